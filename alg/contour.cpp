@@ -39,10 +39,19 @@
 #include "gdal_alg.h"
 #include "cpl_conv.h"
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_srs_api.h"
 #include "ogr_geometry.h"
 
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
 static CPLErr OGRPolygonContourWriter(double dfLevelMin, double dfLevelMax,
                                       const OGRMultiPolygon &multipoly,
                                       void *pInfo)
@@ -210,6 +219,282 @@ struct GDALRingAppender
     void *data_;
 };
 
+/************************************************************************/
+/*                      GDALContourLineCollector                        */
+/************************************************************************/
+
+// Line writer keeping the lines produced from a strip of the raster, so
+// that they can be stitched and written later by the main thread.
+struct GDALContourLineCollector
+{
+    struct Line
+    {
+        double level;
+        marching_squares::LineString ls;
+        bool closed;
+    };
+
+    std::vector<Line> lines{};
+
+    void addLine(double level, marching_squares::LineString &ls, bool closed)
+    {
+        lines.push_back(Line{level, std::move(ls), closed});
+    }
+};
+
+/************************************************************************/
+/*                        GDALContourStripJob                           */
+/************************************************************************/
+
+template <class LevelIterator> struct GDALContourStripJob
+{
+    LevelIterator *poLevels = nullptr;
+    size_t nWidth = 0;
+    size_t nHeight = 0;
+    bool bUseNoData = false;
+    double dfNoDataValue = 0;
+    // Lines [nYOff, nYOff + nYSize[ are contoured from the squares between
+    // each of them and the line above them.
+    size_t nYOff = 0;
+    size_t nYSize = 0;
+    // Line nYOff - 1 (when nYOff > 0), followed by the nYSize lines.
+    std::vector<double> adfData{};
+    GDALContourLineCollector oCollector{};
+    std::string osErrorMsg{};
+};
+
+/************************************************************************/
+/*                      GDALContourProcessStrip()                       */
+/************************************************************************/
+
+template <class LevelIterator> static void GDALContourProcessStrip(void *pData)
+{
+    using namespace marching_squares;
+
+    auto psJob = static_cast<GDALContourStripJob<LevelIterator> *>(pData);
+    try
+    {
+        SegmentMerger<GDALContourLineCollector, LevelIterator> merger(
+            psJob->oCollector, *psJob->poLevels, /* polygonize */ false);
+        ContourGenerator<decltype(merger), LevelIterator> cg(
+            psJob->nWidth, psJob->nHeight, psJob->bUseNoData,
+            psJob->dfNoDataValue, merger, *psJob->poLevels);
+        const double *padfLine = psJob->adfData.data();
+        if (psJob->nYOff > 0)
+        {
+            cg.setStartLine(psJob->nYOff, padfLine);
+            padfLine += psJob->nWidth;
+        }
+        for (size_t i = 0; i < psJob->nYSize; ++i)
+        {
+            cg.feedLine(padfLine);
+            padfLine += psJob->nWidth;
+        }
+    }
+    catch (const std::exception &e)
+    {
+        psJob->osErrorMsg = e.what();
+    }
+}
+
+/************************************************************************/
+/*                     GDALContourGenerateLinesMT()                     */
+/************************************************************************/
+
+// Contour lines of a raster processed as independent horizontal strips, in
+// parallel. Strips share their boundary line, so that a contour crossing
+// from one strip to the next one ends on exactly the same point in both of
+// them. Those fragments are joined once all strips have been processed. The
+// strip height only depends on the raster width, so the output does not
+// depend on the number of threads.
+template <class LevelIterator>
+static bool GDALContourGenerateLinesMT(GDALRasterBandH hBand, bool useNoData,
+                                       double noDataValue,
+                                       LevelIterator &levels,
+                                       GDALRingAppender &appender,
+                                       int nThreads,
+                                       GDALProgressFunc pfnProgress,
+                                       void *pProgressArg)
+{
+    using namespace marching_squares;
+
+    const size_t nWidth = GDALGetRasterBandXSize(hBand);
+    const size_t nHeight = GDALGetRasterBandYSize(hBand);
+    const size_t nStripHeight = std::max<size_t>(
+        16,
+        std::min<size_t>(256, 16 * 1024 * 1024 / (sizeof(double) * nWidth)));
+    const size_t nStrips = (nHeight + nStripHeight - 1) / nStripHeight;
+
+    const auto IsOnStripBoundary = [nStripHeight, nHeight](const Point &pt)
+    {
+        const double dfLine = pt.y + 0.5;
+        if (!(dfLine > 0 && dfLine < static_cast<double>(nHeight)) ||
+            dfLine != std::floor(dfLine))
+            return false;
+        return (static_cast<size_t>(dfLine) % nStripHeight) == 0;
+    };
+
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    auto poJobQueue =
+        poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+
+    // Fragments of contour lines ending on a strip boundary
+    std::vector<GDALContourLineCollector::Line> aoFragments;
+
+    for (size_t iStrip = 0; iStrip < nStrips;
+         iStrip += static_cast<size_t>(nThreads))
+    {
+        const size_t nBatchStrips =
+            std::min(static_cast<size_t>(nThreads), nStrips - iStrip);
+        std::vector<GDALContourStripJob<LevelIterator>> aoJobs(nBatchStrips);
+        for (size_t i = 0; i < nBatchStrips; ++i)
+        {
+            auto &oJob = aoJobs[i];
+            oJob.poLevels = &levels;
+            oJob.nWidth = nWidth;
+            oJob.nHeight = nHeight;
+            oJob.bUseNoData = useNoData;
+            oJob.dfNoDataValue = noDataValue;
+            oJob.nYOff = (iStrip + i) * nStripHeight;
+            oJob.nYSize = std::min(nStripHeight, nHeight - oJob.nYOff);
+            const size_t nReadYOff = oJob.nYOff > 0 ? oJob.nYOff - 1 : 0;
+            const size_t nReadYSize =
+                oJob.nYSize + (oJob.nYOff > 0 ? 1 : 0);
+            oJob.adfData.resize(nWidth * nReadYSize);
+            if (GDALRasterIO(hBand, GF_Read, 0, static_cast<int>(nReadYOff),
+                             static_cast<int>(nWidth),
+                             static_cast<int>(nReadYSize), oJob.adfData.data(),
+                             static_cast<int>(nWidth),
+                             static_cast<int>(nReadYSize), GDT_Float64, 0,
+                             0) != CE_None)
+            {
+                CPLDebug("CONTOUR", "failed fetch %d %d",
+                         static_cast<int>(nReadYOff),
+                         static_cast<int>(nReadYSize));
+                if (poJobQueue)
+                    poJobQueue->WaitCompletion();
+                return false;
+            }
+            if (!poJobQueue ||
+                !poJobQueue->SubmitJob(GDALContourProcessStrip<LevelIterator>,
+                                       &oJob))
+            {
+                GDALContourProcessStrip<LevelIterator>(&oJob);
+            }
+        }
+        if (poJobQueue)
+            poJobQueue->WaitCompletion();
+
+        for (auto &oJob : aoJobs)
+        {
+            if (!oJob.osErrorMsg.empty())
+            {
+                CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                         oJob.osErrorMsg.c_str());
+                return false;
+            }
+            for (auto &oLine : oJob.oCollector.lines)
+            {
+                if (!oLine.closed && !(oLine.ls.front() == oLine.ls.back()) &&
+                    (IsOnStripBoundary(oLine.ls.front()) ||
+                     IsOnStripBoundary(oLine.ls.back())))
+                {
+                    aoFragments.push_back(std::move(oLine));
+                }
+                else
+                {
+                    appender.addLine(oLine.level, oLine.ls, oLine.closed);
+                }
+            }
+        }
+
+        if (!pfnProgress(static_cast<double>(iStrip + nBatchStrips) /
+                             static_cast<double>(nStrips + 1),
+                         "Processing strips", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return false;
+        }
+    }
+
+    // Index fragment ends lying on a strip boundary by (level, x, y)
+    std::map<std::tuple<double, double, double>, std::vector<size_t>> oMapEnds;
+    for (size_t i = 0; i < aoFragments.size(); ++i)
+    {
+        const auto &oFragment = aoFragments[i];
+        for (const Point &pt : {oFragment.ls.front(), oFragment.ls.back()})
+        {
+            if (IsOnStripBoundary(pt))
+                oMapEnds[std::make_tuple(oFragment.level, pt.x, pt.y)]
+                    .push_back(i);
+        }
+    }
+
+    // Join fragments, in the order they were produced
+    std::vector<bool> abUsed(aoFragments.size());
+    for (size_t i = 0; i < aoFragments.size(); ++i)
+    {
+        if (abUsed[i])
+            continue;
+        abUsed[i] = true;
+        const double dfLevel = aoFragments[i].level;
+        LineString &ls = aoFragments[i].ls;
+        bool bClosed = false;
+        for (int iSide = 0; iSide < 2 && !bClosed; ++iSide)
+        {
+            while (true)
+            {
+                const Point ptEnd = iSide == 0 ? ls.back() : ls.front();
+                const auto oIter =
+                    oMapEnds.find(std::make_tuple(dfLevel, ptEnd.x, ptEnd.y));
+                if (oIter == oMapEnds.end())
+                    break;
+                size_t iOther = aoFragments.size();
+                for (size_t j : oIter->second)
+                {
+                    if (!abUsed[j])
+                    {
+                        iOther = j;
+                        break;
+                    }
+                }
+                if (iOther == aoFragments.size())
+                    break;
+                abUsed[iOther] = true;
+                LineString &other = aoFragments[iOther].ls;
+                const bool bOtherStartsAtEnd = other.front() == ptEnd;
+                if (bOtherStartsAtEnd)
+                    other.pop_front();
+                else
+                    other.pop_back();
+                if (iSide == 0)
+                {
+                    if (bOtherStartsAtEnd)
+                        ls.splice(ls.end(), other);
+                    else
+                        ls.insert(ls.end(), other.rbegin(), other.rend());
+                }
+                else
+                {
+                    if (bOtherStartsAtEnd)
+                        ls.insert(ls.begin(), other.rbegin(), other.rend());
+                    else
+                        ls.splice(ls.begin(), other);
+                }
+                if (ls.front() == ls.back())
+                {
+                    bClosed = true;
+                    break;
+                }
+            }
+        }
+        appender.addLine(dfLevel, ls, bClosed);
+    }
+
+    pfnProgress(1.0, "", pProgressArg);
+    return true;
+}
+
 /************************************************************************/
 /* ==================================================================== */
 /*                   Additional C Callable Functions                    */
@@ -545,6 +830,15 @@ mode.
  *
  * If YES, contour polygons will be created, rather than polygon lines.
  *
+ *   NUM_THREADS=number_of_threads|ALL_CPUS
+ *
+ * (GDAL >= 3.10) Number of worker threads used in line contouring mode.
+ * The raster is then processed as horizontal strips in parallel, and the
+ * contour fragments crossing strip boundaries are joined afterwards. The
+ * resulting lines are the same whatever the number of threads, but their
+ * order and starting points may differ from the single-threaded output.
+ * Ignored in polygonal contouring mode. Defaults to 1.
+ *
  *
  * @return CE_None on success or CE_Failure if an error occurs.
  */
@@ -643,6 +937,20 @@ CPLErr GDALContourGenerateEx(GDALRasterBandH hBand, void *hLayer,
 
     bool polygonize = CPLFetchBool(options, "POLYGONIZE", false);
 
+    int nThreads = 1;
+    opt = CSLFetchNameValue(options, "NUM_THREADS");
+    if (opt)
+    {
+        nThreads = EQUAL(opt, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(opt);
+        nThreads = std::max(1, std::min(nThreads, 1024));
+        if (polygonize && nThreads > 1)
+        {
+            CPLDebug("CONTOUR",
+                     "NUM_THREADS ignored in polygonal contouring mode");
+            nThreads = 1;
+        }
+    }
+
     using namespace marching_squares;
 
     OGRContourWriterInfo oCWI;
@@ -740,32 +1048,60 @@ CPLErr GDALContourGenerateEx(GDALRasterBandH hBand, void *hLayer,
             {
                 FixedLevelRangeIterator levels(&fixedLevels[0],
                                                fixedLevels.size());
-                SegmentMerger<GDALRingAppender, FixedLevelRangeIterator> writer(
-                    appender, levels, /* polygonize */ false);
-                ContourGeneratorFromRaster<decltype(writer),
-                                           FixedLevelRangeIterator>
-                    cg(hBand, useNoData, noDataValue, writer, levels);
-                ok = cg.process(pfnProgress, pProgressArg);
+                if (nThreads > 1)
+                {
+                    ok = GDALContourGenerateLinesMT(
+                        hBand, useNoData, noDataValue, levels, appender,
+                        nThreads, pfnProgress, pProgressArg);
+                }
+                else
+                {
+                    SegmentMerger<GDALRingAppender, FixedLevelRangeIterator>
+                        writer(appender, levels, /* polygonize */ false);
+                    ContourGeneratorFromRaster<decltype(writer),
+                                               FixedLevelRangeIterator>
+                        cg(hBand, useNoData, noDataValue, writer, levels);
+                    ok = cg.process(pfnProgress, pProgressArg);
+                }
             }
             else if (expBase > 0.0)
             {
                 ExponentialLevelRangeIterator levels(expBase);
-                SegmentMerger<GDALRingAppender, ExponentialLevelRangeIterator>
-                    writer(appender, levels, /* polygonize */ false);
-                ContourGeneratorFromRaster<decltype(writer),
-                                           ExponentialLevelRangeIterator>
-                    cg(hBand, useNoData, noDataValue, writer, levels);
-                ok = cg.process(pfnProgress, pProgressArg);
+                if (nThreads > 1)
+                {
+                    ok = GDALContourGenerateLinesMT(
+                        hBand, useNoData, noDataValue, levels, appender,
+                        nThreads, pfnProgress, pProgressArg);
+                }
+                else
+                {
+                    SegmentMerger<GDALRingAppender,
+                                  ExponentialLevelRangeIterator>
+                        writer(appender, levels, /* polygonize */ false);
+                    ContourGeneratorFromRaster<decltype(writer),
+                                               ExponentialLevelRangeIterator>
+                        cg(hBand, useNoData, noDataValue, writer, levels);
+                    ok = cg.process(pfnProgress, pProgressArg);
+                }
             }
             else
             {
                 IntervalLevelRangeIterator levels(contourBase, contourInterval);
-                SegmentMerger<GDALRingAppender, IntervalLevelRangeIterator>
-                    writer(appender, levels, /* polygonize */ false);
-                ContourGeneratorFromRaster<decltype(writer),
-                                           IntervalLevelRangeIterator>
-                    cg(hBand, useNoData, noDataValue, writer, levels);
-                ok = cg.process(pfnProgress, pProgressArg);
+                if (nThreads > 1)
+                {
+                    ok = GDALContourGenerateLinesMT(
+                        hBand, useNoData, noDataValue, levels, appender,
+                        nThreads, pfnProgress, pProgressArg);
+                }
+                else
+                {
+                    SegmentMerger<GDALRingAppender, IntervalLevelRangeIterator>
+                        writer(appender, levels, /* polygonize */ false);
+                    ContourGeneratorFromRaster<decltype(writer),
+                                               IntervalLevelRangeIterator>
+                        cg(hBand, useNoData, noDataValue, writer, levels);
+                    ok = cg.process(pfnProgress, pProgressArg);
+                }
             }
         }
     }
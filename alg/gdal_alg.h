@@ -88,6 +88,11 @@ CPLErr CPL_DLL CPL_STDCALL GDALSieveFilter(
     GDALRasterBandH hDstBand, int nSizeThreshold, int nConnectedness,
     char **papszOptions, GDALProgressFunc pfnProgress, void *pProgressArg);
 
+CPLErr CPL_DLL CPL_STDCALL GDALLabelConnectedComponents(
+    GDALRasterBandH hSrcBand, GDALRasterBandH hMaskBand,
+    GDALRasterBandH hDstBand, int nConnectedness, char **papszOptions,
+    GDALProgressFunc pfnProgress, void *pProgressArg);
+
 /*
  * Warp Related.
  */
@@ -36,9 +36,13 @@
 
 #include <cstdint>
 
+#include <memory>
+#include <mutex>
 #include <set>
+#include <vector>
 
 #include "gdal_alg.h"
+#include "ogr_geometry.h"
 #include "ogr_spatialref.h"
 
 CPL_C_START
@@ -371,6 +375,50 @@ struct FloatEqualityTest
     }
 };
 
+/************************************************************************/
+/*                 Strip based connected component labeling             */
+/************************************************************************/
+
+/** Connected components of a raster, as computed by GDALLabelRasterStrips().
+ *
+ * The raster is enumerated as independent strips of nStripHeight lines, and
+ * the polygons crossing strip boundaries are then unioned. The polygon ids of
+ * strip i are the ones GDALEnumerateStripPolygons() assigns to the strip,
+ * offset by anStripIdOffset[i]. anPolyIdMap maps them to the final id of their
+ * component, which is its smallest polygon id: final ids are thus ordered as
+ * the first pixel of the components in raster scan order.
+ */
+template <class DataType> struct GDALRasterStripLabels
+{
+    int nStripHeight = 0;
+    std::vector<GInt32> anPolyIdMap{};
+    std::vector<GInt32> anStripIdOffset{};
+    //! Value of each polygon id (if GDAL_LABEL_POLY_VALUES)
+    std::vector<DataType> aPolyValue{};
+    //! Pixel count of each final id, capped at INT_MAX (if
+    //! GDAL_LABEL_POLY_SIZES)
+    std::vector<int> anPolySize{};
+    //! Final ids of the last line of each strip (if GDAL_LABEL_LAST_LINE_IDS)
+    std::vector<std::vector<GInt32>> aanLastLineId{};
+};
+
+#define GDAL_LABEL_POLY_VALUES 0x1
+#define GDAL_LABEL_POLY_SIZES 0x2
+#define GDAL_LABEL_LAST_LINE_IDS 0x4
+
+int GDALGetLabelStripHeight(int nXSize, int nYSize, size_t nValueSize);
+
+template <class DataType, class EqualityTest>
+bool GDALEnumerateStripPolygons(DataType *paValues, int nXSize, int nLines,
+                                int nConnectedness, GInt32 *panIds);
+
+template <class DataType, class EqualityTest>
+CPLErr GDALLabelRasterStrips(GDALRasterBandH hSrcBand,
+                             GDALRasterBandH hMaskBand, GDALDataType eDT,
+                             int nConnectedness, int nThreads, int nFlags,
+                             GDALRasterStripLabels<DataType> &oLabels,
+                             GDALProgressFunc pfnProgress, void *pProgressArg);
+
 bool GDALComputeAreaOfInterest(OGRSpatialReference *poSRS, double adfGT[6],
                                int nXSize, int nYSize,
                                double &dfWestLongitudeDeg,
@@ -394,6 +442,50 @@ void *GDALCreateGeoLocTransformerEx(GDALDatasetH hBaseDS,
                                     int bReversed, const char *pszSourceDataset,
                                     CSLConstList papszTransformOptions);
 
+/************************************************************************/
+/*                         GDALWarpCutlineIndex                         */
+/************************************************************************/
+
+/** Cutline of a warp operation (in source pixel coordinates), prepared once
+ * for the classification and clipping of all the source chunks it is applied
+ * to. Methods may be called concurrently from several threads.
+ */
+class GDALWarpCutlineIndex
+{
+  public:
+    GDALWarpCutlineIndex(const OGRGeometry *poCutline, double dfBlendDist);
+    ~GDALWarpCutlineIndex();
+
+    int Classify(int nXOff, int nYOff, int nXSize, int nYSize) const;
+    std::unique_ptr<OGRGeometry> Clip(double dfMinX, double dfMinY,
+                                      double dfMaxX, double dfMaxY) const;
+
+  private:
+    CPL_DISALLOW_COPY_ASSIGN(GDALWarpCutlineIndex)
+
+    /** Ring (without its closing point), with the envelopes of runs of
+     * consecutive vertices to quickly skip the parts far from a chunk. */
+    struct Ring
+    {
+        int iPolygon = 0;
+        std::vector<OGRRawPoint> asPoints{};
+        OGREnvelope sEnvelope{};
+        std::vector<OGREnvelope> asRunEnvelopes{};
+    };
+
+    double m_dfBlendDist = 0;
+    OGREnvelope m_sEnvelope{};
+    std::vector<Ring> m_asRings{};
+    OGRPreparedGeometryUniquePtr m_poPreparedCutline{};
+    mutable std::mutex m_oMutex{};
+};
+
+CPLErr GDALWarpCutlineMaskerWithIndex(void *pMaskFuncArg,
+                                      const GDALWarpCutlineIndex *poIndex,
+                                      int nXOff, int nYOff, int nXSize,
+                                      int nYSize, int bMaskIsFloat,
+                                      void *pValidityMask, int *pnValidityFlag);
+
 #endif /* #ifndef DOXYGEN_SKIP */
 
 #endif /* ndef GDAL_ALG_PRIV_H_INCLUDED */
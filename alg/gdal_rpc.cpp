@@ -38,6 +38,7 @@
 #include <algorithm>
 #include <limits>
 #include <string>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -267,6 +268,15 @@ typedef struct
     // the key is (nYBlock << 32) | nXBlock)
     lru11::Cache<uint64_t, std::shared_ptr<std::vector<double>>> *poCacheDEM;
 
+    // DEM window covering the points of the last transform request,
+    // preloaded by GDALRPCPreloadDEMWindow()
+    double *padfDEMWindow;
+    size_t nDEMWindowAlloc;
+    int nDEMWindowXOff;
+    int nDEMWindowYOff;
+    int nDEMWindowXSize;
+    int nDEMWindowYSize;
+
     OGRCoordinateTransformation *poCT;
 
     int nMaxIterations;
@@ -733,6 +743,13 @@ void *GDALCreateRPCTransformerV1(GDALRPCInfoV1 *psRPCInfo, int bReversed,
  * makes sense when debugging point by point, since each time
  * RPCInverseTransformPoint() is called, the file is rewritten).
  *
+ * Starting with GDAL 3.10, when a DEM is used and many points are transformed
+ * from long/lat to pixel/line in a single call, the region of the DEM that
+ * covers all of them is read at once, instead of fetching small windows of
+ * the DEM for each point. The GDAL_RPC_DEM_PRELOAD_MAX_PIXELS configuration
+ * option can be set to the maximum number of pixels of that region (default
+ * is 4194304). Setting it to 0 disables that optimization.
+ *
  * Additional options to the transformer can be supplied in papszOptions.
  *
  * Options:
@@ -1107,6 +1124,7 @@ void GDALDestroyRPCTransformer(void *pTransformAlg)
     if (psTransform->poDS)
         GDALClose(psTransform->poDS);
     delete psTransform->poCacheDEM;
+    VSIFree(psTransform->padfDEMWindow);
     if (psTransform->poCT)
         OCTDestroyCoordinateTransformation(
             reinterpret_cast<OGRCoordinateTransformationH>(psTransform->poCT));
@@ -1392,6 +1410,29 @@ static bool GDALRPCExtractDEMWindow(GDALRPCTransformInfo *psTransform, int nX,
                                     int nY, int nWidth, int nHeight,
                                     double *padfOut)
 {
+    // Fast path when the window is in the DEM region preloaded for the
+    // current transform request
+    if (psTransform->padfDEMWindow && nX >= psTransform->nDEMWindowXOff &&
+        nY >= psTransform->nDEMWindowYOff &&
+        nX + nWidth <=
+            psTransform->nDEMWindowXOff + psTransform->nDEMWindowXSize &&
+        nY + nHeight <=
+            psTransform->nDEMWindowYOff + psTransform->nDEMWindowYSize)
+    {
+        const size_t nWindowXSize = psTransform->nDEMWindowXSize;
+        const double *padfSrc =
+            psTransform->padfDEMWindow +
+            static_cast<size_t>(nY - psTransform->nDEMWindowYOff) *
+                nWindowXSize +
+            (nX - psTransform->nDEMWindowXOff);
+        for (int j = 0; j < nHeight; j++)
+        {
+            memcpy(padfOut + j * nWidth, padfSrc + j * nWindowXSize,
+                   nWidth * sizeof(double));
+        }
+        return true;
+    }
+
     constexpr int BLOCK_SIZE = 64;
 
     // Request the DEM by blocks of BLOCK_SIZE * BLOCK_SIZE and put them
@@ -2032,6 +2073,126 @@ static bool GDALRPCOpenDEM(GDALRPCTransformInfo *psTransform)
     return bIsValid;
 }
 
+/************************************************************************/
+/*                       GDALRPCPreloadDEMWindow()                      */
+/************************************************************************/
+
+// Read in psTransform->padfDEMWindow the region of the DEM that covers the
+// long/lat points to transform, if it is not already loaded, so that
+// GDALRPCExtractDEMWindow() does not need to go through poCacheDEM for each
+// point. Points outside of that region still go through poCacheDEM.
+static void GDALRPCPreloadDEMWindow(GDALRPCTransformInfo *psTransform,
+                                    int nPointCount, const double *padfX,
+                                    const double *padfY)
+{
+    const GIntBig nMaxPixels = CPLAtoGIntBig(
+        CPLGetConfigOption("GDAL_RPC_DEM_PRELOAD_MAX_PIXELS", "4194304"));
+    if (nMaxPixels <= 0)
+        return;
+
+    std::vector<double> adfX;
+    std::vector<double> adfY;
+    const double *padfLong = padfX;
+    const double *padfLat = padfY;
+    if (psTransform->poCT)
+    {
+        adfX.assign(padfX, padfX + nPointCount);
+        adfY.assign(padfY, padfY + nPointCount);
+        std::vector<int> abSuccess(nPointCount);
+        psTransform->poCT->Transform(nPointCount, adfX.data(), adfY.data(),
+                                     nullptr, abSuccess.data());
+        for (int i = 0; i < nPointCount; i++)
+        {
+            if (!abSuccess[i])
+                adfX[i] = HUGE_VAL;
+        }
+        padfLong = adfX.data();
+        padfLat = adfY.data();
+    }
+
+    double dfMinX = std::numeric_limits<double>::max();
+    double dfMinY = std::numeric_limits<double>::max();
+    double dfMaxX = -std::numeric_limits<double>::max();
+    double dfMaxY = -std::numeric_limits<double>::max();
+    for (int i = 0; i < nPointCount; i++)
+    {
+        if (padfLong[i] == HUGE_VAL || std::isnan(padfLong[i]) ||
+            std::isnan(padfLat[i]))
+            continue;
+        double dfX = 0.0;
+        double dfY = 0.0;
+        GDALApplyGeoTransform(psTransform->adfDEMReverseGeoTransform,
+                              padfLong[i], padfLat[i], &dfX, &dfY);
+        dfMinX = std::min(dfMinX, dfX);
+        dfMinY = std::min(dfMinY, dfY);
+        dfMaxX = std::max(dfMaxX, dfX);
+        dfMaxY = std::max(dfMaxY, dfY);
+    }
+    if (!(dfMinX <= dfMaxX && dfMinY <= dfMaxY))
+        return;
+
+    // Take into account the kernel of the cubic resampling, and add a margin
+    // so that the window can be reused by subsequent requests on neighbouring
+    // points.
+    constexpr int MARGIN = 16;
+    const int nRasterXSize = psTransform->poDS->GetRasterXSize();
+    const int nRasterYSize = psTransform->poDS->GetRasterYSize();
+    const double dfXOff =
+        std::max(0.0, std::floor(dfMinX - 0.5) - 1 - MARGIN);
+    const double dfYOff =
+        std::max(0.0, std::floor(dfMinY - 0.5) - 1 - MARGIN);
+    const double dfXEnd = std::min(static_cast<double>(nRasterXSize),
+                                   std::floor(dfMaxX) + 3 + MARGIN);
+    const double dfYEnd = std::min(static_cast<double>(nRasterYSize),
+                                   std::floor(dfMaxY) + 3 + MARGIN);
+    if (!(dfXOff < dfXEnd && dfYOff < dfYEnd) ||
+        (dfXEnd - dfXOff) * (dfYEnd - dfYOff) > static_cast<double>(nMaxPixels))
+    {
+        return;
+    }
+    const int nXOff = static_cast<int>(dfXOff);
+    const int nYOff = static_cast<int>(dfYOff);
+    const int nXSize = static_cast<int>(dfXEnd) - nXOff;
+    const int nYSize = static_cast<int>(dfYEnd) - nYOff;
+
+    // Nothing to do if the currently preloaded window is large enough
+    if (psTransform->padfDEMWindow &&
+        nXOff >= psTransform->nDEMWindowXOff &&
+        nYOff >= psTransform->nDEMWindowYOff &&
+        nXOff + nXSize <=
+            psTransform->nDEMWindowXOff + psTransform->nDEMWindowXSize &&
+        nYOff + nYSize <=
+            psTransform->nDEMWindowYOff + psTransform->nDEMWindowYSize)
+    {
+        return;
+    }
+
+    const size_t nPixels = static_cast<size_t>(nXSize) * nYSize;
+    if (nPixels > psTransform->nDEMWindowAlloc)
+    {
+        VSIFree(psTransform->padfDEMWindow);
+        psTransform->nDEMWindowAlloc = 0;
+        psTransform->padfDEMWindow = static_cast<double *>(
+            VSI_MALLOC2_VERBOSE(nPixels, sizeof(double)));
+        if (psTransform->padfDEMWindow == nullptr)
+            return;
+        psTransform->nDEMWindowAlloc = nPixels;
+    }
+    if (psTransform->poDS->GetRasterBand(1)->RasterIO(
+            GF_Read, nXOff, nYOff, nXSize, nYSize, psTransform->padfDEMWindow,
+            nXSize, nYSize, GDT_Float64, 0, 0, nullptr) != CE_None)
+    {
+        VSIFree(psTransform->padfDEMWindow);
+        psTransform->padfDEMWindow = nullptr;
+        psTransform->nDEMWindowAlloc = 0;
+        return;
+    }
+    psTransform->nDEMWindowXOff = nXOff;
+    psTransform->nDEMWindowYOff = nYOff;
+    psTransform->nDEMWindowXSize = nXSize;
+    psTransform->nDEMWindowYSize = nYSize;
+}
+
 /************************************************************************/
 /*                          GDALRPCTransform()                          */
 /************************************************************************/
@@ -2146,6 +2307,11 @@ int GDALRPCTransform(void *pTransformArg, int bDstToSrc, int nPointCount,
             }
         }
 
+        if (nPointCount >= 10 && psTransform->poDS != nullptr)
+        {
+            GDALRPCPreloadDEMWindow(psTransform, nPointCount, padfX, padfY);
+        }
+
         for (int i = 0; i < nPointCount; i++)
         {
             if (!RPCIsValidLongLat(psTransform, padfX[i], padfY[i]))
@@ -32,6 +32,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <algorithm>
 #include <map>
 #include <utility>
 
@@ -45,6 +46,7 @@
 #include "gdal_alg.h"
 #include "gdal_alg_priv.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "gdalgenericinverse.h"
 
 CPL_C_START
@@ -64,6 +66,10 @@ struct TPSTransformInfo
 
     bool bReversed{};
 
+    // Number of threads used to solve the systems and to transform batches
+    // of points.
+    int nThreads = 1;
+
     std::vector<gdal::GCP> asGCPs{};
 
     volatile int nRefCount{};
@@ -261,16 +267,18 @@ void *GDALCreateTPSTransformerInt(int nGCPCount, const GDAL_GCP *pasGCPList,
             nThreads = atoi(pszWarpThreads);
     }
 
-    if (nThreads > 1)
+    psInfo->nThreads = GDALCapThreadCount(std::max(1, nThreads));
+
+    CPLWorkerThreadPool *poThreadPool =
+        psInfo->nThreads > 1 ? GDALGetGlobalThreadPool(psInfo->nThreads)
+                             : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (poJobQueue && poJobQueue->SubmitJob(GDALTPSComputeForwardInThread,
+                                            psInfo))
     {
         // Compute direct and reverse transforms in parallel.
-        CPLJoinableThread *hThread =
-            CPLCreateJoinableThread(GDALTPSComputeForwardInThread, psInfo);
         psInfo->bReverseSolved = psInfo->poReverse->solve() != 0;
-        if (hThread != nullptr)
-            CPLJoinThread(hThread);
-        else
-            psInfo->bForwardSolved = psInfo->poForward->solve() != 0;
+        poJobQueue->WaitCompletion();
     }
     else
     {
@@ -319,38 +327,30 @@ void GDALDestroyTPSTransformer(void *pTransformArg)
 }
 
 /************************************************************************/
-/*                          GDALTPSTransform()                          */
+/*                         GDALTPSTransformJob                          */
 /************************************************************************/
 
-/**
- * Transforms point based on GCP derived polynomial model.
- *
- * This function matches the GDALTransformerFunc signature, and can be
- * used to transform one or more points from pixel/line coordinates to
- * georeferenced coordinates (SrcToDst) or vice versa (DstToSrc).
- *
- * @param pTransformArg return value from GDALCreateTPSTransformer().
- * @param bDstToSrc TRUE if transformation is from the destination
- * (georeferenced) coordinates to pixel/line or FALSE when transforming
- * from pixel/line to georeferenced coordinates.
- * @param nPointCount the number of values in the x, y and z arrays.
- * @param x array containing the X values to be transformed.
- * @param y array containing the Y values to be transformed.
- * @param z array containing the Z values to be transformed.
- * @param panSuccess array in which a flag indicating success (TRUE) or
- * failure (FALSE) of the transformation are placed.
- *
- * @return TRUE.
- */
-
-int GDALTPSTransform(void *pTransformArg, int bDstToSrc, int nPointCount,
-                     double *x, double *y, CPL_UNUSED double *z,
-                     int *panSuccess)
+namespace
 {
-    VALIDATE_POINTER1(pTransformArg, "GDALTPSTransform", 0);
+struct GDALTPSTransformJob
+{
+    TPSTransformInfo *psInfo = nullptr;
+    int bDstToSrc = FALSE;
+    int nPointCount = 0;
+    double *x = nullptr;
+    double *y = nullptr;
+    int *panSuccess = nullptr;
+};
+}  // namespace
 
-    TPSTransformInfo *psInfo = static_cast<TPSTransformInfo *>(pTransformArg);
+/************************************************************************/
+/*                       GDALTPSTransformPoints()                       */
+/************************************************************************/
 
+static void GDALTPSTransformPoints(TPSTransformInfo *psInfo, int bDstToSrc,
+                                   int nPointCount, double *x, double *y,
+                                   int *panSuccess)
+{
     for (int i = 0; i < nPointCount; i++)
     {
         double xy_out[2] = {0.0, 0.0};
@@ -391,6 +391,95 @@ int GDALTPSTransform(void *pTransformArg, int bDstToSrc, int nPointCount,
         }
         panSuccess[i] = TRUE;
     }
+}
+
+/************************************************************************/
+/*                      GDALTPSTransformInThread()                      */
+/************************************************************************/
+
+static void GDALTPSTransformInThread(void *pData)
+{
+    auto psJob = static_cast<GDALTPSTransformJob *>(pData);
+    GDALTPSTransformPoints(psJob->psInfo, psJob->bDstToSrc,
+                           psJob->nPointCount, psJob->x, psJob->y,
+                           psJob->panSuccess);
+}
+
+/************************************************************************/
+/*                          GDALTPSTransform()                          */
+/************************************************************************/
+
+/**
+ * Transforms point based on GCP derived polynomial model.
+ *
+ * This function matches the GDALTransformerFunc signature, and can be
+ * used to transform one or more points from pixel/line coordinates to
+ * georeferenced coordinates (SrcToDst) or vice versa (DstToSrc).
+ *
+ * @param pTransformArg return value from GDALCreateTPSTransformer().
+ * @param bDstToSrc TRUE if transformation is from the destination
+ * (georeferenced) coordinates to pixel/line or FALSE when transforming
+ * from pixel/line to georeferenced coordinates.
+ * @param nPointCount the number of values in the x, y and z arrays.
+ * @param x array containing the X values to be transformed.
+ * @param y array containing the Y values to be transformed.
+ * @param z array containing the Z values to be transformed.
+ * @param panSuccess array in which a flag indicating success (TRUE) or
+ * failure (FALSE) of the transformation are placed.
+ *
+ * @return TRUE.
+ */
+
+int GDALTPSTransform(void *pTransformArg, int bDstToSrc, int nPointCount,
+                     double *x, double *y, CPL_UNUSED double *z,
+                     int *panSuccess)
+{
+    VALIDATE_POINTER1(pTransformArg, "GDALTPSTransform", 0);
+
+    TPSTransformInfo *psInfo = static_cast<TPSTransformInfo *>(pTransformArg);
+
+    // Each point evaluation costs O(number of GCPs). Spread big enough
+    // requests over the global thread pool. When this function is itself
+    // called from a worker thread of that pool, e.g. by the warping kernel,
+    // the pool runs the jobs synchronously if no other worker is available.
+    constexpr double MIN_WORK_PER_THREAD = 1e6;
+    const int nThreads = static_cast<int>(std::min<double>(
+        std::min(psInfo->nThreads, nPointCount),
+        static_cast<double>(nPointCount) *
+            static_cast<double>(psInfo->asGCPs.size()) / MIN_WORK_PER_THREAD));
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (poJobQueue)
+    {
+        std::vector<GDALTPSTransformJob> asJobs(nThreads);
+        const int nPointsPerJob = DIV_ROUND_UP(nPointCount, nThreads);
+        for (int iJob = 0; iJob < nThreads; ++iJob)
+        {
+            auto &sJob = asJobs[iJob];
+            const int iStart = iJob * nPointsPerJob;
+            sJob.psInfo = psInfo;
+            sJob.bDstToSrc = bDstToSrc;
+            sJob.nPointCount =
+                std::max(0, std::min(nPointsPerJob, nPointCount - iStart));
+            if (sJob.nPointCount == 0)
+                break;
+            sJob.x = x + iStart;
+            sJob.y = y + iStart;
+            sJob.panSuccess = panSuccess + iStart;
+            // The last job is run in the current thread, as well as the
+            // ones that could not be queued.
+            if (iJob + 1 == nThreads ||
+                !poJobQueue->SubmitJob(GDALTPSTransformInThread, &sJob))
+            {
+                GDALTPSTransformInThread(&sJob);
+            }
+        }
+        poJobQueue->WaitCompletion();
+        return TRUE;
+    }
+
+    GDALTPSTransformPoints(psInfo, bDstToSrc, nPointCount, x, y, panSuccess);
 
     return TRUE;
 }
@@ -34,12 +34,16 @@
 #include <cstdio>
 #include <cstring>
 #include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_string.h"
 #include "gdal.h"
 #include "gdal_alg.h"
+#include "gdal_alg_priv.h"
 #include "gdal_priv.h"
 #include "memdataset.h"
 #include "ogr_api.h"
@@ -230,6 +234,272 @@ static int CutlineTransformer(void *pTransformArg, int bDstToSrc,
     return TRUE;
 }
 
+/************************************************************************/
+/*                        GDALWarpCutlineIndex()                        */
+/************************************************************************/
+
+// Number of consecutive vertices whose envelope is stored
+constexpr size_t CUTLINE_RUN_SIZE = 256;
+
+GDALWarpCutlineIndex::GDALWarpCutlineIndex(const OGRGeometry *poCutline,
+                                           double dfBlendDist)
+    : m_dfBlendDist(dfBlendDist)
+{
+    poCutline->getEnvelope(&m_sEnvelope);
+
+    const auto AddPolygon = [this](const OGRPolygon *poPoly, int iPolygon)
+    {
+        for (const auto *poLR : *poPoly)
+        {
+            const int nPoints = poLR->getNumPoints();
+            if (nPoints < 4)
+                continue;
+            Ring oRing;
+            oRing.iPolygon = iPolygon;
+            oRing.asPoints.resize(nPoints - 1);
+            for (int i = 0; i < nPoints - 1; ++i)
+            {
+                oRing.asPoints[i].x = poLR->getX(i);
+                oRing.asPoints[i].y = poLR->getY(i);
+            }
+            poLR->getEnvelope(&oRing.sEnvelope);
+
+            // Run i spans vertices [i * CUTLINE_RUN_SIZE,
+            // (i + 1) * CUTLINE_RUN_SIZE], so that consecutive runs share
+            // a vertex
+            for (size_t iStart = 0; iStart + 1 < oRing.asPoints.size();
+                 iStart += CUTLINE_RUN_SIZE)
+            {
+                const size_t iEnd = std::min(iStart + CUTLINE_RUN_SIZE,
+                                             oRing.asPoints.size() - 1);
+                OGREnvelope sRunEnvelope;
+                for (size_t i = iStart; i <= iEnd; ++i)
+                    sRunEnvelope.Merge(oRing.asPoints[i].x,
+                                       oRing.asPoints[i].y);
+                oRing.asRunEnvelopes.push_back(sRunEnvelope);
+            }
+            m_asRings.push_back(std::move(oRing));
+        }
+    };
+
+    const auto eType = wkbFlatten(poCutline->getGeometryType());
+    if (eType == wkbPolygon)
+    {
+        AddPolygon(poCutline->toPolygon(), 0);
+    }
+    else if (eType == wkbMultiPolygon)
+    {
+        int iPolygon = 0;
+        for (const auto *poPoly : *(poCutline->toMultiPolygon()))
+            AddPolygon(poPoly, iPolygon++);
+    }
+
+    m_poPreparedCutline.reset(OGRCreatePreparedGeometry(
+        OGRGeometry::ToHandle(const_cast<OGRGeometry *>(poCutline))));
+}
+
+/************************************************************************/
+/*                       ~GDALWarpCutlineIndex()                        */
+/************************************************************************/
+
+GDALWarpCutlineIndex::~GDALWarpCutlineIndex() = default;
+
+/************************************************************************/
+/*                              Classify()                              */
+/************************************************************************/
+
+/** Returns whether the source chunk, extended by the blend distance, is
+ * outside of the cutline (GCMVF_NO_INTERSECTION), fully within it
+ * (GCMVF_CHUNK_FULLY_WITHIN_CUTLINE), or crosses it
+ * (GCMVF_PARTIAL_INTERSECTION). */
+int GDALWarpCutlineIndex::Classify(int nXOff, int nYOff, int nXSize,
+                                   int nYSize) const
+{
+    OGREnvelope sChunkEnvelope;
+    sChunkEnvelope.MinX = nXOff - m_dfBlendDist;
+    sChunkEnvelope.MinY = nYOff - m_dfBlendDist;
+    sChunkEnvelope.MaxX = static_cast<double>(nXOff) + nXSize + m_dfBlendDist;
+    sChunkEnvelope.MaxY = static_cast<double>(nYOff) + nYSize + m_dfBlendDist;
+
+    if (!m_sEnvelope.Intersects(sChunkEnvelope))
+        return GCMVF_NO_INTERSECTION;
+    if (!m_poPreparedCutline)
+        return GCMVF_PARTIAL_INTERSECTION;
+
+    auto poRing = std::make_unique<OGRLinearRing>();
+    poRing->addPoint(sChunkEnvelope.MinX, sChunkEnvelope.MinY);
+    poRing->addPoint(sChunkEnvelope.MinX, sChunkEnvelope.MaxY);
+    poRing->addPoint(sChunkEnvelope.MaxX, sChunkEnvelope.MaxY);
+    poRing->addPoint(sChunkEnvelope.MaxX, sChunkEnvelope.MinY);
+    poRing->addPoint(sChunkEnvelope.MinX, sChunkEnvelope.MinY);
+    OGRPolygon oChunkFootprint;
+    oChunkFootprint.addRingDirectly(poRing.release());
+    OGRGeometryH hChunkFootprint = OGRGeometry::ToHandle(&oChunkFootprint);
+
+    // Prepared geometries are not safe for concurrent use
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    if (!OGRPreparedGeometryIntersects(m_poPreparedCutline.get(),
+                                       hChunkFootprint))
+        return GCMVF_NO_INTERSECTION;
+    if (m_sEnvelope.Contains(sChunkEnvelope) &&
+        OGRPreparedGeometryContains(m_poPreparedCutline.get(),
+                                    hChunkFootprint))
+        return GCMVF_CHUNK_FULLY_WITHIN_CUTLINE;
+    return GCMVF_PARTIAL_INTERSECTION;
+}
+
+/************************************************************************/
+/*                          ClipToHalfPlane()                           */
+/************************************************************************/
+
+// One Sutherland-Hodgman step: keeps the part of the closed ring
+// that is inside the half-plane.
+template <class InsideFunc, class IntersectFunc>
+static void ClipToHalfPlane(const std::vector<OGRRawPoint> &asIn,
+                            std::vector<OGRRawPoint> &asOut,
+                            InsideFunc IsInside, IntersectFunc Intersect)
+{
+    asOut.clear();
+    if (asIn.empty())
+        return;
+    OGRRawPoint sPrev = asIn.back();
+    bool bPrevInside = IsInside(sPrev);
+    for (const auto &sCur : asIn)
+    {
+        const bool bCurInside = IsInside(sCur);
+        if (bCurInside != bPrevInside)
+            asOut.push_back(Intersect(sPrev, sCur));
+        if (bCurInside)
+            asOut.push_back(sCur);
+        sPrev = sCur;
+        bPrevInside = bCurInside;
+    }
+}
+
+/************************************************************************/
+/*                      IntersectAtX() / IntersectAtY()                 */
+/************************************************************************/
+
+static OGRRawPoint IntersectAtX(const OGRRawPoint &a, const OGRRawPoint &b,
+                                double dfX)
+{
+    return OGRRawPoint(dfX, a.y + (b.y - a.y) * (dfX - a.x) / (b.x - a.x));
+}
+
+static OGRRawPoint IntersectAtY(const OGRRawPoint &a, const OGRRawPoint &b,
+                                double dfY)
+{
+    return OGRRawPoint(a.x + (b.x - a.x) * (dfY - a.y) / (b.y - a.y), dfY);
+}
+
+/************************************************************************/
+/*                                Clip()                                */
+/************************************************************************/
+
+/** Returns the cutline clipped to the passed rectangle, such that the
+ * even-odd filling of its rings within the rectangle is the same as the one
+ * of the full cutline, or nullptr if no part of the cutline is inside it.
+ *
+ * Rings entirely within the rectangle are returned unchanged. Other rings
+ * are clipped, possibly creating degenerate edges on the rectangle boundary,
+ * so the rectangle should be larger than the area to rasterize.
+ */
+std::unique_ptr<OGRGeometry> GDALWarpCutlineIndex::Clip(double dfMinX,
+                                                       double dfMinY,
+                                                       double dfMaxX,
+                                                       double dfMaxY) const
+{
+    OGREnvelope sClipEnvelope;
+    sClipEnvelope.MinX = dfMinX;
+    sClipEnvelope.MinY = dfMinY;
+    sClipEnvelope.MaxX = dfMaxX;
+    sClipEnvelope.MaxY = dfMaxY;
+
+    const auto IsDisjoint = [&sClipEnvelope](const OGREnvelope &sEnv)
+    {
+        return sEnv.MaxX < sClipEnvelope.MinX ||
+               sEnv.MinX > sClipEnvelope.MaxX ||
+               sEnv.MaxY < sClipEnvelope.MinY || sEnv.MinY > sClipEnvelope.MaxY;
+    };
+
+    auto poMP = std::make_unique<OGRMultiPolygon>();
+    OGRPolygon *poCurPoly = nullptr;
+    int iCurPolygon = -1;
+    std::vector<OGRRawPoint> asTmp1;
+    std::vector<OGRRawPoint> asTmp2;
+    for (const auto &oRing : m_asRings)
+    {
+        if (IsDisjoint(oRing.sEnvelope))
+            continue;
+
+        const std::vector<OGRRawPoint> *pasPoints = &oRing.asPoints;
+        if (!sClipEnvelope.Contains(oRing.sEnvelope))
+        {
+            // Replace the inner vertices of runs entirely outside the
+            // rectangle by a straight segment between their extremities:
+            // this does not change the winding number of the ring around
+            // points of the rectangle.
+            asTmp1.clear();
+            for (size_t iRun = 0; iRun < oRing.asRunEnvelopes.size(); ++iRun)
+            {
+                const size_t iStart = iRun * CUTLINE_RUN_SIZE;
+                const size_t iEnd = std::min(iStart + CUTLINE_RUN_SIZE,
+                                             oRing.asPoints.size() - 1);
+                if (IsDisjoint(oRing.asRunEnvelopes[iRun]))
+                {
+                    asTmp1.push_back(oRing.asPoints[iStart]);
+                }
+                else
+                {
+                    asTmp1.insert(asTmp1.end(),
+                                  oRing.asPoints.begin() + iStart,
+                                  oRing.asPoints.begin() + iEnd);
+                }
+            }
+            asTmp1.push_back(oRing.asPoints.back());
+
+            ClipToHalfPlane(
+                asTmp1, asTmp2,
+                [dfMinX](const OGRRawPoint &p) { return p.x >= dfMinX; },
+                [dfMinX](const OGRRawPoint &a, const OGRRawPoint &b)
+                { return IntersectAtX(a, b, dfMinX); });
+            ClipToHalfPlane(
+                asTmp2, asTmp1,
+                [dfMaxX](const OGRRawPoint &p) { return p.x <= dfMaxX; },
+                [dfMaxX](const OGRRawPoint &a, const OGRRawPoint &b)
+                { return IntersectAtX(a, b, dfMaxX); });
+            ClipToHalfPlane(
+                asTmp1, asTmp2,
+                [dfMinY](const OGRRawPoint &p) { return p.y >= dfMinY; },
+                [dfMinY](const OGRRawPoint &a, const OGRRawPoint &b)
+                { return IntersectAtY(a, b, dfMinY); });
+            ClipToHalfPlane(
+                asTmp2, asTmp1,
+                [dfMaxY](const OGRRawPoint &p) { return p.y <= dfMaxY; },
+                [dfMaxY](const OGRRawPoint &a, const OGRRawPoint &b)
+                { return IntersectAtY(a, b, dfMaxY); });
+            if (asTmp1.size() < 3)
+                continue;
+            pasPoints = &asTmp1;
+        }
+
+        auto poLR = std::make_unique<OGRLinearRing>();
+        poLR->setPoints(static_cast<int>(pasPoints->size()), pasPoints->data());
+        poLR->closeRings();
+        if (oRing.iPolygon != iCurPolygon)
+        {
+            poCurPoly = new OGRPolygon();
+            poMP->addGeometryDirectly(poCurPoly);
+            iCurPolygon = oRing.iPolygon;
+        }
+        poCurPoly->addRingDirectly(poLR.release());
+    }
+
+    if (poMP->IsEmpty())
+        return nullptr;
+    return poMP;
+}
+
 /************************************************************************/
 /*                       GDALWarpCutlineMasker()                        */
 /*                                                                      */
@@ -254,6 +524,26 @@ CPLErr GDALWarpCutlineMaskerEx(void *pMaskFuncArg, int /* nBandCount */,
                                GByte ** /*ppImageData */, int bMaskIsFloat,
                                void *pValidityMask, int *pnValidityFlag)
 
+{
+    return GDALWarpCutlineMaskerWithIndex(pMaskFuncArg, nullptr, nXOff, nYOff,
+                                          nXSize, nYSize, bMaskIsFloat,
+                                          pValidityMask, pnValidityFlag);
+}
+
+/************************************************************************/
+/*                   GDALWarpCutlineMaskerWithIndex()                   */
+/************************************************************************/
+
+/** Same as GDALWarpCutlineMaskerEx(), using the optional poIndex, built from
+ * the cutline of the warp options, to classify the chunk and to only
+ * rasterize the part of the cutline that is near it.
+ */
+CPLErr GDALWarpCutlineMaskerWithIndex(void *pMaskFuncArg,
+                                      const GDALWarpCutlineIndex *poIndex,
+                                      int nXOff, int nYOff, int nXSize,
+                                      int nYSize, int bMaskIsFloat,
+                                      void *pValidityMask, int *pnValidityFlag)
+
 {
     if (pnValidityFlag)
         *pnValidityFlag = GCMVF_PARTIAL_INTERSECTION;
@@ -304,10 +594,37 @@ CPLErr GDALWarpCutlineMaskerEx(void *pMaskFuncArg, int /* nBandCount */,
 
     float *pafMask = static_cast<float *>(pValidityMask);
 
-    if (sEnvelope.MaxX + psWO->dfCutlineBlendDist < nXOff ||
-        sEnvelope.MinX - psWO->dfCutlineBlendDist > nXOff + nXSize ||
-        sEnvelope.MaxY + psWO->dfCutlineBlendDist < nYOff ||
-        sEnvelope.MinY - psWO->dfCutlineBlendDist > nYOff + nYSize)
+    const bool bSkipContainmentTest =
+#ifdef DEBUG
+        // Env var just for debugging purposes
+        CPLTestBool(
+            CPLGetConfigOption("GDALCUTLINE_SKIP_CONTAINMENT_TEST", "NO"));
+#else
+        false;
+#endif
+
+    if (poIndex)
+    {
+        const int nClass = poIndex->Classify(nXOff, nYOff, nXSize, nYSize);
+        if (nClass == GCMVF_NO_INTERSECTION)
+        {
+            if (pnValidityFlag)
+                *pnValidityFlag = GCMVF_NO_INTERSECTION;
+            memset(pafMask, 0, sizeof(float) * nXSize * nYSize);
+            return CE_None;
+        }
+        if (nClass == GCMVF_CHUNK_FULLY_WITHIN_CUTLINE && !bSkipContainmentTest)
+        {
+            if (pnValidityFlag)
+                *pnValidityFlag = GCMVF_CHUNK_FULLY_WITHIN_CUTLINE;
+            CPLDebug("WARP", "Source chunk fully contained within cutline.");
+            return CE_None;
+        }
+    }
+    else if (sEnvelope.MaxX + psWO->dfCutlineBlendDist < nXOff ||
+             sEnvelope.MinX - psWO->dfCutlineBlendDist > nXOff + nXSize ||
+             sEnvelope.MaxY + psWO->dfCutlineBlendDist < nYOff ||
+             sEnvelope.MinY - psWO->dfCutlineBlendDist > nYOff + nYSize)
     {
         if (pnValidityFlag)
             *pnValidityFlag = GCMVF_NO_INTERSECTION;
@@ -321,13 +638,7 @@ CPLErr GDALWarpCutlineMaskerEx(void *pMaskFuncArg, int /* nBandCount */,
 
     // And now check if the chunk to warp is fully contained within the cutline
     // to save rasterization.
-    if (OGRGeometryFactory::haveGEOS()
-#ifdef DEBUG
-        // Env var just for debugging purposes
-        && !CPLTestBool(
-               CPLGetConfigOption("GDALCUTLINE_SKIP_CONTAINMENT_TEST", "NO"))
-#endif
-    )
+    if (!poIndex && OGRGeometryFactory::haveGEOS() && !bSkipContainmentTest)
     {
         OGRLinearRing *poRing = new OGRLinearRing();
         poRing->addPoint(-psWO->dfCutlineBlendDist + nXOff,
@@ -384,9 +695,28 @@ CPLErr GDALWarpCutlineMaskerEx(void *pMaskFuncArg, int /* nBandCount */,
 
     int anXYOff[2] = {nXOff, nYOff};
 
-    CPLErr eErr = GDALRasterizeGeometries(
-        hMemDS, 1, &nTargetBand, 1, &hPolygon, CutlineTransformer, anXYOff,
-        &dfBurnValue, papszRasterizeOptions, nullptr, nullptr);
+    // Only rasterize the part of the cutline near the chunk, with a margin
+    // so that the edges created by the clipping are not burnt.
+    OGRGeometryH hPolygonToBurn = hPolygon;
+    std::unique_ptr<OGRGeometry> poClippedPolygon;
+    if (poIndex)
+    {
+        constexpr double MARGIN = 2;
+        poClippedPolygon = poIndex->Clip(
+            nXOff - MARGIN, nYOff - MARGIN,
+            static_cast<double>(nXOff) + nXSize + MARGIN,
+            static_cast<double>(nYOff) + nYSize + MARGIN);
+        hPolygonToBurn = OGRGeometry::ToHandle(poClippedPolygon.get());
+    }
+
+    CPLErr eErr = CE_None;
+    if (hPolygonToBurn)
+    {
+        eErr = GDALRasterizeGeometries(hMemDS, 1, &nTargetBand, 1,
+                                       &hPolygonToBurn, CutlineTransformer,
+                                       anXYOff, &dfBurnValue,
+                                       papszRasterizeOptions, nullptr, nullptr);
+    }
 
     CSLDestroy(papszRasterizeOptions);
 
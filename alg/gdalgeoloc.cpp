@@ -42,7 +42,10 @@
 #include <cstring>
 
 #include <algorithm>
+#include <functional>
 #include <limits>
+#include <type_traits>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -50,8 +53,10 @@
 #include "cpl_quad_tree.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "memdataset.h"
 
 constexpr float INVALID_BMXY = -10.0f;
@@ -1006,6 +1011,48 @@ void GDALInverseBilinearInterpolation(const double x, const double y,
     j += s;
 }
 
+/************************************************************************/
+/*                       GDALGeoLocBackMapSample                        */
+/************************************************************************/
+
+// Where a sample of the geolocation array lands into the backmap
+struct GDALGeoLocBackMapSample
+{
+    int iBMX = 0;
+    int iBMY = 0;
+    bool bMatchingGeoLocCellFound = false;
+    // Set when bMatchingGeoLocCellFound
+    float fBMX = 0;
+    float fBMY = 0;
+    // Set when !bMatchingGeoLocCellFound
+    double dfX = 0;
+    double dfY = 0;
+    double fracBMX = 0;
+    double fracBMY = 0;
+};
+
+/************************************************************************/
+/*                        GDALGeoLocBackMapJob                          */
+/************************************************************************/
+
+struct GDALGeoLocBackMapJob
+{
+    std::function<void()> pfnProcess{};
+    std::vector<GDALGeoLocBackMapSample> asSamples{};
+    OGRPoint oPoint{};
+    OGRLinearRing oRing{};
+
+    GDALGeoLocBackMapJob()
+    {
+        oRing.setNumPoints(5);
+    }
+};
+
+static void GDALGeoLocBackMapJobFunc(void *pData)
+{
+    static_cast<GDALGeoLocBackMapJob *>(pData)->pfnProcess();
+}
+
 /************************************************************************/
 /*                       GeoLocGenerateBackMap()                        */
 /************************************************************************/
@@ -1151,12 +1198,6 @@ bool GDALGeoLoc<Accessors>::GenerateBackMap(
         }
     };
 
-    // Keep those objects in this outer scope, so they are re-used, to
-    // save memory allocations.
-    OGRPoint oPoint;
-    OGRLinearRing oRing;
-    oRing.setNumPoints(5);
-
     /* -------------------------------------------------------------------- */
     /*      Run through the whole geoloc array forward projecting and       */
     /*      pushing into the backmap.                                       */
@@ -1214,219 +1255,327 @@ bool GDALGeoLoc<Accessors>::GenerateBackMap(
         xStartEnd[iXBlock].second = dfX + dfStep / 10;
     }
 
-    for (int iYBlock = 0; iYBlock < nYBlocks; ++iYBlock)
+    // Forward project the sample (dfX, dfY) of the geolocation array and
+    // find where it lands in the backmap. This only reads the geolocation
+    // arrays, so it can be run concurrently with the C array accessors.
+    // The backmap is only modified by ApplySample().
+    const auto ComputeSample =
+        [&](double dfX, double dfY, OGRPoint &oPoint, OGRLinearRing &oRing,
+            GDALGeoLocBackMapSample &sSample)
     {
-        for (int iXBlock = 0; iXBlock < nXBlocks; ++iXBlock)
-        {
-#if 0
-        CPLDebug("Process geoloc block (y=%d,x=%d) for y in [%f, %f] and x in [%f, %f]",
-                 iYBlock, iXBlock,
-                 yStartEnd[iYBlock].first, yStartEnd[iYBlock].second,
-                 xStartEnd[iXBlock].first, xStartEnd[iXBlock].second);
-#endif
-            for (double dfY = yStartEnd[iYBlock].first;
-                 dfY < yStartEnd[iYBlock].second; dfY += dfStep)
-            {
-                for (double dfX = xStartEnd[iXBlock].first;
-                     dfX < xStartEnd[iXBlock].second; dfX += dfStep)
-                {
-                    // Use forward geolocation array interpolation to compute
-                    // the georeferenced position corresponding to (dfX, dfY)
-                    double dfGeoLocX;
-                    double dfGeoLocY;
-                    if (!PixelLineToXY(psTransform, dfX, dfY, dfGeoLocX,
-                                       dfGeoLocY))
-                        continue;
+        // Use forward geolocation array interpolation to compute
+        // the georeferenced position corresponding to (dfX, dfY)
+        double dfGeoLocX;
+        double dfGeoLocY;
+        if (!PixelLineToXY(psTransform, dfX, dfY, dfGeoLocX, dfGeoLocY))
+            return false;
 
-                    // Compute the floating point coordinates in the pixel space
-                    // of the backmap
-                    const double dBMX = static_cast<double>(
-                        (dfGeoLocX - dfMinX) / dfPixelXSize);
+        // Compute the floating point coordinates in the pixel space
+        // of the backmap
+        const double dBMX =
+            static_cast<double>((dfGeoLocX - dfMinX) / dfPixelXSize);
 
-                    const double dBMY = static_cast<double>(
-                        (dfMaxY - dfGeoLocY) / dfPixelYSize);
+        const double dBMY =
+            static_cast<double>((dfMaxY - dfGeoLocY) / dfPixelYSize);
 
-                    // Get top left index by truncation
-                    const int iBMX = static_cast<int>(std::floor(dBMX));
-                    const int iBMY = static_cast<int>(std::floor(dBMY));
+        // Get top left index by truncation
+        const int iBMX = static_cast<int>(std::floor(dBMX));
+        const int iBMY = static_cast<int>(std::floor(dBMY));
 
-                    if (iBMX >= 0 && iBMX < nBMXSize && iBMY >= 0 &&
-                        iBMY < nBMYSize)
-                    {
-                        // Compute the georeferenced position of the top-left
-                        // index of the backmap
-                        double dfGeoX = dfMinX + iBMX * dfPixelXSize;
-                        const double dfGeoY = dfMaxY - iBMY * dfPixelYSize;
+        sSample.iBMX = iBMX;
+        sSample.iBMY = iBMY;
+        sSample.dfX = dfX;
+        sSample.dfY = dfY;
+
+        if (iBMX >= 0 && iBMX < nBMXSize && iBMY >= 0 && iBMY < nBMYSize)
+        {
+            // Compute the georeferenced position of the top-left
+            // index of the backmap
+            double dfGeoX = dfMinX + iBMX * dfPixelXSize;
+            const double dfGeoY = dfMaxY - iBMY * dfPixelYSize;
+
+            bool bMatchingGeoLocCellFound = false;
 
-                        bool bMatchingGeoLocCellFound = false;
+            const int nOuterIters =
+                psTransform->bGeographicSRSWithMinus180Plus180LongRange &&
+                        fabs(dfGeoX) >= 180
+                    ? 2
+                    : 1;
 
-                        const int nOuterIters =
-                            psTransform->bGeographicSRSWithMinus180Plus180LongRange &&
-                                    fabs(dfGeoX) >= 180
-                                ? 2
-                                : 1;
+            for (int iOuterIter = 0; iOuterIter < nOuterIters; ++iOuterIter)
+            {
+                if (iOuterIter == 1 && dfGeoX >= 180)
+                    dfGeoX -= 360;
+                else if (iOuterIter == 1 && dfGeoX <= -180)
+                    dfGeoX += 360;
+
+                // Identify a cell (quadrilateral in georeferenced
+                // space) in the geolocation array in which dfGeoX,
+                // dfGeoY falls into.
+                oPoint.setX(dfGeoX);
+                oPoint.setY(dfGeoY);
+                const int nX = static_cast<int>(std::floor(dfX));
+                const int nY = static_cast<int>(std::floor(dfY));
+                for (int sx = -1; !bMatchingGeoLocCellFound && sx <= 0; sx++)
+                {
+                    for (int sy = -1; !bMatchingGeoLocCellFound && sy <= 0;
+                         sy++)
+                    {
+                        const int pixel = nX + sx;
+                        const int line = nY + sy;
+                        double x0, y0, x1, y1, x2, y2, x3, y3;
+                        if (!PixelLineToXY(psTransform, pixel, line, x0, y0) ||
+                            !PixelLineToXY(psTransform, pixel + 1, line, x2,
+                                           y2) ||
+                            !PixelLineToXY(psTransform, pixel, line + 1, x1,
+                                           y1) ||
+                            !PixelLineToXY(psTransform, pixel + 1, line + 1,
+                                           x3, y3))
+                        {
+                            break;
+                        }
 
-                        for (int iOuterIter = 0; iOuterIter < nOuterIters;
-                             ++iOuterIter)
+                        int nIters = 1;
+                        if (psTransform
+                                ->bGeographicSRSWithMinus180Plus180LongRange &&
+                            std::fabs(x0) > 170 && std::fabs(x1) > 170 &&
+                            std::fabs(x2) > 170 && std::fabs(x3) > 170 &&
+                            (std::fabs(x1 - x0) > 180 ||
+                             std::fabs(x2 - x0) > 180 ||
+                             std::fabs(x3 - x0) > 180))
+                        {
+                            nIters = 2;
+                            if (x0 > 0)
+                                x0 -= 360;
+                            if (x1 > 0)
+                                x1 -= 360;
+                            if (x2 > 0)
+                                x2 -= 360;
+                            if (x3 > 0)
+                                x3 -= 360;
+                        }
+                        for (int iIter = 0; iIter < nIters; ++iIter)
                         {
-                            if (iOuterIter == 1 && dfGeoX >= 180)
-                                dfGeoX -= 360;
-                            else if (iOuterIter == 1 && dfGeoX <= -180)
-                                dfGeoX += 360;
-
-                            // Identify a cell (quadrilateral in georeferenced
-                            // space) in the geolocation array in which dfGeoX,
-                            // dfGeoY falls into.
-                            oPoint.setX(dfGeoX);
-                            oPoint.setY(dfGeoY);
-                            const int nX = static_cast<int>(std::floor(dfX));
-                            const int nY = static_cast<int>(std::floor(dfY));
-                            for (int sx = -1;
-                                 !bMatchingGeoLocCellFound && sx <= 0; sx++)
+                            if (iIter == 1)
                             {
-                                for (int sy = -1;
-                                     !bMatchingGeoLocCellFound && sy <= 0; sy++)
-                                {
-                                    const int pixel = nX + sx;
-                                    const int line = nY + sy;
-                                    double x0, y0, x1, y1, x2, y2, x3, y3;
-                                    if (!PixelLineToXY(psTransform, pixel, line,
-                                                       x0, y0) ||
-                                        !PixelLineToXY(psTransform, pixel + 1,
-                                                       line, x2, y2) ||
-                                        !PixelLineToXY(psTransform, pixel,
-                                                       line + 1, x1, y1) ||
-                                        !PixelLineToXY(psTransform, pixel + 1,
-                                                       line + 1, x3, y3))
-                                    {
-                                        break;
-                                    }
-
-                                    int nIters = 1;
-                                    if (psTransform
-                                            ->bGeographicSRSWithMinus180Plus180LongRange &&
-                                        std::fabs(x0) > 170 &&
-                                        std::fabs(x1) > 170 &&
-                                        std::fabs(x2) > 170 &&
-                                        std::fabs(x3) > 170 &&
-                                        (std::fabs(x1 - x0) > 180 ||
-                                         std::fabs(x2 - x0) > 180 ||
-                                         std::fabs(x3 - x0) > 180))
-                                    {
-                                        nIters = 2;
-                                        if (x0 > 0)
-                                            x0 -= 360;
-                                        if (x1 > 0)
-                                            x1 -= 360;
-                                        if (x2 > 0)
-                                            x2 -= 360;
-                                        if (x3 > 0)
-                                            x3 -= 360;
-                                    }
-                                    for (int iIter = 0; iIter < nIters; ++iIter)
-                                    {
-                                        if (iIter == 1)
-                                        {
-                                            x0 += 360;
-                                            x1 += 360;
-                                            x2 += 360;
-                                            x3 += 360;
-                                        }
-
-                                        oRing.setPoint(0, x0, y0);
-                                        oRing.setPoint(1, x2, y2);
-                                        oRing.setPoint(2, x3, y3);
-                                        oRing.setPoint(3, x1, y1);
-                                        oRing.setPoint(4, x0, y0);
-                                        if (oRing.isPointInRing(&oPoint) ||
-                                            oRing.isPointOnRingBoundary(
-                                                &oPoint))
-                                        {
-                                            bMatchingGeoLocCellFound = true;
-                                            double dfBMXValue = pixel;
-                                            double dfBMYValue = line;
-                                            GDALInverseBilinearInterpolation(
-                                                dfGeoX, dfGeoY, x0, y0, x1, y1,
-                                                x2, y2, x3, y3, dfBMXValue,
-                                                dfBMYValue);
-
-                                            dfBMXValue =
-                                                (dfBMXValue +
-                                                 dfGeorefConventionOffset) *
-                                                    psTransform->dfPIXEL_STEP +
-                                                psTransform->dfPIXEL_OFFSET;
-                                            dfBMYValue =
-                                                (dfBMYValue +
-                                                 dfGeorefConventionOffset) *
-                                                    psTransform->dfLINE_STEP +
-                                                psTransform->dfLINE_OFFSET;
-
-                                            pAccessors->backMapXAccessor.Set(
-                                                iBMX, iBMY,
-                                                static_cast<float>(dfBMXValue));
-                                            pAccessors->backMapYAccessor.Set(
-                                                iBMX, iBMY,
-                                                static_cast<float>(dfBMYValue));
-                                            pAccessors->backMapWeightAccessor
-                                                .Set(iBMX, iBMY, 1.0f);
-                                        }
-                                    }
-                                }
+                                x0 += 360;
+                                x1 += 360;
+                                x2 += 360;
+                                x3 += 360;
+                            }
+
+                            oRing.setPoint(0, x0, y0);
+                            oRing.setPoint(1, x2, y2);
+                            oRing.setPoint(2, x3, y3);
+                            oRing.setPoint(3, x1, y1);
+                            oRing.setPoint(4, x0, y0);
+                            if (oRing.isPointInRing(&oPoint) ||
+                                oRing.isPointOnRingBoundary(&oPoint))
+                            {
+                                bMatchingGeoLocCellFound = true;
+                                double dfBMXValue = pixel;
+                                double dfBMYValue = line;
+                                GDALInverseBilinearInterpolation(
+                                    dfGeoX, dfGeoY, x0, y0, x1, y1, x2, y2, x3,
+                                    y3, dfBMXValue, dfBMYValue);
+
+                                dfBMXValue =
+                                    (dfBMXValue + dfGeorefConventionOffset) *
+                                        psTransform->dfPIXEL_STEP +
+                                    psTransform->dfPIXEL_OFFSET;
+                                dfBMYValue =
+                                    (dfBMYValue + dfGeorefConventionOffset) *
+                                        psTransform->dfLINE_STEP +
+                                    psTransform->dfLINE_OFFSET;
+
+                                sSample.fBMX = static_cast<float>(dfBMXValue);
+                                sSample.fBMY = static_cast<float>(dfBMYValue);
                             }
                         }
-                        if (bMatchingGeoLocCellFound)
-                            continue;
                     }
+                }
+            }
+            if (bMatchingGeoLocCellFound)
+            {
+                sSample.bMatchingGeoLocCellFound = true;
+                return true;
+            }
+        }
 
-                    // We will end up here in non-nominal cases, with nodata,
-                    // holes, etc.
+        // We will end up here in non-nominal cases, with nodata,
+        // holes, etc.
 
-                    // Check if the center is in range
-                    if (iBMX < -1 || iBMY < -1 || iBMX > nBMXSize ||
-                        iBMY > nBMYSize)
-                        continue;
+        // Check if the center is in range
+        if (iBMX < -1 || iBMY < -1 || iBMX > nBMXSize || iBMY > nBMYSize)
+            return false;
 
-                    const double fracBMX = dBMX - iBMX;
-                    const double fracBMY = dBMY - iBMY;
+        sSample.bMatchingGeoLocCellFound = false;
+        sSample.fracBMX = dBMX - iBMX;
+        sSample.fracBMY = dBMY - iBMY;
+        return true;
+    };
 
-                    // Check logic for top left pixel
-                    if ((iBMX >= 0) && (iBMY >= 0) && (iBMX < nBMXSize) &&
-                        (iBMY < nBMYSize) &&
-                        pAccessors->backMapWeightAccessor.Get(iBMX, iBMY) !=
-                            1.0f)
-                    {
-                        const double tempwt = (1.0 - fracBMX) * (1.0 - fracBMY);
-                        UpdateBackmap(iBMX, iBMY, dfX, dfY, tempwt);
-                    }
+    // Push a sample computed by ComputeSample() into the backmap.
+    const auto ApplySample = [&](const GDALGeoLocBackMapSample &sSample)
+    {
+        const int iBMX = sSample.iBMX;
+        const int iBMY = sSample.iBMY;
+        if (sSample.bMatchingGeoLocCellFound)
+        {
+            pAccessors->backMapXAccessor.Set(iBMX, iBMY, sSample.fBMX);
+            pAccessors->backMapYAccessor.Set(iBMX, iBMY, sSample.fBMY);
+            pAccessors->backMapWeightAccessor.Set(iBMX, iBMY, 1.0f);
+            return;
+        }
 
-                    // Check logic for top right pixel
-                    if ((iBMY >= 0) && (iBMX + 1 < nBMXSize) &&
-                        (iBMY < nBMYSize) &&
-                        pAccessors->backMapWeightAccessor.Get(iBMX + 1, iBMY) !=
-                            1.0f)
-                    {
-                        const double tempwt = fracBMX * (1.0 - fracBMY);
-                        UpdateBackmap(iBMX + 1, iBMY, dfX, dfY, tempwt);
-                    }
+        const double dfX = sSample.dfX;
+        const double dfY = sSample.dfY;
+        const double fracBMX = sSample.fracBMX;
+        const double fracBMY = sSample.fracBMY;
+
+        // Check logic for top left pixel
+        if ((iBMX >= 0) && (iBMY >= 0) && (iBMX < nBMXSize) &&
+            (iBMY < nBMYSize) &&
+            pAccessors->backMapWeightAccessor.Get(iBMX, iBMY) != 1.0f)
+        {
+            const double tempwt = (1.0 - fracBMX) * (1.0 - fracBMY);
+            UpdateBackmap(iBMX, iBMY, dfX, dfY, tempwt);
+        }
+
+        // Check logic for top right pixel
+        if ((iBMY >= 0) && (iBMX + 1 < nBMXSize) && (iBMY < nBMYSize) &&
+            pAccessors->backMapWeightAccessor.Get(iBMX + 1, iBMY) != 1.0f)
+        {
+            const double tempwt = fracBMX * (1.0 - fracBMY);
+            UpdateBackmap(iBMX + 1, iBMY, dfX, dfY, tempwt);
+        }
+
+        // Check logic for bottom right pixel
+        if ((iBMX + 1 < nBMXSize) && (iBMY + 1 < nBMYSize) &&
+            pAccessors->backMapWeightAccessor.Get(iBMX + 1, iBMY + 1) != 1.0f)
+        {
+            const double tempwt = fracBMX * fracBMY;
+            UpdateBackmap(iBMX + 1, iBMY + 1, dfX, dfY, tempwt);
+        }
+
+        // Check logic for bottom left pixel
+        if ((iBMX >= 0) && (iBMX < nBMXSize) && (iBMY + 1 < nBMYSize) &&
+            pAccessors->backMapWeightAccessor.Get(iBMX, iBMY + 1) != 1.0f)
+        {
+            const double tempwt = (1.0 - fracBMX) * fracBMY;
+            UpdateBackmap(iBMX, iBMY + 1, dfX, dfY, tempwt);
+        }
+    };
+
+    // The forward projection of samples can be done in parallel when the
+    // geolocation arrays are in memory. The accessors of the temporary
+    // datasets are not thread-safe, so that mode remains single-threaded.
+    int nThreads = 1;
+    if (std::is_same<Accessors, GDALGeoLocCArrayAccessors>::value)
+    {
+        const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+        nThreads = EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                  : atoi(pszThreads);
+    }
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+
+    // Number of sample lines of a block processed by a job
+    constexpr int ROWS_PER_JOB = 64;
+    std::vector<GDALGeoLocBackMapJob> asJobs;
+    if (poJobQueue)
+        asJobs.resize(nThreads);
+
+    std::vector<double> adfX;
+    std::vector<double> adfY;
 
-                    // Check logic for bottom right pixel
-                    if ((iBMX + 1 < nBMXSize) && (iBMY + 1 < nBMYSize) &&
-                        pAccessors->backMapWeightAccessor.Get(iBMX + 1,
-                                                              iBMY + 1) != 1.0f)
+    // Keep those objects in this outer scope, so they are re-used, to
+    // save memory allocations.
+    OGRPoint oPoint;
+    OGRLinearRing oRing;
+    oRing.setNumPoints(5);
+
+    for (int iYBlock = 0; iYBlock < nYBlocks; ++iYBlock)
+    {
+        adfY.clear();
+        for (double dfY = yStartEnd[iYBlock].first;
+             dfY < yStartEnd[iYBlock].second; dfY += dfStep)
+        {
+            adfY.push_back(dfY);
+        }
+
+        for (int iXBlock = 0; iXBlock < nXBlocks; ++iXBlock)
+        {
+#if 0
+        CPLDebug("Process geoloc block (y=%d,x=%d) for y in [%f, %f] and x in [%f, %f]",
+                 iYBlock, iXBlock,
+                 yStartEnd[iYBlock].first, yStartEnd[iYBlock].second,
+                 xStartEnd[iXBlock].first, xStartEnd[iXBlock].second);
+#endif
+            adfX.clear();
+            for (double dfX = xStartEnd[iXBlock].first;
+                 dfX < xStartEnd[iXBlock].second; dfX += dfStep)
+            {
+                adfX.push_back(dfX);
+            }
+
+            if (!poJobQueue)
+            {
+                GDALGeoLocBackMapSample sSample;
+                for (const double dfY : adfY)
+                {
+                    for (const double dfX : adfX)
                     {
-                        const double tempwt = fracBMX * fracBMY;
-                        UpdateBackmap(iBMX + 1, iBMY + 1, dfX, dfY, tempwt);
+                        if (ComputeSample(dfX, dfY, oPoint, oRing, sSample))
+                            ApplySample(sSample);
                     }
+                }
+                continue;
+            }
 
-                    // Check logic for bottom left pixel
-                    if ((iBMX >= 0) && (iBMX < nBMXSize) &&
-                        (iBMY + 1 < nBMYSize) &&
-                        pAccessors->backMapWeightAccessor.Get(iBMX, iBMY + 1) !=
-                            1.0f)
+            // Compute nThreads batches of ROWS_PER_JOB lines in parallel,
+            // and push their samples into the backmap in the same order as
+            // the sequential code path, so that the result is identical.
+            const size_t nRows = adfY.size();
+            for (size_t iRow = 0; iRow < nRows;
+                 iRow += static_cast<size_t>(nThreads) * ROWS_PER_JOB)
+            {
+                size_t nJobs = 0;
+                for (; nJobs < asJobs.size(); ++nJobs)
+                {
+                    const size_t iStart = iRow + nJobs * ROWS_PER_JOB;
+                    if (iStart >= nRows)
+                        break;
+                    auto &sJob = asJobs[nJobs];
+                    sJob.asSamples.clear();
+                    sJob.pfnProcess = [&adfX, &adfY, &ComputeSample, &sJob,
+                                       iStart, nRows]()
                     {
-                        const double tempwt = (1.0 - fracBMX) * fracBMY;
-                        UpdateBackmap(iBMX, iBMY + 1, dfX, dfY, tempwt);
-                    }
+                        const size_t iEnd =
+                            std::min(nRows, iStart + ROWS_PER_JOB);
+                        GDALGeoLocBackMapSample sSample;
+                        for (size_t i = iStart; i < iEnd; ++i)
+                        {
+                            for (const double dfX : adfX)
+                            {
+                                if (ComputeSample(dfX, adfY[i], sJob.oPoint,
+                                                  sJob.oRing, sSample))
+                                {
+                                    sJob.asSamples.push_back(sSample);
+                                }
+                            }
+                        }
+                    };
+                    if (!poJobQueue->SubmitJob(GDALGeoLocBackMapJobFunc, &sJob))
+                        sJob.pfnProcess();
+                }
+                poJobQueue->WaitCompletion();
+
+                for (size_t iJob = 0; iJob < nJobs; ++iJob)
+                {
+                    for (const auto &sSample : asJobs[iJob].asSamples)
+                        ApplySample(sSample);
                 }
             }
         }
@@ -39,8 +39,10 @@
 
 #include <limits>
 #include <map>
+#include <memory>
 #include <utility>
 #include <algorithm>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_cpu_features.h"
@@ -52,6 +54,7 @@
 #include "cpl_vsi.h"
 #include "cpl_worker_thread_pool.h"
 #include "gdal.h"
+#include "gdal_thread_pool.h"
 
 constexpr double TO_RADIANS = M_PI / 180.0;
 
@@ -72,6 +75,105 @@ static void GDALGridGetPointBounds(const void *hFeature, CPLRectObj *pBounds)
     pBounds->maxy = dfY;
 }
 
+/************************************************************************/
+/*                           GDALGridRowCache                           */
+/************************************************************************/
+
+/* Candidate points of the search windows of the pixels of an output row.
+ * They are collected with a single quadtree search over a band covering the
+ * whole row, and sorted by X so that the candidates of each pixel can be
+ * found with a binary search. The points of a pixel are returned in the same
+ * order as CPLQuadTreeSearch() would, since the quadtree traversal order of
+ * the band and the pixel search windows is the same: the results of the
+ * gridding functions are thus unchanged.
+ */
+struct GDALGridRowCache
+{
+    CPLRectObj sBand{};
+    // Candidate points, in quadtree traversal order
+    std::vector<GDALGridPoint *> apsPoints{};
+    // (X, index in apsPoints) of the candidate points, sorted by X
+    std::vector<std::pair<double, int>> aoSortedX{};
+    // Working buffers of GDALGridQuadTreeSearch()
+    std::vector<int> anIndices{};
+    std::vector<GDALGridPoint *> apsResult{};
+
+    void Fill(const CPLQuadTree *hQuadTree, const CPLRectObj &sBandIn,
+              const double *padfX)
+    {
+        sBand = sBandIn;
+        apsPoints.clear();
+        aoSortedX.clear();
+        int nFeatureCount = 0;
+        GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
+            CPLQuadTreeSearch(hQuadTree, &sBand, &nFeatureCount));
+        apsPoints.assign(papsPoints, papsPoints + nFeatureCount);
+        CPLFree(papsPoints);
+        aoSortedX.reserve(nFeatureCount);
+        for (int k = 0; k < nFeatureCount; ++k)
+            aoSortedX.emplace_back(padfX[apsPoints[k]->i], k);
+        std::sort(aoSortedX.begin(), aoSortedX.end());
+    }
+
+    bool Contains(const CPLRectObj &sAoi) const
+    {
+        return sAoi.minx >= sBand.minx && sAoi.maxx <= sBand.maxx &&
+               sAoi.miny >= sBand.miny && sAoi.maxy <= sBand.maxy;
+    }
+};
+
+/************************************************************************/
+/*                        GDALGridQuadTreeSearch()                      */
+/*                                                                      */
+/*      Equivalent of CPLQuadTreeSearch() on the quadtree of the        */
+/*      extra parameters, using the candidate points of the current     */
+/*      output row when available. The result must be freed with        */
+/*      GDALGridFreeSearchResult().                                     */
+/************************************************************************/
+
+static void **GDALGridQuadTreeSearch(const GDALGridExtraParameters *psParams,
+                                     const CPLRectObj *psAoi,
+                                     int *pnFeatureCount)
+{
+    GDALGridRowCache *psCache = psParams->psRowCache;
+    if (psCache == nullptr || !psCache->Contains(*psAoi))
+        return CPLQuadTreeSearch(psParams->hQuadTree, psAoi, pnFeatureCount);
+
+    psCache->anIndices.clear();
+    auto oIter = std::lower_bound(
+        psCache->aoSortedX.begin(), psCache->aoSortedX.end(),
+        std::pair<double, int>(psAoi->minx, std::numeric_limits<int>::min()));
+    for (; oIter != psCache->aoSortedX.end() && oIter->first <= psAoi->maxx;
+         ++oIter)
+    {
+        const GDALGridPoint *psPoint = psCache->apsPoints[oIter->second];
+        const double dfY = psPoint->psXYArrays->padfY[psPoint->i];
+        if (dfY >= psAoi->miny && dfY <= psAoi->maxy)
+            psCache->anIndices.push_back(oIter->second);
+    }
+    std::sort(psCache->anIndices.begin(), psCache->anIndices.end());
+
+    psCache->apsResult.clear();
+    for (const int k : psCache->anIndices)
+        psCache->apsResult.push_back(psCache->apsPoints[k]);
+    *pnFeatureCount = static_cast<int>(psCache->apsResult.size());
+    return reinterpret_cast<void **>(psCache->apsResult.data());
+}
+
+/************************************************************************/
+/*                      GDALGridFreeSearchResult()                      */
+/************************************************************************/
+
+static void GDALGridFreeSearchResult(const GDALGridExtraParameters *psParams,
+                                     GDALGridPoint **papsPoints)
+{
+    if (psParams->psRowCache == nullptr ||
+        papsPoints != psParams->psRowCache->apsResult.data())
+    {
+        CPLFree(papsPoints);
+    }
+}
+
 /************************************************************************/
 /*                   GDALGridInverseDistanceToAPower()                  */
 /************************************************************************/
@@ -273,8 +375,7 @@ CPLErr GDALGridInverseDistanceToAPowerNearestNeighbor(
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    const CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
-    CPLAssert(phQuadTree);
+    CPLAssert(psExtraParams->hQuadTree);
 
     const double dfRPower2 = psExtraParams->dfRadiusPower2PreComp;
     const double dfPowerDiv2 = psExtraParams->dfPowerDiv2PreComp;
@@ -289,7 +390,7 @@ CPLErr GDALGridInverseDistanceToAPowerNearestNeighbor(
     sAoi.maxy = dfYPoint + dfSearchRadius;
     int nFeatureCount = 0;
     GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-        CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+        GDALGridQuadTreeSearch(psExtraParams, &sAoi, &nFeatureCount));
     if (nFeatureCount != 0)
     {
         for (int k = 0; k < nFeatureCount; k++)
@@ -304,7 +405,7 @@ CPLErr GDALGridInverseDistanceToAPowerNearestNeighbor(
             if (dfRsmoothed2 < 0.0000000000001)
             {
                 *pdfValue = padfZ[i];
-                CPLFree(papsPoints);
+                GDALGridFreeSearchResult(psExtraParams, papsPoints);
                 return CE_None;
             }
             // is point within real distance?
@@ -315,7 +416,7 @@ CPLErr GDALGridInverseDistanceToAPowerNearestNeighbor(
             }
         }
     }
-    CPLFree(papsPoints);
+    GDALGridFreeSearchResult(psExtraParams, papsPoints);
 
     double dfNominator = 0.0;
     double dfDenominator = 0.0;
@@ -382,8 +483,7 @@ static CPLErr GDALGridInverseDistanceToAPowerNearestNeighborPerQuadrant(
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    const CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
-    CPLAssert(phQuadTree);
+    CPLAssert(psExtraParams->hQuadTree);
 
     const double dfRPower2 = psExtraParams->dfRadiusPower2PreComp;
     const double dfPowerDiv2 = psExtraParams->dfPowerDiv2PreComp;
@@ -397,7 +497,7 @@ static CPLErr GDALGridInverseDistanceToAPowerNearestNeighborPerQuadrant(
     sAoi.maxy = dfYPoint + dfSearchRadius;
     int nFeatureCount = 0;
     GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-        CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+        GDALGridQuadTreeSearch(psExtraParams, &sAoi, &nFeatureCount));
     if (nFeatureCount != 0)
     {
         for (int k = 0; k < nFeatureCount; k++)
@@ -412,7 +512,7 @@ static CPLErr GDALGridInverseDistanceToAPowerNearestNeighborPerQuadrant(
             if (dfRsmoothed2 < 0.0000000000001)
             {
                 *pdfValue = padfZ[i];
-                CPLFree(papsPoints);
+                GDALGridFreeSearchResult(psExtraParams, papsPoints);
                 return CE_None;
             }
             // is point within real distance?
@@ -425,7 +525,7 @@ static CPLErr GDALGridInverseDistanceToAPowerNearestNeighborPerQuadrant(
             }
         }
     }
-    CPLFree(papsPoints);
+    GDALGridFreeSearchResult(psExtraParams, papsPoints);
 
     std::multimap<double, double>::iterator aoIter[] = {
         oMapDistanceToZValuesPerQuadrant[0].begin(),
@@ -683,7 +783,7 @@ CPLErr GDALGridMovingAverage(const void *poOptionsIn, GUInt32 nPoints,
         sAoi.maxy = dfYPoint + dfSearchRadius;
         int nFeatureCount = 0;
         GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-            CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+            GDALGridQuadTreeSearch(psExtraParams, &sAoi, &nFeatureCount));
         if (nFeatureCount != 0)
         {
             for (int k = 0; k < nFeatureCount; k++)
@@ -701,7 +801,7 @@ CPLErr GDALGridMovingAverage(const void *poOptionsIn, GUInt32 nPoints,
                 }
             }
         }
-        CPLFree(papsPoints);
+        GDALGridFreeSearchResult(psExtraParams, papsPoints);
     }
     else
     {
@@ -765,8 +865,7 @@ static CPLErr GDALGridMovingAveragePerQuadrant(
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    const CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
-    CPLAssert(phQuadTree);
+    CPLAssert(psExtraParams->hQuadTree);
 
     std::multimap<double, double> oMapDistanceToZValuesPerQuadrant[4];
 
@@ -779,7 +878,7 @@ static CPLErr GDALGridMovingAveragePerQuadrant(
     sAoi.maxy = dfYPoint + dfSearchRadius;
     int nFeatureCount = 0;
     GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-        CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+        GDALGridQuadTreeSearch(psExtraParams, &sAoi, &nFeatureCount));
     if (nFeatureCount != 0)
     {
         for (int k = 0; k < nFeatureCount; k++)
@@ -800,7 +899,7 @@ static CPLErr GDALGridMovingAveragePerQuadrant(
             }
         }
     }
-    CPLFree(papsPoints);
+    GDALGridFreeSearchResult(psExtraParams, papsPoints);
 
     std::multimap<double, double>::iterator aoIter[] = {
         oMapDistanceToZValuesPerQuadrant[0].begin(),
@@ -936,7 +1035,7 @@ CPLErr GDALGridNearestNeighbor(const void *poOptionsIn, GUInt32 nPoints,
             sAoi.maxy = dfYPoint + dfSearchRadius;
             int nFeatureCount = 0;
             GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-                CPLQuadTreeSearch(hQuadTree, &sAoi, &nFeatureCount));
+                GDALGridQuadTreeSearch(psExtraParams, &sAoi, &nFeatureCount));
             if (nFeatureCount != 0)
             {
                 // Nearest distance will be initialized with the distance to the
@@ -956,11 +1055,11 @@ CPLErr GDALGridNearestNeighbor(const void *poOptionsIn, GUInt32 nPoints,
                     }
                 }
 
-                CPLFree(papsPoints);
+                GDALGridFreeSearchResult(psExtraParams, papsPoints);
                 break;
             }
 
-            CPLFree(papsPoints);
+            GDALGridFreeSearchResult(psExtraParams, papsPoints);
             if (poOptions->dfRadius1 > 0 || poOptions->dfRadius2 > 0)
                 break;
             dfSearchRadius *= 2;
@@ -1086,7 +1185,7 @@ CPLErr GDALGridDataMetricMinimum(const void *poOptionsIn, GUInt32 nPoints,
         sAoi.maxy = dfYPoint + dfSearchRadius;
         int nFeatureCount = 0;
         GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-            CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+            GDALGridQuadTreeSearch(psExtraParams, &sAoi, &nFeatureCount));
         if (nFeatureCount != 0)
         {
             for (int k = 0; k < nFeatureCount; k++)
@@ -1105,7 +1204,7 @@ CPLErr GDALGridDataMetricMinimum(const void *poOptionsIn, GUInt32 nPoints,
                 }
             }
         }
-        CPLFree(papsPoints);
+        GDALGridFreeSearchResult(psExtraParams, papsPoints);
     }
     else
     {
@@ -1179,8 +1278,7 @@ static CPLErr GDALGridDataMetricMinimumOrMaximumPerQuadrant(
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    const CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
-    CPLAssert(phQuadTree);
+    CPLAssert(psExtraParams->hQuadTree);
 
     CPLRectObj sAoi;
     sAoi.minx = dfXPoint - dfSearchRadius;
@@ -1189,7 +1287,7 @@ static CPLErr GDALGridDataMetricMinimumOrMaximumPerQuadrant(
     sAoi.maxy = dfYPoint + dfSearchRadius;
     int nFeatureCount = 0;
     GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-        CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+        GDALGridQuadTreeSearch(psExtraParams, &sAoi, &nFeatureCount));
     std::multimap<double, double> oMapDistanceToZValuesPerQuadrant[4];
 
     if (nFeatureCount != 0)
@@ -1212,7 +1310,7 @@ static CPLErr GDALGridDataMetricMinimumOrMaximumPerQuadrant(
             }
         }
     }
-    CPLFree(papsPoints);
+    GDALGridFreeSearchResult(psExtraParams, papsPoints);
 
     std::multimap<double, double>::iterator aoIter[] = {
         oMapDistanceToZValuesPerQuadrant[0].begin(),
@@ -1380,7 +1478,7 @@ CPLErr GDALGridDataMetricMaximum(const void *poOptionsIn, GUInt32 nPoints,
         sAoi.maxy = dfYPoint + dfSearchRadius;
         int nFeatureCount = 0;
         GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-            CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+            GDALGridQuadTreeSearch(psExtraParams, &sAoi, &nFeatureCount));
         if (nFeatureCount != 0)
         {
             for (int k = 0; k < nFeatureCount; k++)
@@ -1399,7 +1497,7 @@ CPLErr GDALGridDataMetricMaximum(const void *poOptionsIn, GUInt32 nPoints,
                 }
             }
         }
-        CPLFree(papsPoints);
+        GDALGridFreeSearchResult(psExtraParams, papsPoints);
     }
     else
     {
@@ -1537,7 +1635,7 @@ CPLErr GDALGridDataMetricRange(const void *poOptionsIn, GUInt32 nPoints,
         sAoi.maxy = dfYPoint + dfSearchRadius;
         int nFeatureCount = 0;
         GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-            CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+            GDALGridQuadTreeSearch(psExtraParams, &sAoi, &nFeatureCount));
         if (nFeatureCount != 0)
         {
             for (int k = 0; k < nFeatureCount; k++)
@@ -1558,7 +1656,7 @@ CPLErr GDALGridDataMetricRange(const void *poOptionsIn, GUInt32 nPoints,
                 }
             }
         }
-        CPLFree(papsPoints);
+        GDALGridFreeSearchResult(psExtraParams, papsPoints);
     }
     else
     {
@@ -1632,8 +1730,7 @@ static CPLErr GDALGridDataMetricRangePerQuadrant(
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    const CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
-    CPLAssert(phQuadTree);
+    CPLAssert(psExtraParams->hQuadTree);
 
     CPLRectObj sAoi;
     sAoi.minx = dfXPoint - dfSearchRadius;
@@ -1642,7 +1739,7 @@ static CPLErr GDALGridDataMetricRangePerQuadrant(
     sAoi.maxy = dfYPoint + dfSearchRadius;
     int nFeatureCount = 0;
     GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-        CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+        GDALGridQuadTreeSearch(psExtraParams, &sAoi, &nFeatureCount));
     std::multimap<double, double> oMapDistanceToZValuesPerQuadrant[4];
 
     if (nFeatureCount != 0)
@@ -1665,7 +1762,7 @@ static CPLErr GDALGridDataMetricRangePerQuadrant(
             }
         }
     }
-    CPLFree(papsPoints);
+    GDALGridFreeSearchResult(psExtraParams, papsPoints);
 
     std::multimap<double, double>::iterator aoIter[] = {
         oMapDistanceToZValuesPerQuadrant[0].begin(),
@@ -1807,7 +1904,7 @@ CPLErr GDALGridDataMetricCount(const void *poOptionsIn, GUInt32 nPoints,
         sAoi.maxy = dfYPoint + dfSearchRadius;
         int nFeatureCount = 0;
         GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-            CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+            GDALGridQuadTreeSearch(psExtraParams, &sAoi, &nFeatureCount));
         if (nFeatureCount != 0)
         {
             for (int k = 0; k < nFeatureCount; k++)
@@ -1824,7 +1921,7 @@ CPLErr GDALGridDataMetricCount(const void *poOptionsIn, GUInt32 nPoints,
                 }
             }
         }
-        CPLFree(papsPoints);
+        GDALGridFreeSearchResult(psExtraParams, papsPoints);
     }
     else
     {
@@ -1894,8 +1991,7 @@ static CPLErr GDALGridDataMetricCountPerQuadrant(
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    const CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
-    CPLAssert(phQuadTree);
+    CPLAssert(psExtraParams->hQuadTree);
 
     CPLRectObj sAoi;
     sAoi.minx = dfXPoint - dfSearchRadius;
@@ -1904,7 +2000,7 @@ static CPLErr GDALGridDataMetricCountPerQuadrant(
     sAoi.maxy = dfYPoint + dfSearchRadius;
     int nFeatureCount = 0;
     GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-        CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+        GDALGridQuadTreeSearch(psExtraParams, &sAoi, &nFeatureCount));
     std::multimap<double, double> oMapDistanceToZValuesPerQuadrant[4];
 
     if (nFeatureCount != 0)
@@ -1927,7 +2023,7 @@ static CPLErr GDALGridDataMetricCountPerQuadrant(
             }
         }
     }
-    CPLFree(papsPoints);
+    GDALGridFreeSearchResult(psExtraParams, papsPoints);
 
     std::multimap<double, double>::iterator aoIter[] = {
         oMapDistanceToZValuesPerQuadrant[0].begin(),
@@ -2068,7 +2164,7 @@ CPLErr GDALGridDataMetricAverageDistance(const void *poOptionsIn,
         sAoi.maxy = dfYPoint + dfSearchRadius;
         int nFeatureCount = 0;
         GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-            CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+            GDALGridQuadTreeSearch(psExtraParams, &sAoi, &nFeatureCount));
         if (nFeatureCount != 0)
         {
             for (int k = 0; k < nFeatureCount; k++)
@@ -2086,7 +2182,7 @@ CPLErr GDALGridDataMetricAverageDistance(const void *poOptionsIn,
                 }
             }
         }
-        CPLFree(papsPoints);
+        GDALGridFreeSearchResult(psExtraParams, papsPoints);
     }
     else
     {
@@ -2158,8 +2254,7 @@ static CPLErr GDALGridDataMetricAverageDistancePerQuadrant(
 
     GDALGridExtraParameters *psExtraParams =
         static_cast<GDALGridExtraParameters *>(hExtraParamsIn);
-    const CPLQuadTree *phQuadTree = psExtraParams->hQuadTree;
-    CPLAssert(phQuadTree);
+    CPLAssert(psExtraParams->hQuadTree);
 
     CPLRectObj sAoi;
     sAoi.minx = dfXPoint - dfSearchRadius;
@@ -2168,7 +2263,7 @@ static CPLErr GDALGridDataMetricAverageDistancePerQuadrant(
     sAoi.maxy = dfYPoint + dfSearchRadius;
     int nFeatureCount = 0;
     GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-        CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+        GDALGridQuadTreeSearch(psExtraParams, &sAoi, &nFeatureCount));
     std::multimap<double, double> oMapDistanceToZValuesPerQuadrant[4];
 
     if (nFeatureCount != 0)
@@ -2191,7 +2286,7 @@ static CPLErr GDALGridDataMetricAverageDistancePerQuadrant(
             }
         }
     }
-    CPLFree(papsPoints);
+    GDALGridFreeSearchResult(psExtraParams, papsPoints);
 
     std::multimap<double, double>::iterator aoIter[] = {
         oMapDistanceToZValuesPerQuadrant[0].begin(),
@@ -2334,7 +2429,7 @@ CPLErr GDALGridDataMetricAverageDistancePts(
         sAoi.maxy = dfYPoint + dfSearchRadius;
         int nFeatureCount = 0;
         GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-            CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+            GDALGridQuadTreeSearch(psExtraParams, &sAoi, &nFeatureCount));
         if (nFeatureCount != 0)
         {
             for (int k = 0; k < nFeatureCount - 1; k++)
@@ -2369,7 +2464,7 @@ CPLErr GDALGridDataMetricAverageDistancePts(
                 }
             }
         }
-        CPLFree(papsPoints);
+        GDALGridFreeSearchResult(psExtraParams, papsPoints);
     }
     else
     {
@@ -2658,6 +2753,17 @@ static void GDALGridJobProcess(void *user_data)
     GDALGridExtraParameters sExtraParameters = *psJob->psExtraParameters;
     const GDALDataType eType = psJob->eType;
 
+    // When the search windows of neighbouring pixels overlap, collect the
+    // candidate points of each output row with a single quadtree search.
+    const double dfRowCacheRadius = sExtraParameters.dfRowCacheRadius;
+    std::unique_ptr<GDALGridRowCache> poRowCache;
+    if (sExtraParameters.hQuadTree != nullptr && dfRowCacheRadius > 0 &&
+        nXSize > 1 && 2 * dfRowCacheRadius >= std::fabs(dfDeltaX))
+    {
+        poRowCache = std::make_unique<GDALGridRowCache>();
+    }
+    sExtraParameters.psRowCache = poRowCache.get();
+
     const int nDataTypeSize = GDALGetDataTypeSizeBytes(eType);
     const int nLineSpace = nXSize * nDataTypeSize;
 
@@ -2665,6 +2771,20 @@ static void GDALGridJobProcess(void *user_data)
     {
         const double dfYPoint = dfYMin + (nYPoint + 0.5) * dfDeltaY;
 
+        if (poRowCache)
+        {
+            // Same expressions as for the pixel search windows, so that the
+            // band contains all of them.
+            const double dfXFirst = dfXMin + (0 + 0.5) * dfDeltaX;
+            const double dfXLast = dfXMin + (nXSize - 1 + 0.5) * dfDeltaX;
+            CPLRectObj sBand;
+            sBand.minx = std::min(dfXFirst, dfXLast) - dfRowCacheRadius;
+            sBand.miny = dfYPoint - dfRowCacheRadius;
+            sBand.maxx = std::max(dfXFirst, dfXLast) + dfRowCacheRadius;
+            sBand.maxy = dfYPoint + dfRowCacheRadius;
+            poRowCache->Fill(sExtraParameters.hQuadTree, sBand, padfX);
+        }
+
         for (GUInt32 nXPoint = 0; nXPoint < nXSize; nXPoint++)
         {
             const double dfXPoint = dfXMin + (nXPoint + 0.5) * dfDeltaX;
@@ -2719,6 +2839,8 @@ struct GDALGridContext
 };
 
 static void GDALGridContextCreateQuadTree(GDALGridContext *psContext);
+static double GDALGridGetRowCacheRadius(GDALGridAlgorithm eAlgorithm,
+                                        const void *poOptions);
 
 /**
  * Creates a context to do regular gridding from the scattered data.
@@ -3243,6 +3365,10 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
     /* -------------------------------------------------------------------- */
     /*  Pre-compute extra parameters in GDALGridExtraParameters              */
     /* -------------------------------------------------------------------- */
+    psContext->sExtraParameters.dfRowCacheRadius =
+        GDALGridGetRowCacheRadius(eAlgorithm, poOptionsNew);
+    psContext->sExtraParameters.psRowCache = nullptr;
+
     if (eAlgorithm == GGA_InverseDistanceToAPowerNearestNeighbor)
     {
         const double dfPower =
@@ -3284,6 +3410,7 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
         nThreads = atoi(pszThreads);
     if (nThreads > 128)
         nThreads = 128;
+    nThreads = GDALCapThreadCount(nThreads);
     if (nThreads > 1)
     {
         psContext->poWorkerThreadPool = new CPLWorkerThreadPool();
@@ -3303,6 +3430,52 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
     return psContext;
 }
 
+/************************************************************************/
+/*                      GDALGridGetRowCacheRadius()                     */
+/*                                                                      */
+/*      Half size of the square search window around output pixels     */
+/*      used by the quadtree based gridding functions, or 0.            */
+/************************************************************************/
+
+static double GDALGridGetRowCacheRadius(GDALGridAlgorithm eAlgorithm,
+                                        const void *poOptions)
+{
+    switch (eAlgorithm)
+    {
+        case GGA_InverseDistanceToAPowerNearestNeighbor:
+            return static_cast<
+                       const GDALGridInverseDistanceToAPowerNearestNeighborOptions
+                           *>(poOptions)
+                ->dfRadius;
+        case GGA_MovingAverage:
+        {
+            const auto psOptions =
+                static_cast<const GDALGridMovingAverageOptions *>(poOptions);
+            return std::max(psOptions->dfRadius1, psOptions->dfRadius2);
+        }
+        case GGA_NearestNeighbor:
+        {
+            const auto psOptions =
+                static_cast<const GDALGridNearestNeighborOptions *>(poOptions);
+            return std::max(psOptions->dfRadius1, psOptions->dfRadius2);
+        }
+        case GGA_MetricMinimum:
+        case GGA_MetricMaximum:
+        case GGA_MetricRange:
+        case GGA_MetricCount:
+        case GGA_MetricAverageDistance:
+        case GGA_MetricAverageDistancePts:
+        {
+            const auto psOptions =
+                static_cast<const GDALGridDataMetricsOptions *>(poOptions);
+            return std::max(psOptions->dfRadius1, psOptions->dfRadius2);
+        }
+        default:
+            break;
+    }
+    return 0.0;
+}
+
 /************************************************************************/
 /*                      GDALGridContextCreateQuadTree()                 */
 /************************************************************************/
@@ -62,6 +62,11 @@ typedef struct
     double dfPowerDiv2PreComp;
     /*! The radius of search circle squared (pre-computation). */
     double dfRadiusPower2PreComp;
+    /*! Half size of the search window around output pixels, whose candidate
+     * points are collected once per output row, or 0. */
+    double dfRowCacheRadius;
+    /*! Candidate points of the output row being processed, or nullptr. */
+    struct GDALGridRowCache *psRowCache;
 } GDALGridExtraParameters;
 
 #ifdef HAVE_SSE_AT_COMPILE_TIME
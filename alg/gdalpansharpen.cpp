@@ -39,6 +39,7 @@
 #include <cstring>
 #include <limits>
 #include <new>
+#include <type_traits>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -48,6 +49,7 @@
 #include "../frmts/vrt/vrtdataset.h"
 #include "gdal_priv.h"
 #include "gdal_priv_templates.hpp"
+#include "gdal_thread_pool.h"
 // #include "gdalsse_priv.h"
 
 // Limit types to practical use cases.
@@ -494,6 +496,7 @@ GDALPansharpenOperation::Initialize(const GDALPansharpenOptions *psOptionsIn)
                 nThreads = std::max(0, std::min(128, atoi(pszNumThreads)));
         }
     }
+    nThreads = GDALCapThreadCount(nThreads);
     if (nThreads > 1)
     {
         CPLDebug("PANSHARPEN", "Using %d threads", nThreads);
@@ -631,7 +634,45 @@ void GDALPansharpenOperation::WeightedBrovey3(
         return;
     }
 
-    for (size_t j = 0; j < nValues; j++)
+    size_t j = 0;  // Used after for.
+    if constexpr (!bHasBitDepth &&
+                  !(std::numeric_limits<WorkDataType>::is_integer) &&
+                  std::is_same_v<WorkDataType, OutDataType>)
+    {
+        if (psOptions->nInputSpectralBands == 3 &&
+            psOptions->nOutPansharpenedBands == 3 &&
+            psOptions->panOutPansharpenedBands[0] == 0 &&
+            psOptions->panOutPansharpenedBands[1] == 1 &&
+            psOptions->panOutPansharpenedBands[2] == 2)
+        {
+            j = WeightedBroveyFloatingPointInternal<WorkDataType, 3, 3>(
+                pPanBuffer, pUpsampledSpectralBuffer, pDataBuf, nValues,
+                nBandValues);
+        }
+        else if (psOptions->nInputSpectralBands == 4 &&
+                 psOptions->nOutPansharpenedBands == 4 &&
+                 psOptions->panOutPansharpenedBands[0] == 0 &&
+                 psOptions->panOutPansharpenedBands[1] == 1 &&
+                 psOptions->panOutPansharpenedBands[2] == 2 &&
+                 psOptions->panOutPansharpenedBands[3] == 3)
+        {
+            j = WeightedBroveyFloatingPointInternal<WorkDataType, 4, 4>(
+                pPanBuffer, pUpsampledSpectralBuffer, pDataBuf, nValues,
+                nBandValues);
+        }
+        else if (psOptions->nInputSpectralBands == 4 &&
+                 psOptions->nOutPansharpenedBands == 3 &&
+                 psOptions->panOutPansharpenedBands[0] == 0 &&
+                 psOptions->panOutPansharpenedBands[1] == 1 &&
+                 psOptions->panOutPansharpenedBands[2] == 2)
+        {
+            j = WeightedBroveyFloatingPointInternal<WorkDataType, 4, 3>(
+                pPanBuffer, pUpsampledSpectralBuffer, pDataBuf, nValues,
+                nBandValues);
+        }
+    }
+
+    for (; j < nValues; j++)
     {
         double dfFactor = 0.0;
         // if( pPanBuffer[j] == 0 )
@@ -741,8 +782,83 @@ size_t GDALPansharpenOperation::WeightedBroveyPositiveWeightsInternal(
     return j;
 }
 
+/************************************************************************/
+/*                WeightedBroveyFloatingPointInternal()                 */
+/************************************************************************/
+
+// Same as WeightedBroveyPositiveWeightsInternal(), but for Float32/Float64
+// working and output types, for which no clamping or rounding is needed,
+// and which can therefore accept any weights. Returns the number of
+// values processed, the remaining ones being left to the caller.
+template <class T, int NINPUT, int NOUTPUT>
+size_t GDALPansharpenOperation::WeightedBroveyFloatingPointInternal(
+    const T *pPanBuffer, const T *pUpsampledSpectralBuffer, T *pDataBuf,
+    size_t nValues, size_t nBandValues) const
+{
+    static_assert(NINPUT == 3 || NINPUT == 4);
+    static_assert(NOUTPUT == 3 || NOUTPUT == 4);
+    const XMMReg4Double w0 =
+        XMMReg4Double::Load1ValHighAndLow(psOptions->padfWeights + 0);
+    const XMMReg4Double w1 =
+        XMMReg4Double::Load1ValHighAndLow(psOptions->padfWeights + 1);
+    const XMMReg4Double w2 =
+        XMMReg4Double::Load1ValHighAndLow(psOptions->padfWeights + 2);
+    [[maybe_unused]] const XMMReg4Double w3 =
+        (NINPUT == 3)
+            ? XMMReg4Double::Zero()
+            : XMMReg4Double::Load1ValHighAndLow(psOptions->padfWeights + 3);
+
+    const XMMReg4Double zero = XMMReg4Double::Zero();
+
+    size_t j = 0;  // Used after for.
+    for (; j + 3 < nValues; j += 4)
+    {
+        XMMReg4Double pseudoPanchro = zero;
+
+        XMMReg4Double val0 = XMMReg4Double::Load4Val(pUpsampledSpectralBuffer +
+                                                     0 * nBandValues + j);
+        XMMReg4Double val1 = XMMReg4Double::Load4Val(pUpsampledSpectralBuffer +
+                                                     1 * nBandValues + j);
+        XMMReg4Double val2 = XMMReg4Double::Load4Val(pUpsampledSpectralBuffer +
+                                                     2 * nBandValues + j);
+        XMMReg4Double val3;
+        if constexpr (NINPUT == 4 || NOUTPUT == 4)
+        {
+            val3 = XMMReg4Double::Load4Val(pUpsampledSpectralBuffer +
+                                           3 * nBandValues + j);
+        }
+
+        pseudoPanchro += w0 * val0;
+        pseudoPanchro += w1 * val1;
+        pseudoPanchro += w2 * val2;
+        if constexpr (NINPUT == 4)
+            pseudoPanchro += w3 * val3;
+
+        const XMMReg4Double factor = XMMReg4Double::And(
+            XMMReg4Double::NotEquals(pseudoPanchro, zero),
+            XMMReg4Double::Load4Val(pPanBuffer + j) / pseudoPanchro);
+
+        (val0 * factor).Store4Val(pDataBuf + 0 * nBandValues + j);
+        (val1 * factor).Store4Val(pDataBuf + 1 * nBandValues + j);
+        (val2 * factor).Store4Val(pDataBuf + 2 * nBandValues + j);
+        if constexpr (NOUTPUT == 4)
+        {
+            (val3 * factor).Store4Val(pDataBuf + 3 * nBandValues + j);
+        }
+    }
+    return j;
+}
+
 #else
 
+template <class T, int NINPUT, int NOUTPUT>
+size_t GDALPansharpenOperation::WeightedBroveyFloatingPointInternal(
+    const T *, const T *, T *, size_t, size_t) const
+{
+    // Handled by the generic loop of WeightedBrovey3()
+    return 0;
+}
+
 template <class T, int NINPUT, int NOUTPUT>
 size_t GDALPansharpenOperation::WeightedBroveyPositiveWeightsInternal(
     const T *pPanBuffer, const T *pUpsampledSpectralBuffer, T *pDataBuf,
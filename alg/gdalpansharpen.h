@@ -245,6 +245,11 @@ class GDALPansharpenOperation
         const T *pPanBuffer, const T *pUpsampledSpectralBuffer, T *pDataBuf,
         size_t nValues, size_t nBandValues, T nMaxValue) const;
 
+    template <class T, int NINPUT, int NOUTPUT>
+    size_t WeightedBroveyFloatingPointInternal(
+        const T *pPanBuffer, const T *pUpsampledSpectralBuffer, T *pDataBuf,
+        size_t nValues, size_t nBandValues) const;
+
     // cppcheck-suppress unusedPrivateFunction
     template <class T>
     void WeightedBroveyGByteOrUInt16(const T *pPanBuffer,
@@ -34,13 +34,17 @@
 #include <cstdlib>
 
 #include <algorithm>
+#include <limits>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
+#include "gdal_thread_pool.h"
 
 static CPLErr ProcessProximityLine(GInt32 *panSrcScanline, int *panNearX,
                                    int *panNearY, int bForward, int iLine,
@@ -49,6 +53,311 @@ static CPLErr ProcessProximityLine(GInt32 *panSrcScanline, int *panNearX,
                                    double *pdfSrcNoDataValue, int nTargetValues,
                                    int *panTargetValues);
 
+/************************************************************************/
+/*                   GDALDistanceTransformLine()                        */
+/*                                                                      */
+/*      One dimensional squared Euclidean distance transform of         */
+/*      Felzenszwalb & Huttenlocher: padfD[q] = min over p of           */
+/*      (q - p)^2 + padfF[p]. Infinite values of padfF are sites that   */
+/*      do not exist. panV and padfZ are working buffers of n and       */
+/*      n + 1 elements.                                                 */
+/************************************************************************/
+
+static void GDALDistanceTransformLine(const double *padfF, int n, double *padfD,
+                                      int *panV, double *padfZ)
+{
+    constexpr double INF = std::numeric_limits<double>::infinity();
+
+    // Lower envelope of the parabolas rooted at the sites
+    int k = -1;
+    for (int q = 0; q < n; ++q)
+    {
+        if (padfF[q] == INF)
+            continue;
+        if (k < 0)
+        {
+            k = 0;
+            panV[0] = q;
+            padfZ[0] = -INF;
+            padfZ[1] = INF;
+            continue;
+        }
+        const double dfFq = padfF[q] + static_cast<double>(q) * q;
+        double dfS;
+        // padfZ[0] is -infinity, so this stops at k == 0 at the latest
+        while (true)
+        {
+            const int p = panV[k];
+            dfS = (dfFq - (padfF[p] + static_cast<double>(p) * p)) /
+                  (2.0 * (q - p));
+            if (dfS > padfZ[k])
+                break;
+            --k;
+        }
+        ++k;
+        panV[k] = q;
+        padfZ[k] = dfS;
+        padfZ[k + 1] = INF;
+    }
+
+    if (k < 0)
+    {
+        std::fill(padfD, padfD + n, INF);
+        return;
+    }
+
+    int j = 0;
+    for (int q = 0; q < n; ++q)
+    {
+        while (padfZ[j + 1] < q)
+            ++j;
+        const double dfDX = q - panV[j];
+        padfD[q] = dfDX * dfDX + padfF[panV[j]];
+    }
+}
+
+/************************************************************************/
+/*                       GDALProximityRowsJob                           */
+/************************************************************************/
+
+namespace
+{
+struct GDALProximityRowsJob
+{
+    int nXSize = 0;
+    int nRows = 0;
+    // nRows lines of squared vertical distances to the nearest target of
+    // the column (infinite if there is none)
+    const double *padfG = nullptr;
+    // nRows lines of source values
+    const GInt32 *panSrc = nullptr;
+    // nRows lines of output proximities
+    float *pafProximity = nullptr;
+    double dfMaxDist = 0;
+    double dfDistMult = 1;
+    const double *pdfSrcNoData = nullptr;
+    float fNoDataValue = 0;
+    bool bFixedBufVal = false;
+    double dfFixedBufVal = 0;
+};
+}  // namespace
+
+/************************************************************************/
+/*                      GDALProximityProcessRows()                      */
+/************************************************************************/
+
+static void GDALProximityProcessRows(void *pData)
+{
+    const auto psJob = static_cast<const GDALProximityRowsJob *>(pData);
+    const int nXSize = psJob->nXSize;
+    std::vector<double> adfD(nXSize);
+    std::vector<int> anV(nXSize);
+    std::vector<double> adfZ(static_cast<size_t>(nXSize) + 1);
+    const double dfMaxDistSq = psJob->dfMaxDist * psJob->dfMaxDist;
+
+    for (int iRow = 0; iRow < psJob->nRows; ++iRow)
+    {
+        const size_t nOffset = static_cast<size_t>(iRow) * nXSize;
+        GDALDistanceTransformLine(psJob->padfG + nOffset, nXSize, adfD.data(),
+                                  anV.data(), adfZ.data());
+        const GInt32 *panSrc = psJob->panSrc + nOffset;
+        float *pafProximity = psJob->pafProximity + nOffset;
+        for (int i = 0; i < nXSize; ++i)
+        {
+            const double dfDistSq = adfD[i];
+            if (dfDistSq == 0)
+                pafProximity[i] = 0.0f;
+            else if ((psJob->pdfSrcNoData &&
+                      panSrc[i] == *(psJob->pdfSrcNoData)) ||
+                     !(dfDistSq <= dfMaxDistSq))
+                pafProximity[i] = psJob->fNoDataValue;
+            else if (psJob->bFixedBufVal)
+                pafProximity[i] = static_cast<float>(psJob->dfFixedBufVal);
+            else
+                pafProximity[i] =
+                    static_cast<float>(sqrt(dfDistSq) * psJob->dfDistMult);
+        }
+    }
+}
+
+/************************************************************************/
+/*                     GDALComputeProximityExact()                      */
+/*                                                                      */
+/*      Exact Euclidean distance transform, with the separable          */
+/*      algorithm of Felzenszwalb & Huttenlocher. The column pass is    */
+/*      done with a top to bottom sweep, saving the distance to the     */
+/*      nearest target above in hWorkBand, and a bottom to top sweep    */
+/*      that completes it with the nearest target below. The row        */
+/*      pass is then applied on batches of lines, in parallel.          */
+/************************************************************************/
+
+static CPLErr GDALComputeProximityExact(
+    GDALRasterBandH hSrcBand, GDALRasterBandH hWorkBand,
+    GDALRasterBandH hProximityBand, double dfMaxDist, double dfDistMult,
+    const double *pdfSrcNoData, float fNoDataValue, bool bFixedBufVal,
+    double dfFixedBufVal, int nTargetValues, const int *panTargetValues,
+    int nThreads, GDALProgressFunc pfnProgress, void *pProgressArg)
+{
+    const int nXSize = GDALGetRasterBandXSize(hSrcBand);
+    const int nYSize = GDALGetRasterBandYSize(hSrcBand);
+
+    const auto IsTarget = [nTargetValues, panTargetValues](GInt32 nVal)
+    {
+        if (nTargetValues == 0)
+            return nVal != 0;
+        for (int i = 0; i < nTargetValues; i++)
+        {
+            if (nVal == panTargetValues[i])
+                return true;
+        }
+        return false;
+    };
+
+    // Lines processed by a job
+    const int nRowsPerJob =
+        std::max(1, std::min(64, 1024 * 1024 / std::max(1, nXSize)));
+    const int nRowsPerBatch = nRowsPerJob * nThreads;
+
+    std::vector<GInt32> anSrc;
+    std::vector<float> afDist;
+    std::vector<double> adfG;
+    std::vector<float> afProximity;
+    std::vector<int> anTargetY;
+    try
+    {
+        anSrc.resize(static_cast<size_t>(nXSize) * nRowsPerBatch);
+        afDist.resize(static_cast<size_t>(nXSize) * nRowsPerBatch);
+        adfG.resize(static_cast<size_t>(nXSize) * nRowsPerBatch);
+        afProximity.resize(static_cast<size_t>(nXSize) * nRowsPerBatch);
+        anTargetY.resize(nXSize, -1);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate proximity working buffers");
+        return CE_Failure;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Top to bottom: vertical distance to the nearest target above.   */
+    /* -------------------------------------------------------------------- */
+    CPLErr eErr = CE_None;
+    for (int iLine = 0; eErr == CE_None && iLine < nYSize; iLine++)
+    {
+        eErr = GDALRasterIO(hSrcBand, GF_Read, 0, iLine, nXSize, 1,
+                            anSrc.data(), nXSize, 1, GDT_Int32, 0, 0);
+        if (eErr != CE_None)
+            break;
+
+        for (int i = 0; i < nXSize; i++)
+        {
+            if (IsTarget(anSrc[i]))
+                anTargetY[i] = iLine;
+            afDist[i] = anTargetY[i] < 0
+                            ? -1.0f
+                            : static_cast<float>(iLine - anTargetY[i]);
+        }
+
+        eErr = GDALRasterIO(hWorkBand, GF_Write, 0, iLine, nXSize, 1,
+                            afDist.data(), nXSize, 1, GDT_Float32, 0, 0);
+
+        if (eErr == CE_None &&
+            !pfnProgress(0.25 * (iLine + 1) / static_cast<double>(nYSize), "",
+                         pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Bottom to top: complete the column pass with the nearest        */
+    /*      target below, and run the row pass on batches of lines.         */
+    /* -------------------------------------------------------------------- */
+    std::fill(anTargetY.begin(), anTargetY.end(), -1);
+
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+
+    for (int iBatchEnd = nYSize; eErr == CE_None && iBatchEnd > 0;
+         iBatchEnd -= nRowsPerBatch)
+    {
+        const int iBatchStart = std::max(0, iBatchEnd - nRowsPerBatch);
+        const int nBatchRows = iBatchEnd - iBatchStart;
+
+        eErr = GDALRasterIO(hWorkBand, GF_Read, 0, iBatchStart, nXSize,
+                            nBatchRows, afDist.data(), nXSize, nBatchRows,
+                            GDT_Float32, 0, 0);
+        if (eErr == CE_None)
+            eErr = GDALRasterIO(hSrcBand, GF_Read, 0, iBatchStart, nXSize,
+                                nBatchRows, anSrc.data(), nXSize, nBatchRows,
+                                GDT_Int32, 0, 0);
+        if (eErr != CE_None)
+            break;
+
+        for (int iRow = nBatchRows - 1; iRow >= 0; --iRow)
+        {
+            const int iLine = iBatchStart + iRow;
+            const size_t nOffset = static_cast<size_t>(iRow) * nXSize;
+            for (int i = 0; i < nXSize; i++)
+            {
+                if (IsTarget(anSrc[nOffset + i]))
+                    anTargetY[i] = iLine;
+                double dfDY = afDist[nOffset + i];
+                if (anTargetY[i] >= 0 &&
+                    (dfDY < 0 || anTargetY[i] - iLine < dfDY))
+                    dfDY = anTargetY[i] - iLine;
+                adfG[nOffset + i] =
+                    dfDY < 0 ? std::numeric_limits<double>::infinity()
+                             : dfDY * dfDY;
+            }
+        }
+
+        const int nJobs = (nBatchRows + nRowsPerJob - 1) / nRowsPerJob;
+        std::vector<GDALProximityRowsJob> asJobs(nJobs);
+        for (int iJob = 0; iJob < nJobs; ++iJob)
+        {
+            auto &sJob = asJobs[iJob];
+            const size_t nOffset =
+                static_cast<size_t>(iJob) * nRowsPerJob * nXSize;
+            sJob.nXSize = nXSize;
+            sJob.nRows = std::min(nRowsPerJob, nBatchRows - iJob * nRowsPerJob);
+            sJob.padfG = adfG.data() + nOffset;
+            sJob.panSrc = anSrc.data() + nOffset;
+            sJob.pafProximity = afProximity.data() + nOffset;
+            sJob.dfMaxDist = dfMaxDist;
+            sJob.dfDistMult = dfDistMult;
+            sJob.pdfSrcNoData = pdfSrcNoData;
+            sJob.fNoDataValue = fNoDataValue;
+            sJob.bFixedBufVal = bFixedBufVal;
+            sJob.dfFixedBufVal = dfFixedBufVal;
+            if (!poJobQueue ||
+                !poJobQueue->SubmitJob(GDALProximityProcessRows, &sJob))
+            {
+                GDALProximityProcessRows(&sJob);
+            }
+        }
+        if (poJobQueue)
+            poJobQueue->WaitCompletion();
+
+        eErr = GDALRasterIO(hProximityBand, GF_Write, 0, iBatchStart, nXSize,
+                            nBatchRows, afProximity.data(), nXSize, nBatchRows,
+                            GDT_Float32, 0, 0);
+
+        if (eErr == CE_None &&
+            !pfnProgress(0.25 + 0.75 * (nYSize - iBatchStart) /
+                                    static_cast<double>(nYSize),
+                         "", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+    }
+
+    return eErr;
+}
+
 /************************************************************************/
 /*                        GDALComputeProximity()                        */
 /************************************************************************/
@@ -105,6 +414,19 @@ the proximity output.
 
 If this option is set, all pixels within the MAXDIST threadhold are
 set to this fixed value instead of to a proximity distance.
+
+  ALGORITHM=[APPROXIMATE]/EXACT
+
+(GDAL >= 3.10) The default algorithm propagates the nearest target found
+so far in two passes over the image, which may occasionally retain a target
+that is not the nearest one, and thus over-estimate the distance. The EXACT
+algorithm computes an exact Euclidean distance transform (Felzenszwalb &
+Huttenlocher separable algorithm).
+
+  NUM_THREADS=n/ALL_CPUS
+
+(GDAL >= 3.10) Number of worker threads used by the EXACT algorithm for
+its row pass. Defaults to 1.
 */
 
 CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
@@ -220,6 +542,31 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
         bFixedBufVal = true;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Which algorithm?                                                */
+    /* -------------------------------------------------------------------- */
+    bool bExact = false;
+    pszOpt = CSLFetchNameValue(papszOptions, "ALGORITHM");
+    if (pszOpt)
+    {
+        if (EQUAL(pszOpt, "EXACT"))
+            bExact = true;
+        else if (!EQUAL(pszOpt, "APPROXIMATE"))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Unrecognized ALGORITHM value '%s'.", pszOpt);
+            return CE_Failure;
+        }
+    }
+
+    int nThreads = 1;
+    pszOpt = CSLFetchNameValue(papszOptions, "NUM_THREADS");
+    if (pszOpt)
+    {
+        nThreads = EQUAL(pszOpt, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszOpt);
+        nThreads = std::max(1, std::min(nThreads, 1024));
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Get the target value(s).                                        */
     /* -------------------------------------------------------------------- */
@@ -254,7 +601,8 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
     /* -------------------------------------------------------------------- */
     /*      We need a signed type for the working proximity values kept     */
     /*      on disk.  If our proximity band is not signed, then create a    */
-    /*      temporary file for this purpose.                                */
+    /*      temporary file for this purpose.  The exact algorithm stores    */
+    /*      vertical distances, that need a floating point type.            */
     /* -------------------------------------------------------------------- */
     GDALRasterBandH hWorkProximityBand = hProximityBand;
     GDALDatasetH hWorkProximityDS = nullptr;
@@ -268,8 +616,9 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
     GInt32 *panSrcScanline = nullptr;
     bool bTempFileAlreadyDeleted = false;
 
-    if (eProxType == GDT_Byte || eProxType == GDT_UInt16 ||
-        eProxType == GDT_UInt32)
+    if (bExact ? (eProxType != GDT_Float32 && eProxType != GDT_Float64)
+               : (eProxType == GDT_Byte || eProxType == GDT_UInt16 ||
+                  eProxType == GDT_UInt32))
     {
         GDALDriverH hDriver = GDALGetDriverByName("GTiff");
         if (hDriver == nullptr)
@@ -294,6 +643,16 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
         hWorkProximityBand = GDALGetRasterBand(hWorkProximityDS, 1);
     }
 
+    if (bExact)
+    {
+        eErr = GDALComputeProximityExact(
+            hSrcBand, hWorkProximityBand, hProximityBand, dfMaxDist,
+            dfDistMult, pdfSrcNoData, fNoDataValue, bFixedBufVal,
+            dfFixedBufVal, nTargetValues, panTargetValues, nThreads,
+            pfnProgress, pProgressArg);
+        goto end;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Allocate buffer for two scanlines of distances as floats        */
     /*      (the current and last line).                                    */
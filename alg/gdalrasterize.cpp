@@ -36,6 +36,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <cfloat>
+#include <cmath>
 #include <limits>
 #include <vector>
 #include <algorithm>
@@ -45,9 +46,11 @@
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
 #include "gdal_priv_templates.hpp"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
@@ -547,40 +550,76 @@ static void GDALCollectRingsFromGeometry(const OGRGeometry *poShape,
 }
 
 /************************************************************************/
-/*                       gv_rasterize_one_shape()                       */
+/*                          GDALRasterizeShape                          */
 /************************************************************************/
-static void gv_rasterize_one_shape(
-    unsigned char *pabyChunkBuf, int nXOff, int nYOff, int nXSize, int nYSize,
-    int nBands, GDALDataType eType, int nPixelSpace, GSpacing nLineSpace,
-    GSpacing nBandSpace, int bAllTouched, const OGRGeometry *poShape,
-    GDALDataType eBurnValueType, const double *padfBurnValues,
-    const int64_t *panBurnValues, GDALBurnValueSrc eBurnValueSrc,
-    GDALRasterMergeAlg eMergeAlg, GDALTransformerFunc pfnTransformer,
-    void *pTransformArg)
 
+// Rings or parts of a geometry, with their point coordinates transformed to
+// the pixel/line coordinates of the target raster.
+struct GDALRasterizeShape
 {
-    if (poShape == nullptr || poShape->IsEmpty())
-        return;
-    const auto eGeomType = wkbFlatten(poShape->getGeometryType());
+    OGRwkbGeometryType eGeomType = wkbUnknown;
+    std::vector<double> aPointX{};
+    std::vector<double> aPointY{};
+    std::vector<double> aPointVariant{};
+    std::vector<int> aPartSize{};
+};
 
-    if ((eGeomType == wkbMultiLineString || eGeomType == wkbMultiPolygon ||
-         eGeomType == wkbGeometryCollection) &&
-        eMergeAlg == GRMA_Replace)
+/************************************************************************/
+/*                        gv_prepare_one_shape()                        */
+/************************************************************************/
+
+static void gv_prepare_one_shape(const OGRGeometry *poShape,
+                                 GDALBurnValueSrc eBurnValueSrc,
+                                 GDALTransformerFunc pfnTransformer,
+                                 void *pTransformArg,
+                                 GDALRasterizeShape &oShape)
+{
+    oShape.eGeomType = wkbFlatten(poShape->getGeometryType());
+
+    /* -------------------------------------------------------------------- */
+    /*      Transform polygon geometries into a set of rings and a part     */
+    /*      size list.                                                      */
+    /* -------------------------------------------------------------------- */
+    GDALCollectRingsFromGeometry(poShape, oShape.aPointX, oShape.aPointY,
+                                 oShape.aPointVariant, oShape.aPartSize,
+                                 eBurnValueSrc);
+
+    /* -------------------------------------------------------------------- */
+    /*      Transform points if needed.                                     */
+    /* -------------------------------------------------------------------- */
+    if (pfnTransformer != nullptr)
     {
-        // Speed optimization: in replace mode, we can rasterize each part of
-        // a geometry collection separately.
-        const auto poGC = poShape->toGeometryCollection();
-        for (const auto poPart : *poGC)
-        {
-            gv_rasterize_one_shape(
-                pabyChunkBuf, nXOff, nYOff, nXSize, nYSize, nBands, eType,
-                nPixelSpace, nLineSpace, nBandSpace, bAllTouched, poPart,
-                eBurnValueType, padfBurnValues, panBurnValues, eBurnValueSrc,
-                eMergeAlg, pfnTransformer, pTransformArg);
-        }
-        return;
+        int *panSuccess =
+            static_cast<int *>(CPLCalloc(sizeof(int), oShape.aPointX.size()));
+
+        // TODO: We need to add all appropriate error checking at some point.
+        pfnTransformer(pTransformArg, FALSE,
+                       static_cast<int>(oShape.aPointX.size()),
+                       oShape.aPointX.data(), oShape.aPointY.data(), nullptr,
+                       panSuccess);
+        CPLFree(panSuccess);
     }
+}
+
+/************************************************************************/
+/*                         gv_burn_one_shape()                          */
+/*                                                                      */
+/*      Burn a prepared shape into a buffer. The point coordinates      */
+/*      and variants of oShape are modified.                            */
+/************************************************************************/
+
+static void gv_burn_one_shape(unsigned char *pabyChunkBuf, int nXOff,
+                              int nYOff, int nXSize, int nYSize, int nBands,
+                              GDALDataType eType, int nPixelSpace,
+                              GSpacing nLineSpace, GSpacing nBandSpace,
+                              int bAllTouched, GDALRasterizeShape &oShape,
+                              GDALDataType eBurnValueType,
+                              const double *padfBurnValues,
+                              const int64_t *panBurnValues,
+                              GDALBurnValueSrc eBurnValueSrc,
+                              GDALRasterMergeAlg eMergeAlg)
 
+{
     if (nPixelSpace == 0)
     {
         nPixelSpace = GDALGetDataTypeSizeBytes(eType);
@@ -617,31 +656,10 @@ static void gv_rasterize_one_shape(
     sInfo.bFillSetVisitedPoints = false;
     sInfo.poSetVisitedPoints = nullptr;
 
-    /* -------------------------------------------------------------------- */
-    /*      Transform polygon geometries into a set of rings and a part     */
-    /*      size list.                                                      */
-    /* -------------------------------------------------------------------- */
-    std::vector<double> aPointX;
-    std::vector<double> aPointY;
-    std::vector<double> aPointVariant;
-    std::vector<int> aPartSize;
-
-    GDALCollectRingsFromGeometry(poShape, aPointX, aPointY, aPointVariant,
-                                 aPartSize, eBurnValueSrc);
-
-    /* -------------------------------------------------------------------- */
-    /*      Transform points if needed.                                     */
-    /* -------------------------------------------------------------------- */
-    if (pfnTransformer != nullptr)
-    {
-        int *panSuccess =
-            static_cast<int *>(CPLCalloc(sizeof(int), aPointX.size()));
-
-        // TODO: We need to add all appropriate error checking at some point.
-        pfnTransformer(pTransformArg, FALSE, static_cast<int>(aPointX.size()),
-                       aPointX.data(), aPointY.data(), nullptr, panSuccess);
-        CPLFree(panSuccess);
-    }
+    std::vector<double> &aPointX = oShape.aPointX;
+    std::vector<double> &aPointY = oShape.aPointY;
+    std::vector<double> &aPointVariant = oShape.aPointVariant;
+    std::vector<int> &aPartSize = oShape.aPartSize;
 
     /* -------------------------------------------------------------------- */
     /*      Shift to account for the buffer offset of this buffer.          */
@@ -657,7 +675,7 @@ static void gv_rasterize_one_shape(
     /*      stored in continuous memory block.                              */
     /* -------------------------------------------------------------------- */
 
-    switch (eGeomType)
+    switch (oShape.eGeomType)
     {
         case wkbPoint:
         case wkbMultiPoint:
@@ -744,6 +762,50 @@ static void gv_rasterize_one_shape(
     delete sInfo.poSetVisitedPoints;
 }
 
+/************************************************************************/
+/*                       gv_rasterize_one_shape()                       */
+/************************************************************************/
+static void gv_rasterize_one_shape(
+    unsigned char *pabyChunkBuf, int nXOff, int nYOff, int nXSize, int nYSize,
+    int nBands, GDALDataType eType, int nPixelSpace, GSpacing nLineSpace,
+    GSpacing nBandSpace, int bAllTouched, const OGRGeometry *poShape,
+    GDALDataType eBurnValueType, const double *padfBurnValues,
+    const int64_t *panBurnValues, GDALBurnValueSrc eBurnValueSrc,
+    GDALRasterMergeAlg eMergeAlg, GDALTransformerFunc pfnTransformer,
+    void *pTransformArg)
+
+{
+    if (poShape == nullptr || poShape->IsEmpty())
+        return;
+    const auto eGeomType = wkbFlatten(poShape->getGeometryType());
+
+    if ((eGeomType == wkbMultiLineString || eGeomType == wkbMultiPolygon ||
+         eGeomType == wkbGeometryCollection) &&
+        eMergeAlg == GRMA_Replace)
+    {
+        // Speed optimization: in replace mode, we can rasterize each part of
+        // a geometry collection separately.
+        const auto poGC = poShape->toGeometryCollection();
+        for (const auto poPart : *poGC)
+        {
+            gv_rasterize_one_shape(
+                pabyChunkBuf, nXOff, nYOff, nXSize, nYSize, nBands, eType,
+                nPixelSpace, nLineSpace, nBandSpace, bAllTouched, poPart,
+                eBurnValueType, padfBurnValues, panBurnValues, eBurnValueSrc,
+                eMergeAlg, pfnTransformer, pTransformArg);
+        }
+        return;
+    }
+
+    GDALRasterizeShape oShape;
+    gv_prepare_one_shape(poShape, eBurnValueSrc, pfnTransformer, pTransformArg,
+                         oShape);
+    gv_burn_one_shape(pabyChunkBuf, nXOff, nYOff, nXSize, nYSize, nBands,
+                      eType, nPixelSpace, nLineSpace, nBandSpace, bAllTouched,
+                      oShape, eBurnValueType, padfBurnValues, panBurnValues,
+                      eBurnValueSrc, eMergeAlg);
+}
+
 /************************************************************************/
 /*                        GDALRasterizeOptions()                        */
 /*                                                                      */
@@ -1443,6 +1505,305 @@ static CPLErr GDALRasterizeGeometriesInternal(
     return eErr;
 }
 
+/************************************************************************/
+/*                        GDALRasterizeStripJob                         */
+/************************************************************************/
+
+namespace
+{
+struct GDALRasterizeBinnedShape
+{
+    GDALRasterizeShape oShape{};
+    // Index of the burn values of the shape in the batch burn value array
+    size_t nBurnValuesIdx = 0;
+};
+
+struct GDALRasterizeStripJob
+{
+    const std::vector<GDALRasterizeBinnedShape> *paoShapes = nullptr;
+    const std::vector<double> *padfBurnValues = nullptr;
+    // Indices in paoShapes of the shapes intersecting the strip, in order
+    const std::vector<size_t> *panShapeIdx = nullptr;
+    unsigned char *pabyBuf = nullptr;
+    int nYOff = 0;
+    int nXSize = 0;
+    int nYSize = 0;
+    int nBands = 0;
+    GDALDataType eType = GDT_Unknown;
+    GSpacing nLineSpace = 0;
+    GSpacing nBandSpace = 0;
+    int bAllTouched = FALSE;
+    GDALBurnValueSrc eBurnValueSrc = GBV_UserBurnValue;
+    GDALRasterMergeAlg eMergeAlg = GRMA_Replace;
+};
+}  // namespace
+
+/************************************************************************/
+/*                        GDALRasterizeStrip()                          */
+/************************************************************************/
+
+static void GDALRasterizeStrip(void *pData)
+{
+    const auto psJob = static_cast<GDALRasterizeStripJob *>(pData);
+    GDALRasterizeShape oShape;
+    for (const size_t iShape : *(psJob->panShapeIdx))
+    {
+        // gv_burn_one_shape() modifies the shape, and a shape may be
+        // shared by several strips, so burn a copy.
+        const auto &oBinnedShape = (*psJob->paoShapes)[iShape];
+        oShape.eGeomType = oBinnedShape.oShape.eGeomType;
+        oShape.aPointX = oBinnedShape.oShape.aPointX;
+        oShape.aPointY = oBinnedShape.oShape.aPointY;
+        oShape.aPointVariant = oBinnedShape.oShape.aPointVariant;
+        oShape.aPartSize = oBinnedShape.oShape.aPartSize;
+        gv_burn_one_shape(
+            psJob->pabyBuf, 0, psJob->nYOff, psJob->nXSize, psJob->nYSize,
+            psJob->nBands, psJob->eType, 0, psJob->nLineSpace,
+            psJob->nBandSpace, psJob->bAllTouched, oShape, GDT_Float64,
+            psJob->padfBurnValues->data() + oBinnedShape.nBurnValuesIdx,
+            nullptr, psJob->eBurnValueSrc, psJob->eMergeAlg);
+    }
+}
+
+/************************************************************************/
+/*                     GDALRasterizePrepareShapes()                     */
+/************************************************************************/
+
+static void GDALRasterizePrepareShapes(
+    const OGRGeometry *poShape, GDALBurnValueSrc eBurnValueSrc,
+    GDALRasterMergeAlg eMergeAlg, GDALTransformerFunc pfnTransformer,
+    void *pTransformArg, size_t nBurnValuesIdx,
+    std::vector<GDALRasterizeBinnedShape> &aoShapes)
+{
+    if (poShape == nullptr || poShape->IsEmpty())
+        return;
+    const auto eGeomType = wkbFlatten(poShape->getGeometryType());
+
+    // Same splitting of collections as in gv_rasterize_one_shape()
+    if ((eGeomType == wkbMultiLineString || eGeomType == wkbMultiPolygon ||
+         eGeomType == wkbGeometryCollection) &&
+        eMergeAlg == GRMA_Replace)
+    {
+        for (const auto poPart : *(poShape->toGeometryCollection()))
+        {
+            GDALRasterizePrepareShapes(poPart, eBurnValueSrc, eMergeAlg,
+                                       pfnTransformer, pTransformArg,
+                                       nBurnValuesIdx, aoShapes);
+        }
+        return;
+    }
+
+    aoShapes.emplace_back();
+    aoShapes.back().nBurnValuesIdx = nBurnValuesIdx;
+    gv_prepare_one_shape(poShape, eBurnValueSrc, pfnTransformer, pTransformArg,
+                         aoShapes.back().oShape);
+}
+
+/************************************************************************/
+/*                       GDALRasterizeLayerMT()                         */
+/*                                                                      */
+/*      Multi-threaded rasterization of a layer: features are read      */
+/*      only once, transformed to pixel/line coordinates and binned     */
+/*      to horizontal strips of the raster from their vertical extent.  */
+/*      Each chunk of nYChunkSize lines is split into nThreads strips   */
+/*      that are burnt in parallel, as they do not overlap. To bound    */
+/*      memory use, features are processed in batches.                  */
+/************************************************************************/
+
+static CPLErr GDALRasterizeLayerMT(
+    GDALDataset *poDS, int nBandCount, int *panBandList, OGRLayer *poLayer,
+    int iBurnField, const double *padfBurnValues,
+    GDALTransformerFunc pfnTransformer, void *pTransformArg, int bAllTouched,
+    GDALBurnValueSrc eBurnValueSrc, GDALRasterMergeAlg eMergeAlg,
+    GDALDataType eType, int nYChunkSize, unsigned char *pabyChunkBuf,
+    int nThreads, GDALProgressFunc pfnProgress, void *pProgressArg)
+{
+    const int nXSize = poDS->GetRasterXSize();
+    const int nYSize = poDS->GetRasterYSize();
+    // If the whole raster is a single chunk, it is read and written by the
+    // caller.
+    const bool bSingleChunk = nYChunkSize == nYSize;
+    const int nStripHeight =
+        std::max(1, (nYChunkSize + nThreads - 1) / nThreads);
+    const int nStrips = (nYSize + nStripHeight - 1) / nStripHeight;
+    const int nStripsPerChunk =
+        bSingleChunk ? nStrips : std::max(1, nYChunkSize / nStripHeight);
+    const GSpacing nLineSpace =
+        static_cast<GSpacing>(nXSize) * GDALGetDataTypeSizeBytes(eType);
+
+    // Maximum number of points of the shapes of a batch
+    constexpr size_t knMaxBatchPoints = 10 * 1000 * 1000;
+
+    std::vector<GDALRasterizeBinnedShape> aoShapes;
+    std::vector<double> adfBurnValues;
+    std::vector<std::vector<size_t>> aanStripShapes(nStrips);
+    size_t nBatchPoints = 0;
+
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+
+    const auto BurnBatch = [&]()
+    {
+        CPLErr eErr = CE_None;
+        for (int iStrip = 0; eErr == CE_None && iStrip < nStrips;
+             iStrip += nStripsPerChunk)
+        {
+            const int nChunkStrips =
+                std::min(nStripsPerChunk, nStrips - iStrip);
+            bool bHasShapes = false;
+            for (int i = 0; !bHasShapes && i < nChunkStrips; ++i)
+                bHasShapes = !aanStripShapes[iStrip + i].empty();
+            if (!bHasShapes)
+                continue;
+
+            const int nChunkYOff = iStrip * nStripHeight;
+            const int nChunkYSize =
+                std::min(nChunkStrips * nStripHeight, nYSize - nChunkYOff);
+            if (!bSingleChunk)
+            {
+                eErr = poDS->RasterIO(GF_Read, 0, nChunkYOff, nXSize,
+                                      nChunkYSize, pabyChunkBuf, nXSize,
+                                      nChunkYSize, eType, nBandCount,
+                                      panBandList, 0, 0, 0, nullptr);
+                if (eErr != CE_None)
+                    break;
+            }
+
+            std::vector<GDALRasterizeStripJob> asJobs(nChunkStrips);
+            for (int i = 0; i < nChunkStrips; ++i)
+            {
+                auto &sJob = asJobs[i];
+                sJob.paoShapes = &aoShapes;
+                sJob.padfBurnValues = &adfBurnValues;
+                sJob.panShapeIdx = &aanStripShapes[iStrip + i];
+                sJob.pabyBuf = pabyChunkBuf + i * nStripHeight * nLineSpace;
+                sJob.nYOff = (iStrip + i) * nStripHeight;
+                sJob.nXSize = nXSize;
+                sJob.nYSize = std::min(nStripHeight, nYSize - sJob.nYOff);
+                sJob.nBands = nBandCount;
+                sJob.eType = eType;
+                sJob.nLineSpace = nLineSpace;
+                sJob.nBandSpace = nLineSpace * nChunkYSize;
+                sJob.bAllTouched = bAllTouched;
+                sJob.eBurnValueSrc = eBurnValueSrc;
+                sJob.eMergeAlg = eMergeAlg;
+                if (sJob.panShapeIdx->empty())
+                    continue;
+                if (!poJobQueue ||
+                    !poJobQueue->SubmitJob(GDALRasterizeStrip, &sJob))
+                {
+                    GDALRasterizeStrip(&sJob);
+                }
+            }
+            if (poJobQueue)
+                poJobQueue->WaitCompletion();
+
+            if (!bSingleChunk)
+            {
+                eErr = poDS->RasterIO(GF_Write, 0, nChunkYOff, nXSize,
+                                      nChunkYSize, pabyChunkBuf, nXSize,
+                                      nChunkYSize, eType, nBandCount,
+                                      panBandList, 0, 0, 0, nullptr);
+            }
+        }
+
+        aoShapes.clear();
+        adfBurnValues.clear();
+        for (auto &anStripShapes : aanStripShapes)
+            anStripShapes.clear();
+        nBatchPoints = 0;
+        return eErr;
+    };
+
+    CPLErr eErr = CE_None;
+    const GIntBig nFeatureCount = poLayer->GetFeatureCount(FALSE);
+    GIntBig nFeaturesRead = 0;
+
+    poLayer->ResetReading();
+    for (auto &poFeat : poLayer)
+    {
+        ++nFeaturesRead;
+
+        const size_t nBurnValuesIdx = adfBurnValues.size();
+        if (iBurnField >= 0)
+        {
+            adfBurnValues.resize(nBurnValuesIdx + nBandCount,
+                                 poFeat->GetFieldAsDouble(iBurnField));
+        }
+        else
+        {
+            adfBurnValues.insert(adfBurnValues.end(), padfBurnValues,
+                                 padfBurnValues + nBandCount);
+        }
+
+        const size_t nFirstShape = aoShapes.size();
+        GDALRasterizePrepareShapes(poFeat->GetGeometryRef(), eBurnValueSrc,
+                                   eMergeAlg, pfnTransformer, pTransformArg,
+                                   nBurnValuesIdx, aoShapes);
+
+        // Bin the new shapes to the strips intersecting their vertical
+        // extent, with a margin of one line.
+        for (size_t iShape = nFirstShape; iShape < aoShapes.size(); ++iShape)
+        {
+            const auto &aPointY = aoShapes[iShape].oShape.aPointY;
+            nBatchPoints += aPointY.size();
+            double dfMinY = std::numeric_limits<double>::infinity();
+            double dfMaxY = -std::numeric_limits<double>::infinity();
+            bool bHasNaN = false;
+            for (const double dfY : aPointY)
+            {
+                if (std::isnan(dfY))
+                    bHasNaN = true;
+                dfMinY = std::min(dfMinY, dfY);
+                dfMaxY = std::max(dfMaxY, dfY);
+            }
+            if (aPointY.empty())
+                continue;
+            int nMinStrip = 0;
+            int nMaxStrip = nStrips - 1;
+            if (!bHasNaN)
+            {
+                if (dfMaxY + 1 < 0 || dfMinY - 1 >= nYSize)
+                    continue;
+                const double dfMinLine = std::max(0.0, std::floor(dfMinY) - 1);
+                const double dfMaxLine =
+                    std::min(nYSize - 1.0, std::floor(dfMaxY) + 1);
+                nMinStrip = static_cast<int>(dfMinLine) / nStripHeight;
+                nMaxStrip = static_cast<int>(dfMaxLine) / nStripHeight;
+            }
+            for (int iStrip = nMinStrip; iStrip <= nMaxStrip; ++iStrip)
+                aanStripShapes[iStrip].push_back(iShape);
+        }
+
+        if (nBatchPoints >= knMaxBatchPoints)
+        {
+            eErr = BurnBatch();
+            if (eErr != CE_None)
+                break;
+            if (nFeatureCount > 0 &&
+                !pfnProgress(std::min(1.0, static_cast<double>(nFeaturesRead) /
+                                               nFeatureCount),
+                             "", pProgressArg))
+            {
+                CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+                eErr = CE_Failure;
+                break;
+            }
+        }
+    }
+
+    if (eErr == CE_None && !aoShapes.empty())
+        eErr = BurnBatch();
+
+    if (eErr == CE_None && !pfnProgress(1.0, "", pProgressArg))
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        eErr = CE_Failure;
+    }
+
+    return eErr;
+}
+
 /************************************************************************/
 /*                        GDALRasterizeLayers()                         */
 /************************************************************************/
@@ -1498,6 +1859,10 @@ static CPLErr GDALRasterizeGeometriesInternal(
  * <li>"MERGE_ALG": May be REPLACE (the default) or ADD.  REPLACE results in
  * overwriting of value, while ADD adds the new value to the existing raster,
  * suitable for heatmaps for instance.</li>
+ * <li>"NUM_THREADS": (GDAL >= 3.10) Number of threads, or ALL_CPUS, used to
+ * burn the geometries. Each layer is then read only once, its geometries
+ * being dispatched to horizontal strips of the raster that are burnt in
+ * parallel. Defaults to 1.</li>
  * </ul>
  * @param pfnProgress the progress function to report completion.
  * @param pProgressArg callback data for progress function.
@@ -1550,6 +1915,15 @@ CPLErr GDALRasterizeLayers(GDALDatasetH hDS, int nBandCount, int *panBandList,
     /* -------------------------------------------------------------------- */
     const char *pszYChunkSize = CSLFetchNameValue(papszOptions, "CHUNKYSIZE");
 
+    int nThreads = 1;
+    const char *pszNumThreads = CSLFetchNameValue(papszOptions, "NUM_THREADS");
+    if (pszNumThreads)
+    {
+        nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                    : atoi(pszNumThreads);
+        nThreads = std::max(1, std::min(nThreads, 1024));
+    }
+
     const GDALDataType eType = poBand->GetRasterDataType();
 
     const int nScanlineBytes =
@@ -1700,79 +2074,93 @@ CPLErr GDALRasterizeLayers(GDALDatasetH hDS, int nBandCount, int *panBandList,
             }
         }
 
-        poLayer->ResetReading();
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Loop over image in designated chunks. */
-        /* --------------------------------------------------------------------
-         */
+        if (nThreads > 1)
+        {
+            if (eErr == CE_None)
+                eErr = GDALRasterizeLayerMT(
+                    poDS, nBandCount, panBandList, poLayer, iBurnField,
+                    padfBurnValues, pfnTransformer, pTransformArg, bAllTouched,
+                    eBurnValueSource, eMergeAlg, eType, nYChunkSize,
+                    pabyChunkBuf, nThreads, pfnProgress, pProgressArg);
+        }
+        else
+        {
+            poLayer->ResetReading();
 
-        double *padfAttrValues = static_cast<double *>(
-            VSI_MALLOC_VERBOSE(sizeof(double) * nBandCount));
-        if (padfAttrValues == nullptr)
-            eErr = CE_Failure;
+            /* -------------------------------------------------------------- */
+            /*      Loop over image in designated chunks.                     */
+            /* -------------------------------------------------------------- */
 
-        for (int iY = 0; iY < poDS->GetRasterYSize() && eErr == CE_None;
-             iY += nYChunkSize)
-        {
-            int nThisYChunkSize = nYChunkSize;
-            if (nThisYChunkSize + iY > poDS->GetRasterYSize())
-                nThisYChunkSize = poDS->GetRasterYSize() - iY;
+            double *padfAttrValues = static_cast<double *>(
+                VSI_MALLOC_VERBOSE(sizeof(double) * nBandCount));
+            if (padfAttrValues == nullptr)
+                eErr = CE_Failure;
 
-            // Only re-read image if not a single chunk is being rendered.
-            if (nYChunkSize < poDS->GetRasterYSize())
+            for (int iY = 0; iY < poDS->GetRasterYSize() && eErr == CE_None;
+                 iY += nYChunkSize)
             {
-                eErr = poDS->RasterIO(
-                    GF_Read, 0, iY, poDS->GetRasterXSize(), nThisYChunkSize,
-                    pabyChunkBuf, poDS->GetRasterXSize(), nThisYChunkSize,
-                    eType, nBandCount, panBandList, 0, 0, 0, nullptr);
-                if (eErr != CE_None)
-                    break;
-            }
+                int nThisYChunkSize = nYChunkSize;
+                if (nThisYChunkSize + iY > poDS->GetRasterYSize())
+                    nThisYChunkSize = poDS->GetRasterYSize() - iY;
 
-            for (auto &poFeat : poLayer)
-            {
-                OGRGeometry *poGeom = poFeat->GetGeometryRef();
+                // Only re-read image if not a single chunk is being rendered.
+                if (nYChunkSize < poDS->GetRasterYSize())
+                {
+                    eErr = poDS->RasterIO(
+                        GF_Read, 0, iY, poDS->GetRasterXSize(),
+                        nThisYChunkSize, pabyChunkBuf, poDS->GetRasterXSize(),
+                        nThisYChunkSize, eType, nBandCount, panBandList, 0, 0,
+                        0, nullptr);
+                    if (eErr != CE_None)
+                        break;
+                }
 
-                if (pszBurnAttribute)
+                for (auto &poFeat : poLayer)
                 {
-                    const double dfAttrValue =
-                        poFeat->GetFieldAsDouble(iBurnField);
-                    for (int iBand = 0; iBand < nBandCount; iBand++)
-                        padfAttrValues[iBand] = dfAttrValue;
+                    OGRGeometry *poGeom = poFeat->GetGeometryRef();
 
-                    padfBurnValues = padfAttrValues;
-                }
+                    if (pszBurnAttribute)
+                    {
+                        const double dfAttrValue =
+                            poFeat->GetFieldAsDouble(iBurnField);
+                        for (int iBand = 0; iBand < nBandCount; iBand++)
+                            padfAttrValues[iBand] = dfAttrValue;
 
-                gv_rasterize_one_shape(
-                    pabyChunkBuf, 0, iY, poDS->GetRasterXSize(),
-                    nThisYChunkSize, nBandCount, eType, 0, 0, 0, bAllTouched,
-                    poGeom, GDT_Float64, padfBurnValues, nullptr,
-                    eBurnValueSource, eMergeAlg, pfnTransformer, pTransformArg);
-            }
+                        padfBurnValues = padfAttrValues;
+                    }
 
-            // Only write image if not a single chunk is being rendered.
-            if (nYChunkSize < poDS->GetRasterYSize())
-            {
-                eErr = poDS->RasterIO(
-                    GF_Write, 0, iY, poDS->GetRasterXSize(), nThisYChunkSize,
-                    pabyChunkBuf, poDS->GetRasterXSize(), nThisYChunkSize,
-                    eType, nBandCount, panBandList, 0, 0, 0, nullptr);
-            }
+                    gv_rasterize_one_shape(
+                        pabyChunkBuf, 0, iY, poDS->GetRasterXSize(),
+                        nThisYChunkSize, nBandCount, eType, 0, 0, 0,
+                        bAllTouched, poGeom, GDT_Float64, padfBurnValues,
+                        nullptr, eBurnValueSource, eMergeAlg, pfnTransformer,
+                        pTransformArg);
+                }
 
-            poLayer->ResetReading();
+                // Only write image if not a single chunk is being rendered.
+                if (nYChunkSize < poDS->GetRasterYSize())
+                {
+                    eErr = poDS->RasterIO(
+                        GF_Write, 0, iY, poDS->GetRasterXSize(),
+                        nThisYChunkSize, pabyChunkBuf, poDS->GetRasterXSize(),
+                        nThisYChunkSize, eType, nBandCount, panBandList, 0, 0,
+                        0, nullptr);
+                }
 
-            if (!pfnProgress((iY + nThisYChunkSize) /
-                                 static_cast<double>(poDS->GetRasterYSize()),
-                             "", pProgressArg))
-            {
-                CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                eErr = CE_Failure;
+                poLayer->ResetReading();
+
+                if (!pfnProgress(
+                        (iY + nThisYChunkSize) /
+                            static_cast<double>(poDS->GetRasterYSize()),
+                        "", pProgressArg))
+                {
+                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+                    eErr = CE_Failure;
+                }
             }
-        }
 
-        VSIFree(padfAttrValues);
+            VSIFree(padfAttrValues);
+        }
 
         if (bNeedToFreeTransformer)
         {
@@ -0,0 +1,681 @@
+/******************************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  Strip based, multi-threaded, connected component labeling
+ * Author:   agent, <agent at local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent at local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "gdal_alg.h"
+#include "gdal_alg_priv.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_progress.h"
+#include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal.h"
+#include "gdal_thread_pool.h"
+
+/*! @cond Doxygen_Suppress */
+
+/************************************************************************/
+/*                      GDALGetLabelStripHeight()                       */
+/*                                                                      */
+/*      Height of the strips processed by GDALLabelRasterStrips().      */
+/*      It does not depend on the number of threads, so that the        */
+/*      polygon ids do not either.                                      */
+/************************************************************************/
+
+int GDALGetLabelStripHeight(int nXSize, int nYSize, size_t nValueSize)
+{
+    const int nStripHeight = static_cast<int>(std::max<size_t>(
+        64, std::min<size_t>(4096, 16 * 1024 * 1024 /
+                                       (nValueSize * std::max(1, nXSize)))));
+    return std::min(nStripHeight, nYSize);
+}
+
+/************************************************************************/
+/*                     GDALEnumerateStripPolygons()                     */
+/*                                                                      */
+/*      Assign polygon ids to the nLines x nXSize pixels of a strip,    */
+/*      the same way GDALLabelRasterStrips() did.                       */
+/************************************************************************/
+
+template <class DataType, class EqualityTest>
+bool GDALEnumerateStripPolygons(DataType *paValues, int nXSize, int nLines,
+                                int nConnectedness, GInt32 *panIds)
+{
+    GDALRasterPolygonEnumeratorT<DataType, EqualityTest> oEnum(nConnectedness);
+    for (int iY = 0; iY < nLines; iY++)
+    {
+        const size_t nOffset = static_cast<size_t>(iY) * nXSize;
+        if (!oEnum.ProcessLine(iY == 0 ? nullptr : paValues + nOffset - nXSize,
+                               paValues + nOffset,
+                               iY == 0 ? nullptr : panIds + nOffset - nXSize,
+                               panIds + nOffset, nXSize))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                         GDALStripLabelingJob                         */
+/************************************************************************/
+
+namespace
+{
+template <class DataType, class EqualityTest> struct GDALStripLabelingJob
+{
+    int nConnectedness = 4;
+    int nXSize = 0;
+    int nYSize = 0;
+    bool bCountPixels = false;
+    // nYSize lines of pixel values
+    std::vector<DataType> aValues{};
+    std::unique_ptr<GDALRasterPolygonEnumeratorT<DataType, EqualityTest>>
+        poEnum{};
+    // Number of pixels of each polygon id, if bCountPixels
+    std::vector<int> anPolySize{};
+    // Values and (local) polygon ids of the first and last lines, once
+    // the job is done
+    std::vector<DataType> aFirstLineVal{};
+    std::vector<DataType> aLastLineVal{};
+    std::vector<GInt32> anFirstLineId{};
+    std::vector<GInt32> anLastLineId{};
+    bool bOK = true;
+};
+}  // namespace
+
+/************************************************************************/
+/*                         GDALLabelStripJob()                          */
+/************************************************************************/
+
+template <class DataType, class EqualityTest>
+static void GDALLabelStripJob(void *pData)
+{
+    auto psJob = static_cast<GDALStripLabelingJob<DataType, EqualityTest> *>(
+        pData);
+    const int nXSize = psJob->nXSize;
+    psJob->poEnum = std::make_unique<
+        GDALRasterPolygonEnumeratorT<DataType, EqualityTest>>(
+        psJob->nConnectedness);
+    std::vector<GInt32> anThisLineId(nXSize);
+    std::vector<GInt32> anLastLineId(nXSize);
+    for (int iY = 0; psJob->bOK && iY < psJob->nYSize; iY++)
+    {
+        DataType *panThisLineVal =
+            psJob->aValues.data() + static_cast<size_t>(iY) * nXSize;
+        psJob->bOK = psJob->poEnum->ProcessLine(
+            iY == 0 ? nullptr : panThisLineVal - nXSize, panThisLineVal,
+            iY == 0 ? nullptr : anLastLineId.data(), anThisLineId.data(),
+            nXSize);
+        if (psJob->bOK && psJob->bCountPixels)
+        {
+            psJob->anPolySize.resize(psJob->poEnum->nNextPolygonId);
+            for (int iX = 0; iX < nXSize; iX++)
+            {
+                const GInt32 nId = anThisLineId[iX];
+                if (nId >= 0 &&
+                    psJob->anPolySize[nId] < std::numeric_limits<int>::max())
+                    psJob->anPolySize[nId]++;
+            }
+        }
+        if (iY == 0)
+            psJob->anFirstLineId = anThisLineId;
+        std::swap(anLastLineId, anThisLineId);
+    }
+    if (psJob->bOK)
+    {
+        psJob->poEnum->CompleteMerges();
+        psJob->anLastLineId = std::move(anLastLineId);
+        psJob->aFirstLineVal.assign(psJob->aValues.begin(),
+                                    psJob->aValues.begin() + nXSize);
+        psJob->aLastLineVal.assign(psJob->aValues.end() - nXSize,
+                                   psJob->aValues.end());
+    }
+    psJob->aValues.clear();
+    psJob->aValues.shrink_to_fit();
+}
+
+/************************************************************************/
+/*                       GDALLabelRasterStrips()                        */
+/*                                                                      */
+/*      Each strip of oLabels.nStripHeight lines is enumerated          */
+/*      independently, nThreads strips at a time, and the polygons      */
+/*      crossing strip boundaries are then unioned, which only          */
+/*      requires the first and last lines of each strip.                */
+/************************************************************************/
+
+template <class DataType, class EqualityTest>
+CPLErr GDALLabelRasterStrips(GDALRasterBandH hSrcBand,
+                             GDALRasterBandH hMaskBand, GDALDataType eDT,
+                             int nConnectedness, int nThreads, int nFlags,
+                             GDALRasterStripLabels<DataType> &oLabels,
+                             GDALProgressFunc pfnProgress, void *pProgressArg)
+{
+    const int nXSize = GDALGetRasterBandXSize(hSrcBand);
+    const int nYSize = GDALGetRasterBandYSize(hSrcBand);
+    const int nStripHeight = oLabels.nStripHeight;
+    const int nStrips = (nYSize + nStripHeight - 1) / nStripHeight;
+    nThreads = std::max(1, nThreads);
+
+    if (pfnProgress == nullptr)
+        pfnProgress = GDALDummyProgress;
+
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+
+    auto &anPolyIdMap = oLabels.anPolyIdMap;
+    auto &anStripIdOffset = oLabels.anStripIdOffset;
+    anPolyIdMap.clear();
+    anStripIdOffset.clear();
+    oLabels.aPolyValue.clear();
+    oLabels.anPolySize.clear();
+    oLabels.aanLastLineId.clear();
+
+    const auto Find = [&anPolyIdMap](GInt32 nId)
+    {
+        while (anPolyIdMap[nId] != nId)
+        {
+            anPolyIdMap[nId] = anPolyIdMap[anPolyIdMap[nId]];
+            nId = anPolyIdMap[nId];
+        }
+        return nId;
+    };
+
+    const auto Union = [&anPolyIdMap, &Find](GInt32 nId1, GInt32 nId2)
+    {
+        nId1 = Find(nId1);
+        nId2 = Find(nId2);
+        if (nId1 < nId2)
+            anPolyIdMap[nId2] = nId1;
+        else if (nId2 < nId1)
+            anPolyIdMap[nId1] = nId2;
+    };
+
+    EqualityTest eq;
+    std::vector<DataType> aPrevLastLineVal;
+    std::vector<GInt32> anPrevLastLineId;
+    std::vector<GByte> abyMask;
+
+    for (int iStrip = 0; iStrip < nStrips; iStrip += nThreads)
+    {
+        const int nBatchStrips = std::min(nThreads, nStrips - iStrip);
+        std::vector<GDALStripLabelingJob<DataType, EqualityTest>> aoJobs(
+            nBatchStrips);
+        for (int i = 0; i < nBatchStrips; ++i)
+        {
+            auto &oJob = aoJobs[i];
+            const int nYOff = (iStrip + i) * nStripHeight;
+            oJob.nConnectedness = nConnectedness;
+            oJob.nXSize = nXSize;
+            oJob.nYSize = std::min(nStripHeight, nYSize - nYOff);
+            oJob.bCountPixels = (nFlags & GDAL_LABEL_POLY_SIZES) != 0;
+            const size_t nPixels = static_cast<size_t>(nXSize) * oJob.nYSize;
+            CPLErr eErr = CE_None;
+            try
+            {
+                oJob.aValues.resize(nPixels);
+                if (hMaskBand)
+                    abyMask.resize(nPixels);
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Cannot allocate strip buffer");
+                eErr = CE_Failure;
+            }
+            if (eErr == CE_None)
+                eErr = GDALRasterIO(hSrcBand, GF_Read, 0, nYOff, nXSize,
+                                    oJob.nYSize, oJob.aValues.data(), nXSize,
+                                    oJob.nYSize, eDT, 0, 0);
+            if (eErr == CE_None && hMaskBand != nullptr)
+            {
+                eErr = GDALRasterIO(hMaskBand, GF_Read, 0, nYOff, nXSize,
+                                    oJob.nYSize, abyMask.data(), nXSize,
+                                    oJob.nYSize, GDT_Byte, 0, 0);
+                for (size_t j = 0; eErr == CE_None && j < nPixels; ++j)
+                {
+                    if (abyMask[j] == 0)
+                        oJob.aValues[j] = GP_NODATA_MARKER;
+                }
+            }
+            if (eErr != CE_None)
+            {
+                if (poJobQueue)
+                    poJobQueue->WaitCompletion();
+                return eErr;
+            }
+            if (!poJobQueue ||
+                !poJobQueue->SubmitJob(
+                    GDALLabelStripJob<DataType, EqualityTest>, &oJob))
+            {
+                GDALLabelStripJob<DataType, EqualityTest>(&oJob);
+            }
+        }
+        if (poJobQueue)
+            poJobQueue->WaitCompletion();
+
+        for (auto &oJob : aoJobs)
+        {
+            if (!oJob.bOK)
+                return CE_Failure;
+
+            // Append the polygon map of the strip to the global one
+            const int nLocalCount = oJob.poEnum->nNextPolygonId;
+            const GInt32 nOffset = static_cast<GInt32>(anPolyIdMap.size());
+            if (nLocalCount >= std::numeric_limits<GInt32>::max() - nOffset)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Maximum number of polygons reached");
+                return CE_Failure;
+            }
+            const size_t nNewSize = static_cast<size_t>(nOffset) + nLocalCount;
+            try
+            {
+                anStripIdOffset.push_back(nOffset);
+                anPolyIdMap.resize(nNewSize);
+                if (nFlags & GDAL_LABEL_POLY_VALUES)
+                    oLabels.aPolyValue.insert(
+                        oLabels.aPolyValue.end(), oJob.poEnum->panPolyValue,
+                        oJob.poEnum->panPolyValue + nLocalCount);
+                if (nFlags & GDAL_LABEL_POLY_SIZES)
+                {
+                    oLabels.anPolySize.insert(oLabels.anPolySize.end(),
+                                              oJob.anPolySize.begin(),
+                                              oJob.anPolySize.end());
+                    oLabels.anPolySize.resize(nNewSize);
+                }
+                if (nFlags & GDAL_LABEL_LAST_LINE_IDS)
+                    oLabels.aanLastLineId.push_back(oJob.anLastLineId);
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Cannot allocate polygon map");
+                return CE_Failure;
+            }
+            // The root of a polygon in the enumerator is not necessarily its
+            // smallest id, so use the first id mapped to each root instead.
+            {
+                const GInt32 *panLocalMap = oJob.poEnum->panPolyIdMap;
+                std::vector<GInt32> anLocalRootToMin(nLocalCount, -1);
+                for (int iPoly = 0; iPoly < nLocalCount; ++iPoly)
+                {
+                    GInt32 &nMin = anLocalRootToMin[panLocalMap[iPoly]];
+                    if (nMin < 0)
+                        nMin = iPoly;
+                    anPolyIdMap[nOffset + iPoly] = nOffset + nMin;
+                }
+            }
+            oJob.poEnum.reset();
+            if (nFlags & GDAL_LABEL_LAST_LINE_IDS)
+            {
+                for (auto &nId : oLabels.aanLastLineId.back())
+                {
+                    if (nId >= 0)
+                        nId += nOffset;
+                }
+            }
+
+            // Union polygons crossing the boundary with the previous strip
+            if (!anPrevLastLineId.empty())
+            {
+                const GInt32 nPrevOffset =
+                    anStripIdOffset[anStripIdOffset.size() - 2];
+                for (int iX = 0; iX < nXSize; ++iX)
+                {
+                    const GInt32 nThisId = oJob.anFirstLineId[iX];
+                    if (nThisId < 0)
+                        continue;
+                    const DataType nThisVal = oJob.aFirstLineVal[iX];
+                    for (int iNeighbour = -1; iNeighbour <= 1; ++iNeighbour)
+                    {
+                        const int iXPrev = iX + iNeighbour;
+                        if ((iNeighbour != 0 && nConnectedness == 4) ||
+                            iXPrev < 0 || iXPrev >= nXSize)
+                            continue;
+                        const GInt32 nPrevId = anPrevLastLineId[iXPrev];
+                        if (nPrevId >= 0 &&
+                            eq.operator()(aPrevLastLineVal[iXPrev], nThisVal))
+                        {
+                            Union(nPrevOffset + nPrevId, nOffset + nThisId);
+                        }
+                    }
+                }
+            }
+            aPrevLastLineVal = std::move(oJob.aLastLineVal);
+            anPrevLastLineId = std::move(oJob.anLastLineId);
+        }
+
+        if (!pfnProgress(std::min(iStrip + nThreads, nStrips) /
+                             static_cast<double>(nStrips),
+                         "", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return CE_Failure;
+        }
+    }
+
+    for (size_t i = 0; i < anPolyIdMap.size(); ++i)
+        anPolyIdMap[i] = Find(static_cast<GInt32>(i));
+
+    // Push the sizes of the polygon fragments to their final id
+    if (nFlags & GDAL_LABEL_POLY_SIZES)
+    {
+        auto &anPolySize = oLabels.anPolySize;
+        for (size_t i = 0; i < anPolySize.size(); ++i)
+        {
+            const GInt32 nFinalId = anPolyIdMap[i];
+            if (nFinalId != static_cast<GInt32>(i))
+            {
+                anPolySize[nFinalId] = static_cast<int>(std::min<GIntBig>(
+                    static_cast<GIntBig>(anPolySize[nFinalId]) + anPolySize[i],
+                    std::numeric_limits<int>::max()));
+                anPolySize[i] = 0;
+            }
+        }
+    }
+
+    if (nFlags & GDAL_LABEL_LAST_LINE_IDS)
+    {
+        for (auto &anLastLineId : oLabels.aanLastLineId)
+        {
+            for (auto &nId : anLastLineId)
+            {
+                if (nId >= 0)
+                    nId = anPolyIdMap[nId];
+            }
+        }
+    }
+
+    return CE_None;
+}
+
+template bool GDALEnumerateStripPolygons<std::int64_t, IntEqualityTest>(
+    std::int64_t *, int, int, int, GInt32 *);
+template bool GDALEnumerateStripPolygons<float, FloatEqualityTest>(float *,
+                                                                   int, int,
+                                                                   int,
+                                                                   GInt32 *);
+
+template CPLErr GDALLabelRasterStrips<std::int64_t, IntEqualityTest>(
+    GDALRasterBandH, GDALRasterBandH, GDALDataType, int, int, int,
+    GDALRasterStripLabels<std::int64_t> &, GDALProgressFunc, void *);
+template CPLErr GDALLabelRasterStrips<float, FloatEqualityTest>(
+    GDALRasterBandH, GDALRasterBandH, GDALDataType, int, int, int,
+    GDALRasterStripLabels<float> &, GDALProgressFunc, void *);
+
+/*! @endcond */
+
+/************************************************************************/
+/*                         GDALLabelLinesJob                            */
+/************************************************************************/
+
+namespace
+{
+struct GDALLabelLinesJob
+{
+    int nXSize = 0;
+    int nLines = 0;
+    int nConnectedness = 4;
+    GInt32 nIdOffset = 0;
+    const std::vector<GInt32> *panLabel = nullptr;
+    // Pixel values on input, labels on output
+    std::vector<std::int64_t> anValues{};
+    std::vector<GInt32> anIds{};
+    bool bOK = true;
+};
+}  // namespace
+
+/************************************************************************/
+/*                        GDALLabelLinesProcess()                       */
+/************************************************************************/
+
+static void GDALLabelLinesProcess(void *pData)
+{
+    auto psJob = static_cast<GDALLabelLinesJob *>(pData);
+    psJob->bOK =
+        GDALEnumerateStripPolygons<std::int64_t, IntEqualityTest>(
+            psJob->anValues.data(), psJob->nXSize, psJob->nLines,
+            psJob->nConnectedness, psJob->anIds.data());
+    if (!psJob->bOK)
+        return;
+    const auto &anLabel = *(psJob->panLabel);
+    for (size_t i = 0; i < psJob->anIds.size(); ++i)
+    {
+        const GInt32 nId = psJob->anIds[i];
+        psJob->anValues[i] = nId < 0 ? 0 : anLabel[psJob->nIdOffset + nId];
+    }
+}
+
+/************************************************************************/
+/*                    GDALLabelConnectedComponents()                    */
+/************************************************************************/
+
+/**
+ * Label the connected components of a raster.
+ *
+ * Connected components are determined (per GDALSieveFilter()) as regions of
+ * the raster where the pixels all have the same value, and that are
+ * contiguous. Each of them is written to hDstBand as a distinct label
+ * starting at 1, labels being ordered as the first pixel of the components
+ * in raster scan order. Pixels determined to be "nodata" per hMaskBand are
+ * written as 0.
+ *
+ * The raster is processed as strips of lines that are labeled independently,
+ * possibly in parallel, the labels of the components crossing strip
+ * boundaries being merged afterwards with a union-find structure. Memory use
+ * is proportional to the number of components (roughly 4 bytes per
+ * component fragment in each strip), and to the size of the strips being
+ * processed.
+ *
+ * @param hSrcBand the source raster band to be processed.
+ * @param hMaskBand an optional mask band.  All pixels in the mask band with a
+ * value other than zero will be considered suitable for inclusion in
+ * components.
+ * @param hDstBand the output raster band, typically of type GDT_UInt32 or
+ * GDT_Int32, with the same dimensions as hSrcBand.
+ * @param nConnectedness either 4 indicating that diagonal pixels are not
+ * considered directly adjacent for component membership purposes or 8
+ * indicating they are.
+ * @param papszOptions algorithm options in name=value list form.
+ * <ul>
+ * <li>NUM_THREADS=number|ALL_CPUS: number of worker threads used to label
+ * the strips. Defaults to 1.</li>
+ * </ul>
+ * @param pfnProgress callback for reporting algorithm progress matching the
+ * GDALProgressFunc() semantics.  May be NULL.
+ * @param pProgressArg callback argument passed to pfnProgress.
+ *
+ * @return CE_None on success or CE_Failure if an error occurs.
+ * @since GDAL 3.10
+ */
+
+CPLErr CPL_STDCALL GDALLabelConnectedComponents(
+    GDALRasterBandH hSrcBand, GDALRasterBandH hMaskBand,
+    GDALRasterBandH hDstBand, int nConnectedness, char **papszOptions,
+    GDALProgressFunc pfnProgress, void *pProgressArg)
+{
+    VALIDATE_POINTER1(hSrcBand, "GDALLabelConnectedComponents", CE_Failure);
+    VALIDATE_POINTER1(hDstBand, "GDALLabelConnectedComponents", CE_Failure);
+
+    if (pfnProgress == nullptr)
+        pfnProgress = GDALDummyProgress;
+
+    if (nConnectedness != 4 && nConnectedness != 8)
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg,
+                 "GDALLabelConnectedComponents(): invalid connectedness");
+        return CE_Failure;
+    }
+
+    const int nXSize = GDALGetRasterBandXSize(hSrcBand);
+    const int nYSize = GDALGetRasterBandYSize(hSrcBand);
+    if (GDALGetRasterBandXSize(hDstBand) != nXSize ||
+        GDALGetRasterBandYSize(hDstBand) != nYSize)
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg,
+                 "GDALLabelConnectedComponents(): source and destination "
+                 "bands have different dimensions");
+        return CE_Failure;
+    }
+
+    int nThreads = 1;
+    const char *pszThreads = CSLFetchNameValue(papszOptions, "NUM_THREADS");
+    if (pszThreads)
+    {
+        nThreads = EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                 : atoi(pszThreads);
+        nThreads = std::max(1, std::min(nThreads, 1024));
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      First pass: label the strips and union their components.        */
+    /* -------------------------------------------------------------------- */
+    GDALRasterStripLabels<std::int64_t> oLabels;
+    oLabels.nStripHeight =
+        GDALGetLabelStripHeight(nXSize, nYSize, sizeof(std::int64_t));
+    void *pScaledProgress =
+        GDALCreateScaledProgress(0.0, 0.5, pfnProgress, pProgressArg);
+    CPLErr eErr = GDALLabelRasterStrips<std::int64_t, IntEqualityTest>(
+        hSrcBand, hMaskBand, GDT_Int64, nConnectedness, nThreads, 0, oLabels,
+        GDALScaledProgress, pScaledProgress);
+    GDALDestroyScaledProgress(pScaledProgress);
+    if (eErr != CE_None)
+        return eErr;
+
+    // Final ids are the smallest id of their component, so compacting them
+    // in increasing order gives labels in raster scan order.
+    std::vector<GInt32> &anLabel = oLabels.anPolyIdMap;
+    GInt32 nLabels = 0;
+    for (size_t i = 0; i < anLabel.size(); ++i)
+    {
+        if (anLabel[i] == static_cast<GInt32>(i))
+            anLabel[i] = ++nLabels;
+        else
+            anLabel[i] = anLabel[anLabel[i]];
+    }
+    CPLDebug("GDALLabelConnectedComponents", "%d components", nLabels);
+
+    /* -------------------------------------------------------------------- */
+    /*      Second pass: enumerate the strips again and write the labels.   */
+    /* -------------------------------------------------------------------- */
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+
+    const int nStripHeight = oLabels.nStripHeight;
+    const int nStrips = static_cast<int>(oLabels.anStripIdOffset.size());
+    std::vector<GDALLabelLinesJob> aoJobs(std::min(nThreads, nStrips));
+    std::vector<GByte> abyMask;
+    for (int iStrip = 0; eErr == CE_None && iStrip < nStrips;
+         iStrip += nThreads)
+    {
+        const int nBatchStrips = std::min(nThreads, nStrips - iStrip);
+        for (int i = 0; eErr == CE_None && i < nBatchStrips; ++i)
+        {
+            auto &oJob = aoJobs[i];
+            const int nYOff = (iStrip + i) * nStripHeight;
+            oJob.nXSize = nXSize;
+            oJob.nLines = std::min(nStripHeight, nYSize - nYOff);
+            oJob.nConnectedness = nConnectedness;
+            oJob.nIdOffset = oLabels.anStripIdOffset[iStrip + i];
+            oJob.panLabel = &anLabel;
+            const size_t nPixels = static_cast<size_t>(nXSize) * oJob.nLines;
+            try
+            {
+                oJob.anValues.resize(nPixels);
+                oJob.anIds.resize(nPixels);
+                if (hMaskBand)
+                    abyMask.resize(nPixels);
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Cannot allocate strip buffer");
+                eErr = CE_Failure;
+                break;
+            }
+            eErr = GDALRasterIO(hSrcBand, GF_Read, 0, nYOff, nXSize,
+                                oJob.nLines, oJob.anValues.data(), nXSize,
+                                oJob.nLines, GDT_Int64, 0, 0);
+            if (eErr == CE_None && hMaskBand != nullptr)
+            {
+                eErr = GDALRasterIO(hMaskBand, GF_Read, 0, nYOff, nXSize,
+                                    oJob.nLines, abyMask.data(), nXSize,
+                                    oJob.nLines, GDT_Byte, 0, 0);
+                for (size_t j = 0; eErr == CE_None && j < nPixels; ++j)
+                {
+                    if (abyMask[j] == 0)
+                        oJob.anValues[j] = GP_NODATA_MARKER;
+                }
+            }
+            if (eErr == CE_None &&
+                (!poJobQueue ||
+                 !poJobQueue->SubmitJob(GDALLabelLinesProcess, &oJob)))
+            {
+                GDALLabelLinesProcess(&oJob);
+            }
+        }
+        if (poJobQueue)
+            poJobQueue->WaitCompletion();
+
+        for (int i = 0; eErr == CE_None && i < nBatchStrips; ++i)
+        {
+            auto &oJob = aoJobs[i];
+            if (!oJob.bOK)
+            {
+                eErr = CE_Failure;
+                break;
+            }
+            eErr = GDALRasterIO(hDstBand, GF_Write, 0,
+                                (iStrip + i) * nStripHeight, nXSize,
+                                oJob.nLines, oJob.anValues.data(), nXSize,
+                                oJob.nLines, GDT_Int64, 0, 0);
+        }
+
+        if (eErr == CE_None &&
+            !pfnProgress(0.5 + 0.5 * (std::min(iStrip + nThreads, nStrips) /
+                                      static_cast<double>(nStrips)),
+                         "", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+    }
+
+    return eErr;
+}
@@ -35,15 +35,19 @@
 #include <algorithm>
 #include <cassert>
 #include <set>
+#include <unordered_map>
 #include <vector>
 #include <utility>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_progress.h"
+#include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_alg_priv.h"
+#include "gdal_thread_pool.h"
 
 #define MY_MAX_INT 2147483647
 
@@ -74,14 +78,17 @@
 /************************************************************************/
 
 static CPLErr GPMaskImageData(GDALRasterBandH hMaskBand, GByte *pabyMaskLine,
-                              int iY, int nXSize, std::int64_t *panImageLine)
+                              int iY, int nXSize, std::int64_t *panImageLine,
+                              int nLines = 1)
 
 {
-    const CPLErr eErr = GDALRasterIO(hMaskBand, GF_Read, 0, iY, nXSize, 1,
-                                     pabyMaskLine, nXSize, 1, GDT_Byte, 0, 0);
+    const CPLErr eErr =
+        GDALRasterIO(hMaskBand, GF_Read, 0, iY, nXSize, nLines, pabyMaskLine,
+                     nXSize, nLines, GDT_Byte, 0, 0);
     if (eErr == CE_None)
     {
-        for (int i = 0; i < nXSize; i++)
+        const size_t nPixels = static_cast<size_t>(nXSize) * nLines;
+        for (size_t i = 0; i < nPixels; i++)
         {
             if (pabyMaskLine[i] == 0)
                 panImageLine[i] = GP_NODATA_MARKER;
@@ -142,6 +149,448 @@ static inline void CompareNeighbour(int nPolyId1, int nPolyId2,
         anBigNeighbour[nPolyId2] = nPolyId1;
 }
 
+/************************************************************************/
+/*                       GPResolveBigNeighbours()                       */
+/*                                                                      */
+/*      Map each polygon smaller than the threshold to the first        */
+/*      polygon at least as large as the threshold found by walking     */
+/*      through the chain of biggest neighbours, or to -1 if there is   */
+/*      none.                                                           */
+/************************************************************************/
+
+static void GPResolveBigNeighbours(const GInt32 *panPolyIdMap,
+                                   const std::int64_t *panPolyValue,
+                                   const std::vector<int> &anPolySizes,
+                                   int nSizeThreshold,
+                                   std::vector<int> &anBigNeighbour)
+{
+    int nFailedMerges = 0;
+    int nIsolatedSmall = 0;
+    int nSieveTargets = 0;
+
+    for (int iPoly = 0; iPoly < static_cast<int>(anPolySizes.size()); iPoly++)
+    {
+        if (panPolyIdMap[iPoly] != iPoly)
+            continue;
+
+        // Ignore nodata polygons.
+        if (panPolyValue[iPoly] == GP_NODATA_MARKER)
+            continue;
+
+        // Don't try to merge polygons larger than the threshold.
+        if (anPolySizes[iPoly] >= nSizeThreshold)
+        {
+            anBigNeighbour[iPoly] = -1;
+            continue;
+        }
+
+        nSieveTargets++;
+
+        // if we have no neighbours but we are small, what shall we do?
+        if (anBigNeighbour[iPoly] == -1)
+        {
+            nIsolatedSmall++;
+            continue;
+        }
+
+        std::set<int> oSetVisitedPoly;
+        oSetVisitedPoly.insert(iPoly);
+
+        // Walk through our neighbours until we find a polygon large enough.
+        int iFinalId = iPoly;
+        bool bFoundBigEnoughPoly = false;
+        while (true)
+        {
+            iFinalId = anBigNeighbour[iFinalId];
+            if (iFinalId < 0)
+            {
+                break;
+            }
+            // If the biggest neighbour is larger than the threshold
+            // then we are golden.
+            if (anPolySizes[iFinalId] >= nSizeThreshold)
+            {
+                bFoundBigEnoughPoly = true;
+                break;
+            }
+            // Check that we don't cycle on an already visited polygon.
+            if (oSetVisitedPoly.find(iFinalId) != oSetVisitedPoly.end())
+                break;
+            oSetVisitedPoly.insert(iFinalId);
+        }
+
+        if (!bFoundBigEnoughPoly)
+        {
+            nFailedMerges++;
+            anBigNeighbour[iPoly] = -1;
+            continue;
+        }
+
+        // Map the whole intermediate chain to it.
+        int iPolyCur = iPoly;
+        while (anBigNeighbour[iPolyCur] != iFinalId)
+        {
+            int iNextPoly = anBigNeighbour[iPolyCur];
+            anBigNeighbour[iPolyCur] = iFinalId;
+            iPolyCur = iNextPoly;
+        }
+    }
+
+    CPLDebug("GDALSieveFilter",
+             "Small Polygons: %d, Isolated: %d, Unmergable: %d", nSieveTargets,
+             nIsolatedSmall, nFailedMerges);
+}
+
+/************************************************************************/
+/*                           GPSieveStripJob                            */
+/************************************************************************/
+
+namespace
+{
+struct GPSieveStripJob
+{
+    int nXSize = 0;
+    int nLines = 0;
+    int nConnectedness = 4;
+    GInt32 nIdOffset = 0;
+    const std::vector<GInt32> *panPolyIdMap = nullptr;
+    const std::vector<int> *panPolySizes = nullptr;
+    // Final polygon ids of the line above the strip, or nullptr
+    const std::vector<GInt32> *panPrevLastLineId = nullptr;
+    // Masked pixel values of the strip
+    std::vector<std::int64_t> anValues{};
+    // Final polygon ids of the pixels of the strip
+    std::vector<GInt32> anIds{};
+    // Biggest neighbour, among the ones found in the strip, of the
+    // polygons of the strip.
+    std::unordered_map<GInt32, GInt32> oMapBigNeighbour{};
+    bool bOK = true;
+};
+
+struct GPSieveApplyStripJob : public GPSieveStripJob
+{
+    const std::vector<int> *panBigNeighbour = nullptr;
+    const std::vector<std::int64_t> *panPolyValue = nullptr;
+    // Unmasked pixel values of the strip, sieved on output
+    std::vector<std::int64_t> anWriteValues{};
+};
+}  // namespace
+
+/************************************************************************/
+/*                          GPSieveStripIds()                           */
+/*                                                                      */
+/*      Enumerate the polygons of a strip again, and translate their    */
+/*      ids into final ids.                                             */
+/************************************************************************/
+
+static bool GPSieveStripIds(GPSieveStripJob *psJob)
+{
+    psJob->anIds.resize(psJob->anValues.size());
+    if (!GDALEnumerateStripPolygons<std::int64_t, IntEqualityTest>(
+            psJob->anValues.data(), psJob->nXSize, psJob->nLines,
+            psJob->nConnectedness, psJob->anIds.data()))
+    {
+        return false;
+    }
+    const auto &anPolyIdMap = *(psJob->panPolyIdMap);
+    for (auto &nId : psJob->anIds)
+    {
+        if (nId >= 0)
+            nId = anPolyIdMap[psJob->nIdOffset + nId];
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                        GPSieveNeighboursJob()                        */
+/*                                                                      */
+/*      Equivalent of the second pass of GDALSieveFilter() on a strip.  */
+/*      Pixels are compared in the same order, so that merging the      */
+/*      results of the strips in order gives the same biggest           */
+/*      neighbours.                                                     */
+/************************************************************************/
+
+static void GPSieveNeighboursJob(void *pData)
+{
+    auto psJob = static_cast<GPSieveStripJob *>(pData);
+    psJob->bOK = GPSieveStripIds(psJob);
+    psJob->anValues.clear();
+    psJob->anValues.shrink_to_fit();
+    if (!psJob->bOK)
+        return;
+
+    const auto &anPolySizes = *(psJob->panPolySizes);
+    auto &oMap = psJob->oMapBigNeighbour;
+    const auto Update = [&anPolySizes, &oMap](GInt32 nPolyId, GInt32 nOther)
+    {
+        auto oIter = oMap.find(nPolyId);
+        if (oIter == oMap.end())
+            oMap[nPolyId] = nOther;
+        else if (anPolySizes[oIter->second] < anPolySizes[nOther])
+            oIter->second = nOther;
+    };
+    const auto Compare = [&Update](GInt32 nPolyId1, GInt32 nPolyId2)
+    {
+        if (nPolyId1 < 0 || nPolyId2 < 0 || nPolyId1 == nPolyId2)
+            return;
+        Update(nPolyId1, nPolyId2);
+        Update(nPolyId2, nPolyId1);
+    };
+
+    const int nXSize = psJob->nXSize;
+    const bool b8Connected = psJob->nConnectedness == 8;
+    for (int iY = 0; iY < psJob->nLines; iY++)
+    {
+        const GInt32 *panThisLineId =
+            psJob->anIds.data() + static_cast<size_t>(iY) * nXSize;
+        const GInt32 *panLastLineId =
+            iY > 0 ? panThisLineId - nXSize
+            : psJob->panPrevLastLineId ? psJob->panPrevLastLineId->data()
+                                       : nullptr;
+        for (int iX = 0; iX < nXSize; iX++)
+        {
+            if (panLastLineId)
+            {
+                Compare(panThisLineId[iX], panLastLineId[iX]);
+                if (iX > 0 && b8Connected)
+                    Compare(panThisLineId[iX], panLastLineId[iX - 1]);
+                if (iX < nXSize - 1 && b8Connected)
+                    Compare(panThisLineId[iX], panLastLineId[iX + 1]);
+            }
+            if (iX > 0)
+                Compare(panThisLineId[iX], panThisLineId[iX - 1]);
+        }
+    }
+    psJob->anIds.clear();
+    psJob->anIds.shrink_to_fit();
+}
+
+/************************************************************************/
+/*                          GPSieveApplyJob()                           */
+/*                                                                      */
+/*      Equivalent of the third pass of GDALSieveFilter() on a strip.   */
+/************************************************************************/
+
+static void GPSieveApplyJob(void *pData)
+{
+    auto psJob = static_cast<GPSieveApplyStripJob *>(pData);
+    psJob->bOK = GPSieveStripIds(psJob);
+    if (!psJob->bOK)
+        return;
+    const auto &anBigNeighbour = *(psJob->panBigNeighbour);
+    const auto &anPolyValue = *(psJob->panPolyValue);
+    for (size_t i = 0; i < psJob->anIds.size(); ++i)
+    {
+        const GInt32 nId = psJob->anIds[i];
+        if (nId >= 0 && anBigNeighbour[nId] != -1)
+            psJob->anWriteValues[i] = anPolyValue[anBigNeighbour[nId]];
+    }
+}
+
+/************************************************************************/
+/*                         GDALSieveFilterMT()                          */
+/*                                                                      */
+/*      Multi-threaded equivalent of GDALSieveFilter(). The raster is   */
+/*      processed as strips, whose polygons are labeled in parallel     */
+/*      and unioned at the strip boundaries. The next passes            */
+/*      enumerate each strip again to recover the final polygon ids.    */
+/*      The strip height does not depend on the number of threads, and */
+/*      the result is the same as the one of the single-threaded        */
+/*      algorithm.                                                      */
+/************************************************************************/
+
+static CPLErr GDALSieveFilterMT(GDALRasterBandH hSrcBand,
+                                GDALRasterBandH hMaskBand,
+                                GDALRasterBandH hDstBand, int nSizeThreshold,
+                                int nConnectedness, int nThreads,
+                                GDALProgressFunc pfnProgress,
+                                void *pProgressArg)
+{
+    const int nXSize = GDALGetRasterBandXSize(hSrcBand);
+    const int nYSize = GDALGetRasterBandYSize(hSrcBand);
+
+    /* -------------------------------------------------------------------- */
+    /*      First pass: polygon ids, values and sizes.                      */
+    /* -------------------------------------------------------------------- */
+    GDALRasterStripLabels<std::int64_t> oLabels;
+    oLabels.nStripHeight =
+        GDALGetLabelStripHeight(nXSize, nYSize, sizeof(std::int64_t));
+    void *pScaledProgress =
+        GDALCreateScaledProgress(0.0, 0.25, pfnProgress, pProgressArg);
+    CPLErr eErr = GDALLabelRasterStrips<std::int64_t, IntEqualityTest>(
+        hSrcBand, hMaskBand, GDT_Int64, nConnectedness, nThreads,
+        GDAL_LABEL_POLY_VALUES | GDAL_LABEL_POLY_SIZES |
+            GDAL_LABEL_LAST_LINE_IDS,
+        oLabels, GDALScaledProgress, pScaledProgress);
+    GDALDestroyScaledProgress(pScaledProgress);
+    if (eErr != CE_None)
+        return eErr;
+
+    const int nStripHeight = oLabels.nStripHeight;
+    const int nStrips = static_cast<int>(oLabels.anStripIdOffset.size());
+    const std::vector<int> &anPolySizes = oLabels.anPolySize;
+
+    std::vector<int> anBigNeighbour;
+    std::vector<GByte> abyMask;
+    try
+    {
+        anBigNeighbour.resize(anPolySizes.size(), -1);
+        if (hMaskBand)
+            abyMask.resize(static_cast<size_t>(nXSize) * nStripHeight);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "Cannot allocate buffers");
+        return CE_Failure;
+    }
+
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+
+    const auto ReadStrip = [&](int iStrip, GPSieveStripJob &oJob,
+                               std::vector<std::int64_t> *panUnmasked)
+    {
+        const int nYOff = iStrip * nStripHeight;
+        oJob.nXSize = nXSize;
+        oJob.nLines = std::min(nStripHeight, nYSize - nYOff);
+        oJob.nConnectedness = nConnectedness;
+        oJob.nIdOffset = oLabels.anStripIdOffset[iStrip];
+        oJob.panPolyIdMap = &oLabels.anPolyIdMap;
+        oJob.panPolySizes = &anPolySizes;
+        oJob.panPrevLastLineId =
+            iStrip > 0 ? &oLabels.aanLastLineId[iStrip - 1] : nullptr;
+        const size_t nPixels = static_cast<size_t>(nXSize) * oJob.nLines;
+        CPLErr eErrRead = CE_None;
+        try
+        {
+            oJob.anValues.resize(nPixels);
+            eErrRead = GDALRasterIO(hSrcBand, GF_Read, 0, nYOff, nXSize,
+                                    oJob.nLines, oJob.anValues.data(), nXSize,
+                                    oJob.nLines, GDT_Int64, 0, 0);
+            if (eErrRead == CE_None && panUnmasked)
+                *panUnmasked = oJob.anValues;
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate strip buffer");
+            return CE_Failure;
+        }
+        if (eErrRead == CE_None && hMaskBand != nullptr)
+            eErrRead = GPMaskImageData(hMaskBand, abyMask.data(), nYOff,
+                                       nXSize, oJob.anValues.data(),
+                                       oJob.nLines);
+        return eErrRead;
+    };
+
+    /* -------------------------------------------------------------------- */
+    /*      Second pass: identify the largest neighbour of each polygon.    */
+    /* -------------------------------------------------------------------- */
+    for (int iStrip = 0; eErr == CE_None && iStrip < nStrips;
+         iStrip += nThreads)
+    {
+        const int nBatchStrips = std::min(nThreads, nStrips - iStrip);
+        std::vector<GPSieveStripJob> aoJobs(nBatchStrips);
+        for (int i = 0; eErr == CE_None && i < nBatchStrips; ++i)
+        {
+            eErr = ReadStrip(iStrip + i, aoJobs[i], nullptr);
+            if (eErr == CE_None &&
+                (!poJobQueue ||
+                 !poJobQueue->SubmitJob(GPSieveNeighboursJob, &aoJobs[i])))
+            {
+                GPSieveNeighboursJob(&aoJobs[i]);
+            }
+        }
+        if (poJobQueue)
+            poJobQueue->WaitCompletion();
+        if (eErr != CE_None)
+            break;
+
+        for (const auto &oJob : aoJobs)
+        {
+            if (!oJob.bOK)
+            {
+                eErr = CE_Failure;
+                break;
+            }
+            for (const auto &oIter : oJob.oMapBigNeighbour)
+            {
+                int &nBigNeighbour = anBigNeighbour[oIter.first];
+                if (nBigNeighbour == -1 ||
+                    anPolySizes[nBigNeighbour] < anPolySizes[oIter.second])
+                    nBigNeighbour = oIter.second;
+            }
+        }
+
+        if (eErr == CE_None &&
+            !pfnProgress(0.25 + 0.25 * (std::min(iStrip + nThreads, nStrips) /
+                                        static_cast<double>(nStrips)),
+                         "", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+    }
+    if (eErr != CE_None)
+        return eErr;
+
+    // The last line ids are no longer needed
+    oLabels.aanLastLineId.clear();
+
+    GPResolveBigNeighbours(oLabels.anPolyIdMap.data(),
+                           oLabels.aPolyValue.data(), anPolySizes,
+                           nSizeThreshold, anBigNeighbour);
+
+    /* -------------------------------------------------------------------- */
+    /*      Third pass: apply the merges.                                   */
+    /* -------------------------------------------------------------------- */
+    for (int iStrip = 0; eErr == CE_None && iStrip < nStrips;
+         iStrip += nThreads)
+    {
+        const int nBatchStrips = std::min(nThreads, nStrips - iStrip);
+        std::vector<GPSieveApplyStripJob> aoJobs(nBatchStrips);
+        for (int i = 0; eErr == CE_None && i < nBatchStrips; ++i)
+        {
+            auto &oJob = aoJobs[i];
+            oJob.panBigNeighbour = &anBigNeighbour;
+            oJob.panPolyValue = &oLabels.aPolyValue;
+            eErr = ReadStrip(iStrip + i, oJob, &oJob.anWriteValues);
+            if (eErr == CE_None &&
+                (!poJobQueue || !poJobQueue->SubmitJob(GPSieveApplyJob, &oJob)))
+            {
+                GPSieveApplyJob(&oJob);
+            }
+        }
+        if (poJobQueue)
+            poJobQueue->WaitCompletion();
+
+        for (int i = 0; eErr == CE_None && i < nBatchStrips; ++i)
+        {
+            auto &oJob = aoJobs[i];
+            if (!oJob.bOK)
+            {
+                eErr = CE_Failure;
+                break;
+            }
+            eErr = GDALRasterIO(hDstBand, GF_Write, 0,
+                                (iStrip + i) * nStripHeight, nXSize,
+                                oJob.nLines, oJob.anWriteValues.data(),
+                                nXSize, oJob.nLines, GDT_Int64, 0, 0);
+        }
+
+        if (eErr == CE_None &&
+            !pfnProgress(0.5 + 0.5 * (std::min(iStrip + nThreads, nStrips) /
+                                      static_cast<double>(nStrips)),
+                         "", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+    }
+
+    return eErr;
+}
+
 /************************************************************************/
 /*                          GDALSieveFilter()                           */
 /************************************************************************/
@@ -173,6 +622,13 @@ static inline void CompareNeighbour(int nPolyId1, int nPolyId2,
  * extremely noisy rasters with many one pixel polygons will end up being
  * expensive (in memory) to process.
  *
+ * When NUM_THREADS is greater than 1, the raster is processed as strips of
+ * lines in which polygons are labeled in parallel, the polygons crossing strip
+ * boundaries being merged afterwards (see GDALLabelConnectedComponents()).
+ * The result is the same as the single-threaded one.  Memory use is then
+ * proportional to the number of polygon fragments in each strip, and to the
+ * size of the strips being processed.
+ *
  * @param hSrcBand the source raster band to be processed.
  * @param hMaskBand an optional mask band.  All pixels in the mask band with a
  * value other than zero will be considered suitable for inclusion in polygons.
@@ -183,8 +639,11 @@ static inline void CompareNeighbour(int nPolyId1, int nPolyId2,
  * @param nConnectedness either 4 indicating that diagonal pixels are not
  * considered directly adjacent for polygon membership purposes or 8
  * indicating they are.
- * @param papszOptions algorithm options in name=value list form.  None
- * currently supported.
+ * @param papszOptions algorithm options in name=value list form.
+ * <ul>
+ * <li>NUM_THREADS=number|ALL_CPUS: (GDAL >= 3.10) number of worker threads.
+ * Defaults to 1.</li>
+ * </ul>
  * @param pfnProgress callback for reporting algorithm progress matching the
  * GDALProgressFunc() semantics.  May be NULL.
  * @param pProgressArg callback argument passed to pfnProgress.
@@ -195,8 +654,7 @@ static inline void CompareNeighbour(int nPolyId1, int nPolyId2,
 CPLErr CPL_STDCALL GDALSieveFilter(GDALRasterBandH hSrcBand,
                                    GDALRasterBandH hMaskBand,
                                    GDALRasterBandH hDstBand, int nSizeThreshold,
-                                   int nConnectedness,
-                                   CPL_UNUSED char **papszOptions,
+                                   int nConnectedness, char **papszOptions,
                                    GDALProgressFunc pfnProgress,
                                    void *pProgressArg)
 {
@@ -206,6 +664,18 @@ CPLErr CPL_STDCALL GDALSieveFilter(GDALRasterBandH hSrcBand,
     if (pfnProgress == nullptr)
         pfnProgress = GDALDummyProgress;
 
+    const char *pszNumThreads = CSLFetchNameValue(papszOptions, "NUM_THREADS");
+    if (pszNumThreads)
+    {
+        int nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                        : atoi(pszNumThreads);
+        nThreads = std::max(1, std::min(nThreads, 1024));
+        if (nThreads > 1)
+            return GDALSieveFilterMT(hSrcBand, hMaskBand, hDstBand,
+                                     nSizeThreshold, nConnectedness, nThreads,
+                                     pfnProgress, pProgressArg);
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Allocate working buffers.                                       */
     /* -------------------------------------------------------------------- */
@@ -457,81 +927,8 @@ CPLErr CPL_STDCALL GDALSieveFilter(GDALRasterBandH hSrcBand,
     /*      threshold, then try tracking to that polygons biggest           */
     /*      neighbour, and so forth.                                        */
     /* -------------------------------------------------------------------- */
-    int nFailedMerges = 0;
-    int nIsolatedSmall = 0;
-    int nSieveTargets = 0;
-
-    for (int iPoly = 0; iPoly < static_cast<int>(anPolySizes.size()); iPoly++)
-    {
-        if (oFirstEnum.panPolyIdMap[iPoly] != iPoly)
-            continue;
-
-        // Ignore nodata polygons.
-        if (oFirstEnum.panPolyValue[iPoly] == GP_NODATA_MARKER)
-            continue;
-
-        // Don't try to merge polygons larger than the threshold.
-        if (anPolySizes[iPoly] >= nSizeThreshold)
-        {
-            anBigNeighbour[iPoly] = -1;
-            continue;
-        }
-
-        nSieveTargets++;
-
-        // if we have no neighbours but we are small, what shall we do?
-        if (anBigNeighbour[iPoly] == -1)
-        {
-            nIsolatedSmall++;
-            continue;
-        }
-
-        std::set<int> oSetVisitedPoly;
-        oSetVisitedPoly.insert(iPoly);
-
-        // Walk through our neighbours until we find a polygon large enough.
-        int iFinalId = iPoly;
-        bool bFoundBigEnoughPoly = false;
-        while (true)
-        {
-            iFinalId = anBigNeighbour[iFinalId];
-            if (iFinalId < 0)
-            {
-                break;
-            }
-            // If the biggest neighbour is larger than the threshold
-            // then we are golden.
-            if (anPolySizes[iFinalId] >= nSizeThreshold)
-            {
-                bFoundBigEnoughPoly = true;
-                break;
-            }
-            // Check that we don't cycle on an already visited polygon.
-            if (oSetVisitedPoly.find(iFinalId) != oSetVisitedPoly.end())
-                break;
-            oSetVisitedPoly.insert(iFinalId);
-        }
-
-        if (!bFoundBigEnoughPoly)
-        {
-            nFailedMerges++;
-            anBigNeighbour[iPoly] = -1;
-            continue;
-        }
-
-        // Map the whole intermediate chain to it.
-        int iPolyCur = iPoly;
-        while (anBigNeighbour[iPolyCur] != iFinalId)
-        {
-            int iNextPoly = anBigNeighbour[iPolyCur];
-            anBigNeighbour[iPolyCur] = iFinalId;
-            iPolyCur = iNextPoly;
-        }
-    }
-
-    CPLDebug("GDALSieveFilter",
-             "Small Polygons: %d, Isolated: %d, Unmergable: %d", nSieveTargets,
-             nIsolatedSmall, nFailedMerges);
+    GPResolveBigNeighbours(oFirstEnum.panPolyIdMap, oFirstEnum.panPolyValue,
+                           anPolySizes, nSizeThreshold, anBigNeighbour);
 
     /* ==================================================================== */
     /*      Make a third pass over the image, actually applying the         */
@@ -42,7 +42,11 @@
 
 #include <algorithm>
 #include <limits>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -747,6 +751,46 @@ retry:
     double dfMaxYOut = 0.0;
     bool bGotInitialPoint = false;
 
+    const auto UpdateBounds = [&](double x, double y)
+    {
+        if (bGotInitialPoint)
+        {
+            dfMinXOut = std::min(dfMinXOut, x);
+            dfMinYOut = std::min(dfMinYOut, y);
+            dfMaxXOut = std::max(dfMaxXOut, x);
+            dfMaxYOut = std::max(dfMaxYOut, y);
+        }
+        else
+        {
+            bGotInitialPoint = true;
+            dfMinXOut = x;
+            dfMaxXOut = x;
+            dfMinYOut = y;
+            dfMaxYOut = y;
+        }
+    };
+
+    // State of the dichotomic search between two consecutive sample points
+    // of a line.
+    struct Dichotomy
+    {
+        double x_in_before = 0;
+        double x_in_after = 0;
+        double x_out_before = 0;
+        double x_out_after = 0;
+        double y_in = 0;
+        bool invalid_before = false;
+        bool invalid_after = false;
+
+        bool MustContinue() const
+        {
+            return invalid_before || invalid_after ||
+                   x_out_before * x_out_after < 0.0;
+        }
+    };
+
+    std::vector<Dichotomy> asDichotomies;
+
     nFailedCount = 0;
     for (int i = 0; i < nSamplePoints; i++)
     {
@@ -769,99 +813,104 @@ retry:
 
         if (x_i > 0 && (pabSuccess[i - 1] || pabSuccess[i]))
         {
-            double x_out_before = padfX[i - 1];
-            double x_out_after = padfX[i];
-            int nIter = 0;
-            double x_in_before =
+            Dichotomy sDichotomy;
+            sDichotomy.x_out_before = padfX[i - 1];
+            sDichotomy.x_out_after = padfX[i];
+            sDichotomy.x_in_before =
                 static_cast<double>(x_i - 1) * nInXSize / nSteps;
-            double x_in_after = static_cast<double>(x_i) * nInXSize / nSteps;
-            int invalid_before = !(pabSuccess[i - 1]);
-            int invalid_after = !(pabSuccess[i]);
-
-            // Detect discontinuity in target coordinates when the target x
-            // coordinates change sign. This may be a false positive when the
-            // target tx is around 0 Dichotomic search to reduce the interval
-            // to near the discontinuity and get a better out extent.
-            while ((invalid_before || invalid_after ||
-                    x_out_before * x_out_after < 0.0) &&
-                   nIter < 16)
+            sDichotomy.x_in_after =
+                static_cast<double>(x_i) * nInXSize / nSteps;
+            sDichotomy.y_in = static_cast<double>(y_i) * nInYSize / nSteps;
+            sDichotomy.invalid_before = !(pabSuccess[i - 1]);
+            sDichotomy.invalid_after = !(pabSuccess[i]);
+            if (sDichotomy.MustContinue())
+                asDichotomies.push_back(sDichotomy);
+        }
+
+        if (!pabSuccess[i])
+        {
+            nFailedCount++;
+            continue;
+        }
+
+        UpdateBounds(padfX[i], padfY[i]);
+    }
+
+    // Detect discontinuity in target coordinates when the target x
+    // coordinates change sign. This may be a false positive when the
+    // target tx is around 0 Dichotomic search to reduce the interval
+    // to near the discontinuity and get a better out extent.
+    // All searches progress in lockstep, so that each iteration transforms
+    // a single batch of points, instead of one point at a time.
+    if (!asDichotomies.empty())
+    {
+        std::vector<double> adfDichoX, adfDichoY, adfDichoZ;
+        std::vector<int> abDichoSuccess;
+        for (int nIter = 0; nIter < 16 && !asDichotomies.empty(); nIter++)
+        {
+            const size_t nCount = asDichotomies.size();
+            adfDichoX.resize(nCount);
+            adfDichoY.resize(nCount);
+            adfDichoZ.assign(nCount, 0.0);
+            abDichoSuccess.assign(nCount, TRUE);
+            for (size_t k = 0; k < nCount; ++k)
             {
-                double x = (x_in_before + x_in_after) / 2.0;
-                double y = static_cast<double>(y_i) * nInYSize / nSteps;
-                double z = 0.0;
-                int bSuccess = TRUE;
-                if (pfnTransformer(pTransformArg, FALSE, 1, &x, &y, &z,
-                                   &bSuccess) &&
-                    bSuccess)
+                const auto &sDichotomy = asDichotomies[k];
+                adfDichoX[k] =
+                    (sDichotomy.x_in_before + sDichotomy.x_in_after) / 2.0;
+                adfDichoY[k] = sDichotomy.y_in;
+            }
+            if (!pfnTransformer(pTransformArg, FALSE, static_cast<int>(nCount),
+                                adfDichoX.data(), adfDichoY.data(),
+                                adfDichoZ.data(), abDichoSuccess.data()))
+            {
+                abDichoSuccess.assign(nCount, FALSE);
+            }
+
+            size_t nKept = 0;
+            for (size_t k = 0; k < nCount; ++k)
+            {
+                auto sDichotomy = asDichotomies[k];
+                const double x_in_middle =
+                    (sDichotomy.x_in_before + sDichotomy.x_in_after) / 2.0;
+                if (abDichoSuccess[k])
                 {
-                    if (bGotInitialPoint)
-                    {
-                        dfMinXOut = std::min(dfMinXOut, x);
-                        dfMinYOut = std::min(dfMinYOut, y);
-                        dfMaxXOut = std::max(dfMaxXOut, x);
-                        dfMaxYOut = std::max(dfMaxYOut, y);
-                    }
-                    else
-                    {
-                        bGotInitialPoint = true;
-                        dfMinXOut = x;
-                        dfMaxXOut = x;
-                        dfMinYOut = y;
-                        dfMaxYOut = y;
-                    }
+                    const double x = adfDichoX[k];
+                    UpdateBounds(x, adfDichoY[k]);
 
-                    if (invalid_before || x_out_before * x < 0)
+                    if (sDichotomy.invalid_before ||
+                        sDichotomy.x_out_before * x < 0)
                     {
-                        invalid_after = FALSE;
-                        x_in_after = (x_in_before + x_in_after) / 2.0;
-                        x_out_after = x;
+                        sDichotomy.invalid_after = false;
+                        sDichotomy.x_in_after = x_in_middle;
+                        sDichotomy.x_out_after = x;
                     }
                     else
                     {
-                        invalid_before = FALSE;
-                        x_out_before = x;
-                        x_in_before = (x_in_before + x_in_after) / 2.0;
+                        sDichotomy.invalid_before = false;
+                        sDichotomy.x_out_before = x;
+                        sDichotomy.x_in_before = x_in_middle;
                     }
                 }
                 else
                 {
-                    if (invalid_before)
+                    if (sDichotomy.invalid_before)
                     {
-                        x_in_before = (x_in_before + x_in_after) / 2.0;
+                        sDichotomy.x_in_before = x_in_middle;
                     }
-                    else if (invalid_after)
+                    else if (sDichotomy.invalid_after)
                     {
-                        x_in_after = (x_in_before + x_in_after) / 2.0;
+                        sDichotomy.x_in_after = x_in_middle;
                     }
                     else
                     {
-                        break;
+                        continue;
                     }
                 }
-                nIter++;
+                if (sDichotomy.MustContinue())
+                    asDichotomies[nKept++] = sDichotomy;
             }
-        }
-
-        if (!pabSuccess[i])
-        {
-            nFailedCount++;
-            continue;
-        }
-
-        if (bGotInitialPoint)
-        {
-            dfMinXOut = std::min(dfMinXOut, padfX[i]);
-            dfMinYOut = std::min(dfMinYOut, padfY[i]);
-            dfMaxXOut = std::max(dfMaxXOut, padfX[i]);
-            dfMaxYOut = std::max(dfMaxYOut, padfY[i]);
-        }
-        else
-        {
-            bGotInitialPoint = true;
-            dfMinXOut = padfX[i];
-            dfMaxXOut = padfX[i];
-            dfMinYOut = padfY[i];
-            dfMaxYOut = padfY[i];
+            asDichotomies.resize(nKept);
         }
     }
 
@@ -3697,17 +3746,105 @@ static void *GDALDeserializeReprojectionTransformer(CPLXMLNode *psTree)
 /* ==================================================================== */
 /************************************************************************/
 
-typedef struct
+namespace
 {
-    GDALTransformerInfo sTI;
 
-    GDALTransformerFunc pfnBaseTransformer;
-    void *pBaseCBData;
-    double dfMaxErrorForward;
-    double dfMaxErrorReverse;
+/************************************************************************/
+/*                        GDALApproxTransformGrid                       */
+/*                                                                      */
+/*      Cache of exactly transformed grid cells, shared between the     */
+/*      clones of an approximate transformer (and thus between warp     */
+/*      chunks and threads). Cells are computed lazily, the first time  */
+/*      a point falls into them.                                        */
+/************************************************************************/
 
-    int bOwnSubtransformer;
-} ApproxTransformInfo;
+struct GDALApproxTransformGridCell
+{
+    // Transformed corners, in (x0,y0), (x1,y0), (x0,y1), (x1,y1) order.
+    double adfX[4] = {0, 0, 0, 0};
+    double adfY[4] = {0, 0, 0, 0};
+    double adfZ[4] = {0, 0, 0, 0};
+
+    // Whether bilinear interpolation within the cell is within the error
+    // threshold. If not, points are transformed with the base transformer.
+    bool bUsable = false;
+};
+
+class GDALApproxTransformGrid
+{
+    const int m_nStep;
+    std::mutex m_oMutex{};
+    // Indexed by bDstToSrc.
+    std::unordered_map<uint64_t, GDALApproxTransformGridCell> m_aoCells[2]{};
+
+    // Limit on the number of cached cells per direction, to bound memory
+    // usage on huge outputs.
+    static constexpr size_t MAX_CELLS = 1000 * 1000;
+
+    static uint64_t GetKey(int iCellX, int iCellY)
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(iCellY)) << 32) |
+               static_cast<uint32_t>(iCellX);
+    }
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALApproxTransformGrid)
+
+  public:
+    explicit GDALApproxTransformGrid(int nStep) : m_nStep(nStep)
+    {
+    }
+
+    int GetStep() const
+    {
+        return m_nStep;
+    }
+
+    bool Get(int bDstToSrc, int iCellX, int iCellY,
+             GDALApproxTransformGridCell &sCell)
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        const auto &oMap = m_aoCells[bDstToSrc ? 1 : 0];
+        const auto oIter = oMap.find(GetKey(iCellX, iCellY));
+        if (oIter == oMap.end())
+            return false;
+        sCell = oIter->second;
+        return true;
+    }
+
+    void Put(int bDstToSrc, int iCellX, int iCellY,
+             const GDALApproxTransformGridCell &sCell)
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        auto &oMap = m_aoCells[bDstToSrc ? 1 : 0];
+        if (oMap.size() >= MAX_CELLS)
+            oMap.clear();
+        oMap[GetKey(iCellX, iCellY)] = sCell;
+    }
+
+    void Clear()
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        m_aoCells[0].clear();
+        m_aoCells[1].clear();
+    }
+};
+
+}  // namespace
+
+struct ApproxTransformInfo
+{
+    GDALTransformerInfo sTI{};
+
+    GDALTransformerFunc pfnBaseTransformer = nullptr;
+    void *pBaseCBData = nullptr;
+    double dfMaxErrorForward = 0;
+    double dfMaxErrorReverse = 0;
+
+    int bOwnSubtransformer = FALSE;
+
+    // Non null when the transform grid cache is enabled.
+    std::shared_ptr<GDALApproxTransformGrid> poGrid{};
+};
 
 /************************************************************************/
 /*                  GDALCreateSimilarApproxTransformer()                */
@@ -3723,22 +3860,27 @@ static void *GDALCreateSimilarApproxTransformer(void *hTransformArg,
     ApproxTransformInfo *psInfo =
         static_cast<ApproxTransformInfo *>(hTransformArg);
 
-    ApproxTransformInfo *psClonedInfo = static_cast<ApproxTransformInfo *>(
-        CPLMalloc(sizeof(ApproxTransformInfo)));
-
-    memcpy(psClonedInfo, psInfo, sizeof(ApproxTransformInfo));
+    ApproxTransformInfo *psClonedInfo = new ApproxTransformInfo(*psInfo);
     if (psClonedInfo->pBaseCBData)
     {
         psClonedInfo->pBaseCBData = GDALCreateSimilarTransformer(
             psInfo->pBaseCBData, dfSrcRatioX, dfSrcRatioY);
         if (psClonedInfo->pBaseCBData == nullptr)
         {
-            CPLFree(psClonedInfo);
+            delete psClonedInfo;
             return nullptr;
         }
     }
     psClonedInfo->bOwnSubtransformer = TRUE;
 
+    // A pure clone can share the cached grid. Otherwise the transformed
+    // values differ, so start from an empty one.
+    if (psInfo->poGrid && (dfSrcRatioX != 1.0 || dfSrcRatioY != 1.0))
+    {
+        psClonedInfo->poGrid = std::make_shared<GDALApproxTransformGrid>(
+            psInfo->poGrid->GetStep());
+    }
+
     return psClonedInfo;
 }
 
@@ -3774,6 +3916,13 @@ static CPLXMLNode *GDALSerializeApproxTransformer(void *pTransformArg)
             CPLString().Printf("%g", psInfo->dfMaxErrorReverse));
     }
 
+    if (psInfo->poGrid)
+    {
+        CPLCreateXMLElementAndValue(
+            psTree, "GridStep",
+            CPLString().Printf("%d", psInfo->poGrid->GetStep()));
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Capture underlying transformer.                                 */
     /* -------------------------------------------------------------------- */
@@ -3818,6 +3967,16 @@ static CPLXMLNode *GDALSerializeApproxTransformer(void *pTransformArg)
  * circumstances as little internal validation is done in order to keep things
  * fast.
  *
+ * Starting with GDAL 3.10, if the GDAL_APPROX_TRANSFORMER_GRID_STEP
+ * configuration option is set to a strictly positive value when the
+ * transformer is created, exact transformations are instead computed on a grid
+ * of that step (in input coordinates), lazily and only once, and points are
+ * bilinearly interpolated inside the grid cells. The interpolation error is
+ * checked against the maximum error at the center and the middle of the edges
+ * of each cell: cells that fail the check are transformed exactly. The grid is
+ * shared by the clones of the transformer, and thus by the warping chunks and
+ * threads. Only points with a zero Z input value use the grid.
+ *
  * @param pfnBaseTransformer the high precision transformer which should be
  * approximated.
  * @param pBaseTransformArg the callback argument for the high precision
@@ -3843,14 +4002,18 @@ GDALCreateApproxTransformer2(GDALTransformerFunc pfnBaseTransformer,
                              double dfMaxErrorReverse)
 
 {
-    ApproxTransformInfo *psATInfo = static_cast<ApproxTransformInfo *>(
-        CPLMalloc(sizeof(ApproxTransformInfo)));
+    ApproxTransformInfo *psATInfo = new ApproxTransformInfo();
     psATInfo->pfnBaseTransformer = pfnBaseTransformer;
     psATInfo->pBaseCBData = pBaseTransformArg;
     psATInfo->dfMaxErrorForward = dfMaxErrorForward;
     psATInfo->dfMaxErrorReverse = dfMaxErrorReverse;
     psATInfo->bOwnSubtransformer = FALSE;
 
+    const int nGridStep =
+        atoi(CPLGetConfigOption("GDAL_APPROX_TRANSFORMER_GRID_STEP", "0"));
+    if (nGridStep > 0)
+        psATInfo->poGrid = std::make_shared<GDALApproxTransformGrid>(nGridStep);
+
     memcpy(psATInfo->sTI.abySignature, GDAL_GTI2_SIGNATURE,
            strlen(GDAL_GTI2_SIGNATURE));
     psATInfo->sTI.pszClassName = GDAL_APPROX_TRANSFORMER_CLASS_NAME;
@@ -3899,7 +4062,7 @@ void GDALDestroyApproxTransformer(void *pCBData)
     if (psATInfo->bOwnSubtransformer)
         GDALDestroyTransformer(psATInfo->pBaseCBData);
 
-    CPLFree(pCBData);
+    delete psATInfo;
 }
 
 /************************************************************************/
@@ -3916,6 +4079,10 @@ void GDALRefreshApproxTransformer(void *hTransformArg)
     {
         GDALRefreshGenImgProjTransformer(psInfo->pBaseCBData);
     }
+
+    // Cached values may be obsolete.
+    if (psInfo->poGrid)
+        psInfo->poGrid->Clear();
 }
 
 /************************************************************************/
@@ -4169,6 +4336,163 @@ static int GDALApproxTransformInternal(void *pCBData, int bDstToSrc,
     return TRUE;
 }
 
+/************************************************************************/
+/*                   GDALApproxTransformComputeCell()                   */
+/*                                                                      */
+/*      Transform exactly the corners of a grid cell, and check that    */
+/*      bilinear interpolation of them is within the error threshold    */
+/*      at the center and at the middle of the edges of the cell.       */
+/************************************************************************/
+
+static void GDALApproxTransformComputeCell(ApproxTransformInfo *psATInfo,
+                                           int bDstToSrc, int iCellX,
+                                           int iCellY,
+                                           GDALApproxTransformGridCell &sCell)
+{
+    const double dfStep = psATInfo->poGrid->GetStep();
+    const double dfX0 = iCellX * dfStep;
+    const double dfY0 = iCellY * dfStep;
+    const double dfX1 = dfX0 + dfStep;
+    const double dfY1 = dfY0 + dfStep;
+    const double dfXM = dfX0 + dfStep / 2;
+    const double dfYM = dfY0 + dfStep / 2;
+
+    // 4 corners, center, then middle of the top, bottom, left and right
+    // edges.
+    constexpr int N_POINTS = 9;
+    double adfX[N_POINTS] = {dfX0, dfX1, dfX0, dfX1, dfXM,
+                             dfXM, dfXM, dfX0, dfX1};
+    double adfY[N_POINTS] = {dfY0, dfY0, dfY1, dfY1, dfYM,
+                             dfY0, dfY1, dfYM, dfYM};
+    double adfZ[N_POINTS] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+    // Position of the check points, relative to the cell.
+    constexpr double adfU[N_POINTS] = {0, 1, 0, 1, 0.5, 0.5, 0.5, 0, 1};
+    constexpr double adfV[N_POINTS] = {0, 0, 1, 1, 0.5, 0, 1, 0.5, 0.5};
+    int anSuccess[N_POINTS] = {};
+
+    sCell.bUsable = false;
+    if (!psATInfo->pfnBaseTransformer(psATInfo->pBaseCBData, bDstToSrc,
+                                      N_POINTS, adfX, adfY, adfZ, anSuccess))
+        return;
+    for (int i = 0; i < N_POINTS; ++i)
+    {
+        if (!anSuccess[i] || !std::isfinite(adfX[i]) ||
+            !std::isfinite(adfY[i]))
+            return;
+    }
+    for (int i = 0; i < 4; ++i)
+    {
+        sCell.adfX[i] = adfX[i];
+        sCell.adfY[i] = adfY[i];
+        sCell.adfZ[i] = adfZ[i];
+    }
+
+    const double dfMaxError =
+        (bDstToSrc) ? psATInfo->dfMaxErrorReverse : psATInfo->dfMaxErrorForward;
+    for (int i = 4; i < N_POINTS; ++i)
+    {
+        const double dfU = adfU[i];
+        const double dfV = adfV[i];
+        const double dfInterpX =
+            (1 - dfV) * ((1 - dfU) * adfX[0] + dfU * adfX[1]) +
+            dfV * ((1 - dfU) * adfX[2] + dfU * adfX[3]);
+        const double dfInterpY =
+            (1 - dfV) * ((1 - dfU) * adfY[0] + dfU * adfY[1]) +
+            dfV * ((1 - dfU) * adfY[2] + dfU * adfY[3]);
+        const double dfError =
+            fabs(dfInterpX - adfX[i]) + fabs(dfInterpY - adfY[i]);
+        if (dfError > dfMaxError)
+            return;
+    }
+    sCell.bUsable = true;
+}
+
+/************************************************************************/
+/*                     GDALApproxTransformWithGrid()                    */
+/*                                                                      */
+/*      Transform points by bilinear interpolation in the cells of the  */
+/*      shared transform grid. Points in cells where the interpolation  */
+/*      is not accurate enough are transformed exactly.                 */
+/************************************************************************/
+
+static int GDALApproxTransformWithGrid(ApproxTransformInfo *psATInfo,
+                                       int bDstToSrc, int nPoints, double *x,
+                                       double *y, double *z, int *panSuccess)
+{
+    GDALApproxTransformGrid *poGrid = psATInfo->poGrid.get();
+    const double dfStep = poGrid->GetStep();
+
+    std::vector<int> anExactIdx;
+    GDALApproxTransformGridCell sCell;
+    bool bHasCell = false;
+    int iCurCellX = 0;
+    int iCurCellY = 0;
+    for (int i = 0; i < nPoints; ++i)
+    {
+        const double dfCellX = std::floor(x[i] / dfStep);
+        const double dfCellY = std::floor(y[i] / dfStep);
+        if (!(dfCellX >= INT_MIN && dfCellX <= INT_MAX &&
+              dfCellY >= INT_MIN && dfCellY <= INT_MAX))
+        {
+            anExactIdx.push_back(i);
+            continue;
+        }
+        const int iCellX = static_cast<int>(dfCellX);
+        const int iCellY = static_cast<int>(dfCellY);
+        if (!bHasCell || iCellX != iCurCellX || iCellY != iCurCellY)
+        {
+            if (!poGrid->Get(bDstToSrc, iCellX, iCellY, sCell))
+            {
+                GDALApproxTransformComputeCell(psATInfo, bDstToSrc, iCellX,
+                                               iCellY, sCell);
+                poGrid->Put(bDstToSrc, iCellX, iCellY, sCell);
+            }
+            bHasCell = true;
+            iCurCellX = iCellX;
+            iCurCellY = iCellY;
+        }
+        if (!sCell.bUsable)
+        {
+            anExactIdx.push_back(i);
+            continue;
+        }
+
+        const double dfU = x[i] / dfStep - dfCellX;
+        const double dfV = y[i] / dfStep - dfCellY;
+        x[i] = (1 - dfV) * ((1 - dfU) * sCell.adfX[0] + dfU * sCell.adfX[1]) +
+               dfV * ((1 - dfU) * sCell.adfX[2] + dfU * sCell.adfX[3]);
+        y[i] = (1 - dfV) * ((1 - dfU) * sCell.adfY[0] + dfU * sCell.adfY[1]) +
+               dfV * ((1 - dfU) * sCell.adfY[2] + dfU * sCell.adfY[3]);
+        z[i] = (1 - dfV) * ((1 - dfU) * sCell.adfZ[0] + dfU * sCell.adfZ[1]) +
+               dfV * ((1 - dfU) * sCell.adfZ[2] + dfU * sCell.adfZ[3]);
+        panSuccess[i] = TRUE;
+    }
+
+    if (anExactIdx.empty())
+        return TRUE;
+
+    const int nExact = static_cast<int>(anExactIdx.size());
+    std::vector<double> adfX(nExact), adfY(nExact), adfZ(nExact);
+    std::vector<int> anSuccess(nExact);
+    for (int j = 0; j < nExact; ++j)
+    {
+        adfX[j] = x[anExactIdx[j]];
+        adfY[j] = y[anExactIdx[j]];
+        adfZ[j] = z[anExactIdx[j]];
+    }
+    const int bRet = psATInfo->pfnBaseTransformer(
+        psATInfo->pBaseCBData, bDstToSrc, nExact, adfX.data(), adfY.data(),
+        adfZ.data(), anSuccess.data());
+    for (int j = 0; j < nExact; ++j)
+    {
+        x[anExactIdx[j]] = adfX[j];
+        y[anExactIdx[j]] = adfY[j];
+        z[anExactIdx[j]] = adfZ[j];
+        panSuccess[anExactIdx[j]] = anSuccess[j];
+    }
+    return bRet;
+}
+
 /************************************************************************/
 /*                        GDALApproxTransform()                         */
 /************************************************************************/
@@ -4211,6 +4535,18 @@ int GDALApproxTransform(void *pCBData, int bDstToSrc, int nPoints, double *x,
         goto end;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Use the shared transform grid if enabled. It is only valid     */
+    /*      for points at zero elevation, which is what the warper uses.   */
+    /* -------------------------------------------------------------------- */
+    if (psATInfo->poGrid &&
+        std::all_of(z, z + nPoints, [](double dfZ) { return dfZ == 0; }))
+    {
+        bRet = GDALApproxTransformWithGrid(psATInfo, bDstToSrc, nPoints, x, y,
+                                           z, panSuccess);
+        goto end;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Transform first, last and middle point.                         */
     /* -------------------------------------------------------------------- */
@@ -4296,6 +4632,19 @@ static void *GDALDeserializeApproxTransformer(CPLXMLNode *psTree)
         pfnBaseTransform, pBaseCBData, dfMaxErrorForward, dfMaxErrorReverse);
     GDALApproxTransformerOwnsSubtransformer(pApproxCBData, TRUE);
 
+    const char *pszGridStep = CPLGetXMLValue(psTree, "GridStep", nullptr);
+    if (pszGridStep != nullptr)
+    {
+        ApproxTransformInfo *psATInfo =
+            static_cast<ApproxTransformInfo *>(pApproxCBData);
+        const int nGridStep = atoi(pszGridStep);
+        if (nGridStep > 0)
+            psATInfo->poGrid =
+                std::make_shared<GDALApproxTransformGrid>(nGridStep);
+        else
+            psATInfo->poGrid.reset();
+    }
+
     return pApproxCBData;
 }
 
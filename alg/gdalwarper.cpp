@@ -1179,6 +1179,28 @@ CPLErr GDALWarpDstAlphaMasker(void *pMaskFuncArg, int nBandCount,
  * set the number of threads to use to parallelize the computation part of the
  * warping. If not set, computation will be done in a single thread.</li>
  *
+ * <li>CHUNK_PIPELINE_DEPTH: (GDAL >= 3.10) Number of chunks that can be in
+ * flight at the same time with GDALWarpOperation::ChunkAndWarpMulti() (that
+ * is gdalwarp -multi). Reading and writing of chunks are serialized, as well
+ * as the warping kernel (which can itself use several threads with
+ * NUM_THREADS), but values greater than the default of 2 allow the source
+ * windows of the next chunks to be read ahead, which is mostly useful with
+ * high latency (e.g. network) sources. Memory usage is proportional to that
+ * value. Chunks are read and written in order whatever the value, and a
+ * value of 1 processes them one after the other.</li>
+ *
+ * <li>USE_OPENCL: Can be set to YES to use the OpenCL warping kernel, when
+ * GDAL has been built with OpenCL support. It is only used for Byte, Int16,
+ * UInt16 and Float32 data (and their complex counterparts) with bilinear,
+ * cubic, cubic spline or lanczos resampling, and without source density
+ * mask. Other cases use the CPU kernels. Defaults to the value of the
+ * GDAL_USE_OPENCL configuration option, or NO.</li>
+ *
+ * <li>USE_GPU: (GDAL >= 3.10) Alias of USE_OPENCL, which takes precedence
+ * over it when both are set. There is currently no other GPU backend. A
+ * warning is emitted once if it is set to YES and GDAL has been built
+ * without OpenCL support.</li>
+ *
  * <li>STREAMABLE_OUTPUT: (GDAL >= 2.0) This defaults to FALSE, but may
  * be set to TRUE typically when writing to a streamed file. The
  * gdalwarp utility automatically sets this option when writing to
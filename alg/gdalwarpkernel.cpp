@@ -42,6 +42,7 @@
 #include <limits>
 #include <mutex>
 #include <new>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -332,6 +333,9 @@ void *GWKThreadsCreate(char **papszWarpOptions,
         nThreads = 0;
     if (nThreads > 128)
         nThreads = 128;
+    nThreads = GDALCapThreadCount(nThreads);
+    if (nThreads <= 1)
+        nThreads = 0;
 
     GWKThreadData *psThreadData = new GWKThreadData();
     auto poThreadPool =
@@ -1207,6 +1211,28 @@ CPLErr GDALWarpKernel::PerformWarp()
     if (CPLFetchBool(papszWarpOptions, "USE_GENERAL_CASE", false))
         return GWKGeneralCase(this);
 
+    // USE_GPU is an alias of USE_OPENCL.
+    const bool bUseGPU = CPLTestBool(CSLFetchNameValueDef(
+        papszWarpOptions, "USE_GPU",
+        CSLFetchNameValueDef(papszWarpOptions, "USE_OPENCL",
+                             CPLGetConfigOption("GDAL_USE_OPENCL", "NO"))));
+#if !defined(HAVE_OPENCL)
+    if (bUseGPU && CSLFetchNameValue(papszWarpOptions, "USE_GPU") != nullptr)
+    {
+        // Warping jobs may run concurrently
+        static std::once_flag oWarnOnce;
+        std::call_once(
+            oWarnOnce,
+            []()
+            {
+                CPLError(CE_Warning, CPLE_NotSupported,
+                         "USE_GPU=YES requested, but GDAL has been built "
+                         "without a GPU warping backend. Using the CPU "
+                         "kernel.");
+            });
+    }
+#endif
+
 #if defined(HAVE_OPENCL)
     if ((eWorkingDataType == GDT_Byte || eWorkingDataType == GDT_CInt16 ||
          eWorkingDataType == GDT_UInt16 || eWorkingDataType == GDT_Int16 ||
@@ -1216,9 +1242,7 @@ CPLErr GDALWarpKernel::PerformWarp()
         !bApplyVerticalShift &&
         // OpenCL warping gives different results than the ones expected by autotest,
         // so disable it by default even if found.
-        CPLTestBool(
-            CSLFetchNameValueDef(papszWarpOptions, "USE_OPENCL",
-                                 CPLGetConfigOption("GDAL_USE_OPENCL", "NO"))))
+        bUseGPU)
     {
         if (pafUnifiedSrcDensity != nullptr)
         {
@@ -5551,6 +5575,193 @@ static CPLErr GWKGeneralCase(GDALWarpKernel *poWK)
     return GWKRun(poWK, "GWKGeneralCase", GWKGeneralCaseThread);
 }
 
+/************************************************************************/
+/*                        GWKIsSrcWindowValid()                         */
+/*                                                                      */
+/*      Return whether all the pixels of the nWinXSize x nWinYSize      */
+/*      source window starting at iSrcOffset are valid in both the      */
+/*      unified and per-band validity masks.                            */
+/************************************************************************/
+
+static bool GWKIsSrcWindowValid(const GDALWarpKernel *poWK, int iBand,
+                                GPtrDiff_t iSrcOffset, int nWinXSize,
+                                int nWinYSize)
+{
+    GUInt32 *panBandSrcValid =
+        poWK->papanBandSrcValid != nullptr ? poWK->papanBandSrcValid[iBand]
+                                           : nullptr;
+    for (int iY = 0; iY < nWinYSize; ++iY)
+    {
+        const GPtrDiff_t iRowOffset =
+            iSrcOffset + static_cast<GPtrDiff_t>(iY) * poWK->nSrcXSize;
+        for (int iX = 0; iX < nWinXSize; ++iX)
+        {
+            if (poWK->panUnifiedSrcValid != nullptr &&
+                !CPLMaskGet(poWK->panUnifiedSrcValid, iRowOffset + iX))
+                return false;
+            if (panBandSrcValid != nullptr &&
+                !CPLMaskGet(panBandSrcValid, iRowOffset + iX))
+                return false;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                 GWKResample4SampleRealAllValidT()                    */
+/*                                                                      */
+/*      Fast path of GWKBilinearResample4Sample() and                   */
+/*      GWKCubicResample4Sample() for non-complex types, when the       */
+/*      whole resampling footprint is inside the source buffer and      */
+/*      valid. The per-pixel density and mask handling is skipped,      */
+/*      but the computations are done in the same order as in the       */
+/*      generic functions, so that results are identical.               */
+/*                                                                      */
+/*      Returns false if the fast path does not apply, in which case    */
+/*      the caller must use the generic function.                       */
+/************************************************************************/
+
+template <class T>
+static bool GWKResample4SampleRealAllValidT(const GDALWarpKernel *poWK,
+                                            int iBand, double dfSrcX,
+                                            double dfSrcY, double *pdfDensity,
+                                            double *pdfReal)
+{
+    const int nSrcXSize = poWK->nSrcXSize;
+    const int nSrcYSize = poWK->nSrcYSize;
+    const T *pSrc = reinterpret_cast<const T *>(poWK->papabySrcImage[iBand]);
+
+    if (poWK->eResample == GRA_Bilinear)
+    {
+        const int iSrcX = static_cast<int>(floor(dfSrcX - 0.5));
+        const int iSrcY = static_cast<int>(floor(dfSrcY - 0.5));
+        if (iSrcX < 0 || iSrcX + 1 >= nSrcXSize || iSrcY < 0 ||
+            iSrcY + 1 >= nSrcYSize)
+            return false;
+
+        const GPtrDiff_t iSrcOffset =
+            iSrcX + static_cast<GPtrDiff_t>(iSrcY) * nSrcXSize;
+        if (!GWKIsSrcWindowValid(poWK, iBand, iSrcOffset, 2, 2))
+            return false;
+
+        const double dfRatioX = 1.5 - (dfSrcX - iSrcX);
+        const double dfRatioY = 1.5 - (dfSrcY - iSrcY);
+        const double dfMult1 = dfRatioX * dfRatioY;
+        const double dfMult2 = (1.0 - dfRatioX) * dfRatioY;
+        const double dfMult3 = dfRatioX * (1.0 - dfRatioY);
+        const double dfMult4 = (1.0 - dfRatioX) * (1.0 - dfRatioY);
+
+        double dfAccumulatorDivisor = 0.0;
+        dfAccumulatorDivisor += dfMult1;
+        dfAccumulatorDivisor += dfMult2;
+        dfAccumulatorDivisor += dfMult3;
+        dfAccumulatorDivisor += dfMult4;
+
+        double dfAccumulatorReal = 0.0;
+        dfAccumulatorReal += static_cast<double>(pSrc[iSrcOffset]) * dfMult1;
+        dfAccumulatorReal +=
+            static_cast<double>(pSrc[iSrcOffset + 1]) * dfMult2;
+        dfAccumulatorReal +=
+            static_cast<double>(pSrc[iSrcOffset + nSrcXSize]) * dfMult3;
+        dfAccumulatorReal +=
+            static_cast<double>(pSrc[iSrcOffset + nSrcXSize + 1]) * dfMult4;
+
+        double dfAccumulatorDensity = 0.0;
+        dfAccumulatorDensity += 1.0 * dfMult1;
+        dfAccumulatorDensity += 1.0 * dfMult2;
+        dfAccumulatorDensity += 1.0 * dfMult3;
+        dfAccumulatorDensity += 1.0 * dfMult4;
+
+        if (dfAccumulatorDivisor == 1.0)
+        {
+            *pdfReal = dfAccumulatorReal;
+            *pdfDensity = dfAccumulatorDensity;
+        }
+        else if (dfAccumulatorDivisor < 0.00001)
+        {
+            *pdfReal = 0.0;
+            *pdfDensity = 0.0;
+        }
+        else
+        {
+            *pdfReal = dfAccumulatorReal / dfAccumulatorDivisor;
+            *pdfDensity = dfAccumulatorDensity / dfAccumulatorDivisor;
+        }
+        return true;
+    }
+
+    CPLAssert(poWK->eResample == GRA_Cubic);
+    const int iSrcX = static_cast<int>(dfSrcX - 0.5);
+    const int iSrcY = static_cast<int>(dfSrcY - 0.5);
+    if (iSrcX - 1 < 0 || iSrcX + 2 >= nSrcXSize || iSrcY - 1 < 0 ||
+        iSrcY + 2 >= nSrcYSize)
+        return false;
+
+    const GPtrDiff_t iSrcOffset =
+        iSrcX + static_cast<GPtrDiff_t>(iSrcY) * nSrcXSize;
+    if (!GWKIsSrcWindowValid(poWK, iBand, iSrcOffset - nSrcXSize - 1, 4, 4))
+        return false;
+
+    const double dfDeltaX = dfSrcX - 0.5 - iSrcX;
+    const double dfDeltaY = dfSrcY - 0.5 - iSrcY;
+
+    double adfCoeffsX[4] = {};
+    GWKCubicComputeWeights(dfDeltaX, adfCoeffsX);
+
+    const double adfDensity[4] = {1.0, 1.0, 1.0, 1.0};
+    const double dfRowDensity = CONVOL4(adfCoeffsX, adfDensity);
+    double adfValueDens[4] = {};
+    double adfValueReal[4] = {};
+    for (GPtrDiff_t i = -1; i < 3; i++)
+    {
+        const T *pSrcRow = pSrc + iSrcOffset + i * nSrcXSize - 1;
+        const double adfReal[4] = {
+            static_cast<double>(pSrcRow[0]), static_cast<double>(pSrcRow[1]),
+            static_cast<double>(pSrcRow[2]), static_cast<double>(pSrcRow[3])};
+        adfValueDens[i + 1] = dfRowDensity;
+        adfValueReal[i + 1] = CONVOL4(adfCoeffsX, adfReal);
+    }
+
+    double adfCoeffsY[4] = {};
+    GWKCubicComputeWeights(dfDeltaY, adfCoeffsY);
+
+    *pdfDensity = CONVOL4(adfCoeffsY, adfValueDens);
+    *pdfReal = CONVOL4(adfCoeffsY, adfValueReal);
+    return true;
+}
+
+/************************************************************************/
+/*                  GWKResample4SampleRealAllValid()                    */
+/************************************************************************/
+
+static bool GWKResample4SampleRealAllValid(const GDALWarpKernel *poWK,
+                                           int iBand, double dfSrcX,
+                                           double dfSrcY, double *pdfDensity,
+                                           double *pdfReal)
+{
+    switch (poWK->eWorkingDataType)
+    {
+        case GDT_Byte:
+            return GWKResample4SampleRealAllValidT<GByte>(
+                poWK, iBand, dfSrcX, dfSrcY, pdfDensity, pdfReal);
+        case GDT_Int16:
+            return GWKResample4SampleRealAllValidT<GInt16>(
+                poWK, iBand, dfSrcX, dfSrcY, pdfDensity, pdfReal);
+        case GDT_UInt16:
+            return GWKResample4SampleRealAllValidT<GUInt16>(
+                poWK, iBand, dfSrcX, dfSrcY, pdfDensity, pdfReal);
+        case GDT_Float32:
+            return GWKResample4SampleRealAllValidT<float>(
+                poWK, iBand, dfSrcX, dfSrcY, pdfDensity, pdfReal);
+        case GDT_Float64:
+            return GWKResample4SampleRealAllValidT<double>(
+                poWK, iBand, dfSrcX, dfSrcY, pdfDensity, pdfReal);
+        default:
+            break;
+    }
+    return false;
+}
+
 /************************************************************************/
 /*                            GWKRealCase()                             */
 /*                                                                      */
@@ -5609,6 +5820,17 @@ static void GWKRealCaseThread(void *pData)
     const bool bOneSourceCornerFailsToReproject =
         GWKOneSourceCornerFailsToReproject(psJob);
 
+    // Whether bilinear and cubic resampling can skip the per-pixel
+    // validity handling when the whole footprint is valid.
+    const bool bTryAllValidFastPath =
+        bUse4SamplesFormula && poWK->pafUnifiedSrcDensity == nullptr &&
+        (poWK->eResample == GRA_Bilinear || poWK->eResample == GRA_Cubic) &&
+        (poWK->eWorkingDataType == GDT_Byte ||
+         poWK->eWorkingDataType == GDT_Int16 ||
+         poWK->eWorkingDataType == GDT_UInt16 ||
+         poWK->eWorkingDataType == GDT_Float32 ||
+         poWK->eWorkingDataType == GDT_Float64);
+
     // Precompute values.
     for (int iDstX = 0; iDstX < nDstXSize; iDstX++)
         padfX[nDstXSize + iDstX] = iDstX + 0.5 + poWK->nDstXOff;
@@ -5730,6 +5952,14 @@ static void GWKRealCaseThread(void *pData)
                     CPL_IGNORE_RET_VAL(GWKGetPixelValueReal(
                         poWK, iBand, iSrcOffset, &dfBandDensity, &dfValueReal));
                 }
+                else if (bTryAllValidFastPath &&
+                         GWKResample4SampleRealAllValid(
+                             poWK, iBand, padfX[iDstX] - poWK->nSrcXOff,
+                             padfY[iDstX] - poWK->nSrcYOff, &dfBandDensity,
+                             &dfValueReal))
+                {
+                    // Done.
+                }
                 else if (poWK->eResample == GRA_Bilinear && bUse4SamplesFormula)
                 {
                     double dfValueImagIgnored = 0.0;
@@ -6412,6 +6642,126 @@ static CPLErr GWKAverageOrMode(GDALWarpKernel *poWK)
     return GWKRun(poWK, "GWKAverageOrMode", GWKAverageOrModeThread);
 }
 
+/************************************************************************/
+/*                        GWKAverageColumnSums                          */
+/************************************************************************/
+
+// Per-column reduction, with their vertical weights, of the source lines
+// covered by a target line, when the transformation is axis-aligned.
+// From its prefix sums, the average (or RMS) value of a target pixel is
+// obtained in constant time, whatever the size of its source footprint.
+struct GWKAverageColumnSums
+{
+    int iSrcYMin = -1;
+    int iSrcYMax = -1;
+    double dfYMin = 0;
+    double dfYMax = 0;
+    // Weighted sum of valid values (or squared values for RMS) per column
+    std::vector<double> adfSum{};
+    // Sum of the weights of valid values per column
+    std::vector<double> adfWeight{};
+    // Prefix sums of the above: element i is the sum of columns [0, i[
+    std::vector<double> adfSumPrefix{};
+    std::vector<double> adfWeightPrefix{};
+
+    bool IsValidFor(int iSrcYMinIn, int iSrcYMaxIn, double dfYMinIn,
+                    double dfYMaxIn) const
+    {
+        return iSrcYMin == iSrcYMinIn && iSrcYMax == iSrcYMaxIn &&
+               dfYMin == dfYMinIn && dfYMax == dfYMaxIn;
+    }
+
+    void Compute(const GDALWarpKernel *poWK, int iBand, bool bSquare,
+                 int iSrcYMinIn, int iSrcYMaxIn, double dfYMinIn,
+                 double dfYMaxIn);
+
+    // Sum of values and weights over columns [iSrcXMin, iSrcXMax[, with
+    // the same fractional weights for edge columns as the general case.
+    void Get(int iSrcXMin, int iSrcXMax, double dfXMin, double dfXMax,
+             double &dfTotal, double &dfTotalWeight) const
+    {
+        if (iSrcXMin >= iSrcXMax)
+        {
+            dfTotal = 0;
+            dfTotalWeight = 0;
+            return;
+        }
+        if (iSrcXMin + 1 == iSrcXMax)
+        {
+            dfTotal = adfSum[iSrcXMin];
+            dfTotalWeight = adfWeight[iSrcXMin];
+            return;
+        }
+        const double dfWeightFirst =
+            std::max(0.0, 1 - (dfXMin - iSrcXMin));
+        const double dfWeightLast = std::max(0.0, 1 - (iSrcXMax - dfXMax));
+        dfTotal = adfSumPrefix[iSrcXMax - 1] - adfSumPrefix[iSrcXMin + 1] +
+                  dfWeightFirst * adfSum[iSrcXMin] +
+                  dfWeightLast * adfSum[iSrcXMax - 1];
+        dfTotalWeight =
+            adfWeightPrefix[iSrcXMax - 1] - adfWeightPrefix[iSrcXMin + 1] +
+            dfWeightFirst * adfWeight[iSrcXMin] +
+            dfWeightLast * adfWeight[iSrcXMax - 1];
+    }
+};
+
+void GWKAverageColumnSums::Compute(const GDALWarpKernel *poWK, int iBand,
+                                   bool bSquare, int iSrcYMinIn,
+                                   int iSrcYMaxIn, double dfYMinIn,
+                                   double dfYMaxIn)
+{
+    iSrcYMin = iSrcYMinIn;
+    iSrcYMax = iSrcYMaxIn;
+    dfYMin = dfYMinIn;
+    dfYMax = dfYMaxIn;
+
+    const int nSrcXSize = poWK->nSrcXSize;
+    adfSum.assign(nSrcXSize, 0.0);
+    adfWeight.assign(nSrcXSize, 0.0);
+    for (int iSrcY = iSrcYMin; iSrcY < iSrcYMax; iSrcY++)
+    {
+        const double dfWeightY =
+            (iSrcY == iSrcYMin)
+                ? ((iSrcYMin + 1 == iSrcYMax) ? 1.0
+                                              : 1 - (dfYMin - iSrcYMin))
+            : (iSrcY + 1 == iSrcYMax) ? 1 - (iSrcYMax - dfYMax)
+                                      : 1.0;
+        if (!(dfWeightY > 0))
+            continue;
+        GPtrDiff_t iSrcOffset = static_cast<GPtrDiff_t>(iSrcY) * nSrcXSize;
+        for (int iSrcX = 0; iSrcX < nSrcXSize; iSrcX++, iSrcOffset++)
+        {
+            if (poWK->panUnifiedSrcValid != nullptr &&
+                !CPLMaskGet(poWK->panUnifiedSrcValid, iSrcOffset))
+            {
+                continue;
+            }
+
+            double dfBandDensity = 0;
+            double dfValue = 0;
+            if (GWKGetPixelValueReal(poWK, iBand, iSrcOffset, &dfBandDensity,
+                                     &dfValue) &&
+                dfBandDensity > BAND_DENSITY_THRESHOLD)
+            {
+                adfSum[iSrcX] +=
+                    (bSquare ? dfValue * dfValue : dfValue) * dfWeightY;
+                adfWeight[iSrcX] += dfWeightY;
+            }
+        }
+    }
+
+    adfSumPrefix.resize(nSrcXSize + 1);
+    adfWeightPrefix.resize(nSrcXSize + 1);
+    adfSumPrefix[0] = 0;
+    adfWeightPrefix[0] = 0;
+    for (int iSrcX = 0; iSrcX < nSrcXSize; iSrcX++)
+    {
+        adfSumPrefix[iSrcX + 1] = adfSumPrefix[iSrcX] + adfSum[iSrcX];
+        adfWeightPrefix[iSrcX + 1] =
+            adfWeightPrefix[iSrcX] + adfWeight[iSrcX];
+    }
+}
+
 // Overall logic based on GWKGeneralCaseThread().
 static void GWKAverageOrModeThread(void *pData)
 {
@@ -6439,15 +6789,16 @@ static void GWKAverageOrModeThread(void *pData)
     int *panVals = nullptr;
     int nBins = 0;
     int nBinsOffset = 0;
+    // Bins of panVals to reset after each target pixel, which is much
+    // cheaper than clearing the 65536 bins of 16-bit types.
+    std::vector<int> anTouchedBins;
 
-    // Only used with nAlgo = 2.
-    float *pafRealVals = nullptr;
-    float *pafImagVals = nullptr;
-    int *panRealSums = nullptr;
-    int *panImagSums = nullptr;
+    // Only used with nAlgo = 2: number of occurrences of each value.
+    std::unordered_map<float, int> oMapValueCounts;
 
     // Only used with nAlgo = 6.
     float quant = 0.5;
+    std::vector<double> adfRealValuesTmp;
 
     // To control array allocation only when data type is complex
     const bool bIsComplex = GDALDataTypeIsComplex(poWK->eWorkingDataType) != 0;
@@ -6493,27 +6844,13 @@ static void GWKAverageOrModeThread(void *pData)
                 nBins = 65536;
             }
             panVals =
-                static_cast<int *>(VSI_MALLOC_VERBOSE(nBins * sizeof(int)));
+                static_cast<int *>(VSI_CALLOC_VERBOSE(nBins, sizeof(int)));
             if (panVals == nullptr)
                 return;
         }
         else
         {
             nAlgo = GWKAOM_Fmode;
-
-            if (nSrcXSize > 0 && nSrcYSize > 0)
-            {
-                pafRealVals = static_cast<float *>(
-                    VSI_MALLOC3_VERBOSE(nSrcXSize, nSrcYSize, sizeof(float)));
-                panRealSums = static_cast<int *>(
-                    VSI_MALLOC3_VERBOSE(nSrcXSize, nSrcYSize, sizeof(int)));
-                if (pafRealVals == nullptr || panRealSums == nullptr)
-                {
-                    VSIFree(pafRealVals);
-                    VSIFree(panRealSums);
-                    return;
-                }
-            }
         }
     }
     else if (poWK->eResample == GRA_Max)
@@ -6595,6 +6932,27 @@ static void GWKAverageOrModeThread(void *pData)
     const int nYMargin =
         2 * std::max(1, static_cast<int>(std::ceil(1. / poWK->dfYScale)));
 
+    // When downsampling with an axis-aligned transformation, all target
+    // pixels of a line share the same source lines and vertical weights.
+    // Those source lines are then reduced once per column, instead of
+    // iterating over the whole footprint of each target pixel. This is
+    // restricted to integer working data types, for which prefix sums
+    // cannot be spoiled by non-finite or huge values.
+    const bool bUseColumnSums =
+        (nAlgo == GWKAOM_Average || nAlgo == GWKAOM_RMS) &&
+        poWK->m_aadfExcludedValues.empty() &&
+        dfNodataValuesThreshold >= 1 && !poWK->bApplyVerticalShift &&
+        !bIsComplex && GDALDataTypeIsInteger(poWK->eWorkingDataType) &&
+        GDALGetDataTypeSizeBits(poWK->eWorkingDataType) <= 32 &&
+        poWK->dfXScale <= 0.5 && poWK->dfYScale <= 0.5 &&
+        GDALTransformIsAffineNoRotation(poWK->pfnTransformer,
+                                        poWK->pTransformerArg) &&
+        // for debug/testing purposes
+        CPLTestBool(
+            CPLGetConfigOption("GDAL_WARP_USE_AFFINE_OPTIMIZATION", "YES"));
+    std::vector<GWKAverageColumnSums> asColumnSums(
+        bUseColumnSums ? poWK->nBands : 0);
+
     /* ==================================================================== */
     /*      Loop over output lines.                                         */
     /* ==================================================================== */
@@ -6745,9 +7103,43 @@ static void GWKAverageOrModeThread(void *pData)
 
             bool bDone = false;
 
+            if (bUseColumnSums && !bWrapOverX)
+            {
+                for (int iBand = 0; iBand < poWK->nBands; iBand++)
+                {
+                    auto &sColumnSums = asColumnSums[iBand];
+                    if (!sColumnSums.IsValidFor(iSrcYMin, iSrcYMax, dfYMin,
+                                                dfYMax))
+                    {
+                        sColumnSums.Compute(poWK, iBand, nAlgo == GWKAOM_RMS,
+                                            iSrcYMin, iSrcYMax, dfYMin,
+                                            dfYMax);
+                    }
+
+                    double dfTotal = 0;
+                    double dfTotalWeight = 0;
+                    sColumnSums.Get(iSrcXMin, iSrcXMax, dfXMin, dfXMax,
+                                    dfTotal, dfTotalWeight);
+                    if (dfTotalWeight > 0)
+                    {
+                        const double dfValue =
+                            nAlgo == GWKAOM_RMS
+                                ? sqrt(dfTotal / dfTotalWeight)
+                                : dfTotal / dfTotalWeight;
+                        bHasFoundDensity = true;
+                        GWKSetPixelValue(poWK, iBand, iDstOffset,
+                                         /* dfBandDensity = */ 1.0, dfValue,
+                                         0);
+                    }
+                }
+
+                // Skip below loop on bands
+                bDone = true;
+            }
+
             // Special Average mode where we process all bands together,
             // to avoid averaging tuples that match an entry of m_aadfExcludedValues
-            if (nAlgo == GWKAOM_Average &&
+            if (!bDone && nAlgo == GWKAOM_Average &&
                 (!poWK->m_aadfExcludedValues.empty() ||
                  dfNodataValuesThreshold < 1 - EPS) &&
                 !poWK->bApplyVerticalShift && !bIsComplex)
@@ -7128,9 +7520,9 @@ static void GWKAverageOrModeThread(void *pData)
                         // majority filter on floating point data? But, here it
                         // is for the sake of compatibility. It won't look
                         // right on RGB images by the nature of the filter.
-                        int iMaxInd = 0;
-                        int iMaxVal = -1;
-                        int i = 0;
+                        float fMaxVal = 0;
+                        int nMaxCount = 0;
+                        oMapValueCounts.clear();
 
                         for (int iSrcY = iSrcYMin; iSrcY < iSrcYMax; iSrcY++)
                         {
@@ -7159,34 +7551,21 @@ static void GWKAverageOrModeThread(void *pData)
                                     const float fVal =
                                         static_cast<float>(dfValueRealTmp);
 
-                                    // Check array for existing entry.
-                                    for (i = 0; i < iMaxInd; ++i)
-                                        if (pafRealVals[i] == fVal &&
-                                            ++panRealSums[i] >
-                                                panRealSums[iMaxVal])
-                                        {
-                                            iMaxVal = i;
-                                            break;
-                                        }
-
-                                    // Add to arr if entry not already there.
-                                    if (i == iMaxInd)
+                                    // In case of ties, the first value
+                                    // reaching the highest count wins.
+                                    const int nCount = ++oMapValueCounts[fVal];
+                                    if (nCount > nMaxCount)
                                     {
-                                        pafRealVals[iMaxInd] = fVal;
-                                        panRealSums[iMaxInd] = 1;
-
-                                        if (iMaxVal < 0)
-                                            iMaxVal = iMaxInd;
-
-                                        ++iMaxInd;
+                                        fMaxVal = fVal;
+                                        nMaxCount = nCount;
                                     }
                                 }
                             }
                         }
 
-                        if (iMaxVal != -1)
+                        if (nMaxCount > 0)
                         {
-                            dfValueReal = pafRealVals[iMaxVal];
+                            dfValueReal = fMaxVal;
 
                             if (poWK->bApplyVerticalShift)
                             {
@@ -7210,7 +7589,7 @@ static void GWKAverageOrModeThread(void *pData)
                         int nMaxVal = 0;
                         int iMaxInd = -1;
 
-                        memset(panVals, 0, nBins * sizeof(int));
+                        anTouchedBins.clear();
 
                         for (int iSrcY = iSrcYMin; iSrcY < iSrcYMax; iSrcY++)
                         {
@@ -7238,17 +7617,25 @@ static void GWKAverageOrModeThread(void *pData)
                                 {
                                     const int nVal =
                                         static_cast<int>(dfValueRealTmp);
-                                    if (++panVals[nVal + nBinsOffset] > nMaxVal)
+                                    const int nCount =
+                                        ++panVals[nVal + nBinsOffset];
+                                    if (nCount == 1)
+                                        anTouchedBins.push_back(nVal +
+                                                                nBinsOffset);
+                                    if (nCount > nMaxVal)
                                     {
                                         // Sum the density.
                                         // Is it the most common value so far?
                                         iMaxInd = nVal;
-                                        nMaxVal = panVals[nVal + nBinsOffset];
+                                        nMaxVal = nCount;
                                     }
                                 }
                             }
                         }
 
+                        for (const int iBin : anTouchedBins)
+                            panVals[iBin] = 0;
+
                         if (iMaxInd != -1)
                         {
                             dfValueReal = iMaxInd;
@@ -7395,7 +7782,7 @@ static void GWKAverageOrModeThread(void *pData)
                 // poWK->eResample == GRA_Med | GRA_Q1 | GRA_Q3.
                 {
                     bool bFoundValid = false;
-                    std::vector<double> dfRealValuesTmp;
+                    adfRealValuesTmp.clear();
 
                     // This code adapted from nAlgo 1 method, GRA_Average.
                     for (int iSrcY = iSrcYMin; iSrcY < iSrcYMax; iSrcY++)
@@ -7424,18 +7811,22 @@ static void GWKAverageOrModeThread(void *pData)
                                 dfBandDensity > BAND_DENSITY_THRESHOLD)
                             {
                                 bFoundValid = true;
-                                dfRealValuesTmp.push_back(dfValueRealTmp);
+                                adfRealValuesTmp.push_back(dfValueRealTmp);
                             }
                         }
                     }
 
                     if (bFoundValid)
                     {
-                        std::sort(dfRealValuesTmp.begin(),
-                                  dfRealValuesTmp.end());
-                        int quantIdx = static_cast<int>(
-                            std::ceil(quant * dfRealValuesTmp.size() - 1));
-                        dfValueReal = dfRealValuesTmp[quantIdx];
+                        // Only the element at quantIdx in sorted order is
+                        // needed: a selection is linear instead of the
+                        // O(n log n) of a full sort.
+                        const int quantIdx = static_cast<int>(
+                            std::ceil(quant * adfRealValuesTmp.size() - 1));
+                        std::nth_element(adfRealValuesTmp.begin(),
+                                         adfRealValuesTmp.begin() + quantIdx,
+                                         adfRealValuesTmp.end());
+                        dfValueReal = adfRealValuesTmp[quantIdx];
 
                         if (poWK->bApplyVerticalShift)
                         {
@@ -7451,7 +7842,6 @@ static void GWKAverageOrModeThread(void *pData)
 
                         dfBandDensity = 1;
                         bHasFoundDensity = true;
-                        dfRealValuesTmp.clear();
                     }
                 }  // Quantile.
 
@@ -7513,13 +7903,6 @@ static void GWKAverageOrModeThread(void *pData)
     CPLFree(pabSuccess);
     CPLFree(pabSuccess2);
     VSIFree(panVals);
-    VSIFree(pafRealVals);
-    VSIFree(panRealSums);
-    if (bIsComplex)
-    {
-        VSIFree(pafImagVals);
-        VSIFree(panImagSums);
-    }
 }
 
 /************************************************************************/
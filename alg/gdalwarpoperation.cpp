@@ -37,10 +37,13 @@
 #include <cstring>
 
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "cpl_config.h"
 #include "cpl_conv.h"
@@ -48,6 +51,7 @@
 #include "cpl_mask.h"
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
+#include "cpl_trace.h"
 #include "cpl_vsi.h"
 #include "gdal.h"
 #include "gdal_priv.h"
@@ -62,12 +66,130 @@ struct _GDALWarpChunk
     double sExtraSx, sExtraSy;
 };
 
+/************************************************************************/
+/*                        GDALWarpChunkSequencer                        */
+/************************************************************************/
+
+// Hands over the stages of the chunks in flight in ChunkAndWarpMulti(), so
+// that chunks are read, warped and written in chunk order, whatever the
+// pipeline depth. Reads and writes share the I/O stage, which is granted in
+// the order of the requests queued. A chunk queues its read request once
+// the previous chunk has queued its own, and similarly for writes. The
+// warping stage is granted to the chunks one after the other.
+class GDALWarpChunkSequencer
+{
+  public:
+    explicit GDALWarpChunkSequencer(int nChunkCount) : m_anFlags(nChunkCount)
+    {
+    }
+
+    void EnterRead(int iChunk)
+    {
+        std::unique_lock<std::mutex> oLock(m_oMutex);
+        AcquireIO(oLock, iChunk, READ_QUEUED, m_nNextRead);
+    }
+
+    // Returns the index of the chunk that owned the I/O stage
+    int LeaveIO()
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        const int iChunk = m_iIOOwner;
+        m_iIOOwner = -1;
+        m_oCV.notify_all();
+        return iChunk;
+    }
+
+    void EnterWarp(int iChunk)
+    {
+        std::unique_lock<std::mutex> oLock(m_oMutex);
+        m_oCV.wait(oLock, [this, iChunk] { return m_nNextWarp == iChunk; });
+    }
+
+    void LeaveWarp(int iChunk)
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        m_anFlags[iChunk] |= WARP_DONE;
+        AdvanceCounters();
+        m_oCV.notify_all();
+    }
+
+    void EnterWrite(int iChunk)
+    {
+        std::unique_lock<std::mutex> oLock(m_oMutex);
+        AcquireIO(oLock, iChunk, WRITE_QUEUED, m_nNextWrite);
+    }
+
+    // Must be called once the chunk is processed, including on early
+    // exits, for the next chunks to be able to go through the stages that
+    // it skipped.
+    void Finish(int iChunk)
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        if (m_iIOOwner == iChunk)
+            m_iIOOwner = -1;
+        m_anFlags[iChunk] = READ_QUEUED | WARP_DONE | WRITE_QUEUED;
+        AdvanceCounters();
+        m_oCV.notify_all();
+    }
+
+  private:
+    static constexpr int READ_QUEUED = 1;
+    static constexpr int WARP_DONE = 2;
+    static constexpr int WRITE_QUEUED = 4;
+
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+    std::vector<int> m_anFlags;
+    // Chunks waiting for the I/O stage
+    std::deque<int> m_anIOQueue{};
+    int m_iIOOwner = -1;
+    // First chunk that has not queued its read (resp. has not been warped,
+    // or has not queued its write)
+    int m_nNextRead = 0;
+    int m_nNextWarp = 0;
+    int m_nNextWrite = 0;
+
+    void AdvanceCounters()
+    {
+        const int nChunkCount = static_cast<int>(m_anFlags.size());
+        while (m_nNextRead < nChunkCount &&
+               (m_anFlags[m_nNextRead] & READ_QUEUED))
+            ++m_nNextRead;
+        while (m_nNextWarp < nChunkCount &&
+               (m_anFlags[m_nNextWarp] & WARP_DONE))
+            ++m_nNextWarp;
+        while (m_nNextWrite < nChunkCount &&
+               (m_anFlags[m_nNextWrite] & WRITE_QUEUED))
+            ++m_nNextWrite;
+    }
+
+    void AcquireIO(std::unique_lock<std::mutex> &oLock, int iChunk,
+                   int nQueuedFlag, const int &nNext)
+    {
+        m_oCV.wait(oLock, [iChunk, &nNext] { return nNext == iChunk; });
+        m_anFlags[iChunk] |= nQueuedFlag;
+        m_anIOQueue.push_back(iChunk);
+        AdvanceCounters();
+        m_oCV.notify_all();
+        m_oCV.wait(oLock,
+                   [this, iChunk]
+                   { return m_iIOOwner < 0 && m_anIOQueue.front() == iChunk; });
+        m_anIOQueue.pop_front();
+        m_iIOOwner = iChunk;
+    }
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALWarpChunkSequencer)
+};
+
 struct GDALWarpPrivateData
 {
     int nStepCount = 0;
     std::vector<int> abSuccess{};
     std::vector<double> adfDstX{};
     std::vector<double> adfDstY{};
+    std::unique_ptr<GDALWarpCutlineIndex> poCutlineIndex{};
+    // Only set during ChunkAndWarpMulti()
+    std::unique_ptr<GDALWarpChunkSequencer> poChunkSequencer{};
 };
 
 static std::mutex gMutex{};
@@ -194,10 +316,9 @@ GDALWarpOperation::~GDALWarpOperation()
     WipeOptions();
 
     if (hIOMutex != nullptr)
-    {
         CPLDestroyMutex(hIOMutex);
+    if (hWarpMutex != nullptr)
         CPLDestroyMutex(hWarpMutex);
-    }
 
     WipeChunkList();
     if (psThreadData)
@@ -582,6 +703,20 @@ CPLErr GDALWarpOperation::Initialize(const GDALWarpOptions *psNewOptions)
     if (pszBD)
         psOptions->dfCutlineBlendDist = CPLAtof(pszBD);
 
+    // Prepare the cutline for the classification and clipping of the chunks
+    GetWarpPrivateData(this)->poCutlineIndex.reset();
+    if (eErr == CE_None && psOptions->hCutline != nullptr)
+    {
+        const auto poCutline = static_cast<OGRGeometry *>(psOptions->hCutline);
+        const auto eCutlineType = wkbFlatten(poCutline->getGeometryType());
+        if (eCutlineType == wkbPolygon || eCutlineType == wkbMultiPolygon)
+        {
+            GetWarpPrivateData(this)->poCutlineIndex =
+                std::make_unique<GDALWarpCutlineIndex>(
+                    poCutline, psOptions->dfCutlineBlendDist);
+        }
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Set SRC_ALPHA_MAX if not provided.                              */
     /* -------------------------------------------------------------------- */
@@ -1011,60 +1146,38 @@ CPLErr GDALChunkAndWarpImage(GDALWarpOperationH hOperation, int nDstXOff,
 
 typedef struct
 {
-    GDALWarpOperation *poOperation;
-    GDALWarpChunk *pasChunkInfo;
-    CPLJoinableThread *hThreadHandle;
-    CPLErr eErr;
-    double dfProgressBase;
-    double dfProgressScale;
-    CPLMutex *hIOMutex;
-
-    CPLMutex *hCondMutex;
-    volatile int bIOMutexTaken;
-    CPLCond *hCond;
+    GDALWarpOperation *poOperation = nullptr;
+    GDALWarpChunk *pasChunkInfo = nullptr;
+    CPLJoinableThread *hThreadHandle = nullptr;
+    CPLErr eErr = CE_None;
+    double dfProgressBase = 0;
+    double dfProgressScale = 0;
+    int iChunk = 0;
+    GDALWarpChunkSequencer *poSequencer = nullptr;
 } ChunkThreadData;
 
 static void ChunkThreadMain(void *pThreadData)
 
 {
-    volatile ChunkThreadData *psData =
-        static_cast<volatile ChunkThreadData *>(pThreadData);
+    ChunkThreadData *psData = static_cast<ChunkThreadData *>(pThreadData);
 
     GDALWarpChunk *pasChunkInfo = psData->pasChunkInfo;
 
     /* -------------------------------------------------------------------- */
-    /*      Acquire IO mutex.                                               */
+    /*      Wait for our turn to read the source window. WarpRegion()       */
+    /*      then hands over to the warping stage, and back to the I/O       */
+    /*      stage to write the result.                                      */
     /* -------------------------------------------------------------------- */
-    if (!CPLAcquireMutex(psData->hIOMutex, 600.0))
-    {
-        CPLError(CE_Failure, CPLE_AppDefined,
-                 "Failed to acquire IOMutex in WarpRegion().");
-        psData->eErr = CE_Failure;
-    }
-    else
-    {
-        if (psData->hCond != nullptr)
-        {
-            CPLAcquireMutex(psData->hCondMutex, 1.0);
-            psData->bIOMutexTaken = TRUE;
-            CPLCondSignal(psData->hCond);
-            CPLReleaseMutex(psData->hCondMutex);
-        }
+    psData->poSequencer->EnterRead(psData->iChunk);
 
-        psData->eErr = psData->poOperation->WarpRegion(
-            pasChunkInfo->dx, pasChunkInfo->dy, pasChunkInfo->dsx,
-            pasChunkInfo->dsy, pasChunkInfo->sx, pasChunkInfo->sy,
-            pasChunkInfo->ssx, pasChunkInfo->ssy, pasChunkInfo->sExtraSx,
-            pasChunkInfo->sExtraSy, psData->dfProgressBase,
-            psData->dfProgressScale);
+    psData->eErr = psData->poOperation->WarpRegion(
+        pasChunkInfo->dx, pasChunkInfo->dy, pasChunkInfo->dsx,
+        pasChunkInfo->dsy, pasChunkInfo->sx, pasChunkInfo->sy,
+        pasChunkInfo->ssx, pasChunkInfo->ssy, pasChunkInfo->sExtraSx,
+        pasChunkInfo->sExtraSy, psData->dfProgressBase,
+        psData->dfProgressScale);
 
-        /* --------------------------------------------------------------------
-         */
-        /*      Release the IO mutex. */
-        /* --------------------------------------------------------------------
-         */
-        CPLReleaseMutex(psData->hIOMutex);
-    }
+    psData->poSequencer->Finish(psData->iChunk);
 }
 
 /************************************************************************/
@@ -1083,6 +1196,13 @@ static void ChunkThreadMain(void *pThreadData)
  * internally this method uses multiple threads to interleave input/output
  * for one region while the processing is being done for another.
  *
+ * By default, two chunks are in flight at the same time. Starting with
+ * GDAL 3.10, the CHUNK_PIPELINE_DEPTH warping option can be set to a larger
+ * value, so that source windows of the next chunks are read ahead while
+ * previous chunks are being processed or written. Memory usage is
+ * proportional to that depth. Whatever the depth, chunks are read, warped
+ * and written in order.
+ *
  * @param nDstXOff X offset to window of destination data to be produced.
  * @param nDstYOff Y offset to window of destination data to be produced.
  * @param nDstXSize Width of output window on destination file to be produced.
@@ -1095,41 +1215,56 @@ CPLErr GDALWarpOperation::ChunkAndWarpMulti(int nDstXOff, int nDstYOff,
                                             int nDstXSize, int nDstYSize)
 
 {
-    hIOMutex = CPLCreateMutex();
-    hWarpMutex = CPLCreateMutex();
-
-    CPLReleaseMutex(hIOMutex);
-    CPLReleaseMutex(hWarpMutex);
-
-    CPLCond *hCond = CPLCreateCond();
-    CPLMutex *hCondMutex = CPLCreateMutex();
-    CPLReleaseMutex(hCondMutex);
+    // Serializes the computation of source windows with the warping
+    // kernel, which share the transformer.
+    if (hWarpMutex == nullptr)
+    {
+        hWarpMutex = CPLCreateMutex();
+        CPLReleaseMutex(hWarpMutex);
+    }
 
     /* -------------------------------------------------------------------- */
     /*      Collect the list of chunks to operate on.                       */
     /* -------------------------------------------------------------------- */
     CollectChunkList(nDstXOff, nDstYOff, nDstXSize, nDstYSize);
 
+    GDALWarpPrivateData *psPrivate = GetWarpPrivateData(this);
+    psPrivate->poChunkSequencer =
+        std::make_unique<GDALWarpChunkSequencer>(nChunkListCount);
+
+    /* -------------------------------------------------------------------- */
+    /*      Determine how many chunks can be in flight at the same time.    */
+    /*      Reads and writes are serialized, as well as kernels, by the     */
+    /*      chunk sequencer, but a deeper pipeline lets reads of the        */
+    /*      next chunks proceed while previous ones are waiting for the     */
+    /*      kernel or being written, which hides the latency of slow        */
+    /*      (typically network) sources. Each chunk in flight holds its     */
+    /*      own buffers, so memory usage grows accordingly.                 */
+    /* -------------------------------------------------------------------- */
+    int nPipelineDepth = std::max(
+        1, atoi(CSLFetchNameValueDef(psOptions->papszWarpOptions,
+                                     "CHUNK_PIPELINE_DEPTH", "2")));
+    nPipelineDepth = std::min(nPipelineDepth, std::max(1, nChunkListCount));
+
     /* -------------------------------------------------------------------- */
     /*      Process them one at a time, updating the progress               */
     /*      information for each region.                                    */
     /* -------------------------------------------------------------------- */
-    ChunkThreadData volatile asThreadData[2] = {};
-    memset(reinterpret_cast<void *>(
-               const_cast<ChunkThreadData(*)[2]>(&asThreadData)),
-           0, sizeof(asThreadData));
-    asThreadData[0].poOperation = this;
-    asThreadData[0].hIOMutex = hIOMutex;
-    asThreadData[1].poOperation = this;
-    asThreadData[1].hIOMutex = hIOMutex;
+    std::vector<ChunkThreadData> asThreadData(nPipelineDepth);
+    for (auto &sThreadData : asThreadData)
+    {
+        sThreadData.poOperation = this;
+        sThreadData.poSequencer = psPrivate->poChunkSequencer.get();
+    }
 
     double dfPixelsProcessed = 0.0;
     double dfTotalPixels = static_cast<double>(nDstXSize) * nDstYSize;
 
     CPLErr eErr = CE_None;
-    for (int iChunk = 0; iChunk < nChunkListCount + 1; iChunk++)
+    for (int iChunk = 0; iChunk < nChunkListCount + nPipelineDepth - 1;
+         iChunk++)
     {
-        int iThread = iChunk % 2;
+        int iThread = iChunk % nPipelineDepth;
 
         /* --------------------------------------------------------------------
          */
@@ -1150,23 +1285,11 @@ CPLErr GDALWarpOperation::ChunkAndWarpMulti(int nDstXOff, int nDstYOff,
             dfPixelsProcessed += dfChunkPixels;
 
             asThreadData[iThread].pasChunkInfo = pasThisChunk;
-
-            if (iChunk == 0)
-            {
-                asThreadData[iThread].hCond = hCond;
-                asThreadData[iThread].hCondMutex = hCondMutex;
-            }
-            else
-            {
-                asThreadData[iThread].hCond = nullptr;
-                asThreadData[iThread].hCondMutex = nullptr;
-            }
-            asThreadData[iThread].bIOMutexTaken = FALSE;
+            asThreadData[iThread].iChunk = iChunk;
 
             CPLDebug("GDAL", "Start chunk %d / %d.", iChunk, nChunkListCount);
             asThreadData[iThread].hThreadHandle = CPLCreateJoinableThread(
-                ChunkThreadMain,
-                const_cast<ChunkThreadData *>(&asThreadData[iThread]));
+                ChunkThreadMain, &asThreadData[iThread]);
             if (asThreadData[iThread].hThreadHandle == nullptr)
             {
                 CPLError(
@@ -1175,33 +1298,24 @@ CPLErr GDALWarpOperation::ChunkAndWarpMulti(int nDstXOff, int nDstYOff,
                 eErr = CE_Failure;
                 break;
             }
-
-            // Wait that the first thread has acquired the IO mutex before
-            // proceeding.  This will ensure that the first thread will run
-            // before the second one.
-            if (iChunk == 0)
-            {
-                CPLAcquireMutex(hCondMutex, 1.0);
-                while (asThreadData[iThread].bIOMutexTaken == FALSE)
-                    CPLCondWait(hCond, hCondMutex);
-                CPLReleaseMutex(hCondMutex);
-            }
         }
 
         /* --------------------------------------------------------------------
          */
-        /*      Wait for previous chunks thread to complete. */
+        /*      Wait for the oldest chunk in flight to complete, once the */
+        /*      pipeline is full. */
         /* --------------------------------------------------------------------
          */
-        if (iChunk > 0)
+        const int iOldestChunk = iChunk - (nPipelineDepth - 1);
+        if (iOldestChunk >= 0)
         {
-            iThread = (iChunk - 1) % 2;
+            iThread = iOldestChunk % nPipelineDepth;
 
             // Wait for thread to finish.
             CPLJoinThread(asThreadData[iThread].hThreadHandle);
             asThreadData[iThread].hThreadHandle = nullptr;
 
-            CPLDebug("GDAL", "Finished chunk %d / %d.", iChunk - 1,
+            CPLDebug("GDAL", "Finished chunk %d / %d.", iOldestChunk,
                      nChunkListCount);
 
             eErr = asThreadData[iThread].eErr;
@@ -1214,14 +1328,13 @@ CPLErr GDALWarpOperation::ChunkAndWarpMulti(int nDstXOff, int nDstYOff,
     /* -------------------------------------------------------------------- */
     /*      Wait for all threads to complete.                               */
     /* -------------------------------------------------------------------- */
-    for (int iThread = 0; iThread < 2; iThread++)
+    for (auto &sThreadData : asThreadData)
     {
-        if (asThreadData[iThread].hThreadHandle)
-            CPLJoinThread(asThreadData[iThread].hThreadHandle);
+        if (sThreadData.hThreadHandle)
+            CPLJoinThread(sThreadData.hThreadHandle);
     }
 
-    CPLDestroyCond(hCond);
-    CPLDestroyMutex(hCondMutex);
+    psPrivate->poChunkSequencer.reset();
 
     WipeChunkList();
 
@@ -1591,6 +1704,7 @@ CPLErr GDALWarpOperation::WarpRegion(
     double dfSrcYExtraSize, double dfProgressBase, double dfProgressScale)
 
 {
+    CPL_TRACE_SCOPE_CAT("GDALWarpOperation::WarpRegion", "warp");
     ReportTiming(nullptr);
 
     /* -------------------------------------------------------------------- */
@@ -1829,6 +1943,23 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
         }
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Skip chunks whose source window is entirely outside of the      */
+    /*      cutline, as nothing from them would be warped.                  */
+    /* -------------------------------------------------------------------- */
+    const GDALWarpCutlineIndex *poCutlineIndex =
+        psOptions->hCutline ? GetWarpPrivateData(this)->poCutlineIndex.get()
+                            : nullptr;
+    if (poCutlineIndex && nSrcXSize > 0 && nSrcYSize > 0 &&
+        psOptions->pfnPreWarpChunkProcessor == nullptr &&
+        psOptions->pfnPostWarpChunkProcessor == nullptr &&
+        poCutlineIndex->Classify(nSrcXOff, nSrcYOff, nSrcXSize, nSrcYSize) ==
+            GCMVF_NO_INTERSECTION)
+    {
+        CPLDebug("WARP", "Source chunk entirely outside of cutline: skipped.");
+        return CE_None;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Prepare a WarpKernel object to match this operation.            */
     /* -------------------------------------------------------------------- */
@@ -2004,10 +2135,9 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
 
         int nValidityFlag = 0;
         if (eErr == CE_None)
-            eErr = GDALWarpCutlineMaskerEx(
-                psOptions, psOptions->nBandCount, psOptions->eWorkingDataType,
-                oWK.nSrcXOff, oWK.nSrcYOff, oWK.nSrcXSize, oWK.nSrcYSize,
-                oWK.papabySrcImage, TRUE, oWK.pafUnifiedSrcDensity,
+            eErr = GDALWarpCutlineMaskerWithIndex(
+                psOptions, poCutlineIndex, oWK.nSrcXOff, oWK.nSrcYOff,
+                oWK.nSrcXSize, oWK.nSrcYSize, TRUE, oWK.pafUnifiedSrcDensity,
                 &nValidityFlag);
         if (nValidityFlag == GCMVF_CHUNK_FULLY_WITHIN_CUTLINE &&
             bUnifiedSrcDensityJustCreated)
@@ -2238,11 +2368,16 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
     }
 
     /* -------------------------------------------------------------------- */
-    /*      Release IO Mutex, and acquire warper mutex.                     */
+    /*      Hand over from the I/O stage to the warping stage, when         */
+    /*      called from ChunkAndWarpMulti().                                */
     /* -------------------------------------------------------------------- */
-    if (hIOMutex != nullptr)
+    GDALWarpChunkSequencer *poSequencer =
+        GetWarpPrivateData(this)->poChunkSequencer.get();
+    int iSequencerChunk = -1;
+    if (poSequencer != nullptr)
     {
-        CPLReleaseMutex(hIOMutex);
+        iSequencerChunk = poSequencer->LeaveIO();
+        poSequencer->EnterWarp(iSequencerChunk);
         if (!CPLAcquireMutex(hWarpMutex, 600.0))
         {
             CPLError(CE_Failure, CPLE_AppDefined,
@@ -2263,6 +2398,7 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
     /* -------------------------------------------------------------------- */
     if (eErr == CE_None)
     {
+        CPL_TRACE_SCOPE_CAT("GDALWarpKernel::PerformWarp", "warp");
         eErr = oWK.PerformWarp();
         ReportTiming("In memory warp operation");
     }
@@ -2275,17 +2411,13 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
             &oWK, psOptions->pPostWarpProcessorArg);
 
     /* -------------------------------------------------------------------- */
-    /*      Release Warp Mutex, and acquire io mutex.                       */
+    /*      Hand over back to the I/O stage, to write the result.           */
     /* -------------------------------------------------------------------- */
-    if (hIOMutex != nullptr)
+    if (poSequencer != nullptr)
     {
         CPLReleaseMutex(hWarpMutex);
-        if (!CPLAcquireMutex(hIOMutex, 600.0))
-        {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Failed to acquire IOMutex in WarpRegion().");
-            return CE_Failure;
-        }
+        poSequencer->LeaveWarp(iSequencerChunk);
+        poSequencer->EnterWrite(iSequencerChunk);
     }
 
     /* -------------------------------------------------------------------- */
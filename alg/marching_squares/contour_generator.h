@@ -70,6 +70,20 @@ class ContourGenerator
         return CE_None;
     }
 
+    // Start the generation at line lineIdx instead of line 0, so that a
+    // range of lines can be processed independently of the lines before it.
+    // previousLine must contain the values of line lineIdx - 1, or be
+    // nullptr when starting at line 0.
+    void setStartLine(size_t lineIdx, const double *previousLine)
+    {
+        lineIdx_ = lineIdx;
+        if (previousLine)
+            std::copy(previousLine, previousLine + width_,
+                      previousLine_.begin());
+        else
+            std::fill(previousLine_.begin(), previousLine_.end(), NaN);
+    }
+
   private:
     size_t width_;
     size_t height_;
@@ -47,6 +47,7 @@
 #include "ogr_core.h"
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_multiproc.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
@@ -102,6 +103,16 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
     const int nConnectedness =
         CSLFetchNameValue(papszOptions, "8CONNECTED") ? 8 : 4;
 
+    int nThreads = 1;
+    const char *pszNumThreads =
+        CSLFetchNameValue(papszOptions, "NUM_THREADS");
+    if (pszNumThreads)
+    {
+        nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                    : atoi(pszNumThreads);
+        nThreads = std::max(1, std::min(nThreads, 1024));
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Confirm our output layer will support feature creation.         */
     /* -------------------------------------------------------------------- */
@@ -192,7 +203,31 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
 
     CPLErr eErr = CE_None;
 
-    for (int iY = 0; eErr == CE_None && iY < nYSize; iY++)
+    // In multi-threaded mode, the raster is enumerated as independent strips
+    // whose polygon ids are then unioned, and the second pass restarts the
+    // enumeration at the beginning of each strip to get the same ids. The
+    // strip height does not depend on the number of threads, so the output
+    // does not either.
+    GDALRasterStripLabels<DataType> oLabels;
+    oLabels.nStripHeight = nYSize;
+    if (nThreads > 1)
+        oLabels.nStripHeight =
+            GDALGetLabelStripHeight(nXSize, nYSize, sizeof(DataType));
+    const int nStripHeight = oLabels.nStripHeight;
+    const std::vector<GInt32> &anPolyIdMap = oLabels.anPolyIdMap;
+    const std::vector<GInt32> &anStripIdOffset = oLabels.anStripIdOffset;
+    if (nStripHeight < nYSize)
+    {
+        void *pScaledProgress =
+            GDALCreateScaledProgress(0.0, 0.10, pfnProgress, pProgressArg);
+        eErr = GDALLabelRasterStrips<DataType, EqualityTest>(
+            hSrcBand, hMaskBand, eDT, nConnectedness, nThreads, 0, oLabels,
+            GDALScaledProgress, pScaledProgress);
+        GDALDestroyScaledProgress(pScaledProgress);
+    }
+
+    for (int iY = 0; eErr == CE_None && nStripHeight == nYSize && iY < nYSize;
+         iY++)
     {
         eErr = GDALRasterIO(hSrcBand, GF_Read, 0, iY, nXSize, 1, panThisLineVal,
                             nXSize, 1, eDT, 0, 0);
@@ -240,8 +275,13 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
     /*      points to the final id it should use, not an intermediate       */
     /*      value.                                                          */
     /* -------------------------------------------------------------------- */
-    if (eErr == CE_None)
+    const GInt32 *panPolyIdMap = anPolyIdMap.data();
+    GInt32 nStripIdOffset = 0;
+    if (eErr == CE_None && nStripHeight == nYSize)
+    {
         oFirstEnum.CompleteMerges();
+        panPolyIdMap = oFirstEnum.panPolyIdMap;
+    }
 
     /* -------------------------------------------------------------------- */
     /*      We will use a new enumerator for the second pass primarily      */
@@ -305,8 +345,13 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
                 panThisLineId[iX] =
                     decltype(oPolygonizer)::THE_OUTER_POLYGON_ID;
         }
-        else if (iY == 0)
+        else if ((iY % nStripHeight) == 0)
         {
+            if (iY > 0)
+            {
+                oSecondEnum.Clear();
+                nStripIdOffset = anStripIdOffset[iY / nStripHeight];
+            }
             eErr = oSecondEnum.ProcessLine(nullptr, panThisLineVal, nullptr,
                                            panThisLineId, nXSize)
                        ? CE_None
@@ -333,7 +378,7 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
                 panLastLineId[iX] =
                     panThisLineId[iX] == -1
                         ? -1
-                        : oFirstEnum.panPolyIdMap[panThisLineId[iX]];
+                        : panPolyIdMap[nStripIdOffset + panThisLineId[iX]];
             }
 
             oPolygonizer.processLine(panLastLineId, panLastLineVal,
@@ -491,6 +536,10 @@ GBool GDALFloatEquals(float A, float B)
  * <li>DATASET_FOR_GEOREF=dataset_name: Name of a dataset from which to read
  * the geotransform. This useful if hSrcBand has no related dataset, which is
  * typical for mask bands.</li>
+ * <li>NUM_THREADS=number_of_threads|ALL_CPUS: (GDAL >= 3.10) Number of
+ * threads used to enumerate the connected regions of the raster, which is
+ * then processed as independent strips whose regions are unioned at the
+ * strip boundaries. Defaults to 1.</li>
  * </ul>
  * @param pfnProgress callback for reporting algorithm progress matching the
  * GDALProgressFunc() semantics.  May be NULL.
@@ -565,6 +614,10 @@ CPLErr CPL_STDCALL GDALPolygonize(GDALRasterBandH hSrcBand,
  * <li>DATASET_FOR_GEOREF=dataset_name: Name of a dataset from which to read
  * the geotransform. This useful if hSrcBand has no related dataset, which is
  * typical for mask bands.</li>
+ * <li>NUM_THREADS=number_of_threads|ALL_CPUS: (GDAL >= 3.10) Number of
+ * threads used to enumerate the connected regions of the raster, which is
+ * then processed as independent strips whose regions are unioned at the
+ * strip boundaries. Defaults to 1.</li>
  * </ul>
  * @param pfnProgress callback for reporting algorithm progress matching the
  * GDALProgressFunc() semantics.  May be NULL.
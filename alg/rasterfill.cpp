@@ -37,14 +37,17 @@
 #include <algorithm>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 /************************************************************************/
 /*                           GDALFilterLine()                           */
@@ -332,6 +335,256 @@ static CPLErr GDALMultiFilter(GDALRasterBandH hTargetBand,
     return eErr;
 }
 
+/************************************************************************/
+/*                        GDALMultiFilterStripJob                       */
+/************************************************************************/
+
+namespace
+{
+struct GDALMultiFilterStripJob
+{
+    int nXSize = 0;
+    int nYSize = 0;
+    int nIterations = 0;
+    // Lines [iWinStart, iWinEnd[ of the input values and masks
+    int iWinStart = 0;
+    int iWinEnd = 0;
+    const float *pafValues = nullptr;
+    const GByte *pabyTMask = nullptr;
+    const GByte *pabyFMask = nullptr;
+    // Lines [iStripStart, iStripEnd[ of the output
+    int iStripStart = 0;
+    int iStripEnd = 0;
+    float *pafOut = nullptr;
+    bool bError = false;
+};
+}  // namespace
+
+/************************************************************************/
+/*                        GDALMultiFilterStrip()                        */
+/*                                                                      */
+/*      Apply the iterations of the filter on a window of lines. Only   */
+/*      the lines that are at least nIterations lines away from a       */
+/*      window edge that is not an edge of the raster get the same      */
+/*      values as with a filtering of the whole raster.                 */
+/************************************************************************/
+
+static void GDALMultiFilterStrip(void *pData)
+{
+    auto psJob = static_cast<GDALMultiFilterStripJob *>(pData);
+    const int nXSize = psJob->nXSize;
+    const int nWinLines = psJob->iWinEnd - psJob->iWinStart;
+    const size_t nWinSize = static_cast<size_t>(nXSize) * nWinLines;
+
+    std::vector<float> afCur;
+    std::vector<float> afNext;
+    try
+    {
+        afCur.assign(psJob->pafValues, psJob->pafValues + nWinSize);
+        afNext.resize(nWinSize);
+    }
+    catch (const std::exception &)
+    {
+        psJob->bError = true;
+        return;
+    }
+
+    for (int iIter = 0; iIter < psJob->nIterations; ++iIter)
+    {
+        for (int iLine = 0; iLine < nWinLines; ++iLine)
+        {
+            const int iY = psJob->iWinStart + iLine;
+            const size_t nOffset = static_cast<size_t>(iLine) * nXSize;
+            // The first and last lines of the raster are not filtered
+            // (see GDALMultiFilter()), and the edges of the window cannot
+            // be.
+            if (iY < 1 || iY >= psJob->nYSize - 1 || iLine == 0 ||
+                iLine == nWinLines - 1)
+            {
+                memcpy(afNext.data() + nOffset, afCur.data() + nOffset,
+                       sizeof(float) * nXSize);
+                continue;
+            }
+            GDALFilterLine(afCur.data() + nOffset - nXSize,
+                           afCur.data() + nOffset,
+                           afCur.data() + nOffset + nXSize,
+                           afNext.data() + nOffset,
+                           psJob->pabyTMask + nOffset - nXSize,
+                           psJob->pabyTMask + nOffset,
+                           psJob->pabyTMask + nOffset + nXSize,
+                           psJob->pabyFMask + nOffset, nXSize);
+        }
+        std::swap(afCur, afNext);
+    }
+
+    const size_t nSkip =
+        static_cast<size_t>(psJob->iStripStart - psJob->iWinStart) * nXSize;
+    std::copy(afCur.begin() + nSkip,
+              afCur.begin() + nSkip +
+                  static_cast<size_t>(psJob->iStripEnd - psJob->iStripStart) *
+                      nXSize,
+              psJob->pafOut);
+}
+
+/************************************************************************/
+/*                         GDALMultiFilterMT()                          */
+/*                                                                      */
+/*      Multi-threaded equivalent of GDALMultiFilter(). Each line       */
+/*      filtered in the rolling buffer of GDALMultiFilter() gets its    */
+/*      k-th iteration from the (k-1)-th iteration of itself and of    */
+/*      its two neighbours, so nIterations filter passes over strips    */
+/*      of lines extended by halos of nIterations lines give the same   */
+/*      result. Strips are filtered in batches of nThreads, and the     */
+/*      source lines of the halo above a batch, that have already      */
+/*      been overwritten, are kept from the previous batch.             */
+/************************************************************************/
+
+static CPLErr GDALMultiFilterMT(GDALRasterBandH hTargetBand,
+                                GDALRasterBandH hTargetMaskBand,
+                                GDALRasterBandH hFiltMaskBand, int nIterations,
+                                int nThreads, GDALProgressFunc pfnProgress,
+                                void *pProgressArg)
+{
+    const int nXSize = GDALGetRasterBandXSize(hTargetBand);
+    const int nYSize = GDALGetRasterBandYSize(hTargetBand);
+
+    if (!pfnProgress(0.0, "Smoothing Filter...", pProgressArg))
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        return CE_Failure;
+    }
+
+    // Strips of ~ 4 MB of float values, but not smaller than the halos.
+    const int nStripLines = std::max(
+        nIterations, static_cast<int>(std::max<GIntBig>(
+                         16, std::min<GIntBig>(1024, 1024 * 1024 / nXSize))));
+    const int nBatchLines = nStripLines * nThreads;
+    const int nMaxWinLines = std::min(nYSize, nBatchLines + 2 * nIterations);
+    const size_t nMaxWinSize = static_cast<size_t>(nXSize) * nMaxWinLines;
+
+    std::vector<float> afValues;
+    std::vector<GByte> abyTMask;
+    std::vector<GByte> abyFMask;
+    std::vector<float> afOut;
+    try
+    {
+        afValues.resize(nMaxWinSize);
+        abyTMask.resize(nMaxWinSize);
+        abyFMask.resize(nMaxWinSize);
+        afOut.resize(static_cast<size_t>(nXSize) *
+                     std::min(nYSize, nBatchLines));
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate smoothing filter working buffers");
+        return CE_Failure;
+    }
+
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+
+    CPLErr eErr = CE_None;
+    // Lines [iKeptStart, iBatchStart[ of the window are kept in the first
+    // lines of the buffers from the previous batch.
+    int iKeptStart = 0;
+    for (int iBatchStart = 0; eErr == CE_None && iBatchStart < nYSize;
+         iBatchStart += nBatchLines)
+    {
+        const int iBatchEnd = std::min(nYSize, iBatchStart + nBatchLines);
+        const int iWinStart = std::max(0, iBatchStart - nIterations);
+        const int iWinEnd = std::min(nYSize, iBatchEnd + nIterations);
+        CPLAssert(iKeptStart == iWinStart);
+
+        // Read the lines that have not been overwritten yet.
+        const size_t nKeptSize =
+            static_cast<size_t>(iBatchStart - iWinStart) * nXSize;
+        const int nReadLines = iWinEnd - iBatchStart;
+        eErr = GDALRasterIO(hTargetBand, GF_Read, 0, iBatchStart, nXSize,
+                            nReadLines, afValues.data() + nKeptSize, nXSize,
+                            nReadLines, GDT_Float32, 0, 0);
+        if (eErr == CE_None)
+            eErr = GDALRasterIO(hTargetMaskBand, GF_Read, 0, iBatchStart,
+                                nXSize, nReadLines, abyTMask.data() + nKeptSize,
+                                nXSize, nReadLines, GDT_Byte, 0, 0);
+        if (eErr == CE_None)
+            eErr = GDALRasterIO(hFiltMaskBand, GF_Read, 0, iBatchStart, nXSize,
+                                nReadLines, abyFMask.data() + nKeptSize,
+                                nXSize, nReadLines, GDT_Byte, 0, 0);
+        if (eErr != CE_None)
+            break;
+
+        std::vector<GDALMultiFilterStripJob> asJobs;
+        for (int iStripStart = iBatchStart; iStripStart < iBatchEnd;
+             iStripStart += nStripLines)
+        {
+            GDALMultiFilterStripJob sJob;
+            sJob.nXSize = nXSize;
+            sJob.nYSize = nYSize;
+            sJob.nIterations = nIterations;
+            sJob.iStripStart = iStripStart;
+            sJob.iStripEnd = std::min(iBatchEnd, iStripStart + nStripLines);
+            sJob.iWinStart = std::max(0, iStripStart - nIterations);
+            sJob.iWinEnd = std::min(nYSize, sJob.iStripEnd + nIterations);
+            const size_t nOffset =
+                static_cast<size_t>(sJob.iWinStart - iWinStart) * nXSize;
+            sJob.pafValues = afValues.data() + nOffset;
+            sJob.pabyTMask = abyTMask.data() + nOffset;
+            sJob.pabyFMask = abyFMask.data() + nOffset;
+            sJob.pafOut = afOut.data() +
+                          static_cast<size_t>(iStripStart - iBatchStart) *
+                              nXSize;
+            asJobs.push_back(sJob);
+        }
+        for (auto &sJob : asJobs)
+        {
+            if (!poJobQueue ||
+                !poJobQueue->SubmitJob(GDALMultiFilterStrip, &sJob))
+            {
+                GDALMultiFilterStrip(&sJob);
+            }
+        }
+        if (poJobQueue)
+            poJobQueue->WaitCompletion();
+        for (const auto &sJob : asJobs)
+        {
+            if (sJob.bError)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Cannot allocate smoothing filter working buffers");
+                eErr = CE_Failure;
+            }
+        }
+        if (eErr != CE_None)
+            break;
+
+        eErr = GDALRasterIO(hTargetBand, GF_Write, 0, iBatchStart, nXSize,
+                            iBatchEnd - iBatchStart, afOut.data(), nXSize,
+                            iBatchEnd - iBatchStart, GDT_Float32, 0, 0);
+
+        // Keep the source lines of the halo of the next batch.
+        iKeptStart = std::max(0, iBatchEnd - nIterations);
+        const size_t nSrcOffset =
+            static_cast<size_t>(iKeptStart - iWinStart) * nXSize;
+        const size_t nKeptNextSize =
+            static_cast<size_t>(iBatchEnd - iKeptStart) * nXSize;
+        memmove(afValues.data(), afValues.data() + nSrcOffset,
+                nKeptNextSize * sizeof(float));
+        memmove(abyTMask.data(), abyTMask.data() + nSrcOffset, nKeptNextSize);
+        memmove(abyFMask.data(), abyFMask.data() + nSrcOffset, nKeptNextSize);
+
+        if (eErr == CE_None &&
+            !pfnProgress(iBatchEnd / static_cast<double>(nYSize),
+                         "Smoothing Filter...", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+    }
+
+    return eErr;
+}
+
 /************************************************************************/
 /*                             QUAD_CHECK()                             */
 /*                                                                      */
@@ -360,6 +613,408 @@ inline void QUAD_CHECK(double &dfQuadDist, float &fQuadValue, int target_x,
     }
 }
 
+/************************************************************************/
+/*                      GDALFillNodataSearchParams                      */
+/************************************************************************/
+
+namespace
+{
+struct GDALFillNodataSearchParams
+{
+    int nXSize = 0;
+    double dfMaxSearchDist = 0;
+    int nMaxSearchDist = 0;
+    bool bNearest = false;
+    bool bHasNoData = false;
+    float fNoData = 0;
+    GUInt32 nNoDataVal = 0;
+};
+}  // namespace
+
+/************************************************************************/
+/*                      GDALFillNodataSearchLine()                      */
+/*                                                                      */
+/*      Interpolate the pixels of line iY that are nodata, from the     */
+/*      "last known value" information of the top down pass for this   */
+/*      line (panTopDownY, pafTopDownValue) and of the bottom up pass   */
+/*      for the line below (panBelowY, pafBelowValue).                  */
+/************************************************************************/
+
+static void
+GDALFillNodataSearchLine(const GDALFillNodataSearchParams &sParams, int iY,
+                         const GUInt32 *panTopDownY,
+                         const float *pafTopDownValue, const GUInt32 *panBelowY,
+                         const float *pafBelowValue, GByte *pabyMask,
+                         float *pafScanline, GByte *pabyFiltMask)
+{
+    const int nXSize = sParams.nXSize;
+    const double dfMaxSearchDist = sParams.dfMaxSearchDist;
+    const GUInt32 nNoDataVal = sParams.nNoDataVal;
+    const bool bHasNoData = sParams.bHasNoData;
+    const float fNoData = sParams.fNoData;
+
+    memset(pabyFiltMask, 0, nXSize);
+    for (int iX = 0; iX < nXSize; iX++)
+    {
+        int nThisMaxSearchDist = sParams.nMaxSearchDist;
+
+        // If this was a valid target - no change.
+        if (pabyMask[iX])
+            continue;
+
+        enum Quadrants
+        {
+            QUAD_TOP_LEFT = 0,
+            QUAD_BOTTOM_LEFT = 1,
+            QUAD_TOP_RIGHT = 2,
+            QUAD_BOTTOM_RIGHT = 3,
+        };
+
+        constexpr int QUAD_COUNT = 4;
+        double adfQuadDist[QUAD_COUNT] = {};
+        float afQuadValue[QUAD_COUNT] = {};
+
+        for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
+        {
+            adfQuadDist[iQuad] = dfMaxSearchDist + 1.0;
+            afQuadValue[iQuad] = 0.0;
+        }
+
+        // Step left and right by one pixel searching for the closest
+        // target value for each quadrant.
+        for (int iStep = 0; iStep <= nThisMaxSearchDist; iStep++)
+        {
+            const int iLeftX = std::max(0, iX - iStep);
+            const int iRightX = std::min(nXSize - 1, iX + iStep);
+
+            // Top left includes current line.
+            QUAD_CHECK(adfQuadDist[QUAD_TOP_LEFT], afQuadValue[QUAD_TOP_LEFT],
+                       iLeftX, panTopDownY[iLeftX], iX, iY,
+                       pafTopDownValue[iLeftX], nNoDataVal);
+
+            // Bottom left.
+            QUAD_CHECK(adfQuadDist[QUAD_BOTTOM_LEFT],
+                       afQuadValue[QUAD_BOTTOM_LEFT], iLeftX,
+                       panBelowY[iLeftX], iX, iY, pafBelowValue[iLeftX],
+                       nNoDataVal);
+
+            // Top right and bottom right do no include center pixel.
+            if (iStep == 0)
+                continue;
+
+            // Top right includes current line.
+            QUAD_CHECK(adfQuadDist[QUAD_TOP_RIGHT], afQuadValue[QUAD_TOP_RIGHT],
+                       iRightX, panTopDownY[iRightX], iX, iY,
+                       pafTopDownValue[iRightX], nNoDataVal);
+
+            // Bottom right.
+            QUAD_CHECK(adfQuadDist[QUAD_BOTTOM_RIGHT],
+                       afQuadValue[QUAD_BOTTOM_RIGHT], iRightX,
+                       panBelowY[iRightX], iX, iY, pafBelowValue[iRightX],
+                       nNoDataVal);
+
+            // Every four steps, recompute maximum distance.
+            if ((iStep & 0x3) == 0)
+                nThisMaxSearchDist = static_cast<int>(floor(
+                    std::max(std::max(adfQuadDist[0], adfQuadDist[1]),
+                             std::max(adfQuadDist[2], adfQuadDist[3]))));
+        }
+
+        bool bHasSrcValues = false;
+        if (sParams.bNearest)
+        {
+            double dfNearestDist = dfMaxSearchDist + 1;
+            float fNearestValue = 0.0f;
+
+            for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
+            {
+                if (adfQuadDist[iQuad] < dfNearestDist)
+                {
+                    bHasSrcValues = true;
+                    if (!bHasNoData || afQuadValue[iQuad] != fNoData)
+                    {
+                        fNearestValue = afQuadValue[iQuad];
+                        dfNearestDist = adfQuadDist[iQuad];
+                    }
+                }
+            }
+
+            if (bHasSrcValues)
+            {
+                pabyFiltMask[iX] = 255;
+                if (dfNearestDist <= dfMaxSearchDist)
+                {
+                    pabyMask[iX] = 255;
+                    pafScanline[iX] = fNearestValue;
+                }
+                else
+                    pafScanline[iX] = fNoData;
+            }
+        }
+        else
+        {
+            double dfWeightSum = 0.0;
+            double dfValueSum = 0.0;
+
+            for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
+            {
+                if (adfQuadDist[iQuad] <= dfMaxSearchDist)
+                {
+                    bHasSrcValues = true;
+                    if (!bHasNoData || afQuadValue[iQuad] != fNoData)
+                    {
+                        const double dfWeight = 1.0 / adfQuadDist[iQuad];
+                        dfWeightSum += dfWeight;
+                        dfValueSum += afQuadValue[iQuad] * dfWeight;
+                    }
+                }
+            }
+
+            if (bHasSrcValues)
+            {
+                pabyFiltMask[iX] = 255;
+                if (dfWeightSum > 0.0)
+                {
+                    pabyMask[iX] = 255;
+                    pafScanline[iX] =
+                        static_cast<float>(dfValueSum / dfWeightSum);
+                }
+                else
+                    pafScanline[iX] = fNoData;
+            }
+        }
+    }
+}
+
+/************************************************************************/
+/*                       GDALFillNodataLinesJob                         */
+/************************************************************************/
+
+namespace
+{
+struct GDALFillNodataLinesJob
+{
+    const GDALFillNodataSearchParams *psParams = nullptr;
+    // Line of the first row of the buffers
+    int iYStart = 0;
+    int nRows = 0;
+    const GUInt32 *panTopDownY = nullptr;
+    const float *pafTopDownValue = nullptr;
+    const GUInt32 *panBelowY = nullptr;
+    const float *pafBelowValue = nullptr;
+    GByte *pabyMask = nullptr;
+    float *pafScanline = nullptr;
+    GByte *pabyFiltMask = nullptr;
+};
+}  // namespace
+
+/************************************************************************/
+/*                      GDALFillNodataProcessLines()                    */
+/************************************************************************/
+
+static void GDALFillNodataProcessLines(void *pData)
+{
+    const auto psJob = static_cast<const GDALFillNodataLinesJob *>(pData);
+    const int nXSize = psJob->psParams->nXSize;
+    for (int iRow = 0; iRow < psJob->nRows; ++iRow)
+    {
+        const size_t nOffset = static_cast<size_t>(iRow) * nXSize;
+        GDALFillNodataSearchLine(
+            *(psJob->psParams), psJob->iYStart + iRow,
+            psJob->panTopDownY + nOffset, psJob->pafTopDownValue + nOffset,
+            psJob->panBelowY + nOffset, psJob->pafBelowValue + nOffset,
+            psJob->pabyMask + nOffset, psJob->pafScanline + nOffset,
+            psJob->pabyFiltMask + nOffset);
+    }
+}
+
+/************************************************************************/
+/*                       GDALFillNodataBottomUp()                       */
+/*                                                                      */
+/*      Collect the "last known value" information from bottom to      */
+/*      top and use it, in combination with the top to bottom search   */
+/*      info saved in hYBand and hValBand, to interpolate.  Lines are   */
+/*      processed by batches: the bottom to top information, which     */
+/*      is cheap to get, is computed sequentially, and the              */
+/*      interpolation of the lines of a batch is dispatched to worker  */
+/*      threads.                                                        */
+/************************************************************************/
+
+static CPLErr GDALFillNodataBottomUp(
+    GDALRasterBandH hTargetBand, GDALRasterBandH hMaskBand, bool bUpdateMask,
+    GDALRasterBandH hYBand, GDALRasterBandH hValBand,
+    GDALRasterBandH hFiltMaskBand, const GDALFillNodataSearchParams &sParams,
+    int nThreads, double dfProgressRatio, GDALProgressFunc pfnProgress,
+    void *pProgressArg)
+{
+    const int nXSize = sParams.nXSize;
+    const int nYSize = GDALGetRasterBandYSize(hTargetBand);
+    const GUInt32 nNoDataVal = sParams.nNoDataVal;
+
+    // Bound the memory used by a batch: 22 bytes per pixel.
+    const int nRowsPerJob = static_cast<int>(std::max<GIntBig>(
+        1, std::min<GIntBig>(64, 4 * 1024 * 1024 / (22 * GIntBig(nXSize)))));
+    const int nBatchRows = std::min(nYSize, nRowsPerJob * nThreads);
+    const size_t nBatchSize = static_cast<size_t>(nXSize) * nBatchRows;
+
+    std::vector<GByte> abyMask;
+    std::vector<float> afScanline;
+    std::vector<GUInt32> anTopDownY;
+    std::vector<float> afTopDownValue;
+    std::vector<GUInt32> anBelowY;
+    std::vector<float> afBelowValue;
+    std::vector<GByte> abyFiltMask;
+    std::vector<GUInt32> anLastY;
+    std::vector<float> afLastValue;
+    try
+    {
+        abyMask.resize(nBatchSize);
+        afScanline.resize(nBatchSize);
+        anTopDownY.resize(nBatchSize);
+        afTopDownValue.resize(nBatchSize);
+        anBelowY.resize(nBatchSize);
+        afBelowValue.resize(nBatchSize);
+        abyFiltMask.resize(nBatchSize);
+        anLastY.resize(nXSize, nNoDataVal);
+        afLastValue.resize(nXSize);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate fill nodata working buffers");
+        return CE_Failure;
+    }
+
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+
+    CPLErr eErr = CE_None;
+    for (int iBatchEnd = nYSize; eErr == CE_None && iBatchEnd > 0;
+         iBatchEnd -= nBatchRows)
+    {
+        const int iBatchStart = std::max(0, iBatchEnd - nBatchRows);
+        const int nRows = iBatchEnd - iBatchStart;
+
+        eErr = GDALRasterIO(hMaskBand, GF_Read, 0, iBatchStart, nXSize, nRows,
+                            abyMask.data(), nXSize, nRows, GDT_Byte, 0, 0);
+        if (eErr == CE_None)
+            eErr = GDALRasterIO(hTargetBand, GF_Read, 0, iBatchStart, nXSize,
+                                nRows, afScanline.data(), nXSize, nRows,
+                                GDT_Float32, 0, 0);
+        if (eErr == CE_None)
+            eErr = GDALRasterIO(hYBand, GF_Read, 0, iBatchStart, nXSize, nRows,
+                                anTopDownY.data(), nXSize, nRows, GDT_UInt32,
+                                0, 0);
+        if (eErr == CE_None)
+            eErr = GDALRasterIO(hValBand, GF_Read, 0, iBatchStart, nXSize,
+                                nRows, afTopDownValue.data(), nXSize, nRows,
+                                GDT_Float32, 0, 0);
+        if (eErr != CE_None)
+            break;
+
+        /* --------------------------------------------------------------------
+         */
+        /*      Figure out the most recent pixel for each column, saving */
+        /*      the one of the line below for each line. */
+        /* --------------------------------------------------------------------
+         */
+        for (int iRow = nRows - 1; iRow >= 0; --iRow)
+        {
+            const int iY = iBatchStart + iRow;
+            const size_t nOffset = static_cast<size_t>(iRow) * nXSize;
+            std::copy(anLastY.begin(), anLastY.end(),
+                      anBelowY.begin() + nOffset);
+            std::copy(afLastValue.begin(), afLastValue.end(),
+                      afBelowValue.begin() + nOffset);
+
+            for (int iX = 0; iX < nXSize; iX++)
+            {
+                if (abyMask[nOffset + iX])
+                {
+                    afLastValue[iX] = afScanline[nOffset + iX];
+                    anLastY[iX] = iY;
+                }
+                else if (!(anLastY[iX] - iY <= sParams.dfMaxSearchDist))
+                {
+                    anLastY[iX] = nNoDataVal;
+                }
+            }
+        }
+
+        /* --------------------------------------------------------------------
+         */
+        /*      Attempt to interpolate any pixels that are nodata. */
+        /* --------------------------------------------------------------------
+         */
+        const int nJobs = (nRows + nRowsPerJob - 1) / nRowsPerJob;
+        std::vector<GDALFillNodataLinesJob> asJobs(nJobs);
+        for (int iJob = 0; iJob < nJobs; ++iJob)
+        {
+            auto &sJob = asJobs[iJob];
+            const int iRow = iJob * nRowsPerJob;
+            const size_t nOffset = static_cast<size_t>(iRow) * nXSize;
+            sJob.psParams = &sParams;
+            sJob.iYStart = iBatchStart + iRow;
+            sJob.nRows = std::min(nRowsPerJob, nRows - iRow);
+            sJob.panTopDownY = anTopDownY.data() + nOffset;
+            sJob.pafTopDownValue = afTopDownValue.data() + nOffset;
+            sJob.panBelowY = anBelowY.data() + nOffset;
+            sJob.pafBelowValue = afBelowValue.data() + nOffset;
+            sJob.pabyMask = abyMask.data() + nOffset;
+            sJob.pafScanline = afScanline.data() + nOffset;
+            sJob.pabyFiltMask = abyFiltMask.data() + nOffset;
+            if (!poJobQueue ||
+                !poJobQueue->SubmitJob(GDALFillNodataProcessLines, &sJob))
+            {
+                GDALFillNodataProcessLines(&sJob);
+            }
+        }
+        if (poJobQueue)
+            poJobQueue->WaitCompletion();
+
+        /* --------------------------------------------------------------------
+         */
+        /*      Write out the updated data and mask information. */
+        /* --------------------------------------------------------------------
+         */
+        eErr = GDALRasterIO(hTargetBand, GF_Write, 0, iBatchStart, nXSize,
+                            nRows, afScanline.data(), nXSize, nRows,
+                            GDT_Float32, 0, 0);
+
+        if (eErr == CE_None && bUpdateMask)
+        {
+            // Update (copy of) mask band when it has been provided by the
+            // user
+            eErr = GDALRasterIO(hMaskBand, GF_Write, 0, iBatchStart, nXSize,
+                                nRows, abyMask.data(), nXSize, nRows, GDT_Byte,
+                                0, 0);
+        }
+
+        if (eErr == CE_None)
+            eErr = GDALRasterIO(hFiltMaskBand, GF_Write, 0, iBatchStart,
+                                nXSize, nRows, abyFiltMask.data(), nXSize,
+                                nRows, GDT_Byte, 0, 0);
+
+        /* --------------------------------------------------------------------
+         */
+        /*      report progress. */
+        /* --------------------------------------------------------------------
+         */
+        if (eErr == CE_None &&
+            !pfnProgress(dfProgressRatio *
+                             (0.5 + 0.5 * (nYSize - iBatchStart) /
+                                        static_cast<double>(nYSize)),
+                         "Filling...", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+    }
+
+    return eErr;
+}
+
 /************************************************************************/
 /*                           GDALFillNodata()                           */
 /************************************************************************/
@@ -393,13 +1048,19 @@ inline void QUAD_CHECK(double &dfQuadDist, float &fQuadValue, int target_x,
  * run (0 or more).
  * @param papszOptions additional name=value options in a string list.
  * <ul>
- * <li>TEMP_FILE_DRIVER=gdal_driver_name. For example MEM.</li>
+ * <li>TEMP_FILE_DRIVER=gdal_driver_name. For example MEM. Starting with
+ * GDAL 3.10, the default is MEM when the work files fit in the block cache
+ * (see GDALGetCacheMax64()), and GTiff otherwise.</li>
  * <li>NODATA=value (starting with GDAL 2.4).
  * Source pixels at that value will be ignored by the interpolator. Warning:
  * currently this will not be honored by smoothing passes.</li>
  * <li>INTERPOLATION=INV_DIST/NEAREST (GDAL >= 3.9). By default, pixels are
  * interpolated using an inverse distance weighting (INV_DIST). It is also
  * possible to choose a nearest neighbour (NEAREST) strategy.</li>
+ * <li>NUM_THREADS=number_of_threads or ALL_CPUS (GDAL >= 3.10). Number of
+ * threads used to interpolate lines and to apply the smoothing filter, by
+ * strips of lines. Defaults to 1. The memory used does not depend on the
+ * size of the raster.</li>
  * </ul>
  * @param pfnProgress the progress function to report completion.
  * @param pProgressArg callback data for progress function.
@@ -447,11 +1108,43 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
         nNoDataVal = 4000002;
     }
 
+    int nThreads = 1;
+    const char *pszNumThreads = CSLFetchNameValue(papszOptions, "NUM_THREADS");
+    if (pszNumThreads)
+    {
+        nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                    : atoi(pszNumThreads);
+        nThreads = std::max(1, std::min(nThreads, 1024));
+    }
+
     /* -------------------------------------------------------------------- */
-    /*      Determine format driver for temp work files.                    */
+    /*      Determine format driver for temp work files.  By default, use   */
+    /*      in-memory work files when they fit in the block cache, where    */
+    /*      GTiff work files would end up anyway.                           */
     /* -------------------------------------------------------------------- */
-    CPLString osTmpFileDriver =
-        CSLFetchNameValueDef(papszOptions, "TEMP_FILE_DRIVER", "GTiff");
+    CPLString osTmpFileDriver;
+    if (const char *pszTmpFileDriver =
+            CSLFetchNameValue(papszOptions, "TEMP_FILE_DRIVER"))
+    {
+        osTmpFileDriver = pszTmpFileDriver;
+    }
+    else
+    {
+        const bool bMaskCopy =
+            hMaskBand != nullptr && nSmoothingIterations > 0 &&
+            hMaskBand != GDALGetMaskBand(hTargetBand);
+        const GIntBig nWorkFilesSize =
+            static_cast<GIntBig>(nXSize) * nYSize *
+            (GDALGetDataTypeSizeBytes(eType) +
+             GDALGetDataTypeSizeBytes(GDALGetRasterDataType(hTargetBand)) +
+             (bMaskCopy ? 2 : 1));
+        osTmpFileDriver = nWorkFilesSize <= GDALGetCacheMax64() &&
+                                  GDALGetDriverByName("MEM") != nullptr
+                              ? "MEM"
+                              : "GTiff";
+        CPLDebug("GDAL", "GDALFillNodata(): using %s work files",
+                 osTmpFileDriver.c_str());
+    }
     GDALDriverH hDriver = GDALGetDriverByName(osTmpFileDriver.c_str());
 
     if (hDriver == nullptr)
@@ -610,25 +1303,19 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
         static_cast<GUInt32 *>(VSI_CALLOC_VERBOSE(nXSize, sizeof(GUInt32)));
     GUInt32 *panThisY =
         static_cast<GUInt32 *>(VSI_CALLOC_VERBOSE(nXSize, sizeof(GUInt32)));
-    GUInt32 *panTopDownY =
-        static_cast<GUInt32 *>(VSI_CALLOC_VERBOSE(nXSize, sizeof(GUInt32)));
     float *pafLastValue =
         static_cast<float *>(VSI_CALLOC_VERBOSE(nXSize, sizeof(float)));
     float *pafThisValue =
         static_cast<float *>(VSI_CALLOC_VERBOSE(nXSize, sizeof(float)));
-    float *pafTopDownValue =
-        static_cast<float *>(VSI_CALLOC_VERBOSE(nXSize, sizeof(float)));
     float *pafScanline =
         static_cast<float *>(VSI_CALLOC_VERBOSE(nXSize, sizeof(float)));
     GByte *pabyMask = static_cast<GByte *>(VSI_CALLOC_VERBOSE(nXSize, 1));
-    GByte *pabyFiltMask = static_cast<GByte *>(VSI_CALLOC_VERBOSE(nXSize, 1));
 
     CPLErr eErr = CE_None;
 
-    if (panLastY == nullptr || panThisY == nullptr || panTopDownY == nullptr ||
-        pafLastValue == nullptr || pafThisValue == nullptr ||
-        pafTopDownValue == nullptr || pafScanline == nullptr ||
-        pabyMask == nullptr || pabyFiltMask == nullptr)
+    if (panLastY == nullptr || panThisY == nullptr || pafLastValue == nullptr ||
+        pafThisValue == nullptr || pafScanline == nullptr ||
+        pabyMask == nullptr)
     {
         eErr = CE_Failure;
         goto end;
@@ -725,260 +1412,26 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
         }
     }
 
-    for (int iX = 0; iX < nXSize; iX++)
-    {
-        panLastY[iX] = nNoDataVal;
-    }
-
     /* ==================================================================== */
     /*      Now we will do collect similar this/last information from       */
     /*      bottom to top and use it in combination with the top to         */
     /*      bottom search info to interpolate.                              */
     /* ==================================================================== */
-    for (int iY = nYSize - 1; iY >= 0 && eErr == CE_None; iY--)
+    if (eErr == CE_None)
     {
-        eErr = GDALRasterIO(hMaskBand, GF_Read, 0, iY, nXSize, 1, pabyMask,
-                            nXSize, 1, GDT_Byte, 0, 0);
-
-        if (eErr != CE_None)
-            break;
-
-        eErr = GDALRasterIO(hTargetBand, GF_Read, 0, iY, nXSize, 1, pafScanline,
-                            nXSize, 1, GDT_Float32, 0, 0);
-
-        if (eErr != CE_None)
-            break;
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Figure out the most recent pixel for each column. */
-        /* --------------------------------------------------------------------
-         */
-
-        for (int iX = 0; iX < nXSize; iX++)
-        {
-            if (pabyMask[iX])
-            {
-                pafThisValue[iX] = pafScanline[iX];
-                panThisY[iX] = iY;
-            }
-            else if (panLastY[iX] - iY <= dfMaxSearchDist)
-            {
-                pafThisValue[iX] = pafLastValue[iX];
-                panThisY[iX] = panLastY[iX];
-            }
-            else
-            {
-                panThisY[iX] = nNoDataVal;
-            }
-        }
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Load the last y and corresponding value from the top down pass.
-         */
-        /* --------------------------------------------------------------------
-         */
-        eErr = GDALRasterIO(hYBand, GF_Read, 0, iY, nXSize, 1, panTopDownY,
-                            nXSize, 1, GDT_UInt32, 0, 0);
-
-        if (eErr != CE_None)
-            break;
-
-        eErr = GDALRasterIO(hValBand, GF_Read, 0, iY, nXSize, 1,
-                            pafTopDownValue, nXSize, 1, GDT_Float32, 0, 0);
-
-        if (eErr != CE_None)
-            break;
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Attempt to interpolate any pixels that are nodata. */
-        /* --------------------------------------------------------------------
-         */
-        memset(pabyFiltMask, 0, nXSize);
-        for (int iX = 0; iX < nXSize; iX++)
-        {
-            int nThisMaxSearchDist = nMaxSearchDist;
-
-            // If this was a valid target - no change.
-            if (pabyMask[iX])
-                continue;
-
-            enum Quadrants
-            {
-                QUAD_TOP_LEFT = 0,
-                QUAD_BOTTOM_LEFT = 1,
-                QUAD_TOP_RIGHT = 2,
-                QUAD_BOTTOM_RIGHT = 3,
-            };
-
-            constexpr int QUAD_COUNT = 4;
-            double adfQuadDist[QUAD_COUNT] = {};
-            float afQuadValue[QUAD_COUNT] = {};
-
-            for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
-            {
-                adfQuadDist[iQuad] = dfMaxSearchDist + 1.0;
-                afQuadValue[iQuad] = 0.0;
-            }
-
-            // Step left and right by one pixel searching for the closest
-            // target value for each quadrant.
-            for (int iStep = 0; iStep <= nThisMaxSearchDist; iStep++)
-            {
-                const int iLeftX = std::max(0, iX - iStep);
-                const int iRightX = std::min(nXSize - 1, iX + iStep);
-
-                // Top left includes current line.
-                QUAD_CHECK(adfQuadDist[QUAD_TOP_LEFT],
-                           afQuadValue[QUAD_TOP_LEFT], iLeftX,
-                           panTopDownY[iLeftX], iX, iY, pafTopDownValue[iLeftX],
-                           nNoDataVal);
-
-                // Bottom left.
-                QUAD_CHECK(adfQuadDist[QUAD_BOTTOM_LEFT],
-                           afQuadValue[QUAD_BOTTOM_LEFT], iLeftX,
-                           panLastY[iLeftX], iX, iY, pafLastValue[iLeftX],
-                           nNoDataVal);
-
-                // Top right and bottom right do no include center pixel.
-                if (iStep == 0)
-                    continue;
-
-                // Top right includes current line.
-                QUAD_CHECK(adfQuadDist[QUAD_TOP_RIGHT],
-                           afQuadValue[QUAD_TOP_RIGHT], iRightX,
-                           panTopDownY[iRightX], iX, iY,
-                           pafTopDownValue[iRightX], nNoDataVal);
-
-                // Bottom right.
-                QUAD_CHECK(adfQuadDist[QUAD_BOTTOM_RIGHT],
-                           afQuadValue[QUAD_BOTTOM_RIGHT], iRightX,
-                           panLastY[iRightX], iX, iY, pafLastValue[iRightX],
-                           nNoDataVal);
-
-                // Every four steps, recompute maximum distance.
-                if ((iStep & 0x3) == 0)
-                    nThisMaxSearchDist = static_cast<int>(floor(
-                        std::max(std::max(adfQuadDist[0], adfQuadDist[1]),
-                                 std::max(adfQuadDist[2], adfQuadDist[3]))));
-            }
-
-            bool bHasSrcValues = false;
-            if (bNearest)
-            {
-                double dfNearestDist = dfMaxSearchDist + 1;
-                float fNearestValue = 0.0f;
-
-                for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
-                {
-                    if (adfQuadDist[iQuad] < dfNearestDist)
-                    {
-                        bHasSrcValues = true;
-                        if (!bHasNoData || afQuadValue[iQuad] != fNoData)
-                        {
-                            fNearestValue = afQuadValue[iQuad];
-                            dfNearestDist = adfQuadDist[iQuad];
-                        }
-                    }
-                }
-
-                if (bHasSrcValues)
-                {
-                    pabyFiltMask[iX] = 255;
-                    if (dfNearestDist <= dfMaxSearchDist)
-                    {
-                        pabyMask[iX] = 255;
-                        pafScanline[iX] = fNearestValue;
-                    }
-                    else
-                        pafScanline[iX] = fNoData;
-                }
-            }
-            else
-            {
-                double dfWeightSum = 0.0;
-                double dfValueSum = 0.0;
-
-                for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
-                {
-                    if (adfQuadDist[iQuad] <= dfMaxSearchDist)
-                    {
-                        bHasSrcValues = true;
-                        if (!bHasNoData || afQuadValue[iQuad] != fNoData)
-                        {
-                            const double dfWeight = 1.0 / adfQuadDist[iQuad];
-                            dfWeightSum += dfWeight;
-                            dfValueSum += afQuadValue[iQuad] * dfWeight;
-                        }
-                    }
-                }
-
-                if (bHasSrcValues)
-                {
-                    pabyFiltMask[iX] = 255;
-                    if (dfWeightSum > 0.0)
-                    {
-                        pabyMask[iX] = 255;
-                        pafScanline[iX] =
-                            static_cast<float>(dfValueSum / dfWeightSum);
-                    }
-                    else
-                        pafScanline[iX] = fNoData;
-                }
-            }
-        }
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Write out the updated data and mask information. */
-        /* --------------------------------------------------------------------
-         */
-        eErr = GDALRasterIO(hTargetBand, GF_Write, 0, iY, nXSize, 1,
-                            pafScanline, nXSize, 1, GDT_Float32, 0, 0);
-
-        if (eErr != CE_None)
-            break;
-
-        if (poTmpMaskDS != nullptr)
-        {
-            // Update (copy of) mask band when it has been provided by the
-            // user
-            eErr = GDALRasterIO(hMaskBand, GF_Write, 0, iY, nXSize, 1, pabyMask,
-                                nXSize, 1, GDT_Byte, 0, 0);
-
-            if (eErr != CE_None)
-                break;
-        }
-
-        eErr = GDALRasterIO(hFiltMaskBand, GF_Write, 0, iY, nXSize, 1,
-                            pabyFiltMask, nXSize, 1, GDT_Byte, 0, 0);
-
-        if (eErr != CE_None)
-            break;
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Flip this/last buffers. */
-        /* --------------------------------------------------------------------
-         */
-        std::swap(pafThisValue, pafLastValue);
-        std::swap(panThisY, panLastY);
-
-        /* --------------------------------------------------------------------
-         */
-        /*      report progress. */
-        /* --------------------------------------------------------------------
-         */
-        if (!pfnProgress(
-                dfProgressRatio *
-                    (0.5 + 0.5 * (nYSize - iY) / static_cast<double>(nYSize)),
-                "Filling...", pProgressArg))
-        {
-            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-            eErr = CE_Failure;
-        }
+        GDALFillNodataSearchParams sParams;
+        sParams.nXSize = nXSize;
+        sParams.dfMaxSearchDist = dfMaxSearchDist;
+        sParams.nMaxSearchDist = nMaxSearchDist;
+        sParams.bNearest = bNearest;
+        sParams.bHasNoData = bHasNoData;
+        sParams.fNoData = fNoData;
+        sParams.nNoDataVal = nNoDataVal;
+
+        eErr = GDALFillNodataBottomUp(
+            hTargetBand, hMaskBand, poTmpMaskDS != nullptr, hYBand, hValBand,
+            hFiltMaskBand, sParams, nThreads, dfProgressRatio, pfnProgress,
+            pProgressArg);
     }
 
     /* ==================================================================== */
@@ -999,9 +1452,14 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
         void *pScaledProgress = GDALCreateScaledProgress(
             dfProgressRatio, 1.0, pfnProgress, pProgressArg);
 
-        eErr = GDALMultiFilter(hTargetBand, hMaskBand, hFiltMaskBand,
-                               nSmoothingIterations, GDALScaledProgress,
-                               pScaledProgress);
+        if (nThreads > 1)
+            eErr = GDALMultiFilterMT(hTargetBand, hMaskBand, hFiltMaskBand,
+                                     nSmoothingIterations, nThreads,
+                                     GDALScaledProgress, pScaledProgress);
+        else
+            eErr = GDALMultiFilter(hTargetBand, hMaskBand, hFiltMaskBand,
+                                   nSmoothingIterations, GDALScaledProgress,
+                                   pScaledProgress);
 
         GDALDestroyScaledProgress(pScaledProgress);
     }
@@ -1012,13 +1470,10 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
 end:
     CPLFree(panLastY);
     CPLFree(panThisY);
-    CPLFree(panTopDownY);
     CPLFree(pafLastValue);
     CPLFree(pafThisValue);
-    CPLFree(pafTopDownValue);
     CPLFree(pafScanline);
     CPLFree(pabyMask);
-    CPLFree(pabyFiltMask);
 
     return eErr;
 }
@@ -27,11 +27,17 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <cmath>
 #include <limits>
+#include <mutex>
 
+#include "cpl_worker_thread_pool.h"
 #include "gdal_alg.h"
 #include "gdal_priv.h"
 #include "gdal_priv_templates.hpp"
+#include "gdal_thread_pool.h"
+#include "memdataset.h"
 
 #include "viewshed.h"
 
@@ -258,6 +264,55 @@ double CalcHeightEdge(int i, int j, double Za, double Zb, double Zo)
         return ((Za - Zo) * i + (Zb - Zo) * (j - i)) / (j - 1) + Zo;
 }
 
+// Compute the position of the observer in the raster, and the window of the
+// raster that is processed for it.
+bool GetObserverWindow(const double *adfInvGeoTransform, int nXSize,
+                       int nYSize, const Viewshed::Point &observer,
+                       double dfMaxDistance, int &nX, int &nY, int &nXStart,
+                       int &nYStart, int &nXStop, int &nYStop)
+{
+    double dfX, dfY;
+    GDALApplyGeoTransform(adfInvGeoTransform, observer.x, observer.y, &dfX,
+                          &dfY);
+    nX = static_cast<int>(dfX);
+    nY = static_cast<int>(dfY);
+
+    if (nX < 0 || nX > nXSize || nY < 0 || nY > nYSize)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "The observer location falls outside of the DEM area");
+        return false;
+    }
+
+    constexpr double EPSILON = 1e-8;
+
+    nXStart = 0;
+    nYStart = 0;
+    nXStop = nXSize;
+    nYStop = nYSize;
+    if (dfMaxDistance > 0)
+    {
+        nXStart = static_cast<int>(std::floor(
+            nX - adfInvGeoTransform[1] * dfMaxDistance + EPSILON));
+        nXStop = static_cast<int>(
+            std::ceil(nX + adfInvGeoTransform[1] * dfMaxDistance - EPSILON) +
+            1);
+        nYStart = static_cast<int>(std::floor(
+                      nY - std::fabs(adfInvGeoTransform[5]) * dfMaxDistance +
+                      EPSILON)) -
+                  (adfInvGeoTransform[5] > 0 ? 1 : 0);
+        nYStop = static_cast<int>(
+            std::ceil(nY + std::fabs(adfInvGeoTransform[5]) * dfMaxDistance -
+                      EPSILON) +
+            (adfInvGeoTransform[5] < 0 ? 1 : 0));
+    }
+    nXStart = std::max(nXStart, 0);
+    nYStart = std::max(nYStart, 0);
+    nXStop = std::min(nXStop, nXSize);
+    nYStop = std::min(nYStop, nYSize);
+    return true;
+}
+
 }  // unnamed namespace
 
 void Viewshed::setVisibility(int iPixel, double dfZ, double *padfZVal,
@@ -318,53 +373,14 @@ bool Viewshed::run(GDALRasterBandH hBand, GDALProgressFunc pfnProgress,
         return false;
     }
 
-    /* calculate observer position */
-    double dfX, dfY;
-    GDALApplyGeoTransform(adfInvGeoTransform, oOpts.observer.x,
-                          oOpts.observer.y, &dfX, &dfY);
-    int nX = static_cast<int>(dfX);
-    int nY = static_cast<int>(dfY);
-
+    /* calculate observer position and the area of interest */
     int nXSize = GDALGetRasterBandXSize(hBand);
     int nYSize = GDALGetRasterBandYSize(hBand);
-
-    if (nX < 0 || nX > nXSize || nY < 0 || nY > nYSize)
-    {
-        CPLError(CE_Failure, CPLE_AppDefined,
-                 "The observer location falls outside of the DEM area");
+    int nX, nY, nXStart, nYStart, nXStop, nYStop;
+    if (!GetObserverWindow(adfInvGeoTransform, nXSize, nYSize, oOpts.observer,
+                           oOpts.maxDistance, nX, nY, nXStart, nYStart,
+                           nXStop, nYStop))
         return false;
-    }
-
-    /* calculate the area of interest */
-    constexpr double EPSILON = 1e-8;
-
-    int nXStart = 0;
-    int nYStart = 0;
-    int nXStop = nXSize;
-    int nYStop = nYSize;
-    if (oOpts.maxDistance > 0)
-    {
-        nXStart = static_cast<int>(std::floor(
-            nX - adfInvGeoTransform[1] * oOpts.maxDistance + EPSILON));
-        nXStop = static_cast<int>(
-            std::ceil(nX + adfInvGeoTransform[1] * oOpts.maxDistance -
-                      EPSILON) +
-            1);
-        nYStart =
-            static_cast<int>(std::floor(
-                nY - std::fabs(adfInvGeoTransform[5]) * oOpts.maxDistance +
-                EPSILON)) -
-            (adfInvGeoTransform[5] > 0 ? 1 : 0);
-        nYStop = static_cast<int>(
-            std::ceil(nY +
-                      std::fabs(adfInvGeoTransform[5]) * oOpts.maxDistance -
-                      EPSILON) +
-            (adfInvGeoTransform[5] < 0 ? 1 : 0));
-    }
-    nXStart = std::max(nXStart, 0);
-    nYStart = std::max(nYStart, 0);
-    nXStop = std::min(nXStop, nXSize);
-    nYStop = std::min(nYStop, nYSize);
 
     /* normalize horizontal index (0 - nXSize) */
     nXSize = nXStop - nXStart;
@@ -923,4 +939,330 @@ bool Viewshed::run(GDALRasterBandH hBand, GDALProgressFunc pfnProgress,
     return true;
 }
 
+namespace
+{
+
+/************************************************************************/
+/*                       ViewshedCumulativeContext                      */
+/************************************************************************/
+
+// State shared by the observer jobs of Viewshed::runCumulative()
+struct ViewshedCumulativeContext
+{
+    Viewshed::Options oOpts{};
+    // Cached DEM, covering the union of the windows of the observers
+    const double *padfDEM = nullptr;
+    int nXSize = 0;
+    int nYSize = 0;
+    std::array<double, 6> adfGeoTransform{};
+    double adfInvGeoTransform[6]{};
+    std::string osSRSWkt{};
+
+    // Number of observers from which each pixel of the cached area is
+    // visible, and mutexes protecting groups of LINES_PER_MUTEX lines.
+    static constexpr int LINES_PER_MUTEX = 64;
+    std::vector<uint32_t> anCounts{};
+    std::vector<std::mutex> aoMutexes{};
+
+    std::atomic<int> nDone{0};
+    std::atomic<bool> bError{false};
+};
+
+struct ViewshedObserverJob
+{
+    ViewshedCumulativeContext *psContext = nullptr;
+    Viewshed::Point oObserver{0, 0, 0};
+};
+
+/************************************************************************/
+/*                      ViewshedProcessObserver()                       */
+/************************************************************************/
+
+void ViewshedProcessObserver(void *pData)
+{
+    const auto psJob = static_cast<const ViewshedObserverJob *>(pData);
+    ViewshedCumulativeContext &oContext = *(psJob->psContext);
+
+    const auto Done = [&oContext](bool bSuccess)
+    {
+        if (!bSuccess)
+            oContext.bError = true;
+        ++oContext.nDone;
+    };
+
+    // Wrap the cached DEM into a dataset specific to this job
+    std::unique_ptr<MEMDataset> poDEMDS(MEMDataset::Create(
+        "", oContext.nXSize, oContext.nYSize, 0, GDT_Float64, nullptr));
+    if (!poDEMDS)
+        return Done(false);
+    poDEMDS->AddMEMBand(MEMCreateRasterBandEx(
+        poDEMDS.get(), 1,
+        reinterpret_cast<GByte *>(const_cast<double *>(oContext.padfDEM)),
+        GDT_Float64, 0, 0, false));
+    std::array<double, 6> adfGeoTransform = oContext.adfGeoTransform;
+    poDEMDS->SetGeoTransform(adfGeoTransform.data());
+    if (!oContext.osSRSWkt.empty())
+    {
+        OGRSpatialReference oSRS;
+        oSRS.SetAxisMappingStrategy(OAMS_TRADITIONAL_GIS_ORDER);
+        if (oSRS.importFromWkt(oContext.osSRSWkt.c_str()) == OGRERR_NONE)
+            poDEMDS->SetSpatialRef(&oSRS);
+    }
+
+    Viewshed::Options oOpts = oContext.oOpts;
+    oOpts.observer = psJob->oObserver;
+    Viewshed oViewshed(oOpts);
+    if (!oViewshed.run(GDALRasterBand::ToHandle(poDEMDS->GetRasterBand(1)),
+                       nullptr))
+        return Done(false);
+    auto poOutDS = oViewshed.output();
+
+    const int nOutXSize = poOutDS->GetRasterXSize();
+    const int nOutYSize = poOutDS->GetRasterYSize();
+    std::vector<GByte> abyVisible;
+    try
+    {
+        abyVisible.resize(static_cast<size_t>(nOutXSize) * nOutYSize);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate buffer for viewshed");
+        return Done(false);
+    }
+    if (poOutDS->GetRasterBand(1)->RasterIO(
+            GF_Read, 0, 0, nOutXSize, nOutYSize, abyVisible.data(), nOutXSize,
+            nOutYSize, GDT_Byte, 0, 0, nullptr) != CE_None)
+        return Done(false);
+
+    // Locate the output window in the cached area
+    double adfOutGeoTransform[6];
+    poOutDS->GetGeoTransform(adfOutGeoTransform);
+    double dfXOff, dfYOff;
+    GDALApplyGeoTransform(oContext.adfInvGeoTransform, adfOutGeoTransform[0],
+                          adfOutGeoTransform[3], &dfXOff, &dfYOff);
+    const int nXOff = static_cast<int>(std::round(dfXOff));
+    const int nYOff = static_cast<int>(std::round(dfYOff));
+    if (nXOff < 0 || nYOff < 0 || nXOff + nOutXSize > oContext.nXSize ||
+        nYOff + nOutYSize > oContext.nYSize)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Unexpected viewshed window for observer (%f,%f)",
+                 psJob->oObserver.x, psJob->oObserver.y);
+        return Done(false);
+    }
+
+    for (int iLine = 0; iLine < nOutYSize; ++iLine)
+    {
+        const int iDstLine = nYOff + iLine;
+        std::lock_guard<std::mutex> oLock(
+            oContext.aoMutexes[iDstLine /
+                               ViewshedCumulativeContext::LINES_PER_MUTEX]);
+        uint32_t *panCounts = oContext.anCounts.data() +
+                              static_cast<size_t>(iDstLine) * oContext.nXSize +
+                              nXOff;
+        const GByte *pabyVisible =
+            abyVisible.data() + static_cast<size_t>(iLine) * nOutXSize;
+        for (int i = 0; i < nOutXSize; ++i)
+            panCounts[i] += pabyVisible[i];
+    }
+
+    Done(true);
+}
+
+}  // unnamed namespace
+
+bool Viewshed::runCumulative(GDALRasterBandH hBand,
+                             const std::vector<Point> &observers,
+                             GDALProgressFunc pfnProgress, void *pProgressArg)
+{
+    if (!pfnProgress)
+        pfnProgress = GDALDummyProgress;
+
+    if (observers.empty())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "No observer provided");
+        return false;
+    }
+
+    if (!pfnProgress(0.0, "", pProgressArg))
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        return false;
+    }
+
+    /* set up geotransformation */
+    std::array<double, 6> adfGeoTransform{{0.0, 1.0, 0.0, 0.0, 0.0, 1.0}};
+    GDALDatasetH hSrcDS = GDALGetBandDataset(hBand);
+    if (hSrcDS != nullptr)
+        GDALGetGeoTransform(hSrcDS, adfGeoTransform.data());
+
+    double adfInvGeoTransform[6];
+    if (!GDALInvGeoTransform(adfGeoTransform.data(), adfInvGeoTransform))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Cannot invert geotransform");
+        return false;
+    }
+
+    /* union of the areas of interest of the observers */
+    const int nRasterXSize = GDALGetRasterBandXSize(hBand);
+    const int nRasterYSize = GDALGetRasterBandYSize(hBand);
+    int nXStart = nRasterXSize;
+    int nYStart = nRasterYSize;
+    int nXStop = 0;
+    int nYStop = 0;
+    for (const auto &observer : observers)
+    {
+        int nX, nY, nObsXStart, nObsYStart, nObsXStop, nObsYStop;
+        if (!GetObserverWindow(adfInvGeoTransform, nRasterXSize, nRasterYSize,
+                               observer, oOpts.maxDistance, nX, nY,
+                               nObsXStart, nObsYStart, nObsXStop, nObsYStop))
+            return false;
+        nXStart = std::min(nXStart, nObsXStart);
+        nYStart = std::min(nYStart, nObsYStart);
+        nXStop = std::max(nXStop, nObsXStop);
+        nYStop = std::max(nYStop, nObsYStop);
+    }
+    const int nXSize = nXStop - nXStart;
+    const int nYSize = nYStop - nYStart;
+    if (nXSize <= 0 || nYSize <= 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Invalid target raster size");
+        return false;
+    }
+
+    /* read the DEM once */
+    std::vector<double> adfDEM;
+    ViewshedCumulativeContext oContext;
+    try
+    {
+        adfDEM.resize(static_cast<size_t>(nXSize) * nYSize);
+        oContext.anCounts.resize(static_cast<size_t>(nXSize) * nYSize);
+        oContext.aoMutexes = std::vector<std::mutex>(
+            (nYSize + ViewshedCumulativeContext::LINES_PER_MUTEX - 1) /
+            ViewshedCumulativeContext::LINES_PER_MUTEX);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate buffers for cumulative viewshed");
+        return false;
+    }
+    if (GDALRasterIO(hBand, GF_Read, nXStart, nYStart, nXSize, nYSize,
+                     adfDEM.data(), nXSize, nYSize, GDT_Float64, 0, 0))
+    {
+        CPLError(
+            CE_Failure, CPLE_AppDefined,
+            "RasterIO error when reading DEM at position(%d, %d), size(%d, %d)",
+            nXStart, nYStart, nXSize, nYSize);
+        return false;
+    }
+
+    std::array<double, 6> adfDstGeoTransform = adfGeoTransform;
+    adfDstGeoTransform[0] = adfGeoTransform[0] + adfGeoTransform[1] * nXStart +
+                            adfGeoTransform[2] * nYStart;
+    adfDstGeoTransform[3] = adfGeoTransform[3] + adfGeoTransform[4] * nXStart +
+                            adfGeoTransform[5] * nYStart;
+
+    oContext.oOpts = oOpts;
+    oContext.oOpts.outputMode = OutputMode::Normal;
+    oContext.oOpts.visibleVal = 1;
+    oContext.oOpts.invisibleVal = 0;
+    oContext.oOpts.outOfRangeVal = 0;
+    oContext.oOpts.nodataVal = -1;
+    oContext.oOpts.outputFormat = "MEM";
+    oContext.oOpts.outputFilename.clear();
+    oContext.oOpts.creationOpts.Clear();
+    oContext.padfDEM = adfDEM.data();
+    oContext.nXSize = nXSize;
+    oContext.nYSize = nYSize;
+    oContext.adfGeoTransform = adfDstGeoTransform;
+    CPL_IGNORE_RET_VAL(GDALInvGeoTransform(adfDstGeoTransform.data(),
+                                           oContext.adfInvGeoTransform));
+    const OGRSpatialReference *poSrcSRS =
+        hSrcDS ? GDALDataset::FromHandle(hSrcDS)->GetSpatialRef() : nullptr;
+    if (poSrcSRS)
+        oContext.osSRSWkt = poSrcSRS->exportToWkt();
+
+    /* process the observers */
+    std::vector<ViewshedObserverJob> asJobs(observers.size());
+    const int nThreads = std::max(1, oOpts.numThreads);
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    bool bInterrupted = false;
+    for (size_t i = 0; i < observers.size() && !oContext.bError; ++i)
+    {
+        asJobs[i].psContext = &oContext;
+        asJobs[i].oObserver = observers[i];
+        if (!poJobQueue ||
+            !poJobQueue->SubmitJob(ViewshedProcessObserver, &asJobs[i]))
+        {
+            ViewshedProcessObserver(&asJobs[i]);
+        }
+        else
+        {
+            // Keep a bounded number of pending jobs, so that progress is
+            // meaningful and interruption is quick.
+            poJobQueue->WaitCompletion(2 * nThreads);
+        }
+
+        if (!pfnProgress(static_cast<double>(oContext.nDone) /
+                             static_cast<double>(observers.size()),
+                         "", pProgressArg))
+        {
+            bInterrupted = true;
+            break;
+        }
+    }
+    if (poJobQueue)
+        poJobQueue->WaitCompletion();
+
+    if (bInterrupted)
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        return false;
+    }
+    if (oContext.bError)
+        return false;
+
+    /* create output raster */
+    GDALDriver *poDriver =
+        GetGDALDriverManager()->GetDriverByName(oOpts.outputFormat.c_str());
+    if (!poDriver)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Cannot get driver");
+        return false;
+    }
+    poDstDS.reset(poDriver->Create(
+        oOpts.outputFilename.c_str(), nXSize, nYSize, 1, GDT_UInt32,
+        const_cast<char **>(oOpts.creationOpts.List())));
+    if (!poDstDS)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Cannot create dataset for %s",
+                 oOpts.outputFilename.c_str());
+        return false;
+    }
+    if (poSrcSRS)
+        poDstDS->SetSpatialRef(poSrcSRS);
+    poDstDS->SetGeoTransform(adfDstGeoTransform.data());
+
+    if (poDstDS->GetRasterBand(1)->RasterIO(
+            GF_Write, 0, 0, nXSize, nYSize, oContext.anCounts.data(), nXSize,
+            nYSize, GDT_UInt32, 0, 0, nullptr) != CE_None)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "RasterIO error when writing target raster");
+        return false;
+    }
+
+    if (!pfnProgress(1.0, "", pProgressArg))
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        return false;
+    }
+
+    return true;
+}
+
 }  // namespace gdal
@@ -28,6 +28,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "cpl_progress.h"
 #include "gdal_priv.h"
@@ -95,6 +96,8 @@ class Viewshed
         CPLStringList creationOpts{};  //!< options for output raster creation
         CellMode cellMode{
             CellMode::Edge};  //!< Mode of cell height calculation.
+        int numThreads{1};  //!< Number of observers processed concurrently
+                            //!< by runCumulative().
     };
 
     /**
@@ -116,6 +119,28 @@ class Viewshed
     CPL_DLL bool run(GDALRasterBandH hBand, GDALProgressFunc pfnProgress,
                      void *pProgressArg = nullptr);
 
+    /**
+     * Create a cumulative viewshed for a set of observers.
+     *
+     * Each pixel of the output raster, of type UInt32, contains the number
+     * of observers from which it is visible. The output raster covers the
+     * union of the areas processed for each observer. That part of the DEM
+     * is read once, and shared by all the observer computations, which are
+     * run on Options::numThreads threads.
+     *
+     * Options::observer is ignored, as well as the output mode and the
+     * visible, invisible and out of range values.
+     *
+     * @param hBand  Handle to the raster band.
+     * @param observers  Observer positions. z is the height above the DEM.
+     * @param pfnProgress  Progress reporting callback function.
+     * @param pProgressArg  Argument to pass to the progress callback.
+    */
+    CPL_DLL bool runCumulative(GDALRasterBandH hBand,
+                               const std::vector<Point> &observers,
+                               GDALProgressFunc pfnProgress,
+                               void *pProgressArg = nullptr);
+
     /**
      * Fetch a pointer to the created raster band.
      *
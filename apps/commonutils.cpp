@@ -28,14 +28,20 @@
 
 #include "commonutils.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
 
 #include <string>
 
 #include "cpl_conv.h"
+#include "cpl_error_internal.h"
+#include "cpl_multiproc.h"
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
+#include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 /* -------------------------------------------------------------------- */
 /*                         GetOutputDriversFor()                        */
@@ -162,3 +168,138 @@ int ArgIsNumeric(const char *pszArg)
 {
     return CPLGetValueType(pszArg) != CPL_VALUE_STRING;
 }
+
+/************************************************************************/
+/*                    GDALGetNumThreadsFromSwitch()                     */
+/************************************************************************/
+
+/** Returns the number of threads to use from the value of a -num_threads
+ * switch (or nullptr if not specified, in which case the GDAL_NUM_THREADS
+ * configuration option is used, defaulting to ALL_CPUS).
+ */
+int GDALGetNumThreadsFromSwitch(const char *pszNumThreads)
+{
+    if (pszNumThreads == nullptr)
+        pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS");
+    const int nThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                             ? CPLGetNumCPUs()
+                             : atoi(pszNumThreads);
+    return std::max(1, std::min(nThreads, 128));
+}
+
+/************************************************************************/
+/*                    GDALOrderedDatasetOpener::Slot                    */
+/************************************************************************/
+
+struct GDALOrderedDatasetOpener::Slot
+{
+    GDALOrderedDatasetOpener *poOpener = nullptr;
+    std::string osFilename{};
+    std::unique_ptr<GDALDataset> poDS{};
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+    bool bDone = false;
+};
+
+/************************************************************************/
+/*                      GDALOrderedDatasetOpener()                      */
+/************************************************************************/
+
+GDALOrderedDatasetOpener::GDALOrderedDatasetOpener(
+    int nThreads, unsigned int nOpenFlags, CSLConstList papszOpenOptions)
+    : m_nThreads(nThreads), m_nOpenFlags(nOpenFlags),
+      m_aosOpenOptions(papszOpenOptions)
+{
+    if (m_nThreads > 1)
+    {
+        CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(m_nThreads);
+        if (poThreadPool)
+            m_poQueue = poThreadPool->CreateJobQueue();
+    }
+}
+
+/************************************************************************/
+/*                     ~GDALOrderedDatasetOpener()                      */
+/************************************************************************/
+
+GDALOrderedDatasetOpener::~GDALOrderedDatasetOpener()
+{
+    // Datasets opened ahead, but not retrieved, are closed with the slots
+    if (m_poQueue)
+        m_poQueue->WaitCompletion();
+}
+
+/************************************************************************/
+/*                                Add()                                 */
+/************************************************************************/
+
+void GDALOrderedDatasetOpener::Add(const std::string &osFilename)
+{
+    auto poSlot = std::make_unique<Slot>();
+    poSlot->poOpener = this;
+    poSlot->osFilename = osFilename;
+    m_apoSlots.push_back(std::move(poSlot));
+}
+
+/************************************************************************/
+/*                              OpenJob()                               */
+/************************************************************************/
+
+void GDALOrderedDatasetOpener::OpenJob(void *pData)
+{
+    Slot *psSlot = static_cast<Slot *>(pData);
+    GDALOrderedDatasetOpener *poOpener = psSlot->poOpener;
+
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors;
+    CPLInstallErrorHandlerAccumulator(aoErrors);
+    std::unique_ptr<GDALDataset> poDS(GDALDataset::Open(
+        psSlot->osFilename.c_str(), poOpener->m_nOpenFlags, nullptr,
+        poOpener->m_aosOpenOptions.List(), nullptr));
+    CPLUninstallErrorHandlerAccumulator();
+
+    std::lock_guard<std::mutex> oLock(poOpener->m_oMutex);
+    psSlot->poDS = std::move(poDS);
+    psSlot->aoErrors = std::move(aoErrors);
+    psSlot->bDone = true;
+    poOpener->m_oCV.notify_all();
+}
+
+/************************************************************************/
+/*                                Get()                                 */
+/************************************************************************/
+
+/** Returns the dataset of the nIdx-th added filename, or nullptr if it
+ * cannot be opened. Must be called with increasing values of nIdx.
+ */
+std::unique_ptr<GDALDataset> GDALOrderedDatasetOpener::Get(size_t nIdx)
+{
+    Slot *psSlot = m_apoSlots[nIdx].get();
+    if (!m_poQueue)
+    {
+        return std::unique_ptr<GDALDataset>(GDALDataset::Open(
+            psSlot->osFilename.c_str(), m_nOpenFlags, nullptr,
+            m_aosOpenOptions.List(), nullptr));
+    }
+
+    // Keep a bounded number of datasets opened ahead of consumption
+    const size_t nWindow = static_cast<size_t>(4) * m_nThreads;
+    while (m_nNextToSubmit < m_apoSlots.size() &&
+           m_nNextToSubmit < nIdx + nWindow)
+    {
+        Slot *psSlotToSubmit = m_apoSlots[m_nNextToSubmit].get();
+        if (!m_poQueue->SubmitJob(OpenJob, psSlotToSubmit))
+            OpenJob(psSlotToSubmit);
+        ++m_nNextToSubmit;
+    }
+
+    std::unique_ptr<GDALDataset> poDS;
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors;
+    {
+        std::unique_lock<std::mutex> oLock(m_oMutex);
+        m_oCV.wait(oLock, [psSlot] { return psSlot->bDone; });
+        poDS = std::move(psSlot->poDS);
+        aoErrors = std::move(psSlot->aoErrors);
+    }
+    for (const auto &oError : aoErrors)
+        CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+    return poDS;
+}
@@ -120,6 +120,59 @@ int ArgIsNumeric(const char *pszArg);
 constexpr int OVR_LEVEL_AUTO = -2;
 constexpr int OVR_LEVEL_NONE = -1;
 
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+class CPLJobQueue;
+class GDALDataset;
+
+/************************************************************************/
+/*                      GDALOrderedDatasetOpener                        */
+/************************************************************************/
+
+/** Opens a list of datasets ahead of their consumption, using a thread pool,
+ * while handing them over in the order of the list, so that the output of
+ * utilities does not depend on the number of threads.
+ *
+ * Errors emitted while opening a dataset are re-emitted, from the calling
+ * thread, when it is retrieved with Get().
+ */
+class GDALOrderedDatasetOpener
+{
+  public:
+    GDALOrderedDatasetOpener(int nThreads, unsigned int nOpenFlags,
+                             CSLConstList papszOpenOptions);
+    ~GDALOrderedDatasetOpener();
+
+    void Add(const std::string &osFilename);
+
+    size_t size() const
+    {
+        return m_apoSlots.size();
+    }
+
+    std::unique_ptr<GDALDataset> Get(size_t nIdx);
+
+  private:
+    struct Slot;
+
+    const int m_nThreads;
+    const unsigned int m_nOpenFlags;
+    const CPLStringList m_aosOpenOptions;
+    std::vector<std::unique_ptr<Slot>> m_apoSlots{};
+    size_t m_nNextToSubmit = 0;
+    std::unique_ptr<CPLJobQueue> m_poQueue{};
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+
+    static void OpenJob(void *pData);
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALOrderedDatasetOpener)
+};
+
+int GDALGetNumThreadsFromSwitch(const char *pszNumThreads);
+
 #endif /* __cplusplus */
 
 #endif /* COMMONUTILS_H_INCLUDED */
@@ -36,7 +36,11 @@
 #include <cstdlib>
 #include <cstring>
 #include <algorithm>
+#include <atomic>
 #include <limits>
+#include <map>
+#include <memory>
+#include <utility>
 #include <vector>
 
 #include "commonutils.h"
@@ -45,9 +49,11 @@
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_alg.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_mem.h"
@@ -124,6 +130,9 @@ struct GDALFootprintOptions
     bool bAbsolutePath = false;
 
     std::string osSrcNoData;
+
+    /*! Number of threads used to read the mask, or empty for the default */
+    std::string osNumThreads{};
 };
 
 static std::unique_ptr<GDALArgumentParser> GDALFootprintAppOptionsGetParser(
@@ -219,6 +228,11 @@ static std::unique_ptr<GDALArgumentParser> GDALFootprintAppOptionsGetParser(
                 "ring to be considered."));
 
     // Note: no store_into (requires post validation)
+    argParser->add_argument("-num_threads")
+        .metavar("<value>|ALL_CPUS")
+        .store_into(psOptions->osNumThreads)
+        .help(_("Number of threads used to read the mask."));
+
     argParser->add_argument("-max_points")
         .metavar("<value>|unlimited")
         .default_value("100")
@@ -812,59 +826,30 @@ static double GetMinDistanceBetweenTwoPoints(const OGRGeometry *poGeom)
 }
 
 /************************************************************************/
-/*                       GDALFootprintProcess()                         */
+/*                       GDALFootprintMaskChain                         */
 /************************************************************************/
 
-static bool GDALFootprintProcess(GDALDataset *poSrcDS, OGRLayer *poDstLayer,
-                                 const GDALFootprintOptions *psOptions)
+/** Mask bands of a dataset, combined into the band whose non-zero pixels
+ * make the footprint. */
+struct GDALFootprintMaskChain
 {
-    std::unique_ptr<OGRCoordinateTransformation> poCT_SRS;
-    const OGRSpatialReference *poDstSRS = poDstLayer->GetSpatialRef();
-    if (!psOptions->oOutputSRS.IsEmpty())
-        poDstSRS = &(psOptions->oOutputSRS);
-    if (poDstSRS)
-    {
-        auto poSrcSRS = poSrcDS->GetSpatialRef();
-        if (!poSrcSRS)
-        {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Output layer has CRS, but input is not georeferenced");
-            return false;
-        }
-        poCT_SRS.reset(OGRCreateCoordinateTransformation(poSrcSRS, poDstSRS));
-        if (!poCT_SRS)
-            return false;
-    }
+    std::vector<GDALRasterBand *> apoSrcMaskBands{};
+    std::vector<std::unique_ptr<GDALRasterBand>> apoTmpNoDataMaskBands{};
+    bool bGlobalMask = true;
+    std::unique_ptr<GDALRasterBand> poMaskForRasterize{};
+};
 
-    std::vector<int> anBands = psOptions->anBands;
-    const int nBandCount = poSrcDS->GetRasterCount();
-    if (anBands.empty())
-    {
-        for (int i = 1; i <= nBandCount; ++i)
-            anBands.push_back(i);
-    }
+/************************************************************************/
+/*                    GDALFootprintBuildMaskChain()                     */
+/************************************************************************/
 
-    std::vector<GDALRasterBand *> apoSrcMaskBands;
-    const CPLStringList aosSrcNoData(
-        CSLTokenizeString2(psOptions->osSrcNoData.c_str(), " ", 0));
-    std::vector<double> adfSrcNoData;
-    if (!psOptions->osSrcNoData.empty())
-    {
-        if (aosSrcNoData.size() != 1 &&
-            static_cast<size_t>(aosSrcNoData.size()) != anBands.size())
-        {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Number of values in -srcnodata should be 1 or the number "
-                     "of bands");
-            return false;
-        }
-        for (int i = 0; i < aosSrcNoData.size(); ++i)
-        {
-            adfSrcNoData.emplace_back(CPLAtof(aosSrcNoData[i]));
-        }
-    }
-    bool bGlobalMask = true;
-    std::vector<std::unique_ptr<GDALRasterBand>> apoTmpNoDataMaskBands;
+static bool GDALFootprintBuildMaskChain(GDALDataset *poSrcDS,
+                                        const GDALFootprintOptions *psOptions,
+                                        const std::vector<int> &anBands,
+                                        const std::vector<double> &adfSrcNoData,
+                                        GDALFootprintMaskChain &oChain)
+{
+    const int nBandCount = poSrcDS->GetRasterCount();
     for (size_t i = 0; i < anBands.size(); ++i)
     {
         const int nBand = anBands[i];
@@ -877,12 +862,13 @@ static bool GDALFootprintProcess(GDALDataset *poSrcDS, OGRLayer *poDstLayer,
         auto poBand = poSrcDS->GetRasterBand(nBand);
         if (!adfSrcNoData.empty())
         {
-            bGlobalMask = false;
-            apoTmpNoDataMaskBands.emplace_back(
+            oChain.bGlobalMask = false;
+            oChain.apoTmpNoDataMaskBands.emplace_back(
                 std::make_unique<GDALNoDataMaskBand>(
                     poBand, adfSrcNoData.size() == 1 ? adfSrcNoData[0]
                                                      : adfSrcNoData[i]));
-            apoSrcMaskBands.push_back(apoTmpNoDataMaskBands.back().get());
+            oChain.apoSrcMaskBands.push_back(
+                oChain.apoTmpNoDataMaskBands.back().get());
         }
         else
         {
@@ -896,7 +882,7 @@ static bool GDALFootprintProcess(GDALDataset *poSrcDS, OGRLayer *poDstLayer,
             {
                 if ((nMaskFlags & GMF_PER_DATASET) == 0)
                 {
-                    bGlobalMask = false;
+                    oChain.bGlobalMask = false;
                 }
                 poMaskBand = poBand->GetMaskBand();
             }
@@ -965,10 +951,668 @@ static bool GDALFootprintProcess(GDALDataset *poSrcDS, OGRLayer *poDstLayer,
                     }
                 }
             }
-            apoSrcMaskBands.push_back(poMaskBand);
+            oChain.apoSrcMaskBands.push_back(poMaskBand);
+        }
+    }
+
+    if (oChain.bGlobalMask || anBands.size() == 1)
+    {
+        oChain.poMaskForRasterize = std::make_unique<GDALFootprintMaskBand>(
+            oChain.apoSrcMaskBands[0]);
+    }
+    else
+    {
+        oChain.poMaskForRasterize =
+            std::make_unique<GDALFootprintCombinedMaskBand>(
+                oChain.apoSrcMaskBands, psOptions->bCombineBandsUnion);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                     Footprint boundary tracing                       */
+/************************************************************************/
+
+// The footprint is computed from the runs of valid pixels of each line of
+// the mask, read by strips, possibly in parallel. The boundary of the valid
+// area is made of the horizontal edges where the runs of consecutive lines
+// differ, and of the vertical edges at the ends of runs. Those edges are
+// chained into rings, without a full polygonization of the mask.
+
+namespace
+{
+/** Runs [first, second[ of valid pixels of a line of the mask */
+typedef std::vector<std::pair<int, int>> GDALFootprintLineRuns;
+
+/** Boundary edge, with the valid pixels on its right when walking from
+ * (nX0, nY0) to (nX1, nY1), the Y axis pointing downwards. */
+struct GDALFootprintEdge
+{
+    uint64_t nStartKey;
+    int nX0;
+    int nY0;
+    int nX1;
+    int nY1;
+};
+}  // namespace
+
+static inline uint64_t GDALFootprintVertexKey(int nX, int nY)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(nY)) << 32) |
+           static_cast<uint32_t>(nX);
+}
+
+/************************************************************************/
+/*                     GDALFootprintEncodeLineRuns()                    */
+/************************************************************************/
+
+/** Appends to aoRuns the runs of pixels at 1 of pabyLine, whose values must be
+ * 0 or 1. Uniform spans are skipped 8 pixels at a time. */
+static void GDALFootprintEncodeLineRuns(const GByte *pabyLine, int nXSize,
+                                        GDALFootprintLineRuns &aoRuns)
+{
+    constexpr uint64_t ALL_ZEROS = 0;
+    constexpr uint64_t ALL_ONES = 0x0101010101010101U;
+    const auto Read8 = [pabyLine](int iX)
+    {
+        uint64_t nWord;
+        memcpy(&nWord, pabyLine + iX, sizeof(nWord));
+        return nWord;
+    };
+
+    int iX = 0;
+    while (iX < nXSize)
+    {
+        while (iX + 8 <= nXSize && Read8(iX) == ALL_ZEROS)
+            iX += 8;
+        while (iX < nXSize && pabyLine[iX] == 0)
+            ++iX;
+        if (iX == nXSize)
+            break;
+        const int nStart = iX;
+        while (iX + 8 <= nXSize && Read8(iX) == ALL_ONES)
+            iX += 8;
+        while (iX < nXSize && pabyLine[iX] != 0)
+            ++iX;
+        aoRuns.emplace_back(nStart, iX);
+    }
+}
+
+/************************************************************************/
+/*                      GDALFootprintReadStrip()                        */
+/************************************************************************/
+
+/** Reads lines [nYStart, nYEnd[ of poMaskBand into runs */
+static bool GDALFootprintReadStrip(GDALRasterBand *poMaskBand, int nYStart,
+                                   int nYEnd,
+                                   std::vector<GDALFootprintLineRuns> &aoLines)
+{
+    const int nXSize = poMaskBand->GetXSize();
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poMaskBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    // Read by chunks of whole blocks, of at most 16 MB
+    const int nChunkLines = std::max(
+        1, std::min(std::max(nBlockYSize, 1),
+                    static_cast<int>((16 * 1024 * 1024) / nXSize)));
+    std::vector<GByte> abyBuffer;
+    try
+    {
+        abyBuffer.resize(static_cast<size_t>(nXSize) * nChunkLines);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory allocating mask buffer");
+        return false;
+    }
+    for (int nY = nYStart; nY < nYEnd; nY += nChunkLines)
+    {
+        const int nLines = std::min(nChunkLines, nYEnd - nY);
+        if (poMaskBand->RasterIO(GF_Read, 0, nY, nXSize, nLines,
+                                 abyBuffer.data(), nXSize, nLines, GDT_Byte, 1,
+                                 nXSize, nullptr) != CE_None)
+        {
+            return false;
+        }
+        for (int i = 0; i < nLines; ++i)
+        {
+            GDALFootprintEncodeLineRuns(
+                abyBuffer.data() + static_cast<size_t>(i) * nXSize, nXSize,
+                aoLines[nY + i]);
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                     GDALFootprintSubtractRuns()                      */
+/************************************************************************/
+
+/** Appends to aoOut the parts of aoA runs that are not in aoB runs */
+static void GDALFootprintSubtractRuns(const GDALFootprintLineRuns &aoA,
+                                      const GDALFootprintLineRuns &aoB,
+                                      GDALFootprintLineRuns &aoOut)
+{
+    size_t j = 0;
+    for (const auto &[nStart, nEnd] : aoA)
+    {
+        int nCur = nStart;
+        while (j < aoB.size() && aoB[j].second <= nCur)
+            ++j;
+        for (size_t k = j; k < aoB.size() && aoB[k].first < nEnd; ++k)
+        {
+            if (aoB[k].first > nCur)
+                aoOut.emplace_back(nCur, aoB[k].first);
+            nCur = std::max(nCur, aoB[k].second);
+        }
+        if (nCur < nEnd)
+            aoOut.emplace_back(nCur, nEnd);
+    }
+}
+
+/************************************************************************/
+/*                       GDALFootprintTraceRuns()                       */
+/************************************************************************/
+
+/** Returns the polygons, in pixel coordinates, of the 4-connected areas of
+ * valid pixels, sorted by their top-left corner. As for GDALPolygonize(),
+ * exterior rings are clockwise and interior rings counter-clockwise (in a
+ * Y-up frame), and start at their top-left vertex. */
+static std::vector<std::unique_ptr<OGRPolygon>>
+GDALFootprintTraceRuns(const std::vector<GDALFootprintLineRuns> &aoLines)
+{
+    const int nYSize = static_cast<int>(aoLines.size());
+
+    // Collect boundary edges
+    std::vector<GDALFootprintEdge> asEdges;
+    const auto AddEdge = [&asEdges](int nX0, int nY0, int nX1, int nY1)
+    {
+        asEdges.push_back(GDALFootprintEdge{GDALFootprintVertexKey(nX0, nY0),
+                                            nX0, nY0, nX1, nY1});
+    };
+    const GDALFootprintLineRuns aoEmpty;
+    GDALFootprintLineRuns aoDiff;
+    for (int nY = 0; nY <= nYSize; ++nY)
+    {
+        const auto &aoAbove = nY > 0 ? aoLines[nY - 1] : aoEmpty;
+        const auto &aoBelow = nY < nYSize ? aoLines[nY] : aoEmpty;
+
+        // Valid below and not above: walk towards increasing X
+        aoDiff.clear();
+        GDALFootprintSubtractRuns(aoBelow, aoAbove, aoDiff);
+        for (const auto &[nStart, nEnd] : aoDiff)
+            AddEdge(nStart, nY, nEnd, nY);
+
+        // Valid above and not below: walk towards decreasing X
+        aoDiff.clear();
+        GDALFootprintSubtractRuns(aoAbove, aoBelow, aoDiff);
+        for (const auto &[nStart, nEnd] : aoDiff)
+            AddEdge(nEnd, nY, nStart, nY);
+
+        if (nY < nYSize)
+        {
+            for (const auto &[nStart, nEnd] : aoBelow)
+            {
+                AddEdge(nStart, nY + 1, nStart, nY);
+                AddEdge(nEnd, nY, nEnd, nY + 1);
+            }
+        }
+    }
+    std::sort(asEdges.begin(), asEdges.end(),
+              [](const GDALFootprintEdge &a, const GDALFootprintEdge &b)
+              { return a.nStartKey < b.nStartKey; });
+
+    // Returns the edge following iEdge. At vertices shared by two diagonal
+    // valid pixels, turning right keeps them in separate rings, as
+    // GDALPolygonize() does with 4-connectedness.
+    const auto GetNextEdge = [&asEdges](size_t iEdge)
+    {
+        const auto &sEdge = asEdges[iEdge];
+        const uint64_t nKey = GDALFootprintVertexKey(sEdge.nX1, sEdge.nY1);
+        auto oIter = std::lower_bound(
+            asEdges.begin(), asEdges.end(), nKey,
+            [](const GDALFootprintEdge &a, uint64_t nVal)
+            { return a.nStartKey < nVal; });
+        CPLAssert(oIter != asEdges.end() && oIter->nStartKey == nKey);
+        auto oNext = oIter + 1;
+        if (oNext != asEdges.end() && oNext->nStartKey == nKey)
+        {
+            const int nDX = (sEdge.nX1 > sEdge.nX0) - (sEdge.nX1 < sEdge.nX0);
+            const int nDY = (sEdge.nY1 > sEdge.nY0) - (sEdge.nY1 < sEdge.nY0);
+            const int nNextDX =
+                (oNext->nX1 > oNext->nX0) - (oNext->nX1 < oNext->nX0);
+            const int nNextDY =
+                (oNext->nY1 > oNext->nY0) - (oNext->nY1 < oNext->nY0);
+            // Right turn of (nDX, nDY) with the Y axis pointing downwards
+            if (nNextDX == -nDY && nNextDY == nDX)
+                oIter = oNext;
+        }
+        return static_cast<size_t>(oIter - asEdges.begin());
+    };
+
+    // Chain edges into closed paths, and split them into simple rings at
+    // vertices they go through several times.
+    std::vector<std::unique_ptr<OGRLinearRing>> apoRings;
+    std::vector<bool> abUsed(asEdges.size());
+    std::vector<std::pair<int, int>> aoPath;
+    std::map<uint64_t, size_t> oMapVertexToPathIdx;
+    const auto EmitRing = [&apoRings](const std::pair<int, int> *pasPoints,
+                                      size_t nPoints)
+    {
+        // Only keep corners
+        std::vector<std::pair<int, int>> aoCorners;
+        for (size_t i = 0; i < nPoints; ++i)
+        {
+            const auto &oPrev = pasPoints[(i + nPoints - 1) % nPoints];
+            const auto &oCur = pasPoints[i];
+            const auto &oNext = pasPoints[(i + 1) % nPoints];
+            if (!(oPrev.first == oCur.first && oCur.first == oNext.first) &&
+                !(oPrev.second == oCur.second && oCur.second == oNext.second))
+            {
+                aoCorners.push_back(oCur);
+            }
+        }
+        if (aoCorners.size() < 4)
+            return;
+        // Start at the top-left corner, and walk backwards so that exterior
+        // rings are clockwise in a Y-up frame.
+        size_t iStart = 0;
+        for (size_t i = 1; i < aoCorners.size(); ++i)
+        {
+            if (std::make_pair(aoCorners[i].second, aoCorners[i].first) <
+                std::make_pair(aoCorners[iStart].second,
+                               aoCorners[iStart].first))
+            {
+                iStart = i;
+            }
+        }
+        auto poRing = std::make_unique<OGRLinearRing>();
+        const size_t nCorners = aoCorners.size();
+        poRing->setNumPoints(static_cast<int>(nCorners + 1), false);
+        for (size_t i = 0; i <= nCorners; ++i)
+        {
+            const auto &oPoint =
+                aoCorners[(iStart + nCorners - (i % nCorners)) % nCorners];
+            poRing->setPoint(static_cast<int>(i), oPoint.first, oPoint.second);
+        }
+        apoRings.push_back(std::move(poRing));
+    };
+
+    for (size_t iFirst = 0; iFirst < asEdges.size(); ++iFirst)
+    {
+        if (abUsed[iFirst])
+            continue;
+        aoPath.clear();
+        oMapVertexToPathIdx.clear();
+        size_t iEdge = iFirst;
+        do
+        {
+            abUsed[iEdge] = true;
+            const auto &sEdge = asEdges[iEdge];
+            const auto oIter = oMapVertexToPathIdx.find(sEdge.nStartKey);
+            if (oIter != oMapVertexToPathIdx.end())
+            {
+                const size_t nIdx = oIter->second;
+                EmitRing(aoPath.data() + nIdx, aoPath.size() - nIdx);
+                for (size_t i = nIdx + 1; i < aoPath.size(); ++i)
+                {
+                    oMapVertexToPathIdx.erase(GDALFootprintVertexKey(
+                        aoPath[i].first, aoPath[i].second));
+                }
+                aoPath.resize(nIdx + 1);
+            }
+            else
+            {
+                oMapVertexToPathIdx[sEdge.nStartKey] = aoPath.size();
+                aoPath.emplace_back(sEdge.nX0, sEdge.nY0);
+            }
+            iEdge = GetNextEdge(iEdge);
+        } while (iEdge != iFirst);
+        EmitRing(aoPath.data(), aoPath.size());
+    }
+
+    // Assign interior rings to exterior rings
+    std::vector<std::unique_ptr<OGRPolygon>> apoPolygons;
+    if (apoRings.empty())
+        return apoPolygons;
+    std::vector<OGRGeometry *> apoTmpPolygons;
+    for (auto &poRing : apoRings)
+    {
+        auto poPoly = std::make_unique<OGRPolygon>();
+        poPoly->addRingDirectly(poRing.release());
+        apoTmpPolygons.push_back(poPoly.release());
+    }
+    const char *apszOptions[] = {"METHOD=ONLY_CCW", nullptr};
+    std::unique_ptr<OGRGeometry> poGeom(OGRGeometryFactory::organizePolygons(
+        apoTmpPolygons.data(), static_cast<int>(apoTmpPolygons.size()),
+        nullptr, apszOptions));
+    if (!poGeom)
+        return apoPolygons;
+    if (poGeom->getGeometryType() == wkbPolygon)
+    {
+        apoPolygons.emplace_back(poGeom.release()->toPolygon());
+    }
+    else if (poGeom->getGeometryType() == wkbMultiPolygon)
+    {
+        auto poMP = poGeom->toMultiPolygon();
+        for (int i = poMP->getNumGeometries() - 1; i >= 0; --i)
+        {
+            apoPolygons.emplace_back(poMP->getGeometryRef(i));
+            poMP->removeGeometry(i, /* bDelete = */ false);
+        }
+    }
+
+    // Sort polygons, and interior rings, by their top-left vertex
+    const auto RingLess = [](const OGRLinearRing *a, const OGRLinearRing *b)
+    {
+        return std::make_pair(a->getY(0), a->getX(0)) <
+               std::make_pair(b->getY(0), b->getX(0));
+    };
+    for (auto &poPoly : apoPolygons)
+    {
+        const int nInteriorRings = poPoly->getNumInteriorRings();
+        if (nInteriorRings > 1)
+        {
+            std::vector<std::unique_ptr<OGRLinearRing>> apoInteriorRings;
+            for (int i = 0; i < nInteriorRings; ++i)
+                apoInteriorRings.emplace_back(poPoly->stealInteriorRing(i));
+            auto poNewPoly = std::make_unique<OGRPolygon>();
+            poNewPoly->addRingDirectly(poPoly->stealExteriorRing());
+            std::sort(apoInteriorRings.begin(), apoInteriorRings.end(),
+                      [&RingLess](const std::unique_ptr<OGRLinearRing> &a,
+                                  const std::unique_ptr<OGRLinearRing> &b)
+                      { return RingLess(a.get(), b.get()); });
+            for (auto &poRing : apoInteriorRings)
+                poNewPoly->addRingDirectly(poRing.release());
+            poPoly = std::move(poNewPoly);
+        }
+    }
+    std::sort(apoPolygons.begin(), apoPolygons.end(),
+              [&RingLess](const std::unique_ptr<OGRPolygon> &a,
+                          const std::unique_ptr<OGRPolygon> &b)
+              {
+                  return RingLess(a->getExteriorRing(), b->getExteriorRing());
+              });
+    return apoPolygons;
+}
+
+/************************************************************************/
+/*                   GDALFootprintReopenThreadSafe()                    */
+/************************************************************************/
+
+/** Reopens poSrcDS in GDAL_OF_THREAD_SAFE mode, so that its mask can be read
+ * by several threads, provided that it shows the same state. */
+static std::unique_ptr<GDALDataset>
+GDALFootprintReopenThreadSafe(GDALDataset *poSrcDS,
+                              const std::vector<int> &anBands)
+{
+    // Pending modifications would not be seen by the reopened dataset
+    GDALDriver *poDriver = poSrcDS->GetDriver();
+    if (!poDriver || EQUAL(poDriver->GetDescription(), "MEM") ||
+        poSrcDS->GetDescription()[0] == '\0' ||
+        poSrcDS->GetAccess() != GA_ReadOnly)
+    {
+        return nullptr;
+    }
+
+    CPLStringList aosAllowedDrivers;
+    aosAllowedDrivers.AddString(poDriver->GetDescription());
+    CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+    std::unique_ptr<GDALDataset> poTSDS(GDALDataset::Open(
+        poSrcDS->GetDescription(), GDAL_OF_RASTER | GDAL_OF_THREAD_SAFE,
+        aosAllowedDrivers.List(), poSrcDS->GetOpenOptions(), nullptr));
+    if (!poTSDS || poTSDS->GetRasterXSize() != poSrcDS->GetRasterXSize() ||
+        poTSDS->GetRasterYSize() != poSrcDS->GetRasterYSize() ||
+        poTSDS->GetRasterCount() != poSrcDS->GetRasterCount())
+    {
+        return nullptr;
+    }
+    for (int nBand : anBands)
+    {
+        auto poSrcBand = poSrcDS->GetRasterBand(nBand);
+        auto poTSBand = poTSDS->GetRasterBand(nBand);
+        int bSrcHasNoData = false;
+        int bTSHasNoData = false;
+        const double dfSrcNoData = poSrcBand->GetNoDataValue(&bSrcHasNoData);
+        const double dfTSNoData = poTSBand->GetNoDataValue(&bTSHasNoData);
+        if (poSrcBand->GetMaskFlags() != poTSBand->GetMaskFlags() ||
+            poSrcBand->GetColorInterpretation() !=
+                poTSBand->GetColorInterpretation() ||
+            poSrcBand->GetOverviewCount() != poTSBand->GetOverviewCount() ||
+            bSrcHasNoData != bTSHasNoData ||
+            (bSrcHasNoData && !(dfSrcNoData == dfTSNoData ||
+                                (std::isnan(dfSrcNoData) &&
+                                 std::isnan(dfTSNoData)))))
+        {
+            return nullptr;
+        }
+    }
+    return poTSDS;
+}
+
+/************************************************************************/
+/*                         GDALFootprintStripJob                        */
+/************************************************************************/
+
+namespace
+{
+struct GDALFootprintStripJob
+{
+    GDALDataset *poTSDS = nullptr;
+    const GDALFootprintOptions *psOptions = nullptr;
+    const std::vector<int> *panBands = nullptr;
+    const std::vector<double> *padfSrcNoData = nullptr;
+    std::vector<GDALFootprintLineRuns> *paoLines = nullptr;
+    int nYStart = 0;
+    int nYEnd = 0;
+    std::atomic<int> *pnLinesDone = nullptr;
+    std::atomic<int> *pnJobsFinished = nullptr;
+    std::atomic<bool> *pbStop = nullptr;
+    std::atomic<bool> *pbError = nullptr;
+};
+}  // namespace
+
+static void GDALFootprintStripJobFunc(void *pData)
+{
+    auto psJob = static_cast<GDALFootprintStripJob *>(pData);
+    if (!*psJob->pbStop)
+    {
+        // Each job builds its own mask bands on top of the thread-safe
+        // dataset.
+        GDALFootprintMaskChain oChain;
+        if (GDALFootprintBuildMaskChain(psJob->poTSDS, psJob->psOptions,
+                                        *psJob->panBands,
+                                        *psJob->padfSrcNoData, oChain) &&
+            GDALFootprintReadStrip(oChain.poMaskForRasterize.get(),
+                                   psJob->nYStart, psJob->nYEnd,
+                                   *psJob->paoLines))
+        {
+            *psJob->pnLinesDone += psJob->nYEnd - psJob->nYStart;
+        }
+        else
+        {
+            *psJob->pbError = true;
+            *psJob->pbStop = true;
+        }
+    }
+    ++(*psJob->pnJobsFinished);
+}
+
+/************************************************************************/
+/*                    GDALFootprintComputePolygons()                    */
+/************************************************************************/
+
+static bool GDALFootprintComputePolygons(
+    GDALDataset *poSrcDS, const GDALFootprintOptions *psOptions,
+    const std::vector<int> &anBands, const std::vector<double> &adfSrcNoData,
+    GDALRasterBand *poMaskBand,
+    std::vector<std::unique_ptr<OGRPolygon>> &apoPolygons)
+{
+    const int nYSize = poMaskBand->GetYSize();
+    std::vector<GDALFootprintLineRuns> aoLines;
+    try
+    {
+        aoLines.resize(nYSize);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "Out of memory");
+        return false;
+    }
+
+    // Strips of whole blocks, of at least 256 lines
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poMaskBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    nBlockYSize = std::max(1, nBlockYSize);
+    const int nStripLines = nBlockYSize * std::max(1, 256 / nBlockYSize);
+    const int nStrips = static_cast<int>(
+        (static_cast<int64_t>(nYSize) + nStripLines - 1) / nStripLines);
+
+    const int nThreads = std::min(
+        nStrips,
+        GDALGetNumThreadsFromSwitch(psOptions->osNumThreads.empty()
+                                        ? nullptr
+                                        : psOptions->osNumThreads.c_str()));
+    std::unique_ptr<GDALDataset> poTSDS;
+    std::unique_ptr<CPLJobQueue> poQueue;
+    if (nThreads > 1)
+    {
+        poTSDS = GDALFootprintReopenThreadSafe(poSrcDS, anBands);
+        CPLWorkerThreadPool *poThreadPool =
+            poTSDS ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+        if (poThreadPool)
+            poQueue = poThreadPool->CreateJobQueue();
+    }
+
+    if (poQueue)
+    {
+        std::atomic<int> nLinesDone{0};
+        std::atomic<int> nJobsFinished{0};
+        std::atomic<bool> bStop{false};
+        std::atomic<bool> bError{false};
+        std::vector<GDALFootprintStripJob> asJobs(nStrips);
+        for (int i = 0; i < nStrips; ++i)
+        {
+            auto &sJob = asJobs[i];
+            sJob.poTSDS = poTSDS.get();
+            sJob.psOptions = psOptions;
+            sJob.panBands = &anBands;
+            sJob.padfSrcNoData = &adfSrcNoData;
+            sJob.paoLines = &aoLines;
+            sJob.nYStart = i * nStripLines;
+            sJob.nYEnd = std::min(nYSize, (i + 1) * nStripLines);
+            sJob.pnLinesDone = &nLinesDone;
+            sJob.pnJobsFinished = &nJobsFinished;
+            sJob.pbStop = &bStop;
+            sJob.pbError = &bError;
+            if (!poQueue->SubmitJob(GDALFootprintStripJobFunc, &sJob))
+                GDALFootprintStripJobFunc(&sJob);
+        }
+
+        bool bCanceled = false;
+        int nFinished;
+        while ((nFinished = nJobsFinished) < nStrips)
+        {
+            if (!bCanceled &&
+                !psOptions->pfnProgress(double(nLinesDone) / nYSize, "",
+                                        psOptions->pProgressData))
+            {
+                bCanceled = true;
+                bStop = true;
+            }
+            poQueue->WaitCompletion(nStrips - nFinished - 1);
+        }
+        poQueue->WaitCompletion();
+        if (bCanceled)
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return false;
+        }
+        if (bError)
+            return false;
+    }
+    else
+    {
+        for (int nY = 0; nY < nYSize; nY += nStripLines)
+        {
+            const int nYEnd = std::min(nYSize, nY + nStripLines);
+            if (!GDALFootprintReadStrip(poMaskBand, nY, nYEnd, aoLines))
+                return false;
+            if (!psOptions->pfnProgress(double(nYEnd) / nYSize, "",
+                                        psOptions->pProgressData))
+            {
+                CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+                return false;
+            }
         }
     }
 
+    apoPolygons = GDALFootprintTraceRuns(aoLines);
+    psOptions->pfnProgress(1.0, "", psOptions->pProgressData);
+    return true;
+}
+
+/************************************************************************/
+/*                       GDALFootprintProcess()                         */
+/************************************************************************/
+
+static bool GDALFootprintProcess(GDALDataset *poSrcDS, OGRLayer *poDstLayer,
+                                 const GDALFootprintOptions *psOptions)
+{
+    std::unique_ptr<OGRCoordinateTransformation> poCT_SRS;
+    const OGRSpatialReference *poDstSRS = poDstLayer->GetSpatialRef();
+    if (!psOptions->oOutputSRS.IsEmpty())
+        poDstSRS = &(psOptions->oOutputSRS);
+    if (poDstSRS)
+    {
+        auto poSrcSRS = poSrcDS->GetSpatialRef();
+        if (!poSrcSRS)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Output layer has CRS, but input is not georeferenced");
+            return false;
+        }
+        poCT_SRS.reset(OGRCreateCoordinateTransformation(poSrcSRS, poDstSRS));
+        if (!poCT_SRS)
+            return false;
+    }
+
+    std::vector<int> anBands = psOptions->anBands;
+    const int nBandCount = poSrcDS->GetRasterCount();
+    if (anBands.empty())
+    {
+        for (int i = 1; i <= nBandCount; ++i)
+            anBands.push_back(i);
+    }
+
+    const CPLStringList aosSrcNoData(
+        CSLTokenizeString2(psOptions->osSrcNoData.c_str(), " ", 0));
+    std::vector<double> adfSrcNoData;
+    if (!psOptions->osSrcNoData.empty())
+    {
+        if (aosSrcNoData.size() != 1 &&
+            static_cast<size_t>(aosSrcNoData.size()) != anBands.size())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Number of values in -srcnodata should be 1 or the number "
+                     "of bands");
+            return false;
+        }
+        for (int i = 0; i < aosSrcNoData.size(); ++i)
+        {
+            adfSrcNoData.emplace_back(CPLAtof(aosSrcNoData[i]));
+        }
+    }
+    GDALFootprintMaskChain oChain;
+    if (!GDALFootprintBuildMaskChain(poSrcDS, psOptions, anBands, adfSrcNoData,
+                                     oChain))
+    {
+        return false;
+    }
+    const auto &apoSrcMaskBands = oChain.apoSrcMaskBands;
+
     std::unique_ptr<OGRCoordinateTransformation> poCT_GT;
     std::array<double, 6> adfGeoTransform{{0.0, 1.0, 0.0, 0.0, 0.0, 1.0}};
     if (psOptions->bOutCSGeoref &&
@@ -1008,28 +1652,20 @@ static bool GDALFootprintProcess(GDALDataset *poSrcDS, OGRLayer *poDstLayer,
             adfGeoTransform);
     }
 
-    std::unique_ptr<GDALRasterBand> poMaskForRasterize;
-    if (bGlobalMask || anBands.size() == 1)
+    std::vector<std::unique_ptr<OGRPolygon>> apoPolygons;
+    if (!GDALFootprintComputePolygons(poSrcDS, psOptions, anBands, adfSrcNoData,
+                                      oChain.poMaskForRasterize.get(),
+                                      apoPolygons))
     {
-        poMaskForRasterize =
-            std::make_unique<GDALFootprintMaskBand>(apoSrcMaskBands[0]);
-    }
-    else
-    {
-        poMaskForRasterize = std::make_unique<GDALFootprintCombinedMaskBand>(
-            apoSrcMaskBands, psOptions->bCombineBandsUnion);
+        return false;
     }
-
-    auto hBand = GDALRasterBand::ToHandle(poMaskForRasterize.get());
     auto poMemLayer = std::make_unique<OGRMemLayer>("", nullptr, wkbUnknown);
-    const CPLErr eErr =
-        GDALPolygonize(hBand, hBand, OGRLayer::ToHandle(poMemLayer.get()),
-                       /* iPixValField = */ -1,
-                       /* papszOptions = */ nullptr, psOptions->pfnProgress,
-                       psOptions->pProgressData);
-    if (eErr != CE_None)
+    for (auto &poPoly : apoPolygons)
     {
-        return false;
+        auto poFeature =
+            std::make_unique<OGRFeature>(poMemLayer->GetLayerDefn());
+        poFeature->SetGeometryDirectly(poPoly.release());
+        CPL_IGNORE_RET_VAL(poMemLayer->CreateFeature(poFeature.get()));
     }
 
     if (!psOptions->bSplitPolys)
@@ -25,11 +25,15 @@
  * DEALINGS IN THE SOFTWARE.
  ****************************************************************************/
 
+#include <algorithm>
 #include <limits>
+#include <stdexcept>
+#include <vector>
 
 #include "commonutils.h"
 #include "gdal.h"
 #include "gdalargumentparser.h"
+#include "ogrsf_frmts.h"
 
 #include "viewshed.h"
 
@@ -64,16 +68,21 @@ MAIN_START(argc, argv)
     argParser.add_output_format_argument(opts.outputFormat);
     argParser.add_argument("-ox")
         .store_into(opts.observer.x)
-        .required()
         .metavar("<value>")
         .help(_("The X position of the observer (in SRS units)."));
 
     argParser.add_argument("-oy")
         .store_into(opts.observer.y)
-        .required()
         .metavar("<value>")
         .help(_("The Y position of the observer (in SRS units)."));
 
+    std::string osObserversFilename;
+    argParser.add_argument("-observers")
+        .store_into(osObserversFilename)
+        .metavar("<filename>")
+        .help(_("Vector dataset whose point features are observers. A "
+                "cumulative viewshed is generated."));
+
     argParser.add_argument("-oz")
         .default_value(2)
         .store_into(opts.observer.z)
@@ -186,6 +195,25 @@ MAIN_START(argc, argv)
         std::exit(1);
     }
 
+    if (osObserversFilename.empty())
+    {
+        for (const char *pszArg : {"-ox", "-oy"})
+        {
+            if (!argParser.is_used(pszArg))
+            {
+                argParser.display_error_and_usage(
+                    std::runtime_error(std::string(pszArg) + ": required."));
+                std::exit(1);
+            }
+        }
+    }
+    else if (opts.outputMode != Viewshed::OutputMode::Normal)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "-om cannot be used with -observers.");
+        exit(2);
+    }
+
     if (opts.maxDistance < 0)
     {
         CPLError(CE_Failure, CPLE_AppDefined,
@@ -243,13 +271,57 @@ MAIN_START(argc, argv)
         }
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Read the observers of the cumulative mode.                      */
+    /* -------------------------------------------------------------------- */
+    std::vector<Viewshed::Point> observers;
+    if (!osObserversFilename.empty())
+    {
+        auto poObserversDS = std::unique_ptr<GDALDataset>(
+            GDALDataset::Open(osObserversFilename.c_str(), GDAL_OF_VECTOR));
+        if (!poObserversDS)
+            exit(2);
+        for (auto *poLayer : poObserversDS->GetLayers())
+        {
+            for (const auto &poFeature : *poLayer)
+            {
+                const OGRGeometry *poGeom = poFeature->GetGeometryRef();
+                if (poGeom &&
+                    wkbFlatten(poGeom->getGeometryType()) == wkbPoint)
+                {
+                    const OGRPoint *poPoint = poGeom->toPoint();
+                    observers.push_back(
+                        {poPoint->getX(), poPoint->getY(), opts.observer.z});
+                }
+            }
+        }
+        if (observers.empty())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "No point feature found in %s.",
+                     osObserversFilename.c_str());
+            exit(2);
+        }
+
+        const char *pszNumThreads =
+            CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+        opts.numThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                              ? CPLGetNumCPUs()
+                              : atoi(pszNumThreads);
+        opts.numThreads = std::max(1, std::min(opts.numThreads, 1024));
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Invoke.                                                         */
     /* -------------------------------------------------------------------- */
     Viewshed oViewshed(opts);
 
+    GDALProgressFunc pfnProgress =
+        bQuiet ? GDALDummyProgress : GDALTermProgress;
     bool bSuccess =
-        oViewshed.run(hBand, bQuiet ? GDALDummyProgress : GDALTermProgress);
+        observers.empty()
+            ? oViewshed.run(hBand, pfnProgress)
+            : oViewshed.runCumulative(hBand, observers, pfnProgress);
 
     GDALDatasetH hDstDS = GDALDataset::FromHandle(oViewshed.output().release());
 
@@ -254,6 +254,7 @@ class VRTBuilder
     bool bUseSrcMaskBand = true;
     bool bNoDataFromMask = false;
     double dfMaskValueThreshold = 0;
+    int nNumThreads = 1;
 
     /* Internal variables */
     char *pszProjectionRef = nullptr;
@@ -291,7 +292,7 @@ class VRTBuilder
                const char *pszVRTNoData, bool bUseSrcMaskBand,
                bool bNoDataFromMask, double dfMaskValueThreshold,
                const char *pszOutputSRS, const char *pszResampling,
-               const char *const *papszOpenOptionsIn);
+               const char *const *papszOpenOptionsIn, int nNumThreadsIn);
 
     ~VRTBuilder();
 
@@ -313,8 +314,9 @@ VRTBuilder::VRTBuilder(
     const char *pszSrcNoDataIn, const char *pszVRTNoDataIn,
     bool bUseSrcMaskBandIn, bool bNoDataFromMaskIn,
     double dfMaskValueThresholdIn, const char *pszOutputSRSIn,
-    const char *pszResamplingIn, const char *const *papszOpenOptionsIn)
-    : bStrict(bStrictIn)
+    const char *pszResamplingIn, const char *const *papszOpenOptionsIn,
+    int nNumThreadsIn)
+    : bStrict(bStrictIn), nNumThreads(nNumThreadsIn)
 {
     pszOutputFilename = CPLStrdup(pszOutputFilenameIn);
     nInputFiles = nInputFilesIn;
@@ -1540,6 +1542,15 @@ GDALDataset *VRTBuilder::Build(GDALProgressFunc pfnProgress,
         }
     }
 
+    // Sources are opened ahead by a thread pool, but analyzed in order, so
+    // that the result does not depend on the number of threads.
+    std::unique_ptr<GDALOrderedDatasetOpener> poOpener;
+    if (pahSrcDS == nullptr)
+    {
+        poOpener = std::make_unique<GDALOrderedDatasetOpener>(
+            nNumThreads, GDAL_OF_RASTER, papszOpenOptions);
+    }
+
     bool bFoundValid = false;
     for (int i = 0; ppszInputFilenames != nullptr && i < nInputFiles; i++)
     {
@@ -1550,10 +1561,20 @@ GDALDataset *VRTBuilder::Build(GDALProgressFunc pfnProgress,
             return nullptr;
         }
 
-        GDALDatasetH hDS = (pahSrcDS)
-                               ? pahSrcDS[i]
-                               : GDALOpenEx(dsFileName, GDAL_OF_RASTER, nullptr,
-                                            papszOpenOptions, nullptr);
+        std::unique_ptr<GDALDataset> poDSOwned;
+        GDALDatasetH hDS = nullptr;
+        if (pahSrcDS)
+        {
+            hDS = pahSrcDS[i];
+        }
+        else
+        {
+            // nInputFiles may have grown with subdatasets of previous sources
+            while (poOpener->size() < static_cast<size_t>(nInputFiles))
+                poOpener->Add(ppszInputFilenames[poOpener->size()]);
+            poDSOwned = poOpener->Get(i);
+            hDS = GDALDataset::ToHandle(poDSOwned.get());
+        }
         asDatasetProperties[i].isFileOK = FALSE;
 
         if (hDS)
@@ -1565,8 +1586,7 @@ GDALDataset *VRTBuilder::Build(GDALProgressFunc pfnProgress,
                 bFoundValid = true;
                 bFirst = FALSE;
             }
-            if (pahSrcDS == nullptr)
-                GDALClose(hDS);
+            poDSOwned.reset();
             if (!osErrorMsg.empty() && osErrorMsg != "SILENTLY_IGNORE")
             {
                 if (bStrict)
@@ -1759,6 +1779,7 @@ struct GDALBuildVRTOptions
     bool bUseSrcMaskBand = true;
     bool bNoDataFromMask = false;
     double dfMaskValueThreshold = 0;
+    std::string osNumThreads{};
 
     /*! allow or suppress progress monitor and other non-error output */
     bool bQuiet = true;
@@ -1906,7 +1927,10 @@ GDALDatasetH GDALBuildVRT(const char *pszDest, int nSrcCount,
         sOptions.dfMaskValueThreshold,
         sOptions.osOutputSRS.empty() ? nullptr : sOptions.osOutputSRS.c_str(),
         sOptions.osResampling.empty() ? nullptr : sOptions.osResampling.c_str(),
-        sOptions.aosOpenOptions.List());
+        sOptions.aosOpenOptions.List(),
+        GDALGetNumThreadsFromSwitch(sOptions.osNumThreads.empty()
+                                        ? nullptr
+                                        : sOptions.osNumThreads.c_str()));
 
     return GDALDataset::ToHandle(
         oBuilder.Build(sOptions.pfnProgress, sOptions.pProgressData));
@@ -2156,6 +2180,11 @@ GDALBuildVRTOptionsGetParser(GDALBuildVRTOptions *psOptions,
 
     argParser->add_open_options_argument(&psOptions->aosOpenOptions);
 
+    argParser->add_argument("-num_threads")
+        .metavar("<value>|ALL_CPUS")
+        .store_into(psOptions->osNumThreads)
+        .help(_("Number of threads used to open source datasets."));
+
     argParser->add_argument("-ignore_srcmaskband")
         .flag()
         .action([psOptions](const std::string &)
@@ -111,6 +111,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <vector>
 
 #include "cpl_error.h"
 #include "cpl_progress.h"
@@ -118,6 +119,7 @@
 #include "cpl_vsi.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 #if defined(__SSE2__) || defined(_M_X64)
 #define HAVE_16_SSE_REG
@@ -294,6 +296,369 @@ GInt32 INTERPOL(GInt32 a, GInt32 b, int bSrcHasNoData, GInt32 fSrcNoDataValue)
     return nVal;
 }
 
+/************************************************************************/
+/*                     GDALGeneric3x3ProcessingContext                  */
+/************************************************************************/
+
+// Parameters shared by all lines processed by GDALGeneric3x3Processing()
+template <class T> struct GDALGeneric3x3ProcessingContext
+{
+    typename GDALGeneric3x3ProcessingAlg<T>::type pfnAlg = nullptr;
+    typename GDALGeneric3x3ProcessingAlg_multisample<T>::type
+        pfnAlg_multisample = nullptr;
+    void *pData = nullptr;
+    bool bComputeAtEdges = false;
+    int nXSize = 0;
+    int nYSize = 0;
+    int bSrcHasNoData = FALSE;
+    T fSrcNoDataValue = 0;
+    bool bIsSrcNoDataNan = false;
+    float fDstNoDataValue = 0;
+};
+
+/************************************************************************/
+/*                    GDALGeneric3x3LineHasNoData()                     */
+/************************************************************************/
+
+template <class T>
+static bool GDALGeneric3x3LineHasNoData(const T *pafLine, int nXSize,
+                                        T fSrcNoDataValue)
+{
+    int iX = 0;
+    for (; iX + 3 < nXSize; iX += 4)
+    {
+        if (pafLine[iX] == fSrcNoDataValue ||
+            pafLine[iX + 1] == fSrcNoDataValue ||
+            pafLine[iX + 2] == fSrcNoDataValue ||
+            pafLine[iX + 3] == fSrcNoDataValue)
+        {
+            return true;
+        }
+    }
+    for (; iX < nXSize; iX++)
+    {
+        if (pafLine[iX] == fSrcNoDataValue)
+            return true;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                    GDALGeneric3x3ProcessEdgeLine()                   */
+/************************************************************************/
+
+// Computes the first (bFirstLine) or last line of the raster, in
+// bComputeAtEdges mode, from that line and its only neighbour line.
+template <class T>
+static void
+GDALGeneric3x3ProcessEdgeLine(const GDALGeneric3x3ProcessingContext<T> &sCtxt,
+                              const T *pafEdgeLine, const T *pafInnerLine,
+                              bool bFirstLine, float *pafOutputBuf)
+{
+    const int nXSize = sCtxt.nXSize;
+    for (int j = 0; j < nXSize; j++)
+    {
+        int jmin = (j == 0) ? j : j - 1;
+        int jmax = (j == nXSize - 1) ? j : j + 1;
+
+        const T afOutside[3] = {
+            INTERPOL(pafEdgeLine[jmin], pafInnerLine[jmin],
+                     sCtxt.bSrcHasNoData, sCtxt.fSrcNoDataValue),
+            INTERPOL(pafEdgeLine[j], pafInnerLine[j], sCtxt.bSrcHasNoData,
+                     sCtxt.fSrcNoDataValue),
+            INTERPOL(pafEdgeLine[jmax], pafInnerLine[jmax],
+                     sCtxt.bSrcHasNoData, sCtxt.fSrcNoDataValue)};
+        const T afEdge[3] = {pafEdgeLine[jmin], pafEdgeLine[j],
+                             pafEdgeLine[jmax]};
+        const T afInner[3] = {pafInnerLine[jmin], pafInnerLine[j],
+                              pafInnerLine[jmax]};
+        const T *pafTop = bFirstLine ? afOutside : afInner;
+        const T *pafBottom = bFirstLine ? afInner : afOutside;
+
+        T afWin[9] = {pafTop[0],    pafTop[1],    pafTop[2],
+                      afEdge[0],    afEdge[1],    afEdge[2],
+                      pafBottom[0], pafBottom[1], pafBottom[2]};
+        pafOutputBuf[j] = ComputeVal(
+            CPL_TO_BOOL(sCtxt.bSrcHasNoData), sCtxt.fSrcNoDataValue,
+            sCtxt.bIsSrcNoDataNan, afWin, sCtxt.fDstNoDataValue, sCtxt.pfnAlg,
+            sCtxt.pData, sCtxt.bComputeAtEdges);
+    }
+}
+
+/************************************************************************/
+/*                   GDALGeneric3x3ProcessInnerLine()                   */
+/************************************************************************/
+
+// Computes a line that has a line above and below it in the raster.
+template <class T>
+static void
+GDALGeneric3x3ProcessInnerLine(const GDALGeneric3x3ProcessingContext<T> &sCtxt,
+                               const T *pafThreeLineWin, int nLine1Off,
+                               int nLine2Off, int nLine3Off,
+                               bool bOneOfThreeLinesHasNoData,
+                               float *pafOutputBuf)
+{
+    const int nXSize = sCtxt.nXSize;
+    const int bSrcHasNoData = sCtxt.bSrcHasNoData;
+    const T fSrcNoDataValue = sCtxt.fSrcNoDataValue;
+
+    if (sCtxt.bComputeAtEdges && nXSize >= 2)
+    {
+        int j = 0;
+        T afWin[9] = {INTERPOL(pafThreeLineWin[nLine1Off + j],
+                               pafThreeLineWin[nLine1Off + j + 1],
+                               bSrcHasNoData, fSrcNoDataValue),
+                      pafThreeLineWin[nLine1Off + j],
+                      pafThreeLineWin[nLine1Off + j + 1],
+                      INTERPOL(pafThreeLineWin[nLine2Off + j],
+                               pafThreeLineWin[nLine2Off + j + 1],
+                               bSrcHasNoData, fSrcNoDataValue),
+                      pafThreeLineWin[nLine2Off + j],
+                      pafThreeLineWin[nLine2Off + j + 1],
+                      INTERPOL(pafThreeLineWin[nLine3Off + j],
+                               pafThreeLineWin[nLine3Off + j + 1],
+                               bSrcHasNoData, fSrcNoDataValue),
+                      pafThreeLineWin[nLine3Off + j],
+                      pafThreeLineWin[nLine3Off + j + 1]};
+
+        pafOutputBuf[j] = ComputeVal(
+            bOneOfThreeLinesHasNoData, fSrcNoDataValue, sCtxt.bIsSrcNoDataNan,
+            afWin, sCtxt.fDstNoDataValue, sCtxt.pfnAlg, sCtxt.pData,
+            sCtxt.bComputeAtEdges);
+    }
+    else
+    {
+        // Exclude the edges
+        pafOutputBuf[0] = sCtxt.fDstNoDataValue;
+    }
+
+    int j = 1;
+    if (sCtxt.pfnAlg_multisample && !bOneOfThreeLinesHasNoData)
+    {
+        j = sCtxt.pfnAlg_multisample(pafThreeLineWin, nLine1Off, nLine2Off,
+                                     nLine3Off, nXSize, sCtxt.pData,
+                                     pafOutputBuf);
+    }
+
+    for (; j < nXSize - 1; j++)
+    {
+        T afWin[9] = {pafThreeLineWin[nLine1Off + j - 1],
+                      pafThreeLineWin[nLine1Off + j],
+                      pafThreeLineWin[nLine1Off + j + 1],
+                      pafThreeLineWin[nLine2Off + j - 1],
+                      pafThreeLineWin[nLine2Off + j],
+                      pafThreeLineWin[nLine2Off + j + 1],
+                      pafThreeLineWin[nLine3Off + j - 1],
+                      pafThreeLineWin[nLine3Off + j],
+                      pafThreeLineWin[nLine3Off + j + 1]};
+
+        pafOutputBuf[j] = ComputeVal(
+            bOneOfThreeLinesHasNoData, fSrcNoDataValue, sCtxt.bIsSrcNoDataNan,
+            afWin, sCtxt.fDstNoDataValue, sCtxt.pfnAlg, sCtxt.pData,
+            sCtxt.bComputeAtEdges);
+    }
+
+    if (sCtxt.bComputeAtEdges && nXSize >= 2)
+    {
+        j = nXSize - 1;
+
+        T afWin[9] = {pafThreeLineWin[nLine1Off + j - 1],
+                      pafThreeLineWin[nLine1Off + j],
+                      INTERPOL(pafThreeLineWin[nLine1Off + j],
+                               pafThreeLineWin[nLine1Off + j - 1],
+                               bSrcHasNoData, fSrcNoDataValue),
+                      pafThreeLineWin[nLine2Off + j - 1],
+                      pafThreeLineWin[nLine2Off + j],
+                      INTERPOL(pafThreeLineWin[nLine2Off + j],
+                               pafThreeLineWin[nLine2Off + j - 1],
+                               bSrcHasNoData, fSrcNoDataValue),
+                      pafThreeLineWin[nLine3Off + j - 1],
+                      pafThreeLineWin[nLine3Off + j],
+                      INTERPOL(pafThreeLineWin[nLine3Off + j],
+                               pafThreeLineWin[nLine3Off + j - 1],
+                               bSrcHasNoData, fSrcNoDataValue)};
+
+        pafOutputBuf[j] = ComputeVal(
+            bOneOfThreeLinesHasNoData, fSrcNoDataValue, sCtxt.bIsSrcNoDataNan,
+            afWin, sCtxt.fDstNoDataValue, sCtxt.pfnAlg, sCtxt.pData,
+            sCtxt.bComputeAtEdges);
+    }
+    else
+    {
+        // Exclude the edges
+        if (nXSize > 1)
+            pafOutputBuf[nXSize - 1] = sCtxt.fDstNoDataValue;
+    }
+}
+
+/************************************************************************/
+/*                       GDALGeneric3x3ProcessStrip()                   */
+/************************************************************************/
+
+// Strip of lines processed by a job of GDALGeneric3x3ProcessingMT()
+template <class T> struct GDALGeneric3x3Strip
+{
+    const GDALGeneric3x3ProcessingContext<T> *psCtxt = nullptr;
+    // First output line, and number of output lines
+    int nYOff = 0;
+    int nYCount = 0;
+    // First source line: nYOff - 1, or 0 for the first strip
+    int nSrcYOff = 0;
+    int nSrcYCount = 0;
+    std::vector<T> aSrc{};
+    std::vector<float> afDst{};
+};
+
+template <class T> static void GDALGeneric3x3ProcessStrip(void *pData)
+{
+    auto psStrip = static_cast<GDALGeneric3x3Strip<T> *>(pData);
+    const auto &sCtxt = *(psStrip->psCtxt);
+    const int nXSize = sCtxt.nXSize;
+    const int nYSize = sCtxt.nYSize;
+    const T *pafSrc = psStrip->aSrc.data();
+
+    // For integer types, find which source lines contain nodata
+    std::vector<bool> abLineHasNoData(psStrip->nSrcYCount,
+                                      CPL_TO_BOOL(sCtxt.bSrcHasNoData));
+    if (std::numeric_limits<T>::is_integer && sCtxt.bSrcHasNoData)
+    {
+        for (int i = 0; i < psStrip->nSrcYCount; ++i)
+        {
+            abLineHasNoData[i] = GDALGeneric3x3LineHasNoData(
+                pafSrc + static_cast<size_t>(i) * nXSize, nXSize,
+                sCtxt.fSrcNoDataValue);
+        }
+    }
+
+    for (int iLine = 0; iLine < psStrip->nYCount; ++iLine)
+    {
+        const int i = psStrip->nYOff + iLine;
+        const int iSrc = i - psStrip->nSrcYOff;
+        float *pafOutputBuf =
+            psStrip->afDst.data() + static_cast<size_t>(iLine) * nXSize;
+        if (i == 0 || i == nYSize - 1)
+        {
+            if (sCtxt.bComputeAtEdges && nXSize >= 2 && nYSize >= 2)
+            {
+                const bool bFirstLine = (i == 0);
+                GDALGeneric3x3ProcessEdgeLine(
+                    sCtxt, pafSrc + static_cast<size_t>(iSrc) * nXSize,
+                    pafSrc +
+                        static_cast<size_t>(bFirstLine ? iSrc + 1 : iSrc - 1) *
+                            nXSize,
+                    bFirstLine, pafOutputBuf);
+            }
+            else
+            {
+                std::fill(pafOutputBuf, pafOutputBuf + nXSize,
+                          sCtxt.fDstNoDataValue);
+            }
+        }
+        else
+        {
+            GDALGeneric3x3ProcessInnerLine(
+                sCtxt, pafSrc, (iSrc - 1) * nXSize, iSrc * nXSize,
+                (iSrc + 1) * nXSize,
+                abLineHasNoData[iSrc - 1] || abLineHasNoData[iSrc] ||
+                    abLineHasNoData[iSrc + 1],
+                pafOutputBuf);
+        }
+    }
+}
+
+/************************************************************************/
+/*                    GDALGeneric3x3ProcessingMT()                      */
+/************************************************************************/
+
+// Multi-threaded version of GDALGeneric3x3Processing(). The raster is split
+// in strips of whole lines, each of them read with a one-line halo above and
+// below. Reading and writing are done by the calling thread, in order, one
+// batch of nThreads strips at a time, and the strips of a batch are
+// processed in parallel. The result is identical to the single-threaded
+// version.
+template <class T>
+static CPLErr
+GDALGeneric3x3ProcessingMT(GDALRasterBandH hSrcBand, GDALRasterBandH hDstBand,
+                           const GDALGeneric3x3ProcessingContext<T> &sCtxt,
+                           GDALDataType eReadDT, CPLJobQueue *poQueue,
+                           int nThreads, GDALProgressFunc pfnProgress,
+                           void *pProgressData)
+{
+    const int nXSize = sCtxt.nXSize;
+    const int nYSize = sCtxt.nYSize;
+
+    // Aim at about 16 MB of source and destination data per strip
+    const GIntBig nBytesPerLine =
+        static_cast<GIntBig>(nXSize) * (sizeof(T) + sizeof(float));
+    const int nStripHeight = static_cast<int>(std::max<GIntBig>(
+        1, std::min<GIntBig>(DIV_ROUND_UP(nYSize, nThreads),
+                             16 * 1024 * 1024 / nBytesPerLine)));
+
+    std::vector<GDALGeneric3x3Strip<T>> asStrips(nThreads);
+    for (int nBatchYOff = 0; nBatchYOff < nYSize;)
+    {
+        int nStripsInBatch = 0;
+        for (; nStripsInBatch < nThreads && nBatchYOff < nYSize;
+             ++nStripsInBatch)
+        {
+            auto &sStrip = asStrips[nStripsInBatch];
+            sStrip.psCtxt = &sCtxt;
+            sStrip.nYOff = nBatchYOff;
+            sStrip.nYCount = std::min(nStripHeight, nYSize - nBatchYOff);
+            sStrip.nSrcYOff = std::max(0, sStrip.nYOff - 1);
+            sStrip.nSrcYCount =
+                std::min(nYSize, sStrip.nYOff + sStrip.nYCount + 1) -
+                sStrip.nSrcYOff;
+            try
+            {
+                // One extra value, as for the single-threaded window buffer
+                sStrip.aSrc.resize(
+                    static_cast<size_t>(sStrip.nSrcYCount) * nXSize + 1);
+                sStrip.afDst.resize(static_cast<size_t>(sStrip.nYCount) *
+                                    nXSize);
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Out of memory in GDALGeneric3x3ProcessingMT()");
+                poQueue->WaitCompletion();
+                return CE_Failure;
+            }
+            if (GDALRasterIO(hSrcBand, GF_Read, 0, sStrip.nSrcYOff, nXSize,
+                             sStrip.nSrcYCount, sStrip.aSrc.data(), nXSize,
+                             sStrip.nSrcYCount, eReadDT, 0, 0) != CE_None)
+            {
+                poQueue->WaitCompletion();
+                return CE_Failure;
+            }
+            if (!poQueue->SubmitJob(GDALGeneric3x3ProcessStrip<T>, &sStrip))
+                GDALGeneric3x3ProcessStrip<T>(&sStrip);
+            nBatchYOff += sStrip.nYCount;
+        }
+
+        poQueue->WaitCompletion();
+
+        for (int iStrip = 0; iStrip < nStripsInBatch; ++iStrip)
+        {
+            auto &sStrip = asStrips[iStrip];
+            if (GDALRasterIO(hDstBand, GF_Write, 0, sStrip.nYOff, nXSize,
+                             sStrip.nYCount, sStrip.afDst.data(), nXSize,
+                             sStrip.nYCount, GDT_Float32, 0, 0) != CE_None)
+            {
+                return CE_Failure;
+            }
+        }
+
+        if (!pfnProgress(1.0 * nBatchYOff / nYSize, nullptr, pProgressData))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return CE_Failure;
+        }
+    }
+
+    return CE_None;
+}
+
 /************************************************************************/
 /*                  GDALGeneric3x3Processing()                          */
 /************************************************************************/
@@ -322,19 +687,6 @@ static CPLErr GDALGeneric3x3Processing(
     const int nXSize = GDALGetRasterBandXSize(hSrcBand);
     const int nYSize = GDALGetRasterBandYSize(hSrcBand);
 
-    // 1 line destination buffer.
-    float *pafOutputBuf =
-        static_cast<float *>(VSI_MALLOC2_VERBOSE(sizeof(float), nXSize));
-    // 3 line rotating source buffer.
-    T *pafThreeLineWin =
-        static_cast<T *>(VSI_MALLOC2_VERBOSE(3 * sizeof(T), nXSize + 1));
-    if (pafOutputBuf == nullptr || pafThreeLineWin == nullptr)
-    {
-        VSIFree(pafOutputBuf);
-        VSIFree(pafThreeLineWin);
-        return CE_Failure;
-    }
-
     GDALDataType eReadDT;
     int bSrcHasNoData = FALSE;
     const double dfNoDataValue =
@@ -381,6 +733,55 @@ static CPLErr GDALGeneric3x3Processing(
     if (!bDstHasNoData)
         fDstNoDataValue = 0.0;
 
+    GDALGeneric3x3ProcessingContext<T> sCtxt;
+    sCtxt.pfnAlg = pfnAlg;
+    sCtxt.pfnAlg_multisample = pfnAlg_multisample;
+    sCtxt.pData = pData;
+    sCtxt.bComputeAtEdges = bComputeAtEdges;
+    sCtxt.nXSize = nXSize;
+    sCtxt.nYSize = nYSize;
+    sCtxt.bSrcHasNoData = bSrcHasNoData;
+    sCtxt.fSrcNoDataValue = fSrcNoDataValue;
+    sCtxt.bIsSrcNoDataNan = CPL_TO_BOOL(bIsSrcNoDataNan);
+    sCtxt.fDstNoDataValue = fDstNoDataValue;
+
+    /* -------------------------------------------------------------------- */
+    /*      Multi-threaded processing, when GDAL_NUM_THREADS is set.        */
+    /* -------------------------------------------------------------------- */
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    int nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                     : atoi(pszNumThreads);
+    // Do not use more threads than strips of at least 16 lines
+    nThreads = std::max(1, std::min({nThreads, 1024, nYSize / 16}));
+    if (nThreads > 1)
+    {
+        CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+        auto poQueue =
+            poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+        if (poQueue)
+        {
+            const CPLErr eErr = GDALGeneric3x3ProcessingMT(
+                hSrcBand, hDstBand, sCtxt, eReadDT, poQueue.get(), nThreads,
+                pfnProgress, pProgressData);
+            if (eErr == CE_None)
+                pfnProgress(1.0, nullptr, pProgressData);
+            return eErr;
+        }
+    }
+
+    // 1 line destination buffer.
+    float *pafOutputBuf =
+        static_cast<float *>(VSI_MALLOC2_VERBOSE(sizeof(float), nXSize));
+    // 3 line rotating source buffer.
+    T *pafThreeLineWin =
+        static_cast<T *>(VSI_MALLOC2_VERBOSE(3 * sizeof(T), nXSize + 1));
+    if (pafOutputBuf == nullptr || pafThreeLineWin == nullptr)
+    {
+        VSIFree(pafOutputBuf);
+        VSIFree(pafThreeLineWin);
+        return CE_Failure;
+    }
+
     int nLine1Off = 0;
     int nLine2Off = nXSize;
     int nLine3Off = 2 * nXSize;
@@ -413,15 +814,8 @@ static CPLErr GDALGeneric3x3Processing(
             }
             if (std::numeric_limits<T>::is_integer && bSrcHasNoData)
             {
-                abLineHasNoDataValue[i] = false;
-                for (int iX = 0; iX < nXSize; iX++)
-                {
-                    if (pafThreeLineWin[i * nXSize + iX] == fSrcNoDataValue)
-                    {
-                        abLineHasNoDataValue[i] = true;
-                        break;
-                    }
-                }
+                abLineHasNoDataValue[i] = GDALGeneric3x3LineHasNoData(
+                    pafThreeLineWin + i * nXSize, nXSize, fSrcNoDataValue);
             }
         }
     }  // End extra scope for VC12
@@ -429,29 +823,9 @@ static CPLErr GDALGeneric3x3Processing(
     CPLErr eErr = CE_None;
     if (bComputeAtEdges && nXSize >= 2 && nYSize >= 2)
     {
-        for (int j = 0; j < nXSize; j++)
-        {
-            int jmin = (j == 0) ? j : j - 1;
-            int jmax = (j == nXSize - 1) ? j : j + 1;
-
-            T afWin[9] = {
-                INTERPOL(pafThreeLineWin[jmin], pafThreeLineWin[nXSize + jmin],
-                         bSrcHasNoData, fSrcNoDataValue),
-                INTERPOL(pafThreeLineWin[j], pafThreeLineWin[nXSize + j],
-                         bSrcHasNoData, fSrcNoDataValue),
-                INTERPOL(pafThreeLineWin[jmax], pafThreeLineWin[nXSize + jmax],
-                         bSrcHasNoData, fSrcNoDataValue),
-                pafThreeLineWin[jmin],
-                pafThreeLineWin[j],
-                pafThreeLineWin[jmax],
-                pafThreeLineWin[nXSize + jmin],
-                pafThreeLineWin[nXSize + j],
-                pafThreeLineWin[nXSize + jmax]};
-            pafOutputBuf[j] =
-                ComputeVal(CPL_TO_BOOL(bSrcHasNoData), fSrcNoDataValue,
-                           CPL_TO_BOOL(bIsSrcNoDataNan), afWin, fDstNoDataValue,
-                           pfnAlg, pData, bComputeAtEdges);
-        }
+        GDALGeneric3x3ProcessEdgeLine(sCtxt, pafThreeLineWin,
+                                      pafThreeLineWin + nXSize,
+                                      /* bFirstLine = */ true, pafOutputBuf);
         eErr = GDALRasterIO(hDstBand, GF_Write, 0, 0, nXSize, 1, pafOutputBuf,
                             nXSize, 1, GDT_Float32, 0, 0);
     }
@@ -499,122 +873,18 @@ static CPLErr GDALGeneric3x3Processing(
         bool bOneOfThreeLinesHasNoData = CPL_TO_BOOL(bSrcHasNoData);
         if (std::numeric_limits<T>::is_integer && bSrcHasNoData)
         {
-            bool bLastLineHasNoDataValue = false;
-            int iX = 0;
-            for (; iX + 3 < nXSize; iX += 4)
-            {
-                if (pafThreeLineWin[nLine3Off + iX] == fSrcNoDataValue ||
-                    pafThreeLineWin[nLine3Off + iX + 1] == fSrcNoDataValue ||
-                    pafThreeLineWin[nLine3Off + iX + 2] == fSrcNoDataValue ||
-                    pafThreeLineWin[nLine3Off + iX + 3] == fSrcNoDataValue)
-                {
-                    bLastLineHasNoDataValue = true;
-                    break;
-                }
-            }
-            if (!bLastLineHasNoDataValue)
-            {
-                for (; iX < nXSize; iX++)
-                {
-                    if (pafThreeLineWin[nLine3Off + iX] == fSrcNoDataValue)
-                    {
-                        bLastLineHasNoDataValue = true;
-                    }
-                }
-            }
-            abLineHasNoDataValue[nLine3Off / nXSize] = bLastLineHasNoDataValue;
+            abLineHasNoDataValue[nLine3Off / nXSize] =
+                GDALGeneric3x3LineHasNoData(pafThreeLineWin + nLine3Off,
+                                            nXSize, fSrcNoDataValue);
 
             bOneOfThreeLinesHasNoData = abLineHasNoDataValue[0] ||
                                         abLineHasNoDataValue[1] ||
                                         abLineHasNoDataValue[2];
         }
 
-        if (bComputeAtEdges && nXSize >= 2)
-        {
-            int j = 0;
-            T afWin[9] = {INTERPOL(pafThreeLineWin[nLine1Off + j],
-                                   pafThreeLineWin[nLine1Off + j + 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine1Off + j],
-                          pafThreeLineWin[nLine1Off + j + 1],
-                          INTERPOL(pafThreeLineWin[nLine2Off + j],
-                                   pafThreeLineWin[nLine2Off + j + 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine2Off + j],
-                          pafThreeLineWin[nLine2Off + j + 1],
-                          INTERPOL(pafThreeLineWin[nLine3Off + j],
-                                   pafThreeLineWin[nLine3Off + j + 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine3Off + j],
-                          pafThreeLineWin[nLine3Off + j + 1]};
-
-            pafOutputBuf[j] =
-                ComputeVal(CPL_TO_BOOL(bOneOfThreeLinesHasNoData),
-                           fSrcNoDataValue, CPL_TO_BOOL(bIsSrcNoDataNan), afWin,
-                           fDstNoDataValue, pfnAlg, pData, bComputeAtEdges);
-        }
-        else
-        {
-            // Exclude the edges
-            pafOutputBuf[0] = fDstNoDataValue;
-        }
-
-        int j = 1;
-        if (pfnAlg_multisample && !bOneOfThreeLinesHasNoData)
-        {
-            j = pfnAlg_multisample(pafThreeLineWin, nLine1Off, nLine2Off,
-                                   nLine3Off, nXSize, pData, pafOutputBuf);
-        }
-
-        for (; j < nXSize - 1; j++)
-        {
-            T afWin[9] = {pafThreeLineWin[nLine1Off + j - 1],
-                          pafThreeLineWin[nLine1Off + j],
-                          pafThreeLineWin[nLine1Off + j + 1],
-                          pafThreeLineWin[nLine2Off + j - 1],
-                          pafThreeLineWin[nLine2Off + j],
-                          pafThreeLineWin[nLine2Off + j + 1],
-                          pafThreeLineWin[nLine3Off + j - 1],
-                          pafThreeLineWin[nLine3Off + j],
-                          pafThreeLineWin[nLine3Off + j + 1]};
-
-            pafOutputBuf[j] =
-                ComputeVal(CPL_TO_BOOL(bOneOfThreeLinesHasNoData),
-                           fSrcNoDataValue, CPL_TO_BOOL(bIsSrcNoDataNan), afWin,
-                           fDstNoDataValue, pfnAlg, pData, bComputeAtEdges);
-        }
-
-        if (bComputeAtEdges && nXSize >= 2)
-        {
-            j = nXSize - 1;
-
-            T afWin[9] = {pafThreeLineWin[nLine1Off + j - 1],
-                          pafThreeLineWin[nLine1Off + j],
-                          INTERPOL(pafThreeLineWin[nLine1Off + j],
-                                   pafThreeLineWin[nLine1Off + j - 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine2Off + j - 1],
-                          pafThreeLineWin[nLine2Off + j],
-                          INTERPOL(pafThreeLineWin[nLine2Off + j],
-                                   pafThreeLineWin[nLine2Off + j - 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine3Off + j - 1],
-                          pafThreeLineWin[nLine3Off + j],
-                          INTERPOL(pafThreeLineWin[nLine3Off + j],
-                                   pafThreeLineWin[nLine3Off + j - 1],
-                                   bSrcHasNoData, fSrcNoDataValue)};
-
-            pafOutputBuf[j] =
-                ComputeVal(CPL_TO_BOOL(bOneOfThreeLinesHasNoData),
-                           fSrcNoDataValue, CPL_TO_BOOL(bIsSrcNoDataNan), afWin,
-                           fDstNoDataValue, pfnAlg, pData, bComputeAtEdges);
-        }
-        else
-        {
-            // Exclude the edges
-            if (nXSize > 1)
-                pafOutputBuf[nXSize - 1] = fDstNoDataValue;
-        }
+        GDALGeneric3x3ProcessInnerLine(sCtxt, pafThreeLineWin, nLine1Off,
+                                       nLine2Off, nLine3Off,
+                                       bOneOfThreeLinesHasNoData, pafOutputBuf);
 
         /* -----------------------------------------
          * Write Line to Raster
@@ -648,34 +918,9 @@ static CPLErr GDALGeneric3x3Processing(
 
     if (bComputeAtEdges && nXSize >= 2 && nYSize >= 2)
     {
-        for (int j = 0; j < nXSize; j++)
-        {
-            int jmin = (j == 0) ? j : j - 1;
-            int jmax = (j == nXSize - 1) ? j : j + 1;
-
-            T afWin[9] = {
-                pafThreeLineWin[nLine1Off + jmin],
-                pafThreeLineWin[nLine1Off + j],
-                pafThreeLineWin[nLine1Off + jmax],
-                pafThreeLineWin[nLine2Off + jmin],
-                pafThreeLineWin[nLine2Off + j],
-                pafThreeLineWin[nLine2Off + jmax],
-                INTERPOL(pafThreeLineWin[nLine2Off + jmin],
-                         pafThreeLineWin[nLine1Off + jmin], bSrcHasNoData,
-                         fSrcNoDataValue),
-                INTERPOL(pafThreeLineWin[nLine2Off + j],
-                         pafThreeLineWin[nLine1Off + j], bSrcHasNoData,
-                         fSrcNoDataValue),
-                INTERPOL(pafThreeLineWin[nLine2Off + jmax],
-                         pafThreeLineWin[nLine1Off + jmax], bSrcHasNoData,
-                         fSrcNoDataValue),
-            };
-
-            pafOutputBuf[j] =
-                ComputeVal(CPL_TO_BOOL(bSrcHasNoData), fSrcNoDataValue,
-                           CPL_TO_BOOL(bIsSrcNoDataNan), afWin, fDstNoDataValue,
-                           pfnAlg, pData, bComputeAtEdges);
-        }
+        GDALGeneric3x3ProcessEdgeLine(sCtxt, pafThreeLineWin + nLine2Off,
+                                      pafThreeLineWin + nLine1Off,
+                                      /* bFirstLine = */ false, pafOutputBuf);
         eErr = GDALRasterIO(hDstBand, GF_Write, 0, i, nXSize, 1, pafOutputBuf,
                             nXSize, 1, GDT_Float32, 0, 0);
         if (eErr != CE_None)
@@ -285,31 +285,39 @@ MAIN_START(argc, argv)
     /* -------------------------------------------------------------------- */
     /*      Turn the location into a pixel and line location.               */
     /* -------------------------------------------------------------------- */
-    bool inputAvailable = true;
     CPLString osXML;
-    char szLine[1024];
     int nLine = 0;
-    std::string osExtraContent;
 
-    if (std::isnan(dfGeoX))
+    // Is it an interactive terminal ?
+    const bool bInteractive =
+        !bIsXYSpecifiedAsArgument && isatty(static_cast<int>(fileno(stdin)));
+    if (bInteractive)
     {
-        // Is it an interactive terminal ?
-        if (isatty(static_cast<int>(fileno(stdin))))
+        if (!osSourceSRS.empty())
         {
-            if (!osSourceSRS.empty())
-            {
-                fprintf(
-                    stderr,
+            fprintf(stderr,
                     "Enter X Y values separated by space, and press Return.\n");
-            }
-            else
-            {
-                fprintf(stderr, "Enter pixel line values separated by space, "
-                                "and press Return.\n");
-            }
         }
+        else
+        {
+            fprintf(stderr, "Enter pixel line values separated by space, "
+                            "and press Return.\n");
+        }
+    }
+
+    struct InputPoint
+    {
+        double dfX = 0;
+        double dfY = 0;
+        std::string osExtraContent{};
+    };
 
-        if (fgets(szLine, sizeof(szLine) - 1, stdin))
+    // Reads the next point from the standard input. Returns false at the end
+    // of input, or if the first line is invalid.
+    const auto ReadPoint = [&nLine, bIgnoreExtraInput](InputPoint &sPoint)
+    {
+        char szLine[1024];
+        while (fgets(szLine, sizeof(szLine) - 1, stdin))
         {
             const CPLStringList aosTokens(CSLTokenizeString(szLine));
             const int nCount = aosTokens.size();
@@ -318,362 +326,442 @@ MAIN_START(argc, argv)
             if (nCount < 2)
             {
                 fprintf(stderr, "Not enough values at line %d\n", nLine);
-                inputAvailable = false;
+                if (nLine == 1)
+                    return false;
+                continue;
             }
-            else
+
+            sPoint.dfX = CPLAtof(aosTokens[0]);
+            sPoint.dfY = CPLAtof(aosTokens[1]);
+            sPoint.osExtraContent.clear();
+            if (!bIgnoreExtraInput)
             {
-                dfGeoX = CPLAtof(aosTokens[0]);
-                dfGeoY = CPLAtof(aosTokens[1]);
-                if (!bIgnoreExtraInput)
+                for (int i = 2; i < nCount; ++i)
                 {
-                    for (int i = 2; i < nCount; ++i)
-                    {
-                        if (!osExtraContent.empty())
-                            osExtraContent += ' ';
-                        osExtraContent += aosTokens[i];
-                    }
-                    while (!osExtraContent.empty() &&
-                           isspace(static_cast<int>(osExtraContent.back())))
-                    {
-                        osExtraContent.pop_back();
-                    }
+                    if (!sPoint.osExtraContent.empty())
+                        sPoint.osExtraContent += ' ';
+                    sPoint.osExtraContent += aosTokens[i];
+                }
+                while (!sPoint.osExtraContent.empty() &&
+                       isspace(static_cast<int>(sPoint.osExtraContent.back())))
+                {
+                    sPoint.osExtraContent.pop_back();
                 }
             }
+            return true;
         }
-        else
-        {
-            inputAvailable = false;
-        }
-    }
+        return false;
+    };
 
-    int nRetCode = 0;
-    while (inputAvailable)
+    double adfInvGeoTransform[6] = {0, 1, 0, 0, 0, 1};
+    if (!osSourceSRS.empty())
     {
-        int iPixel, iLine;
-
-        if (hCT)
+        double adfGeoTransform[6] = {};
+        if (GDALGetGeoTransform(hSrcDS, adfGeoTransform) != CE_None)
         {
-            if (!OCTTransform(hCT, 1, &dfGeoX, &dfGeoY, nullptr))
-                exit(1);
+            CPLError(CE_Failure, CPLE_AppDefined, "Cannot get geotransform");
+            exit(1);
         }
 
-        if (!osSourceSRS.empty())
+        if (!GDALInvGeoTransform(adfGeoTransform, adfInvGeoTransform))
         {
-            double adfGeoTransform[6] = {};
-            if (GDALGetGeoTransform(hSrcDS, adfGeoTransform) != CE_None)
-            {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Cannot get geotransform");
-                exit(1);
-            }
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot invert geotransform");
+            exit(1);
+        }
+    }
+
+    // Points read from a file or a pipe are processed by batches, so that
+    // the coordinate transformation and the pixel reads (grouped by block
+    // by GDALRasterSamplePoints()) are done for many points at once.
+    const size_t nBatchSize = bInteractive ? 1 : 100 * 1000;
+
+    std::vector<InputPoint> asPoints;
+    std::vector<double> adfX;
+    std::vector<double> adfY;
+    std::vector<int> abSuccess;
+    std::vector<int> anPixel;
+    std::vector<int> anLine;
+    std::vector<double> adfQueryX;
+    std::vector<double> adfQueryY;
+    // For each band, nPoints (real, imaginary) pairs, or empty if the band
+    // is unavailable
+    std::vector<std::vector<double>> aadfValues(anBandList.size());
+    std::vector<GDALRasterBandH> ahBands(anBandList.size());
 
-            double adfInvGeoTransform[6] = {};
-            if (!GDALInvGeoTransform(adfGeoTransform, adfInvGeoTransform))
+    /* -------------------------------------------------------------------- */
+    /*      Resolve the bands (or overviews) to query.                      */
+    /* -------------------------------------------------------------------- */
+    for (int i = 0; i < static_cast<int>(anBandList.size()); i++)
+    {
+        GDALRasterBandH hBand = GDALGetRasterBand(hSrcDS, anBandList[i]);
+        if (nOverview >= 0 && hBand != nullptr)
+        {
+            GDALRasterBandH hOvrBand = GDALGetOverview(hBand, nOverview);
+            if (hOvrBand == nullptr)
             {
                 CPLError(CE_Failure, CPLE_AppDefined,
-                         "Cannot invert geotransform");
-                exit(1);
+                         "Cannot get overview %d of band %d", nOverview + 1,
+                         anBandList[i]);
             }
-
-            iPixel = static_cast<int>(floor(adfInvGeoTransform[0] +
-                                            adfInvGeoTransform[1] * dfGeoX +
-                                            adfInvGeoTransform[2] * dfGeoY));
-            iLine = static_cast<int>(floor(adfInvGeoTransform[3] +
-                                           adfInvGeoTransform[4] * dfGeoX +
-                                           adfInvGeoTransform[5] * dfGeoY));
+            hBand = hOvrBand;
         }
-        else
+        ahBands[i] = hBand;
+    }
+
+    // Location to query in an overview band
+    const auto GetPixelLineToQuery =
+        [hSrcDS, nOverview](GDALRasterBandH hBand, int iPixel, int iLine,
+                            int &iPixelToQuery, int &iLineToQuery)
+    {
+        iPixelToQuery = iPixel;
+        iLineToQuery = iLine;
+        if (nOverview >= 0)
         {
-            iPixel = static_cast<int>(floor(dfGeoX));
-            iLine = static_cast<int>(floor(dfGeoY));
+            const int nOvrXSize = GDALGetRasterBandXSize(hBand);
+            const int nOvrYSize = GDALGetRasterBandYSize(hBand);
+            iPixelToQuery = static_cast<int>(
+                0.5 + 1.0 * iPixel / GDALGetRasterXSize(hSrcDS) * nOvrXSize);
+            iLineToQuery = static_cast<int>(
+                0.5 + 1.0 * iLine / GDALGetRasterYSize(hSrcDS) * nOvrYSize);
+            if (iPixelToQuery >= nOvrXSize)
+                iPixelToQuery = nOvrXSize - 1;
+            if (iLineToQuery >= nOvrYSize)
+                iLineToQuery = nOvrYSize - 1;
         }
+    };
 
-        /* --------------------------------------------------------------------
-         */
-        /*      Prepare report. */
-        /* --------------------------------------------------------------------
-         */
-        CPLString osLine;
-
-        if (bAsXML)
+    int nRetCode = 0;
+    bool bInputAvailable = true;
+    while (bInputAvailable)
+    {
+        asPoints.clear();
+        if (bIsXYSpecifiedAsArgument)
         {
-            osLine.Printf("<Report pixel=\"%d\" line=\"%d\">", iPixel, iLine);
-            osXML += osLine;
-            if (!osExtraContent.empty())
-            {
-                char *pszEscaped =
-                    CPLEscapeString(osExtraContent.c_str(), -1, CPLES_XML);
-                osXML += CPLString().Printf("  <ExtraInput>%s</ExtraInput>",
-                                            pszEscaped);
-                CPLFree(pszEscaped);
-            }
+            InputPoint sPoint;
+            sPoint.dfX = dfGeoX;
+            sPoint.dfY = dfGeoY;
+            asPoints.push_back(std::move(sPoint));
+            bInputAvailable = false;
         }
-        else if (!bQuiet)
+        else
         {
-            printf("Report:\n");
-            printf("  Location: (%dP,%dL)\n", iPixel, iLine);
-            if (!osExtraContent.empty())
+            InputPoint sPoint;
+            while (asPoints.size() < nBatchSize)
             {
-                printf("  Extra input: %s\n", osExtraContent.c_str());
+                if (!ReadPoint(sPoint))
+                {
+                    bInputAvailable = false;
+                    break;
+                }
+                asPoints.push_back(sPoint);
             }
         }
-        else if (bEcho)
+        const size_t nPoints = asPoints.size();
+        if (nPoints == 0)
+            break;
+
+        /* ---------------------------------------------------------------- */
+        /*      Transform the points.                                       */
+        /* ---------------------------------------------------------------- */
+        adfX.resize(nPoints);
+        adfY.resize(nPoints);
+        for (size_t iPoint = 0; iPoint < nPoints; ++iPoint)
         {
-            printf("%d%s%d%s", iPixel, osFieldSep.c_str(), iLine,
-                   osFieldSep.c_str());
+            adfX[iPoint] = asPoints[iPoint].dfX;
+            adfY[iPoint] = asPoints[iPoint].dfY;
         }
 
-        bool bPixelReport = true;
+        // Points after the first one that fails to be transformed are not
+        // reported.
+        size_t nValidPoints = nPoints;
+        if (hCT)
+        {
+            abSuccess.resize(nPoints);
+            if (!OCTTransformEx(hCT, static_cast<int>(nPoints), adfX.data(),
+                                adfY.data(), nullptr, abSuccess.data()))
+            {
+                nValidPoints = 0;
+                while (nValidPoints < nPoints && abSuccess[nValidPoints])
+                    ++nValidPoints;
+            }
+        }
 
-        if (iPixel < 0 || iLine < 0 || iPixel >= GDALGetRasterXSize(hSrcDS) ||
-            iLine >= GDALGetRasterYSize(hSrcDS))
+        anPixel.resize(nValidPoints);
+        anLine.resize(nValidPoints);
+        for (size_t iPoint = 0; iPoint < nValidPoints; ++iPoint)
         {
-            if (bAsXML)
-                osXML += "<Alert>Location is off this file! No further details "
-                         "to report.</Alert>";
-            else if (bValOnly)
-                printf("\n");
-            else if (!bQuiet)
-                printf("\nLocation is off this file! No further details to "
-                       "report.\n");
-            bPixelReport = false;
-            nRetCode = 1;
+            const double dfX = adfX[iPoint];
+            const double dfY = adfY[iPoint];
+            anPixel[iPoint] = static_cast<int>(floor(
+                adfInvGeoTransform[0] + adfInvGeoTransform[1] * dfX +
+                adfInvGeoTransform[2] * dfY));
+            anLine[iPoint] = static_cast<int>(floor(
+                adfInvGeoTransform[3] + adfInvGeoTransform[4] * dfX +
+                adfInvGeoTransform[5] * dfY));
         }
 
-        /* --------------------------------------------------------------------
-         */
-        /*      Process each band. */
-        /* --------------------------------------------------------------------
-         */
-        for (int i = 0; bPixelReport && i < static_cast<int>(anBandList.size());
-             i++)
+        /* ---------------------------------------------------------------- */
+        /*      Read the pixel values of each band.                         */
+        /* ---------------------------------------------------------------- */
+        adfQueryX.resize(nValidPoints);
+        adfQueryY.resize(nValidPoints);
+        for (size_t i = 0; i < anBandList.size(); i++)
         {
-            GDALRasterBandH hBand = GDALGetRasterBand(hSrcDS, anBandList[i]);
+            GDALRasterBandH hBand = ahBands[i];
+            aadfValues[i].clear();
+            if (hBand == nullptr)
+                continue;
 
-            int iPixelToQuery = iPixel;
-            int iLineToQuery = iLine;
+            for (size_t iPoint = 0; iPoint < nValidPoints; ++iPoint)
+            {
+                int iPixelToQuery = 0;
+                int iLineToQuery = 0;
+                GetPixelLineToQuery(hBand, anPixel[iPoint], anLine[iPoint],
+                                    iPixelToQuery, iLineToQuery);
+                // Sample at the pixel center. Points off the file get a NaN
+                // value and are not reported.
+                adfQueryX[iPoint] = iPixelToQuery + 0.5;
+                adfQueryY[iPoint] = iLineToQuery + 0.5;
+            }
 
-            if (nOverview >= 0 && hBand != nullptr)
+            aadfValues[i].resize(2 * nValidPoints);
+            if (GDALRasterSamplePoints(hBand, nValidPoints, adfQueryX.data(),
+                                       adfQueryY.data(),
+                                       GRIORA_NearestNeighbour,
+                                       aadfValues[i].data(),
+                                       GDT_CFloat64) != CE_None)
             {
-                GDALRasterBandH hOvrBand = GDALGetOverview(hBand, nOverview);
-                if (hOvrBand != nullptr)
-                {
-                    int nOvrXSize = GDALGetRasterBandXSize(hOvrBand);
-                    int nOvrYSize = GDALGetRasterBandYSize(hOvrBand);
-                    iPixelToQuery = static_cast<int>(
-                        0.5 +
-                        1.0 * iPixel / GDALGetRasterXSize(hSrcDS) * nOvrXSize);
-                    iLineToQuery = static_cast<int>(
-                        0.5 +
-                        1.0 * iLine / GDALGetRasterYSize(hSrcDS) * nOvrYSize);
-                    if (iPixelToQuery >= nOvrXSize)
-                        iPixelToQuery = nOvrXSize - 1;
-                    if (iLineToQuery >= nOvrYSize)
-                        iLineToQuery = nOvrYSize - 1;
-                }
-                else
-                {
-                    CPLError(CE_Failure, CPLE_AppDefined,
-                             "Cannot get overview %d of band %d", nOverview + 1,
-                             anBandList[i]);
-                }
-                hBand = hOvrBand;
+                aadfValues[i].clear();
             }
+        }
 
-            if (hBand == nullptr)
-                continue;
+        for (size_t iPoint = 0; iPoint < nPoints; ++iPoint)
+        {
+            if (iPoint == nValidPoints)
+                exit(1);
+
+            const int iPixel = anPixel[iPoint];
+            const int iLine = anLine[iPoint];
+            const std::string &osExtraContent =
+                asPoints[iPoint].osExtraContent;
+
+            /* ------------------------------------------------------------ */
+            /*      Prepare report.                                         */
+            /* ------------------------------------------------------------ */
+            CPLString osLine;
 
             if (bAsXML)
             {
-                osLine.Printf("<BandReport band=\"%d\">", anBandList[i]);
+                osLine.Printf("<Report pixel=\"%d\" line=\"%d\">", iPixel,
+                              iLine);
                 osXML += osLine;
+                if (!osExtraContent.empty())
+                {
+                    char *pszEscaped =
+                        CPLEscapeString(osExtraContent.c_str(), -1, CPLES_XML);
+                    osXML += CPLString().Printf(
+                        "  <ExtraInput>%s</ExtraInput>", pszEscaped);
+                    CPLFree(pszEscaped);
+                }
             }
             else if (!bQuiet)
             {
-                printf("  Band %d:\n", anBandList[i]);
+                printf("Report:\n");
+                printf("  Location: (%dP,%dL)\n", iPixel, iLine);
+                if (!osExtraContent.empty())
+                {
+                    printf("  Extra input: %s\n", osExtraContent.c_str());
+                }
+            }
+            else if (bEcho)
+            {
+                printf("%d%s%d%s", iPixel, osFieldSep.c_str(), iLine,
+                       osFieldSep.c_str());
             }
 
-            /* --------------------------------------------------------------------
-             */
-            /*      Request location info for this location.  It is possible */
-            /*      only the VRT driver actually supports this. */
-            /* --------------------------------------------------------------------
-             */
-            CPLString osItem;
-
-            osItem.Printf("Pixel_%d_%d", iPixelToQuery, iLineToQuery);
+            bool bPixelReport = true;
 
-            const char *pszLI =
-                GDALGetMetadataItem(hBand, osItem, "LocationInfo");
-
-            if (pszLI != nullptr)
+            if (iPixel < 0 || iLine < 0 ||
+                iPixel >= GDALGetRasterXSize(hSrcDS) ||
+                iLine >= GDALGetRasterYSize(hSrcDS))
             {
                 if (bAsXML)
-                    osXML += pszLI;
+                    osXML += "<Alert>Location is off this file! No further "
+                             "details to report.</Alert>";
+                else if (bValOnly)
+                    printf("\n");
                 else if (!bQuiet)
-                    printf("    %s\n", pszLI);
-                else if (bLIFOnly)
-                {
-                    /* Extract all files, if any. */
-
-                    CPLXMLNode *psRoot = CPLParseXMLString(pszLI);
-
-                    if (psRoot != nullptr && psRoot->psChild != nullptr &&
-                        psRoot->eType == CXT_Element &&
-                        EQUAL(psRoot->pszValue, "LocationInfo"))
-                    {
-                        for (CPLXMLNode *psNode = psRoot->psChild;
-                             psNode != nullptr; psNode = psNode->psNext)
-                        {
-                            if (psNode->eType == CXT_Element &&
-                                EQUAL(psNode->pszValue, "File") &&
-                                psNode->psChild != nullptr)
-                            {
-                                char *pszUnescaped =
-                                    CPLUnescapeString(psNode->psChild->pszValue,
-                                                      nullptr, CPLES_XML);
-                                printf("%s\n", pszUnescaped);
-                                CPLFree(pszUnescaped);
-                            }
-                        }
-                    }
-                    CPLDestroyXMLNode(psRoot);
-                }
+                    printf("\nLocation is off this file! No further details "
+                           "to report.\n");
+                bPixelReport = false;
+                nRetCode = 1;
             }
 
-            /* --------------------------------------------------------------------
-             */
-            /*      Report the pixel value of this band. */
-            /* --------------------------------------------------------------------
-             */
-            double adfPixel[2] = {0, 0};
-            const bool bIsComplex = CPL_TO_BOOL(
-                GDALDataTypeIsComplex(GDALGetRasterDataType(hBand)));
-
-            if (GDALRasterIO(hBand, GF_Read, iPixelToQuery, iLineToQuery, 1, 1,
-                             adfPixel, 1, 1,
-                             bIsComplex ? GDT_CFloat64 : GDT_Float64, 0,
-                             0) == CE_None)
+            /* ------------------------------------------------------------ */
+            /*      Process each band.                                      */
+            /* ------------------------------------------------------------ */
+            for (int i = 0;
+                 bPixelReport && i < static_cast<int>(anBandList.size()); i++)
             {
-                CPLString osValue;
-
-                if (bIsComplex)
-                    osValue.Printf("%.15g+%.15gi", adfPixel[0], adfPixel[1]);
-                else
-                    osValue.Printf("%.15g", adfPixel[0]);
+                GDALRasterBandH hBand = ahBands[i];
+                if (hBand == nullptr)
+                    continue;
 
                 if (bAsXML)
                 {
-                    osXML += "<Value>";
-                    osXML += osValue;
-                    osXML += "</Value>";
+                    osLine.Printf("<BandReport band=\"%d\">", anBandList[i]);
+                    osXML += osLine;
                 }
                 else if (!bQuiet)
-                    printf("    Value: %s\n", osValue.c_str());
-                else if (bValOnly)
                 {
-                    if (i > 0)
-                        printf("%s", osFieldSep.c_str());
-                    printf("%s", osValue.c_str());
+                    printf("  Band %d:\n", anBandList[i]);
                 }
 
-                // Report unscaled if we have scale/offset values.
-                int bSuccess;
+                /* -------------------------------------------------------- */
+                /*      Request location info for this location.  It is     */
+                /*      possible only the VRT driver actually supports      */
+                /*      this.                                               */
+                /* -------------------------------------------------------- */
+                int iPixelToQuery = 0;
+                int iLineToQuery = 0;
+                GetPixelLineToQuery(hBand, iPixel, iLine, iPixelToQuery,
+                                    iLineToQuery);
 
-                double dfOffset = GDALGetRasterOffset(hBand, &bSuccess);
-                // TODO: Should we turn on checking of bSuccess?
-                // Alternatively, delete these checks and put a comment as to
-                // why checking bSuccess does not matter.
-#if 0
-                if (bSuccess == FALSE)
-                {
-                    CPLError( CE_Debug, CPLE_AppDefined,
-                              "Unable to get raster offset." );
-                }
-#endif
-                double dfScale = GDALGetRasterScale(hBand, &bSuccess);
-#if 0
-                if (bSuccess == FALSE)
+                CPLString osItem;
+
+                osItem.Printf("Pixel_%d_%d", iPixelToQuery, iLineToQuery);
+
+                const char *pszLI =
+                    GDALGetMetadataItem(hBand, osItem, "LocationInfo");
+
+                if (pszLI != nullptr)
                 {
-                    CPLError( CE_Debug, CPLE_AppDefined,
-                              "Unable to get raster scale." );
+                    if (bAsXML)
+                        osXML += pszLI;
+                    else if (!bQuiet)
+                        printf("    %s\n", pszLI);
+                    else if (bLIFOnly)
+                    {
+                        /* Extract all files, if any. */
+
+                        CPLXMLNode *psRoot = CPLParseXMLString(pszLI);
+
+                        if (psRoot != nullptr && psRoot->psChild != nullptr &&
+                            psRoot->eType == CXT_Element &&
+                            EQUAL(psRoot->pszValue, "LocationInfo"))
+                        {
+                            for (CPLXMLNode *psNode = psRoot->psChild;
+                                 psNode != nullptr; psNode = psNode->psNext)
+                            {
+                                if (psNode->eType == CXT_Element &&
+                                    EQUAL(psNode->pszValue, "File") &&
+                                    psNode->psChild != nullptr)
+                                {
+                                    char *pszUnescaped = CPLUnescapeString(
+                                        psNode->psChild->pszValue, nullptr,
+                                        CPLES_XML);
+                                    printf("%s\n", pszUnescaped);
+                                    CPLFree(pszUnescaped);
+                                }
+                            }
+                        }
+                        CPLDestroyXMLNode(psRoot);
+                    }
                 }
-#endif
-                if (dfOffset != 0.0 || dfScale != 1.0)
+
+                /* -------------------------------------------------------- */
+                /*      Report the pixel value of this band.                */
+                /* -------------------------------------------------------- */
+                const bool bIsComplex = CPL_TO_BOOL(
+                    GDALDataTypeIsComplex(GDALGetRasterDataType(hBand)));
+
+                if (!aadfValues[i].empty())
                 {
-                    adfPixel[0] = adfPixel[0] * dfScale + dfOffset;
+                    double adfPixel[2] = {aadfValues[i][2 * iPoint],
+                                          aadfValues[i][2 * iPoint + 1]};
+
+                    CPLString osValue;
 
                     if (bIsComplex)
-                    {
-                        adfPixel[1] = adfPixel[1] * dfScale + dfOffset;
                         osValue.Printf("%.15g+%.15gi", adfPixel[0],
                                        adfPixel[1]);
-                    }
                     else
                         osValue.Printf("%.15g", adfPixel[0]);
 
                     if (bAsXML)
                     {
-                        osXML += "<DescaledValue>";
+                        osXML += "<Value>";
                         osXML += osValue;
-                        osXML += "</DescaledValue>";
+                        osXML += "</Value>";
                     }
                     else if (!bQuiet)
-                        printf("    Descaled Value: %s\n", osValue.c_str());
-                }
-            }
-
-            if (bAsXML)
-                osXML += "</BandReport>";
-        }
-
-        osXML += "</Report>";
-
-        if (bValOnly)
-        {
-            if (!osExtraContent.empty() && osFieldSep != "\n")
-                printf("%s%s", osFieldSep.c_str(), osExtraContent.c_str());
-            printf("\n");
-        }
-
-        if (bIsXYSpecifiedAsArgument)
-            break;
+                        printf("    Value: %s\n", osValue.c_str());
+                    else if (bValOnly)
+                    {
+                        if (i > 0)
+                            printf("%s", osFieldSep.c_str());
+                        printf("%s", osValue.c_str());
+                    }
 
-        osExtraContent.clear();
-        if (fgets(szLine, sizeof(szLine) - 1, stdin))
-        {
-            const CPLStringList aosTokens(CSLTokenizeString(szLine));
-            const int nCount = aosTokens.size();
+                    // Report unscaled if we have scale/offset values.
+                    int bSuccess;
 
-            ++nLine;
-            if (nCount < 2)
-            {
-                fprintf(stderr, "Not enough values at line %d\n", nLine);
-                continue;
-            }
-            else
-            {
-                dfGeoX = CPLAtof(aosTokens[0]);
-                dfGeoY = CPLAtof(aosTokens[1]);
-                if (!bIgnoreExtraInput)
-                {
-                    for (int i = 2; i < nCount; ++i)
+                    double dfOffset = GDALGetRasterOffset(hBand, &bSuccess);
+                    // TODO: Should we turn on checking of bSuccess?
+                    // Alternatively, delete these checks and put a comment as
+                    // to why checking bSuccess does not matter.
+#if 0
+                    if (bSuccess == FALSE)
                     {
-                        if (!osExtraContent.empty())
-                            osExtraContent += ' ';
-                        osExtraContent += aosTokens[i];
+                        CPLError( CE_Debug, CPLE_AppDefined,
+                                  "Unable to get raster offset." );
                     }
-                    while (!osExtraContent.empty() &&
-                           isspace(static_cast<int>(osExtraContent.back())))
+#endif
+                    double dfScale = GDALGetRasterScale(hBand, &bSuccess);
+#if 0
+                    if (bSuccess == FALSE)
+                    {
+                        CPLError( CE_Debug, CPLE_AppDefined,
+                                  "Unable to get raster scale." );
+                    }
+#endif
+                    if (dfOffset != 0.0 || dfScale != 1.0)
                     {
-                        osExtraContent.pop_back();
+                        adfPixel[0] = adfPixel[0] * dfScale + dfOffset;
+
+                        if (bIsComplex)
+                        {
+                            adfPixel[1] = adfPixel[1] * dfScale + dfOffset;
+                            osValue.Printf("%.15g+%.15gi", adfPixel[0],
+                                           adfPixel[1]);
+                        }
+                        else
+                            osValue.Printf("%.15g", adfPixel[0]);
+
+                        if (bAsXML)
+                        {
+                            osXML += "<DescaledValue>";
+                            osXML += osValue;
+                            osXML += "</DescaledValue>";
+                        }
+                        else if (!bQuiet)
+                            printf("    Descaled Value: %s\n", osValue.c_str());
                     }
                 }
+
+                if (bAsXML)
+                    osXML += "</BandReport>";
+            }
+
+            osXML += "</Report>";
+
+            if (bValOnly)
+            {
+                if (!osExtraContent.empty() && osFieldSep != "\n")
+                    printf("%s%s", osFieldSep.c_str(), osExtraContent.c_str());
+                printf("\n");
             }
-        }
-        else
-        {
-            break;
         }
     }
 
@@ -100,6 +100,7 @@ struct GDALTileIndexOptions
     double dfMaxPixelSize = std::numeric_limits<double>::quiet_NaN();
     std::vector<GDALTileIndexRasterMetadata> aoFetchMD{};
     std::set<std::string> oSetFilenameFilters{};
+    std::string osNumThreads{};
 };
 
 /************************************************************************/
@@ -189,6 +190,11 @@ static std::unique_ptr<GDALArgumentParser> GDALTileIndexAppOptionsGetParser(
         .store_into(psOptions->bOverwrite)
         .help(_("Overwrite the output tile index file if it already exists."));
 
+    argParser->add_argument("-num_threads")
+        .metavar("<value>|ALL_CPUS")
+        .store_into(psOptions->osNumThreads)
+        .help(_("Number of threads used to open source datasets."));
+
     argParser->add_argument("-recursive")
         .flag()
         .store_into(psOptions->bRecursive)
@@ -992,8 +998,10 @@ GDALDatasetH GDALTileIndex(const char *pszDest, int nSrcCount,
         !psOptions->osGTIFilename.empty();
 
     /* -------------------------------------------------------------------- */
-    /*      loop over GDAL files, processing.                               */
+    /*      Collect the GDAL files that are not yet in the tile index.      */
     /* -------------------------------------------------------------------- */
+    std::vector<std::string> aosSrcFilenames;
+    std::vector<std::string> aosFileNamesToWrite;
     while (true)
     {
         const std::string osSrcFilename = oGDALTileIndexTileIterator.next();
@@ -1026,9 +1034,28 @@ GDALDatasetH GDALTileIndex(const char *pszDest, int nSrcCount,
             continue;
         }
 
-        auto poSrcDS = std::unique_ptr<GDALDataset>(GDALDataset::Open(
-            osSrcFilename.c_str(), GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR,
-            nullptr, nullptr, nullptr));
+        aosSrcFilenames.push_back(osSrcFilename);
+        aosFileNamesToWrite.push_back(std::move(osFileNameToWrite));
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      loop over GDAL files, processing. They are opened ahead by a    */
+    /*      thread pool, but processed in order.                            */
+    /* -------------------------------------------------------------------- */
+    GDALOrderedDatasetOpener oOpener(
+        GDALGetNumThreadsFromSwitch(psOptions->osNumThreads.empty()
+                                        ? nullptr
+                                        : psOptions->osNumThreads.c_str()),
+        GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR, nullptr);
+    for (const auto &osSrcFilename : aosSrcFilenames)
+        oOpener.Add(osSrcFilename);
+
+    for (size_t iSrc = 0; iSrc < aosSrcFilenames.size(); ++iSrc)
+    {
+        const std::string &osSrcFilename = aosSrcFilenames[iSrc];
+        const std::string &osFileNameToWrite = aosFileNamesToWrite[iSrc];
+
+        auto poSrcDS = oOpener.Get(iSrc);
         if (poSrcDS == nullptr)
         {
             CPLError(CE_Warning, CPLE_AppDefined,
@@ -38,6 +38,7 @@
 #include <cstring>
 
 #include <algorithm>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -47,16 +48,10 @@
 #include "cpl_string.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 #include "nearblack_lib.h"
 
-static void ProcessLine(GByte *pabyLine, GByte *pabyMask, int iStart, int iEnd,
-                        int nSrcBands, int nDstBands, int nNearDist,
-                        int nMaxNonBlack, bool bNearWhite,
-                        const Colors &oColors, int *panLastLineCounts,
-                        bool bDoHorizontalCheck, bool bDoVerticalCheck,
-                        bool bBottomUp, int iLineFromTopOrBottom);
-
 /************************************************************************/
 /*                            GDALNearblack()                           */
 /************************************************************************/
@@ -335,393 +330,535 @@ GDALDatasetH CPL_DLL GDALNearblack(const char *pszDest, GDALDatasetH hDstDS,
 }
 
 /************************************************************************/
-/*                   GDALNearblackTwoPassesAlgorithm()                  */
-/*                                                                      */
-/* Do a top-to-bottom pass, followed by a bottom-to-top one.            */
+/*                       NearblackPassContext                           */
 /************************************************************************/
 
-bool GDALNearblackTwoPassesAlgorithm(const GDALNearblackOptions *psOptions,
-                                     GDALDatasetH hSrcDataset,
-                                     GDALDatasetH hDstDS,
-                                     GDALRasterBandH hMaskBand, int nBands,
-                                     int nDstBands, bool bSetMask,
-                                     const Colors &oColors)
+namespace
 {
-    const int nXSize = GDALGetRasterXSize(hSrcDataset);
-    const int nYSize = GDALGetRasterYSize(hSrcDataset);
 
-    const int nMaxNonBlack = psOptions->nMaxNonBlack;
-    const int nNearDist = psOptions->nNearDist;
-    const bool bNearWhite = psOptions->bNearWhite;
-    const bool bSetAlpha = psOptions->bSetAlpha;
+constexpr GByte NEARBLACK_FLAG_NON_BLACK = 1;
+constexpr GByte NEARBLACK_FLAG_REPLACED = 2;
 
-    /* -------------------------------------------------------------------- */
-    /*      Allocate a line buffer.                                         */
-    /* -------------------------------------------------------------------- */
-
-    std::vector<GByte> abyLine(static_cast<size_t>(nXSize) * nDstBands);
-    GByte *pabyLine = abyLine.data();
-
-    std::vector<GByte> abyMask;
+// State of one top-to-bottom or bottom-to-top pass, over a strip of lines
+// stored band-sequentially.
+struct NearblackPassContext
+{
+    int nXSize = 0;
+    int nYSize = 0;
+    int nSrcBands = 0;
+    int nDstBands = 0;
+    int nNearDist = 0;
+    int nMaxNonBlack = 0;
+    const Colors *poColors = nullptr;
+    bool bBottomUp = false;
+    GByte nReplaceValue = 0;
+    // Whether a pixel set to nReplaceValue is considered as non black
+    bool bReplacedIsNonBlack = false;
+
+    // Strip being processed
+    int nYOff = 0;
+    int nLines = 0;
+    GByte *pabyData = nullptr;
+    size_t nBandSpace = 0;
     GByte *pabyMask = nullptr;
-    if (bSetMask)
-    {
-        abyMask.resize(nXSize);
-        pabyMask = abyMask.data();
-    }
+    // Combination of NEARBLACK_FLAG_xxx for each pixel of the strip
+    GByte *pabyFlags = nullptr;
+    // Value of panLastLineCounts after the vertical check of each line
+    int *panCounts = nullptr;
+    // Running vertical counts, for each column
+    int *panLastLineCounts = nullptr;
+};
+
+typedef void (*NearblackStepFunc)(const NearblackPassContext &sCtxt,
+                                  int iStart, int iEnd);
+
+struct NearblackJob
+{
+    const NearblackPassContext *psCtxt = nullptr;
+    NearblackStepFunc pfnStep = nullptr;
+    int iStart = 0;
+    int iEnd = 0;
+};
 
-    std::vector<int> anLastLineCounts(nXSize);
-    int *panLastLineCounts = anLastLineCounts.data();
+}  // namespace
 
-    /* -------------------------------------------------------------------- */
-    /*      Processing data one line at a time.                             */
-    /* -------------------------------------------------------------------- */
-    int iLine;
+/************************************************************************/
+/*                      NearblackComputeNonBlack()                      */
+/*                                                                      */
+/*      Set pabyNonBlack[i] to 1 for the pixels that are far from all   */
+/*      the colors, and to 0 otherwise.                                 */
+/************************************************************************/
+
+static void NearblackComputeNonBlack(const GByte *pabyData, size_t nBandSpace,
+                                     int nXSize, int nSrcBands, int nNearDist,
+                                     const Colors &oColors,
+                                     GByte *pabyNonBlack, GByte *pabyFar)
+{
+    memset(pabyNonBlack, oColors.empty() ? 0 : 1, nXSize);
 
-    for (iLine = 0; iLine < nYSize; iLine++)
+    for (const Color &oColor : oColors)
     {
-        CPLErr eErr = GDALDatasetRasterIO(
-            hSrcDataset, GF_Read, 0, iLine, nXSize, 1, pabyLine, nXSize, 1,
-            GDT_Byte, nBands, nullptr, nDstBands, nXSize * nDstBands, 1);
-        if (eErr != CE_None)
-        {
-            return false;
-        }
+        memset(pabyFar, 0, nXSize);
 
-        if (bSetAlpha)
+        bool bAlwaysFar = false;
+        for (int iBand = 0; iBand < nSrcBands; iBand++)
         {
-            for (int iCol = 0; iCol < nXSize; iCol++)
+            // A value is near the color component if it is in
+            // [nLow, nHigh], which is tested with a single unsigned
+            // comparison, so that the compiler can vectorize the loop.
+            const int nLow = std::max(0, oColor[iBand] - nNearDist);
+            const int nHigh = std::min(255, oColor[iBand] + nNearDist);
+            if (nLow > nHigh)
             {
-                pabyLine[iCol * nDstBands + nDstBands - 1] = 255;
+                bAlwaysFar = true;
+                break;
             }
-        }
-
-        if (bSetMask)
-        {
-            for (int iCol = 0; iCol < nXSize; iCol++)
+            const GByte nLowValue = static_cast<GByte>(nLow);
+            const GByte nRange = static_cast<GByte>(nHigh - nLow);
+            const GByte *pabyBand = pabyData + iBand * nBandSpace;
+            for (int i = 0; i < nXSize; i++)
             {
-                pabyMask[iCol] = 255;
+                pabyFar[i] |= static_cast<GByte>(
+                    static_cast<GByte>(pabyBand[i] - nLowValue) > nRange);
             }
         }
+        if (bAlwaysFar)
+            continue;
 
-        ProcessLine(pabyLine, pabyMask, 0, nXSize - 1, nBands, nDstBands,
-                    nNearDist, nMaxNonBlack, bNearWhite, oColors,
-                    panLastLineCounts,
-                    true,   // bDoHorizontalCheck
-                    true,   // bDoVerticalCheck
-                    false,  // bBottomUp
-                    iLine);
-        ProcessLine(pabyLine, pabyMask, nXSize - 1, 0, nBands, nDstBands,
-                    nNearDist, nMaxNonBlack, bNearWhite, oColors,
-                    panLastLineCounts,
-                    true,   // bDoHorizontalCheck
-                    false,  // bDoVerticalCheck
-                    false,  // bBottomUp
-                    iLine);
-
-        eErr = GDALDatasetRasterIO(hDstDS, GF_Write, 0, iLine, nXSize, 1,
-                                   pabyLine, nXSize, 1, GDT_Byte, nDstBands,
-                                   nullptr, nDstBands, nXSize * nDstBands, 1);
-
-        if (eErr != CE_None)
-        {
-            return false;
-        }
-
-        /***** write out the mask band line *****/
-
-        if (bSetMask)
-        {
-            eErr = GDALRasterIO(hMaskBand, GF_Write, 0, iLine, nXSize, 1,
-                                pabyMask, nXSize, 1, GDT_Byte, 0, 0);
-            if (eErr != CE_None)
-            {
-                CPLError(CE_Warning, CPLE_AppDefined,
-                         "ERROR writing out line to mask band.");
-                return false;
-            }
-        }
-
-        if (!(psOptions->pfnProgress(
-                0.5 * ((iLine + 1) / static_cast<double>(nYSize)), nullptr,
-                psOptions->pProgressData)))
-        {
-            return false;
-        }
+        for (int i = 0; i < nXSize; i++)
+            pabyNonBlack[i] &= pabyFar[i];
     }
+}
 
-    /* -------------------------------------------------------------------- */
-    /*      Now process from the bottom back up                            .*/
-    /* -------------------------------------------------------------------- */
-    memset(panLastLineCounts, 0, sizeof(int) * nXSize);
+/************************************************************************/
+/*                       NearblackClassifyLines()                       */
+/************************************************************************/
 
-    for (iLine = nYSize - 1; hDstDS != nullptr && iLine >= 0; iLine--)
+static void NearblackClassifyLines(const NearblackPassContext &sCtxt,
+                                   int iLineStart, int iLineEnd)
+{
+    const int nXSize = sCtxt.nXSize;
+    std::vector<GByte> abyFar(nXSize);
+    for (int iLine = iLineStart; iLine < iLineEnd; ++iLine)
     {
-        CPLErr eErr = GDALDatasetRasterIO(
-            hDstDS, GF_Read, 0, iLine, nXSize, 1, pabyLine, nXSize, 1, GDT_Byte,
-            nDstBands, nullptr, nDstBands, nXSize * nDstBands, 1);
-        if (eErr != CE_None)
-        {
-            return false;
-        }
-
-        /***** read the mask band line back in *****/
-
-        if (bSetMask)
-        {
-            eErr = GDALRasterIO(hMaskBand, GF_Read, 0, iLine, nXSize, 1,
-                                pabyMask, nXSize, 1, GDT_Byte, 0, 0);
-            if (eErr != CE_None)
-            {
-                return false;
-            }
-        }
+        const size_t nOffset = static_cast<size_t>(iLine) * nXSize;
+        NearblackComputeNonBlack(sCtxt.pabyData + nOffset, sCtxt.nBandSpace,
+                                 nXSize, sCtxt.nSrcBands, sCtxt.nNearDist,
+                                 *sCtxt.poColors, sCtxt.pabyFlags + nOffset,
+                                 abyFar.data());
+    }
+}
 
-        ProcessLine(pabyLine, pabyMask, 0, nXSize - 1, nBands, nDstBands,
-                    nNearDist, nMaxNonBlack, bNearWhite, oColors,
-                    panLastLineCounts,
-                    true,  // bDoHorizontalCheck
-                    true,  // bDoVerticalCheck
-                    true,  // bBottomUp
-                    nYSize - 1 - iLine);
-        ProcessLine(pabyLine, pabyMask, nXSize - 1, 0, nBands, nDstBands,
-                    nNearDist, nMaxNonBlack, bNearWhite, oColors,
-                    panLastLineCounts,
-                    true,   // bDoHorizontalCheck
-                    false,  // bDoVerticalCheck
-                    true,   // bBottomUp
-                    nYSize - 1 - iLine);
-
-        eErr = GDALDatasetRasterIO(hDstDS, GF_Write, 0, iLine, nXSize, 1,
-                                   pabyLine, nXSize, 1, GDT_Byte, nDstBands,
-                                   nullptr, nDstBands, nXSize * nDstBands, 1);
-        if (eErr != CE_None)
-        {
-            return false;
-        }
+/************************************************************************/
+/*                       NearblackVerticalCheck()                       */
+/*                                                                      */
+/*      Process the columns [iColStart, iColEnd[ of all the lines of    */
+/*      the strip, in the order of the pass.                            */
+/************************************************************************/
 
-        /***** write out the mask band line *****/
+static void NearblackVerticalCheck(const NearblackPassContext &sCtxt,
+                                   int iColStart, int iColEnd)
+{
+    const int nMaxNonBlack = sCtxt.nMaxNonBlack;
+    int *panLastLineCounts = sCtxt.panLastLineCounts;
 
-        if (bSetMask)
+    for (int iIter = 0; iIter < sCtxt.nLines; ++iIter)
+    {
+        const int iLine = sCtxt.bBottomUp ? sCtxt.nLines - 1 - iIter : iIter;
+        const int iLineFromTopOrBottom =
+            sCtxt.bBottomUp ? sCtxt.nYSize - 1 - (sCtxt.nYOff + iLine)
+                            : sCtxt.nYOff + iLine;
+        const size_t nOffset = static_cast<size_t>(iLine) * sCtxt.nXSize;
+        GByte *pabyFlags = sCtxt.pabyFlags + nOffset;
+        int *panCounts = sCtxt.panCounts + nOffset;
+
+        for (int i = iColStart; i < iColEnd; i++)
         {
-            eErr = GDALRasterIO(hMaskBand, GF_Write, 0, iLine, nXSize, 1,
-                                pabyMask, nXSize, 1, GDT_Byte, 0, 0);
-            if (eErr != CE_None)
+            // are we already terminated for this column?
+            if (panLastLineCounts[i] <= nMaxNonBlack)
             {
-                return false;
-            }
-        }
+                bool bReplace = true;
+                if (pabyFlags[i] & NEARBLACK_FLAG_NON_BLACK)
+                {
+                    panLastLineCounts[i]++;
 
-        if (!(psOptions->pfnProgress(0.5 + 0.5 * (nYSize - iLine) /
-                                               static_cast<double>(nYSize),
-                                     nullptr, psOptions->pProgressData)))
-        {
-            return false;
+                    if (panLastLineCounts[i] > nMaxNonBlack)
+                    {
+                        bReplace = false;
+                    }
+                    else if (iLineFromTopOrBottom == 0 && nMaxNonBlack > 0)
+                    {
+                        // if there's a valid value just at the top or bottom
+                        // of the raster, then ignore the nMaxNonBlack setting
+                        panLastLineCounts[i] = nMaxNonBlack + 1;
+                        bReplace = false;
+                    }
+                }
+                if (bReplace)
+                    pabyFlags[i] |= NEARBLACK_FLAG_REPLACED;
+            }
+            panCounts[i] = panLastLineCounts[i];
         }
     }
-
-    return true;
 }
 
 /************************************************************************/
-/*                            ProcessLine()                             */
+/*                      NearblackHorizontalCheck()                      */
 /*                                                                      */
-/*      Process a single scanline of image data.                        */
+/*      Process the lines [iLineStart, iLineEnd[ of the strip, left to  */
+/*      right and then right to left, and apply the replacements        */
+/*      decided by both checks.                                         */
 /************************************************************************/
 
-static void ProcessLine(GByte *pabyLine, GByte *pabyMask, int iStart, int iEnd,
-                        int nSrcBands, int nDstBands, int nNearDist,
-                        int nMaxNonBlack, bool bNearWhite,
-                        const Colors &oColors, int *panLastLineCounts,
-                        bool bDoHorizontalCheck, bool bDoVerticalCheck,
-                        bool bBottomUp, int iLineFromTopOrBottom)
+static void NearblackHorizontalCheck(const NearblackPassContext &sCtxt,
+                                     int iLineStart, int iLineEnd)
 {
-    const GByte nReplacevalue = bNearWhite ? 255 : 0;
+    const int nXSize = sCtxt.nXSize;
 
-    /* -------------------------------------------------------------------- */
-    /*      Vertical checking.                                              */
-    /* -------------------------------------------------------------------- */
+    /***** on a bottom up pass assume nMaxNonBlack is 0 *****/
+    const int nMaxNonBlack = sCtxt.bBottomUp ? 0 : sCtxt.nMaxNonBlack;
 
-    if (bDoVerticalCheck)
+    for (int iLine = iLineStart; iLine < iLineEnd; ++iLine)
     {
-        const int nXSize = std::max(iStart + 1, iEnd + 1);
+        const size_t nOffset = static_cast<size_t>(iLine) * nXSize;
+        GByte *pabyFlags = sCtxt.pabyFlags + nOffset;
+        const int *panCounts = sCtxt.panCounts + nOffset;
 
-        for (int i = 0; i < nXSize; i++)
+        for (int iDir = 1; iDir >= -1; iDir -= 2)
         {
-            // are we already terminated for this column?
-            if (panLastLineCounts[i] > nMaxNonBlack)
-                continue;
+            const int iStart = iDir > 0 ? 0 : nXSize - 1;
+            const int iEnd = iDir > 0 ? nXSize - 1 : 0;
+            int nNonBlackPixels = 0;
+            bool bDoTest = true;
 
-            /***** is the pixel valid data? ****/
-
-            bool bIsNonBlack = false;
-
-            /***** loop over the colors *****/
-
-            for (int iColor = 0; iColor < static_cast<int>(oColors.size());
-                 iColor++)
+            for (int i = iStart; i != iEnd; i += iDir)
             {
+                /***** not seen any valid data? *****/
 
-                const Color &oColor = oColors[iColor];
-
-                bIsNonBlack = false;
+                if (bDoTest)
+                {
+                    // Pixels already replaced hold the replacement value
+                    const bool bIsNonBlack =
+                        (pabyFlags[i] & NEARBLACK_FLAG_REPLACED)
+                            ? sCtxt.bReplacedIsNonBlack
+                            : (pabyFlags[i] & NEARBLACK_FLAG_NON_BLACK) != 0;
 
-                /***** loop over the bands *****/
+                    if (bIsNonBlack)
+                    {
+                        /***** use nNonBlackPixels in grey areas  *****/
+                        /***** from the vertical pass's grey areas ****/
 
-                for (int iBand = 0; iBand < nSrcBands; iBand++)
-                {
-                    const int nPix = pabyLine[i * nDstBands + iBand];
+                        if (panCounts[i] <= nMaxNonBlack)
+                            nNonBlackPixels = panCounts[i];
+                        else
+                            nNonBlackPixels++;
+                    }
 
-                    if (oColor[iBand] - nPix > nNearDist ||
-                        nPix > nNearDist + oColor[iBand])
+                    if (nNonBlackPixels > nMaxNonBlack)
                     {
-                        bIsNonBlack = true;
-                        break;
+                        bDoTest = false;
+                        continue;
                     }
-                }
 
-                if (!bIsNonBlack)
-                    break;
-            }
+                    if (bIsNonBlack && nMaxNonBlack > 0 && i == iStart)
+                    {
+                        // if there's a valid value just at the left or right
+                        // of the raster, then ignore the nMaxNonBlack setting
+                        bDoTest = false;
+                        continue;
+                    }
 
-            if (bIsNonBlack)
-            {
-                panLastLineCounts[i]++;
+                    pabyFlags[i] |= NEARBLACK_FLAG_REPLACED;
+                }
 
-                if (panLastLineCounts[i] > nMaxNonBlack)
-                    continue;
+                /***** seen valid data but test if the *****/
+                /***** vertical pass saw any non valid data *****/
 
-                if (iLineFromTopOrBottom == 0 && nMaxNonBlack > 0)
+                else if (panCounts[i] == 0)
                 {
-                    // if there's a valid value just at the top or bottom
-                    // of the raster, then ignore the nMaxNonBlack setting
-                    panLastLineCounts[i] = nMaxNonBlack + 1;
-                    continue;
+                    bDoTest = true;
+                    nNonBlackPixels = 0;
                 }
             }
-            // else
-            //   panLastLineCounts[i] = 0; // not sure this even makes sense
-
-            /***** replace the pixel values *****/
-            for (int iBand = 0; iBand < nSrcBands; iBand++)
-                pabyLine[i * nDstBands + iBand] = nReplacevalue;
-
-            /***** alpha *****/
-            if (nDstBands > nSrcBands)
-                pabyLine[i * nDstBands + nDstBands - 1] = 0;
-
-            /***** mask *****/
-            if (pabyMask != nullptr)
-                pabyMask[i] = 0;
         }
-    }
 
-    /* -------------------------------------------------------------------- */
-    /*      Horizontal Checking.                                            */
-    /* -------------------------------------------------------------------- */
-
-    if (bDoHorizontalCheck)
-    {
-        int nNonBlackPixels = 0;
+        /***** replace the pixel values *****/
 
-        /***** on a bottom up pass assume nMaxNonBlack is 0 *****/
+        for (int iBand = 0; iBand < sCtxt.nSrcBands; iBand++)
+        {
+            GByte *pabyBand =
+                sCtxt.pabyData + iBand * sCtxt.nBandSpace + nOffset;
+            for (int i = 0; i < nXSize; i++)
+            {
+                if (pabyFlags[i] & NEARBLACK_FLAG_REPLACED)
+                    pabyBand[i] = sCtxt.nReplaceValue;
+            }
+        }
 
-        if (bBottomUp)
-            nMaxNonBlack = 0;
+        /***** alpha *****/
 
-        const int iDir = iStart < iEnd ? 1 : -1;
+        if (sCtxt.nDstBands > sCtxt.nSrcBands)
+        {
+            GByte *pabyAlpha = sCtxt.pabyData +
+                               (sCtxt.nDstBands - 1) * sCtxt.nBandSpace +
+                               nOffset;
+            for (int i = 0; i < nXSize; i++)
+            {
+                if (pabyFlags[i] & NEARBLACK_FLAG_REPLACED)
+                    pabyAlpha[i] = 0;
+            }
+        }
 
-        bool bDoTest = TRUE;
+        /***** mask *****/
 
-        for (int i = iStart; i != iEnd; i += iDir)
+        if (sCtxt.pabyMask != nullptr)
         {
-            /***** not seen any valid data? *****/
-
-            if (bDoTest)
+            GByte *pabyMask = sCtxt.pabyMask + nOffset;
+            for (int i = 0; i < nXSize; i++)
             {
-                /***** is the pixel valid data? ****/
+                if (pabyFlags[i] & NEARBLACK_FLAG_REPLACED)
+                    pabyMask[i] = 0;
+            }
+        }
+    }
+}
 
-                bool bIsNonBlack = false;
+/************************************************************************/
+/*                         NearblackRunStep()                           */
+/*                                                                      */
+/*      Run pfnStep over [0, nItems[, split in ranges processed by the  */
+/*      worker threads when poJobQueue is not null.                     */
+/************************************************************************/
 
-                /***** loop over the colors *****/
+static void NearblackJobFunc(void *pData)
+{
+    const NearblackJob *psJob = static_cast<const NearblackJob *>(pData);
+    psJob->pfnStep(*(psJob->psCtxt), psJob->iStart, psJob->iEnd);
+}
 
-                for (int iColor = 0; iColor < static_cast<int>(oColors.size());
-                     iColor++)
-                {
+static void NearblackRunStep(CPLJobQueue *poJobQueue, int nThreads,
+                             NearblackStepFunc pfnStep,
+                             const NearblackPassContext &sCtxt, int nItems)
+{
+    const int nJobs = poJobQueue ? std::min(nThreads, nItems) : 1;
+    if (nJobs <= 1)
+    {
+        pfnStep(sCtxt, 0, nItems);
+        return;
+    }
 
-                    const Color &oColor = oColors[iColor];
+    std::vector<NearblackJob> asJobs(nJobs);
+    for (int iJob = 0; iJob < nJobs; ++iJob)
+    {
+        asJobs[iJob].psCtxt = &sCtxt;
+        asJobs[iJob].pfnStep = pfnStep;
+        asJobs[iJob].iStart =
+            static_cast<int>(static_cast<int64_t>(nItems) * iJob / nJobs);
+        asJobs[iJob].iEnd =
+            static_cast<int>(static_cast<int64_t>(nItems) * (iJob + 1) / nJobs);
+        if (!poJobQueue->SubmitJob(NearblackJobFunc, &asJobs[iJob]))
+            NearblackJobFunc(&asJobs[iJob]);
+    }
+    poJobQueue->WaitCompletion();
+}
 
-                    bIsNonBlack = false;
+/************************************************************************/
+/*                   GDALNearblackTwoPassesAlgorithm()                  */
+/*                                                                      */
+/* Do a top-to-bottom pass, followed by a bottom-to-top one.            */
+/*                                                                      */
+/* Each pass processes strips of lines: pixels are first classified as */
+/* black or non black, then the vertical check is done column-wise,     */
+/* and finally the horizontal check of each line, which only depends    */
+/* on the vertical counts after that line. All steps are run by the     */
+/* worker threads when GDAL_NUM_THREADS is set.                         */
+/************************************************************************/
 
-                    /***** loop over the bands *****/
+bool GDALNearblackTwoPassesAlgorithm(const GDALNearblackOptions *psOptions,
+                                     GDALDatasetH hSrcDataset,
+                                     GDALDatasetH hDstDS,
+                                     GDALRasterBandH hMaskBand, int nBands,
+                                     int nDstBands, bool bSetMask,
+                                     const Colors &oColors)
+{
+    const int nXSize = GDALGetRasterXSize(hSrcDataset);
+    const int nYSize = GDALGetRasterYSize(hSrcDataset);
 
-                    for (int iBand = 0; iBand < nSrcBands; iBand++)
-                    {
-                        const int nPix = pabyLine[i * nDstBands + iBand];
+    const bool bSetAlpha = psOptions->bSetAlpha;
 
-                        if (oColor[iBand] - nPix > nNearDist ||
-                            nPix > nNearDist + oColor[iBand])
-                        {
-                            bIsNonBlack = true;
-                            break;
-                        }
-                    }
+    NearblackPassContext sCtxt;
+    sCtxt.nXSize = nXSize;
+    sCtxt.nYSize = nYSize;
+    sCtxt.nSrcBands = nBands;
+    sCtxt.nDstBands = nDstBands;
+    sCtxt.nNearDist = psOptions->nNearDist;
+    sCtxt.nMaxNonBlack = psOptions->nMaxNonBlack;
+    sCtxt.poColors = &oColors;
+    sCtxt.nReplaceValue = psOptions->bNearWhite ? 255 : 0;
+    {
+        const std::vector<GByte> abyReplaced(std::max(1, nBands),
+                                             sCtxt.nReplaceValue);
+        GByte abyFlag[1] = {0};
+        GByte abyFar[1] = {0};
+        NearblackComputeNonBlack(abyReplaced.data(), 1, 1, nBands,
+                                 sCtxt.nNearDist, oColors, abyFlag, abyFar);
+        sCtxt.bReplacedIsNonBlack = abyFlag[0] != 0;
+    }
 
-                    if (bIsNonBlack == false)
-                        break;
-                }
+    /* -------------------------------------------------------------------- */
+    /*      Multi-threaded processing, when GDAL_NUM_THREADS is set.        */
+    /* -------------------------------------------------------------------- */
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    int nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                     : atoi(pszNumThreads);
+    nThreads = std::max(1, std::min(nThreads, 1024));
+    std::unique_ptr<CPLJobQueue> poJobQueue;
+    if (nThreads > 1)
+    {
+        CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+        if (poThreadPool)
+            poJobQueue = poThreadPool->CreateJobQueue();
+    }
 
-                if (bIsNonBlack)
-                {
-                    /***** use nNonBlackPixels in grey areas  *****/
-                    /***** from the vertical pass's grey areas ****/
+    /* -------------------------------------------------------------------- */
+    /*      Allocate the strip buffers.                                     */
+    /* -------------------------------------------------------------------- */
+    constexpr size_t MAX_STRIP_BYTES = 64 * 1024 * 1024;
+    const size_t nBytesPerLine =
+        std::max<size_t>(1, static_cast<size_t>(nXSize) *
+                                (nDstBands + 2 + sizeof(int)));
+    const int nStripLines = static_cast<int>(std::max<size_t>(
+        1, std::min<size_t>(nYSize, MAX_STRIP_BYTES / nBytesPerLine)));
+    const size_t nStripPixels = static_cast<size_t>(nXSize) * nStripLines;
+
+    std::vector<GByte> abyData;
+    std::vector<GByte> abyMask;
+    std::vector<GByte> abyFlags;
+    std::vector<int> anCounts;
+    std::vector<int> anLastLineCounts;
+    try
+    {
+        abyData.resize(nStripPixels * nDstBands);
+        if (bSetMask)
+            abyMask.resize(nStripPixels);
+        abyFlags.resize(nStripPixels);
+        anCounts.resize(nStripPixels);
+        anLastLineCounts.resize(nXSize);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory allocating working buffers");
+        return false;
+    }
+    sCtxt.pabyData = abyData.data();
+    sCtxt.pabyMask = bSetMask ? abyMask.data() : nullptr;
+    sCtxt.pabyFlags = abyFlags.data();
+    sCtxt.panCounts = anCounts.data();
+    sCtxt.panLastLineCounts = anLastLineCounts.data();
 
-                    if (panLastLineCounts[i] <= nMaxNonBlack)
-                        nNonBlackPixels = panLastLineCounts[i];
-                    else
-                        nNonBlackPixels++;
-                }
+    /* -------------------------------------------------------------------- */
+    /*      Process from the top down, and then from the bottom back up.    */
+    /* -------------------------------------------------------------------- */
+    for (int iPass = 0; iPass < 2; ++iPass)
+    {
+        const bool bBottomUp = iPass == 1;
+        sCtxt.bBottomUp = bBottomUp;
+        std::fill(anLastLineCounts.begin(), anLastLineCounts.end(), 0);
 
-                if (nNonBlackPixels > nMaxNonBlack)
+        for (int iLine = 0; iLine < nYSize; iLine += nStripLines)
+        {
+            const int nLines = std::min(nStripLines, nYSize - iLine);
+            const int nYOff = bBottomUp ? nYSize - iLine - nLines : iLine;
+            const size_t nBandSpace = static_cast<size_t>(nXSize) * nLines;
+            sCtxt.nYOff = nYOff;
+            sCtxt.nLines = nLines;
+            sCtxt.nBandSpace = nBandSpace;
+
+            if (!bBottomUp)
+            {
+                if (GDALDatasetRasterIOEx(
+                        hSrcDataset, GF_Read, 0, nYOff, nXSize, nLines,
+                        sCtxt.pabyData, nXSize, nLines, GDT_Byte, nBands,
+                        nullptr, 1, nXSize, nBandSpace, nullptr) != CE_None)
                 {
-                    bDoTest = false;
-                    continue;
+                    return false;
                 }
 
-                if (bIsNonBlack && nMaxNonBlack > 0 && i == iStart)
+                if (bSetAlpha)
                 {
-                    // if there's a valid value just at the left or right
-                    // of the raster, then ignore the nMaxNonBlack setting
-                    bDoTest = false;
-                    continue;
+                    memset(sCtxt.pabyData + (nDstBands - 1) * nBandSpace, 255,
+                           nBandSpace);
                 }
 
-                /***** replace the pixel values *****/
+                if (bSetMask)
+                    memset(sCtxt.pabyMask, 255, nBandSpace);
+            }
+            else
+            {
+                if (GDALDatasetRasterIOEx(
+                        hDstDS, GF_Read, 0, nYOff, nXSize, nLines,
+                        sCtxt.pabyData, nXSize, nLines, GDT_Byte, nDstBands,
+                        nullptr, 1, nXSize, nBandSpace, nullptr) != CE_None)
+                {
+                    return false;
+                }
 
-                for (int iBand = 0; iBand < nSrcBands; iBand++)
-                    pabyLine[i * nDstBands + iBand] = nReplacevalue;
+                /***** read the mask band lines back in *****/
 
-                /***** alpha *****/
+                if (bSetMask &&
+                    GDALRasterIO(hMaskBand, GF_Read, 0, nYOff, nXSize, nLines,
+                                 sCtxt.pabyMask, nXSize, nLines, GDT_Byte, 0,
+                                 0) != CE_None)
+                {
+                    return false;
+                }
+            }
 
-                if (nDstBands > nSrcBands)
-                    pabyLine[i * nDstBands + nDstBands - 1] = 0;
+            NearblackRunStep(poJobQueue.get(), nThreads,
+                             NearblackClassifyLines, sCtxt, nLines);
+            NearblackRunStep(poJobQueue.get(), nThreads,
+                             NearblackVerticalCheck, sCtxt, nXSize);
+            NearblackRunStep(poJobQueue.get(), nThreads,
+                             NearblackHorizontalCheck, sCtxt, nLines);
+
+            if (GDALDatasetRasterIOEx(hDstDS, GF_Write, 0, nYOff, nXSize,
+                                      nLines, sCtxt.pabyData, nXSize, nLines,
+                                      GDT_Byte, nDstBands, nullptr, 1, nXSize,
+                                      nBandSpace, nullptr) != CE_None)
+            {
+                return false;
+            }
 
-                /***** mask *****/
+            /***** write out the mask band lines *****/
 
-                if (pabyMask != nullptr)
-                    pabyMask[i] = 0;
+            if (bSetMask &&
+                GDALRasterIO(hMaskBand, GF_Write, 0, nYOff, nXSize, nLines,
+                             sCtxt.pabyMask, nXSize, nLines, GDT_Byte, 0,
+                             0) != CE_None)
+            {
+                if (!bBottomUp)
+                {
+                    CPLError(CE_Warning, CPLE_AppDefined,
+                             "ERROR writing out line to mask band.");
+                }
+                return false;
             }
 
-            /***** seen valid data but test if the *****/
-            /***** vertical pass saw any non valid data *****/
-
-            else if (panLastLineCounts[i] == 0)
+            const double dfProgress =
+                bBottomUp ? 0.5 + 0.5 * (nYSize - nYOff) /
+                                      static_cast<double>(nYSize)
+                          : 0.5 * ((nYOff + nLines) /
+                                   static_cast<double>(nYSize));
+            if (!(psOptions->pfnProgress(dfProgress, nullptr,
+                                         psOptions->pProgressData)))
             {
-                bDoTest = true;
-                nNonBlackPixels = 0;
+                return false;
             }
         }
     }
+
+    return true;
 }
 
 /************************************************************************/
@@ -35,14 +35,18 @@
 
 #include <cassert>
 #include <climits>
+#include <condition_variable>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 
 #include <algorithm>
+#include <atomic>
+#include <deque>
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <unordered_set>
 #include <string>
@@ -52,14 +56,19 @@
 #include "commonutils.h"
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_progress.h"
+#include "cpl_quad_tree.h"
 #include "cpl_string.h"
 #include "cpl_time.h"
+#include "cpl_trace.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_alg.h"
 #include "gdal_alg_priv.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
@@ -439,6 +448,12 @@ struct GDALVectorTranslateOptions
     /*! Maximum number of features, or -1 if no limit. */
     GIntBig nLimit = -1;
 
+    /*! Number of threads used to transform geometries. 0 or 1 means that
+        geometries are processed by the calling thread, -1 means the
+        GDAL_NUM_THREADS configuration option, or all CPUs if it is not set.
+     */
+    int nThreads = 0;
+
     /*! Wished offset w.r.t UTC of dateTime */
     int nTZOffsetInSec = TZ_OFFSET_INVALID;
 
@@ -554,6 +569,305 @@ class SetupTargetLayer
           GDALVectorTranslateOptions *psOptions, GIntBig &nTotalEventsDone);
 };
 
+/************************************************************************/
+/*                          TiledClipGeometry                           */
+/*                                                                      */
+/*      Clip geometry (-clipsrc / -clipdst) split into tiles of         */
+/*      bounded complexity, so that a feature is only intersected with  */
+/*      the piece of the clip geometry that overlaps it. Features       */
+/*      entirely within the clip geometry are detected with prepared    */
+/*      geometries, and not intersected at all.                         */
+/*                                                                      */
+/*      Prepared geometries are not thread-safe, so an instance must    */
+/*      only be used by a single thread.                                */
+/************************************************************************/
+
+class TiledClipGeometry
+{
+    // Clip geometries smaller than that are not split.
+    static constexpr size_t MAX_TILE_WKB_SIZE = 64 * 1024;
+    static constexpr int MAX_DEPTH = 10;
+
+    struct Tile
+    {
+        OGREnvelope sCell{};
+        std::unique_ptr<OGRGeometry> poGeom{};
+        OGRPreparedGeometryUniquePtr poPreparedGeom{};
+        // Whether the cell is entirely covered by the clip geometry
+        bool bFull = false;
+    };
+
+    const OGRGeometry *const m_poClipGeom;
+    OGRPreparedGeometryUniquePtr m_poPreparedClipGeom{};
+    std::vector<std::unique_ptr<Tile>> m_apoTiles{};
+    CPLQuadTree *m_hTileTree = nullptr;
+
+    bool Subdivide(std::unique_ptr<OGRGeometry> poGeom,
+                   const OGREnvelope &sCell, int nDepth);
+
+    CPL_DISALLOW_COPY_ASSIGN(TiledClipGeometry)
+
+  public:
+    explicit TiledClipGeometry(const OGRGeometry *poClipGeom);
+    ~TiledClipGeometry();
+
+    const OGRGeometry *GetClipGeometry() const
+    {
+        return m_poClipGeom;
+    }
+
+    std::unique_ptr<OGRGeometry> Intersection(const OGRGeometry *poGeom) const;
+};
+
+/************************************************************************/
+/*                 TiledClipGeometry::TiledClipGeometry()               */
+/************************************************************************/
+
+TiledClipGeometry::TiledClipGeometry(const OGRGeometry *poClipGeom)
+    : m_poClipGeom(poClipGeom)
+{
+    if (!OGRHasPreparedGeometrySupport())
+        return;
+    m_poPreparedClipGeom.reset(OGRCreatePreparedGeometry(
+        OGRGeometry::ToHandle(const_cast<OGRGeometry *>(poClipGeom))));
+
+    if (poClipGeom->getDimension() != 2 || poClipGeom->hasCurveGeometry() ||
+        poClipGeom->WkbSize() <= MAX_TILE_WKB_SIZE)
+    {
+        return;
+    }
+
+    OGREnvelope sEnv;
+    poClipGeom->getEnvelope(&sEnv);
+    bool bOK;
+    {
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        bOK = Subdivide(std::unique_ptr<OGRGeometry>(poClipGeom->clone()),
+                        sEnv, 0);
+    }
+    if (!bOK || m_apoTiles.empty())
+    {
+        CPLDebug("OGR2OGR", "Cannot split clip geometry into tiles");
+        m_apoTiles.clear();
+        return;
+    }
+    CPLDebug("OGR2OGR", "Clip geometry split into %d tiles",
+             static_cast<int>(m_apoTiles.size()));
+
+    CPLRectObj sGlobalBounds;
+    sGlobalBounds.minx = sEnv.MinX;
+    sGlobalBounds.miny = sEnv.MinY;
+    sGlobalBounds.maxx = sEnv.MaxX;
+    sGlobalBounds.maxy = sEnv.MaxY;
+    m_hTileTree = CPLQuadTreeCreate(&sGlobalBounds, nullptr);
+    for (auto &poTile : m_apoTiles)
+    {
+        CPLRectObj sBounds;
+        sBounds.minx = poTile->sCell.MinX;
+        sBounds.miny = poTile->sCell.MinY;
+        sBounds.maxx = poTile->sCell.MaxX;
+        sBounds.maxy = poTile->sCell.MaxY;
+        CPLQuadTreeInsertWithBounds(m_hTileTree, poTile.get(), &sBounds);
+    }
+}
+
+/************************************************************************/
+/*                TiledClipGeometry::~TiledClipGeometry()               */
+/************************************************************************/
+
+TiledClipGeometry::~TiledClipGeometry()
+{
+    if (m_hTileTree)
+        CPLQuadTreeDestroy(m_hTileTree);
+}
+
+/************************************************************************/
+/*                     TiledClipGeometry::Subdivide()                   */
+/************************************************************************/
+
+bool TiledClipGeometry::Subdivide(std::unique_ptr<OGRGeometry> poGeom,
+                                  const OGREnvelope &sCell, int nDepth)
+{
+    // Only keep the areal parts of the result of intersections, that
+    // may also contain lines or points along the cell boundaries.
+    if (wkbFlatten(poGeom->getGeometryType()) == wkbGeometryCollection)
+    {
+        auto poMP = std::make_unique<OGRMultiPolygon>();
+        for (const auto *poPart : *(poGeom->toGeometryCollection()))
+        {
+            const auto eType = wkbFlatten(poPart->getGeometryType());
+            if (eType == wkbPolygon)
+            {
+                poMP->addGeometry(poPart);
+            }
+            else if (eType == wkbMultiPolygon)
+            {
+                for (const auto *poPoly : *(poPart->toMultiPolygon()))
+                    poMP->addGeometry(poPoly);
+            }
+        }
+        poGeom = std::move(poMP);
+    }
+    if (poGeom->IsEmpty())
+        return true;
+
+    if (nDepth == MAX_DEPTH || poGeom->WkbSize() <= MAX_TILE_WKB_SIZE)
+    {
+        auto poTile = std::make_unique<Tile>();
+        poTile->sCell = sCell;
+        if (wkbFlatten(poGeom->getGeometryType()) == wkbPolygon &&
+            poGeom->toPolygon()->getNumInteriorRings() == 0)
+        {
+            const double dfCellArea =
+                (sCell.MaxX - sCell.MinX) * (sCell.MaxY - sCell.MinY);
+            poTile->bFull =
+                poGeom->toPolygon()->get_Area() >= dfCellArea * (1 - 1e-10);
+        }
+        if (!poTile->bFull)
+        {
+            poTile->poPreparedGeom.reset(OGRCreatePreparedGeometry(
+                OGRGeometry::ToHandle(poGeom.get())));
+            if (!poTile->poPreparedGeom)
+                return false;
+        }
+        poTile->poGeom = std::move(poGeom);
+        m_apoTiles.push_back(std::move(poTile));
+        return true;
+    }
+
+    const double dfMidX = (sCell.MinX + sCell.MaxX) / 2;
+    const double dfMidY = (sCell.MinY + sCell.MaxY) / 2;
+    for (int i = 0; i < 4; ++i)
+    {
+        OGREnvelope sSubCell;
+        sSubCell.MinX = (i % 2) == 0 ? sCell.MinX : dfMidX;
+        sSubCell.MaxX = (i % 2) == 0 ? dfMidX : sCell.MaxX;
+        sSubCell.MinY = (i / 2) == 0 ? sCell.MinY : dfMidY;
+        sSubCell.MaxY = (i / 2) == 0 ? dfMidY : sCell.MaxY;
+
+        auto poRing = std::make_unique<OGRLinearRing>();
+        poRing->addPoint(sSubCell.MinX, sSubCell.MinY);
+        poRing->addPoint(sSubCell.MinX, sSubCell.MaxY);
+        poRing->addPoint(sSubCell.MaxX, sSubCell.MaxY);
+        poRing->addPoint(sSubCell.MaxX, sSubCell.MinY);
+        poRing->addPoint(sSubCell.MinX, sSubCell.MinY);
+        OGRPolygon oRect;
+        oRect.addRingDirectly(poRing.release());
+
+        std::unique_ptr<OGRGeometry> poPart(poGeom->Intersection(&oRect));
+        if (!poPart || !Subdivide(std::move(poPart), sSubCell, nDepth + 1))
+            return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                    TiledClipGeometry::Intersection()                 */
+/************************************************************************/
+
+/** Return the intersection of poGeom with the clip geometry, or nullptr if
+ * they do not intersect.
+ */
+std::unique_ptr<OGRGeometry>
+TiledClipGeometry::Intersection(const OGRGeometry *poGeom) const
+{
+    if (!m_poPreparedClipGeom)
+        return std::unique_ptr<OGRGeometry>(m_poClipGeom->Intersection(poGeom));
+
+    OGRGeometryH hGeom =
+        OGRGeometry::ToHandle(const_cast<OGRGeometry *>(poGeom));
+    // The result of Intersection() is linear, so only return the input
+    // geometry as it when that does not make a difference.
+    const bool bCanReturnInput = !poGeom->hasCurveGeometry();
+
+    if (m_hTileTree)
+    {
+        OGREnvelope sEnv;
+        poGeom->getEnvelope(&sEnv);
+        CPLRectObj sBounds;
+        sBounds.minx = sEnv.MinX;
+        sBounds.miny = sEnv.MinY;
+        sBounds.maxx = sEnv.MaxX;
+        sBounds.maxy = sEnv.MaxY;
+        int nCount = 0;
+        void **pahTiles = CPLQuadTreeSearch(m_hTileTree, &sBounds, &nCount);
+        const Tile *poTile =
+            nCount == 1 ? static_cast<const Tile *>(pahTiles[0]) : nullptr;
+        CPLFree(pahTiles);
+
+        // The tiles cover the whole clip geometry.
+        if (nCount == 0)
+            return nullptr;
+
+        // If the geometry lies in a single cell, the intersection with the
+        // clip geometry is its intersection with the tile.
+        if (poTile && poTile->sCell.Contains(sEnv))
+        {
+            if (poTile->bFull ||
+                OGRPreparedGeometryContains(poTile->poPreparedGeom.get(),
+                                            hGeom))
+            {
+                if (bCanReturnInput)
+                    return std::unique_ptr<OGRGeometry>(poGeom->clone());
+            }
+            else if (!OGRPreparedGeometryIntersects(
+                         poTile->poPreparedGeom.get(), hGeom))
+            {
+                return nullptr;
+            }
+            return std::unique_ptr<OGRGeometry>(
+                poTile->poGeom->Intersection(poGeom));
+        }
+    }
+
+    if (OGRPreparedGeometryContains(m_poPreparedClipGeom.get(), hGeom))
+    {
+        if (bCanReturnInput)
+            return std::unique_ptr<OGRGeometry>(poGeom->clone());
+    }
+    else if (!OGRPreparedGeometryIntersects(m_poPreparedClipGeom.get(), hGeom))
+    {
+        return nullptr;
+    }
+    return std::unique_ptr<OGRGeometry>(m_poClipGeom->Intersection(poGeom));
+}
+
+/************************************************************************/
+/*                       GetTiledClipGeometry()                         */
+/************************************************************************/
+
+static const TiledClipGeometry &
+GetTiledClipGeometry(std::unique_ptr<TiledClipGeometry> &poTiledClipGeom,
+                     const OGRGeometry *poClipGeom)
+{
+    if (!poTiledClipGeom || poTiledClipGeom->GetClipGeometry() != poClipGeom)
+        poTiledClipGeom = std::make_unique<TiledClipGeometry>(poClipGeom);
+    return *poTiledClipGeom;
+}
+
+/************************************************************************/
+/*                       GeometryTransformContext                       */
+/*                                                                      */
+/*      Mutable state used by LayerTranslator::TransformGeometry(),     */
+/*      that must not be shared between threads.                        */
+/************************************************************************/
+
+struct GeometryTransformContext
+{
+    std::unique_ptr<OGRGeometry> m_poClipSrcReprojectedToSrcSRS{};
+    const OGRSpatialReference *m_poClipSrcReprojectedToSrcSRS_SRS = nullptr;
+    std::unique_ptr<OGRGeometry> m_poClipDstReprojectedToDstSRS{};
+    const OGRSpatialReference *m_poClipDstReprojectedToDstSRS_SRS = nullptr;
+    std::unique_ptr<TiledClipGeometry> m_poTiledClipSrc{};
+    std::unique_ptr<TiledClipGeometry> m_poTiledClipDst{};
+    OGRGeometryFactory::TransformWithOptionsCache m_transformWithOptionsCache{};
+    bool m_bRunSetPrecisionEvaluated = false;
+    bool m_bRunSetPrecision = false;
+    // When set, serializes accesses to the clip geometries and spatial
+    // reference objects shared with other threads.
+    std::mutex *m_poSharedObjectsMutex = nullptr;
+};
+
 class LayerTranslator
 {
     static bool TranslateArrow(const TargetLayerInfo *psInfo,
@@ -579,17 +893,14 @@ class LayerTranslator
     GeomOperation m_eGeomOp = GEOMOP_NONE;
     double m_dfGeomOpParam = 0;
     OGRGeometry *m_poClipSrcOri = nullptr;
-    bool m_bWarnedClipSrcSRS = false;
-    std::unique_ptr<OGRGeometry> m_poClipSrcReprojectedToSrcSRS;
-    const OGRSpatialReference *m_poClipSrcReprojectedToSrcSRS_SRS = nullptr;
+    std::atomic<bool> m_bWarnedClipSrcSRS{false};
     OGRGeometry *m_poClipDstOri = nullptr;
-    bool m_bWarnedClipDstSRS = false;
-    std::unique_ptr<OGRGeometry> m_poClipDstReprojectedToDstSRS;
-    const OGRSpatialReference *m_poClipDstReprojectedToDstSRS_SRS = nullptr;
+    std::atomic<bool> m_bWarnedClipDstSRS{false};
     bool m_bExplodeCollections = false;
     bool m_bNativeData = false;
     GIntBig m_nLimit = -1;
-    OGRGeometryFactory::TransformWithOptionsCache m_transformWithOptionsCache;
+    int m_nThreads = 0;
+    GeometryTransformContext m_oGeomTransformContext{};
 
     bool Translate(OGRFeature *poFeatureIn, TargetLayerInfo *psInfo,
                    GIntBig nCountLayerFeatures, GIntBig *pnReadFeatureCount,
@@ -597,9 +908,30 @@ class LayerTranslator
                    void *pProgressArg,
                    const GDALVectorTranslateOptions *psOptions);
 
+    enum class GeometryTransformStatus
+    {
+        OK,
+        SKIP_FEATURE,
+        REPROJECTION_FAILED
+    };
+
+    GeometryTransformStatus
+    TransformGeometry(std::unique_ptr<OGRGeometry> &poDstGeometry,
+                      TargetLayerInfo *psInfo, int iGeom,
+                      OGRCoordinateTransformation *poCT,
+                      const OGRSpatialReference *poOutputSRS, GIntBig nSrcFID,
+                      const GDALVectorTranslateOptions *psOptions,
+                      GeometryTransformContext &oCtx);
+
   private:
-    const OGRGeometry *GetDstClipGeom(const OGRSpatialReference *poGeomSRS);
-    const OGRGeometry *GetSrcClipGeom(const OGRSpatialReference *poGeomSRS);
+    static bool
+    ReportReprojectionFailure(OGRLayer *poDstLayer, GIntBig nSrcFID,
+                              const GDALVectorTranslateOptions *psOptions);
+
+    const OGRGeometry *GetDstClipGeom(const OGRSpatialReference *poGeomSRS,
+                                      GeometryTransformContext &oCtx);
+    const OGRGeometry *GetSrcClipGeom(const OGRSpatialReference *poGeomSRS,
+                                      GeometryTransformContext &oCtx);
 };
 
 static OGRLayer *GetLayerAndOverwriteIfNecessary(GDALDataset *poDstDS,
@@ -1325,6 +1657,192 @@ class AxisMappingCoordinateTransformation : public OGRCoordinateTransformation
     }
 };
 
+/************************************************************************/
+/*                   BatchedCoordinateTransformation                    */
+/************************************************************************/
+
+// Reprojects the geometries of a batch of features at once with
+// OGRCoordinateTransformation::TransformParallel().
+//
+// In a first pass, geometries of the batch are "transformed" with this
+// object in recording mode, which collects the coordinates of every
+// Transform() call without altering them. Compute() then transforms all of
+// them at once. In the second pass, the regular per-feature reprojection
+// code uses this object, which serves each Transform() call from the
+// precomputed results when its input is identical to the recorded one, and
+// otherwise delegates to the wrapped transformation.
+class BatchedCoordinateTransformation final
+    : public OGRCoordinateTransformation
+{
+    struct Call
+    {
+        size_t nOffset = 0;
+        size_t nCount = 0;
+    };
+
+    OGRCoordinateTransformation *const m_poCT;
+    bool m_bRecording = true;
+    bool m_bComputed = false;
+    std::vector<Call> m_asCalls{};
+    std::vector<size_t> m_anFeatureFirstCall{};
+    std::vector<double> m_adfXIn{}, m_adfYIn{}, m_adfZIn{};
+    std::vector<double> m_adfX{}, m_adfY{}, m_adfZ{};
+    std::vector<int> m_anErrorCodes{};
+    size_t m_iCurCall = 0;
+    size_t m_iEndCall = 0;
+
+    CPL_DISALLOW_COPY_ASSIGN(BatchedCoordinateTransformation)
+
+  public:
+    explicit BatchedCoordinateTransformation(OGRCoordinateTransformation *poCT)
+        : m_poCT(poCT)
+    {
+    }
+
+    /** Start a new batch, in recording mode. */
+    void Reset()
+    {
+        m_bRecording = true;
+        m_bComputed = false;
+        m_asCalls.clear();
+        m_anFeatureFirstCall.clear();
+        m_adfXIn.clear();
+        m_adfYIn.clear();
+        m_adfZIn.clear();
+        m_iCurCall = 0;
+        m_iEndCall = 0;
+    }
+
+    /** Record the Transform() calls needed to reproject poGeom, which is
+     * the geometry of the next feature of the batch (possibly null). */
+    void RecordFeature(const OGRGeometry *poGeom)
+    {
+        m_anFeatureFirstCall.push_back(m_asCalls.size());
+        if (poGeom)
+        {
+            // Work on a copy, as transform() reassigns the geometry SRS.
+            std::unique_ptr<OGRGeometry> poTmpGeom(poGeom->clone());
+            poTmpGeom->transform(this);
+        }
+    }
+
+    /** Return the number of points recorded in the current batch. */
+    size_t GetRecordedPointCount() const
+    {
+        return m_adfXIn.size();
+    }
+
+    /** Transform all recorded coordinates, and switch to replay mode. */
+    void Compute()
+    {
+        m_anFeatureFirstCall.push_back(m_asCalls.size());
+        m_bRecording = false;
+        m_adfX = m_adfXIn;
+        m_adfY = m_adfYIn;
+        m_adfZ = m_adfZIn;
+        m_anErrorCodes.resize(m_adfX.size());
+        m_bComputed =
+            m_adfX.empty() ||
+            m_poCT->TransformParallel(m_adfX.size(), m_adfX.data(),
+                                      m_adfY.data(), m_adfZ.data(), nullptr,
+                                      m_anErrorCodes.data()) != FALSE;
+    }
+
+    /** Select the feature of the batch whose geometry is going to be
+     * reprojected. */
+    void StartFeature(size_t iFeature)
+    {
+        m_iCurCall = m_anFeatureFirstCall[iFeature];
+        m_iEndCall = m_anFeatureFirstCall[iFeature + 1];
+    }
+
+    const OGRSpatialReference *GetSourceCS() const override
+    {
+        return m_poCT->GetSourceCS();
+    }
+
+    const OGRSpatialReference *GetTargetCS() const override
+    {
+        return m_poCT->GetTargetCS();
+    }
+
+    bool GetEmitErrors() const override
+    {
+        return m_poCT->GetEmitErrors();
+    }
+
+    void SetEmitErrors(bool bEmitErrors) override
+    {
+        m_poCT->SetEmitErrors(bEmitErrors);
+    }
+
+    int Transform(size_t nCount, double *x, double *y, double *z, double *t,
+                  int *pabSuccess) override
+    {
+        if (m_bRecording)
+        {
+            // Calls made without Z or with a time component are not
+            // recorded, and will be forwarded to m_poCT when replayed.
+            if (z != nullptr && t == nullptr)
+            {
+                Call sCall;
+                sCall.nOffset = m_adfXIn.size();
+                sCall.nCount = nCount;
+                m_asCalls.push_back(sCall);
+                m_adfXIn.insert(m_adfXIn.end(), x, x + nCount);
+                m_adfYIn.insert(m_adfYIn.end(), y, y + nCount);
+                m_adfZIn.insert(m_adfZIn.end(), z, z + nCount);
+            }
+            if (pabSuccess)
+            {
+                for (size_t i = 0; i < nCount; ++i)
+                    pabSuccess[i] = TRUE;
+            }
+            return TRUE;
+        }
+
+        if (m_bComputed && m_iCurCall < m_iEndCall && z != nullptr &&
+            t == nullptr)
+        {
+            const Call &sCall = m_asCalls[m_iCurCall];
+            const size_t nOffset = sCall.nOffset;
+            const size_t nBytes = nCount * sizeof(double);
+            if (sCall.nCount == nCount &&
+                (nCount == 0 ||
+                 (memcmp(x, m_adfXIn.data() + nOffset, nBytes) == 0 &&
+                  memcmp(y, m_adfYIn.data() + nOffset, nBytes) == 0 &&
+                  memcmp(z, m_adfZIn.data() + nOffset, nBytes) == 0)))
+            {
+                ++m_iCurCall;
+                if (nCount)
+                {
+                    memcpy(x, m_adfX.data() + nOffset, nBytes);
+                    memcpy(y, m_adfY.data() + nOffset, nBytes);
+                    memcpy(z, m_adfZ.data() + nOffset, nBytes);
+                }
+                if (pabSuccess)
+                {
+                    for (size_t i = 0; i < nCount; ++i)
+                        pabSuccess[i] = m_anErrorCodes[nOffset + i] == 0;
+                }
+                return TRUE;
+            }
+        }
+
+        return m_poCT->Transform(nCount, x, y, z, t, pabSuccess);
+    }
+
+    OGRCoordinateTransformation *Clone() const override
+    {
+        return m_poCT->Clone();
+    }
+
+    OGRCoordinateTransformation *GetInverse() const override
+    {
+        return m_poCT->GetInverse();
+    }
+};
+
 /************************************************************************/
 /*                        ApplySpatialFilter()                          */
 /************************************************************************/
@@ -2823,6 +3341,20 @@ GDALDatasetH GDALVectorTranslate(const char *pszDest, GDALDatasetH hDstDS,
     oTranslator.m_bExplodeCollections = psOptions->bExplodeCollections;
     oTranslator.m_bNativeData = psOptions->bNativeData;
     oTranslator.m_nLimit = psOptions->nLimit;
+    if (psOptions->nThreads < 0)
+    {
+        const char *pszThreads =
+            CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS");
+        oTranslator.m_nThreads = EQUAL(pszThreads, "ALL_CPUS")
+                                     ? CPLGetNumCPUs()
+                                     : atoi(pszThreads);
+    }
+    else
+    {
+        oTranslator.m_nThreads = psOptions->nThreads;
+    }
+    oTranslator.m_nThreads =
+        std::min(128, GDALCapThreadCount(oTranslator.m_nThreads));
 
     if (psOptions->nGroupTransactions)
     {
@@ -5751,73 +6283,356 @@ bool LayerTranslator::TranslateArrow(
 }
 
 /************************************************************************/
-/*                     LayerTranslator::Translate()                     */
+/*                      GeometryTransformPipeline                       */
+/*                                                                      */
+/*      Runs LayerTranslator::TransformGeometry() on worker threads,    */
+/*      on features read ahead of the ones being written. Reading and   */
+/*      writing stay on the calling thread, as datasets are not         */
+/*      thread-safe and the source and target may be the same one.      */
+/*      Features are returned in reading order.                         */
+/*                                                                      */
+/*      Only the single geometry field case is handled.                 */
 /************************************************************************/
 
-bool LayerTranslator::Translate(
-    OGRFeature *poFeatureIn, TargetLayerInfo *psInfo,
-    GIntBig nCountLayerFeatures, GIntBig *pnReadFeatureCount,
-    GIntBig &nTotalEventsDone, GDALProgressFunc pfnProgress, void *pProgressArg,
-    const GDALVectorTranslateOptions *psOptions)
+class GeometryTransformPipeline
 {
-    if (psInfo->m_bUseWriteArrowBatch)
+  public:
+    struct Item
     {
-        return TranslateArrow(psInfo, nCountLayerFeatures, pnReadFeatureCount,
-                              pfnProgress, pProgressArg, psOptions);
-    }
+        std::unique_ptr<OGRFeature> poFeature{};
+        LayerTranslator::GeometryTransformStatus eStatus =
+            LayerTranslator::GeometryTransformStatus::OK;
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+    };
 
-    const int eGType = m_eGType;
-    const OGRSpatialReference *poOutputSRS = m_poOutputSRS;
+    GeometryTransformPipeline(LayerTranslator *poTranslator,
+                              TargetLayerInfo *psInfo,
+                              const OGRSpatialReference *poOutputSRS,
+                              const GDALVectorTranslateOptions *psOptions,
+                              int nThreads, GIntBig nMaxFeatures,
+                              std::unique_ptr<OGRFeature> poFirstFeature);
+    ~GeometryTransformPipeline();
 
-    OGRLayer *poSrcLayer = psInfo->m_poSrcLayer;
-    OGRLayer *poDstLayer = psInfo->m_poDstLayer;
-    const int *const panMap = psInfo->m_anMap.data();
-    const int iSrcZField = psInfo->m_iSrcZField;
-    const bool bPreserveFID = psInfo->m_bPreserveFID;
-    const auto poSrcFDefn = poSrcLayer->GetLayerDefn();
-    const auto poDstFDefn = poDstLayer->GetLayerDefn();
-    const int nSrcGeomFieldCount = poSrcFDefn->GetGeomFieldCount();
-    const int nDstGeomFieldCount = poDstFDefn->GetGeomFieldCount();
-    const bool bExplodeCollections =
-        m_bExplodeCollections && nDstGeomFieldCount <= 1;
-    const int iRequestedSrcGeomField = psInfo->m_iRequestedSrcGeomField;
+    static bool CanBeUsed(const TargetLayerInfo *psInfo);
 
-    if (poOutputSRS == nullptr && !m_bNullifyOutputSRS)
+    bool IsValid() const
     {
-        if (nSrcGeomFieldCount == 1)
-        {
-            poOutputSRS = poSrcLayer->GetSpatialRef();
-        }
-        else if (iRequestedSrcGeomField > 0)
-        {
-            poOutputSRS = poSrcLayer->GetLayerDefn()
-                              ->GetGeomFieldDefn(iRequestedSrcGeomField)
-                              ->GetSpatialRef();
-        }
+        return m_poJobQueue != nullptr;
     }
 
-    /* -------------------------------------------------------------------- */
-    /*      Transfer features.                                              */
-    /* -------------------------------------------------------------------- */
-    if (psOptions->nGroupTransactions)
+    bool GetNextItem(Item &oItem);
+
+    bool ReadFailed() const
     {
-        if (psOptions->nLayerTransaction)
-        {
-            if (poDstLayer->StartTransaction() == OGRERR_FAILURE)
-            {
-                delete poFeatureIn;
-                return false;
-            }
-        }
+        return m_bReadFailed;
     }
 
-    std::unique_ptr<OGRFeature> poFeature;
-    std::unique_ptr<OGRFeature> poDstFeature(new OGRFeature(poDstFDefn));
-    int nFeaturesInTransaction = 0;
-    GIntBig nCount = 0; /* written + failed */
-    GIntBig nFeaturesWritten = 0;
-    bool bRunSetPrecisionEvaluated = false;
-    bool bRunSetPrecision = false;
+    std::unique_ptr<OGRFeature> ReleaseFirstFeature()
+    {
+        return std::move(m_poFirstFeature);
+    }
+
+  private:
+    CPL_DISALLOW_COPY_ASSIGN(GeometryTransformPipeline)
+
+    // Number of features processed by a single job.
+    static constexpr size_t CHUNK_SIZE = 256;
+
+    struct Chunk
+    {
+        GeometryTransformPipeline *poPipeline = nullptr;
+        std::vector<Item> aoItems{};
+        bool bDone = false;
+    };
+
+    struct WorkerState
+    {
+        std::unique_ptr<OGRCoordinateTransformation> poCT{};
+        GeometryTransformContext oCtx{};
+    };
+
+    LayerTranslator *const m_poTranslator;
+    TargetLayerInfo *const m_psInfo;
+    const OGRSpatialReference *const m_poOutputSRS;
+    const GDALVectorTranslateOptions *const m_psOptions;
+    GIntBig m_nRemainingFeatures;
+    std::unique_ptr<OGRFeature> m_poFirstFeature;
+    std::unique_ptr<CPLJobQueue> m_poJobQueue{};
+    size_t m_nMaxChunksInFlight = 0;
+    std::deque<std::unique_ptr<Chunk>> m_apoChunks{};
+    size_t m_iNextItem = 0;
+    bool m_bSourceExhausted = false;
+    bool m_bReadFailed = false;
+
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+    std::mutex m_oSharedObjectsMutex{};
+    std::vector<std::unique_ptr<WorkerState>> m_apoFreeWorkerStates{};
+
+    void SubmitChunks();
+    static void ProcessChunk(void *pData);
+};
+
+/************************************************************************/
+/*            GeometryTransformPipeline::CanBeUsed()                    */
+/************************************************************************/
+
+bool GeometryTransformPipeline::CanBeUsed(const TargetLayerInfo *psInfo)
+{
+    // Each worker needs its own copy of the coordinate transformation.
+    const auto &poCT = psInfo->m_aoReprojectionInfo[0].m_poCT;
+    return poCT == nullptr ||
+           std::unique_ptr<OGRCoordinateTransformation>(poCT->Clone()) !=
+               nullptr;
+}
+
+/************************************************************************/
+/*         GeometryTransformPipeline::GeometryTransformPipeline()       */
+/************************************************************************/
+
+GeometryTransformPipeline::GeometryTransformPipeline(
+    LayerTranslator *poTranslator, TargetLayerInfo *psInfo,
+    const OGRSpatialReference *poOutputSRS,
+    const GDALVectorTranslateOptions *psOptions, int nThreads,
+    GIntBig nMaxFeatures, std::unique_ptr<OGRFeature> poFirstFeature)
+    : m_poTranslator(poTranslator), m_psInfo(psInfo),
+      m_poOutputSRS(poOutputSRS), m_psOptions(psOptions),
+      m_nRemainingFeatures(nMaxFeatures),
+      m_poFirstFeature(std::move(poFirstFeature))
+{
+    CPLWorkerThreadPool *poPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poPool)
+        return;
+    m_poJobQueue = poPool->CreateJobQueue();
+    if (!m_poJobQueue)
+        return;
+
+    // Keep enough work queued to avoid workers starving while the
+    // calling thread writes features.
+    m_nMaxChunksInFlight = 2 * static_cast<size_t>(nThreads);
+
+    // Clone the coordinate transformation upfront, on this thread, as
+    // cloning involves the source and target SRS that are shared with the
+    // features being read. There is one state per chunk in flight, as the
+    // global thread pool may have more threads than requested.
+    const auto &poCT = psInfo->m_aoReprojectionInfo[0].m_poCT;
+    for (size_t i = 0; i < m_nMaxChunksInFlight; ++i)
+    {
+        auto poState = std::make_unique<WorkerState>();
+        poState->oCtx.m_poSharedObjectsMutex = &m_oSharedObjectsMutex;
+        if (poCT)
+        {
+            poState->poCT.reset(poCT->Clone());
+            if (!poState->poCT)
+            {
+                m_poJobQueue.reset();
+                return;
+            }
+        }
+        m_apoFreeWorkerStates.push_back(std::move(poState));
+    }
+}
+
+/************************************************************************/
+/*        GeometryTransformPipeline::~GeometryTransformPipeline()       */
+/************************************************************************/
+
+GeometryTransformPipeline::~GeometryTransformPipeline()
+{
+    if (m_poJobQueue)
+        m_poJobQueue->WaitCompletion();
+}
+
+/************************************************************************/
+/*                       GetNextSourceFeature()                         */
+/************************************************************************/
+
+static OGRFeature *GetNextSourceFeature(OGRLayer *poSrcLayer)
+{
+    CPL_TRACE_SCOPE_CAT("OGRLayer::GetNextFeature", "ogr");
+    return poSrcLayer->GetNextFeature();
+}
+
+/************************************************************************/
+/*              GeometryTransformPipeline::SubmitChunks()               */
+/************************************************************************/
+
+void GeometryTransformPipeline::SubmitChunks()
+{
+    OGRLayer *poSrcLayer = m_psInfo->m_poSrcLayer;
+    while (!m_bSourceExhausted && m_apoChunks.size() < m_nMaxChunksInFlight)
+    {
+        auto poChunk = std::make_unique<Chunk>();
+        poChunk->poPipeline = this;
+        poChunk->aoItems.reserve(CHUNK_SIZE);
+        while (poChunk->aoItems.size() < CHUNK_SIZE)
+        {
+            if (m_nRemainingFeatures == 0)
+            {
+                m_bSourceExhausted = true;
+                break;
+            }
+            std::unique_ptr<OGRFeature> poFeature(
+                m_poFirstFeature ? m_poFirstFeature.release()
+                                 : GetNextSourceFeature(poSrcLayer));
+            if (!poFeature)
+            {
+                m_bSourceExhausted = true;
+                m_bReadFailed = CPLGetLastErrorType() == CE_Failure;
+                break;
+            }
+            if (m_nRemainingFeatures > 0)
+                --m_nRemainingFeatures;
+            Item oItem;
+            oItem.poFeature = std::move(poFeature);
+            poChunk->aoItems.push_back(std::move(oItem));
+        }
+        if (poChunk->aoItems.empty())
+            break;
+        Chunk *poChunkRaw = poChunk.get();
+        m_apoChunks.push_back(std::move(poChunk));
+        if (!m_poJobQueue->SubmitJob(ProcessChunk, poChunkRaw))
+        {
+            // Process it synchronously
+            ProcessChunk(poChunkRaw);
+        }
+    }
+}
+
+/************************************************************************/
+/*              GeometryTransformPipeline::ProcessChunk()               */
+/************************************************************************/
+
+void GeometryTransformPipeline::ProcessChunk(void *pData)
+{
+    Chunk *poChunk = static_cast<Chunk *>(pData);
+    GeometryTransformPipeline *poThis = poChunk->poPipeline;
+
+    std::unique_ptr<WorkerState> poState;
+    {
+        std::lock_guard<std::mutex> oLock(poThis->m_oMutex);
+        CPLAssert(!poThis->m_apoFreeWorkerStates.empty());
+        poState = std::move(poThis->m_apoFreeWorkerStates.back());
+        poThis->m_apoFreeWorkerStates.pop_back();
+    }
+
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors;
+    CPLInstallErrorHandlerAccumulator(aoErrors);
+    for (Item &oItem : poChunk->aoItems)
+    {
+        std::unique_ptr<OGRGeometry> poGeom(oItem.poFeature->StealGeometry(0));
+        if (poGeom)
+        {
+            oItem.eStatus = poThis->m_poTranslator->TransformGeometry(
+                poGeom, poThis->m_psInfo, 0, poState->poCT.get(),
+                poThis->m_poOutputSRS, oItem.poFeature->GetFID(),
+                poThis->m_psOptions, poState->oCtx);
+            oItem.poFeature->SetGeomFieldDirectly(0, poGeom.release());
+        }
+        oItem.aoErrors = std::move(aoErrors);
+        aoErrors.clear();
+    }
+    CPLUninstallErrorHandlerAccumulator();
+
+    std::lock_guard<std::mutex> oLock(poThis->m_oMutex);
+    poThis->m_apoFreeWorkerStates.push_back(std::move(poState));
+    poChunk->bDone = true;
+    poThis->m_oCV.notify_all();
+}
+
+/************************************************************************/
+/*              GeometryTransformPipeline::GetNextItem()                */
+/************************************************************************/
+
+bool GeometryTransformPipeline::GetNextItem(Item &oItem)
+{
+    while (true)
+    {
+        SubmitChunks();
+        if (m_apoChunks.empty())
+            return false;
+
+        Chunk *poChunk = m_apoChunks.front().get();
+        {
+            std::unique_lock<std::mutex> oLock(m_oMutex);
+            m_oCV.wait(oLock, [poChunk] { return poChunk->bDone; });
+        }
+        if (m_iNextItem < poChunk->aoItems.size())
+        {
+            oItem = std::move(poChunk->aoItems[m_iNextItem]);
+            ++m_iNextItem;
+            return true;
+        }
+        m_apoChunks.pop_front();
+        m_iNextItem = 0;
+    }
+}
+
+/************************************************************************/
+/*                     LayerTranslator::Translate()                     */
+/************************************************************************/
+
+bool LayerTranslator::Translate(
+    OGRFeature *poFeatureIn, TargetLayerInfo *psInfo,
+    GIntBig nCountLayerFeatures, GIntBig *pnReadFeatureCount,
+    GIntBig &nTotalEventsDone, GDALProgressFunc pfnProgress, void *pProgressArg,
+    const GDALVectorTranslateOptions *psOptions)
+{
+    if (psInfo->m_bUseWriteArrowBatch)
+    {
+        return TranslateArrow(psInfo, nCountLayerFeatures, pnReadFeatureCount,
+                              pfnProgress, pProgressArg, psOptions);
+    }
+
+    const OGRSpatialReference *poOutputSRS = m_poOutputSRS;
+
+    OGRLayer *poSrcLayer = psInfo->m_poSrcLayer;
+    OGRLayer *poDstLayer = psInfo->m_poDstLayer;
+    const int *const panMap = psInfo->m_anMap.data();
+    const int iSrcZField = psInfo->m_iSrcZField;
+    const bool bPreserveFID = psInfo->m_bPreserveFID;
+    const auto poSrcFDefn = poSrcLayer->GetLayerDefn();
+    const auto poDstFDefn = poDstLayer->GetLayerDefn();
+    const int nSrcGeomFieldCount = poSrcFDefn->GetGeomFieldCount();
+    const int nDstGeomFieldCount = poDstFDefn->GetGeomFieldCount();
+    const bool bExplodeCollections =
+        m_bExplodeCollections && nDstGeomFieldCount <= 1;
+    const int iRequestedSrcGeomField = psInfo->m_iRequestedSrcGeomField;
+
+    if (poOutputSRS == nullptr && !m_bNullifyOutputSRS)
+    {
+        if (nSrcGeomFieldCount == 1)
+        {
+            poOutputSRS = poSrcLayer->GetSpatialRef();
+        }
+        else if (iRequestedSrcGeomField > 0)
+        {
+            poOutputSRS = poSrcLayer->GetLayerDefn()
+                              ->GetGeomFieldDefn(iRequestedSrcGeomField)
+                              ->GetSpatialRef();
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Transfer features.                                              */
+    /* -------------------------------------------------------------------- */
+    if (psOptions->nGroupTransactions)
+    {
+        if (psOptions->nLayerTransaction)
+        {
+            if (poDstLayer->StartTransaction() == OGRERR_FAILURE)
+            {
+                delete poFeatureIn;
+                return false;
+            }
+        }
+    }
+
+    std::unique_ptr<OGRFeature> poFeature;
+    std::unique_ptr<OGRFeature> poDstFeature(new OGRFeature(poDstFDefn));
+    int nFeaturesInTransaction = 0;
+    GIntBig nCount = 0; /* written + failed */
+    GIntBig nFeaturesWritten = 0;
 
     bool bRet = true;
     CPLErrorReset();
@@ -5831,6 +6646,85 @@ bool LayerTranslator::Translate(
                              poOutputSRS, m_poGCPCoordTrans, false);
     }
 
+    // When multithreading is enabled, read features by batches, and
+    // reproject the geometries of a whole batch at once, using several
+    // threads. This is restricted to the simple case of a single geometry
+    // field, reprojected without prior modification.
+    std::unique_ptr<BatchedCoordinateTransformation> poBatchCT;
+    std::vector<std::unique_ptr<OGRFeature>> apoBatchFeatures;
+    size_t iBatchFeature = 0;
+    bool bBatchSourceExhausted = false;
+    bool bBatchReadFailed = false;
+    if (bSetupCTOK && poFeatureIn == nullptr &&
+        psOptions->nFIDToFetch == OGRNullFID && nSrcGeomFieldCount == 1 &&
+        nDstGeomFieldCount == 1 &&
+        psInfo->m_aoReprojectionInfo[0].m_poCT != nullptr &&
+        iSrcZField == -1 && m_eGeomOp == GEOMOP_NONE && !m_poClipSrcOri &&
+        m_nCoordDim == COORD_DIM_UNCHANGED)
+    {
+        const char *pszThreads =
+            CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+        if (pszThreads && (EQUAL(pszThreads, "ALL_CPUS")
+                               ? CPLGetNumCPUs() > 1
+                               : atoi(pszThreads) > 1))
+        {
+            poBatchCT = std::make_unique<BatchedCoordinateTransformation>(
+                psInfo->m_aoReprojectionInfo[0].m_poCT.get());
+        }
+    }
+
+    // When several threads are requested (-multi / -nt), run the geometry
+    // transformations on worker threads, on features read ahead of the one
+    // being written. This requires the coordinate transformation to be the
+    // same for all features, hence it is set up from the first feature when
+    // needed.
+    std::unique_ptr<GeometryTransformPipeline> poPipeline;
+    auto ePipelineStatus = GeometryTransformStatus::OK;
+    std::unique_ptr<OGRFeature> poPendingFeature;
+    bool bPendingEndOfLayer = false;
+    bool bPendingReadFailed = false;
+    if (m_nThreads > 1 && !poBatchCT && poFeatureIn == nullptr &&
+        psOptions->nFIDToFetch == OGRNullFID && nSrcGeomFieldCount == 1 &&
+        nDstGeomFieldCount == 1 && iSrcZField == -1 && !bExplodeCollections &&
+        !psInfo->m_bPerFeatureCT)
+    {
+        if (!bSetupCTOK && psInfo->m_nFeaturesRead == 0 && m_nLimit != 0)
+        {
+            poPendingFeature.reset(GetNextSourceFeature(poSrcLayer));
+            if (poPendingFeature)
+            {
+                if (!SetupCT(psInfo, poSrcLayer, m_bTransform, m_bWrapDateline,
+                             m_osDateLineOffset, m_poUserSourceSRS,
+                             poPendingFeature.get(), poOutputSRS,
+                             m_poGCPCoordTrans, true))
+                {
+                    return false;
+                }
+                bSetupCTOK = !psInfo->m_bPerFeatureCT;
+            }
+            else
+            {
+                bPendingEndOfLayer = true;
+                bPendingReadFailed = CPLGetLastErrorType() == CE_Failure;
+            }
+        }
+
+        if ((bSetupCTOK || psInfo->m_nFeaturesRead > 0) &&
+            !bPendingEndOfLayer && !psInfo->m_bPerFeatureCT &&
+            GeometryTransformPipeline::CanBeUsed(psInfo))
+        {
+            poPipeline = std::make_unique<GeometryTransformPipeline>(
+                this, psInfo, poOutputSRS, psOptions, m_nThreads,
+                m_nLimit >= 0 ? m_nLimit - psInfo->m_nFeaturesRead : -1,
+                std::move(poPendingFeature));
+            if (!poPipeline->IsValid())
+            {
+                poPendingFeature = poPipeline->ReleaseFirstFeature();
+                poPipeline.reset();
+            }
+        }
+    }
+
     while (true)
     {
         if (m_nLimit >= 0 && psInfo->m_nFeaturesRead >= m_nLimit)
@@ -5842,12 +6736,91 @@ bool LayerTranslator::Translate(
             poFeature.reset(poFeatureIn);
         else if (psOptions->nFIDToFetch != OGRNullFID)
             poFeature.reset(poSrcLayer->GetFeature(psOptions->nFIDToFetch));
+        else if (poPipeline)
+        {
+            GeometryTransformPipeline::Item oItem;
+            if (poPipeline->GetNextItem(oItem))
+            {
+                // Re-emit the errors raised by the worker thread
+                for (const auto &oError : oItem.aoErrors)
+                {
+                    CPLError(oError.type, oError.no, "%s",
+                             oError.msg.c_str());
+                }
+                poFeature = std::move(oItem.poFeature);
+                ePipelineStatus = oItem.eStatus;
+            }
+            else
+            {
+                poFeature.reset();
+            }
+        }
+        else if (poPendingFeature || bPendingEndOfLayer)
+        {
+            poFeature = std::move(poPendingFeature);
+            bPendingEndOfLayer = false;
+        }
+        else if (poBatchCT)
+        {
+            if (iBatchFeature == apoBatchFeatures.size() &&
+                !bBatchSourceExhausted)
+            {
+                constexpr size_t MAX_FEATURES_PER_BATCH = 10 * 1000;
+                constexpr size_t MAX_POINTS_PER_BATCH = 1000 * 1000;
+                apoBatchFeatures.clear();
+                iBatchFeature = 0;
+                poBatchCT->Reset();
+                while (apoBatchFeatures.size() < MAX_FEATURES_PER_BATCH &&
+                       poBatchCT->GetRecordedPointCount() <
+                           MAX_POINTS_PER_BATCH &&
+                       (m_nLimit < 0 ||
+                        psInfo->m_nFeaturesRead +
+                                static_cast<GIntBig>(apoBatchFeatures.size()) <
+                            m_nLimit))
+                {
+                    std::unique_ptr<OGRFeature> poBatchFeature(
+                        GetNextSourceFeature(poSrcLayer));
+                    if (!poBatchFeature)
+                    {
+                        bBatchSourceExhausted = true;
+                        bBatchReadFailed =
+                            CPLGetLastErrorType() == CE_Failure;
+                        break;
+                    }
+                    poBatchCT->RecordFeature(
+                        poBatchFeature->GetGeomFieldRef(0));
+                    apoBatchFeatures.push_back(std::move(poBatchFeature));
+                }
+                poBatchCT->Compute();
+            }
+            if (iBatchFeature < apoBatchFeatures.size())
+            {
+                poBatchCT->StartFeature(iBatchFeature);
+                poFeature = std::move(apoBatchFeatures[iBatchFeature]);
+                ++iBatchFeature;
+            }
+            else
+            {
+                poFeature.reset();
+            }
+        }
         else
-            poFeature.reset(poSrcLayer->GetNextFeature());
+        {
+            // Recycle the source feature (unless it has been moved to
+            // poDstFeature in the previous iteration), so that drivers that
+            // implement GetNextFeatureInto() can reuse its storage.
+            if (poFeature == nullptr)
+                poFeature =
+                    std::make_unique<OGRFeature>(poSrcLayer->GetLayerDefn());
+            if (!poSrcLayer->GetNextFeatureInto(*poFeature))
+                poFeature.reset();
+        }
 
         if (poFeature == nullptr)
         {
-            if (CPLGetLastErrorType() == CE_Failure)
+            if (CPLGetLastErrorType() == CE_Failure || bBatchReadFailed ||
+                bPendingReadFailed ||
+                (poPipeline && poPipeline->ReadFailed()))
             {
                 bRet = false;
             }
@@ -5962,7 +6935,8 @@ bool LayerTranslator::Translate(
                     m_poClipSrcOri)
                 {
                     const OGRGeometry *poClipGeom =
-                        GetSrcClipGeom(poStolenGeometry->getSpatialReference());
+                        GetSrcClipGeom(poStolenGeometry->getSpatialReference(),
+                                       m_oGeomTransformContext);
 
                     if (poClipGeom != nullptr &&
                         !poClipGeom->Intersects(poStolenGeometry.get()))
@@ -6108,351 +7082,44 @@ bool LayerTranslator::Translate(
                 {
                     poDstGeometry.reset(poDstFeature->StealGeometry(iGeom));
                 }
-                if (poDstGeometry == nullptr)
-                    continue;
-
-                // poFeature hasn't been moved if iSrcZField != -1
-                // cppcheck-suppress accessMoved
-                if (iSrcZField != -1 && poFeature != nullptr)
-                {
-                    SetZ(poDstGeometry.get(),
-                         poFeature->GetFieldAsDouble(iSrcZField));
-                    /* This will correct the coordinate dimension to 3 */
-                    poDstGeometry.reset(poDstGeometry->clone());
-                }
-
-                if (m_nCoordDim == 2 || m_nCoordDim == 3)
-                {
-                    poDstGeometry->setCoordinateDimension(m_nCoordDim);
-                }
-                else if (m_nCoordDim == 4)
-                {
-                    poDstGeometry->set3D(TRUE);
-                    poDstGeometry->setMeasured(TRUE);
-                }
-                else if (m_nCoordDim == COORD_DIM_XYM)
-                {
-                    poDstGeometry->set3D(FALSE);
-                    poDstGeometry->setMeasured(TRUE);
-                }
-                else if (m_nCoordDim == COORD_DIM_LAYER_DIM)
-                {
-                    const OGRwkbGeometryType eDstLayerGeomType =
-                        poDstLayer->GetLayerDefn()
-                            ->GetGeomFieldDefn(iGeom)
-                            ->GetType();
-                    poDstGeometry->set3D(wkbHasZ(eDstLayerGeomType));
-                    poDstGeometry->setMeasured(wkbHasM(eDstLayerGeomType));
-                }
 
-                if (m_eGeomOp == GEOMOP_SEGMENTIZE)
-                {
-                    if (m_dfGeomOpParam > 0)
-                        poDstGeometry->segmentize(m_dfGeomOpParam);
-                }
-                else if (m_eGeomOp == GEOMOP_SIMPLIFY_PRESERVE_TOPOLOGY)
+                // The pipeline has already transformed the geometry, and
+                // may have nullified it on reprojection failure.
+                auto eStatus = ePipelineStatus;
+                if (!poPipeline)
                 {
-                    if (m_dfGeomOpParam > 0)
-                    {
-                        auto poNewGeom = std::unique_ptr<OGRGeometry>(
-                            poDstGeometry->SimplifyPreserveTopology(
-                                m_dfGeomOpParam));
-                        if (poNewGeom)
-                        {
-                            poDstGeometry = std::move(poNewGeom);
-                        }
-                    }
-                }
-
-                if (m_poClipSrcOri)
-                {
-
-                    const OGRGeometry *poClipGeom =
-                        GetSrcClipGeom(poDstGeometry->getSpatialReference());
-
-                    std::unique_ptr<OGRGeometry> poClipped;
-                    if (poClipGeom != nullptr)
-                    {
-                        OGREnvelope oClipEnv;
-                        OGREnvelope oDstEnv;
-
-                        poClipGeom->getEnvelope(&oClipEnv);
-                        poDstGeometry->getEnvelope(&oDstEnv);
-
-                        if (oClipEnv.Intersects(oDstEnv))
-                        {
-                            poClipped.reset(
-                                poClipGeom->Intersection(poDstGeometry.get()));
-                        }
-                    }
-
-                    if (poClipped == nullptr || poClipped->IsEmpty())
-                    {
-                        goto end_loop;
-                    }
-
-                    const int nDim = poDstGeometry->getDimension();
-                    if (poClipped->getDimension() < nDim &&
-                        wkbFlatten(
-                            poDstFDefn->GetGeomFieldDefn(iGeom)->GetType()) !=
-                            wkbUnknown)
-                    {
-                        CPLDebug(
-                            "OGR2OGR",
-                            "Discarding feature " CPL_FRMT_GIB " of layer %s, "
-                            "as its intersection with -clipsrc is a %s "
-                            "whereas the input is a %s",
-                            nSrcFID, poSrcLayer->GetName(),
-                            OGRToOGCGeomType(poClipped->getGeometryType()),
-                            OGRToOGCGeomType(poDstGeometry->getGeometryType()));
-                        goto end_loop;
-                    }
+                    if (poDstGeometry == nullptr)
+                        continue;
 
-                    poDstGeometry = std::move(poClipped);
-                }
-
-                OGRCoordinateTransformation *const poCT =
-                    psInfo->m_aoReprojectionInfo[iGeom].m_poCT.get();
-                char **const papszTransformOptions =
-                    psInfo->m_aoReprojectionInfo[iGeom]
-                        .m_aosTransformOptions.List();
-                const bool bReprojCanInvalidateValidity =
-                    psInfo->m_aoReprojectionInfo[iGeom]
-                        .m_bCanInvalidateValidity;
-
-                if (poCT != nullptr || papszTransformOptions != nullptr)
-                {
-                    // If we need to change the geometry type to linear, and
-                    // we have a geometry with curves, then convert it to
-                    // linear first, to avoid invalidities due to the fact
-                    // that validity of arc portions isn't always kept while
-                    // reprojecting and then discretizing.
-                    if (bReprojCanInvalidateValidity &&
-                        (!psInfo->m_bSupportCurves ||
-                         m_eGeomTypeConversion == GTC_CONVERT_TO_LINEAR ||
-                         m_eGeomTypeConversion ==
-                             GTC_PROMOTE_TO_MULTI_AND_CONVERT_TO_LINEAR))
-                    {
-                        if (poDstGeometry->hasCurveGeometry(TRUE))
-                        {
-                            OGRwkbGeometryType eTargetType = OGR_GT_GetLinear(
-                                poDstGeometry->getGeometryType());
-                            poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                                poDstGeometry.release(), eTargetType));
-                        }
-                    }
-                    else if (bReprojCanInvalidateValidity &&
-                             eGType != GEOMTYPE_UNCHANGED &&
-                             !OGR_GT_IsNonLinear(
-                                 static_cast<OGRwkbGeometryType>(eGType)) &&
-                             poDstGeometry->hasCurveGeometry(TRUE))
+                    // poFeature hasn't been moved if iSrcZField != -1
+                    // cppcheck-suppress accessMoved
+                    if (iSrcZField != -1 && poFeature != nullptr)
                     {
-                        poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                            poDstGeometry.release(),
-                            static_cast<OGRwkbGeometryType>(eGType)));
+                        SetZ(poDstGeometry.get(),
+                             poFeature->GetFieldAsDouble(iSrcZField));
+                        /* This will correct the coordinate dimension to 3 */
+                        poDstGeometry.reset(poDstGeometry->clone());
                     }
 
-                    for (int iIter = 0; iIter < 2; ++iIter)
-                    {
-                        auto poReprojectedGeom = std::unique_ptr<OGRGeometry>(
-                            OGRGeometryFactory::transformWithOptions(
-                                poDstGeometry.get(), poCT,
-                                papszTransformOptions,
-                                m_transformWithOptionsCache));
-                        if (poReprojectedGeom == nullptr)
-                        {
-                            if (psOptions->nGroupTransactions)
-                            {
-                                if (psOptions->nLayerTransaction)
-                                {
-                                    if (poDstLayer->CommitTransaction() !=
-                                            OGRERR_NONE &&
-                                        !psOptions->bSkipFailures)
-                                    {
-                                        return false;
-                                    }
-                                }
-                            }
-
-                            CPLError(CE_Failure, CPLE_AppDefined,
-                                     "Failed to reproject feature " CPL_FRMT_GIB
-                                     " (geometry probably out of source or "
-                                     "destination SRS).",
-                                     nSrcFID);
-                            if (!psOptions->bSkipFailures)
-                            {
-                                return false;
-                            }
-                        }
-
-                        // Check if a curve geometry is no longer valid after
-                        // reprojection
-                        const auto eType = poDstGeometry->getGeometryType();
-                        const auto eFlatType = wkbFlatten(eType);
-
-                        const auto IsValid = [](const OGRGeometry *poGeom)
-                        {
-                            CPLErrorHandlerPusher oErrorHandler(
-                                CPLQuietErrorHandler);
-                            return poGeom->IsValid();
-                        };
-
-                        if (iIter == 0 && bReprojCanInvalidateValidity &&
-                            OGRGeometryFactory::haveGEOS() &&
-                            (eFlatType == wkbCurvePolygon ||
-                             eFlatType == wkbCompoundCurve ||
-                             eFlatType == wkbMultiCurve ||
-                             eFlatType == wkbMultiSurface) &&
-                            poDstGeometry->hasCurveGeometry(TRUE) &&
-                            IsValid(poDstGeometry.get()))
-                        {
-                            OGRwkbGeometryType eTargetType = OGR_GT_GetLinear(
-                                poDstGeometry->getGeometryType());
-                            auto poDstGeometryTmp =
-                                std::unique_ptr<OGRGeometry>(
-                                    OGRGeometryFactory::forceTo(
-                                        poReprojectedGeom->clone(),
-                                        eTargetType));
-                            if (!IsValid(poDstGeometryTmp.get()))
-                            {
-                                CPLDebug("OGR2OGR",
-                                         "Curve geometry no longer valid after "
-                                         "reprojection: transforming it into "
-                                         "linear one before reprojecting");
-                                poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                                    poDstGeometry.release(), eTargetType));
-                                poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                                    poDstGeometry.release(), eType));
-                            }
-                            else
-                            {
-                                poDstGeometry = std::move(poReprojectedGeom);
-                                break;
-                            }
-                        }
-                        else
-                        {
-                            poDstGeometry = std::move(poReprojectedGeom);
-                            break;
-                        }
-                    }
+                    OGRCoordinateTransformation *const poCT =
+                        poBatchCT
+                            ? poBatchCT.get()
+                            : psInfo->m_aoReprojectionInfo[iGeom].m_poCT.get();
+                    eStatus = TransformGeometry(
+                        poDstGeometry, psInfo, iGeom, poCT, poOutputSRS,
+                        nSrcFID, psOptions, m_oGeomTransformContext);
                 }
-                else if (poOutputSRS != nullptr)
+                if (eStatus == GeometryTransformStatus::SKIP_FEATURE)
                 {
-                    poDstGeometry->assignSpatialReference(poOutputSRS);
+                    goto end_loop;
                 }
-
-                if (poDstGeometry != nullptr)
+                else if (eStatus ==
+                         GeometryTransformStatus::REPROJECTION_FAILED)
                 {
-                    if (m_poClipDstOri)
+                    if (!ReportReprojectionFailure(poDstLayer, nSrcFID,
+                                                   psOptions))
                     {
-                        const OGRGeometry *poClipGeom = GetDstClipGeom(
-                            poDstGeometry->getSpatialReference());
-                        if (poClipGeom == nullptr)
-                        {
-                            goto end_loop;
-                        }
-
-                        std::unique_ptr<OGRGeometry> poClipped;
-
-                        OGREnvelope oClipEnv;
-                        OGREnvelope oDstEnv;
-
-                        poClipGeom->getEnvelope(&oClipEnv);
-                        poDstGeometry->getEnvelope(&oDstEnv);
-
-                        if (oClipEnv.Intersects(oDstEnv))
-                        {
-                            poClipped.reset(
-                                poClipGeom->Intersection(poDstGeometry.get()));
-                        }
-
-                        if (poClipped == nullptr || poClipped->IsEmpty())
-                        {
-                            goto end_loop;
-                        }
-
-                        const int nDim = poDstGeometry->getDimension();
-                        if (poClipped->getDimension() < nDim &&
-                            wkbFlatten(poDstFDefn->GetGeomFieldDefn(iGeom)
-                                           ->GetType()) != wkbUnknown)
-                        {
-                            CPLDebug(
-                                "OGR2OGR",
-                                "Discarding feature " CPL_FRMT_GIB
-                                " of layer %s, "
-                                "as its intersection with -clipdst is a %s "
-                                "whereas the input is a %s",
-                                nSrcFID, poSrcLayer->GetName(),
-                                OGRToOGCGeomType(poClipped->getGeometryType()),
-                                OGRToOGCGeomType(
-                                    poDstGeometry->getGeometryType()));
-                            goto end_loop;
-                        }
-
-                        poDstGeometry = std::move(poClipped);
-                    }
-
-                    if (psOptions->dfXYRes !=
-                            OGRGeomCoordinatePrecision::UNKNOWN &&
-                        OGRGeometryFactory::haveGEOS() &&
-                        !poDstGeometry->hasCurveGeometry())
-                    {
-                        // OGR_APPLY_GEOM_SET_PRECISION default value for
-                        // OGRLayer::CreateFeature() purposes, but here in the
-                        // ogr2ogr -xyRes context, we force calling SetPrecision(),
-                        // unless the user explicitly asks not to do it by
-                        // setting the config option to NO.
-                        if (!bRunSetPrecisionEvaluated)
-                        {
-                            bRunSetPrecisionEvaluated = true;
-                            bRunSetPrecision = CPLTestBool(CPLGetConfigOption(
-                                "OGR_APPLY_GEOM_SET_PRECISION", "YES"));
-                        }
-                        if (bRunSetPrecision)
-                        {
-                            auto poNewGeom = std::unique_ptr<OGRGeometry>(
-                                poDstGeometry->SetPrecision(psOptions->dfXYRes,
-                                                            /* nFlags = */ 0));
-                            if (!poNewGeom)
-                                goto end_loop;
-                            poDstGeometry = std::move(poNewGeom);
-                        }
-                    }
-
-                    if (m_bMakeValid)
-                    {
-                        const bool bIsGeomCollection =
-                            wkbFlatten(poDstGeometry->getGeometryType()) ==
-                            wkbGeometryCollection;
-                        auto poNewGeom = std::unique_ptr<OGRGeometry>(
-                            poDstGeometry->MakeValid());
-                        if (!poNewGeom)
-                            goto end_loop;
-                        poDstGeometry = std::move(poNewGeom);
-                        if (!bIsGeomCollection)
-                        {
-                            poDstGeometry.reset(
-                                OGRGeometryFactory::
-                                    removeLowerDimensionSubGeoms(
-                                        poDstGeometry.get()));
-                        }
-                    }
-
-                    if (m_eGeomTypeConversion != GTC_DEFAULT)
-                    {
-                        OGRwkbGeometryType eTargetType =
-                            poDstGeometry->getGeometryType();
-                        eTargetType =
-                            ConvertType(m_eGeomTypeConversion, eTargetType);
-                        poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                            poDstGeometry.release(), eTargetType));
-                    }
-                    else if (eGType != GEOMTYPE_UNCHANGED)
-                    {
-                        poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                            poDstGeometry.release(),
-                            static_cast<OGRwkbGeometryType>(eGType)));
+                        return false;
                     }
                 }
 
@@ -6558,32 +7225,399 @@ bool LayerTranslator::Translate(
     return bRet;
 }
 
+/************************************************************************/
+/*                 LayerTranslator::TransformGeometry()                 */
+/*                                                                      */
+/*      Apply the requested geometric operations, reprojection and      */
+/*      geometry type conversion to a geometry of the iGeom-th target   */
+/*      geometry field. Mutable state is confined to oCtx, so that      */
+/*      several threads can call this method concurrently, each with    */
+/*      its own context and coordinate transformation.                  */
+/************************************************************************/
+
+LayerTranslator::GeometryTransformStatus LayerTranslator::TransformGeometry(
+    std::unique_ptr<OGRGeometry> &poDstGeometry, TargetLayerInfo *psInfo,
+    int iGeom, OGRCoordinateTransformation *poCT,
+    const OGRSpatialReference *poOutputSRS, GIntBig nSrcFID,
+    const GDALVectorTranslateOptions *psOptions,
+    GeometryTransformContext &oCtx)
+{
+    const OGRFeatureDefn *poDstFDefn = psInfo->m_poDstLayer->GetLayerDefn();
+
+    if (m_nCoordDim == 2 || m_nCoordDim == 3)
+    {
+        poDstGeometry->setCoordinateDimension(m_nCoordDim);
+    }
+    else if (m_nCoordDim == 4)
+    {
+        poDstGeometry->set3D(TRUE);
+        poDstGeometry->setMeasured(TRUE);
+    }
+    else if (m_nCoordDim == COORD_DIM_XYM)
+    {
+        poDstGeometry->set3D(FALSE);
+        poDstGeometry->setMeasured(TRUE);
+    }
+    else if (m_nCoordDim == COORD_DIM_LAYER_DIM)
+    {
+        const OGRwkbGeometryType eDstLayerGeomType =
+            poDstFDefn->GetGeomFieldDefn(iGeom)->GetType();
+        poDstGeometry->set3D(wkbHasZ(eDstLayerGeomType));
+        poDstGeometry->setMeasured(wkbHasM(eDstLayerGeomType));
+    }
+
+    if (m_eGeomOp == GEOMOP_SEGMENTIZE)
+    {
+        if (m_dfGeomOpParam > 0)
+            poDstGeometry->segmentize(m_dfGeomOpParam);
+    }
+    else if (m_eGeomOp == GEOMOP_SIMPLIFY_PRESERVE_TOPOLOGY)
+    {
+        if (m_dfGeomOpParam > 0)
+        {
+            auto poNewGeom = std::unique_ptr<OGRGeometry>(
+                poDstGeometry->SimplifyPreserveTopology(
+                    m_dfGeomOpParam));
+            if (poNewGeom)
+            {
+                poDstGeometry = std::move(poNewGeom);
+            }
+        }
+    }
+
+    if (m_poClipSrcOri)
+    {
+
+        const OGRGeometry *poClipGeom =
+            GetSrcClipGeom(poDstGeometry->getSpatialReference(), oCtx);
+
+        std::unique_ptr<OGRGeometry> poClipped;
+        if (poClipGeom != nullptr)
+        {
+            OGREnvelope oClipEnv;
+            OGREnvelope oDstEnv;
+
+            poClipGeom->getEnvelope(&oClipEnv);
+            poDstGeometry->getEnvelope(&oDstEnv);
+
+            if (oClipEnv.Intersects(oDstEnv))
+            {
+                poClipped = GetTiledClipGeometry(oCtx.m_poTiledClipSrc,
+                                                 poClipGeom)
+                                .Intersection(poDstGeometry.get());
+            }
+        }
+
+        if (poClipped == nullptr || poClipped->IsEmpty())
+        {
+            return GeometryTransformStatus::SKIP_FEATURE;
+        }
+
+        const int nDim = poDstGeometry->getDimension();
+        if (poClipped->getDimension() < nDim &&
+            wkbFlatten(
+                poDstFDefn->GetGeomFieldDefn(iGeom)->GetType()) !=
+                wkbUnknown)
+        {
+            CPLDebug(
+                "OGR2OGR",
+                "Discarding feature " CPL_FRMT_GIB " of layer %s, "
+                "as its intersection with -clipsrc is a %s "
+                "whereas the input is a %s",
+                nSrcFID, psInfo->m_poSrcLayer->GetName(),
+                OGRToOGCGeomType(poClipped->getGeometryType()),
+                OGRToOGCGeomType(poDstGeometry->getGeometryType()));
+            return GeometryTransformStatus::SKIP_FEATURE;
+        }
+
+        poDstGeometry = std::move(poClipped);
+    }
+
+    char **const papszTransformOptions =
+        psInfo->m_aoReprojectionInfo[iGeom].m_aosTransformOptions.List();
+    const bool bReprojCanInvalidateValidity =
+        psInfo->m_aoReprojectionInfo[iGeom].m_bCanInvalidateValidity;
+
+    if (poCT != nullptr || papszTransformOptions != nullptr)
+    {
+        // If we need to change the geometry type to linear, and
+        // we have a geometry with curves, then convert it to
+        // linear first, to avoid invalidities due to the fact
+        // that validity of arc portions isn't always kept while
+        // reprojecting and then discretizing.
+        if (bReprojCanInvalidateValidity &&
+            (!psInfo->m_bSupportCurves ||
+             m_eGeomTypeConversion == GTC_CONVERT_TO_LINEAR ||
+             m_eGeomTypeConversion ==
+                 GTC_PROMOTE_TO_MULTI_AND_CONVERT_TO_LINEAR))
+        {
+            if (poDstGeometry->hasCurveGeometry(TRUE))
+            {
+                OGRwkbGeometryType eTargetType = OGR_GT_GetLinear(
+                    poDstGeometry->getGeometryType());
+                poDstGeometry.reset(OGRGeometryFactory::forceTo(
+                    poDstGeometry.release(), eTargetType));
+            }
+        }
+        else if (bReprojCanInvalidateValidity &&
+                 m_eGType != GEOMTYPE_UNCHANGED &&
+                 !OGR_GT_IsNonLinear(
+                     static_cast<OGRwkbGeometryType>(m_eGType)) &&
+                 poDstGeometry->hasCurveGeometry(TRUE))
+        {
+            poDstGeometry.reset(OGRGeometryFactory::forceTo(
+                poDstGeometry.release(),
+                static_cast<OGRwkbGeometryType>(m_eGType)));
+        }
+
+        for (int iIter = 0; iIter < 2; ++iIter)
+        {
+            auto poReprojectedGeom = std::unique_ptr<OGRGeometry>(
+                OGRGeometryFactory::transformWithOptions(
+                    poDstGeometry.get(), poCT,
+                    papszTransformOptions,
+                    oCtx.m_transformWithOptionsCache));
+            if (poReprojectedGeom == nullptr)
+            {
+                poDstGeometry.reset();
+                return GeometryTransformStatus::REPROJECTION_FAILED;
+            }
+
+            // Check if a curve geometry is no longer valid after
+            // reprojection
+            const auto eType = poDstGeometry->getGeometryType();
+            const auto eFlatType = wkbFlatten(eType);
+
+            const auto IsValid = [](const OGRGeometry *poGeom)
+            {
+                CPLErrorHandlerPusher oErrorHandler(
+                    CPLQuietErrorHandler);
+                return poGeom->IsValid();
+            };
+
+            if (iIter == 0 && bReprojCanInvalidateValidity &&
+                OGRGeometryFactory::haveGEOS() &&
+                (eFlatType == wkbCurvePolygon ||
+                 eFlatType == wkbCompoundCurve ||
+                 eFlatType == wkbMultiCurve ||
+                 eFlatType == wkbMultiSurface) &&
+                poDstGeometry->hasCurveGeometry(TRUE) &&
+                IsValid(poDstGeometry.get()))
+            {
+                OGRwkbGeometryType eTargetType = OGR_GT_GetLinear(
+                    poDstGeometry->getGeometryType());
+                auto poDstGeometryTmp =
+                    std::unique_ptr<OGRGeometry>(
+                        OGRGeometryFactory::forceTo(
+                            poReprojectedGeom->clone(),
+                            eTargetType));
+                if (!IsValid(poDstGeometryTmp.get()))
+                {
+                    CPLDebug("OGR2OGR",
+                             "Curve geometry no longer valid after "
+                             "reprojection: transforming it into "
+                             "linear one before reprojecting");
+                    poDstGeometry.reset(OGRGeometryFactory::forceTo(
+                        poDstGeometry.release(), eTargetType));
+                    poDstGeometry.reset(OGRGeometryFactory::forceTo(
+                        poDstGeometry.release(), eType));
+                }
+                else
+                {
+                    poDstGeometry = std::move(poReprojectedGeom);
+                    break;
+                }
+            }
+            else
+            {
+                poDstGeometry = std::move(poReprojectedGeom);
+                break;
+            }
+        }
+    }
+    else if (poOutputSRS != nullptr)
+    {
+        poDstGeometry->assignSpatialReference(poOutputSRS);
+    }
+
+    if (poDstGeometry != nullptr)
+    {
+        if (m_poClipDstOri)
+        {
+            const OGRGeometry *poClipGeom = GetDstClipGeom(
+                poDstGeometry->getSpatialReference(), oCtx);
+            if (poClipGeom == nullptr)
+            {
+                return GeometryTransformStatus::SKIP_FEATURE;
+            }
+
+            std::unique_ptr<OGRGeometry> poClipped;
+
+            OGREnvelope oClipEnv;
+            OGREnvelope oDstEnv;
+
+            poClipGeom->getEnvelope(&oClipEnv);
+            poDstGeometry->getEnvelope(&oDstEnv);
+
+            if (oClipEnv.Intersects(oDstEnv))
+            {
+                poClipped = GetTiledClipGeometry(oCtx.m_poTiledClipDst,
+                                                 poClipGeom)
+                                .Intersection(poDstGeometry.get());
+            }
+
+            if (poClipped == nullptr || poClipped->IsEmpty())
+            {
+                return GeometryTransformStatus::SKIP_FEATURE;
+            }
+
+            const int nDim = poDstGeometry->getDimension();
+            if (poClipped->getDimension() < nDim &&
+                wkbFlatten(poDstFDefn->GetGeomFieldDefn(iGeom)
+                               ->GetType()) != wkbUnknown)
+            {
+                CPLDebug(
+                    "OGR2OGR",
+                    "Discarding feature " CPL_FRMT_GIB
+                    " of layer %s, "
+                    "as its intersection with -clipdst is a %s "
+                    "whereas the input is a %s",
+                    nSrcFID, psInfo->m_poSrcLayer->GetName(),
+                    OGRToOGCGeomType(poClipped->getGeometryType()),
+                    OGRToOGCGeomType(
+                        poDstGeometry->getGeometryType()));
+                return GeometryTransformStatus::SKIP_FEATURE;
+            }
+
+            poDstGeometry = std::move(poClipped);
+        }
+
+        if (psOptions->dfXYRes !=
+                OGRGeomCoordinatePrecision::UNKNOWN &&
+            OGRGeometryFactory::haveGEOS() &&
+            !poDstGeometry->hasCurveGeometry())
+        {
+            // OGR_APPLY_GEOM_SET_PRECISION default value for
+            // OGRLayer::CreateFeature() purposes, but here in the
+            // ogr2ogr -xyRes context, we force calling SetPrecision(),
+            // unless the user explicitly asks not to do it by
+            // setting the config option to NO.
+            if (!oCtx.m_bRunSetPrecisionEvaluated)
+            {
+                oCtx.m_bRunSetPrecisionEvaluated = true;
+                oCtx.m_bRunSetPrecision = CPLTestBool(CPLGetConfigOption(
+                    "OGR_APPLY_GEOM_SET_PRECISION", "YES"));
+            }
+            if (oCtx.m_bRunSetPrecision)
+            {
+                auto poNewGeom = std::unique_ptr<OGRGeometry>(
+                    poDstGeometry->SetPrecision(psOptions->dfXYRes,
+                                                /* nFlags = */ 0));
+                if (!poNewGeom)
+                    return GeometryTransformStatus::SKIP_FEATURE;
+                poDstGeometry = std::move(poNewGeom);
+            }
+        }
+
+        if (m_bMakeValid)
+        {
+            const bool bIsGeomCollection =
+                wkbFlatten(poDstGeometry->getGeometryType()) ==
+                wkbGeometryCollection;
+            auto poNewGeom = std::unique_ptr<OGRGeometry>(
+                poDstGeometry->MakeValid());
+            if (!poNewGeom)
+                return GeometryTransformStatus::SKIP_FEATURE;
+            poDstGeometry = std::move(poNewGeom);
+            if (!bIsGeomCollection)
+            {
+                poDstGeometry.reset(
+                    OGRGeometryFactory::
+                        removeLowerDimensionSubGeoms(
+                            poDstGeometry.get()));
+            }
+        }
+
+        if (m_eGeomTypeConversion != GTC_DEFAULT)
+        {
+            OGRwkbGeometryType eTargetType =
+                poDstGeometry->getGeometryType();
+            eTargetType =
+                ConvertType(m_eGeomTypeConversion, eTargetType);
+            poDstGeometry.reset(OGRGeometryFactory::forceTo(
+                poDstGeometry.release(), eTargetType));
+        }
+        else if (m_eGType != GEOMTYPE_UNCHANGED)
+        {
+            poDstGeometry.reset(OGRGeometryFactory::forceTo(
+                poDstGeometry.release(),
+                static_cast<OGRwkbGeometryType>(m_eGType)));
+        }
+    }
+
+    return GeometryTransformStatus::OK;
+}
+
+/************************************************************************/
+/*             LayerTranslator::ReportReprojectionFailure()             */
+/*                                                                      */
+/*      Returns false if the translation must be aborted.               */
+/************************************************************************/
+
+bool LayerTranslator::ReportReprojectionFailure(
+    OGRLayer *poDstLayer, GIntBig nSrcFID,
+    const GDALVectorTranslateOptions *psOptions)
+{
+    if (psOptions->nGroupTransactions)
+    {
+        if (psOptions->nLayerTransaction)
+        {
+            if (poDstLayer->CommitTransaction() != OGRERR_NONE &&
+                !psOptions->bSkipFailures)
+            {
+                return false;
+            }
+        }
+    }
+
+    CPLError(CE_Failure, CPLE_AppDefined,
+             "Failed to reproject feature " CPL_FRMT_GIB
+             " (geometry probably out of source or destination SRS).",
+             nSrcFID);
+    return psOptions->bSkipFailures;
+}
+
 /************************************************************************/
 /*                LayerTranslator::GetDstClipGeom()                     */
 /************************************************************************/
 
 const OGRGeometry *
-LayerTranslator::GetDstClipGeom(const OGRSpatialReference *poGeomSRS)
+LayerTranslator::GetDstClipGeom(const OGRSpatialReference *poGeomSRS,
+                                GeometryTransformContext &oCtx)
 {
-    if (m_poClipDstReprojectedToDstSRS_SRS != poGeomSRS)
+    if (oCtx.m_poClipDstReprojectedToDstSRS_SRS != poGeomSRS)
     {
+        std::unique_lock<std::mutex> oLock;
+        if (oCtx.m_poSharedObjectsMutex)
+            oLock = std::unique_lock<std::mutex>(*oCtx.m_poSharedObjectsMutex);
         auto poClipDstSRS = m_poClipDstOri->getSpatialReference();
         if (poClipDstSRS && poGeomSRS && !poClipDstSRS->IsSame(poGeomSRS))
         {
             // Transform clip geom to geometry SRS
-            m_poClipDstReprojectedToDstSRS.reset(m_poClipDstOri->clone());
-            if (m_poClipDstReprojectedToDstSRS->transformTo(poGeomSRS) !=
-                OGRERR_NONE)
+            oCtx.m_poTiledClipDst.reset();
+            oCtx.m_poClipDstReprojectedToDstSRS.reset(
+                m_poClipDstOri->clone());
+            if (oCtx.m_poClipDstReprojectedToDstSRS->transformTo(
+                    poGeomSRS) != OGRERR_NONE)
             {
                 return nullptr;
             }
-            m_poClipDstReprojectedToDstSRS_SRS = poGeomSRS;
+            oCtx.m_poClipDstReprojectedToDstSRS_SRS = poGeomSRS;
         }
         else if (!poClipDstSRS && poGeomSRS)
         {
-            if (!m_bWarnedClipDstSRS)
+            if (!m_bWarnedClipDstSRS.exchange(true))
             {
-                m_bWarnedClipDstSRS = true;
                 CPLError(CE_Warning, CPLE_AppDefined,
                          "Clip destination geometry has no "
                          "attached SRS, but the feature's "
@@ -6594,8 +7628,9 @@ LayerTranslator::GetDstClipGeom(const OGRSpatialReference *poGeomSRS)
         }
     }
 
-    return m_poClipDstReprojectedToDstSRS ? m_poClipDstReprojectedToDstSRS.get()
-                                          : m_poClipDstOri;
+    return oCtx.m_poClipDstReprojectedToDstSRS
+               ? oCtx.m_poClipDstReprojectedToDstSRS.get()
+               : m_poClipDstOri;
 }
 
 /************************************************************************/
@@ -6603,27 +7638,32 @@ LayerTranslator::GetDstClipGeom(const OGRSpatialReference *poGeomSRS)
 /************************************************************************/
 
 const OGRGeometry *
-LayerTranslator::GetSrcClipGeom(const OGRSpatialReference *poGeomSRS)
+LayerTranslator::GetSrcClipGeom(const OGRSpatialReference *poGeomSRS,
+                                GeometryTransformContext &oCtx)
 {
-    if (m_poClipSrcReprojectedToSrcSRS_SRS != poGeomSRS)
+    if (oCtx.m_poClipSrcReprojectedToSrcSRS_SRS != poGeomSRS)
     {
+        std::unique_lock<std::mutex> oLock;
+        if (oCtx.m_poSharedObjectsMutex)
+            oLock = std::unique_lock<std::mutex>(*oCtx.m_poSharedObjectsMutex);
         auto poClipSrcSRS = m_poClipSrcOri->getSpatialReference();
         if (poClipSrcSRS && poGeomSRS && !poClipSrcSRS->IsSame(poGeomSRS))
         {
             // Transform clip geom to geometry SRS
-            m_poClipSrcReprojectedToSrcSRS.reset(m_poClipSrcOri->clone());
-            if (m_poClipSrcReprojectedToSrcSRS->transformTo(poGeomSRS) !=
-                OGRERR_NONE)
+            oCtx.m_poTiledClipSrc.reset();
+            oCtx.m_poClipSrcReprojectedToSrcSRS.reset(
+                m_poClipSrcOri->clone());
+            if (oCtx.m_poClipSrcReprojectedToSrcSRS->transformTo(
+                    poGeomSRS) != OGRERR_NONE)
             {
                 return nullptr;
             }
-            m_poClipSrcReprojectedToSrcSRS_SRS = poGeomSRS;
+            oCtx.m_poClipSrcReprojectedToSrcSRS_SRS = poGeomSRS;
         }
         else if (!poClipSrcSRS && poGeomSRS)
         {
-            if (!m_bWarnedClipSrcSRS)
+            if (!m_bWarnedClipSrcSRS.exchange(true))
             {
-                m_bWarnedClipSrcSRS = true;
                 CPLError(CE_Warning, CPLE_AppDefined,
                          "Clip source geometry has no attached SRS, "
                          "but the feature's geometry has one. "
@@ -6633,8 +7673,9 @@ LayerTranslator::GetSrcClipGeom(const OGRSpatialReference *poGeomSRS)
         }
     }
 
-    return m_poClipSrcReprojectedToSrcSRS ? m_poClipSrcReprojectedToSrcSRS.get()
-                                          : m_poClipSrcOri;
+    return oCtx.m_poClipSrcReprojectedToSrcSRS
+               ? oCtx.m_poClipSrcReprojectedToSrcSRS.get()
+               : m_poClipSrcOri;
 }
 
 /************************************************************************/
@@ -7437,6 +8478,27 @@ static std::unique_ptr<GDALArgumentParser> GDALVectorTranslateOptionsGetParser(
         .store_into(psOptions->nLimit)
         .help(_("Limit the number of features per layer."));
 
+    {
+        auto &group = argParser->add_mutually_exclusive_group();
+        group.add_argument("-multi")
+            .flag()
+            .action([psOptions](const std::string &)
+                    { psOptions->nThreads = -1; })
+            .help(_("Use multiple threads to transform geometries."));
+
+        group.add_argument("-nt")
+            .metavar("<nb_threads>|ALL_CPUS")
+            .action(
+                [psOptions](const std::string &s)
+                {
+                    if (EQUAL(s.c_str(), "ALL_CPUS"))
+                        psOptions->nThreads = CPLGetNumCPUs();
+                    else
+                        psOptions->nThreads = atoi(s.c_str());
+                })
+            .help(_("Number of threads used to transform geometries."));
+    }
+
     argParser->add_argument("-ds_transaction")
         .flag()
         .action(
@@ -401,3 +401,51 @@ def test_contour_raster_acquisition_error():
         gdal.ContourGenerateEx(
             ds.GetRasterBand(1), ogr_lyr, options=["LEVEL_INTERVAL=1", "ID_FIELD=0"]
         )
+
+
+###############################################################################
+# Test NUM_THREADS option
+
+
+def _contour_lines(src_ds, options):
+
+    ogr_ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    ogr_lyr = ogr_ds.CreateLayer("contour", geom_type=ogr.wkbLineString)
+    ogr_lyr.CreateField(ogr.FieldDefn("ID", ogr.OFTInteger))
+    ogr_lyr.CreateField(ogr.FieldDefn("elev", ogr.OFTReal))
+    gdal.ContourGenerateEx(
+        src_ds.GetRasterBand(1),
+        ogr_lyr,
+        options=["LEVEL_INTERVAL=10", "LEVEL_BASE=0.123", "ID_FIELD=0", "ELEV_FIELD=1"]
+        + options,
+    )
+    return [(f["elev"], f.GetGeometryRef().Clone()) for f in ogr_lyr]
+
+
+def test_contour_num_threads():
+
+    # Tall enough to be processed as several strips
+    src_ds = gdal.Translate(
+        "",
+        "../gcore/data/n43.tif",
+        format="MEM",
+        width=300,
+        height=700,
+        outputType=gdal.GDT_Float32,
+        resampleAlg=gdal.GRIORA_Bilinear,
+    )
+
+    ref = _contour_lines(src_ds, [])
+    got = _contour_lines(src_ds, ["NUM_THREADS=4"])
+    assert len(got) == len(ref)
+
+    def summary(lines):
+        return sorted((elev, round(g.Length(), 6)) for elev, g in lines)
+
+    assert summary(got) == summary(ref)
+
+    # Output does not depend on the number of threads
+    got2 = _contour_lines(src_ds, ["NUM_THREADS=2"])
+    assert [(elev, g.ExportToWkt()) for elev, g in got2] == [
+        (elev, g.ExportToWkt()) for elev, g in got
+    ]
@@ -30,6 +30,7 @@
 # DEALINGS IN THE SOFTWARE.
 ###############################################################################
 
+import math
 
 import gdaltest
 import pytest
@@ -116,3 +117,52 @@ def test_cutline_4():
 
 
 ###############################################################################
+# Test that splitting the warp in many chunks, some of them outside, inside or
+# crossing a complex cutline, gives the same result as a single chunk
+
+
+@pytest.mark.require_geos
+@pytest.mark.parametrize("all_touched", [False, True])
+def test_cutline_many_chunks(all_touched):
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 1000, 1000)
+    src_ds.SetGeoTransform([0, 1, 0, 0, 0, 1])
+    src_ds.GetRasterBand(1).Fill(255)
+
+    # A disc with 10000 vertices, with a hole, and a small distant square
+    n = 10000
+    outer = ",".join(
+        "%.6f %.6f"
+        % (
+            400 + 300 * math.cos(2 * math.pi * i / n),
+            400 + 300 * math.sin(2 * math.pi * i / n),
+        )
+        for i in range(n)
+    )
+    outer += ",%.6f %.6f" % (700, 400)
+    hole = "350.5 350.5,350.5 450.5,450.5 450.5,450.5 350.5,350.5 350.5"
+    square = "900 900,900 950,950 950,950 900,900 900"
+    cutline = f"MULTIPOLYGON((({outer}),({hole})),(({square})))"
+
+    warp_options = ["CUTLINE=" + cutline, "INIT_DEST=0"]
+    if all_touched:
+        warp_options.append("CUTLINE_ALL_TOUCHED=TRUE")
+
+    ref_ds = gdal.Warp(
+        "",
+        src_ds,
+        format="MEM",
+        warpOptions=warp_options,
+        warpMemoryLimit=500 * 1024 * 1024,
+    )
+    ref_cs = ref_ds.GetRasterBand(1).Checksum()
+
+    out_ds = gdal.Warp(
+        "",
+        src_ds,
+        format="MEM",
+        warpOptions=warp_options,
+        warpMemoryLimit=100000,
+    )
+    assert out_ds.GetRasterBand(1).Checksum() == ref_cs
+    assert out_ds.GetRasterBand(1).ReadRaster() == ref_ds.GetRasterBand(1).ReadRaster()
@@ -403,3 +403,51 @@ def test_fillnodata_nearest(
         for i in range(height)
     ]
     assert got == expected
+
+
+###############################################################################
+# Test that NUM_THREADS gives the same result as the single-threaded
+# processing. The raster is wide enough for lines to be processed by several
+# strips and batches.
+
+
+@pytest.mark.parametrize("interpolation", ["INV_DIST", "NEAREST"])
+def test_fillnodata_num_threads(interpolation):
+
+    width = 40000
+    height = 80
+    row_pattern = bytes((x * 7) % 251 + 1 for x in range(width + height))
+    hole_pattern = bytes(
+        0 if (x // 5) % 7 == 0 else 255 for x in range(width + 3 * height)
+    )
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", width, height)
+    src_ds.GetRasterBand(1).SetNoDataValue(0)
+    for y in range(height):
+        row = bytes(
+            a & b
+            for a, b in zip(
+                row_pattern[y : y + width], hole_pattern[3 * y : 3 * y + width]
+            )
+        )
+        src_ds.GetRasterBand(1).WriteRaster(0, y, width, 1, row)
+
+    results = []
+    for options in (
+        ["TEMP_FILE_DRIVER=GTiff"],
+        ["NUM_THREADS=4"],
+        ["NUM_THREADS=3", "TEMP_FILE_DRIVER=MEM"],
+    ):
+        ds = gdal.GetDriverByName("MEM").CreateCopy("", src_ds)
+        gdal.FillNodata(
+            targetBand=ds.GetRasterBand(1),
+            maxSearchDist=10,
+            maskBand=None,
+            smoothingIterations=3,
+            options=options + ["INTERPOLATION=" + interpolation],
+        )
+        results.append(ds.GetRasterBand(1).ReadRaster())
+
+    assert results[0] != src_ds.GetRasterBand(1).ReadRaster()
+    assert results[1] == results[0]
+    assert results[2] == results[0]
@@ -448,3 +448,45 @@ def test_polygonize_8():
         wkt
         == "POLYGON ((1 4,1 3,0 3,0 1,1 1,1 0,3 0,3 1,4 1,4 3,3 3,3 4,1 4),(1 3,3 3,3 1,1 1,1 3))"
     )
+
+
+###############################################################################
+# Test NUM_THREADS option
+
+
+@pytest.mark.parametrize("is_int_polygonize", [True, False])
+@pytest.mark.parametrize("options", [[], ["8CONNECTED=8"]])
+def test_polygonize_num_threads(is_int_polygonize, options):
+
+    # Tall enough to be processed as several strips, with polygons crossing
+    # the strip boundaries
+    width = 40
+    height = 9000
+    src_ds = gdal.GetDriverByName("MEM").Create("", width, height)
+    data = bytearray(width * height)
+    for y in range(height):
+        for x in range(width):
+            data[y * width + x] = 1 if ((x + y // 50) % 10) < 5 else x % 3
+    src_ds.WriteRaster(0, 0, width, height, bytes(data))
+    src_band = src_ds.GetRasterBand(1)
+
+    def polygonize(extra_options):
+        mem_ds = ogr.GetDriverByName("Memory").CreateDataSource("out")
+        mem_layer = mem_ds.CreateLayer("poly", None, ogr.wkbPolygon)
+        mem_layer.CreateField(ogr.FieldDefn("DN", ogr.OFTInteger))
+        if is_int_polygonize:
+            result = gdal.Polygonize(
+                src_band, None, mem_layer, 0, options + extra_options
+            )
+        else:
+            result = gdal.FPolygonize(
+                src_band, None, mem_layer, 0, options + extra_options
+            )
+        assert result == 0, "Polygonize failed"
+        return sorted(
+            (f["DN"], f.GetGeometryRef().GetArea(), f.GetGeometryRef().GetEnvelope())
+            for f in mem_layer
+        )
+
+    ref = polygonize([])
+    assert polygonize(["NUM_THREADS=4"]) == ref
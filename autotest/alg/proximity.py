@@ -29,6 +29,9 @@
 ###############################################################################
 
 
+import math
+import struct
+
 import pytest
 
 from osgeo import gdal
@@ -126,3 +129,64 @@ def test_proximity_3():
     if cs != cs_expected:
         print("Got: ", cs)
         pytest.fail("got wrong checksum")
+
+
+###############################################################################
+# Test the exact Euclidean distance transform against a brute force computation
+
+
+@pytest.mark.parametrize("num_threads", [1, 4])
+def test_proximity_exact(num_threads):
+
+    width = 67
+    height = 53
+    targets = [(3, 2), (60, 5), (30, 30), (31, 30), (10, 50), (66, 52), (45, 17)]
+    nodata_pixel = (20, 40)
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", width, height)
+    src_band = src_ds.GetRasterBand(1)
+    src_band.SetNoDataValue(255)
+    data = bytearray(width * height)
+    for x, y in targets:
+        data[y * width + x] = 1
+    data[nodata_pixel[1] * width + nodata_pixel[0]] = 255
+    src_band.WriteRaster(0, 0, width, height, bytes(data))
+
+    dst_ds = gdal.GetDriverByName("MEM").Create("", width, height, 1, gdal.GDT_Float32)
+    dst_band = dst_ds.GetRasterBand(1)
+
+    maxdist = 25
+    gdal.ComputeProximity(
+        src_band,
+        dst_band,
+        options=[
+            "VALUES=1",
+            "ALGORITHM=EXACT",
+            "NUM_THREADS=%d" % num_threads,
+            "MAXDIST=%d" % maxdist,
+            "USE_INPUT_NODATA=YES",
+            "NODATA=-1",
+        ],
+    )
+
+    got = struct.unpack("f" * (width * height), dst_band.ReadRaster())
+    for y in range(height):
+        for x in range(width):
+            expected = min(
+                math.sqrt((x - tx) ** 2 + (y - ty) ** 2) for tx, ty in targets
+            )
+            if (x, y) == nodata_pixel or expected > maxdist:
+                expected = -1
+            assert got[y * width + x] == pytest.approx(expected, abs=1e-5), (x, y)
+
+
+def test_proximity_exact_invalid_algorithm():
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 1, 1)
+    dst_ds = gdal.GetDriverByName("MEM").Create("", 1, 1)
+    with pytest.raises(Exception, match="ALGORITHM"):
+        gdal.ComputeProximity(
+            src_ds.GetRasterBand(1),
+            dst_ds.GetRasterBand(1),
+            options=["ALGORITHM=INVALID"],
+        )
@@ -1011,3 +1011,50 @@ def test_rasterize_bugfix_gh8918(wkt):
     )
 
     assert target_ds.GetRasterBand(1).Checksum() == 36
+
+
+###############################################################################
+# Test NUM_THREADS option of GDALRasterizeLayers()
+
+
+@pytest.mark.parametrize(
+    "options",
+    [
+        [],
+        ["CHUNKYSIZE=7"],
+        ["MERGE_ALG=ADD", "CHUNKYSIZE=7"],
+    ],
+)
+def test_rasterize_layer_num_threads(options):
+
+    sr_wkt = 'LOCAL_CS["arbitrary"]'
+    sr = osr.SpatialReference(sr_wkt)
+
+    ogr_ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ogr_ds.CreateLayer("test", srs=sr)
+    lyr.CreateField(ogr.FieldDefn("val", ogr.OFTReal))
+    for i in range(50):
+        x = (i * 7) % 90
+        y = (i * 13) % 90
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["val"] = i + 1
+        geoms = [
+            f"POLYGON (({x} {y},{x} {y + 15.5},{x + 10.3} {y + 12},{x} {y}))",
+            f"LINESTRING ({x} {y},{x + 30} {y + 40.5})",
+            f"MULTIPOINT ({x + 0.5} {y + 0.5},{x + 3.5} {y + 60.5})",
+        ]
+        f.SetGeometry(ogr.CreateGeometryFromWkt(geoms[i % 3]))
+        lyr.CreateFeature(f)
+
+    def rasterize(extra_options):
+        ds = gdal.GetDriverByName("MEM").Create("", 100, 100, 2, gdal.GDT_Float32)
+        ds.SetGeoTransform((0, 1, 0, 100, 0, -1))
+        ds.SetProjection(sr_wkt)
+        gdal.RasterizeLayer(
+            ds, [1, 2], lyr, options=["ATTRIBUTE=val"] + options + extra_options
+        )
+        return ds.ReadRaster()
+
+    ref = rasterize([])
+    assert rasterize(["NUM_THREADS=3"]) == ref
+    assert rasterize(["NUM_THREADS=ALL_CPUS"]) == ref
@@ -30,6 +30,8 @@
 ###############################################################################
 
 
+import struct
+
 import pytest
 
 from osgeo import gdal
@@ -328,3 +330,104 @@ cellsize     60.000000000000
     if cs != cs_expected:
         print("Got: ", cs)
         pytest.fail("got wrong checksum")
+
+
+###############################################################################
+# Test that NUM_THREADS gives the same result as the single-threaded
+# algorithm, on a raster processed as several strips
+
+
+@pytest.mark.parametrize("connectedness", [4, 8])
+def test_sieve_num_threads(connectedness):
+
+    xsize = 300
+    ysize = 5000
+    src_ds = gdal.GetDriverByName("MEM").Create("", xsize, ysize)
+    src_ds.WriteRaster(
+        0,
+        0,
+        xsize,
+        ysize,
+        bytes(((i * 7919) ^ (i // 13)) % 3 for i in range(xsize * ysize)),
+    )
+    src_band = src_ds.GetRasterBand(1)
+
+    ref_ds = gdal.GetDriverByName("MEM").Create("", xsize, ysize)
+    gdal.SieveFilter(src_band, None, ref_ds.GetRasterBand(1), 10, connectedness)
+
+    dst_ds = gdal.GetDriverByName("MEM").Create("", xsize, ysize)
+    gdal.SieveFilter(
+        src_band,
+        None,
+        dst_ds.GetRasterBand(1),
+        10,
+        connectedness,
+        options=["NUM_THREADS=4"],
+    )
+
+    assert dst_ds.ReadRaster() == ref_ds.ReadRaster()
+    assert dst_ds.ReadRaster() != src_ds.ReadRaster()
+
+
+###############################################################################
+# Test LabelConnectedComponents()
+
+
+def test_sieve_label_connected_components():
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 3, 3)
+    src_ds.WriteRaster(0, 0, 3, 3, b"\x01\x01\x00\x00\x01\x00\x02\x00\x00")
+    dst_ds = gdal.GetDriverByName("MEM").Create("", 3, 3, 1, gdal.GDT_UInt32)
+
+    gdal.LabelConnectedComponents(
+        src_ds.GetRasterBand(1), None, dst_ds.GetRasterBand(1), 4
+    )
+    assert struct.unpack("I" * 9, dst_ds.ReadRaster()) == (1, 1, 2, 3, 1, 2, 4, 2, 2)
+
+    gdal.LabelConnectedComponents(
+        src_ds.GetRasterBand(1), None, dst_ds.GetRasterBand(1), 8
+    )
+    assert struct.unpack("I" * 9, dst_ds.ReadRaster()) == (1, 1, 2, 2, 1, 2, 3, 2, 2)
+
+
+@pytest.mark.parametrize("connectedness", [4, 8])
+def test_sieve_label_connected_components_num_threads(connectedness):
+
+    xsize = 300
+    ysize = 5000
+    src_ds = gdal.GetDriverByName("MEM").Create("", xsize, ysize)
+    src_ds.WriteRaster(
+        0,
+        0,
+        xsize,
+        ysize,
+        bytes(((i * 7919) ^ (i // 13)) % 3 for i in range(xsize * ysize)),
+    )
+    src_band = src_ds.GetRasterBand(1)
+
+    ref_ds = gdal.GetDriverByName("MEM").Create("", xsize, ysize, 1, gdal.GDT_UInt32)
+    gdal.LabelConnectedComponents(
+        src_band, src_band.GetMaskBand(), ref_ds.GetRasterBand(1), connectedness
+    )
+
+    dst_ds = gdal.GetDriverByName("MEM").Create("", xsize, ysize, 1, gdal.GDT_UInt32)
+    gdal.LabelConnectedComponents(
+        src_band,
+        src_band.GetMaskBand(),
+        dst_ds.GetRasterBand(1),
+        connectedness,
+        options=["NUM_THREADS=4"],
+    )
+
+    assert dst_ds.ReadRaster() == ref_ds.ReadRaster()
+    assert ref_ds.GetRasterBand(1).ComputeRasterMinMax()[0] == 1
+
+
+def test_sieve_label_connected_components_invalid_connectedness():
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 3, 3)
+    dst_ds = gdal.GetDriverByName("MEM").Create("", 3, 3, 1, gdal.GDT_UInt32)
+    with pytest.raises(Exception, match="invalid connectedness"):
+        gdal.LabelConnectedComponents(
+            src_ds.GetRasterBand(1), None, dst_ds.GetRasterBand(1), 6
+        )
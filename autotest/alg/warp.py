@@ -1638,6 +1638,35 @@ def test_warp_mode_ties():
     assert out_ds.GetRasterBand(1).ReadAsArray()[0, 0] == 5
 
 
+###############################################################################
+# Test mode and median resampling over several target pixels, to check that
+# per-pixel histograms are correctly reset
+
+
+@pytest.mark.parametrize("dt", [gdal.GDT_UInt16, gdal.GDT_Int32, gdal.GDT_Float32])
+def test_warp_mode_med_several_target_pixels(dt):
+    numpy = pytest.importorskip("numpy")
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 6, 3, 1, dt)
+    src_ds.SetGeoTransform([1, 1, 0, 1, 0, 1])
+    src_ds.GetRasterBand(1).WriteArray(
+        numpy.array([[7, 7, 9, 1, 2, 2], [8, 9, 9, 1, 3, 3], [7, 8, 8, 6, 6, 5]])
+    )
+
+    out_ds = gdal.Warp("", src_ds, format="MEM", resampleAlg="mode", xRes=3, yRes=3)
+    # 7, 9 and 8 have the same count: 9 reaches it first, in scanline order
+    assert out_ds.GetRasterBand(1).ReadAsArray().tolist() == [[9, 2]]
+
+    out_ds = gdal.Warp("", src_ds, format="MEM", resampleAlg="med", xRes=3, yRes=3)
+    assert out_ds.GetRasterBand(1).ReadAsArray().tolist() == [[8, 3]]
+
+    out_ds = gdal.Warp("", src_ds, format="MEM", resampleAlg="q1", xRes=3, yRes=3)
+    assert out_ds.GetRasterBand(1).ReadAsArray().tolist() == [[7, 2]]
+
+    out_ds = gdal.Warp("", src_ds, format="MEM", resampleAlg="q3", xRes=3, yRes=3)
+    assert out_ds.GetRasterBand(1).ReadAsArray().tolist() == [[9, 5]]
+
+
 ###############################################################################
 # Test bugfix for #6526
 
@@ -1853,3 +1882,61 @@ def test_warp_average_NODATA_VALUES_PCT_THRESHOLD():
         options="-of MEM -ts 1 1 -r average -wo NODATA_VALUES_PCT_THRESHOLD=25",
     )
     assert struct.unpack("B", out_ds.ReadRaster())[0] == 20
+
+
+###############################################################################
+# Test the column sums optimization of average and rms resampling when
+# downsampling with an axis-aligned transformation
+
+
+@pytest.mark.parametrize("resampling", ["average", "rms"])
+@pytest.mark.parametrize("with_nodata", [False, True])
+def test_warp_average_downsampling_column_sums(resampling, with_nodata):
+
+    src_ds = gdal.Translate("", "../gcore/data/utmsmall.tif", format="MEM")
+    if with_nodata:
+        src_ds.GetRasterBand(1).SetNoDataValue(107)
+
+    options = f"-of MEM -ts 13 17 -r {resampling}"
+    out_ds = gdal.Warp("", src_ds, options=options)
+    with gdal.config_option("GDAL_WARP_USE_AFFINE_OPTIMIZATION", "NO"):
+        ref_ds = gdal.Warp("", src_ds, options=options)
+
+    got = struct.unpack("B" * (13 * 17), out_ds.ReadRaster())
+    expected = struct.unpack("B" * (13 * 17), ref_ds.ReadRaster())
+    # Allow for rounding differences of values very close to x.5
+    assert max(abs(a - b) for a, b in zip(got, expected)) <= 1
+    assert sum(1 for a, b in zip(got, expected) if a != b) <= 2
+
+
+###############################################################################
+# Test that the fast path of bilinear and cubic resampling for fully valid
+# footprints gives the same result as the general case
+
+
+@pytest.mark.parametrize("typestr", ("Byte", "Int16", "UInt16", "Float32", "Float64"))
+@pytest.mark.parametrize("resampling", ("bilinear", "cubic"))
+def test_warp_all_valid_footprint_same_as_general_case(typestr, resampling):
+
+    src_ds = gdal.GetDriverByName("MEM").Create(
+        "", 40, 30, 1, gdal.GetDataTypeByName(typestr)
+    )
+    src_ds.SetGeoTransform([0, 1, 0, 30, 0, -1])
+    src_ds.GetRasterBand(1).SetNoDataValue(0)
+    data = [
+        1 + (x * 7 + y * 13 + (x * y) % 11) % 200 for y in range(30) for x in range(40)
+    ]
+    # A few invalid pixels, so that the generic functions are also used
+    # around them in the same warp
+    for x, y in ((5, 5), (20, 12), (33, 25)):
+        data[y * 40 + x] = 0
+    src_ds.GetRasterBand(1).WriteRaster(
+        0, 0, 40, 30, struct.pack("d" * len(data), *data), buf_type=gdal.GDT_Float64
+    )
+
+    options = f"-of MEM -r {resampling} -te 0.3 0.2 39.7 29.9 -ts 97 71"
+    out_ds = gdal.Warp("", src_ds, options=options)
+    ref_ds = gdal.Warp("", src_ds, options=options + " -wo USE_GENERAL_CASE=TRUE")
+
+    assert out_ds.GetRasterBand(1).Checksum() != 0
+    assert out_ds.ReadRaster() == ref_ds.ReadRaster()
@@ -27,7 +27,10 @@
  * DEALINGS IN THE SOFTWARE.
  ****************************************************************************/
 
+#include <algorithm>
 #include <array>
+#include <cmath>
+#include <vector>
 
 #include "gdal_unit_test.h"
 
@@ -490,4 +493,90 @@ TEST_F(test_alg, GDALIsLineOfSightVisible_through_mountain)
                                          nullptr, nullptr, nullptr));
 }
 
+// Smooth non-linear transformer, counting the number of transformed points
+static int DummyCurvedTransformer(void *pTransformerArg, int /*bDstToSrc*/,
+                                  int nPointCount, double *x, double *y,
+                                  double * /*z*/, int *panSuccess)
+{
+    *static_cast<int *>(pTransformerArg) += nPointCount;
+    for (int i = 0; i < nPointCount; i++)
+    {
+        const double dfX = x[i];
+        const double dfY = y[i];
+        x[i] = dfX + 20 * sin(dfY / 500);
+        y[i] = dfY + 20 * cos(dfX / 500);
+        panSuccess[i] = TRUE;
+    }
+    return TRUE;
+}
+
+// Test GDAL_APPROX_TRANSFORMER_GRID_STEP
+TEST_F(test_alg, approx_transformer_grid)
+{
+    constexpr int SIZE = 1024;
+    constexpr double MAX_ERROR = 0.125;
+
+    const auto RunScanlines = [](void *hTransformArg, double &dfMaxErr)
+    {
+        std::vector<double> adfX(SIZE), adfY(SIZE), adfZ(SIZE);
+        std::vector<int> anSuccess(SIZE);
+        dfMaxErr = 0;
+        for (int iY = 0; iY < SIZE; ++iY)
+        {
+            for (int iX = 0; iX < SIZE; ++iX)
+            {
+                adfX[iX] = iX + 0.5;
+                adfY[iX] = iY + 0.5;
+                adfZ[iX] = 0;
+            }
+            EXPECT_TRUE(GDALApproxTransform(hTransformArg, TRUE, SIZE,
+                                            adfX.data(), adfY.data(),
+                                            adfZ.data(), anSuccess.data()));
+            for (int iX = 0; iX < SIZE; ++iX)
+            {
+                EXPECT_TRUE(anSuccess[iX]);
+                double dfX = iX + 0.5;
+                double dfY = iY + 0.5;
+                double dfZ = 0;
+                int nCount = 0;
+                int bSuccess = FALSE;
+                DummyCurvedTransformer(&nCount, TRUE, 1, &dfX, &dfY, &dfZ,
+                                       &bSuccess);
+                dfMaxErr = std::max(dfMaxErr, fabs(dfX - adfX[iX]) +
+                                                  fabs(dfY - adfY[iX]));
+            }
+        }
+    };
+
+    int nCountLine = 0;
+    {
+        void *hTransformArg = GDALCreateApproxTransformer(
+            DummyCurvedTransformer, &nCountLine, MAX_ERROR);
+        double dfMaxErr = 0;
+        RunScanlines(hTransformArg, dfMaxErr);
+        GDALDestroyApproxTransformer(hTransformArg);
+    }
+
+    int nCountGrid = 0;
+    {
+        CPLConfigOptionSetter oSetter("GDAL_APPROX_TRANSFORMER_GRID_STEP", "32",
+                                      false);
+        void *hTransformArg = GDALCreateApproxTransformer(
+            DummyCurvedTransformer, &nCountGrid, MAX_ERROR);
+
+        double dfMaxErr = 0;
+        RunScanlines(hTransformArg, dfMaxErr);
+        // Error is only checked at a few places of each cell
+        EXPECT_LE(dfMaxErr, 2 * MAX_ERROR);
+        const int nCountFirstPass = nCountGrid;
+        EXPECT_LT(nCountFirstPass, nCountLine);
+
+        // Second pass only uses the cached grid.
+        RunScanlines(hTransformArg, dfMaxErr);
+        EXPECT_EQ(nCountGrid, nCountFirstPass);
+
+        GDALDestroyApproxTransformer(hTransformArg);
+    }
+}
+
 }  // namespace
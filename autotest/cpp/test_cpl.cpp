@@ -51,6 +51,7 @@
 #include "cpl_http.h"
 #include "cpl_auto_close.h"
 #include "cpl_minixml.h"
+#include "cpl_packed_rtree.h"
 #include "cpl_quad_tree.h"
 #include "cpl_worker_thread_pool.h"
 #include "cpl_vsi_virtual.h"
@@ -2425,6 +2426,65 @@ TEST_F(test_cpl, CPLJSonStreamingParser)
     }
 }
 
+// Test CPLJSonStreamingParser() with tokens long enough to go through the
+// block-based scanning of strings and numbers
+TEST_F(test_cpl, CPLJSonStreamingParser_long_tokens)
+{
+    for (int nOffset = 0; nOffset < 70; ++nOffset)
+    {
+        const std::string osPrefix(nOffset, 'x');
+        const std::string osText = "[\"" + osPrefix + "\\\"" + osPrefix +
+                                   "\\u00e9" + osPrefix + "\\n" + osPrefix +
+                                   "\", " + std::string(nOffset + 1, '1') +
+                                   ".5e+3]";
+        const std::string osExpected =
+            "[\"" + osPrefix + "\\\"" + osPrefix + "\xC3\xA9" + osPrefix +
+            "\\n" + osPrefix + "\", " + std::string(nOffset + 1, '1') +
+            ".5e+3]";
+        {
+            CPLJSonStreamingParserDump oParser;
+            ASSERT_TRUE(oParser.Parse(osText.c_str(), osText.size(), true));
+            EXPECT_STREQ(oParser.GetSerialized(), osExpected.c_str());
+        }
+        {
+            CPLJSonStreamingParserDump oParser;
+            for (size_t i = 0; i < osText.size(); ++i)
+            {
+                const bool bFinished = i + 1 == osText.size();
+                ASSERT_TRUE(oParser.Parse(osText.c_str() + i, 1, bFinished));
+            }
+            EXPECT_STREQ(oParser.GetSerialized(), osExpected.c_str());
+        }
+    }
+
+    // Check that line and character positions are still accurate
+    {
+        CPLJSonStreamingParserDump oParser;
+        const std::string osText =
+            "[\"" + std::string(100, 'x') + "\r\n" + std::string(40, 'x') +
+            "\", " + std::string(50, '1') + " x]";
+        ASSERT_TRUE(!oParser.Parse(osText.c_str(), osText.size(), true));
+        EXPECT_STREQ(oParser.GetException(),
+                     "At line 2, character 96: Unexpected character (x)");
+    }
+    {
+        CPLJSonStreamingParserDump oParser;
+        const std::string osText = "\"" + std::string(100, 'x') + "\"";
+        oParser.SetMaxStringSize(50);
+        ASSERT_TRUE(!oParser.Parse(osText.c_str(), osText.size(), true));
+        EXPECT_STREQ(oParser.GetException(),
+                     "At line 1, character 52: Too many characters in number");
+    }
+    {
+        CPLJSonStreamingParserDump oParser;
+        const std::string osText = std::string(2000, '1');
+        ASSERT_TRUE(!oParser.Parse(osText.c_str(), osText.size(), true));
+        EXPECT_STREQ(
+            oParser.GetException(),
+            "At line 1, character 1025: Too many characters in number");
+    }
+}
+
 // Test cpl_mem_cache
 TEST_F(test_cpl, cpl_mem_cache)
 {
@@ -4127,6 +4187,116 @@ TEST_F(test_cpl, CPLQuadTree)
     CPLQuadTreeDestroy(hTree);
 }
 
+// Test CPLPackedRTree
+TEST_F(test_cpl, CPLPackedRTree)
+{
+    unsigned next = 0;
+    constexpr int MAX_RAND_VAL = 32767;
+    const auto DummyRand = [&]()
+    {
+        next = next * 1103515245 + 12345;
+        return ((unsigned)(next / 65536) % (MAX_RAND_VAL + 1));
+    };
+    const auto GenerateRandomRect = [&](CPLRectObj &rect, double dfMaxSize)
+    {
+        rect.minx = double(DummyRand()) / MAX_RAND_VAL;
+        rect.miny = double(DummyRand()) / MAX_RAND_VAL;
+        rect.maxx = rect.minx + double(DummyRand()) / MAX_RAND_VAL * dfMaxSize;
+        rect.maxy = rect.miny + double(DummyRand()) / MAX_RAND_VAL * dfMaxSize;
+    };
+    const auto Intersects = [](const CPLRectObj &a, const CPLRectObj &b)
+    {
+        return a.minx <= b.maxx && a.maxx >= b.minx && a.miny <= b.maxy &&
+               a.maxy >= b.miny;
+    };
+    const auto SquareDist = [](const CPLRectObj &r, double x, double y)
+    {
+        const double dx = std::max(std::max(r.minx - x, 0.0), x - r.maxx);
+        const double dy = std::max(std::max(r.miny - y, 0.0), y - r.maxy);
+        return dx * dx + dy * dy;
+    };
+
+    {
+        CPLPackedRTree oTree;
+        EXPECT_TRUE(oTree.Build(nullptr, 0));
+        EXPECT_EQ(oTree.GetItemCount(), 0U);
+        CPLRectObj sExtent;
+        EXPECT_FALSE(oTree.GetExtent(sExtent));
+        const CPLRectObj sAOI = {0, 0, 1, 1};
+        EXPECT_TRUE(oTree.Search(sAOI).empty());
+        EXPECT_TRUE(oTree.Nearest(0, 0, 1).empty());
+
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        EXPECT_FALSE(oTree.Build(&sAOI, 1, CPLPackedRTree::SortMethod::HILBERT,
+                                 1));
+    }
+
+    for (const auto eMethod : {CPLPackedRTree::SortMethod::HILBERT,
+                               CPLPackedRTree::SortMethod::STR})
+    {
+        for (const size_t nCount : {1, 2, 16, 17, 1000})
+        {
+            next = static_cast<unsigned>(nCount);
+            std::vector<CPLRectObj> asRects(nCount);
+            for (auto &rect : asRects)
+                GenerateRandomRect(rect, 0.05);
+
+            CPLPackedRTree oTree;
+            ASSERT_TRUE(oTree.Build(asRects.data(), nCount, eMethod, 4));
+            EXPECT_EQ(oTree.GetItemCount(), nCount);
+
+            for (int iQuery = 0; iQuery < 100; ++iQuery)
+            {
+                CPLRectObj sAOI;
+                GenerateRandomRect(sAOI, 0.2);
+
+                std::vector<size_t> anExpected;
+                for (size_t i = 0; i < nCount; ++i)
+                {
+                    if (Intersects(asRects[i], sAOI))
+                        anExpected.push_back(i);
+                }
+                auto anGot = oTree.Search(sAOI);
+                std::sort(anGot.begin(), anGot.end());
+                EXPECT_EQ(anGot, anExpected) << nCount;
+
+                // Early stop of the search
+                size_t nCalls = 0;
+                const bool bCompleted = oTree.Search(sAOI,
+                                                     [&nCalls](size_t)
+                                                     {
+                                                         ++nCalls;
+                                                         return false;
+                                                     });
+                EXPECT_EQ(nCalls, anExpected.empty() ? 0U : 1U);
+                EXPECT_EQ(bCompleted, anExpected.empty());
+
+                // k nearest neighbors
+                const double dfX = double(DummyRand()) / MAX_RAND_VAL;
+                const double dfY = double(DummyRand()) / MAX_RAND_VAL;
+                std::vector<double> adfSquareDist;
+                for (const auto &rect : asRects)
+                    adfSquareDist.push_back(SquareDist(rect, dfX, dfY));
+                std::vector<double> adfSorted(adfSquareDist);
+                std::sort(adfSorted.begin(), adfSorted.end());
+                const auto anNearest = oTree.Nearest(dfX, dfY, 5);
+                ASSERT_EQ(anNearest.size(), std::min<size_t>(5, nCount));
+                for (size_t i = 0; i < anNearest.size(); ++i)
+                {
+                    EXPECT_EQ(adfSquareDist[anNearest[i]], adfSorted[i]);
+                }
+
+                const double dfMaxDist = 0.01;
+                for (const size_t nIdx : oTree.Nearest(dfX, dfY, nCount,
+                                                       dfMaxDist))
+                {
+                    EXPECT_LE(adfSquareDist[nIdx], dfMaxDist * dfMaxDist);
+                }
+            }
+        }
+    }
+}
+
 // Test bUnlinkAndSize on VSIGetMemFileBuffer
 TEST_F(test_cpl, VSIGetMemFileBuffer_unlink_and_size)
 {
@@ -4145,6 +4315,110 @@ TEST_F(test_cpl, VSIGetMemFileBuffer_unlink_and_size)
     VSIFCloseL(fp);
 }
 
+// Test VSIVirtualHandle::ReadMultiRangeWithCallback()
+TEST_F(test_cpl, VSIVirtualHandle_ReadMultiRangeWithCallback)
+{
+    const char *pszFilename = "/vsimem/test_read_multi_range_callback.bin";
+    VSILFILE *fp = VSIFOpenL(pszFilename, "wb+");
+    ASSERT_NE(fp, nullptr);
+    VSIFWriteL("0123456789", 10, 1, fp);
+
+    char abyBuffer1[2] = {0};
+    char abyBuffer2[3] = {0};
+    void *apData[] = {abyBuffer1, abyBuffer2};
+    const vsi_l_offset anOffsets[] = {1, 5};
+    const size_t anSizes[] = {sizeof(abyBuffer1), sizeof(abyBuffer2)};
+
+    struct Notifications
+    {
+        std::vector<std::pair<int, bool>> aoRanges{};
+    } sNotifications;
+    const auto Callback = [](int iRange, bool bSuccess, void *pUserData)
+    {
+        static_cast<Notifications *>(pUserData)->aoRanges.emplace_back(
+            iRange, bSuccess);
+    };
+
+    auto poHandle = reinterpret_cast<VSIVirtualHandle *>(fp);
+    EXPECT_EQ(poHandle->ReadMultiRangeWithCallback(2, apData, anOffsets,
+                                                   anSizes, Callback,
+                                                   &sNotifications),
+              0);
+    EXPECT_EQ(std::string(abyBuffer1, sizeof(abyBuffer1)), "12");
+    EXPECT_EQ(std::string(abyBuffer2, sizeof(abyBuffer2)), "567");
+    ASSERT_EQ(sNotifications.aoRanges.size(), 2U);
+    EXPECT_EQ(sNotifications.aoRanges[0], std::make_pair(0, true));
+    EXPECT_EQ(sNotifications.aoRanges[1], std::make_pair(1, true));
+
+    // Read beyond end of file
+    const vsi_l_offset anOffsetsErr[] = {1, 9};
+    sNotifications.aoRanges.clear();
+    EXPECT_NE(poHandle->ReadMultiRangeWithCallback(2, apData, anOffsetsErr,
+                                                   anSizes, Callback,
+                                                   &sNotifications),
+              0);
+    ASSERT_EQ(sNotifications.aoRanges.size(), 2U);
+    EXPECT_FALSE(sNotifications.aoRanges[1].second);
+
+    VSIFCloseL(fp);
+    VSIUnlink(pszFilename);
+}
+
+// Test VSIFReadMultiRangeL() on a local file, with and without io_uring
+TEST_F(test_cpl, VSIFReadMultiRangeL_local_file)
+{
+    const std::string osFilename =
+        CPLGenerateTempFilename("test_read_multi_range_local");
+    VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "wb+");
+    ASSERT_NE(fp, nullptr);
+    std::vector<GByte> abyData(100 * 1000);
+    for (size_t i = 0; i < abyData.size(); ++i)
+        abyData[i] = static_cast<GByte>(i * 7);
+    ASSERT_EQ(VSIFWriteL(abyData.data(), 1, abyData.size(), fp),
+              abyData.size());
+
+    constexpr int N_RANGES = 100;
+    std::vector<std::vector<GByte>> aabyBuffers(N_RANGES);
+    std::vector<void *> apData(N_RANGES);
+    std::vector<vsi_l_offset> anOffsets(N_RANGES);
+    std::vector<size_t> anSizes(N_RANGES);
+    for (int i = 0; i < N_RANGES; ++i)
+    {
+        anOffsets[i] = static_cast<vsi_l_offset>(i) * 997;
+        anSizes[i] = 10 + i;
+        aabyBuffers[i].resize(anSizes[i]);
+        apData[i] = aabyBuffers[i].data();
+    }
+
+    for (const char *pszUseIOUring : {"NO", "YES"})
+    {
+        CPLConfigOptionSetter oSetter("CPL_VSIL_USE_IO_URING", pszUseIOUring,
+                                      false);
+        for (auto &abyBuffer : aabyBuffers)
+            std::fill(abyBuffer.begin(), abyBuffer.end(), GByte(0));
+        // Includes the case where the last operation was a write
+        EXPECT_EQ(VSIFReadMultiRangeL(N_RANGES, apData.data(),
+                                      anOffsets.data(), anSizes.data(), fp),
+                  0);
+        for (int i = 0; i < N_RANGES; ++i)
+        {
+            EXPECT_EQ(memcmp(apData[i], abyData.data() + anOffsets[i],
+                             anSizes[i]),
+                      0)
+                << pszUseIOUring << " " << i;
+        }
+
+        // Read beyond end of file
+        const vsi_l_offset nOffset = abyData.size() - 1;
+        const size_t nSize = 2;
+        void *pData = apData[0];
+        EXPECT_NE(VSIFReadMultiRangeL(1, &pData, &nOffset, &nSize, fp), 0);
+    }
+
+    VSIFCloseL(fp);
+    VSIUnlink(osFilename.c_str());
+}
+
 // Test CPLLoadConfigOptionsFromFile() for VSI credentials
 TEST_F(test_cpl, CPLLoadConfigOptionsFromFile_VSI_credentials)
 {
@@ -4659,6 +4933,116 @@ TEST_F(test_cpl, CPLWorkerThreadPool_recursion)
     ASSERT_EQ(ctxt.nCounter, 3 * 3);
 }
 
+// Test that CPLWorkerThreadPool runs jobs submitted by an external thread
+// in submission order, when it has fewer threads than job deques
+TEST_F(test_cpl, CPLWorkerThreadPool_fifo_order)
+{
+    struct Context
+    {
+        std::mutex mutex{};
+        std::vector<int> anOrder{};
+    };
+
+    struct Data
+    {
+        Context *psCtxt;
+        int iJob;
+    };
+
+    const auto myJob = [](void *pData)
+    {
+        auto psData = static_cast<Data *>(pData);
+        std::lock_guard<std::mutex> guard(psData->psCtxt->mutex);
+        psData->psCtxt->anOrder.push_back(psData->iJob);
+    };
+
+    CPLWorkerThreadPool oPool;
+    ASSERT_TRUE(oPool.Setup(1, nullptr, nullptr));
+
+    Context ctxt;
+    constexpr int N_JOBS = 1000;
+    std::vector<Data> asData;
+    for (int i = 0; i < N_JOBS; i++)
+        asData.push_back(Data{&ctxt, i});
+
+    for (int i = 0; i < N_JOBS / 2; i++)
+        ASSERT_TRUE(oPool.SubmitJob(myJob, &asData[i]));
+    std::vector<void *> apData;
+    for (int i = N_JOBS / 2; i < N_JOBS; i++)
+        apData.push_back(&asData[i]);
+    ASSERT_TRUE(oPool.SubmitJobs(myJob, apData));
+    oPool.WaitCompletion();
+
+    ASSERT_EQ(ctxt.anOrder.size(), static_cast<size_t>(N_JOBS));
+    for (int i = 0; i < N_JOBS; i++)
+    {
+        ASSERT_EQ(ctxt.anOrder[i], i);
+    }
+}
+
+// Test that CPLWorkerThreadPool::WaitCompletion() also waits for the jobs
+// submitted by jobs of the pool
+TEST_F(test_cpl, CPLWorkerThreadPool_nested_submission)
+{
+    struct Context
+    {
+        CPLWorkerThreadPool oPool{};
+        CPLThreadFunc pfnInnerJob = nullptr;
+        std::atomic<int> nCounter{0};
+    };
+
+    Context ctxt;
+    ASSERT_TRUE(ctxt.oPool.Setup(2, nullptr, nullptr));
+
+    const auto innerJob = [](void *pData)
+    {
+        CPLSleep(0.001);
+        static_cast<Context *>(pData)->nCounter++;
+    };
+
+    const auto outerJob = [](void *pData)
+    {
+        auto psCtxt = static_cast<Context *>(pData);
+        for (int i = 0; i < 10; i++)
+            psCtxt->oPool.SubmitJob(psCtxt->pfnInnerJob, psCtxt);
+        psCtxt->nCounter++;
+    };
+
+    ctxt.pfnInnerJob = innerJob;
+    for (int i = 0; i < 4; i++)
+        ASSERT_TRUE(ctxt.oPool.SubmitJob(outerJob, &ctxt));
+    ctxt.oPool.WaitCompletion();
+    ASSERT_EQ(ctxt.nCounter, 4 + 4 * 10);
+}
+
+// Test CPLWorkerThreadPool::WaitCompletion() with a maximum number of
+// remaining jobs
+TEST_F(test_cpl, CPLWorkerThreadPool_WaitCompletion)
+{
+    CPLWorkerThreadPool oPool;
+    ASSERT_TRUE(oPool.Setup(2, nullptr, nullptr));
+
+    // Nothing to wait for
+    oPool.WaitCompletion();
+
+    const auto myJob = [](void *pData)
+    {
+        CPLSleep(0.001);
+        (*static_cast<std::atomic<int> *>(pData))++;
+    };
+
+    std::atomic<int> nCounter{0};
+    constexpr int N_JOBS = 50;
+    for (int i = 0; i < N_JOBS; i++)
+        ASSERT_TRUE(oPool.SubmitJob(myJob, &nCounter));
+
+    oPool.WaitCompletion(5);
+    ASSERT_GE(nCounter, N_JOBS - 5);
+
+    oPool.WaitCompletion();
+    ASSERT_EQ(nCounter, N_JOBS);
+}
+
 // Test /vsimem/ PRead() implementation
 TEST_F(test_cpl, vsimem_pread)
 {
@@ -35,6 +35,9 @@
 #include "gdal.h"
 #include "tilematrixset.hpp"
 #include "gdalcachedpixelaccessor.h"
+#include "gdal_thread_pool.h"
+#include "cpl_json.h"
+#include "ogr_recordbatch.h"
 
 #include <limits>
 #include <string>
@@ -3147,6 +3150,87 @@ TEST_F(test_gdal, GDALDeinterleave4ComponentsUInt16)
     VSIFree(panDest3);
 }
 
+// Test GDALDeinterleave with many components, crossing chunk boundaries
+TEST_F(test_gdal, GDALDeinterleaveManyComponents)
+{
+    constexpr int nComponents = 200;
+    constexpr int nIters = 1000;
+    std::vector<float> afSrc(nComponents * nIters);
+    for (size_t i = 0; i < afSrc.size(); i++)
+        afSrc[i] = static_cast<float>(i);
+    std::vector<std::vector<double>> aadfDest(nComponents,
+                                              std::vector<double>(nIters));
+    std::vector<void *> apDest;
+    for (auto &adfDest : aadfDest)
+        apDest.push_back(adfDest.data());
+    GDALDeinterleave(afSrc.data(), GDT_Float32, nComponents, apDest.data(),
+                     GDT_Float64, nIters);
+    for (int iComp = 0; iComp < nComponents; iComp++)
+    {
+        for (int i = 0; i < nIters; i++)
+        {
+            ASSERT_EQ(aadfDest[iComp][i],
+                      static_cast<double>(nComponents * i + iComp));
+        }
+    }
+}
+
+// Test GDALInterleave with 3 and 4 components Byte
+TEST_F(test_gdal, GDALInterleaveByte)
+{
+    for (int nComponents : {3, 4})
+    {
+        constexpr int nMaxIters = 4 * 15 + 3;
+        std::vector<std::vector<GByte>> aabySrc(nComponents,
+                                                std::vector<GByte>(nMaxIters));
+        std::vector<const void *> apSrc;
+        for (int iComp = 0; iComp < nComponents; iComp++)
+        {
+            for (int i = 0; i < nMaxIters; i++)
+                aabySrc[iComp][i] = static_cast<GByte>(nComponents * i + iComp);
+            apSrc.push_back(aabySrc[iComp].data());
+        }
+        for (int nIters : {1, 4, 16, nMaxIters})
+        {
+            std::vector<GByte> abyDest(nComponents * nMaxIters, 0);
+            GDALInterleave(apSrc.data(), GDT_Byte, nComponents, abyDest.data(),
+                           GDT_Byte, nIters);
+            for (int i = 0; i < nComponents * nIters; i++)
+            {
+                ASSERT_EQ(abyDest[i], static_cast<GByte>(i))
+                    << "nComponents=" << nComponents << ", nIters=" << nIters;
+            }
+            for (int i = nComponents * nIters; i < nComponents * nMaxIters; i++)
+            {
+                ASSERT_EQ(abyDest[i], 0);
+            }
+        }
+    }
+}
+
+// Test GDALInterleave general case, with data type conversion
+TEST_F(test_gdal, GDALInterleaveGeneralCase)
+{
+    constexpr int nComponents = 200;
+    constexpr int nIters = 1000;
+    std::vector<std::vector<float>> aafSrc(nComponents,
+                                           std::vector<float>(nIters));
+    std::vector<const void *> apSrc;
+    for (int iComp = 0; iComp < nComponents; iComp++)
+    {
+        for (int i = 0; i < nIters; i++)
+            aafSrc[iComp][i] = static_cast<float>(nComponents * i + iComp);
+        apSrc.push_back(aafSrc[iComp].data());
+    }
+    std::vector<double> adfDest(nComponents * nIters);
+    GDALInterleave(apSrc.data(), GDT_Float32, nComponents, adfDest.data(),
+                   GDT_Float64, nIters);
+    for (size_t i = 0; i < adfDest.size(); i++)
+    {
+        ASSERT_EQ(adfDest[i], static_cast<double>(i));
+    }
+}
+
 // Test GDALDataset::ReportError()
 TEST_F(test_gdal, GDALDatasetReportError)
 {
@@ -3927,4 +4011,769 @@ TEST_F(test_gdal, gdal_gcp_class)
     }
 }
 
+// Test GDALRasterBand::ReadBlocks()
+TEST_F(test_gdal, ReadBlocks)
+{
+    GDALDriver *poGTiffDrv = GetGDALDriverManager()->GetDriverByName("GTiff");
+    if (!poGTiffDrv)
+    {
+        GTEST_SKIP() << "GTiff driver missing";
+    }
+
+    const char *pszFilename = "/vsimem/test_gdal_ReadBlocks.tif";
+    {
+        const char *const apszOptions[] = {"TILED=YES", "BLOCKXSIZE=16",
+                                           "BLOCKYSIZE=16", "COMPRESS=DEFLATE",
+                                           nullptr};
+        auto poDS = std::unique_ptr<GDALDataset>(poGTiffDrv->Create(
+            pszFilename, 40, 36, 1, GDT_UInt16, apszOptions));
+        ASSERT_TRUE(poDS != nullptr);
+        std::vector<GUInt16> anValues(40 * 36);
+        for (size_t i = 0; i < anValues.size(); ++i)
+            anValues[i] = static_cast<GUInt16>(i);
+        ASSERT_EQ(poDS->GetRasterBand(1)->RasterIO(GF_Write, 0, 0, 40, 36,
+                                                   anValues.data(), 40, 36,
+                                                   GDT_UInt16, 0, 0, nullptr),
+                  CE_None);
+    }
+
+    // Full blocks, a right edge block, a bottom edge block and a repeated
+    // block, in an arbitrary order.
+    const int anXBlockOff[] = {0, 1, 2, 0, 1, 2, 0, 1};
+    const int anYBlockOff[] = {0, 0, 0, 1, 1, 2, 2, 0};
+    constexpr int nBlockCount = static_cast<int>(CPL_ARRAYSIZE(anXBlockOff));
+
+    std::vector<GUInt16> anExpected(nBlockCount * 16 * 16);
+    {
+        auto poDS = std::unique_ptr<GDALDataset>(
+            GDALDataset::Open(pszFilename, GDAL_OF_RASTER));
+        ASSERT_TRUE(poDS != nullptr);
+        for (int i = 0; i < nBlockCount; ++i)
+        {
+            ASSERT_EQ(poDS->GetRasterBand(1)->ReadBlock(
+                          anXBlockOff[i], anYBlockOff[i],
+                          anExpected.data() + i * 16 * 16),
+                      CE_None);
+        }
+    }
+
+    for (const char *pszNumThreads : {"1", "4"})
+    {
+        const char *const apszOpenOptions[] = {
+            CPLSPrintf("NUM_THREADS=%s", pszNumThreads), nullptr};
+        auto poDS = std::unique_ptr<GDALDataset>(GDALDataset::Open(
+            pszFilename, GDAL_OF_RASTER, nullptr, apszOpenOptions));
+        ASSERT_TRUE(poDS != nullptr);
+        std::vector<GUInt16> anGot(anExpected.size());
+        std::vector<void *> apData;
+        for (int i = 0; i < nBlockCount; ++i)
+            apData.push_back(anGot.data() + i * 16 * 16);
+        ASSERT_EQ(poDS->GetRasterBand(1)->ReadBlocks(
+                      nBlockCount, anXBlockOff, anYBlockOff, apData.data()),
+                  CE_None);
+        EXPECT_EQ(anGot, anExpected) << pszNumThreads;
+    }
+
+    // Invalid block offset
+    {
+        auto poDS = std::unique_ptr<GDALDataset>(
+            GDALDataset::Open(pszFilename, GDAL_OF_RASTER));
+        ASSERT_TRUE(poDS != nullptr);
+        const int nXBlockOff = 3;
+        const int nYBlockOff = 0;
+        void *pData = anExpected.data();
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        EXPECT_EQ(poDS->GetRasterBand(1)->ReadBlocks(1, &nXBlockOff,
+                                                     &nYBlockOff, &pData),
+                  CE_Failure);
+    }
+
+    VSIUnlink(pszFilename);
+}
+
+// Test GDALRasterBand::SamplePoints()
+TEST_F(test_gdal, SamplePoints)
+{
+    GDALDriver *poGTiffDrv = GetGDALDriverManager()->GetDriverByName("GTiff");
+    if (!poGTiffDrv)
+    {
+        GTEST_SKIP() << "GTiff driver missing";
+    }
+
+    const char *pszFilename = "/vsimem/test_gdal_SamplePoints.tif";
+    {
+        const char *const apszOptions[] = {"TILED=YES", "BLOCKXSIZE=16",
+                                           "BLOCKYSIZE=16", nullptr};
+        auto poDS = std::unique_ptr<GDALDataset>(poGTiffDrv->Create(
+            pszFilename, 40, 36, 1, GDT_UInt16, apszOptions));
+        ASSERT_TRUE(poDS != nullptr);
+        std::vector<GUInt16> anValues(40 * 36);
+        for (size_t i = 0; i < anValues.size(); ++i)
+            anValues[i] = static_cast<GUInt16>(i);
+        ASSERT_EQ(poDS->GetRasterBand(1)->RasterIO(GF_Write, 0, 0, 40, 36,
+                                                   anValues.data(), 40, 36,
+                                                   GDT_UInt16, 0, 0, nullptr),
+                  CE_None);
+    }
+
+    const double dfNaN = std::numeric_limits<double>::quiet_NaN();
+    for (const bool bCached : {false, true})
+    {
+        auto poDS = std::unique_ptr<GDALDataset>(
+            GDALDataset::Open(pszFilename, GDAL_OF_RASTER));
+        ASSERT_TRUE(poDS != nullptr);
+        auto poBand = poDS->GetRasterBand(1);
+        if (bCached)
+        {
+            // Put the first block in the block cache
+            GUInt16 nVal = 0;
+            ASSERT_EQ(poBand->RasterIO(GF_Read, 0, 0, 1, 1, &nVal, 1, 1,
+                                       GDT_UInt16, 0, 0, nullptr),
+                      CE_None);
+        }
+
+        {
+            const double adfX[] = {0.5, 17.9, 39.99, 40, -0.1, dfNaN, 3};
+            const double adfY[] = {0.5, 3.2, 35.99, 0, 0, 0, 2};
+            constexpr int N = static_cast<int>(CPL_ARRAYSIZE(adfX));
+            double adfValues[2 * N];
+            ASSERT_EQ(poBand->SamplePoints(N, adfX, adfY,
+                                           GRIORA_NearestNeighbour, adfValues,
+                                           GDT_CFloat64),
+                      CE_None);
+            EXPECT_EQ(adfValues[0], 0);
+            EXPECT_EQ(adfValues[2], 3 * 40 + 17);
+            EXPECT_EQ(adfValues[4], 35 * 40 + 39);
+            EXPECT_TRUE(std::isnan(adfValues[6]));
+            EXPECT_TRUE(std::isnan(adfValues[8]));
+            EXPECT_TRUE(std::isnan(adfValues[10]));
+            EXPECT_EQ(adfValues[12], 2 * 40 + 3);
+            EXPECT_EQ(adfValues[13], 0);
+        }
+
+        {
+            // Within a block, straddling 4 blocks, and at the edges
+            const double adfX[] = {1, 16, 0.25, 39.9};
+            const double adfY[] = {0.5, 16, 0.5, 0.5};
+            constexpr int N = static_cast<int>(CPL_ARRAYSIZE(adfX));
+            double adfValues[N];
+            ASSERT_EQ(poBand->SamplePoints(N, adfX, adfY, GRIORA_Bilinear,
+                                           adfValues, GDT_Float64),
+                      CE_None);
+            EXPECT_EQ(adfValues[0], 0.5);
+            EXPECT_EQ(adfValues[1], (615 + 616 + 655 + 656) / 4.0);
+            EXPECT_EQ(adfValues[2], 0);
+            EXPECT_EQ(adfValues[3], 39);
+        }
+    }
+
+    {
+        auto poDS = std::unique_ptr<GDALDataset>(
+            GDALDataset::Open(pszFilename, GDAL_OF_RASTER));
+        ASSERT_TRUE(poDS != nullptr);
+        const double dfX = 0.5;
+        const double dfY = 0.5;
+        double dfValue = 0;
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        EXPECT_EQ(poDS->GetRasterBand(1)->SamplePoints(
+                      1, &dfX, &dfY, GRIORA_Cubic, &dfValue, GDT_Float64),
+                  CE_Failure);
+        EXPECT_EQ(poDS->GetRasterBand(1)->SamplePoints(1, &dfX, &dfY,
+                                                       GRIORA_NearestNeighbour,
+                                                       &dfValue, GDT_Float32),
+                  CE_Failure);
+    }
+
+    VSIUnlink(pszFilename);
+
+    // Nodata pixels are left out of the bilinear interpolation
+    {
+        auto poDrv = GetGDALDriverManager()->GetDriverByName("MEM");
+        if (!poDrv)
+            return;
+        auto poDS = std::unique_ptr<GDALDataset>(
+            poDrv->Create("", 3, 1, 1, GDT_Float32, nullptr));
+        ASSERT_TRUE(poDS != nullptr);
+        auto poBand = poDS->GetRasterBand(1);
+        poBand->SetNoDataValue(-1);
+        float afValues[] = {10, -1, 30};
+        ASSERT_EQ(poBand->RasterIO(GF_Write, 0, 0, 3, 1, afValues, 3, 1,
+                                   GDT_Float32, 0, 0, nullptr),
+                  CE_None);
+        const double adfX[] = {1, 2, 1.5, 0.75};
+        const double adfY[] = {0.5, 0.5, 0.5, 0.5};
+        constexpr int N = static_cast<int>(CPL_ARRAYSIZE(adfX));
+        double adfValues[N];
+        ASSERT_EQ(poBand->SamplePoints(N, adfX, adfY, GRIORA_Bilinear,
+                                       adfValues, GDT_Float64),
+                  CE_None);
+        EXPECT_EQ(adfValues[0], 10);
+        EXPECT_EQ(adfValues[1], 30);
+        EXPECT_EQ(adfValues[2], -1);
+        EXPECT_EQ(adfValues[3], 10);
+    }
+}
+
+// Test GDALRasterBand::ReadWindows()
+TEST_F(test_gdal, ReadWindows)
+{
+    GDALDriver *poGTiffDrv = GetGDALDriverManager()->GetDriverByName("GTiff");
+    if (!poGTiffDrv)
+    {
+        GTEST_SKIP() << "GTiff driver missing";
+    }
+
+    const char *pszFilename = "/vsimem/test_gdal_ReadWindows.tif";
+    {
+        const char *const apszOptions[] = {"TILED=YES", "BLOCKXSIZE=16",
+                                           "BLOCKYSIZE=16", nullptr};
+        auto poDS = std::unique_ptr<GDALDataset>(poGTiffDrv->Create(
+            pszFilename, 40, 36, 1, GDT_UInt16, apszOptions));
+        ASSERT_TRUE(poDS != nullptr);
+        std::vector<GUInt16> anValues(40 * 36);
+        for (size_t i = 0; i < anValues.size(); ++i)
+            anValues[i] = static_cast<GUInt16>(i);
+        ASSERT_EQ(poDS->GetRasterBand(1)->RasterIO(GF_Write, 0, 0, 40, 36,
+                                                   anValues.data(), 40, 36,
+                                                   GDT_UInt16, 0, 0, nullptr),
+                  CE_None);
+    }
+
+    std::vector<int> anWindows;
+    for (int i = 0; i < 100; ++i)
+    {
+        anWindows.push_back((i * 7) % 30);
+        anWindows.push_back((i * 11) % 26);
+        anWindows.push_back(10);
+        anWindows.push_back(10);
+    }
+    const int nWindows = static_cast<int>(anWindows.size() / 4);
+
+    std::vector<GUInt16> anExpected(nWindows * 10 * 10);
+    {
+        auto poDS = std::unique_ptr<GDALDataset>(
+            GDALDataset::Open(pszFilename, GDAL_OF_RASTER));
+        ASSERT_TRUE(poDS != nullptr);
+        EXPECT_FALSE(poDS->IsThreadSafe(GDAL_OF_RASTER));
+        for (int i = 0; i < nWindows; ++i)
+        {
+            ASSERT_EQ(poDS->GetRasterBand(1)->RasterIO(
+                          GF_Read, anWindows[4 * i], anWindows[4 * i + 1], 10,
+                          10, anExpected.data() + i * 10 * 10, 10, 10,
+                          GDT_UInt16, 0, 0, nullptr),
+                      CE_None);
+        }
+    }
+
+    for (const int nOpenFlags :
+         {GDAL_OF_RASTER, GDAL_OF_RASTER | GDAL_OF_THREAD_SAFE})
+    {
+        auto poDS = std::unique_ptr<GDALDataset>(
+            GDALDataset::Open(pszFilename, nOpenFlags));
+        ASSERT_TRUE(poDS != nullptr);
+        EXPECT_EQ(poDS->IsThreadSafe(GDAL_OF_RASTER),
+                  (nOpenFlags & GDAL_OF_THREAD_SAFE) != 0);
+        CPLConfigOptionSetter oSetter("GDAL_NUM_THREADS", "4", false);
+        std::vector<GUInt16> anGot(anExpected.size());
+        ASSERT_EQ(poDS->GetRasterBand(1)->ReadWindows(
+                      nWindows, anWindows.data(), anGot.data(), 10, 10,
+                      GDT_UInt16, 0, 0, 0, GRIORA_NearestNeighbour),
+                  CE_None);
+        EXPECT_EQ(anGot, anExpected) << nOpenFlags;
+
+        // Invalid window
+        const int anInvalidWindows[] = {0, 0, 10, 10, 35, 0, 10, 10};
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        CPLErrorReset();
+        EXPECT_EQ(poDS->GetRasterBand(1)->ReadWindows(
+                      2, anInvalidWindows, anGot.data(), 10, 10, GDT_UInt16, 0,
+                      0, 0, GRIORA_NearestNeighbour),
+                  CE_Failure);
+        EXPECT_EQ(CPLGetLastErrorType(), CE_Failure);
+    }
+
+    VSIUnlink(pszFilename);
+}
+
+// Test GDALRasterBand::GetBlockView()
+TEST_F(test_gdal, GetBlockView)
+{
+    GDALDatasetUniquePtr poDS(GDALDriver::FromHandle(GDALGetDriverByName("MEM"))
+                                  ->Create("", 20, 10, 1, GDT_UInt16, nullptr));
+    auto poBand = poDS->GetRasterBand(1);
+    ASSERT_EQ(poBand->Fill(1234), CE_None);
+
+    {
+        GDALRasterBlockView oView = poBand->GetBlockView(0, 3);
+        ASSERT_TRUE(oView);
+        EXPECT_EQ(oView.GetDataType(), GDT_UInt16);
+        EXPECT_EQ(oView.GetXSize(), 20);
+        EXPECT_EQ(oView.GetYSize(), 1);
+
+        GDALRasterBlockView oViewCopy(oView);
+        oView = GDALRasterBlockView();
+        EXPECT_FALSE(oView);
+        EXPECT_EQ(oView.GetData(), nullptr);
+
+        // The block must still be pinned by the copy
+        ASSERT_TRUE(oViewCopy.GetData() != nullptr);
+        const GUInt16 *panData =
+            static_cast<const GUInt16 *>(oViewCopy.GetData());
+        for (int i = 0; i < 20; ++i)
+        {
+            EXPECT_EQ(panData[i], 1234);
+        }
+    }
+
+    // The block is no longer locked, so that the cache can be flushed
+    EXPECT_EQ(poBand->FlushCache(false), CE_None);
+
+    {
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        EXPECT_FALSE(poBand->GetBlockView(1, 0));
+    }
+}
+
+// Test GDALRasterBand::GetArrowStream()
+TEST_F(test_gdal, RasterBandGetArrowStream)
+{
+    if (GDALGetDriverByName("GTiff") == nullptr)
+    {
+        GTEST_SKIP() << "GTiff driver missing";
+    }
+
+    const char *pszFilename = "/vsimem/test_raster_band_arrow_stream.tif";
+    CPLStringList aosOptions;
+    aosOptions.SetNameValue("TILED", "YES");
+    aosOptions.SetNameValue("BLOCKXSIZE", "16");
+    aosOptions.SetNameValue("BLOCKYSIZE", "16");
+    GDALDatasetUniquePtr poDS(
+        GDALDriver::FromHandle(GDALGetDriverByName("GTiff"))
+            ->Create(pszFilename, 20, 10, 1, GDT_Int16, aosOptions.List()));
+    ASSERT_TRUE(poDS != nullptr);
+    auto poBand = poDS->GetRasterBand(1);
+    std::vector<GInt16> anValues(20 * 10);
+    for (int i = 0; i < 20 * 10; ++i)
+        anValues[i] = static_cast<GInt16>(i);
+    ASSERT_EQ(poBand->RasterIO(GF_Write, 0, 0, 20, 10, anValues.data(), 20, 10,
+                               GDT_Int16, 0, 0, nullptr),
+              CE_None);
+
+    for (const char *pszMaxBlocks : {"1", "2"})
+    {
+        struct ArrowArrayStream stream;
+        CPLStringList aosStreamOptions;
+        aosStreamOptions.SetNameValue("MAX_BLOCKS_IN_BATCH", pszMaxBlocks);
+        ASSERT_TRUE(poBand->GetArrowStream(&stream, aosStreamOptions.List()));
+
+        struct ArrowSchema schema;
+        ASSERT_EQ(stream.get_schema(&stream, &schema), 0);
+        ASSERT_EQ(schema.n_children, 5);
+        EXPECT_STREQ(schema.children[0]->name, "block_x_off");
+        EXPECT_STREQ(schema.children[4]->name, "data");
+        EXPECT_STREQ(schema.children[4]->format, "+w:256");
+        EXPECT_STREQ(schema.children[4]->children[0]->format, "s");
+        schema.release(&schema);
+
+        int nBlocksSeen = 0;
+        while (true)
+        {
+            struct ArrowArray array;
+            ASSERT_EQ(stream.get_next(&stream, &array), 0);
+            if (array.release == nullptr)
+                break;
+            ASSERT_EQ(array.n_children, 5);
+            const auto panXOff =
+                static_cast<const int32_t *>(array.children[0]->buffers[1]);
+            const auto panYOff =
+                static_cast<const int32_t *>(array.children[1]->buffers[1]);
+            const auto panWidth =
+                static_cast<const int32_t *>(array.children[2]->buffers[1]);
+            const auto panHeight =
+                static_cast<const int32_t *>(array.children[3]->buffers[1]);
+            const auto panData = static_cast<const GInt16 *>(
+                array.children[4]->children[0]->buffers[1]);
+            for (int64_t iRow = 0; iRow < array.length; ++iRow)
+            {
+                const int nXOff = panXOff[iRow];
+                EXPECT_EQ(nXOff, nBlocksSeen);
+                EXPECT_EQ(panYOff[iRow], 0);
+                EXPECT_EQ(panWidth[iRow], nXOff == 0 ? 16 : 4);
+                EXPECT_EQ(panHeight[iRow], 10);
+                for (int y = 0; y < panHeight[iRow]; ++y)
+                {
+                    for (int x = 0; x < panWidth[iRow]; ++x)
+                    {
+                        EXPECT_EQ(panData[iRow * 256 + y * 16 + x],
+                                  anValues[y * 20 + nXOff * 16 + x]);
+                    }
+                }
+                ++nBlocksSeen;
+            }
+            array.release(&array);
+        }
+        EXPECT_EQ(nBlocksSeen, 2);
+        stream.release(&stream);
+    }
+
+    {
+        auto poMEMDS = std::unique_ptr<GDALDataset>(
+            GDALDriver::FromHandle(GDALGetDriverByName("MEM"))
+                ->Create("", 1, 1, 1, GDT_CFloat32, nullptr));
+        struct ArrowArrayStream stream;
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        EXPECT_FALSE(
+            poMEMDS->GetRasterBand(1)->GetArrowStream(&stream, nullptr));
+    }
+
+    poDS.reset();
+    VSIUnlink(pszFilename);
+}
+
+// Test GDAL_MAX_TOTAL_THREADS
+TEST_F(test_gdal, GDALCapThreadCount)
+{
+    {
+        CPLConfigOptionSetter oSetter("GDAL_MAX_TOTAL_THREADS", nullptr, false);
+        EXPECT_EQ(GDALCapThreadCount(1000), 1000);
+    }
+    {
+        CPLConfigOptionSetter oSetter("GDAL_MAX_TOTAL_THREADS", "3", false);
+        EXPECT_EQ(GDALGetMaxTotalThreads(), 3);
+        EXPECT_EQ(GDALCapThreadCount(2), 2);
+        EXPECT_EQ(GDALCapThreadCount(1000), 3);
+    }
+    {
+        CPLConfigOptionSetter oSetter("GDAL_MAX_TOTAL_THREADS", "ALL_CPUS",
+                                      false);
+        EXPECT_EQ(GDALGetMaxTotalThreads(), CPLGetNumCPUs());
+    }
+}
+
+// Test GDALGetRuntimeMetrics()
+TEST_F(test_gdal, GDALGetRuntimeMetrics)
+{
+    const auto GetMetrics = []()
+    {
+        char *pszJSON = GDALGetRuntimeMetrics();
+        CPLJSONDocument oDoc;
+        EXPECT_TRUE(oDoc.LoadMemory(pszJSON));
+        CPLFree(pszJSON);
+        return oDoc.GetRoot();
+    };
+    const auto GetDelta = [](const CPLJSONObject &oAfter,
+                             const CPLJSONObject &oBefore, const char *pszPath)
+    { return oAfter.GetLong(pszPath) - oBefore.GetLong(pszPath); };
+
+    const auto oBefore = GetMetrics();
+    EXPECT_GT(oBefore.GetLong("block_cache/max_bytes"), 0);
+    EXPECT_GE(oBefore.GetInteger("block_cache/shard_count"), 1);
+
+    const char *pszFilename = "/vsimem/test_gdal_runtime_metrics.tif";
+    {
+        CPLStringList aosOptions;
+        aosOptions.SetNameValue("TILED", "YES");
+        aosOptions.SetNameValue("BLOCKXSIZE", "16");
+        aosOptions.SetNameValue("BLOCKYSIZE", "16");
+        auto poDS = std::unique_ptr<GDALDataset>(
+            GDALDriver::FromHandle(GDALGetDriverByName("GTiff"))
+                ->Create(pszFilename, 32, 32, 1, GDT_Byte, aosOptions.List()));
+        ASSERT_TRUE(poDS != nullptr);
+        auto poBand = poDS->GetRasterBand(1);
+        ASSERT_EQ(poBand->Fill(1), CE_None);
+        ASSERT_EQ(poDS->FlushCache(false), CE_None);
+
+        auto poBlock = poBand->GetLockedBlockRef(0, 0);
+        ASSERT_TRUE(poBlock != nullptr);
+        poBlock->DropLock();
+
+        const auto oAfter = GetMetrics();
+        EXPECT_GE(GetDelta(oAfter, oBefore, "block_cache/misses"), 4);
+        EXPECT_GE(GetDelta(oAfter, oBefore, "block_cache/hits"), 1);
+        EXPECT_GE(GetDelta(oAfter, oBefore, "block_cache/dirty_block_writes"),
+                  4);
+        bool bFound = false;
+        for (const auto &oDataset : oAfter.GetArray("block_cache/datasets"))
+        {
+            if (oDataset.GetString("description") == pszFilename)
+            {
+                bFound = true;
+                EXPECT_GE(oDataset.GetLong("used_bytes"), 4 * 16 * 16);
+            }
+        }
+        EXPECT_TRUE(bFound);
+
+        EXPECT_TRUE(GDALFlushCacheBlock());
+        EXPECT_GE(GetDelta(GetMetrics(), oAfter, "block_cache/evictions"), 1);
+    }
+
+    {
+        const std::string osVRT =
+            std::string("<VRTDataset rasterXSize=\"32\" rasterYSize=\"32\">"
+                        "<VRTRasterBand dataType=\"Byte\" band=\"1\">"
+                        "<SimpleSource><SourceFilename>") +
+            pszFilename +
+            "</SourceFilename><SourceBand>1</SourceBand></SimpleSource>"
+            "</VRTRasterBand></VRTDataset>";
+        auto poDS = std::unique_ptr<GDALDataset>(
+            GDALDataset::Open(osVRT.c_str(), GDAL_OF_RASTER));
+        ASSERT_TRUE(poDS != nullptr);
+        CPLErrorReset();
+        GDALChecksumImage(poDS->GetRasterBand(1), 0, 0, 32, 32);
+        EXPECT_EQ(CPLGetLastErrorType(), CE_None);
+        EXPECT_GE(GetDelta(GetMetrics(), oBefore, "dataset_pool/misses"), 1);
+    }
+    VSIUnlink(pszFilename);
+
+    {
+        const auto oBeforeJobs = GetMetrics();
+        CPLWorkerThreadPool oPool;
+        ASSERT_TRUE(oPool.Setup(2, nullptr, nullptr));
+        constexpr int JOB_COUNT = 10;
+        for (int i = 0; i < JOB_COUNT; ++i)
+        {
+            ASSERT_TRUE(oPool.SubmitJob([](void *) {}, nullptr));
+        }
+        oPool.WaitCompletion();
+        const auto oAfter = GetMetrics();
+        EXPECT_GE(GetDelta(oAfter, oBeforeJobs, "thread_pool/jobs_submitted"),
+                  JOB_COUNT);
+        EXPECT_GE(GetDelta(oAfter, oBeforeJobs, "thread_pool/jobs_completed"),
+                  JOB_COUNT);
+        EXPECT_GE(GetDelta(oAfter, oBeforeJobs, "thread_pool/job_wait_ns"), 0);
+    }
+}
+
+// Test recycling of block buffers through the block buffer pool
+TEST_F(test_gdal, block_buffer_pool)
+{
+    const auto GetMetric = [](const char *pszPath)
+    {
+        char *pszJSON = GDALGetRuntimeMetrics();
+        CPLJSONDocument oDoc;
+        EXPECT_TRUE(oDoc.LoadMemory(pszJSON));
+        CPLFree(pszJSON);
+        return oDoc.GetRoot().GetLong(pszPath);
+    };
+
+    const char *pszFilename = "/vsimem/test_gdal_block_buffer_pool.tif";
+    {
+        CPLStringList aosOptions;
+        aosOptions.SetNameValue("TILED", "YES");
+        aosOptions.SetNameValue("BLOCKXSIZE", "16");
+        aosOptions.SetNameValue("BLOCKYSIZE", "16");
+        auto poDS = std::unique_ptr<GDALDataset>(
+            GDALDriver::FromHandle(GDALGetDriverByName("GTiff"))
+                ->Create(pszFilename, 32, 32, 1, GDT_UInt16,
+                         aosOptions.List()));
+        ASSERT_TRUE(poDS != nullptr);
+        ASSERT_EQ(poDS->GetRasterBand(1)->Fill(1), CE_None);
+    }
+
+    const auto nHitsBefore = GetMetric("block_cache/buffer_pool_hits");
+    for (int iIter = 0; iIter < 2; ++iIter)
+    {
+        // Closing the dataset releases its 4 block buffers to the pool,
+        // where they are taken from when reopening it.
+        auto poDS = std::unique_ptr<GDALDataset>(
+            GDALDataset::Open(pszFilename, GDAL_OF_RASTER));
+        ASSERT_TRUE(poDS != nullptr);
+        EXPECT_EQ(GDALChecksumImage(poDS->GetRasterBand(1), 0, 0, 32, 32),
+                  GDALChecksumImage(poDS->GetRasterBand(1), 0, 0, 32, 32));
+    }
+    EXPECT_GE(GetMetric("block_cache/buffer_pool_hits") - nHitsBefore, 4);
+    EXPECT_GT(GetMetric("block_cache/buffer_pool_bytes"), 0);
+
+    // Lowering the cache maximum trims the pool
+    const GIntBig nOldCacheMax = GDALGetCacheMax64();
+    GDALSetCacheMax64(0);
+    EXPECT_EQ(GetMetric("block_cache/buffer_pool_bytes"), 0);
+    GDALSetCacheMax64(nOldCacheMax);
+
+    VSIUnlink(pszFilename);
+}
+
+// Test GDALDataset::RasterIOAsync() and background GDALAsyncReader
+TEST_F(test_gdal, RasterIOAsync)
+{
+    const char *pszFilename = "/vsimem/test_gdal_RasterIOAsync.tif";
+    {
+        CPLStringList aosOptions;
+        aosOptions.SetNameValue("TILED", "YES");
+        aosOptions.SetNameValue("BLOCKXSIZE", "16");
+        aosOptions.SetNameValue("BLOCKYSIZE", "16");
+        auto poDS = std::unique_ptr<GDALDataset>(
+            GDALDriver::FromHandle(GDALGetDriverByName("GTiff"))
+                ->Create(pszFilename, 64, 64, 2, GDT_Byte, aosOptions.List()));
+        ASSERT_TRUE(poDS != nullptr);
+        std::vector<GByte> abyData(64 * 64 * 2);
+        for (size_t i = 0; i < abyData.size(); ++i)
+            abyData[i] = static_cast<GByte>(i * 7);
+        ASSERT_EQ(poDS->RasterIO(GF_Write, 0, 0, 64, 64, abyData.data(), 64, 64,
+                                 GDT_Byte, 2, nullptr, 0, 0, 0, nullptr),
+                  CE_None);
+    }
+
+    for (const int nOpenFlags :
+         {GDAL_OF_RASTER, GDAL_OF_RASTER | GDAL_OF_THREAD_SAFE})
+    {
+        auto poDS = std::unique_ptr<GDALDataset>(
+            GDALDataset::Open(pszFilename, nOpenFlags));
+        ASSERT_TRUE(poDS != nullptr);
+
+        std::vector<GByte> abyExpected(64 * 64 * 2);
+        ASSERT_EQ(poDS->RasterIO(GF_Read, 0, 0, 64, 64, abyExpected.data(), 64,
+                                 64, GDT_Byte, 2, nullptr, 0, 0, 0, nullptr),
+                  CE_None);
+
+        // Several requests in flight, one per quarter of the raster
+        {
+            std::vector<GByte> abyGot(64 * 64 * 2);
+            std::vector<std::future<CPLErr>> aoFutures;
+            for (int i = 0; i < 4; ++i)
+            {
+                aoFutures.push_back(poDS->RasterIOAsync(
+                    (i % 2) * 32, (i / 2) * 32, 32, 32,
+                    abyGot.data() + (i / 2) * 32 * 64 + (i % 2) * 32, 32, 32,
+                    GDT_Byte, 2, nullptr, 1, 64, 64 * 64));
+            }
+            for (auto &oFuture : aoFutures)
+                EXPECT_EQ(oFuture.get(), CE_None);
+            EXPECT_EQ(abyGot, abyExpected) << nOpenFlags;
+        }
+
+        // Invalid request
+        {
+            CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+            GByte byDummy = 0;
+            EXPECT_EQ(poDS->RasterIOAsync(60, 0, 10, 1, &byDummy, 1, 1,
+                                          GDT_Byte, 1, nullptr, 0, 0, 0)
+                          .get(),
+                      CE_Failure);
+        }
+
+        // Background async reader, with resampling
+        {
+            std::vector<GByte> abyExpectedResampled(40 * 24 * 2);
+            ASSERT_EQ(poDS->RasterIO(GF_Read, 0, 3, 64, 60,
+                                     abyExpectedResampled.data(), 40, 24,
+                                     GDT_Byte, 2, nullptr, 0, 0, 0, nullptr),
+                      CE_None);
+
+            std::vector<GByte> abyGot(abyExpectedResampled.size());
+            const char *const apszOptions[] = {"BACKGROUND=YES", nullptr};
+            GDALAsyncReader *poReader = poDS->BeginAsyncReader(
+                0, 3, 64, 60, abyGot.data(), 40, 24, GDT_Byte, 2, nullptr, 0, 0,
+                0, const_cast<char **>(apszOptions));
+            ASSERT_TRUE(poReader != nullptr);
+            std::vector<bool> abLineUpdated(24);
+            int nUpdates = 0;
+            GDALAsyncStatusType eStatus;
+            do
+            {
+                int nBufXOff = 0;
+                int nBufYOff = 0;
+                int nBufXSize = 0;
+                int nBufYSize = 0;
+                eStatus = poReader->GetNextUpdatedRegion(
+                    -1, &nBufXOff, &nBufYOff, &nBufXSize, &nBufYSize);
+                ASSERT_NE(eStatus, GARIO_ERROR);
+                ASSERT_NE(eStatus, GARIO_PENDING);
+                EXPECT_EQ(nBufXOff, 0);
+                EXPECT_EQ(nBufXSize, 40);
+                for (int i = nBufYOff; i < nBufYOff + nBufYSize; ++i)
+                {
+                    EXPECT_FALSE(abLineUpdated[i]);
+                    abLineUpdated[i] = true;
+                }
+                ++nUpdates;
+            } while (eStatus != GARIO_COMPLETE);
+            poDS->EndAsyncReader(poReader);
+
+            // One region per row of blocks
+            EXPECT_EQ(nUpdates, 4);
+            EXPECT_EQ(abLineUpdated, std::vector<bool>(24, true));
+            EXPECT_EQ(abyGot, abyExpectedResampled) << nOpenFlags;
+        }
+    }
+
+    VSIUnlink(pszFilename);
+}
+
+// Test writing of dirty blocks by the write-behind thread of the block cache
+TEST_F(test_gdal, block_cache_write_behind)
+{
+    const auto GetWriteBehindWrites = []()
+    {
+        char *pszJSON = GDALGetRuntimeMetrics();
+        CPLJSONDocument oDoc;
+        EXPECT_TRUE(oDoc.LoadMemory(pszJSON));
+        CPLFree(pszJSON);
+        return oDoc.GetRoot().GetLong("block_cache/write_behind_writes");
+    };
+
+    const GIntBig nOldCacheMax = GDALGetCacheMax64();
+    GDALSetCacheMax64(256 * 1024);
+    const auto nWritesBefore = GetWriteBehindWrites();
+
+    const char *pszFilename = "/vsimem/test_gdal_block_cache_write_behind.tif";
+    const auto GetValue = [](int iStrip, int i)
+    { return static_cast<GByte>(iStrip * 13 + i); };
+    {
+        CPLStringList aosOptions;
+        aosOptions.SetNameValue("TILED", "YES");
+        aosOptions.SetNameValue("BLOCKXSIZE", "32");
+        aosOptions.SetNameValue("BLOCKYSIZE", "32");
+        auto poDS = std::unique_ptr<GDALDataset>(
+            GDALDriver::FromHandle(GDALGetDriverByName("GTiff"))
+                ->Create(pszFilename, 512, 512, 1, GDT_Byte,
+                         aosOptions.List()));
+        ASSERT_TRUE(poDS != nullptr);
+        auto poBand = poDS->GetRasterBand(1);
+        std::vector<GByte> abyStrip(512 * 32);
+        bool bWrittenBehind = false;
+        for (int iStrip = 0; iStrip < 16; ++iStrip)
+        {
+            for (size_t i = 0; i < abyStrip.size(); ++i)
+                abyStrip[i] = GetValue(iStrip, static_cast<int>(i));
+            ASSERT_EQ(poBand->RasterIO(GF_Write, 0, iStrip * 32, 512, 32,
+                                       abyStrip.data(), 512, 32, GDT_Byte, 0, 0,
+                                       nullptr),
+                      CE_None);
+            // Once dirty blocks exceed half of the cache, give some time to
+            // the write-behind thread, which only runs between our RasterIO()
+            // calls.
+            for (int i = 0; iStrip >= 8 && !bWrittenBehind && i < 500; ++i)
+            {
+                bWrittenBehind = GetWriteBehindWrites() > nWritesBefore;
+                if (!bWrittenBehind)
+                    CPLSleep(0.01);
+            }
+        }
+        EXPECT_TRUE(bWrittenBehind);
+    }
+
+    {
+        auto poDS = std::unique_ptr<GDALDataset>(
+            GDALDataset::Open(pszFilename, GDAL_OF_RASTER));
+        ASSERT_TRUE(poDS != nullptr);
+        std::vector<GByte> abyStrip(512 * 32);
+        for (int iStrip = 0; iStrip < 16; ++iStrip)
+        {
+            ASSERT_EQ(poDS->GetRasterBand(1)->RasterIO(
+                          GF_Read, 0, iStrip * 32, 512, 32, abyStrip.data(),
+                          512, 32, GDT_Byte, 0, 0, nullptr),
+                      CE_None);
+            for (size_t i = 0; i < abyStrip.size(); ++i)
+            {
+                ASSERT_EQ(abyStrip[i], GetValue(iStrip, static_cast<int>(i)))
+                    << iStrip;
+            }
+        }
+    }
+
+    GDALSetCacheMax64(nOldCacheMax);
+    VSIUnlink(pszFilename);
+}
+
 }  // namespace
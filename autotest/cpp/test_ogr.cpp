@@ -29,6 +29,7 @@
 #include "gdal_unit_test.h"
 
 #include "ogr_p.h"
+#include "ogr_wkb.h"
 #include "ogrsf_frmts.h"
 #include "../../ogr/ogrsf_frmts/osm/gpb.h"
 #include "ogr_recordbatch.h"
@@ -1907,6 +1908,80 @@ TEST_F(test_ogr, OGRLineString_removePoint)
     }
 }
 
+// Test OGRSimpleCurve::setBorrowedPoints()
+TEST_F(test_ogr, OGRLineString_setBorrowedPoints)
+{
+    {
+        const OGRRawPoint aoPoints[] = {{0, 1}, {2, 3}, {4, 5}};
+        OGRLineString ls;
+        ls.addPoint(10, 20, 30);
+        ls.setBorrowedPoints(3, aoPoints);
+        EXPECT_TRUE(ls.hasBorrowedPoints());
+        EXPECT_FALSE(ls.Is3D());
+        ASSERT_EQ(ls.getNumPoints(), 3);
+        EXPECT_EQ(ls.getX(2), 4.0);
+        EXPECT_EQ(ls.getY(2), 5.0);
+        OGREnvelope sEnvelope;
+        ls.getEnvelope(&sEnvelope);
+        EXPECT_EQ(sEnvelope.MaxX, 4.0);
+
+        // Copies own their points
+        std::unique_ptr<OGRLineString> poClone(ls.clone());
+        EXPECT_FALSE(poClone->hasBorrowedPoints());
+        EXPECT_TRUE(poClone->Equals(&ls));
+
+        // Modifications are done on a private copy
+        ls.setPoint(1, 100, 200);
+        EXPECT_FALSE(ls.hasBorrowedPoints());
+        EXPECT_EQ(ls.getX(1), 100.0);
+        EXPECT_EQ(ls.getX(2), 4.0);
+        EXPECT_EQ(aoPoints[1].x, 2.0);
+    }
+    {
+        // With Z, M
+        const OGRRawPoint aoPoints[] = {{0, 1}, {2, 3}};
+        const double adfZ[] = {10, 20};
+        const double adfM[] = {30, 40};
+        OGRLineString ls;
+        ls.setBorrowedPoints(2, aoPoints, adfZ, adfM);
+        EXPECT_TRUE(ls.Is3D());
+        EXPECT_TRUE(ls.IsMeasured());
+        EXPECT_EQ(ls.getZ(1), 20.0);
+        EXPECT_EQ(ls.getM(1), 40.0);
+        ls.addPoint(4, 5, 50, 60);
+        EXPECT_FALSE(ls.hasBorrowedPoints());
+        ASSERT_EQ(ls.getNumPoints(), 3);
+        EXPECT_EQ(ls.getZ(1), 20.0);
+        EXPECT_EQ(ls.getM(2), 60.0);
+    }
+    {
+        const OGRRawPoint aoPoints[] = {{0, 1}, {2, 3}};
+        const double adfZ[] = {10, 20};
+        OGRLineString ls;
+        ls.setBorrowedPoints(2, aoPoints, adfZ);
+        ls.flattenTo2D();
+        EXPECT_TRUE(ls.hasBorrowedPoints());
+        EXPECT_FALSE(ls.Is3D());
+        ls.reversePoints();
+        EXPECT_FALSE(ls.hasBorrowedPoints());
+        EXPECT_EQ(ls.getX(0), 2.0);
+        EXPECT_EQ(aoPoints[0].x, 0.0);
+        ls.empty();
+        EXPECT_EQ(ls.getNumPoints(), 0);
+    }
+    {
+        const OGRRawPoint aoPoints[] = {{0, 0}, {0, 1}, {1, 1}, {0, 0}};
+        OGRPolygon oPoly;
+        auto poRing = std::make_unique<OGRLinearRing>();
+        poRing->setBorrowedPoints(4, aoPoints);
+        oPoly.addRing(std::move(poRing));
+        EXPECT_EQ(oPoly.get_Area(), 0.5);
+        oPoly.swapXY();
+        EXPECT_EQ(aoPoints[1].y, 1.0);
+        EXPECT_EQ(oPoly.getExteriorRing()->getX(1), 1.0);
+    }
+}
+
 // Test effect of MarkSuppressOnClose() on DXF
 TEST_F(test_ogr, DXF_MarkSuppressOnClose)
 {
@@ -2388,6 +2463,65 @@ TEST_F(test_ogr, feature_defn_geomfields_iterator)
     EXPECT_EQ(i, oFDefn.GetGeomFieldCount());
 }
 
+// Test OGRFeatureDefn::GetFieldIndex() / GetGeomFieldIndex() on a definition
+// large enough to use the field name index
+TEST_F(test_ogr, feature_defn_field_index_many_fields)
+{
+    OGRFeatureDefn oFDefn;
+    oFDefn.DeleteGeomFieldDefn(0);
+    constexpr int N = 50;
+    for (int i = 0; i < N; ++i)
+    {
+        OGRFieldDefn oFieldDefn(CPLSPrintf("field%d", i), OFTString);
+        oFDefn.AddFieldDefn(&oFieldDefn);
+        OGRGeomFieldDefn oGeomFieldDefn(CPLSPrintf("geom%d", i), wkbUnknown);
+        oFDefn.AddGeomFieldDefn(&oGeomFieldDefn);
+    }
+    for (int i = 0; i < N; ++i)
+    {
+        EXPECT_EQ(oFDefn.GetFieldIndex(CPLSPrintf("field%d", i)), i);
+        EXPECT_EQ(oFDefn.GetFieldIndex(CPLSPrintf("FIELD%d", i)), i);
+        EXPECT_EQ(oFDefn.GetGeomFieldIndex(CPLSPrintf("GEOM%d", i)), i);
+    }
+    EXPECT_EQ(oFDefn.GetFieldIndex("non_existing"), -1);
+    EXPECT_EQ(oFDefn.GetGeomFieldIndex("non_existing"), -1);
+
+    // Duplicated names: the first occurrence is returned
+    {
+        OGRFieldDefn oFieldDefn("field1", OFTString);
+        oFDefn.AddFieldDefn(&oFieldDefn);
+    }
+    EXPECT_EQ(oFDefn.GetFieldIndex("field1"), 1);
+    EXPECT_EQ(oFDefn.GetFieldIndex(CPLSPrintf("field%d", N - 1)), N - 1);
+
+    EXPECT_EQ(oFDefn.DeleteFieldDefn(0), OGRERR_NONE);
+    EXPECT_EQ(oFDefn.GetFieldIndex("field0"), -1);
+    EXPECT_EQ(oFDefn.GetFieldIndex("field1"), 0);
+    EXPECT_EQ(oFDefn.GetFieldIndex("field2"), 1);
+
+    std::vector<int> anMap(oFDefn.GetFieldCount());
+    for (int i = 0; i < static_cast<int>(anMap.size()); ++i)
+        anMap[i] = static_cast<int>(anMap.size()) - 1 - i;
+    EXPECT_EQ(oFDefn.ReorderFieldDefns(anMap.data()), OGRERR_NONE);
+    EXPECT_EQ(oFDefn.GetFieldIndex("field1"), 0);
+    EXPECT_EQ(oFDefn.GetFieldIndex("field2"), oFDefn.GetFieldCount() - 2);
+
+    // Renaming a field already attached to the definition
+    const int iField = oFDefn.GetFieldIndex("field2");
+    oFDefn.GetFieldDefn(iField)->SetName("renamed");
+    EXPECT_EQ(oFDefn.GetFieldIndex("field2"), -1);
+    EXPECT_EQ(oFDefn.GetFieldIndex("RENAMED"), iField);
+
+    const int iGeomField = oFDefn.GetGeomFieldIndex("geom3");
+    oFDefn.GetGeomFieldDefn(iGeomField)->SetName("renamed_geom");
+    EXPECT_EQ(oFDefn.GetGeomFieldIndex("geom3"), -1);
+    EXPECT_EQ(oFDefn.GetGeomFieldIndex("renamed_geom"), iGeomField);
+
+    EXPECT_EQ(oFDefn.DeleteGeomFieldDefn(0), OGRERR_NONE);
+    EXPECT_EQ(oFDefn.GetGeomFieldIndex("geom0"), -1);
+    EXPECT_EQ(oFDefn.GetGeomFieldIndex("geom1"), 0);
+}
+
 // Test GDALDataset QueryLoggerFunc callback
 TEST_F(test_ogr, GDALDatasetSetQueryLoggerFunc)
 {
@@ -4047,4 +4181,162 @@ TEST_F(test_ogr, OGRGeometry_IsRectangle)
     }
 }
 
+
+// Test OGRLayer::GetNextFeatureInto()
+TEST_F(test_ogr, OGRLayer_GetNextFeatureInto)
+{
+    const auto CheckLayer = [](OGRLayer *poLayer)
+    {
+        std::vector<std::unique_ptr<OGRFeature>> apoRefFeatures;
+        poLayer->ResetReading();
+        for (auto &&poFeature : poLayer)
+            apoRefFeatures.emplace_back(poFeature.release());
+        ASSERT_TRUE(!apoRefFeatures.empty());
+
+        OGRFeature oFeature(poLayer->GetLayerDefn());
+        poLayer->ResetReading();
+        size_t i = 0;
+        while (poLayer->GetNextFeatureInto(oFeature))
+        {
+            ASSERT_LT(i, apoRefFeatures.size());
+            EXPECT_EQ(oFeature.GetFID(), apoRefFeatures[i]->GetFID());
+            EXPECT_TRUE(oFeature.Equal(apoRefFeatures[i].get()));
+            ++i;
+        }
+        EXPECT_EQ(i, apoRefFeatures.size());
+        EXPECT_EQ(oFeature.GetFID(), OGRNullFID);
+
+        // With an attribute filter that rejects the first feature
+        const std::string osFilter(
+            CPLSPrintf("FID <> " CPL_FRMT_GIB, apoRefFeatures[0]->GetFID()));
+        ASSERT_EQ(poLayer->SetAttributeFilter(osFilter.c_str()), OGRERR_NONE);
+        poLayer->ResetReading();
+        i = 1;
+        while (OGR_L_GetNextFeatureInto(OGRLayer::ToHandle(poLayer),
+                                        OGRFeature::ToHandle(&oFeature)))
+        {
+            ASSERT_LT(i, apoRefFeatures.size());
+            EXPECT_TRUE(oFeature.Equal(apoRefFeatures[i].get()));
+            ++i;
+        }
+        EXPECT_EQ(i, apoRefFeatures.size());
+        poLayer->SetAttributeFilter(nullptr);
+
+        // Feature with a different definition
+        OGRFeatureDefn *poOtherDefn = new OGRFeatureDefn("other");
+        poOtherDefn->Reference();
+        {
+            OGRFeature oOtherFeature(poOtherDefn);
+            poLayer->ResetReading();
+            CPLErrorHandlerPusher oErrorHandler(CPLQuietErrorHandler);
+            EXPECT_FALSE(poLayer->GetNextFeatureInto(oOtherFeature));
+        }
+        poOtherDefn->Release();
+    };
+
+    // Driver-specific implementation
+    {
+        std::string file(data_ + SEP + "poly.shp");
+        GDALDatasetUniquePtr poDS(
+            GDALDataset::Open(file.c_str(), GDAL_OF_VECTOR));
+        ASSERT_TRUE(poDS != nullptr);
+        CheckLayer(poDS->GetLayer(0));
+    }
+
+    if (GetGDALDriverManager()->GetDriverByName("GPKG"))
+    {
+        std::string file(data_ + SEP + "poly-1-feature.gpkg");
+        GDALDatasetUniquePtr poDS(
+            GDALDataset::Open(file.c_str(), GDAL_OF_VECTOR));
+        ASSERT_TRUE(poDS != nullptr);
+        CheckLayer(poDS->GetLayer(0));
+    }
+
+    // Default implementation
+    {
+        auto poDrv = GetGDALDriverManager()->GetDriverByName("Memory");
+        ASSERT_NE(poDrv, nullptr);
+        GDALDatasetUniquePtr poDS(
+            poDrv->Create("", 0, 0, 0, GDT_Unknown, nullptr));
+        auto poLayer = poDS->CreateLayer("test", nullptr, wkbPoint);
+        ASSERT_NE(poLayer, nullptr);
+        OGRFieldDefn oFieldDefn("str", OFTString);
+        ASSERT_EQ(poLayer->CreateField(&oFieldDefn), OGRERR_NONE);
+        for (int i = 0; i < 3; ++i)
+        {
+            OGRFeature oFeature(poLayer->GetLayerDefn());
+            oFeature.SetField(0, CPLSPrintf("value%d", i));
+            oFeature.SetGeometryDirectly(new OGRPoint(i, i));
+            ASSERT_EQ(poLayer->CreateFeature(&oFeature), OGRERR_NONE);
+        }
+        CheckLayer(poLayer);
+    }
+}
+
+// Test OGRSimpleCurve::getEnvelope() and OGRWKBGetBoundingBox()
+TEST_F(test_ogr, OGRSimpleCurve_getEnvelope)
+{
+    for (int nPoints = 1; nPoints < 10; ++nPoints)
+    {
+        for (const bool bIs3D : {false, true})
+        {
+            OGRLineString oLS;
+            OGREnvelope3D sExpected;
+            for (int i = 0; i < nPoints; ++i)
+            {
+                const double dfX = (i * 37) % 11 - 5;
+                const double dfY = (i * 13) % 7 + 100;
+                const double dfZ = -i;
+                if (bIs3D)
+                    oLS.addPoint(dfX, dfY, dfZ);
+                else
+                    oLS.addPoint(dfX, dfY);
+                sExpected.Merge(dfX, dfY, bIs3D ? dfZ : 0);
+            }
+
+            OGREnvelope3D sEnvelope;
+            oLS.getEnvelope(&sEnvelope);
+            EXPECT_EQ(sEnvelope.MinX, sExpected.MinX);
+            EXPECT_EQ(sEnvelope.MinY, sExpected.MinY);
+            EXPECT_EQ(sEnvelope.MaxX, sExpected.MaxX);
+            EXPECT_EQ(sEnvelope.MaxY, sExpected.MaxY);
+            EXPECT_EQ(sEnvelope.MinZ, sExpected.MinZ);
+            EXPECT_EQ(sEnvelope.MaxZ, sExpected.MaxZ);
+
+            for (const auto eByteOrder : {wkbNDR, wkbXDR})
+            {
+                std::vector<GByte> abyWKB(oLS.WkbSize());
+                static_cast<const OGRGeometry &>(oLS).exportToWkb(
+                    eByteOrder, abyWKB.data(), wkbVariantIso);
+                OGREnvelope3D sWKBEnvelope;
+                EXPECT_TRUE(OGRWKBGetBoundingBox(abyWKB.data(), abyWKB.size(),
+                                                 sWKBEnvelope));
+                EXPECT_EQ(sWKBEnvelope.MinX, sExpected.MinX);
+                EXPECT_EQ(sWKBEnvelope.MinY, sExpected.MinY);
+                EXPECT_EQ(sWKBEnvelope.MaxX, sExpected.MaxX);
+                EXPECT_EQ(sWKBEnvelope.MaxY, sExpected.MaxY);
+                if (bIs3D)
+                {
+                    EXPECT_EQ(sWKBEnvelope.MinZ, sExpected.MinZ);
+                    EXPECT_EQ(sWKBEnvelope.MaxZ, sExpected.MaxZ);
+                }
+            }
+        }
+    }
+
+    // NaN coordinates after the first point are ignored
+    {
+        OGRLineString oLS;
+        oLS.addPoint(1, 2);
+        oLS.addPoint(std::numeric_limits<double>::quiet_NaN(), 3);
+        oLS.addPoint(0, std::numeric_limits<double>::quiet_NaN());
+        OGREnvelope sEnvelope;
+        oLS.getEnvelope(&sEnvelope);
+        EXPECT_EQ(sEnvelope.MinX, 0);
+        EXPECT_EQ(sEnvelope.MinY, 2);
+        EXPECT_EQ(sEnvelope.MaxX, 1);
+        EXPECT_EQ(sEnvelope.MaxY, 3);
+    }
+}
+
 }  // namespace
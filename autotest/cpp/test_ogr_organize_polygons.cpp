@@ -268,3 +268,53 @@ TEST_P(OrganizePolygonsTest, CrossingCCWPolygons)
                 "((5 5, 15 5, 15 15, 5 15, 5 5)))"));
     ASSERT_TRUE(result->Equals(expected.get()));
 }
+
+TEST_P(OrganizePolygonsTest, ManyHolesInSeveralOuterRings)
+{
+    // Enough parts to go through the spatial index of envelopes
+    std::vector<OGRGeometry *> polygons;
+    polygons.push_back(
+        readWKT("POLYGON ((0 0, 0 100, 100 100, 100 0, 0 0))"));  // CW
+    polygons.push_back(
+        readWKT("POLYGON ((200 0, 200 100, 300 100, 300 0, 200 0))"));  // CW
+    for (int iOuter = 0; iOuter < 2; ++iOuter)
+    {
+        for (int a = 0; a < 5; ++a)
+        {
+            for (int b = 0; b < 5; ++b)
+            {
+                const int x = iOuter * 200 + 10 + 20 * a;
+                const int y = 10 + 20 * b;
+                polygons.push_back(readWKT(CPLSPrintf(
+                    "POLYGON ((%d %d, %d %d, %d %d, %d %d, %d %d))", x, y,
+                    x + 10, y, x + 10, y + 10, x, y + 10, x, y)));  // CCW
+            }
+        }
+    }
+    // CW island in the first hole
+    polygons.push_back(
+        readWKT("POLYGON ((12 12, 12 13, 13 13, 13 12, 12 12))"));
+
+    const auto &method = GetParam();
+    auto result = organizePolygons(polygons, method);
+
+    ASSERT_NE(result, nullptr);
+    ASSERT_EQ(result->getGeometryType(), wkbMultiPolygon);
+    const auto poMP = result->toMultiPolygon();
+    if (method == "SKIP")
+    {
+        ASSERT_EQ(poMP->getNumGeometries(), 2 + 2 * 25 + 1);
+    }
+    else
+    {
+        ASSERT_EQ(poMP->getNumGeometries(), 3);
+        EXPECT_EQ(poMP->getGeometryRef(0)->getNumInteriorRings(), 25);
+        EXPECT_EQ(poMP->getGeometryRef(1)->getNumInteriorRings(), 25);
+        EXPECT_EQ(poMP->getGeometryRef(2)->getNumInteriorRings(), 0);
+        OGREnvelope sEnvelope;
+        poMP->getGeometryRef(1)->getInteriorRing(0)->getEnvelope(&sEnvelope);
+        EXPECT_GE(sEnvelope.MinX, 200);
+        poMP->getGeometryRef(2)->getEnvelope(&sEnvelope);
+        EXPECT_EQ(sEnvelope.MinX, 12);
+    }
+}
@@ -226,6 +226,17 @@ TEST_F(test_ogr_swq, select_unparse)
         EXPECT_STREQ(ret, pszSQL);
         CPLFree(ret);
     }
+    {
+        swq_select select;
+        const char *pszSQL = "SELECT a, \"a b\", COUNT(c) FROM FOO "
+                             "WHERE \"group\" = 1 GROUP BY a, \"a b\" "
+                             "ORDER BY a";
+        EXPECT_EQ(select.preparse(pszSQL), CE_None);
+        EXPECT_EQ(select.group_specs, 2);
+        char *ret = select.Unparse();
+        EXPECT_STREQ(ret, pszSQL);
+        CPLFree(ret);
+    }
 }
 
 }  // namespace
@@ -524,4 +524,236 @@ INSTANTIATE_TEST_SUITE_P(
         OGRWKBIntersectsPessimisticFixture::ParamType> &l_info)
     { return std::get<6>(l_info.param); });
 
+class OGRWKBIntersectsEnvelopeFixture
+    : public test_ogr_wkb,
+      public ::testing::WithParamInterface<std::tuple<
+          const char *, double, double, double, double, bool, const char *>>
+{
+  public:
+    static std::vector<std::tuple<const char *, double, double, double, double,
+                                  bool, const char *>>
+    GetTupleValues()
+    {
+        return {
+            std::make_tuple("POINT(1 2)", 0.9, 1.9, 1.1, 2.1, true, "POINT_IN"),
+            std::make_tuple("POINT(1 2)", 1.05, 1.9, 1.1, 2.1, false,
+                            "POINT_OUT"),
+            std::make_tuple("POINT(1 2)", 1, 2, 1.1, 2.1, true,
+                            "POINT_TOUCHES"),
+            std::make_tuple("POINT EMPTY", 0.9, 1.9, 1.1, 2.1, false,
+                            "POINT_EMPTY"),
+            std::make_tuple("LINESTRING(0 0,10 10)", 4, 4.5, 5, 5.5, true,
+                            "LINESTRING_CROSSES"),
+            std::make_tuple("LINESTRING(0 0,10 10)", 4, 5.5, 5, 6.5, false,
+                            "LINESTRING_OUT"),
+            std::make_tuple("LINESTRING(0 0,10 10)", 5, 5, 6, 5, true,
+                            "LINESTRING_TOUCHES"),
+            std::make_tuple("LINESTRING Z (0 0 1,10 10 1)", 4, 4.5, 5, 5.5,
+                            true, "LINESTRINGZ_CROSSES"),
+            std::make_tuple("LINESTRING EMPTY", 0.9, 1.9, 1.1, 2.1, false,
+                            "LINESTRING_EMPTY"),
+            std::make_tuple("POLYGON((0 0,0 10,10 10,10 0,0 0))", 4, 4, 5, 5,
+                            true, "POLYGON_ENVELOPE_INSIDE"),
+            std::make_tuple("POLYGON((0 0,0 10,10 10,10 0,0 0))", -1, -1, 11,
+                            11, true, "POLYGON_INSIDE_ENVELOPE"),
+            std::make_tuple("POLYGON((0 0,0 10,10 10,0 0))", 6, 1, 9, 4, false,
+                            "POLYGON_OUT_IN_BBOX"),
+            std::make_tuple("POLYGON((0 0,0 10,10 10,10 0,0 0),"
+                            "(2 2,2 8,8 8,8 2,2 2))",
+                            4, 4, 5, 5, false, "POLYGON_ENVELOPE_IN_HOLE"),
+            std::make_tuple("POLYGON((0 0,0 10,10 10,10 0,0 0),"
+                            "(2 2,2 8,8 8,8 2,2 2))",
+                            1, 1, 5, 5, true, "POLYGON_ENVELOPE_CROSSES_HOLE"),
+            std::make_tuple("POLYGON EMPTY", 0.9, 1.9, 1.1, 2.1, false,
+                            "POLYGON_EMPTY"),
+            std::make_tuple("MULTIPOLYGON(((0 0,0 10,10 10,0 0)),"
+                            "((20 0,20 10,30 10,20 0)))",
+                            22, 5, 23, 6, true, "MULTIPOLYGON_IN"),
+            std::make_tuple("MULTIPOLYGON(((0 0,0 10,10 10,0 0)),"
+                            "((20 0,20 10,30 10,20 0)))",
+                            26, 1, 29, 4, false, "MULTIPOLYGON_OUT"),
+            std::make_tuple("GEOMETRYCOLLECTION(POINT(100 100),"
+                            "LINESTRING(0 0,10 10))",
+                            4, 4.5, 5, 5.5, true, "GEOMETRYCOLLECTION_IN"),
+            std::make_tuple("TIN(((0 0,0 10,10 10,0 0)))", 6, 1, 9, 4, false,
+                            "TIN_OUT"),
+        };
+    }
+};
+
+TEST_P(OGRWKBIntersectsEnvelopeFixture, test)
+{
+    const char *pszInput = std::get<0>(GetParam());
+    OGREnvelope sEnvelope;
+    sEnvelope.MinX = std::get<1>(GetParam());
+    sEnvelope.MinY = std::get<2>(GetParam());
+    sEnvelope.MaxX = std::get<3>(GetParam());
+    sEnvelope.MaxY = std::get<4>(GetParam());
+    const bool bExpected = std::get<5>(GetParam());
+
+    OGRGeometry *poGeom = nullptr;
+    EXPECT_EQ(OGRGeometryFactory::createFromWkt(pszInput, nullptr, &poGeom),
+              OGRERR_NONE);
+    ASSERT_TRUE(poGeom != nullptr);
+    std::vector<GByte> abyWkb(poGeom->WkbSize());
+    poGeom->exportToWkb(wkbNDR, abyWkb.data(), wkbVariantIso);
+    delete poGeom;
+
+    bool bIntersects = !bExpected;
+    ASSERT_TRUE(OGRWKBIntersectsEnvelope(abyWkb.data(), abyWkb.size(),
+                                         sEnvelope, bIntersects));
+    EXPECT_EQ(bIntersects, bExpected);
+
+    // Truncated WKB
+    EXPECT_FALSE(OGRWKBIntersectsEnvelope(abyWkb.data(), abyWkb.size() - 1,
+                                          sEnvelope, bIntersects));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    test_ogr_wkb, OGRWKBIntersectsEnvelopeFixture,
+    ::testing::ValuesIn(OGRWKBIntersectsEnvelopeFixture::GetTupleValues()),
+    [](const ::testing::TestParamInfo<
+        OGRWKBIntersectsEnvelopeFixture::ParamType> &l_info)
+    { return std::get<6>(l_info.param); });
+
+static std::vector<GByte> WKBFromWKT(const char *pszWKT)
+{
+    OGRGeometry *poGeom = nullptr;
+    OGRGeometryFactory::createFromWkt(pszWKT, nullptr, &poGeom);
+    std::vector<GByte> abyWkb;
+    if (poGeom)
+    {
+        abyWkb.resize(poGeom->WkbSize());
+        poGeom->exportToWkb(wkbXDR, abyWkb.data(), wkbVariantIso);
+        delete poGeom;
+    }
+    return abyWkb;
+}
+
+// Test OGRWKBIntersectsPoint()
+TEST_F(test_ogr_wkb, OGRWKBIntersectsPoint)
+{
+    bool bIntersects = false;
+    {
+        const auto abyWkb = WKBFromWKT("POLYGON((0 0,0 10,10 10,10 0,0 0),"
+                                       "(2 2,2 8,8 8,8 2,2 2))");
+        EXPECT_TRUE(OGRWKBIntersectsPoint(abyWkb.data(), abyWkb.size(), 1, 1,
+                                          bIntersects));
+        EXPECT_TRUE(bIntersects);
+        EXPECT_TRUE(OGRWKBIntersectsPoint(abyWkb.data(), abyWkb.size(), 5, 5,
+                                          bIntersects));
+        EXPECT_FALSE(bIntersects);
+        EXPECT_TRUE(OGRWKBIntersectsPoint(abyWkb.data(), abyWkb.size(), 0, 5,
+                                          bIntersects));
+        EXPECT_TRUE(bIntersects);
+        EXPECT_TRUE(OGRWKBIntersectsPoint(abyWkb.data(), abyWkb.size(), 2, 5,
+                                          bIntersects));
+        EXPECT_TRUE(bIntersects);
+        EXPECT_TRUE(OGRWKBIntersectsPoint(abyWkb.data(), abyWkb.size(), 11, 5,
+                                          bIntersects));
+        EXPECT_FALSE(bIntersects);
+    }
+    {
+        const auto abyWkb = WKBFromWKT("LINESTRING(0 0,10 10)");
+        EXPECT_TRUE(OGRWKBIntersectsPoint(abyWkb.data(), abyWkb.size(), 5, 5,
+                                          bIntersects));
+        EXPECT_TRUE(bIntersects);
+        EXPECT_TRUE(OGRWKBIntersectsPoint(abyWkb.data(), abyWkb.size(), 5, 6,
+                                          bIntersects));
+        EXPECT_FALSE(bIntersects);
+    }
+    {
+        const auto abyWkb = WKBFromWKT("CURVEPOLYGON((0 0,0 10,10 10,0 0))");
+        EXPECT_FALSE(OGRWKBIntersectsPoint(abyWkb.data(), abyWkb.size(), 1, 5,
+                                           bIntersects));
+    }
+}
+
+// Test OGRWKBGetDistanceToPoint()
+TEST_F(test_ogr_wkb, OGRWKBGetDistanceToPoint)
+{
+    double dfDistance = -1;
+    {
+        const auto abyWkb = WKBFromWKT("POINT(3 4)");
+        EXPECT_TRUE(OGRWKBGetDistanceToPoint(abyWkb.data(), abyWkb.size(), 0,
+                                             0, dfDistance));
+        EXPECT_EQ(dfDistance, 5);
+    }
+    {
+        const auto abyWkb = WKBFromWKT("LINESTRING(0 0,10 0)");
+        EXPECT_TRUE(OGRWKBGetDistanceToPoint(abyWkb.data(), abyWkb.size(), 5,
+                                             2, dfDistance));
+        EXPECT_EQ(dfDistance, 2);
+        EXPECT_TRUE(OGRWKBGetDistanceToPoint(abyWkb.data(), abyWkb.size(), 13,
+                                             4, dfDistance));
+        EXPECT_EQ(dfDistance, 5);
+    }
+    {
+        const auto abyWkb = WKBFromWKT("POLYGON((0 0,0 10,10 10,10 0,0 0))");
+        EXPECT_TRUE(OGRWKBGetDistanceToPoint(abyWkb.data(), abyWkb.size(), 5,
+                                             5, dfDistance));
+        EXPECT_EQ(dfDistance, 0);
+        EXPECT_TRUE(OGRWKBGetDistanceToPoint(abyWkb.data(), abyWkb.size(), 12,
+                                             5, dfDistance));
+        EXPECT_EQ(dfDistance, 2);
+    }
+    {
+        const auto abyWkb = WKBFromWKT("GEOMETRYCOLLECTION EMPTY");
+        EXPECT_FALSE(OGRWKBGetDistanceToPoint(abyWkb.data(), abyWkb.size(), 0,
+                                              0, dfDistance));
+    }
+}
+
+// Test OGRWKBGetLength() and OGRWKBGetArea() against OGRGeometry
+TEST_F(test_ogr_wkb, OGRWKBGetLength_OGRWKBGetArea)
+{
+    for (const char *pszWKT :
+         {"POINT(1 2)", "LINESTRING(0 0,3 4,3 5)",
+          "LINESTRING(0 0,0 1,1 1,0 0)", "LINESTRING Z (0 0 0,0 1 2,1 1 3)",
+          "POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,2 8,8 8,8 2,2 2))",
+          "MULTILINESTRING((0 0,1 1),(2 2,4 4))",
+          "MULTIPOLYGON(((0 0,0 1,1 1,0 0)),((2 2,2 3,3 3,2 2)))",
+          "GEOMETRYCOLLECTION(LINESTRING(0 0,1 0),POLYGON((0 0,0 1,1 1,0 0)))",
+          "MULTILINESTRING((0 0,0 1,1 1,0 0))",
+          "GEOMETRYCOLLECTION(MULTILINESTRING((0 0,0 1,1 1,0 0)),"
+          "MULTIPOLYGON(((0 0,0 1,1 1,0 0))))",
+          "GEOMETRYCOLLECTION EMPTY"})
+    {
+        OGRGeometry *poGeom = nullptr;
+        ASSERT_EQ(OGRGeometryFactory::createFromWkt(pszWKT, nullptr, &poGeom),
+                  OGRERR_NONE);
+        std::vector<GByte> abyWkb(poGeom->WkbSize());
+        poGeom->exportToWkb(wkbNDR, abyWkb.data(), wkbVariantIso);
+
+        // OGR_G_Length() and OGR_G_Area() warn on unsupported types
+        CPLErrorHandlerPusher oErrorHandler(CPLQuietErrorHandler);
+
+        double dfLength = -1;
+        EXPECT_TRUE(OGRWKBGetLength(abyWkb.data(), abyWkb.size(), dfLength))
+            << pszWKT;
+        EXPECT_NEAR(dfLength, OGR_G_Length(OGRGeometry::ToHandle(poGeom)),
+                    1e-10)
+            << pszWKT;
+
+        double dfArea = -1;
+        EXPECT_TRUE(OGRWKBGetArea(abyWkb.data(), abyWkb.size(), dfArea))
+            << pszWKT;
+        EXPECT_NEAR(dfArea, OGR_G_Area(OGRGeometry::ToHandle(poGeom)), 1e-10)
+            << pszWKT;
+
+        delete poGeom;
+    }
+
+    {
+        const auto abyWkb = WKBFromWKT("CIRCULARSTRING(0 0,1 1,2 0)");
+        double dfLength = 0;
+        EXPECT_FALSE(OGRWKBGetLength(abyWkb.data(), abyWkb.size(), dfLength));
+    }
+    {
+        const auto abyWkb = WKBFromWKT("TIN(((0 0,0 1,1 1,0 0)))");
+        double dfArea = 0;
+        EXPECT_FALSE(OGRWKBGetArea(abyWkb.data(), abyWkb.size(), dfArea));
+    }
+}
+
 }  // namespace
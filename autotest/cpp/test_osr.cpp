@@ -34,7 +34,9 @@
 
 #include <algorithm>
 #include <cmath>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "gtest_include.h"
 
@@ -641,4 +643,98 @@ TEST_F(test_osr, exportToPanorama)
         EXPECT_NEAR(adfParams[6], 0, EPS);           //false_northing
     }
 }
+// Test OGRCoordinateTransformation::TransformParallel()
+TEST_F(test_osr, TransformParallel)
+{
+    OGRSpatialReference oSrcSRS;
+    oSrcSRS.importFromEPSG(4326);
+    oSrcSRS.SetAxisMappingStrategy(OAMS_TRADITIONAL_GIS_ORDER);
+    OGRSpatialReference oDstSRS;
+    oDstSRS.importFromEPSG(32631);
+    std::unique_ptr<OGRCoordinateTransformation> poCT(
+        OGRCreateCoordinateTransformation(&oSrcSRS, &oDstSRS));
+    ASSERT_TRUE(poCT != nullptr);
+
+    constexpr size_t N = 100 * 1000;
+    std::vector<double> adfX(N), adfY(N), adfZ(N);
+    for (size_t i = 0; i < N; ++i)
+    {
+        adfX[i] = static_cast<double>(i % 1000) / 1000.0 * 6;
+        adfY[i] = static_cast<double>(i / 1000) / 100.0 * 80;
+        adfZ[i] = static_cast<double>(i);
+    }
+    // Put an invalid point close to the end, so it lands in a worker chunk
+    adfY[N - 2] = 1000;
+
+    std::vector<double> adfXRef(adfX), adfYRef(adfY), adfZRef(adfZ);
+    std::vector<int> anErrorCodesRef(N);
+    {
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        EXPECT_TRUE(poCT->TransformWithErrorCodes(N, adfXRef.data(),
+                                                  adfYRef.data(),
+                                                  adfZRef.data(), nullptr,
+                                                  anErrorCodesRef.data()));
+    }
+
+    for (int nThreads : {1, 4})
+    {
+        std::vector<double> adfXPar(adfX), adfYPar(adfY), adfZPar(adfZ);
+        std::vector<int> anErrorCodesPar(N);
+        {
+            CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+            EXPECT_TRUE(poCT->TransformParallel(
+                N, adfXPar.data(), adfYPar.data(), adfZPar.data(), nullptr,
+                anErrorCodesPar.data(), nThreads));
+        }
+        EXPECT_EQ(adfXPar, adfXRef);
+        EXPECT_EQ(adfYPar, adfYRef);
+        EXPECT_EQ(adfZPar, adfZRef);
+        EXPECT_EQ(anErrorCodesPar, anErrorCodesRef);
+        EXPECT_NE(anErrorCodesPar[N - 2], 0);
+    }
+}
+
+// Test the cache of coordinate transformations
+TEST_F(test_osr, OCTGetCacheStatistics)
+{
+    OGRSpatialReference oSrcSRS;
+    oSrcSRS.importFromEPSG(4326);
+    OGRSpatialReference oDstSRS;
+    oDstSRS.importFromEPSG(32631);
+
+    GIntBig nHitsBefore = 0;
+    GIntBig nMissesBefore = 0;
+    OCTGetCacheStatistics(&nHitsBefore, &nMissesBefore);
+
+    std::unique_ptr<OGRCoordinateTransformation> poCT1(
+        OGRCreateCoordinateTransformation(&oSrcSRS, &oDstSRS));
+    ASSERT_TRUE(poCT1 != nullptr);
+    std::unique_ptr<OGRCoordinateTransformation> poCT2(
+        OGRCreateCoordinateTransformation(&oSrcSRS, &oDstSRS));
+    ASSERT_TRUE(poCT2 != nullptr);
+    EXPECT_NE(poCT1.get(), poCT2.get());
+
+    // A different coordinate epoch must not match the cached entry
+    OGRSpatialReference oSrcSRSWithEpoch(oSrcSRS);
+    oSrcSRSWithEpoch.SetCoordinateEpoch(2020.0);
+    std::unique_ptr<OGRCoordinateTransformation> poCT3(
+        OGRCreateCoordinateTransformation(&oSrcSRSWithEpoch, &oDstSRS));
+    ASSERT_TRUE(poCT3 != nullptr);
+
+    GIntBig nHits = 0;
+    GIntBig nMisses = 0;
+    OCTGetCacheStatistics(&nHits, &nMisses);
+    EXPECT_GE(nHits - nHitsBefore, 1);
+    EXPECT_GE(nMisses - nMissesBefore, 1);
+    EXPECT_EQ((nHits - nHitsBefore) + (nMisses - nMissesBefore), 3);
+
+    double x = 3.0;
+    double y = 49.0;
+    double x2 = 3.0;
+    double y2 = 49.0;
+    EXPECT_TRUE(poCT1->Transform(1, &x, &y));
+    EXPECT_TRUE(poCT2->Transform(1, &x2, &y2));
+    EXPECT_EQ(x, x2);
+    EXPECT_EQ(y, y2);
+}
 }  // namespace
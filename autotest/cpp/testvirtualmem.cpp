@@ -251,6 +251,7 @@ TEST(testvitualmem, test)
         CPLVirtualMem *psMem = CPLVirtualMemFileMapNew(
             fp, 0, nSize, VIRTUALMEM_READONLY, nullptr, nullptr);
         ASSERT_TRUE(psMem != nullptr);
+        EXPECT_TRUE(CPLVirtualMemAdviseRandomAccess(psMem));
         void *pMemBuf = CPLVirtualMemGetAddr(psMem);
         ASSERT_TRUE(memcmp(pRefBuf, pMemBuf, nSize) == 0);
         CPLFree(pRefBuf);
@@ -1922,3 +1922,25 @@ def test_cog_stats(tmp_vsimem, nbands, co, src_has_stats, expected_val):
     if expected_val and ds.RasterCount == 2:
         assert ds.GetRasterBand(2).GetMetadataItem("STATISTICS_MINIMUM") == "255"
     ds = None
+
+
+###############################################################################
+# Test writing to a file system that only supports sequential writing
+
+
+def test_cog_sequential_write_only_file_system(tmp_vsimem):
+
+    filename = "/vsigzip/" + str(tmp_vsimem / "out.tif.gz")
+    src_ds = gdal.Translate("", "data/byte.tif", options="-of MEM -outsize 1024 0")
+    ds = gdal.GetDriverByName("COG").CreateCopy(
+        filename, src_ds, options=["BLOCKSIZE=256"]
+    )
+    assert ds is not None
+    assert ds.GetMetadataItem("LAYOUT", "IMAGE_STRUCTURE") == "COG"
+    ds = None
+
+    ds = gdal.Open(filename)
+    assert ds.GetRasterBand(1).Checksum() == src_ds.GetRasterBand(1).Checksum()
+    assert ds.GetRasterBand(1).GetOverviewCount() == 2
+    ds = None
+    _check_cog(filename)
@@ -905,3 +905,119 @@ def test_stats_mask_band():
     assert src_ds.GetRasterBand(1).ComputeRasterMinMax(False) == (2, 3)
     assert src_ds.GetRasterBand(1).ComputeStatistics(False) == [2, 3, 2.5, 0.5]
     assert src_ds.GetRasterBand(1).GetHistogram(False) == [0, 0, 1, 1] + ([0] * 252)
+
+
+###############################################################################
+# Test multithreaded computation of statistics and min/max
+
+
+@pytest.mark.parametrize(
+    "datatype,struct_frmt",
+    [
+        (gdal.GDT_Byte, "B"),
+        (gdal.GDT_UInt16, "H"),
+        (gdal.GDT_Int16, "h"),
+        (gdal.GDT_Float32, "f"),
+        (gdal.GDT_Float64, "d"),
+    ],
+)
+@pytest.mark.parametrize("nodata_or_mask", [None, "nodata", "mask"])
+def test_stats_num_threads(datatype, struct_frmt, nodata_or_mask):
+
+    width = 37
+    height = 53
+    src_ds = gdal.GetDriverByName("MEM").Create("", width, height, 1, datatype)
+    values = [(i * 7919) % 251 for i in range(width * height)]
+    src_ds.WriteRaster(
+        0, 0, width, height, struct.pack(struct_frmt * len(values), *values)
+    )
+    band = src_ds.GetRasterBand(1)
+    if nodata_or_mask == "nodata":
+        band.SetNoDataValue(values[0])
+    elif nodata_or_mask == "mask":
+        src_ds.CreateMaskBand(gdal.GMF_PER_DATASET)
+        band.GetMaskBand().WriteRaster(
+            0,
+            0,
+            width,
+            height,
+            struct.pack(
+                "B" * len(values), *[255 if (i % 5) else 0 for i in range(len(values))]
+            ),
+        )
+
+    ref_stats = band.ComputeStatistics(False)
+    ref_minmax = band.ComputeRasterMinMax(False)
+
+    all_stats = []
+    for num_threads in ("2", "3", "8"):
+        with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+            stats = band.ComputeStatistics(False)
+            assert band.ComputeRasterMinMax(False) == ref_minmax
+        assert stats[0] == ref_stats[0]
+        assert stats[1] == ref_stats[1]
+        assert stats[2] == pytest.approx(ref_stats[2], rel=1e-12)
+        assert stats[3] == pytest.approx(ref_stats[3], rel=1e-12)
+        all_stats.append(stats)
+
+    # The result does not depend on the number of threads
+    assert all_stats[0] == all_stats[1] == all_stats[2]
+
+
+###############################################################################
+# Test GDAL_STATS_BLOCK_SUMMARIES
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_stats_block_summaries(num_threads):
+
+    width = 40
+    height = 30
+    ds = gdal.GetDriverByName("MEM").Create("", width, height, 2, gdal.GDT_Float32)
+    values = [(i * 7919) % 251 for i in range(width * height)]
+    ds.WriteRaster(
+        0, 0, width, height, struct.pack("f" * len(values), *values), band_list=[1]
+    )
+    band = ds.GetRasterBand(1)
+
+    def check():
+        with gdal.config_options(
+            {"GDAL_STATS_BLOCK_SUMMARIES": "YES", "GDAL_NUM_THREADS": num_threads}
+        ):
+            got = band.ComputeStatistics(False)
+        ref_ds = gdal.GetDriverByName("MEM").CreateCopy("", ds)
+        ref_band = ref_ds.GetRasterBand(1)
+        if band.GetNoDataValue() is not None:
+            ref_band.SetNoDataValue(band.GetNoDataValue())
+        expected = ref_band.ComputeStatistics(False)
+        assert got == pytest.approx(expected, rel=1e-12)
+
+    check()
+    check()
+
+    # Band RasterIO()
+    band.WriteRaster(3, 5, 2, 2, struct.pack("f" * 4, 1000, -5, 3, 4))
+    check()
+
+    # Dataset RasterIO()
+    ds.WriteRaster(10, 20, 1, 1, struct.pack("f", -1000), band_list=[1])
+    check()
+
+    # Through the block cache
+    band.Fill(7)
+    band.FlushCache()
+    check()
+    band.WriteRaster(0, 29, 1, 1, struct.pack("f", 12345))
+    check()
+
+    # Nodata value changes invalidate all summaries
+    band.SetNoDataValue(7)
+    check()
+
+    # NaN nodata value
+    band.SetNoDataValue(float("nan"))
+    band.WriteRaster(1, 1, 1, 1, struct.pack("f", float("nan")))
+    check()
+    check()
+    band.WriteRaster(2, 2, 1, 1, struct.pack("f", -12345))
+    check()
@@ -389,6 +389,73 @@ def test_geoloc_affine_transformation_with_noise(step, convention):
     gdal.Unlink("/vsimem/lat.tif")
 
 
+###############################################################################
+# Test that the backmap computed with several threads is identical to the
+# single-threaded one
+
+
+def test_geoloc_backmap_multithreaded(tmp_vsimem):
+
+    r = random.Random(0)
+
+    size = 300
+    lon_filename = str(tmp_vsimem / "lon.tif")
+    lat_filename = str(tmp_vsimem / "lat.tif")
+    lon_ds = gdal.GetDriverByName("GTiff").Create(
+        lon_filename, size, size, 1, gdal.GDT_Float32
+    )
+    lat_ds = gdal.GetDriverByName("GTiff").Create(
+        lat_filename, size, size, 1, gdal.GDT_Float32
+    )
+    for y in range(size):
+        lon_vals = array.array(
+            "f",
+            [
+                -80 + 0.01 * x + 0.003 * y + r.uniform(-0.004, 0.004)
+                for x in range(size)
+            ],
+        )
+        lon_ds.WriteRaster(0, y, size, 1, lon_vals)
+        lat_vals = array.array(
+            "f",
+            [
+                50 - 0.01 * y + 0.002 * x + r.uniform(-0.004, 0.004)
+                for x in range(size)
+            ],
+        )
+        lat_ds.WriteRaster(0, y, size, 1, lat_vals)
+    lon_ds = None
+    lat_ds = None
+
+    ds = gdal.GetDriverByName("MEM").Create("", size, size)
+    ds.GetRasterBand(1).WriteRaster(
+        0, 0, size, size, bytes([(i * 7) % 251 for i in range(size * size)])
+    )
+    ds.SetMetadata(
+        {
+            "LINE_OFFSET": "0",
+            "LINE_STEP": "1",
+            "PIXEL_OFFSET": "0",
+            "PIXEL_STEP": "1",
+            "X_DATASET": lon_filename,
+            "X_BAND": "1",
+            "Y_DATASET": lat_filename,
+            "Y_BAND": "1",
+            "SRS": "WGS84",
+        },
+        "GEOLOCATION",
+    )
+
+    def warp():
+        out_ds = gdal.Warp("", ds, format="MEM")
+        return out_ds.GetRasterBand(1).Checksum()
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", "1"):
+        expected_cs = warp()
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        assert warp() == expected_cs
+
+
 ###############################################################################
 # Test GEOLOC_ARRAY transformer option to have the warped dataset != geolocation dataset
 
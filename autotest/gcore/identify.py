@@ -29,6 +29,8 @@
 ###############################################################################
 
 
+import pytest
+
 from osgeo import gdal
 
 ###############################################################################
@@ -100,3 +102,38 @@ def test_identify_4():
             "../gdrivers/data/envi/aea.dat", sibling_files=["aea.dat", "aea.hdr"]
         )
         assert dr is not None, "Did not get a driver!"
+
+
+###############################################################################
+# Test the GDAL_DMD_MAGIC_BYTES pre-filter
+
+
+def test_identify_magic_bytes():
+
+    drv = gdal.GetDriverByName("GTiff")
+    magic_bytes = drv.GetMetadataItem(gdal.DMD_MAGIC_BYTES)
+    assert magic_bytes is not None
+    assert "49492A00" in magic_bytes.split(" ")
+
+    dr = gdal.IdentifyDriverEx("data/byte.tif", allowed_drivers=["GTiff"])
+    assert dr is not None and dr.GetDescription() == "GTiff"
+
+    try:
+        # Signature that does not match the header of byte.tif
+        drv.SetMetadataItem(gdal.DMD_MAGIC_BYTES, "DEADBEEF")
+        dr = gdal.IdentifyDriverEx("data/byte.tif", allowed_drivers=["GTiff"])
+        assert dr is None
+        with pytest.raises(Exception):
+            gdal.OpenEx("data/byte.tif", allowed_drivers=["GTiff"])
+
+        # Invalid signatures are ignored with a warning
+        with gdal.quiet_errors():
+            drv.SetMetadataItem(gdal.DMD_MAGIC_BYTES, "4949ZZ 494")
+        assert gdal.GetLastErrorType() == gdal.CE_Warning
+        dr = gdal.IdentifyDriverEx("data/byte.tif", allowed_drivers=["GTiff"])
+        assert dr is not None and dr.GetDescription() == "GTiff"
+    finally:
+        drv.SetMetadataItem(gdal.DMD_MAGIC_BYTES, magic_bytes)
+
+    dr = gdal.IdentifyDriverEx("data/byte.tif", allowed_drivers=["GTiff"])
+    assert dr is not None and dr.GetDescription() == "GTiff"
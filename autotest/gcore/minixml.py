@@ -250,6 +250,22 @@ def test_minixml_processing_instruction():
     assert xml == got_xml, "serialize xml tree failed."
 
 
+###############################################################################
+# Test multi-line attribute values and text, and line numbers in error messages
+
+
+def test_minixml_multiline_values():
+
+    xml = """<a b='x\ny' c="1 &amp;\n2">\n  text &lt;\n\n  more\n</a>"""
+    tree = gdal.ParseXMLString(xml)
+    assert tree[2][2][1] == "x\ny"
+    assert tree[3][2][1] == "1 &\n2"
+    assert tree[4][1] == "text <\n\n  more\n"
+
+    with pytest.raises(Exception, match="Line 6: </b> doesn't have matching <b>"):
+        gdal.ParseXMLString(xml.replace("</a>", "</b>"))
+
+
 ###############################################################################
 # Cleanup
 
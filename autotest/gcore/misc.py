@@ -996,6 +996,52 @@ def test_misc_general_cmd_line_processor(tmp_path):
     assert processed == ["program", "2", str(tmp_path / "a_path"), "a_string"]
 
 
+###############################################################################
+# Test GDALDataset::SetCacheBudget() and the CACHE_BUDGET open option
+
+
+def test_misc_dataset_cache_budget(tmp_vsimem):
+
+    for name in ("hot.tif", "big.tif"):
+        gdal.GetDriverByName("GTiff").Create(
+            tmp_vsimem / name,
+            256,
+            256,
+            options=["TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16"],
+        )
+
+    with gdaltest.SetCacheMax(gdal.GetCacheUsed() + 150 * 1000):
+        hot_ds = gdal.Open(tmp_vsimem / "hot.tif")
+        assert hot_ds.GetCacheBudget() == 0
+        assert hot_ds.GetCacheUsed() == 0
+        hot_ds.GetRasterBand(1).Checksum()
+        hot_cache_used = hot_ds.GetCacheUsed()
+        assert hot_cache_used > 100 * 1000
+
+        big_ds = gdal.OpenEx(
+            tmp_vsimem / "big.tif", open_options=["CACHE_BUDGET=20000"]
+        )
+        assert big_ds.GetCacheBudget() == 20000
+        big_ds.GetRasterBand(1).Checksum()
+
+        # Blocks of big_ds exceed its budget, so they must have been evicted
+        # before the (older) ones of hot_ds
+        assert hot_ds.GetCacheUsed() == hot_cache_used
+        assert big_ds.GetCacheUsed() > 20000
+        assert big_ds.GetCacheUsed() < 150 * 1000 - hot_cache_used + 1000
+
+        # Without budget, the least recently used blocks are evicted
+        big_ds.SetCacheBudget(0)
+        assert big_ds.GetCacheBudget() == 0
+        big_ds = None
+        big_ds = gdal.Open(tmp_vsimem / "big.tif")
+        big_ds.GetRasterBand(1).Checksum()
+        assert hot_ds.GetCacheUsed() < hot_cache_used
+
+        big_ds = None
+        hot_ds = None
+
+
 ###############################################################################
 
 
@@ -1015,3 +1015,87 @@ def test_numpy_rw_masked_array_2():
     assert numpy.all(masked_arr.mask[mask != 255])
 
     assert masked_arr.sum() == arr[mask == 255].sum()
+
+
+###############################################################################
+# Test Band.ReadWindows()
+
+
+@pytest.mark.parametrize(
+    "open_flags", [gdal.OF_RASTER, gdal.OF_RASTER | gdal.OF_THREAD_SAFE]
+)
+def test_numpy_rw_read_windows(open_flags):
+
+    ds = gdal.OpenEx("data/utmsmall.tif", open_flags)
+    assert ds.IsThreadSafe(gdal.OF_RASTER) == (
+        (open_flags & gdal.OF_THREAD_SAFE) != 0
+    )
+    band = ds.GetRasterBand(1)
+    windows = [(i % 90, (i * 7) % 90, 10, 10) for i in range(50)]
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        ar = band.ReadWindows(windows)
+    assert ar.shape == (50, 10, 10)
+    assert ar.dtype == numpy.uint8
+    for i, w in enumerate(windows):
+        assert numpy.array_equal(ar[i], band.ReadAsArray(*w))
+
+    ar = band.ReadWindows(
+        windows[0:2], buf_xsize=5, buf_ysize=5, buf_type=gdal.GDT_Float32
+    )
+    assert ar.shape == (2, 5, 5)
+    assert ar.dtype == numpy.float32
+    assert numpy.array_equal(
+        ar[1],
+        band.ReadAsArray(
+            *windows[1], buf_xsize=5, buf_ysize=5, buf_type=gdal.GDT_Float32
+        ),
+    )
+
+    assert band.ReadWindows([]).shape == (0, 0, 0)
+
+    with pytest.raises(ValueError, match="buf_xsize must be specified"):
+        band.ReadWindows([(0, 0, 10, 10), (0, 0, 20, 10)])
+
+    with gdaltest.enable_exceptions(), pytest.raises(Exception):
+        band.ReadWindows([(0, 0, 10, 10), (95, 0, 10, 10)])
+
+
+###############################################################################
+# Test Band.GetBlockViewArray()
+
+
+def test_numpy_rw_get_block_view_array(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.tif")
+    gdal.Translate(
+        filename,
+        "data/utmsmall.tif",
+        creationOptions=["TILED=YES", "BLOCKXSIZE=32", "BLOCKYSIZE=32"],
+    )
+
+    ds = gdal.Open(filename)
+    band = ds.GetRasterBand(1)
+    ar = band.GetBlockViewArray(1, 0)
+    assert ar.shape == (32, 32)
+    assert not ar.flags.writeable
+    assert numpy.array_equal(ar, band.ReadAsArray(32, 0, 32, 32))
+
+    # Partial block at the right and bottom edges
+    ar2 = band.GetBlockViewArray(3, 3)
+    assert ar2.shape == (4, 4)
+    assert numpy.array_equal(ar2, band.ReadAsArray(96, 96, 4, 4))
+
+    with pytest.raises(ValueError):
+        ar[0, 0] = 0
+
+    # The array keeps the band and dataset alive
+    del band
+    del ds
+    assert numpy.array_equal(ar, ar.copy())
+    del ar
+    del ar2
+
+    ds = gdal.Open(filename)
+    with gdaltest.enable_exceptions(), pytest.raises(Exception):
+        ds.GetRasterBand(1).GetBlockViewArray(4, 0)
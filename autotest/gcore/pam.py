@@ -611,3 +611,53 @@ def test_pam_nodata_nan():
     # Check that no PAM file is generated
     assert gdal.VSIStatL(outfilename + ".aux.xml") is None
     gdal.GetDriverByName("GTiff").Delete(outfilename)
+
+
+###############################################################################
+# Test GDAL_SIDECAR_NEGATIVE_CACHE_TTL
+
+
+def test_pam_sidecar_negative_cache(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test_pam_sidecar_negative_cache.tif")
+    gdal.GetDriverByName("GTiff").Create(filename, 1, 1)
+
+    options = {
+        "GDAL_SIDECAR_NEGATIVE_CACHE_TTL": "3600",
+        "GDAL_DISABLE_READDIR_ON_OPEN": "YES",
+    }
+    with gdal.config_options(options):
+        ds = gdal.Open(filename)
+        assert ds.GetMetadataItem("FOO") is None
+        ds = None
+
+        # Created behind GDAL's back: still remembered as missing
+        gdal.FileFromMemBuffer(
+            filename + ".aux.xml",
+            '<PAMDataset><Metadata><MDI key="FOO">BAR</MDI></Metadata></PAMDataset>',
+        )
+        ds = gdal.Open(filename)
+        assert ds.GetMetadataItem("FOO") is None
+        ds = None
+
+    # Disabling the cache forgets everything
+    with gdal.config_option("GDAL_DISABLE_READDIR_ON_OPEN", "YES"):
+        ds = gdal.Open(filename)
+        assert ds.GetMetadataItem("FOO") == "BAR"
+        ds = None
+
+    gdal.Unlink(filename + ".aux.xml")
+    with gdal.config_options(options):
+        ds = gdal.Open(filename)
+        assert ds.GetMetadataItem("FOO") is None
+        ds = None
+
+        # Writing the .aux.xml file from GDAL invalidates the cache
+        ds = gdal.Open(filename)
+        ds.SetMetadataItem("FOO", "BAZ")
+        ds = None
+        assert gdal.VSIStatL(filename + ".aux.xml") is not None
+
+        ds = gdal.Open(filename)
+        assert ds.GetMetadataItem("FOO") == "BAZ"
+        ds = None
@@ -1464,4 +1464,103 @@ def test_pixfun_max_no_nodata():
     assert ar[10][12] == 255
 
 
+
+###############################################################################
+# Verify the expression pixel function
+
+
+@pytest.mark.parametrize("transfer_type", ["Float32", "Float64"])
+def test_pixfun_expression(transfer_type):
+
+    vrt_ds = gdal.Open(
+        f"""<VRTDataset rasterXSize="5" rasterYSize="6">
+  <VRTRasterBand dataType="Float64" band="1" subClass="VRTDerivedRasterBand">
+    <PixelFunctionType>expression</PixelFunctionType>
+    <PixelFunctionArguments expression="(B1 - B2) / (B1 + B2)" />
+    <SourceTransferType>{transfer_type}</SourceTransferType>
+    <SimpleSource>
+      <SourceFilename relativeToVRT="0">data/int32.tif</SourceFilename>
+      <SourceBand>1</SourceBand>
+      <SrcRect xOff="0" yOff="0" xSize="5" ySize="6"/>
+      <DstRect xOff="0" yOff="0" xSize="5" ySize="6"/>
+    </SimpleSource>
+    <SimpleSource>
+      <SourceFilename relativeToVRT="0">data/float32.tif</SourceFilename>
+      <SourceBand>1</SourceBand>
+      <SrcRect xOff="10" yOff="10" xSize="5" ySize="6"/>
+      <DstRect xOff="0" yOff="0" xSize="5" ySize="6"/>
+    </SimpleSource>
+  </VRTRasterBand>
+</VRTDataset>"""
+    )
+    data = vrt_ds.GetRasterBand(1).ReadAsArray()
+
+    refdata1 = gdal.Open("data/int32.tif").ReadAsArray(0, 0, 5, 6)
+    refdata1 = refdata1.astype("float64")
+    refdata2 = gdal.Open("data/float32.tif").ReadAsArray(10, 10, 5, 6)
+    refdata2 = refdata2.astype("float64")
+    assert numpy.allclose(data, (refdata1 - refdata2) / (refdata1 + refdata2))
+
+
+def test_pixfun_expression_conditional(tmp_vsimem):
+
+    # Width larger than the chunk size used by the evaluator
+    src_filename = str(tmp_vsimem / "src.tif")
+    src_ds = gdal.GetDriverByName("GTiff").Create(src_filename, 1000, 2, 2)
+    src_data1 = numpy.arange(2000, dtype=numpy.uint8).reshape(2, 1000)
+    src_data2 = numpy.full((2, 1000), 100, dtype=numpy.uint8)
+    src_ds.GetRasterBand(1).WriteArray(src_data1)
+    src_ds.GetRasterBand(2).WriteArray(src_data2)
+    src_ds = None
+
+    vrt_ds = gdal.Open(
+        f"""<VRTDataset rasterXSize="1000" rasterYSize="2">
+  <VRTRasterBand dataType="Int16" band="1" subClass="VRTDerivedRasterBand">
+    <PixelFunctionType>expression</PixelFunctionType>
+    <PixelFunctionArguments
+        expression="B1 &gt; B2 &amp;&amp; B1 &lt; 200 ? -1 : max(B1, B2) + 2^3" />
+    <SimpleSource>
+      <SourceFilename relativeToVRT="0">{src_filename}</SourceFilename>
+      <SourceBand>1</SourceBand>
+    </SimpleSource>
+    <SimpleSource>
+      <SourceFilename relativeToVRT="0">{src_filename}</SourceFilename>
+      <SourceBand>2</SourceBand>
+    </SimpleSource>
+  </VRTRasterBand>
+</VRTDataset>"""
+    )
+    data = vrt_ds.GetRasterBand(1).ReadAsArray()
+    b1 = src_data1.astype("float64")
+    b2 = src_data2.astype("float64")
+    expected = numpy.where((b1 > b2) & (b1 < 200), -1, numpy.maximum(b1, b2) + 8)
+    assert numpy.array_equal(data, expected)
+
+
+@pytest.mark.parametrize(
+    "expression,error_msg",
+    [
+        ("B1 +", "unexpected end of expression"),
+        ("foo(B1)", "unknown function"),
+        ("B1 + B2", "there are only 1 sources"),
+    ],
+)
+def test_pixfun_expression_errors(expression, error_msg):
+
+    vrt_ds = gdal.Open(
+        f"""<VRTDataset rasterXSize="20" rasterYSize="20">
+  <VRTRasterBand dataType="Float32" band="1" subClass="VRTDerivedRasterBand">
+    <PixelFunctionType>expression</PixelFunctionType>
+    <PixelFunctionArguments expression="{expression}" />
+    <SimpleSource>
+      <SourceFilename relativeToVRT="0">data/byte.tif</SourceFilename>
+      <SourceBand>1</SourceBand>
+    </SimpleSource>
+  </VRTRasterBand>
+</VRTDataset>"""
+    )
+    with pytest.raises(Exception, match=error_msg):
+        vrt_ds.GetRasterBand(1).ReadRaster()
+
+
 ###############################################################################
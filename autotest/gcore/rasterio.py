@@ -2697,6 +2697,45 @@ def test_rasterio_rms_two_third_downsampling_float32():
     )
 
 
+###############################################################################
+# Test average and rms downsampling by integer factors greater than 2, with
+# integer data types, and check that the optimized code path without nodata
+# gives the same result as the generic one with a nodata value never hit
+
+
+@pytest.mark.parametrize("factor", [3, 4, 8])
+@pytest.mark.parametrize(
+    "dt,struct_type,max_val",
+    [(gdal.GDT_Byte, "B", 255), (gdal.GDT_UInt16, "H", 65535)],
+)
+@pytest.mark.parametrize("resample_alg", [gdal.GRIORA_Average, gdal.GRIORA_RMS])
+def test_rasterio_average_rms_integer_factor_downsampling(
+    factor, dt, struct_type, max_val, resample_alg
+):
+
+    width = factor * 21
+    height = factor * 5
+    # Values never reach max_val, which is used as nodata value afterwards
+    values = [((i * 7919) % 100003) % max_val for i in range(width * height)]
+    ds = gdal.GetDriverByName("MEM").Create("", width, height, 1, dt)
+    ds.WriteRaster(
+        0, 0, width, height, struct.pack(struct_type * (width * height), *values)
+    )
+    data = ds.GetRasterBand(1).ReadRaster(
+        buf_xsize=width // factor,
+        buf_ysize=height // factor,
+        resample_alg=resample_alg,
+    )
+
+    ds.GetRasterBand(1).SetNoDataValue(max_val)
+    ref_data = ds.GetRasterBand(1).ReadRaster(
+        buf_xsize=width // factor,
+        buf_ysize=height // factor,
+        resample_alg=resample_alg,
+    )
+    assert data == ref_data
+
+
 ###############################################################################
 # Test rms downsampling by a factor of 2 on exact boundaries, with CFloat32
 
@@ -3282,3 +3321,86 @@ def test_rasterio_overview_selection():
         assert ds.GetRasterBand(1).ReadRaster(0, 0, 100, 100, 29, 29)[0] == 2
         assert ds.GetRasterBand(1).ReadRaster(0, 0, 100, 100, 25, 25)[0] == 3
         assert ds.GetRasterBand(1).ReadRaster(0, 0, 100, 100, 24, 24)[0] == 3
+
+
+###############################################################################
+# Test GDALDatasetCopyWholeRaster() with several swaths, with and without
+# prefetching of the source
+
+
+@pytest.mark.parametrize("interleave", ["PIXEL", "BAND"])
+@pytest.mark.parametrize("prefetch", ["YES", "NO"])
+def test_rasterio_copy_whole_raster_prefetch(tmp_vsimem, interleave, prefetch):
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 1000, 3000, 3)
+    for i in range(3):
+        src_ds.GetRasterBand(i + 1).WriteRaster(
+            0,
+            0,
+            1000,
+            3000,
+            bytes(((x * (i + 1)) % 251) for x in range(1000 * 30)) * 100,
+        )
+    expected_cs = [src_ds.GetRasterBand(i + 1).Checksum() for i in range(3)]
+
+    progress_values = []
+
+    def my_progress(pct, msg, user_data):
+        progress_values.append(pct)
+        return 1
+
+    filename = str(tmp_vsimem / "out.tif")
+    with gdaltest.config_options(
+        {"GDAL_SWATH_SIZE": "1000000", "GDAL_COPY_WHOLE_RASTER_PREFETCH": prefetch}
+    ):
+        gdal.GetDriverByName("GTiff").CreateCopy(
+            filename,
+            src_ds,
+            options=["COMPRESS=DEFLATE", "INTERLEAVE=" + interleave],
+            callback=my_progress,
+        )
+    assert progress_values == sorted(progress_values)
+    assert progress_values[-1] == 1.0
+
+    with gdal.Open(filename) as ds:
+        assert [ds.GetRasterBand(i + 1).Checksum() for i in range(3)] == expected_cs
+
+    # Interrupt the copy in the middle
+    def my_interrupting_progress(pct, msg, user_data):
+        return pct < 0.5
+
+    with gdaltest.config_options(
+        {"GDAL_SWATH_SIZE": "1000000", "GDAL_COPY_WHOLE_RASTER_PREFETCH": prefetch}
+    ):
+        with pytest.raises(Exception, match="User terminated"):
+            gdal.GetDriverByName("GTiff").CreateCopy(
+                filename,
+                src_ds,
+                options=["COMPRESS=DEFLATE", "INTERLEAVE=" + interleave],
+                callback=my_interrupting_progress,
+            )
+
+
+###############################################################################
+# Test Band.SamplePoints()
+
+
+def test_rasterio_sample_points():
+
+    ds = gdal.Open("data/byte.tif")
+    band = ds.GetRasterBand(1)
+    points = [(0.5, 0.5), (1, 2), (19.9, 19.9), (20, 0), (-1, 5)]
+    values = band.SamplePoints(points)
+    assert values[:3] == [
+        struct.unpack("B", band.ReadRaster(int(x), int(y), 1, 1))[0]
+        for x, y in points[:3]
+    ]
+    assert math.isnan(values[3])
+    assert math.isnan(values[4])
+
+    assert band.SamplePoints([(1, 0.5)], gdal.GRIORA_Bilinear) == [
+        (107 + 123) / 2
+    ]
+
+    with pytest.raises(Exception, match="Only nearest neighbour and bilinear"):
+        band.SamplePoints([(1, 0.5)], gdal.GRIORA_Cubic)
@@ -178,3 +178,64 @@ def test_rat_4():
 
 
 ##############################################################################
+# Test GetRowOfValue() on the various kinds of tables it can index
+
+
+def test_rat_get_row_of_value():
+
+    # Single MinMax column, with duplicated values
+    rat = gdal.RasterAttributeTable()
+    rat.CreateColumn("VALUE", gdal.GFT_Integer, gdal.GFU_MinMax)
+    for i, v in enumerate([5, 3, 8, 3, 1]):
+        rat.SetValueAsInt(i, 0, v)
+    assert rat.GetRowOfValue(3) == 1
+    assert rat.GetRowOfValue(1) == 4
+    assert rat.GetRowOfValue(8) == 2
+    assert rat.GetRowOfValue(2) == -1
+    assert rat.GetRowOfValue(float("nan")) == 0
+    # Modifying values must be taken into account
+    rat.SetValueAsInt(3, 0, 2)
+    assert rat.GetRowOfValue(2) == 3
+    rat.SetValueAsInt(5, 0, 9)
+    assert rat.GetRowOfValue(9) == 5
+
+    # Sorted Min and Max columns
+    rat = gdal.RasterAttributeTable()
+    rat.CreateColumn("MIN", gdal.GFT_Real, gdal.GFU_Min)
+    rat.CreateColumn("MAX", gdal.GFT_Real, gdal.GFU_Max)
+    for i, (vmin, vmax) in enumerate([(0, 1), (1.5, 2), (2.5, 10)]):
+        rat.SetValueAsDouble(i, 0, vmin)
+        rat.SetValueAsDouble(i, 1, vmax)
+    assert rat.GetRowOfValue(-1.0) == -1
+    assert rat.GetRowOfValue(0.0) == 0
+    assert rat.GetRowOfValue(1.0) == 0
+    assert rat.GetRowOfValue(1.2) == -1
+    assert rat.GetRowOfValue(1.5) == 1
+    assert rat.GetRowOfValue(5.0) == 2
+    assert rat.GetRowOfValue(10.5) == -1
+
+    # Overlapping ranges: first matching row
+    rat.SetValueAsDouble(1, 0, 0.5)
+    rat.SetValueAsDouble(1, 1, 20)
+    assert rat.GetRowOfValue(0.7) == 0
+    assert rat.GetRowOfValue(15.0) == 1
+
+    # Min column only
+    rat = gdal.RasterAttributeTable()
+    rat.CreateColumn("MIN", gdal.GFT_Integer, gdal.GFU_Min)
+    for i, v in enumerate([10, 20, 5, 0]):
+        rat.SetValueAsInt(i, 0, v)
+    assert rat.GetRowOfValue(25) == 0
+    assert rat.GetRowOfValue(7) == 2
+    assert rat.GetRowOfValue(0) == 3
+    assert rat.GetRowOfValue(-1) == -1
+
+    # Max column only
+    rat = gdal.RasterAttributeTable()
+    rat.CreateColumn("MAX", gdal.GFT_Real, gdal.GFU_Max)
+    for i, v in enumerate([10, 5, 20, 30]):
+        rat.SetValueAsDouble(i, 0, v)
+    assert rat.GetRowOfValue(1.0) == 0
+    assert rat.GetRowOfValue(15.0) == 2
+    assert rat.GetRowOfValue(30.0) == 3
+    assert rat.GetRowOfValue(31.0) == -1
@@ -75,3 +75,124 @@ def test_thread_test_1():
             ret = False
 
     assert ret
+
+
+###############################################################################
+# Test concurrent use of the dataset pool by VRT sources, including nested
+# VRTs whose opening go through the pool while other threads use it
+
+
+def test_thread_test_proxy_pool(tmp_vsimem):
+
+    inner_vrt = str(tmp_vsimem / "inner.vrt")
+    gdal.Translate(inner_vrt, "data/byte.tif", format="VRT")
+
+    sources = ""
+    for i in range(8):
+        sources += f"""
+    <SimpleSource>
+      <SourceFilename>{inner_vrt}</SourceFilename>
+      <SourceBand>1</SourceBand>
+      <SrcRect xOff="0" yOff="0" xSize="20" ySize="20"/>
+      <DstRect xOff="{i * 20}" yOff="0" xSize="20" ySize="20"/>
+    </SimpleSource>"""
+    outer_vrt = f"""<VRTDataset rasterXSize="160" rasterYSize="20">
+  <VRTRasterBand dataType="Byte" band="1">{sources}
+  </VRTRasterBand>
+</VRTDataset>"""
+
+    with gdal.Open(outer_vrt) as ds:
+        expected_cs = ds.GetRasterBand(1).Checksum()
+
+    def worker(args_dict):
+        for i in range(50):
+            with gdal.Open(outer_vrt) as ds:
+                if ds.GetRasterBand(1).Checksum() != expected_cs:
+                    args_dict["ret"] = False
+
+    threads = []
+    args_array = []
+    for i in range(8):
+        args_dict = {"ret": True}
+        t = threading.Thread(target=worker, args=(args_dict,))
+        args_array.append(args_dict)
+        threads.append(t)
+        t.start()
+
+    for t in threads:
+        t.join()
+
+    for args_dict in args_array:
+        assert args_dict["ret"]
+
+
+###############################################################################
+# Test concurrent reads on a dataset opened with GDAL_OF_THREAD_SAFE
+
+
+def test_thread_test_thread_safe_dataset(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.tif")
+    gdal.Translate(filename, "data/utmsmall.tif", options="-outsize 400 400")
+    with gdal.Open(filename, gdal.GA_Update) as ds:
+        ds.BuildOverviews("NEAR", [2])
+
+    with gdal.Open(filename) as ds:
+        expected_cs = ds.GetRasterBand(1).Checksum()
+        expected_ovr_cs = ds.GetRasterBand(1).GetOverview(0).Checksum()
+
+    ds = gdal.OpenEx(filename, gdal.OF_RASTER | gdal.OF_THREAD_SAFE)
+    assert ds.RasterXSize == 400
+    assert ds.GetDriver().ShortName == "GTiff"
+    band = ds.GetRasterBand(1)
+    assert band.GetOverviewCount() == 1
+
+    def worker(args_dict):
+        for i in range(20):
+            if band.Checksum() != expected_cs:
+                args_dict["ret"] = False
+            if band.GetOverview(0).Checksum() != expected_ovr_cs:
+                args_dict["ret"] = False
+            if ds.ReadRaster(0, 0, 10, 10) is None:
+                args_dict["ret"] = False
+
+    threads = []
+    args_array = []
+    for i in range(8):
+        args_dict = {"ret": True}
+        t = threading.Thread(target=worker, args=(args_dict,))
+        args_array.append(args_dict)
+        threads.append(t)
+        t.start()
+
+    for t in threads:
+        t.join()
+
+    for args_dict in args_array:
+        assert args_dict["ret"]
+
+    with pytest.raises(Exception, match="GDAL_OF_THREAD_SAFE"):
+        band.Fill(0)
+    with pytest.raises(Exception, match="GDAL_OF_THREAD_SAFE"):
+        ds.SetMetadataItem("FOO", "BAR")
+    assert ds.GetMetadataItem("FOO") is None
+
+    ds.Close()
+
+
+def test_thread_test_thread_safe_dataset_errors():
+
+    with pytest.raises(Exception, match="GDAL_OF_RASTER only"):
+        gdal.OpenEx("data/byte.tif", gdal.OF_THREAD_SAFE)
+    with pytest.raises(Exception, match="GDAL_OF_RASTER only"):
+        gdal.OpenEx(
+            "data/byte.tif", gdal.OF_RASTER | gdal.OF_VECTOR | gdal.OF_THREAD_SAFE
+        )
+    with pytest.raises(Exception, match="incompatible with GDAL_OF_UPDATE"):
+        gdal.OpenEx(
+            "data/byte.tif", gdal.OF_RASTER | gdal.OF_UPDATE | gdal.OF_THREAD_SAFE
+        )
+    with pytest.raises(Exception, match="incompatible with GDAL_OF_UPDATE"):
+        gdal.OpenEx(
+            "data/byte.tif", gdal.OF_RASTER | gdal.OF_SHARED | gdal.OF_THREAD_SAFE
+        )
@@ -2094,6 +2094,45 @@ def test_tiff_direct_and_virtual_mem_io():
             pytest.fail("missing code coverage in VirtualMemIO()")
 
 
+###############################################################################
+# Test that GTIFF_VIRTUAL_MEM_IO=AUTO serves large reads without going
+# through the block cache
+
+
+@pytest.mark.skipif(sys.platform != "linux", reason="Incorrect platform")
+@pytest.mark.parametrize("interleave", ["PIXEL", "BAND"])
+def test_tiff_virtual_mem_io_auto(tmp_path, interleave):
+
+    filename = str(tmp_path / "test_tiff_virtual_mem_io_auto.tif")
+    src_ds = gdal.Translate(
+        "", "data/stefan_full_rgba.tif", format="MEM", width=256, height=256
+    )
+    gdal.GetDriverByName("GTiff").CreateCopy(
+        filename, src_ds, options=["INTERLEAVE=" + interleave]
+    )
+    expected_data = src_ds.ReadRaster()
+
+    with gdaltest.SetCacheMax(256 * 1024), gdaltest.config_option(
+        "GTIFF_VIRTUAL_MEM_IO", "AUTO"
+    ):
+        ds = gdal.Open(filename)
+
+        # Small request: served through the block cache
+        cache_used = gdal.GetCacheUsed()
+        ds.ReadRaster(0, 0, 16, 16)
+        assert gdal.GetCacheUsed() > cache_used
+        cache_used = gdal.GetCacheUsed()
+
+        # Large request: served from the file mapping
+        assert ds.ReadRaster() == expected_data
+        assert gdal.GetCacheUsed() == cache_used
+        assert ds.GetRasterBand(2).ReadRaster() == src_ds.GetRasterBand(
+            2
+        ).ReadRaster()
+        assert gdal.GetCacheUsed() == cache_used
+        ds = None
+
+
 ###############################################################################
 # Check read Digital Globe metadata IMD & RPB format
 
@@ -4957,6 +4996,136 @@ def test_tiff_read_multi_threaded(
     ds = None
 
 
+###############################################################################
+# Test multi-threaded decoding of odd bits files, masks and overviews
+
+
+@pytest.mark.parametrize(
+    "nbands,dtype,creation_options",
+    [
+        (1, gdal.GDT_Byte, ["NBITS=1"]),
+        (3, gdal.GDT_Byte, ["NBITS=1", "INTERLEAVE=PIXEL"]),
+        (1, gdal.GDT_UInt16, ["NBITS=12"]),
+        (3, gdal.GDT_UInt16, ["NBITS=12", "INTERLEAVE=PIXEL"]),
+        (2, gdal.GDT_UInt16, ["NBITS=12", "INTERLEAVE=BAND"]),
+        (1, gdal.GDT_UInt32, ["NBITS=20"]),
+        (1, gdal.GDT_Float32, ["NBITS=16"]),
+    ],
+)
+@pytest.mark.parametrize("compress", ["NONE", "DEFLATE"])
+def test_tiff_read_multi_threaded_odd_bits_mask_overview(
+    tmp_vsimem, nbands, dtype, creation_options, compress
+):
+
+    max_val = 1 if "NBITS=1" in creation_options else 255
+    ref_ds = gdal.GetDriverByName("MEM").Create("", 100, 90, nbands, dtype)
+    for band in range(nbands):
+        buf = array.array(
+            "B",
+            [
+                (band * 10 + j + i) % (max_val + 1)
+                for j in range(90)
+                for i in range(100)
+            ],
+        )
+        ref_ds.GetRasterBand(band + 1).WriteRaster(
+            0, 0, 100, 90, buf, buf_type=gdal.GDT_Byte
+        )
+
+    tmpfile = str(tmp_vsimem / "test.tif")
+    with gdal.config_option("GDAL_TIFF_INTERNAL_MASK", "YES"):
+        ds = gdal.GetDriverByName("GTiff").CreateCopy(
+            tmpfile,
+            ref_ds,
+            options=creation_options
+            + ["COMPRESS=" + compress, "TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16"],
+        )
+        ds.CreateMaskBand(gdal.GMF_PER_DATASET)
+        ds.GetRasterBand(1).GetMaskBand().WriteRaster(
+            0, 0, 50, 50, b"\xFF" * (50 * 50)
+        )
+        ds.BuildOverviews("NEAR", [2])
+        ds = None
+
+    def read_all(ds):
+        ret = [ds.ReadRaster(), ds.ReadRaster(3, 5, 70, 60)]
+        for i in range(nbands):
+            ret.append(ds.GetRasterBand(i + 1).ReadRaster())
+        ret.append(ds.GetRasterBand(1).GetMaskBand().ReadRaster())
+        ovr = ds.GetRasterBand(1).GetOverview(0)
+        ret.append(ovr.ReadRaster())
+        ret.append(ovr.GetMaskBand().ReadRaster())
+        return ret
+
+    ds = gdal.Open(tmpfile)
+    expected = read_all(ds)
+    ds = None
+
+    ds = gdal.OpenEx(tmpfile, open_options=["NUM_THREADS=4"])
+    assert read_all(ds) == expected
+    ds = None
+
+
+###############################################################################
+# Test multi-threaded decoding of DEFLATE striles, without libtiff
+
+
+@pytest.mark.parametrize(
+    "dtype,predictor",
+    [
+        (gdal.GDT_Byte, 1),
+        (gdal.GDT_Byte, 2),
+        (gdal.GDT_UInt16, 2),
+        (gdal.GDT_Int32, 2),
+        (gdal.GDT_Float32, 1),
+        (gdal.GDT_Float32, 2),
+        (gdal.GDT_Float32, 3),
+        (gdal.GDT_Float64, 3),
+    ],
+)
+@pytest.mark.parametrize("endianness", ["LITTLE", "BIG"])
+@pytest.mark.parametrize(
+    "layout_options",
+    [
+        ["TILED=YES", "BLOCKXSIZE=32", "BLOCKYSIZE=32", "INTERLEAVE=PIXEL"],
+        ["BLOCKYSIZE=16", "INTERLEAVE=BAND"],
+    ],
+)
+def test_tiff_read_multi_threaded_deflate_predictor(
+    tmp_vsimem, dtype, predictor, endianness, layout_options
+):
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 100, 90, 3, dtype)
+    for band in range(3):
+        buf = array.array(
+            "B", [(band * 10 + j * i) % 256 for j in range(90) for i in range(100)]
+        )
+        src_ds.GetRasterBand(band + 1).WriteRaster(
+            0, 0, 100, 90, buf, buf_type=gdal.GDT_Byte
+        )
+
+    tmpfile = str(tmp_vsimem / "test.tif")
+    gdal.GetDriverByName("GTiff").CreateCopy(
+        tmpfile,
+        src_ds,
+        options=layout_options
+        + [
+            "COMPRESS=DEFLATE",
+            f"PREDICTOR={predictor}",
+            f"ENDIANNESS={endianness}",
+        ],
+    )
+
+    with gdal.Open(tmpfile) as ds:
+        expected = ds.ReadRaster()
+    assert expected == src_ds.ReadRaster()
+
+    with gdal.OpenEx(tmpfile, open_options=["NUM_THREADS=4"]) as ds:
+        assert ds.ReadRaster() == expected
+        assert ds.ReadRaster(3, 5, 70, 60) == src_ds.ReadRaster(3, 5, 70, 60)
+        assert ds.GetRasterBand(2).ReadRaster() == src_ds.GetRasterBand(2).ReadRaster()
+
+
 ###############################################################################
 # Test multi-threaded decoding with /vsicurl
 
@@ -5220,3 +5389,48 @@ def test_tiff_read_jpeg_cached_multi_range_issue_9563(tmp_vsimem):
     out = str(tmp_vsimem / "out.tif")
     with gdal.config_option("GTIFF_HAS_OPTIMIZED_READ_MULTI_RANGE", "YES"):
         gdal.Translate(out, vrt, options="-tr 0.000071806 0.000071806 -f COG")
+
+
+
+###############################################################################
+# Test reading with GDAL_PREFETCH_BLOCKS
+
+
+@pytest.mark.parametrize("compress", ["NONE", "DEFLATE"])
+def test_tiff_read_prefetch_blocks(tmp_path, compress):
+
+    filename = str(tmp_path / "test.tif")
+    gdal.Translate(
+        filename,
+        "data/byte.tif",
+        options=f"-outsize 600 600 -co TILED=YES -co BLOCKXSIZE=16 "
+        f"-co BLOCKYSIZE=16 -co COMPRESS={compress}",
+    )
+
+    ds = gdal.Open(filename)
+    ref_band = ds.GetRasterBand(1)
+
+    def ref_block(x, y):
+        return ref_band.ReadRaster(x, y, min(16, 600 - x), min(16, 600 - y))
+
+    with gdal.config_option("GDAL_PREFETCH_BLOCKS", "20"):
+        ds_prefetch = gdal.Open(filename)
+        band = ds_prefetch.GetRasterBand(1)
+
+        # Sequential scan, block by block
+        for y in range(0, 600, 16):
+            for x in range(0, 600, 16):
+                assert band.ReadRaster(
+                    x, y, min(16, 600 - x), min(16, 600 - y)
+                ) == ref_block(x, y)
+
+        # Random access after a sequential scan
+        band.FlushCache()
+        for x, y in [(0, 0), (16, 0), (32, 0), (320, 512), (48, 0), (592, 592)]:
+            assert band.ReadRaster(
+                x, y, min(16, 600 - x), min(16, 600 - y)
+            ) == ref_block(x, y)
+
+        band.FlushCache()
+        assert band.Checksum() == ref_band.Checksum()
+        ds_prefetch = None
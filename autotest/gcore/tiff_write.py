@@ -8448,6 +8448,45 @@ def test_tiff_write_176_lerc_max_z_error():
     ut.testCreateCopy(skip_preclose_test=1)
 
 
+###############################################################################
+# Test LERC compression with LERC_MAX_TILE_SIZE
+
+
+@pytest.mark.require_creation_option("GTiff", "LERC_ZSTD")
+@pytest.mark.parametrize("num_threads", [None, "2"])
+def test_tiff_write_lerc_max_tile_size(tmp_vsimem, num_threads):
+
+    src_ds = gdal.Open("../gdrivers/data/small_world.tif")
+    options = ["COMPRESS=LERC_ZSTD", "TILED=YES", "BLOCKXSIZE=128", "BLOCKYSIZE=128"]
+    if num_threads:
+        options.append("NUM_THREADS=" + num_threads)
+
+    filename = str(tmp_vsimem / "lossless.tif")
+    with gdal.GetDriverByName("GTiff").CreateCopy(
+        filename, src_ds, options=options
+    ) as ds:
+        pass
+    with gdal.Open(filename) as ds:
+        band = ds.GetRasterBand(1)
+        lossless_size = int(band.GetMetadataItem("BLOCK_SIZE_0_0", "TIFF"))
+        lossless_cs = band.Checksum()
+
+    target_size = lossless_size // 2
+    filename = str(tmp_vsimem / "sized.tif")
+    with gdal.GetDriverByName("GTiff").CreateCopy(
+        filename, src_ds, options=options + [f"LERC_MAX_TILE_SIZE={target_size}"]
+    ) as ds:
+        pass
+    with gdal.Open(filename) as ds:
+        band = ds.GetRasterBand(1)
+        assert int(band.GetMetadataItem("BLOCK_SIZE_0_0", "TIFF")) <= target_size
+        assert band.Checksum() != lossless_cs
+        # The approximated values remain close
+        assert band.ComputeRasterMinMax() == pytest.approx(
+            src_ds.GetRasterBand(1).ComputeRasterMinMax(), abs=64
+        )
+
+
 ###############################################################################
 # Test LERC compression with several bands and tiling
 
@@ -11523,3 +11562,132 @@ def test_tiff_write_copy_mdd():
     ds = None
 
     gdal.Unlink(filename)
+
+
+###############################################################################
+# Test DEDUPLICATE_TILES creation option
+
+
+@pytest.mark.parametrize("compress", ["NONE", "DEFLATE"])
+@pytest.mark.parametrize("num_threads", [None, "2"])
+def test_tiff_write_deduplicate_tiles(tmp_vsimem, compress, num_threads):
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 64, 64)
+    # Tiles of the left half are identical, as well as tiles of the right half
+    for y in range(64):
+        src_ds.GetRasterBand(1).WriteRaster(
+            0,
+            y,
+            64,
+            1,
+            b"".join(bytes([(x + y) % 16 + (x // 32) * 100]) for x in range(64)),
+        )
+
+    options = ["TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16", "COMPRESS=" + compress]
+    if num_threads:
+        options.append("NUM_THREADS=" + num_threads)
+
+    ref_filename = str(tmp_vsimem / "ref.tif")
+    gdal.GetDriverByName("GTiff").CreateCopy(ref_filename, src_ds, options=options)
+
+    filename = str(tmp_vsimem / "test.tif")
+    gdal.GetDriverByName("GTiff").CreateCopy(
+        filename, src_ds, options=options + ["DEDUPLICATE_TILES=YES"]
+    )
+    assert gdal.VSIStatL(filename).size < gdal.VSIStatL(ref_filename).size
+
+    ds = gdal.Open(filename)
+    band = ds.GetRasterBand(1)
+    assert band.Checksum() == src_ds.GetRasterBand(1).Checksum()
+    offsets = set()
+    for y in range(4):
+        for x in range(4):
+            offsets.add(band.GetMetadataItem("BLOCK_OFFSET_%d_%d" % (x, y), "TIFF"))
+    assert len(offsets) == 2
+    ds = None
+
+    # Rewriting a tile with new content must not alter those sharing its
+    # previous location
+    ds = gdal.GetDriverByName("GTiff").Create(
+        filename, 64, 64, options=options + ["DEDUPLICATE_TILES=YES"]
+    )
+    ds.WriteRaster(0, 0, 64, 64, src_ds.ReadRaster())
+    ds.FlushCache()
+    ds.GetRasterBand(1).WriteRaster(0, 0, 16, 16, b"\xff" * (16 * 16))
+    ds = None
+
+    ds = gdal.Open(filename)
+    assert ds.ReadRaster(0, 0, 16, 16) == b"\xff" * (16 * 16)
+    assert ds.ReadRaster(16, 0, 48, 64) == src_ds.ReadRaster(16, 0, 48, 64)
+    assert ds.ReadRaster(0, 16, 16, 48) == src_ds.ReadRaster(0, 16, 16, 48)
+    ds = None
+
+
+def test_tiff_write_deduplicate_tiles_empty_tiles(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.tif")
+    ds = gdal.GetDriverByName("GTiff").Create(
+        filename,
+        256,
+        256,
+        options=["TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16", "DEDUPLICATE_TILES=YES"],
+    )
+    ds.GetRasterBand(1).WriteRaster(0, 0, 1, 1, b"\x01")
+    ds = None
+
+    assert gdal.VSIStatL(filename).size < 2 * 16 * 16 + 10000
+    ds = gdal.Open(filename)
+    assert ds.GetRasterBand(1).Checksum() == 1
+    assert ds.GetRasterBand(1).GetMetadataItem(
+        "BLOCK_OFFSET_1_0", "TIFF"
+    ) == ds.GetRasterBand(1).GetMetadataItem("BLOCK_OFFSET_15_15", "TIFF")
+
+
+###############################################################################
+# Test band-by-band writing of a pixel-interleaved file with a block cache too
+# small to hold all bands, and dataset writes from a band-sequential buffer
+
+
+@pytest.mark.parametrize("nbands", [3, 4])
+def test_tiff_write_pixel_interleaved_band_by_band(tmp_vsimem, nbands):
+
+    src_ds = gdal.Translate(
+        "", "data/rgbsmall.tif", format="MEM", width=256, height=256
+    )
+    if nbands == 4:
+        src_ds.AddBand(gdal.GDT_Byte)
+        src_ds.GetRasterBand(4).Fill(255)
+
+    filename = str(tmp_vsimem / "test.tif")
+    options = [
+        "TILED=YES",
+        "BLOCKXSIZE=64",
+        "BLOCKYSIZE=64",
+        "COMPRESS=DEFLATE",
+        "INTERLEAVE=PIXEL",
+    ]
+    with gdaltest.config_option("GDAL_CACHEMAX", "1"):
+        ds = gdal.GetDriverByName("GTiff").Create(
+            filename, 256, 256, nbands, options=options
+        )
+        for i in range(nbands):
+            ds.GetRasterBand(i + 1).WriteRaster(
+                0, 0, 256, 256, src_ds.GetRasterBand(i + 1).ReadRaster()
+            )
+        ds = None
+
+    ds = gdal.Open(filename)
+    assert [ds.GetRasterBand(i + 1).Checksum() for i in range(nbands)] == [
+        src_ds.GetRasterBand(i + 1).Checksum() for i in range(nbands)
+    ]
+    ds = None
+
+    ds = gdal.GetDriverByName("GTiff").Create(
+        filename, 256, 256, nbands, options=options
+    )
+    ds.WriteRaster(0, 0, 256, 256, src_ds.ReadRaster())
+    ds = None
+
+    ds = gdal.Open(filename)
+    assert ds.ReadRaster() == src_ds.ReadRaster()
+    ds = None
@@ -32,6 +32,7 @@
 
 
 import math
+import random
 
 import gdaltest
 import pytest
@@ -500,6 +501,67 @@ def test_transformer_9():
     gdal.Unlink("/vsimem/dem.tif")
 
 
+###############################################################################
+# Test that preloading the DEM region covering a batch of points gives the
+# same results as transforming points one at a time
+
+
+@pytest.mark.parametrize("dem_epsg", [4326, 32652])
+def test_transformer_rpc_dem_preload(tmp_vsimem, dem_epsg):
+
+    ds = gdal.Open("data/rpc.vrt")
+
+    dem_filename = str(tmp_vsimem / "dem.tif")
+    ds_dem = gdal.GetDriverByName("GTiff").Create(
+        dem_filename, 100, 100, 1, gdal.GDT_Byte
+    )
+    sr = osr.SpatialReference()
+    sr.ImportFromEPSG(dem_epsg)
+    ds_dem.SetProjection(sr.ExportToWkt())
+    if dem_epsg == 4326:
+        ds_dem.SetGeoTransform(
+            [
+                125.647968621436,
+                1.2111052640051412e-05,
+                0,
+                39.869926216038,
+                0,
+                -8.6569068979969188e-06,
+            ]
+        )
+    else:
+        ds_dem.SetGeoTransform([213290, 1, 0, 4418700, 0, -1])
+    r = random.Random(0)
+    ds_dem.GetRasterBand(1).WriteRaster(
+        0, 0, 100, 100, bytes([40 + r.randint(0, 9) for _ in range(100 * 100)])
+    )
+    ds_dem = None
+
+    points = [
+        (125.6480 + 0.00008 * i, 39.8698 - 0.00006 * j)
+        for j in range(7)
+        for i in range(7)
+    ]
+
+    for method in ["near", "bilinear", "cubic"]:
+        tr = gdal.Transformer(
+            ds,
+            None,
+            [
+                "METHOD=RPC",
+                "RPC_DEM=" + dem_filename,
+                "RPC_DEMINTERPOLATION=%s" % method,
+            ],
+        )
+
+        (pnts, success) = tr.TransformPoints(1, points)
+        for i, (x, y) in enumerate(points):
+            (single_success, pnt) = tr.TransformPoint(1, x, y, 0)
+            assert success[i] == single_success, (method, i)
+            if single_success:
+                assert pnts[i] == pnt, (method, i)
+
+
 ###############################################################################
 # Test RPC DEM transform from geoid height to ellipsoidal height
 
@@ -1077,6 +1139,36 @@ def test_transformer_tps_precision():
     assert maxDiffResult < 1e-3, "at least one transformation exceeds the error bound"
 
 
+###############################################################################
+# Test that transforming a batch of points with a multi-threaded TPS
+# transformer gives the same results as with a single thread
+
+
+def test_transformer_tps_multithreaded_transform():
+
+    ds = gdal.Open("data/gcps_2115.vrt")
+    gcps = ds.GetGCPs()
+    points = [
+        (
+            0.5 * (gcps[i].GCPPixel + gcps[i + 1].GCPPixel),
+            0.5 * (gcps[i].GCPLine + gcps[i + 1].GCPLine),
+        )
+        for i in range(len(gcps) - 1)
+    ]
+
+    tr = gdal.Transformer(ds, None, ["METHOD=GCP_TPS", "NUM_THREADS=1"])
+    expected_fwd, _ = tr.TransformPoints(0, points)
+    expected_inv, _ = tr.TransformPoints(1, [(p[0], p[1]) for p in expected_fwd])
+
+    tr = gdal.Transformer(ds, None, ["METHOD=GCP_TPS", "NUM_THREADS=4"])
+    got_fwd, success = tr.TransformPoints(0, points)
+    assert all(success)
+    assert got_fwd == expected_fwd
+    got_inv, success = tr.TransformPoints(1, [(p[0], p[1]) for p in got_fwd])
+    assert all(success)
+    assert got_inv == expected_inv
+
+
 ###############################################################################
 def test_transformer_image_no_srs():
 
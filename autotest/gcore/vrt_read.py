@@ -2639,3 +2639,76 @@ def test_vrt_read_virtual_overviews_match_src_overviews(tmp_vsimem):
     assert vrt_band.GetOverview(1).YSize == 1024
     assert vrt_band.GetOverview(2).XSize == 1024
     assert vrt_band.GetOverview(2).YSize == 512
+
+
+###############################################################################
+# Test reading sources from several threads in IRasterIO()
+
+
+@pytest.mark.parametrize("overlapping", [False, True])
+def test_vrt_read_multithreaded_sources(overlapping):
+
+    src_ds = gdal.Open("data/byte.tif")
+    if overlapping:
+        srcwins = [(0, 0, 12, 12), (8, 0, 12, 12), (0, 8, 12, 12), (8, 8, 12, 12)]
+    else:
+        srcwins = [(0, 0, 10, 10), (10, 0, 10, 10), (0, 10, 10, 10), (10, 10, 10, 10)]
+    tile_ds = [
+        gdal.Translate("", src_ds, options="-of MEM -srcwin %d %d %d %d" % srcwin)
+        for srcwin in srcwins
+    ]
+    vrt_ds = gdal.BuildVRT("", tile_ds)
+
+    expected = vrt_ds.ReadRaster()
+    expected_half_res = vrt_ds.ReadRaster(buf_xsize=10, buf_ysize=10)
+    expected_subwin = vrt_ds.ReadRaster(5, 5, 10, 10)
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        assert vrt_ds.ReadRaster() == expected
+        assert vrt_ds.ReadRaster(buf_xsize=10, buf_ysize=10) == expected_half_res
+        assert vrt_ds.ReadRaster(5, 5, 10, 10) == expected_subwin
+    assert expected == src_ds.ReadRaster()
+
+
+###############################################################################
+# Test the spatial index over sources used for mosaics with many sources
+
+
+@pytest.mark.require_geos
+def test_vrt_read_many_sources_spatial_index():
+
+    src_ds = gdal.Open("data/byte.tif")
+    tile_ds = [
+        gdal.Translate("", src_ds, options="-of MEM -srcwin %d %d 2 2" % (x, y))
+        for y in range(0, 20, 2)
+        for x in range(0, 20, 2)
+    ]
+    vrt_ds = gdal.BuildVRT("", tile_ds)
+    assert vrt_ds.GetRasterBand(1).GetMetadata("vrt_sources")
+    assert len(vrt_ds.GetRasterBand(1).GetMetadata("vrt_sources")) == 100
+
+    assert vrt_ds.ReadRaster() == src_ds.ReadRaster()
+    for xoff, yoff, xsize, ysize in [(0, 0, 1, 1), (3, 5, 7, 4), (19, 19, 1, 1)]:
+        assert vrt_ds.ReadRaster(xoff, yoff, xsize, ysize) == src_ds.ReadRaster(
+            xoff, yoff, xsize, ysize
+        )
+        assert vrt_ds.GetRasterBand(1).ReadRaster(
+            xoff, yoff, xsize, ysize
+        ) == src_ds.GetRasterBand(1).ReadRaster(xoff, yoff, xsize, ysize)
+
+    # Adding a source afterwards must be taken into account
+    vrt_ds.GetRasterBand(1).SetMetadataItem(
+        "source_100",
+        """<SimpleSource>
+             <SourceFilename>data/byte.tif</SourceFilename>
+             <SourceBand>1</SourceBand>
+             <SrcRect xOff="0" yOff="0" xSize="20" ySize="20" />
+             <DstRect xOff="0" yOff="0" xSize="20" ySize="20" />
+           </SimpleSource>""",
+        "new_vrt_sources",
+    )
+    assert vrt_ds.GetRasterBand(1).ReadRaster(3, 5, 7, 4) == src_ds.GetRasterBand(
+        1
+    ).ReadRaster(3, 5, 7, 4)
+
+    flags, pct = vrt_ds.GetRasterBand(1).GetDataCoverageStatus(3, 5, 7, 4)
+    assert flags == gdal.GDAL_DATA_COVERAGE_STATUS_DATA and pct == 100.0
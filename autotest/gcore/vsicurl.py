@@ -28,6 +28,7 @@
 # DEALINGS IN THE SOFTWARE.
 ###############################################################################
 
+import json
 import sys
 import time
 
@@ -621,6 +622,56 @@ def test_vsicurl_test_retry(server):
             gdal.VSIFCloseL(f)
 
 
+###############################################################################
+# Test VSIGetIOStatistics()
+
+
+def test_vsicurl_io_statistics(server):
+
+    gdal.VSICurlClearCache()
+    gdal.NetworkStatsReset()
+
+    handler = webserver.SequentialHandler()
+    handler.add("GET", "/test_io_statistics/", 404)
+    handler.add("HEAD", "/test_io_statistics/test.txt", 200, {"Content-Length": "3"})
+    handler.add("GET", "/test_io_statistics/test.txt", 502)
+    handler.add("GET", "/test_io_statistics/test.txt", 200, {}, "foo")
+    with webserver.install_http_handler(handler), gdaltest.config_option(
+        "CPL_VSIL_NETWORK_STATS_ENABLED", "YES", thread_local=False
+    ):
+        f = gdal.VSIFOpenL(
+            "/vsicurl?max_retry=1&retry_delay=0.01&url=http://localhost:%d/test_io_statistics/test.txt"
+            % server.port,
+            "rb",
+        )
+        assert f is not None
+        try:
+            with gdal.quiet_errors():
+                assert gdal.VSIFReadL(1, 3, f) == b"foo"
+            gdal.VSIFSeekL(f, 1, 0)
+            assert gdal.VSIFReadL(1, 2, f) == b"oo"
+        finally:
+            gdal.VSIFCloseL(f)
+
+    j = json.loads(gdal.GetIOStatistics())
+    stats = j["handlers"]["vsicurl"]
+    assert j["retry_count"] == 1
+    assert stats["read"] == {"count": 2, "bytes": 5}
+    assert stats["cache"] == {"hit_count": 1, "hit_bytes": 2}
+    assert stats["methods"]["GET"]["downloaded_bytes"] == 3
+    assert stats["latency"]["request_count"] == 4
+    assert sum(stats["latency"]["histogram_ms"].values()) == 4
+
+    assert json.loads(gdal.GetIOStatistics("/vsicurl/")) == stats
+    assert json.loads(gdal.GetIOStatistics("/vsis3/")) == {"methods": {}}
+
+    # Extended statistics are not reported by NetworkStatsGetAsSerializedJSON()
+    assert "latency" not in json.loads(gdal.NetworkStatsGetAsSerializedJSON())
+
+    gdal.NetworkStatsReset()
+    gdal.VSICurlClearCache()
+
+
 ###############################################################################
 
 
@@ -1272,3 +1323,203 @@ def test_vsicurl_404_repeated_same_resource(server):
 
     with pytest.raises(Exception, match="404"):
         gdal.Open("/vsicurl/http://localhost:%d/does/not/exist.bin" % server.port)
+
+
+###############################################################################
+# Test CPL_VSIL_CURL_DISK_CACHE_DIR
+
+
+def test_vsicurl_disk_cache(server, tmp_path):
+
+    gdal.VSICurlClearCache()
+
+    url = "/vsicurl/http://localhost:%d/test_disk_cache/test.txt" % server.port
+
+    def read(handler):
+        with webserver.install_http_handler(handler):
+            f = gdal.VSIFOpenL(url, "rb")
+            assert f is not None
+            try:
+                return gdal.VSIFReadL(1, 3, f).decode("ascii")
+            finally:
+                gdal.VSIFCloseL(f)
+
+    with gdaltest.config_option("CPL_VSIL_CURL_DISK_CACHE_DIR", str(tmp_path)):
+        handler = webserver.SequentialHandler()
+        handler.add("GET", "/test_disk_cache/", 404)
+        handler.add(
+            "HEAD",
+            "/test_disk_cache/test.txt",
+            200,
+            {"Content-Length": "3", "ETag": '"first"'},
+        )
+        handler.add("GET", "/test_disk_cache/test.txt", 200, {}, "foo")
+        assert read(handler) == "foo"
+
+        # Simulate a new process: no network access for the content
+        gdal.VSICurlClearCache()
+        handler = webserver.SequentialHandler()
+        handler.add("GET", "/test_disk_cache/", 404)
+        handler.add(
+            "HEAD",
+            "/test_disk_cache/test.txt",
+            200,
+            {"Content-Length": "3", "ETag": '"first"'},
+        )
+        assert read(handler) == "foo"
+
+        # Remote file has changed
+        gdal.VSICurlClearCache()
+        handler = webserver.SequentialHandler()
+        handler.add("GET", "/test_disk_cache/", 404)
+        handler.add(
+            "HEAD",
+            "/test_disk_cache/test.txt",
+            200,
+            {"Content-Length": "3", "ETag": '"second"'},
+        )
+        handler.add("GET", "/test_disk_cache/test.txt", 200, {}, "bar")
+        assert read(handler) == "bar"
+
+    gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test adaptive read-ahead for large sequential reads
+
+
+@pytest.mark.parametrize("adaptive_read_ahead", ["YES", "NO"])
+def test_vsicurl_adaptive_read_ahead(server, adaptive_read_ahead):
+
+    gdal.VSICurlClearCache()
+
+    data = bytes(i % 251 for i in range(6 * 1024 * 1024))
+
+    class RangeHandler:
+        def final_check(self):
+            pass
+
+        def do_HEAD(self, request):
+            request.send_response(200)
+            request.send_header("Content-Length", len(data))
+            request.end_headers()
+
+        def do_GET(self, request):
+            if request.path != "/test_adaptive_read_ahead/test.bin":
+                request.send_response(404)
+                request.send_header("Content-Length", 0)
+                request.end_headers()
+                return
+            start, end = request.headers["Range"][len("bytes=") :].split("-")
+            start = int(start)
+            end = min(int(end), len(data) - 1)
+            request.send_response(206)
+            request.send_header(
+                "Content-Range", "bytes %d-%d/%d" % (start, end, len(data))
+            )
+            request.send_header("Content-Length", end - start + 1)
+            request.end_headers()
+            request.wfile.write(data[start : end + 1])
+
+    with webserver.install_http_handler(RangeHandler()), gdaltest.config_option(
+        "CPL_VSIL_CURL_ADAPTIVE_READ_AHEAD", adaptive_read_ahead
+    ):
+        f = gdal.VSIFOpenL(
+            "/vsicurl/http://localhost:%d/test_adaptive_read_ahead/test.bin"
+            % server.port,
+            "rb",
+        )
+        assert f is not None
+        try:
+            got = b""
+            while True:
+                chunk = gdal.VSIFReadL(1, 100000, f)
+                got += chunk
+                if len(chunk) < 100000:
+                    break
+        finally:
+            gdal.VSIFCloseL(f)
+
+    assert got == data
+
+    gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test parallel reads from several threads, with and without the process-wide
+# connection pool
+
+
+@pytest.mark.parametrize("shared_connection_pool", ["YES", "NO"])
+def test_vsicurl_parallel_reads_shared_connection_pool(server, shared_connection_pool):
+
+    gdal.VSICurlClearCache()
+
+    nfiles = 8
+    contents = [bytes((i + j) % 251 for j in range(10000)) for i in range(nfiles)]
+
+    class ParallelHandler:
+        def final_check(self):
+            pass
+
+        def _get_data(self, request):
+            prefix = "/test_parallel_reads/file_"
+            if not request.path.startswith(prefix) or not request.path.endswith(
+                ".bin"
+            ):
+                return None
+            return contents[int(request.path[len(prefix) : -len(".bin")])]
+
+        def do_HEAD(self, request):
+            data = self._get_data(request)
+            request.send_response(200 if data is not None else 404)
+            request.send_header("Content-Length", len(data) if data else 0)
+            request.end_headers()
+
+        def do_GET(self, request):
+            data = self._get_data(request)
+            if data is None:
+                request.send_response(404)
+                request.send_header("Content-Length", 0)
+                request.end_headers()
+                return
+            if "Range" in request.headers:
+                start, end = request.headers["Range"][len("bytes=") :].split("-")
+                start = int(start)
+                end = min(int(end), len(data) - 1)
+                request.send_response(206)
+                request.send_header(
+                    "Content-Range", "bytes %d-%d/%d" % (start, end, len(data))
+                )
+            else:
+                start = 0
+                end = len(data) - 1
+                request.send_response(200)
+            request.send_header("Content-Length", end - start + 1)
+            request.end_headers()
+            request.wfile.write(data[start : end + 1])
+
+    def read_file(i):
+        f = gdal.VSIFOpenL(
+            "/vsicurl/http://localhost:%d/test_parallel_reads/file_%d.bin"
+            % (server.port, i),
+            "rb",
+        )
+        if f is None:
+            return None
+        try:
+            return gdal.VSIFReadL(1, len(contents[i]), f)
+        finally:
+            gdal.VSIFCloseL(f)
+
+    from concurrent.futures import ThreadPoolExecutor
+
+    with webserver.install_http_handler(ParallelHandler()), gdaltest.config_option(
+        "GDAL_HTTP_SHARED_CONNECTION_POOL", shared_connection_pool
+    ):
+        with ThreadPoolExecutor(max_workers=4) as executor:
+            got = list(executor.map(read_file, range(nfiles)))
+
+    assert got == contents
+
+    gdal.VSICurlClearCache()
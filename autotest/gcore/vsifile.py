@@ -879,6 +879,119 @@ def test_vsigzip_multi_thread():
         pytest.fail()
 
 
+###############################################################################
+# Test multithreaded decompression of BGZF files
+
+
+def _create_bgzf(data, block_size=65280):
+    import struct
+    import zlib
+
+    def block(chunk):
+        c = zlib.compressobj(6, zlib.DEFLATED, -15)
+        cdata = c.compress(chunk) + c.flush()
+        header = struct.pack(
+            "<4BI2BH2BHH",
+            0x1F,
+            0x8B,
+            8,
+            4,
+            0,
+            0,
+            0xFF,
+            6,
+            ord("B"),
+            ord("C"),
+            2,
+            18 + len(cdata) + 8 - 1,
+        )
+        return header + cdata + struct.pack("<II", zlib.crc32(chunk), len(chunk))
+
+    out = b""
+    for i in range(0, len(data), block_size):
+        out += block(data[i : i + block_size])
+    # End-of-file marker
+    out += block(b"")
+    return out
+
+
+def test_vsigzip_bgzf_multi_thread(tmp_vsimem):
+
+    data = b"".join(b"line %d\n" % i for i in range(200000))
+    filename = str(tmp_vsimem / "test.gz")
+    gdal.FileFromMemBuffer(filename, _create_bgzf(data))
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        assert gdal.VSIStatL("/vsigzip/" + filename).size == len(data)
+        assert gdal.VSIStatL(filename + ".gzi") is not None
+
+        for _ in range(2):
+            f = gdal.VSIFOpenL("/vsigzip/" + filename, "rb")
+            assert f
+            try:
+                assert gdal.VSIFReadL(1, len(data) + 1, f) == data
+                assert gdal.VSIFEofL(f)
+
+                for offset, size in [
+                    (100000, 200000),
+                    (65279, 2),
+                    (0, 10),
+                    (len(data) - 5, 10),
+                ]:
+                    gdal.VSIFSeekL(f, offset, 0)
+                    assert gdal.VSIFReadL(1, size, f) == data[offset : offset + size]
+            finally:
+                gdal.VSIFCloseL(f)
+
+        # Corrupted index: ignored, and rebuilt
+        gdal.FileFromMemBuffer(filename + ".gzi", b"\xff" * 8)
+        f = gdal.VSIFOpenL("/vsigzip/" + filename, "rb")
+        assert f
+        gdal.VSIFSeekL(f, 1000000, 0)
+        assert gdal.VSIFReadL(1, 10, f) == data[1000000:1000010]
+        gdal.VSIFCloseL(f)
+
+
+###############################################################################
+# Test /vsizstd/
+
+
+@pytest.mark.skipif(
+    "/vsizstd/" not in gdal.GetFileSystemsPrefixes(), reason="zstd not available"
+)
+@pytest.mark.parametrize("num_threads", [None, "4"])
+@pytest.mark.parametrize(
+    "filename", ["data/test.txt.zst", "data/test_seekable.txt.zst"]
+)
+def test_vsizstd(filename, num_threads):
+
+    data = b"".join(b"line %d\n" % i for i in range(20000))
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", num_threads):
+        assert gdal.VSIStatL("/vsizstd/" + filename).size == len(data)
+
+        f = gdal.VSIFOpenL("/vsizstd/" + filename, "rb")
+        assert f
+        try:
+            assert gdal.VSIFReadL(1, len(data) + 1, f) == data
+            assert gdal.VSIFEofL(f)
+
+            for offset, size in [
+                (100000, 50000),
+                (16383, 2),
+                (0, 10),
+                (len(data) - 5, 10),
+            ]:
+                gdal.VSIFSeekL(f, offset, 0)
+                assert gdal.VSIFReadL(1, size, f) == data[offset : offset + size]
+        finally:
+            gdal.VSIFCloseL(f)
+
+    with gdal.quiet_errors():
+        assert gdal.VSIFOpenL("/vsizstd/" + filename, "wb") is None
+        assert gdal.VSIFOpenL("/vsizstd/data/byte.tif", "rb") is None
+
+
 ###############################################################################
 # Test vsisync()
 
@@ -2956,6 +2956,70 @@ def test_vsis3_write_multipart_retry(aws_test_config, webserver_port):
                 gdal.VSIFCloseL(f)
 
 
+###############################################################################
+# Test multipart upload with parts uploaded in the background
+
+
+def test_vsis3_write_multipart_upload_concurrency(aws_test_config, webserver_port):
+
+    with gdaltest.config_options(
+        {"VSIS3_CHUNK_SIZE": "1", "CPL_VSIS3_UPLOAD_CONCURRENCY": "2"},
+        thread_local=False,
+    ):
+        with webserver.install_http_handler(webserver.SequentialHandler()):
+            f = gdal.VSIFOpenL("/vsis3/s3_fake_bucket4/upload_concurrency.bin", "wb")
+        assert f is not None
+
+        nparts = 4
+        size = (nparts - 1) * 1024 * 1024 + 1
+
+        handler = webserver.NonSequentialMockedHttpHandler()
+        response = """<?xml version="1.0" encoding="UTF-8"?>
+        <InitiateMultipartUploadResult>
+        <UploadId>my_id</UploadId>
+        </InitiateMultipartUploadResult>"""
+        handler.add(
+            "POST",
+            "/s3_fake_bucket4/upload_concurrency.bin?uploads",
+            200,
+            {"Content-type": "application/xml", "Content-Length": len(response)},
+            response,
+        )
+        expected_body = "<CompleteMultipartUpload>\n"
+        for i in range(1, nparts + 1):
+            handler.add(
+                "PUT",
+                "/s3_fake_bucket4/upload_concurrency.bin?partNumber=%d&uploadId=my_id"
+                % i,
+                200,
+                {"ETag": '"etag%d"' % i, "Content-Length": "0"},
+                b"",
+                expected_headers={
+                    "Content-Length": "1" if i == nparts else "1048576"
+                },
+            )
+            expected_body += (
+                '<Part>\n<PartNumber>%d</PartNumber><ETag>"etag%d"</ETag></Part>\n'
+                % (i, i)
+            )
+        expected_body += "</CompleteMultipartUpload>\n"
+        handler.add(
+            "POST",
+            "/s3_fake_bucket4/upload_concurrency.bin?uploadId=my_id",
+            200,
+            {},
+            b"",
+            expected_headers={"Content-Length": str(len(expected_body))},
+            expected_body=expected_body.encode("ascii"),
+        )
+
+        with webserver.install_http_handler(handler):
+            assert gdal.VSIFWriteL("a" * size, 1, size, f) == size
+            gdal.ErrorReset()
+            assert gdal.VSIFCloseL(f) == 0
+            assert gdal.GetLastErrorMsg() == ""
+
+
 ###############################################################################
 # Test abort pending multipart uploads
 
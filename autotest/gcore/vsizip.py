@@ -977,3 +977,56 @@ def test_vsizip_sozip_of_file_bigger_than_4GB():
         assert gdal.VSIFReadL(1, 2, f) == b"\x00"
     finally:
         gdal.VSIFCloseL(f)
+
+
+###############################################################################
+# Test reading a STORED member, and that cached member properties are
+# invalidated when the archive is modified
+
+
+def test_vsizip_stored_member(tmp_vsimem):
+
+    import io
+    import zipfile
+
+    data = open("data/byte.tif", "rb").read()
+
+    def create_zip(members):
+        out = io.BytesIO()
+        with zipfile.ZipFile(out, "w", compression=zipfile.ZIP_STORED) as z:
+            for name, content in members:
+                z.writestr(name, content)
+        return out.getvalue()
+
+    zipfilename = str(tmp_vsimem / "test_vsizip_stored_member.zip")
+    dstfilename = f"/vsizip/{zipfilename}/test.tif"
+    gdal.FileFromMemBuffer(zipfilename, create_zip([("test.tif", data)]))
+
+    for _ in range(2):
+        f = gdal.VSIFOpenL(dstfilename, "rb")
+        assert f
+        try:
+            assert gdal.VSIFReadL(1, len(data) + 1, f) == data
+            assert gdal.VSIFEofL(f)
+            assert gdal.VSIFSeekL(f, 0, 2) == 0
+            assert gdal.VSIFTellL(f) == len(data)
+            assert gdal.VSIFSeekL(f, 100, 0) == 0
+            assert gdal.VSIFReadL(1, 10, f) == data[100:110]
+        finally:
+            gdal.VSIFCloseL(f)
+
+    ds = gdal.Open(dstfilename)
+    assert ds.GetRasterBand(1).Checksum() == 4672
+    ds = None
+
+    # Rewrite the archive with the member at a different offset
+    gdal.FileFromMemBuffer(
+        zipfilename, create_zip([("first.txt", b"x" * 1000), ("test.tif", data)])
+    )
+
+    f = gdal.VSIFOpenL(dstfilename, "rb")
+    assert f
+    try:
+        assert gdal.VSIFReadL(1, len(data), f) == data
+    finally:
+        gdal.VSIFCloseL(f)
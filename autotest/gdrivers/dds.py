@@ -60,6 +60,29 @@ def test_dds(compression, checksums):
     ] == checksums
 
 
+
+@pytest.mark.parametrize("num_threads", ["1", "3", "ALL_CPUS"])
+@pytest.mark.parametrize("band_count", [3, 4])
+def test_dds_num_threads(tmp_vsimem, num_threads, band_count):
+    src_ds = gdal.Translate(
+        "",
+        "../gcore/data/stefan_full_rgba.tif",
+        format="MEM",
+        bandList=list(range(1, band_count + 1)),
+    )
+    ref_ds = gdal.GetDriverByName("DDS").CreateCopy(
+        str(tmp_vsimem / "ref.dds"), src_ds, options=["FORMAT=DXT1"]
+    )
+    ds = gdal.GetDriverByName("DDS").CreateCopy(
+        str(tmp_vsimem / "out.dds"),
+        src_ds,
+        options=["FORMAT=DXT1", "NUM_THREADS=" + num_threads],
+    )
+    assert [ds.GetRasterBand(i + 1).Checksum() for i in range(ds.RasterCount)] == [
+        ref_ds.GetRasterBand(i + 1).Checksum() for i in range(ref_ds.RasterCount)
+    ]
+
+
 def test_dds_no_compression():
     ref_ds = gdal.Open("../gcore/data/stefan_full_rgba.tif")
     ds = gdal.Open("data/dds/stefan_full_rgba_no_compression.dds")
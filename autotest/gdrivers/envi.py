@@ -938,6 +938,14 @@ def test_envi_read_direct_access(byte_order):
         buf_band_space=2,
     )
 
+    # Using optimization, with deinterleaving into a band-sequential buffer
+    assert ds.ReadRaster(buf_type=gdal.GDT_UInt16) == src_ds.ReadRaster(
+        buf_type=gdal.GDT_UInt16
+    )
+    assert ds.ReadRaster(1, 2, 3, 4, buf_type=gdal.GDT_UInt16) == src_ds.ReadRaster(
+        1, 2, 3, 4, buf_type=gdal.GDT_UInt16
+    )
+
     # Non-optimized (at time of writing...)
 
     # buffer type != native data type
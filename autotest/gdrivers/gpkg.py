@@ -4298,3 +4298,58 @@ def test_gpkg_gti_gpkg_ext(tmp_vsimem):
     ds = gdal.Open(filename)
     assert ds.GetDriver().ShortName == "GPKG"
     assert ds.GetRasterBand(1).Checksum() == 4672
+
+
+###############################################################################
+# Test encoding tiles in worker threads
+
+
+@pytest.mark.parametrize(
+    "tile_format", ["PNG", "JPEG", "PNG_JPEG", "PNG8", "WEBP"]
+)
+def test_gpkg_multithreaded_tile_encoding(tmp_vsimem, tile_format):
+
+    tile_drv_name = "PNG" if tile_format in ("PNG_JPEG", "PNG8") else tile_format
+    if gdal.GetDriverByName(tile_drv_name) is None:
+        pytest.skip(f"Driver {tile_drv_name} not available.")
+
+    src_ds = gdal.Translate(
+        "", "data/small_world.tif", format="MEM", bandList=[1, 2, 3, 3]
+    )
+    # Fully transparent tile, that should not be written
+    src_ds.GetRasterBand(4).Fill(255)
+    src_ds.GetRasterBand(4).WriteRaster(0, 0, 64, 64, b"\0" * (64 * 64))
+    if tile_format in ("JPEG", "PNG8"):
+        src_ds = gdal.Translate("", src_ds, format="MEM", bandList=[1, 2, 3])
+
+    options = [f"TILE_FORMAT={tile_format}", "BLOCKSIZE=64"]
+
+    def create(filename):
+        gdal.Translate(filename, src_ds, format="GPKG", creationOptions=options)
+        with gdal.Open(filename, gdal.GA_Update) as ds:
+            ds.BuildOverviews("AVERAGE", [2, 4])
+        with gdal.Open(filename) as ds:
+            band = ds.GetRasterBand(1)
+            return (
+                [ds.GetRasterBand(i + 1).Checksum() for i in range(ds.RasterCount)],
+                [
+                    band.GetOverview(i).Checksum()
+                    for i in range(band.GetOverviewCount())
+                ],
+            )
+
+    ref_filename = str(tmp_vsimem / "ref.gpkg")
+    expected = create(ref_filename)
+
+    filename = str(tmp_vsimem / "test.gpkg")
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        assert create(filename) == expected
+
+    ds = ogr.Open(filename)
+    sql_lyr = ds.ExecuteSQL("SELECT COUNT(*) FROM test")
+    count = sql_lyr.GetNextFeature().GetField(0)
+    ds.ReleaseResultSet(sql_lyr)
+    ds = ogr.Open(ref_filename)
+    sql_lyr = ds.ExecuteSQL("SELECT COUNT(*) FROM ref")
+    assert sql_lyr.GetNextFeature().GetField(0) == count
+    ds.ReleaseResultSet(sql_lyr)
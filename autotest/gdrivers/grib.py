@@ -2252,6 +2252,45 @@ def test_grib_grib2_sidecar():
             ) == ds_idx.GetRasterBand(i).GetMetadataItem(key)
 
 
+###############################################################################
+# Test ELEMENTS and LEVELS open options, and multi-band reads
+
+
+@pytest.mark.parametrize("use_idx", [True, False])
+def test_grib_grib2_open_options_elements_levels(use_idx):
+
+    filename = "data/grib/gfs.t06z.pgrb2.10p0.f010.grib2"
+    open_options = ["USE_IDX=YES"] if use_idx else ["USE_IDX=NO"]
+    ds_ref = gdal.OpenEx(filename, open_options=open_options)
+
+    ds = gdal.OpenEx(filename, open_options=open_options + ["ELEMENTS=REFD,vgrd"])
+    assert ds.RasterCount == 3
+    assert [
+        ds.GetRasterBand(i + 1).GetMetadataItem("GRIB_ELEMENT") for i in range(3)
+    ] == ["REFD", "REFD", "VGRD"]
+    assert ds.GetRasterBand(3).Checksum() == ds_ref.GetRasterBand(6).Checksum()
+    assert ds.GetRasterBand(3).GetMetadataItem(
+        "GRIB_PDS_TEMPLATE_ASSEMBLED_VALUES"
+    ) == ds_ref.GetRasterBand(6).GetMetadataItem("GRIB_PDS_TEMPLATE_ASSEMBLED_VALUES")
+
+    # Multi-band read, going through the prefetching of messages
+    assert ds.ReadRaster() == ds_ref.ReadRaster(band_list=[1, 2, 6])
+
+    if use_idx:
+        ds = gdal.OpenEx(
+            filename,
+            open_options=open_options
+            + ["ELEMENTS=UGRD,VGRD", "LEVELS=planetary boundary layer"],
+        )
+        assert ds.RasterCount == 2
+        assert ds.GetRasterBand(1).GetMetadataItem("GRIB_ELEMENT") == "UGRD"
+        assert ds.GetRasterBand(2).GetMetadataItem("GRIB_ELEMENT") == "VGRD"
+        assert ds.ReadRaster() == ds_ref.ReadRaster(band_list=[5, 6])
+
+    with pytest.raises(Exception, match="No message"):
+        gdal.OpenEx(filename, open_options=open_options + ["ELEMENTS=i_do_not_exist"])
+
+
 # Test reading a (broken) mix of GRIBv2/GRIBv1 bands
 
 
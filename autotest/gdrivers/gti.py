@@ -1054,6 +1054,73 @@ def test_gti_rgb_left_right(tmp_vsimem):
     )
 
 
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_gti_multithreaded_sources(tmp_vsimem, num_threads):
+
+    src_ds = gdal.Open("data/small_world.tif")
+
+    # 4 non-overlapping tiles, plus one tile overlapping the 2 top ones and
+    # with the highest priority
+    tiles = []
+    for xoff, yoff in [(0, 0), (200, 0), (0, 100), (200, 100)]:
+        filename = str(tmp_vsimem / f"tile_{xoff}_{yoff}.tif")
+        gdal.Translate(filename, src_ds, srcWin=[xoff, yoff, 200, 100])
+        tiles.append(gdal.Open(filename))
+    filename = str(tmp_vsimem / "center.tif")
+    gdal.Translate(
+        filename, src_ds, srcWin=[150, 20, 100, 50], scaleParams=[[0, 255, 0, 0]]
+    )
+    tiles.append(gdal.Open(filename))
+
+    index_filename = str(tmp_vsimem / "index.gti.gpkg")
+    index_ds, _ = create_basic_tileindex(
+        index_filename,
+        tiles,
+        sort_field_name="z_order",
+        sort_field_type=ogr.OFTInteger,
+        sort_values=[5, 4, 3, 2, 10],
+    )
+    del index_ds
+
+    expected_ds = gdal.GetDriverByName("MEM").CreateCopy("", src_ds)
+    for i in range(3):
+        expected_ds.GetRasterBand(i + 1).WriteRaster(
+            150, 20, 100, 50, b"\x00" * (100 * 50)
+        )
+
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+        vrt_ds = gdal.Open(index_filename)
+        assert vrt_ds.ReadRaster() == expected_ds.ReadRaster()
+        assert (
+            vrt_ds.GetMetadataItem("NUMBER_OF_CONTRIBUTING_SOURCES", "__DEBUG__")
+            == "5"
+        )
+        assert vrt_ds.ReadRaster(100, 0, 200, 200, 100, 100) == expected_ds.ReadRaster(
+            100, 0, 200, 200, 100, 100
+        )
+
+
+def test_gti_source_cache_size(tmp_vsimem):
+
+    src_ds = gdal.Open("data/small_world.tif")
+
+    tiles = []
+    for xoff in range(0, 400, 100):
+        filename = str(tmp_vsimem / f"tile_{xoff}.tif")
+        gdal.Translate(filename, src_ds, srcWin=[xoff, 0, 100, 200])
+        tiles.append(gdal.Open(filename))
+
+    index_filename = str(tmp_vsimem / "index.gti.gpkg")
+    index_ds, _ = create_basic_tileindex(index_filename, tiles)
+    del index_ds
+
+    with gdal.config_option("GTI_SOURCE_CACHE_SIZE", "1"):
+        vrt_ds = gdal.Open(index_filename)
+    assert vrt_ds.ReadRaster() == src_ds.ReadRaster()
+    assert vrt_ds.ReadRaster(0, 0, 100, 200) == src_ds.ReadRaster(0, 0, 100, 200)
+    assert vrt_ds.ReadRaster() == src_ds.ReadRaster()
+
+
 def test_gti_overlapping_sources(tmp_vsimem):
 
     filename1 = str(tmp_vsimem / "one.tif")
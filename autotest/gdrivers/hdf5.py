@@ -1591,6 +1591,52 @@ END
     )
 
 
+###############################################################################
+# Test reading chunks with H5Dread_chunk() and decoding them with GDAL
+
+
+@pytest.mark.require_driver("netCDF")
+@pytest.mark.parametrize("num_threads", [None, "4"])
+def test_hdf5_direct_chunk_read(tmp_path, num_threads):
+
+    fname = str(tmp_path / "test.nc")
+    nz, ny, nx = 2, 20, 15
+
+    # The netCDF driver creates shuffle + deflate compressed variables
+    ds = gdal.GetDriverByName("netCDF").CreateMultiDimensional(fname)
+    rg = ds.GetRootGroup()
+    dimz = rg.CreateDimension("z", None, None, nz)
+    dimy = rg.CreateDimension("y", None, None, ny)
+    dimx = rg.CreateDimension("x", None, None, nx)
+    ar = rg.CreateMDArray(
+        "v",
+        [dimz, dimy, dimx],
+        gdal.ExtendedDataType.Create(gdal.GDT_Int32),
+        ["BLOCKSIZE=1,8,8", "COMPRESS=DEFLATE"],
+    )
+    values = array.array("i", [i * 7919 for i in range(nz * ny * nx)])
+    assert ar.Write(values.tobytes()) == gdal.CE_None
+    ds = None
+
+    def expected(z):
+        return values[z * ny * nx : (z + 1) * ny * nx].tobytes()
+
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+        ds = gdal.Open(f'HDF5:"{fname}"://v')
+        assert ds.RasterCount == nz
+        assert ds.GetRasterBand(1).GetBlockSize() == [8, 8]
+        for z in range(nz):
+            band = ds.GetRasterBand(z + 1)
+            assert band.ReadRaster() == expected(z)
+            assert band.ReadBlock(0, 1) == band.ReadRaster(0, 8, 8, 8)
+        ds = None
+
+    with gdal.config_option("HDF5_DIRECT_CHUNK_READ", "NO"):
+        ds = gdal.Open(f'HDF5:"{fname}"://v')
+        for z in range(nz):
+            assert ds.GetRasterBand(z + 1).ReadRaster() == expected(z)
+
+
 ###############################################################################
 # Test GetNoDataValue(), GetOffset(), GetScale()
 
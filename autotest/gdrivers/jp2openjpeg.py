@@ -465,6 +465,34 @@ def test_jp2openjpeg_15(JP2OPENJPEG_USE_THREADED_IO):
     assert got_data == data
 
 
+###############################################################################
+# Test that repeated multi-threaded reads of several tiles, which reuse the
+# file handles of the worker threads, return consistent results
+
+
+def test_jp2openjpeg_multithreaded_read_repeated(tmp_vsimem):
+
+    src_ds = gdal.Open("data/byte.tif")
+    filename = str(tmp_vsimem / "test.jp2")
+    gdaltest.jp2openjpeg_drv.CreateCopy(
+        filename,
+        src_ds,
+        options=["BLOCKXSIZE=8", "BLOCKYSIZE=8", "REVERSIBLE=YES", "QUALITY=100"],
+    )
+    ref_data = src_ds.ReadRaster()
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        ds = gdal.Open(filename)
+        for _ in range(3):
+            assert ds.ReadRaster() == ref_data
+            assert ds.ReadRaster(3, 5, 11, 13) == src_ds.ReadRaster(3, 5, 11, 13)
+            # Drop the cached blocks so that the next iteration decodes again
+            ds.FlushCache()
+            assert ds.GetRasterBand(1).Checksum() == 4672
+            ds.FlushCache()
+    ds = None
+
+
 ###############################################################################
 # Test reading PixelIsPoint file (#5437)
 
@@ -293,6 +293,37 @@ def test_mem_5():
     ds = None
 
 
+###############################################################################
+# Test USE_HUGE_PAGES and NUM_THREADS creation options
+
+
+@pytest.mark.parametrize("interleave", ["BAND", "PIXEL"])
+@pytest.mark.parametrize(
+    "options",
+    [
+        ["USE_HUGE_PAGES=YES"],
+        ["NUM_THREADS=4"],
+        ["USE_HUGE_PAGES=YES", "NUM_THREADS=3"],
+    ],
+)
+def test_mem_create_allocation_options(interleave, options):
+
+    drv = gdal.GetDriverByName("MEM")
+
+    with gdal.quiet_errors():
+        ds = drv.Create("", 101, 103, 3, options=["INTERLEAVE=" + interleave] + options)
+    for i in range(3):
+        assert ds.GetRasterBand(i + 1).Checksum() == 0
+
+    ds.GetRasterBand(2).Fill(255)
+    assert [ds.GetRasterBand(i + 1).ComputeRasterMinMax() for i in range(3)] == [
+        (0, 0),
+        (255, 255),
+        (0, 0),
+    ]
+    ds = None
+
+
 ###############################################################################
 # Test out-of-memory situations
 
@@ -666,6 +666,54 @@ def test_mem_md_copy_array():
     assert copy_myarray.Read() == data
 
 
+###############################################################################
+# Test CopyFrom() writing a chunk while the next one is read
+
+
+def test_mem_md_copy_array_multithreaded():
+
+    drv = gdal.GetDriverByName("MEM")
+    ds = drv.CreateMultiDimensional("myds")
+    rg = ds.GetRootGroup()
+    dim0 = rg.CreateDimension("dim0", None, None, 20)
+    dim1 = rg.CreateDimension("dim1", None, None, 30)
+    dim2 = rg.CreateDimension("dim2", None, None, 51)
+    myarray = rg.CreateMDArray(
+        "myarray",
+        [dim0, dim1, dim2],
+        gdal.ExtendedDataType.Create(gdal.GDT_UInt32),
+    )
+
+    data = array.array("I", list(range(myarray.GetTotalElementsCount()))).tobytes()
+    assert myarray.Write(data) == gdal.CE_None
+
+    def my_cbk(pct, _, arg):
+        assert pct >= tab[0]
+        tab[0] = pct
+        return 1
+
+    tab = [0]
+    with gdaltest.config_options(
+        {"GDAL_SWATH_SIZE": str(10 * 1000), "GDAL_NUM_THREADS": "2"}
+    ):
+        copy_ds = drv.CreateCopy("", ds, callback=my_cbk, callback_data=tab)
+    assert tab[0] == 1
+    assert copy_ds
+    copy_myarray = copy_ds.GetRootGroup().OpenMDArray("myarray")
+    assert copy_myarray
+    assert copy_myarray.Read() == data
+
+    # Interruption through the progress callback
+    def interrupt_cbk(pct, _, arg):
+        return pct < 0.5
+
+    with gdaltest.config_options(
+        {"GDAL_SWATH_SIZE": str(10 * 1000), "GDAL_NUM_THREADS": "2"}
+    ):
+        with gdaltest.disable_exceptions(), gdal.quiet_errors():
+            assert drv.CreateCopy("", ds, callback=interrupt_cbk) is None
+
+
 def test_mem_md_array_read_write_errors():
 
     drv = gdal.GetDriverByName("MEM")
@@ -1859,6 +1907,64 @@ def test_mem_md_array_get_unscaled_3dim():
     assert myarray.Read() == data
 
 
+def test_mem_md_array_get_unscaled_3dim_nodata_non_native_buffer_datatype():
+
+    drv = gdal.GetDriverByName("MEM")
+    ds = drv.CreateMultiDimensional("myds")
+    rg = ds.GetRootGroup()
+    dim0 = rg.CreateDimension("dim0", None, None, 2)
+    dim1 = rg.CreateDimension("dim1", None, None, 3)
+    dim2 = rg.CreateDimension("dim2", None, None, 4)
+    myarray = rg.CreateMDArray(
+        "myarray", [dim0, dim1, dim2], gdal.ExtendedDataType.Create(gdal.GDT_Byte)
+    )
+    data = array.array("B", [i % 5 for i in range(24)]).tobytes()
+    assert myarray.Write(data) == gdal.CE_None
+    myarray.SetOffset(1)
+    myarray.SetScale(2)
+    myarray.SetNoDataValueDouble(1)
+
+    def unscale(x):
+        return float("nan") if x == 1 else x * 2 + 1
+
+    unscaled = myarray.GetUnscaled()
+    float32_dt = gdal.ExtendedDataType.Create(gdal.GDT_Float32)
+    got_data = struct.unpack("f" * 24, unscaled.Read(buffer_datatype=float32_dt))
+    expected_data = [unscale(x) for x in struct.unpack("B" * 24, data)]
+    for got, expected in zip(got_data, expected_data):
+        if math.isnan(expected):
+            assert math.isnan(got)
+        else:
+            assert got == expected
+
+    # Transposed buffer, with negative step
+    got_data = struct.unpack(
+        "f" * 12,
+        unscaled.Read(
+            array_start_idx=[1, 0, 3],
+            count=[1, 3, 4],
+            array_step=[1, 1, -1],
+            buffer_stride=[12, 1, 3],
+            buffer_datatype=float32_dt,
+        ),
+    )
+    for j in range(3):
+        for i in range(4):
+            got = got_data[i * 3 + j]
+            expected = unscale(data[12 + j * 4 + 3 - i])
+            if math.isnan(expected):
+                assert math.isnan(got)
+            else:
+                assert got == expected
+
+    int16_dt = gdal.ExtendedDataType.Create(gdal.GDT_Int16)
+    got_data = struct.unpack("h" * 24, unscaled.Read(buffer_datatype=int16_dt))
+    # NaN nodata converted to integer gives 0
+    assert list(got_data) == [
+        0 if x == 1 else x * 2 + 1 for x in struct.unpack("B" * 24, data)
+    ]
+
+
 def test_mem_md_array_get_unscaled_1dim_complex():
 
     drv = gdal.GetDriverByName("MEM")
@@ -425,6 +425,85 @@ def test_mrf_overview_external():
     cleanup()
 
 
+###############################################################################
+# Test reading a window of several tiles, with prefetched index and data
+
+
+@pytest.mark.parametrize(
+    "options",
+    [
+        ["COMPRESS=DEFLATE", "BLOCKSIZE=32"],
+        ["COMPRESS=DEFLATE", "BLOCKSIZE=32", "INTERLEAVE=PIXEL"],
+        ["COMPRESS=PNG", "BLOCKSIZE=64", "INTERLEAVE=PIXEL"],
+        ["COMPRESS=JPEG", "BLOCKSIZE=64", "INTERLEAVE=PIXEL"],
+        ["COMPRESS=NONE", "BLOCKSIZE=32"],
+    ],
+)
+def test_mrf_read_several_tiles(tmp_vsimem, options):
+
+    filename = str(tmp_vsimem / "out.mrf")
+    src_ds = gdal.Translate("", "data/rgbsmall.tif", format="MEM", width=200)
+    # Leave an empty tile
+    src_ds.WriteRaster(0, 0, 64, 64, b"\0" * (64 * 64 * 3))
+    gdal.Translate(filename, src_ds, format="MRF", creationOptions=options)
+
+    # Reference from band reads, block by block
+    with gdal.Open(filename) as ds:
+        expected = [ds.GetRasterBand(i + 1).ReadRaster() for i in range(3)]
+
+    with gdal.Open(filename) as ds:
+        assert ds.ReadRaster() == b"".join(expected)
+        assert ds.ReadRaster(10, 20, 150, 100, band_list=[2]) == ds.GetRasterBand(
+            2
+        ).ReadRaster(10, 20, 150, 100)
+        # Second read, partly from the block cache
+        assert ds.ReadRaster(band_list=[3, 1]) == expected[2] + expected[0]
+
+
+###############################################################################
+# Test the implicit overviews of a JPEG MRF, decoded at reduced resolution
+
+
+@pytest.mark.parametrize("interleave", ["PIXEL", "BAND"])
+def test_mrf_jpeg_implicit_overviews(tmp_vsimem, interleave):
+
+    filename = str(tmp_vsimem / "out.mrf")
+    gdal.Translate(
+        filename,
+        "data/rgbsmall.tif",
+        format="MRF",
+        width=512,
+        height=512,
+        creationOptions=["COMPRESS=JPEG", "INTERLEAVE=" + interleave],
+    )
+
+    # Reference from the full resolution
+    with gdal.config_option("MRF_IMPLICIT_JPEG_OVR", "NO"):
+        with gdal.Open(filename) as ds:
+            assert ds.GetRasterBand(1).GetOverviewCount() == 0
+            ref_ds = gdal.Translate(
+                "", ds, format="MEM", width=128, height=128, resampleAlg="average"
+            )
+
+    with gdal.Open(filename) as ds:
+        for i in range(3):
+            band = ds.GetRasterBand(i + 1)
+            assert band.GetOverviewCount() == 2
+            assert band.GetOverview(0).XSize == 256
+            assert band.GetOverview(0).YSize == 256
+            ovr = band.GetOverview(1)
+            assert (ovr.XSize, ovr.YSize) == (128, 128)
+            assert ovr.GetBlockSize() == [128, 128]
+            got = ovr.ReadRaster()
+            expected = ref_ds.GetRasterBand(i + 1).ReadRaster()
+            diff = sum(abs(x - y) for x, y in zip(got, expected))
+            assert diff / len(got) < 4, i
+
+    # Update mode doesn't use implicit overviews
+    with gdal.Open(filename, gdal.GA_Update) as ds:
+        assert ds.GetRasterBand(1).GetOverviewCount() == 0
+
+
 @pytest.mark.require_creation_option("MRF", "LERC")
 def test_mrf_lerc_nodata():
 
@@ -5601,6 +5601,46 @@ def test_netcdf_chunked_not_multiple():
     assert ds.GetRasterBand(1).Checksum() == 4672
 
 
+###############################################################################
+# Test reading the levels of a 3D variable chunked along z, where the levels
+# of a z chunk are read together
+
+
+def test_netcdf_read_levels_of_z_chunk(tmp_path):
+
+    fname = str(tmp_path / "test.nc")
+    nz, ny, nx = 5, 20, 15
+
+    ds = gdal.GetDriverByName("netCDF").CreateMultiDimensional(fname)
+    rg = ds.GetRootGroup()
+    dimz = rg.CreateDimension("z", None, None, nz)
+    dimy = rg.CreateDimension("y", None, None, ny)
+    dimx = rg.CreateDimension("x", None, None, nx)
+    ar = rg.CreateMDArray(
+        "v",
+        [dimz, dimy, dimx],
+        gdal.ExtendedDataType.Create(gdal.GDT_UInt16),
+        ["BLOCKSIZE=2,8,8"],
+    )
+    values = [
+        z * 1000 + y * nx + x for z in range(nz) for y in range(ny) for x in range(nx)
+    ]
+    assert ar.Write(struct.pack("H" * len(values), *values)) == gdal.CE_None
+    ds = None
+
+    def expected(z):
+        level_values = values[z * ny * nx : (z + 1) * ny * nx]
+        return struct.pack("H" * len(level_values), *level_values)
+
+    with gdaltest.config_option("GDAL_NETCDF_BOTTOMUP", "NO"):
+        for order in (range(nz), reversed(range(nz))):
+            with gdal.Open(fname) as ds:
+                assert ds.RasterCount == nz
+                assert ds.GetRasterBand(1).GetBlockSize() == [8, 8]
+                for z in order:
+                    assert ds.GetRasterBand(z + 1).ReadRaster() == expected(z)
+
+
 def test_netcdf_create():
 
     ds = gdaltest.netcdf_drv.Create("tmp/test_create.nc", 2, 2)
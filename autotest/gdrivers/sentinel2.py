@@ -3182,3 +3182,39 @@ def test_sentinel2_l2a_processing_baseline_5_09__2():
 
         pprint.pprint(got_md)
         pytest.fail()
+
+
+###############################################################################
+# Test that reading granule metadata and checking tiles with several threads
+# gives the same result as sequentially
+
+
+@pytest.mark.parametrize(
+    "subds_name",
+    [
+        "SENTINEL2_L1C:data/sentinel2/fake_l1c/S2A_OPER_PRD_MSIL1C.SAFE/S2A_OPER_MTD_SAFL1C.xml:10m:EPSG_32632",
+        "SENTINEL2_L2A:data/sentinel2/fake_l2a/S2A_USER_PRD_MSIL2A.SAFE/S2A_USER_MTD_SAFL2A.xml:60m:EPSG_32632",
+    ],
+)
+def test_sentinel2_num_threads(subds_name):
+
+    main_filename = subds_name.split(":")[1]
+    ds_ref = gdal.OpenEx(main_filename, open_options=["NUM_THREADS=1"])
+    ds = gdal.OpenEx(main_filename, open_options=["NUM_THREADS=4"])
+    assert ds.GetMetadata("SUBDATASETS") == ds_ref.GetMetadata("SUBDATASETS")
+
+    ds_ref = gdal.OpenEx(subds_name, open_options=["NUM_THREADS=1"])
+    assert ds_ref is not None
+    gdal.ErrorReset()
+    ds = gdal.OpenEx(subds_name, open_options=["NUM_THREADS=4", "ALPHA=YES"])
+    assert ds is not None and gdal.GetLastErrorMsg() == ""
+    assert ds.RasterXSize == ds_ref.RasterXSize
+    assert ds.RasterYSize == ds_ref.RasterYSize
+    assert ds.GetGeoTransform() == ds_ref.GetGeoTransform()
+    assert ds.GetFileList() == ds_ref.GetFileList()
+    assert ds.RasterCount == ds_ref.RasterCount + 1
+    for i in range(ds_ref.RasterCount):
+        assert (
+            ds.GetRasterBand(i + 1).Checksum()
+            == ds_ref.GetRasterBand(i + 1).Checksum()
+        )
@@ -2399,3 +2399,64 @@ def test_vrtpansharpen_open_options_input_bands():
         )
         # Not the prettiest way to check that open options are used, but that does the job...
         assert "small_world.tif: Invalid value for NUM_THREADS: foo" in msgs
+
+
+###############################################################################
+# Test floating point data types with 3 and 4 spectral bands, and weights
+# that are not all positive
+
+
+@pytest.mark.parametrize("dt", [gdal.GDT_Float32, gdal.GDT_Float64])
+@pytest.mark.parametrize("nbands", [3, 4])
+def test_vrtpansharpen_floating_point(dt, nbands):
+
+    width = 7
+    height = 5
+    weights = [0.25, 0.5, -0.1, 0.35][0:nbands]
+    fmt = "f" if dt == gdal.GDT_Float32 else "d"
+
+    pan_mem_ds = gdal.GetDriverByName("MEM").Create("", width, height, 1, dt)
+    ms_mem_ds = gdal.GetDriverByName("MEM").Create("", width, height, nbands, dt)
+    for ds in (pan_mem_ds, ms_mem_ds):
+        ds.SetGeoTransform([0, 1, 0, 0, 0, -1])
+    pan = [1.5 + (i % 11) * 3.25 for i in range(width * height)]
+    pan_mem_ds.GetRasterBand(1).WriteRaster(
+        0, 0, width, height, struct.pack(fmt * len(pan), *pan)
+    )
+    ms = []
+    for b in range(nbands):
+        vals = [0.5 + ((i + 3 * b) % 7) * 1.75 for i in range(width * height)]
+        # Make the pseudo panchromatic value null on one pixel
+        vals[4] = 0
+        ms.append(vals)
+        ms_mem_ds.GetRasterBand(b + 1).WriteRaster(
+            0, 0, width, height, struct.pack(fmt * len(vals), *vals)
+        )
+
+    spectral_bands = "".join(
+        '<SpectralBand dstBand="%d"></SpectralBand>' % (b + 1) for b in range(nbands)
+    )
+    vrt_ds = gdal.CreatePansharpenedVRT(
+        """<VRTDataset subClass="VRTPansharpenedDataset">
+        <PansharpeningOptions>
+            <AlgorithmOptions>
+                <Weights>%s</Weights>
+            </AlgorithmOptions>
+            %s
+        </PansharpeningOptions>
+    </VRTDataset>"""
+        % (",".join(str(w) for w in weights), spectral_bands),
+        pan_mem_ds.GetRasterBand(1),
+        [ms_mem_ds.GetRasterBand(b + 1) for b in range(nbands)],
+    )
+    assert vrt_ds is not None
+
+    for b in range(nbands):
+        got = struct.unpack(
+            fmt * (width * height),
+            vrt_ds.GetRasterBand(b + 1).ReadRaster(buf_type=dt),
+        )
+        for i in range(width * height):
+            pseudo_pan = sum(weights[k] * ms[k][i] for k in range(nbands))
+            factor = pan[i] / pseudo_pan if pseudo_pan != 0 else 0
+            assert got[i] == pytest.approx(ms[b][i] * factor, rel=1e-6)
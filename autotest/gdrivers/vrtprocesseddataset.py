@@ -226,6 +226,60 @@ def test_vrtprocesseddataset_several_steps(tmp_vsimem):
     assert ds.GetRasterBand(3).ComputeRasterMinMax(False) == (3, 3)
 
 
+###############################################################################
+# Test several steps on a block large enough to be processed in several strips,
+# possibly in parallel
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_vrtprocesseddataset_several_steps_strips(tmp_vsimem, num_threads):
+
+    src_filename = str(tmp_vsimem / "src.tif")
+    src_ds = gdal.GetDriverByName("GTiff").Create(src_filename, 1000, 500, 3)
+    src_ds.GetRasterBand(1).WriteArray(
+        (np.arange(1000 * 500) % 251).reshape(500, 1000)
+    )
+    src_ds.GetRasterBand(2).WriteArray(
+        (np.arange(1000 * 500) % 241).reshape(500, 1000)
+    )
+    src_ds.GetRasterBand(3).Fill(3)
+    src_ds.Close()
+
+    vrt = f"""<VRTDataset subclass='VRTProcessedDataset'>
+    <Input>
+        <SourceFilename>{src_filename}</SourceFilename>
+    </Input>
+    <BlockXSize>1000</BlockXSize>
+    <BlockYSize>500</BlockYSize>
+    <ProcessingSteps>
+        <Step>
+            <Algorithm>BandAffineCombination</Algorithm>
+            <Argument name="coefficients_1">0,0,1,0</Argument>
+            <Argument name="coefficients_2">0,1,0,0</Argument>
+            <Argument name="coefficients_3">1,0,0,1</Argument>
+        </Step>
+        <Step>
+            <Algorithm>LUT</Algorithm>
+            <Argument name="lut_1">0:255,255:0</Argument>
+            <Argument name="lut_2">0:0,255:255</Argument>
+            <Argument name="lut_3">0:0,255:255</Argument>
+        </Step>
+    </ProcessingSteps>
+    </VRTDataset>
+        """
+
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+        ds = gdal.Open(vrt)
+        assert ds.GetRasterBand(1).GetBlockSize() == [1000, 500]
+        got = ds.ReadAsArray()
+
+    b1 = (np.arange(1000 * 500) % 251).reshape(500, 1000)
+    b2 = (np.arange(1000 * 500) % 241).reshape(500, 1000)
+    np.testing.assert_equal(got[0], 255 - b2)
+    np.testing.assert_equal(got[1], b1)
+    np.testing.assert_equal(got[2], np.full((500, 1000), 4))
+
+
 ###############################################################################
 # Test nominal cases of BandAffineCombination algorithm with nodata
 
@@ -1162,3 +1162,57 @@ def test_wms_cache_path():
 
     with pytest.raises(Exception):
         gdal.Open("<GDAL_WMS><Service/><Cache/></GDAL_WMS>")
+
+
+###############################################################################
+# Test the in-memory cache of decoded tiles
+
+
+@pytest.mark.require_driver("PNG")
+def test_wms_decoded_tile_cache(tmp_vsimem):
+
+    gdal.Translate(
+        str(tmp_vsimem / "0" / "0" / "0.png"),
+        "data/rgbsmall.tif",
+        format="PNG",
+        width=256,
+        height=256,
+    )
+
+    tms = f"""<GDAL_WMS>
+    <Service name="TMS">
+        <ServerUrl>{tmp_vsimem}/${{z}}/${{x}}/${{y}}.png</ServerUrl>
+    </Service>
+    <DataWindow>
+        <UpperLeftX>-20037508.34</UpperLeftX>
+        <UpperLeftY>20037508.34</UpperLeftY>
+        <LowerRightX>20037508.34</LowerRightX>
+        <LowerRightY>-20037508.34</LowerRightY>
+        <TileLevel>0</TileLevel>
+        <TileCountX>1</TileCountX>
+        <TileCountY>1</TileCountY>
+        <YOrigin>top</YOrigin>
+    </DataWindow>
+    <Projection>EPSG:3857</Projection>
+    <BlockSizeX>256</BlockSizeX>
+    <BlockSizeY>256</BlockSizeY>
+    <BandsCount>3</BandsCount>
+    <DecodedTileCacheSize>4</DecodedTileCacheSize>
+</GDAL_WMS>"""
+
+    ds = gdal.Open(tms)
+    expected_cs = [ds.GetRasterBand(i + 1).Checksum() for i in range(3)]
+    assert expected_cs == [
+        gdal.Open(str(tmp_vsimem / "0" / "0" / "0.png"))
+        .GetRasterBand(i + 1)
+        .Checksum()
+        for i in range(3)
+    ]
+
+    # Drop the tile and the block cache: the decoded tile must still be
+    # available from memory
+    gdal.Unlink(str(tmp_vsimem / "0" / "0" / "0.png"))
+    ds.FlushCache()
+    for i in range(3):
+        ds.GetRasterBand(i + 1).FlushCache()
+    assert [ds.GetRasterBand(i + 1).Checksum() for i in range(3)] == expected_cs
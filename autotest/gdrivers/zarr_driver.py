@@ -3851,6 +3851,128 @@ def test_zarr_advise_read(compression, format):
         gdal.RmdirRecursive(filename)
 
 
+@pytest.mark.parametrize("format", ["ZARR_V2", "ZARR_V3"])
+def test_zarr_read_multithreaded(tmp_vsimem, format):
+
+    filename = str(tmp_vsimem / "test.zarr")
+    dim0_size = 123
+    dim1_size = 257
+    data = array.array("B", [(i % 255) + 1 for i in range(dim0_size * dim1_size)])
+
+    ds = gdal.GetDriverByName("ZARR").CreateMultiDimensional(
+        filename, options=["FORMAT=" + format]
+    )
+    rg = ds.GetRootGroup()
+    dim0 = rg.CreateDimension("dim0", None, None, dim0_size)
+    dim1 = rg.CreateDimension("dim1", None, None, dim1_size)
+    ar = rg.CreateMDArray(
+        "test",
+        [dim0, dim1],
+        gdal.ExtendedDataType.Create(gdal.GDT_Byte),
+        ["COMPRESS=GZIP", "BLOCKSIZE=20,30"],
+    )
+    assert ar.Write(data) == gdal.CE_None
+    # Tile only made of zeros
+    assert (
+        ar.Write(b"\x00" * (20 * 30), array_start_idx=[20, 30], count=[20, 30])
+        == gdal.CE_None
+    )
+    ds = None
+
+    def read(**kwargs):
+        ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+        ar = ds.GetRootGroup().OpenMDArray("test")
+        return ar.Read(**kwargs)
+
+    requests = [
+        {},
+        {"array_start_idx": [5, 7], "count": [100, 200]},
+        {"array_start_idx": [5, 7], "count": [40, 50], "array_step": [2, 3]},
+        {"array_start_idx": [110, 250], "count": [50, 60], "array_step": [-2, -4]},
+        # Step is larger than the block size: no parallel decoding
+        {"array_start_idx": [0, 0], "count": [3, 5], "array_step": [50, 50]},
+    ]
+    expected = [read(**req) for req in requests]
+
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        for req, exp in zip(requests, expected):
+            assert read(**req) == exp, req
+
+        # Force decoding by several slabs of tiles
+        oldCacheMax = gdal.GetCacheMax()
+        gdal.SetCacheMax(10 * 20 * 30 * 9)
+        try:
+            for req, exp in zip(requests, expected):
+                assert read(**req) == exp, req
+        finally:
+            gdal.SetCacheMax(oldCacheMax)
+
+
+@pytest.mark.parametrize("format", ["ZARR_V2", "ZARR_V3"])
+@pytest.mark.parametrize("options", [[], ["CHUNK_MEMORY_LAYOUT=F"]])
+def test_zarr_write_multithreaded(tmp_vsimem, format, options):
+
+    filename = str(tmp_vsimem / "test.zarr")
+    dim0_size = 123
+    dim1_size = 257
+    data = array.array("H", [i % 65535 for i in range(dim0_size * dim1_size)])
+
+    ds = gdal.GetDriverByName("ZARR").CreateMultiDimensional(
+        filename, options=["FORMAT=" + format]
+    )
+    rg = ds.GetRootGroup()
+    dim0 = rg.CreateDimension("dim0", None, None, dim0_size)
+    dim1 = rg.CreateDimension("dim1", None, None, dim1_size)
+    ar = rg.CreateMDArray(
+        "test",
+        [dim0, dim1],
+        gdal.ExtendedDataType.Create(gdal.GDT_UInt16),
+        ["COMPRESS=GZIP", "BLOCKSIZE=20,30", "NUM_THREADS=4"] + options,
+    )
+    assert ar.Write(data) == gdal.CE_None
+    # Partial update of tiles that may still be being written
+    assert (
+        ar.Write(
+            array.array("H", [1] * (10 * 15)), array_start_idx=[5, 7], count=[10, 15]
+        )
+        == gdal.CE_None
+    )
+    # Read back before closing
+    for y in range(5, 15):
+        for x in range(7, 22):
+            data[y * dim1_size + x] = 1
+    assert ar.Read() == data.tobytes()
+    # Make a tile empty
+    assert (
+        ar.Write(
+            array.array("H", [0] * (20 * 30)), array_start_idx=[20, 30], count=[20, 30]
+        )
+        == gdal.CE_None
+    )
+    for y in range(20, 40):
+        for x in range(30, 60):
+            data[y * dim1_size + x] = 0
+    ds = None
+
+    ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+    ar = ds.GetRootGroup().OpenMDArray("test")
+    assert ar.Read() == data.tobytes()
+
+
+def test_zarr_write_multithreaded_classic_api(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.zarr")
+    src_ds = gdal.Open("data/byte.tif")
+    gdal.Translate(
+        filename,
+        src_ds,
+        format="Zarr",
+        creationOptions=["COMPRESS=GZIP", "BLOCKSIZE=3,4", "NUM_THREADS=4"],
+    )
+    ds = gdal.Open(filename)
+    assert ds.GetRasterBand(1).Checksum() == src_ds.GetRasterBand(1).Checksum()
+
+
 def test_zarr_read_invalid_nczarr_dim():
 
     try:
@@ -5470,3 +5592,160 @@ def test_zarr_read_cf1_zarrv3():
         ds.GetSpatialRef().ExportToProj4()
         == "+proj=utm +zone=11 +ellps=clrk66 +units=m +no_defs"
     )
+
+
+###############################################################################
+
+
+def _crc32c(data):
+
+    crc = 0xFFFFFFFF
+    for b in data:
+        crc ^= b
+        for _ in range(8):
+            crc = (crc >> 1) ^ (0x82F63B78 if crc & 1 else 0)
+    return crc ^ 0xFFFFFFFF
+
+
+def _create_sharded_zarr_v3(filename, index_location="end"):
+
+    # Array of shape (4, 8), with shards of shape (4, 4) made of inner chunks
+    # of shape (2, 2). Inner chunk (1, 0) of the first shard is missing, as
+    # is the whole second shard.
+    j = {
+        "zarr_format": 3,
+        "node_type": "array",
+        "shape": [4, 8],
+        "data_type": "uint8",
+        "chunk_grid": {"name": "regular", "configuration": {"chunk_shape": [4, 4]}},
+        "chunk_key_encoding": {"name": "default"},
+        "fill_value": 255,
+        "codecs": [
+            {
+                "name": "sharding_indexed",
+                "configuration": {
+                    "chunk_shape": [2, 2],
+                    "codecs": [
+                        {"name": "bytes", "configuration": {"endian": "little"}}
+                    ],
+                    "index_codecs": [
+                        {"name": "bytes", "configuration": {"endian": "little"}},
+                        {"name": "crc32c"},
+                    ],
+                    "index_location": index_location,
+                },
+            }
+        ],
+    }
+    gdal.FileFromMemBuffer(filename + "/zarr.json", json.dumps(j))
+
+    data = b""
+    index = []
+    for chunk_y in range(2):
+        for chunk_x in range(2):
+            if (chunk_y, chunk_x) == (1, 0):
+                index += [0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF]
+                continue
+            chunk = bytes(
+                [
+                    (chunk_y * 2 + y) * 8 + chunk_x * 2 + x
+                    for y in range(2)
+                    for x in range(2)
+                ]
+            )
+            index += [len(data), len(chunk)]
+            data += chunk
+    if index_location == "start":
+        index_size = 4 * 16 + 4
+        index = [v if v == 0xFFFFFFFFFFFFFFFF else v + index_size for v in index]
+    encoded_index = struct.pack("<" + "Q" * len(index), *index)
+    encoded_index += struct.pack("<I", _crc32c(encoded_index))
+    if index_location == "start":
+        data = encoded_index + data
+    else:
+        data += encoded_index
+    gdal.FileFromMemBuffer(filename + "/c/0/0", data)
+
+
+def _expected_sharded_zarr_v3_values():
+
+    expected = []
+    for y in range(4):
+        for x in range(8):
+            if x >= 4 or (y >= 2 and x < 2):
+                expected.append(255)
+            else:
+                expected.append(y * 8 + x)
+    return expected
+
+
+@gdaltest.enable_exceptions()
+@pytest.mark.parametrize("index_location", ["end", "start"])
+def test_zarr_read_v3_sharding(tmp_vsimem, index_location):
+
+    filename = str(tmp_vsimem / "test.zarr")
+    _create_sharded_zarr_v3(filename, index_location)
+
+    ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+    rg = ds.GetRootGroup()
+    ar = rg.OpenMDArray("test")
+    assert ar.GetBlockSize() == [2, 2]
+    assert list(struct.unpack("B" * 32, ar.Read())) == (
+        _expected_sharded_zarr_v3_values()
+    )
+
+    # Partial read
+    assert struct.unpack(
+        "B" * 4, ar.Read(array_start_idx=[1, 1], count=[2, 2])
+    ) == (9, 10, 255, 18)
+
+
+@gdaltest.enable_exceptions()
+@pytest.mark.parametrize("num_threads", ["1", "2"])
+def test_zarr_read_v3_sharding_advise_read(tmp_vsimem, num_threads):
+
+    filename = str(tmp_vsimem / "test.zarr")
+    _create_sharded_zarr_v3(filename)
+
+    ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+    rg = ds.GetRootGroup()
+    ar = rg.OpenMDArray("test")
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+        assert ar.AdviseRead()
+    assert list(struct.unpack("B" * 32, ar.Read())) == (
+        _expected_sharded_zarr_v3_values()
+    )
+
+
+@gdaltest.enable_exceptions()
+def test_zarr_read_v3_sharding_errors(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.zarr")
+    _create_sharded_zarr_v3(filename)
+
+    # Corrupt the checksum of the index
+    f = gdal.VSIFOpenL(filename + "/c/0/0", "rb+")
+    gdal.VSIFSeekL(f, 0, 2)
+    gdal.VSIFSeekL(f, gdal.VSIFTellL(f) - 1, 0)
+    gdal.VSIFWriteL(b"\x00", 1, 1, f)
+    gdal.VSIFCloseL(f)
+
+    ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+    rg = ds.GetRootGroup()
+    ar = rg.OpenMDArray("test")
+    with pytest.raises(Exception):
+        ar.Read()
+
+
+@gdaltest.enable_exceptions()
+def test_zarr_v3_sharding_write_not_supported(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.zarr")
+    _create_sharded_zarr_v3(filename)
+
+    with pytest.raises(Exception, match="sharding_indexed"):
+        ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER | gdal.OF_UPDATE)
+        rg = ds.GetRootGroup()
+        ar = rg.OpenMDArray("test")
+        ar.Write(b"\x00" * 32)
+        ds.Close()
@@ -163,6 +163,36 @@ def test_gnm_graph_dijkstra():
     dn = None
 
 
+###############################################################################
+# Dijkstra shortest path after changes of the block state of features
+
+
+def test_gnm_graph_dijkstra_block_state():
+
+    ds = gdal.OpenEx("tmp/test_gnm", gdal.OF_UPDATE)
+    dgn = gnm.CastToGenericNetwork(ds)
+    assert dgn is not None, "cast to GNMGenericNetwork failed"
+
+    def get_path():
+        lyr = dgn.GetPath(61, 50, gnm.GATDijkstraShortestPath)
+        assert lyr is not None, "failed to get path"
+        ret = [f.GetFieldAsInteger64("gnm_fid") for f in lyr]
+        dgn.ReleaseResultSet(lyr)
+        return ret
+
+    path = get_path()
+    assert path
+
+    assert dgn.ChangeAllBlockState(True) == 0
+    assert get_path() == []
+
+    assert dgn.ChangeAllBlockState(False) == 0
+    assert get_path() == path
+
+    dgn = None
+    ds = None
+
+
 ###############################################################################
 # KShortest Paths
 
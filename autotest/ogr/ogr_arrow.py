@@ -165,6 +165,28 @@ def test_ogr_arrow_1(use_vsi):
             gdal.Unlink(vsifilename)
 
 
+###############################################################################
+# Read local files with and without memory mapping
+
+
+@pytest.mark.parametrize("memory_map", ["YES", "NO"])
+def test_ogr_arrow_read_memory_map(memory_map):
+
+    with gdal.config_option("OGR_ARROW_MEMORY_MAP", memory_map):
+        ogr_parquet._check_test_parquet(
+            "data/arrow/test.feather",
+            expect_fast_get_extent=False,
+            expect_ignore_fields=False,
+        )
+
+        ds = ogr.Open("data/arrow/from_paleolimbot_geoarrow/polygon-default.ipc")
+        got = [f.ExportToJson() for f in ds.GetLayer(0)]
+        ds = None
+
+    ds = ogr.Open("data/arrow/from_paleolimbot_geoarrow/polygon-default.ipc")
+    assert got == [f.ExportToJson() for f in ds.GetLayer(0)]
+
+
 ###############################################################################
 # Run test_ogrsf on a Feather file
 
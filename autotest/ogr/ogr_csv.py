@@ -3089,6 +3089,343 @@ def test_ogr_csv_geom_coord_precision_OGR_APPLY_GEOM_SET_PRECISION(tmp_vsimem):
     assert b"MULTIPOLYGON" in data
 
 
+###############################################################################
+# Test that the optimized GetArrowStream() implementation returns the same
+# content as the generic one
+
+
+def _get_csv_arrow_batches(filename, open_options, stream_options, where=None):
+    ds = gdal.OpenEx(filename, gdal.OF_VECTOR, open_options=open_options)
+    lyr = ds.GetLayer(0)
+    if where:
+        lyr.SetAttributeFilter(where)
+    stream = lyr.GetArrowStreamAsNumPy(
+        options=["USE_MASKED_ARRAYS=NO"] + stream_options
+    )
+    return [{k: [x for x in v] for k, v in batch.items()} for batch in stream]
+
+
+@pytest.mark.parametrize(
+    "filename,open_options",
+    [
+        ("data/csv/testnull.csv", []),
+        ("data/csv/testdatetime.csv", []),
+        ("data/csv/testtypeautodetectboolean.csv", ["AUTODETECT_TYPE=YES"]),
+        ("data/csv/testtypeautodetectinteger64.csv", ["AUTODETECT_TYPE=YES"]),
+        ("data/wkt.csv", []),
+        ("data/wkt.csv", ["KEEP_GEOM_COLUMNS=NO"]),
+        ("data/prime_meridian.csv", []),
+        ("XY", ["X_POSSIBLE_NAMES=x", "Y_POSSIBLE_NAMES=y", "Z_POSSIBLE_NAMES=z"]),
+        (
+            "XY",
+            [
+                "X_POSSIBLE_NAMES=x",
+                "Y_POSSIBLE_NAMES=y",
+                "KEEP_SOURCE_COLUMNS=YES",
+                "AUTODETECT_TYPE=YES",
+            ],
+        ),
+    ],
+)
+@pytest.mark.parametrize(
+    "stream_options,where",
+    [([], None), (["MAX_FEATURES_IN_BATCH=1"], None), ([], "FID >= 2")],
+)
+def test_ogr_csv_arrow_stream_optimized_vs_generic(
+    tmp_vsimem, filename, open_options, stream_options, where
+):
+    pytest.importorskip("osgeo.gdal_array")
+    pytest.importorskip("numpy")
+
+    if filename == "XY":
+        filename = str(tmp_vsimem / "test_ogr_csv_arrow_stream.csv")
+        gdal.FileFromMemBuffer(
+            filename, "x,y,z,name\n1,2,3,foo\n,,,\n4,5,,bar\n1,2,3,baz\n"
+        )
+
+    batches = _get_csv_arrow_batches(filename, open_options, stream_options, where)
+    assert batches
+    with gdal.config_option("OGR_CSV_STREAM_BASE_IMPL", "YES"):
+        ref_batches = _get_csv_arrow_batches(
+            filename, open_options, stream_options, where
+        )
+    assert batches == ref_batches
+
+
+###############################################################################
+
+
+###############################################################################
+# Test that the native WriteArrowBatch() implementation gives the same result
+# as the generic one
+
+
+@gdaltest.enable_exceptions()
+def test_ogr_csv_write_arrow_native_vs_generic(tmp_vsimem):
+
+    src_ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    src_lyr = src_ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    src_lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    src_lyr.CreateField(ogr.FieldDefn("int64", ogr.OFTInteger64))
+    src_lyr.CreateField(ogr.FieldDefn("real", ogr.OFTReal))
+    src_lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    src_lyr.CreateField(ogr.FieldDefn("date", ogr.OFTDate))
+    for i in range(5):
+        f = ogr.Feature(src_lyr.GetLayerDefn())
+        if i != 1:
+            f["int"] = i
+            f["int64"] = 1234567890123 + i
+            f["real"] = 1.25 * i
+            f["str"] = "foo, \"bar\" %d" % i
+            f["date"] = "2023/10/%02d" % (i + 1)
+        if i != 2:
+            f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d %d)" % (i, -i)))
+        src_lyr.CreateFeature(f)
+
+    def write(filename, base_impl):
+        ds = gdal.GetDriverByName("CSV").Create(
+            filename, 0, 0, 0, gdal.GDT_Unknown
+        )
+        lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint, options=["GEOMETRY=AS_WKT"])
+        stream = src_lyr.GetArrowStream(["MAX_FEATURES_IN_BATCH=2"])
+        schema = stream.GetSchema()
+        for i in range(schema.GetChildrenCount()):
+            if schema.GetChild(i).GetName() not in ("wkb_geometry", "OGC_FID"):
+                lyr.CreateFieldFromArrowSchema(schema.GetChild(i))
+        with gdal.config_option("OGR_CSV_WRITE_ARROW_BASE_IMPL", base_impl):
+            while True:
+                array = stream.GetNextRecordBatch()
+                if array is None:
+                    break
+                assert lyr.WriteArrowBatch(schema, array, ["FID=OGC_FID"])
+        ds.Close()
+
+    filename_native = str(tmp_vsimem / "native.csv")
+    write(filename_native, "NO")
+    filename_generic = str(tmp_vsimem / "generic.csv")
+    write(filename_generic, "YES")
+
+    # The CSV writer is text based: the output must be byte-identical
+    def read(filename):
+        f = gdal.VSIFOpenL(filename, "rb")
+        data = gdal.VSIFReadL(1, 10000, f)
+        gdal.VSIFCloseL(f)
+        return data
+
+    assert read(filename_native) == read(filename_generic)
+
+    ds_native = ogr.Open(filename_native)
+    ds_generic = ogr.Open(filename_generic)
+    lyr_native = ds_native.GetLayer(0)
+    lyr_generic = ds_generic.GetLayer(0)
+    assert lyr_native.GetFeatureCount() == 5
+    for f_native, f_generic in zip(lyr_native, lyr_generic):
+        assert f_native.Equal(f_generic)
+
+
+###############################################################################
+# Test that the column-at-a-time evaluation of attribute filters on Arrow
+# batches gives the same result as the feature per feature one
+
+
+@pytest.mark.parametrize(
+    "where",
+    [
+        "int = 2",
+        "int <> 2",
+        "int < 2",
+        "int <= 2",
+        "int > 2",
+        "int >= 2",
+        "int = 2.5",
+        "int < 2.5",
+        "int BETWEEN 1 AND 3",
+        "int IN (1, 3, 5)",
+        "int64 = 1234567890123",
+        "int64 > 1",
+        "real = 1.5",
+        "real < 2",
+        "real BETWEEN 1 AND 2.5",
+        "real IN (1.5, 4.5)",
+        "str = 'foo'",
+        "str = 'FOO'",
+        "str <> 'foo'",
+        "str < 'bar'",
+        "str >= 'bar'",
+        "str BETWEEN 'a' AND 'c'",
+        "str IN ('foo', 'baz')",
+        "str LIKE 'ba%'",
+        "str ILIKE 'BA%'",
+        "str LIKE 'b_r'",
+        "int IS NULL",
+        "int IS NOT NULL",
+        "str IS NULL",
+        "NOT (int = 2)",
+        "int = 2 OR real = 1.5",
+        "int > 1 AND str LIKE 'b%'",
+        "NOT (int > 1 AND real > 1)",
+        "NOT (int > 1 OR real > 1)",
+        "int > 1 AND (str = 'foo' OR real IS NULL)",
+        # Not handled by the columnar evaluator
+        "int + 1 = 3",
+        "FID = 2",
+    ],
+)
+def test_ogr_csv_arrow_stream_columnar_attribute_filter(tmp_vsimem, where):
+    pytest.importorskip("osgeo.gdal_array")
+    pytest.importorskip("numpy")
+
+    filename = str(tmp_vsimem / "test_ogr_csv_arrow_stream_columnar_filter.csv")
+    gdal.FileFromMemBuffer(
+        filename,
+        "int,int64,real,str\n"
+        + "1,1234567890123,1.5,foo\n"
+        + "2,2,2.5,bar\n"
+        + ",3,,baz\n"
+        + "3,,4.5,\n"
+        + "4,5,0.5,Bar\n",
+    )
+    gdal.FileFromMemBuffer(
+        filename[0:-4] + ".csvt", "Integer,Integer64,Real,String\n"
+    )
+
+    ds = gdal.OpenEx(filename, gdal.OF_VECTOR)
+    lyr = ds.GetLayer(0)
+    lyr.SetAttributeFilter(where)
+    expected_fids = [f.GetFID() for f in lyr]
+    ds = None
+
+    batches = _get_csv_arrow_batches(filename, [], ["INCLUDE_FID=YES"], where)
+    fids = [fid for batch in batches for fid in batch["OGC_FID"]]
+    assert fids == expected_fids
+
+    with gdal.config_option("OGR_ARROW_COLUMNAR_ATTR_FILTER", "NO"):
+        ref_batches = _get_csv_arrow_batches(filename, [], [], where)
+    assert _get_csv_arrow_batches(filename, [], [], where) == ref_batches
+
+
+###############################################################################
+# Test CREATE SPATIAL INDEX / DROP SPATIAL INDEX with a sidecar .ogrsidx file
+
+
+def test_ogr_csv_sidecar_spatial_index(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test_ogr_csv_sidecar_spatial_index.csv")
+    index_filename = filename + ".ogrsidx"
+    content = "id,WKT\n"
+    for i in range(1000):
+        x = i % 40
+        y = i // 40
+        if i == 500:
+            content += "%d,\n" % i
+        else:
+            content += '%d,"POINT (%d %d)"\n' % (i, x, y)
+    gdal.FileFromMemBuffer(filename, content)
+
+    def get_fids(ds, minx, miny, maxx, maxy):
+        lyr = ds.GetLayer(0)
+        lyr.SetSpatialFilterRect(minx, miny, maxx, maxy)
+        fids = [f.GetFID() for f in lyr]
+        # Iterating a second time must give the same result
+        assert [f.GetFID() for f in lyr] == fids
+        lyr.SetSpatialFilter(None)
+        return fids
+
+    with gdal.OpenEx(filename, gdal.OF_VECTOR) as ds:
+        ref_fids = get_fids(ds, 10.5, 2.5, 12.5, 20.5)
+        ds.ExecuteSQL("CREATE SPATIAL INDEX ON test_ogr_csv_sidecar_spatial_index")
+    assert gdal.VSIStatL(index_filename) is not None
+    assert len(ref_fids) == 2 * 18
+
+    with gdal.OpenEx(filename, gdal.OF_VECTOR) as ds:
+        assert get_fids(ds, 10.5, 2.5, 12.5, 20.5) == ref_fids
+        assert get_fids(ds, 100, 100, 101, 101) == []
+        lyr = ds.GetLayer(0)
+        lyr.SetSpatialFilterRect(10.5, 2.5, 12.5, 20.5)
+        lyr.SetAttributeFilter("id < 300")
+        expected_fids = [fid for fid in ref_fids if fid <= 300]
+        assert [f.GetFID() for f in lyr] == expected_fids
+        assert lyr.GetFeatureCount() == len(expected_fids)
+
+    # A stale index must be ignored
+    gdal.FileFromMemBuffer(filename, content + '1000,"POINT (11 3)"\n')
+    with gdal.OpenEx(filename, gdal.OF_VECTOR) as ds:
+        assert get_fids(ds, 10.5, 2.5, 12.5, 20.5) == sorted(ref_fids + [1001])
+
+    with gdal.OpenEx(filename, gdal.OF_VECTOR) as ds:
+        ds.ExecuteSQL("DROP SPATIAL INDEX ON test_ogr_csv_sidecar_spatial_index")
+    assert gdal.VSIStatL(index_filename) is None
+
+    with gdal.OpenEx(filename, gdal.OF_VECTOR) as ds:
+        with pytest.raises(Exception, match="no such layer"):
+            ds.ExecuteSQL("CREATE SPATIAL INDEX ON non_existing")
+        with pytest.raises(Exception, match="Syntax error"):
+            ds.ExecuteSQL("CREATE SPATIAL INDEX ON")
+
+
+###############################################################################
+# Test that multi-threaded parsing returns the same records as sequential one
+
+
+def _create_csv_num_threads_file(filename, eol):
+    lines = ["\xef\xbb\xbfid,val,comment"]
+    for i in range(60000):
+        if i % 1000 == 1:
+            lines.append(f'{i},{i * 0.5},"multi{eol}line, ""quoted"" {i}"')
+        elif i % 777 == 0:
+            lines.append("")
+            lines.append(f"{i},,")
+        else:
+            lines.append(f"{i},{i * 0.5},comment number {i}")
+    gdal.FileFromMemBuffer(filename, eol.join(lines) + eol)
+
+
+@pytest.mark.parametrize("eol", ["\n", "\r\n"])
+def test_ogr_csv_num_threads(tmp_vsimem, eol):
+
+    filename = str(tmp_vsimem / "test_ogr_csv_num_threads.csv")
+    _create_csv_num_threads_file(filename, eol)
+
+    def read_all(lyr):
+        lyr.ResetReading()
+        return [(f.GetFID(), f["id"], f["val"], f["comment"]) for f in lyr]
+
+    with gdal.OpenEx(filename, gdal.OF_VECTOR) as ds:
+        lyr = ds.GetLayer(0)
+        ref = read_all(lyr)
+        ref_feat = lyr.GetFeature(45678)["comment"]
+    assert len(ref) == 60000
+    assert ref[1][3] == 'multi\nline, "quoted" 1'
+
+    with gdaltest.config_option("OGR_CSV_NUM_THREADS", "4"):
+        with gdal.OpenEx(filename, gdal.OF_VECTOR) as ds:
+            lyr = ds.GetLayer(0)
+            assert read_all(lyr) == ref
+            lyr.ResetReading()
+            for _ in range(10):
+                lyr.GetNextFeature()
+            assert lyr.GetNextFeature().GetFID() == 11
+            assert read_all(lyr) == ref
+            assert lyr.GetFeature(45678)["comment"] == ref_feat
+            assert lyr.GetFeatureCount() == 60000
+
+
+def test_ogr_csv_num_threads_arrow_stream(tmp_vsimem):
+    pytest.importorskip("osgeo.gdal_array")
+    pytest.importorskip("numpy")
+
+    filename = str(tmp_vsimem / "test_ogr_csv_num_threads_arrow_stream.csv")
+    _create_csv_num_threads_file(filename, "\n")
+
+    ref_batches = _get_csv_arrow_batches(
+        filename, [], ["MAX_FEATURES_IN_BATCH=1000"]
+    )
+    with gdaltest.config_option("OGR_CSV_NUM_THREADS", "4"):
+        batches = _get_csv_arrow_batches(filename, [], ["MAX_FEATURES_IN_BATCH=1000"])
+    assert len(batches) == 60
+    assert batches == ref_batches
+
+
 ###############################################################################
 
 
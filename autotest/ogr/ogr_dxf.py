@@ -3993,3 +3993,51 @@ def test_ogr_dxf_read_broken_file_2():
         lyr = ds.GetLayer(0)
         for f in lyr:
             pass
+
+
+###############################################################################
+# Test that repeated and array INSERTs of a block whose merged geometry is
+# cached get their own transformation
+
+
+def test_ogr_dxf_insert_cached_block_geometry(tmp_vsimem):
+
+    def line(x1, y1, x2, y2):
+        return f"0\nLINE\n8\n0\n10\n{x1}\n20\n{y1}\n11\n{x2}\n21\n{y2}\n"
+
+    def insert(x, y, extra=""):
+        return f"0\nINSERT\n8\n0\n2\nB\n10\n{x}\n20\n{y}\n{extra}"
+
+    content = (
+        "0\nSECTION\n2\nBLOCKS\n"
+        + "0\nBLOCK\n8\n0\n2\nB\n70\n0\n10\n0\n20\n0\n3\nB\n"
+        + line(0, 0, 1, 0)
+        + line(1, 0, 1, 1)
+        + "0\nENDBLK\n"
+        + "0\nENDSEC\n"
+        + "0\nSECTION\n2\nENTITIES\n"
+        # Array of 2 columns spaced by 10
+        + insert(100, 0, "70\n2\n44\n10\n")
+        # Rotation of 90 degrees and scaling by 2
+        + insert(0, 0, "41\n2\n42\n2\n50\n90\n")
+        # Same block as the first one, to use the cached geometry again
+        + insert(-5, -5)
+        + "0\nENDSEC\n"
+        + "0\nEOF\n"
+    )
+
+    filename = tmp_vsimem / "test_ogr_dxf_insert_cached_block_geometry.dxf"
+    gdal.FileFromMemBuffer(filename, content)
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    assert lyr.GetFeatureCount() == 4
+
+    f = lyr.GetNextFeature()
+    ogrtest.check_feature_geometry(f, "MULTILINESTRING ((100 0,101 0),(101 0,101 1))")
+    f = lyr.GetNextFeature()
+    ogrtest.check_feature_geometry(f, "MULTILINESTRING ((110 0,111 0),(111 0,111 1))")
+    f = lyr.GetNextFeature()
+    ogrtest.check_feature_geometry(f, "MULTILINESTRING ((0 0,0 2),(0 2,-2 2))")
+    f = lyr.GetNextFeature()
+    ogrtest.check_feature_geometry(f, "MULTILINESTRING ((-5 -5,-4 -5),(-4 -5,-4 -4))")
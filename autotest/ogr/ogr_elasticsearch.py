@@ -3486,3 +3486,72 @@ def test_ogr_elasticsearch_upsert_feature(es_url, handle_get, handle_post):
     assert gdal.GetLastErrorMsg() == ""
 
     ds = None
+
+
+###############################################################################
+# Test BULK_CONCURRENCY layer creation option
+
+
+def test_ogr_elasticsearch_bulk_concurrency(es_url, handle_get, handle_post):
+
+    handle_get("/fakeelasticsearch", """{"version":{"number":"6.8.0"}}""")
+
+    ds = ogrtest.elasticsearch_drv.CreateDataSource(f"{es_url}/fakeelasticsearch")
+    assert ds is not None
+
+    handle_get("/fakeelasticsearch/test_bulk", "{}")
+
+    handle_post(
+        "/fakeelasticsearch/test_bulk/_mapping/FeatureCollection",
+        post_body='{ "FeatureCollection": { "properties": {} }}',
+        contents="{}",
+    )
+
+    lyr = ds.CreateLayer(
+        "test_bulk",
+        srs=ogrtest.srs_wgs84,
+        options=[
+            'MAPPING={ "FeatureCollection": { "properties": {} }}',
+            "BULK_SIZE=1",
+            "BULK_CONCURRENCY=2",
+        ],
+    )
+    assert lyr is not None
+
+    for i in range(1, 5):
+        handle_post(
+            """/fakeelasticsearch/_bulk""",
+            post_body="""{"index" :{"_index":"test_bulk", "_type":"FeatureCollection","_id":"id%d"}}
+{ "ogc_fid": %d, "properties": { } }
+
+"""
+            % (i, i),
+            contents="{}",
+        )
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["_id"] = "id%d" % i
+        f.SetFID(i)
+        assert lyr.CreateFeature(f) == ogr.OGRERR_NONE
+
+    gdal.ErrorReset()
+    assert lyr.SyncToDisk() == ogr.OGRERR_NONE
+    assert gdal.GetLastErrorMsg() == ""
+
+    # Errors of asynchronous requests are reported at the latest by SyncToDisk()
+    handle_post(
+        """/fakeelasticsearch/_bulk""",
+        post_body="""{"index" :{"_index":"test_bulk", "_type":"FeatureCollection","_id":"id5"}}
+{ "ogc_fid": 5, "properties": { } }
+
+""",
+        contents='{"error":"my error"}',
+    )
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f["_id"] = "id5"
+    f.SetFID(5)
+    with gdal.quiet_errors():
+        lyr.CreateFeature(f)
+        assert lyr.SyncToDisk() != ogr.OGRERR_NONE
+    assert "my error" in gdal.GetLastErrorMsg()
+
+    ds = None
@@ -1419,3 +1419,103 @@ def test_ogr_flatgeobuf_write_mismatch_geom_type(tmp_vsimem):
         match="ICreateFeature: Mismatched geometry type. Feature geometry type is Line String, expected layer geometry type is Point",
     ):
         lyr.CreateFeature(f)
+
+
+###############################################################################
+# Test that the native WriteArrowBatch() implementation gives the same result
+# as the generic one
+
+
+@gdaltest.enable_exceptions()
+def test_ogr_flatgeobuf_write_arrow_native_vs_generic(tmp_vsimem):
+
+    src_ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    src_lyr = src_ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    src_lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    src_lyr.CreateField(ogr.FieldDefn("int64", ogr.OFTInteger64))
+    src_lyr.CreateField(ogr.FieldDefn("real", ogr.OFTReal))
+    src_lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    src_lyr.CreateField(ogr.FieldDefn("date", ogr.OFTDate))
+    for i in range(5):
+        f = ogr.Feature(src_lyr.GetLayerDefn())
+        if i != 1:
+            f["int"] = i
+            f["int64"] = 1234567890123 + i
+            f["real"] = 1.25 * i
+            f["str"] = "foo, \"bar\" %d" % i
+            f["date"] = "2023/10/%02d" % (i + 1)
+        if i != 2:
+            f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d %d)" % (i, -i)))
+        src_lyr.CreateFeature(f)
+
+    def write(filename, base_impl):
+        ds = gdal.GetDriverByName("FlatGeobuf").Create(
+            filename, 0, 0, 0, gdal.GDT_Unknown
+        )
+        lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+        stream = src_lyr.GetArrowStream(["MAX_FEATURES_IN_BATCH=2"])
+        schema = stream.GetSchema()
+        for i in range(schema.GetChildrenCount()):
+            if schema.GetChild(i).GetName() not in ("wkb_geometry", "OGC_FID"):
+                lyr.CreateFieldFromArrowSchema(schema.GetChild(i))
+        with gdal.config_option("OGR_FLATGEOBUF_WRITE_ARROW_BASE_IMPL", base_impl):
+            while True:
+                array = stream.GetNextRecordBatch()
+                if array is None:
+                    break
+                assert lyr.WriteArrowBatch(schema, array, ["FID=OGC_FID"])
+        ds.Close()
+
+    filename_native = str(tmp_vsimem / "native.fgb")
+    write(filename_native, "NO")
+    filename_generic = str(tmp_vsimem / "generic.fgb")
+    write(filename_generic, "YES")
+
+    ds_native = ogr.Open(filename_native)
+    ds_generic = ogr.Open(filename_generic)
+    lyr_native = ds_native.GetLayer(0)
+    lyr_generic = ds_generic.GetLayer(0)
+    assert lyr_native.GetFeatureCount() == 5
+    for f_native, f_generic in zip(lyr_native, lyr_generic):
+        assert f_native.Equal(f_generic)
+
+
+###############################################################################
+# Test reading features found in the spatial index with multi-range reads
+
+
+@pytest.mark.parametrize("arrow", [False, True])
+def test_ogr_flatgeobuf_multi_range_read(tmp_vsimem, arrow):
+
+    if arrow:
+        pytest.importorskip("osgeo.gdal_array")
+        pytest.importorskip("numpy")
+
+    filename = str(tmp_vsimem / "test.fgb")
+    ds = gdal.GetDriverByName("FlatGeobuf").Create(filename, 0, 0, 0, gdal.GDT_Unknown)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    for i in range(2500):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["str"] = "x" * (i % 10)
+        f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT({i % 50} {i // 50})"))
+        lyr.CreateFeature(f)
+    ds.Close()
+
+    def read(multi_range_read):
+        ds = ogr.Open(filename)
+        lyr = ds.GetLayer(0)
+        lyr.SetSpatialFilterRect(10.5, 0, 30.5, 100)
+        with gdal.config_option("OGR_FLATGEOBUF_MULTI_RANGE_READ", multi_range_read):
+            if arrow:
+                ret = []
+                for batch in lyr.GetArrowStreamAsNumPy():
+                    ret += [(fid, s) for fid, s in zip(batch["OGC_FID"], batch["str"])]
+                return ret
+            return [
+                (f.GetFID(), f["str"], f.GetGeometryRef().ExportToWkt()) for f in lyr
+            ]
+
+    expected = read("NO")
+    assert len(expected) == 1000
+    assert read("YES") == expected
@@ -4114,6 +4114,96 @@ def test_ogr_geojson_feature_large(tmp_vsimem):
     gdal.Unlink(filename)
 
 
+###############################################################################
+# Test reading features with several threads (OGR_GEOJSON_NUM_THREADS)
+
+
+def test_ogr_geojson_read_num_threads(tmp_vsimem):
+
+    filename = tmp_vsimem / "test_ogr_geojson_read_num_threads.json"
+    features = []
+    for i in range(2500):
+        if i % 100 == 1:
+            features.append("[1, 2]")
+        elif i % 100 == 2:
+            features.append('{"type":"NotAFeature"}')
+        else:
+            features.append(
+                '{"type":"Feature","id":%d,"properties":{"s":"}{\\\\\\"[%d",'
+                '"n":%d},"geometry":{"type":"Point","coordinates":[%d,%d]}}'
+                % (i // 2, i, i, i, -i)
+            )
+    gdal.FileFromMemBuffer(
+        filename,
+        '{"type":"FeatureCollection","name":"features",'
+        '"x":{"features":[{"type":"Feature"}]},"features":[\n%s\n]}'
+        % ",\n".join(features),
+    )
+
+    def read_all():
+        ds = ogr.Open(filename)
+        lyr = ds.GetLayer(0)
+        ret = [f.DumpReadableAsString() for f in lyr]
+        lyr.ResetReading()
+        assert lyr.GetNextFeature().DumpReadableAsString() == ret[0]
+        return ret
+
+    with gdal.quiet_errors():
+        ref = read_all()
+        with gdaltest.config_option("OGR_GEOJSON_NUM_THREADS", "4"):
+            got = read_all()
+    assert len(ref) == 2450
+    assert got == ref
+
+
+###############################################################################
+# Test OGR_GEOJSON_MAX_FEATURES_FOR_SCHEMA
+
+
+def test_ogr_geojson_max_features_for_schema(tmp_vsimem):
+
+    filename = tmp_vsimem / "test_ogr_geojson_max_features_for_schema.json"
+    gdal.FileFromMemBuffer(
+        filename,
+        """{"type":"FeatureCollection","features":[
+{"type":"Feature","id":1,"properties":{"a":1},
+ "geometry":{"type":"Point","coordinates":[1,2]}},
+{"type":"Feature","id":2,"properties":{"a":2},
+ "geometry":{"type":"Point","coordinates":[3,4]}},
+{"type":"Feature","id":3,"properties":{"b":"x","coordinates":[[100,200]]},
+ "geometry":null},
+{"type":"NotAFeature","geometry":{"type":"Point","coordinates":[-100,-100]}},
+{"type":"Feature","id":10000000000,"properties":{"a":3},
+ "geometry":{"type":"GeometryCollection","geometries":[
+  {"type":"LineString","coordinates":[[-1,5],[0,6]]},
+  {"type":"Point","coordinates":[2,-3,7]}]}}
+]}""",
+    )
+
+    with gdaltest.config_option("OGR_GEOJSON_MAX_FEATURES_FOR_SCHEMA", "2"):
+        ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    assert lyr.GetFeatureCount(force=False) == 4
+    assert lyr.GetGeomType() == ogr.wkbUnknown
+    assert lyr.GetExtent(force=False) == (-1, 3, -3, 6)
+    assert lyr.GetExtent3D(force=False) == (-1, 3, -3, 6, 7, 7)
+    assert lyr.GetLayerDefn().GetFieldCount() == 1
+    assert lyr.GetLayerDefn().GetFieldDefn(0).GetName() == "a"
+    assert lyr.GetMetadataItem(ogr.OLMD_FID64) == "YES"
+    assert [f.GetFID() for f in lyr] == [1, 2, 3, 10000000000]
+    lyr.ResetReading()
+    lyr.GetNextFeature()
+    lyr.GetNextFeature()
+    f = lyr.GetNextFeature()
+    assert f.GetGeometryRef() is None
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    assert lyr.GetFeatureCount(force=False) == 4
+    assert lyr.GetExtent(force=False) == (-1, 3, -3, 6)
+    assert lyr.GetLayerDefn().GetFieldCount() == 2
+
+
 ###############################################################################
 # Test reading http:// resource
 
@@ -5201,3 +5291,72 @@ def test_ogr_geojson_identify_jsonfg_with_geojson():
             "data/jsonfg/crs_none.json", allowed_drivers=["GeoJSON", "JSONFG"]
         )
         assert drv.GetDescription() == "JSONFG"
+
+
+###############################################################################
+# Test that coordinates directly serialized from geometries are identical to
+# the ones of the json-c object tree based code path
+
+
+@pytest.mark.parametrize(
+    "options",
+    [
+        [],
+        ["COORDINATE_PRECISION=3"],
+        ["SIGNIFICANT_FIGURES=5"],
+        ["RFC7946=YES"],
+        ["WRITE_BBOX=YES", "XY_COORD_PRECISION=2", "Z_COORD_PRECISION=1"],
+    ],
+)
+@pytest.mark.parametrize("driver_name", ["GeoJSON", "GeoJSONSeq"])
+def test_ogr_geojson_write_streamed_coordinates(tmp_vsimem, options, driver_name):
+
+    wkts = [
+        "POINT (1.23456789 2.3456789)",
+        "POINT Z (1.23456789 -2.3456789 3.456789)",
+        "POINT EMPTY",
+        "LINESTRING (1 2,3.00000000001 4.99999999999,1e-8 -1e8)",
+        "LINESTRING Z (1 2 3,4 5 6)",
+        "LINESTRING EMPTY",
+        "POLYGON ((0 0,0 1,1 1,1 0,0 0),(0.2 0.2,0.8 0.2,0.8 0.8,0.2 0.2))",
+        "POLYGON EMPTY",
+        "MULTIPOINT ((1 2),(3 4))",
+        "MULTIPOINT Z ((1 2 3))",
+        "MULTILINESTRING ((1 2,3 4),(5 6,7 8))",
+        "MULTIPOLYGON (((0 0,0 1,1 1,1 0,0 0)),((10 10,11 10,11 11,10 10)))",
+        "GEOMETRYCOLLECTION (POINT (1 2),LINESTRING (1 2,3 4),"
+        + "GEOMETRYCOLLECTION (POLYGON ((0 0,0 1,1 1,0 0))))",
+        "GEOMETRYCOLLECTION EMPTY",
+    ]
+    geoms = [ogr.CreateGeometryFromWkt(wkt) for wkt in wkts]
+    g = ogr.Geometry(ogr.wkbLineString)
+    g.AddPoint_2D(1, 2)
+    g.AddPoint_2D(float("nan"), 4)
+    geoms.append(g)
+    g = ogr.Geometry(ogr.wkbMultiPoint)
+    g.AddGeometry(ogr.CreateGeometryFromWkt("POINT (1 2)"))
+    g.AddGeometry(ogr.CreateGeometryFromWkt("POINT EMPTY"))
+    geoms.append(g)
+
+    def write(filename):
+        ds = ogr.GetDriverByName(driver_name).CreateDataSource(filename)
+        lyr = ds.CreateLayer("test", options=options)
+        lyr.CreateField(ogr.FieldDefn("foo"))
+        for i, geom in enumerate(geoms):
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f["foo"] = str(i)
+            f.SetGeometry(geom)
+            with gdaltest.error_handler():
+                lyr.CreateFeature(f)
+        ds = None
+        fp = gdal.VSIFOpenL(filename, "rb")
+        data = gdal.VSIFReadL(1, 100000, fp)
+        gdal.VSIFCloseL(fp)
+        return data
+
+    streamed = write(str(tmp_vsimem / "streamed.json"))
+    with gdal.config_option("OGR_GEOJSON_STREAM_COORDINATES", "NO"):
+        not_streamed = write(str(tmp_vsimem / "not_streamed.json"))
+
+    assert b'"coordinates": [ [ ' in streamed
+    assert streamed == not_streamed
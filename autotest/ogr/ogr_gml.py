@@ -4327,3 +4327,58 @@ def test_ogr_gml_geom_link_to_immediate_child():
         "data/gml/link_to_immediate_child.gml", open_options=["WRITE_GFS=NO"]
     )
     assert ds
+
+
+###############################################################################
+# Test building geometries in worker threads (OGR_GML_NUM_THREADS)
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4", "ALL_CPUS"])
+def test_ogr_gml_read_num_threads(tmp_vsimem, num_threads):
+
+    filename = str(tmp_vsimem / "test.gml")
+    ds = gdal.GetDriverByName("GML").Create(filename, 0, 0, 0, gdal.GDT_Unknown)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPolygon)
+    lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    for i in range(1000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["id"] = i
+        if (i % 10) != 5:
+            f.SetGeometry(
+                ogr.CreateGeometryFromWkt(
+                    f"POLYGON(({i} 0,{i} 1,{i + 1} 1,{i + 1} 0,{i} 0))"
+                )
+            )
+        lyr.CreateFeature(f)
+    ds.Close()
+
+    with gdal.config_option("OGR_GML_NUM_THREADS", "1"):
+        ds = ogr.Open(filename)
+        lyr = ds.GetLayer(0)
+        expected = []
+        for f in lyr:
+            g = f.GetGeometryRef()
+            expected.append((f["id"], g.ExportToWkt() if g else None))
+        ds.Close()
+    assert len(expected) == 1000
+
+    with gdal.config_option("OGR_GML_NUM_THREADS", num_threads):
+        ds = ogr.Open(filename)
+        lyr = ds.GetLayer(0)
+        for _ in range(2):
+            got = []
+            for f in lyr:
+                g = f.GetGeometryRef()
+                got.append((f["id"], g.ExportToWkt() if g else None))
+            assert got == expected
+            lyr.ResetReading()
+
+        # Interrupted read
+        lyr.ResetReading()
+        for i in range(100):
+            f = lyr.GetNextFeature()
+        assert f["id"] == 99
+        lyr.ResetReading()
+        f = lyr.GetNextFeature()
+        assert f["id"] == 0
+        assert f.GetGeometryRef().ExportToWkt() == expected[0][1]
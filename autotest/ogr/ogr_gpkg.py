@@ -8408,6 +8408,110 @@ def test_ogr_gpkg_arrow_stream_numpy_multi_threading(
     assert i == num_features
 
 
+###############################################################################
+# Test multi-threaded Arrow reading of tables with holes in FID numbering
+
+
+@pytest.mark.parametrize(
+    "num_features,deleted_modulo,max_threads",
+    [
+        (1001, 3, "1"),
+        (1001, 3, "3"),
+        (1001, 5, "ALL_CPUS"),
+        (1001, 0, "4"),
+        (1000, 7, "4"),
+    ],
+)
+def test_ogr_gpkg_arrow_stream_numpy_multi_threading_fid_holes(
+    tmp_vsimem, num_features, deleted_modulo, max_threads
+):
+    pytest.importorskip("osgeo.gdal_array")
+    pytest.importorskip("numpy")
+
+    filename = tmp_vsimem / "test.gpkg"
+
+    ds = gdal.GetDriverByName("GPKG").Create(filename, 0, 0, 0, gdal.GDT_Unknown)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("i", ogr.OFTInteger))
+
+    for i in range(num_features):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["i"] = i
+        f.SetGeometryDirectly(ogr.CreateGeometryFromWkt(f"POINT({i} {i})"))
+        lyr.CreateFeature(f)
+
+    expected_fids = []
+    for fid in range(1, num_features + 1):
+        # Also creates a whole empty range of FIDs between 301 and 400
+        if (deleted_modulo and (fid % deleted_modulo) == 0) or (300 < fid <= 400):
+            assert lyr.DeleteFeature(fid) == ogr.OGRERR_NONE
+        else:
+            expected_fids.append(fid)
+
+    ds = None
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    stream = lyr.GetArrowStreamAsNumPy(
+        options=[
+            "USE_MASKED_ARRAYS=NO",
+            "MAX_FEATURES_IN_BATCH=100",
+            f"MAX_THREADS={max_threads}",
+        ]
+    )
+
+    got_msg = []
+
+    def my_handler(errorClass, errno, msg):
+        if errorClass != gdal.CE_Debug:
+            got_msg.append(msg)
+        return
+
+    with gdaltest.error_handler(my_handler):
+        batches = [batch for batch in stream]
+
+    assert len(got_msg) == 0
+
+    got_fids = []
+    for batch in batches:
+        assert len(batch["fid"]) > 0
+        assert len(batch["fid"]) <= 100
+        for fid, i, wkb in zip(batch["fid"], batch["i"], batch["geom"]):
+            assert i == fid - 1
+            assert ogr.CreateGeometryFromWkb(wkb).GetX() == fid - 1
+            got_fids.append(fid)
+    assert got_fids == expected_fids
+
+
+###############################################################################
+# Test Arrow interface on a table with very sparse FID numbering
+
+
+def test_ogr_gpkg_arrow_stream_numpy_sparse_fids(tmp_vsimem):
+    pytest.importorskip("osgeo.gdal_array")
+    pytest.importorskip("numpy")
+
+    filename = tmp_vsimem / "test.gpkg"
+
+    ds = gdal.GetDriverByName("GPKG").Create(filename, 0, 0, 0, gdal.GDT_Unknown)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbNone)
+    for fid in (1, 2, 1000000, (1 << 62)):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f.SetFID(fid)
+        lyr.CreateFeature(f)
+    ds = None
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    stream = lyr.GetArrowStreamAsNumPy(
+        options=["USE_MASKED_ARRAYS=NO", "MAX_FEATURES_IN_BATCH=2", "MAX_THREADS=2"]
+    )
+    batches = [batch for batch in stream]
+    assert len(batches) == 2
+    assert list(batches[0]["fid"]) == [1, 2]
+    assert list(batches[1]["fid"]) == [1000000, (1 << 62)]
+
+
 ###############################################################################
 # Test Arrow interface with bool fields
 
@@ -8589,6 +8693,55 @@ def test_ogr_gpkg_arrow_stream_numpy_detailed_spatial_filter(tmp_vsimem, layer_t
     ds = None
 
 
+###############################################################################
+# Test a non-rectangular spatial filter, which goes through the GEOS WKB
+# reader, or the OGRGeometry based fallback for curve geometries.
+
+
+@pytest.mark.require_geos
+def test_ogr_gpkg_non_rectangular_spatial_filter(tmp_vsimem):
+    pytest.importorskip("osgeo.gdal_array")
+    pytest.importorskip("numpy")
+
+    filename = str(tmp_vsimem / "test_ogr_gpkg_non_rectangular_spatial_filter.gpkg")
+    ds = ogr.GetDriverByName("GPKG").CreateDataSource(filename)
+    lyr = ds.CreateLayer("test", options=["FID=fid"])
+    wkts = [
+        "POINT(1 1)",
+        "POINT(8 1)",
+        "POINT Z(1 1 5)",
+        "POINT M(8 1 5)",
+        "LINESTRING(5 -1,5 1)",
+        "LINESTRING(9 2,9.5 9)",
+        "POLYGON((8 8,8 9,9 9,9 8,8 8))",
+        "CURVEPOLYGON(CIRCULARSTRING(1 1,2 2,1 1))",
+        "CIRCULARSTRING(9 8,9.5 8.5,9 9)",
+        "POLYGON EMPTY",
+    ]
+    for idx, wkt in enumerate(wkts):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f.SetFID(idx)
+        f.SetGeometryDirectly(ogr.CreateGeometryFromWkt(wkt))
+        lyr.CreateFeature(f)
+    ds = None
+
+    # Lower left triangle of the (0,0)-(10,10) square
+    filter_geom = ogr.CreateGeometryFromWkt("POLYGON((0 0,0 10,10 0,0 0))")
+    expected_fids = [
+        idx
+        for idx, wkt in enumerate(wkts)
+        if ogr.CreateGeometryFromWkt(wkt).Intersects(filter_geom)
+    ]
+    assert expected_fids == [0, 1, 2, 3, 4, 7]
+
+    with ogr.Open(filename) as ds:
+        lyr = ds.GetLayer(0)
+        lyr.SetSpatialFilter(filter_geom)
+        assert [f.GetFID() for f in lyr] == expected_fids
+        stream = lyr.GetArrowStreamAsNumPy(options=["USE_MASKED_ARRAYS=NO"])
+        assert [fid for batch in stream for fid in batch["fid"]] == expected_fids
+
+
 ###############################################################################
 # Test reading an empty file with GetArrowStream()
 
@@ -9067,6 +9220,61 @@ def test_ogr_gpkg_background_rtree_build(
     ds = None
 
 
+###############################################################################
+# Test building the RTree of an existing table with several threads
+
+
+@pytest.mark.parametrize("num_threads", ("1", "4"))
+def test_ogr_gpkg_create_spatial_index_parallel(tmp_vsimem, num_threads):
+
+    filename = tmp_vsimem / "test_ogr_gpkg_create_spatial_index_parallel.gpkg"
+    ds = gdaltest.gpkg_dr.CreateDataSource(filename)
+    lyr = ds.CreateLayer("foo", options=["SPATIAL_INDEX=NO"])
+    lyr.StartTransaction()
+    for i in range(1000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if i % 100 == 1:
+            pass
+        elif i % 100 == 2:
+            f.SetGeometryDirectly(ogr.CreateGeometryFromWkt("POINT EMPTY"))
+        elif i % 2 == 0:
+            f.SetGeometryDirectly(ogr.CreateGeometryFromWkt("POINT(%d %d)" % (i, -i)))
+        else:
+            f.SetGeometryDirectly(
+                ogr.CreateGeometryFromWkt(
+                    "POLYGON((%g %g,%g %g,%g %g,%g %g))"
+                    % (i, -i, i, -i + 0.5, i + 0.5, -i, i, -i)
+                )
+            )
+        assert lyr.CreateFeature(f) == ogr.OGRERR_NONE
+    lyr.CommitTransaction()
+    ds = None
+
+    ds = ogr.Open(filename, update=1)
+    with gdaltest.config_options(
+        {
+            "OGR_GPKG_NUM_THREADS": num_threads,
+            "OGR_GPKG_PARALLEL_RTREE_MIN_ROWS_PER_THREAD": "100",
+        }
+    ):
+        with ds.ExecuteSQL("SELECT CreateSpatialIndex('foo', 'geom')") as sql_lyr:
+            f = sql_lyr.GetNextFeature()
+            assert f.GetField(0) == 1
+    ds = None
+
+    ds = ogr.Open(filename)
+    with ds.ExecuteSQL("SELECT rtreecheck('rtree_foo_geom')") as sql_lyr:
+        f = sql_lyr.GetNextFeature()
+        assert f.GetField(0) == "ok"
+    with ds.ExecuteSQL("SELECT * FROM rtree_foo_geom") as sql_lyr:
+        assert sql_lyr.GetFeatureCount() == 980
+    lyr = ds.GetLayer(0)
+    for i in range(0, 1000, 7):
+        lyr.SetSpatialFilterRect(i - 0.1, -i - 0.1, i + 0.1, -i + 0.1)
+        assert lyr.GetFeatureCount() == (0 if i % 100 in (1, 2) else 1), i
+    ds = None
+
+
 ###############################################################################
 
 
@@ -10510,3 +10718,130 @@ def test_ogr_gpkg_launder(tmp_vsimem):
     assert lyr.GetGeometryColumn() == "my_geom"
     lyr.CreateField(ogr.FieldDefn("_"))
     assert lyr.GetLayerDefn().GetFieldDefn(0).GetNameRef() == "x_"
+
+
+###############################################################################
+# Test BULK_LOAD=YES layer creation option
+
+
+@gdaltest.enable_exceptions()
+@pytest.mark.parametrize("bulk_insert_rows", ["1", "3", "100"])
+def test_ogr_gpkg_bulk_load(tmp_vsimem, bulk_insert_rows):
+
+    filename = tmp_vsimem / "test_ogr_gpkg_bulk_load.gpkg"
+
+    with gdal.config_option("OGR_GPKG_BULK_INSERT_ROWS", bulk_insert_rows):
+        ds = ogr.GetDriverByName("GPKG").CreateDataSource(filename)
+        lyr = ds.CreateLayer("test", options=["BULK_LOAD=YES"])
+        lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+        lyr.CreateField(ogr.FieldDefn("dt", ogr.OFTDateTime))
+        lyr.CreateField(ogr.FieldDefn("bin", ogr.OFTBinary))
+        lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+
+        ds.StartTransaction()
+        for i in range(10):
+            f = ogr.Feature(lyr.GetLayerDefn())
+            if i != 3:
+                f["str"] = "val%d" % i
+            f["dt"] = "2024/01/02 03:04:%02d" % i
+            f.SetFieldBinaryFromHexString("bin", "0102%02X" % i)
+            f["int"] = i
+            if i != 5:
+                f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d %d)" % (i, -i)))
+            if i == 7:
+                f.SetFID(100)
+            lyr.CreateFeature(f)
+            assert f.GetFID() == (100 if i == 7 else i + 1 if i < 7 else 100 + i - 7)
+        ds.CommitTransaction()
+
+        # Partial batch, outside of a transaction
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["str"] = "last"
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (100 100)"))
+        lyr.CreateFeature(f)
+        assert f.GetFID() == 103
+
+        # Reading flushes pending rows
+        assert lyr.GetFeatureCount() == 11
+        f = lyr.GetFeature(103)
+        assert f["str"] == "last"
+        ds.Close()
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    assert lyr.GetFeatureCount() == 11
+    assert lyr.TestCapability(ogr.OLCFastSpatialFilter)
+    fids = [f.GetFID() for f in lyr]
+    assert fids == [1, 2, 3, 4, 5, 6, 7, 100, 101, 102, 103]
+
+    f = lyr.GetFeature(4)
+    assert f.IsFieldNull("str")
+    assert f["dt"] == "2024/01/02 03:04:03+00"
+    assert f.GetFieldAsBinary("bin") == b"\x01\x02\x03"
+    assert f["int"] == 3
+    assert f.GetGeometryRef().ExportToWkt() == "POINT (3 -3)"
+
+    assert lyr.GetFeature(6).GetGeometryRef() is None
+
+    lyr.SetSpatialFilterRect(6.5, -7.5, 7.5, -6.5)
+    assert [f["int"] for f in lyr] == [7]
+    lyr.SetSpatialFilter(None)
+
+    with ds.ExecuteSQL("SELECT COUNT(*) FROM rtree_test_geom") as sql_lyr:
+        assert sql_lyr.GetNextFeature().GetField(0) == 10
+
+
+###############################################################################
+# Test reading through the page cache of the SQLite VFS
+
+
+@pytest.mark.parametrize("prefetch_max_pages", ["0", "512"])
+def test_ogr_gpkg_vfs_page_cache(tmp_vsimem, prefetch_max_pages):
+
+    filename = str(tmp_vsimem / "test_ogr_gpkg_vfs_page_cache.gpkg")
+    ds = gdal.GetDriverByName("GPKG").Create(filename, 0, 0, 0, gdal.GDT_Unknown)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    lyr.StartTransaction()
+    for i in range(5000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["str"] = "value_%d" % i + "x" * (i % 100)
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d %d)" % (i, -i)))
+        lyr.CreateFeature(f)
+    lyr.CommitTransaction()
+    ds.Close()
+
+    messages = []
+
+    def my_handler(errorClass, errno, msg):
+        if errorClass == gdal.CE_Debug and "VFS page cache" in msg:
+            messages.append(msg)
+
+    with gdaltest.config_options(
+        {
+            "OGR_SQLITE_VFS_CACHE": "YES",
+            "OGR_SQLITE_VFS_CACHE_SIZE": "1000000",
+            "OGR_SQLITE_VFS_PREFETCH_MAX_PAGES": prefetch_max_pages,
+            "CPL_DEBUG": "ON",
+        }
+    ), gdaltest.error_handler(my_handler):
+        ds = ogr.Open(filename)
+        lyr = ds.GetLayer(0)
+        assert lyr.GetFeatureCount() == 5000
+        count = 0
+        for f in lyr:
+            i = f.GetFID() - 1
+            assert f["str"] == "value_%d" % i + "x" * (i % 100)
+            assert f.GetGeometryRef().GetX() == i
+            count += 1
+        assert count == 5000
+        for i in (4999, 1, 2500, 3333):
+            f = lyr.GetFeature(i + 1)
+            assert f["str"] == "value_%d" % i + "x" * (i % 100)
+        lyr.SetSpatialFilterRect(99.5, -100.5, 100.5, -99.5)
+        assert [f.GetFID() for f in lyr] == [101]
+        ds.Close()
+
+    assert messages
+    if prefetch_max_pages == "0":
+        assert " 0 prefetched pages" in messages[0]
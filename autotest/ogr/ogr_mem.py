@@ -2860,3 +2860,62 @@ def test_ogr_mem_lyr_get_dataset():
     ds = ogr.GetDriverByName("Memory").CreateDataSource("foo")
     lyr = ds.CreateLayer("test")
     assert lyr.GetDataset().GetDescription() == "foo"
+
+
+###############################################################################
+# Test spatial filtering through the spatial index, and its maintenance
+
+
+@pytest.mark.parametrize("sparse_fids", [False, True])
+def test_ogr_mem_spatial_index(sparse_fids):
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("test")
+    for i in range(1000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if sparse_fids:
+            f.SetFID(200000 + i * 1000)
+        f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT ({i % 100} {i // 100})"))
+        lyr.CreateFeature(f)
+
+    def get_fids():
+        return [f.GetFID() for f in lyr]
+
+    lyr.SetSpatialFilterRect(9.5, 0.5, 11.5, 2.5)
+    fids = get_fids()
+    assert len(fids) == 4
+    assert fids == sorted(fids)
+    assert lyr.GetFeatureCount() == 4
+
+    # Move a point inside the filter
+    first_fid = 200000 if sparse_fids else 0
+    f = lyr.GetFeature(first_fid)
+    f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (10 1.5)"))
+    lyr.SetFeature(f)
+    assert get_fids() == [first_fid] + fids
+
+    # Move a point outside of the filter
+    f = lyr.GetFeature(fids[1])
+    f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (-10 -10)"))
+    lyr.SetFeature(f)
+    assert fids[1] not in get_fids()
+
+    # Delete a point
+    lyr.DeleteFeature(fids[2])
+    assert fids[2] not in get_fids()
+
+    # Add a point outside of the initial extent, and inside the filter
+    lyr.SetSpatialFilterRect(1000, 1000, 1001, 1001)
+    assert get_fids() == []
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (1000.5 1000.5)"))
+    lyr.CreateFeature(f)
+    assert get_fids() == [f.GetFID()]
+
+    # Update the geometry with UpdateFeature()
+    f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (0 0)"))
+    lyr.UpdateFeature(f, [], [0], False)
+    assert get_fids() == []
+
+    lyr.SetSpatialFilter(None)
+    assert lyr.GetFeatureCount() == 1000
@@ -29,8 +29,10 @@
 # DEALINGS IN THE SOFTWARE.
 ###############################################################################
 
-# import os
+import os
+
 # import pdb
+import shutil
 
 import gdaltest
 
@@ -225,6 +227,122 @@ def test_ogr_miramon_read_simple_arc():
     check_simple_arc(ds)
 
 
+###############################################################################
+# Test spatial filtering on arc and polygon layers, that uses the bounding
+# boxes of the element headers
+
+
+@pytest.mark.parametrize(
+    "filename",
+    [
+        "Arcs/SimpleArcs/SimpleArcFile.arc",
+        "Polygons/SimplePolygons/SimplePolFile.pol",
+        "Polygons/Multipolygons/Multipolygons.pol",
+    ],
+)
+def test_ogr_miramon_spatial_filter(filename):
+
+    ds = gdal.OpenEx("data/miramon/" + filename, gdal.OF_VECTOR)
+    lyr = ds.GetLayer(0)
+    assert lyr.TestCapability(ogr.OLCFastSpatialFilter)
+
+    envelopes = {f.GetFID(): f.GetGeometryRef().GetEnvelope() for f in lyr}
+    assert envelopes
+
+    for minx, maxx, miny, maxy in envelopes.values():
+        lyr.SetSpatialFilterRect(minx, miny, maxx, maxy)
+        expected_fids = [
+            fid
+            for fid, (fminx, fmaxx, fminy, fmaxy) in envelopes.items()
+            if fmaxx >= minx and fminx <= maxx and fmaxy >= miny and fminy <= maxy
+        ]
+        got_fids = [f.GetFID() for f in lyr]
+        assert set(got_fids) <= set(expected_fids)
+        assert set(got_fids) >= set(
+            fid
+            for fid in expected_fids
+            if lyr.GetFeature(fid).GetGeometryRef().Intersects(
+                lyr.GetSpatialFilter()
+            )
+        )
+
+    (minx, maxx, miny, maxy) = list(envelopes.values())[0]
+    lyr.SetSpatialFilterRect(maxx + 1e6, maxy + 1e6, maxx + 2e6, maxy + 2e6)
+    assert lyr.GetNextFeature() is None
+    lyr.SetSpatialFilter(None)
+    assert len([f for f in lyr]) == len(envelopes)
+
+
+@pytest.mark.parametrize(
+    "filename",
+    [
+        "Points/SimplePoints/SimplePointsFile.pnt",
+        "Points/3dpoints/Some3dPoints.pnt",
+    ],
+)
+def test_ogr_miramon_points_sequential_and_random_reads(filename):
+
+    ds = gdal.OpenEx("data/miramon/" + filename, gdal.OF_VECTOR)
+    lyr = ds.GetLayer(0)
+
+    wkts = [(f.GetFID(), f.GetGeometryRef().ExportToIsoWkt()) for f in lyr]
+    assert wkts
+
+    # Random access, then back to sequential reading
+    for fid, wkt in reversed(wkts):
+        assert lyr.GetFeature(fid).GetGeometryRef().ExportToIsoWkt() == wkt
+    lyr.ResetReading()
+    assert [
+        (f.GetFID(), f.GetGeometryRef().ExportToIsoWkt()) for f in lyr
+    ] == wkts
+
+
+###############################################################################
+# Test CREATE INDEX and the use of attribute indexes by attribute filters
+
+
+def test_ogr_miramon_attribute_index(tmp_path):
+
+    for ext in (".pnt", "T.dbf", "T.rel"):
+        shutil.copy(
+            "data/miramon/Points/SimplePoints/SimplePointsFile" + ext,
+            tmp_path / ("SimplePointsFile" + ext),
+        )
+    filename = str(tmp_path / "SimplePointsFile.pnt")
+
+    with gdal.OpenEx(filename, gdal.OF_VECTOR) as ds:
+        ds.ExecuteSQL("CREATE INDEX ON SimplePointsFile USING ID_GRAFIC")
+        ds.ExecuteSQL("CREATE INDEX ON SimplePointsFile USING ATT1")
+    assert os.path.exists(filename + ".idm")
+    assert os.path.exists(filename + ".ind")
+
+    with gdal.OpenEx(filename, gdal.OF_VECTOR) as ds:
+        lyr = ds.GetLayer(0)
+
+        lyr.SetAttributeFilter("ID_GRAFIC = 1")
+        assert [f.GetFID() for f in lyr] == [1]
+        assert lyr.GetFeatureCount() == 1
+
+        lyr.SetAttributeFilter("ID_GRAFIC IN (2, 0)")
+        assert [f.GetFID() for f in lyr] == [0, 2]
+
+        lyr.SetAttributeFilter("ATT1 = 'A'")
+        assert 0 in [f.GetFID() for f in lyr]
+
+        lyr.SetAttributeFilter("ID_GRAFIC = 12345")
+        assert lyr.GetNextFeature() is None
+
+        # Not resolved by the index
+        lyr.SetAttributeFilter("ID_GRAFIC > 0")
+        assert [f.GetFID() for f in lyr] == [1, 2]
+
+        lyr.SetAttributeFilter(None)
+        assert lyr.GetFeatureCount() == 3
+
+        ds.ExecuteSQL("DROP INDEX ON SimplePointsFile")
+    assert not os.path.exists(filename + ".idm")
+
+
 def test_ogr_miramon_write_simple_arc_EmptyVersion(tmp_vsimem):
 
     out_filename = str(tmp_vsimem / "out.arc")
@@ -415,6 +533,103 @@ def test_ogr_miramon_write_simple_polygon_last_version(tmp_vsimem):
     check_simple_polygon(ds)
 
 
+###############################################################################
+# Test the FEATURE_COUNT_HINT layer creation option, with hints smaller and
+# bigger than the real number of features
+
+
+@pytest.mark.parametrize("hint", ["1", "200000"])
+@pytest.mark.parametrize(
+    "src_filename,out_basename,check_func",
+    [
+        (
+            "data/miramon/Points/SimplePoints/SimplePointsFile.pnt",
+            "out.pnt",
+            check_simple_point,
+        ),
+        (
+            "data/miramon/Arcs/SimpleArcs/SimpleArcFile.arc",
+            "out.arc",
+            check_simple_arc,
+        ),
+        (
+            "data/miramon/Polygons/SimplePolygons/SimplePolFile.pol",
+            "out.pol",
+            check_simple_polygon,
+        ),
+    ],
+)
+def test_ogr_miramon_write_feature_count_hint(
+    tmp_vsimem, src_filename, out_basename, check_func, hint
+):
+
+    out_filename = str(tmp_vsimem / out_basename)
+    gdal.VectorTranslate(
+        out_filename,
+        src_filename,
+        format="MiraMonVector",
+        options="-lco FEATURE_COUNT_HINT=" + hint,
+    )
+    ds = gdal.OpenEx(out_filename, gdal.OF_VECTOR)
+    check_func(ds)
+
+
+###############################################################################
+# Test writing polygons with their geometry prepared by worker threads
+
+
+def test_ogr_miramon_write_polygons_num_threads(tmp_vsimem):
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 0, 0, 0, gdal.GDT_Unknown)
+    src_lyr = src_ds.CreateLayer("test", geom_type=ogr.wkbUnknown)
+    src_lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    for i in range(1000):
+        f = ogr.Feature(src_lyr.GetLayerDefn())
+        f["id"] = i
+        x = i % 40
+        y = i // 40
+        square = "(%d %d,%d %d,%d %d,%d %d,%d %d)" % (
+            (x, y, x + 1, y, x + 1, y + 1, x, y + 1, x, y)
+        )
+        hole = "(%f %f,%f %f,%f %f,%f %f)" % (
+            (x + 0.25, y + 0.25, x + 0.75, y + 0.25)
+            + (x + 0.5, y + 0.75, x + 0.25, y + 0.25)
+        )
+        if i % 100 == 50:
+            # Interleave some other geometry types
+            wkt = "POINT (%d %d)" % (x, y)
+        elif i % 3 == 0:
+            # Counterclockwise exterior ring, with a hole
+            wkt = "POLYGON (%s,%s)" % (square, hole)
+        elif i % 3 == 1:
+            wkt = "MULTIPOLYGON ((%s),(%s))" % (hole, square)
+        else:
+            wkt = "POLYGON (%s)" % square
+        f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+        src_lyr.CreateFeature(f)
+
+    def read_features(filename):
+        ds = gdal.OpenEx(filename, gdal.OF_VECTOR)
+        lyr = ds.GetLayer(0)
+        return [
+            (f.GetFID(), f["id"], f.GetGeometryRef().ExportToIsoWkt()) for f in lyr
+        ]
+
+    ref_filename = str(tmp_vsimem / "ref" / "out.pol")
+    gdal.VectorTranslate(
+        ref_filename, src_ds, format="MiraMonVector", options="-lco NUM_THREADS=1"
+    )
+
+    out_filename = str(tmp_vsimem / "mt" / "out.pol")
+    gdal.VectorTranslate(
+        out_filename, src_ds, format="MiraMonVector", options="-lco NUM_THREADS=4"
+    )
+
+    ref_features = read_features(ref_filename)
+    assert len(ref_features) == 990
+    assert read_features(out_filename) == ref_features
+
+
 ###############################################################################
 # basic multipolygon test
 
@@ -1444,3 +1659,104 @@ def test_ogr_miramon_create_field_after_feature(tmp_path):
         match="Cannot create fields to a layer with already existing features in it",
     ):
         create_common_attributes(lyr)
+
+
+###############################################################################
+# Test that the native GetArrowStream() implementation returns the same
+# content as the feature based reading
+
+
+def _check_arrow_stream_vs_features(lyr):
+
+    stream = lyr.GetArrowStream(["MAX_FEATURES_IN_BATCH=2"])
+    schema = stream.GetSchema()
+    mem_ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    mem_lyr = mem_ds.CreateLayer("test", geom_type=ogr.wkbUnknown)
+    for i in range(schema.GetChildrenCount()):
+        if schema.GetChild(i).GetName() not in ("wkb_geometry", "OGC_FID"):
+            mem_lyr.CreateFieldFromArrowSchema(schema.GetChild(i))
+    while True:
+        array = stream.GetNextRecordBatch()
+        if array is None:
+            break
+        assert mem_lyr.WriteArrowBatch(schema, array, ["FID=OGC_FID"])
+    stream = None
+    assert (
+        lyr.GetMetadataItem(
+            "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
+        )
+        == "YES"
+    )
+
+    lyr.ResetReading()
+    assert mem_lyr.GetFeatureCount() == lyr.GetFeatureCount()
+    for f in lyr:
+        f_arrow = mem_lyr.GetFeature(f.GetFID())
+        assert f_arrow is not None
+        for i in range(f.GetFieldCount()):
+            name = f.GetFieldDefnRef(i).GetName()
+            assert f_arrow.IsFieldSetAndNotNull(name) == f.IsFieldSetAndNotNull(
+                name
+            ), name
+            assert f_arrow.GetField(name) == f.GetField(name), name
+        g = f.GetGeometryRef()
+        g_arrow = f_arrow.GetGeometryRef()
+        assert g_arrow.ExportToIsoWkt() == g.ExportToIsoWkt()
+
+
+@pytest.mark.parametrize(
+    "filename,open_options",
+    [
+        ("Points/SimplePoints/SimplePointsFile.pnt", []),
+        ("Points/3dpoints/Some3dPoints.pnt", []),
+        ("Arcs/SimpleArcs/SimpleArcFile.arc", []),
+        ("Arcs/3dArcs/linies_3d_WGS84.arc", []),
+        ("Polygons/SimplePolygons/SimplePolFile.pol", []),
+        ("Polygons/3dPolygons/tin_3d.pol", []),
+        ("Polygons/Multipolygons/Multipolygons.pol", []),
+        ("Polygons/Multipolygons/Multipolygons.pol", ["MultiRecordIndex=1"]),
+        ("Polygons/Multipolygons/Multipolygons.pol", ["MultiRecordIndex=Last"]),
+        ("Polygons/Multipolygons/Multipolygons.pol", ["MultiRecordIndex=JSON"]),
+    ],
+)
+def test_ogr_miramon_arrow_stream(filename, open_options):
+
+    ds = gdal.OpenEx(
+        "data/miramon/" + filename, gdal.OF_VECTOR, open_options=open_options
+    )
+    lyr = ds.GetLayer(0)
+    assert lyr.TestCapability(ogr.OLCFastGetArrowStream)
+    _check_arrow_stream_vs_features(lyr)
+
+
+def test_ogr_miramon_arrow_stream_list_fields(tmp_path):
+
+    filename = str(tmp_path / "DataSetPOINT")
+    ds = ogr.GetDriverByName("MiramonVector").CreateDataSource(filename)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbUnknown)
+    create_common_attributes(lyr)
+    for i in range(5):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        assign_common_attributes(f)
+        f["strlistfield"] = ["foo%d" % j for j in range(i)]
+        f["boolfield"] = i % 2
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d %d)" % (i, -i)))
+        lyr.CreateFeature(f)
+    f = None
+    ds = None
+
+    ds = ogr.Open(filename + "/test.pnt")
+    lyr = ds.GetLayer(0)
+    _check_arrow_stream_vs_features(lyr)
+
+    # Regular code path
+    lyr.SetAttributeFilter("1 = 1")
+    stream = lyr.GetArrowStream()
+    assert stream.GetNextRecordBatch() is not None
+    stream = None
+    assert (
+        lyr.GetMetadataItem(
+            "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
+        )
+        == "NO"
+    )
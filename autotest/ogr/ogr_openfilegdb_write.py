@@ -1761,6 +1761,82 @@ def test_ogr_openfilegdb_write_attribute_index(tmp_vsimem):
     ds = None
 
 
+###############################################################################
+# Test use of attribute indexes for LIKE predicates with a literal prefix
+
+
+def test_ogr_openfilegdb_write_attribute_index_like(tmp_vsimem):
+
+    dirname = tmp_vsimem / "out.gdb"
+
+    ds = ogr.GetDriverByName("OpenFileGDB").CreateDataSource(dirname)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbNone)
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("lower_str", ogr.OFTString))
+    values = ["abc", "abcd", "ab", "abd", "ABC", "Abcd", "abc\tz", "a%b", "a_b"]
+    values += ["x" * 100, ("x" * 100) + "y", None]
+    values += ["val%04d" % i for i in range(1000)]
+    for v in values:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["str"] = v
+        f["lower_str"] = v
+        assert lyr.CreateFeature(f) == ogr.OGRERR_NONE
+    ds.ExecuteSQL("CREATE INDEX idx_str ON test(str)")
+    ds.ExecuteSQL("CREATE INDEX idx_lower_str ON test(LOWER(lower_str))")
+    ds = None
+
+    def get_fids(lyr, where):
+        lyr.SetAttributeFilter(where)
+        return [f.GetFID() for f in lyr]
+
+    def get_attr_index_use(ds, lyr):
+        sql_lyr = ds.ExecuteSQL("GetLayerAttrIndexUse " + lyr.GetName())
+        attr_index_use = int(sql_lyr.GetNextFeature().GetField(0))
+        ds.ReleaseResultSet(sql_lyr)
+        return attr_index_use
+
+    ds = ogr.Open(dirname)
+    lyr = ds.GetLayer(0)
+
+    for field_name in ("str", "lower_str"):
+        for op, pattern, index_used in [
+            ("LIKE", "abc%", True),
+            ("LIKE", "ABC%", True),
+            ("LIKE", "ab_d", True),
+            ("LIKE", "ab%", True),
+            ("LIKE", "val05%", True),
+            ("LIKE", "val0999", True),
+            ("LIKE", "x" * 90 + "%", True),
+            ("LIKE", "a\\%%' ESCAPE '\\", True),
+            ("LIKE", "%bc", False),
+            ("ILIKE", "Abc%", field_name == "lower_str"),
+            ("ILIKE", "val0%", field_name == "lower_str"),
+            ("ILIKE", "%", False),
+        ]:
+            where = f"{field_name} {op} '{pattern}'"
+            with gdal.config_option("OPENFILEGDB_USE_INDEX", "NO"):
+                expected = get_fids(lyr, where)
+            got = get_fids(lyr, where)
+            assert got == expected, where
+            assert get_attr_index_use(ds, lyr) == (1 if index_used else 0), where
+
+    # Combination with other predicates
+    where = "str LIKE 'val01%' OR str = 'abc'"
+    with gdal.config_option("OPENFILEGDB_USE_INDEX", "NO"):
+        expected = get_fids(lyr, where)
+    assert len(expected) == 101
+    assert get_fids(lyr, where) == expected
+
+    where = "str LIKE 'val01%' AND NOT str LIKE 'val011%'"
+    with gdal.config_option("OPENFILEGDB_USE_INDEX", "NO"):
+        expected = get_fids(lyr, where)
+    assert len(expected) == 90
+    assert get_fids(lyr, where) == expected
+    assert get_attr_index_use(ds, lyr) == 1
+
+    ds = None
+
+
 ###############################################################################
 
 
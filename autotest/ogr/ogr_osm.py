@@ -324,6 +324,15 @@ def test_ogr_osm_3_custom_compress_nodes():
         test_ogr_osm_3()
 
 
+###############################################################################
+# Test ogr2ogr with --config OSM_DENSE_NODES_INDEX YES
+
+
+def test_ogr_osm_3_dense_nodes_index():
+    with gdal.config_option("OSM_DENSE_NODES_INDEX", "YES"):
+        test_ogr_osm_3()
+
+
 ###############################################################################
 # Test ogr2ogr with all layers
 
@@ -513,6 +522,16 @@ def test_ogr_osm_9():
         test_ogr_osm_8()
 
 
+###############################################################################
+# Same as ogr_osm_8 but with OSM_DENSE_NODES_INDEX=YES
+
+
+def test_ogr_osm_9_dense_nodes_index():
+
+    with gdal.config_option("OSM_DENSE_NODES_INDEX", "YES"):
+        test_ogr_osm_8()
+
+
 ###############################################################################
 # Some error conditions
 
@@ -3724,6 +3724,142 @@ def test_ogr_parquet_sort_by_bbox(tmp_vsimem):
     check_file(outfilename2)
 
 
+###############################################################################
+# Test SORT_BY_HILBERT=YES creation option
+
+
+def _hilbert_code(x, y):
+    N = 1 << 16
+    d = 0
+    s = N // 2
+    while s > 0:
+        rx = 1 if (x & s) > 0 else 0
+        ry = 1 if (y & s) > 0 else 0
+        d += s * s * ((3 * rx) ^ ry)
+        if ry == 0:
+            if rx == 1:
+                x = N - 1 - x
+                y = N - 1 - y
+            x, y = y, x
+        s //= 2
+    return d
+
+
+def test_ogr_parquet_sort_by_hilbert(tmp_vsimem):
+
+    outfilename = str(tmp_vsimem / "test_ogr_parquet_sort_by_hilbert.parquet")
+    ds = ogr.GetDriverByName("Parquet").CreateDataSource(outfilename)
+
+    with pytest.raises(Exception, match="mutually exclusive"):
+        ds.CreateLayer(
+            "test",
+            geom_type=ogr.wkbPoint,
+            options=["SORT_BY_BBOX=YES", "SORT_BY_HILBERT=YES"],
+        )
+
+    ROW_GROUP_SIZE = 64
+    lyr = ds.CreateLayer(
+        "test",
+        geom_type=ogr.wkbPoint,
+        options=[
+            "SORT_BY_HILBERT=YES",
+            f"ROW_GROUP_SIZE={ROW_GROUP_SIZE}",
+            "FID=fid",
+        ],
+    )
+    assert lyr.TestCapability(ogr.OLCFastWriteArrowBatch) == 0
+    lyr.CreateField(ogr.FieldDefn("i", ogr.OFTInteger))
+    COUNT_NON_SPATIAL = 10
+    GRID_SIZE = 32
+    for i in range(COUNT_NON_SPATIAL):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["i"] = i
+        lyr.CreateFeature(f)
+    expected_order = []
+    for i in range(GRID_SIZE * GRID_SIZE):
+        x = i % GRID_SIZE
+        y = i // GRID_SIZE
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["i"] = i + COUNT_NON_SPATIAL
+        f.SetGeometryDirectly(ogr.CreateGeometryFromWkt(f"POINT({x} {y})"))
+        lyr.CreateFeature(f)
+        hx = int(min(max(x / (GRID_SIZE - 1) * 65535.0, 0), 65535))
+        hy = int(min(max(y / (GRID_SIZE - 1) * 65535.0, 0), 65535))
+        expected_order.append((_hilbert_code(hx, hy), i + COUNT_NON_SPATIAL))
+    ds = None
+    expected_order = [fid for _, fid in sorted(expected_order)]
+
+    def check_file(filename):
+        ds = ogr.Open(filename)
+        lyr = ds.GetLayer(0)
+
+        # First features should be non spatial ones
+        for i in range(COUNT_NON_SPATIAL):
+            f = lyr.GetNextFeature()
+            assert f.GetFID() == i
+            assert f.GetGeometryRef() is None
+
+        # Then spatial features, along the Hilbert curve
+        got_order = []
+        for f in lyr:
+            assert f.GetFID() == f["i"]
+            g = f.GetGeometryRef()
+            i = f["i"] - COUNT_NON_SPATIAL
+            assert g.GetX() == i % GRID_SIZE
+            assert g.GetY() == i // GRID_SIZE
+            got_order.append(f.GetFID())
+        assert got_order == expected_order
+
+    check_file(outfilename)
+
+    # Check that this works also when using the Arrow interface for creation
+    outfilename2 = str(tmp_vsimem / "test_ogr_parquet_sort_by_hilbert2.parquet")
+    gdal.VectorTranslate(
+        outfilename2,
+        outfilename,
+        layerCreationOptions=["SORT_BY_HILBERT=YES", "ROW_GROUP_SIZE=64"],
+    )
+    check_file(outfilename2)
+
+
+###############################################################################
+# Test writing with and without OGR_PARQUET_USE_THREADS
+
+
+@pytest.mark.parametrize("use_threads", ["YES", "NO"])
+def test_ogr_parquet_write_use_threads(tmp_vsimem, use_threads):
+
+    outfilename = str(tmp_vsimem / "test_ogr_parquet_write_use_threads.parquet")
+    with gdaltest.config_option("OGR_PARQUET_USE_THREADS", use_threads):
+        ds = ogr.GetDriverByName("Parquet").CreateDataSource(outfilename)
+        lyr = ds.CreateLayer(
+            "test", geom_type=ogr.wkbPoint, options=["ROW_GROUP_SIZE=10"]
+        )
+        lyr.CreateField(ogr.FieldDefn("i", ogr.OFTInteger))
+        lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+        for i in range(95):
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f["i"] = i
+            f["str"] = str(i) * (i % 5)
+            if i % 7 != 0:
+                f.SetGeometryDirectly(ogr.CreateGeometryFromWkt(f"POINT({i} {-i})"))
+            lyr.CreateFeature(f)
+        ds = None
+
+    ds = ogr.Open(outfilename)
+    lyr = ds.GetLayer(0)
+    assert lyr.GetMetadataItem("NUM_ROW_GROUPS", "_PARQUET_") == "10"
+    assert lyr.GetFeatureCount() == 95
+    for i, f in enumerate(lyr):
+        assert f["i"] == i
+        assert f["str"] == str(i) * (i % 5)
+        if i % 7 != 0:
+            assert f.GetGeometryRef().ExportToWkt() == f"POINT ({i} {-i})"
+        else:
+            assert f.GetGeometryRef() is None
+    assert lyr.GetExtent() == (1, 94, -94, -1)
+
+
 ###############################################################################
 # Check GeoArrow struct encoding
 
@@ -4073,3 +4209,52 @@ def test_ogr_parquet_ignored_fields_bounding_box_column_arrow_dataset(tmp_path):
     lyr.SetSpatialFilterRect(0, 0, 0, 0)
     lyr.ResetReading()
     assert lyr.GetNextFeature() is None
+
+
+###############################################################################
+# Test row group skipping for attribute filters with IN and OR
+
+
+@pytest.mark.parametrize(
+    "filter,expected_ids",
+    [
+        ("id IN (5, 95)", [5, 95]),
+        ("id IN (5, 1000)", [5]),
+        ("id IN (1000, 2000)", []),
+        ("id = 5 OR id = 95", [5, 95]),
+        ("id < 2 OR id > 97", [0, 1, 98, 99]),
+        ("id = 5 OR (id >= 50 AND id < 52)", [5, 50, 51]),
+        ("str IN ('s05', 's95')", [5, 95]),
+        ("str = 's05' OR id = 95", [5, 95]),
+        ("str IN ('s05', 's95') AND id > 10", [95]),
+        ("(id = 5 OR id = 95) AND (str = 's95' OR str = 'x')", [95]),
+        ("id = 5 OR str IS NULL", [5]),
+        ("NOT (id IN (5, 95)) AND id < 3", [0, 1, 2]),
+    ],
+)
+def test_ogr_parquet_attribute_filter_in_or_row_groups(
+    tmp_vsimem, filter, expected_ids
+):
+
+    outfilename = str(tmp_vsimem / "test.parquet")
+    ds = ogr.GetDriverByName("Parquet").CreateDataSource(outfilename)
+    lyr = ds.CreateLayer(
+        "test", geom_type=ogr.wkbNone, options=["ROW_GROUP_SIZE=10"]
+    )
+    lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    for i in range(100):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["id"] = i
+        f["str"] = "s%02d" % i
+        lyr.CreateFeature(f)
+    ds = None
+
+    ds = ogr.Open(outfilename)
+    lyr = ds.GetLayer(0)
+    with ogrtest.attribute_filter(lyr, filter):
+        assert [f["id"] for f in lyr] == expected_ids
+        assert lyr.GetFeatureCount() == len(expected_ids)
+        with gdaltest.config_option("OGR_PARQUET_USE_BLOOM_FILTER", "NO"):
+            lyr.ResetReading()
+            assert [f["id"] for f in lyr] == expected_ids
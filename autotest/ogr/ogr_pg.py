@@ -5308,6 +5308,98 @@ def test_ogr_pg_copy_error(pg_ds):
             gdal.VectorTranslate(pg_ds.GetDescription(), src_ds)
 
 
+###############################################################################
+# Test PG_USE_COPY_BINARY=YES
+
+
+@only_with_postgis
+def test_ogr_pg_copy_binary(pg_ds):
+
+    src_ds = gdal.GetDriverByName("Memory").Create("", 0, 0, 0, gdal.GDT_Unknown)
+    srs = osr.SpatialReference()
+    srs.ImportFromEPSG(4326)
+    src_lyr = src_ds.CreateLayer("src", geom_type=ogr.wkbPolygon, srs=srs)
+    fld_defn = ogr.FieldDefn("bool", ogr.OFTInteger)
+    fld_defn.SetSubType(ogr.OFSTBoolean)
+    src_lyr.CreateField(fld_defn)
+    fld_defn = ogr.FieldDefn("int16", ogr.OFTInteger)
+    fld_defn.SetSubType(ogr.OFSTInt16)
+    src_lyr.CreateField(fld_defn)
+    src_lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    src_lyr.CreateField(ogr.FieldDefn("int64", ogr.OFTInteger64))
+    fld_defn = ogr.FieldDefn("float32", ogr.OFTReal)
+    fld_defn.SetSubType(ogr.OFSTFloat32)
+    src_lyr.CreateField(fld_defn)
+    src_lyr.CreateField(ogr.FieldDefn("real", ogr.OFTReal))
+    fld_defn = ogr.FieldDefn("numeric", ogr.OFTReal)
+    fld_defn.SetWidth(10)
+    fld_defn.SetPrecision(3)
+    src_lyr.CreateField(fld_defn)
+    fld_defn = ogr.FieldDefn("numeric_int", ogr.OFTInteger64)
+    fld_defn.SetWidth(12)
+    src_lyr.CreateField(fld_defn)
+    src_lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    fld_defn = ogr.FieldDefn("str5", ogr.OFTString)
+    fld_defn.SetWidth(5)
+    src_lyr.CreateField(fld_defn)
+    src_lyr.CreateField(ogr.FieldDefn("date", ogr.OFTDate))
+    src_lyr.CreateField(ogr.FieldDefn("time", ogr.OFTTime))
+    src_lyr.CreateField(ogr.FieldDefn("datetime", ogr.OFTDateTime))
+    src_lyr.CreateField(ogr.FieldDefn("binary", ogr.OFTBinary))
+
+    f = ogr.Feature(src_lyr.GetLayerDefn())
+    f["bool"] = True
+    f["int16"] = -32768
+    f["int"] = 123456789
+    f["int64"] = 1234567890123
+    f["float32"] = 1.25
+    f["real"] = 1.2345678901234
+    f["numeric"] = -1234.5678
+    f["numeric_int"] = 123456789012
+    f["str"] = "tab\tnew line\nbackslash\\ \u00e9"
+    f["str5"] = "\u00e9l\u00e9phant"
+    f["date"] = "2024/02/29"
+    f["time"] = "12:34:56.789"
+    f["datetime"] = "1999/12/31 23:59:58.5+02"
+    f.SetFieldBinaryFromHexString("binary", "0001FF")
+    f.SetGeometry(ogr.CreateGeometryFromWkt("POLYGON((0 0,0 1,1 1,0 0))"))
+    src_lyr.CreateFeature(f)
+
+    f = ogr.Feature(src_lyr.GetLayerDefn())
+    f["numeric"] = 0
+    src_lyr.CreateFeature(f)
+
+    # Local time zone: cannot be encoded in binary form, so the end of the
+    # layer is written with a text COPY.
+    f = ogr.Feature(src_lyr.GetLayerDefn())
+    f["datetime"] = "2000/01/01 00:00:00"
+    f["str"] = "after fallback"
+    src_lyr.CreateFeature(f)
+
+    for use_copy_binary in ("NO", "YES"):
+        with gdal.config_option("PG_USE_COPY_BINARY", use_copy_binary):
+            pg_ds.CopyLayer(src_lyr, "test_ogr_pg_copy_binary_" + use_copy_binary)
+
+    pg_ds = reconnect(pg_ds)
+    pg_ds.ExecuteSQL('set timezone to "UTC"')
+    lyr_text = pg_ds.GetLayerByName("test_ogr_pg_copy_binary_NO")
+    lyr_binary = pg_ds.GetLayerByName("test_ogr_pg_copy_binary_YES")
+    assert lyr_binary.GetFeatureCount() == 3
+    for f_text, f_binary in zip(lyr_text, lyr_binary):
+        assert f_binary.items() == f_text.items()
+        assert f_binary.GetFID() == f_text.GetFID()
+        g_text = f_text.GetGeometryRef()
+        g_binary = f_binary.GetGeometryRef()
+        assert (g_binary is None) == (g_text is None)
+        if g_text:
+            assert g_binary.ExportToIsoWkt() == g_text.ExportToIsoWkt()
+
+    lyr_binary.ResetReading()
+    f = lyr_binary.GetNextFeature()
+    assert f["str5"] == "\u00e9l\u00e9ph"
+    assert f["datetime"] == "1999/12/31 21:59:58.500+00"
+
+
 ###############################################################################
 # Test gdal.VectorTranslate with GEOM_TYPE=geography and a named geometry column
 
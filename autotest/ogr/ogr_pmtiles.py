@@ -629,3 +629,33 @@ def test_ogr_pmtiles_read_with_many_directories():
     )
     lyr = ds.GetLayer(0)
     assert lyr.GetFeatureCount() != 0
+
+
+###############################################################################
+# Test that the process-wide directory cache does not serve directories of
+# a file that has been rewritten, and that re-reading gives the same result
+
+
+def test_ogr_pmtiles_read_directory_cache(tmp_vsimem):
+
+    def read_all(filename):
+        ds = gdal.OpenEx(filename, open_options=["ZOOM_LEVEL=0"])
+        lyr = ds.GetLayer(0)
+        ret = [f.GetGeometryRef().ExportToWkt() for f in lyr]
+        lyr.ResetReading()
+        assert [f.GetGeometryRef().ExportToWkt() for f in lyr] == ret
+        return ret
+
+    expected_poly = read_all("data/pmtiles/poly.pmtiles")
+    expected_subset = read_all("data/pmtiles/subset7_truncated.pmtiles")
+    assert expected_subset
+
+    filename = str(tmp_vsimem / "test.pmtiles")
+    gdal.FileFromMemBuffer(filename, open("data/pmtiles/poly.pmtiles", "rb").read())
+    assert read_all(filename) == expected_poly
+    assert read_all(filename) == expected_poly
+
+    gdal.FileFromMemBuffer(
+        filename, open("data/pmtiles/subset7_truncated.pmtiles", "rb").read()
+    )
+    assert read_all(filename) == expected_subset
@@ -5883,7 +5883,7 @@ def test_ogr_shape_arrow_stream():
         lyr.GetMetadataItem(
             "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
         )
-        == "NO"
+        == "YES"
     )
     assert len(batches) == 1
     assert len(batches[0]) == 5
@@ -5980,7 +5980,7 @@ def test_ogr_shape_arrow_stream_fid_optim(tmp_vsimem):
     )
     assert len(batches) == 0
 
-    # Regular code path
+    # Optimized code path
     lyr.SetIgnoredFields(ignored_fields[0:-1])
     stream = lyr.GetArrowStreamAsNumPy(options=["USE_MASKED_ARRAYS=NO"])
     batches = [batch for batch in stream]
@@ -5989,14 +5989,14 @@ def test_ogr_shape_arrow_stream_fid_optim(tmp_vsimem):
         lyr.GetMetadataItem(
             "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
         )
-        == "NO"
+        == "YES"
     )
     assert len(batches) == 1
     assert len(batches[0]) == 2
     assert len(batches[0]["OGC_FID"]) == 10
     assert list(batches[0]["OGC_FID"]) == [0, 1, 2, 3, 4, 5, 6, 7, 8, 9]
 
-    # Regular code path
+    # Optimized code path
     lyr.SetIgnoredFields(ignored_fields[1:])
     stream = lyr.GetArrowStreamAsNumPy(options=["USE_MASKED_ARRAYS=NO"])
     batches = [batch for batch in stream]
@@ -6005,7 +6005,7 @@ def test_ogr_shape_arrow_stream_fid_optim(tmp_vsimem):
         lyr.GetMetadataItem(
             "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
         )
-        == "NO"
+        == "YES"
     )
     assert len(batches) == 1
     assert len(batches[0]) == 2
@@ -6077,6 +6077,95 @@ def test_ogr_shape_arrow_stream_fid_optim(tmp_vsimem):
     assert len(batches) == 0
 
 
+###############################################################################
+# Test that the optimized GetArrowStream() implementation returns the same
+# content as the generic one
+
+
+def _get_arrow_batches_optimized_and_generic(filename):
+    def get_batches():
+        ds = ogr.Open(filename)
+        lyr = ds.GetLayer(0)
+        stream = lyr.GetArrowStreamAsNumPy(
+            options=["USE_MASKED_ARRAYS=NO", "MAX_FEATURES_IN_BATCH=3"]
+        )
+        batches = [{k: [x for x in v] for k, v in batch.items()} for batch in stream]
+        optimized = lyr.GetMetadataItem(
+            "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
+        )
+        return batches, optimized
+
+    batches, optimized = get_batches()
+    assert optimized == "YES"
+
+    with gdal.config_option("OGR_SHAPE_STREAM_BASE_IMPL", "YES"):
+        ref_batches, optimized = get_batches()
+    assert optimized == "NO"
+
+    return batches, ref_batches
+
+
+@pytest.mark.parametrize(
+    "filename", ["data/poly.shp", "data/shp/testpoly.shp", "data/shp/Stacks.shp"]
+)
+def test_ogr_shape_arrow_stream_optimized_vs_generic(filename):
+    pytest.importorskip("osgeo.gdal_array")
+    pytest.importorskip("numpy")
+
+    batches, ref_batches = _get_arrow_batches_optimized_and_generic(filename)
+    assert batches
+    assert batches == ref_batches
+
+
+def test_ogr_shape_arrow_stream_field_types(tmp_vsimem):
+    pytest.importorskip("osgeo.gdal_array")
+    pytest.importorskip("numpy")
+
+    filename = str(tmp_vsimem / "test_ogr_shape_arrow_stream_field_types.shp")
+    ds = gdal.GetDriverByName("ESRI Shapefile").Create(
+        filename, 0, 0, 0, gdal.GDT_Unknown
+    )
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint, options=["ENCODING=LATIN1"])
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    fld_defn = ogr.FieldDefn("int64", ogr.OFTInteger64)
+    fld_defn.SetWidth(18)
+    lyr.CreateField(fld_defn)
+    lyr.CreateField(ogr.FieldDefn("real", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("date", ogr.OFTDate))
+    fld_defn = ogr.FieldDefn("bool", ogr.OFTInteger)
+    fld_defn.SetSubType(ogr.OFSTBoolean)
+    lyr.CreateField(fld_defn)
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f["str"] = "\u00e9t\u00e9"
+    f["int"] = -123
+    f["int64"] = 1234567890123
+    f["real"] = 1.5
+    f["date"] = "2024/03/31"
+    f["bool"] = True
+    f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (1 2)"))
+    lyr.CreateFeature(f)
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f["bool"] = False
+    lyr.CreateFeature(f)
+    ds.Close()
+
+    batches, ref_batches = _get_arrow_batches_optimized_and_generic(filename)
+    assert batches == ref_batches
+    assert len(batches) == 1
+    batch = batches[0]
+    assert batch["OGC_FID"] == [0, 1]
+    assert batch["str"][0] == "\u00e9t\u00e9".encode("UTF-8")
+    assert batch["int"][0] == -123
+    assert batch["int64"][0] == 1234567890123
+    assert batch["real"][0] == 1.5
+    assert batch["bool"] == [True, False]
+    assert (
+        ogr.CreateGeometryFromWkb(batch["wkb_geometry"][0]).ExportToIsoWkt()
+        == "POINT (1 2)"
+    )
+
+
 ###############################################################################
 # Test DBF Logical field type
 
@@ -6121,3 +6210,240 @@ def test_ogr_shape_logical_field(tmp_vsimem):
     assert f["int_field"] == -1234
     f = lyr.GetNextFeature()
     assert f["bool_field"] is None
+
+
+###############################################################################
+# Test that the native WriteArrowBatch() implementation gives the same result
+# as the generic one
+
+
+@gdaltest.enable_exceptions()
+def test_ogr_shape_write_arrow_native_vs_generic(tmp_vsimem):
+
+    src_ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    src_lyr = src_ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    src_lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    src_lyr.CreateField(ogr.FieldDefn("int64", ogr.OFTInteger64))
+    src_lyr.CreateField(ogr.FieldDefn("real", ogr.OFTReal))
+    src_lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    src_lyr.CreateField(ogr.FieldDefn("date", ogr.OFTDate))
+    for i in range(5):
+        f = ogr.Feature(src_lyr.GetLayerDefn())
+        if i != 1:
+            f["int"] = i
+            f["int64"] = 1234567890123 + i
+            f["real"] = 1.25 * i
+            f["str"] = "foo, \"bar\" %d" % i
+            f["date"] = "2023/10/%02d" % (i + 1)
+        if i != 2:
+            f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d %d)" % (i, -i)))
+        src_lyr.CreateFeature(f)
+
+    def write(filename, base_impl):
+        ds = gdal.GetDriverByName("ESRI Shapefile").Create(
+            filename, 0, 0, 0, gdal.GDT_Unknown
+        )
+        lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+        stream = src_lyr.GetArrowStream(["MAX_FEATURES_IN_BATCH=2"])
+        schema = stream.GetSchema()
+        for i in range(schema.GetChildrenCount()):
+            if schema.GetChild(i).GetName() not in ("wkb_geometry", "OGC_FID"):
+                lyr.CreateFieldFromArrowSchema(schema.GetChild(i))
+        with gdal.config_option("OGR_SHAPE_WRITE_ARROW_BASE_IMPL", base_impl):
+            while True:
+                array = stream.GetNextRecordBatch()
+                if array is None:
+                    break
+                assert lyr.WriteArrowBatch(schema, array, ["FID=OGC_FID"])
+        ds.Close()
+
+    filename_native = str(tmp_vsimem / "native.shp")
+    write(filename_native, "NO")
+    filename_generic = str(tmp_vsimem / "generic.shp")
+    write(filename_generic, "YES")
+
+    ds_native = ogr.Open(filename_native)
+    ds_generic = ogr.Open(filename_generic)
+    lyr_native = ds_native.GetLayer(0)
+    lyr_generic = ds_generic.GetLayer(0)
+    assert lyr_native.GetFeatureCount() == 5
+    for f_native, f_generic in zip(lyr_native, lyr_generic):
+        assert f_native.Equal(f_generic)
+
+
+###############################################################################
+# Test SHAPE_READ_AHEAD_THREADS
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+@gdaltest.enable_exceptions()
+def test_ogr_shape_read_ahead_threads(tmp_vsimem, num_threads):
+
+    filename = str(tmp_vsimem / "test.shp")
+    ds = gdal.GetDriverByName("ESRI Shapefile").Create(
+        filename, 0, 0, 0, gdal.GDT_Unknown
+    )
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    for i in range(3500):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["id"] = i
+        f["str"] = "foo%d" % i
+        if i % 7 != 0:
+            f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d %d)" % (i, -i)))
+        lyr.CreateFeature(f)
+    for i in (0, 999, 1000, 2500):
+        lyr.DeleteFeature(i)
+    ds.Close()
+
+    ds_ref = ogr.Open(filename)
+    lyr_ref = ds_ref.GetLayer(0)
+    ref = [f.Clone() for f in lyr_ref]
+    assert len(ref) == 3496
+
+    with gdal.config_option("SHAPE_READ_AHEAD_THREADS", num_threads):
+        ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+
+    got = [f for f in lyr]
+    assert len(got) == len(ref)
+    for f_got, f_ref in zip(got, ref):
+        assert f_got.GetFID() == f_ref.GetFID()
+        assert f_got.Equal(f_ref)
+
+    # Interleave random reads and stop half-way
+    lyr.ResetReading()
+    for i in range(1500):
+        f = lyr.GetNextFeature()
+        assert f.Equal(ref[i])
+        if i == 100:
+            assert lyr.GetFeature(3000).Equal(lyr_ref.GetFeature(3000))
+
+    # Position changes
+    lyr.SetNextByIndex(2000)
+    assert lyr.GetNextFeature().GetFID() == 2000
+    lyr.SetIgnoredFields(["str"])
+    f = lyr.GetNextFeature()
+    assert f.GetFID() == 2001
+    assert f["str"] is None
+    assert f["id"] == 2001
+    lyr.SetIgnoredFields([])
+
+    lyr.SetAttributeFilter("id >= 3490")
+    assert [f.GetFID() for f in lyr] == list(range(3490, 3500))
+    lyr.SetAttributeFilter(None)
+    lyr.SetSpatialFilterRect(10, -20, 20, -10)
+    assert lyr.GetFeatureCount() == 10
+    lyr.SetSpatialFilter(None)
+
+    lyr.ResetReading()
+    assert lyr.GetNextFeature().GetFID() == 1
+
+
+###############################################################################
+# Test SHAPE_USE_MMAP
+
+
+def test_ogr_shape_use_mmap(tmp_path):
+
+    for ext in ("shp", "shx", "dbf"):
+        shutil.copy("data/shp/poly." + ext, tmp_path / ("poly." + ext))
+    filename = str(tmp_path / "poly.shp")
+
+    ds_ref = ogr.Open(filename)
+    lyr_ref = ds_ref.GetLayer(0)
+    ref = [f.Clone() for f in lyr_ref]
+
+    with gdal.config_option("SHAPE_USE_MMAP", "YES"):
+        ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    assert lyr.GetFeatureCount() == len(ref)
+    for f_got, f_ref in zip(lyr, ref):
+        assert f_got.Equal(f_ref)
+    for fid in (9, 0, 5):
+        assert lyr.GetFeature(fid).Equal(ref[fid])
+    ds = None
+
+    # Truncated .dbf: the records beyond the end must not be read
+    dbf_size = os.stat(tmp_path / "poly.dbf").st_size
+    with open(tmp_path / "poly.dbf", "r+b") as f:
+        f.truncate(dbf_size - 100)
+
+    def read_all(use_mmap):
+        with gdal.config_option("SHAPE_USE_MMAP", use_mmap):
+            ds = ogr.Open(filename)
+        lyr = ds.GetLayer(0)
+        with gdal.quiet_errors():
+            return [f.GetFID() for f in lyr]
+
+    assert read_all("YES") == read_all("NO")
+
+
+###############################################################################
+# Test CREATE SPATIAL INDEX ON ... PACKED
+
+
+@pytest.mark.parametrize("max_memory", [None, "0.01"])
+def test_ogr_shape_packed_spatial_index(tmp_path, max_memory):
+
+    filename = str(tmp_path / "test.shp")
+    ds = gdal.GetDriverByName("ESRI Shapefile").Create(
+        filename, 0, 0, 0, gdal.GDT_Unknown
+    )
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    for i in range(3000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["id"] = i
+        if i != 10:
+            f.SetGeometry(
+                ogr.CreateGeometryFromWkt("POINT (%d %d)" % (i % 100, i // 100))
+            )
+        lyr.CreateFeature(f)
+    ds.Close()
+
+    ds = ogr.Open(filename, update=1)
+    with gdal.config_option("OGR_SPATIAL_INDEX_BUILD_MAX_MEMORY", max_memory):
+        ds.ExecuteSQL("CREATE SPATIAL INDEX ON test PACKED")
+    assert os.path.exists(filename + ".ogrsidx")
+    assert not os.path.exists(str(tmp_path / "test.qix"))
+    ds.Close()
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    for minx, miny, maxx, maxy in [
+        (10.5, 3.5, 12.5, 5.5),
+        (-1, -1, 0.5, 0.5),
+        (95, 25, 200, 200),
+        (1000, 1000, 2000, 2000),
+    ]:
+        lyr.SetSpatialFilterRect(minx, miny, maxx, maxy)
+        got = [f["id"] for f in lyr]
+        expected = [
+            i
+            for i in range(3000)
+            if i != 10
+            and minx <= i % 100 <= maxx
+            and miny <= i // 100 <= maxy
+        ]
+        assert got == expected
+    lyr.SetSpatialFilter(None)
+    ds.Close()
+
+    # Adding features removes the index
+    ds = ogr.Open(filename, update=1)
+    lyr = ds.GetLayer(0)
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (11 4)"))
+    lyr.CreateFeature(f)
+    assert not os.path.exists(filename + ".ogrsidx")
+    lyr.SetSpatialFilterRect(10.5, 3.5, 11.5, 4.5)
+    assert [f.GetFID() for f in lyr] == [411, 3000]
+    lyr.SetSpatialFilter(None)
+
+    ds.ExecuteSQL("CREATE SPATIAL INDEX ON test PACKED")
+    assert os.path.exists(filename + ".ogrsidx")
+    ds.ExecuteSQL("DROP SPATIAL INDEX ON test")
+    assert not os.path.exists(filename + ".ogrsidx")
+    ds.Close()
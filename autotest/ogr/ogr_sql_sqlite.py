@@ -2510,3 +2510,64 @@ def test_ogr_sql_sqlite_execute_sql_error_on_spatial_filter_shp_layer(tmp_vsimem
         Exception, match="Cannot set spatial filter: no geometry field selected"
     ):
         ds.ExecuteSQL("SELECT 1 FROM test", spatialFilter=geom, dialect="SQLITE")
+
+
+###############################################################################
+# Test pushing spatial predicates, column projection and OFFSET to the
+# underlying layers
+
+
+@gdaltest.enable_exceptions()
+def test_ogr_sql_sqlite_push_down_to_virtual_table():
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("test")
+    lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("name", ogr.OFTString))
+    for i in range(10):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["id"] = i
+        f["name"] = "name%d" % i
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d %d)" % (i, i)))
+        lyr.CreateFeature(f)
+
+    with ds.ExecuteSQL(
+        "SELECT id FROM test WHERE ST_Intersects(GEOMETRY, "
+        "ST_GeomFromText('POLYGON((1.5 1.5,1.5 4.5,4.5 4.5,4.5 1.5,1.5 1.5))'))",
+        dialect="SQLite",
+    ) as sql_lyr:
+        assert [f["id"] for f in sql_lyr] == [2, 3, 4]
+
+    with ds.ExecuteSQL(
+        "SELECT id FROM test WHERE ST_Intersects(GEOMETRY, NULL) "
+        "OR id = 0",
+        dialect="SQLite",
+    ) as sql_lyr:
+        assert [f["id"] for f in sql_lyr] == [0]
+
+    with ds.ExecuteSQL(
+        "SELECT name FROM test WHERE id >= 8", dialect="SQLite"
+    ) as sql_lyr:
+        assert [f["name"] for f in sql_lyr] == ["name8", "name9"]
+
+    with ds.ExecuteSQL(
+        "SELECT id FROM test LIMIT 2 OFFSET 3", dialect="SQLite"
+    ) as sql_lyr:
+        assert [f["id"] for f in sql_lyr] == [3, 4]
+
+    with ds.ExecuteSQL(
+        "SELECT id FROM test LIMIT 2 OFFSET 100", dialect="SQLite"
+    ) as sql_lyr:
+        assert [f["id"] for f in sql_lyr] == []
+
+    with ds.ExecuteSQL(
+        "SELECT id FROM test WHERE id > 2 LIMIT 2 OFFSET 3", dialect="SQLite"
+    ) as sql_lyr:
+        assert [f["id"] for f in sql_lyr] == [6, 7]
+
+    # Check that the state of the source layer has been restored
+    assert lyr.GetFeatureCount() == 10
+    lyr.ResetReading()
+    f = lyr.GetNextFeature()
+    assert f["name"] == "name0"
+    assert f.GetGeometryRef() is not None
@@ -1999,3 +1999,313 @@ def test_ogr_sql_on_null(where, feature_count, dialect, ds_for_test_ogr_sql_on_n
             "select * from layer where " + where, dialect=dialect
         ) as sql_lyr:
             assert sql_lyr.GetFeatureCount() == feature_count
+
+
+###############################################################################
+# Check that the compiled evaluation of attribute filters gives the same
+# results as the expression tree interpreter
+
+
+@pytest.mark.parametrize(
+    "where",
+    [
+        "intfield = 1",
+        "intfield <> 1",
+        "intfield < 2 AND int64field >= 1234567890123",
+        "intfield > 1 OR realfield <= 1.5",
+        "NOT (intfield >= 2)",
+        "intfield = 1.0",
+        "realfield > intfield",
+        "intfield BETWEEN 1 AND 2",
+        "realfield BETWEEN 1.0 AND 2.5",
+        "strfield BETWEEN 'a' AND 'B'",
+        "intfield IN (1, 3)",
+        "intfield IN (1, NULL)",
+        "intfield NOT IN (1, NULL)",
+        "realfield IN (1.5, 2.5)",
+        "strfield IN ('A', 'c')",
+        "strfield = 'a'",
+        "strfield <> 'a'",
+        "strfield > 'a'",
+        "strfield = '2024/01/01 00:00:00+00'",
+        "strfield LIKE '%b%'",
+        "strfield ILIKE 'B%'",
+        "strfield LIKE 'a\\_%' ESCAPE '\\'",
+        "intfield IS NULL",
+        "strfield IS NOT NULL",
+        "datetimefield IS NULL",
+        "intfield + 1 = 3",
+        "intfield * int64field > 0",
+        "intfield / 0 > 0",
+        "intfield % 2 = 1",
+        "realfield - intfield < 1",
+        "realfield / 0 > 0",
+        "realfield % 1 = 0.5",
+        "intfield",
+        "realfield",
+        "FID = 1",
+        "OGR_GEOM_AREA > 0",
+        "int64field * 9223372036854775807 > 0",
+    ],
+)
+def test_ogr_sql_compiled_attribute_filter(where):
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("test")
+    lyr.CreateField(ogr.FieldDefn("intfield", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("int64field", ogr.OFTInteger64))
+    lyr.CreateField(ogr.FieldDefn("realfield", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("strfield", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("datetimefield", ogr.OFTDateTime))
+    values = [
+        (1, 1234567890123, 1.5, "a_b", "2024/01/01 00:00:00"),
+        (2, -1, 2.5, "B", None),
+        (3, None, None, "2024/01/01 00:00:00", None),
+        (None, 0, 0.0, None, "2024/01/01 00:00:00"),
+        (0, 1, 1.0, "c", None),
+    ]
+    for intval, int64val, realval, strval, dtval in values:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        for i, val in enumerate((intval, int64val, realval, strval, dtval)):
+            if val is None:
+                f.SetFieldNull(i)
+            else:
+                f.SetField(i, val)
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POLYGON((0 0,0 1,1 1,0 0))"))
+        lyr.CreateFeature(f)
+
+    def get_fids():
+        lyr.SetAttributeFilter(where)
+        with gdal.quiet_errors():
+            return [f.GetFID() for f in lyr]
+
+    with gdaltest.config_option("OGR_SQL_COMPILED_EXPRESSIONS", "NO"):
+        expected = get_fids()
+    assert get_fids() == expected
+
+
+###############################################################################
+# Test GROUP BY
+
+
+@pytest.fixture()
+def group_by_ds():
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("test")
+    lyr.CreateField(ogr.FieldDefn("cls", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("sub", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("val", ogr.OFTReal))
+    for cls, sub, val in [
+        ("b", 1, 1.0),
+        ("a", 2, 2.0),
+        ("b", 1, 3.0),
+        (None, 1, 4.0),
+        ("a", 1, None),
+        ("b", 2, 6.0),
+    ]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if cls is None:
+            f["cls"] = None
+        else:
+            f["cls"] = cls
+        f["sub"] = sub
+        if val is not None:
+            f["val"] = val
+        lyr.CreateFeature(f)
+    return ds
+
+
+def test_ogr_sql_group_by(group_by_ds):
+
+    with group_by_ds.ExecuteSQL(
+        "SELECT cls, COUNT(*), COUNT(val), SUM(val), AVG(val), MIN(val), "
+        "MAX(val) FROM test GROUP BY cls ORDER BY cls"
+    ) as sql_lyr:
+        assert sql_lyr.GetFeatureCount() == 3
+        assert sql_lyr.GetLayerDefn().GetFieldDefn(1).GetType() == ogr.OFTInteger
+        res = [
+            (
+                f["cls"],
+                f["COUNT_*"],
+                f["COUNT_val"],
+                f["SUM_val"],
+                f["AVG_val"],
+                f["MIN_val"],
+                f["MAX_val"],
+            )
+            for f in sql_lyr
+        ]
+    assert res == [
+        (None, 1, 1, 4.0, 4.0, 4.0, 4.0),
+        ("a", 2, 1, 2.0, 2.0, 2.0, 2.0),
+        ("b", 3, 3, 10.0, 10.0 / 3, 1.0, 6.0),
+    ]
+
+
+def test_ogr_sql_group_by_several_fields(group_by_ds):
+
+    with group_by_ds.ExecuteSQL(
+        "SELECT cls, sub, COUNT(*) FROM test WHERE cls IS NOT NULL "
+        "GROUP BY cls, sub ORDER BY cls DESC, sub"
+    ) as sql_lyr:
+        res = [(f["cls"], f["sub"], f["COUNT_*"]) for f in sql_lyr]
+        assert sql_lyr.GetFeature(0)["cls"] == "b"
+        assert sql_lyr.GetFeature(4) is None
+    assert res == [("b", 1, 2), ("b", 2, 1), ("a", 1, 1), ("a", 2, 1)]
+
+    # Without ORDER BY, groups are returned in order of first appearance
+    with group_by_ds.ExecuteSQL(
+        "SELECT sub, MAX(val) FROM test GROUP BY sub LIMIT 1"
+    ) as sql_lyr:
+        assert sql_lyr.GetFeatureCount() == 1
+        res = [(f["sub"], f["MAX_val"]) for f in sql_lyr]
+    assert res == [(1, 4.0)]
+
+
+@pytest.mark.parametrize(
+    "sql",
+    [
+        "SELECT cls, val FROM test GROUP BY cls",
+        "SELECT cls, COUNT(*) FROM test GROUP BY non_existing",
+        "SELECT cls, COUNT(*) FROM test GROUP BY cls ORDER BY val",
+        "SELECT DISTINCT cls FROM test GROUP BY cls",
+    ],
+)
+def test_ogr_sql_group_by_errors(group_by_ds, sql):
+
+    with pytest.raises(Exception):
+        group_by_ds.ExecuteSQL(sql)
+
+
+###############################################################################
+# Test that GROUP is only a keyword when followed by BY, so that an unquoted
+# "group" field can still be used
+
+
+def test_ogr_sql_group_field_name():
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("test")
+    lyr.CreateField(ogr.FieldDefn("group", ogr.OFTInteger))
+    for val in (1, 2, 1):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["group"] = val
+        lyr.CreateFeature(f)
+
+    with ds.ExecuteSQL("SELECT group FROM test") as sql_lyr:
+        assert [f["group"] for f in sql_lyr] == [1, 2, 1]
+
+    with ds.ExecuteSQL("SELECT * FROM test WHERE group = 1") as sql_lyr:
+        assert sql_lyr.GetFeatureCount() == 2
+
+    with ds.ExecuteSQL(
+        "SELECT group, COUNT(*) FROM test WHERE group > 0 GROUP\nBY group "
+        "ORDER BY group"
+    ) as sql_lyr:
+        assert [(f["group"], f["COUNT_*"]) for f in sql_lyr] == [(1, 2), (2, 1)]
+
+    lyr.SetAttributeFilter("group = 2")
+    assert lyr.GetFeatureCount() == 1
+
+
+###############################################################################
+# Test that hash joins return the same result as the attribute filter path
+
+
+@pytest.mark.parametrize("max_memory", [None, "0"])
+def test_ogr_sql_hash_join(max_memory):
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("primary")
+    lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("code", ogr.OFTString))
+    for id, code in [(1, "a"), (2, "B"), (3, "c"), (None, "a"), (1, None)]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if id is not None:
+            f["id"] = id
+        if code is not None:
+            f["code"] = code
+        lyr.CreateFeature(f)
+
+    lyr = ds.CreateLayer("secondary")
+    lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger64))
+    lyr.CreateField(ogr.FieldDefn("code", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("val", ogr.OFTString))
+    for id, code, val in [
+        (1, "A", "first"),
+        (2, "b", "second"),
+        (1, "a", "duplicate"),
+        (4, "c", "other"),
+    ]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["id"] = id
+        f["code"] = code
+        f["val"] = val
+        lyr.CreateFeature(f)
+
+    def get_result(sql):
+        with ds.ExecuteSQL(sql) as sql_lyr:
+            return [f.items() for f in sql_lyr]
+
+    for sql in [
+        "SELECT * FROM primary p LEFT JOIN secondary s ON p.id = s.id",
+        "SELECT * FROM primary p LEFT JOIN secondary s ON p.code = s.code",
+        "SELECT * FROM primary p LEFT JOIN secondary s "
+        "ON p.id = s.id AND p.code = s.code",
+    ]:
+        with gdaltest.config_option("OGR_SQL_HASH_JOIN", "NO"):
+            expected = get_result(sql)
+        with gdaltest.config_option("OGR_SQL_HASH_JOIN_MAX_MEMORY", max_memory):
+            assert get_result(sql) == expected
+
+
+###############################################################################
+# Test ORDER BY through the external merge sort and the top-K heap
+
+
+@pytest.mark.parametrize("max_memory", [None, "0.0001"])
+@pytest.mark.parametrize(
+    "sql_suffix",
+    [
+        "ORDER BY strfield",
+        "ORDER BY strfield DESC, intfield",
+        "ORDER BY intfield LIMIT 3",
+        "ORDER BY intfield DESC LIMIT 2 OFFSET 3",
+        "ORDER BY strfield OFFSET 7",
+    ],
+)
+def test_ogr_sql_order_by_external_sort(max_memory, sql_suffix):
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("test")
+    lyr.CreateField(ogr.FieldDefn("intfield", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("strfield", ogr.OFTString))
+    for i in range(10):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["intfield"] = (i * 7) % 5
+        if i != 4:
+            f["strfield"] = "val%d" % ((i * 3) % 4)
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d 0)" % i))
+        lyr.CreateFeature(f)
+
+    def get_result():
+        with ds.ExecuteSQL("SELECT * FROM test " + sql_suffix) as sql_lyr:
+            res = [
+                (f.GetFID(), f["intfield"], f["strfield"], f.GetGeometryRef().GetX())
+                for f in sql_lyr
+            ]
+            # Iterate a second time
+            assert [f.GetFID() for f in sql_lyr] == [x[0] for x in res]
+            if len(res) > 1:
+                assert sql_lyr.SetNextByIndex(1) == ogr.OGRERR_NONE
+                assert sql_lyr.GetNextFeature().GetFID() == res[1][0]
+            return res
+
+    # Reference result computed from the in-memory index of FIDs, or the
+    # top-K heap with LIMIT. A tiny memory limit forces the external sort,
+    # with one run per feature.
+    with gdaltest.config_option("OGR_SQL_ORDER_BY_MAX_MEMORY", "1000"):
+        expected = get_result()
+    with gdaltest.config_option("OGR_SQL_ORDER_BY_MAX_MEMORY", max_memory):
+        assert get_result() == expected
@@ -3355,3 +3355,192 @@ def test_ogr_vrt_geom_coordinate_precision():
     assert prec.GetXYResolution() == 1e-5
     assert prec.GetZResolution() == 1e-3
     assert prec.GetMResolution() == 1e-2
+
+
+###############################################################################
+# Test OGRVRTUnionLayer source layer extents and parallel reading
+
+
+@pytest.mark.parametrize("max_opened", [None, "2"])
+@pytest.mark.parametrize(
+    "num_threads,preserve_order", [(1, "ON"), (4, "ON"), (4, "OFF")]
+)
+def test_ogr_vrt_union_extent_and_parallel_reading(
+    tmp_path, max_opened, num_threads, preserve_order
+):
+
+    sources = ""
+    for tile in range(4):
+        filename = str(tmp_path / f"tile_{tile}.shp")
+        with ogr.GetDriverByName("ESRI Shapefile").CreateDataSource(filename) as ds:
+            lyr = ds.CreateLayer(f"tile_{tile}", geom_type=ogr.wkbPoint)
+            lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+            for i in range(1000):
+                f = ogr.Feature(lyr.GetLayerDefn())
+                f["id"] = tile * 1000 + i
+                f.SetGeometry(
+                    ogr.CreateGeometryFromWkt(
+                        f"POINT({tile * 10 + (i % 10)} {i // 100})"
+                    )
+                )
+                lyr.CreateFeature(f)
+        sources += f"""
+        <OGRVRTLayer name="tile_{tile}">
+            <SrcDataSource>{filename}</SrcDataSource>
+            <ExtentXMin>{tile * 10}</ExtentXMin>
+            <ExtentYMin>0</ExtentYMin>
+            <ExtentXMax>{tile * 10 + 9}</ExtentXMax>
+            <ExtentYMax>9</ExtentYMax>
+        </OGRVRTLayer>"""
+
+    # Never opened, as its extent does not intersect the spatial filter
+    sources += """
+        <OGRVRTLayer name="i_do_not_exist">
+            <SrcDataSource>/i_do/not/exist.shp</SrcDataSource>
+            <ExtentXMin>1000</ExtentXMin>
+            <ExtentYMin>1000</ExtentYMin>
+            <ExtentXMax>1001</ExtentXMax>
+            <ExtentYMax>1001</ExtentYMax>
+        </OGRVRTLayer>"""
+
+    vrt = f"""<OGRVRTDataSource>
+    <OGRVRTUnionLayer name="union_layer">{sources}
+        <FieldStrategy>FirstLayer</FieldStrategy>
+        <NumThreads>{num_threads}</NumThreads>
+        <PreserveOrder>{preserve_order}</PreserveOrder>
+    </OGRVRTUnionLayer>
+</OGRVRTDataSource>"""
+
+    with gdaltest.config_option("OGR_VRT_MAX_OPENED", max_opened):
+        ds = ogr.Open(vrt)
+        lyr = ds.GetLayer(0)
+
+        assert lyr.GetExtent() == (0, 1001, 0, 1001)
+
+        lyr.SetSpatialFilterRect(5, 0, 25, 9)
+        ids = [f["id"] for f in lyr]
+        expected_ids = [
+            tile * 1000 + i for tile in range(3) for i in range(1000) if
+            5 <= tile * 10 + (i % 10) <= 25
+        ]
+        if preserve_order == "ON":
+            assert ids == expected_ids
+        else:
+            assert sorted(ids) == expected_ids
+        assert lyr.GetFeatureCount() == len(expected_ids)
+
+        # Source layers accessed while reading
+        lyr.ResetReading()
+        f = lyr.GetNextFeature()
+        assert f is not None
+        assert lyr.GetExtent() == (0, 1001, 0, 1001)
+        assert len([f for f in lyr]) == len(expected_ids) - 1
+
+
+###############################################################################
+# Test batched reprojection of OGRVRTWarpedLayer, through GetNextFeature()
+# and GetArrowStream()
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_ogr_vrt_warped_layer_batch_reprojection(tmp_path, num_threads):
+
+    pytest.importorskip("numpy")
+
+    srs = osr.SpatialReference()
+    srs.ImportFromEPSG(4326)
+    srs.SetAxisMappingStrategy(osr.OAMS_TRADITIONAL_GIS_ORDER)
+    ds = ogr.GetDriverByName("ESRI Shapefile").CreateDataSource(
+        tmp_path / "src.shp"
+    )
+    lyr = ds.CreateLayer("src", srs=srs, geom_type=ogr.wkbLineString)
+    lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    for i in range(2000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["id"] = i
+        if i == 10:
+            # Cannot be reprojected
+            f.SetGeometry(ogr.CreateGeometryFromWkt("LINESTRING (2 49,2 91)"))
+        elif i != 20:
+            x = 1 + (i % 100) / 50.0
+            y = 45 + (i // 100) / 5.0
+            f.SetGeometry(
+                ogr.CreateGeometryFromWkt(
+                    "LINESTRING (%f %f,%f %f,%f %f)"
+                    % (x, y, x + 0.01, y + 0.01, x + 0.02, y)
+                )
+            )
+        lyr.CreateFeature(f)
+    ds = None
+
+    dst_srs = osr.SpatialReference()
+    dst_srs.ImportFromEPSG(32631)
+    dst_srs.SetAxisMappingStrategy(osr.OAMS_TRADITIONAL_GIS_ORDER)
+    ct = osr.CoordinateTransformation(srs, dst_srs)
+
+    expected = {}
+    with ogr.Open(tmp_path / "src.shp") as ds:
+        for f in ds.GetLayer(0):
+            g = f.GetGeometryRef()
+            if g is not None:
+                with gdal.quiet_errors():
+                    if g.Transform(ct) != 0:
+                        g = None
+            expected[f["id"]] = g.Clone() if g else None
+
+    def check_geom(id, g):
+        if expected[id] is None:
+            assert g is None, id
+        else:
+            ogrtest.check_feature_geometry(g, expected[id], max_error=1e-6)
+
+    vrt = f"""<OGRVRTDataSource>
+    <OGRVRTWarpedLayer>
+        <OGRVRTLayer name="src">
+            <SrcDataSource>{tmp_path / "src.shp"}</SrcDataSource>
+        </OGRVRTLayer>
+        <TargetSRS>EPSG:32631</TargetSRS>
+    </OGRVRTWarpedLayer>
+</OGRVRTDataSource>"""
+
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads), ogr.Open(
+        vrt
+    ) as ds:
+        lyr = ds.GetLayer(0)
+
+        with gdal.quiet_errors():
+            got_ids = []
+            for f in lyr:
+                check_geom(f["id"], f.GetGeometryRef())
+                got_ids.append(f["id"])
+        assert got_ids == list(range(2000))
+
+        # Reading interrupted by ResetReading()
+        lyr.ResetReading()
+        for i in range(20):
+            assert lyr.GetNextFeature()["id"] == i
+        lyr.ResetReading()
+        assert lyr.GetNextFeature()["id"] == 0
+
+        lyr.ResetReading()
+        with gdal.quiet_errors():
+            stream = lyr.GetArrowStreamAsNumPy(options=["USE_MASKED_ARRAYS=NO"])
+            batches = [batch for batch in stream]
+        got_ids = []
+        for batch in batches:
+            for id, wkb in zip(batch["id"], batch["wkb_geometry"]):
+                g = ogr.CreateGeometryFromWkb(bytes(wkb)) if wkb is not None else None
+                check_geom(id, g)
+                got_ids.append(id)
+        assert got_ids == list(range(2000))
+
+        # Spatial filter in the target SRS
+        minx, maxx, miny, maxy = expected[550].GetEnvelope()
+        lyr.SetSpatialFilterRect(minx, miny, maxx, maxy)
+        with gdal.quiet_errors():
+            expected_ids = [f["id"] for f in lyr]
+            stream = lyr.GetArrowStreamAsNumPy(options=["USE_MASKED_ARRAYS=NO"])
+            got_ids = [id for batch in stream for id in batch["id"]]
+        assert 550 in expected_ids
+        assert len(expected_ids) < 100
+        assert got_ids == expected_ids
@@ -392,6 +392,29 @@ def test_osr_epsg_13():
     assert matches[0][0].IsSame(sr) != 1
 
 
+###############################################################################
+# Test that repeated FindMatches() calls, served from the identification
+# cache, return independent objects
+
+
+def test_osr_epsg_find_matches_cached():
+
+    sr = osr.SpatialReference()
+    sr.ImportFromEPSG(32631)
+    sr.SetFromUserInput(sr.ExportToWkt(["FORMAT=WKT1_ESRI"]))
+
+    matches = sr.FindMatches()
+    assert len(matches) == 1 and matches[0][1] == 100
+    assert matches[0][0].GetAuthorityCode(None) == "32631"
+    matches[0][0].SetUTM(32)
+
+    for i in range(2):
+        matches_again = sr.FindMatches()
+        assert len(matches_again) == 1 and matches_again[0][1] == 100
+        assert matches_again[0][0].GetAuthorityCode(None) == "32631"
+        assert matches_again[0][0].GetUTMZone() == 31
+
+
 ###############################################################################
 
 
@@ -756,3 +756,48 @@ def test_gdal_footprint_lib_writeAbsolutePath():
     lyr = out_ds.GetLayer(0)
     f = lyr.GetNextFeature()
     assert os.path.isabs(f["location"])
+
+
+###############################################################################
+# Test that the footprint of a raster spanning several strips, with holes,
+# touching corners and several blobs, does not depend on the number of threads
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_gdal_footprint_lib_num_threads(tmp_path, num_threads):
+
+    src_filename = str(tmp_path / "test.tif")
+    src_ds = gdal.GetDriverByName("GTiff").Create(
+        src_filename,
+        100,
+        1000,
+        options=["TILED=YES", "BLOCKXSIZE=64", "BLOCKYSIZE=64"],
+    )
+    src_ds.GetRasterBand(1).SetNoDataValue(0)
+    # Big blob crossing strip boundaries, with a hole across a boundary
+    src_ds.GetRasterBand(1).Fill(0)
+    src_ds.GetRasterBand(1).WriteRaster(10, 10, 50, 900, b"\x01" * (50 * 900))
+    src_ds.GetRasterBand(1).WriteRaster(20, 250, 10, 20, b"\x00" * (10 * 20))
+    # Two pixels touching by a corner on a strip boundary
+    src_ds.GetRasterBand(1).WriteRaster(80, 255, 1, 1, b"\x01")
+    src_ds.GetRasterBand(1).WriteRaster(81, 256, 1, 1, b"\x01")
+    src_ds = None
+
+    out_ds = gdal.Footprint(
+        "",
+        src_filename,
+        format="Memory",
+        targetCoordinateSystem="pixel",
+        maxPoints="unlimited",
+        options=["-num_threads", num_threads],
+    )
+    assert out_ds is not None
+    lyr = out_ds.GetLayer(0)
+    f = lyr.GetNextFeature()
+    ogrtest.check_feature_geometry(
+        f,
+        "MULTIPOLYGON (((10 10,10 910,60 910,60 10,10 10),"
+        "(20 250,30 250,30 270,20 270,20 250)),"
+        "((80 255,80 256,81 256,81 255,80 255)),"
+        "((81 256,81 257,82 257,82 256,81 256)))",
+    )
@@ -1101,3 +1101,57 @@ def test_gdal_grid_lib_errors():
             algorithm="invdist",
             SQLStatement="invalid",
         )
+
+
+###############################################################################
+# Test algorithms using a search radius on enough points for a quadtree to be
+# used, with search windows of neighbouring pixels overlapping so that
+# candidate points are collected per output row.
+
+
+@pytest.mark.parametrize("alg", ["average", "count", "maximum"])
+def test_gdal_grid_lib_search_radius_many_points(alg):
+
+    points = []
+    seed = 1
+    for i in range(500):
+        seed = (seed * 1103515245 + 12345) % 2147483648
+        x = (seed % 10000) / 1000.0
+        seed = (seed * 1103515245 + 12345) % 2147483648
+        y = (seed % 10000) / 1000.0
+        points.append((x, y, i % 17))
+    wkt = "MULTIPOINT(" + ",".join("%g %g %g" % pt for pt in points) + ")"
+
+    width = 40
+    height = 30
+    radius = 1.5
+    ds = gdal.Grid(
+        "",
+        ogr.CreateGeometryFromWkt(wkt).ExportToJson(),
+        width=width,
+        height=height,
+        outputBounds=[0, 0, 10, 10],
+        outputType=gdal.GDT_Float64,
+        format="MEM",
+        algorithm=f"{alg}:radius1={radius}:radius2={radius}:nodata=-1",
+    )
+    got = struct.unpack("d" * (width * height), ds.ReadRaster())
+
+    for j in range(height):
+        y0 = (j + 0.5) * 10 / height
+        for i in range(width):
+            x0 = (i + 0.5) * 10 / width
+            values = [
+                z
+                for x, y, z in points
+                if (x - x0) ** 2 + (y - y0) ** 2 <= radius * radius
+            ]
+            if alg == "count":
+                expected = len(values)
+            elif not values:
+                expected = -1
+            elif alg == "average":
+                expected = sum(values) / len(values)
+            else:
+                expected = max(values)
+            assert got[j * width + i] == pytest.approx(expected, abs=1e-10)
@@ -424,3 +424,82 @@ def test_gdal_viewshed_south_up(gdal_viewshed_path, tmp_path, viewshed_input):
         struct.unpack("B" * (width * height), ds.GetRasterBand(1).ReadRaster())
         == expected_data
     )
+
+
+###############################################################################
+# Test cumulative viewshed from several observers
+
+
+@pytest.mark.parametrize("num_threads", ["1", "2"])
+def test_gdal_viewshed_observers(
+    gdal_viewshed_path, tmp_path, viewshed_input, num_threads
+):
+
+    observers = [(ox[0], oy[0]), (ox[0] + 1500, oy[0] - 1000), (ox[0], oy[0])]
+
+    observers_filename = str(tmp_path / "observers.csv")
+    with open(observers_filename, "wt") as f:
+        f.write("WKT\n")
+        for x, y in observers:
+            f.write('"POINT (%f %f)"\n' % (x, y))
+
+    # Sum of the viewsheds of each observer
+    expected = {}
+    for i, (x, y) in enumerate(observers):
+        single_out = str(tmp_path / ("single_%d.tif" % i))
+        _, err = gdaltest.runexternal_out_and_err(
+            gdal_viewshed_path
+            + " -md 5000 -vv 1 -oz {} -ox {} -oy {} {} {}".format(
+                oz[1], x, y, viewshed_input, single_out
+            )
+        )
+        assert err is None or err == ""
+        ds = gdal.Open(single_out)
+        gt = ds.GetGeoTransform()
+        data = struct.unpack(
+            "B" * (ds.RasterXSize * ds.RasterYSize), ds.GetRasterBand(1).ReadRaster()
+        )
+        for j in range(ds.RasterYSize):
+            for k in range(ds.RasterXSize):
+                key = (round(gt[0] + k * gt[1], 3), round(gt[3] + j * gt[5], 3))
+                expected[key] = expected.get(key, 0) + data[j * ds.RasterXSize + k]
+        ds = None
+
+    viewshed_out = str(tmp_path / "test_gdal_viewshed_cumulative.tif")
+    _, err = gdaltest.runexternal_out_and_err(
+        gdal_viewshed_path
+        + " --config GDAL_NUM_THREADS {} -md 5000 -oz {} -observers {} {} {}".format(
+            num_threads, oz[1], observers_filename, viewshed_input, viewshed_out
+        )
+    )
+    assert err is None or err == ""
+    ds = gdal.Open(viewshed_out)
+    assert ds.GetRasterBand(1).DataType == gdal.GDT_UInt32
+    gt = ds.GetGeoTransform()
+    got = struct.unpack(
+        "I" * (ds.RasterXSize * ds.RasterYSize), ds.GetRasterBand(1).ReadRaster()
+    )
+    assert max(got) > 1
+    for j in range(ds.RasterYSize):
+        for k in range(ds.RasterXSize):
+            key = (round(gt[0] + k * gt[1], 3), round(gt[3] + j * gt[5], 3))
+            assert got[j * ds.RasterXSize + k] == expected.get(key, 0), (k, j)
+
+
+###############################################################################
+
+
+def test_gdal_viewshed_observers_and_om(gdal_viewshed_path, tmp_path, viewshed_input):
+
+    observers_filename = str(tmp_path / "observers.csv")
+    with open(observers_filename, "wt") as f:
+        f.write("WKT\n")
+        f.write('"POINT (%f %f)"\n' % (ox[0], oy[0]))
+
+    _, err = gdaltest.runexternal_out_and_err(
+        gdal_viewshed_path
+        + " -om DEM -observers {} {} {}".format(
+            observers_filename, viewshed_input, str(tmp_path / "out.tif")
+        )
+    )
+    assert "-om cannot be used with -observers" in err
@@ -903,3 +903,33 @@ def test_gdalbuildvrt_lib_nodataMaxMaskThreshold_rgb_mask(tmp_vsimem):
     assert struct.unpack(
         "f" * 3, vrt_ds.GetRasterBand(1).ReadRaster(buf_type=gdal.GDT_Float32)
     ) == pytest.approx((1.0, 1.001, 2.0))
+
+
+###############################################################################
+# Test that opening sources with several threads gives the same result
+
+
+def test_gdalbuildvrt_lib_num_threads(tmp_vsimem):
+
+    src_filenames = []
+    for i in range(40):
+        filename = str(tmp_vsimem / f"src_{i}.tif")
+        ds = gdal.GetDriverByName("GTiff").Create(filename, 10, 10)
+        ds.SetGeoTransform([2 + (i % 8) * 10, 1, 0, 49 - (i // 8) * 10, 0, -1])
+        ds = None
+        src_filenames.append(filename)
+    src_filenames.insert(5, str(tmp_vsimem / "non_existing.tif"))
+
+    def build(num_threads):
+        vrt_filename = str(tmp_vsimem / f"out_{num_threads}.vrt")
+        with gdal.quiet_errors():
+            gdal.BuildVRT(
+                vrt_filename, src_filenames, options=f"-num_threads {num_threads}"
+            ).Close()
+        with gdal.VSIFile(vrt_filename, "rb") as f:
+            return f.read().replace(bytes(f"out_{num_threads}", "ascii"), b"out")
+
+    ref = build(1)
+    assert b"src_39.tif" in ref
+    assert b"non_existing" not in ref
+    assert build(4) == ref
@@ -699,6 +699,36 @@ def test_gdaldem_lib_nodata():
         pytest.fail("Bad checksum")
 
 
+###############################################################################
+# Test that multi-threaded processing gives the same result as single-threaded
+
+
+@pytest.mark.parametrize(
+    "processing", ["hillshade", "slope", "aspect", "TRI", "TPI", "Roughness"]
+)
+@pytest.mark.parametrize("computeEdges", [False, True])
+@pytest.mark.parametrize("datatype", [gdal.GDT_Int16, gdal.GDT_Float32])
+def test_gdaldem_lib_multithreaded(processing, computeEdges, datatype):
+
+    src_ds = gdal.Translate(
+        "", "../gdrivers/data/n43.tif", format="MEM", outputType=datatype
+    )
+    # Add a few nodata pixels
+    src_ds.GetRasterBand(1).SetNoDataValue(0)
+    src_ds.GetRasterBand(1).WriteRaster(
+        10, 30, 2, 2, struct.pack("h" * 4, 0, 0, 0, 0), buf_type=gdal.GDT_Int16
+    )
+
+    ref_ds = gdal.DEMProcessing(
+        "", src_ds, processing, format="MEM", computeEdges=computeEdges
+    )
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        ds = gdal.DEMProcessing(
+            "", src_ds, processing, format="MEM", computeEdges=computeEdges
+        )
+    assert ds.ReadRaster() == ref_ds.ReadRaster()
+
+
 ###############################################################################
 # Test option argument handling
 
@@ -254,3 +254,18 @@ def test_gdallocationinfo_echo(gdallocationinfo_path):
         strin="1 2",
     )
     assert "1,2,132" in ret
+
+
+###############################################################################
+# Test several points read from stdin, with an invalid line and a point off
+# the file
+
+
+def test_gdallocationinfo_several_points(gdallocationinfo_path):
+
+    ret, err = gdaltest.runexternal_out_and_err(
+        gdallocationinfo_path + ' -valonly -field_sep "," ../gcore/data/byte.tif',
+        strin="0 0 a\n1 2 b\nbad\n100 100\n2 0\n",
+    )
+    assert [x for x in ret.splitlines() if x] == ["107,a", "132,b", "132"]
+    assert "Not enough values at line 3" in err
@@ -458,3 +458,20 @@ def test_gdaltindex_lib_fetch_md(tmp_path, four_tiles):
     lyr = ds.GetLayer(0)
     f = lyr.GetNextFeature()
     assert f["foo_field"] == "bar"
+
+
+###############################################################################
+# Test that opening sources with several threads gives the same result
+
+
+def test_gdaltindex_lib_num_threads(tmp_path, four_tiles):
+
+    index_filename = str(tmp_path / "test_gdaltindex_lib_num_threads.shp")
+    src_filenames = four_tiles * 5
+
+    gdal.TileIndex(index_filename, src_filenames, options="-num_threads 4")
+
+    ds = ogr.Open(index_filename)
+    lyr = ds.GetLayer(0)
+    assert lyr.GetFeatureCount() == len(src_filenames)
+    assert [f["location"] for f in lyr] == src_filenames
@@ -4186,3 +4186,37 @@ def test_target_extent_consistent_size():
 
     assert ds.RasterXSize == 4793
     assert ds.RasterYSize == 4143
+
+
+###############################################################################
+# Test that the CHUNK_PIPELINE_DEPTH warping option of -multi does not alter
+# the result, with many small chunks in flight.
+
+
+def test_gdalwarp_lib_multi_chunk_pipeline_depth():
+
+    src_ds = gdal.Translate(
+        "", "../gcore/data/byte.tif", format="MEM", width=200, height=200
+    )
+
+    results = []
+    for depth in (1, 2, 4):
+        ds = gdal.Warp(
+            "",
+            src_ds,
+            options=gdal.WarpOptions(
+                format="MEM",
+                dstSRS="EPSG:4326",
+                width=200,
+                height=200,
+                resampleAlg="bilinear",
+                multithread=True,
+                warpMemoryLimit=0.01,
+                warpOptions=[f"CHUNK_PIPELINE_DEPTH={depth}"],
+            ),
+        )
+        assert ds.GetRasterBand(1).Checksum() != 0
+        results.append(ds.ReadRaster())
+
+    assert results[1] == results[0]
+    assert results[2] == results[0]
@@ -156,6 +156,36 @@ def test_nearblack_lib_5(tmp_vsimem, alg):
     ds = None
 
 
+###############################################################################
+# Test that multi-threaded processing gives the same result as the
+# single-threaded one
+
+
+@pytest.mark.parametrize("maxNonBlack", [0, 2])
+def test_nearblack_lib_num_threads(tmp_vsimem, maxNonBlack):
+
+    src_ds = gdal.Translate(
+        "", "../gdrivers/data/rgbsmall.tif", format="MEM", width=150, height=120
+    )
+
+    def run(num_threads):
+        with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+            ds = gdal.Nearblack(
+                tmp_vsimem / f"out_{num_threads}.tif",
+                src_ds,
+                format="GTiff",
+                maxNonBlack=maxNonBlack,
+                nearDist=15,
+                setAlpha=True,
+                setMask=True,
+            )
+        return [ds.GetRasterBand(i + 1).Checksum() for i in range(4)] + [
+            ds.GetRasterBand(1).GetMaskBand().Checksum()
+        ]
+
+    assert run("1") == run("4")
+
+
 ###############################################################################
 # Test -color
 
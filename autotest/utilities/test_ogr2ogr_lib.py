@@ -701,6 +701,62 @@ def test_ogr2ogr_lib_makevalid(tmp_vsimem):
     )
 
 
+###############################################################################
+# Test -nt / -multi
+
+
+@pytest.mark.parametrize(
+    "options",
+    [
+        "-t_srs EPSG:32631 -segmentize 0.1",
+        "-simplify 0.01 -limit 600",
+        pytest.param("-clipsrc 1 40 3 42", marks=pytest.mark.require_geos),
+    ],
+)
+def test_ogr2ogr_lib_multithreaded(options):
+
+    srs = osr.SpatialReference()
+    srs.SetFromUserInput("WGS84")
+    srs.SetAxisMappingStrategy(osr.OAMS_TRADITIONAL_GIS_ORDER)
+    src_ds = gdal.GetDriverByName("Memory").Create("", 0, 0, 0, gdal.GDT_Unknown)
+    src_lyr = src_ds.CreateLayer("test", srs=srs)
+    src_lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    for i in range(1000):
+        f = ogr.Feature(src_lyr.GetLayerDefn())
+        f["id"] = i
+        x = 1 + (i % 20) * 0.1
+        y = 40 + (i // 20) * 0.05
+        if i % 10 != 0:
+            f.SetGeometry(
+                ogr.CreateGeometryFromWkt(
+                    f"LINESTRING ({x} {y},{x + 0.3} {y + 0.1},{x + 0.5} {y})"
+                )
+            )
+        src_lyr.CreateFeature(f)
+
+    ref_ds = gdal.VectorTranslate("", src_ds, options="-f Memory " + options)
+    ref_lyr = ref_ds.GetLayer(0)
+
+    out_ds = gdal.VectorTranslate("", src_ds, options="-f Memory -nt 4 " + options)
+    out_lyr = out_ds.GetLayer(0)
+    assert out_lyr.GetFeatureCount() == ref_lyr.GetFeatureCount()
+    assert out_lyr.GetFeatureCount() > 0
+    for ref_f, out_f in zip(ref_lyr, out_lyr):
+        assert out_f["id"] == ref_f["id"]
+        ref_g = ref_f.GetGeometryRef()
+        out_g = out_f.GetGeometryRef()
+        if ref_g is None:
+            assert out_g is None
+        else:
+            assert out_g.ExportToIsoWkt() == ref_g.ExportToIsoWkt()
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", "2"):
+        out_ds = gdal.VectorTranslate(
+            "", src_ds, options="-f Memory -multi " + options
+        )
+    assert out_ds.GetLayer(0).GetFeatureCount() == ref_lyr.GetFeatureCount()
+
+
 ###############################################################################
 # Test SQLStatement with -sql @filename syntax
 
@@ -1491,6 +1547,60 @@ def test_ogr2ogr_lib_clipdst_argument_errors():
         gdal.VectorTranslate("", srcDS, options="-f MEM -clipdst 1 2 3 4 -clipdst foo")
 
 
+###############################################################################
+# Test -clipsrc / -clipdst with a complex clip geometry, that gets split into
+# tiles
+
+
+@pytest.mark.parametrize("clip_option", ["clipSrc", "clipDst"])
+@pytest.mark.require_geos
+def test_ogr2ogr_lib_clip_complex_geometry(clip_option):
+
+    # Disc with 20000 vertices
+    clip_geom = ogr.CreateGeometryFromWkt("POINT (50 50)").Buffer(40, 5000)
+    assert clip_geom.GetGeometryRef(0).GetPointCount() > 20000
+
+    srcDS = gdal.GetDriverByName("Memory").Create("", 0, 0, 0, gdal.GDT_Unknown)
+    srcLayer = srcDS.CreateLayer("test")
+    for i in range(100):
+        x = i % 10 * 10 + 1
+        y = i // 10 * 10 + 1
+        f = ogr.Feature(srcLayer.GetLayerDefn())
+        f.SetFID(i)
+        f.SetGeometry(
+            ogr.CreateGeometryFromWkt(
+                f"POLYGON (({x} {y},{x} {y + 8},{x + 8} {y + 8},{x + 8} {y},{x} {y}))"
+            )
+        )
+        srcLayer.CreateFeature(f)
+
+    ds = gdal.VectorTranslate(
+        "",
+        srcDS,
+        format="Memory",
+        preserveFID=True,
+        **{clip_option: clip_geom.ExportToWkt()},
+    )
+    lyr = ds.GetLayer(0)
+    count = 0
+    for src_f in srcLayer:
+        src_geom = src_f.GetGeometryRef()
+        if not src_geom.Intersects(clip_geom):
+            continue
+        expected_geom = src_geom.Intersection(clip_geom)
+        if expected_geom.GetDimension() < 2:
+            continue
+        f = lyr.GetFeature(src_f.GetFID())
+        assert f is not None, src_f.GetFID()
+        got_geom = f.GetGeometryRef()
+        assert got_geom.SymDifference(expected_geom).GetArea() < 1e-8
+        if clip_geom.Contains(src_geom):
+            assert got_geom.Equals(src_geom)
+        count += 1
+    assert lyr.GetFeatureCount() == count
+    assert count > 50
+
+
 ###############################################################################
 # Test using explodecollections
 
@@ -70,7 +70,10 @@ GdalDriverHelper
 
 function(_set_driver_core_sources _KEY _DRIVER_TARGET)
 
-    add_library(${_DRIVER_TARGET}_core OBJECT ${ARGN})
+    # BUILTIN: the driver is built in libgdal, but its registration is
+    # deferred until first use (GDAL_ENABLE_DEFERRED_BUILTIN_DRIVERS)
+    cmake_parse_arguments(_CORE "BUILTIN" "" "" ${ARGN})
+    add_library(${_DRIVER_TARGET}_core OBJECT ${_CORE_UNPARSED_ARGUMENTS})
     set_property(TARGET ${_DRIVER_TARGET}_core PROPERTY POSITION_INDEPENDENT_CODE ${GDAL_OBJECT_LIBRARIES_POSITION_INDEPENDENT_CODE})
     target_sources(${GDAL_LIB_TARGET_NAME} PRIVATE $<TARGET_OBJECTS:${_DRIVER_TARGET}_core>)
     target_compile_definitions(${_DRIVER_TARGET}_core PRIVATE "-DPLUGIN_FILENAME=\"${_DRIVER_TARGET}${CMAKE_SHARED_LIBRARY_SUFFIX}\"")
@@ -86,7 +89,15 @@ function(_set_driver_core_sources _KEY _DRIVER_TARGET)
     gdal_standard_includes(${_DRIVER_TARGET}_core)
     add_dependencies(${_DRIVER_TARGET}_core generate_gdal_version_h)
 
-    target_compile_definitions(gdal_frmts PRIVATE -DDEFERRED_${_KEY}_DRIVER)
+    if (_CORE_BUILTIN)
+        if (IS_OGR EQUAL -1) # raster
+            target_compile_definitions(gdal_frmts PRIVATE -DDEFERRED_BUILTIN_${_KEY}_DRIVER)
+        else ()
+            target_compile_definitions(ogrsf_frmts PRIVATE -DDEFERRED_BUILTIN_${_KEY}_DRIVER)
+        endif ()
+    else ()
+        target_compile_definitions(gdal_frmts PRIVATE -DDEFERRED_${_KEY}_DRIVER)
+    endif ()
 
 endfunction()
 
@@ -258,7 +269,14 @@ function(add_gdal_driver)
         endif ()
 
     else ()
-        add_library(${_DRIVER_TARGET} OBJECT ${_DRIVER_SOURCES} ${_DRIVER_CORE_SOURCES})
+        if (_DRIVER_CORE_SOURCES AND GDAL_ENABLE_DEFERRED_BUILTIN_DRIVERS)
+            # Only the core sources are used at GDALAllRegister() time. The
+            # rest of the driver is registered on first use.
+            _set_driver_core_sources(${_KEY} ${_DRIVER_TARGET} BUILTIN ${_DRIVER_CORE_SOURCES})
+            add_library(${_DRIVER_TARGET} OBJECT ${_DRIVER_SOURCES})
+        else ()
+            add_library(${_DRIVER_TARGET} OBJECT ${_DRIVER_SOURCES} ${_DRIVER_CORE_SOURCES})
+        endif ()
         set_property(TARGET ${_DRIVER_TARGET} PROPERTY POSITION_INDEPENDENT_CODE ON)
         target_sources(${GDAL_LIB_TARGET_NAME} PRIVATE $<TARGET_OBJECTS:${_DRIVER_TARGET}>)
         if (_DRIVER_DEF)
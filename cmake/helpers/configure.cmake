@@ -382,6 +382,7 @@ else ()
   )
 
   check_include_file("linux/userfaultfd.h" HAVE_USERFAULTFD_H)
+  check_include_file("linux/io_uring.h" HAVE_LINUX_IO_URING_H)
 endif ()
 
 if (${CMAKE_SYSTEM_NAME} MATCHES "Darwin")
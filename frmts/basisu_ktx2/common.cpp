@@ -91,41 +91,47 @@ bool GDAL_KTX2_BASISU_CreateCopy(const char *pszFilename, GDALDataset *poSrcDS,
 
     const int nXSize = poSrcDS->GetRasterXSize();
     const int nYSize = poSrcDS->GetRasterYSize();
-    void *pSrcData = VSI_MALLOC3_VERBOSE(nXSize, nYSize, nBands);
-    if (pSrcData == nullptr)
-        return false;
 
-    if (poSrcDS->RasterIO(GF_Read, 0, 0, nXSize, nYSize, pSrcData, nXSize,
-                          nYSize, GDT_Byte, nBands, nullptr, nBands,
-                          static_cast<GSpacing>(nBands) * nXSize, 1,
-                          nullptr) != CE_None)
-    {
-        VSIFree(pSrcData);
-        return false;
-    }
+    GDALInitBasisUEncoder();
 
-    basisu::image img;
+    const bool bVerbose = CPLTestBool(CPLGetConfigOption("KTX2_VERBOSE", "NO"));
+
+    basisu::basis_compressor_params params;
+    params.m_create_ktx2_file = bIsKTX2;
+
+    // Read the source directly into the RGBA image of the encoder, instead
+    // of going through a temporary pixel-interleaved copy of it.
     try
     {
-        img.init(static_cast<const uint8_t *>(pSrcData), nXSize, nYSize,
-                 nBands);
-        VSIFree(pSrcData);
+        params.m_source_images.resize(1);
+        params.m_source_images[0].resize(nXSize, nYSize, UINT32_MAX,
+                                         basisu::color_rgba(0, 0, 0, 255));
     }
     catch (const std::exception &e)
     {
-        VSIFree(pSrcData);
-        CPLError(CE_Failure, CPLE_AppDefined, "%s", e.what());
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
         return false;
     }
 
-    GDALInitBasisUEncoder();
-
-    const bool bVerbose = CPLTestBool(CPLGetConfigOption("KTX2_VERBOSE", "NO"));
-
-    basisu::basis_compressor_params params;
-    params.m_create_ktx2_file = bIsKTX2;
-
-    params.m_source_images.push_back(img);
+    {
+        // Expand grey and grey+alpha as basisu::image::init() does
+        const int anBandMapGrey[] = {1, 1, 1};
+        const int anBandMapGreyAlpha[] = {1, 1, 1, 2};
+        const int anBandMapRGBA[] = {1, 2, 3, 4};
+        const int *panBandMap = nBands == 1   ? anBandMapGrey
+                                : nBands == 2 ? anBandMapGreyAlpha
+                                              : anBandMapRGBA;
+        const int nBandCount = nBands <= 2 ? nBands + 2 : nBands;
+        constexpr GSpacing nPixelSpace = sizeof(basisu::color_rgba);
+        if (poSrcDS->RasterIO(GF_Read, 0, 0, nXSize, nYSize,
+                              params.m_source_images[0].get_ptr(), nXSize,
+                              nYSize, GDT_Byte, nBandCount,
+                              panBandMap, nPixelSpace, nPixelSpace * nXSize,
+                              1, nullptr) != CE_None)
+        {
+            return false;
+        }
+    }
 
     params.m_perceptual = EQUAL(
         CSLFetchNameValueDef(papszOptions, "COLORSPACE", "PERCEPTUAL_SRGB"),
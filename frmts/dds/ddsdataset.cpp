@@ -28,11 +28,14 @@
  ******************************************************************************/
 
 #include "crunch_headers.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_frmts.h"
 #include "gdal_pam.h"
+#include "gdal_thread_pool.h"
 #include "ddsdrivercore.h"
 
 #include <algorithm>
+#include <vector>
 
 using namespace crnlib;
 
@@ -463,6 +466,89 @@ GDALDataset *DDSDatasetAllDecoded::Open(GDALOpenInfo *poOpenInfo)
     return poDS;
 }
 
+/************************************************************************/
+/*                         DDSCompressBlockRows()                       */
+/************************************************************************/
+
+namespace
+{
+struct DDSCompressJob
+{
+    crn_block_compressor_context_t pContext = nullptr;
+    std::vector<crn_uint32> anSrcImage{};
+    const GByte *pabyScanlines = nullptr;  // first line of the chunk
+    GByte *pabyCompressed = nullptr;       // first block row of the chunk
+    int nColorType = 0;
+    int nBands = 0;
+    uint32_t nXSize = 0;
+    uint32_t nYSize = 0;  // number of valid lines in the chunk
+    uint32_t nNumBlocksX = 0;
+    uint32_t nBytesPerBlock = 0;
+    uint32_t nFirstBlockRow = 0;
+    uint32_t nEndBlockRow = 0;  // exclusive
+};
+}  // namespace
+
+static void DDSCompressBlockRows(void *pData)
+{
+    DDSCompressJob *psJob = static_cast<DDSCompressJob *>(pData);
+    const uint32_t nXSize = psJob->nXSize;
+    const size_t nScanlinesSize =
+        static_cast<size_t>(psJob->nBands) * nXSize * cDXTBlockSize;
+    crn_uint32 pixels[cDXTBlockSize * cDXTBlockSize];
+
+    for (uint32_t iRow = psJob->nFirstBlockRow; iRow < psJob->nEndBlockRow;
+         ++iRow)
+    {
+        const uint32_t size_y =
+            std::min(cDXTBlockSize, psJob->nYSize - iRow * cDXTBlockSize);
+        const GByte *pabyScanlines =
+            psJob->pabyScanlines + iRow * nScanlinesSize;
+
+        const crn_uint32 *pSrc_image = nullptr;
+        if (psJob->nColorType == DDS_COLOR_TYPE_RGB_ALPHA)
+            pSrc_image = reinterpret_cast<const crn_uint32 *>(pabyScanlines);
+        else
+        { /* crunch needs 32bits integers */
+            const uint32_t nPixels = nXSize * size_y;
+            crn_uint32 *src_image = psJob->anSrcImage.data();
+            for (uint32_t i = 0; i < nPixels; ++i)
+            {
+                const uint32_t y = i * 3;
+                src_image[i] = (255U << 24) | (pabyScanlines[y + 2] << 16) |
+                               (pabyScanlines[y + 1] << 8) | pabyScanlines[y];
+            }
+            pSrc_image = src_image;
+        }
+
+        GByte *pabyCompressed =
+            psJob->pabyCompressed +
+            static_cast<size_t>(iRow) * psJob->nNumBlocksX *
+                psJob->nBytesPerBlock;
+        for (uint32_t block_x = 0; block_x < psJob->nNumBlocksX; block_x++)
+        {
+            // Exact block from image, clamping at the sides of non-divisible by
+            // 4 images to avoid artifacts.
+            crn_uint32 *pDst_pixels = pixels;
+            for (uint32_t y = 0; y < cDXTBlockSize; y++)
+            {
+                const uint32_t actual_y = std::min(y, size_y - 1U);
+                for (uint32_t x = 0; x < cDXTBlockSize; x++)
+                {
+                    const uint32_t actual_x =
+                        std::min(nXSize - 1U, (block_x * cDXTBlockSize) + x);
+                    *pDst_pixels++ = pSrc_image[actual_x + actual_y * nXSize];
+                }
+            }
+
+            // Compress the DXTn block.
+            crn_compress_block(psJob->pContext, pixels,
+                               pabyCompressed +
+                                   block_x * psJob->nBytesPerBlock);
+        }
+    }
+}
+
 /************************************************************************/
 /*                             CreateCopy()                             */
 /************************************************************************/
@@ -593,9 +679,6 @@ GDALDataset *DDSDataset::CreateCopy(const char *pszFilename,
     comp_params.set_flag(cCRNCompFlagPerceptual, srgb_colorspace);
     comp_params.set_flag(cCRNCompFlagDXT1AForTransparency, dxt1a_transparency);
 
-    crn_block_compressor_context_t pContext =
-        crn_create_block_compressor(comp_params);
-
     /* -------------------------------------------------------------------- */
     /*      Write the DDS header to the file.                               */
     /* -------------------------------------------------------------------- */
@@ -644,72 +727,84 @@ GDALDataset *DDSDataset::CreateCopy(const char *pszFilename,
     const uint32_t num_blocks_x = (nXSize + cDXTBlockSize - 1) / cDXTBlockSize;
     const uint32_t total_compressed_size = num_blocks_x * bytesPerBlock;
 
-    void *pCompressed_data = CPLMalloc(total_compressed_size);
-    GByte *pabyScanlines = (GByte *)CPLMalloc(nBands * nXSize * cDXTBlockSize);
-    crn_uint32 *pixels = (crn_uint32 *)CPLMalloc(sizeof(crn_uint32) *
-                                                 cDXTBlockSize * cDXTBlockSize);
-    crn_uint32 *src_image = nullptr;
-    if (nColorType == DDS_COLOR_TYPE_RGB)
-        src_image = (crn_uint32 *)CPLMalloc(sizeof(crn_uint32) * nXSize *
-                                            cDXTBlockSize);
+    const char *pszNumThreads = CSLFetchNameValueDef(
+        papszOptions, "NUM_THREADS",
+        CPLGetConfigOption("GDAL_NUM_THREADS", "1"));
+    int nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                    : atoi(pszNumThreads);
+    nThreads = std::max(
+        1, std::min(nThreads, static_cast<int>(std::min(nYNumBlocks, 128U))));
+    CPLWorkerThreadPool *poPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    if (poPool == nullptr)
+        nThreads = 1;
+    auto poQueue = poPool ? poPool->CreateJobQueue() : nullptr;
+
+    // Several rows of blocks are read at once, and compressed in parallel
+    // by the worker threads, each one with its own crunch context.
+    const uint32_t nChunkBlockRows =
+        std::min(nYNumBlocks, 4U * static_cast<uint32_t>(nThreads));
+    GByte *pabyCompressed = static_cast<GByte *>(
+        VSI_MALLOC2_VERBOSE(total_compressed_size, nChunkBlockRows));
+    GByte *pabyScanlines = static_cast<GByte *>(VSI_MALLOC3_VERBOSE(
+        nBands * nXSize, cDXTBlockSize, nChunkBlockRows));
+    if (pabyCompressed == nullptr || pabyScanlines == nullptr)
+        eErr = CE_Failure;
+
+    std::vector<DDSCompressJob> asJobs(nThreads);
+    for (auto &sJob : asJobs)
+    {
+        sJob.pContext = crn_create_block_compressor(comp_params);
+        if (nColorType == DDS_COLOR_TYPE_RGB)
+            sJob.anSrcImage.resize(static_cast<size_t>(nXSize) * cDXTBlockSize);
+        sJob.pabyScanlines = pabyScanlines;
+        sJob.pabyCompressed = pabyCompressed;
+        sJob.nColorType = nColorType;
+        sJob.nBands = nBands;
+        sJob.nXSize = nXSize;
+        sJob.nNumBlocksX = num_blocks_x;
+        sJob.nBytesPerBlock = bytesPerBlock;
+    }
 
-    for (uint32_t iLine = 0; iLine < nYNumBlocks && eErr == CE_None; iLine++)
+    for (uint32_t iChunk = 0; iChunk < nYNumBlocks && eErr == CE_None;
+         iChunk += nChunkBlockRows)
     {
-        const uint32_t size_y =
-            (iLine * cDXTBlockSize + cDXTBlockSize) < (uint32_t)nYSize
-                ? cDXTBlockSize
-                : (cDXTBlockSize - ((iLine * cDXTBlockSize + cDXTBlockSize) -
-                                    (uint32_t)nYSize));
+        const uint32_t nBlockRows =
+            std::min(nChunkBlockRows, nYNumBlocks - iChunk);
+        const uint32_t nYOff = iChunk * cDXTBlockSize;
+        const uint32_t nLines =
+            std::min(nBlockRows * cDXTBlockSize, nYSize - nYOff);
 
-        eErr =
-            poSrcDS->RasterIO(GF_Read, 0, iLine * cDXTBlockSize, nXSize, size_y,
-                              pabyScanlines, nXSize, size_y, GDT_Byte, nBands,
-                              nullptr, nBands, nBands * nXSize, 1, nullptr);
+        eErr = poSrcDS->RasterIO(GF_Read, 0, nYOff, nXSize, nLines,
+                                 pabyScanlines, nXSize, nLines, GDT_Byte,
+                                 nBands, nullptr, nBands, nBands * nXSize, 1,
+                                 nullptr);
 
         if (eErr != CE_None)
             break;
 
-        crn_uint32 *pSrc_image = nullptr;
-        if (nColorType == DDS_COLOR_TYPE_RGB_ALPHA)
-            pSrc_image = (crn_uint32 *)pabyScanlines;
-        else if (nColorType == DDS_COLOR_TYPE_RGB)
-        { /* crunch needs 32bits integers */
-            int nPixels = nXSize * cDXTBlockSize;
-            for (int i = 0; i < nPixels; ++i)
-            {
-                int y = (i * 3);
-                src_image[i] = (255U << 24) | (pabyScanlines[y + 2] << 16) |
-                               (pabyScanlines[y + 1] << 8) | pabyScanlines[y];
-            }
-
-            pSrc_image = &(src_image[0]);
-        }
-
-        for (crn_uint32 block_x = 0; block_x < num_blocks_x; block_x++)
+        const uint32_t nJobs = static_cast<uint32_t>(nThreads);
+        const uint32_t nBlockRowsPerJob = (nBlockRows + nJobs - 1) / nJobs;
+        for (uint32_t i = 0; i < nJobs; ++i)
         {
-            // Exact block from image, clamping at the sides of non-divisible by
-            // 4 images to avoid artifacts.
-            crn_uint32 *pDst_pixels = pixels;
-            for (uint32_t y = 0; y < cDXTBlockSize; y++)
-            {
-                const uint32_t actual_y = std::min(y, size_y - 1U);
-                for (uint32_t x = 0; x < cDXTBlockSize; x++)
-                {
-                    const uint32_t actual_x =
-                        std::min(nXSize - 1U, (block_x * cDXTBlockSize) + x);
-                    *pDst_pixels++ = pSrc_image[actual_x + actual_y * nXSize];
-                }
-            }
-
-            // Compress the DXTn block.
-            crn_compress_block(pContext, pixels,
-                               static_cast<crn_uint8 *>(pCompressed_data) +
-                                   block_x * bytesPerBlock);
+            DDSCompressJob &sJob = asJobs[i];
+            sJob.nYSize = nLines;
+            sJob.nFirstBlockRow = std::min(nBlockRows, i * nBlockRowsPerJob);
+            sJob.nEndBlockRow =
+                std::min(nBlockRows, (i + 1) * nBlockRowsPerJob);
+            if (poQueue)
+                poQueue->SubmitJob(DDSCompressBlockRows, &sJob);
+            else
+                DDSCompressBlockRows(&sJob);
         }
+        if (poQueue)
+            poQueue->WaitCompletion();
 
-        VSIFWriteL(pCompressed_data, 1, total_compressed_size, fpImage);
+        VSIFWriteL(pabyCompressed, 1,
+                   static_cast<size_t>(total_compressed_size) * nBlockRows,
+                   fpImage);
 
-        if (!pfnProgress((iLine + 1) / (double)nYNumBlocks, nullptr,
+        if (!pfnProgress((iChunk + nBlockRows) / (double)nYNumBlocks, nullptr,
                          pProgressData))
         {
             eErr = CE_Failure;
@@ -718,12 +813,10 @@ GDALDataset *DDSDataset::CreateCopy(const char *pszFilename,
         }
     }
 
-    CPLFree(src_image);
-    CPLFree(pixels);
-    CPLFree(pCompressed_data);
-    CPLFree(pabyScanlines);
-    crn_free_block_compressor(pContext);
-    pContext = nullptr;
+    for (auto &sJob : asJobs)
+        crn_free_block_compressor(sJob.pContext);
+    VSIFree(pabyCompressed);
+    VSIFree(pabyScanlines);
 
     VSIFCloseL(fpImage);
 
@@ -83,6 +83,9 @@ void DDSDriverSetCommonMetadata(GDALDriver *poDriver)
         "     <Value>BETTER</Value>\n"
         "     <Value>UBER</Value>\n"
         "   </Option>\n"
+        "   <Option name='NUM_THREADS' type='string' description='Number of "
+        "worker threads for compression. Can be set to ALL_CPUS' default='1'/>"
+        "\n"
         "</CreationOptionList>\n");
 
     poDriver->SetMetadataItem(GDAL_DCAP_VIRTUALIO, "YES");
@@ -333,7 +333,12 @@ void CPL_STDCALL GDALAllRegister()
 #endif
 
 #ifdef FRMT_nitf
+#ifdef DEFERRED_BUILTIN_NITF_DRIVER
+    poDriverManager->DeclareDeferredBuiltinDriver(DeclareDeferredNITFPlugin,
+                                                  GDALRegister_NITF);
+#else
     GDALRegister_NITF();
+#endif
     GDALRegister_RPFTOC();
     GDALRegister_ECRGTOC();
 #endif
@@ -386,20 +391,40 @@ void CPL_STDCALL GDALAllRegister()
 #endif
 
 #ifdef FRMT_png
+#ifdef DEFERRED_BUILTIN_PNG_DRIVER
+    poDriverManager->DeclareDeferredBuiltinDriver(DeclareDeferredPNGPlugin,
+                                                  GDALRegister_PNG);
+#else
     GDALRegister_PNG();
 #endif
+#endif
 
 #ifdef FRMT_dds
+#ifdef DEFERRED_BUILTIN_DDS_DRIVER
+    poDriverManager->DeclareDeferredBuiltinDriver(DeclareDeferredDDSPlugin,
+                                                  GDALRegister_DDS);
+#else
     GDALRegister_DDS();
 #endif
+#endif
 
 #ifdef FRMT_gta
+#ifdef DEFERRED_BUILTIN_GTA_DRIVER
+    poDriverManager->DeclareDeferredBuiltinDriver(DeclareDeferredGTAPlugin,
+                                                  GDALRegister_GTA);
+#else
     GDALRegister_GTA();
 #endif
+#endif
 
 #ifdef FRMT_jpeg
+#ifdef DEFERRED_BUILTIN_JPEG_DRIVER
+    poDriverManager->DeclareDeferredBuiltinDriver(DeclareDeferredJPEGPlugin,
+                                                  GDALRegister_JPEG);
+#else
     GDALRegister_JPEG();
 #endif
+#endif
 
 #ifdef FRMT_mem
     GDALRegister_MEM();
@@ -419,8 +444,13 @@ void CPL_STDCALL GDALAllRegister()
 #endif
 
 #ifdef FRMT_fits
+#ifdef DEFERRED_BUILTIN_FITS_DRIVER
+    poDriverManager->DeclareDeferredBuiltinDriver(DeclareDeferredFITSPlugin,
+                                                  GDALRegister_FITS);
+#else
     GDALRegister_FITS();
 #endif
+#endif
 
 #ifdef FRMT_bsb
     GDALRegister_BSB();
@@ -451,12 +481,22 @@ void CPL_STDCALL GDALAllRegister()
 #endif
 
 #ifdef FRMT_pcidsk
+#ifdef DEFERRED_BUILTIN_PCIDSK_DRIVER
+    poDriverManager->DeclareDeferredBuiltinDriver(DeclareDeferredPCIDSKPlugin,
+                                                  GDALRegister_PCIDSK);
+#else
     GDALRegister_PCIDSK();
 #endif
+#endif
 
 #ifdef FRMT_pcraster
+#ifdef DEFERRED_BUILTIN_PCRASTER_DRIVER
+    poDriverManager->DeclareDeferredBuiltinDriver(DeclareDeferredPCRasterPlugin,
+                                                  GDALRegister_PCRaster);
+#else
     GDALRegister_PCRaster();
 #endif
+#endif
 
 #ifdef FRMT_ilwis
     GDALRegister_ILWIS();
@@ -479,8 +519,13 @@ void CPL_STDCALL GDALAllRegister()
 #endif
 
 #ifdef FRMT_netcdf
+#ifdef DEFERRED_BUILTIN_NETCDF_DRIVER
+    poDriverManager->DeclareDeferredBuiltinDriver(DeclareDeferredNetCDFPlugin,
+                                                  GDALRegister_netCDF);
+#else
     GDALRegister_netCDF();
 #endif
+#endif
 
 #ifdef FRMT_hdf4
     GDALRegister_HDF4();
@@ -505,18 +550,33 @@ void CPL_STDCALL GDALAllRegister()
 
 #ifdef FRMT_jp2kak
     // JPEG2000 support using Kakadu toolkit
+#ifdef DEFERRED_BUILTIN_JP2KAK_DRIVER
+    poDriverManager->DeclareDeferredBuiltinDriver(DeclareDeferredJP2KAKPlugin,
+                                                  GDALRegister_JP2KAK);
+#else
     GDALRegister_JP2KAK();
 #endif
+#endif
 
 #ifdef FRMT_jpipkak
     // JPEG2000 support using Kakadu toolkit
+#ifdef DEFERRED_BUILTIN_JPIPKAK_DRIVER
+    poDriverManager->DeclareDeferredBuiltinDriver(DeclareDeferredJPIPKAKPlugin,
+                                                  GDALRegister_JPIPKAK);
+#else
     GDALRegister_JPIPKAK();
 #endif
+#endif
 
 #ifdef FRMT_jp2lura
     // JPEG2000 support using Lurawave library
+#ifdef DEFERRED_BUILTIN_JP2LURA_DRIVER
+    poDriverManager->DeclareDeferredBuiltinDriver(DeclareDeferredJP2LuraPlugin,
+                                                  GDALRegister_JP2Lura);
+#else
     GDALRegister_JP2Lura();
 #endif
+#endif
 
 #ifdef FRMT_ecw
     GDALRegister_ECW();
@@ -525,8 +585,13 @@ void CPL_STDCALL GDALAllRegister()
 
 #ifdef FRMT_openjpeg
     // JPEG2000 support using OpenJPEG library
+#ifdef DEFERRED_BUILTIN_JP2OPENJPEG_DRIVER
+    poDriverManager->DeclareDeferredBuiltinDriver(DeclareDeferredOPENJPEGPlugin,
+                                                  GDALRegister_JP2OpenJPEG);
+#else
     GDALRegister_JP2OpenJPEG();
 #endif
+#endif
 
 #ifdef FRMT_l1b
     GDALRegister_L1B();
@@ -537,8 +602,13 @@ void CPL_STDCALL GDALAllRegister()
 #endif
 
 #ifdef FRMT_grib
+#ifdef DEFERRED_BUILTIN_GRIB_DRIVER
+    poDriverManager->DeclareDeferredBuiltinDriver(DeclareDeferredGRIBPlugin,
+                                                  GDALRegister_GRIB);
+#else
     GDALRegister_GRIB();
 #endif
+#endif
 
 #ifdef FRMT_mrsid
     GDALRegister_MrSID();
@@ -549,20 +619,35 @@ void CPL_STDCALL GDALAllRegister()
 #endif
 
 #ifdef FRMT_wcs
+#ifdef DEFERRED_BUILTIN_WCS_DRIVER
+    poDriverManager->DeclareDeferredBuiltinDriver(DeclareDeferredWCSPlugin,
+                                                  GDALRegister_WCS);
+#else
     GDALRegister_WCS();
 #endif
+#endif
 
 #ifdef FRMT_wms
+#ifdef DEFERRED_BUILTIN_WMS_DRIVER
+    poDriverManager->DeclareDeferredBuiltinDriver(DeclareDeferredWMSPlugin,
+                                                  GDALRegister_WMS);
+#else
     GDALRegister_WMS();
 #endif
+#endif
 
 #ifdef FRMT_msgn
     GDALRegister_MSGN();
 #endif
 
 #ifdef FRMT_msg
+#ifdef DEFERRED_BUILTIN_MSG_DRIVER
+    poDriverManager->DeclareDeferredBuiltinDriver(DeclareDeferredMSGPlugin,
+                                                  GDALRegister_MSG);
+#else
     GDALRegister_MSG();
 #endif
+#endif
 
 #ifdef FRMT_idrisi
     GDALRegister_IDRISI();
@@ -599,16 +684,31 @@ void CPL_STDCALL GDALAllRegister()
 #endif
 
 #ifdef FRMT_webp
+#ifdef DEFERRED_BUILTIN_WEBP_DRIVER
+    poDriverManager->DeclareDeferredBuiltinDriver(DeclareDeferredWEBPPlugin,
+                                                  GDALRegister_WEBP);
+#else
     GDALRegister_WEBP();
 #endif
+#endif
 
 #ifdef FRMT_pdf
+#ifdef DEFERRED_BUILTIN_PDF_DRIVER
+    poDriverManager->DeclareDeferredBuiltinDriver(DeclareDeferredPDFPlugin,
+                                                  GDALRegister_PDF);
+#else
     GDALRegister_PDF();
 #endif
+#endif
 
 #ifdef FRMT_rasterlite
+#ifdef DEFERRED_BUILTIN_RASTERLITE_DRIVER
+    poDriverManager->DeclareDeferredBuiltinDriver(
+        DeclareDeferredRasterlitePlugin, GDALRegister_Rasterlite);
+#else
     GDALRegister_Rasterlite();
 #endif
+#endif
 
 #ifdef FRMT_mbtiles
     GDALRegister_MBTiles();
@@ -623,20 +723,35 @@ void CPL_STDCALL GDALAllRegister()
 #endif
 
 #ifdef FRMT_wmts
+#ifdef DEFERRED_BUILTIN_WMTS_DRIVER
+    poDriverManager->DeclareDeferredBuiltinDriver(DeclareDeferredWMTSPlugin,
+                                                  GDALRegister_WMTS);
+#else
     GDALRegister_WMTS();
 #endif
+#endif
 
 #ifdef FRMT_sentinel2
     GDALRegister_SENTINEL2();
 #endif
 
 #ifdef FRMT_mrf
+#ifdef DEFERRED_BUILTIN_MRF_DRIVER
+    poDriverManager->DeclareDeferredBuiltinDriver(DeclareDeferredMRFPlugin,
+                                                  GDALRegister_mrf);
+#else
     GDALRegister_mrf();
 #endif
+#endif
 
 #ifdef FRMT_tiledb
+#ifdef DEFERRED_BUILTIN_TILEDB_DRIVER
+    poDriverManager->DeclareDeferredBuiltinDriver(DeclareDeferredTileDBPlugin,
+                                                  GDALRegister_TileDB);
+#else
     GDALRegister_TileDB();
 #endif
+#endif
 
 #ifdef FRMT_rdb
     GDALRegister_RDB();
@@ -671,8 +786,13 @@ void CPL_STDCALL GDALAllRegister()
 
 /* Register KEA before HDF5 */
 #ifdef FRMT_kea
+#ifdef DEFERRED_BUILTIN_KEA_DRIVER
+    poDriverManager->DeclareDeferredBuiltinDriver(DeclareDeferredKEAPlugin,
+                                                  GDALRegister_KEA);
+#else
     GDALRegister_KEA();
 #endif
+#endif
 
 #ifdef FRMT_hdf5
     GDALRegister_BAG();
@@ -698,12 +818,22 @@ void CPL_STDCALL GDALAllRegister()
 #endif
 
 #ifdef FRMT_georaster
+#ifdef DEFERRED_BUILTIN_GEOR_DRIVER
+    poDriverManager->DeclareDeferredBuiltinDriver(DeclareDeferredGEORPlugin,
+                                                  GDALRegister_GEOR);
+#else
     GDALRegister_GEOR();
 #endif
+#endif
 
 #ifdef FRMT_postgisraster
+#ifdef DEFERRED_BUILTIN_POSTGISRASTER_DRIVER
+    poDriverManager->DeclareDeferredBuiltinDriver(
+        DeclareDeferredPostGISRasterPlugin, GDALRegister_PostGISRaster);
+#else
     GDALRegister_PostGISRaster();
 #endif
+#endif
 
 #ifdef FRMT_saga
     GDALRegister_SAGA();
@@ -759,12 +889,22 @@ void CPL_STDCALL GDALAllRegister()
 #endif
 
 #ifdef FRMT_exr
+#ifdef DEFERRED_BUILTIN_EXR_DRIVER
+    poDriverManager->DeclareDeferredBuiltinDriver(DeclareDeferredEXRPlugin,
+                                                  GDALRegister_EXR);
+#else
     GDALRegister_EXR();
 #endif
+#endif
 
 #ifdef FRMT_heif
+#ifdef DEFERRED_BUILTIN_HEIF_DRIVER
+    poDriverManager->DeclareDeferredBuiltinDriver(DeclareDeferredHEIFPlugin,
+                                                  GDALRegister_HEIF);
+#else
     GDALRegister_HEIF();
 #endif
+#endif
 
 #ifdef FRMT_tga
     GDALRegister_TGA();
@@ -783,8 +923,13 @@ void CPL_STDCALL GDALAllRegister()
 #endif
 
 #ifdef FRMT_jpegxl
+#ifdef DEFERRED_BUILTIN_JPEGXL_DRIVER
+    poDriverManager->DeclareDeferredBuiltinDriver(DeclareDeferredJPEGXLPlugin,
+                                                  GDALRegister_JPEGXL);
+#else
     GDALRegister_JPEGXL();
 #endif
+#endif
 
 #ifdef FRMT_basisu_ktx2
     GDALRegister_BASISU();
@@ -815,8 +960,13 @@ void CPL_STDCALL GDALAllRegister()
 #endif
 
 #ifdef FRMT_zarr
+#ifdef DEFERRED_BUILTIN_ZARR_DRIVER
+    poDriverManager->DeclareDeferredBuiltinDriver(DeclareDeferredZarrPlugin,
+                                                  GDALRegister_Zarr);
+#else
     GDALRegister_Zarr();
 #endif
+#endif
 
 /* -------------------------------------------------------------------- */
 /*      Register GDAL HTTP last, to let a chance to other drivers       */
@@ -44,6 +44,7 @@
 #endif
 
 #include <algorithm>
+#include <map>
 #include <set>
 #include <string>
 #include <vector>
@@ -804,9 +805,13 @@ const char *GRIBRasterBand::GetDescription() const
 
 /************************************************************************/
 /*                             LoadData()                               */
+/*                                                                      */
+/*      If fpIn is not null, the message is read from it at nOffset,    */
+/*      typically from an in-memory copy of the message, instead of     */
+/*      from the dataset file at the band start offset.                 */
 /************************************************************************/
 
-CPLErr GRIBRasterBand::LoadData()
+CPLErr GRIBRasterBand::LoadData(VSILFILE *fpIn, vsi_l_offset nOffset)
 
 {
     if (!m_Grib_Data)
@@ -857,7 +862,12 @@ CPLErr GRIBRasterBand::LoadData()
             delete m_Grib_MetaData;
             m_Grib_MetaData = nullptr;
         }
-        ReadGribData(poGDS->fp, start, subgNum, &m_Grib_Data, &m_Grib_MetaData);
+        if (fpIn)
+            ReadGribData(fpIn, nOffset, subgNum, &m_Grib_Data,
+                         &m_Grib_MetaData);
+        else
+            ReadGribData(poGDS->fp, start, subgNum, &m_Grib_Data,
+                         &m_Grib_MetaData);
         if (!m_Grib_Data)
         {
             CPLError(CE_Failure, CPLE_AppDefined, "Out of memory.");
@@ -1299,6 +1309,188 @@ CPLErr GRIBDataset::GetGeoTransform(double *padfTransform)
     return CE_None;
 }
 
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+CPLErr GRIBDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                              int nXSize, int nYSize, void *pData,
+                              int nBufXSize, int nBufYSize,
+                              GDALDataType eBufType, int nBandCount,
+                              BANDMAP_TYPE panBandMap, GSpacing nPixelSpace,
+                              GSpacing nLineSpace, GSpacing nBandSpace,
+                              GDALRasterIOExtraArg *psExtraArg)
+{
+    if (eRWFlag == GF_Read && nBandCount > 1)
+        PrefetchBands(nBandCount, panBandMap);
+
+    return GDALPamDataset::IRasterIO(
+        eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
+        eBufType, nBandCount, panBandMap, nPixelSpace, nLineSpace, nBandSpace,
+        psExtraArg);
+}
+
+/************************************************************************/
+/*                           PrefetchBands()                            */
+/*                                                                      */
+/*      Fetch the GRIB2 messages of the requested bands that are not    */
+/*      loaded yet with a single multi-range read, which is issued as   */
+/*      parallel range requests on network file systems, and decode     */
+/*      them from memory.                                               */
+/************************************************************************/
+
+void GRIBDataset::PrefetchBands(int nBandCount, const int *panBandMap)
+{
+    if (bCacheOnlyOneBand)
+        return;
+
+    std::vector<GRIBRasterBand *> apoBands;
+    std::set<vsi_l_offset> oSetStarts;
+    for (int i = 0; i < nBandCount; ++i)
+    {
+        auto poBand =
+            cpl::down_cast<GRIBRasterBand *>(GetRasterBand(panBandMap[i]));
+        if (poBand->m_Grib_Data == nullptr &&
+            std::find(apoBands.begin(), apoBands.end(), poBand) ==
+                apoBands.end())
+        {
+            apoBands.push_back(poBand);
+            oSetStarts.insert(poBand->start);
+        }
+    }
+    if (oSetStarts.size() < 2)
+        return;
+
+    // Do not go beyond what LoadData() would keep cached anyway
+    const GIntBig nBandBytes =
+        static_cast<GIntBig>(nRasterXSize) * nRasterYSize * sizeof(double);
+    if (nCachedBytes + nBandBytes * static_cast<GIntBig>(apoBands.size()) >
+        nCachedBytesThreshold)
+    {
+        return;
+    }
+
+    VSIFSeekL(fp, 0, SEEK_END);
+    const vsi_l_offset nFileSize = VSIFTellL(fp);
+
+    // First pass: read the beginning of each message, to skip the garbage
+    // that may precede it (see FindTrueStart()) and get its length from
+    // section 0.
+    constexpr size_t HEADER_SIZE = 1024;
+    const std::vector<vsi_l_offset> anStarts(oSetStarts.begin(),
+                                             oSetStarts.end());
+    const int nMessages = static_cast<int>(anStarts.size());
+    std::vector<GByte> abyHeaders;
+    std::vector<void *> apHeaderData;
+    std::vector<vsi_l_offset> anHeaderOffsets;
+    std::vector<size_t> anHeaderSizes;
+    try
+    {
+        abyHeaders.resize(static_cast<size_t>(nMessages) * HEADER_SIZE);
+        for (int i = 0; i < nMessages; ++i)
+        {
+            if (anStarts[i] + 16 > nFileSize)
+                return;
+            apHeaderData.push_back(abyHeaders.data() + i * HEADER_SIZE);
+            anHeaderOffsets.push_back(anStarts[i]);
+            anHeaderSizes.push_back(static_cast<size_t>(std::min<vsi_l_offset>(
+                HEADER_SIZE, nFileSize - anStarts[i])));
+        }
+    }
+    catch (const std::exception &)
+    {
+        return;
+    }
+    if (VSIFReadMultiRangeL(nMessages, apHeaderData.data(),
+                            anHeaderOffsets.data(), anHeaderSizes.data(),
+                            fp) != 0)
+    {
+        return;
+    }
+
+    std::map<vsi_l_offset, int> oMapStartToMessageIdx;
+    std::vector<vsi_l_offset> anMsgOffsets;
+    std::vector<size_t> anMsgSizes;
+    GIntBig nTotalMsgSize = 0;
+    for (int i = 0; i < nMessages; ++i)
+    {
+        const GByte *pabyHeader = abyHeaders.data() + i * HEADER_SIZE;
+        const size_t nHeaderSize = anHeaderSizes[i];
+        size_t nOffset = 0;
+        while (nOffset + 16 <= nHeaderSize &&
+               memcmp(pabyHeader + nOffset, "GRIB", 4) != 0)
+        {
+            ++nOffset;
+        }
+        // Only GRIB2 messages are handled: the others are left to LoadData()
+        if (nOffset + 16 > nHeaderSize || pabyHeader[nOffset + 7] != 2)
+            continue;
+        GUInt64 nMsgSize = 0;
+        for (int j = 0; j < 8; ++j)
+            nMsgSize = (nMsgSize << 8) | pabyHeader[nOffset + 8 + j];
+        const vsi_l_offset nMsgOffset = anStarts[i] + nOffset;
+        if (nMsgSize < 16 || nMsgSize > nFileSize - nMsgOffset)
+            continue;
+        nTotalMsgSize += static_cast<GIntBig>(nMsgSize);
+        if (nTotalMsgSize > nCachedBytesThreshold)
+            return;
+        oMapStartToMessageIdx[anStarts[i]] =
+            static_cast<int>(anMsgOffsets.size());
+        anMsgOffsets.push_back(nMsgOffset);
+        anMsgSizes.push_back(static_cast<size_t>(nMsgSize));
+    }
+    if (anMsgOffsets.size() < 2)
+        return;
+
+    // Second pass: fetch the messages
+    std::vector<std::vector<GByte>> aabyMessages;
+    std::vector<void *> apMsgData;
+    try
+    {
+        aabyMessages.resize(anMsgOffsets.size());
+        for (size_t i = 0; i < anMsgOffsets.size(); ++i)
+        {
+            aabyMessages[i].resize(anMsgSizes[i]);
+            apMsgData.push_back(aabyMessages[i].data());
+        }
+    }
+    catch (const std::exception &)
+    {
+        return;
+    }
+    CPLDebug("GRIB", "Prefetching %d messages (" CPL_FRMT_GIB " bytes)",
+             static_cast<int>(anMsgOffsets.size()), nTotalMsgSize);
+    if (VSIFReadMultiRangeL(static_cast<int>(anMsgOffsets.size()),
+                            apMsgData.data(), anMsgOffsets.data(),
+                            anMsgSizes.data(), fp) != 0)
+    {
+        return;
+    }
+
+    // Decoding is done sequentially, as degrib keeps some state in static
+    // variables. Failures are silently ignored here, and will be reported
+    // by the regular lazy loading of the band.
+    for (GRIBRasterBand *poBand : apoBands)
+    {
+        const auto oIter = oMapStartToMessageIdx.find(poBand->start);
+        if (oIter == oMapStartToMessageIdx.end())
+            continue;
+        const int iMsg = oIter->second;
+        const std::string osTmpFilename(
+            CPLSPrintf("/vsimem/grib_prefetch_%p_%d", this, iMsg));
+        VSILFILE *fpMem = VSIFileFromMemBuffer(
+            osTmpFilename.c_str(), aabyMessages[iMsg].data(),
+            aabyMessages[iMsg].size(), FALSE);
+        if (fpMem)
+        {
+            CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+            poBand->LoadData(fpMem, 0);
+            VSIFCloseL(fpMem);
+        }
+        VSIUnlink(osTmpFilename.c_str());
+    }
+}
+
 /************************************************************************/
 /*                                Inventory()                           */
 /************************************************************************/
@@ -1337,6 +1529,55 @@ GRIBDataset::Inventory(VSILFILE *fp, GDALOpenInfo *poOpenInfo)
     return pInventories;
 }
 
+/************************************************************************/
+/*                      GRIBInventoryMatchesFilter()                    */
+/************************************************************************/
+
+/** Returns whether an inventory entry matches the ELEMENTS and LEVELS open
+ * options. An empty list matches everything.
+ */
+static bool GRIBInventoryMatchesFilter(const inventoryType *psInv,
+                                       const CPLStringList &aosElements,
+                                       const CPLStringList &aosLevels)
+{
+    std::string osElement;
+    std::vector<std::string> aosInvLevels;
+    if (psInv->element)
+    {
+        osElement = psInv->element;
+        if (psInv->shortFstLevel)
+            aosInvLevels.push_back(psInv->shortFstLevel);
+        if (psInv->longFstLevel)
+            aosInvLevels.push_back(psInv->longFstLevel);
+    }
+    else if (psInv->longFstLevel)
+    {
+        // Inventory from a .idx sidecar: longFstLevel is "var:level:time"
+        const CPLStringList aosTokens(CSLTokenizeString2(
+            psInv->longFstLevel, ":", CSLT_ALLOWEMPTYTOKENS));
+        if (aosTokens.size() >= 2)
+        {
+            osElement = aosTokens[0];
+            aosInvLevels.push_back(aosTokens[1]);
+        }
+    }
+
+    if (!aosElements.empty() && aosElements.FindString(osElement.c_str()) < 0)
+        return false;
+
+    if (!aosLevels.empty())
+    {
+        for (const auto &osLevel : aosInvLevels)
+        {
+            if (aosLevels.FindString(osLevel.c_str()) >= 0)
+                return true;
+        }
+        return false;
+    }
+
+    return true;
+}
+
 /************************************************************************/
 /*                                Open()                                */
 /************************************************************************/
@@ -1434,20 +1675,31 @@ GDALDataset *GRIBDataset::Open(GDALOpenInfo *poOpenInfo)
         return nullptr;
     }
 
+    const CPLStringList aosElements(CSLTokenizeString2(
+        CSLFetchNameValueDef(poOpenInfo->papszOpenOptions, "ELEMENTS", ""),
+        ",", CSLT_STRIPLEADSPACES | CSLT_STRIPENDSPACES));
+    const CPLStringList aosLevels(CSLTokenizeString2(
+        CSLFetchNameValueDef(poOpenInfo->papszOpenOptions, "LEVELS", ""), ",",
+        CSLT_HONOURSTRINGS | CSLT_STRIPLEADSPACES | CSLT_STRIPENDSPACES));
+
     // Create band objects.
+    uInt4 bandNr = 0;
     for (uInt4 i = 0; i < pInventories->length(); ++i)
     {
         inventoryType *psInv = pInventories->get(i);
+        if (!GRIBInventoryMatchesFilter(psInv, aosElements, aosLevels))
+            continue;
+
         GRIBRasterBand *gribBand = nullptr;
-        uInt4 bandNr = i + 1;
+        ++bandNr;
 
         if (bandNr == 1)
         {
             // Important: set DataSet extents before creating first RasterBand
             // in it.
             grib_MetaData *metaData = nullptr;
-            GRIBRasterBand::ReadGribData(poDS->fp, 0, psInv->subgNum, nullptr,
-                                         &metaData);
+            GRIBRasterBand::ReadGribData(poDS->fp, psInv->start, psInv->subgNum,
+                                         nullptr, &metaData);
             if (metaData == nullptr || metaData->gds.Nx < 1 ||
                 metaData->gds.Ny < 1)
             {
@@ -1486,6 +1738,20 @@ GDALDataset *GRIBDataset::Open(GDALOpenInfo *poOpenInfo)
         poDS->SetBand(bandNr, gribBand);
     }
 
+    if (bandNr == 0)
+    {
+        CPLError(CE_Failure, CPLE_OpenFailed,
+                 "No message of %s matches the ELEMENTS and LEVELS open "
+                 "options.",
+                 poOpenInfo->pszFilename);
+        // Release hGRIBMutex otherwise we'll deadlock with GDALDataset own
+        // hGRIBMutex.
+        CPLReleaseMutex(hGRIBMutex);
+        delete poDS;
+        CPLAcquireMutex(hGRIBMutex, 1000.0);
+        return nullptr;
+    }
+
     // Initialize any PAM information.
     poDS->SetDescription(poOpenInfo->pszFilename);
 
@@ -101,6 +101,13 @@ class GRIBDataset final : public GDALPamDataset
 
     CPLErr GetGeoTransform(double *padfTransform) override;
 
+    CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                     int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                     GDALDataType eBufType, int nBandCount,
+                     BANDMAP_TYPE panBandMap, GSpacing nPixelSpace,
+                     GSpacing nLineSpace, GSpacing nBandSpace,
+                     GDALRasterIOExtraArg *psExtraArg) override;
+
     const OGRSpatialReference *GetSpatialRef() const override
     {
         return m_poSRS.get();
@@ -116,6 +123,7 @@ class GRIBDataset final : public GDALPamDataset
     static GDALDataset *OpenMultiDim(GDALOpenInfo *);
     static std::unique_ptr<gdal::grib::InventoryWrapper>
     Inventory(VSILFILE *, GDALOpenInfo *);
+    void PrefetchBands(int nBandCount, const int *panBandMap);
 
     VSILFILE *fp;
     // Calculate and store once as GetGeoTransform may be called multiple times.
@@ -167,7 +175,7 @@ class GRIBRasterBand final : public GDALPamRasterBand
                              grib_MetaData **);
 
   private:
-    CPLErr LoadData();
+    CPLErr LoadData(VSILFILE *fpIn = nullptr, vsi_l_offset nOffset = 0);
     void FindNoDataGrib2(bool bSeekToStart = true);
     void FindMetaData();
     // Heuristic search for the start of the message
@@ -70,6 +70,12 @@ void GRIBDriverSetCommonMetadata(GDALDriver *poDriver)
                               "    <Option name='USE_IDX' type='boolean' "
                               "description='Load metadata from "
                               "wgrib2 index file if available' default='YES'/>"
+                              "    <Option name='ELEMENTS' type='string' "
+                              "description='Comma-separated list of element "
+                              "names of the messages to expose as bands'/>"
+                              "    <Option name='LEVELS' type='string' "
+                              "description='Comma-separated list of levels of "
+                              "the messages to expose as bands'/>"
                               "</OpenOptionList>");
     poDriver->SetMetadataItem(GDAL_DMD_HELPTOPIC, "drivers/raster/grib.html");
     poDriver->SetMetadataItem(GDAL_DMD_EXTENSIONS, "grb grb2 grib2");
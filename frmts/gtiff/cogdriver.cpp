@@ -719,6 +719,7 @@ struct GDALCOGCreator final
     std::unique_ptr<GDALDataset> m_poVRTWithOrWithoutStats{};
     CPLString m_osTmpOverviewFilename{};
     CPLString m_osTmpMskOverviewFilename{};
+    CPLString m_osTmpCOGFilename{};
 
     ~GDALCOGCreator();
 
@@ -751,6 +752,10 @@ GDALCOGCreator::~GDALCOGCreator()
     {
         VSIUnlink(m_osTmpMskOverviewFilename);
     }
+    if (!m_osTmpCOGFilename.empty())
+    {
+        VSIUnlink(m_osTmpCOGFilename);
+    }
 }
 
 /************************************************************************/
@@ -1240,6 +1245,9 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
         aosOptions.SetNameValue(
             "MAX_Z_ERROR_OVERVIEW",
             CSLFetchNameValue(papszOptions, "MAX_Z_ERROR_OVERVIEW"));
+        aosOptions.SetNameValue(
+            "LERC_MAX_TILE_SIZE",
+            CSLFetchNameValue(papszOptions, "LERC_MAX_TILE_SIZE"));
     }
 
     if (STARTS_WITH_CI(osCompress, "JXL"))
@@ -1342,8 +1350,24 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
         GDALDriver::FromHandle(GDALGetDriverByName("GTiff"));
     if (!poGTiffDrv)
         return nullptr;
+
+    // If the target file system only supports sequential writing (typically
+    // /vsis3/ and other cloud storage, when
+    // CPL_VSIL_USE_TEMP_FILE_FOR_RANDOM_WRITE is not set), generate the
+    // final product in a local temporary file and upload it at the end,
+    // through the sequential (multipart upload) write handle of the target.
+    const bool bUploadAtEnd = !VSISupportsRandomWrite(pszFilename, true) &&
+                              VSISupportsSequentialWrite(pszFilename, false);
+    if (bUploadAtEnd)
+        m_osTmpCOGFilename = GetTmpFilename(pszFilename, "cog.tmp");
+    // Fraction of the progress reserved for the upload step
+    constexpr double UPLOAD_PROGRESS_RATIO = 0.1;
+    const double dfCreateCopyEndProgress =
+        bUploadAtEnd ? 1.0 - UPLOAD_PROGRESS_RATIO : 1.0;
+
     void *pScaledProgress = GDALCreateScaledProgress(
-        dfCurPixels / dfTotalPixelsToProcess, 1.0, pfnProgress, pProgressData);
+        dfCurPixels / dfTotalPixelsToProcess, dfCreateCopyEndProgress,
+        pfnProgress, pProgressData);
 
     CPLConfigOptionSetter oSetterInternalMask("GDAL_TIFF_INTERNAL_MASK", "YES",
                                               false);
@@ -1358,9 +1382,9 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
     CSLDestroy(papszSrcMDD);
 
     CPLDebug("COG", "Generating final product: start");
-    auto poRet =
-        poGTiffDrv->CreateCopy(pszFilename, poCurDS, false, aosOptions.List(),
-                               GDALScaledProgress, pScaledProgress);
+    auto poRet = poGTiffDrv->CreateCopy(
+        bUploadAtEnd ? m_osTmpCOGFilename.c_str() : pszFilename, poCurDS,
+        false, aosOptions.List(), GDALScaledProgress, pScaledProgress);
 
     GDALDestroyScaledProgress(pScaledProgress);
 
@@ -1368,6 +1392,51 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
         poRet->FlushCache(false);
 
     CPLDebug("COG", "Generating final product: end");
+
+    if (poRet && bUploadAtEnd)
+    {
+        if (poRet->Close() != CE_None)
+        {
+            delete poRet;
+            return nullptr;
+        }
+        delete poRet;
+
+        // Release the scratch space used by the temporary overview files
+        // before uploading.
+        if (!m_osTmpOverviewFilename.empty())
+        {
+            VSIUnlink(m_osTmpOverviewFilename);
+            m_osTmpOverviewFilename.clear();
+        }
+        if (!m_osTmpMskOverviewFilename.empty())
+        {
+            VSIUnlink(m_osTmpMskOverviewFilename);
+            m_osTmpMskOverviewFilename.clear();
+        }
+
+        CPLDebug("COG", "Uploading final product: start");
+        pScaledProgress = GDALCreateScaledProgress(
+            dfCreateCopyEndProgress, 1.0, pfnProgress, pProgressData);
+        const int nRet =
+            VSICopyFile(m_osTmpCOGFilename, pszFilename, nullptr,
+                        static_cast<vsi_l_offset>(-1), nullptr,
+                        GDALScaledProgress, pScaledProgress);
+        GDALDestroyScaledProgress(pScaledProgress);
+        CPLDebug("COG", "Uploading final product: end");
+
+        VSIUnlink(m_osTmpCOGFilename);
+        m_osTmpCOGFilename.clear();
+        if (nRet != 0)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot write %s", pszFilename);
+            return nullptr;
+        }
+
+        poRet = GDALDataset::Open(pszFilename,
+                                  GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR);
+    }
+
     return poRet;
 }
 
@@ -1504,7 +1573,10 @@ void GDALCOGDriver::InitializeCreationOptionList()
             "error for LERC compression' default='0'/>"
             "   <Option name='MAX_Z_ERROR_OVERVIEW' type='float' "
             "description='Maximum error for LERC compression in overviews' "
-            "default='0'/>";
+            "default='0'/>"
+            "   <Option name='LERC_MAX_TILE_SIZE' type='int' "
+            "description='Target maximum size in bytes of a LERC tile/strip, "
+            "reached by increasing the maximum error'/>";
     }
 #ifdef HAVE_JXL
     osOptions +=
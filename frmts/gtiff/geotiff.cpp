@@ -1398,7 +1398,10 @@ void GDALRegister_GTiff()
             "error for LERC compression' default='0'/>"
             "   <Option name='MAX_Z_ERROR_OVERVIEW' type='float' "
             "description='Maximum error for LERC compression in overviews' "
-            "default='0'/>";
+            "default='0'/>"
+            "   <Option name='LERC_MAX_TILE_SIZE' type='int' "
+            "description='Target maximum size in bytes of a LERC tile/strip, "
+            "reached by increasing the maximum error'/>";
     }
     if (bHasWebP)
     {
@@ -1469,6 +1472,9 @@ void GDALRegister_GTiff()
         "   </Option>"
         "   <Option name='SPARSE_OK' type='boolean' description='Should empty "
         "blocks be omitted on disk?' default='FALSE'/>"
+        "   <Option name='DEDUPLICATE_TILES' type='boolean' "
+        "description='Whether tiles with identical content should share the "
+        "same location on disk' default='FALSE'/>"
         "   <Option name='ALPHA' type='string-select' description='Mark first "
         "extrasample as being alpha'>"
         "       <Value>NON-PREMULTIPLIED</Value>"
@@ -1553,6 +1559,10 @@ void GDALRegister_GTiff()
     poDriver->SetMetadataItem(GDAL_DMD_MIMETYPE, "image/tiff");
     poDriver->SetMetadataItem(GDAL_DMD_EXTENSION, "tif");
     poDriver->SetMetadataItem(GDAL_DMD_EXTENSIONS, "tif tiff");
+    // Classic and BigTIFF headers, with either byte order marker
+    poDriver->SetMetadataItem(GDAL_DMD_MAGIC_BYTES,
+                              "49492A00 4949002A 49492B00 4949002B "
+                              "4D4D2A00 4D4D002A 4D4D2B00 4D4D002B");
     poDriver->SetMetadataItem(GDAL_DMD_CREATIONDATATYPES,
                               "Byte Int8 UInt16 Int16 UInt32 Int32 Float32 "
                               "Float64 CInt16 CInt32 CFloat32 CFloat64");
@@ -1600,6 +1610,7 @@ void GDALRegister_GTiff()
 #endif
 
     poDriver->SetMetadataItem(GDAL_DCAP_COORDINATE_EPOCH, "YES");
+    poDriver->SetMetadataItem(GDAL_DCAP_INDEPENDENT_BLOCK_READS, "YES");
 
     poDriver->pfnOpen = GTiffDataset::Open;
     poDriver->pfnCreate = GTiffDataset::Create;
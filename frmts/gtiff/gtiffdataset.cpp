@@ -121,8 +121,10 @@ GTiffDataset::GTiffDataset()
     //     sizeof(GTiffDataset)));
 
     const char *pszVirtualMemIO =
-        CPLGetConfigOption("GTIFF_VIRTUAL_MEM_IO", "NO");
-    if (EQUAL(pszVirtualMemIO, "IF_ENOUGH_RAM"))
+        CPLGetConfigOption("GTIFF_VIRTUAL_MEM_IO", "AUTO");
+    if (EQUAL(pszVirtualMemIO, "AUTO"))
+        m_eVirtualMemIOUsage = VirtualMemIOEnum::AUTO;
+    else if (EQUAL(pszVirtualMemIO, "IF_ENOUGH_RAM"))
         m_eVirtualMemIOUsage = VirtualMemIOEnum::IF_ENOUGH_RAM;
     else if (CPLTestBool(pszVirtualMemIO))
         m_eVirtualMemIOUsage = VirtualMemIOEnum::YES;
@@ -175,6 +177,10 @@ std::tuple<CPLErr, bool> GTiffDataset::Finalize()
     if (m_bIsFinalized)
         return std::tuple(CE_None, bDroppedRef);
 
+    // Make sure the write-behind thread of the block cache no longer
+    // accesses us.
+    DisableWriteBehindFlushing();
+
     CPLErr eErr = CE_None;
     Crystalize();
 
@@ -455,6 +461,11 @@ CPLErr GTiffDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                                GDALRasterIOExtraArg *psExtraArg)
 
 {
+    // Allow the dirty blocks to be written by the write-behind thread of the
+    // block cache, until the next FlushCache().
+    if (eRWFlag == GF_Write)
+        EnableWriteBehindFlushing();
+
     // Try to pass the request to the most appropriate overview dataset.
     if (nBufXSize < nXSize && nBufYSize < nYSize)
     {
@@ -579,6 +590,7 @@ CPLErr GTiffDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                 // buffer
                 const int nBlockId = poFirstBand->ComputeBlockId(
                     nXOff / m_nBlockXSize, nYOff / m_nBlockYSize);
+                DiscardPendingBlock(nBlockId);
                 return WriteEncodedTileOrStrip(nBlockId, pData,
                                                /* bPreserveDataBuffer= */ true);
             }
@@ -600,6 +612,8 @@ CPLErr GTiffDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
             const int nYBlockEnd = 1 + (nYOff + nYSize - 1) / m_nBlockYSize;
             const int nXBlockStart = nXOff / m_nBlockXSize;
             const int nXBlockEnd = 1 + (nXOff + nXSize - 1) / m_nBlockXSize;
+            const auto nBufDTSize = GDALGetDataTypeSizeBytes(eBufType);
+            std::vector<const void *> apSrcBands(nBands);
             for (int nYBlock = nYBlockStart; nYBlock < nYBlockEnd; ++nYBlock)
             {
                 const int nValidY = std::min(
@@ -617,7 +631,6 @@ CPLErr GTiffDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                                static_cast<size_t>(m_nBlockXSize) *
                                    m_nBlockYSize * nBands * nDTSize);
                     }
-                    const auto nBufDTSize = GDALGetDataTypeSizeBytes(eBufType);
                     const GByte *pabySrcData =
                         static_cast<const GByte *>(pData) +
                         static_cast<size_t>(nYBlock - nYBlockStart) *
@@ -641,6 +654,27 @@ CPLErr GTiffDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                                 static_cast<GPtrDiff_t>(nValidX) * nBands);
                         }
                     }
+                    else if (bOrderedBands && nPixelSpace == nBufDTSize)
+                    {
+                        // Input buffer is band sequential (or at least,
+                        // contiguous within each line of each band)
+                        for (int iY = 0; iY < nValidY; ++iY)
+                        {
+                            for (int iBand = 0; iBand < nBands; ++iBand)
+                            {
+                                apSrcBands[iBand] =
+                                    pabySrcData +
+                                    static_cast<size_t>(iY) * nLineSpace +
+                                    iBand * nBandSpace;
+                            }
+                            GDALInterleave(
+                                apSrcBands.data(), eBufType, nBands,
+                                m_pabyBlockBuf + static_cast<size_t>(iY) *
+                                                     m_nBlockXSize * nBands *
+                                                     nDTSize,
+                                eDataType, nValidX);
+                        }
+                    }
                     else
                     {
                         // "Random" spacing for input buffer
@@ -665,6 +699,7 @@ CPLErr GTiffDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
 
                     const int nBlockId =
                         poFirstBand->ComputeBlockId(nXBlock, nYBlock);
+                    DiscardPendingBlock(nBlockId);
                     if (WriteEncodedTileOrStrip(
                             nBlockId, m_pabyBlockBuf,
                             /* bPreserveDataBuffer= */ false) != CE_None)
@@ -1133,6 +1168,11 @@ void GTiffDataset::ScanDirectories()
                     m_papoOverviewDS[m_nOverviewCount - 1] = poODS;
                     poODS->m_poBaseDS = this;
                     poODS->m_bIsOverview = true;
+                    // Decompression of overview striles can also be done
+                    // in worker threads.
+                    if (m_poThreadPool &&
+                        poODS->IsMultiThreadedReadCompatible())
+                        poODS->m_poThreadPool = m_poThreadPool;
 
                     // Propagate a few compression related settings that are
                     // no preserved at the TIFF tag level, but may be set in
@@ -1146,6 +1186,7 @@ void GTiffDataset::ScanDirectories()
                     // m_dfMaxZError of the overview
                     poODS->m_dfMaxZError = m_dfMaxZErrorOverview;
                     poODS->m_dfMaxZErrorOverview = m_dfMaxZErrorOverview;
+                    poODS->m_nLercMaxTileSize = m_nLercMaxTileSize;
 #if HAVE_JXL
                     poODS->m_bJXLLossless = m_bJXLLossless;
                     poODS->m_fJXLDistance = m_fJXLDistance;
@@ -1201,6 +1242,9 @@ void GTiffDataset::ScanDirectories()
                     m_poMaskDS->m_bPromoteTo8Bits =
                         CPLTestBool(CPLGetConfigOption(
                             "GDAL_TIFF_INTERNAL_MASK_TO_8BIT", "YES"));
+                    if (m_poThreadPool &&
+                        m_poMaskDS->IsMultiThreadedReadCompatible())
+                        m_poMaskDS->m_poThreadPool = m_poThreadPool;
                 }
             }
 
@@ -1245,6 +1289,9 @@ void GTiffDataset::ScanDirectories()
                                 CPLTestBool(CPLGetConfigOption(
                                     "GDAL_TIFF_INTERNAL_MASK_TO_8BIT", "YES"));
                             poDS->m_poBaseDS = this;
+                            if (m_poThreadPool &&
+                                poDS->IsMultiThreadedReadCompatible())
+                                poDS->m_poThreadPool = m_poThreadPool;
                             break;
                         }
                     }
@@ -32,6 +32,7 @@
 
 #include "gdal_pam.h"
 
+#include <map>
 #include <mutex>
 #include <queue>
 
@@ -180,6 +181,8 @@ class GTiffDataset final : public GDALPamDataset
     double m_adfGeoTransform[6]{0, 1, 0, 0, 0, 1};
     double m_dfMaxZError = 0.0;
     double m_dfMaxZErrorOverview = 0.0;
+    // Target maximum size of a LERC strile, 0 if unset
+    GIntBig m_nLercMaxTileSize = 0;
     uint32_t m_anLercAddCompressionAndVersion[2]{0, 0};
 #if HAVE_JXL
     bool m_bJXLLossless = true;
@@ -243,7 +246,8 @@ class GTiffDataset final : public GDALPamDataset
     {
         NO,
         YES,
-        IF_ENOUGH_RAM
+        IF_ENOUGH_RAM,
+        AUTO
     };
 
     VirtualMemIOEnum m_eVirtualMemIOUsage = VirtualMemIOEnum::NO;
@@ -258,10 +262,31 @@ class GTiffDataset final : public GDALPamDataset
     std::queue<int> m_asQueueJobIdx{};  // queue of index of m_asCompressionJobs
                                         // being compressed in worker threads
 
+    // Used by DEDUPLICATE_TILES=YES: hash of the uncompressed content of
+    // tiles, for the first tile written with a given content.
+    using TileHash = std::pair<uint64_t, uint64_t>;
+    std::map<TileHash, int> m_oMapTileHashToTileIdx{};
+    std::map<int, TileHash> m_oMapTileIdxToTileHash{};
+
+    // Pixel-interleaved blocks that only received part of their bands and
+    // were never written to disk, kept in memory until their other bands
+    // arrive instead of being encoded, and then read back and re-encoded.
+    struct PendingBlock
+    {
+        std::vector<GByte> abyData{};
+        std::vector<bool> abBandsWritten{};
+    };
+
+    std::map<int, PendingBlock> m_oMapPendingBlocks{};
+    size_t m_nPendingBlocksSize = 0;
+    // Bands whose content has been set in m_pabyBlockBuf
+    std::vector<bool> m_abLoadedBlockBandsWritten{};
+
     bool m_bStreamingIn : 1;
     bool m_bStreamingOut : 1;
     bool m_bScanDeferred : 1;
     bool m_bSingleIFDOpened = false;
+    bool m_bDeduplicateTiles = false;
     bool m_bLoadedBlockDirty : 1;
     bool m_bWriteError : 1;
     bool m_bLookedForProjection : 1;
@@ -320,6 +345,15 @@ class GTiffDataset final : public GDALPamDataset
                     GPtrDiff_t nBlockReqSize);
     CPLErr LoadBlockBuf(int nBlockId, bool bReadFromDisk = true);
     CPLErr FlushBlockBuf();
+    bool StashLoadedBlockBuf();
+    CPLErr FlushPendingBlocks();
+    void DiscardPendingBlock(int nBlockId);
+
+    bool HasPendingBlock(int nBlockId) const
+    {
+        return !m_oMapPendingBlocks.empty() &&
+               m_oMapPendingBlocks.find(nBlockId) != m_oMapPendingBlocks.end();
+    }
 
     void LoadMDAreaOrPoint();
     void LookForProjection();
@@ -346,6 +380,8 @@ class GTiffDataset final : public GDALPamDataset
                           int bPreserveDataBuffer);
     bool WriteEncodedStrip(uint32_t strip, GByte *pabyData,
                            int bPreserveDataBuffer);
+    bool DeduplicateTile(int nTile, const GByte *pabyData, GPtrDiff_t cc);
+    void PrepareStrileRewrite(int nStripOrTile);
 
     template <typename T>
     void WriteDealWithLercAndNan(T *pBuffer, int nActualBlockWidth,
@@ -384,6 +384,8 @@ struct GTiffDecompressContext
     bool bUseDeinterleaveOptimBlockCache = false;
     bool bIsTiled = false;
     bool bTIFFIsBigEndian = false;
+    bool bOddBits = false;
+    bool bDirectDeflate = false;
     int nBlocksPerRow = 0;
 
     uint16_t nPredictor = 0;
@@ -423,6 +425,105 @@ static void CPL_STDCALL ThreadDecompressionFuncErrorHandler(
     psContext->aoErrors.emplace_back(eErr, eErrorNum, pszMsg);
 }
 
+/************************************************************************/
+/*                     GTiffUndoHorizontalPredictor()                   */
+/************************************************************************/
+
+template <class T>
+static void GTiffUndoHorizontalPredictor(GByte *pabyData, size_t nRows,
+                                         size_t nValuesPerRow, int nStride)
+{
+    T *panData = reinterpret_cast<T *>(pabyData);
+    for (size_t iRow = 0; iRow < nRows; ++iRow)
+    {
+        for (size_t i = nStride; i < nValuesPerRow; ++i)
+            panData[i] = static_cast<T>(panData[i] + panData[i - nStride]);
+        panData += nValuesPerRow;
+    }
+}
+
+/************************************************************************/
+/*                         GTiffInflateStrile()                         */
+/************************************************************************/
+
+// Decompresses a whole DEFLATE strile of nOutSize bytes, and undoes its
+// predictor, as libtiff would do. Returns false if the strile cannot be
+// decoded, in which case the caller should let libtiff do it, so that the
+// error is correctly reported.
+static bool GTiffInflateStrile(const GByte *pabyInput, size_t nInputSize,
+                               GByte *pabyOutput, size_t nOutSize,
+                               int nPredictor, int nDTSize,
+                               size_t nValuesPerRow, int nSamplesPerPixel)
+{
+    // Uses libdeflate single-shot decompression when available
+    size_t nOutBytes = 0;
+    if (CPLZLibInflate(pabyInput, nInputSize, pabyOutput, nOutSize,
+                       &nOutBytes) == nullptr ||
+        nOutBytes != nOutSize)
+    {
+        return false;
+    }
+
+    const size_t nRowSize = nValuesPerRow * nDTSize;
+    const size_t nRows = nOutSize / nRowSize;
+    if (nPredictor == PREDICTOR_HORIZONTAL)
+    {
+        switch (nDTSize)
+        {
+            case 1:
+                GTiffUndoHorizontalPredictor<uint8_t>(
+                    pabyOutput, nRows, nValuesPerRow, nSamplesPerPixel);
+                break;
+            case 2:
+                GTiffUndoHorizontalPredictor<uint16_t>(
+                    pabyOutput, nRows, nValuesPerRow, nSamplesPerPixel);
+                break;
+            case 4:
+                GTiffUndoHorizontalPredictor<uint32_t>(
+                    pabyOutput, nRows, nValuesPerRow, nSamplesPerPixel);
+                break;
+            case 8:
+                GTiffUndoHorizontalPredictor<uint64_t>(
+                    pabyOutput, nRows, nValuesPerRow, nSamplesPerPixel);
+                break;
+            default:
+                return false;
+        }
+    }
+    else if (nPredictor == PREDICTOR_FLOATINGPOINT)
+    {
+        // Each row stores the most significant bytes of all its values, then
+        // the next ones, etc., horizontally differenced byte per byte.
+        std::vector<GByte> abyRow(nRowSize);
+        for (size_t iRow = 0; iRow < nRows; ++iRow)
+        {
+            GByte *pabyRow = pabyOutput + iRow * nRowSize;
+            for (size_t i = nSamplesPerPixel; i < nRowSize; ++i)
+                pabyRow[i] = static_cast<GByte>(pabyRow[i] +
+                                                pabyRow[i - nSamplesPerPixel]);
+            memcpy(abyRow.data(), pabyRow, nRowSize);
+            for (size_t i = 0; i < nValuesPerRow; ++i)
+            {
+                for (int iByte = 0; iByte < nDTSize; ++iByte)
+                {
+#ifdef CPL_MSB
+                    pabyRow[i * nDTSize + iByte] =
+                        abyRow[iByte * nValuesPerRow + i];
+#else
+                    pabyRow[i * nDTSize + iByte] =
+                        abyRow[(nDTSize - iByte - 1) * nValuesPerRow + i];
+#endif
+                }
+            }
+        }
+    }
+    else if (nPredictor != PREDICTOR_NONE)
+    {
+        return false;
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                     ThreadDecompressionFunc()                        */
 /************************************************************************/
@@ -701,15 +802,6 @@ static void CPL_STDCALL ThreadDecompressionFuncErrorHandler(
 
     if (nAlreadyLoadedBlocks != nBandsToCache)
     {
-        // Generate a dummy in-memory TIFF file that has all the needed tags
-        // from the original file
-        CPLString osTmpFilename;
-        osTmpFilename.Printf("/vsimem/decompress_%p.tif", psJob);
-        VSILFILE *fpTmp = VSIFOpenL(osTmpFilename.c_str(), "wb+");
-        TIFF *hTIFFTmp =
-            VSI_TIFFOpen(osTmpFilename.c_str(),
-                         psContext->bTIFFIsBigEndian ? "wb+" : "wl+", fpTmp);
-        CPLAssert(hTIFFTmp != nullptr);
         const int nBlockYSize =
             (psContext->bIsTiled ||
              psJob->nYBlock < poDS->m_nBlocksPerColumn - 1)
@@ -717,54 +809,6 @@ static void CPL_STDCALL ThreadDecompressionFuncErrorHandler(
             : (poDS->nRasterYSize % poDS->m_nBlockYSize) == 0
                 ? poDS->m_nBlockYSize
                 : poDS->nRasterYSize % poDS->m_nBlockYSize;
-        TIFFSetField(hTIFFTmp, TIFFTAG_IMAGEWIDTH, poDS->m_nBlockXSize);
-        TIFFSetField(hTIFFTmp, TIFFTAG_IMAGELENGTH, nBlockYSize);
-        TIFFSetField(hTIFFTmp, TIFFTAG_BITSPERSAMPLE, poDS->m_nBitsPerSample);
-        TIFFSetField(hTIFFTmp, TIFFTAG_COMPRESSION, poDS->m_nCompression);
-        TIFFSetField(hTIFFTmp, TIFFTAG_PHOTOMETRIC, poDS->m_nPhotometric);
-        TIFFSetField(hTIFFTmp, TIFFTAG_SAMPLEFORMAT, poDS->m_nSampleFormat);
-        TIFFSetField(hTIFFTmp, TIFFTAG_SAMPLESPERPIXEL,
-                     poDS->m_nPlanarConfig == PLANARCONFIG_CONTIG
-                         ? poDS->m_nSamplesPerPixel
-                         : 1);
-        TIFFSetField(hTIFFTmp, TIFFTAG_ROWSPERSTRIP, nBlockYSize);
-        TIFFSetField(hTIFFTmp, TIFFTAG_PLANARCONFIG, poDS->m_nPlanarConfig);
-        if (psContext->nPredictor != PREDICTOR_NONE)
-            TIFFSetField(hTIFFTmp, TIFFTAG_PREDICTOR, psContext->nPredictor);
-        if (poDS->m_nCompression == COMPRESSION_LERC)
-        {
-            TIFFSetField(hTIFFTmp, TIFFTAG_LERC_PARAMETERS, 2,
-                         poDS->m_anLercAddCompressionAndVersion);
-        }
-        else if (poDS->m_nCompression == COMPRESSION_JPEG)
-        {
-            if (psContext->pJPEGTable)
-            {
-                TIFFSetField(hTIFFTmp, TIFFTAG_JPEGTABLES,
-                             psContext->nJPEGTableSize, psContext->pJPEGTable);
-            }
-            if (poDS->m_nPhotometric == PHOTOMETRIC_YCBCR)
-            {
-                TIFFSetField(hTIFFTmp, TIFFTAG_YCBCRSUBSAMPLING,
-                             psContext->nYCrbCrSubSampling0,
-                             psContext->nYCrbCrSubSampling1);
-            }
-        }
-        if (psContext->pExtraSamples)
-        {
-            TIFFSetField(hTIFFTmp, TIFFTAG_EXTRASAMPLES,
-                         psContext->nExtraSampleCount,
-                         psContext->pExtraSamples);
-        }
-        TIFFWriteCheck(hTIFFTmp, FALSE, "ThreadDecompressionFunc");
-        TIFFWriteDirectory(hTIFFTmp);
-        XTIFFClose(hTIFFTmp);
-
-        // Re-open file
-        hTIFFTmp = VSI_TIFFOpen(osTmpFilename.c_str(), "r", fpTmp);
-        CPLAssert(hTIFFTmp != nullptr);
-        poDS->RestoreVolatileParameters(hTIFFTmp);
-
         bool bRet = true;
         // Request m_nBlockYSize line in the block, except on the bottom-most
         // tile/strip.
@@ -775,28 +819,125 @@ static void CPL_STDCALL ThreadDecompressionFuncErrorHandler(
                 ? poDS->m_nBlockYSize
                 : poDS->nRasterYSize % poDS->m_nBlockYSize;
 
-        const size_t nReqSize = static_cast<size_t>(poDS->m_nBlockXSize) *
-                                nBlockReqYSize * nBandsPerStrile * nDTSize;
+        // In the odd bits case, values are packed, with each line starting
+        // on a byte boundary.
+        const size_t nReqSize =
+            psContext->bOddBits
+                ? DIV_ROUND_UP(static_cast<size_t>(poDS->m_nBlockXSize) *
+                                   nBandsPerStrile * poDS->m_nBitsPerSample,
+                               8) *
+                      nBlockReqYSize
+                : static_cast<size_t>(poDS->m_nBlockXSize) * nBlockReqYSize *
+                      nBandsPerStrile * nDTSize;
+        const bool bUseTmpOutput = psContext->bSkipBlockCache ||
+                                   nBandsPerStrile > 1 || psContext->bOddBits;
+
+        // Size of the decompressed strile, that can be larger than nReqSize for
+        // the bottom-most tile
+        const size_t nDecodedSize = static_cast<size_t>(poDS->m_nBlockXSize) *
+                                    nBlockYSize * nBandsPerStrile * nDTSize;
+
+        // For DEFLATE, directly inflate the strile in a single shot (with
+        // libdeflate when available) and undo the predictor, rather than going
+        // through a temporary TIFF file and libtiff.
+        const bool bDirectDeflate =
+            psContext->bDirectDeflate && nDecodedSize >= nReqSize;
 
         GByte *pabyOutput;
         std::vector<GByte> abyOutput;
+        bool bDecoded = false;
         if (poDS->m_nCompression == COMPRESSION_NONE &&
             !TIFFIsByteSwapped(poDS->m_hTIFF) && abyInput.size() >= nReqSize &&
-            (psContext->bSkipBlockCache || nBandsPerStrile > 1))
+            bUseTmpOutput)
         {
             pabyOutput = abyInput.data();
+            bDecoded = true;
         }
         else
         {
-            if (psContext->bSkipBlockCache || nBandsPerStrile > 1)
+            if (bUseTmpOutput)
             {
-                abyOutput.resize(nReqSize);
+                abyOutput.resize(bDirectDeflate ? nDecodedSize : nReqSize);
                 pabyOutput = abyOutput.data();
             }
             else
             {
                 pabyOutput = static_cast<GByte *>(apoBlocks[0]->GetDataRef());
             }
+            if (bDirectDeflate)
+            {
+                bDecoded = GTiffInflateStrile(
+                    abyInput.data(), abyInput.size(), pabyOutput, nDecodedSize,
+                    psContext->nPredictor, nDTSize,
+                    static_cast<size_t>(poDS->m_nBlockXSize) * nBandsPerStrile,
+                    nBandsPerStrile);
+            }
+        }
+
+        if (!bDecoded)
+        {
+            // Generate a dummy in-memory TIFF file that has all the needed tags
+            // from the original file
+            CPLString osTmpFilename;
+            osTmpFilename.Printf("/vsimem/decompress_%p.tif", psJob);
+            VSILFILE *fpTmp = VSIFOpenL(osTmpFilename.c_str(), "wb+");
+            TIFF *hTIFFTmp = VSI_TIFFOpen(
+                osTmpFilename.c_str(),
+                psContext->bTIFFIsBigEndian ? "wb+" : "wl+", fpTmp);
+            CPLAssert(hTIFFTmp != nullptr);
+            TIFFSetField(hTIFFTmp, TIFFTAG_IMAGEWIDTH, poDS->m_nBlockXSize);
+            TIFFSetField(hTIFFTmp, TIFFTAG_IMAGELENGTH, nBlockYSize);
+            TIFFSetField(hTIFFTmp, TIFFTAG_BITSPERSAMPLE,
+                         poDS->m_nBitsPerSample);
+            TIFFSetField(hTIFFTmp, TIFFTAG_COMPRESSION, poDS->m_nCompression);
+            TIFFSetField(hTIFFTmp, TIFFTAG_PHOTOMETRIC, poDS->m_nPhotometric);
+            TIFFSetField(hTIFFTmp, TIFFTAG_SAMPLEFORMAT,
+                         poDS->m_nSampleFormat);
+            TIFFSetField(hTIFFTmp, TIFFTAG_SAMPLESPERPIXEL,
+                         poDS->m_nPlanarConfig == PLANARCONFIG_CONTIG
+                             ? poDS->m_nSamplesPerPixel
+                             : 1);
+            TIFFSetField(hTIFFTmp, TIFFTAG_ROWSPERSTRIP, nBlockYSize);
+            TIFFSetField(hTIFFTmp, TIFFTAG_PLANARCONFIG,
+                         poDS->m_nPlanarConfig);
+            if (psContext->nPredictor != PREDICTOR_NONE)
+                TIFFSetField(hTIFFTmp, TIFFTAG_PREDICTOR,
+                             psContext->nPredictor);
+            if (poDS->m_nCompression == COMPRESSION_LERC)
+            {
+                TIFFSetField(hTIFFTmp, TIFFTAG_LERC_PARAMETERS, 2,
+                             poDS->m_anLercAddCompressionAndVersion);
+            }
+            else if (poDS->m_nCompression == COMPRESSION_JPEG)
+            {
+                if (psContext->pJPEGTable)
+                {
+                    TIFFSetField(hTIFFTmp, TIFFTAG_JPEGTABLES,
+                                 psContext->nJPEGTableSize,
+                                 psContext->pJPEGTable);
+                }
+                if (poDS->m_nPhotometric == PHOTOMETRIC_YCBCR)
+                {
+                    TIFFSetField(hTIFFTmp, TIFFTAG_YCBCRSUBSAMPLING,
+                                 psContext->nYCrbCrSubSampling0,
+                                 psContext->nYCrbCrSubSampling1);
+                }
+            }
+            if (psContext->pExtraSamples)
+            {
+                TIFFSetField(hTIFFTmp, TIFFTAG_EXTRASAMPLES,
+                             psContext->nExtraSampleCount,
+                             psContext->pExtraSamples);
+            }
+            TIFFWriteCheck(hTIFFTmp, FALSE, "ThreadDecompressionFunc");
+            TIFFWriteDirectory(hTIFFTmp);
+            XTIFFClose(hTIFFTmp);
+
+            // Re-open file
+            hTIFFTmp = VSI_TIFFOpen(osTmpFilename.c_str(), "r", fpTmp);
+            CPLAssert(hTIFFTmp != nullptr);
+            poDS->RestoreVolatileParameters(hTIFFTmp);
+
             if (!TIFFReadFromUserBuffer(hTIFFTmp, 0, abyInput.data(),
                                         abyInput.size(), pabyOutput,
                                         nReqSize) &&
@@ -804,10 +945,10 @@ static void CPL_STDCALL ThreadDecompressionFuncErrorHandler(
             {
                 bRet = false;
             }
+            XTIFFClose(hTIFFTmp);
+            CPL_IGNORE_RET_VAL(VSIFCloseL(fpTmp));
+            VSIUnlink(osTmpFilename.c_str());
         }
-        XTIFFClose(hTIFFTmp);
-        CPL_IGNORE_RET_VAL(VSIFCloseL(fpTmp));
-        VSIUnlink(osTmpFilename.c_str());
 
         if (!bRet)
         {
@@ -816,7 +957,26 @@ static void CPL_STDCALL ThreadDecompressionFuncErrorHandler(
             return;
         }
 
-        if (!psContext->bSkipBlockCache && nBandsPerStrile > 1)
+        if (psContext->bOddBits)
+        {
+            // Expand packed values into cached blocks
+            for (int i = 0; i < nBandsToCache; ++i)
+            {
+                if (!abAlreadyLoadedBlocks[i])
+                {
+                    const int iBand =
+                        psContext->bCacheAllBands ? i + 1
+                        : poDS->m_nPlanarConfig == PLANARCONFIG_CONTIG
+                            ? psContext->panBandMap[i]
+                            : psJob->iSrcBandIdxSeparate + 1;
+                    GTiffOddBitsBand::UnpackBlock(
+                        poDS, iBand, psContext->eDT, poDS->m_nBlockXSize,
+                        nBlockReqYSize, pabyOutput,
+                        apoBlocks[i]->GetDataRef());
+                }
+            }
+        }
+        else if (!psContext->bSkipBlockCache && nBandsPerStrile > 1)
         {
             // Copy pixel-interleaved all-band buffer to cached blocks
 
@@ -970,7 +1130,7 @@ static void CPL_STDCALL ThreadDecompressionFuncErrorHandler(
 bool GTiffDataset::IsMultiThreadedReadCompatible() const
 {
     return cpl::down_cast<GTiffRasterBand *>(papoBands[0])
-               ->IsBaseGTiffClass() &&
+               ->IsMultiThreadedReadCompatible() &&
            !m_bStreamingIn && !m_bStreamingOut &&
            (m_nCompression == COMPRESSION_NONE ||
             m_nCompression == COMPRESSION_ADOBE_DEFLATE ||
@@ -1143,6 +1303,19 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
         }
     }
 
+    // Odd bits bands (that is the only other class accepted by
+    // IsMultiThreadedReadCompatible()) need their packed values to be
+    // expanded, which is done in the blocks of the block cache.
+    sContext.bOddBits =
+        !cpl::down_cast<GTiffRasterBand *>(papoBands[0])->IsBaseGTiffClass();
+    if (sContext.bOddBits)
+    {
+        sContext.bSkipBlockCache = false;
+        sContext.bUseBIPOptim = false;
+        sContext.bUseDeinterleaveOptimNoBlockCache = false;
+        sContext.bUseDeinterleaveOptimBlockCache = false;
+    }
+
     if (eAccess == GA_Update)
     {
         std::vector<int> anBandsToCheck;
@@ -1176,11 +1349,13 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
                 {
                     for (const int iBand : anBandsToCheck)
                     {
-                        if (m_nLoadedBlock >= 0 && m_bLoadedBlockDirty &&
+                        const int nBlockId =
                             cpl::down_cast<GTiffRasterBand *>(papoBands[iBand])
-                                    ->ComputeBlockId(nBlockXStart + x,
-                                                     nBlockYStart + y) ==
-                                m_nLoadedBlock)
+                                ->ComputeBlockId(nBlockXStart + x,
+                                                 nBlockYStart + y);
+                        if ((m_nLoadedBlock >= 0 && m_bLoadedBlockDirty &&
+                             nBlockId == m_nLoadedBlock) ||
+                            HasPendingBlock(nBlockId))
                         {
                             bUseBaseImplementation = true;
                             goto after_loop;
@@ -1250,6 +1425,26 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
     {
         TIFFGetField(m_hTIFF, TIFFTAG_PREDICTOR, &sContext.nPredictor);
     }
+
+    // DEFLATE striles can be decoded without libtiff when their samples are
+    // whole bytes, and in native byte order, except for the floating point
+    // predictor which is independent of the byte order.
+    if ((m_nCompression == COMPRESSION_ADOBE_DEFLATE ||
+         m_nCompression == COMPRESSION_DEFLATE) &&
+        !sContext.bOddBits && !GDALDataTypeIsComplex(sContext.eDT) &&
+        m_nBitsPerSample == GDALGetDataTypeSizeBits(sContext.eDT))
+    {
+        if (sContext.nPredictor == PREDICTOR_FLOATINGPOINT)
+        {
+            sContext.bDirectDeflate = m_nSampleFormat == SAMPLEFORMAT_IEEEFP;
+        }
+        else if (sContext.nPredictor == PREDICTOR_NONE ||
+                 sContext.nPredictor == PREDICTOR_HORIZONTAL)
+        {
+            sContext.bDirectDeflate =
+                m_nBitsPerSample == 8 || !TIFFIsByteSwapped(m_hTIFF);
+        }
+    }
     else if (m_nCompression == COMPRESSION_JPEG)
     {
         TIFFGetField(m_hTIFF, TIFFTAG_JPEGTABLES, &sContext.nJPEGTableSize,
@@ -1569,6 +1764,33 @@ int GTiffDataset::VirtualMemIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
         return -1;
     }
 
+    if (m_eVirtualMemIOUsage == VirtualMemIOEnum::AUTO)
+    {
+#if SIZEOF_VOIDP == 4
+        // Mapping whole files would exhaust the address space.
+        m_eVirtualMemIOUsage = VirtualMemIOEnum::NO;
+        return -1;
+#else
+        // Only take that path for requests that would otherwise evict a
+        // significant part of the block cache with blocks that are cheap
+        // to re-read, and when the mapping is backed by a real file.
+        if (psExtraArg != nullptr && psExtraArg->pfnProgress != nullptr &&
+            psExtraArg->pfnProgress != GDALDummyProgress)
+        {
+            return -1;
+        }
+        const GIntBig nReqBytes = static_cast<GIntBig>(nXSize) * nYSize *
+                                  nBandCount * (nDTSizeBits / 8);
+        if (nReqBytes < GDALGetCacheMax64() / 4)
+            return -1;
+        if (STARTS_WITH(m_pszFilename, "/vsimem/"))
+        {
+            m_eVirtualMemIOUsage = VirtualMemIOEnum::NO;
+            return -1;
+        }
+#endif
+    }
+
     size_t nMappingSize = 0;
     GByte *pabySrcData = nullptr;
     if (STARTS_WITH(m_pszFilename, "/vsimem/"))
@@ -1617,7 +1839,8 @@ int GTiffDataset::VirtualMemIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
             m_eVirtualMemIOUsage = VirtualMemIOEnum::NO;
             return -1;
         }
-        m_eVirtualMemIOUsage = VirtualMemIOEnum::YES;
+        if (m_eVirtualMemIOUsage != VirtualMemIOEnum::AUTO)
+            m_eVirtualMemIOUsage = VirtualMemIOEnum::YES;
     }
 
     if (m_psVirtualMemIOMapping)
@@ -3288,7 +3511,8 @@ CPLErr GTiffDataset::LoadBlockBuf(int nBlockId, bool bReadFromDisk)
     /* -------------------------------------------------------------------- */
     /*      If we have a dirty loaded block, flush it out first.            */
     /* -------------------------------------------------------------------- */
-    if (m_nLoadedBlock != -1 && m_bLoadedBlockDirty)
+    if (m_nLoadedBlock != -1 && m_bLoadedBlockDirty &&
+        !StashLoadedBlockBuf())
     {
         const CPLErr eErr = FlushBlockBuf();
         if (eErr != CE_None)
@@ -3323,6 +3547,28 @@ CPLErr GTiffDataset::LoadBlockBuf(int nBlockId, bool bReadFromDisk)
     if (m_nLoadedBlock == nBlockId)
         return CE_None;
 
+    m_abLoadedBlockBandsWritten.assign(nBands, false);
+
+    /* -------------------------------------------------------------------- */
+    /*      Restore a partially written block that was kept in memory.      */
+    /* -------------------------------------------------------------------- */
+    const auto oIterPending = m_oMapPendingBlocks.find(nBlockId);
+    if (oIterPending != m_oMapPendingBlocks.end())
+    {
+        if (bReadFromDisk)
+        {
+            memcpy(m_pabyBlockBuf, oIterPending->second.abyData.data(),
+                   nBlockBufSize);
+            m_abLoadedBlockBandsWritten =
+                std::move(oIterPending->second.abBandsWritten);
+            m_bLoadedBlockDirty = true;
+        }
+        m_nPendingBlocksSize -= oIterPending->second.abyData.size();
+        m_oMapPendingBlocks.erase(oIterPending);
+        m_nLoadedBlock = nBlockId;
+        return CE_None;
+    }
+
     /* -------------------------------------------------------------------- */
     /*  When called from ::IWriteBlock in separate cases (or in single band */
     /*  geotiffs), the ::IWriteBlock will override the content of the buffer*/
@@ -3342,6 +3588,7 @@ CPLErr GTiffDataset::LoadBlockBuf(int nBlockId, bool bReadFromDisk)
         m_bDontReloadFirstBlock = false;
         memset(m_pabyBlockBuf, 0, nBlockBufSize);
         m_nLoadedBlock = nBlockId;
+        m_abLoadedBlockBandsWritten.assign(nBands, true);
         return CE_None;
     }
 
@@ -3396,6 +3643,7 @@ CPLErr GTiffDataset::LoadBlockBuf(int nBlockId, bool bReadFromDisk)
 
     if (eErr == CE_None)
     {
+        m_abLoadedBlockBandsWritten.assign(nBands, true);
         if (m_nCompression == COMPRESSION_WEBP && TIFFIsTiled(m_hTIFF) &&
             nBlockYOff * m_nBlockYSize > nRasterYSize - m_nBlockYSize)
         {
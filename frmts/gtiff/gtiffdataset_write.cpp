@@ -114,6 +114,13 @@ static double GTiffGetLERCMaxZErrorOverview(CSLConstList papszOptions)
         CSLFetchNameValueDef(papszOptions, "MAX_Z_ERROR", "0.0")));
 }
 
+static GIntBig GTiffGetLERCMaxTileSize(CSLConstList papszOptions)
+{
+    return std::max<GIntBig>(
+        0, CPLAtoGIntBig(
+               CSLFetchNameValueDef(papszOptions, "LERC_MAX_TILE_SIZE", "0")));
+}
+
 #if HAVE_JXL
 static bool GTiffGetJXLLossless(CSLConstList papszOptions)
 {
@@ -308,7 +315,8 @@ CPLErr GTiffDataset::FillEmptyTiles()
     /*      w.r.t TIFF spec ... as a sparse file w.r.t filesystem, ie by    */
     /*      seeking to end of file instead of writing zero blocks.          */
     /* -------------------------------------------------------------------- */
-    else if (m_nCompression == COMPRESSION_NONE && (m_nBitsPerSample % 8) == 0)
+    else if (m_nCompression == COMPRESSION_NONE &&
+             (m_nBitsPerSample % 8) == 0 && !m_bDeduplicateTiles)
     {
         CPLErr eErr = CE_None;
         // Only use libtiff to write the first sparse block to ensure that it
@@ -387,6 +395,8 @@ CPLErr GTiffDataset::FillEmptyTiles()
 
     /* -------------------------------------------------------------------- */
     /*      Check all blocks, writing out data for uninitialized blocks.    */
+    /*      With DEDUPLICATE_TILES=YES, they will all share the location    */
+    /*      of the first one.                                               */
     /* -------------------------------------------------------------------- */
 
     GByte *pabyRaw = nullptr;
@@ -396,9 +406,15 @@ CPLErr GTiffDataset::FillEmptyTiles()
     {
         if (panByteCounts[iBlock] == 0)
         {
-            if (pabyRaw == nullptr)
+            if (pabyRaw == nullptr || m_bDeduplicateTiles)
             {
-                if (WriteEncodedTileOrStrip(iBlock, pabyData, FALSE) != CE_None)
+                const bool bWriteEmptyTilesBak = m_bWriteEmptyTiles;
+                if (m_bDeduplicateTiles)
+                    m_bWriteEmptyTiles = true;
+                const bool bOK = WriteEncodedTileOrStrip(iBlock, pabyData,
+                                                         FALSE) == CE_None;
+                m_bWriteEmptyTiles = bWriteEmptyTilesBak;
+                if (!bOK)
                 {
                     eErr = CE_Failure;
                     break;
@@ -410,7 +426,7 @@ CPLErr GTiffDataset::FillEmptyTiles()
 
                 // When using compression, get back the compressed block
                 // so we can use the raw API to write it faster.
-                if (m_nCompression != COMPRESSION_NONE)
+                if (m_nCompression != COMPRESSION_NONE && !m_bDeduplicateTiles)
                 {
                     pabyRaw = static_cast<GByte *>(
                         VSI_MALLOC_VERBOSE(static_cast<size_t>(nRawSize)));
@@ -765,15 +781,108 @@ bool GTiffDataset::WriteEncodedTile(uint32_t tile, GByte *pabyData,
         return true;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Reuse the location of an identical tile already written ?       */
+    /* -------------------------------------------------------------------- */
+    if (m_bDeduplicateTiles && DeduplicateTile(tile, pabyData, cc))
+        return true;
+
     /* -------------------------------------------------------------------- */
     /*      Should we do compression in a worker thread ?                   */
     /* -------------------------------------------------------------------- */
     if (SubmitCompressionJob(tile, pabyData, cc, m_nBlockYSize))
         return true;
 
+    if (m_bDeduplicateTiles)
+        PrepareStrileRewrite(tile);
+
     return TIFFWriteEncodedTile(m_hTIFF, tile, pabyData, cc) == cc;
 }
 
+/************************************************************************/
+/*                          DeduplicateTile()                           */
+/************************************************************************/
+
+// Returns true if a tile with the same uncompressed content has already
+// been written, in which case the offset and byte count of tile nTile are
+// made to point to it, and nothing needs to be written.
+// Otherwise records the hash of the content of nTile and returns false.
+
+bool GTiffDataset::DeduplicateTile(int nTile, const GByte *pabyData,
+                                   GPtrDiff_t cc)
+{
+    struct CPLMD5Context context;
+    CPLMD5Init(&context);
+    CPLMD5Update(&context, pabyData, static_cast<size_t>(cc));
+    GByte abyDigest[16];
+    CPLMD5Final(abyDigest, &context);
+    TileHash oHash;
+    memcpy(&oHash.first, abyDigest, sizeof(oHash.first));
+    memcpy(&oHash.second, abyDigest + sizeof(oHash.first),
+           sizeof(oHash.second));
+
+    // The tile is going to be rewritten: it can no longer be used as the
+    // reference for its previous content.
+    const auto oIterPrevHash = m_oMapTileIdxToTileHash.find(nTile);
+    if (oIterPrevHash != m_oMapTileIdxToTileHash.end())
+    {
+        if (oIterPrevHash->second == oHash && IsBlockAvailable(nTile))
+            return true;
+        m_oMapTileHashToTileIdx.erase(oIterPrevHash->second);
+        m_oMapTileIdxToTileHash.erase(oIterPrevHash);
+    }
+
+    const auto oIter = m_oMapTileHashToTileIdx.find(oHash);
+    if (oIter != m_oMapTileHashToTileIdx.end())
+    {
+        const int nSrcTile = oIter->second;
+        // Make sure the reference tile has reached the file
+        WaitCompletionForBlock(nSrcTile);
+
+        toff_t *panOffsets = nullptr;
+        toff_t *panByteCounts = nullptr;
+        if (TIFFGetField(m_hTIFF, TIFFTAG_TILEOFFSETS, &panOffsets) &&
+            TIFFGetField(m_hTIFF, TIFFTAG_TILEBYTECOUNTS, &panByteCounts) &&
+            panOffsets != nullptr && panByteCounts != nullptr &&
+            panOffsets[nSrcTile] != 0 && panByteCounts[nSrcTile] != 0)
+        {
+            panOffsets[nTile] = panOffsets[nSrcTile];
+            panByteCounts[nTile] = panByteCounts[nSrcTile];
+            // Make sure the modified TileOffsets and TileByteCounts arrays
+            // get serialized.
+            m_bNeedsRewrite = true;
+            return true;
+        }
+        m_oMapTileHashToTileIdx.erase(oIter);
+    }
+
+    m_oMapTileHashToTileIdx[oHash] = nTile;
+    m_oMapTileIdxToTileHash[nTile] = oHash;
+    return false;
+}
+
+/************************************************************************/
+/*                        PrepareStrileRewrite()                        */
+/************************************************************************/
+
+// When DEDUPLICATE_TILES=YES, the location of a tile in the file may be
+// shared by several tiles, so it must never be rewritten in place.
+// Resetting the byte count forces libtiff to write the new content at the
+// end of the file.
+
+void GTiffDataset::PrepareStrileRewrite(int nStripOrTile)
+{
+    toff_t *panOffsets = nullptr;
+    toff_t *panByteCounts = nullptr;
+    if (TIFFGetField(m_hTIFF, TIFFTAG_TILEOFFSETS, &panOffsets) &&
+        TIFFGetField(m_hTIFF, TIFFTAG_TILEBYTECOUNTS, &panByteCounts) &&
+        panOffsets != nullptr && panByteCounts != nullptr &&
+        panOffsets[nStripOrTile] != 0)
+    {
+        panByteCounts[nStripOrTile] = 0;
+    }
+}
+
 /************************************************************************/
 /*                        WriteEncodedStrip()                           */
 /************************************************************************/
@@ -1007,7 +1116,7 @@ void GTiffDataset::ThreadCompressionFunc(void *pData)
                                      psJob->nBufferSize) == psJob->nBufferSize;
 
     toff_t nOffset = 0;
-    if (bOK)
+    const auto GetOffsetAndSize = [hTIFFTmp, psJob, &nOffset]()
     {
         toff_t *panOffsets = nullptr;
         toff_t *panByteCounts = nullptr;
@@ -1017,8 +1126,37 @@ void GTiffDataset::ThreadCompressionFunc(void *pData)
         nOffset = panOffsets[0];
         psJob->nCompressedBufferSize =
             static_cast<GPtrDiff_t>(panByteCounts[0]);
+    };
+    if (bOK)
+    {
+        GetOffsetAndSize();
+
+        // Re-encode the LERC striles larger than the target size with a
+        // doubled maximum error, a bounded number of times. Integer values
+        // are still exactly encoded with a maximum error of 0.5.
+        if (poDS->m_nCompression == COMPRESSION_LERC &&
+            poDS->m_nLercMaxTileSize > 0)
+        {
+            double dfMaxZError = poDS->m_dfMaxZError;
+            if (poDS->m_nSampleFormat != SAMPLEFORMAT_IEEEFP)
+                dfMaxZError = std::max(dfMaxZError, 0.5);
+            constexpr int MAX_ITERATIONS = 10;
+            for (int i = 0;
+                 i < MAX_ITERATIONS && bOK && dfMaxZError > 0 &&
+                 psJob->nCompressedBufferSize > poDS->m_nLercMaxTileSize;
+                 ++i)
+            {
+                dfMaxZError *= 2;
+                TIFFSetField(hTIFFTmp, TIFFTAG_LERC_MAXZERROR, dfMaxZError);
+                bOK = TIFFWriteEncodedStrip(hTIFFTmp, 0, psJob->pabyBuffer,
+                                            psJob->nBufferSize) ==
+                      psJob->nBufferSize;
+                if (bOK)
+                    GetOffsetAndSize();
+            }
+        }
     }
-    else
+    if (!bOK)
     {
         CPLError(CE_Failure, CPLE_AppDefined,
                  "Error when compressing strip/tile %d", psJob->nStripOrTile);
@@ -1071,6 +1209,9 @@ void GTiffDataset::WriteRawStripOrTile(int nStripOrTile,
     CPLDebug("GTIFF", "Writing raw strip/tile %d, size " CPL_FRMT_GUIB,
              nStripOrTile, static_cast<GUIntBig>(nCompressedBufferSize));
 #endif
+    if (m_bDeduplicateTiles)
+        PrepareStrileRewrite(nStripOrTile);
+
     toff_t *panOffsets = nullptr;
     toff_t *panByteCounts = nullptr;
     bool bWriteAtEnd = true;
@@ -1368,8 +1509,10 @@ bool GTiffDataset::SubmitCompressionJob(int nStripOrTile, GByte *pabyData,
                                 m_nCompression == COMPRESSION_WEBP ||
                                 m_nCompression == COMPRESSION_JPEG))
     {
+        // LERC_MAX_TILE_SIZE requires re-encoding the striles in memory
         if (m_bBlockOrderRowMajor || m_bLeaderSizeAsUInt4 ||
-            m_bTrailerRepeatedLast4BytesRepeated)
+            m_bTrailerRepeatedLast4BytesRepeated ||
+            (m_nCompression == COMPRESSION_LERC && m_nLercMaxTileSize > 0))
         {
             GTiffCompressionJob sJob;
             memset(&sJob, 0, sizeof(sJob));
@@ -1994,6 +2137,8 @@ CPLErr GTiffDataset::FlushBlockBuf()
         return CE_None;
 
     m_bLoadedBlockDirty = false;
+    // All bands are now on disk, even the ones never written
+    m_abLoadedBlockBandsWritten.assign(nBands, true);
 
     const CPLErr eErr =
         WriteEncodedTileOrStrip(m_nLoadedBlock, m_pabyBlockBuf, true);
@@ -2007,6 +2152,104 @@ CPLErr GTiffDataset::FlushBlockBuf()
     return eErr;
 }
 
+/************************************************************************/
+/*                        StashLoadedBlockBuf()                         */
+/************************************************************************/
+
+// Called when the dirty loaded block must be evicted from m_pabyBlockBuf.
+// If it is a pixel-interleaved block for which only some bands have been
+// written, and it is not yet on disk, keep it in memory rather than encoding
+// it, so that it does not need to be decoded and re-encoded when the other
+// bands are written. The amount of memory used for that is bounded to a
+// fraction of the block cache size.
+// Returns true if the block has been stashed.
+bool GTiffDataset::StashLoadedBlockBuf()
+{
+    if (m_nLoadedBlock < 0 || !m_bLoadedBlockDirty || nBands == 1 ||
+        m_nPlanarConfig != PLANARCONFIG_CONTIG || m_bStreamingOut ||
+        static_cast<int>(m_abLoadedBlockBandsWritten.size()) != nBands)
+    {
+        return false;
+    }
+
+    const auto nWrittenBands =
+        std::count(m_abLoadedBlockBandsWritten.begin(),
+                   m_abLoadedBlockBandsWritten.end(), true);
+    if (nWrittenBands == 0 || nWrittenBands == nBands)
+        return false;
+
+    const size_t nBlockBufSize = static_cast<size_t>(
+        TIFFIsTiled(m_hTIFF) ? TIFFTileSize(m_hTIFF) : TIFFStripSize(m_hTIFF));
+    if (static_cast<GIntBig>(m_nPendingBlocksSize + nBlockBufSize) >
+        GDALGetCacheMax64() / 4)
+    {
+        return false;
+    }
+    if (IsBlockAvailable(m_nLoadedBlock))
+        return false;
+
+    PendingBlock oBlock;
+    try
+    {
+        oBlock.abyData.assign(m_pabyBlockBuf, m_pabyBlockBuf + nBlockBufSize);
+    }
+    catch (const std::exception &)
+    {
+        return false;
+    }
+    oBlock.abBandsWritten = std::move(m_abLoadedBlockBandsWritten);
+    m_oMapPendingBlocks[m_nLoadedBlock] = std::move(oBlock);
+    m_nPendingBlocksSize += nBlockBufSize;
+
+    m_nLoadedBlock = -1;
+    m_bLoadedBlockDirty = false;
+    m_abLoadedBlockBandsWritten.clear();
+    return true;
+}
+
+/************************************************************************/
+/*                         FlushPendingBlocks()                         */
+/************************************************************************/
+
+// Encodes the blocks stashed by StashLoadedBlockBuf(), with the bands that
+// have never been written left to zero.
+CPLErr GTiffDataset::FlushPendingBlocks()
+{
+    CPLErr eErr = CE_None;
+    auto oMapPendingBlocks = std::move(m_oMapPendingBlocks);
+    m_oMapPendingBlocks.clear();
+    m_nPendingBlocksSize = 0;
+    for (auto &[nBlockId, oBlock] : oMapPendingBlocks)
+    {
+        if (WriteEncodedTileOrStrip(nBlockId, oBlock.abyData.data(),
+                                    /* bPreserveDataBuffer = */ false) !=
+            CE_None)
+        {
+            ReportError(CE_Failure, CPLE_AppDefined,
+                        "WriteEncodedTile/Strip() failed.");
+            m_bWriteError = true;
+            eErr = CE_Failure;
+        }
+    }
+    return eErr;
+}
+
+/************************************************************************/
+/*                        DiscardPendingBlock()                         */
+/************************************************************************/
+
+// To be called when all the bands of a block are going to be written
+// without going through m_pabyBlockBuf.
+void GTiffDataset::DiscardPendingBlock(int nBlockId)
+{
+    const auto oIter = m_oMapPendingBlocks.find(nBlockId);
+    if (oIter != m_oMapPendingBlocks.end())
+    {
+        m_nPendingBlocksSize -= oIter->second.abyData.size();
+        m_oMapPendingBlocks.erase(oIter);
+    }
+}
+
 /************************************************************************/
 /*                   GTiffFillStreamableOffsetAndCount()                */
 /************************************************************************/
@@ -2166,6 +2409,12 @@ CPLErr GTiffDataset::FlushCacheInternal(bool bAtClosing, bool bFlushDirectory)
     if (m_bIsFinalized)
         return CE_None;
 
+    // FlushDirectory() and the flushing of the pending compression jobs are
+    // not protected by the read/write mutex of the dataset, so stop the
+    // write-behind thread of the block cache. It is enabled again by the next
+    // write RasterIO() call.
+    DisableWriteBehindFlushing();
+
     CPLErr eErr = GDALPamDataset::FlushCache(bAtClosing);
 
     if (m_bLoadedBlockDirty && m_nLoadedBlock != -1)
@@ -2174,6 +2423,9 @@ CPLErr GTiffDataset::FlushCacheInternal(bool bAtClosing, bool bFlushDirectory)
             eErr = CE_Failure;
     }
 
+    if (FlushPendingBlocks() != CE_None)
+        eErr = CE_Failure;
+
     CPLFree(m_pabyBlockBuf);
     m_pabyBlockBuf = nullptr;
     m_nLoadedBlock = -1;
@@ -2550,6 +2802,7 @@ CPLErr GTiffDataset::RegisterNewOverviewDataset(toff_t nOverviewOffset,
         poODS->m_bWriteEmptyTiles = m_bWriteEmptyTiles;
         poODS->m_bFillEmptyTilesAtClosing = m_bFillEmptyTilesAtClosing;
     }
+    poODS->m_bDeduplicateTiles = m_bDeduplicateTiles;
     poODS->m_nJpegQuality = static_cast<signed char>(l_nJpegQuality);
     poODS->m_nWebPLevel = static_cast<signed char>(nWebpLevel);
     poODS->m_nZLevel = static_cast<signed char>(nZLevel);
@@ -2559,6 +2812,7 @@ CPLErr GTiffDataset::RegisterNewOverviewDataset(toff_t nOverviewOffset,
     poODS->m_nJpegTablesMode = m_nJpegTablesMode;
     poODS->m_dfMaxZError = dfMaxZError;
     poODS->m_dfMaxZErrorOverview = dfMaxZError;
+    poODS->m_nLercMaxTileSize = m_nLercMaxTileSize;
     memcpy(poODS->m_anLercAddCompressionAndVersion,
            m_anLercAddCompressionAndVersion,
            sizeof(m_anLercAddCompressionAndVersion));
@@ -2956,6 +3210,7 @@ CPLErr GTiffDataset::CreateInternalMaskOverviews(int nOvrBlockXSize,
                 {
                     poODS->m_bPromoteTo8Bits = CPLTestBool(CPLGetConfigOption(
                         "GDAL_TIFF_INTERNAL_MASK_TO_8BIT", "YES"));
+                    poODS->m_bDeduplicateTiles = m_bDeduplicateTiles;
                     poODS->m_poBaseDS = this;
                     poODS->m_poImageryDS = m_papoOverviewDS[i];
                     m_papoOverviewDS[i]->m_poMaskDS = poODS;
@@ -6384,6 +6639,15 @@ GDALDataset *GTiffDataset::Create(const char *pszFilename, int nXSize,
     if (!CPLFetchBool(papszParamList, "SPARSE_OK", false))
         poDS->m_bFillEmptyTilesAtClosing = true;
 
+    if (CPLFetchBool(papszParamList, "DEDUPLICATE_TILES", false))
+    {
+        if (TIFFIsTiled(l_hTIFF))
+            poDS->m_bDeduplicateTiles = true;
+        else
+            CPLError(CE_Warning, CPLE_NotSupported,
+                     "DEDUPLICATE_TILES ignored on non-tiled files");
+    }
+
     poDS->m_bWriteEmptyTiles =
         bStreaming || (poDS->m_nCompression != COMPRESSION_NONE &&
                        poDS->m_bFillEmptyTilesAtClosing);
@@ -6421,6 +6685,7 @@ GDALDataset *GTiffDataset::Create(const char *pszFilename, int nXSize,
     poDS->m_nJpegTablesMode = GTiffGetJpegTablesMode(papszParamList);
     poDS->m_dfMaxZError = GTiffGetLERCMaxZError(papszParamList);
     poDS->m_dfMaxZErrorOverview = GTiffGetLERCMaxZErrorOverview(papszParamList);
+    poDS->m_nLercMaxTileSize = GTiffGetLERCMaxTileSize(papszParamList);
 #if HAVE_JXL
     poDS->m_bJXLLossless = GTiffGetJXLLossless(papszParamList);
     poDS->m_nJXLEffort = GTiffGetJXLEffort(papszParamList);
@@ -6633,6 +6898,29 @@ CPLErr GTiffDataset::CopyImageryAndMask(GTiffDataset *poDstDS,
     return eErr;
 }
 
+/************************************************************************/
+/*                     OpenSrcOverviewDataset()                         */
+/************************************************************************/
+
+// Open the dataset pointed by the @OVERVIEW_DATASET or @MASK_OVERVIEW_DATASET
+// creation options (temporary overview files generated by the COG driver).
+// Forward NUM_THREADS so that the decompression of the source overview tiles
+// is also multi-threaded, and does not become the bottleneck when copying
+// the overview and mask IFDs, whose compression is done by the worker
+// threads of the main dataset.
+static GDALDataset *OpenSrcOverviewDataset(const char *pszFilename,
+                                           CSLConstList papszOptions)
+{
+    CPLStringList aosOpenOptions;
+    const char *pszNumThreads = CSLFetchNameValue(papszOptions, "NUM_THREADS");
+    if (pszNumThreads == nullptr)
+        pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (pszNumThreads)
+        aosOpenOptions.SetNameValue("NUM_THREADS", pszNumThreads);
+    return GDALDataset::Open(pszFilename, GDAL_OF_RASTER, nullptr,
+                             aosOpenOptions.List());
+}
+
 /************************************************************************/
 /*                             CreateCopy()                             */
 /************************************************************************/
@@ -6774,7 +7062,8 @@ GDALDataset *GTiffDataset::CreateCopy(const char *pszFilename,
             // to ignore source overviews.
             if (!EQUAL(pszOvrDS, ""))
             {
-                poOvrDS.reset(GDALDataset::Open(pszOvrDS));
+                poOvrDS.reset(
+                    OpenSrcOverviewDataset(pszOvrDS, papszCreateOptions));
                 if (!poOvrDS)
                 {
                     CSLDestroy(papszCreateOptions);
@@ -7721,6 +8010,7 @@ GDALDataset *GTiffDataset::CreateCopy(const char *pszFilename,
     poDS->GetDiscardLsbOption(papszOptions);
     poDS->m_dfMaxZError = GTiffGetLERCMaxZError(papszOptions);
     poDS->m_dfMaxZErrorOverview = GTiffGetLERCMaxZErrorOverview(papszOptions);
+    poDS->m_nLercMaxTileSize = GTiffGetLERCMaxTileSize(papszOptions);
 #if HAVE_JXL
     poDS->m_bJXLLossless = GTiffGetJXLLossless(papszOptions);
     poDS->m_nJXLEffort = GTiffGetJXLEffort(papszOptions);
@@ -7797,6 +8087,18 @@ GDALDataset *GTiffDataset::CreateCopy(const char *pszFilename,
     if (!CPLFetchBool(papszOptions, "SPARSE_OK", false))
         poDS->m_bFillEmptyTilesAtClosing = true;
 
+    if (CPLFetchBool(papszOptions, "DEDUPLICATE_TILES", false))
+    {
+        if (bCopySrcOverviews)
+            CPLError(CE_Warning, CPLE_NotSupported,
+                     "DEDUPLICATE_TILES ignored when COPY_SRC_OVERVIEWS=YES");
+        else if (!TIFFIsTiled(l_hTIFF))
+            CPLError(CE_Warning, CPLE_NotSupported,
+                     "DEDUPLICATE_TILES ignored on non-tiled files");
+        else
+            poDS->m_bDeduplicateTiles = true;
+    }
+
     poDS->m_bWriteEmptyTiles =
         (bCopySrcOverviews && poDS->m_bFillEmptyTilesAtClosing) || bStreaming ||
         (poDS->m_nCompression != COMPRESSION_NONE &&
@@ -7849,7 +8151,8 @@ GDALDataset *GTiffDataset::CreateCopy(const char *pszFilename,
             CSLFetchNameValue(papszOptions, "@MASK_OVERVIEW_DATASET");
         if (pszMaskOvrDS)
         {
-            poMaskOvrDS.reset(GDALDataset::Open(pszMaskOvrDS));
+            poMaskOvrDS.reset(
+                OpenSrcOverviewDataset(pszMaskOvrDS, papszOptions));
             if (!poMaskOvrDS)
             {
                 delete poDS;
@@ -8745,6 +9048,7 @@ CPLErr GTiffDataset::CreateMaskBand(int nFlagsIn)
         m_poMaskDS->ShareLockWithParentDataset(this);
         m_poMaskDS->m_bPromoteTo8Bits = CPLTestBool(
             CPLGetConfigOption("GDAL_TIFF_INTERNAL_MASK_TO_8BIT", "YES"));
+        m_poMaskDS->m_bDeduplicateTiles = m_bDeduplicateTiles;
         if (m_poMaskDS->OpenOffset(VSI_TIFFOpenChild(m_hTIFF), nOffset,
                                    GA_Update) != CE_None)
         {
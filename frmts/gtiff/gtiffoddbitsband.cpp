@@ -528,7 +528,7 @@ CPLErr GTiffOddBitsBand::IWriteBlock(int nBlockXOff, int nBlockYOff,
 }
 
 /************************************************************************/
-/*                             IReadBlock()                             */
+/*                            UnpackBlock()                             */
 /************************************************************************/
 
 static void ExpandPacked8ToByte1(const GByte *const CPL_RESTRICT pabySrc,
@@ -585,44 +585,21 @@ static void ExpandPacked8ToByte255(const GByte *const CPL_RESTRICT pabySrc,
     }
 }
 
-CPLErr GTiffOddBitsBand::IReadBlock(int nBlockXOff, int nBlockYOff,
-                                    void *pImage)
-
+/** Expand the packed content of a strile, as read by libtiff, into the
+ * pixel buffer of band nBand.
+ *
+ * This does not use the state of the dataset apart from its structural
+ * settings, so it may be called from a worker thread, as done by
+ * GTiffDataset::MultiThreadedRead().
+ *
+ * @param nBlockYSize Number of lines to unpack.
+ */
+/* static */ void GTiffOddBitsBand::UnpackBlock(
+    const GTiffDataset *poGDS, int nBand, GDALDataType eDataType,
+    int nBlockXSize, int nBlockYSize, const GByte *pabyBlockBuf, void *pImage)
 {
-    m_poGDS->Crystalize();
-
-    const int nBlockId = ComputeBlockId(nBlockXOff, nBlockYOff);
-
-    /* -------------------------------------------------------------------- */
-    /*      Handle the case of a strip in a writable file that doesn't      */
-    /*      exist yet, but that we want to read.  Just set to zeros and     */
-    /*      return.                                                         */
-    /* -------------------------------------------------------------------- */
-    if (nBlockId != m_poGDS->m_nLoadedBlock)
-    {
-        bool bErrOccurred = false;
-        if (!m_poGDS->IsBlockAvailable(nBlockId, nullptr, nullptr,
-                                       &bErrOccurred))
-        {
-            NullBlock(pImage);
-            if (bErrOccurred)
-                return CE_Failure;
-            return CE_None;
-        }
-    }
-
-    /* -------------------------------------------------------------------- */
-    /*      Load the block buffer.                                          */
-    /* -------------------------------------------------------------------- */
-    {
-        const CPLErr eErr = m_poGDS->LoadBlockBuf(nBlockId);
-        if (eErr != CE_None)
-            return eErr;
-    }
-
-    if (m_poGDS->m_nBitsPerSample == 1 &&
-        (m_poGDS->nBands == 1 ||
-         m_poGDS->m_nPlanarConfig == PLANARCONFIG_SEPARATE))
+    if (poGDS->m_nBitsPerSample == 1 &&
+        (poGDS->nBands == 1 || poGDS->m_nPlanarConfig == PLANARCONFIG_SEPARATE))
     {
         /* --------------------------------------------------------------------
          */
@@ -630,8 +607,6 @@ CPLErr GTiffOddBitsBand::IReadBlock(int nBlockXOff, int nBlockYOff,
         /* --------------------------------------------------------------------
          */
         GPtrDiff_t iDstOffset = 0;
-        const GByte *const CPL_RESTRICT m_pabyBlockBuf =
-            m_poGDS->m_pabyBlockBuf;
         GByte *CPL_RESTRICT pabyDest = static_cast<GByte *>(pImage);
 
         for (int iLine = 0; iLine < nBlockYSize; ++iLine)
@@ -639,23 +614,23 @@ CPLErr GTiffOddBitsBand::IReadBlock(int nBlockXOff, int nBlockYOff,
             GPtrDiff_t iSrcOffsetByte =
                 static_cast<GPtrDiff_t>((nBlockXSize + 7) >> 3) * iLine;
 
-            if (!m_poGDS->m_bPromoteTo8Bits)
+            if (!poGDS->m_bPromoteTo8Bits)
             {
-                ExpandPacked8ToByte1(m_pabyBlockBuf + iSrcOffsetByte,
+                ExpandPacked8ToByte1(pabyBlockBuf + iSrcOffsetByte,
                                      pabyDest + iDstOffset, nBlockXSize / 8);
             }
             else
             {
-                ExpandPacked8ToByte255(m_pabyBlockBuf + iSrcOffsetByte,
+                ExpandPacked8ToByte255(pabyBlockBuf + iSrcOffsetByte,
                                        pabyDest + iDstOffset, nBlockXSize / 8);
             }
             GPtrDiff_t iSrcOffsetBit = (iSrcOffsetByte + nBlockXSize / 8) * 8;
             iDstOffset += nBlockXSize & ~0x7;
-            const GByte bSetVal = m_poGDS->m_bPromoteTo8Bits ? 255 : 1;
+            const GByte bSetVal = poGDS->m_bPromoteTo8Bits ? 255 : 1;
             for (int iPixel = nBlockXSize & ~0x7; iPixel < nBlockXSize;
                  ++iPixel, ++iSrcOffsetBit)
             {
-                if (m_pabyBlockBuf[iSrcOffsetBit >> 3] &
+                if (pabyBlockBuf[iSrcOffsetBit >> 3] &
                     (0x80 >> (iSrcOffsetBit & 0x7)))
                     static_cast<GByte *>(pImage)[iDstOffset++] = bSetVal;
                 else
@@ -669,20 +644,20 @@ CPLErr GTiffOddBitsBand::IReadBlock(int nBlockXOff, int nBlockYOff,
     /* -------------------------------------------------------------------- */
     else if (eDataType == GDT_Float32)
     {
-        const int nWordBytes = m_poGDS->m_nBitsPerSample / 8;
+        const int nWordBytes = poGDS->m_nBitsPerSample / 8;
         const GByte *pabyImage =
-            m_poGDS->m_pabyBlockBuf +
-            ((m_poGDS->m_nPlanarConfig == PLANARCONFIG_SEPARATE)
+            pabyBlockBuf +
+            ((poGDS->m_nPlanarConfig == PLANARCONFIG_SEPARATE)
                  ? 0
                  : (nBand - 1) * nWordBytes);
         const int iSkipBytes =
-            (m_poGDS->m_nPlanarConfig == PLANARCONFIG_SEPARATE)
+            (poGDS->m_nPlanarConfig == PLANARCONFIG_SEPARATE)
                 ? nWordBytes
-                : m_poGDS->nBands * nWordBytes;
+                : poGDS->nBands * nWordBytes;
 
         const auto nBlockPixels =
             static_cast<GPtrDiff_t>(nBlockXSize) * nBlockYSize;
-        if (m_poGDS->m_nBitsPerSample == 16)
+        if (poGDS->m_nBitsPerSample == 16)
         {
             for (GPtrDiff_t i = 0; i < nBlockPixels; ++i)
             {
@@ -691,7 +666,7 @@ CPLErr GTiffOddBitsBand::IReadBlock(int nBlockXOff, int nBlockYOff,
                 pabyImage += iSkipBytes;
             }
         }
-        else if (m_poGDS->m_nBitsPerSample == 24)
+        else if (poGDS->m_nBitsPerSample == 24)
         {
             for (GPtrDiff_t i = 0; i < nBlockPixels; ++i)
             {
@@ -714,19 +689,19 @@ CPLErr GTiffOddBitsBand::IReadBlock(int nBlockXOff, int nBlockYOff,
     /* -------------------------------------------------------------------- */
     /*      Special case for moving 12bit data somewhat more efficiently.   */
     /* -------------------------------------------------------------------- */
-    else if (m_poGDS->m_nBitsPerSample == 12)
+    else if (poGDS->m_nBitsPerSample == 12)
     {
         int iPixelBitSkip = 0;
         int iBandBitOffset = 0;
 
-        if (m_poGDS->m_nPlanarConfig == PLANARCONFIG_CONTIG)
+        if (poGDS->m_nPlanarConfig == PLANARCONFIG_CONTIG)
         {
-            iPixelBitSkip = m_poGDS->nBands * m_poGDS->m_nBitsPerSample;
-            iBandBitOffset = (nBand - 1) * m_poGDS->m_nBitsPerSample;
+            iPixelBitSkip = poGDS->nBands * poGDS->m_nBitsPerSample;
+            iBandBitOffset = (nBand - 1) * poGDS->m_nBitsPerSample;
         }
         else
         {
-            iPixelBitSkip = m_poGDS->m_nBitsPerSample;
+            iPixelBitSkip = poGDS->m_nBitsPerSample;
         }
 
         // Bits per line rounds up to next byte boundary.
@@ -749,16 +724,16 @@ CPLErr GTiffOddBitsBand::IReadBlock(int nBlockXOff, int nBlockYOff,
                     // Starting on byte boundary.
 
                     static_cast<GUInt16 *>(pImage)[iPixel++] =
-                        (m_poGDS->m_pabyBlockBuf[iByte] << 4) |
-                        (m_poGDS->m_pabyBlockBuf[iByte + 1] >> 4);
+                        (pabyBlockBuf[iByte] << 4) |
+                        (pabyBlockBuf[iByte + 1] >> 4);
                 }
                 else
                 {
                     // Starting off byte boundary.
 
                     static_cast<GUInt16 *>(pImage)[iPixel++] =
-                        ((m_poGDS->m_pabyBlockBuf[iByte] & 0xf) << 8) |
-                        (m_poGDS->m_pabyBlockBuf[iByte + 1]);
+                        ((pabyBlockBuf[iByte] & 0xf) << 8) |
+                        (pabyBlockBuf[iByte + 1]);
                 }
                 iBitOffset += iPixelBitSkip;
             }
@@ -769,19 +744,19 @@ CPLErr GTiffOddBitsBand::IReadBlock(int nBlockXOff, int nBlockYOff,
     /*      Special case for 24bit data which is pre-byteswapped since      */
     /*      the size falls on a byte boundary ... ugh (#2361).              */
     /* -------------------------------------------------------------------- */
-    else if (m_poGDS->m_nBitsPerSample == 24)
+    else if (poGDS->m_nBitsPerSample == 24)
     {
         int iPixelByteSkip = 0;
         int iBandByteOffset = 0;
 
-        if (m_poGDS->m_nPlanarConfig == PLANARCONFIG_CONTIG)
+        if (poGDS->m_nPlanarConfig == PLANARCONFIG_CONTIG)
         {
-            iPixelByteSkip = (m_poGDS->nBands * m_poGDS->m_nBitsPerSample) / 8;
-            iBandByteOffset = ((nBand - 1) * m_poGDS->m_nBitsPerSample) / 8;
+            iPixelByteSkip = (poGDS->nBands * poGDS->m_nBitsPerSample) / 8;
+            iBandByteOffset = ((nBand - 1) * poGDS->m_nBitsPerSample) / 8;
         }
         else
         {
-            iPixelByteSkip = m_poGDS->m_nBitsPerSample / 8;
+            iPixelByteSkip = poGDS->m_nBitsPerSample / 8;
         }
 
         const GPtrDiff_t nBytesPerLine =
@@ -790,8 +765,8 @@ CPLErr GTiffOddBitsBand::IReadBlock(int nBlockXOff, int nBlockYOff,
         GPtrDiff_t iPixel = 0;
         for (int iY = 0; iY < nBlockYSize; ++iY)
         {
-            GByte *pabyImage =
-                m_poGDS->m_pabyBlockBuf + iBandByteOffset + iY * nBytesPerLine;
+            const GByte *pabyImage =
+                pabyBlockBuf + iBandByteOffset + iY * nBytesPerLine;
 
             for (int iX = 0; iX < nBlockXSize; ++iX)
             {
@@ -819,14 +794,14 @@ CPLErr GTiffOddBitsBand::IReadBlock(int nBlockXOff, int nBlockYOff,
         unsigned iPixelBitSkip = 0;
         unsigned iBandBitOffset = 0;
 
-        if (m_poGDS->m_nPlanarConfig == PLANARCONFIG_CONTIG)
+        if (poGDS->m_nPlanarConfig == PLANARCONFIG_CONTIG)
         {
-            iPixelBitSkip = m_poGDS->nBands * m_poGDS->m_nBitsPerSample;
-            iBandBitOffset = (nBand - 1) * m_poGDS->m_nBitsPerSample;
+            iPixelBitSkip = poGDS->nBands * poGDS->m_nBitsPerSample;
+            iBandBitOffset = (nBand - 1) * poGDS->m_nBitsPerSample;
         }
         else
         {
-            iPixelBitSkip = m_poGDS->m_nBitsPerSample;
+            iPixelBitSkip = poGDS->m_nBitsPerSample;
         }
 
         // Bits per line rounds up to next byte boundary.
@@ -835,8 +810,7 @@ CPLErr GTiffOddBitsBand::IReadBlock(int nBlockXOff, int nBlockYOff,
         if ((nBitsPerLine & 7) != 0)
             nBitsPerLine = (nBitsPerLine + 7) & (~7);
 
-        const GByte *const m_pabyBlockBuf = m_poGDS->m_pabyBlockBuf;
-        const unsigned nBitsPerSample = m_poGDS->m_nBitsPerSample;
+        const unsigned nBitsPerSample = poGDS->m_nBitsPerSample;
         GPtrDiff_t iPixel = 0;
 
         if (nBitsPerSample == 1 && eDataType == GDT_Byte)
@@ -848,7 +822,7 @@ CPLErr GTiffOddBitsBand::IReadBlock(int nBlockXOff, int nBlockYOff,
                 for (unsigned iX = 0; iX < static_cast<unsigned>(nBlockXSize);
                      ++iX)
                 {
-                    if (m_pabyBlockBuf[iBitOffset >> 3] &
+                    if (pabyBlockBuf[iBitOffset >> 3] &
                         (0x80 >> (iBitOffset & 7)))
                         static_cast<GByte *>(pImage)[iPixel] = 1;
                     else
@@ -871,7 +845,7 @@ CPLErr GTiffOddBitsBand::IReadBlock(int nBlockXOff, int nBlockYOff,
 
                     for (unsigned iBit = 0; iBit < nBitsPerSample; ++iBit)
                     {
-                        if (m_pabyBlockBuf[iBitOffset >> 3] &
+                        if (pabyBlockBuf[iBitOffset >> 3] &
                             (0x80 >> (iBitOffset & 7)))
                             nOutWord |= (1 << (nBitsPerSample - 1 - iBit));
                         ++iBitOffset;
@@ -901,6 +875,49 @@ CPLErr GTiffOddBitsBand::IReadBlock(int nBlockXOff, int nBlockYOff,
             }
         }
     }
+}
+
+/************************************************************************/
+/*                             IReadBlock()                             */
+/************************************************************************/
+
+CPLErr GTiffOddBitsBand::IReadBlock(int nBlockXOff, int nBlockYOff,
+                                    void *pImage)
+
+{
+    m_poGDS->Crystalize();
+
+    const int nBlockId = ComputeBlockId(nBlockXOff, nBlockYOff);
+
+    /* -------------------------------------------------------------------- */
+    /*      Handle the case of a strip in a writable file that doesn't      */
+    /*      exist yet, but that we want to read.  Just set to zeros and     */
+    /*      return.                                                         */
+    /* -------------------------------------------------------------------- */
+    if (nBlockId != m_poGDS->m_nLoadedBlock)
+    {
+        bool bErrOccurred = false;
+        if (!m_poGDS->IsBlockAvailable(nBlockId, nullptr, nullptr,
+                                       &bErrOccurred))
+        {
+            NullBlock(pImage);
+            if (bErrOccurred)
+                return CE_Failure;
+            return CE_None;
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Load the block buffer.                                          */
+    /* -------------------------------------------------------------------- */
+    {
+        const CPLErr eErr = m_poGDS->LoadBlockBuf(nBlockId);
+        if (eErr != CE_None)
+            return eErr;
+    }
+
+    UnpackBlock(m_poGDS, nBand, eDataType, nBlockXSize, nBlockYSize,
+                m_poGDS->m_pabyBlockBuf, pImage);
 
     CacheMaskForBlock(nBlockXOff, nBlockYOff);
 
@@ -54,6 +54,16 @@ class GTiffOddBitsBand CPL_NON_FINAL : public GTiffRasterBand
         return false;
     }
 
+    bool IsMultiThreadedReadCompatible() const override
+    {
+        return true;
+    }
+
+    static void UnpackBlock(const GTiffDataset *poGDS, int nBand,
+                            GDALDataType eDataType, int nBlockXSize,
+                            int nBlockYSize, const GByte *pabyBlockBuf,
+                            void *pImage);
+
     virtual CPLErr IReadBlock(int, int, void *) override;
     virtual CPLErr IWriteBlock(int, int, void *) override;
 };
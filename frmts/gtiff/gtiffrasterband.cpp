@@ -239,6 +239,11 @@ CPLErr GTiffRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
              nYSize, nBufXSize, nBufYSize);
 #endif
 
+    // Allow the dirty blocks to be written by the write-behind thread of the
+    // block cache, until the next FlushCache().
+    if (eRWFlag == GF_Write)
+        m_poGDS->EnableWriteBehindFlushing();
+
     // Try to pass the request to the most appropriate overview dataset.
     if (nBufXSize < nXSize && nBufYSize < nYSize)
     {
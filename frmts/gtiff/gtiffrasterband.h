@@ -72,6 +72,8 @@ class GTiffRasterBand CPL_NON_FINAL : public GDALPamRasterBand
     void *CacheMultiRange(int nXOff, int nYOff, int nXSize, int nYSize,
                           int nBufXSize, int nBufYSize,
                           GDALRasterIOExtraArg *psExtraArg);
+    void *CacheMultiRangeForBlocks(int nBlockCount, const int *panXBlockOff,
+                                   const int *panYBlockOff);
 
   protected:
     GTiffDataset *m_poGDS = nullptr;
@@ -102,8 +104,18 @@ class GTiffRasterBand CPL_NON_FINAL : public GDALPamRasterBand
         return true;
     }
 
+    // Whether GTiffDataset::MultiThreadedRead() knows how to decode the
+    // striles of this band.
+    virtual bool IsMultiThreadedReadCompatible() const
+    {
+        return IsBaseGTiffClass();
+    }
+
     virtual CPLErr IReadBlock(int, int, void *) override;
     virtual CPLErr IWriteBlock(int, int, void *) override;
+    virtual CPLErr IReadBlocks(int nBlockCount, const int *panXBlockOff,
+                               const int *panYBlockOff,
+                               void *const *papImages) override;
 
     virtual GDALSuggestedBlockAccessPattern
     GetSuggestedBlockAccessPattern() const override
@@ -636,7 +636,6 @@ void *GTiffRasterBand::CacheMultiRange(int nXOff, int nYOff, int nXSize,
                                        int nYSize, int nBufXSize, int nBufYSize,
                                        GDALRasterIOExtraArg *psExtraArg)
 {
-    void *pBufferedData = nullptr;
     // Same logic as in GDALRasterBand::IRasterIO()
     double dfXOff = nXOff;
     double dfYOff = nYOff;
@@ -669,6 +668,37 @@ void *GTiffRasterBand::CacheMultiRange(int nXOff, int nYOff, int nXSize,
                      (nBufYSize - 1 + 0.5) * dfSrcYInc + dfYOff + EPS)) /
         nBlockYSize;
 
+    std::vector<int> anXBlockOff;
+    std::vector<int> anYBlockOff;
+    for (int iY = nBlockY1; iY <= nBlockY2; iY++)
+    {
+        for (int iX = nBlockX1; iX <= nBlockX2; iX++)
+        {
+            anXBlockOff.push_back(iX);
+            anYBlockOff.push_back(iY);
+        }
+    }
+    return CacheMultiRangeForBlocks(static_cast<int>(anXBlockOff.size()),
+                                    anXBlockOff.data(), anYBlockOff.data());
+}
+
+/************************************************************************/
+/*                      CacheMultiRangeForBlocks()                      */
+/************************************************************************/
+
+/** Fetch with a single VSIFReadMultiRangeL() call the byte ranges of the
+ * specified blocks that are not already in the block cache, and make them
+ * available to libtiff through VSI_TIFFSetCachedRanges().
+ *
+ * @return the buffer holding the cached ranges, to be freed with VSIFree()
+ * after having called VSI_TIFFSetCachedRanges(th, 0, ...), or nullptr.
+ */
+void *GTiffRasterBand::CacheMultiRangeForBlocks(int nReqBlockCount,
+                                                const int *panXBlockOff,
+                                                const int *panYBlockOff)
+{
+    void *pBufferedData = nullptr;
+
     const int nBlockCount = nBlocksPerRow * nBlocksPerColumn;
 
     struct StrileData
@@ -935,57 +965,54 @@ void *GTiffRasterBand::CacheMultiRange(int nXOff, int nYOff, int nXSize,
         size_t nTotalSize = 0;
         const unsigned int nMaxRawBlockCacheSize = atoi(
             CPLGetConfigOption("GDAL_MAX_RAW_BLOCK_CACHE_SIZE", "10485760"));
-        bool bGoOn = true;
-        for (int iY = nBlockY1; bGoOn && iY <= nBlockY2; iY++)
+        for (int iReqBlock = 0; iReqBlock < nReqBlockCount; ++iReqBlock)
         {
-            for (int iX = nBlockX1; bGoOn && iX <= nBlockX2; iX++)
+            const int iX = panXBlockOff[iReqBlock];
+            const int iY = panYBlockOff[iReqBlock];
+            GDALRasterBlock *poBlock = TryGetLockedBlockRef(iX, iY);
+            if (poBlock != nullptr)
             {
-                GDALRasterBlock *poBlock = TryGetLockedBlockRef(iX, iY);
-                if (poBlock != nullptr)
-                {
-                    poBlock->DropLock();
-                    continue;
-                }
-                int nBlockId = iX + iY * nBlocksPerRow;
-                if (m_poGDS->m_nPlanarConfig == PLANARCONFIG_SEPARATE)
-                    nBlockId += (nBand - 1) * m_poGDS->m_nBlocksPerBand;
-                vsi_l_offset nOffset = 0;
-                vsi_l_offset nSize = 0;
-
-                if ((m_poGDS->m_nPlanarConfig == PLANARCONFIG_CONTIG ||
-                     m_poGDS->nBands == 1) &&
-                    !m_poGDS->m_bStreamingIn &&
-                    m_poGDS->m_bBlockOrderRowMajor &&
-                    m_poGDS->m_bLeaderSizeAsUInt4)
+                poBlock->DropLock();
+                continue;
+            }
+            int nBlockId = iX + iY * nBlocksPerRow;
+            if (m_poGDS->m_nPlanarConfig == PLANARCONFIG_SEPARATE)
+                nBlockId += (nBand - 1) * m_poGDS->m_nBlocksPerBand;
+            vsi_l_offset nOffset = 0;
+            vsi_l_offset nSize = 0;
+
+            if ((m_poGDS->m_nPlanarConfig == PLANARCONFIG_CONTIG ||
+                 m_poGDS->nBands == 1) &&
+                !m_poGDS->m_bStreamingIn && m_poGDS->m_bBlockOrderRowMajor &&
+                m_poGDS->m_bLeaderSizeAsUInt4)
+            {
+                OptimizedRetrievalOfOffsetSize(nBlockId, nOffset, nSize,
+                                               nTotalSize,
+                                               nMaxRawBlockCacheSize);
+            }
+            else
+            {
+                CPL_IGNORE_RET_VAL(
+                    m_poGDS->IsBlockAvailable(nBlockId, &nOffset, &nSize));
+            }
+            if (nSize)
+            {
+                if (nTotalSize + nSize < nMaxRawBlockCacheSize)
                 {
-                    OptimizedRetrievalOfOffsetSize(nBlockId, nOffset, nSize,
-                                                   nTotalSize,
-                                                   nMaxRawBlockCacheSize);
+#ifdef DEBUG_VERBOSE
+                    CPLDebug("GTiff",
+                             "Precaching for block (%d, %d), " CPL_FRMT_GUIB
+                             "-" CPL_FRMT_GUIB,
+                             iX, iY, nOffset,
+                             nOffset + static_cast<size_t>(nSize) - 1);
+#endif
+                    aOffsetSize.push_back(
+                        std::pair(nOffset, static_cast<size_t>(nSize)));
+                    nTotalSize += static_cast<size_t>(nSize);
                 }
                 else
                 {
-                    CPL_IGNORE_RET_VAL(
-                        m_poGDS->IsBlockAvailable(nBlockId, &nOffset, &nSize));
-                }
-                if (nSize)
-                {
-                    if (nTotalSize + nSize < nMaxRawBlockCacheSize)
-                    {
-#ifdef DEBUG_VERBOSE
-                        CPLDebug("GTiff",
-                                 "Precaching for block (%d, %d), " CPL_FRMT_GUIB
-                                 "-" CPL_FRMT_GUIB,
-                                 iX, iY, nOffset,
-                                 nOffset + static_cast<size_t>(nSize) - 1);
-#endif
-                        aOffsetSize.push_back(
-                            std::pair(nOffset, static_cast<size_t>(nSize)));
-                        nTotalSize += static_cast<size_t>(nSize);
-                    }
-                    else
-                    {
-                        bGoOn = false;
-                    }
+                    break;
                 }
             }
         }
@@ -1063,9 +1090,8 @@ void *GTiffRasterBand::CacheMultiRange(int nXOff, int nYOff, int nXSize,
                         // Retry without optimization
                         CPLFree(pBufferedData);
                         m_poGDS->m_bLeaderSizeAsUInt4 = false;
-                        void *pRet =
-                            CacheMultiRange(nXOff, nYOff, nXSize, nYSize,
-                                            nBufXSize, nBufYSize, psExtraArg);
+                        void *pRet = CacheMultiRangeForBlocks(
+                            nReqBlockCount, panXBlockOff, panYBlockOff);
                         m_poGDS->m_bLeaderSizeAsUInt4 = true;
                         return pRet;
                     }
@@ -1219,6 +1245,7 @@ CPLErr GTiffRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff, void *pImage)
     vsi_l_offset nOffset = 0;
     bool bErrOccurred = false;
     if (nBlockId != m_poGDS->m_nLoadedBlock &&
+        !m_poGDS->HasPendingBlock(nBlockId) &&
         !m_poGDS->IsBlockAvailable(nBlockId, &nOffset, nullptr, &bErrOccurred))
     {
         NullBlock(pImage);
@@ -1346,6 +1373,113 @@ CPLErr GTiffRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff, void *pImage)
     return eErr;
 }
 
+/************************************************************************/
+/*                            IReadBlocks()                             */
+/************************************************************************/
+
+CPLErr GTiffRasterBand::IReadBlocks(int nBlockCount, const int *panXBlockOff,
+                                    const int *panYBlockOff,
+                                    void *const *papImages)
+{
+    m_poGDS->Crystalize();
+
+    const bool bCanUseMultiThreadedRead =
+        m_poGDS->m_nDisableMultiThreadedRead == 0 &&
+        m_poGDS->m_poThreadPool != nullptr &&
+        m_poGDS->IsMultiThreadedReadCompatible();
+
+    // Fetch the byte ranges of all blocks with a single multi-range request,
+    // unless the multi-threaded reader will do it by itself with PRead().
+    thandle_t th = TIFFClientdata(m_poGDS->m_hTIFF);
+    void *pBufferedData = nullptr;
+    if (nBlockCount > 1 && m_poGDS->eAccess == GA_ReadOnly &&
+        m_poGDS->HasOptimizedReadMultiRange() &&
+        !(bCanUseMultiThreadedRead && VSI_TIFFGetVSILFile(th)->HasPRead()))
+    {
+        pBufferedData =
+            CacheMultiRangeForBlocks(nBlockCount, panXBlockOff, panYBlockOff);
+    }
+
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    const auto IsFullBlock = [this](int nXBlockOff, int nYBlockOff)
+    {
+        return static_cast<GIntBig>(nXBlockOff + 1) * nBlockXSize <=
+                   nRasterXSize &&
+               static_cast<GIntBig>(nYBlockOff + 1) * nBlockYSize <=
+                   nRasterYSize;
+    };
+
+    CPLErr eErr = CE_None;
+    for (int i = 0; eErr == CE_None && i < nBlockCount;)
+    {
+        // Gather a run of horizontally consecutive blocks, that are not
+        // partial blocks, so that they can be decoded in parallel.
+        int nRun = 1;
+        if (bCanUseMultiThreadedRead &&
+            IsFullBlock(panXBlockOff[i], panYBlockOff[i]))
+        {
+            while (i + nRun < nBlockCount &&
+                   panYBlockOff[i + nRun] == panYBlockOff[i] &&
+                   panXBlockOff[i + nRun] == panXBlockOff[i] + nRun &&
+                   IsFullBlock(panXBlockOff[i + nRun], panYBlockOff[i + nRun]))
+            {
+                ++nRun;
+            }
+        }
+
+        if (nRun == 1)
+        {
+            eErr = IReadBlock(panXBlockOff[i], panYBlockOff[i], papImages[i]);
+        }
+        else
+        {
+            const int nXSize = nRun * nBlockXSize;
+            const size_t nBlockLineSize =
+                static_cast<size_t>(nBlockXSize) * nDTSize;
+            std::vector<GByte> abyBuffer;
+            try
+            {
+                abyBuffer.resize(nBlockLineSize * nRun * nBlockYSize);
+            }
+            catch (const std::exception &)
+            {
+                ReportError(CE_Failure, CPLE_OutOfMemory,
+                            "Cannot allocate temporary buffer");
+                eErr = CE_Failure;
+                break;
+            }
+            eErr = m_poGDS->MultiThreadedRead(
+                panXBlockOff[i] * nBlockXSize, panYBlockOff[i] * nBlockYSize,
+                nXSize, nBlockYSize, abyBuffer.data(), eDataType, 1, &nBand,
+                nDTSize, static_cast<GSpacing>(nBlockLineSize) * nRun, 0);
+            if (eErr == CE_None)
+            {
+                for (int k = 0; k < nRun; ++k)
+                {
+                    GByte *pabyDst = static_cast<GByte *>(papImages[i + k]);
+                    for (int iY = 0; iY < nBlockYSize; ++iY)
+                    {
+                        memcpy(pabyDst + iY * nBlockLineSize,
+                               abyBuffer.data() +
+                                   (static_cast<size_t>(iY) * nRun + k) *
+                                       nBlockLineSize,
+                               nBlockLineSize);
+                    }
+                }
+            }
+        }
+        i += nRun;
+    }
+
+    if (pBufferedData)
+    {
+        VSIFree(pBufferedData);
+        VSI_TIFFSetCachedRanges(th, 0, nullptr, nullptr, nullptr);
+    }
+
+    return eErr;
+}
+
 /************************************************************************/
 /*                           CacheMaskForBlock()                       */
 /************************************************************************/
@@ -151,6 +151,36 @@ CPLErr GTiffRasterBand::IWriteBlock(int nBlockXOff, int nBlockYOff,
     /* -------------------------------------------------------------------- */
     const int nWordBytes = m_poGDS->m_nBitsPerSample / 8;
 
+    if (bAllBlocksDirty && nWordBytes == GDALGetDataTypeSizeBytes(eDataType))
+    {
+        // All bands are available: interleave them in a single pass.
+        const void *apSrcBands[MAX_BANDS_FOR_DIRTY_CHECK] = {};
+        for (int iBand = 0; iBand < nBands; ++iBand)
+        {
+            apSrcBands[iBand] = iBand + 1 == nBand
+                                    ? pImage
+                                    : apoBlocks[iBand]->GetDataRef();
+        }
+        GDALInterleave(apSrcBands, eDataType, nBands, m_poGDS->m_pabyBlockBuf,
+                       eDataType,
+                       static_cast<size_t>(nBlockXSize) * nBlockYSize);
+        for (int iBand = 0; iBand < nBands; ++iBand)
+        {
+            if (apoBlocks[iBand] != nullptr)
+            {
+                apoBlocks[iBand]->MarkClean();
+                apoBlocks[iBand]->DropLock();
+            }
+        }
+
+        // We can synchronously write the block now.
+        const CPLErr eErr = m_poGDS->WriteEncodedTileOrStrip(
+            nBlockId, m_poGDS->m_pabyBlockBuf, true);
+        m_poGDS->m_bLoadedBlockDirty = false;
+        m_poGDS->m_abLoadedBlockBandsWritten.assign(nBands, true);
+        return eErr;
+    }
+
     for (int iBand = 0; iBand < nBands; ++iBand)
     {
         const GByte *pabyThisImage = nullptr;
@@ -186,6 +216,11 @@ CPLErr GTiffRasterBand::IWriteBlock(int nBlockXOff, int nBlockYOff,
         GDALCopyWords64(pabyThisImage, eDataType, nWordBytes, pabyOut,
                         eDataType, nWordBytes * nBands,
                         static_cast<GPtrDiff_t>(nBlockXSize) * nBlockYSize);
+        if (static_cast<int>(m_poGDS->m_abLoadedBlockBandsWritten.size()) ==
+            nBands)
+        {
+            m_poGDS->m_abLoadedBlockBandsWritten[iBand] = true;
+        }
 
         if (poBlock != nullptr)
         {
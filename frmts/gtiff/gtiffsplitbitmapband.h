@@ -47,6 +47,11 @@ class GTiffSplitBitmapBand final : public GTiffBitmapBand
     GTiffSplitBitmapBand(GTiffDataset *, int);
     virtual ~GTiffSplitBitmapBand();
 
+    bool IsMultiThreadedReadCompatible() const override
+    {
+        return false;
+    }
+
     virtual int IGetDataCoverageStatus(int nXOff, int nYOff, int nXSize,
                                        int nYSize, int nMaskFlagStop,
                                        double *pdfDataPct) override;
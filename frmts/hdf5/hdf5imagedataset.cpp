@@ -29,10 +29,13 @@
 
 #include "hdf5_api.h"
 
+#include "cpl_compressor.h"
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_frmts.h"
 #include "gdal_pam.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "gh5_convenience.h"
 #include "hdf5dataset.h"
 #include "hdf5drivercore.h"
@@ -40,6 +43,13 @@
 #include "../mem/memdataset.h"
 
 #include <algorithm>
+#include <atomic>
+#include <limits>
+#include <vector>
+
+#if H5_VERSION_GE(1, 10, 2)
+#define HAVE_H5DREAD_CHUNK
+#endif
 
 class HDF5ImageDataset final : public HDF5Dataset
 {
@@ -114,8 +124,24 @@ class HDF5ImageDataset final : public HDF5Dataset
     // [m_iCurrentBandChunk * m_nBandChunkSize, (m_iCurrentBandChunk+1) * m_nBandChunkSize[
     std::vector<GByte> m_abyBandChunk{};
 
+    //! Whether blocks can be read with H5Dread_chunk() and decoded by GDAL,
+    // outside of the HDF5 filter pipeline (and lock).
+    bool m_bDirectChunkRead = false;
+    //! Filters of the chunk pipeline, in the order they are applied when
+    // writing.
+    std::vector<H5Z_filter_t> m_anChunkFilters{};
+    //! Size in bytes of a decoded chunk
+    size_t m_nChunkBytes = 0;
+
     CPLErr CreateODIMH5Projection();
 
+    void SetChunkCache(const hsize_t *panChunkDims);
+    void DetectDirectChunkRead(hid_t listid);
+    bool ReadRawChunk(int nBand, int nBlockXOff, int nBlockYOff,
+                      std::vector<GByte> &abyRaw, uint32_t &nFilterMask);
+    bool DecodeRawChunk(const std::vector<GByte> &abyRaw, uint32_t nFilterMask,
+                        void *pDst) const;
+
   public:
     HDF5ImageDataset();
     virtual ~HDF5ImageDataset();
@@ -262,6 +288,9 @@ class HDF5ImageRasterBand final : public GDALPamRasterBand
     double m_dfScale = 1.0;
     int m_nIRasterIORecCounter = 0;
 
+    bool ReadChunksInParallel(int nXOff, int nYOff, int nXSize, int nYSize,
+                              int nThreads);
+
   public:
     HDF5ImageRasterBand(HDF5ImageDataset *, int, GDALDataType);
     virtual ~HDF5ImageRasterBand();
@@ -407,6 +436,25 @@ CPLErr HDF5ImageRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
         }
     }
 
+    if (poGDS->m_bDirectChunkRead)
+    {
+        std::vector<GByte> abyRaw;
+        uint32_t nFilterMask = 0;
+        if (poGDS->ReadRawChunk(nBand, nBlockXOff, nBlockYOff, abyRaw,
+                                nFilterMask))
+        {
+            if (!poGDS->DecodeRawChunk(abyRaw, nFilterMask, pImage))
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Cannot decode chunk (%d, %d)", nBlockXOff,
+                         nBlockYOff);
+                return CE_Failure;
+            }
+            return CE_None;
+        }
+        // Otherwise (unallocated chunk for example), go through H5Dread()
+    }
+
     HDF5_GLOBAL_LOCK();
 
     hsize_t count[3] = {0, 0, 0};
@@ -468,6 +516,135 @@ CPLErr HDF5ImageRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
     return CE_None;
 }
 
+/************************************************************************/
+/*                      HDF5GetNumThreadsForRead()                      */
+/************************************************************************/
+
+static int HDF5GetNumThreadsForRead()
+{
+    const char *pszValue = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (pszValue == nullptr)
+        return 1;
+    int nThreads =
+        EQUAL(pszValue, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszValue);
+    if (nThreads > 1024)
+        nThreads = 1024;  // to please Coverity
+    return nThreads;
+}
+
+/************************************************************************/
+/*                        ReadChunksInParallel()                        */
+/************************************************************************/
+
+// Reads the compressed chunks intersecting the window (under the HDF5 lock),
+// and decodes them with nThreads threads (outside of it) into the block
+// cache. Returns false if the block cache cannot hold them.
+bool HDF5ImageRasterBand::ReadChunksInParallel(int nXOff, int nYOff,
+                                               int nXSize, int nYSize,
+                                               int nThreads)
+{
+    HDF5ImageDataset *poGDS = static_cast<HDF5ImageDataset *>(poDS);
+
+    const int nBlockXStart = nXOff / nBlockXSize;
+    const int nBlockXEnd = (nXOff + nXSize - 1) / nBlockXSize;
+    const int nBlockYStart = nYOff / nBlockYSize;
+    const int nBlockYEnd = (nYOff + nYSize - 1) / nBlockYSize;
+    const GIntBig nBlocks =
+        static_cast<GIntBig>(nBlockXEnd - nBlockXStart + 1) *
+        (nBlockYEnd - nBlockYStart + 1);
+    const GIntBig nBlockBytes = static_cast<GIntBig>(nBlockXSize) *
+                                nBlockYSize *
+                                GDALGetDataTypeSizeBytes(eDataType);
+    if (nBlocks * nBlockBytes >
+        (GDALGetCacheMax64() - GDALGetCacheUsed64()) / 2)
+    {
+        return false;
+    }
+
+    CPLWorkerThreadPool *poPool = GDALGetGlobalThreadPool(nThreads);
+    if (poPool == nullptr)
+        return false;
+
+    struct Job
+    {
+        const HDF5ImageDataset *poGDS = nullptr;
+        GDALRasterBlock *poBlock = nullptr;
+        std::vector<GByte> abyRaw{};
+        uint32_t nFilterMask = 0;
+        std::atomic<bool> *pbSuccess = nullptr;
+    };
+
+    std::vector<Job> asJobs;
+    asJobs.reserve(static_cast<size_t>(nBlocks));
+    for (int iY = nBlockYStart; iY <= nBlockYEnd; ++iY)
+    {
+        for (int iX = nBlockXStart; iX <= nBlockXEnd; ++iX)
+        {
+            GDALRasterBlock *poBlock = TryGetLockedBlockRef(iX, iY);
+            if (poBlock)
+            {
+                // Already cached
+                poBlock->DropLock();
+                continue;
+            }
+            GDALRasterBlock::EnterDisableDirtyBlockFlush();
+            poBlock = GetLockedBlockRef(iX, iY, TRUE);
+            GDALRasterBlock::LeaveDisableDirtyBlockFlush();
+            if (poBlock == nullptr)
+                break;
+            Job sJob;
+            sJob.poGDS = poGDS;
+            sJob.poBlock = poBlock;
+            asJobs.push_back(std::move(sJob));
+        }
+    }
+
+    std::atomic<bool> bSuccess(true);
+    const auto DecodeJob = [](void *pData)
+    {
+        Job *psJob = static_cast<Job *>(pData);
+        if (!psJob->poGDS->DecodeRawChunk(psJob->abyRaw, psJob->nFilterMask,
+                                          psJob->poBlock->GetDataRef()))
+        {
+            *(psJob->pbSuccess) = false;
+        }
+    };
+
+    auto poQueue = poPool->CreateJobQueue();
+    for (auto &sJob : asJobs)
+    {
+        const int iX = sJob.poBlock->GetXOff();
+        const int iY = sJob.poBlock->GetYOff();
+        if (!poGDS->ReadRawChunk(nBand, iX, iY, sJob.abyRaw, sJob.nFilterMask))
+        {
+            // Unallocated chunk for example: let IReadBlock() deal with it
+            if (IReadBlock(iX, iY, sJob.poBlock->GetDataRef()) != CE_None)
+                bSuccess = false;
+            continue;
+        }
+        sJob.pbSuccess = &bSuccess;
+        poQueue->SubmitJob(DecodeJob, &sJob);
+    }
+    poQueue->WaitCompletion();
+
+    for (auto &sJob : asJobs)
+    {
+        const int iX = sJob.poBlock->GetXOff();
+        const int iY = sJob.poBlock->GetYOff();
+        sJob.poBlock->DropLock();
+        // Do not leave undecoded blocks in the cache.
+        if (!bSuccess)
+            FlushBlock(iX, iY, FALSE);
+    }
+    if (!bSuccess)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Cannot decode chunks of window (%d, %d, %d, %d)", nXOff,
+                 nYOff, nXSize, nYSize);
+    }
+    return bSuccess;
+}
+
 /************************************************************************/
 /*                             IRasterIO()                              */
 /************************************************************************/
@@ -660,6 +837,24 @@ CPLErr HDF5ImageRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
         }
     }
 
+    // Decode the chunks intersecting the request with several threads, and
+    // then read from the block cache.
+    if (eRWFlag == GF_Read && poGDS->m_bDirectChunkRead &&
+        m_nIRasterIORecCounter == 0 && nXSize == nBufXSize &&
+        nYSize == nBufYSize &&
+        (nXOff / nBlockXSize != (nXOff + nXSize - 1) / nBlockXSize ||
+         nYOff / nBlockYSize != (nYOff + nYSize - 1) / nBlockYSize))
+    {
+        const int nThreads = HDF5GetNumThreadsForRead();
+        if (nThreads > 1 &&
+            ReadChunksInParallel(nXOff, nYOff, nXSize, nYSize, nThreads))
+        {
+            return GDALPamRasterBand::IRasterIO(
+                eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize,
+                nBufYSize, eBufType, nPixelSpace, nLineSpace, psExtraArg);
+        }
+    }
+
     const bool bIsExpectedLayout =
         (bIsBandInterleavedData ||
          (poGDS->ndims == 2 && poGDS->GetYIndex() == 0 &&
@@ -919,6 +1114,260 @@ CPLErr HDF5ImageDataset::IRasterIO(
                                   nBandSpace, psExtraArg);
 }
 
+/************************************************************************/
+/*                           SetChunkCache()                            */
+/************************************************************************/
+
+// By default, libhdf5 uses a 1 MB chunk cache per dataset. Chunks larger than
+// that are not cached, and are decompressed again by each request that
+// intersects them (e.g. each scanline). So reopen the dataset with a chunk
+// cache large enough to hold a row of chunks, within the limits of the GDAL
+// block cache.
+void HDF5ImageDataset::SetChunkCache(const hsize_t *panChunkDims)
+{
+    GIntBig nChunkBytes = static_cast<GIntBig>(size);
+    for (int i = 0; i < ndims; ++i)
+        nChunkBytes *= static_cast<GIntBig>(panChunkDims[i]);
+    if (nChunkBytes <= 0)
+        return;
+
+    GIntBig nCacheSize = std::min(
+        nChunkBytes * DIV_ROUND_UP(nRasterXSize, m_nBlockXSize),
+        GDALGetCacheMax64() / 4);
+    const char *pszCacheSize =
+        CPLGetConfigOption("HDF5_CHUNK_CACHE_SIZE", nullptr);
+    if (pszCacheSize)
+        nCacheSize = CPLAtoGIntBig(pszCacheSize);
+
+    constexpr GIntBig DEFAULT_HDF5_CHUNK_CACHE_SIZE = 1024 * 1024;
+    if (nCacheSize <= DEFAULT_HDF5_CHUNK_CACHE_SIZE && !pszCacheSize)
+        return;
+
+    const hid_t hDAPL = H5Pcreate(H5P_DATASET_ACCESS);
+    if (hDAPL < 0)
+        return;
+    // libhdf5 recommends about 100 times more hash slots than the number of
+    // chunks that fit in the cache.
+    const GIntBig nChunksInCache = std::max<GIntBig>(
+        1, std::min<GIntBig>(nCacheSize / nChunkBytes, 10000));
+    const hid_t hNewDataset =
+        H5Pset_chunk_cache(hDAPL, static_cast<size_t>(nChunksInCache * 100 + 1),
+                           static_cast<size_t>(nCacheSize),
+                           H5D_CHUNK_CACHE_W0_DEFAULT) < 0
+            ? -1
+            : H5Dopen2(m_hHDF5, poH5Objects->pszPath, hDAPL);
+    H5Pclose(hDAPL);
+    if (hNewDataset >= 0)
+    {
+        CPLDebug("HDF5", "Using a chunk cache of " CPL_FRMT_GIB " bytes",
+                 nCacheSize);
+        H5Dclose(dataset_id);
+        dataset_id = hNewDataset;
+    }
+}
+
+/************************************************************************/
+/*                       DetectDirectChunkRead()                        */
+/************************************************************************/
+
+// Checks if the chunks of the dataset can be read with H5Dread_chunk() and
+// decoded by GDAL: the blocks must have the layout of the chunks, the values
+// must be stored in the native data type, and the filter pipeline must only
+// consist of filters for which GDAL has a decoder.
+void HDF5ImageDataset::DetectDirectChunkRead(hid_t listid)
+{
+#ifdef HAVE_H5DREAD_CHUNK
+    if (!CPLTestBool(CPLGetConfigOption("HDF5_DIRECT_CHUNK_READ", "YES")))
+        return;
+    if (IsComplexCSKL1A() || GetYIndex() < 0 || GetYIndex() > GetXIndex() ||
+        !(ndims == 2 || (ndims == 3 && m_nBandChunkSize == 1)))
+    {
+        return;
+    }
+    const GDALDataType eDT = GetDataType(native);
+    if (eDT == GDT_Unknown || H5Tequal(datatype, native) <= 0 ||
+        static_cast<hsize_t>(GDALGetDataTypeSizeBytes(eDT)) != size)
+    {
+        return;
+    }
+
+    std::vector<H5Z_filter_t> anFilters;
+    const int nFilters = H5Pget_nfilters(listid);
+    for (int i = 0; i < nFilters; ++i)
+    {
+        unsigned int flags = 0;
+        size_t cd_nelmts = 1;
+        unsigned int cd_values[1] = {0};
+        char szName[64 + 1] = {0};
+        const auto eFilter = H5Pget_filter(listid, i, &flags, &cd_nelmts,
+                                           cd_values, 64, szName);
+        if (eFilter == H5Z_FILTER_DEFLATE)
+        {
+            if (CPLGetDecompressor("zlib") == nullptr)
+                return;
+        }
+        else if (eFilter == H5Z_FILTER_SHUFFLE)
+        {
+            // cd_values[0] is the element size
+            if (cd_nelmts < 1 || cd_values[0] != size)
+                return;
+        }
+        else
+        {
+            return;
+        }
+        anFilters.push_back(eFilter);
+    }
+
+    m_anChunkFilters = std::move(anFilters);
+    m_nChunkBytes = static_cast<size_t>(m_nBlockXSize) * m_nBlockYSize *
+                    static_cast<size_t>(size);
+    m_bDirectChunkRead = true;
+#else
+    CPL_IGNORE_RET_VAL(listid);
+#endif
+}
+
+/************************************************************************/
+/*                           ReadRawChunk()                             */
+/************************************************************************/
+
+// Reads the (compressed) chunk of a block with H5Dread_chunk(). Returns false
+// if it cannot be read that way, for example if it is not allocated.
+bool HDF5ImageDataset::ReadRawChunk(int nBand, int nBlockXOff, int nBlockYOff,
+                                    std::vector<GByte> &abyRaw,
+                                    uint32_t &nFilterMask)
+{
+#ifdef HAVE_H5DREAD_CHUNK
+    HDF5_GLOBAL_LOCK();
+
+    hsize_t anOffset[3] = {0, 0, 0};
+    anOffset[GetXIndex()] = static_cast<hsize_t>(nBlockXOff) * m_nBlockXSize;
+    anOffset[GetYIndex()] = static_cast<hsize_t>(nBlockYOff) * m_nBlockYSize;
+    if (ndims == 3)
+        anOffset[m_nOtherDimIndex] = nBand - 1;
+
+    hsize_t nStorageSize = 0;
+    if (H5Dget_chunk_storage_size(dataset_id, anOffset, &nStorageSize) < 0 ||
+        nStorageSize == 0 ||
+        nStorageSize > std::numeric_limits<size_t>::max() / 2)
+    {
+        return false;
+    }
+    try
+    {
+        abyRaw.resize(static_cast<size_t>(nStorageSize));
+    }
+    catch (const std::exception &)
+    {
+        return false;
+    }
+    nFilterMask = 0;
+    return H5Dread_chunk(dataset_id, H5P_DEFAULT, anOffset, &nFilterMask,
+                         abyRaw.data()) >= 0;
+#else
+    CPL_IGNORE_RET_VAL(nBand);
+    CPL_IGNORE_RET_VAL(nBlockXOff);
+    CPL_IGNORE_RET_VAL(nBlockYOff);
+    CPL_IGNORE_RET_VAL(abyRaw);
+    CPL_IGNORE_RET_VAL(nFilterMask);
+    return false;
+#endif
+}
+
+/************************************************************************/
+/*                           HDF5Unshuffle()                            */
+/************************************************************************/
+
+// Reverts the HDF5 shuffle filter, which stores the first byte of all
+// elements, then their second byte, etc. Trailing bytes that do not form a
+// whole element are left as they are.
+static void HDF5Unshuffle(const GByte *pabySrc, GByte *pabyDst, size_t nBytes,
+                          size_t nEltSize)
+{
+    const size_t nElts = nBytes / nEltSize;
+    for (size_t j = 0; j < nEltSize; ++j)
+    {
+        for (size_t i = 0; i < nElts; ++i)
+            pabyDst[i * nEltSize + j] = pabySrc[j * nElts + i];
+    }
+    memcpy(pabyDst + nElts * nEltSize, pabySrc + nElts * nEltSize,
+           nBytes - nElts * nEltSize);
+}
+
+/************************************************************************/
+/*                          DecodeRawChunk()                            */
+/************************************************************************/
+
+// Undoes the filters of a chunk read by ReadRawChunk(), into pDst, which must
+// be m_nChunkBytes large. Does not take the HDF5 lock, and may be called from
+// several threads at once.
+bool HDF5ImageDataset::DecodeRawChunk(const std::vector<GByte> &abyRaw,
+                                      uint32_t nFilterMask, void *pDst) const
+{
+    // Filters to undo, in the reverse order of their application. Bit i of
+    // nFilterMask is set if filter i was skipped when writing that chunk.
+    std::vector<H5Z_filter_t> anFilters;
+    for (size_t i = m_anChunkFilters.size(); i > 0;)
+    {
+        --i;
+        if ((nFilterMask & (1U << i)) == 0)
+            anFilters.push_back(m_anChunkFilters[i]);
+    }
+
+    const GByte *pabyIn = abyRaw.data();
+    size_t nInSize = abyRaw.size();
+    std::vector<GByte> aabyTmp[2];
+    for (size_t i = 0; i < anFilters.size(); ++i)
+    {
+        GByte *pabyOut = static_cast<GByte *>(pDst);
+        if (i + 1 < anFilters.size())
+        {
+            try
+            {
+                aabyTmp[i % 2].resize(m_nChunkBytes);
+            }
+            catch (const std::exception &)
+            {
+                return false;
+            }
+            pabyOut = aabyTmp[i % 2].data();
+        }
+
+        if (anFilters[i] == H5Z_FILTER_DEFLATE)
+        {
+            const CPLCompressor *psDecompressor = CPLGetDecompressor("zlib");
+            void *pOut = pabyOut;
+            size_t nOutSize = m_nChunkBytes;
+            if (psDecompressor == nullptr ||
+                !psDecompressor->pfnFunc(pabyIn, nInSize, &pOut, &nOutSize,
+                                         nullptr, psDecompressor->user_data) ||
+                nOutSize != m_nChunkBytes)
+            {
+                return false;
+            }
+        }
+        else
+        {
+            CPLAssert(anFilters[i] == H5Z_FILTER_SHUFFLE);
+            if (nInSize != m_nChunkBytes)
+                return false;
+            HDF5Unshuffle(pabyIn, pabyOut, m_nChunkBytes,
+                          static_cast<size_t>(size));
+        }
+        pabyIn = pabyOut;
+        nInSize = m_nChunkBytes;
+    }
+
+    if (anFilters.empty())
+    {
+        if (nInSize != m_nChunkBytes)
+            return false;
+        memcpy(pDst, pabyIn, m_nChunkBytes);
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                                Open()                                */
 /************************************************************************/
@@ -1213,6 +1662,9 @@ GDALDataset *HDF5ImageDataset::Open(GDALOpenInfo *poOpenInfo)
                                       CPLSPrintf("%d", poDS->m_nBandChunkSize),
                                       "IMAGE_STRUCTURE");
             }
+
+            poDS->SetChunkCache(panChunkDims);
+            poDS->DetectDirectChunkRead(listid);
         }
 
         const int nFilters = H5Pget_nfilters(listid);
@@ -139,6 +139,7 @@ void JPEGDriverSetCommonMetadata(GDALDriver *poDriver)
     poDriver->SetMetadataItem(GDAL_DMD_HELPTOPIC, "drivers/raster/jpeg.html");
     poDriver->SetMetadataItem(GDAL_DMD_EXTENSION, "jpg");
     poDriver->SetMetadataItem(GDAL_DMD_EXTENSIONS, "jpg jpeg");
+    poDriver->SetMetadataItem(GDAL_DMD_MAGIC_BYTES, "FFD8FF");
     poDriver->SetMetadataItem(GDAL_DMD_MIMETYPE, "image/jpeg");
 
 #if defined(JPEG_LIB_MK1_OR_12BIT) || defined(JPEG_DUAL_MODE_8_12)
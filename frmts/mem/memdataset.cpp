@@ -47,6 +47,11 @@
 #include "cpl_vsi.h"
 #include "gdal.h"
 #include "gdal_frmts.h"
+#include "gdal_thread_pool.h"
+
+#ifdef HAVE_MMAP
+#include <sys/mman.h>
+#endif
 
 struct MEMDataset::Private
 {
@@ -148,7 +153,12 @@ MEMRasterBand::~MEMRasterBand()
 {
     if (bOwnData)
     {
-        VSIFree(pabyData);
+#ifdef HAVE_MMAP
+        if (m_nMMapSize)
+            munmap(pabyData, m_nMMapSize);
+        else
+#endif
+            VSIFree(pabyData);
     }
 }
 
@@ -1224,6 +1234,100 @@ GDALDataset *MEMDataset::Open(GDALOpenInfo *poOpenInfo)
     return poDS;
 }
 
+/************************************************************************/
+/*                          MEMAllocateBuffer()                         */
+/************************************************************************/
+
+// Allocates a zero-initialized buffer, backed by transparent huge pages
+// when bUseHugePages is set and the platform supports it. In that case,
+// nMMapSizeOut is set to nSize, and the buffer must be freed with munmap().
+static GByte *MEMAllocateBuffer(size_t nSize, bool bUseHugePages,
+                                size_t &nMMapSizeOut)
+{
+    nMMapSizeOut = 0;
+    if (bUseHugePages)
+    {
+#if defined(HAVE_MMAP) && defined(MADV_HUGEPAGE)
+        // Anonymous mappings are zero-initialized
+        void *pData = mmap(nullptr, nSize, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (pData == MAP_FAILED)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate " CPL_FRMT_GUIB " bytes",
+                     static_cast<GUIntBig>(nSize));
+            return nullptr;
+        }
+        if (madvise(pData, nSize, MADV_HUGEPAGE) != 0)
+        {
+            CPLDebug("MEM", "madvise(MADV_HUGEPAGE) failed");
+        }
+        nMMapSizeOut = nSize;
+        return static_cast<GByte *>(pData);
+#else
+        CPLError(CE_Warning, CPLE_NotSupported,
+                 "USE_HUGE_PAGES=YES is not supported on this platform");
+#endif
+    }
+    return static_cast<GByte *>(VSI_CALLOC_VERBOSE(1, nSize));
+}
+
+/************************************************************************/
+/*                          MEMFirstTouchInit()                         */
+/************************************************************************/
+
+// Writes the nSegments consecutive segments of nSegmentSize bytes of
+// pabyData from nThreads threads, each thread taking care of the same
+// fraction of each segment. With the first-touch memory placement policy of
+// operating systems, this spreads the physical pages of each band over the
+// NUMA nodes of the threads, instead of putting them all on the node of the
+// thread that would first fill the dataset.
+static void MEMFirstTouchInit(GByte *pabyData, size_t nSegmentSize,
+                              int nSegments, int nThreads)
+{
+    CPLWorkerThreadPool *poPool = GDALGetGlobalThreadPool(nThreads);
+    auto poQueue = poPool ? poPool->CreateJobQueue() : nullptr;
+    if (!poQueue)
+        return;
+
+    struct JobStruct
+    {
+        GByte *pabyData = nullptr;
+        size_t nSegmentSize = 0;
+        int nSegments = 0;
+        size_t nStart = 0;
+        size_t nEnd = 0;
+    };
+
+    const auto JobFunc = [](void *pData)
+    {
+        const JobStruct *psJob = static_cast<const JobStruct *>(pData);
+        for (int i = 0; i < psJob->nSegments; ++i)
+        {
+            // The buffer is already zero-initialized: this is just to
+            // touch its pages
+            memset(psJob->pabyData + i * psJob->nSegmentSize + psJob->nStart,
+                   0, psJob->nEnd - psJob->nStart);
+        }
+    };
+
+    std::vector<JobStruct> asJobs(nThreads);
+    for (int i = 0; i < nThreads; ++i)
+    {
+        auto &sJob = asJobs[i];
+        sJob.pabyData = pabyData;
+        sJob.nSegmentSize = nSegmentSize;
+        sJob.nSegments = nSegments;
+        sJob.nStart = static_cast<size_t>(static_cast<GUIntBig>(nSegmentSize) *
+                                          i / nThreads);
+        sJob.nEnd = static_cast<size_t>(static_cast<GUIntBig>(nSegmentSize) *
+                                        (i + 1) / nThreads);
+        if (!poQueue->SubmitJob(JobFunc, &sJob))
+            JobFunc(&sJob);
+    }
+    poQueue->WaitCompletion();
+}
+
 /************************************************************************/
 /*                               Create()                               */
 /************************************************************************/
@@ -1270,16 +1374,37 @@ MEMDataset *MEMDataset::Create(const char * /* pszFilename */, int nXSize,
     }
 #endif
 
+    const bool bUseHugePages =
+        CPLTestBool(CSLFetchNameValueDef(papszOptions, "USE_HUGE_PAGES", "NO"));
+    int nInitThreads = 1;
+    pszOption = CSLFetchNameValue(papszOptions, "NUM_THREADS");
+    if (pszOption)
+    {
+        nInitThreads =
+            EQUAL(pszOption, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszOption);
+        nInitThreads = std::max(1, std::min(1024, nInitThreads));
+    }
+
     std::vector<GByte *> apbyBandData;
+    size_t nMMapSize = 0;
     if (nBandsIn > 0)
     {
         GByte *pabyData =
-            static_cast<GByte *>(VSI_CALLOC_VERBOSE(1, nGlobalSize));
+            MEMAllocateBuffer(nGlobalSize, bUseHugePages, nMMapSize);
         if (!pabyData)
         {
             return nullptr;
         }
 
+        if (nInitThreads > 1)
+        {
+            if (bPixelInterleaved)
+                MEMFirstTouchInit(pabyData, nGlobalSize, 1, nInitThreads);
+            else
+                MEMFirstTouchInit(pabyData, nGlobalSize / nBandsIn, nBandsIn,
+                                  nInitThreads);
+        }
+
         if (bPixelInterleaved)
         {
             for (int iBand = 0; iBand < nBandsIn; iBand++)
@@ -1328,6 +1453,8 @@ MEMDataset *MEMDataset::Create(const char * /* pszFilename */, int nXSize,
         else
             poNewBand = new MEMRasterBand(poDS, iBand + 1, apbyBandData[iBand],
                                           eType, 0, 0, iBand == 0);
+        if (iBand == 0)
+            poNewBand->m_nMMapSize = nMMapSize;
 
         poDS->SetBand(iBand + 1, poNewBand);
     }
@@ -3152,6 +3279,12 @@ void GDALRegister_MEM()
         "       <Value>BAND</Value>"
         "       <Value>PIXEL</Value>"
         "   </Option>"
+        "   <Option name='USE_HUGE_PAGES' type='boolean' default='NO' "
+        "description='Whether to back the pixel buffer with transparent huge "
+        "pages (Linux only)'/>"
+        "   <Option name='NUM_THREADS' type='string' default='1' "
+        "description='Number of threads (or ALL_CPUS) used to initialize the "
+        "pixel buffer, so that its pages are spread over NUMA nodes'/>"
         "</CreationOptionList>");
 
     // Define GDAL_NO_OPEN_FOR_MEM_DRIVER macro to undefine Open() method for
@@ -154,6 +154,9 @@ class CPL_DLL MEMRasterBand CPL_NON_FINAL : public GDALPamRasterBand
     GSpacing nLineOffset;
     int bOwnData;
 
+    //! If not 0, size of pabyData, which has been allocated with mmap()
+    size_t m_nMMapSize = 0;
+
     bool m_bIsMask = false;
 
   public:
@@ -69,6 +69,7 @@
 
 #include "marfa.h"
 #include <setjmp.h>
+#include <algorithm>
 #include <vector>
 
 CPL_C_START
@@ -505,21 +506,23 @@ static void ProgressMonitor(j_common_ptr cinfo)
 
 // Returns the number of zero pixels, as well as clearing those bits int the
 // mask
-template <typename T> static void apply_mask(MRFJPEGStruct &sJ, T *s, int nc)
+// The data can be at 1/scale of the mask resolution
+template <typename T>
+static void apply_mask(MRFJPEGStruct &sJ, T *s, int nc, int scale = 1)
 {
     if (NO_MASK == sJ.mask_state)
         return;
 
     BitMask *mask = sJ.mask;
-    int w = mask->getWidth();
-    int h = mask->getHeight();
+    int w = mask->getWidth() / scale;
+    int h = mask->getHeight() / scale;
 
     if (MASK_LOADED == sJ.mask_state)
     {  // Partial map
         for (int y = 0; y < h; y++)
             for (int x = 0; x < w; x++)
             {
-                if (mask->isSet(x, y))
+                if (mask->isSet(x * scale, y * scale))
                 {  // Non zero pixel
                     for (int c = 0; c < nc; c++, s++)
                     {
@@ -611,9 +614,10 @@ static boolean MaskProcessor(j_decompress_ptr pcinfo)
  * @param sz if non-zero, test that uncompressed data fits in the buffer.
  */
 #if defined(JPEG12_ON)
-CPLErr JPEG_Codec::DecompressJPEG12(buf_mgr &dst, const buf_mgr &isrc)
+CPLErr JPEG_Codec::DecompressJPEG12(buf_mgr &dst, const buf_mgr &isrc,
+                                    int scale)
 #else
-CPLErr JPEG_Codec::DecompressJPEG(buf_mgr &dst, const buf_mgr &isrc)
+CPLErr JPEG_Codec::DecompressJPEG(buf_mgr &dst, const buf_mgr &isrc, int scale)
 #endif
 
 {
@@ -715,8 +719,16 @@ CPLErr JPEG_Codec::DecompressJPEG(buf_mgr &dst, const buf_mgr &isrc)
     if (nbands == 1 && cinfo.num_components != nbands)
         cinfo.out_color_space = JCS_GRAYSCALE;
 
+    // Reduced resolution decoding, in the DCT domain
+    if (scale > 1)
+    {
+        cinfo.scale_num = 1;
+        cinfo.scale_denom = scale;
+    }
+    jpeg_calc_output_dimensions(&cinfo);
+
     const int datasize = ((cinfo.data_precision == 8) ? 1 : 2);
-    if (cinfo.image_width >
+    if (cinfo.output_width >
         static_cast<unsigned>(INT_MAX / (nbands * datasize)))
     {
         CPLError(CE_Failure, CPLE_AppDefined,
@@ -724,21 +736,21 @@ CPLErr JPEG_Codec::DecompressJPEG(buf_mgr &dst, const buf_mgr &isrc)
         jpeg_destroy_decompress(&cinfo);
         return CE_Failure;
     }
-    int linesize = cinfo.image_width * nbands * datasize;
+    int linesize = cinfo.output_width * nbands * datasize;
 
     // We have a mismatch between the real and the declared data format
     // warn and fail if output buffer is too small
-    if (linesize > static_cast<int>(INT_MAX / cinfo.image_height))
+    if (linesize > static_cast<int>(INT_MAX / cinfo.output_height))
     {
         CPLError(CE_Failure, CPLE_AppDefined,
                  "MRF: JPEG decompress buffer overflow");
         jpeg_destroy_decompress(&cinfo);
         return CE_Failure;
     }
-    if (static_cast<size_t>(linesize) * cinfo.image_height != dst.size)
+    if (static_cast<size_t>(linesize) * cinfo.output_height != dst.size)
     {
         CPLError(CE_Warning, CPLE_AppDefined, "MRF: read JPEG size is wrong");
-        if (static_cast<size_t>(linesize) * cinfo.image_height > dst.size)
+        if (static_cast<size_t>(linesize) * cinfo.output_height > dst.size)
         {
             CPLError(CE_Failure, CPLE_AppDefined,
                      "MRF: JPEG decompress buffer overflow");
@@ -754,7 +766,7 @@ CPLErr JPEG_Codec::DecompressJPEG(buf_mgr &dst, const buf_mgr &isrc)
     jpeg_start_decompress(&cinfo);
 
     // Decompress, two lines at a time is what libjpeg does
-    while (cinfo.output_scanline < cinfo.image_height)
+    while (cinfo.output_scanline < cinfo.output_height)
     {
         char *rp[2];
         rp[0] = (char *)dst.buffer + linesize * cinfo.output_scanline;
@@ -777,10 +789,10 @@ CPLErr JPEG_Codec::DecompressJPEG(buf_mgr &dst, const buf_mgr &isrc)
     // Apply the mask
     if (datasize == 1)
         apply_mask(sJPEGStruct, reinterpret_cast<char *>(dst.buffer),
-                   img.pagesize.c);
+                   img.pagesize.c, scale);
     else
         apply_mask(sJPEGStruct, reinterpret_cast<GUInt16 *>(dst.buffer),
-                   img.pagesize.c);
+                   img.pagesize.c, scale);
 
     return CE_None;
 }
@@ -827,13 +839,18 @@ static size_t brunsli_fun_callback(void *out, const GByte *data, size_t size)
 
 // Type dependent dispachers
 CPLErr JPEG_Band::Decompress(buf_mgr &dst, buf_mgr &src)
+{
+    return Decompress(dst, src, 1);
+}
+
+CPLErr JPEG_Band::Decompress(buf_mgr &dst, buf_mgr &src, int scale)
 {
 #if defined(JPEG12_SUPPORTED)
     if (GDT_Byte != img.dt)
-        return codec.DecompressJPEG12(dst, src);
+        return codec.DecompressJPEG12(dst, src, scale);
 #endif
     if (!isbrunsli(src))
-        return codec.DecompressJPEG(dst, src);
+        return codec.DecompressJPEG(dst, src, scale);
 
         // Need conversion to JFIF first
 #if !defined(BRUNSLI)
@@ -855,7 +872,8 @@ CPLErr JPEG_Band::Decompress(buf_mgr &dst, buf_mgr &src)
     buf_mgr jfif_src;
     jfif_src.buffer = reinterpret_cast<char *>(out.data());
     jfif_src.size = out.size();
-    return Decompress(dst, jfif_src);  // Call itself with JFIF JPEG source
+    // Call itself with JFIF JPEG source
+    return Decompress(dst, jfif_src, scale);
 #endif  // BRUNSLI
 }
 
@@ -934,6 +952,236 @@ JPEG_Band::JPEG_Band(MRFDataset *pDS, const ILImage &image, int b, int level)
         codec.optimize = true;  // Required for 12bit
     }
 }
+
+JPEG_Band::~JPEG_Band()
+{
+    for (auto poOvr : implicit_ovr)
+        delete poOvr;
+}
+
+// JPEG pages can be decoded at 1/2, 1/4 or 1/8 of their size directly from
+// the DCT coefficients, which is much cheaper than decoding the full size
+// page and averaging.  When the MRF has no overviews, these are exposed as
+// implicit overviews
+void JPEG_Band::InitImplicitOverviews()
+{
+    if (implicit_ovr_init)
+        return;
+    implicit_ovr_init = true;
+
+    if (poMRFDS->GetAccess() != GA_ReadOnly || m_l != 0 || GDT_Byte != img.dt ||
+        dodeflate || dozstd || !poMRFDS->source.empty() ||
+        poMRFDS->bypass_cache ||
+        !CPLTestBool(CPLGetConfigOption("MRF_IMPLICIT_JPEG_OVR", "YES")))
+        return;
+
+    for (int scale = 2; scale <= 8; scale *= 2)
+    {
+        // The scaled page has to be a whole number of pixels
+        if (img.pagesize.x % scale != 0 || img.pagesize.y % scale != 0)
+            break;
+        // Stop when the previous level is small enough
+        if (nRasterXSize < 256 * scale / 2 && nRasterYSize < 256 * scale / 2)
+            break;
+        implicit_ovr.push_back(new JPEG_OverviewBand(this, scale));
+    }
+}
+
+int JPEG_Band::GetOverviewCount()
+{
+    int n = MRFRasterBand::GetOverviewCount();
+    if (n > 0)
+        return n;
+    InitImplicitOverviews();
+    return static_cast<int>(implicit_ovr.size());
+}
+
+GDALRasterBand *JPEG_Band::GetOverview(int n)
+{
+    if (MRFRasterBand::GetOverviewCount() > 0)
+        return MRFRasterBand::GetOverview(n);
+    InitImplicitOverviews();
+    if (n >= 0 && n < static_cast<int>(implicit_ovr.size()))
+        return implicit_ovr[n];
+    return nullptr;
+}
+
+// Reads and decodes one page at 1/scale.  buffers holds one destination per
+// band of the page, each one a block of the matching overview band
+CPLErr JPEG_Band::ReadScaledPage(int xblk, int yblk, int scale, void **buffers)
+{
+    const int cstride = img.pagesize.c;
+    const size_t npixels = static_cast<size_t>(img.pagesize.x / scale) *
+                           (img.pagesize.y / scale);
+
+    // Blocks without data are set to NoData, or zero
+    const auto FillBuffers = [&]()
+    {
+        int success = FALSE;
+        double ndv = GetNoDataValue(&success);
+        GByte val = success ? static_cast<GByte>(ndv) : 0;
+        for (int i = 0; i < cstride; i++)
+            if (buffers[i])
+                memset(buffers[i], val, npixels);
+        return CE_None;
+    };
+
+    ILIdx tinfo;
+    tinfo.size = 0;
+    ILSize req(xblk, yblk, 0, (nBand - 1) / cstride, m_l);
+    if (CE_None != poMRFDS->ReadTileIdx(tinfo, req, img))
+    {
+        if (!poMRFDS->no_errors)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "MRF: Unable to read index at offset " CPL_FRMT_GIB,
+                     IdxOffset(req, img));
+            return CE_Failure;
+        }
+        return FillBuffers();
+    }
+
+    if (0 == tinfo.size)
+        return FillBuffers();
+
+    // No stored tile should be larger than twice the raw size.
+    if (tinfo.size < 0 || tinfo.size > poMRFDS->pbsize * 2)
+    {
+        if (!poMRFDS->no_errors)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Stored tile is too large: " CPL_FRMT_GIB, tinfo.size);
+            return CE_Failure;
+        }
+        return FillBuffers();
+    }
+
+    VSILFILE *dfp = DataFP();
+    if (dfp == nullptr)
+        return CE_Failure;
+
+    std::vector<char> data;
+    std::vector<char> pixels;
+    try
+    {
+        data.resize(static_cast<size_t>(tinfo.size) + PADDING_BYTES);
+        if (cstride != 1)
+            pixels.resize(npixels * cstride);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Could not allocate memory for tile size: " CPL_FRMT_GIB,
+                 tinfo.size);
+        return CE_Failure;
+    }
+
+    VSIFSeekL(dfp, tinfo.offset, SEEK_SET);
+    if (1 != VSIFReadL(data.data(), static_cast<size_t>(tinfo.size), 1, dfp))
+    {
+        if (poMRFDS->no_errors)
+            return FillBuffers();
+        CPLError(CE_Failure, CPLE_AppDefined, "Unable to read data page, %d@%x",
+                 static_cast<int>(tinfo.size), static_cast<int>(tinfo.offset));
+        return CE_Failure;
+    }
+
+    buf_mgr src = {data.data(), static_cast<size_t>(tinfo.size)};
+    buf_mgr dst = {cstride == 1 ? static_cast<char *>(buffers[0])
+                                : pixels.data(),
+                   npixels * cstride};
+    CPLErr ret = Decompress(dst, src, scale);
+    if (ret != CE_None)
+    {
+        if (poMRFDS->no_errors)
+            return FillBuffers();
+        return ret;
+    }
+
+    // De-interleave the pixels into the overview blocks
+    if (cstride != 1)
+    {
+        for (int i = 0; i < cstride; i++)
+        {
+            if (!buffers[i])
+                continue;
+            GByte *out = static_cast<GByte *>(buffers[i]);
+            const char *in = pixels.data() + i;
+            for (size_t j = 0; j < npixels; j++, in += cstride)
+                out[j] = static_cast<GByte>(*in);
+        }
+    }
+    return CE_None;
+}
+
+JPEG_OverviewBand::JPEG_OverviewBand(JPEG_Band *base, int iscale)
+    : pBase(base), scale(iscale)
+{
+    nBand = base->GetBand();
+    eDataType = base->GetRasterDataType();
+    nRasterXSize = DIV_ROUND_UP(base->GetXSize(), scale);
+    nRasterYSize = DIV_ROUND_UP(base->GetYSize(), scale);
+    nBlockXSize = base->img.pagesize.x / scale;
+    nBlockYSize = base->img.pagesize.y / scale;
+}
+
+CPLErr JPEG_OverviewBand::IReadBlock(int xblk, int yblk, void *buffer)
+{
+    const int cstride = pBase->img.pagesize.c;
+    if (cstride == 1)
+        return pBase->ReadScaledPage(xblk, yblk, scale, &buffer);
+
+    // Interleaved page, fill in the blocks of the sibling overview bands too
+    GDALDataset *poBaseDS = pBase->GetDataset();
+    const int first = ((nBand - 1) / cstride) * cstride;
+    std::vector<void *> buffers(cstride, nullptr);
+    std::vector<GDALRasterBlock *> blocks;
+    const int level = static_cast<int>(
+        std::find(pBase->implicit_ovr.begin(), pBase->implicit_ovr.end(),
+                  this) -
+        pBase->implicit_ovr.begin());
+    for (int i = 0; i < cstride; i++)
+    {
+        if (first + i + 1 == nBand)
+        {
+            buffers[i] = buffer;
+            continue;
+        }
+        auto poBand = poBaseDS->GetRasterBand(first + i + 1);
+        auto poOvr = poBand ? poBand->GetOverview(level) : nullptr;
+        if (poOvr == nullptr)
+            continue;
+        // Skip the blocks already in the cache
+        GDALRasterBlock *poBlock = poOvr->TryGetLockedBlockRef(xblk, yblk);
+        if (poBlock != nullptr)
+        {
+            poBlock->DropLock();
+            continue;
+        }
+        GDALRasterBlock::EnterDisableDirtyBlockFlush();
+        poBlock = poOvr->GetLockedBlockRef(xblk, yblk, TRUE);
+        GDALRasterBlock::LeaveDisableDirtyBlockFlush();
+        if (poBlock == nullptr)
+            continue;
+        buffers[i] = poBlock->GetDataRef();
+        blocks.push_back(poBlock);
+    }
+
+    CPLErr ret = pBase->ReadScaledPage(xblk, yblk, scale, buffers.data());
+    for (auto poBlock : blocks)
+    {
+        // Don't leave uninitialized blocks in the cache
+        if (ret != CE_None)
+            poBlock->MarkClean();
+        poBlock->DropLock();
+        if (ret != CE_None)
+        {
+            poBlock->GetBand()->FlushBlock(poBlock->GetXOff(),
+                                           poBlock->GetYOff(), FALSE);
+        }
+    }
+    return ret;
+}
 #endif
 
 NAMESPACE_MRF_END
@@ -63,6 +63,8 @@
 #include "ogr_spatialref.h"
 
 #include <limits>
+#include <map>
+#include <vector>
 // For printing values
 #include <ostream>
 #include <iostream>
@@ -360,6 +362,7 @@ MRFRasterBand *newMRFRasterBand(MRFDataset *, const ILImage &, int,
 class MRFDataset final : public GDALPamDataset
 {
     friend class MRFRasterBand;
+    friend class JPEG_Band;
     friend MRFRasterBand *newMRFRasterBand(MRFDataset *, const ILImage &, int,
                                            int level);
 
@@ -520,6 +523,15 @@ class MRFDataset final : public GDALPamDataset
     CPLErr ReadTileIdx(ILIdx &tinfo, const ILSize &pos, const ILImage &img,
                        const GIntBig bias = 0);
 
+    // Read the stored data of a tile, returns false on failure
+    bool ReadTileData(void *buffer, const ILIdx &tinfo);
+
+    // Fetches the index records and the tile data of a read window in a few
+    // requests, when it covers more than one tile
+    void PrefetchTiles(int nXOff, int nYOff, int nXSize, int nYSize,
+                       int nBandCount, const int *panBandMap);
+    void ClearPrefetch();
+
     VSILFILE *IdxFP();
     VSILFILE *DataFP();
 
@@ -632,6 +644,13 @@ class MRFDataset final : public GDALPamDataset
 #endif
     // Time duration spend for decompression and compression
     std::chrono::nanoseconds read_timer, write_timer;
+
+    // Prefetched index records, by their offset in the index file
+    std::map<GIntBig, ILIdx> prefetched_idx{};
+    // Prefetched tile data, by tile offset in the data file, pointing within
+    // prefetch_buffers
+    std::map<GIntBig, std::pair<const char *, size_t>> prefetched_data{};
+    std::vector<std::vector<char>> prefetch_buffers{};
 };
 
 class MRFRasterBand CPL_NON_FINAL : public GDALPamRasterBand
@@ -848,14 +867,15 @@ class JPEG_Codec
     }
 
     CPLErr CompressJPEG(buf_mgr &dst, buf_mgr &src);
-    CPLErr DecompressJPEG(buf_mgr &dst, const buf_mgr &src);
+    // scale is the libjpeg scale_denom, 1, 2, 4 or 8
+    CPLErr DecompressJPEG(buf_mgr &dst, const buf_mgr &src, int scale = 1);
 
     // Returns true for both JPEG and JPEG-XL (brunsli)
     static bool IsJPEG(const buf_mgr &src);
 
 #if defined(JPEG12_SUPPORTED)  // Internal only
     CPLErr CompressJPEG12(buf_mgr &dst, buf_mgr &src);
-    CPLErr DecompressJPEG12(buf_mgr &dst, const buf_mgr &src);
+    CPLErr DecompressJPEG12(buf_mgr &dst, const buf_mgr &src, int scale = 1);
 #endif
 
     const ILImage img;
@@ -872,22 +892,69 @@ class JPEG_Codec
     JPEG_Codec &operator=(const JPEG_Codec &src);
 };
 
+class JPEG_OverviewBand;
+
 class JPEG_Band final : public MRFRasterBand
 {
     friend class MRFDataset;
+    friend class JPEG_OverviewBand;
 
   public:
     JPEG_Band(MRFDataset *pDS, const ILImage &image, int b, int level);
-
-    virtual ~JPEG_Band()
-    {
-    }
+    virtual ~JPEG_Band();
 
   protected:
     virtual CPLErr Decompress(buf_mgr &dst, buf_mgr &src) override;
     virtual CPLErr Compress(buf_mgr &dst, buf_mgr &src) override;
 
+    // Implicit overviews, when there are no other ones
+    virtual int GetOverviewCount() override;
+    virtual GDALRasterBand *GetOverview(int n) override;
+
     JPEG_Codec codec;
+
+  private:
+    CPLErr Decompress(buf_mgr &dst, buf_mgr &src, int scale);
+    // Decodes the page of a block at 1/scale resolution, into one buffer per
+    // band of the page, which can be null
+    CPLErr ReadScaledPage(int xblk, int yblk, int scale, void **buffers);
+    void InitImplicitOverviews();
+
+    bool implicit_ovr_init = false;
+    std::vector<JPEG_OverviewBand *> implicit_ovr{};
+};
+
+/*\brief Implicit overview of a JPEG band
+ *
+ * Decodes the pages of the full resolution band at 1/2, 1/4 or 1/8 of their
+ * size, using the DCT scaling of libjpeg. Its blocks match the full resolution
+ * ones.
+ */
+class JPEG_OverviewBand final : public GDALRasterBand
+{
+  public:
+    JPEG_OverviewBand(JPEG_Band *base, int scale);
+
+    virtual CPLErr IReadBlock(int xblk, int yblk, void *buffer) override;
+
+    virtual GDALColorInterp GetColorInterpretation() override
+    {
+        return pBase->GetColorInterpretation();
+    }
+
+    virtual GDALColorTable *GetColorTable() override
+    {
+        return pBase->GetColorTable();
+    }
+
+    virtual double GetNoDataValue(int *pbSuccess) override
+    {
+        return pBase->GetNoDataValue(pbSuccess);
+    }
+
+  private:
+    JPEG_Band *pBase;
+    int scale;
 };
 
 // A 2 or 4 band, with JPEG and/or PNG page encoding, optimized for size
@@ -212,14 +212,185 @@ CPLErr MRFDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
         return CE_Failure;
     }
 
+    // Full resolution reads of local MRFs fetch the index records and the
+    // tiles they need in a few requests, which matters on object storage
+    const bool bPrefetch = eRWFlag == GF_Read && eAccess == GA_ReadOnly &&
+                           source.empty() && !clonedSource &&
+                           nXSize == nBufXSize && nYSize == nBufYSize;
+    if (bPrefetch)
+        PrefetchTiles(nXOff, nYOff, nXSize, nYSize, nBandCount, panBandMap);
+
     //
     // Call the parent implementation, which splits it into bands and calls
     // their IRasterIO
     //
-    return GDALPamDataset::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
-                                     pData, nBufXSize, nBufYSize, eBufType,
-                                     nBandCount, panBandMap, nPixelSpace,
-                                     nLineSpace, nBandSpace, psExtraArgs);
+    CPLErr ret = GDALPamDataset::IRasterIO(
+        eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
+        eBufType, nBandCount, panBandMap, nPixelSpace, nLineSpace, nBandSpace,
+        psExtraArgs);
+
+    if (bPrefetch)
+        ClearPrefetch();
+    return ret;
+}
+
+/**
+ *\brief Fetch the index records and the tile data for a read window
+ *
+ * The index records of each row of tiles are contiguous, they are read with
+ * a single multi-range request. The tiles not already in the block cache are
+ * then read with another multi-range request, merging the ranges that are
+ * close, up to a quarter of the block cache size.
+ */
+void MRFDataset::PrefetchTiles(int nXOff, int nYOff, int nXSize, int nYSize,
+                               int nBandCount, const int *panBandMap)
+{
+    auto poBand = static_cast<MRFRasterBand *>(GetRasterBand(panBandMap[0]));
+    if (poBand->m_l != 0 || missing)
+        return;
+    const ILImage &img = poBand->img;
+    const int x0 = nXOff / img.pagesize.x;
+    const int x1 = (nXOff + nXSize - 1) / img.pagesize.x;
+    const int y0 = nYOff / img.pagesize.y;
+    const int y1 = (nYOff + nYSize - 1) / img.pagesize.y;
+    if (x0 == x1 && y0 == y1)
+        return;
+
+    VSILFILE *l_ifp = IdxFP();
+    if (l_ifp == nullptr)
+        return;
+
+    // Index records, one range for each row of tiles, all the bands
+    const int nRows = y1 - y0 + 1;
+    const size_t nRecords = static_cast<size_t>(x1 - x0 + 1) * img.pagecount.c;
+    vector<vector<ILIdx>> records(nRows);
+    vector<void *> apData(nRows);
+    vector<vsi_l_offset> anOffsets(nRows);
+    vector<size_t> anSizes(nRows);
+    try
+    {
+        for (int i = 0; i < nRows; i++)
+        {
+            records[i].resize(nRecords);
+            apData[i] = records[i].data();
+            anOffsets[i] = IdxOffset(ILSize(x0, y0 + i, 0, 0, 0), img);
+            anSizes[i] = nRecords * sizeof(ILIdx);
+        }
+    }
+    catch (const std::exception &)
+    {
+        return;
+    }
+    // On failure, let the regular read path report the errors
+    if (VSIFReadMultiRangeL(nRows, apData.data(), anOffsets.data(),
+                            anSizes.data(), l_ifp) != 0)
+        return;
+
+    // Tiles to read, by offset in the data file
+    const int cstride = img.pagesize.c;
+    std::map<GIntBig, size_t> tiles;
+    GIntBig nTotalSize = 0;
+    const GIntBig nMaxTotalSize = GDALGetCacheMax64() / 4;
+    for (int i = 0; i < nRows; i++)
+    {
+        for (size_t j = 0; j < nRecords; j++)
+        {
+            ILIdx tinfo = records[i][j];
+            tinfo.offset = net64(tinfo.offset);
+            tinfo.size = net64(tinfo.size);
+            prefetched_idx[static_cast<GIntBig>(anOffsets[i] +
+                                                j * sizeof(ILIdx))] = tinfo;
+
+            if (tinfo.size <= 0 || tinfo.size > pbsize * 2 ||
+                nTotalSize + tinfo.size > nMaxTotalSize)
+                continue;
+
+            // Only the pages of the requested bands
+            const int c = static_cast<int>(j % img.pagecount.c);
+            const int x = x0 + static_cast<int>(j / img.pagecount.c);
+            bool bRequested = false;
+            for (int k = 0; k < nBandCount && !bRequested; k++)
+                bRequested = (panBandMap[k] - 1) / cstride == c;
+            if (!bRequested)
+                continue;
+
+            // Skip the pages already decoded
+            GDALRasterBlock *poBlock =
+                GetRasterBand(c * cstride + 1)->TryGetLockedBlockRef(x, y0 + i);
+            if (poBlock != nullptr)
+            {
+                poBlock->DropLock();
+                continue;
+            }
+
+            if (tiles.insert({tinfo.offset, static_cast<size_t>(tinfo.size)})
+                    .second)
+                nTotalSize += tinfo.size;
+        }
+    }
+    if (tiles.size() < 2)
+        return;
+
+    VSILFILE *l_dfp = DataFP();
+    if (l_dfp == nullptr)
+        return;
+
+    // Merge the ranges that are close to each other
+    constexpr GIntBig MAX_GAP = 64 * 1024;
+    vector<std::pair<GIntBig, GIntBig>> ranges;  // start, end
+    for (const auto &oTile : tiles)
+    {
+        const GIntBig end = oTile.first + static_cast<GIntBig>(oTile.second);
+        if (!ranges.empty() && oTile.first <= ranges.back().second + MAX_GAP)
+            ranges.back().second = std::max(ranges.back().second, end);
+        else
+            ranges.emplace_back(oTile.first, end);
+    }
+
+    const int nRanges = static_cast<int>(ranges.size());
+    apData.resize(nRanges);
+    anOffsets.resize(nRanges);
+    anSizes.resize(nRanges);
+    try
+    {
+        prefetch_buffers.resize(nRanges);
+        for (int i = 0; i < nRanges; i++)
+        {
+            prefetch_buffers[i].resize(
+                static_cast<size_t>(ranges[i].second - ranges[i].first));
+            apData[i] = prefetch_buffers[i].data();
+            anOffsets[i] = static_cast<vsi_l_offset>(ranges[i].first);
+            anSizes[i] = prefetch_buffers[i].size();
+        }
+    }
+    catch (const std::exception &)
+    {
+        prefetch_buffers.clear();
+        return;
+    }
+    if (VSIFReadMultiRangeL(nRanges, apData.data(), anOffsets.data(),
+                            anSizes.data(), l_dfp) != 0)
+    {
+        prefetch_buffers.clear();
+        return;
+    }
+
+    int iRange = 0;
+    for (const auto &oTile : tiles)
+    {
+        while (oTile.first >= ranges[iRange].second)
+            iRange++;
+        const char *pData = prefetch_buffers[iRange].data() +
+                            (oTile.first - ranges[iRange].first);
+        prefetched_data[oTile.first] = {pData, oTile.second};
+    }
+}
+
+void MRFDataset::ClearPrefetch()
+{
+    prefetched_idx.clear();
+    prefetched_data.clear();
+    prefetch_buffers.clear();
 }
 
 /**
@@ -2522,6 +2693,28 @@ CPLErr MRFDataset::GetGeoTransform(double *gt)
     return CE_None;
 }
 
+/**
+ *\brief Read the stored data of a tile
+ *
+ * Uses the prefetched data when available
+ */
+bool MRFDataset::ReadTileData(void *buffer, const ILIdx &tinfo)
+{
+    auto it = prefetched_data.find(tinfo.offset);
+    if (it != prefetched_data.end() &&
+        it->second.second == static_cast<size_t>(tinfo.size))
+    {
+        memcpy(buffer, it->second.first, it->second.second);
+        return true;
+    }
+
+    VSILFILE *l_dfp = DataFP();
+    if (l_dfp == nullptr)
+        return false;
+    VSIFSeekL(l_dfp, tinfo.offset, SEEK_SET);
+    return 1 == VSIFReadL(buffer, static_cast<size_t>(tinfo.size), 1, l_dfp);
+}
+
 /**
  *\brief Read a tile index
  *
@@ -2564,6 +2757,17 @@ CPLErr MRFDataset::ReadTileIdx(ILIdx &tinfo, const ILSize &pos,
         return CE_Failure;
     }
 
+    // Index records fetched ahead, in native form
+    if (0 == bias && !prefetched_idx.empty())
+    {
+        auto it = prefetched_idx.find(offset);
+        if (it != prefetched_idx.end())
+        {
+            tinfo = it->second;
+            return CE_None;
+        }
+    }
+
     VSIFSeekL(l_ifp, offset, SEEK_SET);
     if (1 != VSIFReadL(&tinfo, sizeof(ILIdx), 1, l_ifp))
         return CE_Failure;
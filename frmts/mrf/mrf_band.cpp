@@ -222,6 +222,17 @@ static int ZPack(const buf_mgr &src, buf_mgr &dst, int flags)
 // Return true if it worked
 static int ZUnPack(const buf_mgr &src, buf_mgr &dst, int flags)
 {
+    // zlib and gzip streams are decoded in one shot by CPLZLibInflate(),
+    // which uses libdeflate when available
+    if (!(ZFLAG_RAW & flags))
+    {
+        size_t nOutBytes = 0;
+        if (CPLZLibInflate(src.buffer, src.size, dst.buffer, dst.size,
+                           &nOutBytes) == nullptr)
+            return false;
+        dst.size = nOutBytes;
+        return true;
+    }
 
     z_stream stream;
     int err;
@@ -232,9 +243,8 @@ static int ZUnPack(const buf_mgr &src, buf_mgr &dst, int flags)
     stream.next_out = (Bytef *)dst.buffer;
     stream.avail_out = (uInt)dst.size;
 
-    // 32 means autodetec gzip or zlib header, negative 15 is for raw
-    int wb = (ZFLAG_RAW & flags) ? -MAX_WBITS : 32 + MAX_WBITS;
-    err = inflateInit2(&stream, wb);
+    // negative 15 is for raw
+    err = inflateInit2(&stream, -MAX_WBITS);
     if (err != Z_OK)
         return false;
 
@@ -1065,8 +1075,7 @@ CPLErr MRFRasterBand::IReadBlock(int xblk, int yblk, void *buffer)
     }
 
     // This part is not thread safe, but it is what GDAL expects
-    VSIFSeekL(dfp, tinfo.offset, SEEK_SET);
-    if (1 != VSIFReadL(data, static_cast<size_t>(tinfo.size), 1, dfp))
+    if (!poMRFDS->ReadTileData(data, tinfo))
     {
         CPLFree(data);
         if (poMRFDS->no_errors)
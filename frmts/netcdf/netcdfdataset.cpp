@@ -238,7 +238,21 @@ class netCDFRasterBand final : public GDALPamRasterBand
                       size_t nTmpBlockYSize, bool bCheckIsNan = false);
     void SetBlockSize();
 
+    void CheckBlockData(void *pImage, void *pImageNC, size_t nTmpBlockXSize,
+                        size_t nTmpBlockYSize);
+    int ReadNetcdfArray(const size_t *start, const size_t *edge,
+                        void *pBuffer);
+
     bool FetchNetcdfChunk(size_t xstart, size_t ystart, void *pImage);
+    bool FetchNetcdfChunk(size_t xstart, size_t ystart, int nFirstLevel,
+                          int nLevelCount, void *const *papImages,
+                          netCDFRasterBand *const *papoBands);
+
+    // Size of the netCDF-4 chunks along the z dimension of 3D variables
+    // (1 if not chunked, or not a 3D variable)
+    int m_nZChunkSize = 1;
+    bool FetchCoalescedLevels(size_t xstart, size_t ystart, int nBlockXOff,
+                              int nBlockYOff, void *pImage);
 
     void SetNoDataValueNoUpdate(double dfNoData);
     void SetNoDataValueNoUpdate(int64_t nNoData);
@@ -861,6 +875,11 @@ void netCDFRasterBand::SetBlockSize()
                 nBlockYSize = (int)chunksize[nZDim - 2];
             else
                 nBlockYSize = 1;
+            // Only worth coalescing level reads when z is the outermost
+            // dimension, so that levels are contiguous in a read buffer.
+            if (nZDim == 3 && panBandZPos && panBandZPos[0] == 0 &&
+                chunksize[0] > 1)
+                m_nZChunkSize = static_cast<int>(chunksize[0]);
         }
     }
 
@@ -2288,12 +2307,197 @@ void netCDFRasterBand::CheckDataCpx(void *pImage, void *pImageNC,
     }
 }
 
+/************************************************************************/
+/*                          ReadNetcdfArray()                           */
+/************************************************************************/
+
+// Reads the [start, start + edge[ hyperslab of the variable into pBuffer,
+// with the netCDF API function matching the band data type.
+int netCDFRasterBand::ReadNetcdfArray(const size_t *start, const size_t *edge,
+                                      void *pBuffer)
+{
+    if (eDataType == GDT_Byte)
+    {
+        if (bSignedData)
+            return nc_get_vara_schar(cdfid, nZId, start, edge,
+                                     static_cast<signed char *>(pBuffer));
+        return nc_get_vara_uchar(cdfid, nZId, start, edge,
+                                 static_cast<unsigned char *>(pBuffer));
+    }
+    else if (eDataType == GDT_Int8)
+    {
+        return nc_get_vara_schar(cdfid, nZId, start, edge,
+                                 static_cast<signed char *>(pBuffer));
+    }
+    else if (nc_datatype == NC_SHORT)
+    {
+        return nc_get_vara_short(cdfid, nZId, start, edge,
+                                 static_cast<short *>(pBuffer));
+    }
+    else if (eDataType == GDT_Int32)
+    {
+#if SIZEOF_UNSIGNED_LONG == 4
+        return nc_get_vara_long(cdfid, nZId, start, edge,
+                                static_cast<long *>(pBuffer));
+#else
+        return nc_get_vara_int(cdfid, nZId, start, edge,
+                               static_cast<int *>(pBuffer));
+#endif
+    }
+    else if (eDataType == GDT_Float32)
+    {
+        return nc_get_vara_float(cdfid, nZId, start, edge,
+                                 static_cast<float *>(pBuffer));
+    }
+    else if (eDataType == GDT_Float64)
+    {
+        return nc_get_vara_double(cdfid, nZId, start, edge,
+                                  static_cast<double *>(pBuffer));
+    }
+    else if (eDataType == GDT_UInt16)
+    {
+        return nc_get_vara_ushort(cdfid, nZId, start, edge,
+                                  static_cast<unsigned short *>(pBuffer));
+    }
+    else if (eDataType == GDT_UInt32)
+    {
+        return nc_get_vara_uint(cdfid, nZId, start, edge,
+                                static_cast<unsigned int *>(pBuffer));
+    }
+    else if (eDataType == GDT_Int64)
+    {
+        return nc_get_vara_longlong(cdfid, nZId, start, edge,
+                                    static_cast<long long *>(pBuffer));
+    }
+    else if (eDataType == GDT_UInt64)
+    {
+        return nc_get_vara_ulonglong(
+            cdfid, nZId, start, edge,
+            static_cast<unsigned long long *>(pBuffer));
+    }
+    else if (eDataType == GDT_CInt16 || eDataType == GDT_CInt32 ||
+             eDataType == GDT_CFloat32 || eDataType == GDT_CFloat64)
+    {
+        return nc_get_vara(cdfid, nZId, start, edge, pBuffer);
+    }
+    return NC_EBADTYPE;
+}
+
+/************************************************************************/
+/*                          CheckBlockData()                            */
+/************************************************************************/
+
+// Dispatches to CheckData() / CheckDataCpx() according to the band data type,
+// once pImageNC has been filled by ReadNetcdfArray().
+void netCDFRasterBand::CheckBlockData(void *pImage, void *pImageNC,
+                                      size_t nTmpBlockXSize,
+                                      size_t nTmpBlockYSize)
+{
+    if (eDataType == GDT_Byte)
+    {
+        if (bSignedData)
+            CheckData<signed char>(pImage, pImageNC, nTmpBlockXSize,
+                                   nTmpBlockYSize, false);
+        else
+            CheckData<unsigned char>(pImage, pImageNC, nTmpBlockXSize,
+                                     nTmpBlockYSize, false);
+    }
+    else if (eDataType == GDT_Int8)
+    {
+        CheckData<signed char>(pImage, pImageNC, nTmpBlockXSize,
+                               nTmpBlockYSize, false);
+    }
+    else if (nc_datatype == NC_SHORT)
+    {
+        if (eDataType == GDT_Int16)
+            CheckData<GInt16>(pImage, pImageNC, nTmpBlockXSize,
+                              nTmpBlockYSize, false);
+        else
+            CheckData<GUInt16>(pImage, pImageNC, nTmpBlockXSize,
+                               nTmpBlockYSize, false);
+    }
+    else if (eDataType == GDT_Int32)
+    {
+#if SIZEOF_UNSIGNED_LONG == 4
+        CheckData<long>(pImage, pImageNC, nTmpBlockXSize, nTmpBlockYSize,
+                        false);
+#else
+        CheckData<int>(pImage, pImageNC, nTmpBlockXSize, nTmpBlockYSize,
+                       false);
+#endif
+    }
+    else if (eDataType == GDT_Float32)
+    {
+        CheckData<float>(pImage, pImageNC, nTmpBlockXSize, nTmpBlockYSize,
+                         true);
+    }
+    else if (eDataType == GDT_Float64)
+    {
+        CheckData<double>(pImage, pImageNC, nTmpBlockXSize, nTmpBlockYSize,
+                          true);
+    }
+    else if (eDataType == GDT_UInt16)
+    {
+        CheckData<unsigned short>(pImage, pImageNC, nTmpBlockXSize,
+                                  nTmpBlockYSize, false);
+    }
+    else if (eDataType == GDT_UInt32)
+    {
+        CheckData<unsigned int>(pImage, pImageNC, nTmpBlockXSize,
+                                nTmpBlockYSize, false);
+    }
+    else if (eDataType == GDT_Int64)
+    {
+        CheckData<std::int64_t>(pImage, pImageNC, nTmpBlockXSize,
+                                nTmpBlockYSize, false);
+    }
+    else if (eDataType == GDT_UInt64)
+    {
+        CheckData<std::uint64_t>(pImage, pImageNC, nTmpBlockXSize,
+                                 nTmpBlockYSize, false);
+    }
+    else if (eDataType == GDT_CInt16)
+    {
+        CheckDataCpx<short>(pImage, pImageNC, nTmpBlockXSize, nTmpBlockYSize,
+                            false);
+    }
+    else if (eDataType == GDT_CInt32)
+    {
+        CheckDataCpx<int>(pImage, pImageNC, nTmpBlockXSize, nTmpBlockYSize,
+                          false);
+    }
+    else if (eDataType == GDT_CFloat32)
+    {
+        CheckDataCpx<float>(pImage, pImageNC, nTmpBlockXSize, nTmpBlockYSize,
+                            false);
+    }
+    else if (eDataType == GDT_CFloat64)
+    {
+        CheckDataCpx<double>(pImage, pImageNC, nTmpBlockXSize, nTmpBlockYSize,
+                             false);
+    }
+}
+
 /************************************************************************/
 /*                         FetchNetcdfChunk()                           */
 /************************************************************************/
 
 bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
                                         void *pImage)
+{
+    netCDFRasterBand *poThis = this;
+    return FetchNetcdfChunk(xstart, ystart, nLevel, 1, &pImage, &poThis);
+}
+
+// Fetches the block at (xstart, ystart) of nLevelCount consecutive levels,
+// starting at nFirstLevel, with a single hyperslab read. papImages[i] is the
+// block buffer of the band papoBands[i], of level nFirstLevel + i, or nullptr
+// if that level is not needed. nLevelCount > 1 is only valid for 3D
+// variables.
+bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
+                                        int nFirstLevel, int nLevelCount,
+                                        void *const *papImages,
+                                        netCDFRasterBand *const *papoBands)
 {
     size_t start[MAX_NC_DIMS] = {};
     size_t edge[MAX_NC_DIMS] = {};
@@ -2319,10 +2523,11 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
 
     int nd = 0;
     nc_inq_varndims(cdfid, nZId, &nd);
+    CPLAssert(nLevelCount == 1 || nd == 3);
     if (nd == 3)
     {
-        start[panBandZPos[0]] = nLevel;  // z
-        edge[panBandZPos[0]] = 1;
+        start[panBandZPos[0]] = nFirstLevel;  // z
+        edge[panBandZPos[0]] = nLevelCount;
     }
 
     // Compute multidimention band position.
@@ -2346,12 +2551,12 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
                 {
                     Sum *= panBandZLev[j];
                 }
-                start[panBandZPos[i]] = (int)((nLevel - Taken) / Sum);
+                start[panBandZPos[i]] = (int)((nFirstLevel - Taken) / Sum);
                 edge[panBandZPos[i]] = 1;
             }
             else
             {
-                start[panBandZPos[i]] = (int)((nLevel - Taken) % Sum);
+                start[panBandZPos[i]] = (int)((nFirstLevel - Taken) % Sum);
                 edge[panBandZPos[i]] = 1;
             }
             Taken += static_cast<int>(start[panBandZPos[i]]) * Sum;
@@ -2365,167 +2570,150 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
     // re-arrange the data because partial blocks are not arranged the
     // same way in netcdf and gdal, so we first we read the netcdf data at
     // the end of the gdal block buffer then re-arrange rows in CheckData().
-    void *pImageNC = pImage;
-    if (edge[nBandXPos] != static_cast<size_t>(nBlockXSize))
-    {
-        pImageNC = static_cast<GByte *>(pImage) +
-                   ((static_cast<size_t>(nBlockXSize) * nBlockYSize -
-                     edge[nBandXPos] * nYChunkSize) *
-                    (GDALGetDataTypeSize(eDataType) / 8));
-    }
+    const size_t nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    const size_t nChunkBytes = edge[nBandXPos] * nYChunkSize * nDTSize;
+    const size_t nOffsetNC =
+        edge[nBandXPos] != static_cast<size_t>(nBlockXSize)
+            ? static_cast<size_t>(nBlockXSize) * nBlockYSize * nDTSize -
+                  nChunkBytes
+            : 0;
 
-    // Read data according to type.
     int status;
-    if (eDataType == GDT_Byte)
+    if (nLevelCount == 1)
     {
-        if (bSignedData)
+        void *pImageNC = static_cast<GByte *>(papImages[0]) + nOffsetNC;
+        status = ReadNetcdfArray(start, edge, pImageNC);
+        if (status == NC_NOERR)
+            papoBands[0]->CheckBlockData(papImages[0], pImageNC,
+                                         edge[nBandXPos], nYChunkSize);
+    }
+    else
+    {
+        // z is the outermost dimension, so the levels come one after the
+        // other in the buffer.
+        std::vector<GByte> abyBuffer;
+        try
         {
-            status = nc_get_vara_schar(cdfid, nZId, start, edge,
-                                       static_cast<signed char *>(pImageNC));
-            if (status == NC_NOERR)
-                CheckData<signed char>(pImage, pImageNC, edge[nBandXPos],
-                                       nYChunkSize, false);
+            abyBuffer.resize(nChunkBytes * nLevelCount);
         }
-        else
+        catch (const std::exception &)
         {
-            status = nc_get_vara_uchar(cdfid, nZId, start, edge,
-                                       static_cast<unsigned char *>(pImageNC));
-            if (status == NC_NOERR)
-                CheckData<unsigned char>(pImage, pImageNC, edge[nBandXPos],
-                                         nYChunkSize, false);
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate buffer for %d levels", nLevelCount);
+            return false;
         }
-    }
-    else if (eDataType == GDT_Int8)
-    {
-        status = nc_get_vara_schar(cdfid, nZId, start, edge,
-                                   static_cast<signed char *>(pImageNC));
-        if (status == NC_NOERR)
-            CheckData<signed char>(pImage, pImageNC, edge[nBandXPos],
-                                   nYChunkSize, false);
-    }
-    else if (nc_datatype == NC_SHORT)
-    {
-        status = nc_get_vara_short(cdfid, nZId, start, edge,
-                                   static_cast<short *>(pImageNC));
+        status = ReadNetcdfArray(start, edge, abyBuffer.data());
         if (status == NC_NOERR)
         {
-            if (eDataType == GDT_Int16)
+            for (int i = 0; i < nLevelCount; ++i)
             {
-                CheckData<GInt16>(pImage, pImageNC, edge[nBandXPos],
-                                  nYChunkSize, false);
-            }
-            else
-            {
-                CheckData<GUInt16>(pImage, pImageNC, edge[nBandXPos],
-                                   nYChunkSize, false);
+                if (papImages[i] == nullptr)
+                    continue;
+                void *pImageNC = static_cast<GByte *>(papImages[i]) + nOffsetNC;
+                memcpy(pImageNC, abyBuffer.data() + i * nChunkBytes,
+                       nChunkBytes);
+                papoBands[i]->CheckBlockData(papImages[i], pImageNC,
+                                             edge[nBandXPos], nYChunkSize);
             }
         }
     }
-    else if (eDataType == GDT_Int32)
-    {
-#if SIZEOF_UNSIGNED_LONG == 4
-        status = nc_get_vara_long(cdfid, nZId, start, edge,
-                                  static_cast<long *>(pImageNC));
-        if (status == NC_NOERR)
-            CheckData<long>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
-                            false);
-#else
-        status = nc_get_vara_int(cdfid, nZId, start, edge,
-                                 static_cast<int *>(pImageNC));
-        if (status == NC_NOERR)
-            CheckData<int>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
-                           false);
-#endif
-    }
-    else if (eDataType == GDT_Float32)
-    {
-        status = nc_get_vara_float(cdfid, nZId, start, edge,
-                                   static_cast<float *>(pImageNC));
-        if (status == NC_NOERR)
-            CheckData<float>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
-                             true);
-    }
-    else if (eDataType == GDT_Float64)
-    {
-        status = nc_get_vara_double(cdfid, nZId, start, edge,
-                                    static_cast<double *>(pImageNC));
-        if (status == NC_NOERR)
-            CheckData<double>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
-                              true);
-    }
-    else if (eDataType == GDT_UInt16)
-    {
-        status = nc_get_vara_ushort(cdfid, nZId, start, edge,
-                                    static_cast<unsigned short *>(pImageNC));
-        if (status == NC_NOERR)
-            CheckData<unsigned short>(pImage, pImageNC, edge[nBandXPos],
-                                      nYChunkSize, false);
-    }
-    else if (eDataType == GDT_UInt32)
-    {
-        status = nc_get_vara_uint(cdfid, nZId, start, edge,
-                                  static_cast<unsigned int *>(pImageNC));
-        if (status == NC_NOERR)
-            CheckData<unsigned int>(pImage, pImageNC, edge[nBandXPos],
-                                    nYChunkSize, false);
-    }
-    else if (eDataType == GDT_Int64)
-    {
-        status = nc_get_vara_longlong(cdfid, nZId, start, edge,
-                                      static_cast<long long *>(pImageNC));
-        if (status == NC_NOERR)
-            CheckData<std::int64_t>(pImage, pImageNC, edge[nBandXPos],
-                                    nYChunkSize, false);
-    }
-    else if (eDataType == GDT_UInt64)
-    {
-        status =
-            nc_get_vara_ulonglong(cdfid, nZId, start, edge,
-                                  static_cast<unsigned long long *>(pImageNC));
-        if (status == NC_NOERR)
-            CheckData<std::uint64_t>(pImage, pImageNC, edge[nBandXPos],
-                                     nYChunkSize, false);
-    }
-    else if (eDataType == GDT_CInt16)
+
+    if (status != NC_NOERR)
     {
-        status = nc_get_vara(cdfid, nZId, start, edge, pImageNC);
-        if (status == NC_NOERR)
-            CheckDataCpx<short>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
-                                false);
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "netCDF chunk fetch failed: #%d (%s)", status,
+                 nc_strerror(status));
+        return false;
     }
-    else if (eDataType == GDT_CInt32)
+    return true;
+}
+
+/************************************************************************/
+/*                        FetchCoalescedLevels()                        */
+/************************************************************************/
+
+// For a 3D variable chunked along its (outermost) z dimension, reading one
+// level at a time decompresses each netCDF chunk as many times as it has
+// levels. Instead read the block for all the levels of the z chunk at once,
+// and put the levels other than ours in the block cache of their bands.
+bool netCDFRasterBand::FetchCoalescedLevels(size_t xstart, size_t ystart,
+                                            int nBlockXOff, int nBlockYOff,
+                                            void *pImage)
+{
+    const int nFirstLevel = (nLevel / m_nZChunkSize) * m_nZChunkSize;
+    const int nLevelCount =
+        std::min(m_nZChunkSize, panBandZLev[0] - nFirstLevel);
+    const size_t nBlockBytes = static_cast<size_t>(nBlockXSize) *
+                               nBlockYSize *
+                               GDALGetDataTypeSizeBytes(eDataType);
+    if (nLevelCount <= 1 || static_cast<GIntBig>(nBlockBytes) * nLevelCount >
+                                GDALGetCacheMax64() / 4)
     {
-        status = nc_get_vara(cdfid, nZId, start, edge, pImageNC);
-        if (status == NC_NOERR)
-            CheckDataCpx<int>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
-                              false);
+        return FetchNetcdfChunk(xstart, ystart, pImage);
     }
-    else if (eDataType == GDT_CFloat32)
+
+    std::vector<netCDFRasterBand *> apoBands(nLevelCount);
+    std::vector<void *> apImages(nLevelCount);
+    std::vector<GDALRasterBlock *> apoBlocks(nLevelCount);
+    for (int iBand = 1; iBand <= poDS->GetRasterCount(); ++iBand)
     {
-        status = nc_get_vara(cdfid, nZId, start, edge, pImageNC);
-        if (status == NC_NOERR)
-            CheckDataCpx<float>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
-                                false);
+        auto poBand =
+            dynamic_cast<netCDFRasterBand *>(poDS->GetRasterBand(iBand));
+        if (poBand && poBand->cdfid == cdfid && poBand->nZId == nZId &&
+            poBand->nLevel >= nFirstLevel &&
+            poBand->nLevel < nFirstLevel + nLevelCount &&
+            poBand->nBlockXSize == nBlockXSize &&
+            poBand->nBlockYSize == nBlockYSize)
+        {
+            apoBands[poBand->nLevel - nFirstLevel] = poBand;
+        }
     }
-    else if (eDataType == GDT_CFloat64)
+    apoBands[nLevel - nFirstLevel] = this;
+
+    for (int i = 0; i < nLevelCount; ++i)
     {
-        status = nc_get_vara(cdfid, nZId, start, edge, pImageNC);
-        if (status == NC_NOERR)
-            CheckDataCpx<double>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
-                                 false);
+        auto poBand = apoBands[i];
+        if (poBand == this)
+        {
+            apImages[i] = pImage;
+        }
+        else if (poBand)
+        {
+            GDALRasterBlock *poBlock =
+                poBand->TryGetLockedBlockRef(nBlockXOff, nBlockYOff);
+            if (poBlock)
+            {
+                // Already cached
+                poBlock->DropLock();
+                continue;
+            }
+            // Do not flush dirty blocks of other datasets while holding
+            // hNCMutex, as that could take locks in reverse order.
+            GDALRasterBlock::EnterDisableDirtyBlockFlush();
+            poBlock = poBand->GetLockedBlockRef(nBlockXOff, nBlockYOff, TRUE);
+            GDALRasterBlock::LeaveDisableDirtyBlockFlush();
+            if (poBlock)
+            {
+                apoBlocks[i] = poBlock;
+                apImages[i] = poBlock->GetDataRef();
+            }
+        }
     }
 
-    else
-        status = NC_EBADTYPE;
-
-    if (status != NC_NOERR)
+    const bool bRet =
+        FetchNetcdfChunk(xstart, ystart, nFirstLevel, nLevelCount,
+                         apImages.data(), apoBands.data());
+    for (int i = 0; i < nLevelCount; ++i)
     {
-        CPLError(CE_Failure, CPLE_AppDefined,
-                 "netCDF chunk fetch failed: #%d (%s)", status,
-                 nc_strerror(status));
-        return false;
+        if (apoBlocks[i])
+        {
+            apoBlocks[i]->DropLock();
+            // Do not leave uninitialized blocks in the cache.
+            if (!bRet)
+                apoBands[i]->FlushBlock(nBlockXOff, nBlockYOff, FALSE);
+        }
     }
-    return true;
+    return bRet;
 }
 
 /************************************************************************/
@@ -2642,6 +2830,15 @@ CPLErr netCDFRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
         }
     }
 
+    if (m_nZChunkSize > 1 &&
+        static_cast<netCDFDataset *>(poDS)->eAccess == GA_ReadOnly)
+    {
+        return FetchCoalescedLevels(xstart, ystart, nBlockXOff, nBlockYOff,
+                                    pImage)
+                   ? CE_None
+                   : CE_Failure;
+    }
+
     return FetchNetcdfChunk(xstart, ystart, pImage) ? CE_None : CE_Failure;
 }
 
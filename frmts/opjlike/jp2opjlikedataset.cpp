@@ -211,6 +211,49 @@ VSILFILE *JP2OPJLikeDataset<CODEC, BASE>::GetFileHandle()
     return this->fp_;
 }
 
+/************************************************************************/
+/*                         AcquireFileHandle()                          */
+/************************************************************************/
+
+template <typename CODEC, typename BASE>
+VSILFILE *JP2OPJLikeDataset<CODEC, BASE>::AcquireFileHandle()
+{
+    {
+        std::lock_guard<std::mutex> oLock(m_oFileHandlesMutex);
+        if (!m_apoFreeFileHandles.empty())
+        {
+            VSILFILE *fp = m_apoFreeFileHandles.back();
+            m_apoFreeFileHandles.pop_back();
+            return fp;
+        }
+    }
+    return VSIFOpenL(this->m_osFilename.c_str(), "rb");
+}
+
+/************************************************************************/
+/*                         ReleaseFileHandle()                          */
+/************************************************************************/
+
+template <typename CODEC, typename BASE>
+void JP2OPJLikeDataset<CODEC, BASE>::ReleaseFileHandle(VSILFILE *fp)
+{
+    std::lock_guard<std::mutex> oLock(m_oFileHandlesMutex);
+    m_apoFreeFileHandles.push_back(fp);
+}
+
+/************************************************************************/
+/*                         CloseFileHandles()                           */
+/************************************************************************/
+
+template <typename CODEC, typename BASE>
+void JP2OPJLikeDataset<CODEC, BASE>::CloseFileHandles()
+{
+    std::lock_guard<std::mutex> oLock(m_oFileHandlesMutex);
+    for (VSILFILE *fp : m_apoFreeFileHandles)
+        VSIFCloseL(fp);
+    m_apoFreeFileHandles.clear();
+}
+
 /************************************************************************/
 /*                   ReadBlockInThread()                                */
 /************************************************************************/
@@ -226,7 +269,7 @@ void JP2OPJLikeDataset<CODEC, BASE>::ReadBlockInThread(void *userdata)
     int nPairs = (int)poJob->oPairs.size();
     int nBandCount = poJob->nBandCount;
     const int *panBandMap = poJob->panBandMap;
-    VSILFILE *fp = VSIFOpenL(poGDS->m_osFilename.c_str(), "rb");
+    VSILFILE *fp = poGDS->AcquireFileHandle();
     if (fp == nullptr)
     {
         CPLDebug(CODEC::debugId(), "Cannot open %s",
@@ -262,8 +305,7 @@ void JP2OPJLikeDataset<CODEC, BASE>::ReadBlockInThread(void *userdata)
         poBlock->DropLock();
     }
 
-    VSIFCloseL(fp);
-    // VSIFree(pDummy);
+    poGDS->ReleaseFileHandle(fp);
 }
 
 /************************************************************************/
@@ -322,15 +364,11 @@ int JP2OPJLikeDataset<CODEC, BASE>::PreloadBlocks(
         if (this->m_nBlocksToLoad > 1)
         {
             const int l_nThreads = std::min(this->m_nBlocksToLoad, nMaxThreads);
-            CPLJoinableThread **pahThreads =
-                (CPLJoinableThread **)VSI_CALLOC_VERBOSE(
-                    sizeof(CPLJoinableThread *), l_nThreads);
-            if (pahThreads == nullptr)
-            {
-                this->m_nBlocksToLoad = 0;
-                return -1;
-            }
-            int i;
+            // The calling thread takes its share of the blocks, so only
+            // l_nThreads - 1 extra threads are needed. Dedicated threads,
+            // rather than the global thread pool, are used as we may be
+            // called from a job of that pool (e.g. from the GTI driver).
+            std::vector<CPLJoinableThread *> ahThreads;
 
             CPLDebug(CODEC::debugId(), "%d blocks to load (%d threads)",
                      this->m_nBlocksToLoad, l_nThreads);
@@ -366,18 +404,19 @@ int JP2OPJLikeDataset<CODEC, BASE>::PreloadBlocks(
             /* This is a workaround to a design defect of the block cache */
             GDALRasterBlock::FlushDirtyBlocks();
 
-            for (i = 0; i < l_nThreads; i++)
+            TemporarilyDropReadWriteLock();
+            for (int i = 1; i < l_nThreads; i++)
             {
-                pahThreads[i] =
+                CPLJoinableThread *hThread =
                     CPLCreateJoinableThread(ReadBlockInThread, &oJob);
-                if (pahThreads[i] == nullptr)
-                    oJob.bSuccess = false;
+                if (hThread == nullptr)
+                    break;
+                ahThreads.push_back(hThread);
             }
-            TemporarilyDropReadWriteLock();
-            for (i = 0; i < l_nThreads; i++)
-                CPLJoinThread(pahThreads[i]);
+            ReadBlockInThread(&oJob);
+            for (CPLJoinableThread *hThread : ahThreads)
+                CPLJoinThread(hThread);
             ReacquireReadWriteLock();
-            CPLFree(pahThreads);
             if (!oJob.bSuccess)
             {
                 this->m_nBlocksToLoad = 0;
@@ -818,6 +857,7 @@ CPLErr JP2OPJLikeDataset<CODEC, BASE>::Close()
         if (JP2OPJLikeDataset::FlushCache(true) != CE_None)
             eErr = CE_Failure;
 
+        CloseFileHandles();
         this->closeJP2();
         if (this->iLevel == 0 && this->fp_ != nullptr)
         {
@@ -1082,6 +1122,9 @@ CPLErr JP2OPJLikeDataset<CODEC, BASE>::Close()
                 VSIFCloseL(this->fp_);
         }
 
+        // The rewrite pass above may have re-opened worker file handles
+        CloseFileHandles();
+
         JP2OPJLikeDataset::CloseDependentDatasets();
 
         if (GDALPamDataset::Close() != CE_None)
@@ -38,6 +38,9 @@
 #include "gdaljp2abstractdataset.h"
 #include "gdaljp2metadata.h"
 
+#include <mutex>
+#include <vector>
+
 typedef int JP2_COLOR_SPACE;
 typedef int JP2_PROG_ORDER;
 
@@ -133,6 +136,15 @@ class JP2OPJLikeDataset final : public GDALJP2AbstractDataset, public BASE
     friend class JP2OPJLikeRasterBand<CODEC, BASE>;
     JP2OPJLikeDataset **papoOverviewDS = nullptr;
 
+    // File handles used by worker threads of PreloadBlocks(), kept open
+    // between calls so that repeated reads do not re-open the file.
+    std::mutex m_oFileHandlesMutex{};
+    std::vector<VSILFILE *> m_apoFreeFileHandles{};
+
+    VSILFILE *AcquireFileHandle();
+    void ReleaseFileHandle(VSILFILE *fp);
+    void CloseFileHandles();
+
   protected:
     virtual int CloseDependentDatasets() override;
     virtual VSILFILE *GetFileHandle() override;
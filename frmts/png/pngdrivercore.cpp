@@ -59,6 +59,7 @@ void PNGDriverSetCommonMetadata(GDALDriver *poDriver)
     poDriver->SetMetadataItem(GDAL_DMD_LONGNAME, "Portable Network Graphics");
     poDriver->SetMetadataItem(GDAL_DMD_HELPTOPIC, "drivers/raster/png.html");
     poDriver->SetMetadataItem(GDAL_DMD_EXTENSION, "png");
+    poDriver->SetMetadataItem(GDAL_DMD_MAGIC_BYTES, "89504E470D0A1A0A");
     poDriver->SetMetadataItem(GDAL_DMD_MIMETYPE, "image/png");
 
     poDriver->SetMetadataItem(GDAL_DMD_CREATIONDATATYPES, "Byte UInt16");
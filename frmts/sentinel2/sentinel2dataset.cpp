@@ -27,15 +27,20 @@
  * DEALINGS IN THE SOFTWARE.
  ****************************************************************************/
 
+#include "cpl_error_internal.h"
 #include "cpl_minixml.h"
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_pam.h"
+#include "gdal_thread_pool.h"
 #include "ogr_spatialref.h"
 #include "ogr_geometry.h"
 #include "gdaljp2metadata.h"
 #include "../vrt/vrtdataset.h"
 
 #include <algorithm>
+#include <atomic>
+#include <functional>
 #include <map>
 #include <set>
 #include <vector>
@@ -148,6 +153,8 @@ static const char *SENTINEL2GetOption(GDALOpenInfo *poOpenInfo,
                                       const char *pszDefaultVal = nullptr);
 static bool SENTINEL2GetTileInfo(const char *pszFilename, int *pnWidth,
                                  int *pnHeight, int *pnBits);
+static int SENTINEL2GetNumThreads(GDALOpenInfo *poOpenInfo,
+                                  const char *pszFilename);
 
 /************************************************************************/
 /*                           SENTINEL2GranuleInfo                       */
@@ -191,7 +198,7 @@ class SENTINEL2Dataset final : public VRTDataset
         std::vector<CPLString> &aosNonJP2Files, int nSubDSPrecision,
         bool bIsPreview, bool bIsTCI, int nSubDSEPSGCode, bool bAlpha,
         const std::vector<CPLString> &aosBands, int nSaturatedVal,
-        int nNodataVal, const CPLString &osProductURI);
+        int nNodataVal, const CPLString &osProductURI, int nNumThreads);
 
   public:
     SENTINEL2Dataset(int nXSize, int nYSize);
@@ -207,7 +214,7 @@ class SENTINEL2Dataset final : public VRTDataset
                    std::set<CPLString> *poBandSet = nullptr);
     static GDALDataset *OpenL1BSubdataset(GDALOpenInfo *);
     static GDALDataset *OpenL1C_L2A(const char *pszFilename,
-                                    SENTINEL2Level eLevel);
+                                    SENTINEL2Level eLevel, int nNumThreads);
     static GDALDataset *OpenL1CTile(const char *pszFilename,
                                     CPLXMLNode **ppsRootMainMTD = nullptr,
                                     int nResolutionOfInterest = 0,
@@ -593,7 +600,9 @@ GDALDataset *SENTINEL2Dataset::Open(GDALOpenInfo *poOpenInfo)
         strstr(pszHeader, "User_Product_Level-1C.xsd") != nullptr)
     {
         CPLDebug("SENTINEL2", "Trying OpenL1C_L2A");
-        return OpenL1C_L2A(poOpenInfo->pszFilename, SENTINEL2_L1C);
+        return OpenL1C_L2A(
+            poOpenInfo->pszFilename, SENTINEL2_L1C,
+            SENTINEL2GetNumThreads(poOpenInfo, poOpenInfo->pszFilename));
     }
 
     if (strstr(pszHeader, "<n1:Level-1C_Tile_ID") != nullptr &&
@@ -607,7 +616,9 @@ GDALDataset *SENTINEL2Dataset::Open(GDALOpenInfo *poOpenInfo)
         strstr(pszHeader, "User_Product_Level-2A") != nullptr)
     {
         CPLDebug("SENTINEL2", "Trying OpenL1C_L2A");
-        return OpenL1C_L2A(poOpenInfo->pszFilename, SENTINEL2_L2A);
+        return OpenL1C_L2A(
+            poOpenInfo->pszFilename, SENTINEL2_L2A,
+            SENTINEL2GetNumThreads(poOpenInfo, poOpenInfo->pszFilename));
     }
 
     if (SENTINEL2isZipped(pszHeader, poOpenInfo->nHeaderBytes))
@@ -719,7 +730,8 @@ static bool SENTINEL2GetGranuleInfo(
     double *pdfULY = nullptr, int *pnResolution = nullptr,
     int *pnWidth = nullptr, int *pnHeight = nullptr)
 {
-    static bool bTryOptimization = true;
+    // Shared by the threads of SENTINEL2GetGranuleInfoList()
+    static std::atomic<bool> bTryOptimization{true};
     CPLXMLNode *psRoot = nullptr;
 
     if (bTryOptimization)
@@ -881,6 +893,121 @@ static bool SENTINEL2GetGranuleInfo(
     return true;
 }
 
+/************************************************************************/
+/*                       SENTINEL2GetNumThreads()                       */
+/************************************************************************/
+
+// Number of threads used to fetch the granule metadata files and to check
+// the presence of the tiles. This is dominated by I/O latency, hence the
+// default value on network file systems, independent of the number of CPUs.
+static int SENTINEL2GetNumThreads(GDALOpenInfo *poOpenInfo,
+                                  const char *pszFilename)
+{
+    const char *pszNumThreads =
+        SENTINEL2GetOption(poOpenInfo, "NUM_THREADS", nullptr);
+    if (pszNumThreads == nullptr)
+        return VSIIsLocal(pszFilename) ? 1 : 8;
+    if (EQUAL(pszNumThreads, "ALL_CPUS"))
+        return CPLGetNumCPUs();
+    return std::max(1, atoi(pszNumThreads));
+}
+
+/************************************************************************/
+/*                          SENTINEL2RunJobs()                          */
+/************************************************************************/
+
+namespace
+{
+struct SENTINEL2Job
+{
+    const std::function<void(size_t)> *pfnFunc = nullptr;
+    size_t nIdx = 0;
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+};
+}  // namespace
+
+// Call fnFunc(i) for i in [0, nJobs[, in parallel if nNumThreads > 1.
+// Errors emitted by the jobs are re-emitted in the calling thread, in the
+// order of the jobs.
+static void SENTINEL2RunJobs(size_t nJobs, int nNumThreads,
+                             const std::function<void(size_t)> &fnFunc)
+{
+    CPLWorkerThreadPool *poPool =
+        (nJobs > 1 && nNumThreads > 1)
+            ? GDALGetGlobalThreadPool(static_cast<int>(
+                  std::min(static_cast<size_t>(nNumThreads), nJobs)))
+            : nullptr;
+    auto poQueue = poPool ? poPool->CreateJobQueue() : nullptr;
+    if (!poQueue)
+    {
+        for (size_t i = 0; i < nJobs; ++i)
+            fnFunc(i);
+        return;
+    }
+
+    const auto JobFunc = [](void *pData)
+    {
+        auto psJob = static_cast<SENTINEL2Job *>(pData);
+        CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+        (*psJob->pfnFunc)(psJob->nIdx);
+        CPLUninstallErrorHandlerAccumulator();
+    };
+    std::vector<SENTINEL2Job> asJobs(nJobs);
+    for (size_t i = 0; i < nJobs; ++i)
+    {
+        asJobs[i].pfnFunc = &fnFunc;
+        asJobs[i].nIdx = i;
+        if (!poQueue->SubmitJob(JobFunc, &asJobs[i]))
+            JobFunc(&asJobs[i]);
+    }
+    poQueue->WaitCompletion();
+
+    for (const auto &sJob : asJobs)
+    {
+        for (const auto &oError : sJob.aoErrors)
+            CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+    }
+}
+
+/************************************************************************/
+/*                     SENTINEL2GetGranuleInfoList()                    */
+/************************************************************************/
+
+namespace
+{
+struct SENTINEL2GranuleGeoInfo
+{
+    bool bOK = false;
+    int nEPSGCode = 0;
+    double dfULX = 0;
+    double dfULY = 0;
+    int nResolution = 0;
+    int nWidth = 0;
+    int nHeight = 0;
+};
+}  // namespace
+
+// Read the metadata file of each granule, possibly in parallel
+static std::vector<SENTINEL2GranuleGeoInfo>
+SENTINEL2GetGranuleInfoList(SENTINEL2Level eLevel,
+                            const std::vector<CPLString> &aosGranuleList,
+                            int nDesiredResolution, int nNumThreads)
+{
+    std::vector<SENTINEL2GranuleGeoInfo> asInfo(aosGranuleList.size());
+    SENTINEL2RunJobs(aosGranuleList.size(), nNumThreads,
+                     [eLevel, &aosGranuleList, nDesiredResolution,
+                      &asInfo](size_t i)
+                     {
+                         auto &sInfo = asInfo[i];
+                         sInfo.bOK = SENTINEL2GetGranuleInfo(
+                             eLevel, aosGranuleList[i], nDesiredResolution,
+                             &sInfo.nEPSGCode, &sInfo.dfULX, &sInfo.dfULY,
+                             &sInfo.nResolution, &sInfo.nWidth,
+                             &sInfo.nHeight);
+                     });
+    return asInfo;
+}
+
 /************************************************************************/
 /*                      SENTINEL2GetPathSeparator()                     */
 /************************************************************************/
@@ -2491,7 +2618,8 @@ static bool SENTINEL2GetGranuleList_L2ASafeCompact(
 /************************************************************************/
 
 GDALDataset *SENTINEL2Dataset::OpenL1C_L2A(const char *pszFilename,
-                                           SENTINEL2Level eLevel)
+                                           SENTINEL2Level eLevel,
+                                           int nNumThreads)
 {
     CPLXMLNode *psRoot = CPLParseXMLFile(pszFilename);
     if (psRoot == nullptr)
@@ -2604,14 +2732,11 @@ GDALDataset *SENTINEL2Dataset::OpenL1C_L2A(const char *pszFilename,
     }
 
     std::set<int> oSetEPSGCodes;
-    for (size_t i = 0; i < aosGranuleList.size(); i++)
+    for (const auto &sInfo : SENTINEL2GetGranuleInfoList(
+             eLevel, aosGranuleList, *(oSetResolutions.begin()), nNumThreads))
     {
-        int nEPSGCode = 0;
-        if (SENTINEL2GetGranuleInfo(eLevel, aosGranuleList[i],
-                                    *(oSetResolutions.begin()), &nEPSGCode))
-        {
-            oSetEPSGCodes.insert(nEPSGCode);
-        }
+        if (sInfo.bOK)
+            oSetEPSGCodes.insert(sInfo.nEPSGCode);
     }
 
     SENTINEL2DatasetContainer *poDS = new SENTINEL2DatasetContainer();
@@ -3300,7 +3425,8 @@ GDALDataset *SENTINEL2Dataset::OpenL1C_L2ASubdataset(GDALOpenInfo *poOpenInfo,
         eLevel, pType, bIsSafeCompact, aosGranuleList,
         aoL1CSafeCompactGranuleList, aosNonJP2Files, nSubDSPrecision,
         bIsPreview, bIsTCI, nSubDSEPSGCode, bAlpha, aosBands, nSaturatedVal,
-        nNodataVal, CPLString(pszProductURI));
+        nNodataVal, CPLString(pszProductURI),
+        SENTINEL2GetNumThreads(poOpenInfo, osFilename));
     if (poDS == nullptr)
     {
         CSLDestroy(papszMD);
@@ -3532,7 +3658,7 @@ SENTINEL2Dataset *SENTINEL2Dataset::CreateL1CL2ADataset(
     bool bIsPreview, bool bIsTCI,
     int nSubDSEPSGCode, /* or -1 if not known at this point */
     bool bAlpha, const std::vector<CPLString> &aosBands, int nSaturatedVal,
-    int nNodataVal, const CPLString &osProductURI)
+    int nNodataVal, const CPLString &osProductURI, int nNumThreads)
 {
 
     /* Iterate over granule metadata to know the layer extent */
@@ -3549,17 +3675,17 @@ SENTINEL2Dataset *SENTINEL2Dataset::CreateL1CL2ADataset(
         CPLAssert(aosGranuleList.size() == aoL1CSafeCompactGranuleList.size());
     }
 
+    const auto asGranuleGeoInfo = SENTINEL2GetGranuleInfoList(
+        eLevel, aosGranuleList, nDesiredResolution, nNumThreads);
     for (size_t i = 0; i < aosGranuleList.size(); i++)
     {
-        int nEPSGCode = 0;
-        double dfULX = 0.0;
-        double dfULY = 0.0;
-        int nResolution = 0;
-        int nWidth = 0;
-        int nHeight = 0;
-        if (SENTINEL2GetGranuleInfo(eLevel, aosGranuleList[i],
-                                    nDesiredResolution, &nEPSGCode, &dfULX,
-                                    &dfULY, &nResolution, &nWidth, &nHeight) &&
+        const int nEPSGCode = asGranuleGeoInfo[i].nEPSGCode;
+        const double dfULX = asGranuleGeoInfo[i].dfULX;
+        const double dfULY = asGranuleGeoInfo[i].dfULY;
+        const int nResolution = asGranuleGeoInfo[i].nResolution;
+        const int nWidth = asGranuleGeoInfo[i].nWidth;
+        const int nHeight = asGranuleGeoInfo[i].nHeight;
+        if (asGranuleGeoInfo[i].bOK &&
             (nSubDSEPSGCode == nEPSGCode || nSubDSEPSGCode < 0) &&
             nResolution != 0)
         {
@@ -3651,6 +3777,81 @@ SENTINEL2Dataset *SENTINEL2Dataset::CreateL1CL2ADataset(
     const int nAlphaBand = (bIsPreview || bIsTCI || !bAlpha) ? 0 : nBands;
     const GDALDataType eDT = (bIsPreview || bIsTCI) ? GDT_Byte : GDT_UInt16;
 
+    const auto GetTileName =
+        [eLevel, pType, bIsSafeCompact, bIsPreview, bIsTCI, nSubDSPrecision,
+         &osProductURI](const SENTINEL2GranuleInfo &oGranuleInfo,
+                        const CPLString &osBandName)
+    {
+        CPLString osTile;
+        if (bIsSafeCompact && eLevel != SENTINEL2_L2A)
+        {
+            if (bIsTCI)
+            {
+                osTile = oGranuleInfo.osBandPrefixPath + "TCI.jp2";
+            }
+            else
+            {
+                osTile = oGranuleInfo.osBandPrefixPath + "B";
+                if (osBandName.size() == 1)
+                    osTile += "0" + osBandName;
+                else if (osBandName.size() == 3)
+                    osTile += osBandName.substr(1);
+                else
+                    osTile += osBandName;
+                osTile += ".jp2";
+            }
+        }
+        else
+        {
+            osTile = SENTINEL2GetTilename(
+                oGranuleInfo.osPath, CPLGetFilename(oGranuleInfo.osPath),
+                osBandName, osProductURI, bIsPreview,
+                (eLevel == SENTINEL2_L1C) ? 0 : nSubDSPrecision);
+            if (bIsSafeCompact && eLevel == SENTINEL2_L2A &&
+                pType == MSI2Ap && osTile.size() >= 34 &&
+                osTile.substr(osTile.size() - 18, 3) != "MSK")
+            {
+                osTile.insert(osTile.size() - 34, "L2A_");
+            }
+            if (bIsTCI && osTile.size() >= 14)
+            {
+                osTile.replace(osTile.size() - 11, 3, "TCI");
+            }
+        }
+        return osTile;
+    };
+
+    /* Names of the tiles of each band, and check of their presence, which */
+    /* can be done in parallel. The tiles themselves are only opened when */
+    /* pixels are read, except the first one to get the bit depth. */
+    std::vector<CPLString> aosTiles;
+    for (int nBand = 1; nBand <= nBands; nBand++)
+    {
+        const CPLString &osBandName =
+            (nBand != nAlphaBand) ? aosBands[nBand - 1] : aosBands[0];
+        for (const auto &oGranuleInfo : aosGranuleInfoList)
+            aosTiles.push_back(GetTileName(oGranuleInfo, osBandName));
+    }
+    std::map<CPLString, bool> oMapTileExists;
+    for (const auto &osTile : aosTiles)
+        oMapTileExists[osTile] = false;
+    {
+        std::vector<CPLString> aosUniqueTiles;
+        for (const auto &oIter : oMapTileExists)
+            aosUniqueTiles.push_back(oIter.first);
+        std::vector<GByte> abyExists(aosUniqueTiles.size());
+        SENTINEL2RunJobs(aosUniqueTiles.size(), nNumThreads,
+                         [&aosUniqueTiles, &abyExists](size_t i)
+                         {
+                             VSIStatBufL sStat;
+                             abyExists[i] =
+                                 VSIStatExL(aosUniqueTiles[i], &sStat,
+                                            VSI_STAT_EXISTS_FLAG) == 0;
+                         });
+        for (size_t i = 0; i < aosUniqueTiles.size(); ++i)
+            oMapTileExists[aosUniqueTiles[i]] = abyExists[i] != 0;
+    }
+
     for (int nBand = 1; nBand <= nBands; nBand++)
     {
         VRTSourcedRasterBand *poBand = nullptr;
@@ -3683,52 +3884,18 @@ SENTINEL2Dataset *SENTINEL2Dataset::CreateL1CL2ADataset(
         for (size_t iSrc = 0; iSrc < aosGranuleInfoList.size(); iSrc++)
         {
             const SENTINEL2GranuleInfo &oGranuleInfo = aosGranuleInfoList[iSrc];
-            CPLString osTile;
+            const CPLString &osTile =
+                aosTiles[(nBand - 1) * aosGranuleInfoList.size() + iSrc];
 
-            if (bIsSafeCompact && eLevel != SENTINEL2_L2A)
-            {
-                if (bIsTCI)
-                {
-                    osTile = oGranuleInfo.osBandPrefixPath + "TCI.jp2";
-                }
-                else
-                {
-                    osTile = oGranuleInfo.osBandPrefixPath + "B";
-                    if (osBandName.size() == 1)
-                        osTile += "0" + osBandName;
-                    else if (osBandName.size() == 3)
-                        osTile += osBandName.substr(1);
-                    else
-                        osTile += osBandName;
-                    osTile += ".jp2";
-                }
-            }
-            else
-            {
-                osTile = SENTINEL2GetTilename(
-                    oGranuleInfo.osPath, CPLGetFilename(oGranuleInfo.osPath),
-                    osBandName, osProductURI, bIsPreview,
-                    (eLevel == SENTINEL2_L1C) ? 0 : nSubDSPrecision);
-                if (bIsSafeCompact && eLevel == SENTINEL2_L2A &&
-                    pType == MSI2Ap && osTile.size() >= 34 &&
-                    osTile.substr(osTile.size() - 18, 3) != "MSK")
-                {
-                    osTile.insert(osTile.size() - 34, "L2A_");
-                }
-                if (bIsTCI && osTile.size() >= 14)
-                {
-                    osTile.replace(osTile.size() - 11, 3, "TCI");
-                }
-            }
-
-            bool bTileFound = false;
-            if (nValMax == 0)
+            bool bTileFound = oMapTileExists[osTile];
+            if (bTileFound && nValMax == 0)
             {
                 /* It is supposed to be 12 bits, but some products have 15 bits
                  */
-                if (SENTINEL2GetTileInfo(osTile, nullptr, nullptr, &nBits))
+                bTileFound =
+                    SENTINEL2GetTileInfo(osTile, nullptr, nullptr, &nBits);
+                if (bTileFound)
                 {
-                    bTileFound = true;
                     if (nBits <= 16)
                         nValMax = (1 << nBits) - 1;
                     else
@@ -3738,12 +3905,6 @@ SENTINEL2Dataset *SENTINEL2Dataset::CreateL1CL2ADataset(
                     }
                 }
             }
-            else
-            {
-                VSIStatBufL sStat;
-                if (VSIStatExL(osTile, &sStat, VSI_STAT_EXISTS_FLAG) == 0)
-                    bTileFound = true;
-            }
             if (!bTileFound)
             {
                 CPLError(CE_Warning, CPLE_AppDefined,
@@ -3865,7 +4026,7 @@ GDALDataset *SENTINEL2Dataset::OpenL1CTileSubdataset(GDALOpenInfo *poOpenInfo)
         aosNonJP2Files, nSubDSPrecision, bIsPreview,
         false,  // bIsTCI
         -1 /*nSubDSEPSGCode*/, bAlpha, aosBands, nSaturatedVal, nNodataVal,
-        CPLString());
+        CPLString(), SENTINEL2GetNumThreads(poOpenInfo, osFilename));
     if (poDS == nullptr)
     {
         delete poTmpDS;
@@ -3928,6 +4089,10 @@ void GDALRegister_SENTINEL2()
         "<OpenOptionList>"
         "  <Option name='ALPHA' type='boolean' description='Whether to expose "
         "an alpha band' default='NO'/>"
+        "  <Option name='NUM_THREADS' type='string' description='Number of "
+        "threads used to read granule metadata and check the presence of "
+        "tiles. Integer value or ALL_CPUS. Defaults to 8 for files on network "
+        "file systems, 1 otherwise'/>"
         "</OpenOptionList>");
 #endif
 
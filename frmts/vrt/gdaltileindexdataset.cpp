@@ -30,19 +30,23 @@
 
 #include <array>
 #include <algorithm>
+#include <atomic>
 #include <limits>
+#include <map>
 #include <set>
 #include <tuple>
 #include <utility>
 #include <vector>
 
 #include "cpl_port.h"
+#include "cpl_error_internal.h"
 #include "cpl_mem_cache.h"
 #include "cpl_minixml.h"
 #include "vrtdataset.h"
 #include "vrt_priv.h"
 #include "ogrsf_frmts.h"
 #include "gdal_proxy.h"
+#include "gdal_thread_pool.h"
 #include "gdal_utils.h"
 
 #if defined(__SSE2__) || defined(_M_X64)
@@ -152,6 +156,17 @@ static inline bool ENDS_WITH_CI(const char *a, const char *b)
     return strlen(a) >= strlen(b) && EQUAL(a + strlen(a) - strlen(b), b);
 }
 
+/************************************************************************/
+/*                        GTIGetSourceCacheSize()                       */
+/************************************************************************/
+
+static size_t GTIGetSourceCacheSize()
+{
+    const int nSize =
+        atoi(CPLGetConfigOption("GTI_SOURCE_CACHE_SIZE", "500"));
+    return static_cast<size_t>(std::max(1, nSize));
+}
+
 /************************************************************************/
 /*                       GDALTileIndexDataset                           */
 /************************************************************************/
@@ -224,8 +239,10 @@ class GDALTileIndexDataset final : public GDALPamDataset
     //! Note that the dataset objects are ultimately GDALProxyPoolDataset,
     //! and that the GDALProxyPoolDataset limits the number of simultaneously
     //! opened real datasets (controlled by GDAL_MAX_DATASET_POOL_SIZE). Hence 500 is not too big.
+    //! The size of the cache can be changed with the GTI_SOURCE_CACHE_SIZE
+    //! configuration option.
     lru11::Cache<std::string, std::shared_ptr<GDALDataset>> m_oMapSharedSources{
-        500};
+        GTIGetSourceCacheSize()};
 
     //! Mask band (e.g. for JPEG compressed + mask band)
     std::unique_ptr<GDALTileIndexBand> m_poMaskBand{};
@@ -324,6 +341,14 @@ class GDALTileIndexDataset final : public GDALPamDataset
     //! Sort sources according to m_nSortFieldIndex.
     void SortSourceDesc();
 
+    //! Find sources of m_aoSourceDesc[] whose output window in the pixel
+    //! buffer does not intersect the one of any other source, and that
+    //! can thus be rendered independently of the compositing order.
+    size_t FindIndependentSources(double dfXOff, double dfYOff,
+                                  double dfXSize, double dfYSize,
+                                  int nBufXSize, int nBufYSize,
+                                  std::vector<bool> &abIndependent);
+
     //! Whether the output buffer needs to be nodata initialized, or if
     //! sources are fully covering it.
     bool NeedInitBuffer(int nBandCount, const int *panBandMap) const;
@@ -3369,7 +3394,9 @@ CPLErr GDALTileIndexDataset::IRasterIO(
                                nXSize, nYSize, dfXOff, dfYOff, dfXSize, dfYSize,
                                nBufXSize, nBufYSize, pData, eBufType,
                                nBandCount, panBandMap, nPixelSpace, nLineSpace,
-                               nBandSpace, psExtraArg](SourceDesc &oSourceDesc)
+                               nBandSpace, psExtraArg](
+                                  SourceDesc &oSourceDesc,
+                                  VRTSource::WorkingState &oWorkingState)
     {
         auto &poTileDS = oSourceDesc.poDS;
         auto &poSource = oSourceDesc.poSource;
@@ -3458,7 +3485,7 @@ CPLErr GDALTileIndexDataset::IRasterIO(
                     eErr = poSource->RasterIO(
                         poTileBand->GetRasterDataType(), nXOff, nYOff, nXSize,
                         nYSize, pabyBandData, nBufXSize, nBufYSize, eBufType,
-                        nPixelSpace, nLineSpace, &sExtraArg, m_oWorkingState);
+                        nPixelSpace, nLineSpace, &sExtraArg, oWorkingState);
                 }
             }
             return eErr;
@@ -3697,7 +3724,7 @@ CPLErr GDALTileIndexDataset::IRasterIO(
                     papoBands[nBandNr - 1]->GetRasterDataType(), nXOff, nYOff,
                     nXSize, nYSize, pabyBandData, nBufXSize, nBufYSize,
                     eBufType, nPixelSpace, nLineSpace, &sExtraArg,
-                    m_oWorkingState);
+                    oWorkingState);
             }
         }
         return eErr;
@@ -3705,24 +3732,197 @@ CPLErr GDALTileIndexDataset::IRasterIO(
 
     if (!bNeedInitBuffer)
     {
-        return RenderSource(m_aoSourceDesc.back());
+        return RenderSource(m_aoSourceDesc.back(), m_oWorkingState);
     }
     else
     {
         InitBuffer(pData, nBufXSize, nBufYSize, eBufType, nBandCount,
                    panBandMap, nPixelSpace, nLineSpace, nBandSpace);
 
-        // Now render from bottom of the stack to top.
-        for (auto &oSourceDesc : m_aoSourceDesc)
+        // Sources that do not overlap any other one can be rendered in
+        // any order, and thus in worker threads. The other ones are rendered
+        // by this thread, in z-order, concurrently with the workers.
+        const int nThreads = VRTGetNumThreadsForSourcesIO();
+        std::vector<bool> abIndependent;
+        const size_t nIndependent =
+            nThreads > 1 && m_aoSourceDesc.size() > 1
+                ? FindIndependentSources(dfXOff, dfYOff, dfXSize, dfYSize,
+                                         nBufXSize, nBufYSize, abIndependent)
+                : 0;
+        auto poThreadPool =
+            nIndependent > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+        auto poQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+
+        if (!poQueue)
+        {
+            // Now render from bottom of the stack to top.
+            for (auto &oSourceDesc : m_aoSourceDesc)
+            {
+                if (oSourceDesc.poDS &&
+                    RenderSource(oSourceDesc, m_oWorkingState) != CE_None)
+                    return CE_Failure;
+            }
+
+            return CE_None;
+        }
+
+        CPLDebugOnly("GTI", "IRasterIO(): rendering %d sources in parallel",
+                     static_cast<int>(nIndependent));
+
+        struct Job
+        {
+            const decltype(RenderSource) *pRenderSource = nullptr;
+            SourceDesc *poSourceDesc = nullptr;
+            VRTSource::WorkingState oWorkingState{};
+            std::atomic<bool> *pbFailure = nullptr;
+            std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+            CPLErr eErr = CE_None;
+        };
+
+        const auto JobRunner = [](void *pJobData)
+        {
+            auto psJob = static_cast<Job *>(pJobData);
+            if (*(psJob->pbFailure))
+                return;
+            CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+            psJob->eErr = (*psJob->pRenderSource)(*(psJob->poSourceDesc),
+                                                  psJob->oWorkingState);
+            CPLUninstallErrorHandlerAccumulator();
+            if (psJob->eErr != CE_None)
+                *(psJob->pbFailure) = true;
+        };
+
+        std::atomic<bool> bFailure{false};
+        std::vector<Job> asJobs(nIndependent);
+        size_t iJob = 0;
+        for (size_t i = 0; i < m_aoSourceDesc.size(); ++i)
         {
-            if (oSourceDesc.poDS && RenderSource(oSourceDesc) != CE_None)
-                return CE_Failure;
+            if (!abIndependent[i])
+                continue;
+            Job &sJob = asJobs[iJob++];
+            sJob.pRenderSource = &RenderSource;
+            sJob.poSourceDesc = &m_aoSourceDesc[i];
+            sJob.pbFailure = &bFailure;
+            if (!poQueue->SubmitJob(JobRunner, &sJob))
+                JobRunner(&sJob);
         }
 
-        return CE_None;
+        CPLErr eErr = CE_None;
+        for (size_t i = 0; i < m_aoSourceDesc.size(); ++i)
+        {
+            auto &oSourceDesc = m_aoSourceDesc[i];
+            if (!abIndependent[i] && oSourceDesc.poDS && !bFailure &&
+                RenderSource(oSourceDesc, m_oWorkingState) != CE_None)
+            {
+                eErr = CE_Failure;
+                bFailure = true;
+            }
+        }
+        poQueue->WaitCompletion();
+
+        // Re-emit errors of workers in the calling thread
+        for (const auto &sJob : asJobs)
+        {
+            for (const auto &oError : sJob.aoErrors)
+            {
+                CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+            }
+            if (sJob.eErr != CE_None)
+                eErr = CE_Failure;
+        }
+
+        return eErr;
     }
 }
 
+/************************************************************************/
+/*                       FindIndependentSources()                       */
+/************************************************************************/
+
+size_t GDALTileIndexDataset::FindIndependentSources(
+    double dfXOff, double dfYOff, double dfXSize, double dfYSize,
+    int nBufXSize, int nBufYSize, std::vector<bool> &abIndependent)
+{
+    struct OutWindow
+    {
+        int nXOff;
+        int nYOff;
+        int nXSize;
+        int nYSize;
+    };
+
+    const size_t nSources = m_aoSourceDesc.size();
+    abIndependent.assign(nSources, false);
+
+    // Pairwise comparison of windows below
+    constexpr size_t MAX_SOURCES = 1000;
+    if (nSources > MAX_SOURCES)
+        return 0;
+
+    std::vector<OutWindow> aoOutWindows(nSources, OutWindow{0, 0, 0, 0});
+    std::vector<bool> abValid(nSources, false);
+    std::map<std::string, int> oMapNameCount;
+    for (size_t i = 0; i < nSources; ++i)
+    {
+        auto &oSourceDesc = m_aoSourceDesc[i];
+        if (!oSourceDesc.poDS)
+            continue;
+        auto &poSource = oSourceDesc.poSource;
+        poSource->SetRasterBand(oSourceDesc.poDS->GetRasterBand(1), false);
+
+        double dfReqXOff = 0.0;
+        double dfReqYOff = 0.0;
+        double dfReqXSize = 0.0;
+        double dfReqYSize = 0.0;
+        int nReqXOff = 0;
+        int nReqYOff = 0;
+        int nReqXSize = 0;
+        int nReqYSize = 0;
+        OutWindow &sWindow = aoOutWindows[i];
+        bool bError = false;
+        if (!poSource->GetSrcDstWindow(
+                dfXOff, dfYOff, dfXSize, dfYSize, nBufXSize, nBufYSize,
+                &dfReqXOff, &dfReqYOff, &dfReqXSize, &dfReqYSize, &nReqXOff,
+                &nReqYOff, &nReqXSize, &nReqYSize, &sWindow.nXOff,
+                &sWindow.nYOff, &sWindow.nXSize, &sWindow.nYSize, bError))
+        {
+            if (bError)
+                return 0;
+            continue;
+        }
+        abValid[i] = true;
+        // Sources pointing to the same dataset share the same dataset
+        // object, which cannot be used from several threads.
+        oMapNameCount[oSourceDesc.osName]++;
+    }
+
+    size_t nIndependent = 0;
+    for (size_t i = 0; i < nSources; ++i)
+    {
+        if (!abValid[i] || oMapNameCount[m_aoSourceDesc[i].osName] > 1)
+            continue;
+        const OutWindow &sWindow = aoOutWindows[i];
+        bool bOverlap = false;
+        for (size_t j = 0; j < nSources && !bOverlap; ++j)
+        {
+            if (j == i || !abValid[j])
+                continue;
+            const OutWindow &sOther = aoOutWindows[j];
+            bOverlap = sWindow.nXOff < sOther.nXOff + sOther.nXSize &&
+                       sOther.nXOff < sWindow.nXOff + sWindow.nXSize &&
+                       sWindow.nYOff < sOther.nYOff + sOther.nYSize &&
+                       sOther.nYOff < sWindow.nYOff + sWindow.nYSize;
+        }
+        if (!bOverlap)
+        {
+            abIndependent[i] = true;
+            ++nIndependent;
+        }
+    }
+
+    return nIndependent;
+}
+
 /************************************************************************/
 /*                         GDALRegister_GTI()                           */
 /************************************************************************/
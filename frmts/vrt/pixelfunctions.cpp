@@ -30,8 +30,11 @@
 #include <cmath>
 #include "gdal.h"
 #include "vrtdataset.h"
+#include "vrtexpression.h"
 
+#include <algorithm>
 #include <limits>
+#include <string>
 
 template <typename T>
 inline double GetSrcVal(const void *pSource, GDALDataType eSrcType, T ii)
@@ -1630,6 +1633,110 @@ static CPLErr MaxPixelFunc(void **papoSources, int nSources, void *pData,
                                          nPixelSpace, nLineSpace, papszArgs);
 }
 
+/************************************************************************/
+/*                        ExpressionPixelFunc()                         */
+/************************************************************************/
+
+static const char pszExpressionPixelFuncMetadata[] =
+    "<PixelFunctionArgumentsList>"
+    "   <Argument name='expression' description='Expression to evaluate, "
+    "where B1, B2, ... designate the sources' type='string' />"
+    "</PixelFunctionArgumentsList>";
+
+static CPLErr ExpressionPixelFunc(void **papoSources, int nSources,
+                                  void *pData, int nXSize, int nYSize,
+                                  GDALDataType eSrcType, GDALDataType eBufType,
+                                  int nPixelSpace, int nLineSpace,
+                                  CSLConstList papszArgs)
+{
+    /* ---- Init ---- */
+    if (GDALDataTypeIsComplex(eSrcType))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "expression cannot by applied to complex data types");
+        return CE_Failure;
+    }
+
+    const char *pszExpression = CSLFetchNameValue(papszArgs, "expression");
+    if (pszExpression == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Missing pixel function argument: expression");
+        return CE_Failure;
+    }
+
+    // The expression is compiled once per thread, and re-used as long as
+    // it does not change.
+    thread_local std::string tlsExpression;
+    thread_local std::unique_ptr<VRTExpression> tlsCompiledExpression;
+    if (!tlsCompiledExpression || tlsExpression != pszExpression)
+    {
+        tlsCompiledExpression = VRTExpression::Compile(pszExpression);
+        if (!tlsCompiledExpression)
+            return CE_Failure;
+        tlsExpression = pszExpression;
+    }
+    const VRTExpression &oExpression = *tlsCompiledExpression;
+
+    const int nBands = oExpression.GetMaxBandIndex();
+    if (nBands > nSources)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Expression references B%d, but there are only %d sources",
+                 nBands, nSources);
+        return CE_Failure;
+    }
+
+    /* ---- Set pixels ---- */
+    constexpr size_t CHUNK_SIZE = VRTExpression::CHUNK_SIZE;
+    const int nSrcTypeSize = GDALGetDataTypeSizeBytes(eSrcType);
+    std::vector<double> adfBandValues(static_cast<size_t>(nBands) *
+                                      CHUNK_SIZE);
+    std::vector<const double *> apdfBands(nBands);
+    double adfResult[CHUNK_SIZE];
+    VRTExpression::Workspace oWorkspace;
+    for (int iLine = 0; iLine < nYSize; ++iLine)
+    {
+        for (int iCol = 0; iCol < nXSize; iCol += static_cast<int>(CHUNK_SIZE))
+        {
+            const int nCount =
+                std::min(static_cast<int>(CHUNK_SIZE), nXSize - iCol);
+            const size_t ii = static_cast<size_t>(iLine) * nXSize + iCol;
+            for (int iBand = 0; iBand < nBands; ++iBand)
+            {
+                const GByte *pabySrc =
+                    static_cast<const GByte *>(papoSources[iBand]) +
+                    ii * nSrcTypeSize;
+                if (eSrcType == GDT_Float64)
+                {
+                    // No conversion needed
+                    apdfBands[iBand] =
+                        reinterpret_cast<const double *>(pabySrc);
+                }
+                else
+                {
+                    double *pdfBand = adfBandValues.data() + iBand * CHUNK_SIZE;
+                    GDALCopyWords(pabySrc, eSrcType, nSrcTypeSize, pdfBand,
+                                  GDT_Float64, sizeof(double), nCount);
+                    apdfBands[iBand] = pdfBand;
+                }
+            }
+
+            oExpression.Evaluate(apdfBands.data(), nCount, adfResult,
+                                 oWorkspace);
+
+            GDALCopyWords(adfResult, GDT_Float64, sizeof(double),
+                          static_cast<GByte *>(pData) +
+                              static_cast<GSpacing>(nLineSpace) * iLine +
+                              static_cast<GSpacing>(iCol) * nPixelSpace,
+                          eBufType, nPixelSpace, nCount);
+        }
+    }
+
+    /* ---- Return success ---- */
+    return CE_None;
+}  // ExpressionPixelFunc
+
 /************************************************************************/
 /*                     GDALRegisterDefaultPixelFunc()                   */
 /************************************************************************/
@@ -1698,6 +1805,8 @@ static CPLErr MaxPixelFunc(void **papoSources, int nSources, void *pData,
  *                      exponential interpolation
  * - "scale": Apply the RasterBand metadata values of "offset" and "scale"
  * - "nan": Convert incoming NoData values to IEEE 754 nan
+ * - "expression": evaluate an arithmetic expression referencing sources
+ *                 as B1, B2, ...
  *
  * @see GDALAddDerivedBandPixelFunc
  *
@@ -1751,5 +1860,7 @@ CPLErr GDALRegisterDefaultPixelFunc()
                                         pszMinMaxFuncMetadataNodata);
     GDALAddDerivedBandPixelFuncWithArgs("max", MaxPixelFunc,
                                         pszMinMaxFuncMetadataNodata);
+    GDALAddDerivedBandPixelFuncWithArgs("expression", ExpressionPixelFunc,
+                                        pszExpressionPixelFuncMetadata);
     return CE_None;
 }
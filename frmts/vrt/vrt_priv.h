@@ -57,6 +57,8 @@ CPLStringList VRTParseCategoryNames(const CPLXMLNode *psCategoryNames);
 std::unique_ptr<GDALColorTable>
 VRTParseColorTable(const CPLXMLNode *psColorTable);
 
+int VRTGetNumThreadsForSourcesIO();
+
 #endif
 
 #endif  // VRT_PRIV_H_INCLUDED
@@ -2288,17 +2288,31 @@ CPLErr VRTDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
         // they don't necessary instantiate all underlying rasterbands.
         VRTSourcedRasterBand *poBand =
             static_cast<VRTSourcedRasterBand *>(papoBands[nBands - 1]);
-        for (int iSource = 0; eErr == CE_None && iSource < poBand->nSources;
-             iSource++)
+        std::vector<int> anCandidateSources;
+        if (psExtraArg->bFloatingPointWindowValidity)
+        {
+            poBand->GetSourcesIntersectingWindow(
+                psExtraArg->dfXOff, psExtraArg->dfYOff, psExtraArg->dfXSize,
+                psExtraArg->dfYSize, anCandidateSources);
+        }
+        else
+        {
+            poBand->GetSourcesIntersectingWindow(nXOff, nYOff, nXSize, nYSize,
+                                                 anCandidateSources);
+        }
+        const int nCandidateSources =
+            static_cast<int>(anCandidateSources.size());
+        for (int iCandidate = 0;
+             eErr == CE_None && iCandidate < nCandidateSources; iCandidate++)
         {
             psExtraArg->pfnProgress = GDALScaledProgress;
             psExtraArg->pProgressData = GDALCreateScaledProgress(
-                1.0 * iSource / poBand->nSources,
-                1.0 * (iSource + 1) / poBand->nSources, pfnProgressGlobal,
+                1.0 * iCandidate / nCandidateSources,
+                1.0 * (iCandidate + 1) / nCandidateSources, pfnProgressGlobal,
                 pProgressDataGlobal);
 
-            VRTSimpleSource *poSource =
-                static_cast<VRTSimpleSource *>(poBand->papoSources[iSource]);
+            VRTSimpleSource *poSource = static_cast<VRTSimpleSource *>(
+                poBand->papoSources[anCandidateSources[iCandidate]]);
 
             eErr = poSource->DatasetRasterIO(
                 poBand->GetRasterDataType(), nXOff, nYOff, nXSize, nYSize,
@@ -2817,6 +2831,14 @@ std::string VRTDataset::BuildSourceFilename(const char *pszFilename,
     std::string osSrcDSName;
     if (pszVRTPath != nullptr && bRelativeToVRT)
     {
+        // Subdataset and special syntaxes are all of the form PREFIX:...
+        // Plain filenames, by far the most common case in mosaics with many
+        // sources, skip probing each driver.
+        if (strchr(pszFilename, ':') == nullptr)
+        {
+            return CPLProjectRelativeFilename(pszVRTPath, pszFilename);
+        }
+
         // Try subdatasetinfo API first
         // Note: this will become the only branch when subdatasetinfo will become
         //       available for NITF_IM, RASTERLITE and TILEDB
@@ -35,6 +35,7 @@
 
 #include "cpl_hash_set.h"
 #include "cpl_minixml.h"
+#include "cpl_quad_tree.h"
 #include "gdal_pam.h"
 #include "gdal_priv.h"
 #include "gdal_rat.h"
@@ -664,6 +665,10 @@ class VRTProcessedDataset final : public VRTDataset
                    std::vector<double> &adfInNoData,
                    std::vector<double> &adfOutNoData);
     bool ProcessRegion(int nXOff, int nYOff, int nBufXSize, int nBufYSize);
+
+    bool RunSteps(int nXOff, int nYOff, int nBufXSize, int nBufYSize,
+                  const double adfSrcGT[6], std::vector<NoInitByte> &abyInput,
+                  std::vector<NoInitByte> &abyOutput) const;
 };
 
 /************************************************************************/
@@ -826,11 +831,33 @@ class CPL_DLL VRTSourcedRasterBand CPL_NON_FINAL : public VRTRasterBand
     char **m_papszSourceList = nullptr;
     int m_nSkipBufferInitialization = -1;
 
+    // Spatial index over the destination windows of simple sources, built
+    // lazily when the number of sources is large enough.
+    CPLQuadTree *m_hSourcesIndex = nullptr;
+    std::vector<int> m_anNonIndexedSources{};
+    int m_nSourcesIndexed = 0;
+
+    void InvalidateSourcesIndex();
+
     bool CanUseSourcesMinMaxImplementations();
 
     bool IsMosaicOfNonOverlappingSimpleSourcesOfFullRasterNoResAndTypeChange(
         bool bAllowMaxValAdjustment) const;
 
+    bool CanReadSourcesInParallel(int nXOff, int nYOff, int nXSize, int nYSize,
+                                  int nBufXSize, int nBufYSize,
+                                  const GDALRasterIOExtraArg *psExtraArg,
+                                  const std::vector<int> &anCandidateSources,
+                                  std::vector<int> &anSourceIndices) const;
+
+    CPLErr ReadSourcesInParallel(const std::vector<int> &anSourceIndices,
+                                 int nThreads, int nXOff, int nYOff,
+                                 int nXSize, int nYSize, void *pData,
+                                 int nBufXSize, int nBufYSize,
+                                 GDALDataType eBufType, GSpacing nPixelSpace,
+                                 GSpacing nLineSpace,
+                                 const GDALRasterIOExtraArg *psExtraArg);
+
     CPL_DISALLOW_COPY_ASSIGN(VRTSourcedRasterBand)
 
   protected:
@@ -944,6 +971,10 @@ class CPL_DLL VRTSourcedRasterBand CPL_NON_FINAL : public VRTRasterBand
         GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
         int nBufXSize, int nBufYSize, GDALRasterIOExtraArg *psExtraArg) const;
 
+    void GetSourcesIntersectingWindow(double dfXOff, double dfYOff,
+                                      double dfXSize, double dfYSize,
+                                      std::vector<int> &anSourceIndices);
+
     virtual CPLErr IReadBlock(int, int, void *) override;
 
     virtual void GetFileList(char ***ppapszFileList, int *pnSize,
@@ -0,0 +1,821 @@
+/******************************************************************************
+ *
+ * Project:  Virtual GDAL Datasets
+ * Purpose:  Compiled arithmetic expressions for derived bands
+ * Author:   agent, <agent at local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent at local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "vrtexpression.h"
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_string.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+/************************************************************************/
+/*                              ApplyOp()                               */
+/************************************************************************/
+
+template <class F>
+static inline void ApplyUnary(double *pdfDst, const double *pdfA, size_t nCount,
+                              F f)
+{
+    for (size_t i = 0; i < nCount; ++i)
+        pdfDst[i] = f(pdfA[i]);
+}
+
+template <class F>
+static inline void ApplyBinary(double *pdfDst, const double *pdfA,
+                               const double *pdfB, size_t nCount, F f)
+{
+    for (size_t i = 0; i < nCount; ++i)
+        pdfDst[i] = f(pdfA[i], pdfB[i]);
+}
+
+static void ApplyOp(VRTExpression::Op eOp, double *pdfDst, const double *pdfA,
+                    const double *pdfB, const double *pdfC, size_t nCount)
+{
+    using Op = VRTExpression::Op;
+    switch (eOp)
+    {
+        case Op::ADD:
+            ApplyBinary(pdfDst, pdfA, pdfB, nCount,
+                        [](double a, double b) { return a + b; });
+            break;
+        case Op::SUB:
+            ApplyBinary(pdfDst, pdfA, pdfB, nCount,
+                        [](double a, double b) { return a - b; });
+            break;
+        case Op::MUL:
+            ApplyBinary(pdfDst, pdfA, pdfB, nCount,
+                        [](double a, double b) { return a * b; });
+            break;
+        case Op::DIV:
+            ApplyBinary(pdfDst, pdfA, pdfB, nCount,
+                        [](double a, double b) { return a / b; });
+            break;
+        case Op::POW:
+            ApplyBinary(pdfDst, pdfA, pdfB, nCount,
+                        [](double a, double b) { return std::pow(a, b); });
+            break;
+        case Op::NEG:
+            ApplyUnary(pdfDst, pdfA, nCount, [](double a) { return -a; });
+            break;
+        case Op::NOT:
+            ApplyUnary(pdfDst, pdfA, nCount,
+                       [](double a) { return a == 0 ? 1.0 : 0.0; });
+            break;
+        case Op::LT:
+            ApplyBinary(pdfDst, pdfA, pdfB, nCount,
+                        [](double a, double b) { return a < b ? 1.0 : 0.0; });
+            break;
+        case Op::LE:
+            ApplyBinary(pdfDst, pdfA, pdfB, nCount,
+                        [](double a, double b) { return a <= b ? 1.0 : 0.0; });
+            break;
+        case Op::GT:
+            ApplyBinary(pdfDst, pdfA, pdfB, nCount,
+                        [](double a, double b) { return a > b ? 1.0 : 0.0; });
+            break;
+        case Op::GE:
+            ApplyBinary(pdfDst, pdfA, pdfB, nCount,
+                        [](double a, double b) { return a >= b ? 1.0 : 0.0; });
+            break;
+        case Op::EQ:
+            ApplyBinary(pdfDst, pdfA, pdfB, nCount,
+                        [](double a, double b) { return a == b ? 1.0 : 0.0; });
+            break;
+        case Op::NE:
+            ApplyBinary(pdfDst, pdfA, pdfB, nCount,
+                        [](double a, double b) { return a != b ? 1.0 : 0.0; });
+            break;
+        case Op::AND:
+            ApplyBinary(pdfDst, pdfA, pdfB, nCount, [](double a, double b)
+                        { return a != 0 && b != 0 ? 1.0 : 0.0; });
+            break;
+        case Op::OR:
+            ApplyBinary(pdfDst, pdfA, pdfB, nCount, [](double a, double b)
+                        { return a != 0 || b != 0 ? 1.0 : 0.0; });
+            break;
+        case Op::SELECT:
+            for (size_t i = 0; i < nCount; ++i)
+                pdfDst[i] = pdfA[i] != 0 ? pdfB[i] : pdfC[i];
+            break;
+        case Op::MIN:
+            ApplyBinary(pdfDst, pdfA, pdfB, nCount,
+                        [](double a, double b) { return b < a ? b : a; });
+            break;
+        case Op::MAX:
+            ApplyBinary(pdfDst, pdfA, pdfB, nCount,
+                        [](double a, double b) { return b > a ? b : a; });
+            break;
+        case Op::ABS:
+            ApplyUnary(pdfDst, pdfA, nCount,
+                       [](double a) { return std::fabs(a); });
+            break;
+        case Op::SQRT:
+            ApplyUnary(pdfDst, pdfA, nCount,
+                       [](double a) { return std::sqrt(a); });
+            break;
+        case Op::EXP:
+            ApplyUnary(pdfDst, pdfA, nCount,
+                       [](double a) { return std::exp(a); });
+            break;
+        case Op::LOG:
+            ApplyUnary(pdfDst, pdfA, nCount,
+                       [](double a) { return std::log(a); });
+            break;
+        case Op::LOG10:
+            ApplyUnary(pdfDst, pdfA, nCount,
+                       [](double a) { return std::log10(a); });
+            break;
+        case Op::SIN:
+            ApplyUnary(pdfDst, pdfA, nCount,
+                       [](double a) { return std::sin(a); });
+            break;
+        case Op::COS:
+            ApplyUnary(pdfDst, pdfA, nCount,
+                       [](double a) { return std::cos(a); });
+            break;
+        case Op::TAN:
+            ApplyUnary(pdfDst, pdfA, nCount,
+                       [](double a) { return std::tan(a); });
+            break;
+        case Op::ASIN:
+            ApplyUnary(pdfDst, pdfA, nCount,
+                       [](double a) { return std::asin(a); });
+            break;
+        case Op::ACOS:
+            ApplyUnary(pdfDst, pdfA, nCount,
+                       [](double a) { return std::acos(a); });
+            break;
+        case Op::ATAN:
+            ApplyUnary(pdfDst, pdfA, nCount,
+                       [](double a) { return std::atan(a); });
+            break;
+        case Op::ATAN2:
+            ApplyBinary(pdfDst, pdfA, pdfB, nCount,
+                        [](double a, double b) { return std::atan2(a, b); });
+            break;
+        case Op::FLOOR:
+            ApplyUnary(pdfDst, pdfA, nCount,
+                       [](double a) { return std::floor(a); });
+            break;
+        case Op::CEIL:
+            ApplyUnary(pdfDst, pdfA, nCount,
+                       [](double a) { return std::ceil(a); });
+            break;
+        case Op::ROUND:
+            ApplyUnary(pdfDst, pdfA, nCount,
+                       [](double a) { return std::round(a); });
+            break;
+        case Op::ISNAN:
+            ApplyUnary(pdfDst, pdfA, nCount,
+                       [](double a) { return std::isnan(a) ? 1.0 : 0.0; });
+            break;
+    }
+}
+
+/************************************************************************/
+/*                         VRTExpressionParser                          */
+/************************************************************************/
+
+// Operand of an instruction during parsing
+struct VRTExpressionOperand
+{
+    enum class Kind
+    {
+        NONE,
+        BAND,
+        CONSTANT,
+        TEMP
+    };
+
+    Kind eKind = Kind::NONE;
+    int nIdx = 0;      // band index (0-based) or temporary index
+    double dfVal = 0;  // constant value
+};
+
+class VRTExpressionParser
+{
+  public:
+    VRTExpressionParser(const char *pszExpression, VRTExpression &oExpression)
+        : m_pszExpression(pszExpression), m_pszCur(pszExpression),
+          m_oExpression(oExpression)
+    {
+    }
+
+    bool Parse();
+
+  private:
+    using Operand = VRTExpressionOperand;
+
+    struct PendingInstruction
+    {
+        VRTExpression::Op eOp;
+        int nTemp;
+        Operand oA;
+        Operand oB;
+        Operand oC;
+    };
+
+    const char *const m_pszExpression;
+    const char *m_pszCur;
+    VRTExpression &m_oExpression;
+    std::vector<PendingInstruction> m_aoInstructions{};
+    int m_nTemps = 0;
+    int m_nMaxBandIndex = 0;
+    int m_nDepth = 0;
+    bool m_bError = false;
+
+    static constexpr int MAX_DEPTH = 128;
+
+    // Temporary results are numbered from TEMP_SLOT_BASE downwards until
+    // the number of bands and constants is known. -1 means no operand.
+    static constexpr int TEMP_SLOT_BASE = -2;
+
+    void Error(const char *pszMsg);
+    void SkipSpaces();
+    bool Consume(const char *pszToken);
+
+    Operand Emit(VRTExpression::Op eOp, const Operand &oA,
+                 const Operand &oB = Operand(), const Operand &oC = Operand());
+
+    Operand ParseTernary();
+    Operand ParseOr();
+    Operand ParseAnd();
+    Operand ParseComparison();
+    Operand ParseAdditive();
+    Operand ParseMultiplicative();
+    Operand ParseUnary();
+    Operand ParsePower();
+    Operand ParsePrimary();
+    Operand ParseFunction(const std::string &osName);
+
+    CPL_DISALLOW_COPY_ASSIGN(VRTExpressionParser)
+};
+
+/************************************************************************/
+/*                               Error()                                */
+/************************************************************************/
+
+void VRTExpressionParser::Error(const char *pszMsg)
+{
+    if (!m_bError)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Invalid expression '%s': %s at position %d", m_pszExpression,
+                 pszMsg, static_cast<int>(m_pszCur - m_pszExpression) + 1);
+        m_bError = true;
+    }
+}
+
+/************************************************************************/
+/*                             SkipSpaces()                             */
+/************************************************************************/
+
+void VRTExpressionParser::SkipSpaces()
+{
+    while (isspace(static_cast<unsigned char>(*m_pszCur)))
+        ++m_pszCur;
+}
+
+/************************************************************************/
+/*                              Consume()                               */
+/************************************************************************/
+
+bool VRTExpressionParser::Consume(const char *pszToken)
+{
+    SkipSpaces();
+    const size_t nLen = strlen(pszToken);
+    if (strncmp(m_pszCur, pszToken, nLen) != 0)
+        return false;
+    // Do not mistake "<=" for "<", "&&" for "&", etc.
+    if (nLen == 1 && (*pszToken == '<' || *pszToken == '>' ||
+                      *pszToken == '!' || *pszToken == '=') &&
+        m_pszCur[1] == '=')
+    {
+        return false;
+    }
+    m_pszCur += nLen;
+    return true;
+}
+
+/************************************************************************/
+/*                                Emit()                                */
+/************************************************************************/
+
+VRTExpressionParser::Operand VRTExpressionParser::Emit(VRTExpression::Op eOp,
+                                                       const Operand &oA,
+                                                       const Operand &oB,
+                                                       const Operand &oC)
+{
+    using Kind = Operand::Kind;
+    if (m_bError)
+        return Operand();
+
+    // Constant folding
+    if (oA.eKind == Kind::CONSTANT &&
+        (oB.eKind == Kind::NONE || oB.eKind == Kind::CONSTANT) &&
+        (oC.eKind == Kind::NONE || oC.eKind == Kind::CONSTANT))
+    {
+        Operand oRes;
+        oRes.eKind = Kind::CONSTANT;
+        ApplyOp(eOp, &oRes.dfVal, &oA.dfVal, &oB.dfVal, &oC.dfVal, 1);
+        return oRes;
+    }
+
+    PendingInstruction sInstr{eOp, m_nTemps++, oA, oB, oC};
+    m_aoInstructions.push_back(sInstr);
+    Operand oRes;
+    oRes.eKind = Kind::TEMP;
+    oRes.nIdx = sInstr.nTemp;
+    return oRes;
+}
+
+/************************************************************************/
+/*                               Parse()                                */
+/************************************************************************/
+
+bool VRTExpressionParser::Parse()
+{
+    const Operand oRes = ParseTernary();
+    SkipSpaces();
+    if (!m_bError && *m_pszCur != '\0')
+        Error("unexpected character");
+    if (m_bError)
+        return false;
+
+    // Assign slots: bands first, then constants, then temporary results
+    auto &oExpr = m_oExpression;
+    oExpr.m_nMaxBandIndex = m_nMaxBandIndex;
+    const auto GetSlot = [this, &oExpr](const Operand &oOperand)
+    {
+        switch (oOperand.eKind)
+        {
+            case Operand::Kind::NONE:
+                break;
+            case Operand::Kind::BAND:
+                return oOperand.nIdx;
+            case Operand::Kind::CONSTANT:
+                oExpr.m_adfConstants.push_back(oOperand.dfVal);
+                return m_nMaxBandIndex +
+                       static_cast<int>(oExpr.m_adfConstants.size()) - 1;
+            case Operand::Kind::TEMP:
+                return TEMP_SLOT_BASE - oOperand.nIdx;  // resolved below
+        }
+        return -1;
+    };
+
+    for (const auto &sPending : m_aoInstructions)
+    {
+        VRTExpression::Instruction sInstr;
+        sInstr.eOp = sPending.eOp;
+        sInstr.nDst = TEMP_SLOT_BASE - sPending.nTemp;
+        sInstr.nA = GetSlot(sPending.oA);
+        sInstr.nB = GetSlot(sPending.oB);
+        sInstr.nC = GetSlot(sPending.oC);
+        oExpr.m_aoInstructions.push_back(sInstr);
+    }
+    oExpr.m_nResultSlot = GetSlot(oRes);
+
+    const int nFirstTempSlot =
+        m_nMaxBandIndex + static_cast<int>(oExpr.m_adfConstants.size());
+    const auto ResolveTemp = [nFirstTempSlot](int &nSlot)
+    {
+        if (nSlot <= TEMP_SLOT_BASE)
+            nSlot = nFirstTempSlot + (TEMP_SLOT_BASE - nSlot);
+    };
+    for (auto &sInstr : oExpr.m_aoInstructions)
+    {
+        ResolveTemp(sInstr.nDst);
+        ResolveTemp(sInstr.nA);
+        ResolveTemp(sInstr.nB);
+        ResolveTemp(sInstr.nC);
+    }
+    ResolveTemp(oExpr.m_nResultSlot);
+    oExpr.m_nTempSlots = m_nTemps;
+
+    return true;
+}
+
+/************************************************************************/
+/*                            ParseTernary()                            */
+/************************************************************************/
+
+VRTExpressionParser::Operand VRTExpressionParser::ParseTernary()
+{
+    if (++m_nDepth > MAX_DEPTH)
+    {
+        Error("too many nested expressions");
+        --m_nDepth;
+        return Operand();
+    }
+    Operand oRes = ParseOr();
+    if (!m_bError && Consume("?"))
+    {
+        const Operand oIfTrue = ParseTernary();
+        if (!m_bError && !Consume(":"))
+            Error("':' expected");
+        const Operand oIfFalse = ParseTernary();
+        oRes = Emit(VRTExpression::Op::SELECT, oRes, oIfTrue, oIfFalse);
+    }
+    --m_nDepth;
+    return oRes;
+}
+
+/************************************************************************/
+/*                              ParseOr()                               */
+/************************************************************************/
+
+VRTExpressionParser::Operand VRTExpressionParser::ParseOr()
+{
+    Operand oRes = ParseAnd();
+    while (!m_bError && Consume("||"))
+        oRes = Emit(VRTExpression::Op::OR, oRes, ParseAnd());
+    return oRes;
+}
+
+/************************************************************************/
+/*                              ParseAnd()                              */
+/************************************************************************/
+
+VRTExpressionParser::Operand VRTExpressionParser::ParseAnd()
+{
+    Operand oRes = ParseComparison();
+    while (!m_bError && Consume("&&"))
+        oRes = Emit(VRTExpression::Op::AND, oRes, ParseComparison());
+    return oRes;
+}
+
+/************************************************************************/
+/*                          ParseComparison()                           */
+/************************************************************************/
+
+VRTExpressionParser::Operand VRTExpressionParser::ParseComparison()
+{
+    using Op = VRTExpression::Op;
+    Operand oRes = ParseAdditive();
+    while (!m_bError)
+    {
+        if (Consume("<="))
+            oRes = Emit(Op::LE, oRes, ParseAdditive());
+        else if (Consume(">="))
+            oRes = Emit(Op::GE, oRes, ParseAdditive());
+        else if (Consume("=="))
+            oRes = Emit(Op::EQ, oRes, ParseAdditive());
+        else if (Consume("!="))
+            oRes = Emit(Op::NE, oRes, ParseAdditive());
+        else if (Consume("<"))
+            oRes = Emit(Op::LT, oRes, ParseAdditive());
+        else if (Consume(">"))
+            oRes = Emit(Op::GT, oRes, ParseAdditive());
+        else
+            break;
+    }
+    return oRes;
+}
+
+/************************************************************************/
+/*                           ParseAdditive()                            */
+/************************************************************************/
+
+VRTExpressionParser::Operand VRTExpressionParser::ParseAdditive()
+{
+    Operand oRes = ParseMultiplicative();
+    while (!m_bError)
+    {
+        if (Consume("+"))
+            oRes = Emit(VRTExpression::Op::ADD, oRes, ParseMultiplicative());
+        else if (Consume("-"))
+            oRes = Emit(VRTExpression::Op::SUB, oRes, ParseMultiplicative());
+        else
+            break;
+    }
+    return oRes;
+}
+
+/************************************************************************/
+/*                        ParseMultiplicative()                         */
+/************************************************************************/
+
+VRTExpressionParser::Operand VRTExpressionParser::ParseMultiplicative()
+{
+    Operand oRes = ParseUnary();
+    while (!m_bError)
+    {
+        if (Consume("*"))
+            oRes = Emit(VRTExpression::Op::MUL, oRes, ParseUnary());
+        else if (Consume("/"))
+            oRes = Emit(VRTExpression::Op::DIV, oRes, ParseUnary());
+        else
+            break;
+    }
+    return oRes;
+}
+
+/************************************************************************/
+/*                             ParseUnary()                             */
+/************************************************************************/
+
+VRTExpressionParser::Operand VRTExpressionParser::ParseUnary()
+{
+    if (++m_nDepth > MAX_DEPTH)
+    {
+        Error("too many nested expressions");
+        --m_nDepth;
+        return Operand();
+    }
+    Operand oRes;
+    if (Consume("-"))
+        oRes = Emit(VRTExpression::Op::NEG, ParseUnary());
+    else if (Consume("+"))
+        oRes = ParseUnary();
+    else if (Consume("!"))
+        oRes = Emit(VRTExpression::Op::NOT, ParseUnary());
+    else
+        oRes = ParsePower();
+    --m_nDepth;
+    return oRes;
+}
+
+/************************************************************************/
+/*                             ParsePower()                             */
+/************************************************************************/
+
+VRTExpressionParser::Operand VRTExpressionParser::ParsePower()
+{
+    Operand oRes = ParsePrimary();
+    // Right-associative, and binds tighter than unary minus on its left:
+    // -2^2 is -(2^2), 2^-1 is 2^(-1)
+    if (!m_bError && Consume("^"))
+        oRes = Emit(VRTExpression::Op::POW, oRes, ParseUnary());
+    return oRes;
+}
+
+/************************************************************************/
+/*                            ParsePrimary()                            */
+/************************************************************************/
+
+VRTExpressionParser::Operand VRTExpressionParser::ParsePrimary()
+{
+    if (m_bError)
+        return Operand();
+
+    SkipSpaces();
+    const char ch = *m_pszCur;
+    if (ch == '(')
+    {
+        ++m_pszCur;
+        const Operand oRes = ParseTernary();
+        if (!m_bError && !Consume(")"))
+            Error("')' expected");
+        return oRes;
+    }
+
+    if (isdigit(static_cast<unsigned char>(ch)) ||
+        (ch == '.' && isdigit(static_cast<unsigned char>(m_pszCur[1]))))
+    {
+        char *pszEnd = nullptr;
+        Operand oRes;
+        oRes.eKind = Operand::Kind::CONSTANT;
+        oRes.dfVal = CPLStrtod(m_pszCur, &pszEnd);
+        m_pszCur = pszEnd;
+        return oRes;
+    }
+
+    if (isalpha(static_cast<unsigned char>(ch)) || ch == '_')
+    {
+        const char *pszStart = m_pszCur;
+        while (isalnum(static_cast<unsigned char>(*m_pszCur)) ||
+               *m_pszCur == '_')
+        {
+            ++m_pszCur;
+        }
+        const std::string osName(pszStart, m_pszCur - pszStart);
+
+        SkipSpaces();
+        if (*m_pszCur == '(')
+        {
+            ++m_pszCur;
+            return ParseFunction(osName);
+        }
+
+        if ((osName[0] == 'B' || osName[0] == 'b') && osName.size() > 1 &&
+            osName.size() <= 6 &&
+            std::all_of(osName.begin() + 1, osName.end(), [](char c)
+                        { return isdigit(static_cast<unsigned char>(c)); }))
+        {
+            const int nBand = atoi(osName.c_str() + 1);
+            if (nBand < 1)
+            {
+                Error("band indices start at 1");
+                return Operand();
+            }
+            m_nMaxBandIndex = std::max(m_nMaxBandIndex, nBand);
+            Operand oRes;
+            oRes.eKind = Operand::Kind::BAND;
+            oRes.nIdx = nBand - 1;
+            return oRes;
+        }
+
+        Operand oRes;
+        oRes.eKind = Operand::Kind::CONSTANT;
+        if (EQUAL(osName.c_str(), "pi"))
+        {
+            oRes.dfVal = M_PI;
+            return oRes;
+        }
+        if (EQUAL(osName.c_str(), "nan"))
+        {
+            oRes.dfVal = std::numeric_limits<double>::quiet_NaN();
+            return oRes;
+        }
+
+        m_pszCur = pszStart;
+        Error(CPLSPrintf("unknown identifier '%s'", osName.c_str()));
+        return Operand();
+    }
+
+    if (ch == '\0')
+        Error("unexpected end of expression");
+    else
+        Error("unexpected character");
+    return Operand();
+}
+
+/************************************************************************/
+/*                           ParseFunction()                            */
+/************************************************************************/
+
+VRTExpressionParser::Operand
+VRTExpressionParser::ParseFunction(const std::string &osName)
+{
+    using Op = VRTExpression::Op;
+
+    struct FunctionDef
+    {
+        const char *pszName;
+        Op eOp;
+        int nArgs;  // -1 for 2 or more arguments
+    };
+
+    static const FunctionDef asFunctions[] = {
+        {"abs", Op::ABS, 1},     {"sqrt", Op::SQRT, 1},
+        {"exp", Op::EXP, 1},     {"log", Op::LOG, 1},
+        {"log10", Op::LOG10, 1}, {"sin", Op::SIN, 1},
+        {"cos", Op::COS, 1},     {"tan", Op::TAN, 1},
+        {"asin", Op::ASIN, 1},   {"acos", Op::ACOS, 1},
+        {"atan", Op::ATAN, 1},   {"atan2", Op::ATAN2, 2},
+        {"floor", Op::FLOOR, 1}, {"ceil", Op::CEIL, 1},
+        {"round", Op::ROUND, 1}, {"isnan", Op::ISNAN, 1},
+        {"pow", Op::POW, 2},     {"min", Op::MIN, -1},
+        {"max", Op::MAX, -1},
+    };
+
+    const FunctionDef *psDef = nullptr;
+    for (const auto &sDef : asFunctions)
+    {
+        if (EQUAL(osName.c_str(), sDef.pszName))
+        {
+            psDef = &sDef;
+            break;
+        }
+    }
+    if (psDef == nullptr)
+    {
+        Error(CPLSPrintf("unknown function '%s'", osName.c_str()));
+        return Operand();
+    }
+
+    std::vector<Operand> aoArgs;
+    if (!Consume(")"))
+    {
+        do
+        {
+            aoArgs.push_back(ParseTernary());
+        } while (!m_bError && Consume(","));
+        if (!m_bError && !Consume(")"))
+            Error("')' expected");
+    }
+    if (m_bError)
+        return Operand();
+
+    const int nArgs = static_cast<int>(aoArgs.size());
+    if ((psDef->nArgs >= 0 && nArgs != psDef->nArgs) ||
+        (psDef->nArgs < 0 && nArgs < 2))
+    {
+        Error(CPLSPrintf("wrong number of arguments for function '%s'",
+                         psDef->pszName));
+        return Operand();
+    }
+
+    if (nArgs == 1)
+        return Emit(psDef->eOp, aoArgs[0]);
+    Operand oRes = Emit(psDef->eOp, aoArgs[0], aoArgs[1]);
+    for (int i = 2; i < nArgs; ++i)
+        oRes = Emit(psDef->eOp, oRes, aoArgs[i]);
+    return oRes;
+}
+
+/************************************************************************/
+/*                              Compile()                               */
+/************************************************************************/
+
+/** Compile an expression.
+ *
+ * Supported syntax: numbers, band references B1, B2..., constants pi and
+ * nan, operators + - * / ^ (power), comparisons (< <= > >= == !=) and
+ * logical operators (&& || !) returning 1 or 0, the C ternary operator
+ * cond ? a : b, and functions abs, sqrt, exp, log, log10, sin, cos, tan,
+ * asin, acos, atan, atan2, floor, ceil, round, isnan, pow, min and max.
+ *
+ * @return a compiled expression, or nullptr in case of error (a CPLError()
+ * is emitted).
+ */
+std::unique_ptr<VRTExpression>
+VRTExpression::Compile(const char *pszExpression)
+{
+    auto poExpr = std::unique_ptr<VRTExpression>(new VRTExpression());
+    VRTExpressionParser oParser(pszExpression, *poExpr);
+    if (!oParser.Parse())
+        return nullptr;
+    return poExpr;
+}
+
+/************************************************************************/
+/*                              Evaluate()                              */
+/************************************************************************/
+
+/** Evaluate the expression on nCount (<= CHUNK_SIZE) values.
+ *
+ * @param papdfBands Array of GetMaxBandIndex() pointers to the input values
+ *                   of each band.
+ * @param nCount Number of values.
+ * @param pdfOut Output array of nCount values.
+ * @param oWorkspace Working buffers, that may be re-used from one call to
+ *                   another.
+ */
+void VRTExpression::Evaluate(const double *const *papdfBands, size_t nCount,
+                             double *pdfOut, Workspace &oWorkspace) const
+{
+    CPLAssert(nCount <= CHUNK_SIZE);
+
+    const int nConstants = static_cast<int>(m_adfConstants.size());
+    const int nFirstTempSlot = m_nMaxBandIndex + nConstants;
+    if (oWorkspace.poExpression != this)
+    {
+        oWorkspace.poExpression = this;
+        oWorkspace.adfValues.resize(
+            static_cast<size_t>(nConstants + m_nTempSlots) * CHUNK_SIZE);
+        oWorkspace.apdfSlots.resize(nFirstTempSlot + m_nTempSlots);
+        for (int i = 0; i < nConstants + m_nTempSlots; ++i)
+        {
+            double *pdfSlot = oWorkspace.adfValues.data() + i * CHUNK_SIZE;
+            if (i < nConstants)
+                std::fill_n(pdfSlot, CHUNK_SIZE, m_adfConstants[i]);
+            oWorkspace.apdfSlots[m_nMaxBandIndex + i] = pdfSlot;
+        }
+    }
+    for (int i = 0; i < m_nMaxBandIndex; ++i)
+        oWorkspace.apdfSlots[i] = papdfBands[i];
+
+    const auto &apdfSlots = oWorkspace.apdfSlots;
+    for (const auto &sInstr : m_aoInstructions)
+    {
+        double *pdfDst =
+            oWorkspace.adfValues.data() +
+            static_cast<size_t>(sInstr.nDst - m_nMaxBandIndex) * CHUNK_SIZE;
+        ApplyOp(sInstr.eOp, pdfDst, apdfSlots[sInstr.nA],
+                sInstr.nB >= 0 ? apdfSlots[sInstr.nB] : nullptr,
+                sInstr.nC >= 0 ? apdfSlots[sInstr.nC] : nullptr, nCount);
+    }
+
+    memcpy(pdfOut, apdfSlots[m_nResultSlot], nCount * sizeof(double));
+}
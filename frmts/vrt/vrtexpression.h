@@ -0,0 +1,142 @@
+/******************************************************************************
+ *
+ * Project:  Virtual GDAL Datasets
+ * Purpose:  Compiled arithmetic expressions for derived bands
+ * Author:   agent, <agent at local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent at local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#ifndef VRTEXPRESSION_H_INCLUDED
+#define VRTEXPRESSION_H_INCLUDED
+
+#ifndef DOXYGEN_SKIP
+
+#include "cpl_port.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+/************************************************************************/
+/*                            VRTExpression                             */
+/************************************************************************/
+
+/** Arithmetic expression compiled into a flat list of instructions, each of
+ * them operating on arrays of up to CHUNK_SIZE values, so that evaluation
+ * has no per-pixel dispatch overhead and its loops can be vectorized by the
+ * compiler.
+ *
+ * Bands are referenced as B1, B2, ... (1-based).
+ */
+class VRTExpression
+{
+  public:
+    //! Maximum number of values processed by a call to Evaluate()
+    static constexpr size_t CHUNK_SIZE = 256;
+
+    static std::unique_ptr<VRTExpression> Compile(const char *pszExpression);
+
+    //! Highest band index (1-based) referenced by the expression, or 0.
+    int GetMaxBandIndex() const
+    {
+        return m_nMaxBandIndex;
+    }
+
+    //! Working buffers for Evaluate(), specific to an expression
+    struct Workspace
+    {
+        const VRTExpression *poExpression = nullptr;
+        std::vector<double> adfValues{};
+        std::vector<const double *> apdfSlots{};
+    };
+
+    void Evaluate(const double *const *papdfBands, size_t nCount,
+                  double *pdfOut, Workspace &oWorkspace) const;
+
+    enum class Op
+    {
+        ADD,
+        SUB,
+        MUL,
+        DIV,
+        POW,
+        NEG,
+        NOT,
+        LT,
+        LE,
+        GT,
+        GE,
+        EQ,
+        NE,
+        AND,
+        OR,
+        SELECT,
+        MIN,
+        MAX,
+        ABS,
+        SQRT,
+        EXP,
+        LOG,
+        LOG10,
+        SIN,
+        COS,
+        TAN,
+        ASIN,
+        ACOS,
+        ATAN,
+        ATAN2,
+        FLOOR,
+        CEIL,
+        ROUND,
+        ISNAN,
+    };
+
+    //! Instruction computing slot nDst from slots nA, nB, nC
+    struct Instruction
+    {
+        Op eOp;
+        int nDst;
+        int nA;
+        int nB;
+        int nC;
+    };
+
+  private:
+    friend class VRTExpressionParser;
+
+    VRTExpression() = default;
+
+    // Slots [0, m_nMaxBandIndex[ are bands, then constants, then
+    // temporary results.
+    int m_nMaxBandIndex = 0;
+    std::vector<double> m_adfConstants{};
+    int m_nTempSlots = 0;
+    std::vector<Instruction> m_aoInstructions{};
+    int m_nResultSlot = -1;
+
+    CPL_DISALLOW_COPY_ASSIGN(VRTExpression)
+};
+
+#endif /* #ifndef DOXYGEN_SKIP */
+
+#endif /* #ifndef VRTEXPRESSION_H_INCLUDED */
@@ -26,11 +26,17 @@
  * DEALINGS IN THE SOFTWARE.
  ****************************************************************************/
 
+#include "cpl_error_internal.h"
 #include "cpl_minixml.h"
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 #include "vrtdataset.h"
+#include "vrt_priv.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <limits>
 #include <map>
 #include <vector>
@@ -897,63 +903,40 @@ void VRTProcessedDataset::GetBlockSize(int *pnBlockXSize,
 }
 
 /************************************************************************/
-/*                            ProcessRegion()                           */
+/*                 IsThreadSafeProcessedDatasetFunc()                   */
 /************************************************************************/
 
-/** Compute pixel values for the specified region.
- *
- * The output is stored in m_abyInput in a pixel-interleaved way.
- */
-bool VRTProcessedDataset::ProcessRegion(int nXOff, int nYOff, int nBufXSize,
-                                        int nBufYSize)
+// Whether the processing function only reads its working data and buffers,
+// so that it can be concurrently called on different parts of a region.
+// LocalScaleOffset and Trimming read auxiliary datasets, and nothing is
+// known about user-registered functions.
+static bool IsThreadSafeProcessedDatasetFunc(const std::string &osAlgorithm)
 {
+    return osAlgorithm == "BandAffineCombination" || osAlgorithm == "LUT";
+}
 
-    CPLAssert(!m_aoSteps.empty());
+/************************************************************************/
+/*                              RunSteps()                              */
+/************************************************************************/
 
-    const int nFirstBandCount = m_aoSteps.front().nInBands;
-    CPLAssert(nFirstBandCount == m_poSrcDS->GetRasterCount());
+/** Run the processing steps on a region.
+ *
+ * abyInput must contain the pixel values of the region in the input data
+ * type of the first step, in a pixel-interleaved way. The output is stored
+ * in abyInput, also in a pixel-interleaved way. abyOutput is used as a
+ * working buffer.
+ */
+bool VRTProcessedDataset::RunSteps(int nXOff, int nYOff, int nBufXSize,
+                                   int nBufYSize, const double adfSrcGT[6],
+                                   std::vector<NoInitByte> &abyInput,
+                                   std::vector<NoInitByte> &abyOutput) const
+{
     const GDALDataType eFirstDT = m_aoSteps.front().eInDT;
-    const int nFirstDTSize = GDALGetDataTypeSizeBytes(eFirstDT);
-    auto &abyInput = m_abyInput;
-    auto &abyOutput = m_abyOutput;
-    try
-    {
-        abyInput.resize(static_cast<size_t>(nBufXSize) * nBufYSize *
-                        nFirstBandCount * nFirstDTSize);
-    }
-    catch (const std::bad_alloc &)
-    {
-        CPLError(CE_Failure, CPLE_OutOfMemory,
-                 "Out of memory allocating working buffer");
-        return false;
-    }
-
-    if (m_poSrcDS->RasterIO(
-            GF_Read, nXOff, nYOff, nBufXSize, nBufYSize, abyInput.data(),
-            nBufXSize, nBufYSize, eFirstDT, nFirstBandCount, nullptr,
-            static_cast<GSpacing>(nFirstDTSize) * nFirstBandCount,
-            static_cast<GSpacing>(nFirstDTSize) * nFirstBandCount * nBufXSize,
-            nFirstDTSize, nullptr) != CE_None)
-    {
-        return false;
-    }
-
     const double dfSrcXOff = nXOff;
     const double dfSrcYOff = nYOff;
     const double dfSrcXSize = nBufXSize;
     const double dfSrcYSize = nBufYSize;
 
-    double adfSrcGT[6];
-    if (m_poSrcDS->GetGeoTransform(adfSrcGT) != CE_None)
-    {
-        adfSrcGT[0] = 0;
-        adfSrcGT[1] = 1;
-        adfSrcGT[2] = 0;
-        adfSrcGT[3] = 0;
-        adfSrcGT[4] = 0;
-        adfSrcGT[5] = 1;
-    }
-
     GDALDataType eLastDT = eFirstDT;
     const auto &oMapFunctions = GetGlobalMapProcessedDatasetFunc();
     for (const auto &oStep : m_aoSteps)
@@ -1020,6 +1003,209 @@ bool VRTProcessedDataset::ProcessRegion(int nXOff, int nYOff, int nBufXSize,
     return true;
 }
 
+/************************************************************************/
+/*                            ProcessRegion()                           */
+/************************************************************************/
+
+/** Compute pixel values for the specified region.
+ *
+ * The output is stored in m_abyInput in a pixel-interleaved way.
+ */
+bool VRTProcessedDataset::ProcessRegion(int nXOff, int nYOff, int nBufXSize,
+                                        int nBufYSize)
+{
+
+    CPLAssert(!m_aoSteps.empty());
+
+    const int nFirstBandCount = m_aoSteps.front().nInBands;
+    CPLAssert(nFirstBandCount == m_poSrcDS->GetRasterCount());
+    const GDALDataType eFirstDT = m_aoSteps.front().eInDT;
+    const int nFirstDTSize = GDALGetDataTypeSizeBytes(eFirstDT);
+    auto &abyInput = m_abyInput;
+    auto &abyOutput = m_abyOutput;
+    try
+    {
+        abyInput.resize(static_cast<size_t>(nBufXSize) * nBufYSize *
+                        nFirstBandCount * nFirstDTSize);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory allocating working buffer");
+        return false;
+    }
+
+    if (m_poSrcDS->RasterIO(
+            GF_Read, nXOff, nYOff, nBufXSize, nBufYSize, abyInput.data(),
+            nBufXSize, nBufYSize, eFirstDT, nFirstBandCount, nullptr,
+            static_cast<GSpacing>(nFirstDTSize) * nFirstBandCount,
+            static_cast<GSpacing>(nFirstDTSize) * nFirstBandCount * nBufXSize,
+            nFirstDTSize, nullptr) != CE_None)
+    {
+        return false;
+    }
+
+    double adfSrcGT[6];
+    if (m_poSrcDS->GetGeoTransform(adfSrcGT) != CE_None)
+    {
+        adfSrcGT[0] = 0;
+        adfSrcGT[1] = 1;
+        adfSrcGT[2] = 0;
+        adfSrcGT[3] = 0;
+        adfSrcGT[4] = 0;
+        adfSrcGT[5] = 1;
+    }
+
+    // Run the whole chain of steps on strips of lines whose working
+    // buffers fit in the CPU caches, rather than each step on the whole
+    // region, which would stream large intermediate buffers (often widened
+    // to Float64) to memory between steps.
+    constexpr size_t WORKING_SET_SIZE = 1024 * 1024;
+    size_t nMaxPixelSize = 0;
+    bool bThreadSafe = true;
+    for (const auto &oStep : m_aoSteps)
+    {
+        nMaxPixelSize = std::max(
+            nMaxPixelSize,
+            std::max(static_cast<size_t>(oStep.nInBands) *
+                         GDALGetDataTypeSizeBytes(oStep.eInDT),
+                     static_cast<size_t>(oStep.nOutBands) *
+                         GDALGetDataTypeSizeBytes(oStep.eOutDT)));
+        if (!IsThreadSafeProcessedDatasetFunc(oStep.osAlgorithm))
+            bThreadSafe = false;
+    }
+    const int nLinesPerStrip = static_cast<int>(std::min<size_t>(
+        nBufYSize,
+        std::max<size_t>(1, WORKING_SET_SIZE / (static_cast<size_t>(nBufXSize) *
+                                                nMaxPixelSize))));
+    if (nLinesPerStrip == nBufYSize)
+    {
+        return RunSteps(nXOff, nYOff, nBufXSize, nBufYSize, adfSrcGT, abyInput,
+                        abyOutput);
+    }
+
+    const int nLastBandCount = m_aoSteps.back().nOutBands;
+    const int nLastDTSize = GDALGetDataTypeSizeBytes(m_aoSteps.back().eOutDT);
+    const size_t nInLineSize =
+        static_cast<size_t>(nBufXSize) * nFirstBandCount * nFirstDTSize;
+    const size_t nOutLineSize =
+        static_cast<size_t>(nBufXSize) * nLastBandCount * nLastDTSize;
+    try
+    {
+        abyOutput.resize(nOutLineSize * nBufYSize);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory allocating working buffer");
+        return false;
+    }
+
+    struct Job
+    {
+        const VRTProcessedDataset *poDS = nullptr;
+        int nXOff = 0;
+        int nYOff = 0;
+        int nBufXSize = 0;
+        int nLines = 0;
+        const double *padfSrcGT = nullptr;
+        const GByte *pabyIn = nullptr;
+        size_t nInSize = 0;
+        GByte *pabyOut = nullptr;
+        std::vector<NoInitByte> abyStripIn{};
+        std::vector<NoInitByte> abyStripOut{};
+        std::atomic<bool> *pbFailure = nullptr;
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+
+        static void Run(Job &sJob)
+        {
+            if (*(sJob.pbFailure))
+                return;
+            try
+            {
+                sJob.abyStripIn.resize(sJob.nInSize);
+            }
+            catch (const std::bad_alloc &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Out of memory allocating working buffer");
+                *(sJob.pbFailure) = true;
+                return;
+            }
+            memcpy(sJob.abyStripIn.data(), sJob.pabyIn, sJob.nInSize);
+            if (!sJob.poDS->RunSteps(sJob.nXOff, sJob.nYOff, sJob.nBufXSize,
+                                     sJob.nLines, sJob.padfSrcGT,
+                                     sJob.abyStripIn, sJob.abyStripOut))
+            {
+                *(sJob.pbFailure) = true;
+                return;
+            }
+            memcpy(sJob.pabyOut, sJob.abyStripIn.data(),
+                   sJob.abyStripIn.size());
+        }
+    };
+
+    const int nStrips = DIV_ROUND_UP(nBufYSize, nLinesPerStrip);
+    const int nThreads =
+        bThreadSafe ? std::min(nStrips, VRTGetNumThreadsForSourcesIO()) : 1;
+    auto poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+
+    std::atomic<bool> bFailure{false};
+    // When running sequentially, a single job (and its working buffers) is
+    // reused for all strips.
+    std::vector<Job> asJobs(poQueue ? nStrips : 1);
+    for (int iStrip = 0; iStrip < nStrips && !bFailure; ++iStrip)
+    {
+        Job &sJob = asJobs[poQueue ? iStrip : 0];
+        const int iLine = iStrip * nLinesPerStrip;
+        sJob.poDS = this;
+        sJob.nXOff = nXOff;
+        sJob.nYOff = nYOff + iLine;
+        sJob.nBufXSize = nBufXSize;
+        sJob.nLines = std::min(nLinesPerStrip, nBufYSize - iLine);
+        sJob.padfSrcGT = adfSrcGT;
+        sJob.pabyIn = &(abyInput[iLine * nInLineSize].value);
+        sJob.nInSize = sJob.nLines * nInLineSize;
+        sJob.pabyOut = &(abyOutput[iLine * nOutLineSize].value);
+        sJob.pbFailure = &bFailure;
+        if (poQueue)
+        {
+            const auto JobRunner = [](void *pData)
+            {
+                auto psJob = static_cast<Job *>(pData);
+                CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+                Job::Run(*psJob);
+                CPLUninstallErrorHandlerAccumulator();
+            };
+            if (!poQueue->SubmitJob(JobRunner, &sJob))
+            {
+                bFailure = true;
+            }
+        }
+        else
+        {
+            Job::Run(sJob);
+        }
+    }
+
+    if (poQueue)
+    {
+        poQueue->WaitCompletion();
+        for (const auto &sJob : asJobs)
+        {
+            for (const auto &oError : sJob.aoErrors)
+            {
+                CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+            }
+        }
+    }
+
+    std::swap(abyInput, abyOutput);
+    return !bFailure;
+}
+
 /************************************************************************/
 /*                        VRTProcessedRasterBand()                      */
 /************************************************************************/
@@ -353,37 +353,45 @@ static CPLErr BandAffineCombinationProcess(
     const double dfClampMax = data->m_dfClampMax;
     for (size_t i = 0; i < nElts; ++i)
     {
-        for (int iDst = 0; iDst < nOutBands; ++iDst)
+        // The nodata test does not depend on the output band, so do it once
+        // per pixel, which leaves the inner loop as a plain dot product.
+        bool bSetNoData = false;
+        for (int iSrc = 0; iSrc < nInBands; ++iSrc)
         {
-            const auto &adfCoefficients = data->m_aadfCoefficients[iDst];
-            double dfVal = adfCoefficients[0];
-            bool bSetNoData = false;
-            for (int iSrc = 0; iSrc < nInBands; ++iSrc)
-            {
-                // written this way to work with a NaN value
-                if (!(padfSrc[iSrc] != padfInNoData[iSrc]))
-                {
-                    bSetNoData = true;
-                    break;
-                }
-                dfVal += adfCoefficients[iSrc + 1] * padfSrc[iSrc];
-            }
-            if (bSetNoData)
+            // written this way to work with a NaN value
+            if (!(padfSrc[iSrc] != padfInNoData[iSrc]))
             {
-                *padfDst = padfOutNoData[iDst];
+                bSetNoData = true;
+                break;
             }
-            else
+        }
+        if (bSetNoData)
+        {
+            for (int iDst = 0; iDst < nOutBands; ++iDst)
+                padfDst[iDst] = padfOutNoData[iDst];
+            padfDst += nOutBands;
+            padfSrc += nInBands;
+            continue;
+        }
+
+        for (int iDst = 0; iDst < nOutBands; ++iDst)
+        {
+            const double *CPL_RESTRICT padfCoefficients =
+                data->m_aadfCoefficients[iDst].data();
+            double dfVal = padfCoefficients[0];
+            for (int iSrc = 0; iSrc < nInBands; ++iSrc)
             {
-                double dfDstVal = GetDstValue(
-                    dfVal, padfOutNoData[iDst],
-                    data->m_adfReplacementDstNodata[iDst],
-                    data->m_eIntendedDstDT, bDstIntendedDTIsInteger);
-                if (dfDstVal < dfClampMin)
-                    dfDstVal = dfClampMin;
-                if (dfDstVal > dfClampMax)
-                    dfDstVal = dfClampMax;
-                *padfDst = dfDstVal;
+                dfVal += padfCoefficients[iSrc + 1] * padfSrc[iSrc];
             }
+            double dfDstVal = GetDstValue(
+                dfVal, padfOutNoData[iDst],
+                data->m_adfReplacementDstNodata[iDst], data->m_eIntendedDstDT,
+                bDstIntendedDTIsInteger);
+            if (dfDstVal < dfClampMin)
+                dfDstVal = dfClampMin;
+            if (dfDstVal > dfClampMax)
+                dfDstVal = dfClampMax;
+            *padfDst = dfDstVal;
             ++padfDst;
         }
         padfSrc += nInBands;
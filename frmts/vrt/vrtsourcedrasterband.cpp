@@ -30,8 +30,10 @@
 #include "cpl_port.h"
 #include "gdal_vrt.h"
 #include "vrtdataset.h"
+#include "vrt_priv.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cmath>
 #include <cstddef>
@@ -45,6 +47,7 @@
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_hash_set.h"
 #include "cpl_minixml.h"
 #include "cpl_progress.h"
@@ -130,6 +133,109 @@ VRTSourcedRasterBand::~VRTSourcedRasterBand()
 {
     VRTSourcedRasterBand::CloseDependentDatasets();
     CSLDestroy(m_papszSourceList);
+    InvalidateSourcesIndex();
+}
+
+/************************************************************************/
+/*                       InvalidateSourcesIndex()                       */
+/************************************************************************/
+
+void VRTSourcedRasterBand::InvalidateSourcesIndex()
+{
+    if (m_hSourcesIndex)
+    {
+        CPLQuadTreeDestroy(m_hSourcesIndex);
+        m_hSourcesIndex = nullptr;
+    }
+    m_anNonIndexedSources.clear();
+    m_nSourcesIndexed = 0;
+}
+
+/************************************************************************/
+/*                    GetSourcesIntersectingWindow()                    */
+/************************************************************************/
+
+// Below that number of sources, iterating over all of them is cheap enough.
+constexpr int MIN_SOURCES_FOR_SPATIAL_INDEX = 64;
+
+/** Return, sorted in increasing order (that is in priority order), the
+ * indices of the sources that may intersect the specified window, expressed
+ * in pixel coordinates of the band. This is a superset of the sources that
+ * actually contribute to it.
+ */
+void VRTSourcedRasterBand::GetSourcesIntersectingWindow(
+    double dfXOff, double dfYOff, double dfXSize, double dfYSize,
+    std::vector<int> &anSourceIndices)
+{
+    anSourceIndices.clear();
+    if (nSources < MIN_SOURCES_FOR_SPATIAL_INDEX)
+    {
+        for (int i = 0; i < nSources; ++i)
+            anSourceIndices.push_back(i);
+        return;
+    }
+
+    // Sources may have been directly added or removed
+    if (m_hSourcesIndex && m_nSourcesIndexed != nSources)
+        InvalidateSourcesIndex();
+
+    if (!m_hSourcesIndex)
+    {
+        CPLRectObj sGlobalBounds;
+        sGlobalBounds.minx = 0;
+        sGlobalBounds.miny = 0;
+        sGlobalBounds.maxx = nRasterXSize;
+        sGlobalBounds.maxy = nRasterYSize;
+        m_hSourcesIndex = CPLQuadTreeCreate(&sGlobalBounds, nullptr);
+
+        for (int i = 0; i < nSources; ++i)
+        {
+            bool bIndexed = false;
+            if (papoSources[i]->IsSimpleSource())
+            {
+                const VRTSimpleSource *poSS =
+                    cpl::down_cast<VRTSimpleSource *>(papoSources[i]);
+                const bool bDstWinSet =
+                    poSS->m_dfDstXOff != -1 || poSS->m_dfDstXSize != -1 ||
+                    poSS->m_dfDstYOff != -1 || poSS->m_dfDstYSize != -1;
+                if (bDstWinSet)
+                {
+                    CPLRectObj sRect;
+                    sRect.minx = poSS->m_dfDstXOff;
+                    sRect.miny = poSS->m_dfDstYOff;
+                    sRect.maxx = poSS->m_dfDstXOff + poSS->m_dfDstXSize;
+                    sRect.maxy = poSS->m_dfDstYOff + poSS->m_dfDstYSize;
+                    CPLQuadTreeInsertWithBounds(
+                        m_hSourcesIndex,
+                        reinterpret_cast<void *>(static_cast<uintptr_t>(i)),
+                        &sRect);
+                    bIndexed = true;
+                }
+            }
+            // Sources without a destination window, or that are not simple
+            // sources, must always be considered.
+            if (!bIndexed)
+                m_anNonIndexedSources.push_back(i);
+        }
+        m_nSourcesIndexed = nSources;
+    }
+
+    CPLRectObj sRect;
+    sRect.minx = dfXOff;
+    sRect.miny = dfYOff;
+    sRect.maxx = dfXOff + dfXSize;
+    sRect.maxy = dfYOff + dfYSize;
+    int nFeatureCount = 0;
+    void **pahRet =
+        CPLQuadTreeSearch(m_hSourcesIndex, &sRect, &nFeatureCount);
+    anSourceIndices = m_anNonIndexedSources;
+    for (int i = 0; i < nFeatureCount; ++i)
+    {
+        anSourceIndices.push_back(
+            static_cast<int>(reinterpret_cast<uintptr_t>(pahRet[i])));
+    }
+    CPLFree(pahRet);
+    std::sort(anSourceIndices.begin(), anSourceIndices.end());
 }
 
 /************************************************************************/
@@ -239,6 +345,227 @@ bool VRTSourcedRasterBand::CanIRasterIOBeForwardedToEachSource(
     return true;
 }
 
+/************************************************************************/
+/*                     VRTGetNumThreadsForSourcesIO()                   */
+/************************************************************************/
+
+int VRTGetNumThreadsForSourcesIO()
+{
+    const char *pszValue = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (pszValue == nullptr)
+        return 1;
+    int nThreads =
+        EQUAL(pszValue, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszValue);
+    if (nThreads > 1024)
+        nThreads = 1024;  // to please Coverity
+    return nThreads;
+}
+
+/************************************************************************/
+/*                      CanReadSourcesInParallel()                      */
+/************************************************************************/
+
+// Returns true if the sources contributing to the request are simple
+// sources that write to non-overlapping areas of the output buffer, and
+// that belong to different datasets. In that situation, the order in which
+// they are composited does not matter, and they can be safely read from
+// different threads.
+bool VRTSourcedRasterBand::CanReadSourcesInParallel(
+    int nXOff, int nYOff, int nXSize, int nYSize, int nBufXSize,
+    int nBufYSize, const GDALRasterIOExtraArg *psExtraArg,
+    const std::vector<int> &anCandidateSources,
+    std::vector<int> &anSourceIndices) const
+{
+    anSourceIndices.clear();
+
+    double dfXOff = nXOff;
+    double dfYOff = nYOff;
+    double dfXSize = nXSize;
+    double dfYSize = nYSize;
+    if (psExtraArg->bFloatingPointWindowValidity)
+    {
+        dfXOff = psExtraArg->dfXOff;
+        dfYOff = psExtraArg->dfYOff;
+        dfXSize = psExtraArg->dfXSize;
+        dfYSize = psExtraArg->dfYSize;
+    }
+
+    struct OutWindow
+    {
+        int nXOff;
+        int nYOff;
+        int nXSize;
+        int nYSize;
+    };
+
+    std::vector<OutWindow> aoOutWindows;
+    std::set<std::string> oSetDatasetNames;
+    std::set<GDALDataset *> oSetDatasetPointers;
+    for (const int i : anCandidateSources)
+    {
+        if (!papoSources[i]->IsSimpleSource())
+            return false;
+        auto poSource = cpl::down_cast<VRTSimpleSource *>(papoSources[i]);
+
+        double dfReqXOff = 0.0;
+        double dfReqYOff = 0.0;
+        double dfReqXSize = 0.0;
+        double dfReqYSize = 0.0;
+        int nReqXOff = 0;
+        int nReqYOff = 0;
+        int nReqXSize = 0;
+        int nReqYSize = 0;
+        OutWindow sWindow{0, 0, 0, 0};
+        bool bError = false;
+        if (!poSource->GetSrcDstWindow(
+                dfXOff, dfYOff, dfXSize, dfYSize, nBufXSize, nBufYSize,
+                &dfReqXOff, &dfReqYOff, &dfReqXSize, &dfReqYSize, &nReqXOff,
+                &nReqYOff, &nReqXSize, &nReqYSize, &sWindow.nXOff,
+                &sWindow.nYOff, &sWindow.nXSize, &sWindow.nYSize, bError))
+        {
+            if (bError)
+                return false;
+            continue;
+        }
+
+        auto poBand = poSource->GetRasterBand();
+        if (poBand == nullptr)
+            return false;
+        auto poSourceDataset = poBand->GetDataset();
+        if (poSourceDataset == nullptr)
+            return false;
+
+        // Check that all sources refer to different datasets.
+        // If the datasets belong to the MEM driver, or have no name, check
+        // GDALDataset* pointer values. Otherwise use dataset name.
+        auto poDriver = poSourceDataset->GetDriver();
+        if ((poDriver && EQUAL(poDriver->GetDescription(), "MEM")) ||
+            poSourceDataset->GetDescription()[0] == '\0')
+        {
+            if (!oSetDatasetPointers.insert(poSourceDataset).second)
+                return false;
+        }
+        else if (!oSetDatasetNames.insert(poSourceDataset->GetDescription())
+                      .second)
+        {
+            return false;
+        }
+
+        for (const auto &sOther : aoOutWindows)
+        {
+            if (sWindow.nXOff < sOther.nXOff + sOther.nXSize &&
+                sOther.nXOff < sWindow.nXOff + sWindow.nXSize &&
+                sWindow.nYOff < sOther.nYOff + sOther.nYSize &&
+                sOther.nYOff < sWindow.nYOff + sWindow.nYSize)
+            {
+                return false;
+            }
+        }
+        aoOutWindows.push_back(sWindow);
+        anSourceIndices.push_back(i);
+    }
+
+    return anSourceIndices.size() >= 2;
+}
+
+/************************************************************************/
+/*                        ReadSourcesInParallel()                       */
+/************************************************************************/
+
+CPLErr VRTSourcedRasterBand::ReadSourcesInParallel(
+    const std::vector<int> &anSourceIndices, int nThreads, int nXOff,
+    int nYOff, int nXSize, int nYSize, void *pData, int nBufXSize,
+    int nBufYSize, GDALDataType eBufType, GSpacing nPixelSpace,
+    GSpacing nLineSpace, const GDALRasterIOExtraArg *psExtraArg)
+{
+    auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    auto poQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+
+    CPLDebugOnly("VRT", "IRasterIO(): reading %d sources in parallel",
+                 static_cast<int>(anSourceIndices.size()));
+
+    struct Job
+    {
+        VRTSourcedRasterBand *poBand = nullptr;
+        VRTSource *poSource = nullptr;
+        int nXOff = 0;
+        int nYOff = 0;
+        int nXSize = 0;
+        int nYSize = 0;
+        void *pData = nullptr;
+        int nBufXSize = 0;
+        int nBufYSize = 0;
+        GDALDataType eBufType = GDT_Unknown;
+        GSpacing nPixelSpace = 0;
+        GSpacing nLineSpace = 0;
+        GDALRasterIOExtraArg sExtraArg{};
+        VRTSource::WorkingState oWorkingState{};
+        std::atomic<bool> *pbFailure = nullptr;
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+        CPLErr eErr = CE_None;
+    };
+
+    const auto JobRunner = [](void *pJobData)
+    {
+        auto psJob = static_cast<Job *>(pJobData);
+        if (*(psJob->pbFailure))
+            return;
+        CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+        psJob->eErr = psJob->poSource->RasterIO(
+            psJob->poBand->GetRasterDataType(), psJob->nXOff, psJob->nYOff,
+            psJob->nXSize, psJob->nYSize, psJob->pData, psJob->nBufXSize,
+            psJob->nBufYSize, psJob->eBufType, psJob->nPixelSpace,
+            psJob->nLineSpace, &psJob->sExtraArg, psJob->oWorkingState);
+        CPLUninstallErrorHandlerAccumulator();
+        if (psJob->eErr != CE_None)
+            *(psJob->pbFailure) = true;
+    };
+
+    std::atomic<bool> bFailure{false};
+    std::vector<Job> asJobs(anSourceIndices.size());
+    for (size_t i = 0; i < anSourceIndices.size(); ++i)
+    {
+        Job &sJob = asJobs[i];
+        sJob.poBand = this;
+        sJob.poSource = papoSources[anSourceIndices[i]];
+        sJob.nXOff = nXOff;
+        sJob.nYOff = nYOff;
+        sJob.nXSize = nXSize;
+        sJob.nYSize = nYSize;
+        sJob.pData = pData;
+        sJob.nBufXSize = nBufXSize;
+        sJob.nBufYSize = nBufYSize;
+        sJob.eBufType = eBufType;
+        sJob.nPixelSpace = nPixelSpace;
+        sJob.nLineSpace = nLineSpace;
+        sJob.sExtraArg = *psExtraArg;
+        sJob.sExtraArg.pfnProgress = nullptr;
+        sJob.sExtraArg.pProgressData = nullptr;
+        sJob.pbFailure = &bFailure;
+        if (!poQueue || !poQueue->SubmitJob(JobRunner, &sJob))
+            JobRunner(&sJob);
+    }
+    if (poQueue)
+        poQueue->WaitCompletion();
+
+    // Re-emit errors of workers in the calling thread, in source order
+    CPLErr eErr = CE_None;
+    for (const auto &sJob : asJobs)
+    {
+        for (const auto &oError : sJob.aoErrors)
+        {
+            CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+        }
+        if (sJob.eErr != CE_None)
+            eErr = CE_Failure;
+    }
+
+    if (eErr == CE_None && psExtraArg->pfnProgress)
+        psExtraArg->pfnProgress(1.0, "", psExtraArg->pProgressData);
+
+    return eErr;
+}
+
 /************************************************************************/
 /*                             IRasterIO()                              */
 /************************************************************************/
@@ -351,6 +678,42 @@ CPLErr VRTSourcedRasterBand::IRasterIO(
         }
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Find the sources that may intersect the request.                */
+    /* -------------------------------------------------------------------- */
+    std::vector<int> anCandidateSources;
+    if (psExtraArg->bFloatingPointWindowValidity)
+    {
+        GetSourcesIntersectingWindow(psExtraArg->dfXOff, psExtraArg->dfYOff,
+                                     psExtraArg->dfXSize, psExtraArg->dfYSize,
+                                     anCandidateSources);
+    }
+    else
+    {
+        GetSourcesIntersectingWindow(nXOff, nYOff, nXSize, nYSize,
+                                     anCandidateSources);
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      If the contributing sources do not overlap and belong to        */
+    /*      different datasets, read them from several threads.             */
+    /* -------------------------------------------------------------------- */
+    if (anCandidateSources.size() > 1)
+    {
+        const int nThreads = VRTGetNumThreadsForSourcesIO();
+        std::vector<int> anSourceIndices;
+        if (nThreads > 1 &&
+            CanReadSourcesInParallel(nXOff, nYOff, nXSize, nYSize, nBufXSize,
+                                     nBufYSize, psExtraArg, anCandidateSources,
+                                     anSourceIndices))
+        {
+            return ReadSourcesInParallel(
+                anSourceIndices, nThreads, nXOff, nYOff, nXSize, nYSize, pData,
+                nBufXSize, nBufYSize, eBufType, nPixelSpace, nLineSpace,
+                psExtraArg);
+        }
+    }
+
     GDALProgressFunc const pfnProgressGlobal = psExtraArg->pfnProgress;
     void *const pProgressDataGlobal = psExtraArg->pProgressData;
 
@@ -359,15 +722,19 @@ CPLErr VRTSourcedRasterBand::IRasterIO(
     /* -------------------------------------------------------------------- */
     CPLErr eErr = CE_None;
     VRTSource::WorkingState oWorkingState;
-    for (int iSource = 0; eErr == CE_None && iSource < nSources; iSource++)
+    const int nCandidateSources = static_cast<int>(anCandidateSources.size());
+    for (int iCandidate = 0; eErr == CE_None && iCandidate < nCandidateSources;
+         iCandidate++)
     {
         psExtraArg->pfnProgress = GDALScaledProgress;
         psExtraArg->pProgressData = GDALCreateScaledProgress(
-            1.0 * iSource / nSources, 1.0 * (iSource + 1) / nSources,
-            pfnProgressGlobal, pProgressDataGlobal);
+            1.0 * iCandidate / nCandidateSources,
+            1.0 * (iCandidate + 1) / nCandidateSources, pfnProgressGlobal,
+            pProgressDataGlobal);
         if (psExtraArg->pProgressData == nullptr)
             psExtraArg->pfnProgress = nullptr;
 
+        const int iSource = anCandidateSources[iCandidate];
         eErr = papoSources[iSource]->RasterIO(
             eDataType, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize,
             nBufYSize, eBufType, nPixelSpace, nLineSpace, psExtraArg,
@@ -416,7 +783,10 @@ int VRTSourcedRasterBand::IGetDataCoverageStatus(int nXOff, int nYOff,
     poLR->addPoint(nXOff, nYOff);
     poPolyNonCoveredBySources->addRingDirectly(poLR);
 
-    for (int iSource = 0; iSource < nSources; iSource++)
+    std::vector<int> anCandidateSources;
+    GetSourcesIntersectingWindow(nXOff, nYOff, nXSize, nYSize,
+                                 anCandidateSources);
+    for (const int iSource : anCandidateSources)
     {
         if (!papoSources[iSource]->IsSimpleSource())
         {
@@ -1761,6 +2131,8 @@ CPLErr VRTSourcedRasterBand::GetHistogram(double dfMin, double dfMax,
 CPLErr VRTSourcedRasterBand::AddSource(VRTSource *poNewSource)
 
 {
+    InvalidateSourcesIndex();
+
     nSources++;
 
     papoSources = static_cast<VRTSource **>(
@@ -2606,6 +2978,7 @@ CPLErr VRTSourcedRasterBand::SetMetadata(char **papszNewMD,
 
         if (EQUAL(pszDomain, "vrt_sources"))
         {
+            InvalidateSourcesIndex();
             for (int i = 0; i < nSources; i++)
                 delete papoSources[i];
             CPLFree(papoSources);
@@ -2670,6 +3043,7 @@ int VRTSourcedRasterBand::CloseDependentDatasets()
     if (nSources == 0)
         return ret;
 
+    InvalidateSourcesIndex();
     for (int i = 0; i < nSources; i++)
         delete papoSources[i];
 
@@ -2870,6 +3244,7 @@ void VRTSourcedRasterBand::RemoveCoveredSources(CSLConstList papszOptions)
             papoSources[iDst++] = papoSources[iSrc];
     }
     nSources = iDst;
+    InvalidateSourcesIndex();
 
     CPLQuadTreeDestroy(hTree);
 #endif
@@ -60,6 +60,7 @@ void WEBPDriverSetCommonMetadata(GDALDriver *poDriver)
     poDriver->SetMetadataItem(GDAL_DMD_LONGNAME, "WEBP");
     poDriver->SetMetadataItem(GDAL_DMD_HELPTOPIC, "drivers/raster/webp.html");
     poDriver->SetMetadataItem(GDAL_DMD_EXTENSION, "webp");
+    poDriver->SetMetadataItem(GDAL_DMD_MAGIC_BYTES, "52494646");
     poDriver->SetMetadataItem(GDAL_DMD_MIMETYPE, "image/webp");
     poDriver->SetMetadataItem(GDAL_DMD_CREATIONDATATYPES, "Byte");
 
@@ -273,6 +273,24 @@ CPLErr GDALWMSDataset::Initialize(CPLXMLNode *config, char **l_papszOpenOptions)
         }
     }
 
+    if (ret == CE_None)
+    {
+        const char *decoded_tile_cache_size =
+            CPLGetXMLValue(config, "DecodedTileCacheSize", "");
+        if (decoded_tile_cache_size[0] == '\0')
+        {
+            decoded_tile_cache_size =
+                CPLGetConfigOption("GDAL_WMS_DECODED_TILE_CACHE_SIZE", "0");
+        }
+        const int nDecodedTileCacheSize = atoi(decoded_tile_cache_size);
+        if (nDecodedTileCacheSize > 0)
+        {
+            m_poDecodedTileCache = std::make_unique<
+                lru11::Cache<std::string, std::shared_ptr<GDALDataset>>>(
+                nDecodedTileCacheSize, 0);
+        }
+    }
+
     CPLXMLNode *service_node = CPLGetXMLNode(config, "Service");
     if (service_node == nullptr)
     {
@@ -151,7 +151,13 @@ CPLErr GDALWMSRasterBand::ReadBlocks(int x, int y, void *buffer, int bx0,
                     }
                     need_this_block = false;
                 }
-                if (ret == CE_None && cache != nullptr)
+                if (ret == CE_None && need_this_block && !advise_read &&
+                    ReadBlockFromDecodedTileCache(request.URL, ix, iy, nBand,
+                                                  p))
+                {
+                    need_this_block = false;
+                }
+                if (ret == CE_None && need_this_block && cache != nullptr)
                 {
                     if (cache->GetItemStatus(request.URL) == CACHE_ITEM_OK)
                     {
@@ -247,9 +253,9 @@ CPLErr GDALWMSRasterBand::ReadBlocks(int x, int y, void *buffer, int bx0,
                         }
                         else
                         {
-                            ret = ReadBlockFromFile(file_name, request.x,
-                                                    request.y, nBand, p,
-                                                    advise_read);
+                            ret = ReadBlockFromFile(
+                                file_name, request.URL, request.x, request.y,
+                                nBand, p, advise_read);
                             if (ret == CE_None)
                             {
                                 if (cache != nullptr)
@@ -940,7 +946,6 @@ CPLErr GDALWMSRasterBand::ReadBlockFromDataset(GDALDataset *ds, int x, int y,
             }
         }
     }
-    GDALClose(ds);
 
     if (color_table != nullptr)
     {
@@ -950,9 +955,61 @@ CPLErr GDALWMSRasterBand::ReadBlockFromDataset(GDALDataset *ds, int x, int y,
     return ret;
 }
 
-CPLErr GDALWMSRasterBand::ReadBlockFromFile(const CPLString &soFileName, int x,
-                                            int y, int to_buffer_band,
-                                            void *buffer, int advise_read)
+CPLErr GDALWMSRasterBand::ReadBlockFromTile(GDALDataset *poTileDS,
+                                            const char *pszKey, int x, int y,
+                                            int to_buffer_band, void *buffer,
+                                            int advise_read)
+{
+    std::unique_ptr<GDALDataset> poTileDSHolder(poTileDS);
+
+    auto poDecodedTileCache = m_parent_dataset->m_poDecodedTileCache.get();
+    if (poDecodedTileCache != nullptr && pszKey != nullptr && !advise_read)
+    {
+        // Decode the whole tile once in memory, so that later requests for
+        // it, from other bands or after eviction from the block cache, do
+        // not need to decompress it again.
+        GDALDriver *poMEMDriver =
+            GetGDALDriverManager()->GetDriverByName("MEM");
+        if (poMEMDriver != nullptr)
+        {
+            std::shared_ptr<GDALDataset> poDecodedDS(poMEMDriver->CreateCopy(
+                "", poTileDS, FALSE, nullptr, nullptr, nullptr));
+            if (poDecodedDS == nullptr)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "GDALWMS: Unable to decode downloaded block.");
+                return CE_Failure;
+            }
+            poTileDSHolder.reset();
+            poDecodedTileCache->insert(pszKey, poDecodedDS);
+            return ReadBlockFromDataset(poDecodedDS.get(), x, y,
+                                        to_buffer_band, buffer, advise_read);
+        }
+    }
+
+    return ReadBlockFromDataset(poTileDS, x, y, to_buffer_band, buffer,
+                                advise_read);
+}
+
+bool GDALWMSRasterBand::ReadBlockFromDecodedTileCache(const char *pszKey,
+                                                      int x, int y,
+                                                      int to_buffer_band,
+                                                      void *buffer)
+{
+    auto poDecodedTileCache = m_parent_dataset->m_poDecodedTileCache.get();
+    if (poDecodedTileCache == nullptr)
+        return false;
+    std::shared_ptr<GDALDataset> poDecodedDS;
+    if (!poDecodedTileCache->tryGet(pszKey, poDecodedDS))
+        return false;
+    return ReadBlockFromDataset(poDecodedDS.get(), x, y, to_buffer_band,
+                                buffer, false) == CE_None;
+}
+
+CPLErr GDALWMSRasterBand::ReadBlockFromFile(const CPLString &soFileName,
+                                            const char *pszKey, int x, int y,
+                                            int to_buffer_band, void *buffer,
+                                            int advise_read)
 {
     GDALDataset *ds = GDALDataset::FromHandle(GDALOpenEx(
         soFileName, GDAL_OF_RASTER | GDAL_OF_READONLY | GDAL_OF_VERBOSE_ERROR,
@@ -964,7 +1021,8 @@ CPLErr GDALWMSRasterBand::ReadBlockFromFile(const CPLString &soFileName, int x,
         return CE_Failure;
     }
 
-    return ReadBlockFromDataset(ds, x, y, to_buffer_band, buffer, advise_read);
+    return ReadBlockFromTile(ds, pszKey, x, y, to_buffer_band, buffer,
+                             advise_read);
 }
 
 CPLErr GDALWMSRasterBand::ReadBlockFromCache(const char *pszKey, int x, int y,
@@ -986,7 +1044,8 @@ CPLErr GDALWMSRasterBand::ReadBlockFromCache(const char *pszKey, int x, int y,
         return CE_Failure;
     }
 
-    return ReadBlockFromDataset(ds, x, y, to_buffer_band, buffer, advise_read);
+    return ReadBlockFromTile(ds, pszKey, x, y, to_buffer_band, buffer,
+                             advise_read);
 }
 
 CPLErr GDALWMSRasterBand::EmptyBlock(int x, int y, int to_buffer_band,
@@ -37,6 +37,7 @@
 #include <algorithm>
 #include <cmath>
 #include <map>
+#include <memory>
 #include <set>
 #include <vector>
 #include <utility>
@@ -44,6 +45,7 @@
 #include "cpl_conv.h"
 #include "cpl_curl_priv.h"
 #include "cpl_http.h"
+#include "cpl_mem_cache.h"
 #include "gdal_alg.h"
 #include "gdal_pam.h"
 #include "gdalwarper.h"
@@ -521,6 +523,10 @@ class GDALWMSDataset final : public GDALPamDataset
     CPLString m_osUserPwd;
     std::string m_osAccept{};  // HTTP Accept header
 
+    // In-memory cache of decoded tiles, keyed by request URL
+    std::unique_ptr<lru11::Cache<std::string, std::shared_ptr<GDALDataset>>>
+        m_poDecodedTileCache{};
+
     GDALWMSDataWindow m_default_data_window;
     int m_default_block_size_x;
     int m_default_block_size_y;
@@ -585,8 +591,14 @@ class GDALWMSRasterBand final : public GDALPamRasterBand
     CPLErr ReadBlockFromCache(const char *pszKey, int x, int y,
                               int to_buffer_band, void *buffer,
                               int advise_read);
-    CPLErr ReadBlockFromFile(const CPLString &soFileName, int x, int y,
-                             int to_buffer_band, void *buffer, int advise_read);
+    CPLErr ReadBlockFromFile(const CPLString &soFileName, const char *pszKey,
+                             int x, int y, int to_buffer_band, void *buffer,
+                             int advise_read);
+    CPLErr ReadBlockFromTile(GDALDataset *poTileDS, const char *pszKey, int x,
+                             int y, int to_buffer_band, void *buffer,
+                             int advise_read);
+    bool ReadBlockFromDecodedTileCache(const char *pszKey, int x, int y,
+                                       int to_buffer_band, void *buffer);
     CPLErr ReadBlockFromDataset(GDALDataset *ds, int x, int y,
                                 int to_buffer_band, void *buffer,
                                 int advise_read);
@@ -30,12 +30,16 @@
 #define ZARR_H
 
 #include "cpl_compressor.h"
+#include "cpl_error_internal.h"
 #include "cpl_json.h"
+#include "cpl_mem_cache.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_priv.h"
 #include "gdal_pam.h"
 #include "memmultidim.h"
 
 #include <array>
+#include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -350,6 +354,7 @@ class ZarrSharedResource
 /************************************************************************/
 
 class ZarrArray;
+class ZarrV3CodecSequence;
 class ZarrDimension;
 
 class ZarrGroupBase CPL_NON_FINAL : public GDALGroup
@@ -805,6 +810,32 @@ class ZarrArray CPL_NON_FINAL : public GDALPamMDArray
 
     mutable std::map<uint64_t, CachedTile> m_oMapTileIndexToCachedTile{};
 
+    //! Whether IRead() is being called by ReadInParallel()
+    mutable bool m_bInParallelRead = false;
+
+    //! Tile to be encoded and written by WriteTile()
+    struct TileWriteJob
+    {
+        const ZarrArray *poArray = nullptr;
+        std::string osFilename{};
+        ZarrByteVectorQuickResize abyRawTileData{};
+        ZarrByteVectorQuickResize abyTmpRawTileData{};
+        //! Codecs owned by the job (Zarr V3 only)
+        std::unique_ptr<ZarrV3CodecSequence> poCodecs{};
+    };
+
+    //! Number of threads used to encode and write tiles (NUM_THREADS
+    //! creation option). Asynchronous writing is enabled when > 1.
+    int m_nWriteThreads = 1;
+    mutable std::unique_ptr<CPLJobQueue> m_poTileWriteQueue{};
+    //! Protects m_oSetPendingTileWrites, m_aoTileWriteErrors and
+    //! m_bTileWriteError
+    mutable std::mutex m_oTileWriteMutex{};
+    mutable std::set<std::string> m_oSetPendingTileWrites{};
+    mutable std::vector<CPLErrorHandlerAccumulatorStruct>
+        m_aoTileWriteErrors{};
+    mutable bool m_bTileWriteError = false;
+
     static uint64_t
     ComputeTileCount(const std::string &osName,
                      const std::vector<std::shared_ptr<GDALDimension>> &aoDims,
@@ -820,6 +851,22 @@ class ZarrArray CPL_NON_FINAL : public GDALPamMDArray
     virtual bool LoadTileData(const uint64_t *tileIndices,
                               bool &bMissingTileOut) const = 0;
 
+    //! Encodes and writes the tile of oJob. Called from a worker thread when
+    //! asynchronous writing is enabled.
+    virtual bool WriteTile(TileWriteJob &oJob) const = 0;
+
+    bool SubmitTileWrite(std::unique_ptr<TileWriteJob> &&poJob) const;
+
+    static void TileWriteJobFunc(void *pData);
+
+    bool ReportTileWriteErrors() const;
+
+    bool WaitPendingTileWrite(const std::string &osFilename) const;
+
+    bool WaitPendingTileWrite(const std::vector<uint64_t> &tileIndices) const;
+
+    bool WaitPendingTileWrites() const;
+
     void BlockTranspose(const ZarrByteVectorQuickResize &abySrc,
                         ZarrByteVectorQuickResize &abyDst, bool bDecode) const;
 
@@ -861,12 +908,22 @@ class ZarrArray CPL_NON_FINAL : public GDALPamMDArray
 
     bool IsEmptyTile(const ZarrByteVectorQuickResize &abyTile) const;
 
+    bool CanReadInParallel(const GUInt64 *arrayStartIdx, const size_t *count,
+                           const GInt64 *arrayStep) const;
+
+    bool ReadInParallel(const GUInt64 *arrayStartIdx, const size_t *count,
+                        const GInt64 *arrayStep,
+                        const GPtrDiff_t *bufferStride,
+                        const GDALExtendedDataType &bufferDataType,
+                        void *pDstBuffer, int nThreads) const;
+
     bool IAdviseReadCommon(const GUInt64 *arrayStartIdx, const size_t *count,
                            CSLConstList papszOptions,
                            std::vector<uint64_t> &anIndicesCur,
                            int &nThreadsMax,
                            std::vector<uint64_t> &anReqTilesIndices,
-                           size_t &nReqTiles) const;
+                           size_t &nReqTiles,
+                           bool bListTilesIfSingleThreaded = false) const;
 
     CPLJSONObject SerializeSpecialAttributes();
 
@@ -979,6 +1036,8 @@ class ZarrArray CPL_NON_FINAL : public GDALPamMDArray
         m_osDimSeparator = osDimSeparator;
     }
 
+    void SetWriteThreads(const char *pszNumThreads);
+
     void ParseSpecialAttributes(const std::shared_ptr<GDALGroup> &poGroup,
                                 CPLJSONObject &oAttributes);
 
@@ -1140,6 +1199,8 @@ class ZarrV2Array final : public ZarrArray
 
     bool FlushDirtyTile() const override;
 
+    bool WriteTile(TileWriteJob &oJob) const override;
+
     std::string BuildTileFilename(const uint64_t *tileIndices) const override;
 
     bool AllocateWorkingBuffers() const override;
@@ -1420,6 +1481,188 @@ class ZarrV3CodecTranspose final : public ZarrV3Codec
                 ZarrByteVectorQuickResize &abyDst) const override;
 };
 
+/************************************************************************/
+/*                           ZarrV3CodecZstd                            */
+/************************************************************************/
+
+// Implements the "zstd" codec, with "level" and "checksum" configuration
+// members, as written by zarr-python 3
+class ZarrV3CodecZstd final : public ZarrV3Codec
+{
+    CPLStringList m_aosCompressorOptions{};
+    const CPLCompressor *m_pDecompressor = nullptr;
+    const CPLCompressor *m_pCompressor = nullptr;
+
+    ZarrV3CodecZstd(const ZarrV3CodecZstd &) = delete;
+    ZarrV3CodecZstd &operator=(const ZarrV3CodecZstd &) = delete;
+
+  public:
+    static constexpr const char *NAME = "zstd";
+
+    ZarrV3CodecZstd();
+    ~ZarrV3CodecZstd() override;
+
+    IOType GetInputType() const override
+    {
+        return IOType::BYTES;
+    }
+
+    IOType GetOutputType() const override
+    {
+        return IOType::BYTES;
+    }
+
+    static CPLJSONObject GetConfiguration(int nLevel, bool bChecksum);
+
+    bool
+    InitFromConfiguration(const CPLJSONObject &configuration,
+                          const ZarrArrayMetadata &oInputArrayMetadata,
+                          ZarrArrayMetadata &oOutputArrayMetadata) override;
+
+    std::unique_ptr<ZarrV3Codec> Clone() const override;
+
+    bool Encode(const ZarrByteVectorQuickResize &abySrc,
+                ZarrByteVectorQuickResize &abyDst) const override;
+    bool Decode(const ZarrByteVectorQuickResize &abySrc,
+                ZarrByteVectorQuickResize &abyDst) const override;
+};
+
+/************************************************************************/
+/*                          ZarrV3CodecCRC32C                           */
+/************************************************************************/
+
+// Implements https://zarr-specs.readthedocs.io/en/latest/v3/codecs/crc32c/v1.0.html
+class ZarrV3CodecCRC32C final : public ZarrV3Codec
+{
+  public:
+    static constexpr const char *NAME = "crc32c";
+
+    ZarrV3CodecCRC32C();
+    ~ZarrV3CodecCRC32C() override;
+
+    IOType GetInputType() const override
+    {
+        return IOType::BYTES;
+    }
+
+    IOType GetOutputType() const override
+    {
+        return IOType::BYTES;
+    }
+
+    bool
+    InitFromConfiguration(const CPLJSONObject &configuration,
+                          const ZarrArrayMetadata &oInputArrayMetadata,
+                          ZarrArrayMetadata &oOutputArrayMetadata) override;
+
+    std::unique_ptr<ZarrV3Codec> Clone() const override;
+
+    bool Encode(const ZarrByteVectorQuickResize &abySrc,
+                ZarrByteVectorQuickResize &abyDst) const override;
+    bool Decode(const ZarrByteVectorQuickResize &abySrc,
+                ZarrByteVectorQuickResize &abyDst) const override;
+
+    static uint32_t ComputeCRC32C(const GByte *pabyData, size_t nSize);
+};
+
+/************************************************************************/
+/*                     ZarrV3CodecShardingIndexed                       */
+/************************************************************************/
+
+class ZarrV3CodecSequence;
+
+// Implements https://zarr-specs.readthedocs.io/en/latest/v3/codecs/sharding-indexed/v1.0.html
+// Only partial decoding, that is reading individual inner chunks, is
+// supported (through ZarrV3Array), not whole shard encoding/decoding.
+class ZarrV3CodecShardingIndexed final : public ZarrV3Codec
+{
+    ZarrArrayMetadata m_oInnerArrayMetadata{};
+    std::vector<size_t> m_anChunksPerShard{};
+    size_t m_nInnerChunkCount = 0;
+    std::unique_ptr<ZarrV3CodecSequence> m_poCodecs{};
+    std::unique_ptr<ZarrV3CodecSequence> m_poIndexCodecs{};
+    bool m_bIndexAtEnd = true;
+    size_t m_nEncodedIndexSize = 0;
+
+    ZarrV3CodecShardingIndexed(const ZarrV3CodecShardingIndexed &) = delete;
+    ZarrV3CodecShardingIndexed &
+    operator=(const ZarrV3CodecShardingIndexed &) = delete;
+
+  public:
+    static constexpr const char *NAME = "sharding_indexed";
+
+    //! Value of the offset and size of missing inner chunks in the index
+    static constexpr uint64_t EMPTY_CHUNK =
+        std::numeric_limits<uint64_t>::max();
+
+    ZarrV3CodecShardingIndexed();
+    ~ZarrV3CodecShardingIndexed() override;
+
+    IOType GetInputType() const override
+    {
+        return IOType::ARRAY;
+    }
+
+    IOType GetOutputType() const override
+    {
+        return IOType::BYTES;
+    }
+
+    bool
+    InitFromConfiguration(const CPLJSONObject &configuration,
+                          const ZarrArrayMetadata &oInputArrayMetadata,
+                          ZarrArrayMetadata &oOutputArrayMetadata) override;
+
+    std::unique_ptr<ZarrV3Codec> Clone() const override;
+
+    bool Encode(const ZarrByteVectorQuickResize &abySrc,
+                ZarrByteVectorQuickResize &abyDst) const override;
+    bool Decode(const ZarrByteVectorQuickResize &abySrc,
+                ZarrByteVectorQuickResize &abyDst) const override;
+
+    const std::vector<size_t> &GetShardShape() const
+    {
+        return m_oInputArrayMetadata.anBlockSizes;
+    }
+
+    const std::vector<size_t> &GetInnerChunkShape() const
+    {
+        return m_oInnerArrayMetadata.anBlockSizes;
+    }
+
+    const std::vector<size_t> &GetChunksPerShard() const
+    {
+        return m_anChunksPerShard;
+    }
+
+    size_t GetInnerChunkCount() const
+    {
+        return m_nInnerChunkCount;
+    }
+
+    //! Codec sequence to decode inner chunks
+    ZarrV3CodecSequence *GetInnerCodecs() const
+    {
+        return m_poCodecs.get();
+    }
+
+    bool IsIndexAtEnd() const
+    {
+        return m_bIndexAtEnd;
+    }
+
+    //! Size in bytes of the shard index, as stored in the shard
+    size_t GetEncodedIndexSize() const
+    {
+        return m_nEncodedIndexSize;
+    }
+
+    // Decode the shard index into (offset, nbytes) pairs, one for each
+    // inner chunk, in C order.
+    bool DecodeIndex(const GByte *pabyData, size_t nSize,
+                     std::vector<uint64_t> &anIndex) const;
+};
+
 /************************************************************************/
 /*                          ZarrV3CodecSequence                         */
 /************************************************************************/
@@ -1451,6 +1694,9 @@ class ZarrV3CodecSequence
 
     bool Encode(ZarrByteVectorQuickResize &abyBuffer);
     bool Decode(ZarrByteVectorQuickResize &abyBuffer);
+
+    //! Return the sharding codec, when it is the only codec of the sequence.
+    ZarrV3CodecShardingIndexed *GetShardingCodec() const;
 };
 
 /************************************************************************/
@@ -1462,6 +1708,24 @@ class ZarrV3Array final : public ZarrArray
     bool m_bV2ChunkKeyEncoding = false;
     std::unique_ptr<ZarrV3CodecSequence> m_poCodecs{};
 
+    //! Number of inner chunks per shard along each dimension, when the
+    //! sharding_indexed codec is used. In that case, tiles (m_anBlockSize)
+    //! are the inner chunks.
+    std::vector<uint64_t> m_anChunksPerShard{};
+
+    //! Decoded index of a shard
+    struct ShardIndex
+    {
+        bool bMissing = false;
+        vsi_l_offset nFileSize = 0;
+        //! (offset, nbytes) pairs for each inner chunk
+        std::vector<uint64_t> anIndex{};
+    };
+
+    //! Cache of shard indices, from shard filename
+    mutable lru11::Cache<std::string, std::shared_ptr<ShardIndex>>
+        m_oShardIndexCache{128};
+
     ZarrV3Array(const std::shared_ptr<ZarrSharedResource> &poSharedResource,
                 const std::string &osParentName, const std::string &osName,
                 const std::vector<std::shared_ptr<GDALDimension>> &aoDims,
@@ -1483,6 +1747,39 @@ class ZarrV3Array final : public ZarrArray
                       ZarrByteVectorQuickResize &abyDecodedTileData,
                       bool &bMissingTileOut) const;
 
+    VSILFILE *OpenTileFile(const std::string &osFilename) const;
+
+    void
+    ConvertRawTileData(const ZarrByteVectorQuickResize &abyRawTileData,
+                       ZarrByteVectorQuickResize &abyDecodedTileData) const;
+
+    size_t GetInnerChunkIndex(const uint64_t *tileIndices) const;
+
+    std::shared_ptr<ShardIndex>
+    GetShardIndex(const std::string &osFilename, bool bUseMutex,
+                  const ZarrV3CodecShardingIndexed *poSharding,
+                  VSILFILE *&fpOut) const;
+
+    bool GetInnerChunkLocation(const ShardIndex &oShardIndex,
+                               size_t nInnerChunkIdx,
+                               const std::string &osFilename,
+                               uint64_t &nOffset, uint64_t &nSize,
+                               bool &bMissing) const;
+
+    bool DecodeInnerChunk(const std::string &osFilename,
+                          ZarrV3CodecShardingIndexed *poSharding,
+                          ZarrByteVectorQuickResize &abyRawTileData,
+                          ZarrByteVectorQuickResize &abyDecodedTileData) const;
+
+    bool LoadShardedTileData(const uint64_t *tileIndices, bool bUseMutex,
+                             ZarrV3CodecShardingIndexed *poSharding,
+                             ZarrByteVectorQuickResize &abyRawTileData,
+                             ZarrByteVectorQuickResize &abyDecodedTileData,
+                             bool &bMissingTileOut) const;
+
+    bool IAdviseReadSharded(const std::vector<uint64_t> &anReqTilesIndices,
+                            size_t nReqTiles, int nThreadsMax) const;
+
   public:
     ~ZarrV3Array() override;
 
@@ -1499,9 +1796,12 @@ class ZarrV3Array final : public ZarrArray
         m_bV2ChunkKeyEncoding = b;
     }
 
-    void SetCodecs(std::unique_ptr<ZarrV3CodecSequence> &&poCodecs)
+    void SetCodecs(std::unique_ptr<ZarrV3CodecSequence> &&poCodecs);
+
+    //! Whether the sharding_indexed codec is used
+    bool IsSharded() const
     {
-        m_poCodecs = std::move(poCodecs);
+        return !m_anChunksPerShard.empty();
     }
 
     void Flush() override;
@@ -1516,6 +1816,8 @@ class ZarrV3Array final : public ZarrArray
 
     bool FlushDirtyTile() const override;
 
+    bool WriteTile(TileWriteJob &oJob) const override;
+
     std::string BuildTileFilename(const uint64_t *tileIndices) const override;
 
     bool LoadTileData(const uint64_t *tileIndices,
@@ -30,6 +30,7 @@
 #include "ucs4_utf8.hpp"
 
 #include "cpl_float.h"
+#include "gdal_thread_pool.h"
 
 #include "netcdf_cf_constants.h"  // for CF_UNITS, etc
 
@@ -885,11 +886,16 @@ bool ZarrArray::IAdviseReadCommon(const GUInt64 *arrayStartIdx,
                                   std::vector<uint64_t> &anIndicesCur,
                                   int &nThreadsMax,
                                   std::vector<uint64_t> &anReqTilesIndices,
-                                  size_t &nReqTiles) const
+                                  size_t &nReqTiles,
+                                  bool bListTilesIfSingleThreaded) const
 {
     if (!CheckValidAndErrorOutIfNot())
         return false;
 
+    // Tiles must be read after their pending writes
+    if (!WaitPendingTileWrites())
+        return false;
+
     const size_t nDims = m_aoDims.size();
     anIndicesCur.resize(nDims);
     std::vector<uint64_t> anIndicesMin(nDims);
@@ -961,7 +967,7 @@ bool ZarrArray::IAdviseReadCommon(const GUInt64 *arrayStartIdx,
         nThreadsMax = std::max(1, atoi(pszNumThreads));
     if (nThreadsMax > 1024)
         nThreadsMax = 1024;
-    if (nThreadsMax <= 1)
+    if (nThreadsMax <= 1 && !bListTilesIfSingleThreaded)
         return true;
     CPLDebug(ZARR_DEBUG_KEY, "IAdviseRead(): Using up to %d threads",
              nThreadsMax);
@@ -1026,6 +1032,163 @@ lbl_next_depth:
     return true;
 }
 
+/************************************************************************/
+/*                      ZarrGetNumThreadsForRead()                      */
+/************************************************************************/
+
+static int ZarrGetNumThreadsForRead()
+{
+    const char *pszValue = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (pszValue == nullptr)
+        return 1;
+    int nThreads =
+        EQUAL(pszValue, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszValue);
+    if (nThreads > 1024)
+        nThreads = 1024;  // to please Coverity
+    return nThreads;
+}
+
+/************************************************************************/
+/*                    ZarrArray::CanReadInParallel()                    */
+/************************************************************************/
+
+// Returns whether the request, with positive steps, intersects several tiles
+// that are all needed by it.
+bool ZarrArray::CanReadInParallel(const GUInt64 *arrayStartIdx,
+                                  const size_t *count,
+                                  const GInt64 *arrayStep) const
+{
+    if (m_bInParallelRead || !m_oMapTileIndexToCachedTile.empty())
+    {
+        // Already in a parallel read, or using the cache of an explicit
+        // AdviseRead() call
+        return false;
+    }
+
+    size_t nReqTiles = 1;
+    for (size_t i = 0; i < m_aoDims.size(); ++i)
+    {
+        // Do not decode tiles that would be skipped by subsampling
+        if (count[i] > 1 &&
+            static_cast<uint64_t>(arrayStep[i]) > m_anBlockSize[i])
+        {
+            return false;
+        }
+        const uint64_t nLastIdx =
+            arrayStartIdx[i] +
+            static_cast<uint64_t>(count[i] - 1) * arrayStep[i];
+        nReqTiles *= static_cast<size_t>(nLastIdx / m_anBlockSize[i] -
+                                         arrayStartIdx[i] / m_anBlockSize[i] +
+                                         1);
+    }
+    return nReqTiles > 1;
+}
+
+/************************************************************************/
+/*                      ZarrArray::ReadInParallel()                     */
+/************************************************************************/
+
+// Decodes the tiles intersecting the request with several threads, through
+// IAdviseRead(), and then copies them to the output buffer with IRead().
+// To bound memory usage, this is done by slabs of tiles along the first
+// dimension, whose size fits in half of the remaining block cache.
+bool ZarrArray::ReadInParallel(const GUInt64 *arrayStartIdx,
+                               const size_t *count, const GInt64 *arrayStep,
+                               const GPtrDiff_t *bufferStride,
+                               const GDALExtendedDataType &bufferDataType,
+                               void *pDstBuffer, int nThreads) const
+{
+    const size_t nDims = m_aoDims.size();
+
+    // Number of tiles in a slice of one tile along the first dimension
+    size_t nTilesPerSlice = 1;
+    for (size_t i = 1; i < nDims; ++i)
+    {
+        const uint64_t nLastIdx =
+            arrayStartIdx[i] +
+            static_cast<uint64_t>(count[i] - 1) * arrayStep[i];
+        nTilesPerSlice *=
+            static_cast<size_t>(nLastIdx / m_anBlockSize[i] -
+                                arrayStartIdx[i] / m_anBlockSize[i] + 1);
+    }
+
+    const uint64_t nCacheSize = std::min(
+        static_cast<uint64_t>((GDALGetCacheMax64() - GDALGetCacheUsed64()) /
+                              2),
+        static_cast<uint64_t>(std::numeric_limits<size_t>::max() / 2));
+    const uint64_t nSliceSize =
+        static_cast<uint64_t>(nTilesPerSlice) * std::max(m_nTileSize, nDims);
+    const uint64_t nSlicesPerSlab = nCacheSize / nSliceSize;
+    if (nSlicesPerSlab == 0)
+    {
+        CPLDebug(ZARR_DEBUG_KEY,
+                 "Not enough cache to decode tiles in parallel");
+        m_bInParallelRead = true;
+        const bool bRet = IRead(arrayStartIdx, count, arrayStep, bufferStride,
+                                bufferDataType, pDstBuffer);
+        m_bInParallelRead = false;
+        return bRet;
+    }
+
+    CPLStringList aosOptions;
+    aosOptions.SetNameValue("NUM_THREADS", CPLSPrintf("%d", nThreads));
+    aosOptions.SetNameValue(
+        "CACHE_SIZE",
+        CPLSPrintf(CPL_FRMT_GUIB, static_cast<GUIntBig>(nCacheSize)));
+
+    const auto nBufferDTSize =
+        static_cast<GPtrDiff_t>(bufferDataType.GetSize());
+    const uint64_t nStep0 = static_cast<uint64_t>(arrayStep[0]);
+    const uint64_t nLastIdx0 =
+        arrayStartIdx[0] + static_cast<uint64_t>(count[0] - 1) * nStep0;
+    std::vector<GUInt64> anSlabStartIdx(arrayStartIdx, arrayStartIdx + nDims);
+    std::vector<size_t> anSlabCount(count, count + nDims);
+    std::vector<size_t> anSlabSpan(nDims);
+    for (size_t i = 1; i < nDims; ++i)
+    {
+        anSlabSpan[i] = static_cast<size_t>(
+            static_cast<uint64_t>(count[i] - 1) * arrayStep[i] + 1);
+    }
+
+    bool bRet = true;
+    size_t iCur = 0;
+    while (bRet && iCur < count[0])
+    {
+        // Find the range [iCur, iEnd[ of indices along the first dimension
+        // that fall into the current slab of tiles
+        anSlabStartIdx[0] = arrayStartIdx[0] + iCur * nStep0;
+        const uint64_t nSlabEndIdx =
+            (anSlabStartIdx[0] / m_anBlockSize[0] + nSlicesPerSlab) *
+            m_anBlockSize[0];
+        size_t iEnd = count[0];
+        if (nSlabEndIdx <= nLastIdx0)
+        {
+            // nStep0 cannot be 0 here, since count[0] > 1
+            iEnd = static_cast<size_t>(
+                (nSlabEndIdx - arrayStartIdx[0] + nStep0 - 1) / nStep0);
+        }
+        anSlabCount[0] = iEnd - iCur;
+        anSlabSpan[0] = static_cast<size_t>(
+            static_cast<uint64_t>(anSlabCount[0] - 1) * nStep0 + 1);
+
+        bRet = IAdviseRead(anSlabStartIdx.data(), anSlabSpan.data(),
+                           aosOptions.List());
+        if (bRet)
+        {
+            m_bInParallelRead = true;
+            bRet = IRead(anSlabStartIdx.data(), anSlabCount.data(), arrayStep,
+                         bufferStride, bufferDataType,
+                         static_cast<GByte *>(pDstBuffer) +
+                             static_cast<GPtrDiff_t>(iCur) * bufferStride[0] *
+                                 nBufferDTSize);
+            m_bInParallelRead = false;
+        }
+        m_oMapTileIndexToCachedTile.clear();
+        iCur = iEnd;
+    }
+    return bRet;
+}
+
 /************************************************************************/
 /*                           ZarrArray::IRead()                         */
 /************************************************************************/
@@ -1098,6 +1261,20 @@ bool ZarrArray::IRead(const GUInt64 *arrayStartIdx, const size_t *count,
         bufferStride = bufferStrideMod.data();
     }
 
+    if (!m_aoDims.empty())
+    {
+        const int nThreads = ZarrGetNumThreadsForRead();
+        if (nThreads > 1 && CanReadInParallel(arrayStartIdx, count, arrayStep))
+        {
+            // Make sure that IAdviseRead() sees the content of the dirty tile
+            if (!FlushDirtyTile())
+                return false;
+            return ReadInParallel(arrayStartIdx, count, arrayStep,
+                                  bufferStride, bufferDataType, pDstBuffer,
+                                  nThreads);
+        }
+    }
+
     std::vector<uint64_t> indicesOuterLoop(nDims + 1);
     std::vector<GByte *> dstPtrStackOuterLoop(nDims + 1);
 
@@ -1188,7 +1365,7 @@ lbl_next_depth:
             }
             else
             {
-                if (!FlushDirtyTile())
+                if (!FlushDirtyTile() || !WaitPendingTileWrite(tileIndices))
                     return false;
 
                 m_anCachedTiledIndices = tileIndices;
@@ -1706,6 +1883,8 @@ lbl_next_depth:
             {
                 // If we don't write the whole tile, we need to fetch a
                 // potentially existing one.
+                if (!WaitPendingTileWrite(tileIndices))
+                    return false;
                 bool bEmptyTile = false;
                 m_bCachedTiledValid =
                     LoadTileData(tileIndices.data(), bEmptyTile);
@@ -2003,6 +2182,145 @@ lbl_next_depth:
     return true;
 }
 
+/************************************************************************/
+/*                    ZarrArray::SetWriteThreads()                      */
+/************************************************************************/
+
+void ZarrArray::SetWriteThreads(const char *pszNumThreads)
+{
+    if (pszNumThreads == nullptr)
+        return;
+    int nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                    : atoi(pszNumThreads);
+    if (nThreads > 1024)
+        nThreads = 1024;  // to please Coverity
+    m_nWriteThreads = std::max(1, nThreads);
+}
+
+/************************************************************************/
+/*                    ZarrArray::SubmitTileWrite()                      */
+/************************************************************************/
+
+// Encodes and writes a tile, asynchronously if m_nWriteThreads > 1.
+// Errors from asynchronous jobs are reported by a later call to this method
+// or WaitPendingTileWrites().
+bool ZarrArray::SubmitTileWrite(std::unique_ptr<TileWriteJob> &&poJob) const
+{
+    poJob->poArray = this;
+
+    // Never have two jobs writing the same tile at the same time
+    if (!WaitPendingTileWrite(poJob->osFilename))
+        return false;
+
+    if (!m_poTileWriteQueue && m_nWriteThreads > 1)
+    {
+        auto poPool = GDALGetGlobalThreadPool(m_nWriteThreads);
+        if (poPool)
+            m_poTileWriteQueue = poPool->CreateJobQueue();
+    }
+    if (!m_poTileWriteQueue)
+        return WriteTile(*poJob);
+
+    // Bound the number of tiles waiting to be written, and thus the
+    // memory used by their copies
+    m_poTileWriteQueue->WaitCompletion(2 * m_nWriteThreads);
+    if (!ReportTileWriteErrors())
+        return false;
+
+    {
+        std::lock_guard<std::mutex> oLock(m_oTileWriteMutex);
+        m_oSetPendingTileWrites.insert(poJob->osFilename);
+    }
+    TileWriteJob *psJob = poJob.release();
+    if (!m_poTileWriteQueue->SubmitJob(TileWriteJobFunc, psJob))
+        TileWriteJobFunc(psJob);
+    return true;
+}
+
+/************************************************************************/
+/*                   ZarrArray::TileWriteJobFunc()                      */
+/************************************************************************/
+
+void ZarrArray::TileWriteJobFunc(void *pData)
+{
+    std::unique_ptr<TileWriteJob> poJob(static_cast<TileWriteJob *>(pData));
+    const ZarrArray *poArray = poJob->poArray;
+
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors;
+    CPLInstallErrorHandlerAccumulator(aoErrors);
+    const bool bOK = poArray->WriteTile(*poJob);
+    CPLUninstallErrorHandlerAccumulator();
+
+    std::lock_guard<std::mutex> oLock(poArray->m_oTileWriteMutex);
+    poArray->m_oSetPendingTileWrites.erase(poJob->osFilename);
+    if (!bOK)
+        poArray->m_bTileWriteError = true;
+    for (auto &oError : aoErrors)
+        poArray->m_aoTileWriteErrors.push_back(std::move(oError));
+}
+
+/************************************************************************/
+/*                 ZarrArray::ReportTileWriteErrors()                   */
+/************************************************************************/
+
+// Re-emits, in the calling thread, the errors of asynchronous tile writing
+// jobs, and returns false if one of them failed.
+bool ZarrArray::ReportTileWriteErrors() const
+{
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors;
+    bool bError;
+    {
+        std::lock_guard<std::mutex> oLock(m_oTileWriteMutex);
+        std::swap(aoErrors, m_aoTileWriteErrors);
+        bError = m_bTileWriteError;
+        m_bTileWriteError = false;
+    }
+    for (const auto &oError : aoErrors)
+    {
+        CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+    }
+    return !bError;
+}
+
+/************************************************************************/
+/*                  ZarrArray::WaitPendingTileWrite()                   */
+/************************************************************************/
+
+// Waits for asynchronous writing jobs to complete if one of them concerns
+// osFilename.
+bool ZarrArray::WaitPendingTileWrite(const std::string &osFilename) const
+{
+    if (!m_poTileWriteQueue)
+        return true;
+    bool bPending;
+    {
+        std::lock_guard<std::mutex> oLock(m_oTileWriteMutex);
+        bPending = m_oSetPendingTileWrites.find(osFilename) !=
+                   m_oSetPendingTileWrites.end();
+    }
+    return bPending ? WaitPendingTileWrites() : true;
+}
+
+bool ZarrArray::WaitPendingTileWrite(
+    const std::vector<uint64_t> &tileIndices) const
+{
+    if (!m_poTileWriteQueue)
+        return true;
+    return WaitPendingTileWrite(BuildTileFilename(tileIndices.data()));
+}
+
+/************************************************************************/
+/*                  ZarrArray::WaitPendingTileWrites()                  */
+/************************************************************************/
+
+bool ZarrArray::WaitPendingTileWrites() const
+{
+    if (!m_poTileWriteQueue)
+        return true;
+    m_poTileWriteQueue->WaitCompletion();
+    return ReportTileWriteErrors();
+}
+
 /************************************************************************/
 /*                   ZarrArray::IsEmptyTile()                           */
 /************************************************************************/
@@ -2688,6 +3006,10 @@ bool ZarrArray::Rename(const std::string &osNewName)
         return false;
     }
 
+    // Pending tile writes use the current directory
+    if (!WaitPendingTileWrites())
+        return false;
+
     auto poParent = m_poGroupWeak.lock();
     if (poParent)
     {
@@ -98,6 +98,7 @@ void ZarrV2Array::Flush()
         return;
 
     ZarrV2Array::FlushDirtyTile();
+    WaitPendingTileWrites();
 
     if (m_bDefinitionModified)
     {
@@ -827,6 +828,9 @@ bool ZarrV2Array::FlushDirtyTile() const
     {
         m_bCachedTiledEmpty = true;
 
+        if (!WaitPendingTileWrite(osFilename))
+            return false;
+
         VSIStatBufL sStat;
         if (VSIStatL(osFilename.c_str(), &sStat) == 0)
         {
@@ -851,13 +855,57 @@ bool ZarrV2Array::FlushDirtyTile() const
         }
     }
 
+    auto poJob = std::make_unique<TileWriteJob>();
+    poJob->osFilename = std::move(osFilename);
+    if (m_nWriteThreads <= 1)
+    {
+        // Synchronous writing: directly use the working buffers
+        std::swap(poJob->abyRawTileData, m_abyRawTileData);
+        std::swap(poJob->abyTmpRawTileData, m_abyTmpRawTileData);
+        poJob->poArray = this;
+        const bool bRet = WriteTile(*poJob);
+        std::swap(poJob->abyRawTileData, m_abyRawTileData);
+        std::swap(poJob->abyTmpRawTileData, m_abyTmpRawTileData);
+        return bRet;
+    }
+
+    try
+    {
+        poJob->abyRawTileData.resize(m_abyRawTileData.size());
+        poJob->abyTmpRawTileData.resize(m_abyTmpRawTileData.size());
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for tile %s",
+                 poJob->osFilename.c_str());
+        return false;
+    }
+    memcpy(poJob->abyRawTileData.data(), m_abyRawTileData.data(),
+           m_abyRawTileData.size());
+    return SubmitTileWrite(std::move(poJob));
+}
+
+/************************************************************************/
+/*                       ZarrV2Array::WriteTile()                       */
+/************************************************************************/
+
+bool ZarrV2Array::WriteTile(TileWriteJob &oJob) const
+{
+    // This method should NOT modify any ZarrArray member, as it is going to
+    // be called concurrently from several threads.
+
+    const std::string &osFilename = oJob.osFilename;
+    auto &abyRawTileData = oJob.abyRawTileData;
+    auto &abyTmpRawTileData = oJob.abyTmpRawTileData;
+
     if (m_bFortranOrder && !m_aoDims.empty())
     {
-        BlockTranspose(m_abyRawTileData, m_abyTmpRawTileData, false);
-        std::swap(m_abyRawTileData, m_abyTmpRawTileData);
+        BlockTranspose(abyRawTileData, abyTmpRawTileData, false);
+        std::swap(abyRawTileData, abyTmpRawTileData);
     }
 
-    size_t nRawDataSize = m_abyRawTileData.size();
+    size_t nRawDataSize = abyRawTileData.size();
     for (const auto &oFilter : m_oFiltersArray)
     {
         const auto osFilterId = oFilter["id"].ToString();
@@ -870,10 +918,10 @@ bool ZarrV2Array::FlushDirtyTile() const
             aosOptions.SetNameValue(obj.GetName().c_str(),
                                     obj.ToString().c_str());
         }
-        void *out_buffer = &m_abyTmpRawTileData[0];
-        size_t nOutSize = m_abyTmpRawTileData.size();
+        void *out_buffer = &abyTmpRawTileData[0];
+        size_t nOutSize = abyTmpRawTileData.size();
         if (!psFilterCompressor->pfnFunc(
-                m_abyRawTileData.data(), nRawDataSize, &out_buffer, &nOutSize,
+                abyRawTileData.data(), nRawDataSize, &out_buffer, &nOutSize,
                 aosOptions.List(), psFilterCompressor->user_data))
         {
             CPLError(CE_Failure, CPLE_AppDefined,
@@ -883,7 +931,7 @@ bool ZarrV2Array::FlushDirtyTile() const
         }
 
         nRawDataSize = nOutSize;
-        std::swap(m_abyRawTileData, m_abyTmpRawTileData);
+        std::swap(abyRawTileData, abyTmpRawTileData);
     }
 
     if (m_osDimSeparator == "/")
@@ -892,7 +940,9 @@ bool ZarrV2Array::FlushDirtyTile() const
         VSIStatBufL sStat;
         if (VSIStatL(osDir.c_str(), &sStat) != 0)
         {
-            if (VSIMkdirRecursive(osDir.c_str(), 0755) != 0)
+            // Another thread might have created it in the meantime
+            if (VSIMkdirRecursive(osDir.c_str(), 0755) != 0 &&
+                VSIStatL(osDir.c_str(), &sStat) != 0)
             {
                 CPLError(CE_Failure, CPLE_AppDefined,
                          "Cannot create directory %s", osDir.c_str());
@@ -912,7 +962,7 @@ bool ZarrV2Array::FlushDirtyTile() const
     bool bRet = true;
     if (m_psCompressor == nullptr)
     {
-        if (VSIFWriteL(m_abyRawTileData.data(), 1, nRawDataSize, fp) !=
+        if (VSIFWriteL(abyRawTileData.data(), 1, nRawDataSize, fp) !=
             nRawDataSize)
         {
             CPLError(CE_Failure, CPLE_AppDefined,
@@ -958,7 +1008,7 @@ bool ZarrV2Array::FlushDirtyTile() const
             }
 
             if (!m_psCompressor->pfnFunc(
-                    m_abyRawTileData.data(), nRawDataSize, &out_buffer,
+                    abyRawTileData.data(), nRawDataSize, &out_buffer,
                     &out_size, aosOptions.List(), m_psCompressor->user_data))
             {
                 CPLError(CE_Failure, CPLE_AppDefined,
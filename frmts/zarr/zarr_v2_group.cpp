@@ -1114,6 +1114,7 @@ std::shared_ptr<GDALMDArray> ZarrV2Group::CreateMDArray(
     poArray->SetFilename(osZarrayFilename);
     poArray->SetDimSeparator(pszDimSeparator);
     poArray->SetDtype(dtype);
+    poArray->SetWriteThreads(CSLFetchNameValue(papszOptions, "NUM_THREADS"));
     poArray->SetCompressorDecompressor(pszCompressor, psCompressor,
                                        psDecompressor);
     if (oCompressor.IsValid())
@@ -94,6 +94,7 @@ void ZarrV3Array::Flush()
         return;
 
     ZarrV3Array::FlushDirtyTile();
+    WaitPendingTileWrites();
 
     if (!m_aoDims.empty())
     {
@@ -159,9 +160,12 @@ void ZarrV3Array::Serialize(const CPLJSONObject &oAttrs)
         CPLJSONObject oConfiguration;
         oChunkGrid.Add("configuration", oConfiguration);
         CPLJSONArray oChunks;
-        for (const auto nBlockSize : m_anBlockSize)
+        for (size_t i = 0; i < m_anBlockSize.size(); ++i)
         {
-            oChunks.Add(static_cast<GInt64>(nBlockSize));
+            // With sharding, the chunks of the chunk grid are the shards
+            oChunks.Add(static_cast<GInt64>(
+                m_anBlockSize[i] *
+                (IsSharded() ? m_anChunksPerShard[i] : 1)));
         }
         oConfiguration.Add("chunk_shape", oChunks);
     }
@@ -253,6 +257,23 @@ void ZarrV3Array::Serialize(const CPLJSONObject &oAttrs)
     oDoc.Save(m_osFilename);
 }
 
+/************************************************************************/
+/*                       ZarrV3Array::SetCodecs()                       */
+/************************************************************************/
+
+void ZarrV3Array::SetCodecs(std::unique_ptr<ZarrV3CodecSequence> &&poCodecs)
+{
+    m_poCodecs = std::move(poCodecs);
+    m_anChunksPerShard.clear();
+    const auto poSharding =
+        m_poCodecs ? m_poCodecs->GetShardingCodec() : nullptr;
+    if (poSharding)
+    {
+        for (const size_t nCount : poSharding->GetChunksPerShard())
+            m_anChunksPerShard.push_back(nCount);
+    }
+}
+
 /************************************************************************/
 /*                  ZarrV3Array::NeedDecodedBuffer()                    */
 /************************************************************************/
@@ -394,6 +415,13 @@ bool ZarrV3Array::LoadTileData(const uint64_t *tileIndices, bool bUseMutex,
 
     bMissingTileOut = false;
 
+    if (IsSharded())
+    {
+        return LoadShardedTileData(tileIndices, bUseMutex,
+                                   poCodecs->GetShardingCodec(), abyRawTileData,
+                                   abyDecodedTileData, bMissingTileOut);
+    }
+
     std::string osFilename = BuildTileFilename(tileIndices);
 
     // For network file systems, get the streaming version of the filename,
@@ -433,25 +461,7 @@ bool ZarrV3Array::LoadTileData(const uint64_t *tileIndices, bool bUseMutex,
     if (bUseMutex)
         m_oMutex.unlock();
 
-    VSILFILE *fp = nullptr;
-    // This is the number of files returned in a S3 directory listing operation
-    constexpr uint64_t MAX_TILES_ALLOWED_FOR_DIRECTORY_LISTING = 1000;
-    const char *const apszOpenOptions[] = {"IGNORE_FILENAME_RESTRICTIONS=YES",
-                                           nullptr};
-    if ((m_osDimSeparator == "/" && !m_anBlockSize.empty() &&
-         m_anBlockSize.back() > MAX_TILES_ALLOWED_FOR_DIRECTORY_LISTING) ||
-        (m_osDimSeparator != "/" &&
-         m_nTotalTileCount > MAX_TILES_ALLOWED_FOR_DIRECTORY_LISTING))
-    {
-        // Avoid issuing ReadDir() when a lot of files are expected
-        CPLConfigOptionSetter optionSetter("GDAL_DISABLE_READDIR_ON_OPEN",
-                                           "YES", true);
-        fp = VSIFOpenEx2L(osFilename.c_str(), "rb", 0, apszOpenOptions);
-    }
-    else
-    {
-        fp = VSIFOpenEx2L(osFilename.c_str(), "rb", 0, apszOpenOptions);
-    }
+    VSILFILE *fp = OpenTileFile(osFilename);
     if (fp == nullptr)
     {
         // Missing files are OK and indicate nodata_value
@@ -534,6 +544,46 @@ bool ZarrV3Array::LoadTileData(const uint64_t *tileIndices, bool bUseMutex,
         return false;
     }
 
+    ConvertRawTileData(abyRawTileData, abyDecodedTileData);
+
+    return true;
+
+#undef m_abyRawTileData
+#undef m_abyDecodedTileData
+#undef m_poCodecs
+}
+
+/************************************************************************/
+/*                      ZarrV3Array::OpenTileFile()                     */
+/************************************************************************/
+
+VSILFILE *ZarrV3Array::OpenTileFile(const std::string &osFilename) const
+{
+    // This is the number of files returned in a S3 directory listing operation
+    constexpr uint64_t MAX_TILES_ALLOWED_FOR_DIRECTORY_LISTING = 1000;
+    const char *const apszOpenOptions[] = {"IGNORE_FILENAME_RESTRICTIONS=YES",
+                                           nullptr};
+    if ((m_osDimSeparator == "/" && !m_anBlockSize.empty() &&
+         m_anBlockSize.back() > MAX_TILES_ALLOWED_FOR_DIRECTORY_LISTING) ||
+        (m_osDimSeparator != "/" &&
+         m_nTotalTileCount > MAX_TILES_ALLOWED_FOR_DIRECTORY_LISTING))
+    {
+        // Avoid issuing ReadDir() when a lot of files are expected
+        CPLConfigOptionSetter optionSetter("GDAL_DISABLE_READDIR_ON_OPEN",
+                                           "YES", true);
+        return VSIFOpenEx2L(osFilename.c_str(), "rb", 0, apszOpenOptions);
+    }
+    return VSIFOpenEx2L(osFilename.c_str(), "rb", 0, apszOpenOptions);
+}
+
+/************************************************************************/
+/*                   ZarrV3Array::ConvertRawTileData()                  */
+/************************************************************************/
+
+void ZarrV3Array::ConvertRawTileData(
+    const ZarrByteVectorQuickResize &abyRawTileData,
+    ZarrByteVectorQuickResize &abyDecodedTileData) const
+{
     if (!abyDecodedTileData.empty())
     {
         const size_t nSourceSize =
@@ -549,12 +599,246 @@ bool ZarrV3Array::LoadTileData(const uint64_t *tileIndices, bool bUseMutex,
             DecodeSourceElt(m_aoDtypeElts, pSrc, pDst);
         }
     }
+}
 
+/************************************************************************/
+/*                  ZarrV3Array::GetInnerChunkIndex()                   */
+/************************************************************************/
+
+// Returns the index, in C order, of an inner chunk within its shard
+size_t ZarrV3Array::GetInnerChunkIndex(const uint64_t *tileIndices) const
+{
+    size_t nIdx = 0;
+    for (size_t i = 0; i < m_anChunksPerShard.size(); ++i)
+    {
+        nIdx = nIdx * static_cast<size_t>(m_anChunksPerShard[i]) +
+               static_cast<size_t>(tileIndices[i] % m_anChunksPerShard[i]);
+    }
+    return nIdx;
+}
+
+/************************************************************************/
+/*                     ZarrV3Array::GetShardIndex()                     */
+/************************************************************************/
+
+// Returns the (potentially cached) index of a shard, or nullptr in case of
+// error. If the index had to be read, fpOut is set to the opened shard file,
+// which must be closed by the caller.
+std::shared_ptr<ZarrV3Array::ShardIndex>
+ZarrV3Array::GetShardIndex(const std::string &osFilename, bool bUseMutex,
+                           const ZarrV3CodecShardingIndexed *poSharding,
+                           VSILFILE *&fpOut) const
+{
+    // This method should NOT modify any ZarrArray member, other than
+    // m_oShardIndexCache when holding m_oMutex, as it is going to
+    // be called concurrently from several threads.
+
+    fpOut = nullptr;
+    {
+        std::unique_lock<std::mutex> oLock(m_oMutex, std::defer_lock);
+        if (bUseMutex)
+            oLock.lock();
+        std::shared_ptr<ShardIndex> poShardIndex;
+        if (m_oShardIndexCache.tryGet(osFilename, poShardIndex))
+            return poShardIndex;
+    }
+
+    auto poShardIndex = std::make_shared<ShardIndex>();
+    VSILFILE *fp = OpenTileFile(osFilename);
+    if (fp == nullptr)
+    {
+        // Missing shards are OK and indicate nodata_value
+        CPLDebugOnly(ZARR_DEBUG_KEY, "Shard %s missing (=nodata)",
+                     osFilename.c_str());
+        poShardIndex->bMissing = true;
+    }
+    else
+    {
+        // Read the index with a single range request
+        const size_t nIndexSize = poSharding->GetEncodedIndexSize();
+        VSIFSeekL(fp, 0, SEEK_END);
+        const vsi_l_offset nFileSize = VSIFTellL(fp);
+        std::vector<GByte> abyIndex;
+        if (nFileSize < nIndexSize)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Shard %s is too small to contain its index",
+                     osFilename.c_str());
+            VSIFCloseL(fp);
+            return nullptr;
+        }
+        try
+        {
+            abyIndex.resize(nIndexSize);
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate memory for index of shard %s",
+                     osFilename.c_str());
+            VSIFCloseL(fp);
+            return nullptr;
+        }
+        if (VSIFSeekL(fp,
+                      poSharding->IsIndexAtEnd() ? nFileSize - nIndexSize : 0,
+                      SEEK_SET) != 0 ||
+            VSIFReadL(abyIndex.data(), 1, nIndexSize, fp) != nIndexSize)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Could not read index of shard %s", osFilename.c_str());
+            VSIFCloseL(fp);
+            return nullptr;
+        }
+        if (!poSharding->DecodeIndex(abyIndex.data(), nIndexSize,
+                                     poShardIndex->anIndex))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Decoding of index of shard %s failed",
+                     osFilename.c_str());
+            VSIFCloseL(fp);
+            return nullptr;
+        }
+        poShardIndex->nFileSize = nFileSize;
+        fpOut = fp;
+    }
+
+    std::unique_lock<std::mutex> oLock(m_oMutex, std::defer_lock);
+    if (bUseMutex)
+        oLock.lock();
+    m_oShardIndexCache.insert(osFilename, poShardIndex);
+    return poShardIndex;
+}
+
+/************************************************************************/
+/*                 ZarrV3Array::GetInnerChunkLocation()                 */
+/************************************************************************/
+
+bool ZarrV3Array::GetInnerChunkLocation(const ShardIndex &oShardIndex,
+                                        size_t nInnerChunkIdx,
+                                        const std::string &osFilename,
+                                        uint64_t &nOffset, uint64_t &nSize,
+                                        bool &bMissing) const
+{
+    bMissing = true;
+    nOffset = 0;
+    nSize = 0;
+    if (oShardIndex.bMissing)
+        return true;
+    CPLAssert(2 * nInnerChunkIdx + 1 < oShardIndex.anIndex.size());
+    nOffset = oShardIndex.anIndex[2 * nInnerChunkIdx];
+    nSize = oShardIndex.anIndex[2 * nInnerChunkIdx + 1];
+    if (nOffset == ZarrV3CodecShardingIndexed::EMPTY_CHUNK &&
+        nSize == ZarrV3CodecShardingIndexed::EMPTY_CHUNK)
+    {
+        return true;
+    }
+    bMissing = false;
+    if (nOffset > oShardIndex.nFileSize ||
+        nSize > oShardIndex.nFileSize - nOffset)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Invalid location of inner chunk %u in shard %s",
+                 static_cast<unsigned>(nInnerChunkIdx), osFilename.c_str());
+        return false;
+    }
+    if (nSize > static_cast<uint64_t>(std::numeric_limits<int>::max()))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Too large inner chunk %u in shard %s",
+                 static_cast<unsigned>(nInnerChunkIdx), osFilename.c_str());
+        return false;
+    }
     return true;
+}
 
-#undef m_abyRawTileData
-#undef m_abyDecodedTileData
-#undef m_poCodecs
+/************************************************************************/
+/*                    ZarrV3Array::DecodeInnerChunk()                   */
+/************************************************************************/
+
+bool ZarrV3Array::DecodeInnerChunk(
+    const std::string &osFilename, ZarrV3CodecShardingIndexed *poSharding,
+    ZarrByteVectorQuickResize &abyRawTileData,
+    ZarrByteVectorQuickResize &abyDecodedTileData) const
+{
+    if (!poSharding->GetInnerCodecs()->Decode(abyRawTileData))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Decompression of inner chunk of shard %s failed",
+                 osFilename.c_str());
+        return false;
+    }
+    if (abyRawTileData.size() != m_nTileSize)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Decompressed inner chunk of shard %s has not expected size. "
+                 "Got %u instead of %u",
+                 osFilename.c_str(),
+                 static_cast<unsigned>(abyRawTileData.size()),
+                 static_cast<unsigned>(m_nTileSize));
+        return false;
+    }
+    ConvertRawTileData(abyRawTileData, abyDecodedTileData);
+    return true;
+}
+
+/************************************************************************/
+/*                  ZarrV3Array::LoadShardedTileData()                  */
+/************************************************************************/
+
+bool ZarrV3Array::LoadShardedTileData(
+    const uint64_t *tileIndices, bool bUseMutex,
+    ZarrV3CodecShardingIndexed *poSharding,
+    ZarrByteVectorQuickResize &abyRawTileData,
+    ZarrByteVectorQuickResize &abyDecodedTileData, bool &bMissingTileOut) const
+{
+    const std::string osFilename = BuildTileFilename(tileIndices);
+
+    VSILFILE *fp = nullptr;
+    const auto poShardIndex =
+        GetShardIndex(osFilename, bUseMutex, poSharding, fp);
+    if (!poShardIndex)
+        return false;
+
+    uint64_t nOffset = 0;
+    uint64_t nSize = 0;
+    bool bRet = GetInnerChunkLocation(*poShardIndex,
+                                      GetInnerChunkIndex(tileIndices),
+                                      osFilename, nOffset, nSize,
+                                      bMissingTileOut);
+    if (bRet && !bMissingTileOut)
+    {
+        if (fp == nullptr)
+            fp = OpenTileFile(osFilename);
+        try
+        {
+            abyRawTileData.resize(static_cast<size_t>(nSize));
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate memory for inner chunk of shard %s",
+                     osFilename.c_str());
+            bRet = false;
+        }
+        if (bRet &&
+            (fp == nullptr || VSIFSeekL(fp, nOffset, SEEK_SET) != 0 ||
+             VSIFReadL(abyRawTileData.data(), 1, abyRawTileData.size(), fp) !=
+                 abyRawTileData.size()))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Could not read inner chunk of shard %s correctly",
+                     osFilename.c_str());
+            bRet = false;
+        }
+        if (bRet)
+        {
+            bRet = DecodeInnerChunk(osFilename, poSharding, abyRawTileData,
+                                    abyDecodedTileData);
+        }
+    }
+    if (fp)
+        VSIFCloseL(fp);
+    return bRet;
 }
 
 /************************************************************************/
@@ -569,10 +853,15 @@ bool ZarrV3Array::IAdviseRead(const GUInt64 *arrayStartIdx, const size_t *count,
     std::vector<uint64_t> anReqTilesIndices;
     size_t nReqTiles = 0;
     if (!IAdviseReadCommon(arrayStartIdx, count, papszOptions, anIndicesCur,
-                           nThreadsMax, anReqTilesIndices, nReqTiles))
+                           nThreadsMax, anReqTilesIndices, nReqTiles,
+                           /* bListTilesIfSingleThreaded = */ IsSharded()))
     {
         return false;
     }
+    if (IsSharded())
+    {
+        return IAdviseReadSharded(anReqTilesIndices, nReqTiles, nThreadsMax);
+    }
     if (nThreadsMax <= 1)
     {
         return true;
@@ -726,6 +1015,244 @@ bool ZarrV3Array::IAdviseRead(const GUInt64 *arrayStartIdx, const size_t *count,
     return bGlobalStatus;
 }
 
+/************************************************************************/
+/*                   ZarrV3Array::IAdviseReadSharded()                  */
+/************************************************************************/
+
+// Loads the requested inner chunks in m_oMapTileIndexToCachedTile, with
+// one multi-range read per shard.
+bool ZarrV3Array::IAdviseReadSharded(
+    const std::vector<uint64_t> &anReqTilesIndices, size_t nReqTiles,
+    int nThreadsMax) const
+{
+    const size_t nDims = m_aoDims.size();
+
+    // Group requested inner chunks by shard
+    std::map<std::string, std::vector<size_t>> oMapShardToReqTiles;
+    for (size_t iReq = 0; iReq < nReqTiles; ++iReq)
+    {
+        oMapShardToReqTiles[BuildTileFilename(anReqTilesIndices.data() +
+                                              iReq * nDims)]
+            .push_back(iReq);
+    }
+    std::vector<std::pair<std::string, std::vector<size_t>>> aoShards(
+        oMapShardToReqTiles.begin(), oMapShardToReqTiles.end());
+
+    const int nThreads = static_cast<int>(
+        std::min(static_cast<size_t>(std::max(1, nThreadsMax)),
+                 aoShards.size()));
+    CPLWorkerThreadPool *wtp =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poQueue = wtp ? wtp->CreateJobQueue() : nullptr;
+
+    struct JobStruct
+    {
+        const ZarrV3Array *poArray = nullptr;
+        bool *pbGlobalStatus = nullptr;
+        const std::vector<uint64_t> *panReqTilesIndices = nullptr;
+        const std::vector<std::pair<std::string, std::vector<size_t>>>
+            *paoShards = nullptr;
+        size_t nFirstIdx = 0;
+        size_t nLastIdxNotIncluded = 0;
+    };
+
+    const auto JobFunc = [](void *pThreadData)
+    {
+        const JobStruct *jobStruct =
+            static_cast<const JobStruct *>(pThreadData);
+
+        const auto poArray = jobStruct->poArray;
+        const auto &aoDims = poArray->GetDimensions();
+        const size_t l_nDims = poArray->GetDimensionCount();
+        ZarrByteVectorQuickResize abyRawTileData;
+        ZarrByteVectorQuickResize abyDecodedTileData;
+        std::unique_ptr<ZarrV3CodecSequence> poCodecs;
+        {
+            std::lock_guard<std::mutex> oLock(poArray->m_oMutex);
+            poCodecs = poArray->m_poCodecs->Clone();
+        }
+        const auto poSharding = poCodecs->GetShardingCodec();
+
+        const auto StoreTile = [poArray, &aoDims, l_nDims](
+                                   const uint64_t *tileIndices,
+                                   ZarrByteVectorQuickResize *pabyTile)
+        {
+            uint64_t nTileIdx = 0;
+            for (size_t j = 0; j < l_nDims; ++j)
+            {
+                if (j > 0)
+                    nTileIdx *= aoDims[j - 1]->GetSize();
+                nTileIdx += tileIndices[j];
+            }
+            CachedTile cachedTile;
+            if (pabyTile)
+                std::swap(cachedTile.abyDecoded, *pabyTile);
+            std::lock_guard<std::mutex> oLock(poArray->m_oMutex);
+            poArray->m_oMapTileIndexToCachedTile[nTileIdx] =
+                std::move(cachedTile);
+        };
+
+        const auto SetError = [poArray, jobStruct]()
+        {
+            std::lock_guard<std::mutex> oLock(poArray->m_oMutex);
+            *jobStruct->pbGlobalStatus = false;
+        };
+
+        for (size_t iShard = jobStruct->nFirstIdx;
+             iShard < jobStruct->nLastIdxNotIncluded; ++iShard)
+        {
+            // Check if we must early exit
+            {
+                std::lock_guard<std::mutex> oLock(poArray->m_oMutex);
+                if (!(*jobStruct->pbGlobalStatus))
+                    return;
+            }
+
+            const std::string &osFilename =
+                (*jobStruct->paoShards)[iShard].first;
+            const auto &anReqTiles = (*jobStruct->paoShards)[iShard].second;
+
+            VSILFILE *fp = nullptr;
+            const auto poShardIndex =
+                poArray->GetShardIndex(osFilename, true, poSharding, fp);
+            if (!poShardIndex)
+            {
+                SetError();
+                return;
+            }
+
+            // Collect the location of non-empty inner chunks
+            std::vector<size_t> anReqTilesToRead;
+            std::vector<vsi_l_offset> anOffsets;
+            std::vector<size_t> anSizes;
+            size_t nTotalSize = 0;
+            bool bOK = true;
+            for (const size_t iReq : anReqTiles)
+            {
+                const uint64_t *tileIndices =
+                    jobStruct->panReqTilesIndices->data() + iReq * l_nDims;
+                uint64_t nOffset = 0;
+                uint64_t nSize = 0;
+                bool bMissing = false;
+                if (!poArray->GetInnerChunkLocation(
+                        *poShardIndex, poArray->GetInnerChunkIndex(tileIndices),
+                        osFilename, nOffset, nSize, bMissing))
+                {
+                    bOK = false;
+                    break;
+                }
+                if (bMissing)
+                {
+                    StoreTile(tileIndices, nullptr);
+                }
+                else
+                {
+                    anReqTilesToRead.push_back(iReq);
+                    anOffsets.push_back(nOffset);
+                    anSizes.push_back(static_cast<size_t>(nSize));
+                    nTotalSize += static_cast<size_t>(nSize);
+                }
+            }
+
+            // Fetch them with a multi-range read
+            std::vector<GByte> abyData;
+            if (bOK && !anReqTilesToRead.empty())
+            {
+                if (fp == nullptr)
+                    fp = poArray->OpenTileFile(osFilename);
+                std::vector<void *> apData;
+                try
+                {
+                    abyData.resize(nTotalSize);
+                    size_t nAccSize = 0;
+                    for (const size_t nSize : anSizes)
+                    {
+                        apData.push_back(abyData.data() + nAccSize);
+                        nAccSize += nSize;
+                    }
+                }
+                catch (const std::exception &)
+                {
+                    CPLError(CE_Failure, CPLE_OutOfMemory,
+                             "Cannot allocate memory for inner chunks of "
+                             "shard %s",
+                             osFilename.c_str());
+                    bOK = false;
+                }
+                if (bOK &&
+                    (fp == nullptr ||
+                     VSIFReadMultiRangeL(static_cast<int>(apData.size()),
+                                         apData.data(), anOffsets.data(),
+                                         anSizes.data(), fp) != 0))
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Could not read inner chunks of shard %s",
+                             osFilename.c_str());
+                    bOK = false;
+                }
+            }
+            if (fp)
+                VSIFCloseL(fp);
+
+            size_t nAccSize = 0;
+            for (size_t i = 0; bOK && i < anReqTilesToRead.size(); ++i)
+            {
+                const uint64_t *tileIndices =
+                    jobStruct->panReqTilesIndices->data() +
+                    anReqTilesToRead[i] * l_nDims;
+                if (!poArray->AllocateWorkingBuffers(abyRawTileData,
+                                                     abyDecodedTileData))
+                {
+                    bOK = false;
+                    break;
+                }
+                abyRawTileData.resize(anSizes[i]);
+                memcpy(abyRawTileData.data(), abyData.data() + nAccSize,
+                       anSizes[i]);
+                nAccSize += anSizes[i];
+                if (!poArray->DecodeInnerChunk(osFilename, poSharding,
+                                               abyRawTileData,
+                                               abyDecodedTileData))
+                {
+                    bOK = false;
+                    break;
+                }
+                StoreTile(tileIndices, !abyDecodedTileData.empty()
+                                           ? &abyDecodedTileData
+                                           : &abyRawTileData);
+            }
+
+            if (!bOK)
+            {
+                SetError();
+                return;
+            }
+        }
+    };
+
+    bool bGlobalStatus = true;
+    std::vector<JobStruct> asJobStructs(nThreads);
+    for (int i = 0; i < nThreads; i++)
+    {
+        JobStruct &jobStruct = asJobStructs[i];
+        jobStruct.poArray = this;
+        jobStruct.pbGlobalStatus = &bGlobalStatus;
+        jobStruct.panReqTilesIndices = &anReqTilesIndices;
+        jobStruct.paoShards = &aoShards;
+        jobStruct.nFirstIdx = static_cast<size_t>(i) * aoShards.size() /
+                              static_cast<size_t>(nThreads);
+        jobStruct.nLastIdxNotIncluded =
+            static_cast<size_t>(i + 1) * aoShards.size() /
+            static_cast<size_t>(nThreads);
+        if (!poQueue || !poQueue->SubmitJob(JobFunc, &jobStruct))
+            JobFunc(&jobStruct);
+    }
+    if (poQueue)
+        poQueue->WaitCompletion();
+
+    return bGlobalStatus;
+}
+
 /************************************************************************/
 /*                    ZarrV3Array::FlushDirtyTile()                     */
 /************************************************************************/
@@ -736,6 +1263,14 @@ bool ZarrV3Array::FlushDirtyTile() const
         return true;
     m_bDirtyTile = false;
 
+    if (IsSharded())
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Writing to arrays using the sharding_indexed codec is not "
+                 "supported");
+        return false;
+    }
+
     std::string osFilename = BuildTileFilename(m_anCachedTiledIndices.data());
 
     const size_t nSourceSize =
@@ -747,6 +1282,9 @@ bool ZarrV3Array::FlushDirtyTile() const
     {
         m_bCachedTiledEmpty = true;
 
+        if (!WaitPendingTileWrite(osFilename))
+            return false;
+
         VSIStatBufL sStat;
         if (VSIStatL(osFilename.c_str(), &sStat) == 0)
         {
@@ -771,14 +1309,59 @@ bool ZarrV3Array::FlushDirtyTile() const
         }
     }
 
-    const size_t nSizeBefore = m_abyRawTileData.size();
+    auto poJob = std::make_unique<TileWriteJob>();
+    poJob->osFilename = std::move(osFilename);
+    if (m_nWriteThreads <= 1)
+    {
+        // Synchronous writing: directly use the working buffer and codecs
+        const size_t nSizeBefore = m_abyRawTileData.size();
+        std::swap(poJob->abyRawTileData, m_abyRawTileData);
+        poJob->poArray = this;
+        const bool bRet = WriteTile(*poJob);
+        std::swap(poJob->abyRawTileData, m_abyRawTileData);
+        m_abyRawTileData.resize(nSizeBefore);
+        return bRet;
+    }
+
+    try
+    {
+        poJob->abyRawTileData.resize(m_abyRawTileData.size());
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for tile %s",
+                 poJob->osFilename.c_str());
+        return false;
+    }
+    memcpy(poJob->abyRawTileData.data(), m_abyRawTileData.data(),
+           m_abyRawTileData.size());
     if (m_poCodecs)
     {
-        if (!m_poCodecs->Encode(m_abyRawTileData))
-        {
-            m_abyRawTileData.resize(nSizeBefore);
+        // Codecs have working buffers, so each job needs its own instance
+        poJob->poCodecs = m_poCodecs->Clone();
+    }
+    return SubmitTileWrite(std::move(poJob));
+}
+
+/************************************************************************/
+/*                       ZarrV3Array::WriteTile()                       */
+/************************************************************************/
+
+bool ZarrV3Array::WriteTile(TileWriteJob &oJob) const
+{
+    // This method should NOT modify any ZarrArray member, as it is going to
+    // be called concurrently from several threads, with oJob.poCodecs set.
+
+    const std::string &osFilename = oJob.osFilename;
+    auto &abyRawTileData = oJob.abyRawTileData;
+
+    ZarrV3CodecSequence *poCodecs =
+        oJob.poCodecs ? oJob.poCodecs.get() : m_poCodecs.get();
+    if (poCodecs)
+    {
+        if (!poCodecs->Encode(abyRawTileData))
             return false;
-        }
     }
 
     if (m_osDimSeparator == "/")
@@ -787,11 +1370,12 @@ bool ZarrV3Array::FlushDirtyTile() const
         VSIStatBufL sStat;
         if (VSIStatL(osDir.c_str(), &sStat) != 0)
         {
-            if (VSIMkdirRecursive(osDir.c_str(), 0755) != 0)
+            // Another thread might have created it in the meantime
+            if (VSIMkdirRecursive(osDir.c_str(), 0755) != 0 &&
+                VSIStatL(osDir.c_str(), &sStat) != 0)
             {
                 CPLError(CE_Failure, CPLE_AppDefined,
                          "Cannot create directory %s", osDir.c_str());
-                m_abyRawTileData.resize(nSizeBefore);
                 return false;
             }
         }
@@ -802,13 +1386,12 @@ bool ZarrV3Array::FlushDirtyTile() const
     {
         CPLError(CE_Failure, CPLE_AppDefined, "Cannot create tile %s",
                  osFilename.c_str());
-        m_abyRawTileData.resize(nSizeBefore);
         return false;
     }
 
     bool bRet = true;
-    const size_t nRawDataSize = m_abyRawTileData.size();
-    if (VSIFWriteL(m_abyRawTileData.data(), 1, nRawDataSize, fp) !=
+    const size_t nRawDataSize = abyRawTileData.size();
+    if (VSIFWriteL(abyRawTileData.data(), 1, nRawDataSize, fp) !=
         nRawDataSize)
     {
         CPLError(CE_Failure, CPLE_AppDefined,
@@ -817,8 +1400,6 @@ bool ZarrV3Array::FlushDirtyTile() const
     }
     VSIFCloseL(fp);
 
-    m_abyRawTileData.resize(nSizeBefore);
-
     return bRet;
 }
 
@@ -828,6 +1409,26 @@ bool ZarrV3Array::FlushDirtyTile() const
 
 std::string ZarrV3Array::BuildTileFilename(const uint64_t *tileIndices) const
 {
+    if (IsSharded() && !m_aoDims.empty())
+    {
+        // Tiles are inner chunks stored in the file of their shard
+        std::vector<uint64_t> anShardIndices;
+        for (size_t i = 0; i < m_aoDims.size(); ++i)
+            anShardIndices.push_back(tileIndices[i] / m_anChunksPerShard[i]);
+        std::string osFilename(CPLGetDirname(m_osFilename.c_str()));
+        osFilename += '/';
+        if (!m_bV2ChunkKeyEncoding)
+        {
+            osFilename += 'c';
+        }
+        for (size_t i = 0; i < m_aoDims.size(); ++i)
+        {
+            if (i > 0 || !m_bV2ChunkKeyEncoding)
+                osFilename += m_osDimSeparator;
+            osFilename += std::to_string(anShardIndices[i]);
+        }
+        return osFilename;
+    }
     if (m_aoDims.empty())
     {
         return CPLFormFilename(CPLGetDirname(m_osFilename.c_str()),
@@ -1568,6 +2169,14 @@ ZarrV3Group::LoadArray(const std::string &osArrayName,
         poCodecs = std::make_unique<ZarrV3CodecSequence>(oInputArrayMetadata);
         if (!poCodecs->InitFromJson(oCodecs))
             return nullptr;
+
+        // With sharding, the tiles exposed by the array are the inner chunks
+        if (const auto poSharding = poCodecs->GetShardingCodec())
+        {
+            const auto &anInnerChunkShape = poSharding->GetInnerChunkShape();
+            for (size_t i = 0; i < anBlockSize.size(); ++i)
+                anBlockSize[i] = anInnerChunkShape[i];
+        }
     }
 
     auto poArray =
@@ -1603,7 +2212,16 @@ ZarrV3Group::LoadArray(const std::string &osArrayName,
     if (CPLTestBool(m_poSharedResource->GetOpenOptions().FetchNameValueDef(
             "CACHE_TILE_PRESENCE", "NO")))
     {
-        poArray->CacheTilePresence();
+        if (poArray->IsSharded())
+        {
+            CPLError(CE_Warning, CPLE_NotSupported,
+                     "CACHE_TILE_PRESENCE is not supported for arrays using "
+                     "the sharding_indexed codec");
+        }
+        else
+        {
+            poArray->CacheTilePresence();
+        }
     }
 
     return poArray;
@@ -916,6 +916,569 @@ bool ZarrV3CodecTranspose::Decode(const ZarrByteVectorQuickResize &abySrc,
     return Transpose(abySrc, abyDst, false);
 }
 
+/************************************************************************/
+/*                          ZarrV3CodecZstd()                           */
+/************************************************************************/
+
+ZarrV3CodecZstd::ZarrV3CodecZstd() : ZarrV3Codec(NAME)
+{
+}
+
+/************************************************************************/
+/*                         ~ZarrV3CodecZstd()                           */
+/************************************************************************/
+
+ZarrV3CodecZstd::~ZarrV3CodecZstd() = default;
+
+/************************************************************************/
+/*                           GetConfiguration()                         */
+/************************************************************************/
+
+/* static */ CPLJSONObject ZarrV3CodecZstd::GetConfiguration(int nLevel,
+                                                            bool bChecksum)
+{
+    CPLJSONObject oConfig;
+    oConfig.Add("level", nLevel);
+    oConfig.Add("checksum", bChecksum);
+    return oConfig;
+}
+
+/************************************************************************/
+/*                   ZarrV3CodecZstd::InitFromConfiguration()           */
+/************************************************************************/
+
+bool ZarrV3CodecZstd::InitFromConfiguration(
+    const CPLJSONObject &configuration,
+    const ZarrArrayMetadata &oInputArrayMetadata,
+    ZarrArrayMetadata &oOutputArrayMetadata)
+{
+    m_pCompressor = CPLGetCompressor("zstd");
+    m_pDecompressor = CPLGetDecompressor("zstd");
+    if (!m_pCompressor || !m_pDecompressor)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "zstd compressor not available");
+        return false;
+    }
+
+    m_oConfiguration = configuration.Clone();
+    m_oInputArrayMetadata = oInputArrayMetadata;
+    // byte->byte codec
+    oOutputArrayMetadata = oInputArrayMetadata;
+
+    int nLevel = 13;
+
+    if (configuration.IsValid())
+    {
+        if (configuration.GetType() != CPLJSONObject::Type::Object)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Codec zstd: configuration is not an object");
+            return false;
+        }
+
+        for (const auto &oChild : configuration.GetChildren())
+        {
+            if (oChild.GetName() != "level" && oChild.GetName() != "checksum")
+            {
+                CPLError(
+                    CE_Failure, CPLE_AppDefined,
+                    "Codec zstd: configuration contains a unhandled member: %s",
+                    oChild.GetName().c_str());
+                return false;
+            }
+        }
+
+        const auto oLevel = configuration.GetObj("level");
+        if (oLevel.IsValid())
+        {
+            if (oLevel.GetType() != CPLJSONObject::Type::Integer)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Codec zstd: level is not an integer");
+                return false;
+            }
+            nLevel = oLevel.ToInteger();
+            if (nLevel < -131072 || nLevel > 22)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Codec zstd: invalid value for level: %d", nLevel);
+                return false;
+            }
+        }
+
+        // The checksum, if present in the frame, is verified by libzstd
+        // when decoding. When encoding, no checksum is written.
+        const auto oChecksum = configuration.GetObj("checksum");
+        if (oChecksum.IsValid() &&
+            oChecksum.GetType() != CPLJSONObject::Type::Boolean)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Codec zstd: checksum is not a boolean");
+            return false;
+        }
+    }
+
+    m_aosCompressorOptions.SetNameValue("LEVEL", CPLSPrintf("%d", nLevel));
+
+    return true;
+}
+
+/************************************************************************/
+/*                      ZarrV3CodecZstd::Clone()                        */
+/************************************************************************/
+
+std::unique_ptr<ZarrV3Codec> ZarrV3CodecZstd::Clone() const
+{
+    auto psClone = std::make_unique<ZarrV3CodecZstd>();
+    ZarrArrayMetadata oOutputArrayMetadata;
+    psClone->InitFromConfiguration(m_oConfiguration, m_oInputArrayMetadata,
+                                   oOutputArrayMetadata);
+    return psClone;
+}
+
+/************************************************************************/
+/*                      ZarrV3CodecZstd::Encode()                       */
+/************************************************************************/
+
+bool ZarrV3CodecZstd::Encode(const ZarrByteVectorQuickResize &abySrc,
+                             ZarrByteVectorQuickResize &abyDst) const
+{
+    abyDst.resize(abyDst.capacity());
+    void *pOutputData = abyDst.data();
+    size_t nOutputSize = abyDst.size();
+    bool bRet = m_pCompressor->pfnFunc(
+        abySrc.data(), abySrc.size(), &pOutputData, &nOutputSize,
+        m_aosCompressorOptions.List(), m_pCompressor->user_data);
+    if (bRet)
+    {
+        abyDst.resize(nOutputSize);
+    }
+    else if (nOutputSize > abyDst.size())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "ZarrV3CodecZstd::Encode(): output buffer too small");
+    }
+    return bRet;
+}
+
+/************************************************************************/
+/*                      ZarrV3CodecZstd::Decode()                       */
+/************************************************************************/
+
+bool ZarrV3CodecZstd::Decode(const ZarrByteVectorQuickResize &abySrc,
+                             ZarrByteVectorQuickResize &abyDst) const
+{
+    abyDst.resize(abyDst.capacity());
+    void *pOutputData = abyDst.data();
+    size_t nOutputSize = abyDst.size();
+    bool bRet = m_pDecompressor->pfnFunc(abySrc.data(), abySrc.size(),
+                                         &pOutputData, &nOutputSize, nullptr,
+                                         m_pDecompressor->user_data);
+    if (bRet)
+    {
+        abyDst.resize(nOutputSize);
+    }
+    else if (nOutputSize > abyDst.size())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "ZarrV3CodecZstd::Decode(): output buffer too small");
+    }
+    return bRet;
+}
+
+/************************************************************************/
+/*                         ZarrV3CodecCRC32C()                          */
+/************************************************************************/
+
+ZarrV3CodecCRC32C::ZarrV3CodecCRC32C() : ZarrV3Codec(NAME)
+{
+}
+
+/************************************************************************/
+/*                        ~ZarrV3CodecCRC32C()                          */
+/************************************************************************/
+
+ZarrV3CodecCRC32C::~ZarrV3CodecCRC32C() = default;
+
+/************************************************************************/
+/*                 ZarrV3CodecCRC32C::InitFromConfiguration()           */
+/************************************************************************/
+
+bool ZarrV3CodecCRC32C::InitFromConfiguration(
+    const CPLJSONObject &configuration,
+    const ZarrArrayMetadata &oInputArrayMetadata,
+    ZarrArrayMetadata &oOutputArrayMetadata)
+{
+    m_oConfiguration = configuration.Clone();
+    m_oInputArrayMetadata = oInputArrayMetadata;
+    // byte->byte codec
+    oOutputArrayMetadata = oInputArrayMetadata;
+
+    if (configuration.IsValid())
+    {
+        if (configuration.GetType() != CPLJSONObject::Type::Object)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Codec crc32c: configuration is not an object");
+            return false;
+        }
+
+        for (const auto &oChild : configuration.GetChildren())
+        {
+            CPLError(
+                CE_Failure, CPLE_AppDefined,
+                "Codec crc32c: configuration contains a unhandled member: %s",
+                oChild.GetName().c_str());
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                     ZarrV3CodecCRC32C::Clone()                       */
+/************************************************************************/
+
+std::unique_ptr<ZarrV3Codec> ZarrV3CodecCRC32C::Clone() const
+{
+    auto psClone = std::make_unique<ZarrV3CodecCRC32C>();
+    ZarrArrayMetadata oOutputArrayMetadata;
+    psClone->InitFromConfiguration(m_oConfiguration, m_oInputArrayMetadata,
+                                   oOutputArrayMetadata);
+    return psClone;
+}
+
+/************************************************************************/
+/*                  ZarrV3CodecCRC32C::ComputeCRC32C()                  */
+/************************************************************************/
+
+/* static */ uint32_t ZarrV3CodecCRC32C::ComputeCRC32C(const GByte *pabyData,
+                                                       size_t nSize)
+{
+    // Table-driven CRC-32C (Castagnoli), reflected polynomial 0x82F63B78
+    static const std::array<uint32_t, 256> anTable = []()
+    {
+        std::array<uint32_t, 256> anTableTmp{};
+        for (uint32_t i = 0; i < 256; ++i)
+        {
+            uint32_t nCRC = i;
+            for (int j = 0; j < 8; ++j)
+                nCRC = (nCRC >> 1) ^ ((nCRC & 1) ? 0x82F63B78U : 0);
+            anTableTmp[i] = nCRC;
+        }
+        return anTableTmp;
+    }();
+
+    uint32_t nCRC = 0xFFFFFFFFU;
+    for (size_t i = 0; i < nSize; ++i)
+        nCRC = (nCRC >> 8) ^ anTable[(nCRC ^ pabyData[i]) & 0xFF];
+    return nCRC ^ 0xFFFFFFFFU;
+}
+
+/************************************************************************/
+/*                     ZarrV3CodecCRC32C::Encode()                      */
+/************************************************************************/
+
+bool ZarrV3CodecCRC32C::Encode(const ZarrByteVectorQuickResize &abySrc,
+                               ZarrByteVectorQuickResize &abyDst) const
+{
+    const size_t nSize = abySrc.size();
+    abyDst.resize(nSize + sizeof(uint32_t));
+    if (nSize)
+        memcpy(abyDst.data(), abySrc.data(), nSize);
+    uint32_t nCRC = ComputeCRC32C(abySrc.data(), nSize);
+    CPL_LSBPTR32(&nCRC);
+    memcpy(abyDst.data() + nSize, &nCRC, sizeof(nCRC));
+    return true;
+}
+
+/************************************************************************/
+/*                     ZarrV3CodecCRC32C::Decode()                      */
+/************************************************************************/
+
+bool ZarrV3CodecCRC32C::Decode(const ZarrByteVectorQuickResize &abySrc,
+                               ZarrByteVectorQuickResize &abyDst) const
+{
+    if (abySrc.size() < sizeof(uint32_t))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "ZarrV3CodecCRC32C::Decode(): input buffer too small");
+        return false;
+    }
+    const size_t nSize = abySrc.size() - sizeof(uint32_t);
+    uint32_t nExpectedCRC = 0;
+    memcpy(&nExpectedCRC, abySrc.data() + nSize, sizeof(nExpectedCRC));
+    CPL_LSBPTR32(&nExpectedCRC);
+    if (ComputeCRC32C(abySrc.data(), nSize) != nExpectedCRC)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "ZarrV3CodecCRC32C::Decode(): checksum mismatch");
+        return false;
+    }
+    abyDst.resize(nSize);
+    if (nSize)
+        memcpy(abyDst.data(), abySrc.data(), nSize);
+    return true;
+}
+
+/************************************************************************/
+/*                     ZarrV3CodecShardingIndexed()                     */
+/************************************************************************/
+
+ZarrV3CodecShardingIndexed::ZarrV3CodecShardingIndexed() : ZarrV3Codec(NAME)
+{
+}
+
+/************************************************************************/
+/*                    ~ZarrV3CodecShardingIndexed()                     */
+/************************************************************************/
+
+ZarrV3CodecShardingIndexed::~ZarrV3CodecShardingIndexed() = default;
+
+/************************************************************************/
+/*             ZarrV3CodecShardingIndexed::InitFromConfiguration()      */
+/************************************************************************/
+
+bool ZarrV3CodecShardingIndexed::InitFromConfiguration(
+    const CPLJSONObject &configuration,
+    const ZarrArrayMetadata &oInputArrayMetadata,
+    ZarrArrayMetadata &oOutputArrayMetadata)
+{
+    m_oConfiguration = configuration.Clone();
+    m_oInputArrayMetadata = oInputArrayMetadata;
+    // array->byte codec
+    oOutputArrayMetadata = oInputArrayMetadata;
+
+    if (!configuration.IsValid() ||
+        configuration.GetType() != CPLJSONObject::Type::Object)
+    {
+        CPLError(
+            CE_Failure, CPLE_AppDefined,
+            "Codec sharding_indexed: configuration missing or not an object");
+        return false;
+    }
+
+    for (const auto &oChild : configuration.GetChildren())
+    {
+        const auto osName = oChild.GetName();
+        if (osName != "chunk_shape" && osName != "codecs" &&
+            osName != "index_codecs" && osName != "index_location")
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Codec sharding_indexed: configuration contains a "
+                     "unhandled member: %s",
+                     osName.c_str());
+            return false;
+        }
+    }
+
+    const auto oChunkShape = configuration.GetArray("chunk_shape");
+    if (!oChunkShape.IsValid() ||
+        static_cast<size_t>(oChunkShape.Size()) !=
+            oInputArrayMetadata.anBlockSizes.size())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec sharding_indexed: chunk_shape missing, not an array, "
+                 "or with a number of values different from the number of "
+                 "dimensions");
+        return false;
+    }
+
+    m_oInnerArrayMetadata = ZarrArrayMetadata();
+    m_oInnerArrayMetadata.oElt = oInputArrayMetadata.oElt;
+    m_anChunksPerShard.clear();
+    m_nInnerChunkCount = 1;
+    for (int i = 0; i < oChunkShape.Size(); ++i)
+    {
+        const auto oVal = oChunkShape[i];
+        const size_t nShardSize = oInputArrayMetadata.anBlockSizes[i];
+        const auto nInnerSize = oVal.ToLong(0);
+        if (oVal.GetType() != CPLJSONObject::Type::Integer &&
+            oVal.GetType() != CPLJSONObject::Type::Long)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Codec sharding_indexed: chunk_shape[%d] is not an "
+                     "integer",
+                     i);
+            return false;
+        }
+        if (nInnerSize <= 0 ||
+            static_cast<uint64_t>(nInnerSize) > nShardSize ||
+            (nShardSize % static_cast<size_t>(nInnerSize)) != 0)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Codec sharding_indexed: chunk_shape[%d] should be "
+                     "strictly positive and divide the shard shape",
+                     i);
+            return false;
+        }
+        m_oInnerArrayMetadata.anBlockSizes.push_back(
+            static_cast<size_t>(nInnerSize));
+        m_anChunksPerShard.push_back(nShardSize /
+                                     static_cast<size_t>(nInnerSize));
+        // Cannot overflow, since bounded by the number of elements of a shard
+        m_nInnerChunkCount *= m_anChunksPerShard.back();
+    }
+    if (m_nInnerChunkCount >
+        std::numeric_limits<size_t>::max() / (2 * sizeof(uint64_t)))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec sharding_indexed: too many inner chunks");
+        return false;
+    }
+
+    const auto oIndexLocation = configuration.GetObj("index_location");
+    if (oIndexLocation.IsValid())
+    {
+        const auto osIndexLocation = oIndexLocation.ToString();
+        if (osIndexLocation == "end")
+            m_bIndexAtEnd = true;
+        else if (osIndexLocation == "start")
+            m_bIndexAtEnd = false;
+        else
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Codec sharding_indexed: invalid value for "
+                     "index_location");
+            return false;
+        }
+    }
+
+    const auto oCodecs = configuration.GetObj("codecs");
+    if (oCodecs.GetType() != CPLJSONObject::Type::Array)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec sharding_indexed: codecs missing or not an array");
+        return false;
+    }
+    m_poCodecs = std::make_unique<ZarrV3CodecSequence>(m_oInnerArrayMetadata);
+    if (!m_poCodecs->InitFromJson(oCodecs))
+        return false;
+    if (m_poCodecs->GetShardingCodec())
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Codec sharding_indexed: nested sharding is not supported");
+        return false;
+    }
+
+    // The index is an array of uint64 of shape chunks_per_shard + [2]
+    ZarrArrayMetadata oIndexArrayMetadata;
+    oIndexArrayMetadata.oElt.nativeType = DtypeElt::NativeType::UNSIGNED_INT;
+    oIndexArrayMetadata.oElt.nativeSize = sizeof(uint64_t);
+    oIndexArrayMetadata.oElt.gdalType =
+        GDALExtendedDataType::Create(GDT_UInt64);
+    oIndexArrayMetadata.oElt.gdalSize = sizeof(uint64_t);
+    oIndexArrayMetadata.anBlockSizes = m_anChunksPerShard;
+    oIndexArrayMetadata.anBlockSizes.push_back(2);
+
+    const auto oIndexCodecs = configuration.GetObj("index_codecs");
+    if (oIndexCodecs.GetType() != CPLJSONObject::Type::Array)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec sharding_indexed: index_codecs missing or not an "
+                 "array");
+        return false;
+    }
+    m_poIndexCodecs =
+        std::make_unique<ZarrV3CodecSequence>(oIndexArrayMetadata);
+    if (!m_poIndexCodecs->InitFromJson(oIndexCodecs))
+        return false;
+
+    // Index codecs must produce a fixed-sized output. Determine it by
+    // encoding a dummy index.
+    const size_t nRawIndexSize = m_nInnerChunkCount * 2 * sizeof(uint64_t);
+    ZarrByteVectorQuickResize abyIndex;
+    try
+    {
+        abyIndex.resize(nRawIndexSize);
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+        return false;
+    }
+    memset(abyIndex.data(), 0xFF, nRawIndexSize);
+    if (!m_poIndexCodecs->Encode(abyIndex))
+        return false;
+    m_nEncodedIndexSize = abyIndex.size();
+
+    return true;
+}
+
+/************************************************************************/
+/*                  ZarrV3CodecShardingIndexed::Clone()                 */
+/************************************************************************/
+
+std::unique_ptr<ZarrV3Codec> ZarrV3CodecShardingIndexed::Clone() const
+{
+    auto psClone = std::make_unique<ZarrV3CodecShardingIndexed>();
+    ZarrArrayMetadata oOutputArrayMetadata;
+    psClone->InitFromConfiguration(m_oConfiguration, m_oInputArrayMetadata,
+                                   oOutputArrayMetadata);
+    return psClone;
+}
+
+/************************************************************************/
+/*                  ZarrV3CodecShardingIndexed::Encode()                */
+/************************************************************************/
+
+bool ZarrV3CodecShardingIndexed::Encode(const ZarrByteVectorQuickResize &,
+                                        ZarrByteVectorQuickResize &) const
+{
+    CPLError(CE_Failure, CPLE_NotSupported,
+             "Codec sharding_indexed: writing shards is not supported");
+    return false;
+}
+
+/************************************************************************/
+/*                  ZarrV3CodecShardingIndexed::Decode()                */
+/************************************************************************/
+
+bool ZarrV3CodecShardingIndexed::Decode(const ZarrByteVectorQuickResize &,
+                                        ZarrByteVectorQuickResize &) const
+{
+    // Whole shards are never decoded: ZarrV3Array reads inner chunks
+    // individually, using GetInnerCodecs() and DecodeIndex().
+    CPLError(CE_Failure, CPLE_NotSupported,
+             "Codec sharding_indexed: decoding whole shards is not supported");
+    return false;
+}
+
+/************************************************************************/
+/*               ZarrV3CodecShardingIndexed::DecodeIndex()              */
+/************************************************************************/
+
+bool ZarrV3CodecShardingIndexed::DecodeIndex(
+    const GByte *pabyData, size_t nSize, std::vector<uint64_t> &anIndex) const
+{
+    const size_t nRawIndexSize = m_nInnerChunkCount * 2 * sizeof(uint64_t);
+    ZarrByteVectorQuickResize abyIndex;
+    try
+    {
+        abyIndex.resize(std::max(nSize, nRawIndexSize));
+        anIndex.resize(m_nInnerChunkCount * 2);
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+        return false;
+    }
+    abyIndex.resize(nSize);
+    memcpy(abyIndex.data(), pabyData, nSize);
+    if (!m_poIndexCodecs->Decode(abyIndex))
+        return false;
+    if (abyIndex.size() != nRawIndexSize)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec sharding_indexed: decoded index has not expected "
+                 "size");
+        return false;
+    }
+    memcpy(anIndex.data(), abyIndex.data(), nRawIndexSize);
+    return true;
+}
+
 /************************************************************************/
 /*                    ZarrV3CodecSequence::Clone()                      */
 /************************************************************************/
@@ -980,10 +1543,29 @@ bool ZarrV3CodecSequence::InitFromJson(const CPLJSONObject &oCodecs)
             poCodec = std::make_unique<ZarrV3CodecGZip>();
         else if (osName == "blosc")
             poCodec = std::make_unique<ZarrV3CodecBlosc>();
-        else if (osName == "endian")
+        // "bytes" is the name of the "endian" codec in the final version
+        // of the Zarr V3 specification
+        else if (osName == "endian" || osName == "bytes")
             poCodec = std::make_unique<ZarrV3CodecEndian>();
         else if (osName == "transpose")
             poCodec = std::make_unique<ZarrV3CodecTranspose>();
+        else if (osName == "zstd")
+            poCodec = std::make_unique<ZarrV3CodecZstd>();
+        else if (osName == "crc32c")
+            poCodec = std::make_unique<ZarrV3CodecCRC32C>();
+        else if (osName == "sharding_indexed")
+        {
+            // Partial decoding of shards is only possible if the sharding
+            // codec is the only one.
+            if (oCodecsArray.Size() != 1)
+            {
+                CPLError(CE_Failure, CPLE_NotSupported,
+                         "Codec sharding_indexed is only supported when it is "
+                         "the only codec");
+                return false;
+            }
+            poCodec = std::make_unique<ZarrV3CodecShardingIndexed>();
+        }
         else
         {
             CPLError(CE_Failure, CPLE_NotSupported, "Unsupported codec: %s",
@@ -1107,3 +1689,14 @@ bool ZarrV3CodecSequence::Decode(ZarrByteVectorQuickResize &abyBuffer)
     }
     return true;
 }
+
+/************************************************************************/
+/*                ZarrV3CodecSequence::GetShardingCodec()               */
+/************************************************************************/
+
+ZarrV3CodecShardingIndexed *ZarrV3CodecSequence::GetShardingCodec() const
+{
+    if (m_apoCodecs.size() != 1)
+        return nullptr;
+    return dynamic_cast<ZarrV3CodecShardingIndexed *>(m_apoCodecs[0].get());
+}
@@ -693,6 +693,7 @@ std::shared_ptr<GDALMDArray> ZarrV3Group::CreateMDArray(
     poArray->SetFilename(osFilename);
     poArray->SetDimSeparator(pszDimSeparator);
     poArray->SetDtype(dtype);
+    poArray->SetWriteThreads(CSLFetchNameValue(papszOptions, "NUM_THREADS"));
     if (poCodecs)
         poArray->SetCodecs(std::move(poCodecs));
     poArray->SetUpdatable(true);
@@ -778,6 +778,16 @@ void ZarrDriver::InitMetadata()
             "Dimension separator in chunk filenames. Default to decimal point "
             "for ZarrV2 and slash for ZarrV3");
 
+        auto psNumThreadsNode =
+            CPLCreateXMLNode(oTree.get(), CXT_Element, "Option");
+        CPLAddXMLAttributeAndValue(psNumThreadsNode, "name", "NUM_THREADS");
+        CPLAddXMLAttributeAndValue(psNumThreadsNode, "type", "string");
+        CPLAddXMLAttributeAndValue(
+            psNumThreadsNode, "description",
+            "Number of worker threads to compress and write chunks. Can be "
+            "set to ALL_CPUS");
+        CPLAddXMLAttributeAndValue(psNumThreadsNode, "default", "1");
+
         for (auto iter = compressors; iter && *iter; ++iter)
         {
             const auto psCompressor = CPLGetCompressor(*iter);
@@ -378,6 +378,14 @@ typedef struct GDALDimensionHS *GDALDimensionH;
  */
 #define GDAL_DMD_EXTENSIONS "DMD_EXTENSIONS"
 
+/** List of (space separated) magic byte signatures, as hexadecimal strings,
+ * one of which the header of a file must start with for the driver to
+ * recognize it. When set, drivers are not probed on opened files that do not
+ * match any of them.
+ * @since GDAL 3.10
+ */
+#define GDAL_DMD_MAGIC_BYTES "DMD_MAGIC_BYTES"
+
 /** XML snippet with creation options. */
 #define GDAL_DMD_CREATIONOPTIONLIST "DMD_CREATIONOPTIONLIST"
 
@@ -744,6 +752,14 @@ typedef struct GDALDimensionHS *GDALDimensionH;
  */
 #define GDAL_DCAP_FLUSHCACHE_CONSISTENT_STATE "DCAP_FLUSHCACHE_CONSISTENT_STATE"
 
+/** Capability set by raster drivers whose read-only datasets can be re-opened
+ * a second time, and used from another thread, to read blocks independently
+ * of the original dataset. This is used by the generic block prefetcher
+ * (see GDAL_PREFETCH_BLOCKS configuration option).
+ * @since GDAL 3.10
+ */
+#define GDAL_DCAP_INDEPENDENT_BLOCK_READS "DCAP_INDEPENDENT_BLOCK_READS"
+
 /** Capability set by drivers which honor the OGRCoordinatePrecision settings
  * of geometry fields at layer creation and/or for OGRLayer::CreateGeomField().
  * Note that while those drivers honor the settings at feature writing time,
@@ -1030,6 +1046,23 @@ GDALDatasetH CPL_DLL CPL_STDCALL GDALOpenShared(const char *, GDALAccess)
 #define GDAL_OF_FROM_GDALOPEN 0x400
 #endif
 
+/** Open in thread-safe mode.
+ *
+ * The returned dataset can be used concurrently by several threads, for
+ * read-only raster access (GetRasterBand(), RasterIO(), ReadBlock(),
+ * GetOverview(), GetMaskBand(), metadata getters, ...). Each thread using it
+ * transparently gets its own underlying dataset handle, opened on first use
+ * with the same parameters and kept until the dataset is closed.
+ * Modifications are not allowed.
+ *
+ * Must be combined with GDAL_OF_RASTER only, and is incompatible with
+ * GDAL_OF_UPDATE and GDAL_OF_SHARED.
+ *
+ * Used by GDALOpenEx().
+ * @since GDAL 3.10
+ */
+#define GDAL_OF_THREAD_SAFE 0x800
+
 GDALDatasetH CPL_DLL CPL_STDCALL GDALOpenEx(
     const char *pszFilename, unsigned int nOpenFlags,
     const char *const *papszAllowedDrivers, const char *const *papszOpenOptions,
@@ -1199,6 +1232,8 @@ void CPL_DLL *CPL_STDCALL GDALGetInternalHandle(GDALDatasetH, const char *);
 int CPL_DLL CPL_STDCALL GDALReferenceDataset(GDALDatasetH);
 int CPL_DLL CPL_STDCALL GDALDereferenceDataset(GDALDatasetH);
 int CPL_DLL CPL_STDCALL GDALReleaseDataset(GDALDatasetH);
+bool CPL_DLL GDALDatasetIsThreadSafe(GDALDatasetH, int nScopeFlags,
+                                     CSLConstList papszOptions);
 
 CPLErr CPL_DLL CPL_STDCALL GDALBuildOverviews(GDALDatasetH, const char *, int,
                                               const int *, int, const int *,
@@ -1211,6 +1246,9 @@ void CPL_DLL CPL_STDCALL GDALGetOpenDatasets(GDALDatasetH **hDS, int *pnCount);
 int CPL_DLL CPL_STDCALL GDALGetAccess(GDALDatasetH hDS);
 CPLErr CPL_DLL CPL_STDCALL GDALFlushCache(GDALDatasetH hDS);
 CPLErr CPL_DLL CPL_STDCALL GDALDropCache(GDALDatasetH hDS);
+void CPL_DLL GDALDatasetSetCacheBudget(GDALDatasetH hDS, GIntBig nBudget);
+GIntBig CPL_DLL GDALDatasetGetCacheBudget(GDALDatasetH hDS);
+GIntBig CPL_DLL GDALDatasetGetCacheUsed(GDALDatasetH hDS);
 
 CPLErr CPL_DLL CPL_STDCALL GDALCreateDatasetMaskBand(GDALDatasetH hDS,
                                                      int nFlags);
@@ -1509,6 +1547,16 @@ CPLErr CPL_DLL CPL_STDCALL GDALRasterIOEx(
     GDALRasterIOExtraArg *psExtraArg) CPL_WARN_UNUSED_RESULT;
 CPLErr CPL_DLL CPL_STDCALL GDALReadBlock(GDALRasterBandH, int, int,
                                          void *) CPL_WARN_UNUSED_RESULT;
+CPLErr CPL_DLL GDALReadBlocks(GDALRasterBandH, int, const int *, const int *,
+                              void *const *) CPL_WARN_UNUSED_RESULT;
+CPLErr CPL_DLL GDALRasterSamplePoints(GDALRasterBandH, size_t, const double *,
+                                      const double *, GDALRIOResampleAlg,
+                                      void *,
+                                      GDALDataType) CPL_WARN_UNUSED_RESULT;
+CPLErr CPL_DLL GDALRasterReadWindows(GDALRasterBandH, int, const int *,
+                                     void *, int, int, GDALDataType, GSpacing,
+                                     GSpacing, GSpacing,
+                                     GDALRIOResampleAlg) CPL_WARN_UNUSED_RESULT;
 CPLErr CPL_DLL CPL_STDCALL GDALWriteBlock(GDALRasterBandH, int, int,
                                           void *) CPL_WARN_UNUSED_RESULT;
 int CPL_DLL CPL_STDCALL GDALGetRasterBandXSize(GDALRasterBandH);
@@ -1560,6 +1608,10 @@ CPLErr CPL_DLL CPL_STDCALL GDALSetRasterStatistics(GDALRasterBandH hBand,
 GDALMDArrayH
     CPL_DLL GDALRasterBandAsMDArray(GDALRasterBandH) CPL_WARN_UNUSED_RESULT;
 
+bool CPL_DLL GDALRasterBandGetArrowStream(GDALRasterBandH hBand,
+                                          struct ArrowArrayStream *out_stream,
+                                          CSLConstList papszOptions);
+
 const char CPL_DLL *CPL_STDCALL GDALGetRasterUnitType(GDALRasterBandH);
 CPLErr CPL_DLL CPL_STDCALL GDALSetRasterUnitType(GDALRasterBandH hBand,
                                                  const char *pszNewValue);
@@ -1831,6 +1883,11 @@ void CPL_DLL GDALDeinterleave(const void *pSourceBuffer, GDALDataType eSourceDT,
                               int nComponents, void **ppDestBuffer,
                               GDALDataType eDestDT, size_t nIters);
 
+void CPL_DLL GDALInterleave(const void *const *ppSourceBuffer,
+                            GDALDataType eSourceDT, int nComponents,
+                            void *pDestBuffer, GDALDataType eDestDT,
+                            size_t nIters);
+
 double CPL_DLL GDALGetNoDataReplacementValue(GDALDataType, double);
 
 int CPL_DLL CPL_STDCALL GDALLoadWorldFile(const char *, double *);
@@ -2183,6 +2240,8 @@ void CPL_DLL CPL_STDCALL GDALSetCacheMax64(GIntBig nBytes);
 GIntBig CPL_DLL CPL_STDCALL GDALGetCacheMax64(void);
 GIntBig CPL_DLL CPL_STDCALL GDALGetCacheUsed64(void);
 
+char CPL_DLL *GDALGetRuntimeMetrics(void);
+
 int CPL_DLL CPL_STDCALL GDALFlushCacheBlock(void);
 
 /* ==================================================================== */
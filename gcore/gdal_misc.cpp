@@ -40,8 +40,12 @@
 #include <fcntl.h>
 
 #include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <limits>
+#include <map>
+#include <mutex>
+#include <set>
 #include <string>
 
 #include "cpl_conv.h"
@@ -1597,7 +1601,8 @@ CPLString GDALFindAssociatedFile(const char *pszBaseFilename,
     {
         VSIStatBufL sStatBuf;
 
-        if (VSIStatExL(osTarget, &sStatBuf, VSI_STAT_EXISTS_FLAG) != 0)
+        if (GDALStatSidecarFile(osTarget, &sStatBuf, VSI_STAT_EXISTS_FLAG) !=
+            0)
         {
             CPLString osAltExt = pszExt;
 
@@ -1608,7 +1613,8 @@ CPLString GDALFindAssociatedFile(const char *pszBaseFilename,
 
             osTarget = CPLResetExtension(pszBaseFilename, osAltExt);
 
-            if (VSIStatExL(osTarget, &sStatBuf, VSI_STAT_EXISTS_FLAG) != 0)
+            if (GDALStatSidecarFile(osTarget, &sStatBuf,
+                                    VSI_STAT_EXISTS_FLAG) != 0)
                 return "";
         }
     }
@@ -2350,12 +2356,14 @@ int GDALReadWorldFile2(const char *pszBaseFilename, const char *pszExtension,
     /* -------------------------------------------------------------------- */
 
     VSIStatBufL sStatBuf;
-    bool bGotTFW = VSIStatExL(pszTFW, &sStatBuf, VSI_STAT_EXISTS_FLAG) == 0;
+    bool bGotTFW =
+        GDALStatSidecarFile(pszTFW, &sStatBuf, VSI_STAT_EXISTS_FLAG) == 0;
 
     if (!bGotTFW && VSIIsCaseSensitiveFS(pszTFW))
     {
         pszTFW = CPLResetExtension(pszBaseFilename, szExtUpper);
-        bGotTFW = VSIStatExL(pszTFW, &sStatBuf, VSI_STAT_EXISTS_FLAG) == 0;
+        bGotTFW =
+            GDALStatSidecarFile(pszTFW, &sStatBuf, VSI_STAT_EXISTS_FLAG) == 0;
     }
 
     if (!bGotTFW)
@@ -2433,6 +2441,7 @@ int CPL_STDCALL GDALWriteWorldFile(const char *pszBaseFilename,
     /*      Update extension, and write to disk.                            */
     /* -------------------------------------------------------------------- */
     const char *pszTFW = CPLResetExtension(pszBaseFilename, pszExtension);
+    GDALInvalidateSidecarFileCache(pszTFW);
     VSILFILE *const fpTFW = VSIFOpenL(pszTFW, "wt");
     if (fpTFW == nullptr)
         return FALSE;
@@ -3129,6 +3138,20 @@ static void StripIrrelevantOptions(CPLXMLNode *psCOL, int nOptions)
     }
 }
 
+/************************************************************************/
+/*                         GDALPrintIOStatistics()                      */
+/************************************************************************/
+
+static void GDALPrintIOStatistics()
+{
+    char *pszStats = VSIGetIOStatistics(nullptr, nullptr);
+    if (pszStats)
+    {
+        fprintf(stderr, "I/O statistics:\n%s\n", pszStats); /*ok*/
+        VSIFree(pszStats);
+    }
+}
+
 /************************************************************************/
 /*                    GDALGeneralCmdLineProcessor()                     */
 /************************************************************************/
@@ -3149,6 +3172,8 @@ static void StripIrrelevantOptions(CPLXMLNode *psCOL, int nOptions)
  *  --config key value: set system configuration option.
  *  --config key=value: set system configuration option (since GDAL 3.9)
  *  --debug [on/off/value]: set debug level.
+ *  --io-stats: report I/O statistics of network file systems on exit
+ *              (since GDAL 3.10)
  *  --mempreload dir: preload directory contents into /vsimem
  *  --pause: Pause for user input (allows time to attach debugger)
  *  --locale [locale]: Install a locale using setlocale() (debugging)
@@ -3345,6 +3370,24 @@ int CPL_STDCALL GDALGeneralCmdLineProcessor(int nArgc, char ***ppapszArgv,
             iArg += 1;
         }
 
+        /* --------------------------------------------------------------------
+         */
+        /*      --io-stats */
+        /* --------------------------------------------------------------------
+         */
+        else if (EQUAL(papszArgv[iArg], "--io-stats"))
+        {
+            CPLSetConfigOption("CPL_VSIL_NETWORK_STATS_ENABLED", "YES");
+            // Make sure the option is taken into account
+            VSINetworkStatsReset();
+            static bool bRegistered = false;
+            if (!bRegistered)
+            {
+                bRegistered = true;
+                atexit(GDALPrintIOStatistics);
+            }
+        }
+
         /* --------------------------------------------------------------------
          */
         /*      --optfile */
@@ -3735,6 +3778,8 @@ int CPL_STDCALL GDALGeneralCmdLineProcessor(int nArgc, char ***ppapszArgv,
                    "  --config <key> <value> or --config <key>=<value>: set "
                    "system configuration option.\n");               /*ok*/
             printf("  --debug [on/off/value]: set debug level.\n"); /*ok*/
+            printf("  --io-stats: report I/O statistics of network file " /*ok*/
+                   "systems on exit.\n");
             /*ok*/ printf(                                          /*ok*/
                           "  --pause: wait for user input, time to attach "
                           "debugger\n");
@@ -3938,13 +3983,13 @@ GDALDataset *GDALFindAssociatedAuxFile(const char *pszBasename,
     GDALDataset *poODS = nullptr;
     GByte abyHeader[32];
 
-    VSILFILE *fp = VSIFOpenL(osAuxFilename, "rb");
+    VSILFILE *fp = GDALOpenSidecarFile(osAuxFilename);
 
     if (fp == nullptr && VSIIsCaseSensitiveFS(osAuxFilename))
     {
         // Can't found file with lower case suffix. Try the upper case one.
         osAuxFilename = CPLResetExtension(pszBasename, pszAuxSuffixUC);
-        fp = VSIFOpenL(osAuxFilename, "rb");
+        fp = GDALOpenSidecarFile(osAuxFilename);
     }
 
     if (fp != nullptr)
@@ -4037,14 +4082,14 @@ GDALDataset *GDALFindAssociatedAuxFile(const char *pszBasename,
         osAuxFilename = pszBasename;
         osAuxFilename += ".";
         osAuxFilename += pszAuxSuffixLC;
-        fp = VSIFOpenL(osAuxFilename, "rb");
+        fp = GDALOpenSidecarFile(osAuxFilename);
         if (fp == nullptr && VSIIsCaseSensitiveFS(osAuxFilename))
         {
             // Can't found file with lower case suffix. Try the upper case one.
             osAuxFilename = pszBasename;
             osAuxFilename += ".";
             osAuxFilename += pszAuxSuffixUC;
-            fp = VSIFOpenL(osAuxFilename, "rb");
+            fp = GDALOpenSidecarFile(osAuxFilename);
         }
 
         if (fp != nullptr)
@@ -4592,6 +4637,142 @@ bool GDALCanReliablyUseSiblingFileList(const char *pszFilename)
 #endif
 }
 
+/************************************************************************/
+/*                     Sidecar file negative cache                      */
+/************************************************************************/
+
+/* Opening a dataset probes for a number of sidecar files (.aux.xml, .aux,
+ * world files, .ovr, .msk) that generally do not exist. On network file
+ * systems, each probe is a request, so when the
+ * GDAL_SIDECAR_NEGATIVE_CACHE_TTL configuration option is set to a positive
+ * number of seconds, the sidecar files found to be missing are remembered,
+ * per directory, during that time, across datasets.
+ */
+
+namespace
+{
+struct GDALSidecarDirectoryCache
+{
+    std::chrono::steady_clock::time_point oCreationTime{};
+    std::set<std::string> aosMissingFiles{};
+};
+}  // namespace
+
+static std::mutex goSidecarCacheMutex;
+static std::map<std::string, GDALSidecarDirectoryCache> goSidecarCache;
+
+// Maximum number of directories remembered before the cache is reset
+constexpr size_t SIDECAR_CACHE_MAX_DIRECTORIES = 1000;
+
+static double GDALGetSidecarNegativeCacheTTL()
+{
+    const double dfTTL =
+        CPLAtof(CPLGetConfigOption("GDAL_SIDECAR_NEGATIVE_CACHE_TTL", "0"));
+    if (!(dfTTL > 0))
+    {
+        std::lock_guard<std::mutex> oLock(goSidecarCacheMutex);
+        goSidecarCache.clear();
+        return 0;
+    }
+    return dfTTL;
+}
+
+static bool GDALIsKnownMissingSidecarFile(const char *pszFilename,
+                                          double dfTTL)
+{
+    std::lock_guard<std::mutex> oLock(goSidecarCacheMutex);
+    const auto oIter = goSidecarCache.find(CPLGetPath(pszFilename));
+    if (oIter == goSidecarCache.end())
+        return false;
+    if (std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                      oIter->second.oCreationTime)
+            .count() > dfTTL)
+    {
+        goSidecarCache.erase(oIter);
+        return false;
+    }
+    return oIter->second.aosMissingFiles.count(CPLGetFilename(pszFilename)) >
+           0;
+}
+
+static void GDALRememberMissingSidecarFile(const char *pszFilename)
+{
+    std::lock_guard<std::mutex> oLock(goSidecarCacheMutex);
+    const std::string osDir(CPLGetPath(pszFilename));
+    auto oIter = goSidecarCache.find(osDir);
+    if (oIter == goSidecarCache.end())
+    {
+        if (goSidecarCache.size() >= SIDECAR_CACHE_MAX_DIRECTORIES)
+            goSidecarCache.clear();
+        oIter = goSidecarCache.emplace(osDir, GDALSidecarDirectoryCache())
+                    .first;
+        oIter->second.oCreationTime = std::chrono::steady_clock::now();
+    }
+    oIter->second.aosMissingFiles.insert(CPLGetFilename(pszFilename));
+}
+
+/************************************************************************/
+/*                        GDALStatSidecarFile()                         */
+/************************************************************************/
+
+/** Same as VSIStatExL(), but for sidecar files of a dataset, whose absence
+ * may be remembered according to GDAL_SIDECAR_NEGATIVE_CACHE_TTL.
+ */
+int GDALStatSidecarFile(const char *pszFilename, VSIStatBufL *psStatBuf,
+                        int nFlags)
+{
+    const double dfTTL = GDALGetSidecarNegativeCacheTTL();
+    if (dfTTL == 0)
+        return VSIStatExL(pszFilename, psStatBuf, nFlags);
+    if (GDALIsKnownMissingSidecarFile(pszFilename, dfTTL))
+        return -1;
+    const int nRet = VSIStatExL(pszFilename, psStatBuf, nFlags);
+    if (nRet != 0)
+        GDALRememberMissingSidecarFile(pszFilename);
+    return nRet;
+}
+
+/************************************************************************/
+/*                        GDALOpenSidecarFile()                         */
+/************************************************************************/
+
+/** Same as VSIFOpenL(pszFilename, "rb"), but for sidecar files of a dataset,
+ * whose absence may be remembered according to
+ * GDAL_SIDECAR_NEGATIVE_CACHE_TTL.
+ */
+VSILFILE *GDALOpenSidecarFile(const char *pszFilename)
+{
+    const double dfTTL = GDALGetSidecarNegativeCacheTTL();
+    if (dfTTL == 0)
+        return VSIFOpenL(pszFilename, "rb");
+    if (GDALIsKnownMissingSidecarFile(pszFilename, dfTTL))
+        return nullptr;
+    VSILFILE *fp = VSIFOpenL(pszFilename, "rb");
+    if (fp == nullptr)
+        GDALRememberMissingSidecarFile(pszFilename);
+    return fp;
+}
+
+/************************************************************************/
+/*                    GDALInvalidateSidecarFileCache()                  */
+/************************************************************************/
+
+/** Forget the sidecar files remembered as missing in the directory of
+ * pszFilename, or in all directories if pszFilename is nullptr.
+ *
+ * Must be called when GDAL creates a file that could be a sidecar file.
+ */
+void GDALInvalidateSidecarFileCache(const char *pszFilename)
+{
+    std::lock_guard<std::mutex> oLock(goSidecarCacheMutex);
+    if (goSidecarCache.empty())
+        return;
+    if (pszFilename == nullptr)
+        goSidecarCache.clear();
+    else
+        goSidecarCache.erase(CPLGetPath(pszFilename));
+}
+
 /************************************************************************/
 /*                    GDALAdjustNoDataCloseToFloatMax()                 */
 /************************************************************************/
@@ -51,6 +51,10 @@ class GDALProxyDataset;
 class GDALProxyRasterBand;
 class GDALAsyncReader;
 class GDALRelationship;
+//! @cond Doxygen_Suppress
+class GDALBlockPrefetcher;
+struct GDALRasterBandBlockStatistics;
+//! @endcond
 
 /* -------------------------------------------------------------------- */
 /*      Pull in the public declarations.  This gets the C apis, and     */
@@ -72,6 +76,7 @@ class GDALRelationship;
 
 #include <cmath>
 #include <cstdint>
+#include <future>
 #include <iterator>
 #include <limits>
 #include <map>
@@ -510,9 +515,17 @@ class CPL_DLL GDALDataset : public GDALMajorObject
     friend class GDALDefaultOverviews;
     friend class GDALProxyDataset;
     friend class GDALDriverManager;
+    friend class GDALRasterBlock;
 
     CPL_INTERNAL void AddToDatasetOpenList();
 
+    CPL_INTERNAL void AddToCacheUsed(GIntBig nDelta);
+    CPL_INTERNAL bool IsOverCacheBudget() const;
+    CPL_INTERNAL static bool IsAnyCacheBudgetSet();
+
+    CPL_INTERNAL void RegisterForWriteBehindFlushing();
+    CPL_INTERNAL bool IsRegisteredForWriteBehindFlushing() const;
+
     CPL_INTERNAL void UnregisterFromSharedDataset();
 
     CPL_INTERNAL static void ReportErrorV(const char *pszDSName,
@@ -606,6 +619,9 @@ class CPL_DLL GDALDataset : public GDALMajorObject
 
     void ShareLockWithParentDataset(GDALDataset *poParentDataset);
 
+    void EnableWriteBehindFlushing();
+    void DisableWriteBehindFlushing();
+
     //! @endcond
 
     void CleanupPostFileClosing();
@@ -700,6 +716,15 @@ class CPL_DLL GDALDataset : public GDALMajorObject
     virtual CPLErr FlushCache(bool bAtClosing = false);
     virtual CPLErr DropCache();
 
+    void SetCacheBudget(GIntBig nBudget);
+    GIntBig GetCacheBudget() const;
+    GIntBig GetCacheUsed() const;
+
+    //! @cond Doxygen_Suppress
+    CPL_INTERNAL static std::vector<std::pair<std::string, GIntBig>>
+    GetCacheUsedByOpenDatasets();
+    //! @endcond
+
     virtual GIntBig GetEstimatedRAMUsage();
 
     virtual const OGRSpatialReference *GetSpatialRef() const;
@@ -786,6 +811,14 @@ class CPL_DLL GDALDataset : public GDALMajorObject
                     GDALRasterIOExtraArg *psExtraArg) CPL_WARN_UNUSED_RESULT;
 #endif
 
+    std::future<CPLErr>
+    RasterIOAsync(int nXOff, int nYOff, int nXSize, int nYSize, void *pData,
+                  int nBufXSize, int nBufYSize, GDALDataType eBufType,
+                  int nBandCount, const int *panBandMap, GSpacing nPixelSpace,
+                  GSpacing nLineSpace, GSpacing nBandSpace,
+                  const GDALRasterIOExtraArg *psExtraArg = nullptr);
+    void WaitForRasterIOAsync();
+
     virtual CPLStringList GetCompressionFormats(int nXOff, int nYOff,
                                                 int nXSize, int nYSize,
                                                 int nBandCount,
@@ -822,6 +855,8 @@ class CPL_DLL GDALDataset : public GDALMajorObject
         return bSuppressOnClose;
     }
 
+    virtual bool IsThreadSafe(int nScopeFlags) const;
+
     /** Return open options.
      * @return open options.
      */
@@ -1130,6 +1165,7 @@ class CPL_DLL GDALDataset : public GDALMajorObject
     //! @cond Doxygen_Suppress
     OGRErr ProcessSQLCreateIndex(const char *);
     OGRErr ProcessSQLDropIndex(const char *);
+    OGRErr ProcessSQLCreateDropSpatialIndex(const char *, bool bCreate);
     OGRErr ProcessSQLDropTable(const char *);
     OGRErr ProcessSQLAlterTableAddColumn(const char *);
     OGRErr ProcessSQLAlterTableDropColumn(const char *);
@@ -1213,6 +1249,9 @@ class CPL_DLL GDALRasterBlock
 
     CPL_INTERNAL void RecycleFor(int nXOffIn, int nYOffIn);
 
+    CPL_INTERNAL static int FlushDirtyBlocksOfDataset(GDALDataset *poDS);
+    CPL_INTERNAL static void WriteBehindThreadFunc();
+
   public:
     GDALRasterBlock(GDALRasterBand *, int, int);
     GDALRasterBlock(int nXOffIn, int nYOffIn); /* only for lookup purpose */
@@ -1330,12 +1369,78 @@ class CPL_DLL GDALRasterBlock
     /* Should only be called by GDALDestroyDriverManager() */
     //! @cond Doxygen_Suppress
     CPL_INTERNAL static void DestroyRBMutex();
+
+    /* Should only be called by GDALDataset */
+    CPL_INTERNAL static void RegisterWriteBehindDataset(GDALDataset *poDS);
+    CPL_INTERNAL static void UnregisterWriteBehindDataset(GDALDataset *poDS);
     //! @endcond
 
   private:
     CPL_DISALLOW_COPY_ASSIGN(GDALRasterBlock)
 };
 
+/* ******************************************************************** */
+/*                         GDALRasterBlockView                          */
+/* ******************************************************************** */
+
+/** Read-only view on the data of a block of the block cache.
+ *
+ * Instances are returned by GDALRasterBand::GetBlockView(). The underlying
+ * block is kept locked in the block cache, and thus its data pointer remains
+ * valid, as long as at least one copy of the view is alive. All copies of
+ * a view must be destroyed before the band is flushed or destroyed.
+ *
+ * @since GDAL 3.10
+ */
+class CPL_DLL GDALRasterBlockView
+{
+    friend class GDALRasterBand;
+
+    std::shared_ptr<GDALRasterBlock> m_poBlock{};
+
+    CPL_INTERNAL explicit GDALRasterBlockView(GDALRasterBlock *poLockedBlock);
+
+  public:
+    /** Construct an empty (invalid) view. */
+    GDALRasterBlockView() = default;
+
+    /** Return whether the view points to a block. */
+    explicit operator bool() const
+    {
+        return m_poBlock != nullptr;
+    }
+
+    /** Return a pointer to the block data, or nullptr for an empty view.
+     *
+     * The data is organized as GetXSize() * GetYSize() pixels of type
+     * GetDataType(), packed in row-major order. For partial blocks at the
+     * right or bottom edge of the raster, only the part of the block that
+     * intersects the raster is meaningful.
+     */
+    const void *GetData() const
+    {
+        return m_poBlock ? m_poBlock->GetDataRef() : nullptr;
+    }
+
+    /** Return the data type of the pixels of the block. */
+    GDALDataType GetDataType() const
+    {
+        return m_poBlock ? m_poBlock->GetDataType() : GDT_Unknown;
+    }
+
+    /** Return the width of the block, in pixels. */
+    int GetXSize() const
+    {
+        return m_poBlock ? m_poBlock->GetXSize() : 0;
+    }
+
+    /** Return the height of the block, in pixels. */
+    int GetYSize() const
+    {
+        return m_poBlock ? m_poBlock->GetYSize() : 0;
+    }
+};
+
 /* ******************************************************************** */
 /*                             GDALColorTable                           */
 /* ******************************************************************** */
@@ -1508,8 +1613,13 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
 
     CPLErr eFlushBlockErr = CE_None;
     GDALAbstractBandBlockCache *poBandBlockCache = nullptr;
+    GDALBlockPrefetcher *m_poPrefetcher = nullptr;
+    bool m_bPrefetcherChecked = false;
+    GDALRasterBandBlockStatistics *m_poBlockStatistics = nullptr;
 
     CPL_INTERNAL void SetFlushBlockErr(CPLErr eErr);
+    CPL_INTERNAL void InvalidateBlockStatistics(int nXOff, int nYOff,
+                                                int nXSize, int nYSize);
     CPL_INTERNAL CPLErr UnreferenceBlock(GDALRasterBlock *poBlock);
     CPL_INTERNAL void IncDirtyBlocks(int nInc);
 
@@ -1606,6 +1716,8 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
   protected:
     virtual CPLErr IReadBlock(int nBlockXOff, int nBlockYOff, void *pData) = 0;
     virtual CPLErr IWriteBlock(int nBlockXOff, int nBlockYOff, void *pData);
+    virtual CPLErr IReadBlocks(int nBlockCount, const int *panXBlockOff,
+                               const int *panYBlockOff, void *const *papData);
 
     virtual CPLErr
     IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
@@ -1685,6 +1797,21 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
     CPLErr ReadBlock(int nXBlockOff, int nYBlockOff,
                      void *pImage) CPL_WARN_UNUSED_RESULT;
 
+    CPLErr ReadBlocks(int nBlockCount, const int *panXBlockOff,
+                      const int *panYBlockOff,
+                      void *const *papImages) CPL_WARN_UNUSED_RESULT;
+
+    CPLErr SamplePoints(size_t nPointCount, const double *padfX,
+                        const double *padfY, GDALRIOResampleAlg eResampleAlg,
+                        void *pData,
+                        GDALDataType eBufType) CPL_WARN_UNUSED_RESULT;
+
+    CPLErr ReadWindows(int nWindowCount, const int *panWindows, void *pData,
+                       int nBufXSize, int nBufYSize, GDALDataType eBufType,
+                       GSpacing nPixelSpace, GSpacing nLineSpace,
+                       GSpacing nWindowSpace,
+                       GDALRIOResampleAlg eResampleAlg) CPL_WARN_UNUSED_RESULT;
+
     CPLErr WriteBlock(int nXBlockOff, int nYBlockOff,
                       void *pImage) CPL_WARN_UNUSED_RESULT;
 
@@ -1693,6 +1820,8 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
                       int bJustInitialize = FALSE) CPL_WARN_UNUSED_RESULT;
     GDALRasterBlock *TryGetLockedBlockRef(int nXBlockOff, int nYBlockYOff)
         CPL_WARN_UNUSED_RESULT;
+    GDALRasterBlockView GetBlockView(int nXBlockOff,
+                                     int nYBlockOff) CPL_WARN_UNUSED_RESULT;
     CPLErr FlushBlock(int nXBlockOff, int nYBlockOff,
                       int bWriteDirtyBlock = TRUE);
 
@@ -1795,6 +1924,9 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
 
     std::shared_ptr<GDALMDArray> AsMDArray() const;
 
+    bool GetArrowStream(struct ArrowArrayStream *out_stream,
+                        CSLConstList papszOptions = nullptr);
+
 #ifndef DOXYGEN_XML
     void ReportError(CPLErr eErrClass, CPLErrorNum err_no, const char *fmt, ...)
         CPL_PRINT_FUNC_FORMAT(4, 5);
@@ -2195,6 +2327,8 @@ class CPL_DLL GDALDriver : public GDALMajorObject
     CPLErr QuietDeleteForCreateCopy(const char *pszFilename,
                                     GDALDataset *poSrcDS);
 
+    bool HeaderMatchesMagicBytes(const GDALOpenInfo *poOpenInfo) const;
+
     //! @endcond
     static CPLErr QuietDelete(const char *pszName,
                               CSLConstList papszAllowedDrivers = nullptr);
@@ -2226,6 +2360,9 @@ class CPL_DLL GDALDriver : public GDALMajorObject
     }
 
   private:
+    // Decoded GDAL_DMD_MAGIC_BYTES signatures
+    std::vector<std::vector<GByte>> m_aabyMagicBytes{};
+
     CPL_DISALLOW_COPY_ASSIGN(GDALDriver)
 };
 
@@ -2278,6 +2415,9 @@ class GDALPluginDriverProxy : public GDALDriver
     std::string m_osPluginFullPath{};
     std::unique_ptr<GDALDriver> m_poRealDriver{};
     std::set<std::string> m_oSetMetadataItems{};
+    // Registration function of a driver built in libgdal, for proxies
+    // declared with GDALDriverManager::DeclareDeferredBuiltinDriver()
+    void (*m_pfnBuiltinRegister)() = nullptr;
 
     GDALDriver *GetRealDriver();
 
@@ -2351,6 +2491,7 @@ class CPL_DLL GDALDriverManager : public GDALMajorObject
     bool m_bInDeferredDriverLoading = false;
     std::map<std::string, std::unique_ptr<GDALDriver>> m_oMapRealDrivers{};
     std::vector<std::unique_ptr<GDALDriver>> m_aoHiddenDrivers{};
+    void (*m_pfnPendingBuiltinRegister)() = nullptr;
 
     GDALDriver *GetDriver_unlocked(int iDriver)
     {
@@ -2405,6 +2546,11 @@ class CPL_DLL GDALDriverManager : public GDALMajorObject
 
     void DeclareDeferredPluginDriver(GDALPluginDriverProxy *poProxyDriver);
 
+    //! @cond Doxygen_Suppress
+    void DeclareDeferredBuiltinDriver(void (*pfnDeclare)(),
+                                      void (*pfnRegister)());
+    //! @endcond
+
     //! @cond Doxygen_Suppress
     int GetDriverCount(bool bIncludeHidden) const;
     GDALDriver *GetDriver(int iDriver, bool bIncludeHidden);
@@ -4312,6 +4458,11 @@ void GDALRasterIOExtraArgSetResampleAlg(GDALRasterIOExtraArg *psExtraArg,
 GDALDataset *GDALCreateOverviewDataset(GDALDataset *poDS, int nOvrLevel,
                                        bool bThisLevelOnly);
 
+std::unique_ptr<GDALDataset>
+GDALCreateThreadSafeDataset(std::unique_ptr<GDALDataset> poPrototypeDS,
+                            const char *pszFilename, unsigned int nOpenFlags,
+                            CSLConstList papszOpenOptions);
+
 // Should cover particular cases of #3573, #4183, #4506, #6578
 // Behavior is undefined if fVal1 or fVal2 are NaN (should be tested before
 // calling this function)
@@ -4345,6 +4496,11 @@ int GDALCanFileAcceptSidecarFile(const char *pszFilename);
 
 bool GDALCanReliablyUseSiblingFileList(const char *pszFilename);
 
+int CPL_DLL GDALStatSidecarFile(const char *pszFilename,
+                                VSIStatBufL *psStatBuf, int nFlags);
+VSILFILE CPL_DLL *GDALOpenSidecarFile(const char *pszFilename);
+void CPL_DLL GDALInvalidateSidecarFileCache(const char *pszFilename);
+
 typedef enum
 {
     GSF_UNSIGNED_INT,
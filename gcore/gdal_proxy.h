@@ -125,6 +125,7 @@ class CPL_DLL GDALProxyRasterBand : public GDALRasterBand
 
     CPLErr IReadBlock(int, int, void *) override;
     CPLErr IWriteBlock(int, int, void *) override;
+    CPLErr IReadBlocks(int, const int *, const int *, void *const *) override;
     CPLErr IRasterIO(GDALRWFlag, int, int, int, int, void *, int, int,
                      GDALDataType, GSpacing, GSpacing,
                      GDALRasterIOExtraArg *psExtraArg) override;
@@ -37,6 +37,7 @@
 #include <cstdlib>
 
 #include <algorithm>
+#include <limits>
 #include <vector>
 
 #include "cpl_conv.h"
@@ -1661,6 +1662,7 @@ void GDALDefaultRasterAttributeTable::SetRowCount(int nNewCount)
     }
 
     nRowCount = nNewCount;
+    InvalidateRowOfValueIndex();
 }
 
 /************************************************************************/
@@ -1694,6 +1696,9 @@ void GDALDefaultRasterAttributeTable::SetValue(int iRow, int iField,
         return;
     }
 
+    if (iField == nMinCol || iField == nMaxCol)
+        InvalidateRowOfValueIndex();
+
     switch (aoFields[iField].eType)
     {
         case GFT_Integer:
@@ -1760,6 +1765,9 @@ void GDALDefaultRasterAttributeTable::SetValue(int iRow, int iField, int nValue)
         return;
     }
 
+    if (iField == nMinCol || iField == nMaxCol)
+        InvalidateRowOfValueIndex();
+
     switch (aoFields[iField].eType)
     {
         case GFT_Integer:
@@ -1826,6 +1834,9 @@ void GDALDefaultRasterAttributeTable::SetValue(int iRow, int iField,
         return;
     }
 
+    if (iField == nMinCol || iField == nMaxCol)
+        InvalidateRowOfValueIndex();
+
     switch (aoFields[iField].eType)
     {
         case GFT_Integer:
@@ -1896,6 +1907,142 @@ int CPL_STDCALL GDALRATChangesAreWrittenToFile(GDALRasterAttributeTableH hRAT)
         ->ChangesAreWrittenToFile();
 }
 
+/************************************************************************/
+/*                    GDALRATGetFieldValueAsDouble()                    */
+/************************************************************************/
+
+static double
+GDALRATGetFieldValueAsDouble(const GDALRasterAttributeField &oField, int iRow)
+{
+    return oField.eType == GFT_Integer ? oField.anValues[iRow]
+                                       : oField.adfValues[iRow];
+}
+
+/************************************************************************/
+/*                     InvalidateRowOfValueIndex()                      */
+/************************************************************************/
+
+void GDALDefaultRasterAttributeTable::InvalidateRowOfValueIndex()
+{
+    m_eRowOfValueIndex = RowOfValueIndex::NOT_BUILT;
+    m_adfRowOfValueKeys.clear();
+    m_anRowOfValueRows.clear();
+    m_nFirstRowMatchingAnyValue = -1;
+}
+
+/************************************************************************/
+/*                        BuildRowOfValueIndex()                        */
+/*                                                                      */
+/*      Build an index giving the same result as the linear search      */
+/*      of GetRowOfValue(), i.e. the first row such that                */
+/*      min <= value <= max, in O(log(nRowCount)).                      */
+/************************************************************************/
+
+void GDALDefaultRasterAttributeTable::BuildRowOfValueIndex() const
+{
+    m_eRowOfValueIndex = RowOfValueIndex::LINEAR_SEARCH;
+
+    // String columns are ignored by the search
+    const auto IsNumeric = [this](int iCol)
+    {
+        return iCol >= 0 && (aoFields[iCol].eType == GFT_Integer ||
+                             aoFields[iCol].eType == GFT_Real);
+    };
+    const bool bHasMin = IsNumeric(nMinCol);
+    const bool bHasMax = IsNumeric(nMaxCol);
+    if (!bHasMin && !bHasMax)
+        return;
+
+    try
+    {
+        if (bHasMin && bHasMax && nMinCol == nMaxCol)
+        {
+            // A row matches when its value is equal to the searched one,
+            // or, with NaN, always.
+            const auto &oField = aoFields[nMinCol];
+            std::vector<std::pair<double, int>> aoPairs;
+            aoPairs.reserve(nRowCount);
+            for (int iRow = 0; iRow < nRowCount; ++iRow)
+            {
+                const double dfVal = GDALRATGetFieldValueAsDouble(oField, iRow);
+                if (std::isnan(dfVal))
+                {
+                    if (m_nFirstRowMatchingAnyValue < 0)
+                        m_nFirstRowMatchingAnyValue = iRow;
+                }
+                else
+                {
+                    aoPairs.emplace_back(dfVal, iRow);
+                }
+            }
+            // Sorting on (value, row) puts the first row of each value first
+            std::sort(aoPairs.begin(), aoPairs.end());
+            for (const auto &oPair : aoPairs)
+            {
+                if (m_adfRowOfValueKeys.empty() ||
+                    m_adfRowOfValueKeys.back() != oPair.first)
+                {
+                    m_adfRowOfValueKeys.push_back(oPair.first);
+                    m_anRowOfValueRows.push_back(oPair.second);
+                }
+            }
+            m_eRowOfValueIndex = RowOfValueIndex::VALUE_TO_ROW;
+        }
+        else if (bHasMin && bHasMax)
+        {
+            // Only handle ranges sorted in increasing order without overlap
+            const auto &oMinField = aoFields[nMinCol];
+            const auto &oMaxField = aoFields[nMaxCol];
+            m_adfRowOfValueKeys.resize(nRowCount);
+            double dfPrevMax = -std::numeric_limits<double>::infinity();
+            for (int iRow = 0; iRow < nRowCount; ++iRow)
+            {
+                const double dfMin =
+                    GDALRATGetFieldValueAsDouble(oMinField, iRow);
+                const double dfMax =
+                    GDALRATGetFieldValueAsDouble(oMaxField, iRow);
+                if (!(dfPrevMax < dfMin && dfMin <= dfMax))
+                {
+                    m_adfRowOfValueKeys.clear();
+                    return;
+                }
+                m_adfRowOfValueKeys[iRow] = dfMin;
+                dfPrevMax = dfMax;
+            }
+            m_eRowOfValueIndex = RowOfValueIndex::SORTED_RANGES;
+        }
+        else
+        {
+            // With a single bound, the first matching row is the first one
+            // where the running minimum (resp. maximum) of the bound
+            // reaches the value. A NaN bound matches any value.
+            const auto &oField = aoFields[bHasMin ? nMinCol : nMaxCol];
+            constexpr double INF = std::numeric_limits<double>::infinity();
+            m_adfRowOfValueKeys.resize(nRowCount);
+            double dfRunning = bHasMin ? INF : -INF;
+            for (int iRow = 0; iRow < nRowCount; ++iRow)
+            {
+                double dfVal = GDALRATGetFieldValueAsDouble(oField, iRow);
+                if (std::isnan(dfVal))
+                    dfVal = bHasMin ? -INF : INF;
+                dfRunning = bHasMin ? std::min(dfRunning, dfVal)
+                                    : std::max(dfRunning, dfVal);
+                m_adfRowOfValueKeys[iRow] = dfRunning;
+            }
+            m_eRowOfValueIndex = bHasMin ? RowOfValueIndex::PREFIX_MIN
+                                         : RowOfValueIndex::PREFIX_MAX;
+        }
+    }
+    catch (const std::exception &)
+    {
+        // Out of memory: fallback to linear search
+        m_eRowOfValueIndex = RowOfValueIndex::LINEAR_SEARCH;
+        m_adfRowOfValueKeys.clear();
+        m_anRowOfValueRows.clear();
+        m_nFirstRowMatchingAnyValue = -1;
+    }
+}
+
 /************************************************************************/
 /*                           GetRowOfValue()                            */
 /************************************************************************/
@@ -1925,6 +2072,78 @@ int GDALDefaultRasterAttributeTable::GetRowOfValue(double dfValue) const
     if (nMinCol == -1 && nMaxCol == -1)
         return -1;
 
+    if (m_eRowOfValueIndex == RowOfValueIndex::NOT_BUILT)
+        BuildRowOfValueIndex();
+
+    // Comparisons with NaN are always false, so the first row matches.
+    if (std::isnan(dfValue))
+        return nRowCount > 0 ? 0 : -1;
+
+    switch (m_eRowOfValueIndex)
+    {
+        case RowOfValueIndex::NOT_BUILT:
+        case RowOfValueIndex::LINEAR_SEARCH:
+            break;
+
+        case RowOfValueIndex::VALUE_TO_ROW:
+        {
+            int iRow = m_nFirstRowMatchingAnyValue;
+            const auto oIter =
+                std::lower_bound(m_adfRowOfValueKeys.begin(),
+                                 m_adfRowOfValueKeys.end(), dfValue);
+            if (oIter != m_adfRowOfValueKeys.end() && *oIter == dfValue)
+            {
+                const int iValueRow = m_anRowOfValueRows[static_cast<size_t>(
+                    oIter - m_adfRowOfValueKeys.begin())];
+                if (iRow < 0 || iValueRow < iRow)
+                    iRow = iValueRow;
+            }
+            return iRow;
+        }
+
+        case RowOfValueIndex::SORTED_RANGES:
+        {
+            // Last row whose minimum is lower or equal to dfValue
+            const auto oIter =
+                std::upper_bound(m_adfRowOfValueKeys.begin(),
+                                 m_adfRowOfValueKeys.end(), dfValue);
+            if (oIter == m_adfRowOfValueKeys.begin())
+                return -1;
+            const int iRow =
+                static_cast<int>(oIter - m_adfRowOfValueKeys.begin()) - 1;
+            return dfValue <= GDALRATGetFieldValueAsDouble(aoFields[nMaxCol],
+                                                           iRow)
+                       ? iRow
+                       : -1;
+        }
+
+        case RowOfValueIndex::PREFIX_MIN:
+        {
+            // Keys are non-increasing: first row where the running minimum
+            // is lower or equal to dfValue.
+            const auto oIter =
+                std::lower_bound(m_adfRowOfValueKeys.begin(),
+                                 m_adfRowOfValueKeys.end(), dfValue,
+                                 [](double dfKey, double dfVal)
+                                 { return dfKey > dfVal; });
+            if (oIter == m_adfRowOfValueKeys.end())
+                return -1;
+            return static_cast<int>(oIter - m_adfRowOfValueKeys.begin());
+        }
+
+        case RowOfValueIndex::PREFIX_MAX:
+        {
+            // Keys are non-decreasing: first row where the running maximum
+            // is greater or equal to dfValue.
+            const auto oIter =
+                std::lower_bound(m_adfRowOfValueKeys.begin(),
+                                 m_adfRowOfValueKeys.end(), dfValue);
+            if (oIter == m_adfRowOfValueKeys.end())
+                return -1;
+            return static_cast<int>(oIter - m_adfRowOfValueKeys.begin());
+        }
+    }
+
     const GDALRasterAttributeField *poMin = nullptr;
     if (nMinCol != -1)
         poMin = &(aoFields[nMinCol]);
@@ -2096,6 +2315,9 @@ GDALDefaultRasterAttributeTable::CreateColumn(const char *pszFieldName,
     else if (eFieldType == GFT_String)
         aoFields[iNewField].aosValues.resize(nRowCount);
 
+    bColumnsAnalysed = false;
+    InvalidateRowOfValueIndex();
+
     return CE_None;
 }
 
@@ -2148,6 +2370,8 @@ void GDALDefaultRasterAttributeTable::RemoveStatistics()
         }
     }
     aoFields = std::move(aoNewFields);
+    bColumnsAnalysed = false;
+    InvalidateRowOfValueIndex();
 }
 
 /************************************************************************/
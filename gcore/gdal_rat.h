@@ -362,6 +362,24 @@ class CPL_DLL GDALDefaultRasterAttributeTable : public GDALRasterAttributeTable
 
     CPLString osWorkingResult{};
 
+    // Index used by GetRowOfValue(), built on first use
+    enum class RowOfValueIndex
+    {
+        NOT_BUILT,
+        LINEAR_SEARCH,   // no index, linear search on rows
+        VALUE_TO_ROW,    // single GFU_MinMax column: sorted distinct values
+        SORTED_RANGES,   // sorted and disjoint [min, max] ranges
+        PREFIX_MIN,      // only a Min column: running minimum of it
+        PREFIX_MAX,      // only a Max column: running maximum of it
+    };
+    mutable RowOfValueIndex m_eRowOfValueIndex = RowOfValueIndex::NOT_BUILT;
+    mutable std::vector<double> m_adfRowOfValueKeys{};
+    mutable std::vector<int> m_anRowOfValueRows{};
+    mutable int m_nFirstRowMatchingAnyValue = -1;
+
+    void BuildRowOfValueIndex() const;
+    void InvalidateRowOfValueIndex();
+
   public:
     GDALDefaultRasterAttributeTable();
     ~GDALDefaultRasterAttributeTable() override;
@@ -28,6 +28,11 @@
 
 #include "gdal_thread_pool.h"
 
+#include "cpl_conv.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
 #include <mutex>
 
 // For unclear reasons, attempts at making this a std::unique_ptr<>, even
@@ -42,8 +47,53 @@ static std::mutex &GetMutexThreadPool()
     return gMutexThreadPool;
 }
 
+/************************************************************************/
+/*                       GDALGetMaxTotalThreads()                       */
+/************************************************************************/
+
+/** Return the maximum number of worker threads of the global thread pool,
+ * as set by the GDAL_MAX_TOTAL_THREADS configuration option, or INT_MAX if
+ * it is not set.
+ */
+int GDALGetMaxTotalThreads()
+{
+    const char *pszValue = CPLGetConfigOption("GDAL_MAX_TOTAL_THREADS", "");
+    if (pszValue[0] == '\0')
+        return INT_MAX;
+    if (EQUAL(pszValue, "ALL_CPUS"))
+        return CPLGetNumCPUs();
+    return std::max(1, atoi(pszValue));
+}
+
+/************************************************************************/
+/*                         GDALCapThreadCount()                         */
+/************************************************************************/
+
+/** Return nThreads capped to GDALGetMaxTotalThreads().
+ *
+ * To be used by components that size their work splitting, or a private
+ * thread pool, on a requested number of threads.
+ */
+int GDALCapThreadCount(int nThreads)
+{
+    return std::min(nThreads, GDALGetMaxTotalThreads());
+}
+
+/************************************************************************/
+/*                      GDALGetGlobalThreadPool()                       */
+/************************************************************************/
+
+/** Return the process-wide thread pool, with at least nThreads threads,
+ * within the limit of GDAL_MAX_TOTAL_THREADS.
+ *
+ * Jobs submitted from a worker thread of this pool, while no other worker
+ * is available, are run synchronously. Consequently nested uses of the
+ * pool, for example GeoTIFF decoding from a warping job, do not create
+ * additional threads.
+ */
 CPLWorkerThreadPool *GDALGetGlobalThreadPool(int nThreads)
 {
+    nThreads = GDALCapThreadCount(nThreads);
     std::lock_guard oGuard(GetMutexThreadPool());
     if (gpoCompressThreadPool == nullptr)
     {
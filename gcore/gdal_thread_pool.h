@@ -33,6 +33,10 @@
 
 CPLWorkerThreadPool CPL_DLL *GDALGetGlobalThreadPool(int nThreads);
 
+int CPL_DLL GDALGetMaxTotalThreads();
+
+int CPL_DLL GDALCapThreadCount(int nThreads);
+
 void GDALDestroyGlobalThreadPool();
 
 #endif  // GDAL_THREAD_POOL_H
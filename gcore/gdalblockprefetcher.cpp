@@ -0,0 +1,497 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  Prefetching of raster blocks driven by the access pattern
+ * Author:   agent, <agent at local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent at local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "gdalblockprefetcher.h"
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "gdal_priv.h"
+#include "gdal_thread_pool.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+//! @cond Doxygen_Suppress
+
+// Number of consecutive block reads after which the access pattern is
+// considered as being sequential.
+constexpr int SEQUENTIAL_READS_THRESHOLD = 2;
+
+// Maximum number of blocks that can be prefetched.
+constexpr int MAX_PREFETCH_BLOCKS = 1024;
+
+namespace
+{
+struct GDALBlockPrefetcherJob
+{
+    GDALBlockPrefetcher *poPrefetcher;
+    GIntBig nFirstBlockId;
+    int nCount;
+};
+}  // namespace
+
+/************************************************************************/
+/*                        GDALBlockPrefetcher()                         */
+/************************************************************************/
+
+GDALBlockPrefetcher::GDALBlockPrefetcher(
+    GDALRasterBand *poBand, int nBlockXSize, int nBlockYSize,
+    int nPrefetchCount, std::unique_ptr<CPLJobQueue> &&poJobQueue)
+    : m_nBand(poBand->GetBand()), m_nRasterXSize(poBand->GetXSize()),
+      m_nRasterYSize(poBand->GetYSize()),
+      m_nBlockXSize(nBlockXSize), m_nBlockYSize(nBlockYSize),
+      m_nBlocksPerRow(DIV_ROUND_UP(m_nRasterXSize, m_nBlockXSize)),
+      m_nTotalBlocks(static_cast<GIntBig>(m_nBlocksPerRow) *
+                     DIV_ROUND_UP(m_nRasterYSize, m_nBlockYSize)),
+      m_eDataType(poBand->GetRasterDataType()),
+      m_nBlockSizeBytes(static_cast<size_t>(m_nBlockXSize) * m_nBlockYSize *
+                        GDALGetDataTypeSizeBytes(m_eDataType)),
+      m_nPrefetchCount(nPrefetchCount),
+      m_osFilename(poBand->GetDataset()->GetDescription()),
+      m_osDriverName(poBand->GetDataset()->GetDriver()->GetDescription()),
+      m_aosOpenOptions(CSLDuplicate(poBand->GetDataset()->GetOpenOptions())),
+      m_poJobQueue(std::move(poJobQueue))
+{
+}
+
+/************************************************************************/
+/*                       ~GDALBlockPrefetcher()                         */
+/************************************************************************/
+
+GDALBlockPrefetcher::~GDALBlockPrefetcher()
+{
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        m_bStop = true;
+    }
+    m_poJobQueue->WaitCompletion();
+    m_poJobQueue.reset();
+    if (m_poWorkerDS)
+        GDALClose(m_poWorkerDS);
+}
+
+/************************************************************************/
+/*                              Create()                                */
+/************************************************************************/
+
+/** Instantiate a prefetcher for the band, if the GDAL_PREFETCH_BLOCKS
+ * configuration option is set, and if the band is compatible with it.
+ *
+ * @return a new object, or nullptr.
+ */
+GDALBlockPrefetcher *GDALBlockPrefetcher::Create(GDALRasterBand *poBand)
+{
+    int nPrefetchCount =
+        atoi(CPLGetConfigOption("GDAL_PREFETCH_BLOCKS", "0"));
+    if (nPrefetchCount <= 0)
+        return nullptr;
+    nPrefetchCount = std::min(nPrefetchCount, MAX_PREFETCH_BLOCKS);
+
+    GDALDataset *poDS = poBand->GetDataset();
+    const int nBand = poBand->GetBand();
+    if (poDS == nullptr || nBand <= 0 || poDS->GetAccess() != GA_ReadOnly ||
+        poBand->GetAccess() != GA_ReadOnly ||
+        poDS->GetRasterBand(nBand) != poBand)
+    {
+        return nullptr;
+    }
+
+    GDALDriver *poDriver = poDS->GetDriver();
+    if (poDriver == nullptr ||
+        !CPLTestBool(CSLFetchNameValueDef(poDriver->GetMetadata(),
+                                          GDAL_DCAP_INDEPENDENT_BLOCK_READS,
+                                          "NO")))
+    {
+        return nullptr;
+    }
+
+    // The worker thread re-opens the dataset. This is not possible for
+    // standard input or streaming file systems.
+    const char *pszFilename = poDS->GetDescription();
+    if (pszFilename[0] == '\0' || STARTS_WITH(pszFilename, "/vsistdin/") ||
+        (STARTS_WITH(pszFilename, "/vsi") &&
+         strstr(pszFilename, "_streaming/") != nullptr))
+    {
+        return nullptr;
+    }
+
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    const int nDTSize =
+        GDALGetDataTypeSizeBytes(poBand->GetRasterDataType());
+    if (nBlockXSize <= 0 || nBlockYSize <= 0 || nDTSize == 0 ||
+        nBlockXSize > std::numeric_limits<int>::max() / nDTSize / nBlockYSize)
+    {
+        return nullptr;
+    }
+    const int nBlocksPerRow = DIV_ROUND_UP(poBand->GetXSize(), nBlockXSize);
+    const int nBlocksPerColumn =
+        DIV_ROUND_UP(poBand->GetYSize(), nBlockYSize);
+    if (static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn <=
+        SEQUENTIAL_READS_THRESHOLD + 1)
+    {
+        return nullptr;
+    }
+
+    // Do not let prefetched blocks use more than a quarter of the block
+    // cache.
+    const GIntBig nBlockSizeBytes =
+        static_cast<GIntBig>(nBlockXSize) * nBlockYSize * nDTSize;
+    const GIntBig nMaxCount = GDALGetCacheMax64() / 4 / nBlockSizeBytes;
+    if (nMaxCount < nPrefetchCount)
+    {
+        if (nMaxCount < 1)
+            return nullptr;
+        nPrefetchCount = static_cast<int>(nMaxCount);
+    }
+
+    CPLWorkerThreadPool *poThreadPool =
+        GDALGetGlobalThreadPool(CPLGetNumCPUs());
+    if (poThreadPool == nullptr)
+        return nullptr;
+    auto poJobQueue = poThreadPool->CreateJobQueue();
+
+    CPLDebug("GDAL", "Prefetching up to %d blocks of band %d of %s",
+             nPrefetchCount, nBand, pszFilename);
+
+    return new GDALBlockPrefetcher(poBand, nBlockXSize, nBlockYSize,
+                                   nPrefetchCount, std::move(poJobQueue));
+}
+
+/************************************************************************/
+/*                            FetchBlock()                              */
+/************************************************************************/
+
+/** Copy the content of a prefetched block into pData.
+ *
+ * If the block is being read by the worker thread, this waits for the
+ * read to be completed.
+ *
+ * @return true if pData has been filled, false if the caller must read the
+ * block itself.
+ */
+bool GDALBlockPrefetcher::FetchBlock(int nXBlockOff, int nYBlockOff,
+                                     void *pData)
+{
+    const GIntBig nBlockId =
+        static_cast<GIntBig>(nYBlockOff) * m_nBlocksPerRow + nXBlockOff;
+
+    // Only wait for blocks whose read is in progress, not for jobs still
+    // queued: the caller might itself be running in the global thread pool.
+    std::unique_lock<std::mutex> oLock(m_oMutex);
+    m_oCV.wait(oLock,
+               [this, nBlockId]
+               {
+                   return nBlockId < m_nRunningFirstBlockId ||
+                          nBlockId >= m_nRunningEndBlockId;
+               });
+
+    auto oIter = m_oMapReadyBlocks.find(nBlockId);
+    if (oIter == m_oMapReadyBlocks.end())
+        return false;
+    memcpy(pData, oIter->second.data(), m_nBlockSizeBytes);
+    m_oMapReadyBlocks.erase(oIter);
+    return true;
+}
+
+/************************************************************************/
+/*                          NotifyBlockRead()                           */
+/************************************************************************/
+
+/** Record that a block has been read, and schedule the read of the next
+ * blocks if a sequential access pattern is detected.
+ */
+void GDALBlockPrefetcher::NotifyBlockRead(int nXBlockOff, int nYBlockOff)
+{
+    const GIntBig nBlockId =
+        static_cast<GIntBig>(nYBlockOff) * m_nBlocksPerRow + nXBlockOff;
+
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    if (m_bFailed || m_bStop)
+        return;
+
+    if (nBlockId == m_nLastReadBlockId + 1)
+    {
+        ++m_nSequentialReads;
+    }
+    else
+    {
+        // Sequential scan broken: discard what has been prefetched.
+        m_nSequentialReads = 0;
+        m_oMapReadyBlocks.clear();
+        m_nLastScheduledBlockId = nBlockId;
+    }
+    m_nLastReadBlockId = nBlockId;
+
+    // Blocks before the current one will not be requested by a sequential
+    // reader.
+    m_oMapReadyBlocks.erase(m_oMapReadyBlocks.begin(),
+                            m_oMapReadyBlocks.upper_bound(nBlockId));
+
+    if (m_nSequentialReads < SEQUENTIAL_READS_THRESHOLD)
+        return;
+
+    // Only schedule a new batch once half of the previous one is consumed.
+    m_nLastScheduledBlockId = std::max(m_nLastScheduledBlockId, nBlockId);
+    if (m_nLastScheduledBlockId - nBlockId > m_nPrefetchCount / 2)
+        return;
+
+    const GIntBig nFirstBlockId = m_nLastScheduledBlockId + 1;
+    const GIntBig nLastBlockId =
+        std::min(nBlockId + m_nPrefetchCount, m_nTotalBlocks - 1);
+    if (nFirstBlockId > nLastBlockId)
+        return;
+
+    auto psJob = new GDALBlockPrefetcherJob;
+    psJob->poPrefetcher = this;
+    psJob->nFirstBlockId = nFirstBlockId;
+    psJob->nCount = static_cast<int>(nLastBlockId - nFirstBlockId + 1);
+    if (!m_poJobQueue->SubmitJob(ReadBlocksJob, psJob))
+    {
+        delete psJob;
+        m_bFailed = true;
+        return;
+    }
+    m_nLastScheduledBlockId = nLastBlockId;
+}
+
+/************************************************************************/
+/*                           ReadBlocksJob()                            */
+/************************************************************************/
+
+/* static */ void GDALBlockPrefetcher::ReadBlocksJob(void *pData)
+{
+    std::unique_ptr<GDALBlockPrefetcherJob> psJob(
+        static_cast<GDALBlockPrefetcherJob *>(pData));
+    psJob->poPrefetcher->ReadBlocks(psJob->nFirstBlockId, psJob->nCount);
+}
+
+/************************************************************************/
+/*                           GetWorkerBand()                            */
+/************************************************************************/
+
+/** Return the band of the dataset privately opened by the worker thread. */
+GDALRasterBand *GDALBlockPrefetcher::GetWorkerBand()
+{
+    if (!m_bWorkerOpenTried)
+    {
+        m_bWorkerOpenTried = true;
+
+        // Multi-threaded decoding would compete with the main thread for
+        // the global thread pool, in which we are running.
+        CPLConfigOptionSetter oSetter("GDAL_NUM_THREADS", "1", false);
+        const char *const apszAllowedDrivers[] = {m_osDriverName.c_str(),
+                                                  nullptr};
+        m_poWorkerDS = GDALDataset::Open(
+            m_osFilename.c_str(),
+            GDAL_OF_RASTER | GDAL_OF_READONLY | GDAL_OF_INTERNAL,
+            apszAllowedDrivers, m_aosOpenOptions.List(), nullptr);
+        if (m_poWorkerDS == nullptr)
+        {
+            CPLDebug("GDAL", "Cannot re-open %s for prefetching",
+                     m_osFilename.c_str());
+            return nullptr;
+        }
+
+        GDALRasterBand *poWorkerBand = m_poWorkerDS->GetRasterBand(m_nBand);
+        int nBlockXSize = 0;
+        int nBlockYSize = 0;
+        if (poWorkerBand)
+            poWorkerBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+        if (poWorkerBand == nullptr ||
+            poWorkerBand->GetXSize() != m_nRasterXSize ||
+            poWorkerBand->GetYSize() != m_nRasterYSize ||
+            poWorkerBand->GetRasterDataType() != m_eDataType ||
+            nBlockXSize != m_nBlockXSize || nBlockYSize != m_nBlockYSize)
+        {
+            // Typically overviews whose dataset name is the one of the
+            // full resolution dataset.
+            CPLDebug("GDAL",
+                     "Re-opened %s does not match original band. "
+                     "Disabling prefetching",
+                     m_osFilename.c_str());
+            GDALClose(m_poWorkerDS);
+            m_poWorkerDS = nullptr;
+            return nullptr;
+        }
+    }
+    return m_poWorkerDS ? m_poWorkerDS->GetRasterBand(m_nBand) : nullptr;
+}
+
+/************************************************************************/
+/*                           ReadBlockRow()                             */
+/************************************************************************/
+
+/** Read blocks [nXBlock0, nXBlock1[ of block row nYBlock with a single
+ * RasterIO() request, so that drivers can coalesce the underlying I/O
+ * (e.g. GTiff multi-range reading on /vsicurl/).
+ */
+bool GDALBlockPrefetcher::ReadBlockRow(
+    GDALRasterBand *poWorkerBand, int nYBlock, int nXBlock0, int nXBlock1,
+    std::map<GIntBig, std::vector<GByte>> &oMapResults)
+{
+    const int nDTSize = GDALGetDataTypeSizeBytes(m_eDataType);
+    const int nXOff = nXBlock0 * m_nBlockXSize;
+    const int nYOff = nYBlock * m_nBlockYSize;
+    const int nXSize =
+        std::min(nXBlock1 * m_nBlockXSize, m_nRasterXSize) - nXOff;
+    const int nYSize = std::min(m_nBlockYSize, m_nRasterYSize - nYOff);
+
+    std::vector<GByte> abyBuffer;
+    try
+    {
+        abyBuffer.resize(static_cast<size_t>(nXSize) * nYSize * nDTSize);
+    }
+    catch (const std::exception &)
+    {
+        return false;
+    }
+    if (poWorkerBand->RasterIO(GF_Read, nXOff, nYOff, nXSize, nYSize,
+                               abyBuffer.data(), nXSize, nYSize, m_eDataType,
+                               0, 0, nullptr) != CE_None)
+    {
+        return false;
+    }
+
+    for (int nXBlock = nXBlock0; nXBlock < nXBlock1; ++nXBlock)
+    {
+        const int nXOffInBuffer = (nXBlock - nXBlock0) * m_nBlockXSize;
+        const int nValidXSize =
+            std::min(m_nBlockXSize, nXSize - nXOffInBuffer);
+        std::vector<GByte> abyBlock;
+        try
+        {
+            // Zero-initialized, which takes care of partial edge blocks.
+            abyBlock.resize(m_nBlockSizeBytes);
+        }
+        catch (const std::exception &)
+        {
+            return false;
+        }
+        for (int iY = 0; iY < nYSize; ++iY)
+        {
+            memcpy(abyBlock.data() +
+                       static_cast<size_t>(iY) * m_nBlockXSize * nDTSize,
+                   abyBuffer.data() +
+                       (static_cast<size_t>(iY) * nXSize + nXOffInBuffer) *
+                           nDTSize,
+                   static_cast<size_t>(nValidXSize) * nDTSize);
+        }
+        oMapResults[static_cast<GIntBig>(nYBlock) * m_nBlocksPerRow +
+                    nXBlock] = std::move(abyBlock);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                            ReadBlocks()                              */
+/************************************************************************/
+
+/** Read nCount blocks in row-major order, starting at nFirstBlockId.
+ * Runs in a worker thread.
+ */
+void GDALBlockPrefetcher::ReadBlocks(GIntBig nFirstBlockId, int nCount)
+{
+    std::map<GIntBig, std::vector<GByte>> oMapResults;
+    bool bFailed = false;
+    {
+        std::lock_guard<std::mutex> oWorkerLock(m_oWorkerMutex);
+
+        bool bStop;
+        {
+            std::lock_guard<std::mutex> oLock(m_oMutex);
+            bStop = m_bStop;
+            if (!bStop)
+            {
+                m_nRunningFirstBlockId = nFirstBlockId;
+                m_nRunningEndBlockId = nFirstBlockId + nCount;
+            }
+        }
+
+        if (!bStop)
+        {
+            // Prevent the worker band from instantiating its own prefetcher.
+            CPLConfigOptionSetter oSetter("GDAL_PREFETCH_BLOCKS", "0", false);
+            // Failures are not fatal: the main thread will read the blocks
+            // itself and report errors if needed.
+            CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+
+            GDALRasterBand *poWorkerBand = GetWorkerBand();
+            if (poWorkerBand == nullptr)
+            {
+                bFailed = true;
+            }
+            else
+            {
+                const GIntBig nEndBlockId = nFirstBlockId + nCount;
+                GIntBig nBlockId = nFirstBlockId;
+                while (nBlockId < nEndBlockId)
+                {
+                    const int nYBlock =
+                        static_cast<int>(nBlockId / m_nBlocksPerRow);
+                    const int nXBlock0 =
+                        static_cast<int>(nBlockId % m_nBlocksPerRow);
+                    const int nXBlock1 = static_cast<int>(std::min<GIntBig>(
+                        m_nBlocksPerRow, nXBlock0 + (nEndBlockId - nBlockId)));
+                    if (!ReadBlockRow(poWorkerBand, nYBlock, nXBlock0,
+                                      nXBlock1, oMapResults))
+                    {
+                        break;
+                    }
+                    nBlockId += nXBlock1 - nXBlock0;
+                }
+
+                // Prefetched data is owned by us: do not keep a second copy
+                // in the block cache.
+                m_poWorkerDS->FlushCache(false);
+            }
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        m_nRunningFirstBlockId = -1;
+        m_nRunningEndBlockId = -1;
+        for (auto &oKV : oMapResults)
+        {
+            // Only keep blocks that a sequential reader will still request.
+            if (oKV.first > m_nLastReadBlockId &&
+                oKV.first <= m_nLastReadBlockId + 2 * m_nPrefetchCount)
+            {
+                m_oMapReadyBlocks[oKV.first] = std::move(oKV.second);
+            }
+        }
+        if (bFailed)
+            m_bFailed = true;
+    }
+    m_oCV.notify_all();
+}
+
+//! @endcond
@@ -0,0 +1,123 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  Prefetching of raster blocks driven by the access pattern
+ * Author:   agent, <agent at local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent at local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#ifndef GDALBLOCKPREFETCHER_H_INCLUDED
+#define GDALBLOCKPREFETCHER_H_INCLUDED
+
+#include "cpl_port.h"
+#include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal.h"
+
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class GDALDataset;
+class GDALRasterBand;
+
+//! @cond Doxygen_Suppress
+
+/************************************************************************/
+/*                         GDALBlockPrefetcher                          */
+/************************************************************************/
+
+/** Watches the blocks read through GDALRasterBand::GetLockedBlockRef() and,
+ * once a sequential (row-major) scan is detected, reads the next blocks
+ * ahead of time in a worker thread of the global thread pool.
+ *
+ * The worker thread does not use the band being prefetched, but a private
+ * read-only handle on the same file, so this is only enabled for drivers
+ * that declare GDAL_DCAP_INDEPENDENT_BLOCK_READS.
+ */
+class GDALBlockPrefetcher
+{
+    const int m_nBand;
+    const int m_nRasterXSize;
+    const int m_nRasterYSize;
+    const int m_nBlockXSize;
+    const int m_nBlockYSize;
+    const int m_nBlocksPerRow;
+    const GIntBig m_nTotalBlocks;
+    const GDALDataType m_eDataType;
+    const size_t m_nBlockSizeBytes;
+    const int m_nPrefetchCount;
+
+    const std::string m_osFilename;
+    const std::string m_osDriverName;
+    const CPLStringList m_aosOpenOptions;
+
+    // Protects below members, and is used with m_oCV.
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+    std::map<GIntBig, std::vector<GByte>> m_oMapReadyBlocks{};
+    // Range [first, end[ of the blocks being read by the worker thread.
+    GIntBig m_nRunningFirstBlockId = -1;
+    GIntBig m_nRunningEndBlockId = -1;
+    GIntBig m_nLastReadBlockId = -1;
+    GIntBig m_nLastScheduledBlockId = -1;
+    int m_nSequentialReads = 0;
+    bool m_bFailed = false;
+    bool m_bStop = false;
+
+    // Only used by the worker thread.
+    std::mutex m_oWorkerMutex{};
+    GDALDataset *m_poWorkerDS = nullptr;
+    bool m_bWorkerOpenTried = false;
+
+    std::unique_ptr<CPLJobQueue> m_poJobQueue{};
+
+    GDALBlockPrefetcher(GDALRasterBand *poBand, int nBlockXSize,
+                        int nBlockYSize, int nPrefetchCount,
+                        std::unique_ptr<CPLJobQueue> &&poJobQueue);
+
+    GDALRasterBand *GetWorkerBand();
+    bool ReadBlockRow(GDALRasterBand *poWorkerBand, int nYBlock, int nXBlock0,
+                      int nXBlock1,
+                      std::map<GIntBig, std::vector<GByte>> &oMapResults);
+    void ReadBlocks(GIntBig nFirstBlockId, int nCount);
+
+    static void ReadBlocksJob(void *pData);
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALBlockPrefetcher)
+
+  public:
+    ~GDALBlockPrefetcher();
+
+    static GDALBlockPrefetcher *Create(GDALRasterBand *poBand);
+
+    bool FetchBlock(int nXBlockOff, int nYBlockOff, void *pData);
+    void NotifyBlockRead(int nXBlockOff, int nYBlockOff);
+};
+
+//! @endcond
+
+#endif  // GDALBLOCKPREFETCHER_H_INCLUDED
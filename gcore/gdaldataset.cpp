@@ -37,7 +37,11 @@
 #include <cstdlib>
 #include <cstring>
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <future>
 #include <map>
+#include <mutex>
 #include <new>
 #include <set>
 #include <string>
@@ -49,8 +53,10 @@
 #include "cpl_multiproc.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
+#include "cpl_trace.h"
 #include "cpl_vsi.h"
 #include "cpl_vsi_error.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_attrind.h"
 #include "ogr_core.h"
@@ -94,6 +100,10 @@ enum class GDALAllowReadWriteMutexState
 const GIntBig TOTAL_FEATURES_NOT_INIT = -2;
 const GIntBig TOTAL_FEATURES_UNKNOWN = -1;
 
+constexpr int WRITE_BEHIND_DISABLED = 0;
+constexpr int WRITE_BEHIND_ENABLED = 1;
+constexpr int WRITE_BEHIND_REGISTERED = 2;
+
 class GDALDataset::Private
 {
     CPL_DISALLOW_COPY_ASSIGN(Private)
@@ -126,9 +136,28 @@ class GDALDataset::Private
     std::vector<int>
         m_anBandMap{};  // used by RasterIO(). Values are 1, 2, etc.
 
+    // Memory used in the global block cache by blocks of this dataset, and
+    // budget (0 if none). See SetCacheBudget().
+    std::atomic<GIntBig> m_nCacheUsed{0};
+    std::atomic<GIntBig> m_nCacheBudget{0};
+
+    // RasterIOAsync() state. m_oAsyncRasterIOMutex serializes requests on
+    // datasets that are not thread-safe.
+    std::mutex m_oAsyncRasterIOMutex{};
+    std::mutex m_oAsyncPendingMutex{};
+    std::condition_variable m_oAsyncPendingCV{};
+    int m_nAsyncPending = 0;
+
+    // Write-behind flushing state of the block cache. See
+    // EnableWriteBehindFlushing().
+    std::atomic<int> m_nWriteBehindState{WRITE_BEHIND_DISABLED};
+
     Private() = default;
 };
 
+// Number of datasets with a non-zero cache budget.
+static std::atomic<int> gnDatasetsWithCacheBudget{0};
+
 struct SharedDatasetCtxt
 {
     // PID of the thread that mark the dataset as shared
@@ -291,6 +320,9 @@ GDALDataset::GDALDataset(int bForceCachedIOIn)
 GDALDataset::~GDALDataset()
 
 {
+    // Should normally have been done by the driver.
+    DisableWriteBehindFlushing();
+
     // we don't want to report destruction of datasets that
     // were never really open or meant as internal
     if (!bIsInternal && (nBands != 0 || !EQUAL(GetDescription(), "")))
@@ -373,6 +405,9 @@ GDALDataset::~GDALDataset()
         if (m_poPrivate->hMutex != nullptr)
             CPLDestroyMutex(m_poPrivate->hMutex);
 
+        if (m_poPrivate->m_nCacheBudget > 0)
+            --gnDatasetsWithCacheBudget;
+
         CPLFree(m_poPrivate->m_pszWKTCached);
         if (m_poPrivate->m_poSRSCached)
         {
@@ -669,6 +704,215 @@ CPLErr CPL_STDCALL GDALDropCache(GDALDatasetH hDS)
     return GDALDataset::FromHandle(hDS)->DropCache();
 }
 
+/************************************************************************/
+/*                          SetCacheBudget()                            */
+/************************************************************************/
+
+/**
+ * \brief Set the block cache budget of this dataset.
+ *
+ * The budget is a soft limit on the memory that the blocks of this dataset
+ * may use in the global block cache (see GDALSetCacheMax64()). The dataset
+ * may use more than its budget as long as the global cache is not full, but
+ * when blocks must be evicted from the cache, the blocks of datasets that
+ * exceed their budget are evicted before the ones of other datasets.
+ *
+ * Blocks of overview or mask datasets that share their lock with a parent
+ * dataset (as done by the GTiff driver) are accounted to the parent dataset.
+ *
+ * The budget can also be set at opening time with the generic CACHE_BUDGET
+ * open option of GDALOpenEx().
+ *
+ * This method is the same as the C function GDALDatasetSetCacheBudget().
+ *
+ * @param nBudget Budget in bytes, or 0 to remove any budget.
+ * @since GDAL 3.10
+ */
+
+void GDALDataset::SetCacheBudget(GIntBig nBudget)
+{
+    if (m_poPrivate == nullptr)
+        return;
+    if (m_poPrivate->poParentDataset)
+    {
+        m_poPrivate->poParentDataset->SetCacheBudget(nBudget);
+        return;
+    }
+    nBudget = std::max<GIntBig>(0, nBudget);
+    const GIntBig nOldBudget = m_poPrivate->m_nCacheBudget.exchange(nBudget);
+    if (nOldBudget == 0 && nBudget > 0)
+        ++gnDatasetsWithCacheBudget;
+    else if (nOldBudget > 0 && nBudget == 0)
+        --gnDatasetsWithCacheBudget;
+}
+
+/************************************************************************/
+/*                      GDALDatasetSetCacheBudget()                     */
+/************************************************************************/
+
+/**
+ * \brief Set the block cache budget of this dataset.
+ *
+ * @see GDALDataset::SetCacheBudget().
+ * @since GDAL 3.10
+ */
+
+void GDALDatasetSetCacheBudget(GDALDatasetH hDS, GIntBig nBudget)
+{
+    VALIDATE_POINTER0(hDS, "GDALDatasetSetCacheBudget");
+
+    GDALDataset::FromHandle(hDS)->SetCacheBudget(nBudget);
+}
+
+/************************************************************************/
+/*                          GetCacheBudget()                            */
+/************************************************************************/
+
+/**
+ * \brief Return the block cache budget of this dataset.
+ *
+ * This method is the same as the C function GDALDatasetGetCacheBudget().
+ *
+ * @return budget in bytes, or 0 if there is no budget.
+ * @since GDAL 3.10
+ */
+
+GIntBig GDALDataset::GetCacheBudget() const
+{
+    if (m_poPrivate == nullptr)
+        return 0;
+    if (m_poPrivate->poParentDataset)
+        return m_poPrivate->poParentDataset->GetCacheBudget();
+    return m_poPrivate->m_nCacheBudget;
+}
+
+/************************************************************************/
+/*                      GDALDatasetGetCacheBudget()                     */
+/************************************************************************/
+
+/**
+ * \brief Return the block cache budget of this dataset.
+ *
+ * @see GDALDataset::GetCacheBudget().
+ * @since GDAL 3.10
+ */
+
+GIntBig GDALDatasetGetCacheBudget(GDALDatasetH hDS)
+{
+    VALIDATE_POINTER1(hDS, "GDALDatasetGetCacheBudget", 0);
+
+    return GDALDataset::FromHandle(hDS)->GetCacheBudget();
+}
+
+/************************************************************************/
+/*                           GetCacheUsed()                             */
+/************************************************************************/
+
+/**
+ * \brief Return the memory used by the blocks of this dataset in the global
+ * block cache.
+ *
+ * This method is the same as the C function GDALDatasetGetCacheUsed().
+ *
+ * @return memory usage in bytes.
+ * @since GDAL 3.10
+ */
+
+GIntBig GDALDataset::GetCacheUsed() const
+{
+    if (m_poPrivate == nullptr)
+        return 0;
+    if (m_poPrivate->poParentDataset)
+        return m_poPrivate->poParentDataset->GetCacheUsed();
+    return m_poPrivate->m_nCacheUsed;
+}
+
+/************************************************************************/
+/*                       GDALDatasetGetCacheUsed()                      */
+/************************************************************************/
+
+/**
+ * \brief Return the memory used by the blocks of this dataset in the global
+ * block cache.
+ *
+ * @see GDALDataset::GetCacheUsed().
+ * @since GDAL 3.10
+ */
+
+GIntBig GDALDatasetGetCacheUsed(GDALDatasetH hDS)
+{
+    VALIDATE_POINTER1(hDS, "GDALDatasetGetCacheUsed", 0);
+
+    return GDALDataset::FromHandle(hDS)->GetCacheUsed();
+}
+
+/************************************************************************/
+/*                          AddToCacheUsed()                            */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+void GDALDataset::AddToCacheUsed(GIntBig nDelta)
+{
+    if (m_poPrivate == nullptr)
+        return;
+    if (m_poPrivate->poParentDataset)
+        m_poPrivate->poParentDataset->AddToCacheUsed(nDelta);
+    else
+        m_poPrivate->m_nCacheUsed += nDelta;
+}
+
+/************************************************************************/
+/*                         IsOverCacheBudget()                          */
+/************************************************************************/
+
+bool GDALDataset::IsOverCacheBudget() const
+{
+    if (m_poPrivate == nullptr)
+        return false;
+    if (m_poPrivate->poParentDataset)
+        return m_poPrivate->poParentDataset->IsOverCacheBudget();
+    const GIntBig nBudget = m_poPrivate->m_nCacheBudget;
+    return nBudget > 0 && m_poPrivate->m_nCacheUsed > nBudget;
+}
+
+/************************************************************************/
+/*                        IsAnyCacheBudgetSet()                         */
+/************************************************************************/
+
+bool GDALDataset::IsAnyCacheBudgetSet()
+{
+    return gnDatasetsWithCacheBudget > 0;
+}
+
+/************************************************************************/
+/*                    GetCacheUsedByOpenDatasets()                      */
+/************************************************************************/
+
+// Returns the description and block cache usage of the open datasets that
+// have blocks in the cache. Child datasets (overviews, masks) are accounted
+// with their parent.
+std::vector<std::pair<std::string, GIntBig>>
+GDALDataset::GetCacheUsedByOpenDatasets()
+{
+    std::vector<std::pair<std::string, GIntBig>> aoRet;
+    CPLMutexHolderD(&hDLMutex);
+    if (poAllDatasetMap == nullptr)
+        return aoRet;
+    for (const auto &oIter : *poAllDatasetMap)
+    {
+        const GDALDataset *poDS = oIter.first;
+        if (poDS->m_poPrivate == nullptr ||
+            poDS->m_poPrivate->poParentDataset != nullptr)
+            continue;
+        const GIntBig nUsed = poDS->m_poPrivate->m_nCacheUsed;
+        if (nUsed > 0)
+            aoRet.emplace_back(poDS->GetDescription(), nUsed);
+    }
+    return aoRet;
+}
+
+//! @endcond
+
 /************************************************************************/
 /*                      GetEstimatedRAMUsage()                          */
 /************************************************************************/
@@ -1738,6 +1982,58 @@ void GDALDataset::UnMarkSuppressOnClose()
     bSuppressOnClose = false;
 }
 
+/************************************************************************/
+/*                            IsThreadSafe()                            */
+/************************************************************************/
+
+/** Return whether this dataset, and its related objects (typically raster
+ * bands), can be called for the intended scope from several threads
+ * concurrently, without external locking.
+ *
+ * Currently this only returns true for datasets opened with the
+ * GDAL_OF_THREAD_SAFE flag, for read-only raster access, that is with
+ * nScopeFlags == GDAL_OF_RASTER.
+ *
+ * This method is the same as the C function GDALDatasetIsThreadSafe().
+ *
+ * @param nScopeFlags Intended scope of use. Only GDAL_OF_RASTER is currently
+ * supported.
+ * @return true if the dataset can be used concurrently for that scope.
+ * @since GDAL 3.10
+ */
+bool GDALDataset::IsThreadSafe(int nScopeFlags) const
+{
+    CPL_IGNORE_RET_VAL(nScopeFlags);
+    return false;
+}
+
+/************************************************************************/
+/*                      GDALDatasetIsThreadSafe()                       */
+/************************************************************************/
+
+/** Return whether this dataset, and its related objects (typically raster
+ * bands), can be called for the intended scope from several threads
+ * concurrently, without external locking.
+ *
+ * @see GDALDataset::IsThreadSafe()
+ *
+ * @param hDS Source dataset
+ * @param nScopeFlags Intended scope of use. Only GDAL_OF_RASTER is currently
+ * supported.
+ * @param papszOptions Options. None currently.
+ * @return true if the dataset can be used concurrently for that scope.
+ * @since GDAL 3.10
+ */
+bool GDALDatasetIsThreadSafe(GDALDatasetH hDS, int nScopeFlags,
+                             CSLConstList papszOptions)
+{
+    VALIDATE_POINTER1(hDS, __func__, false);
+
+    CPL_IGNORE_RET_VAL(papszOptions);
+
+    return GDALDataset::FromHandle(hDS)->IsThreadSafe(nScopeFlags);
+}
+
 /************************************************************************/
 /*                        CleanupPostFileClosing()                      */
 /************************************************************************/
@@ -2793,6 +3089,8 @@ CPLErr GDALDataset::RasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
 
     int bCallLeaveReadWrite = EnterReadWrite(eRWFlag);
 
+    CPL_TRACE_SCOPE("GDALDataset::IRasterIO");
+
     /* -------------------------------------------------------------------- */
     /*      We are being forced to use cached IO instead of a driver        */
     /*      specific implementation.                                        */
@@ -2818,12 +3116,197 @@ CPLErr GDALDataset::RasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                          nBandSpace, psExtraArg);
     }
 
+    if (eRWFlag == GF_Write)
+    {
+        for (int i = 0; i < nBandCount; ++i)
+        {
+            GDALRasterBand *poBand = GetRasterBand(panBandMap[i]);
+            if (poBand)
+                poBand->InvalidateBlockStatistics(nXOff, nYOff, nXSize,
+                                                  nYSize);
+        }
+    }
+
     if (bCallLeaveReadWrite)
         LeaveReadWrite();
 
     return eErr;
 }
 
+/************************************************************************/
+/*                           RasterIOAsync()                            */
+/************************************************************************/
+
+/**
+ * \brief Read a region of image data from multiple bands, asynchronously.
+ *
+ * This is the same as RasterIO() with GF_Read, except that the request is
+ * run by a worker thread of the GDAL global thread pool, and that the
+ * method returns immediately. The returned future becomes ready, with the
+ * return code of RasterIO(), once the buffer has been filled.
+ *
+ * Requests on a dataset opened with GDAL_OF_THREAD_SAFE are run
+ * concurrently. For other datasets, requests are run one at a time, and
+ * the caller must not use the dataset (including for other operations than
+ * RasterIOAsync()) until the futures of all pending requests are ready.
+ * In all cases, the dataset must not be destroyed and pData must not be
+ * freed before the future is ready. GDALClose() waits for pending requests,
+ * as does WaitForRasterIOAsync().
+ *
+ * Errors are emitted from the worker thread, as is the progress callback
+ * of psExtraArg, if any.
+ *
+ * @param nXOff The pixel offset to the top left corner of the region.
+ * @param nYOff The line offset to the top left corner of the region.
+ * @param nXSize The width of the region in pixels.
+ * @param nYSize The height of the region in lines.
+ * @param pData The buffer into which the data should be read.
+ * @param nBufXSize the width of the buffer image.
+ * @param nBufYSize the height of the buffer image.
+ * @param eBufType the type of the pixel values in the pData data buffer.
+ * @param nBandCount the number of bands being read.
+ * @param panBandMap the list of nBandCount band numbers being read, or NULL
+ * to select the first nBandCount bands. It is copied by this method.
+ * @param nPixelSpace The byte offset from the start of one pixel value in
+ * pData to the start of the next pixel value within a scanline, or 0.
+ * @param nLineSpace The byte offset from the start of one scanline in
+ * pData to the start of the next, or 0.
+ * @param nBandSpace the byte offset from the start of one bands data to the
+ * start of the next, or 0.
+ * @param psExtraArg pointer to a GDALRasterIOExtraArg structure with
+ * additional arguments, or NULL. It is copied by this method.
+ *
+ * @return a future with the return code of RasterIO().
+ * @since GDAL 3.10
+ */
+
+std::future<CPLErr> GDALDataset::RasterIOAsync(
+    int nXOff, int nYOff, int nXSize, int nYSize, void *pData, int nBufXSize,
+    int nBufYSize, GDALDataType eBufType, int nBandCount,
+    const int *panBandMap, GSpacing nPixelSpace, GSpacing nLineSpace,
+    GSpacing nBandSpace, const GDALRasterIOExtraArg *psExtraArg)
+{
+    struct Job
+    {
+        GDALDataset *poDS = nullptr;
+        bool bSerialize = false;
+        int nXOff = 0;
+        int nYOff = 0;
+        int nXSize = 0;
+        int nYSize = 0;
+        void *pData = nullptr;
+        int nBufXSize = 0;
+        int nBufYSize = 0;
+        GDALDataType eBufType = GDT_Unknown;
+        std::vector<int> anBandMap{};
+        GSpacing nPixelSpace = 0;
+        GSpacing nLineSpace = 0;
+        GSpacing nBandSpace = 0;
+        GDALRasterIOExtraArg sExtraArg{};
+        std::promise<CPLErr> oPromise{};
+
+        static void Run(void *pJob)
+        {
+            std::unique_ptr<Job> psJob(static_cast<Job *>(pJob));
+            auto poPrivate = psJob->poDS->m_poPrivate;
+            CPLErr eErr;
+            {
+                std::unique_lock oLock(poPrivate->m_oAsyncRasterIOMutex,
+                                       std::defer_lock);
+                if (psJob->bSerialize)
+                    oLock.lock();
+                eErr = psJob->poDS->RasterIO(
+                    GF_Read, psJob->nXOff, psJob->nYOff, psJob->nXSize,
+                    psJob->nYSize, psJob->pData, psJob->nBufXSize,
+                    psJob->nBufYSize, psJob->eBufType,
+                    static_cast<int>(psJob->anBandMap.size()),
+                    psJob->anBandMap.data(), psJob->nPixelSpace,
+                    psJob->nLineSpace, psJob->nBandSpace, &psJob->sExtraArg);
+            }
+
+            {
+                // Notify under the lock, as the dataset may be destroyed as
+                // soon as the counter drops to zero.
+                std::lock_guard oLock(poPrivate->m_oAsyncPendingMutex);
+                --poPrivate->m_nAsyncPending;
+                poPrivate->m_oAsyncPendingCV.notify_all();
+            }
+
+            // Last, as the dataset may be destroyed once the future is ready
+            psJob->oPromise.set_value(eErr);
+        }
+    };
+
+    auto psJob = std::make_unique<Job>();
+    psJob->poDS = this;
+    psJob->bSerialize = !IsThreadSafe(GDAL_OF_RASTER);
+    psJob->nXOff = nXOff;
+    psJob->nYOff = nYOff;
+    psJob->nXSize = nXSize;
+    psJob->nYSize = nYSize;
+    psJob->pData = pData;
+    psJob->nBufXSize = nBufXSize;
+    psJob->nBufYSize = nBufYSize;
+    psJob->eBufType = eBufType;
+    for (int i = 0; i < nBandCount; ++i)
+        psJob->anBandMap.push_back(panBandMap ? panBandMap[i] : i + 1);
+    psJob->nPixelSpace = nPixelSpace;
+    psJob->nLineSpace = nLineSpace;
+    psJob->nBandSpace = nBandSpace;
+    if (psExtraArg)
+    {
+        psJob->sExtraArg = *psExtraArg;
+    }
+    else
+    {
+        INIT_RASTERIO_EXTRA_ARG(psJob->sExtraArg);
+    }
+    auto oFuture = psJob->oPromise.get_future();
+
+    if (!m_poPrivate)
+    {
+        psJob->oPromise.set_value(CE_Failure);
+        return oFuture;
+    }
+
+    {
+        std::lock_guard oLock(m_poPrivate->m_oAsyncPendingMutex);
+        ++m_poPrivate->m_nAsyncPending;
+    }
+
+    CPLWorkerThreadPool *poThreadPool =
+        GDALGetGlobalThreadPool(CPLGetNumCPUs());
+    if (poThreadPool && poThreadPool->SubmitJob(Job::Run, psJob.get()))
+    {
+        psJob.release();
+    }
+    else
+    {
+        // Fallback to a synchronous request
+        Job::Run(psJob.release());
+    }
+    return oFuture;
+}
+
+/************************************************************************/
+/*                        WaitForRasterIOAsync()                        */
+/************************************************************************/
+
+/**
+ * \brief Wait for the completion of all pending RasterIOAsync() requests.
+ *
+ * @since GDAL 3.10
+ */
+
+void GDALDataset::WaitForRasterIOAsync()
+{
+    if (!m_poPrivate)
+        return;
+    std::unique_lock oLock(m_poPrivate->m_oAsyncPendingMutex);
+    m_poPrivate->m_oAsyncPendingCV.wait(
+        oLock, [this]() { return m_poPrivate->m_nAsyncPending == 0; });
+}
+
 /************************************************************************/
 /*                        GDALDatasetRasterIO()                         */
 /************************************************************************/
@@ -3472,6 +3955,47 @@ static GDALDataset *GetSharedDS(const char *pszFilename,
     return nullptr;
 }
 
+/************************************************************************/
+/*                   GDALIsDriverSpecificOpenOption()                   */
+/************************************************************************/
+
+static bool GDALIsDriverSpecificOpenOption(GDALDriver *poDriver,
+                                           const char *pszOptionName)
+{
+    const char *pszOpenOptionList =
+        poDriver->GetMetadataItem(GDAL_DMD_OPENOPTIONLIST);
+    return pszOpenOptionList != nullptr &&
+           CPLString(pszOpenOptionList).ifind(pszOptionName) !=
+               std::string::npos;
+}
+
+/************************************************************************/
+/*                        GDALParseCacheBudget()                        */
+/************************************************************************/
+
+/* Parse the value of the CACHE_BUDGET open option: either X% of the block */
+/* cache maximum size, or a value in megabytes if lower than 100000, */
+/* otherwise in bytes, similarly to GDAL_CACHEMAX. */
+static GIntBig GDALParseCacheBudget(const char *pszValue)
+{
+    if (strchr(pszValue, '%') != nullptr)
+    {
+        const double dfBudget = static_cast<double>(GDALGetCacheMax64()) *
+                                CPLAtof(pszValue) / 100.0;
+        if (dfBudget >= 0 && dfBudget < 1e15)
+            return static_cast<GIntBig>(dfBudget);
+    }
+    else
+    {
+        const GIntBig nBudget = CPLAtoGIntBig(pszValue);
+        if (nBudget >= 0)
+            return nBudget < 100000 ? nBudget * 1024 * 1024 : nBudget;
+    }
+    CPLError(CE_Warning, CPLE_IllegalArg,
+             "Invalid value for CACHE_BUDGET: %s. Ignoring it", pszValue);
+    return 0;
+}
+
 /************************************************************************/
 /*                             GDALOpenEx()                             */
 /************************************************************************/
@@ -3535,7 +4059,11 @@ static GDALDataset *GetSharedDS(const char *pszFilename,
  * GDALOpenEx() it will be referenced and returned, if GDALOpenEx() is called
  * from the same thread.</li> <li>Verbose error: GDAL_OF_VERBOSE_ERROR. If set,
  * a failed attempt to open the file will lead to an error message to be
- * reported.</li>
+ * reported.</li> <li>Thread safe: GDAL_OF_THREAD_SAFE (since GDAL 3.10). If
+ * set, the returned dataset can be used concurrently by several threads for
+ * read-only raster access (see the GDAL_OF_THREAD_SAFE documentation).
+ * It must be combined with GDAL_OF_RASTER only, and cannot be combined with
+ * GDAL_OF_UPDATE or GDAL_OF_SHARED.</li>
  * </ul>
  *
  * @param papszAllowedDrivers NULL to consider all candidate drivers, or a NULL
@@ -3555,6 +4083,11 @@ static GDALDataset *GetSharedDS(const char *pszFilename,
  * that it may not cause a warning if the driver doesn't declare this option.
  * Starting with GDAL 3.3, OVERVIEW_LEVEL=NONE is supported to indicate that
  * no overviews should be exposed.
+ * Starting with GDAL 3.10, the CACHE_BUDGET=value option is also available for
+ * all raster drivers, to set the budget of the dataset in the block cache
+ * (see GDALDataset::SetCacheBudget()). The value is expressed in megabytes
+ * if lower than 100000, otherwise in bytes, or as X% of the block cache
+ * maximum size.
  *
  * @param papszSiblingFiles NULL, or a NULL terminated list of strings that are
  * filenames that are auxiliary to the main filename. If NULL is passed, a
@@ -3578,6 +4111,39 @@ GDALDatasetH CPL_STDCALL GDALOpenEx(const char *pszFilename,
     if ((nOpenFlags & GDAL_OF_KIND_MASK) == 0)
         nOpenFlags |= GDAL_OF_KIND_MASK & ~GDAL_OF_MULTIDIM_RASTER;
 
+    if (nOpenFlags & GDAL_OF_THREAD_SAFE)
+    {
+        if ((nOpenFlags & GDAL_OF_KIND_MASK) != GDAL_OF_RASTER)
+        {
+            CPLError(CE_Failure, CPLE_IllegalArg,
+                     "GDAL_OF_THREAD_SAFE must be combined with "
+                     "GDAL_OF_RASTER only");
+            return nullptr;
+        }
+        if (nOpenFlags & (GDAL_OF_UPDATE | GDAL_OF_SHARED))
+        {
+            CPLError(CE_Failure, CPLE_IllegalArg,
+                     "GDAL_OF_THREAD_SAFE is incompatible with GDAL_OF_UPDATE "
+                     "and GDAL_OF_SHARED");
+            return nullptr;
+        }
+
+        const unsigned int nThreadOpenFlags =
+            nOpenFlags & ~GDAL_OF_THREAD_SAFE;
+        std::unique_ptr<GDALDataset> poPrototypeDS(GDALDataset::FromHandle(
+            GDALOpenEx(pszFilename, nThreadOpenFlags | GDAL_OF_INTERNAL,
+                       papszAllowedDrivers, papszOpenOptions,
+                       papszSiblingFiles)));
+        if (!poPrototypeDS)
+            return nullptr;
+        auto poDS = GDALCreateThreadSafeDataset(std::move(poPrototypeDS),
+                                                pszFilename, nThreadOpenFlags,
+                                                papszOpenOptions);
+        if (poDS && !(nOpenFlags & GDAL_OF_INTERNAL))
+            poDS->AddToDatasetOpenList();
+        return poDS.release();
+    }
+
     /* -------------------------------------------------------------------- */
     /*      In case of shared dataset, first scan the existing list to see  */
     /*      if it could already contain the requested dataset.              */
@@ -3709,26 +4275,38 @@ retry:
             poDriver->GetMetadataItem(GDAL_DCAP_MULTIDIM_RASTER) == nullptr)
             continue;
 
-        // Remove general OVERVIEW_LEVEL open options from list before passing
-        // it to the driver, if it isn't a driver specific option already.
+        // Cheap rejection based on the signatures declared by the driver,
+        // before anything else is done with it.
+        if (!poDriver->HeaderMatchesMagicBytes(&oOpenInfo))
+            continue;
+
+        // Remove general OVERVIEW_LEVEL and CACHE_BUDGET open options from
+        // list before passing it to the driver, if they aren't driver
+        // specific options already.
         char **papszTmpOpenOptions = nullptr;
         char **papszTmpOpenOptionsToValidate = nullptr;
         char **papszOptionsToValidate = const_cast<char **>(papszOpenOptions);
-        if (CSLFetchNameValue(papszOpenOptionsCleaned, "OVERVIEW_LEVEL") !=
-                nullptr &&
-            (poDriver->GetMetadataItem(GDAL_DMD_OPENOPTIONLIST) == nullptr ||
-             CPLString(poDriver->GetMetadataItem(GDAL_DMD_OPENOPTIONLIST))
-                     .ifind("OVERVIEW_LEVEL") == std::string::npos))
+        for (const char *pszGenericOption : {"OVERVIEW_LEVEL", "CACHE_BUDGET"})
         {
-            papszTmpOpenOptions = CSLDuplicate(papszOpenOptionsCleaned);
+            if (CSLFetchNameValue(papszOpenOptionsCleaned, pszGenericOption) ==
+                    nullptr ||
+                GDALIsDriverSpecificOpenOption(poDriver, pszGenericOption))
+            {
+                continue;
+            }
+            if (papszTmpOpenOptions == nullptr)
+            {
+                papszTmpOpenOptions = CSLDuplicate(papszOpenOptionsCleaned);
+                papszTmpOpenOptionsToValidate =
+                    CSLDuplicate(papszOptionsToValidate);
+            }
             papszTmpOpenOptions =
-                CSLSetNameValue(papszTmpOpenOptions, "OVERVIEW_LEVEL", nullptr);
+                CSLSetNameValue(papszTmpOpenOptions, pszGenericOption, nullptr);
             oOpenInfo.papszOpenOptions = papszTmpOpenOptions;
 
-            papszOptionsToValidate = CSLDuplicate(papszOptionsToValidate);
-            papszOptionsToValidate = CSLSetNameValue(papszOptionsToValidate,
-                                                     "OVERVIEW_LEVEL", nullptr);
-            papszTmpOpenOptionsToValidate = papszOptionsToValidate;
+            papszTmpOpenOptionsToValidate = CSLSetNameValue(
+                papszTmpOpenOptionsToValidate, pszGenericOption, nullptr);
+            papszOptionsToValidate = papszTmpOpenOptionsToValidate;
         }
 
         const int nIdentifyRes =
@@ -3822,10 +4400,7 @@ retry:
             // driver specific.
             if (CSLFetchNameValue(papszOpenOptions, "OVERVIEW_LEVEL") !=
                     nullptr &&
-                (poDriver->GetMetadataItem(GDAL_DMD_OPENOPTIONLIST) ==
-                     nullptr ||
-                 CPLString(poDriver->GetMetadataItem(GDAL_DMD_OPENOPTIONLIST))
-                         .ifind("OVERVIEW_LEVEL") == std::string::npos))
+                !GDALIsDriverSpecificOpenOption(poDriver, "OVERVIEW_LEVEL"))
             {
                 CPLString osVal(
                     CSLFetchNameValue(papszOpenOptions, "OVERVIEW_LEVEL"));
@@ -3895,6 +4470,16 @@ retry:
                 }
             }
 
+            // Deal with generic CACHE_BUDGET open option, unless it is
+            // driver specific.
+            const char *pszCacheBudget =
+                CSLFetchNameValue(papszOpenOptionsCleaned, "CACHE_BUDGET");
+            if (poDS != nullptr && pszCacheBudget != nullptr &&
+                !GDALIsDriverSpecificOpenOption(poDriver, "CACHE_BUDGET"))
+            {
+                poDS->SetCacheBudget(GDALParseCacheBudget(pszCacheBudget));
+            }
+
             VSIErrorReset();
 
             CSLDestroy(papszOpenOptionsCleaned);
@@ -4129,6 +4714,8 @@ CPLErr CPL_STDCALL GDALClose(GDALDatasetH hDS)
 
     GDALDataset *poDS = GDALDataset::FromHandle(hDS);
 
+    poDS->WaitForRasterIOAsync();
+
     if (poDS->GetShared())
     {
         /* --------------------------------------------------------------------
@@ -4320,7 +4907,12 @@ int CPL_STDCALL GDALDumpOpenDatasets(FILE *fp)
  * of the data buffer.
  *
  * @param papszOptions Driver specific control options in a string list or NULL.
- * Consult driver documentation for options supported.
+ * Consult driver documentation for options supported. For drivers without a
+ * specific implementation, starting with GDAL 3.10, BACKGROUND=YES causes the
+ * request to be read by worker threads, by strips aligned on rows of blocks
+ * that are reported by GetNextUpdatedRegion() as they are read. The dataset
+ * must then not be used until the session is ended. This is the default for
+ * datasets opened with GDAL_OF_THREAD_SAFE, whose strips are read concurrently.
  *
  * @return The GDALAsyncReader object representing the request.
  */
@@ -4413,7 +5005,12 @@ GDALAsyncReader *GDALDataset::BeginAsyncReader(
  * of the data buffer.
  *
  * @param papszOptions Driver specific control options in a string list or NULL.
- * Consult driver documentation for options supported.
+ * Consult driver documentation for options supported. For drivers without a
+ * specific implementation, starting with GDAL 3.10, BACKGROUND=YES causes the
+ * request to be read by worker threads, by strips aligned on rows of blocks
+ * that are reported by GetNextUpdatedRegion() as they are read. The dataset
+ * must then not be used until the session is ended. This is the default for
+ * datasets opened with GDAL_OF_THREAD_SAFE, whose strips are read concurrently.
  *
  * @return handle representing the request.
  */
@@ -6220,6 +6817,64 @@ OGRErr GDALDataset::ProcessSQLDropIndex(const char *pszSQLCommand)
     return eErr;
 }
 
+/************************************************************************/
+/*                  ProcessSQLCreateDropSpatialIndex()                  */
+/*                                                                      */
+/*      The correct syntax for creating or dropping a sidecar spatial   */
+/*      index in the OGR SQL dialect is:                                */
+/*                                                                      */
+/*          CREATE SPATIAL INDEX ON <layername>                         */
+/*          DROP SPATIAL INDEX ON <layername>                           */
+/************************************************************************/
+
+OGRErr GDALDataset::ProcessSQLCreateDropSpatialIndex(const char *pszSQLCommand,
+                                                     bool bCreate)
+
+{
+    const CPLStringList aosTokens(CSLTokenizeString(pszSQLCommand));
+    const char *pszVerb = bCreate ? "CREATE" : "DROP";
+
+    /* -------------------------------------------------------------------- */
+    /*      Do some general syntax checking.                                */
+    /* -------------------------------------------------------------------- */
+    if (aosTokens.size() != 5 || !EQUAL(aosTokens[0], pszVerb) ||
+        !EQUAL(aosTokens[1], "SPATIAL") || !EQUAL(aosTokens[2], "INDEX") ||
+        !EQUAL(aosTokens[3], "ON"))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Syntax error in %s SPATIAL INDEX command.\n"
+                 "Was '%s'\n"
+                 "Should be of form '%s SPATIAL INDEX ON <table>'",
+                 pszVerb, pszSQLCommand, pszVerb);
+        return OGRERR_FAILURE;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Find the named layer.                                           */
+    /* -------------------------------------------------------------------- */
+    OGRLayer *poLayer = GetLayerByName(aosTokens[4]);
+    if (poLayer == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "%s SPATIAL INDEX ON failed, no such layer as `%s'.", pszVerb,
+                 aosTokens[4]);
+        return OGRERR_FAILURE;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Does this layer even support sidecar spatial indexes?           */
+    /* -------------------------------------------------------------------- */
+    if (!poLayer->HasSidecarSpatialIndexSupport())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "%s SPATIAL INDEX ON not supported by this driver.", pszVerb);
+        return OGRERR_FAILURE;
+    }
+
+    return bCreate ? poLayer->CreateSidecarSpatialIndex()
+                   : poLayer->DropSidecarSpatialIndex();
+}
+
 /************************************************************************/
 /*                        ProcessSQLDropTable()                         */
 /*                                                                      */
@@ -6839,6 +7494,20 @@ GDALDataset::ExecuteSQL(const char *pszStatement, OGRGeometry *poSpatialFilter,
         return nullptr;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Handle CREATE/DROP SPATIAL INDEX statements specially.          */
+    /* -------------------------------------------------------------------- */
+    if (STARTS_WITH_CI(pszStatement, "CREATE SPATIAL INDEX"))
+    {
+        ProcessSQLCreateDropSpatialIndex(pszStatement, true);
+        return nullptr;
+    }
+    if (STARTS_WITH_CI(pszStatement, "DROP SPATIAL INDEX"))
+    {
+        ProcessSQLCreateDropSpatialIndex(pszStatement, false);
+        return nullptr;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Handle DROP TABLE statements specially.                         */
     /* -------------------------------------------------------------------- */
@@ -8155,9 +8824,86 @@ void GDALDataset::ShareLockWithParentDataset(GDALDataset *poParentDataset)
     if (m_poPrivate != nullptr)
     {
         m_poPrivate->poParentDataset = poParentDataset;
+
+        // Transfer the block cache usage already accounted to this dataset.
+        if (poParentDataset)
+            poParentDataset->AddToCacheUsed(
+                m_poPrivate->m_nCacheUsed.exchange(0));
+    }
+}
+
+/************************************************************************/
+/*                     EnableWriteBehindFlushing()                      */
+/************************************************************************/
+
+/* To be used by drivers whose IWriteBlock() may be called from a background
+ * thread, as long as the dataset read/write mutex is held (see
+ * EnterReadWrite()), while the user thread uses the dataset. When this is
+ * enabled, the first block of the dataset that gets dirty registers the
+ * dataset to the write-behind thread of the block cache, that writes dirty
+ * blocks when they exceed half of the cache size.
+ * DisableWriteBehindFlushing() must be called before any operation that
+ * accesses the file without holding the read/write mutex (typically
+ * FlushCache()), and at the latest when closing the dataset.
+ */
+
+void GDALDataset::EnableWriteBehindFlushing()
+{
+    if (m_poPrivate != nullptr && eAccess == GA_Update &&
+        m_poPrivate->poParentDataset == nullptr)
+    {
+        int nExpected = WRITE_BEHIND_DISABLED;
+        m_poPrivate->m_nWriteBehindState.compare_exchange_strong(
+            nExpected, WRITE_BEHIND_ENABLED);
+    }
+}
+
+/************************************************************************/
+/*                     DisableWriteBehindFlushing()                     */
+/************************************************************************/
+
+/* Undoes EnableWriteBehindFlushing(). When this returns, the write-behind
+ * thread no longer accesses this dataset.
+ */
+
+void GDALDataset::DisableWriteBehindFlushing()
+{
+    if (m_poPrivate != nullptr &&
+        m_poPrivate->m_nWriteBehindState.exchange(WRITE_BEHIND_DISABLED) ==
+            WRITE_BEHIND_REGISTERED)
+    {
+        GDALRasterBlock::UnregisterWriteBehindDataset(this);
     }
 }
 
+/************************************************************************/
+/*                   RegisterForWriteBehindFlushing()                   */
+/************************************************************************/
+
+/* Called by GDALRasterBlock::MarkDirty() */
+void GDALDataset::RegisterForWriteBehindFlushing()
+{
+    if (m_poPrivate != nullptr)
+    {
+        int nExpected = WRITE_BEHIND_ENABLED;
+        if (m_poPrivate->m_nWriteBehindState.compare_exchange_strong(
+                nExpected, WRITE_BEHIND_REGISTERED))
+        {
+            GDALRasterBlock::RegisterWriteBehindDataset(this);
+        }
+    }
+}
+
+/************************************************************************/
+/*                 IsRegisteredForWriteBehindFlushing()                 */
+/************************************************************************/
+
+bool GDALDataset::IsRegisteredForWriteBehindFlushing() const
+{
+    return m_poPrivate != nullptr &&
+           m_poPrivate->m_nWriteBehindState == WRITE_BEHIND_REGISTERED;
+}
+
 /************************************************************************/
 /*                   SetQueryLoggerFunc()                               */
 /************************************************************************/
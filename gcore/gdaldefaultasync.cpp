@@ -30,12 +30,23 @@
 #include "cpl_port.h"
 #include "gdal_priv.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
 #include <cstring>
+#include <deque>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_string.h"
 #include "gdal.h"
+#include "gdal_thread_pool.h"
 
 CPL_C_START
 GDALAsyncReader *GDALGetDefaultAsyncReader(GDALDataset *poDS, int nXOff,
@@ -264,11 +275,40 @@ void CPL_STDCALL GDALARUnlockBuffer(GDALAsyncReaderH hARIO)
 /* ==================================================================== */
 /************************************************************************/
 
+// When reading in the background, the request is split into strips of
+// buffer lines, aligned on the block boundaries of the dataset. Each strip is
+// reported by GetNextUpdatedRegion() once it has been read.
+
 class GDALDefaultAsyncReader : public GDALAsyncReader
 {
   private:
     char **papszOptions = nullptr;
 
+    // Background mode
+    bool m_bBackground = false;
+    std::unique_ptr<CPLJobQueue> m_poJobQueue{};
+    std::vector<std::pair<int, int>> m_aoStrips{};  // buffer y offset, size
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+    std::deque<int> m_anReadyStrips{};
+    int m_nRemainingStrips = 0;
+    bool m_bError = false;
+    std::atomic<bool> m_bCancel{false};
+    std::vector<CPLErrorHandlerAccumulatorStruct> m_aoErrors{};
+
+    struct Job
+    {
+        GDALDefaultAsyncReader *poReader = nullptr;
+        int iStrip = 0;  // or -1 to read all strips sequentially
+    };
+
+    std::vector<Job> m_asJobs{};
+
+    void ComputeStrips();
+    bool StartBackgroundReading();
+    static void RunJob(void *pData);
+    CPLErr ReadStrip(int iStrip, bool bAdviseRead);
+
     CPL_DISALLOW_COPY_ASSIGN(GDALDefaultAsyncReader)
 
   public:
@@ -334,11 +374,20 @@ GDALDefaultAsyncReader::GDALDefaultAsyncReader(
             panBandMap[i] = i + 1;
     }
 
-    nPixelSpace = nPixelSpaceIn;
-    nLineSpace = nLineSpaceIn;
-    nBandSpace = nBandSpaceIn;
+    // Resolve default spacings now, as strips are read with a smaller
+    // buffer height than the whole request.
+    nPixelSpace = nPixelSpaceIn ? nPixelSpaceIn
+                                : GDALGetDataTypeSizeBytes(eBufTypeIn);
+    nLineSpace = nLineSpaceIn ? nLineSpaceIn : nPixelSpace * nBufXSizeIn;
+    nBandSpace = nBandSpaceIn ? nBandSpaceIn : nLineSpace * nBufYSizeIn;
 
     papszOptions = CSLDuplicate(papszOptionsIn);
+
+    const char *pszBackground = CSLFetchNameValue(papszOptions, "BACKGROUND");
+    m_bBackground = pszBackground ? CPLTestBool(pszBackground)
+                                  : poDS->IsThreadSafe(GDAL_OF_RASTER);
+    if (m_bBackground && !StartBackgroundReading())
+        m_bBackground = false;
 }
 
 /************************************************************************/
@@ -348,33 +397,271 @@ GDALDefaultAsyncReader::GDALDefaultAsyncReader(
 GDALDefaultAsyncReader::~GDALDefaultAsyncReader()
 
 {
+    if (m_poJobQueue)
+    {
+        m_bCancel = true;
+        m_poJobQueue->WaitCompletion();
+    }
     CPLFree(panBandMap);
     CSLDestroy(papszOptions);
 }
 
+/************************************************************************/
+/*                           ComputeStrips()                            */
+/************************************************************************/
+
+void GDALDefaultAsyncReader::ComputeStrips()
+{
+    int nBlockYSize = 1;
+    GDALRasterBand *poBand = poDS->GetRasterBand(panBandMap[0]);
+    if (poBand)
+    {
+        int nBlockXSize = 0;
+        poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+        nBlockYSize = std::max(1, nBlockYSize);
+    }
+
+    // Group rows of blocks so that there are not too many strips
+    constexpr int MAX_STRIPS = 256;
+    const int nBlockRows =
+        (nYOff + nYSize - 1) / nBlockYSize - nYOff / nBlockYSize + 1;
+    const int nBlockRowsPerStrip =
+        std::max(1, (nBlockRows + MAX_STRIPS - 1) / MAX_STRIPS);
+    const int nStripSrcHeight = nBlockYSize * nBlockRowsPerStrip;
+
+    // A buffer line belongs to the strip containing its nearest source
+    // line.
+    const double dfRatio = static_cast<double>(nYSize) / nBufYSize;
+    int nBufYStart = 0;
+    for (int nSrcY = (nYOff / nStripSrcHeight + 1) * nStripSrcHeight;
+         nBufYStart < nBufYSize; nSrcY += nStripSrcHeight)
+    {
+        const int nBufYEnd =
+            nSrcY >= nYOff + nYSize
+                ? nBufYSize
+                : std::clamp(static_cast<int>(std::ceil(
+                                 (nSrcY - nYOff) / dfRatio - 0.5)),
+                             0, nBufYSize);
+        if (nBufYEnd > nBufYStart)
+        {
+            m_aoStrips.emplace_back(nBufYStart, nBufYEnd - nBufYStart);
+            nBufYStart = nBufYEnd;
+        }
+    }
+}
+
+/************************************************************************/
+/*                       StartBackgroundReading()                       */
+/************************************************************************/
+
+bool GDALDefaultAsyncReader::StartBackgroundReading()
+{
+    if (nXSize <= 0 || nYSize <= 0 || nBufXSize <= 0 || nBufYSize <= 0 ||
+        nBandCount <= 0 || pBuf == nullptr)
+        return false;
+
+    CPLWorkerThreadPool *poThreadPool =
+        GDALGetGlobalThreadPool(CPLGetNumCPUs());
+    if (poThreadPool == nullptr)
+        return false;
+
+    ComputeStrips();
+    m_nRemainingStrips = static_cast<int>(m_aoStrips.size());
+    m_poJobQueue = poThreadPool->CreateJobQueue();
+
+    // Strips of thread-safe datasets are read concurrently. Otherwise a
+    // single job reads them in sequence, and AdviseRead() lets network
+    // drivers fetch the blocks of each strip in parallel.
+    if (poDS->IsThreadSafe(GDAL_OF_RASTER))
+    {
+        m_asJobs.resize(m_aoStrips.size());
+        for (int i = 0; i < static_cast<int>(m_asJobs.size()); ++i)
+        {
+            m_asJobs[i].poReader = this;
+            m_asJobs[i].iStrip = i;
+        }
+    }
+    else
+    {
+        m_asJobs.resize(1);
+        m_asJobs[0].poReader = this;
+        m_asJobs[0].iStrip = -1;
+    }
+
+    for (auto &sJob : m_asJobs)
+    {
+        if (!m_poJobQueue->SubmitJob(RunJob, &sJob))
+        {
+            m_bCancel = true;
+            m_poJobQueue->WaitCompletion();
+            m_poJobQueue.reset();
+            m_asJobs.clear();
+            m_aoStrips.clear();
+            m_anReadyStrips.clear();
+            m_bCancel = false;
+            m_bError = false;
+            return false;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                              RunJob()                                */
+/************************************************************************/
+
+void GDALDefaultAsyncReader::RunJob(void *pData)
+{
+    const Job *psJob = static_cast<const Job *>(pData);
+    GDALDefaultAsyncReader *poReader = psJob->poReader;
+
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors;
+    CPLInstallErrorHandlerAccumulator(aoErrors);
+
+    const int nStrips = static_cast<int>(poReader->m_aoStrips.size());
+    const int iFirst = psJob->iStrip >= 0 ? psJob->iStrip : 0;
+    const int iLast = psJob->iStrip >= 0 ? psJob->iStrip : nStrips - 1;
+    for (int iStrip = iFirst; iStrip <= iLast; ++iStrip)
+    {
+        if (poReader->m_bCancel)
+            break;
+        const CPLErr eErr = poReader->ReadStrip(iStrip, psJob->iStrip < 0);
+
+        std::lock_guard oLock(poReader->m_oMutex);
+        --poReader->m_nRemainingStrips;
+        if (eErr == CE_None)
+        {
+            poReader->m_anReadyStrips.push_back(iStrip);
+        }
+        else
+        {
+            poReader->m_bError = true;
+            poReader->m_bCancel = true;
+        }
+        poReader->m_oCV.notify_one();
+    }
+
+    CPLUninstallErrorHandlerAccumulator();
+    if (!aoErrors.empty())
+    {
+        std::lock_guard oLock(poReader->m_oMutex);
+        poReader->m_aoErrors.insert(poReader->m_aoErrors.end(),
+                                    aoErrors.begin(), aoErrors.end());
+    }
+}
+
+/************************************************************************/
+/*                             ReadStrip()                              */
+/************************************************************************/
+
+CPLErr GDALDefaultAsyncReader::ReadStrip(int iStrip, bool bAdviseRead)
+{
+    const int nBufYOff = m_aoStrips[iStrip].first;
+    const int nBufYSizeStrip = m_aoStrips[iStrip].second;
+
+    // Source window corresponding to the strip, so that the resampling
+    // gives the same result as reading the whole request at once.
+    const double dfRatio = static_cast<double>(nYSize) / nBufYSize;
+    const double dfYOff = nYOff + nBufYOff * dfRatio;
+    const double dfYSize = nBufYSizeStrip * dfRatio;
+    const int nSrcYOff =
+        std::max(nYOff, static_cast<int>(std::floor(dfYOff + 1e-10)));
+    const int nSrcYEnd = std::min(
+        nYOff + nYSize,
+        std::max(nSrcYOff + 1,
+                 static_cast<int>(std::ceil(dfYOff + dfYSize - 1e-10))));
+
+    GDALRasterIOExtraArg sExtraArg;
+    INIT_RASTERIO_EXTRA_ARG(sExtraArg);
+    if (nBufYSize != nYSize)
+    {
+        sExtraArg.bFloatingPointWindowValidity = TRUE;
+        sExtraArg.dfXOff = nXOff;
+        sExtraArg.dfYOff = dfYOff;
+        sExtraArg.dfXSize = nXSize;
+        sExtraArg.dfYSize = dfYSize;
+    }
+
+    if (bAdviseRead)
+    {
+        CPL_IGNORE_RET_VAL(poDS->AdviseRead(
+            nXOff, nSrcYOff, nXSize, nSrcYEnd - nSrcYOff, nBufXSize,
+            nBufYSizeStrip, eBufType, nBandCount, panBandMap, nullptr));
+    }
+
+    return poDS->RasterIO(
+        GF_Read, nXOff, nSrcYOff, nXSize, nSrcYEnd - nSrcYOff,
+        static_cast<GByte *>(pBuf) + static_cast<GPtrDiff_t>(nBufYOff) *
+                                         static_cast<GPtrDiff_t>(nLineSpace),
+        nBufXSize, nBufYSizeStrip, eBufType, nBandCount, panBandMap,
+        nPixelSpace, nLineSpace, nBandSpace, &sExtraArg);
+}
+
 /************************************************************************/
 /*                        GetNextUpdatedRegion()                        */
 /************************************************************************/
 
 GDALAsyncStatusType
-GDALDefaultAsyncReader::GetNextUpdatedRegion(double /*dfTimeout*/,
-                                             int *pnBufXOff, int *pnBufYOff,
-                                             int *pnBufXSize, int *pnBufYSize)
+GDALDefaultAsyncReader::GetNextUpdatedRegion(double dfTimeout, int *pnBufXOff,
+                                             int *pnBufYOff, int *pnBufXSize,
+                                             int *pnBufYSize)
 {
-    CPLErr eErr;
-
-    eErr =
-        poDS->RasterIO(GF_Read, nXOff, nYOff, nXSize, nYSize, pBuf, nBufXSize,
-                       nBufYSize, eBufType, nBandCount, panBandMap, nPixelSpace,
-                       nLineSpace, nBandSpace, nullptr);
+    if (!m_bBackground)
+    {
+        CPLErr eErr = poDS->RasterIO(GF_Read, nXOff, nYOff, nXSize, nYSize,
+                                     pBuf, nBufXSize, nBufYSize, eBufType,
+                                     nBandCount, panBandMap, nPixelSpace,
+                                     nLineSpace, nBandSpace, nullptr);
+
+        *pnBufXOff = 0;
+        *pnBufYOff = 0;
+        *pnBufXSize = nBufXSize;
+        *pnBufYSize = nBufYSize;
+
+        if (eErr == CE_None)
+            return GARIO_COMPLETE;
+        else
+            return GARIO_ERROR;
+    }
 
     *pnBufXOff = 0;
     *pnBufYOff = 0;
-    *pnBufXSize = nBufXSize;
-    *pnBufYSize = nBufYSize;
+    *pnBufXSize = 0;
+    *pnBufYSize = 0;
 
-    if (eErr == CE_None)
-        return GARIO_COMPLETE;
-    else
+    std::unique_lock oLock(m_oMutex);
+    const auto IsReady = [this]()
+    {
+        return !m_anReadyStrips.empty() || m_bError ||
+               m_nRemainingStrips == 0;
+    };
+    if (dfTimeout < 0)
+    {
+        m_oCV.wait(oLock, IsReady);
+    }
+    else if (!m_oCV.wait_for(oLock,
+                             std::chrono::duration<double>(dfTimeout),
+                             IsReady))
+    {
+        return GARIO_PENDING;
+    }
+
+    // Emit errors of the worker threads in the calling thread
+    for (const auto &oError : m_aoErrors)
+        CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+    m_aoErrors.clear();
+
+    if (m_bError)
         return GARIO_ERROR;
+
+    if (m_anReadyStrips.empty())
+        return GARIO_COMPLETE;
+
+    const int iStrip = m_anReadyStrips.front();
+    m_anReadyStrips.pop_front();
+    *pnBufXSize = nBufXSize;
+    *pnBufYOff = m_aoStrips[iStrip].first;
+    *pnBufYSize = m_aoStrips[iStrip].second;
+    return m_anReadyStrips.empty() && m_nRemainingStrips == 0 ? GARIO_COMPLETE
+                                                              : GARIO_UPDATE;
 }
@@ -212,6 +212,24 @@ static AntiRecursionStructDefaultOvr &GetAntiRecursionDefaultOvr()
     return *static_cast<AntiRecursionStructDefaultOvr *>(pData);
 }
 
+/************************************************************************/
+/*                        CheckForSidecarFile()                         */
+/************************************************************************/
+
+// Same as CPLCheckForFile(), but going through the sidecar negative cache
+// when there is no sibling file list.
+static bool CheckForSidecarFile(std::vector<char> &achFilename,
+                                char **papszSiblingFiles)
+{
+    if (papszSiblingFiles == nullptr)
+    {
+        VSIStatBufL sStatBuf;
+        return GDALStatSidecarFile(achFilename.data(), &sStatBuf,
+                                   VSI_STAT_EXISTS_FLAG) == 0;
+    }
+    return CPL_TO_BOOL(CPLCheckForFile(achFilename.data(), papszSiblingFiles));
+}
+
 /************************************************************************/
 /*                            OverviewScan()                            */
 /*                                                                      */
@@ -257,8 +275,8 @@ void GDALDefaultOverviews::OverviewScan()
         achOvrFilename.resize(osOvrFilename.size() + 1);
         memcpy(&(achOvrFilename[0]), osOvrFilename.c_str(),
                osOvrFilename.size() + 1);
-        bool bExists = CPL_TO_BOOL(
-            CPLCheckForFile(&achOvrFilename[0], papszInitSiblingFiles));
+        bool bExists =
+            CheckForSidecarFile(achOvrFilename, papszInitSiblingFiles);
         osOvrFilename = &achOvrFilename[0];
 
 #if !defined(_WIN32)
@@ -267,8 +285,8 @@ void GDALDefaultOverviews::OverviewScan()
             osOvrFilename.Printf("%s.OVR", pszInitName);
             memcpy(&(achOvrFilename[0]), osOvrFilename.c_str(),
                    osOvrFilename.size() + 1);
-            bExists = CPL_TO_BOOL(
-                CPLCheckForFile(&achOvrFilename[0], papszInitSiblingFiles));
+            bExists =
+                CheckForSidecarFile(achOvrFilename, papszInitSiblingFiles);
             osOvrFilename = &achOvrFilename[0];
             if (!bExists)
                 osOvrFilename.Printf("%s.ovr", pszInitName);
@@ -702,6 +720,9 @@ CPLErr GDALDefaultOverviews::BuildOverviews(
             osOvrFilename.Printf("%s.ovr", pszBasename);
     }
 
+    // The overview file may have been remembered as missing.
+    GDALInvalidateSidecarFileCache(osOvrFilename);
+
     /* -------------------------------------------------------------------- */
     /*      Establish which of the overview levels we already have, and     */
     /*      which are new.  We assume that band 1 of the file is            */
@@ -1293,8 +1314,7 @@ int GDALDefaultOverviews::HaveMaskFile(char **papszSiblingFiles,
     achMskFilename.resize(osMskFilename.size() + 1);
     memcpy(&(achMskFilename[0]), osMskFilename.c_str(),
            osMskFilename.size() + 1);
-    bool bExists =
-        CPL_TO_BOOL(CPLCheckForFile(&achMskFilename[0], papszSiblingFiles));
+    bool bExists = CheckForSidecarFile(achMskFilename, papszSiblingFiles);
     osMskFilename = &achMskFilename[0];
 
 #if !defined(_WIN32)
@@ -1303,8 +1323,7 @@ int GDALDefaultOverviews::HaveMaskFile(char **papszSiblingFiles,
         osMskFilename.Printf("%s.MSK", pszBasename);
         memcpy(&(achMskFilename[0]), osMskFilename.c_str(),
                osMskFilename.size() + 1);
-        bExists =
-            CPL_TO_BOOL(CPLCheckForFile(&achMskFilename[0], papszSiblingFiles));
+        bExists = CheckForSidecarFile(achMskFilename, papszSiblingFiles);
         osMskFilename = &achMskFilename[0];
     }
 #endif
@@ -273,6 +273,9 @@ GDALDataset *GDALDriver::Create(const char *pszFilename, int nXSize, int nYSize,
              GetDescription(), pszFilename, nXSize, nYSize, nBands,
              GDALGetDataTypeName(eType), papszOptions);
 
+    // The new file may be a sidecar file remembered as missing.
+    GDALInvalidateSidecarFileCache(pszFilename);
+
     GDALDataset *poDS = nullptr;
     if (pfnCreateEx != nullptr)
     {
@@ -1288,6 +1291,9 @@ GDALDataset *GDALDriver::CreateCopy(const char *pszFilename,
         QuietDeleteForCreateCopy(pszFilename, poSrcDS);
     }
 
+    // The new file may be a sidecar file remembered as missing.
+    GDALInvalidateSidecarFileCache(pszFilename);
+
     int iIdxQuietDeleteOnCreateCopy =
         CSLPartialFindString(papszOptions, "@QUIET_DELETE_ON_CREATE_COPY=");
     if (iIdxQuietDeleteOnCreateCopy >= 0)
@@ -2705,6 +2711,9 @@ GDALDriverH CPL_STDCALL GDALIdentifyDriverEx(
             poDriver->GetMetadataItem(GDAL_DCAP_VECTOR) == nullptr)
             continue;
 
+        if (!poDriver->HeaderMatchesMagicBytes(&oOpenInfo))
+            continue;
+
         if (poDriver->pfnIdentifyEx)
         {
             if (poDriver->pfnIdentifyEx(poDriver, &oOpenInfo) > 0)
@@ -2755,6 +2764,9 @@ GDALDriverH CPL_STDCALL GDALIdentifyDriverEx(
             poDriver->GetMetadataItem(GDAL_DCAP_VECTOR) == nullptr)
             continue;
 
+        if (!poDriver->HeaderMatchesMagicBytes(&oOpenInfo))
+            continue;
+
         if (poDriver->pfnIdentifyEx != nullptr)
         {
             if (poDriver->pfnIdentifyEx(poDriver, &oOpenInfo) == 0)
@@ -2820,10 +2832,70 @@ CPLErr GDALDriver::SetMetadataItem(const char *pszName, const char *pszValue,
         {
             GDALMajorObject::SetMetadataItem(GDAL_DMD_EXTENSION, pszValue);
         }
+        else if (EQUAL(pszName, GDAL_DMD_MAGIC_BYTES))
+        {
+            m_aabyMagicBytes.clear();
+            const CPLStringList aosSignatures(
+                CSLTokenizeString2(pszValue ? pszValue : "", " ", 0));
+            for (const char *pszSignature : aosSignatures)
+            {
+                int nBytes = 0;
+                GByte *pabyBytes = CPLHexToBinary(pszSignature, &nBytes);
+                const size_t nLen = strlen(pszSignature);
+                if (nBytes > 0 && static_cast<size_t>(nBytes) * 2 == nLen &&
+                    strspn(pszSignature, "0123456789abcdefABCDEF") == nLen)
+                {
+                    m_aabyMagicBytes.emplace_back(pabyBytes,
+                                                  pabyBytes + nBytes);
+                }
+                else
+                {
+                    CPLError(CE_Warning, CPLE_AppDefined,
+                             "%s: invalid signature '%s' in %s",
+                             GetDescription(), pszSignature,
+                             GDAL_DMD_MAGIC_BYTES);
+                }
+                CPLFree(pabyBytes);
+            }
+        }
     }
     return GDALMajorObject::SetMetadataItem(pszName, pszValue, pszDomain);
 }
 
+/************************************************************************/
+/*                      HeaderMatchesMagicBytes()                       */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+/** Returns whether the file header of poOpenInfo may be recognized by the
+ * driver, according to its GDAL_DMD_MAGIC_BYTES signatures.
+ *
+ * This is a cheap pre-filter run before Identify(): it only returns false
+ * for an opened file whose header does not start with any of the declared
+ * signatures, and true if the driver declares none.
+ */
+bool GDALDriver::HeaderMatchesMagicBytes(const GDALOpenInfo *poOpenInfo) const
+{
+    if (m_aabyMagicBytes.empty() || poOpenInfo->fpL == nullptr ||
+        poOpenInfo->nHeaderBytes <= 0)
+    {
+        return true;
+    }
+    for (const auto &abySignature : m_aabyMagicBytes)
+    {
+        if (static_cast<size_t>(poOpenInfo->nHeaderBytes) >=
+                abySignature.size() &&
+            memcmp(poOpenInfo->pabyHeader, abySignature.data(),
+                   abySignature.size()) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//! @endcond
+
 /************************************************************************/
 /*                   DoesDriverHandleExtension()                        */
 /************************************************************************/
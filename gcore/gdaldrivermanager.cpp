@@ -1283,6 +1283,7 @@ static const char *const apszProxyMetadataItems[] = {
     GDAL_DMD_LONGNAME,
     GDAL_DMD_EXTENSIONS,
     GDAL_DMD_EXTENSION,
+    GDAL_DMD_MAGIC_BYTES,
     GDAL_DCAP_RASTER,
     GDAL_DCAP_MULTIDIM_RASTER,
     GDAL_DCAP_VECTOR,
@@ -1321,8 +1322,9 @@ const char *GDALPluginDriverProxy::GetMetadataItem(const char *pszName,
         }
         else if (EQUAL(pszName, "MISSING_PLUGIN_FILENAME"))
         {
-            return m_osPluginFullPath.empty() ? m_osPluginFileName.c_str()
-                                              : nullptr;
+            return m_osPluginFullPath.empty() && !m_pfnBuiltinRegister
+                       ? m_osPluginFileName.c_str()
+                       : nullptr;
         }
         else if (IsListedProxyMetadataItem(pszName))
         {
@@ -1362,7 +1364,7 @@ GDALDriver *GDALPluginDriverProxy::GetRealDriver()
 {
     // No need to take the mutex has this member variable is not modified
     // under the mutex.
-    if (m_osPluginFullPath.empty())
+    if (m_osPluginFullPath.empty() && !m_pfnBuiltinRegister)
         return nullptr;
 
     CPLMutexHolderD(&hDMMutex);
@@ -1377,6 +1379,38 @@ GDALDriver *GDALPluginDriverProxy::GetRealDriver()
         m_poRealDriver = std::move(oIter->second);
         poDriverManager->m_oMapRealDrivers.erase(oIter);
     }
+    else if (m_pfnBuiltinRegister)
+    {
+        CPLDebug("GDAL", "On-demand registering built-in driver %s.",
+                 GetDescription());
+
+        poDriverManager->m_bInDeferredDriverLoading = true;
+        try
+        {
+            m_pfnBuiltinRegister();
+        }
+        catch (...)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Registration of driver %s threw an exception",
+                     GetDescription());
+        }
+        poDriverManager->m_bInDeferredDriverLoading = false;
+
+        oIter = poDriverManager->m_oMapRealDrivers.find(GetDescription());
+        if (oIter == poDriverManager->m_oMapRealDrivers.end())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Registration function of built-in driver %s did not "
+                     "register it",
+                     GetDescription());
+        }
+        else
+        {
+            m_poRealDriver = std::move(oIter->second);
+            poDriverManager->m_oMapRealDrivers.erase(oIter);
+        }
+    }
     else
     {
         CPLString osFuncName;
@@ -1642,6 +1676,18 @@ void GDALDriverManager::DeclareDeferredPluginDriver(
 {
     CPLMutexHolderD(&hDMMutex);
 
+    if (m_pfnPendingBuiltinRegister)
+    {
+        if (GDALGetDriverByName(poProxyDriver->GetDescription()))
+        {
+            delete poProxyDriver;
+            return;
+        }
+        poProxyDriver->m_pfnBuiltinRegister = m_pfnPendingBuiltinRegister;
+        RegisterDriver(poProxyDriver);
+        return;
+    }
+
     const auto &osPluginFileName = poProxyDriver->GetPluginFileName();
     const char *pszPluginFileName = osPluginFileName.c_str();
     if ((!STARTS_WITH(pszPluginFileName, "gdal_") &&
@@ -1681,6 +1727,32 @@ void GDALDriverManager::DeclareDeferredPluginDriver(
     }
 }
 
+/************************************************************************/
+/*                    DeclareDeferredBuiltinDriver()                    */
+/************************************************************************/
+
+/** Declare drivers built in libgdal, whose full registration is deferred
+ * until they are actually needed.
+ *
+ * pfnDeclare is the DeclareDeferredXXXPlugin() function of the driver core
+ * sources, which registers GDALPluginDriverProxy instances with the
+ * identification metadata of the drivers. pfnRegister is the regular
+ * registration function of the drivers, which is called the first time the
+ * real driver is needed.
+ *
+ * This is used by GDALAllRegister() when GDAL is built with the
+ * GDAL_ENABLE_DEFERRED_BUILTIN_DRIVERS CMake option.
+ */
+void GDALDriverManager::DeclareDeferredBuiltinDriver(void (*pfnDeclare)(),
+                                                     void (*pfnRegister)())
+{
+    CPLMutexHolderD(&hDMMutex);
+
+    m_pfnPendingBuiltinRegister = pfnRegister;
+    pfnDeclare();
+    m_pfnPendingBuiltinRegister = nullptr;
+}
+
 /************************************************************************/
 /*                      GDALDestroyDriverManager()                      */
 /************************************************************************/
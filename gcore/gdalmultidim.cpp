@@ -46,6 +46,7 @@
 #include "memmultidim.h"
 #include "ogrsf_frmts.h"
 #include "gdalmultidim_priv.h"
+#include "gdal_thread_pool.h"
 
 #if defined(__clang__) || defined(_MSC_VER)
 #define COMPILER_WARNS_ABOUT_ABSTRACT_VBASE_INIT
@@ -3786,6 +3787,11 @@ bool GDALMDArray::CopyFromAllExceptValues(const GDALMDArray *poSrcArray,
  * @param pfnProgress Progress callback, or nullptr.
  * @param pProgressData Progress user data, or nulptr.
  *
+ * Starting with GDAL 3.10, when the GDAL_NUM_THREADS configuration option is
+ * set to a value greater than 1 (or ALL_CPUS), the writing of a chunk into
+ * this array is done in a worker thread while the next chunk is read from
+ * the source array.
+ *
  * @return true in case of success (or partial success if bStrict == false).
  */
 bool GDALMDArray::CopyFrom(CPL_UNUSED GDALDataset *poSrcDS,
@@ -3830,10 +3836,57 @@ bool GDALMDArray::CopyFrom(CPL_UNUSED GDALDataset *poSrcDS,
             count[i] = static_cast<size_t>(dims[i]->GetSize());
         }
 
-        struct CopyFunc
+        // Write of a chunk, possibly run in a worker thread while the next
+        // chunk is read from the source array.
+        struct CopyWriteJob
         {
             GDALMDArray *poDstArray = nullptr;
+            const GDALExtendedDataType *pDT = nullptr;
             std::vector<GByte> abyTmp{};
+            std::vector<GUInt64> anStartIdx{};
+            std::vector<size_t> anCount{};
+            std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+            bool bRet = true;
+
+            void Run()
+            {
+                const auto &dt = *pDT;
+                bRet = poDstArray->Write(anStartIdx.data(), anCount.data(),
+                                         nullptr, nullptr, dt, &abyTmp[0]);
+                if (dt.NeedsFreeDynamicMemory())
+                {
+                    const auto l_nDTSize = dt.GetSize();
+                    GByte *ptr = &abyTmp[0];
+                    size_t nEltCount = 1;
+                    for (const auto nCount : anCount)
+                    {
+                        nEltCount *= nCount;
+                    }
+                    for (size_t i = 0; i < nEltCount; i++)
+                    {
+                        dt.FreeDynamicMemory(ptr);
+                        ptr += l_nDTSize;
+                    }
+                }
+            }
+
+            static void RunInThread(void *pData)
+            {
+                auto psJob = static_cast<CopyWriteJob *>(pData);
+                CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+                psJob->Run();
+                CPLUninstallErrorHandlerAccumulator();
+            }
+        };
+
+        struct CopyFunc
+        {
+            GDALMDArray *poDstArray = nullptr;
+            // Two jobs when writes are pipelined with reads, one otherwise
+            std::vector<CopyWriteJob> asJobs{};
+            size_t iCurJob = 0;
+            CPLJobQueue *poJobQueue = nullptr;
+            bool bPendingJob = false;
             GDALProgressFunc pfnProgress = nullptr;
             void *pProgressData = nullptr;
             GUInt64 nCurCost = 0;
@@ -3841,6 +3894,22 @@ bool GDALMDArray::CopyFrom(CPL_UNUSED GDALDataset *poSrcDS,
             GUInt64 nTotalBytesThisArray = 0;
             bool bStop = false;
 
+            // Wait for the write of the previous chunk, if any.
+            bool WaitPendingJob()
+            {
+                if (!bPendingJob)
+                    return true;
+                bPendingJob = false;
+                poJobQueue->WaitCompletion();
+                auto &sJob = asJobs[1 - iCurJob];
+                for (const auto &oError : sJob.aoErrors)
+                {
+                    CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+                }
+                sJob.aoErrors.clear();
+                return sJob.bRet;
+            }
+
             static bool f(GDALAbstractMDArray *l_poSrcArray,
                           const GUInt64 *chunkArrayStartIdx,
                           const size_t *chunkCount, GUInt64 iCurChunk,
@@ -3848,34 +3917,40 @@ bool GDALMDArray::CopyFrom(CPL_UNUSED GDALDataset *poSrcDS,
             {
                 const auto &dt(l_poSrcArray->GetDataType());
                 auto data = static_cast<CopyFunc *>(pUserData);
-                auto poDstArray = data->poDstArray;
-                if (!l_poSrcArray->Read(chunkArrayStartIdx, chunkCount, nullptr,
-                                        nullptr, dt, &data->abyTmp[0]))
+                auto &sJob = data->asJobs[data->iCurJob];
+                // When pipelined, the previous chunk is being written while
+                // this one is read.
+                const bool bReadOK =
+                    l_poSrcArray->Read(chunkArrayStartIdx, chunkCount, nullptr,
+                                       nullptr, dt, &sJob.abyTmp[0]);
+                if (!data->WaitPendingJob() || !bReadOK)
                 {
                     return false;
                 }
-                bool bRet =
-                    poDstArray->Write(chunkArrayStartIdx, chunkCount, nullptr,
-                                      nullptr, dt, &data->abyTmp[0]);
-                if (dt.NeedsFreeDynamicMemory())
+
+                const size_t l_nDims(l_poSrcArray->GetDimensionCount());
+                sJob.poDstArray = data->poDstArray;
+                sJob.pDT = &dt;
+                sJob.anStartIdx.assign(chunkArrayStartIdx,
+                                       chunkArrayStartIdx + l_nDims);
+                sJob.anCount.assign(chunkCount, chunkCount + l_nDims);
+                if (data->poJobQueue)
                 {
-                    const auto l_nDTSize = dt.GetSize();
-                    GByte *ptr = &data->abyTmp[0];
-                    const size_t l_nDims(l_poSrcArray->GetDimensionCount());
-                    size_t nEltCount = 1;
-                    for (size_t i = 0; i < l_nDims; ++i)
+                    if (!data->poJobQueue->SubmitJob(CopyWriteJob::RunInThread,
+                                                     &sJob))
                     {
-                        nEltCount *= chunkCount[i];
-                    }
-                    for (size_t i = 0; i < nEltCount; i++)
-                    {
-                        dt.FreeDynamicMemory(ptr);
-                        ptr += l_nDTSize;
+                        return false;
                     }
+                    data->bPendingJob = true;
+                    data->iCurJob = 1 - data->iCurJob;
                 }
-                if (!bRet)
+                else
                 {
-                    return false;
+                    sJob.Run();
+                    if (!sJob.bRet)
+                    {
+                        return false;
+                    }
                 }
 
                 double dfCurCost =
@@ -3915,9 +3990,29 @@ bool GDALMDArray::CopyFrom(CPL_UNUSED GDALDataset *poSrcDS,
         {
             nRealChunkSize *= nChunkSize;
         }
+
+        // When several threads are allowed, and there is more than one
+        // chunk, write a chunk into the destination array (which generally
+        // involves compression) while the next one is read from the source.
+        int nThreads = 1;
+        if (poSrcArray != this &&
+            copyFunc.nTotalBytesThisArray > nRealChunkSize)
+        {
+            const char *pszThreads =
+                CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+            nThreads = EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                      : atoi(pszThreads);
+        }
+        CPLWorkerThreadPool *poThreadPool =
+            nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+        auto poJobQueue =
+            poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+        copyFunc.poJobQueue = poJobQueue.get();
         try
         {
-            copyFunc.abyTmp.resize(nRealChunkSize);
+            copyFunc.asJobs.resize(poJobQueue ? 2 : 1);
+            for (auto &sJob : copyFunc.asJobs)
+                sJob.abyTmp.resize(nRealChunkSize);
         }
         catch (const std::exception &)
         {
@@ -3926,12 +4021,14 @@ bool GDALMDArray::CopyFrom(CPL_UNUSED GDALDataset *poSrcDS,
             nCurCost += copyFunc.nTotalBytesThisArray;
             return false;
         }
-        if (copyFunc.nTotalBytesThisArray != 0 &&
-            !const_cast<GDALMDArray *>(poSrcArray)
-                 ->ProcessPerChunk(arrayStartIdx.data(), count.data(),
-                                   anChunkSizes.data(), CopyFunc::f,
-                                   &copyFunc) &&
-            (bStrict || copyFunc.bStop))
+        bool bOK = copyFunc.nTotalBytesThisArray == 0 ||
+                   const_cast<GDALMDArray *>(poSrcArray)
+                       ->ProcessPerChunk(arrayStartIdx.data(), count.data(),
+                                         anChunkSizes.data(), CopyFunc::f,
+                                         &copyFunc);
+        if (!copyFunc.WaitPendingJob())
+            bOK = false;
+        if (!bOK && (bStrict || copyFunc.bStop))
         {
             nCurCost += copyFunc.nTotalBytesThisArray;
             return false;
@@ -6166,8 +6263,46 @@ bool GDALMDArrayUnscaled::IRead(const GUInt64 *arrayStartIdx,
     GDALExtendedDataType::CopyValue(m_abyRawNoData.data(), m_dt, abyDstNoData,
                                     bufferDataType);
 
+    // When converting to a numeric buffer data type, unscale the values of
+    // the last dimension in the temporary buffer, and convert them at once
+    // with CopyValues(), instead of value per value.
+    const bool bConvertWholeRows =
+        bTempBufferNeeded && bufferDataType.GetClass() == GEDTC_NUMERIC;
+    std::vector<size_t> anNoDataIdx;
+
 lbl_next_depth:
-    if (dimIdx == nDimsMinus1)
+    if (dimIdx == nDimsMinus1 && bConvertWholeRows)
+    {
+        const size_t nIters = count[dimIdx];
+        double *padfVal = stack[dimIdx].src_ptr;
+        const auto src_inc_offset = stack[dimIdx].src_inc_offset;
+        anNoDataIdx.clear();
+        for (size_t i = 0; i < nIters; ++i, padfVal += src_inc_offset)
+        {
+            if (!m_bHasNoData || padfVal[0] != adfSrcNoData[0])
+            {
+                padfVal[0] = padfVal[0] * dfScale + dfOffset;
+                if (bDTIsComplex)
+                {
+                    padfVal[1] = padfVal[1] * dfScale + dfOffset;
+                }
+            }
+            else
+            {
+                anNoDataIdx.push_back(i);
+            }
+        }
+        GDALExtendedDataType::CopyValues(
+            stack[dimIdx].src_ptr, dtDouble, actualBufferStridePtr[dimIdx],
+            stack[dimIdx].dst_ptr, bufferDataType, bufferStride[dimIdx],
+            nIters);
+        for (const size_t i : anNoDataIdx)
+        {
+            memcpy(stack[dimIdx].dst_ptr + i * stack[dimIdx].dst_inc_offset,
+                   abyDstNoData, nBufferDTSize);
+        }
+    }
+    else if (dimIdx == nDimsMinus1)
     {
         auto nIters = count[dimIdx];
         double *padfVal = stack[dimIdx].src_ptr;
@@ -13409,14 +13544,38 @@ bool GDALMDArrayRegularlySpaced::IRead(
     void *pDstBuffer) const
 {
     GByte *pabyDstBuffer = static_cast<GByte *>(pDstBuffer);
-    for (size_t i = 0; i < count[0]; i++)
+    if (bufferDataType.GetClass() != GEDTC_NUMERIC)
     {
-        const double dfVal = m_dfStart + (arrayStartIdx[0] + i * arrayStep[0] +
-                                          m_dfOffsetInIncrement) *
-                                             m_dfIncrement;
-        GDALExtendedDataType::CopyValue(&dfVal, m_dt, pabyDstBuffer,
-                                        bufferDataType);
-        pabyDstBuffer += bufferStride[0] * bufferDataType.GetSize();
+        for (size_t i = 0; i < count[0]; i++)
+        {
+            const double dfVal =
+                m_dfStart + (arrayStartIdx[0] + i * arrayStep[0] +
+                             m_dfOffsetInIncrement) *
+                                m_dfIncrement;
+            GDALExtendedDataType::CopyValue(&dfVal, m_dt, pabyDstBuffer,
+                                            bufferDataType);
+            pabyDstBuffer += bufferStride[0] * bufferDataType.GetSize();
+        }
+        return true;
+    }
+
+    // Compute values by chunks, and convert them at once to the buffer data
+    // type.
+    constexpr size_t CHUNK_SIZE = 256;
+    double adfVal[CHUNK_SIZE];
+    for (size_t i = 0; i < count[0]; i += CHUNK_SIZE)
+    {
+        const size_t nVals = std::min(CHUNK_SIZE, count[0] - i);
+        for (size_t j = 0; j < nVals; ++j)
+        {
+            adfVal[j] = m_dfStart + (arrayStartIdx[0] + (i + j) * arrayStep[0] +
+                                     m_dfOffsetInIncrement) *
+                                        m_dfIncrement;
+        }
+        GDALExtendedDataType::CopyValues(adfVal, m_dt, 1, pabyDstBuffer,
+                                         bufferDataType, bufferStride[0],
+                                         nVals);
+        pabyDstBuffer += nVals * bufferStride[0] * bufferDataType.GetSize();
     }
     return true;
 }
@@ -908,8 +908,9 @@ CPLErr GDALPamDataset::TryLoadXML(char **papszSiblingFiles)
             psTree = CPLParseXMLFile(psPam->pszPamFilename);
         }
     }
-    else if (VSIStatExL(psPam->pszPamFilename, &sStatBuf,
-                        VSI_STAT_EXISTS_FLAG | VSI_STAT_NATURE_FLAG) == 0 &&
+    else if (GDALStatSidecarFile(psPam->pszPamFilename, &sStatBuf,
+                                 VSI_STAT_EXISTS_FLAG | VSI_STAT_NATURE_FLAG) ==
+                 0 &&
              VSI_ISREG(sStatBuf.st_mode))
     {
         CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
@@ -999,6 +1000,9 @@ CPLErr GDALPamDataset::TrySaveXML()
     if (!BuildPamFilename())
         return CE_None;
 
+    // The .aux.xml file may have been remembered as missing.
+    GDALInvalidateSidecarFileCache(psPam->pszPamFilename);
+
     /* -------------------------------------------------------------------- */
     /*      Build the XML representation of the auxiliary metadata.          */
     /* -------------------------------------------------------------------- */
@@ -297,6 +297,11 @@ RB_PROXY_METHOD_WITH_RET_WITH_INIT_BLOCK(CPLErr, CE_Failure, IWriteBlock,
                                          (int nXBlockOff, int nYBlockOff,
                                           void *pImage),
                                          (nXBlockOff, nYBlockOff, pImage))
+RB_PROXY_METHOD_WITH_RET_WITH_INIT_BLOCK(
+    CPLErr, CE_Failure, IReadBlocks,
+    (int nBlockCount, const int *panXBlockOff, const int *panYBlockOff,
+     void *const *papImages),
+    (nBlockCount, panXBlockOff, panYBlockOff, papImages))
 
 CPLErr GDALProxyRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                                       int nXSize, int nYSize, void *pData,
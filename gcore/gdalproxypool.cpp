@@ -39,6 +39,7 @@
 #include "cpl_error.h"
 #include "cpl_hash_set.h"
 #include "cpl_multiproc.h"
+#include "cpl_runtime_metrics.h"
 #include "cpl_string.h"
 #include "gdal.h"
 #include "gdal_priv.h"
@@ -76,6 +77,10 @@ struct _GDALProxyPoolCacheEntry
     /* Ref count of the cached dataset */
     int refCount;
 
+    /* Id of the thread opening poDS, while the pool mutex is released, or 0
+     */
+    GIntBig nOpeningThreadId;
+
     GDALProxyPoolCacheEntry *prev;
     GDALProxyPoolCacheEntry *next;
 };
@@ -113,6 +118,10 @@ class GDALDatasetPool
      * ghost */
     int refCountOfDisableRefCount = 0;
 
+    /* Same as refCountOfDisableRefCount, but for datasets opened by the */
+    /* current thread while the pool mutex is released. */
+    static thread_local int tlsRefCountOfDisableRefCount;
+
     /* Caution : to be sure that we don't run out of entries, size must be at */
     /* least greater or equal than the maximum number of threads */
     explicit GDALDatasetPool(int maxSize, int64_t nMaxRAMUsage);
@@ -152,6 +161,8 @@ class GDALDatasetPool
     static void ForceDestroy();
 };
 
+thread_local int GDALDatasetPool::tlsRefCountOfDisableRefCount = 0;
+
 /************************************************************************/
 /*                         GDALDatasetPool()                            */
 /************************************************************************/
@@ -293,9 +304,10 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
             /* dataset */
             GDALSetResponsiblePIDForCurrentThread(candidate->responsiblePID);
 
-            refCountOfDisableRefCount++;
+            tlsRefCountOfDisableRefCount++;
             GDALClose(candidate->poDS);
-            refCountOfDisableRefCount--;
+            tlsRefCountOfDisableRefCount--;
+            CPLRuntimeMetricAdd(CPLRuntimeMetric::DATASET_POOL_EVICTIONS);
 
             candidate->poDS = nullptr;
             GDALSetResponsiblePIDForCurrentThread(responsiblePID);
@@ -336,11 +348,17 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
     const std::string osFilenameAndOO =
         GetFilenameAndOpenOptions(pszFileName, papszOpenOptions);
 
+    const GIntBig nThreadId = CPLGetPID();
+
     while (cur)
     {
         GDALProxyPoolCacheEntry *next = cur->next;
 
+        // Entries being opened by other threads are skipped: we rather open
+        // another handle than waiting for them.
         if (cur->pszFileNameAndOpenOptions &&
+            (cur->nOpeningThreadId == 0 ||
+             cur->nOpeningThreadId == nThreadId) &&
             osFilenameAndOO == cur->pszFileNameAndOpenOptions &&
             ((bShared && cur->responsiblePID == responsiblePID &&
               ((cur->pszOwner == nullptr && pszOwner == nullptr) ||
@@ -367,6 +385,7 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
             }
 
             cur->refCount++;
+            CPLRuntimeMetricAdd(CPLRuntimeMetric::DATASET_POOL_HITS);
             return cur;
         }
 
@@ -376,6 +395,8 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
     if (!bForceOpen)
         return nullptr;
 
+    CPLRuntimeMetricAdd(CPLRuntimeMetric::DATASET_POOL_MISSES);
+
     if (currentSize == maxSize)
     {
         if (!EvictEntryWithZeroRefCount(false))
@@ -416,14 +437,27 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
     cur->responsiblePID = responsiblePID;
     cur->refCount = 1;
     cur->nRAMUsage = 0;
+    cur->nOpeningThreadId = nThreadId;
+
+    // The entry is reserved by its reference count, so we can release the
+    // mutex while opening, which may be slow, to let other threads use the
+    // pool in the meantime.
+    CPLReleaseMutex(*GDALGetphDLMutex());
 
-    refCountOfDisableRefCount++;
+    tlsRefCountOfDisableRefCount++;
     int nFlag = ((eAccess == GA_Update) ? GDAL_OF_UPDATE : GDAL_OF_READONLY) |
                 GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR;
-    CPLConfigOptionSetter oSetter("CPL_ALLOW_VSISTDIN", "NO", true);
-    cur->poDS = GDALDataset::Open(pszFileName, nFlag, nullptr, papszOpenOptions,
-                                  nullptr);
-    refCountOfDisableRefCount--;
+    GDALDataset *poDS = nullptr;
+    {
+        CPLConfigOptionSetter oSetter("CPL_ALLOW_VSISTDIN", "NO", true);
+        poDS = GDALDataset::Open(pszFileName, nFlag, nullptr, papszOpenOptions,
+                                 nullptr);
+    }
+    tlsRefCountOfDisableRefCount--;
+
+    CPLAcquireMutex(*GDALGetphDLMutex(), 1000.0);
+    cur->poDS = poDS;
+    cur->nOpeningThreadId = 0;
 
     if (cur->poDS)
     {
@@ -489,9 +523,9 @@ void GDALDatasetPool::_CloseDatasetIfZeroRefCount(const char *pszFileName,
             CPLFree(cur->pszOwner);
             cur->pszOwner = nullptr;
 
-            refCountOfDisableRefCount++;
+            tlsRefCountOfDisableRefCount++;
             GDALClose(poDS);
-            refCountOfDisableRefCount--;
+            tlsRefCountOfDisableRefCount--;
 
             GDALSetResponsiblePIDForCurrentThread(responsiblePID);
             break;
@@ -533,7 +567,8 @@ void GDALDatasetPool::Ref()
 
         singleton = new GDALDatasetPool(l_maxSize, l_nMaxRAMUsage);
     }
-    if (singleton->refCountOfDisableRefCount == 0)
+    if (singleton->refCountOfDisableRefCount == 0 &&
+        tlsRefCountOfDisableRefCount == 0)
         singleton->refCount++;
 }
 
@@ -566,7 +601,8 @@ void GDALDatasetPool::Unref()
         CPLAssert(false);
         return;
     }
-    if (singleton->refCountOfDisableRefCount == 0)
+    if (singleton->refCountOfDisableRefCount == 0 &&
+        tlsRefCountOfDisableRefCount == 0)
     {
         singleton->refCount--;
         if (singleton->refCount == 0)
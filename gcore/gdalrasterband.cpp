@@ -39,20 +39,32 @@
 #include <cstdlib>
 #include <cstring>
 #include <algorithm>
+#include <atomic>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <new>
 #include <type_traits>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
+#include "cpl_multiproc.h"
 #include "cpl_progress.h"
+#include "cpl_runtime_metrics.h"
 #include "cpl_string.h"
+#include "cpl_trace.h"
 #include "cpl_virtualmem.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_rat.h"
+#include "gdalblockprefetcher.h"
 #include "gdal_priv_templates.hpp"
+#include "gdal_thread_pool.h"
+
+static void DeleteBlockStatistics(GDALRasterBandBlockStatistics *);
 
 /************************************************************************/
 /*                           GDALRasterBand()                           */
@@ -85,6 +97,9 @@ GDALRasterBand::GDALRasterBand(int bForceCachedIOIn)
 GDALRasterBand::~GDALRasterBand()
 
 {
+    delete m_poPrefetcher;
+    DeleteBlockStatistics(m_poBlockStatistics);
+
     if (poDS && poDS->IsMarkedSuppressOnClose())
     {
         if (poBandBlockCache)
@@ -416,6 +431,7 @@ CPLErr GDALRasterBand::RasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
 
     const bool bCallLeaveReadWrite = CPL_TO_BOOL(EnterReadWrite(eRWFlag));
 
+    CPL_TRACE_SCOPE("GDALRasterBand::IRasterIO");
     CPLErr eErr;
     if (bForceCachedIO)
         eErr = GDALRasterBand::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
@@ -426,6 +442,9 @@ CPLErr GDALRasterBand::RasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
             IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize,
                       nBufYSize, eBufType, nPixelSpace, nLineSpace, psExtraArg);
 
+    if (eRWFlag == GF_Write)
+        InvalidateBlockStatistics(nXOff, nYOff, nXSize, nYSize);
+
     if (bCallLeaveReadWrite)
         LeaveReadWrite();
 
@@ -595,35 +614,774 @@ CPLErr GDALRasterBand::ReadBlock(int nXBlockOff, int nYBlockOff, void *pImage)
         return (CE_Failure);
     }
 
-    /* -------------------------------------------------------------------- */
-    /*      Invoke underlying implementation method.                        */
-    /* -------------------------------------------------------------------- */
-
-    int bCallLeaveReadWrite = EnterReadWrite(GF_Read);
-    CPLErr eErr = IReadBlock(nXBlockOff, nYBlockOff, pImage);
-    if (bCallLeaveReadWrite)
-        LeaveReadWrite();
-    return eErr;
+    /* -------------------------------------------------------------------- */
+    /*      Invoke underlying implementation method.                        */
+    /* -------------------------------------------------------------------- */
+
+    int bCallLeaveReadWrite = EnterReadWrite(GF_Read);
+    CPLErr eErr;
+    {
+        CPL_TRACE_SCOPE("GDALRasterBand::IReadBlock");
+        eErr = IReadBlock(nXBlockOff, nYBlockOff, pImage);
+    }
+    if (bCallLeaveReadWrite)
+        LeaveReadWrite();
+    return eErr;
+}
+
+/************************************************************************/
+/*                           GDALReadBlock()                            */
+/************************************************************************/
+
+/**
+ * \brief Read a block of image data efficiently.
+ *
+ * @see GDALRasterBand::ReadBlock()
+ */
+
+CPLErr CPL_STDCALL GDALReadBlock(GDALRasterBandH hBand, int nXOff, int nYOff,
+                                 void *pData)
+
+{
+    VALIDATE_POINTER1(hBand, "GDALReadBlock", CE_Failure);
+
+    GDALRasterBand *poBand = GDALRasterBand::FromHandle(hBand);
+    return (poBand->ReadBlock(nXOff, nYOff, pData));
+}
+
+/************************************************************************/
+/*                             ReadBlocks()                             */
+/************************************************************************/
+
+/**
+ * \brief Read several blocks of image data efficiently.
+ *
+ * This method is equivalent to calling ReadBlock() for each of the
+ * nBlockCount blocks, but gives the driver the opportunity to process the
+ * whole request at once, typically to coalesce the underlying I/O into a
+ * multi-range read, or to decode blocks in parallel.
+ *
+ * As with ReadBlock(), the block cache is not used, and each buffer of
+ * papImages must be large enough to hold GetBlockXSize()*GetBlockYSize()
+ * words of type GetRasterDataType().
+ *
+ * If at least one block cannot be read, CE_Failure is returned, and the
+ * content of all buffers is undefined.
+ *
+ * This method is the same as the C function GDALReadBlocks().
+ *
+ * @param nBlockCount number of blocks to read.
+ * @param panXBlockOff array of nBlockCount horizontal block offsets.
+ * @param panYBlockOff array of nBlockCount vertical block offsets.
+ * @param papImages array of nBlockCount buffers into which the data of each
+ * block is read.
+ *
+ * @return CE_None on success or CE_Failure on an error.
+ *
+ * @since GDAL 3.10
+ */
+
+CPLErr GDALRasterBand::ReadBlocks(int nBlockCount, const int *panXBlockOff,
+                                  const int *panYBlockOff,
+                                  void *const *papImages)
+
+{
+    /* -------------------------------------------------------------------- */
+    /*      Validate arguments.                                             */
+    /* -------------------------------------------------------------------- */
+    if (nBlockCount == 0)
+        return CE_None;
+    if (nBlockCount < 0 || panXBlockOff == nullptr ||
+        panYBlockOff == nullptr || papImages == nullptr)
+    {
+        ReportError(CE_Failure, CPLE_IllegalArg,
+                    "Invalid arguments in GDALRasterBand::ReadBlocks()");
+        return CE_Failure;
+    }
+
+    if (!InitBlockInfo())
+        return CE_Failure;
+
+    for (int i = 0; i < nBlockCount; ++i)
+    {
+        CPLAssert(papImages[i] != nullptr);
+        if (panXBlockOff[i] < 0 || panXBlockOff[i] >= nBlocksPerRow)
+        {
+            ReportError(CE_Failure, CPLE_IllegalArg,
+                        "Illegal nXBlockOff value (%d) in "
+                        "GDALRasterBand::ReadBlocks()",
+                        panXBlockOff[i]);
+            return CE_Failure;
+        }
+
+        if (panYBlockOff[i] < 0 || panYBlockOff[i] >= nBlocksPerColumn)
+        {
+            ReportError(CE_Failure, CPLE_IllegalArg,
+                        "Illegal nYBlockOff value (%d) in "
+                        "GDALRasterBand::ReadBlocks()",
+                        panYBlockOff[i]);
+            return CE_Failure;
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Invoke underlying implementation method.                        */
+    /* -------------------------------------------------------------------- */
+
+    int bCallLeaveReadWrite = EnterReadWrite(GF_Read);
+    CPLErr eErr =
+        IReadBlocks(nBlockCount, panXBlockOff, panYBlockOff, papImages);
+    if (bCallLeaveReadWrite)
+        LeaveReadWrite();
+    return eErr;
+}
+
+/************************************************************************/
+/*                            IReadBlocks()                             */
+/************************************************************************/
+
+/** Read several blocks of image data.
+ *
+ * Called by ReadBlocks(), with validated arguments. The default
+ * implementation calls IReadBlock() for each block. Drivers may override it
+ * to process the request as a whole.
+ *
+ * @since GDAL 3.10
+ */
+CPLErr GDALRasterBand::IReadBlocks(int nBlockCount, const int *panXBlockOff,
+                                   const int *panYBlockOff,
+                                   void *const *papImages)
+{
+    for (int i = 0; i < nBlockCount; ++i)
+    {
+        if (IReadBlock(panXBlockOff[i], panYBlockOff[i], papImages[i]) !=
+            CE_None)
+        {
+            return CE_Failure;
+        }
+    }
+    return CE_None;
+}
+
+/************************************************************************/
+/*                           GDALReadBlocks()                           */
+/************************************************************************/
+
+/**
+ * \brief Read several blocks of image data efficiently.
+ *
+ * @see GDALRasterBand::ReadBlocks()
+ * @since GDAL 3.10
+ */
+
+CPLErr GDALReadBlocks(GDALRasterBandH hBand, int nBlockCount,
+                      const int *panXBlockOff, const int *panYBlockOff,
+                      void *const *papImages)
+
+{
+    VALIDATE_POINTER1(hBand, "GDALReadBlocks", CE_Failure);
+
+    GDALRasterBand *poBand = GDALRasterBand::FromHandle(hBand);
+    return poBand->ReadBlocks(nBlockCount, panXBlockOff, panYBlockOff,
+                              papImages);
+}
+
+/************************************************************************/
+/*                            SamplePoints()                            */
+/************************************************************************/
+
+/**
+ * \brief Sample the band at a set of points.
+ *
+ * Points are expressed in pixel/line coordinates, (0,0) being the top-left
+ * corner of the top-left pixel, and (GetXSize(),GetYSize()) the bottom-right
+ * corner of the bottom-right pixel.
+ *
+ * With GRIORA_NearestNeighbour, the value of the pixel containing each point
+ * is returned. With GRIORA_Bilinear, the values of the 2x2 pixels whose
+ * centers surround the point are interpolated, pixels at the edges of the
+ * raster being replicated. Pixels equal to the nodata value are then left
+ * out and the weights of the other ones renormalized, and the nodata value
+ * is returned if all of them are nodata.
+ *
+ * Points outside of the raster get a NaN value.
+ *
+ * The points are grouped by the block they fall into, and each needed block
+ * is fetched once: from the block cache if it is present there, and
+ * otherwise with ReadBlocks() in batches of blocks, which lets drivers
+ * coalesce the I/O and decode blocks in parallel (for instance the GTiff
+ * driver with the NUM_THREADS open option). Fetched blocks are not added to
+ * the block cache.
+ *
+ * This method is the same as the C function GDALRasterSamplePoints().
+ *
+ * @param nPointCount number of points.
+ * @param padfX array of nPointCount pixel coordinates.
+ * @param padfY array of nPointCount line coordinates.
+ * @param eResampleAlg GRIORA_NearestNeighbour or GRIORA_Bilinear.
+ * @param pData buffer of nPointCount values of type eBufType, receiving the
+ * sampled values.
+ * @param eBufType GDT_Float64, or GDT_CFloat64 to also get the imaginary
+ * part of complex values.
+ *
+ * @return CE_None on success or CE_Failure on an error.
+ *
+ * @since GDAL 3.10
+ */
+
+CPLErr GDALRasterBand::SamplePoints(size_t nPointCount, const double *padfX,
+                                    const double *padfY,
+                                    GDALRIOResampleAlg eResampleAlg,
+                                    void *pData, GDALDataType eBufType)
+
+{
+    /* -------------------------------------------------------------------- */
+    /*      Validate arguments.                                             */
+    /* -------------------------------------------------------------------- */
+    if (nPointCount == 0)
+        return CE_None;
+    if (padfX == nullptr || padfY == nullptr || pData == nullptr)
+    {
+        ReportError(CE_Failure, CPLE_IllegalArg,
+                    "Invalid arguments in GDALRasterBand::SamplePoints()");
+        return CE_Failure;
+    }
+    if (eResampleAlg != GRIORA_NearestNeighbour &&
+        eResampleAlg != GRIORA_Bilinear)
+    {
+        ReportError(CE_Failure, CPLE_NotSupported,
+                    "Only nearest neighbour and bilinear resampling are "
+                    "supported by GDALRasterBand::SamplePoints()");
+        return CE_Failure;
+    }
+    if (eBufType != GDT_Float64 && eBufType != GDT_CFloat64)
+    {
+        ReportError(CE_Failure, CPLE_NotSupported,
+                    "Only GDT_Float64 and GDT_CFloat64 buffer types are "
+                    "supported by GDALRasterBand::SamplePoints()");
+        return CE_Failure;
+    }
+
+    if (!InitBlockInfo())
+        return CE_Failure;
+
+    const bool bBilinear = eResampleAlg == GRIORA_Bilinear;
+    const int nOutValues = eBufType == GDT_CFloat64 ? 2 : 1;
+    double *padfOut = static_cast<double *>(pData);
+    int bHasNoData = FALSE;
+    const double dfNoData = GetNoDataValue(&bHasNoData);
+    const bool bNoDataIsNan = bHasNoData && std::isnan(dfNoData);
+
+    // Locates the pixels needed by each point, and the block where they
+    // are. Points whose pixels are in several blocks (only possible with
+    // bilinear) are read with RasterIO().
+    struct Sample
+    {
+        size_t nIdx;
+        GIntBig nBlockIdx;  // -1 for points using RasterIO()
+        int nX0;
+        int nY0;
+        int nX1;
+        int nY1;
+        double dfDX;
+        double dfDY;
+    };
+
+    std::vector<Sample> asSamples;
+    try
+    {
+        asSamples.reserve(nPointCount);
+    }
+    catch (const std::bad_alloc &)
+    {
+        ReportError(CE_Failure, CPLE_OutOfMemory,
+                    "Out of memory in GDALRasterBand::SamplePoints()");
+        return CE_Failure;
+    }
+
+    for (size_t i = 0; i < nPointCount; ++i)
+    {
+        const double dfX = padfX[i];
+        const double dfY = padfY[i];
+        // Written that way to catch NaN values
+        if (!(dfX >= 0 && dfX < nRasterXSize && dfY >= 0 &&
+              dfY < nRasterYSize))
+        {
+            padfOut[i * nOutValues] = std::numeric_limits<double>::quiet_NaN();
+            if (nOutValues == 2)
+                padfOut[i * nOutValues + 1] =
+                    std::numeric_limits<double>::quiet_NaN();
+            continue;
+        }
+
+        Sample sSample;
+        sSample.nIdx = i;
+        if (bBilinear)
+        {
+            const double dfSrcX = dfX - 0.5;
+            const double dfSrcY = dfY - 0.5;
+            const int nX = static_cast<int>(std::floor(dfSrcX));
+            const int nY = static_cast<int>(std::floor(dfSrcY));
+            sSample.dfDX = dfSrcX - nX;
+            sSample.dfDY = dfSrcY - nY;
+            sSample.nX0 = std::max(nX, 0);
+            sSample.nY0 = std::max(nY, 0);
+            sSample.nX1 = std::min(nX + 1, nRasterXSize - 1);
+            sSample.nY1 = std::min(nY + 1, nRasterYSize - 1);
+        }
+        else
+        {
+            sSample.nX0 = std::min(static_cast<int>(dfX), nRasterXSize - 1);
+            sSample.nY0 = std::min(static_cast<int>(dfY), nRasterYSize - 1);
+            sSample.nX1 = sSample.nX0;
+            sSample.nY1 = sSample.nY0;
+            sSample.dfDX = 0;
+            sSample.dfDY = 0;
+        }
+
+        const int nBlockX = sSample.nX0 / nBlockXSize;
+        const int nBlockY = sSample.nY0 / nBlockYSize;
+        if (sSample.nX1 / nBlockXSize == nBlockX &&
+            sSample.nY1 / nBlockYSize == nBlockY)
+        {
+            sSample.nBlockIdx =
+                static_cast<GIntBig>(nBlockY) * nBlocksPerRow + nBlockX;
+        }
+        else
+        {
+            sSample.nBlockIdx = -1;
+        }
+        asSamples.push_back(sSample);
+    }
+
+    std::sort(asSamples.begin(), asSamples.end(),
+              [](const Sample &a, const Sample &b)
+              { return a.nBlockIdx < b.nBlockIdx; });
+
+    // Computes the output value of a point from its (up to) 4 pixel values,
+    // as (real, imaginary) pairs in the order (X0,Y0), (X1,Y0), (X0,Y1),
+    // (X1,Y1).
+    const auto Evaluate = [&](const Sample &sSample, const double adfPix[8])
+    {
+        double *padfDst = padfOut + sSample.nIdx * nOutValues;
+        if (!bBilinear)
+        {
+            padfDst[0] = adfPix[0];
+            if (nOutValues == 2)
+                padfDst[1] = adfPix[1];
+            return;
+        }
+
+        const double adfWeight[4] = {
+            (1 - sSample.dfDX) * (1 - sSample.dfDY),
+            sSample.dfDX * (1 - sSample.dfDY),
+            (1 - sSample.dfDX) * sSample.dfDY,
+            sSample.dfDX * sSample.dfDY,
+        };
+        double dfSumWeight = 0;
+        double dfReal = 0;
+        double dfImag = 0;
+        for (int k = 0; k < 4; ++k)
+        {
+            const double dfVal = adfPix[2 * k];
+            if (bHasNoData &&
+                (bNoDataIsNan ? std::isnan(dfVal) : dfVal == dfNoData))
+            {
+                continue;
+            }
+            dfSumWeight += adfWeight[k];
+            dfReal += adfWeight[k] * dfVal;
+            dfImag += adfWeight[k] * adfPix[2 * k + 1];
+        }
+        if (dfSumWeight > 0)
+        {
+            padfDst[0] = dfReal / dfSumWeight;
+            if (nOutValues == 2)
+                padfDst[1] = dfImag / dfSumWeight;
+        }
+        else
+        {
+            padfDst[0] = dfNoData;
+            if (nOutValues == 2)
+                padfDst[1] = 0;
+        }
+    };
+
+    size_t iSample = 0;
+
+    /* -------------------------------------------------------------------- */
+    /*      Points straddling several blocks.                               */
+    /* -------------------------------------------------------------------- */
+    for (; iSample < asSamples.size() && asSamples[iSample].nBlockIdx < 0;
+         ++iSample)
+    {
+        const Sample &sSample = asSamples[iSample];
+        double adfWindow[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+        const int nWinXSize = sSample.nX1 - sSample.nX0 + 1;
+        const int nWinYSize = sSample.nY1 - sSample.nY0 + 1;
+        if (RasterIO(GF_Read, sSample.nX0, sSample.nY0, nWinXSize, nWinYSize,
+                     adfWindow, nWinXSize, nWinYSize, GDT_CFloat64,
+                     2 * sizeof(double), 4 * sizeof(double),
+                     nullptr) != CE_None)
+        {
+            return CE_Failure;
+        }
+        // Replicate edges when the window is clamped to the raster.
+        const double adfPix[8] = {
+            adfWindow[0],
+            adfWindow[1],
+            adfWindow[2 * (nWinXSize - 1)],
+            adfWindow[2 * (nWinXSize - 1) + 1],
+            adfWindow[4 * (nWinYSize - 1)],
+            adfWindow[4 * (nWinYSize - 1) + 1],
+            adfWindow[4 * (nWinYSize - 1) + 2 * (nWinXSize - 1)],
+            adfWindow[4 * (nWinYSize - 1) + 2 * (nWinXSize - 1) + 1],
+        };
+        Evaluate(sSample, adfPix);
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Points within a single block, processed by batches of blocks.   */
+    /* -------------------------------------------------------------------- */
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    const size_t nBlockBytes =
+        static_cast<size_t>(nBlockXSize) * nBlockYSize * nDTSize;
+    constexpr size_t BATCH_BYTES = 64 * 1024 * 1024;
+    const int nMaxBatchBlocks = static_cast<int>(
+        std::clamp<size_t>(BATCH_BYTES / nBlockBytes, 1, 256));
+    std::unique_ptr<GByte, VSIFreeReleaser> pabyBuffers;
+
+    std::vector<GIntBig> anBatchBlockIdx;
+    std::vector<const GByte *> apabyBatchData;
+    std::vector<GDALRasterBlock *> apoLockedBlocks;
+    std::vector<int> anReadXBlockOff;
+    std::vector<int> anReadYBlockOff;
+    std::vector<void *> apReadData;
+    std::vector<size_t> anReadBatchIdx;
+
+    CPLErr eErr = CE_None;
+    while (iSample < asSamples.size() && eErr == CE_None)
+    {
+        // Collect the next batch of distinct blocks
+        anBatchBlockIdx.clear();
+        apabyBatchData.clear();
+        anReadXBlockOff.clear();
+        anReadYBlockOff.clear();
+        apReadData.clear();
+        anReadBatchIdx.clear();
+        const size_t iFirstSample = iSample;
+        while (iSample < asSamples.size())
+        {
+            const GIntBig nBlockIdx = asSamples[iSample].nBlockIdx;
+            if (anBatchBlockIdx.empty() || anBatchBlockIdx.back() != nBlockIdx)
+            {
+                if (static_cast<int>(anBatchBlockIdx.size()) == nMaxBatchBlocks)
+                    break;
+                anBatchBlockIdx.push_back(nBlockIdx);
+            }
+            ++iSample;
+        }
+
+        for (const GIntBig nBlockIdx : anBatchBlockIdx)
+        {
+            const int nBlockX = static_cast<int>(nBlockIdx % nBlocksPerRow);
+            const int nBlockY = static_cast<int>(nBlockIdx / nBlocksPerRow);
+            GDALRasterBlock *poBlock = TryGetLockedBlockRef(nBlockX, nBlockY);
+            if (poBlock)
+            {
+                apoLockedBlocks.push_back(poBlock);
+                apabyBatchData.push_back(
+                    static_cast<const GByte *>(poBlock->GetDataRef()));
+            }
+            else
+            {
+                anReadXBlockOff.push_back(nBlockX);
+                anReadYBlockOff.push_back(nBlockY);
+                anReadBatchIdx.push_back(apabyBatchData.size());
+                apabyBatchData.push_back(nullptr);
+            }
+        }
+
+        if (!anReadXBlockOff.empty())
+        {
+            if (!pabyBuffers)
+            {
+                pabyBuffers.reset(static_cast<GByte *>(
+                    VSI_MALLOC2_VERBOSE(nMaxBatchBlocks, nBlockBytes)));
+                if (!pabyBuffers)
+                    eErr = CE_Failure;
+            }
+            for (size_t i = 0; eErr == CE_None && i < anReadXBlockOff.size();
+                 ++i)
+            {
+                GByte *pabyData = pabyBuffers.get() + i * nBlockBytes;
+                apReadData.push_back(pabyData);
+                apabyBatchData[anReadBatchIdx[i]] = pabyData;
+            }
+            if (eErr == CE_None)
+            {
+                eErr = ReadBlocks(static_cast<int>(anReadXBlockOff.size()),
+                                  anReadXBlockOff.data(),
+                                  anReadYBlockOff.data(), apReadData.data());
+            }
+        }
+
+        size_t iBatchBlock = 0;
+        for (size_t i = iFirstSample; eErr == CE_None && i < iSample; ++i)
+        {
+            const Sample &sSample = asSamples[i];
+            while (anBatchBlockIdx[iBatchBlock] != sSample.nBlockIdx)
+                ++iBatchBlock;
+            const GByte *pabyBlock = apabyBatchData[iBatchBlock];
+            const int nBlockX =
+                static_cast<int>(sSample.nBlockIdx % nBlocksPerRow);
+            const int nBlockY =
+                static_cast<int>(sSample.nBlockIdx / nBlocksPerRow);
+            const int anX[2] = {sSample.nX0 - nBlockX * nBlockXSize,
+                                sSample.nX1 - nBlockX * nBlockXSize};
+            const int anY[2] = {sSample.nY0 - nBlockY * nBlockYSize,
+                                sSample.nY1 - nBlockY * nBlockYSize};
+            double adfPix[8];
+            for (int k = 0; k < (bBilinear ? 4 : 1); ++k)
+            {
+                const size_t nOffset =
+                    (static_cast<size_t>(anY[k / 2]) * nBlockXSize +
+                     anX[k % 2]) *
+                    nDTSize;
+                GDALCopyWords(pabyBlock + nOffset, eDataType, 0,
+                              adfPix + 2 * k, GDT_CFloat64, 0, 1);
+            }
+            Evaluate(sSample, adfPix);
+        }
+
+        for (GDALRasterBlock *poBlock : apoLockedBlocks)
+            poBlock->DropLock();
+        apoLockedBlocks.clear();
+    }
+
+    return eErr;
+}
+
+/************************************************************************/
+/*                       GDALRasterSamplePoints()                       */
+/************************************************************************/
+
+/**
+ * \brief Sample the band at a set of points.
+ *
+ * @see GDALRasterBand::SamplePoints()
+ * @since GDAL 3.10
+ */
+
+CPLErr GDALRasterSamplePoints(GDALRasterBandH hBand, size_t nPointCount,
+                              const double *padfX, const double *padfY,
+                              GDALRIOResampleAlg eResampleAlg, void *pData,
+                              GDALDataType eBufType)
+
+{
+    VALIDATE_POINTER1(hBand, "GDALRasterSamplePoints", CE_Failure);
+
+    GDALRasterBand *poBand = GDALRasterBand::FromHandle(hBand);
+    return poBand->SamplePoints(nPointCount, padfX, padfY, eResampleAlg,
+                                pData, eBufType);
+}
+
+/************************************************************************/
+/*                            ReadWindows()                             */
+/************************************************************************/
+
+/**
+ * \brief Read several windows of the band.
+ *
+ * This is equivalent to calling RasterIO() in read mode for each window,
+ * the i-th window being read at pData + i * nWindowSpace into a buffer of
+ * nBufXSize * nBufYSize pixels. Windows whose size differs from the buffer
+ * size are resampled with eResampleAlg.
+ *
+ * When the dataset of the band can be used from several threads concurrently
+ * (see GDALDataset::IsThreadSafe(), typically when it has been opened with
+ * GDAL_OF_THREAD_SAFE), windows are read in parallel, by the number of
+ * threads specified by the GDAL_NUM_THREADS configuration option (defaults
+ * to ALL_CPUS). Otherwise they are read sequentially.
+ *
+ * This method is the same as the C function GDALRasterReadWindows().
+ *
+ * @param nWindowCount number of windows.
+ * @param panWindows array of 4 * nWindowCount values: X offset, Y offset,
+ * width and height of each window.
+ * @param pData buffer receiving the pixel values of all windows.
+ * @param nBufXSize width of the buffer of a window.
+ * @param nBufYSize height of the buffer of a window.
+ * @param eBufType type of the pixel values in pData.
+ * @param nPixelSpace byte offset between consecutive pixels of a line, or 0
+ * for the size of eBufType.
+ * @param nLineSpace byte offset between consecutive lines of a window, or 0
+ * for nPixelSpace * nBufXSize.
+ * @param nWindowSpace byte offset between consecutive windows, or 0 for
+ * nLineSpace * nBufYSize.
+ * @param eResampleAlg resampling algorithm.
+ *
+ * @return CE_None on success or CE_Failure on an error.
+ *
+ * @since GDAL 3.10
+ */
+
+CPLErr GDALRasterBand::ReadWindows(int nWindowCount, const int *panWindows,
+                                   void *pData, int nBufXSize, int nBufYSize,
+                                   GDALDataType eBufType, GSpacing nPixelSpace,
+                                   GSpacing nLineSpace, GSpacing nWindowSpace,
+                                   GDALRIOResampleAlg eResampleAlg)
+
+{
+    if (nWindowCount == 0)
+        return CE_None;
+    if (nWindowCount < 0 || panWindows == nullptr || pData == nullptr)
+    {
+        ReportError(CE_Failure, CPLE_IllegalArg,
+                    "Invalid arguments in GDALRasterBand::ReadWindows()");
+        return CE_Failure;
+    }
+
+    if (nPixelSpace == 0)
+        nPixelSpace = GDALGetDataTypeSizeBytes(eBufType);
+    if (nLineSpace == 0)
+        nLineSpace = nPixelSpace * nBufXSize;
+    if (nWindowSpace == 0)
+        nWindowSpace = nLineSpace * nBufYSize;
+
+    // Windows are taken from a shared counter by the calling thread and by
+    // the worker threads.
+    struct Context
+    {
+        GDALRasterBand *poBand = nullptr;
+        int nWindowCount = 0;
+        const int *panWindows = nullptr;
+        GByte *pabyData = nullptr;
+        int nBufXSize = 0;
+        int nBufYSize = 0;
+        GDALDataType eBufType = GDT_Unknown;
+        GSpacing nPixelSpace = 0;
+        GSpacing nLineSpace = 0;
+        GSpacing nWindowSpace = 0;
+        GDALRIOResampleAlg eResampleAlg = GRIORA_NearestNeighbour;
+        std::atomic<int> nNextWindow{0};
+        std::atomic<bool> bFailure{false};
+
+        void Run()
+        {
+            GDALRasterIOExtraArg sExtraArg;
+            INIT_RASTERIO_EXTRA_ARG(sExtraArg);
+            sExtraArg.eResampleAlg = eResampleAlg;
+            while (!bFailure)
+            {
+                const int i = nNextWindow++;
+                if (i >= nWindowCount)
+                    break;
+                const int *panWindow = panWindows + 4 * static_cast<size_t>(i);
+                if (poBand->RasterIO(GF_Read, panWindow[0], panWindow[1],
+                                     panWindow[2], panWindow[3],
+                                     pabyData + i * nWindowSpace, nBufXSize,
+                                     nBufYSize, eBufType, nPixelSpace,
+                                     nLineSpace, &sExtraArg) != CE_None)
+                {
+                    bFailure = true;
+                }
+            }
+        }
+    };
+
+    Context sContext;
+    sContext.poBand = this;
+    sContext.nWindowCount = nWindowCount;
+    sContext.panWindows = panWindows;
+    sContext.pabyData = static_cast<GByte *>(pData);
+    sContext.nBufXSize = nBufXSize;
+    sContext.nBufYSize = nBufYSize;
+    sContext.eBufType = eBufType;
+    sContext.nPixelSpace = nPixelSpace;
+    sContext.nLineSpace = nLineSpace;
+    sContext.nWindowSpace = nWindowSpace;
+    sContext.eResampleAlg = eResampleAlg;
+
+    int nThreads = 1;
+    if (poDS && poDS->IsThreadSafe(GDAL_OF_RASTER))
+    {
+        const char *pszThreads =
+            CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS");
+        nThreads = std::clamp(EQUAL(pszThreads, "ALL_CPUS")
+                                  ? CPLGetNumCPUs()
+                                  : atoi(pszThreads),
+                              1, std::min(128, nWindowCount));
+    }
+    auto poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                   : std::unique_ptr<CPLJobQueue>(nullptr);
+
+    struct Job
+    {
+        Context *psContext = nullptr;
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+
+        static void Run(void *pData)
+        {
+            Job *psJob = static_cast<Job *>(pData);
+            CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+            psJob->psContext->Run();
+            CPLUninstallErrorHandlerAccumulator();
+        }
+    };
+
+    // The calling thread is one of the nThreads readers
+    std::vector<Job> asJobs(poJobQueue ? nThreads - 1 : 0);
+    for (auto &sJob : asJobs)
+    {
+        sJob.psContext = &sContext;
+        if (!poJobQueue->SubmitJob(Job::Run, &sJob))
+            break;
+    }
+    sContext.Run();
+
+    if (poJobQueue)
+    {
+        poJobQueue->WaitCompletion();
+        for (const auto &sJob : asJobs)
+        {
+            for (const auto &oError : sJob.aoErrors)
+            {
+                CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+            }
+        }
+    }
+
+    return sContext.bFailure ? CE_Failure : CE_None;
 }
 
 /************************************************************************/
-/*                           GDALReadBlock()                            */
+/*                       GDALRasterReadWindows()                        */
 /************************************************************************/
 
 /**
- * \brief Read a block of image data efficiently.
+ * \brief Read several windows of the band.
  *
- * @see GDALRasterBand::ReadBlock()
+ * @see GDALRasterBand::ReadWindows()
+ * @since GDAL 3.10
  */
 
-CPLErr CPL_STDCALL GDALReadBlock(GDALRasterBandH hBand, int nXOff, int nYOff,
-                                 void *pData)
+CPLErr GDALRasterReadWindows(GDALRasterBandH hBand, int nWindowCount,
+                             const int *panWindows, void *pData, int nBufXSize,
+                             int nBufYSize, GDALDataType eBufType,
+                             GSpacing nPixelSpace, GSpacing nLineSpace,
+                             GSpacing nWindowSpace,
+                             GDALRIOResampleAlg eResampleAlg)
 
 {
-    VALIDATE_POINTER1(hBand, "GDALReadBlock", CE_Failure);
+    VALIDATE_POINTER1(hBand, "GDALRasterReadWindows", CE_Failure);
 
     GDALRasterBand *poBand = GDALRasterBand::FromHandle(hBand);
-    return (poBand->ReadBlock(nXOff, nYOff, pData));
+    return poBand->ReadWindows(nWindowCount, panWindows, pData, nBufXSize,
+                               nBufYSize, eBufType, nPixelSpace, nLineSpace,
+                               nWindowSpace, eResampleAlg);
 }
 
 /************************************************************************/
@@ -758,6 +1516,8 @@ CPLErr GDALRasterBand::WriteBlock(int nXBlockOff, int nYBlockOff, void *pImage)
 
     const bool bCallLeaveReadWrite = CPL_TO_BOOL(EnterReadWrite(GF_Write));
     CPLErr eErr = IWriteBlock(nXBlockOff, nYBlockOff, pImage);
+    InvalidateBlockStatistics(nXBlockOff * nBlockXSize,
+                              nYBlockOff * nBlockYSize, 1, 1);
     if (bCallLeaveReadWrite)
         LeaveReadWrite();
 
@@ -1420,6 +2180,8 @@ GDALRasterBlock *GDALRasterBand::GetLockedBlockRef(int nXBlockOff,
     /*      Try and fetch from cache.                                       */
     /* -------------------------------------------------------------------- */
     GDALRasterBlock *poBlock = TryGetLockedBlockRef(nXBlockOff, nYBlockOff);
+    CPLRuntimeMetricAdd(poBlock ? CPLRuntimeMetric::BLOCK_CACHE_HITS
+                                : CPLRuntimeMetric::BLOCK_CACHE_MISSES);
 
     /* -------------------------------------------------------------------- */
     /*      If we didn't find it in our memory cache, instantiate a         */
@@ -1496,11 +2258,30 @@ GDALRasterBlock *GDALRasterBand::GetLockedBlockRef(int nXBlockOff,
 
         if (!bJustInitialize)
         {
+            if (!m_bPrefetcherChecked && eAccess == GA_ReadOnly)
+            {
+                m_bPrefetcherChecked = true;
+                m_poPrefetcher = GDALBlockPrefetcher::Create(this);
+            }
+
             const GUInt32 nErrorCounter = CPLGetErrorCounter();
-            int bCallLeaveReadWrite = EnterReadWrite(GF_Read);
-            eErr = IReadBlock(nXBlockOff, nYBlockOff, poBlock->GetDataRef());
-            if (bCallLeaveReadWrite)
-                LeaveReadWrite();
+            if (m_poPrefetcher && m_poPrefetcher->FetchBlock(
+                                      nXBlockOff, nYBlockOff,
+                                      poBlock->GetDataRef()))
+            {
+                eErr = CE_None;
+            }
+            else
+            {
+                int bCallLeaveReadWrite = EnterReadWrite(GF_Read);
+                {
+                    CPL_TRACE_SCOPE("GDALRasterBand::IReadBlock");
+                    eErr = IReadBlock(nXBlockOff, nYBlockOff,
+                                      poBlock->GetDataRef());
+                }
+                if (bCallLeaveReadWrite)
+                    LeaveReadWrite();
+            }
             if (eErr != CE_None)
             {
                 poBlock->DropLock();
@@ -1514,6 +2295,9 @@ GDALRasterBlock *GDALRasterBand::GetLockedBlockRef(int nXBlockOff,
                 return nullptr;
             }
 
+            if (m_poPrefetcher)
+                m_poPrefetcher->NotifyBlockRead(nXBlockOff, nYBlockOff);
+
             nBlockReads++;
             if (static_cast<GIntBig>(nBlockReads) ==
                     static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn +
@@ -1529,6 +2313,56 @@ GDALRasterBlock *GDALRasterBand::GetLockedBlockRef(int nXBlockOff,
     return poBlock;
 }
 
+/************************************************************************/
+/*                        GDALRasterBlockView()                         */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+GDALRasterBlockView::GDALRasterBlockView(GDALRasterBlock *poLockedBlock)
+    : m_poBlock(poLockedBlock, [](GDALRasterBlock *poBlock)
+                { poBlock->DropLock(); })
+{
+}
+
+//! @endcond
+
+/************************************************************************/
+/*                            GetBlockView()                            */
+/************************************************************************/
+
+/**
+ * \brief Return a read-only view on the data of a block.
+ *
+ * This is similar to ReadBlock(), except that no copy of the block is made
+ * into a user buffer: the block is loaded in the block cache if needed, and
+ * the returned view gives direct access to the cached data. The block is
+ * kept locked in the cache, and thus cannot be evicted, as long as a copy of
+ * the view is alive.
+ *
+ * The data must not be modified through the returned pointer. All views on
+ * blocks of a band must be released before calling FlushCache() on it, or
+ * closing its dataset.
+ *
+ * @param nXBlockOff the horizontal block offset, with zero indicating
+ * the left most block, 1 the next block and so forth.
+ *
+ * @param nYBlockOff the vertical block offset, with zero indicating
+ * the top most block, 1 the next block and so forth.
+ *
+ * @return a view, that evaluates to false in case of error.
+ *
+ * @since GDAL 3.10
+ */
+
+GDALRasterBlockView GDALRasterBand::GetBlockView(int nXBlockOff,
+                                                 int nYBlockOff)
+{
+    GDALRasterBlock *poBlock = GetLockedBlockRef(nXBlockOff, nYBlockOff);
+    if (poBlock == nullptr)
+        return GDALRasterBlockView();
+    return GDALRasterBlockView(poBlock);
+}
+
 /************************************************************************/
 /*                               Fill()                                 */
 /************************************************************************/
@@ -5579,23 +6413,340 @@ static inline double GetPixelValue(GDALDataType eDataType, bool bSignedByte,
             dfValue = static_cast<const GInt16 *>(pData)[iOffset * 2];
             break;
         case GDT_CInt32:
-            dfValue = static_cast<const GInt32 *>(pData)[iOffset * 2];
+            dfValue = static_cast<const GInt32 *>(pData)[iOffset * 2];
+            break;
+        case GDT_CFloat32:
+            dfValue = static_cast<const float *>(pData)[iOffset * 2];
+            if (CPLIsNan(dfValue))
+            {
+                bValid = false;
+                return 0.0;
+            }
+            break;
+        case GDT_CFloat64:
+            dfValue = static_cast<const double *>(pData)[iOffset * 2];
+            if (CPLIsNan(dfValue))
+            {
+                bValid = false;
+                return 0.0;
+            }
+            break;
+        case GDT_Unknown:
+        case GDT_TypeCount:
+            CPLAssert(false);
+            break;
+    }
+
+    if (bGotNoDataValue && ARE_REAL_EQUAL(dfValue, dfNoDataValue))
+    {
+        bValid = false;
+        return 0.0;
+    }
+    return dfValue;
+}
+
+/************************************************************************/
+/*                         SetValidPercent()                            */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+/**
+ * \brief Set percentage of valid (not nodata) pixels.
+ *
+ * Stores the percentage of valid pixels in the metadata item
+ * STATISTICS_VALID_PERCENT
+ *
+ * @param nSampleCount Number of sampled pixels.
+ *
+ * @param nValidCount Number of valid pixels.
+ */
+
+void GDALRasterBand::SetValidPercent(GUIntBig nSampleCount,
+                                     GUIntBig nValidCount)
+{
+    if (nValidCount == 0)
+    {
+        SetMetadataItem("STATISTICS_VALID_PERCENT", "0");
+    }
+    else if (nValidCount == nSampleCount)
+    {
+        SetMetadataItem("STATISTICS_VALID_PERCENT", "100");
+    }
+    else /* nValidCount < nSampleCount */
+    {
+        char szValue[128] = {0};
+
+        /* percentage is only an indicator: limit precision */
+        CPLsnprintf(szValue, sizeof(szValue), "%.4g",
+                    100. * static_cast<double>(nValidCount) / nSampleCount);
+
+        if (EQUAL(szValue, "100"))
+        {
+            /* don't set 100 percent valid
+             * because some of the sampled pixels were nodata */
+            SetMetadataItem("STATISTICS_VALID_PERCENT", "99.999");
+        }
+        else
+        {
+            SetMetadataItem("STATISTICS_VALID_PERCENT", szValue);
+        }
+    }
+}
+
+//! @endcond
+
+/************************************************************************/
+/*                        StatisticsAccumulator                         */
+/************************************************************************/
+
+namespace
+{
+// Using Welford algorithm:
+// http://en.wikipedia.org/wiki/Algorithms_for_calculating_variance
+// to compute standard deviation in a more numerically robust way than
+// the difference of the sum of square values with the square of the sum.
+// dfMean and dfM2 are updated at each sample.
+// dfM2 is the sum of square of differences to the current mean.
+struct StatisticsAccumulator
+{
+    double dfMin = std::numeric_limits<double>::max();
+    double dfMax = -std::numeric_limits<double>::max();
+    double dfMean = 0.0;
+    double dfM2 = 0.0;
+    GUIntBig nValidCount = 0;
+    GUIntBig nSampleCount = 0;
+
+    inline void Add(double dfValue)
+    {
+        dfMin = std::min(dfMin, dfValue);
+        dfMax = std::max(dfMax, dfValue);
+
+        nValidCount++;
+        const double dfDelta = dfValue - dfMean;
+        dfMean += dfDelta / nValidCount;
+        dfM2 += dfDelta * (dfValue - dfMean);
+    }
+
+    // Combine with the statistics of another set of samples, using the
+    // pairwise formula of Chan et al.
+    void Merge(const StatisticsAccumulator &other)
+    {
+        nSampleCount += other.nSampleCount;
+        if (other.nValidCount == 0)
+            return;
+        dfMin = std::min(dfMin, other.dfMin);
+        dfMax = std::max(dfMax, other.dfMax);
+        if (nValidCount == 0)
+        {
+            dfMean = other.dfMean;
+            dfM2 = other.dfM2;
+            nValidCount = other.nValidCount;
+            return;
+        }
+        const double dfN = static_cast<double>(nValidCount);
+        const double dfOtherN = static_cast<double>(other.nValidCount);
+        const double dfTotalN = dfN + dfOtherN;
+        const double dfDelta = other.dfMean - dfMean;
+        dfMean += dfDelta * (dfOtherN / dfTotalN);
+        dfM2 += other.dfM2 + dfDelta * dfDelta * (dfN * dfOtherN / dfTotalN);
+        nValidCount += other.nValidCount;
+    }
+};
+
+// Exact statistics for Byte and UInt16 data.
+struct IntegerStatisticsAccumulator
+{
+    GUInt32 nMin = 0;
+    GUInt32 nMax = 0;
+    GUIntBig nSum = 0;
+    GUIntBig nSumSquare = 0;
+    GUIntBig nSampleCount = 0;
+    GUIntBig nValidCount = 0;
+
+    void Merge(const IntegerStatisticsAccumulator &other)
+    {
+        nMin = std::min(nMin, other.nMin);
+        nMax = std::max(nMax, other.nMax);
+        nSum += other.nSum;
+        nSumSquare += other.nSumSquare;
+        nSampleCount += other.nSampleCount;
+        nValidCount += other.nValidCount;
+    }
+};
+
+// Min/max of data of any type.
+struct MinMaxAccumulator
+{
+    double dfMin = std::numeric_limits<double>::max();
+    double dfMax = -std::numeric_limits<double>::max();
+};
+
+}  // namespace
+
+/************************************************************************/
+/*                    GDALRasterBandBlockStatistics                     */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+
+/** Statistics of each block of a band, kept when the
+ * GDAL_STATS_BLOCK_SUMMARIES configuration option is set, so that
+ * ComputeStatistics() only needs to re-read blocks modified since its
+ * previous call. */
+struct GDALRasterBandBlockStatistics
+{
+    std::mutex oMutex{};
+
+    // Parameters the summaries have been computed with
+    bool bGotNoDataValue = false;
+    double dfNoDataValue = 0;
+    bool bSignedByte = false;
+
+    std::vector<StatisticsAccumulator> asBlocks{};
+    std::vector<bool> abValid{};
+};
+
+static void DeleteBlockStatistics(GDALRasterBandBlockStatistics *poStats)
+{
+    delete poStats;
+}
+
+// Protects the m_poBlockStatistics pointers of all bands, so that
+// InvalidateBlockStatistics() does not use summaries that
+// ComputeStatistics() is replacing. Only taken once summaries have been
+// created by a band, so that writes are not slowed down otherwise.
+static std::mutex goBlockStatisticsMutex;
+static std::atomic<bool> gbBlockStatisticsCreated{false};
+
+/************************************************************************/
+/*                     InvalidateBlockStatistics()                      */
+/************************************************************************/
+
+/** Mark the summaries of the blocks intersecting a window as out of date. */
+void GDALRasterBand::InvalidateBlockStatistics(int nXOff, int nYOff,
+                                               int nXSize, int nYSize)
+{
+    if (!gbBlockStatisticsCreated || nXSize <= 0 || nYSize <= 0)
+        return;
+
+    std::lock_guard<std::mutex> oGlobalLock(goBlockStatisticsMutex);
+    if (m_poBlockStatistics == nullptr)
+        return;
+    std::lock_guard<std::mutex> oLock(m_poBlockStatistics->oMutex);
+    const int nXBlockStart = nXOff / nBlockXSize;
+    const int nXBlockEnd =
+        std::min(nBlocksPerRow - 1, (nXOff + nXSize - 1) / nBlockXSize);
+    const int nYBlockStart = nYOff / nBlockYSize;
+    const int nYBlockEnd =
+        std::min(nBlocksPerColumn - 1, (nYOff + nYSize - 1) / nBlockYSize);
+    for (int iYBlock = nYBlockStart; iYBlock <= nYBlockEnd; ++iYBlock)
+    {
+        for (int iXBlock = nXBlockStart; iXBlock <= nXBlockEnd; ++iXBlock)
+        {
+            m_poBlockStatistics
+                ->abValid[static_cast<size_t>(iYBlock) * nBlocksPerRow +
+                          iXBlock] = false;
+        }
+    }
+}
+
+//! @endcond
+
+/************************************************************************/
+/*                      ComputeStatisticsGeneric()                      */
+/************************************************************************/
+
+template <GDALDataType eDataType, bool bSignedByte>
+static void ComputeStatisticsGeneric(const void *pData, int nXCheck,
+                                     int nYCheck, int nBlockXSize,
+                                     bool bGotNoDataValue, double dfNoDataValue,
+                                     bool bGotFloatNoDataValue,
+                                     float fNoDataValue,
+                                     const GByte *pabyMaskData,
+                                     StatisticsAccumulator &sAcc)
+{
+    for (int iY = 0; iY < nYCheck; iY++)
+    {
+        for (int iX = 0; iX < nXCheck; iX++)
+        {
+            const GPtrDiff_t iOffset =
+                iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
+            if (pabyMaskData && pabyMaskData[iOffset] == 0)
+                continue;
+
+            bool bValid = true;
+            const double dfValue = GetPixelValue(
+                eDataType, bSignedByte, pData, iOffset, bGotNoDataValue,
+                dfNoDataValue, bGotFloatNoDataValue, fNoDataValue, bValid);
+            if (!bValid)
+                continue;
+
+            sAcc.Add(dfValue);
+        }
+    }
+
+    sAcc.nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
+}
+
+static void
+ComputeStatisticsGeneric(const void *pData, GDALDataType eDataType,
+                         bool bSignedByte, int nXCheck, int nYCheck,
+                         int nBlockXSize, bool bGotNoDataValue,
+                         double dfNoDataValue, bool bGotFloatNoDataValue,
+                         float fNoDataValue, const GByte *pabyMaskData,
+                         StatisticsAccumulator &sAcc)
+{
+#define CALL_COMPUTE_STATISTICS_GENERIC(eDT, bSigned)                          \
+    ComputeStatisticsGeneric<eDT, bSigned>(                                    \
+        pData, nXCheck, nYCheck, nBlockXSize, bGotNoDataValue, dfNoDataValue,  \
+        bGotFloatNoDataValue, fNoDataValue, pabyMaskData, sAcc)
+
+    switch (eDataType)
+    {
+        case GDT_Byte:
+            if (bSignedByte)
+                CALL_COMPUTE_STATISTICS_GENERIC(GDT_Byte, true);
+            else
+                CALL_COMPUTE_STATISTICS_GENERIC(GDT_Byte, false);
+            break;
+        case GDT_Int8:
+            CALL_COMPUTE_STATISTICS_GENERIC(GDT_Int8, false);
+            break;
+        case GDT_UInt16:
+            CALL_COMPUTE_STATISTICS_GENERIC(GDT_UInt16, false);
+            break;
+        case GDT_Int16:
+            CALL_COMPUTE_STATISTICS_GENERIC(GDT_Int16, false);
+            break;
+        case GDT_UInt32:
+            CALL_COMPUTE_STATISTICS_GENERIC(GDT_UInt32, false);
+            break;
+        case GDT_Int32:
+            CALL_COMPUTE_STATISTICS_GENERIC(GDT_Int32, false);
+            break;
+        case GDT_UInt64:
+            CALL_COMPUTE_STATISTICS_GENERIC(GDT_UInt64, false);
+            break;
+        case GDT_Int64:
+            CALL_COMPUTE_STATISTICS_GENERIC(GDT_Int64, false);
+            break;
+        case GDT_Float32:
+            CALL_COMPUTE_STATISTICS_GENERIC(GDT_Float32, false);
+            break;
+        case GDT_Float64:
+            CALL_COMPUTE_STATISTICS_GENERIC(GDT_Float64, false);
+            break;
+        case GDT_CInt16:
+            CALL_COMPUTE_STATISTICS_GENERIC(GDT_CInt16, false);
+            break;
+        case GDT_CInt32:
+            CALL_COMPUTE_STATISTICS_GENERIC(GDT_CInt32, false);
             break;
         case GDT_CFloat32:
-            dfValue = static_cast<const float *>(pData)[iOffset * 2];
-            if (CPLIsNan(dfValue))
-            {
-                bValid = false;
-                return 0.0;
-            }
+            CALL_COMPUTE_STATISTICS_GENERIC(GDT_CFloat32, false);
             break;
         case GDT_CFloat64:
-            dfValue = static_cast<const double *>(pData)[iOffset * 2];
-            if (CPLIsNan(dfValue))
-            {
-                bValid = false;
-                return 0.0;
-            }
+            CALL_COMPUTE_STATISTICS_GENERIC(GDT_CFloat64, false);
             break;
         case GDT_Unknown:
         case GDT_TypeCount:
@@ -5603,63 +6754,155 @@ static inline double GetPixelValue(GDALDataType eDataType, bool bSignedByte,
             break;
     }
 
-    if (bGotNoDataValue && ARE_REAL_EQUAL(dfValue, dfNoDataValue))
-    {
-        bValid = false;
-        return 0.0;
-    }
-    return dfValue;
+#undef CALL_COMPUTE_STATISTICS_GENERIC
 }
 
 /************************************************************************/
-/*                         SetValidPercent()                            */
+/*                     GetNumThreadsForStatistics()                     */
 /************************************************************************/
 
-//! @cond Doxygen_Suppress
-/**
- * \brief Set percentage of valid (not nodata) pixels.
- *
- * Stores the percentage of valid pixels in the metadata item
- * STATISTICS_VALID_PERCENT
- *
- * @param nSampleCount Number of sampled pixels.
- *
- * @param nValidCount Number of valid pixels.
- */
+static int GetNumThreadsForStatistics()
+{
+    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    return std::max(1, std::min(128, EQUAL(pszThreads, "ALL_CPUS")
+                                         ? CPLGetNumCPUs()
+                                         : atoi(pszThreads)));
+}
 
-void GDALRasterBand::SetValidPercent(GUIntBig nSampleCount,
-                                     GUIntBig nValidCount)
+/************************************************************************/
+/*                          GetSampledBlocks()                          */
+/************************************************************************/
+
+static std::vector<int> GetSampledBlocks(int nTotalBlocks, int nSampleRate)
 {
-    if (nValidCount == 0)
+    std::vector<int> anBlocks;
+    anBlocks.reserve(nTotalBlocks / nSampleRate + 1);
+    for (int iSampleBlock = 0; iSampleBlock < nTotalBlocks;
+         iSampleBlock += nSampleRate)
     {
-        SetMetadataItem("STATISTICS_VALID_PERCENT", "0");
+        anBlocks.push_back(iSampleBlock);
     }
-    else if (nValidCount == nSampleCount)
+    return anBlocks;
+}
+
+/************************************************************************/
+/*                          ProcessBlocksMT()                           */
+/************************************************************************/
+
+// Computes an accumulator on each block of anBlocks, by calling
+// oCompute(pData, nXCheck, nYCheck, pabyMaskData, oAcc) from worker threads,
+// and passes them to oMerge(oAcc, iBlock) from the calling thread, in the
+// order of anBlocks, so that the result does not depend on the number of
+// threads. Blocks and mask values are read from the calling thread.
+// oMerge() may return false to stop processing.
+template <class Acc, class ComputeFunc, class MergeFunc>
+static bool ProcessBlocksMT(GDALRasterBand *poBand, GDALRasterBand *poMaskBand,
+                            int nThreads, const std::vector<int> &anBlocks,
+                            int nBlocksPerRow, const Acc &oInitAcc,
+                            const ComputeFunc &oCompute,
+                            const MergeFunc &oMerge)
+{
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+
+    struct Job
     {
-        SetMetadataItem("STATISTICS_VALID_PERCENT", "100");
+        const ComputeFunc *poCompute = nullptr;
+        GDALRasterBlock *poBlock = nullptr;
+        int iSampleBlock = 0;
+        int nXCheck = 0;
+        int nYCheck = 0;
+        std::vector<GByte> abyMask{};
+        Acc oAcc{};
+
+        static void Run(void *pData)
+        {
+            Job *psJob = static_cast<Job *>(pData);
+            (*psJob->poCompute)(
+                psJob->poBlock->GetDataRef(), psJob->nXCheck, psJob->nYCheck,
+                psJob->abyMask.empty() ? nullptr : psJob->abyMask.data(),
+                psJob->oAcc);
+        }
+    };
+
+    // A few blocks per thread, to amortize the synchronization
+    std::vector<Job> asJobs;
+    try
+    {
+        asJobs.resize(static_cast<size_t>(nThreads) * 2);
+        for (auto &sJob : asJobs)
+        {
+            sJob.poCompute = &oCompute;
+            if (poMaskBand)
+                sJob.abyMask.resize(static_cast<size_t>(nBlockXSize) *
+                                    nBlockYSize);
+        }
     }
-    else /* nValidCount < nSampleCount */
+    catch (const std::exception &)
     {
-        char szValue[128] = {0};
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in ProcessBlocksMT()");
+        return false;
+    }
 
-        /* percentage is only an indicator: limit precision */
-        CPLsnprintf(szValue, sizeof(szValue), "%.4g",
-                    100. * static_cast<double>(nValidCount) / nSampleCount);
+    auto poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                   : std::unique_ptr<CPLJobQueue>(nullptr);
 
-        if (EQUAL(szValue, "100"))
+    bool bRet = true;
+    size_t iNext = 0;
+    while (bRet && iNext < anBlocks.size())
+    {
+        size_t nJobs = 0;
+        for (; nJobs < asJobs.size() && iNext < anBlocks.size(); ++iNext)
         {
-            /* don't set 100 percent valid
-             * because some of the sampled pixels were nodata */
-            SetMetadataItem("STATISTICS_VALID_PERCENT", "99.999");
+            const int iSampleBlock = anBlocks[iNext];
+            const int iYBlock = iSampleBlock / nBlocksPerRow;
+            const int iXBlock = iSampleBlock - nBlocksPerRow * iYBlock;
+
+            Job &sJob = asJobs[nJobs];
+            sJob.poBlock = poBand->GetLockedBlockRef(iXBlock, iYBlock);
+            if (sJob.poBlock == nullptr)
+            {
+                bRet = false;
+                break;
+            }
+            ++nJobs;
+            sJob.iSampleBlock = iSampleBlock;
+            poBand->GetActualBlockSize(iXBlock, iYBlock, &sJob.nXCheck,
+                                       &sJob.nYCheck);
+
+            if (poMaskBand &&
+                poMaskBand->RasterIO(GF_Read, iXBlock * nBlockXSize,
+                                     iYBlock * nBlockYSize, sJob.nXCheck,
+                                     sJob.nYCheck, sJob.abyMask.data(),
+                                     sJob.nXCheck, sJob.nYCheck, GDT_Byte, 0,
+                                     nBlockXSize, nullptr) != CE_None)
+            {
+                bRet = false;
+                break;
+            }
+
+            sJob.oAcc = oInitAcc;
+            if (!poJobQueue || !poJobQueue->SubmitJob(Job::Run, &sJob))
+                Job::Run(&sJob);
         }
-        else
+
+        if (poJobQueue)
+            poJobQueue->WaitCompletion();
+
+        for (size_t i = 0; i < nJobs; ++i)
         {
-            SetMetadataItem("STATISTICS_VALID_PERCENT", szValue);
+            if (bRet && !oMerge(asJobs[i].oAcc, asJobs[i].iSampleBlock))
+                bRet = false;
+            asJobs[i].poBlock->DropLock();
         }
     }
-}
 
-//! @endcond
+    return bRet;
+}
 
 /************************************************************************/
 /*                         ComputeStatistics()                          */
@@ -5678,6 +6921,17 @@ void GDALRasterBand::SetValidPercent(GUIntBig nSampleCount,
  *
  * Cached statistics can be cleared with GDALDataset::ClearStatistics().
  *
+ * Starting with GDAL 3.10, the GDAL_NUM_THREADS configuration option can be
+ * set to ALL_CPUS or a integer value to process blocks in parallel. Blocks
+ * are still read from the calling thread. The result does not depend on the
+ * number of threads, but the mean and standard deviation may differ from the
+ * single-threaded computation by floating-point rounding.
+ *
+ * Starting with GDAL 3.10, when the GDAL_STATS_BLOCK_SUMMARIES configuration
+ * option is set to YES, the statistics of each block are kept in memory, so
+ * that a subsequent exact computation only reads the blocks written in the
+ * meantime.
+ *
  * This method is the same as the C function GDALComputeRasterStatistics().
  *
  * @param bApproxOK If TRUE statistics may be computed based on overviews
@@ -5754,16 +7008,7 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
     /* -------------------------------------------------------------------- */
     /*      Read actual data and compute statistics.                        */
     /* -------------------------------------------------------------------- */
-    // Using Welford algorithm:
-    // http://en.wikipedia.org/wiki/Algorithms_for_calculating_variance
-    // to compute standard deviation in a more numerically robust way than
-    // the difference of the sum of square values with the square of the sum.
-    // dfMean and dfM2 are updated at each sample.
-    // dfM2 is the sum of square of differences to the current mean.
-    double dfMin = std::numeric_limits<double>::max();
-    double dfMax = -std::numeric_limits<double>::max();
-    double dfMean = 0.0;
-    double dfM2 = 0.0;
+    StatisticsAccumulator sAcc;
 
     GDALRasterIOExtraArg sExtraArg;
     INIT_RASTERIO_EXTRA_ARG(sExtraArg);
@@ -5859,34 +7104,11 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
             }
         }
 
-        /* this isn't the fastest way to do this, but is easier for now */
-        for (int iY = 0; iY < nYReduced; iY++)
-        {
-            for (int iX = 0; iX < nXReduced; iX++)
-            {
-                const int iOffset = iX + iY * nXReduced;
-                if (pabyMaskData && pabyMaskData[iOffset] == 0)
-                    continue;
-
-                bool bValid = true;
-                double dfValue =
-                    GetPixelValue(eDataType, bSignedByte, pData, iOffset,
-                                  CPL_TO_BOOL(bGotNoDataValue), dfNoDataValue,
-                                  bGotFloatNoDataValue, fNoDataValue, bValid);
-                if (!bValid)
-                    continue;
-
-                dfMin = std::min(dfMin, dfValue);
-                dfMax = std::max(dfMax, dfValue);
-
-                nValidCount++;
-                const double dfDelta = dfValue - dfMean;
-                dfMean += dfDelta / nValidCount;
-                dfM2 += dfDelta * (dfValue - dfMean);
-            }
-        }
-
-        nSampleCount = static_cast<GUIntBig>(nXReduced) * nYReduced;
+        ComputeStatisticsGeneric(pData, eDataType, bSignedByte, nXReduced,
+                                 nYReduced, nXReduced,
+                                 CPL_TO_BOOL(bGotNoDataValue), dfNoDataValue,
+                                 bGotFloatNoDataValue, fNoDataValue,
+                                 pabyMaskData, sAcc);
 
         CPLFree(pData);
         CPLFree(pabyMaskData);
@@ -5918,6 +7140,13 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
         if (nSampleRate == 1)
             bApproxOK = false;
 
+        // Blocks are processed in parallel when GDAL_NUM_THREADS is set and
+        // more than one block is sampled.
+        const int nTotalBlocks = nBlocksPerRow * nBlocksPerColumn;
+        const int nThreads = nTotalBlocks > nSampleRate
+                                 ? GetNumThreadsForStatistics()
+                                 : 1;
+
 #ifdef CPL_HAS_GINT64
         // Particular case for GDT_Byte that only use integral types for all
         // intermediate computations. Only possible if the number of pixels
@@ -5938,10 +7167,8 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                       static_cast<GUInt64>(nBlockYSize))))
         {
             const GUInt32 nMaxValueType = (eDataType == GDT_Byte) ? 255 : 65535;
-            GUInt32 nMin = nMaxValueType;
-            GUInt32 nMax = 0;
-            GUIntBig nSum = 0;
-            GUIntBig nSumSquare = 0;
+            IntegerStatisticsAccumulator sIntAcc;
+            sIntAcc.nMin = nMaxValueType;
             // If no valid nodata, map to invalid value (256 for Byte)
             const GUInt32 nNoDataValue =
                 (bGotNoDataValue && dfNoDataValue >= 0 &&
@@ -5951,31 +7178,20 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                     ? static_cast<GUInt32>(dfNoDataValue + 1e-10)
                     : nMaxValueType + 1;
 
-            for (int iSampleBlock = 0;
-                 iSampleBlock < nBlocksPerRow * nBlocksPerColumn;
-                 iSampleBlock += nSampleRate)
+            const auto ComputeBlock =
+                [this, nNoDataValue,
+                 nMaxValueType](const void *pData, int nXCheck, int nYCheck,
+                                const GByte *, IntegerStatisticsAccumulator &s)
             {
-                const int iYBlock = iSampleBlock / nBlocksPerRow;
-                const int iXBlock = iSampleBlock - nBlocksPerRow * iYBlock;
-
-                GDALRasterBlock *const poBlock =
-                    GetLockedBlockRef(iXBlock, iYBlock);
-                if (poBlock == nullptr)
-                    return CE_Failure;
-
-                void *const pData = poBlock->GetDataRef();
-
-                int nXCheck = 0, nYCheck = 0;
-                GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
-
                 if (eDataType == GDT_Byte)
                 {
                     ComputeStatisticsInternal<
                         GByte, /* COMPUTE_OTHER_STATS = */ true>::
                         f(nXCheck, nBlockXSize, nYCheck,
                           static_cast<const GByte *>(pData),
-                          nNoDataValue <= nMaxValueType, nNoDataValue, nMin,
-                          nMax, nSum, nSumSquare, nSampleCount, nValidCount);
+                          nNoDataValue <= nMaxValueType, nNoDataValue, s.nMin,
+                          s.nMax, s.nSum, s.nSumSquare, s.nSampleCount,
+                          s.nValidCount);
                 }
                 else
                 {
@@ -5983,22 +7199,79 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                         GUInt16, /* COMPUTE_OTHER_STATS = */ true>::
                         f(nXCheck, nBlockXSize, nYCheck,
                           static_cast<const GUInt16 *>(pData),
-                          nNoDataValue <= nMaxValueType, nNoDataValue, nMin,
-                          nMax, nSum, nSumSquare, nSampleCount, nValidCount);
+                          nNoDataValue <= nMaxValueType, nNoDataValue, s.nMin,
+                          s.nMax, s.nSum, s.nSumSquare, s.nSampleCount,
+                          s.nValidCount);
                 }
+            };
 
-                poBlock->DropLock();
-
-                if (!pfnProgress(iSampleBlock /
-                                     static_cast<double>(nBlocksPerRow *
-                                                         nBlocksPerColumn),
-                                 "Compute Statistics", pProgressData))
+            if (nThreads > 1)
+            {
+                IntegerStatisticsAccumulator sInitAcc;
+                sInitAcc.nMin = nMaxValueType;
+                if (!ProcessBlocksMT(
+                        this, nullptr, nThreads,
+                        GetSampledBlocks(nTotalBlocks, nSampleRate),
+                        nBlocksPerRow, sInitAcc, ComputeBlock,
+                        [this, &sIntAcc, nTotalBlocks, pfnProgress,
+                         pProgressData](const IntegerStatisticsAccumulator &s,
+                                        int iSampleBlock)
+                        {
+                            sIntAcc.Merge(s);
+                            if (!pfnProgress(iSampleBlock /
+                                                 static_cast<double>(
+                                                     nTotalBlocks),
+                                             "Compute Statistics",
+                                             pProgressData))
+                            {
+                                ReportError(CE_Failure, CPLE_UserInterrupt,
+                                            "User terminated");
+                                return false;
+                            }
+                            return true;
+                        }))
                 {
-                    ReportError(CE_Failure, CPLE_UserInterrupt,
-                                "User terminated");
                     return CE_Failure;
                 }
             }
+            else
+            {
+                for (int iSampleBlock = 0; iSampleBlock < nTotalBlocks;
+                     iSampleBlock += nSampleRate)
+                {
+                    const int iYBlock = iSampleBlock / nBlocksPerRow;
+                    const int iXBlock = iSampleBlock - nBlocksPerRow * iYBlock;
+
+                    GDALRasterBlock *const poBlock =
+                        GetLockedBlockRef(iXBlock, iYBlock);
+                    if (poBlock == nullptr)
+                        return CE_Failure;
+
+                    int nXCheck = 0, nYCheck = 0;
+                    GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
+
+                    ComputeBlock(poBlock->GetDataRef(), nXCheck, nYCheck,
+                                 nullptr, sIntAcc);
+
+                    poBlock->DropLock();
+
+                    if (!pfnProgress(
+                            iSampleBlock / static_cast<double>(nTotalBlocks),
+                            "Compute Statistics", pProgressData))
+                    {
+                        ReportError(CE_Failure, CPLE_UserInterrupt,
+                                    "User terminated");
+                        return CE_Failure;
+                    }
+                }
+            }
+
+            const GUInt32 nMin = sIntAcc.nMin;
+            const GUInt32 nMax = sIntAcc.nMax;
+            const GUIntBig nSum = sIntAcc.nSum;
+            const GUIntBig nSumSquare = sIntAcc.nSumSquare;
+            nSampleCount = sIntAcc.nSampleCount;
+            nValidCount = sIntAcc.nValidCount;
 
             if (!pfnProgress(1.0, "Compute Statistics", pProgressData))
             {
@@ -6011,8 +7284,8 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
             /*      Save computed information. */
             /* --------------------------------------------------------------------
              */
-            if (nValidCount)
-                dfMean = static_cast<double>(nSum) / nValidCount;
+            const double dfMean =
+                nValidCount ? static_cast<double>(nSum) / nValidCount : 0.0;
 
             // To avoid potential precision issues when doing the difference,
             // we need to do that computation on 128 bit rather than casting
@@ -6066,93 +7339,185 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
         }
 #endif
 
-        GByte *pabyMaskData = nullptr;
-        if (poMaskBand)
+        const auto ComputeBlock =
+            [this, bSignedByte, bGotNoDataValue, dfNoDataValue,
+             bGotFloatNoDataValue,
+             fNoDataValue](const void *pData, int nXCheck, int nYCheck,
+                           const GByte *pabyMask, StatisticsAccumulator &s)
         {
-            pabyMaskData = static_cast<GByte *>(
-                VSI_MALLOC2_VERBOSE(nBlockXSize, nBlockYSize));
-            if (!pabyMaskData)
+            ComputeStatisticsGeneric(pData, eDataType, bSignedByte, nXCheck,
+                                     nYCheck, nBlockXSize,
+                                     CPL_TO_BOOL(bGotNoDataValue),
+                                     dfNoDataValue, bGotFloatNoDataValue,
+                                     fNoDataValue, pabyMask, s);
+        };
+
+        if (nSampleRate == 1 && !poMaskBand &&
+            CPLTestBool(
+                CPLGetConfigOption("GDAL_STATS_BLOCK_SUMMARIES", "NO")))
+        {
+            GDALRasterBandBlockStatistics *poStats;
             {
-                return CE_Failure;
+                std::lock_guard<std::mutex> oLock(goBlockStatisticsMutex);
+                poStats = m_poBlockStatistics;
+            }
+            if (poStats == nullptr ||
+                poStats->bGotNoDataValue != CPL_TO_BOOL(bGotNoDataValue) ||
+                !((std::isnan(poStats->dfNoDataValue) &&
+                   std::isnan(dfNoDataValue)) ||
+                  poStats->dfNoDataValue == dfNoDataValue) ||
+                poStats->bSignedByte != bSignedByte)
+            {
+                try
+                {
+                    poStats = new GDALRasterBandBlockStatistics();
+                    poStats->asBlocks.resize(nTotalBlocks);
+                    poStats->abValid.resize(nTotalBlocks);
+                }
+                catch (const std::exception &)
+                {
+                    delete poStats;
+                    ReportError(CE_Failure, CPLE_OutOfMemory,
+                                "Out of memory in ComputeStatistics()");
+                    return CE_Failure;
+                }
+                poStats->bGotNoDataValue = CPL_TO_BOOL(bGotNoDataValue);
+                poStats->dfNoDataValue = dfNoDataValue;
+                poStats->bSignedByte = bSignedByte;
+                GDALRasterBandBlockStatistics *poOldStats;
+                {
+                    std::lock_guard<std::mutex> oLock(goBlockStatisticsMutex);
+                    poOldStats = m_poBlockStatistics;
+                    m_poBlockStatistics = poStats;
+                    gbBlockStatisticsCreated = true;
+                }
+                delete poOldStats;
             }
-        }
 
-        for (int iSampleBlock = 0;
-             iSampleBlock < nBlocksPerRow * nBlocksPerColumn;
-             iSampleBlock += nSampleRate)
-        {
-            const int iYBlock = iSampleBlock / nBlocksPerRow;
-            const int iXBlock = iSampleBlock - nBlocksPerRow * iYBlock;
+            // Only blocks modified since the last computation are read
+            std::vector<int> anBlocks;
+            {
+                std::lock_guard<std::mutex> oLock(poStats->oMutex);
+                for (int iBlock = 0; iBlock < nTotalBlocks; ++iBlock)
+                {
+                    if (!poStats->abValid[iBlock])
+                        anBlocks.push_back(iBlock);
+                }
+            }
 
-            GDALRasterBlock *const poBlock =
-                GetLockedBlockRef(iXBlock, iYBlock);
-            if (poBlock == nullptr)
+            if (!ProcessBlocksMT(
+                    this, nullptr, nThreads, anBlocks, nBlocksPerRow,
+                    StatisticsAccumulator(), ComputeBlock,
+                    [this, poStats, nTotalBlocks, pfnProgress,
+                     pProgressData](const StatisticsAccumulator &s, int iBlock)
+                    {
+                        {
+                            std::lock_guard<std::mutex> oLock(poStats->oMutex);
+                            poStats->asBlocks[iBlock] = s;
+                            poStats->abValid[iBlock] = true;
+                        }
+                        if (!pfnProgress(iBlock /
+                                             static_cast<double>(nTotalBlocks),
+                                         "Compute Statistics", pProgressData))
+                        {
+                            ReportError(CE_Failure, CPLE_UserInterrupt,
+                                        "User terminated");
+                            return false;
+                        }
+                        return true;
+                    }))
             {
-                CPLFree(pabyMaskData);
                 return CE_Failure;
             }
 
-            void *const pData = poBlock->GetDataRef();
-
-            int nXCheck = 0, nYCheck = 0;
-            GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
-
-            if (poMaskBand &&
-                poMaskBand->RasterIO(GF_Read, iXBlock * nBlockXSize,
-                                     iYBlock * nBlockYSize, nXCheck, nYCheck,
-                                     pabyMaskData, nXCheck, nYCheck, GDT_Byte,
-                                     0, nBlockXSize, nullptr) != CE_None)
+            for (const auto &sBlockAcc : poStats->asBlocks)
+                sAcc.Merge(sBlockAcc);
+        }
+        else if (nThreads > 1)
+        {
+            if (!ProcessBlocksMT(
+                    this, poMaskBand, nThreads,
+                    GetSampledBlocks(nTotalBlocks, nSampleRate),
+                    nBlocksPerRow, StatisticsAccumulator(), ComputeBlock,
+                    [this, &sAcc, nTotalBlocks, pfnProgress,
+                     pProgressData](const StatisticsAccumulator &s,
+                                    int iSampleBlock)
+                    {
+                        sAcc.Merge(s);
+                        if (!pfnProgress(iSampleBlock /
+                                             static_cast<double>(nTotalBlocks),
+                                         "Compute Statistics", pProgressData))
+                        {
+                            ReportError(CE_Failure, CPLE_UserInterrupt,
+                                        "User terminated");
+                            return false;
+                        }
+                        return true;
+                    }))
             {
-                CPLFree(pabyMaskData);
-                poBlock->DropLock();
                 return CE_Failure;
             }
-
-            // This isn't the fastest way to do this, but is easier for now.
-            for (int iY = 0; iY < nYCheck; iY++)
+        }
+        else
+        {
+            GByte *pabyMaskData = nullptr;
+            if (poMaskBand)
             {
-                for (int iX = 0; iX < nXCheck; iX++)
+                pabyMaskData = static_cast<GByte *>(
+                    VSI_MALLOC2_VERBOSE(nBlockXSize, nBlockYSize));
+                if (!pabyMaskData)
                 {
-                    const GPtrDiff_t iOffset =
-                        iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
-                    if (pabyMaskData && pabyMaskData[iOffset] == 0)
-                        continue;
+                    return CE_Failure;
+                }
+            }
+
+            for (int iSampleBlock = 0; iSampleBlock < nTotalBlocks;
+                 iSampleBlock += nSampleRate)
+            {
+                const int iYBlock = iSampleBlock / nBlocksPerRow;
+                const int iXBlock = iSampleBlock - nBlocksPerRow * iYBlock;
 
-                    bool bValid = true;
-                    double dfValue = GetPixelValue(
-                        eDataType, bSignedByte, pData, iOffset,
-                        CPL_TO_BOOL(bGotNoDataValue), dfNoDataValue,
-                        bGotFloatNoDataValue, fNoDataValue, bValid);
+                GDALRasterBlock *const poBlock =
+                    GetLockedBlockRef(iXBlock, iYBlock);
+                if (poBlock == nullptr)
+                {
+                    CPLFree(pabyMaskData);
+                    return CE_Failure;
+                }
 
-                    if (!bValid)
-                        continue;
+                void *const pData = poBlock->GetDataRef();
 
-                    dfMin = std::min(dfMin, dfValue);
-                    dfMax = std::max(dfMax, dfValue);
+                int nXCheck = 0, nYCheck = 0;
+                GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
 
-                    nValidCount++;
-                    const double dfDelta = dfValue - dfMean;
-                    dfMean += dfDelta / nValidCount;
-                    dfM2 += dfDelta * (dfValue - dfMean);
+                if (poMaskBand &&
+                    poMaskBand->RasterIO(
+                        GF_Read, iXBlock * nBlockXSize, iYBlock * nBlockYSize,
+                        nXCheck, nYCheck, pabyMaskData, nXCheck, nYCheck,
+                        GDT_Byte, 0, nBlockXSize, nullptr) != CE_None)
+                {
+                    CPLFree(pabyMaskData);
+                    poBlock->DropLock();
+                    return CE_Failure;
                 }
-            }
 
-            nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
+                ComputeBlock(pData, nXCheck, nYCheck, pabyMaskData, sAcc);
 
-            poBlock->DropLock();
+                poBlock->DropLock();
 
-            if (!pfnProgress(
-                    iSampleBlock /
-                        static_cast<double>(nBlocksPerRow * nBlocksPerColumn),
-                    "Compute Statistics", pProgressData))
-            {
-                ReportError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                CPLFree(pabyMaskData);
-                return CE_Failure;
+                if (!pfnProgress(
+                        iSampleBlock / static_cast<double>(nTotalBlocks),
+                        "Compute Statistics", pProgressData))
+                {
+                    ReportError(CE_Failure, CPLE_UserInterrupt,
+                                "User terminated");
+                    CPLFree(pabyMaskData);
+                    return CE_Failure;
+                }
             }
-        }
 
-        CPLFree(pabyMaskData);
+            CPLFree(pabyMaskData);
+        }
     }
 
     if (!pfnProgress(1.0, "Compute Statistics", pProgressData))
@@ -6164,7 +7529,13 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
     /* -------------------------------------------------------------------- */
     /*      Save computed information.                                      */
     /* -------------------------------------------------------------------- */
-    const double dfStdDev = nValidCount > 0 ? sqrt(dfM2 / nValidCount) : 0.0;
+    double dfMin = sAcc.dfMin;
+    double dfMax = sAcc.dfMax;
+    const double dfMean = sAcc.dfMean;
+    nSampleCount = sAcc.nSampleCount;
+    nValidCount = sAcc.nValidCount;
+    const double dfStdDev =
+        nValidCount > 0 ? sqrt(sAcc.dfM2 / nValidCount) : 0.0;
 
     if (nValidCount > 0)
     {
@@ -6551,6 +7922,11 @@ static bool ComputeMinMaxGenericIterBlocks(
  * If bApprox is FALSE, then all pixels will be read and used to compute
  * an exact range.
  *
+ * Starting with GDAL 3.10, the GDAL_NUM_THREADS configuration option can be
+ * set to ALL_CPUS or a integer value to process blocks in parallel, for data
+ * types and masks that are not handled by the optimized single-threaded code
+ * paths.
+ *
  * This method is the same as the C function GDALComputeRasterMinMax().
  *
  * @param bApproxOK TRUE if an approximate (faster) answer is OK, otherwise
@@ -6839,11 +8215,44 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
         else
         {
             const int nTotalBlocks = nBlocksPerRow * nBlocksPerColumn;
-            if (!ComputeMinMaxGenericIterBlocks(
-                    this, eDataType, bSignedByte, nTotalBlocks, nSampleRate,
-                    nBlocksPerRow, CPL_TO_BOOL(bGotNoDataValue), dfNoDataValue,
-                    bGotFloatNoDataValue, fNoDataValue, poMaskBand, dfMin,
-                    dfMax))
+            const int nThreads = nTotalBlocks > nSampleRate
+                                     ? GetNumThreadsForStatistics()
+                                     : 1;
+            if (nThreads > 1)
+            {
+                if (!ProcessBlocksMT(
+                        this, poMaskBand, nThreads,
+                        GetSampledBlocks(nTotalBlocks, nSampleRate),
+                        nBlocksPerRow, MinMaxAccumulator(),
+                        [this, bSignedByte, bGotNoDataValue, dfNoDataValue,
+                         bGotFloatNoDataValue,
+                         fNoDataValue](const void *pData, int nXCheck,
+                                       int nYCheck, const GByte *pabyMask,
+                                       MinMaxAccumulator &s)
+                        {
+                            ComputeMinMaxGeneric(
+                                pData, eDataType, bSignedByte, nXCheck,
+                                nYCheck, nBlockXSize,
+                                CPL_TO_BOOL(bGotNoDataValue), dfNoDataValue,
+                                bGotFloatNoDataValue, fNoDataValue, pabyMask,
+                                s.dfMin, s.dfMax);
+                        },
+                        [&dfMin, &dfMax](const MinMaxAccumulator &s, int)
+                        {
+                            dfMin = std::min(dfMin, s.dfMin);
+                            dfMax = std::max(dfMax, s.dfMax);
+                            return true;
+                        }))
+                {
+                    return CE_Failure;
+                }
+            }
+            else if (!ComputeMinMaxGenericIterBlocks(
+                         this, eDataType, bSignedByte, nTotalBlocks,
+                         nSampleRate, nBlocksPerRow,
+                         CPL_TO_BOOL(bGotNoDataValue), dfNoDataValue,
+                         bGotFloatNoDataValue, fNoDataValue, poMaskBand, dfMin,
+                         dfMax))
             {
                 return CE_Failure;
             }
@@ -0,0 +1,496 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  Export of raster blocks as an Arrow C stream
+ * Author:   agent, <agent at local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent at local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "gdal_priv.h"
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_string.h"
+#include "ogr_recordbatch.h"
+
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+//! @cond Doxygen_Suppress
+
+namespace
+{
+
+constexpr const char *BLOCK_X_OFF_FIELD = "block_x_off";
+constexpr const char *BLOCK_Y_OFF_FIELD = "block_y_off";
+constexpr const char *WIDTH_FIELD = "width";
+constexpr const char *HEIGHT_FIELD = "height";
+constexpr const char *DATA_FIELD = "data";
+constexpr int FIELD_COUNT = 5;
+
+/************************************************************************/
+/*                       GetArrowFormatFromDataType()                   */
+/************************************************************************/
+
+const char *GetArrowFormatFromDataType(GDALDataType eDT)
+{
+    switch (eDT)
+    {
+        case GDT_Byte:
+            return "C";
+        case GDT_Int8:
+            return "c";
+        case GDT_UInt16:
+            return "S";
+        case GDT_Int16:
+            return "s";
+        case GDT_UInt32:
+            return "I";
+        case GDT_Int32:
+            return "i";
+        case GDT_UInt64:
+            return "L";
+        case GDT_Int64:
+            return "l";
+        case GDT_Float32:
+            return "f";
+        case GDT_Float64:
+            return "g";
+        default:
+            break;
+    }
+    return nullptr;
+}
+
+/************************************************************************/
+/*                           Schema building                            */
+/************************************************************************/
+
+void ReleaseSchema(struct ArrowSchema *schema)
+{
+    CPLFree(const_cast<char *>(schema->format));
+    CPLFree(const_cast<char *>(schema->name));
+    CPLFree(const_cast<char *>(schema->metadata));
+    for (int64_t i = 0; i < schema->n_children; ++i)
+    {
+        if (schema->children[i]->release)
+            schema->children[i]->release(schema->children[i]);
+        CPLFree(schema->children[i]);
+    }
+    CPLFree(schema->children);
+    schema->release = nullptr;
+}
+
+void InitSchema(struct ArrowSchema *schema, const char *pszFormat,
+                const char *pszName, int nChildren)
+{
+    memset(schema, 0, sizeof(*schema));
+    schema->format = CPLStrdup(pszFormat);
+    schema->name = CPLStrdup(pszName);
+    schema->release = ReleaseSchema;
+    schema->n_children = nChildren;
+    if (nChildren)
+    {
+        schema->children = static_cast<struct ArrowSchema **>(
+            CPLCalloc(nChildren, sizeof(struct ArrowSchema *)));
+        for (int i = 0; i < nChildren; ++i)
+        {
+            schema->children[i] = static_cast<struct ArrowSchema *>(
+                CPLCalloc(1, sizeof(struct ArrowSchema)));
+        }
+    }
+}
+
+// Encode key/value pairs in the binary format of ArrowSchema::metadata.
+char *
+BuildArrowMetadata(const std::vector<std::pair<std::string, std::string>> &kv)
+{
+    size_t nSize = sizeof(int32_t);
+    for (const auto &oPair : kv)
+        nSize += 2 * sizeof(int32_t) + oPair.first.size() + oPair.second.size();
+    char *pszMetadata = static_cast<char *>(CPLMalloc(nSize));
+    char *pszIter = pszMetadata;
+    const auto AppendInt32 = [&pszIter](size_t nVal)
+    {
+        const int32_t nVal32 = static_cast<int32_t>(nVal);
+        memcpy(pszIter, &nVal32, sizeof(int32_t));
+        pszIter += sizeof(int32_t);
+    };
+    const auto AppendString = [&pszIter, &AppendInt32](const std::string &s)
+    {
+        AppendInt32(s.size());
+        memcpy(pszIter, s.data(), s.size());
+        pszIter += s.size();
+    };
+    AppendInt32(kv.size());
+    for (const auto &oPair : kv)
+    {
+        AppendString(oPair.first);
+        AppendString(oPair.second);
+    }
+    return pszMetadata;
+}
+
+/************************************************************************/
+/*                            Array building                            */
+/************************************************************************/
+
+// Owns the memory referenced by an ArrowArray created by this file.
+struct ArrayPrivateData
+{
+    std::vector<int32_t> anValues{};
+    std::vector<GByte> abyData{};
+    GDALRasterBlockView oView{};
+    std::vector<const void *> apBuffers{};
+    std::vector<struct ArrowArray *> apChildren{};
+};
+
+void ReleaseArray(struct ArrowArray *array)
+{
+    auto psPrivate = static_cast<ArrayPrivateData *>(array->private_data);
+    for (auto *psChild : psPrivate->apChildren)
+    {
+        if (psChild->release)
+            psChild->release(psChild);
+        delete psChild;
+    }
+    delete psPrivate;
+    array->release = nullptr;
+}
+
+ArrayPrivateData *InitArray(struct ArrowArray *array, int64_t nLength,
+                            int nBuffers, int nChildren)
+{
+    memset(array, 0, sizeof(*array));
+    auto psPrivate = new ArrayPrivateData();
+    psPrivate->apBuffers.resize(nBuffers);
+    for (int i = 0; i < nChildren; ++i)
+    {
+        auto psChild = new struct ArrowArray;
+        memset(psChild, 0, sizeof(*psChild));
+        psPrivate->apChildren.push_back(psChild);
+    }
+    array->length = nLength;
+    array->n_buffers = nBuffers;
+    array->buffers = psPrivate->apBuffers.data();
+    array->n_children = nChildren;
+    array->children = nChildren ? psPrivate->apChildren.data() : nullptr;
+    array->private_data = psPrivate;
+    array->release = ReleaseArray;
+    return psPrivate;
+}
+
+/************************************************************************/
+/*                   GDALRasterBandArrowStreamPrivate                   */
+/************************************************************************/
+
+struct GDALRasterBandArrowStreamPrivate
+{
+    GDALRasterBand *poBand = nullptr;
+    const char *pszItemFormat = nullptr;
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    int nBlocksPerRow = 0;
+    int nBlocksPerColumn = 0;
+    int64_t nNextBlock = 0;
+    int nMaxBlocksInBatch = 1;
+    bool bZeroCopy = true;
+    std::string osLastError{};
+};
+
+int GetSchema(struct ArrowArrayStream *stream, struct ArrowSchema *out_schema)
+{
+    auto psPrivate =
+        static_cast<GDALRasterBandArrowStreamPrivate *>(stream->private_data);
+
+    InitSchema(out_schema, "+s", "", FIELD_COUNT);
+    const char *const apszIntFields[] = {BLOCK_X_OFF_FIELD, BLOCK_Y_OFF_FIELD,
+                                         WIDTH_FIELD, HEIGHT_FIELD};
+    for (int i = 0; i < 4; ++i)
+        InitSchema(out_schema->children[i], "i", apszIntFields[i], 0);
+
+    const int nValuesPerBlock =
+        psPrivate->nBlockXSize * psPrivate->nBlockYSize;
+    auto psData = out_schema->children[FIELD_COUNT - 1];
+    InitSchema(psData, CPLSPrintf("+w:%d", nValuesPerBlock), DATA_FIELD, 1);
+    // Advertise the block shape with the canonical fixed shape tensor
+    // extension type.
+    psData->metadata = BuildArrowMetadata(
+        {{"ARROW:extension:name", "arrow.fixed_shape_tensor"},
+         {"ARROW:extension:metadata",
+          CPLSPrintf("{\"shape\":[%d,%d],\"dim_names\":[\"y\",\"x\"]}",
+                     psPrivate->nBlockYSize, psPrivate->nBlockXSize)}});
+    InitSchema(psData->children[0], psPrivate->pszItemFormat, "item", 0);
+
+    return 0;
+}
+
+int GetNext(struct ArrowArrayStream *stream, struct ArrowArray *out_array)
+{
+    auto psPrivate =
+        static_cast<GDALRasterBandArrowStreamPrivate *>(stream->private_data);
+    const int64_t nBlockCount =
+        static_cast<int64_t>(psPrivate->nBlocksPerRow) *
+        psPrivate->nBlocksPerColumn;
+    if (psPrivate->nNextBlock >= nBlockCount)
+    {
+        // End of stream
+        memset(out_array, 0, sizeof(*out_array));
+        return 0;
+    }
+
+    const int nBlocks = static_cast<int>(
+        std::min<int64_t>(psPrivate->nMaxBlocksInBatch,
+                          nBlockCount - psPrivate->nNextBlock));
+    const bool bZeroCopy = psPrivate->bZeroCopy && nBlocks == 1;
+    GDALRasterBand *poBand = psPrivate->poBand;
+    const int nDTSize =
+        GDALGetDataTypeSizeBytes(poBand->GetRasterDataType());
+    const size_t nBlockBytes = static_cast<size_t>(psPrivate->nBlockXSize) *
+                               psPrivate->nBlockYSize * nDTSize;
+
+    InitArray(out_array, nBlocks, 1, FIELD_COUNT);
+    std::vector<int32_t *> apanValues;
+    for (int i = 0; i < 4; ++i)
+    {
+        auto psChildPrivate =
+            InitArray(out_array->children[i], nBlocks, 2, 0);
+        psChildPrivate->anValues.resize(nBlocks);
+        psChildPrivate->apBuffers[1] = psChildPrivate->anValues.data();
+        apanValues.push_back(psChildPrivate->anValues.data());
+    }
+    auto psData = out_array->children[FIELD_COUNT - 1];
+    InitArray(psData, nBlocks, 1, 1);
+    auto psItemsPrivate = InitArray(
+        psData->children[0],
+        static_cast<int64_t>(nBlocks) * psPrivate->nBlockXSize *
+            psPrivate->nBlockYSize,
+        2, 0);
+    if (!bZeroCopy)
+    {
+        try
+        {
+            psItemsPrivate->abyData.resize(nBlockBytes * nBlocks);
+        }
+        catch (const std::exception &)
+        {
+            out_array->release(out_array);
+            memset(out_array, 0, sizeof(*out_array));
+            psPrivate->osLastError = "Out of memory";
+            CPLError(CE_Failure, CPLE_OutOfMemory, "%s",
+                     psPrivate->osLastError.c_str());
+            return ENOMEM;
+        }
+        psItemsPrivate->apBuffers[1] = psItemsPrivate->abyData.data();
+    }
+
+    for (int i = 0; i < nBlocks; ++i, ++psPrivate->nNextBlock)
+    {
+        const int nXBlockOff =
+            static_cast<int>(psPrivate->nNextBlock % psPrivate->nBlocksPerRow);
+        const int nYBlockOff =
+            static_cast<int>(psPrivate->nNextBlock / psPrivate->nBlocksPerRow);
+        auto oView = poBand->GetBlockView(nXBlockOff, nYBlockOff);
+        if (!oView)
+        {
+            out_array->release(out_array);
+            memset(out_array, 0, sizeof(*out_array));
+            psPrivate->osLastError = CPLGetLastErrorMsg();
+            if (psPrivate->osLastError.empty())
+                psPrivate->osLastError = CPLSPrintf(
+                    "Cannot read block (%d,%d)", nXBlockOff, nYBlockOff);
+            return EIO;
+        }
+        int nXValid = 0;
+        int nYValid = 0;
+        poBand->GetActualBlockSize(nXBlockOff, nYBlockOff, &nXValid,
+                                   &nYValid);
+        apanValues[0][i] = nXBlockOff;
+        apanValues[1][i] = nYBlockOff;
+        apanValues[2][i] = nXValid;
+        apanValues[3][i] = nYValid;
+        if (bZeroCopy)
+        {
+            // The view keeps the block locked in the cache until the array
+            // is released.
+            psItemsPrivate->apBuffers[1] = oView.GetData();
+            psItemsPrivate->oView = std::move(oView);
+        }
+        else
+        {
+            memcpy(psItemsPrivate->abyData.data() + i * nBlockBytes,
+                   oView.GetData(), nBlockBytes);
+        }
+    }
+
+    return 0;
+}
+
+const char *GetLastError(struct ArrowArrayStream *stream)
+{
+    auto psPrivate =
+        static_cast<GDALRasterBandArrowStreamPrivate *>(stream->private_data);
+    return psPrivate->osLastError.empty() ? nullptr
+                                          : psPrivate->osLastError.c_str();
+}
+
+void ReleaseStream(struct ArrowArrayStream *stream)
+{
+    delete static_cast<GDALRasterBandArrowStreamPrivate *>(
+        stream->private_data);
+    stream->private_data = nullptr;
+    stream->release = nullptr;
+}
+
+}  // namespace
+
+//! @endcond
+
+/************************************************************************/
+/*                           GetArrowStream()                           */
+/************************************************************************/
+
+/**
+ * \brief Get an Arrow C stream on the blocks of the band.
+ *
+ * Each row of the record batches returned by the stream corresponds to a
+ * block of the band, and blocks are returned in row-major order (from left
+ * to right, and then from top to bottom). The schema of the record batches
+ * is a struct with the following children:
+ * <ul>
+ * <li>block_x_off (int32): horizontal offset of the block</li>
+ * <li>block_y_off (int32): vertical offset of the block</li>
+ * <li>width (int32): number of valid columns of the block, which is smaller
+ * than the block width for blocks at the right edge of the raster</li>
+ * <li>height (int32): number of valid rows of the block, which is smaller
+ * than the block height for blocks at the bottom edge of the raster</li>
+ * <li>data: a FixedSizeList of block width * block height values of the
+ * data type of the band, packed in row-major order, and exposed with the
+ * arrow.fixed_shape_tensor extension type of shape [block height, block
+ * width]. For partial blocks, only the top-left part of width * height
+ * values is meaningful.</li>
+ * </ul>
+ *
+ * Complex data types are not supported.
+ *
+ * By default, each record batch contains a single block, and its data buffer
+ * points directly to the memory of the block in the block cache, without any
+ * copy. The block is kept locked in the cache until the array is released.
+ * Consequently, all arrays returned by the stream must be released before
+ * the band is flushed or its dataset is closed. In all cases, the band must
+ * be kept alive while the stream is used.
+ *
+ * Supported options are:
+ * <ul>
+ * <li>MAX_BLOCKS_IN_BATCH=integer: maximum number of blocks in each record
+ * batch. Defaults to 1. Values greater than 1 imply a copy of the blocks
+ * into a contiguous buffer.</li>
+ * <li>ZERO_COPY=YES/NO: whether single-block batches should directly
+ * reference the block cache memory. Defaults to YES. Setting it to NO makes
+ * the arrays independent of the lifetime of the band.</li>
+ * </ul>
+ *
+ * This method is the same as the C function GDALRasterBandGetArrowStream().
+ *
+ * @param out_stream Pointer to an array stream, which must be released by
+ * the caller with out_stream->release(out_stream) after use.
+ * @param papszOptions NULL terminated list of options, or NULL.
+ * @return true in case of success.
+ * @since GDAL 3.10
+ */
+bool GDALRasterBand::GetArrowStream(struct ArrowArrayStream *out_stream,
+                                    CSLConstList papszOptions)
+{
+    memset(out_stream, 0, sizeof(*out_stream));
+
+    const char *pszItemFormat = GetArrowFormatFromDataType(eDataType);
+    if (!pszItemFormat)
+    {
+        ReportError(CE_Failure, CPLE_NotSupported,
+                    "GetArrowStream(): data type %s is not supported",
+                    GDALGetDataTypeName(eDataType));
+        return false;
+    }
+    if (nBlockXSize <= 0 || nBlockYSize <= 0 ||
+        nBlockXSize > std::numeric_limits<int>::max() / nBlockYSize)
+    {
+        ReportError(CE_Failure, CPLE_NotSupported,
+                    "GetArrowStream(): block size %dx%d is not supported",
+                    nBlockXSize, nBlockYSize);
+        return false;
+    }
+
+    const int nMaxBlocksInBatch = atoi(
+        CSLFetchNameValueDef(papszOptions, "MAX_BLOCKS_IN_BATCH", "1"));
+    if (nMaxBlocksInBatch <= 0)
+    {
+        ReportError(CE_Failure, CPLE_IllegalArg,
+                    "GetArrowStream(): invalid value for MAX_BLOCKS_IN_BATCH");
+        return false;
+    }
+
+    auto psPrivate = new GDALRasterBandArrowStreamPrivate();
+    psPrivate->poBand = this;
+    psPrivate->pszItemFormat = pszItemFormat;
+    psPrivate->nBlockXSize = nBlockXSize;
+    psPrivate->nBlockYSize = nBlockYSize;
+    psPrivate->nBlocksPerRow = DIV_ROUND_UP(nRasterXSize, nBlockXSize);
+    psPrivate->nBlocksPerColumn = DIV_ROUND_UP(nRasterYSize, nBlockYSize);
+    psPrivate->nMaxBlocksInBatch = nMaxBlocksInBatch;
+    psPrivate->bZeroCopy =
+        CPLTestBool(CSLFetchNameValueDef(papszOptions, "ZERO_COPY", "YES"));
+
+    out_stream->get_schema = GetSchema;
+    out_stream->get_next = GetNext;
+    out_stream->get_last_error = GetLastError;
+    out_stream->release = ReleaseStream;
+    out_stream->private_data = psPrivate;
+    return true;
+}
+
+/************************************************************************/
+/*                    GDALRasterBandGetArrowStream()                    */
+/************************************************************************/
+
+/**
+ * \brief Get an Arrow C stream on the blocks of the band.
+ *
+ * This function is the same as the C++ method
+ * GDALRasterBand::GetArrowStream().
+ *
+ * @since GDAL 3.10
+ */
+bool GDALRasterBandGetArrowStream(GDALRasterBandH hBand,
+                                  struct ArrowArrayStream *out_stream,
+                                  CSLConstList papszOptions)
+{
+    VALIDATE_POINTER1(hBand, __func__, false);
+    VALIDATE_POINTER1(out_stream, __func__, false);
+    return GDALRasterBand::FromHandle(hBand)->GetArrowStream(out_stream,
+                                                             papszOptions);
+}
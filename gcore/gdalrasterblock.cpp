@@ -35,33 +35,32 @@
 #include <algorithm>
 #include <climits>
 #include <cstring>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 #include "cpl_atomic_ops.h"
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_json.h"
 #include "cpl_multiproc.h"
+#include "cpl_runtime_metrics.h"
 #include "cpl_string.h"
+#include "cpl_trace.h"
 #include "cpl_vsi.h"
 
 // Will later be overridden by the default 5% if GDAL_CACHEMAX not defined.
 static GIntBig nCacheMax = 40 * 1024 * 1024;
-static GIntBig nCacheUsed = 0;
-
-static GDALRasterBlock *poOldest = nullptr;  // Tail.
-static GDALRasterBlock *poNewest = nullptr;  // Head.
+static std::atomic<GIntBig> nCacheUsed{0};
 
 static int nDisableDirtyBlockFlushCounter = 0;
 
-#if 0
-static CPLMutex *hRBLock = nullptr;
-#define INITIALIZE_LOCK CPLMutexHolderD(&hRBLock)
-#define TAKE_LOCK CPLMutexHolderOptionalLockD(hRBLock)
-#define DESTROY_LOCK CPLDestroyMutex(hRBLock)
-#else
-
-static CPLLock *hRBLock = nullptr;
 static bool bDebugContention = false;
+static bool bMeasureLockWait = false;
 static bool bSleepsForBockCacheDebug = false;
 
 static CPLLockType GetLockType()
@@ -87,17 +86,312 @@ static CPLLockType GetLockType()
         }
         bDebugContention = CPLTestBool(
             CPLGetConfigOption("GDAL_RB_LOCK_DEBUG_CONTENTION", "NO"));
+        bMeasureLockWait = CPLTestBool(
+            CPLGetConfigOption("GDAL_RB_LOCK_WAIT_METRICS", "NO"));
     }
     return static_cast<CPLLockType>(nLockType);
 }
 
-#define INITIALIZE_LOCK                                                        \
-    CPLLockHolderD(&hRBLock, GetLockType());                                   \
-    CPLLockSetDebugPerf(hRBLock, bDebugContention)
-#define TAKE_LOCK CPLLockHolderOptionalLockD(hRBLock)
-#define DESTROY_LOCK CPLDestroyLock(hRBLock)
+namespace
+{
+// Accumulates the time spent acquiring a block cache lock into the
+// BLOCK_CACHE_LOCK_WAIT_NS metric, when GDAL_RB_LOCK_WAIT_METRICS is set.
+class GDALRBLockWaitTimer
+{
+    int64_t m_nStartNs = 0;
 
-#endif
+  public:
+    GDALRBLockWaitTimer()
+    {
+        if (bMeasureLockWait)
+            m_nStartNs = CPLRuntimeMetricNowNs();
+    }
+
+    void Stop() const
+    {
+        if (m_nStartNs)
+        {
+            CPLRuntimeMetricAdd(CPLRuntimeMetric::BLOCK_CACHE_LOCK_WAIT_NS,
+                                CPLRuntimeMetricNowNs() - m_nStartNs);
+        }
+    }
+};
+}  // namespace
+
+#define INITIALIZE_LOCK(hLock)                                                 \
+    const GDALRBLockWaitTimer oLockWaitTimer;                                  \
+    CPLLockHolderD(&(hLock), GetLockType());                                   \
+    oLockWaitTimer.Stop();                                                     \
+    CPLLockSetDebugPerf((hLock), bDebugContention)
+#define TAKE_LOCK(hLock)                                                       \
+    const GDALRBLockWaitTimer oLockWaitTimer;                                  \
+    CPLLockHolderOptionalLockD(hLock);                                         \
+    oLockWaitTimer.Stop()
+#define DESTROY_LOCK(hLock) CPLDestroyLock(hLock)
+
+/************************************************************************/
+/*                       GDALRasterBlockCacheShard                      */
+/************************************************************************/
+
+// The global block cache is split into one or several shards (see the
+// GDAL_CACHEMAX_SHARDS configuration option), each with its own LRU list
+// and lock. A block is assigned to a shard from a hash of its band and
+// block coordinates. The cache size limit remains global.
+namespace
+{
+struct GDALRasterBlockCacheShard
+{
+    CPLLock *hLock = nullptr;
+    GDALRasterBlock *poOldest = nullptr;  // Tail.
+    GDALRasterBlock *poNewest = nullptr;  // Head.
+};
+}  // namespace
+
+constexpr int MAX_CACHE_SHARDS = 256;
+static GDALRasterBlockCacheShard asShards[MAX_CACHE_SHARDS];
+static int nShards = 1;
+static std::atomic<unsigned> nFlushShardCounter{0};
+
+/************************************************************************/
+/*                      GDALRasterBlockBufferPool                       */
+/************************************************************************/
+
+// Data buffers of evicted or destroyed blocks are kept per allocation size
+// (that is per block size and data type), to be reused by the next
+// Internalize() call for the same size, instead of a VSIFreeAligned() /
+// VSIMallocAligned() pair at each eviction. This limits allocator traffic
+// and heap fragmentation when blocks are constantly recycled.
+// The pool is bounded, so that cached blocks and pooled buffers together
+// use at most the cache maximum, and it is emptied when the block cache
+// becomes empty. It can be disabled with GDAL_BLOCK_BUFFER_POOL=NO.
+namespace
+{
+struct GDALRasterBlockBufferPool
+{
+    std::mutex oMutex{};
+    std::map<size_t, std::vector<void *>> oMapFreeBuffers{};
+    GIntBig nBytes = 0;
+
+    GDALRasterBlockBufferPool() = default;
+
+    ~GDALRasterBlockBufferPool()
+    {
+        Trim(0);
+    }
+
+    // Must be called with oMutex held, or at destruction
+    void Trim(GIntBig nMaxBytes)
+    {
+        auto oIter = oMapFreeBuffers.begin();
+        while (nBytes > nMaxBytes && oIter != oMapFreeBuffers.end())
+        {
+            auto &apBuffers = oIter->second;
+            while (nBytes > nMaxBytes && !apBuffers.empty())
+            {
+                VSIFreeAligned(apBuffers.back());
+                apBuffers.pop_back();
+                nBytes -= static_cast<GIntBig>(oIter->first);
+            }
+            if (apBuffers.empty())
+                oIter = oMapFreeBuffers.erase(oIter);
+            else
+                ++oIter;
+        }
+    }
+
+    GDALRasterBlockBufferPool(const GDALRasterBlockBufferPool &) = delete;
+    GDALRasterBlockBufferPool &
+    operator=(const GDALRasterBlockBufferPool &) = delete;
+};
+}  // namespace
+
+static bool bUseBufferPool = true;
+
+static GDALRasterBlockBufferPool &GetBufferPool()
+{
+    static GDALRasterBlockBufferPool oPool;
+    return oPool;
+}
+
+/************************************************************************/
+/*                        GDALRBAcquireBuffer()                         */
+/************************************************************************/
+
+static void *GDALRBAcquireBuffer(size_t nSize)
+{
+    if (bUseBufferPool)
+    {
+        auto &oPool = GetBufferPool();
+        std::lock_guard<std::mutex> oLock(oPool.oMutex);
+        void *pBuffer = nullptr;
+        auto oIter = oPool.oMapFreeBuffers.find(nSize);
+        if (oIter != oPool.oMapFreeBuffers.end())
+        {
+            pBuffer = oIter->second.back();
+            oIter->second.pop_back();
+            if (oIter->second.empty())
+                oPool.oMapFreeBuffers.erase(oIter);
+            oPool.nBytes -= static_cast<GIntBig>(nSize);
+            CPLRuntimeMetricAdd(CPLRuntimeMetric::BLOCK_CACHE_BUFFER_POOL_HITS);
+        }
+        // Buffers of other sizes may now exceed the room left by the cache
+        oPool.Trim(std::max<GIntBig>(0, nCacheMax - nCacheUsed));
+        if (pBuffer)
+            return pBuffer;
+    }
+    return VSI_MALLOC_ALIGNED_AUTO_VERBOSE(nSize);
+}
+
+/************************************************************************/
+/*                        GDALRBReleaseBuffer()                         */
+/************************************************************************/
+
+// Must be called once the block has been detached, so that its size is
+// no longer accounted in nCacheUsed.
+static void GDALRBReleaseBuffer(void *pBuffer, size_t nSize)
+{
+    if (pBuffer == nullptr)
+        return;
+    if (bUseBufferPool)
+    {
+        auto &oPool = GetBufferPool();
+        std::lock_guard<std::mutex> oLock(oPool.oMutex);
+        if (nCacheUsed + oPool.nBytes + static_cast<GIntBig>(nSize) <=
+            nCacheMax)
+        {
+            oPool.oMapFreeBuffers[nSize].push_back(pBuffer);
+            oPool.nBytes += static_cast<GIntBig>(nSize);
+            return;
+        }
+    }
+    VSIFreeAligned(pBuffer);
+}
+
+/************************************************************************/
+/*                       GDALRBTrimBufferPool()                         */
+/************************************************************************/
+
+static void GDALRBTrimBufferPool(GIntBig nMaxBytes)
+{
+    auto &oPool = GetBufferPool();
+    std::lock_guard<std::mutex> oLock(oPool.oMutex);
+    oPool.Trim(nMaxBytes);
+}
+
+/************************************************************************/
+/*                     GDALRasterBlockWriteBehind                       */
+/************************************************************************/
+
+// Datasets whose driver allows it (see GDALDataset::
+// EnableWriteBehindFlushing()) have their dirty blocks written by a
+// background thread, once the dirty blocks of the cache exceed half of the
+// cache size, and until they go below a quarter of it. This avoids the
+// writer thread to stall on writing (and compressing) blocks on its own
+// when the cache is full. This can be disabled with
+// GDAL_CACHE_WRITE_BEHIND=NO.
+namespace
+{
+struct GDALRasterBlockWriteBehind
+{
+    std::mutex oMutex{};
+    std::condition_variable oCV{};      // wakes up the thread
+    std::condition_variable oIdleCV{};  // signaled when poBusyDS is reset
+    std::vector<GDALDataset *> apoDatasets{};
+    GDALDataset *poBusyDS = nullptr;
+    bool bStop = false;
+    std::thread oThread{};
+
+    GDALRasterBlockWriteBehind() = default;
+
+    ~GDALRasterBlockWriteBehind()
+    {
+        Stop();
+    }
+
+    void Stop()
+    {
+        {
+            std::lock_guard<std::mutex> oLock(oMutex);
+            bStop = true;
+            oCV.notify_one();
+        }
+        if (oThread.joinable())
+            oThread.join();
+        std::lock_guard<std::mutex> oLock(oMutex);
+        bStop = false;
+    }
+
+    GDALRasterBlockWriteBehind(const GDALRasterBlockWriteBehind &) = delete;
+    GDALRasterBlockWriteBehind &
+    operator=(const GDALRasterBlockWriteBehind &) = delete;
+};
+}  // namespace
+
+static std::atomic<GIntBig> nDirtyBlockBytes{0};
+static std::atomic<int> nWriteBehindDatasets{0};
+static std::atomic<bool> bWriteBehindRequested{false};
+// Set when the dataset being processed by the thread is unregistered.
+static std::atomic<bool> bWriteBehindCancelBusy{false};
+
+static GDALRasterBlockWriteBehind &GetWriteBehind()
+{
+    static GDALRasterBlockWriteBehind oWriteBehind;
+    return oWriteBehind;
+}
+
+static GIntBig GetWriteBehindLowWaterMark()
+{
+    return nCacheMax / 4;
+}
+
+/************************************************************************/
+/*                            GetShardIdx()                             */
+/************************************************************************/
+
+static inline int GetShardIdx(const void *poBand, int nXOff, int nYOff)
+{
+    if (nShards == 1)
+        return 0;
+    uint64_t nHash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(poBand));
+    nHash ^= (static_cast<uint64_t>(static_cast<uint32_t>(nXOff)) << 32) |
+             static_cast<uint32_t>(nYOff);
+    // Finalizer of MurmurHash3
+    nHash ^= nHash >> 33;
+    nHash *= UINT64_C(0xff51afd7ed558ccd);
+    nHash ^= nHash >> 33;
+    nHash *= UINT64_C(0xc4ceb9fe1a85ec53);
+    nHash ^= nHash >> 33;
+    return static_cast<int>(nHash % static_cast<unsigned>(nShards));
+}
+
+static inline GDALRasterBlockCacheShard &GetShard(GDALRasterBlock *poBlock)
+{
+    return asShards[GetShardIdx(poBlock->GetBand(), poBlock->GetXOff(),
+                                poBlock->GetYOff())];
+}
+
+/************************************************************************/
+/*                          GetShardCount()                             */
+/************************************************************************/
+
+static int GetShardCount()
+{
+    const char *pszShards = CPLGetConfigOption("GDAL_CACHEMAX_SHARDS", "1");
+    int nVal;
+    if (EQUAL(pszShards, "ALL_CPUS"))
+        nVal = CPLGetNumCPUs();
+    else
+        nVal = atoi(pszShards);
+    if (nVal < 1 || nVal > MAX_CACHE_SHARDS)
+    {
+        CPLError(CE_Warning, CPLE_IllegalArg,
+                 "Invalid value for GDAL_CACHEMAX_SHARDS: %s. "
+                 "It should be in [1,%d] range. Using 1",
+                 pszShards, MAX_CACHE_SHARDS);
+        nVal = 1;
+    }
+    return nVal;
+}
 
 // #define ENABLE_DEBUG
 
@@ -171,6 +465,8 @@ void CPL_STDCALL GDALSetCacheMax64(GIntBig nNewSizeInBytes)
         if (nCacheUsed == nOldCacheUsed)
             break;
     }
+
+    GDALRBTrimBufferPool(std::max<GIntBig>(0, nCacheMax - nCacheUsed));
 }
 
 /************************************************************************/
@@ -241,11 +537,17 @@ GIntBig CPL_STDCALL GDALGetCacheMax64()
         flagSetupGDALGetCacheMax64,
         []()
         {
+            nShards = GetShardCount();
+            for (int i = 0; i < nShards; ++i)
             {
-                INITIALIZE_LOCK;
+                INITIALIZE_LOCK(asShards[i].hLock);
             }
+            if (nShards > 1)
+                CPLDebug("GDAL", "GDAL_CACHEMAX_SHARDS = %d", nShards);
             bSleepsForBockCacheDebug =
                 CPLTestBool(CPLGetConfigOption("GDAL_DEBUG_BLOCK_CACHE", "NO"));
+            bUseBufferPool = CPLTestBool(
+                CPLGetConfigOption("GDAL_BLOCK_BUFFER_POOL", "YES"));
 
             const char *pszCacheMax = CPLGetConfigOption("GDAL_CACHEMAX", "5%");
 
@@ -324,7 +626,8 @@ GIntBig CPL_STDCALL GDALGetCacheMax64()
 
 int CPL_STDCALL GDALGetCacheUsed()
 {
-    if (nCacheUsed > INT_MAX)
+    const GIntBig nCurCacheUsed = nCacheUsed.load();
+    if (nCurCacheUsed > INT_MAX)
     {
         static bool bHasWarned = false;
         if (!bHasWarned)
@@ -336,7 +639,7 @@ int CPL_STDCALL GDALGetCacheUsed()
         }
         return INT_MAX;
     }
-    return static_cast<int>(nCacheUsed);
+    return static_cast<int>(nCurCacheUsed);
 }
 
 /************************************************************************/
@@ -354,7 +657,115 @@ int CPL_STDCALL GDALGetCacheUsed()
 
 GIntBig CPL_STDCALL GDALGetCacheUsed64()
 {
-    return nCacheUsed;
+    return nCacheUsed.load();
+}
+
+/************************************************************************/
+/*                       GDALGetRuntimeMetrics()                        */
+/************************************************************************/
+
+/**
+ * \brief Get runtime metrics of the block cache, worker thread pools and
+ * dataset pool, as a JSON document.
+ *
+ * Counters are cumulative since the start of the process, so that they can
+ * be exported as is to monitoring systems, which compute rates from them.
+ * Durations are in nanoseconds.
+ *
+ * The document has the following members:
+ * <ul>
+ * <li>"block_cache": "max_bytes", "used_bytes", "shard_count", "hits",
+ * "misses", "evictions", "dirty_block_writes", "dirty_bytes",
+ * "write_behind_writes" (blocks written by the write-behind thread, see the
+ * GDAL_CACHE_WRITE_BEHIND configuration option), "lock_wait_ns" (only
+ * measured when the GDAL_RB_LOCK_WAIT_METRICS configuration option is set to
+ * YES, as indicated by "lock_wait_measured"), and "datasets", an array of
+ * {"description", "used_bytes"} objects for the open datasets having blocks
+ * in the cache.</li>
+ * <li>"thread_pool": "jobs_submitted", "jobs_started", "jobs_completed",
+ * "queued_jobs", "running_jobs", "job_wait_ns" (time between submission
+ * and start of jobs) and "job_run_ns", summed over all CPLWorkerThreadPool
+ * instances.</li>
+ * <li>"dataset_pool": "hits", "misses" and "evictions" of the pool of
+ * datasets used by GDALProxyPoolDataset (VRT sources for example).</li>
+ * </ul>
+ *
+ * @return a JSON string to free with CPLFree().
+ *
+ * @since GDAL 3.10
+ */
+
+char *GDALGetRuntimeMetrics()
+{
+    const auto Get = [](CPLRuntimeMetric eMetric)
+    { return CPLRuntimeMetricGet(eMetric); };
+
+    CPLJSONDocument oDoc;
+    CPLJSONObject oRoot = oDoc.GetRoot();
+
+    CPLJSONObject oBlockCache;
+    oBlockCache.Add("max_bytes", static_cast<GInt64>(GDALGetCacheMax64()));
+    oBlockCache.Add("used_bytes", static_cast<GInt64>(nCacheUsed.load()));
+    oBlockCache.Add("shard_count", nShards);
+    oBlockCache.Add("hits", Get(CPLRuntimeMetric::BLOCK_CACHE_HITS));
+    oBlockCache.Add("misses", Get(CPLRuntimeMetric::BLOCK_CACHE_MISSES));
+    oBlockCache.Add("evictions", Get(CPLRuntimeMetric::BLOCK_CACHE_EVICTIONS));
+    oBlockCache.Add("dirty_block_writes",
+                    Get(CPLRuntimeMetric::BLOCK_CACHE_DIRTY_BLOCK_WRITES));
+    oBlockCache.Add("dirty_bytes", static_cast<GInt64>(nDirtyBlockBytes));
+    oBlockCache.Add("write_behind_writes",
+                    Get(CPLRuntimeMetric::BLOCK_CACHE_WRITE_BEHIND_WRITES));
+    oBlockCache.Add("buffer_pool_hits",
+                    Get(CPLRuntimeMetric::BLOCK_CACHE_BUFFER_POOL_HITS));
+    {
+        auto &oPool = GetBufferPool();
+        std::lock_guard<std::mutex> oLock(oPool.oMutex);
+        oBlockCache.Add("buffer_pool_bytes",
+                        static_cast<GInt64>(oPool.nBytes));
+    }
+    oBlockCache.Add("lock_wait_measured", bMeasureLockWait);
+    oBlockCache.Add("lock_wait_ns",
+                    Get(CPLRuntimeMetric::BLOCK_CACHE_LOCK_WAIT_NS));
+    CPLJSONArray oDatasets;
+    for (const auto &oIter : GDALDataset::GetCacheUsedByOpenDatasets())
+    {
+        CPLJSONObject oDataset;
+        oDataset.Add("description", oIter.first);
+        oDataset.Add("used_bytes", static_cast<GInt64>(oIter.second));
+        oDatasets.Add(oDataset);
+    }
+    oBlockCache.Add("datasets", oDatasets);
+    oRoot.Add("block_cache", oBlockCache);
+
+    // Read the completed counter first, so that the derived gauges cannot
+    // be negative.
+    const uint64_t nCompleted =
+        Get(CPLRuntimeMetric::THREAD_POOL_JOBS_COMPLETED);
+    const uint64_t nStarted = Get(CPLRuntimeMetric::THREAD_POOL_JOBS_STARTED);
+    const uint64_t nSubmitted =
+        Get(CPLRuntimeMetric::THREAD_POOL_JOBS_SUBMITTED);
+    CPLJSONObject oThreadPool;
+    oThreadPool.Add("jobs_submitted", nSubmitted);
+    oThreadPool.Add("jobs_started", nStarted);
+    oThreadPool.Add("jobs_completed", nCompleted);
+    oThreadPool.Add("queued_jobs",
+                    static_cast<uint64_t>(
+                        nSubmitted > nStarted ? nSubmitted - nStarted : 0));
+    oThreadPool.Add("running_jobs", nStarted - nCompleted);
+    oThreadPool.Add("job_wait_ns",
+                    Get(CPLRuntimeMetric::THREAD_POOL_JOB_WAIT_NS));
+    oThreadPool.Add("job_run_ns",
+                    Get(CPLRuntimeMetric::THREAD_POOL_JOB_RUN_NS));
+    oRoot.Add("thread_pool", oThreadPool);
+
+    CPLJSONObject oDatasetPool;
+    oDatasetPool.Add("hits", Get(CPLRuntimeMetric::DATASET_POOL_HITS));
+    oDatasetPool.Add("misses", Get(CPLRuntimeMetric::DATASET_POOL_MISSES));
+    oDatasetPool.Add("evictions",
+                     Get(CPLRuntimeMetric::DATASET_POOL_EVICTIONS));
+    oRoot.Add("dataset_pool", oDatasetPool);
+
+    return CPLStrdup(oDoc.SaveAsString().c_str());
 }
 
 /************************************************************************/
@@ -434,11 +845,23 @@ int CPL_STDCALL GDALFlushCacheBlock()
 int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
 
 {
-    GDALRasterBlock *poTarget;
+    // Make sure the shards are set up.
+    GDALGetCacheMax64();
+
+    GDALRasterBlock *poTarget = nullptr;
 
+    // Start from a different shard at each call, so that repeated calls
+    // spread evictions over all shards.
+    const int iFirstShard =
+        nShards == 1 ? 0
+                     : static_cast<int>(nFlushShardCounter++ %
+                                        static_cast<unsigned>(nShards));
+    for (int iIter = 0; iIter < nShards && poTarget == nullptr; ++iIter)
     {
-        INITIALIZE_LOCK;
-        poTarget = poOldest;
+        GDALRasterBlockCacheShard &oShard =
+            asShards[(iFirstShard + iIter) % nShards];
+        INITIALIZE_LOCK(oShard.hLock);
+        poTarget = oShard.poOldest;
 
         while (poTarget != nullptr)
         {
@@ -452,7 +875,7 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
         }
 
         if (poTarget == nullptr)
-            return FALSE;
+            continue;
         if (bSleepsForBockCacheDebug)
         {
             // coverity[tainted_data]
@@ -464,6 +887,15 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
 
         poTarget->Detach_unlocked();
         poTarget->GetBand()->UnreferenceBlock(poTarget);
+        CPLRuntimeMetricAdd(CPLRuntimeMetric::BLOCK_CACHE_EVICTIONS);
+    }
+
+    if (poTarget == nullptr)
+    {
+        // Nothing left to flush: give the pooled buffers back
+        if (!bDirtyBlocksOnly && nCacheUsed == 0)
+            GDALRBTrimBufferPool(0);
+        return FALSE;
     }
 
     if (bSleepsForBockCacheDebug)
@@ -485,7 +917,8 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
         }
     }
 
-    VSIFreeAligned(poTarget->pData);
+    GDALRBReleaseBuffer(poTarget->pData,
+                        static_cast<size_t>(poTarget->GetBlockSize()));
     poTarget->pData = nullptr;
     poTarget->GetBand()->AddBlockToFreeList(poTarget);
 
@@ -521,6 +954,194 @@ void GDALRasterBlock::FlushDirtyBlocks()
     }
 }
 
+/************************************************************************/
+/*                     FlushDirtyBlocksOfDataset()                      */
+/************************************************************************/
+
+// Writes the least recently used dirty blocks of poDS, until the dirty
+// blocks of the cache go below the low water mark of the write-behind
+// thread. This is only done while holding the read/write mutex of the
+// dataset, which serializes this with the I/O done by the user thread.
+// Returns the number of written blocks.
+int GDALRasterBlock::FlushDirtyBlocksOfDataset(GDALDataset *poDS)
+{
+    if (!poDS->EnterReadWrite(GF_Write))
+    {
+        // Without the mutex, IWriteBlock() could be run concurrently with
+        // any other method of the dataset.
+        return 0;
+    }
+
+    int nWritten = 0;
+    for (int iShard = 0; iShard < nShards; ++iShard)
+    {
+        GDALRasterBlockCacheShard &oShard = asShards[iShard];
+        while (!bWriteBehindCancelBusy &&
+               nDirtyBlockBytes > GetWriteBehindLowWaterMark())
+        {
+            GDALRasterBlock *poTarget = nullptr;
+            {
+                INITIALIZE_LOCK(oShard.hLock);
+                for (poTarget = oShard.poOldest; poTarget != nullptr;
+                     poTarget = poTarget->poPrevious)
+                {
+                    if (poTarget->GetDirty() &&
+                        nDisableDirtyBlockFlushCounter == 0 &&
+                        poTarget->poBand->GetDataset() == poDS &&
+                        CPLAtomicCompareAndExchange(&(poTarget->nLockCount), 0,
+                                                    -1))
+                    {
+                        break;
+                    }
+                }
+                if (poTarget == nullptr)
+                    break;
+
+                poTarget->Detach_unlocked();
+                poTarget->GetBand()->UnreferenceBlock(poTarget);
+                CPLRuntimeMetricAdd(CPLRuntimeMetric::BLOCK_CACHE_EVICTIONS);
+            }
+
+            const CPLErr eErr = poTarget->Write();
+            if (eErr != CE_None)
+            {
+                // Save the error for later reporting.
+                poTarget->GetBand()->SetFlushBlockErr(eErr);
+            }
+            CPLRuntimeMetricAdd(
+                CPLRuntimeMetric::BLOCK_CACHE_WRITE_BEHIND_WRITES);
+            ++nWritten;
+
+            GDALRBReleaseBuffer(poTarget->pData,
+                                static_cast<size_t>(poTarget->GetBlockSize()));
+            poTarget->pData = nullptr;
+            poTarget->GetBand()->AddBlockToFreeList(poTarget);
+        }
+    }
+
+    poDS->LeaveReadWrite();
+    return nWritten;
+}
+
+/************************************************************************/
+/*                       WriteBehindThreadFunc()                        */
+/************************************************************************/
+
+void GDALRasterBlock::WriteBehindThreadFunc()
+{
+    auto &oWriteBehind = GetWriteBehind();
+    std::unique_lock<std::mutex> oLock(oWriteBehind.oMutex);
+    while (true)
+    {
+        oWriteBehind.oCV.wait(oLock, [&oWriteBehind]
+                              { return oWriteBehind.bStop ||
+                                       bWriteBehindRequested; });
+        if (oWriteBehind.bStop)
+            break;
+
+        int nWritten = 0;
+        // Datasets may be unregistered while the lock is dropped, hence the
+        // re-check of the size of the vector at each iteration.
+        for (size_t i = 0; !oWriteBehind.bStop &&
+                           i < oWriteBehind.apoDatasets.size() &&
+                           nDirtyBlockBytes > GetWriteBehindLowWaterMark();
+             ++i)
+        {
+            GDALDataset *poDS = oWriteBehind.apoDatasets[i];
+            oWriteBehind.poBusyDS = poDS;
+            bWriteBehindCancelBusy = false;
+            oLock.unlock();
+
+            nWritten += FlushDirtyBlocksOfDataset(poDS);
+
+            oLock.lock();
+            oWriteBehind.poBusyDS = nullptr;
+            oWriteBehind.oIdleCV.notify_all();
+        }
+
+        if (nWritten == 0)
+        {
+            // The remaining dirty blocks cannot be written by us (they
+            // belong to other datasets, or are locked): avoid being woken up
+            // again at each new dirty block.
+            oWriteBehind.oCV.wait_for(oLock, std::chrono::milliseconds(50),
+                                      [&oWriteBehind]
+                                      { return oWriteBehind.bStop; });
+        }
+        if (nWritten == 0 || nDirtyBlockBytes <= GetWriteBehindLowWaterMark())
+        {
+            bWriteBehindRequested = false;
+        }
+    }
+}
+
+/************************************************************************/
+/*                     RegisterWriteBehindDataset()                     */
+/************************************************************************/
+
+/*! @cond Doxygen_Suppress */
+
+// Called by GDALDataset::RegisterForWriteBehindFlushing()
+void GDALRasterBlock::RegisterWriteBehindDataset(GDALDataset *poDS)
+{
+    static const bool bEnabled =
+        CPLTestBool(CPLGetConfigOption("GDAL_CACHE_WRITE_BEHIND", "YES"));
+    if (!bEnabled)
+        return;
+
+    auto &oWriteBehind = GetWriteBehind();
+    std::lock_guard<std::mutex> oLock(oWriteBehind.oMutex);
+    // Check under the lock, as DisableWriteBehindFlushing() may have been
+    // called concurrently.
+    if (!poDS->IsRegisteredForWriteBehindFlushing() ||
+        std::find(oWriteBehind.apoDatasets.begin(),
+                  oWriteBehind.apoDatasets.end(),
+                  poDS) != oWriteBehind.apoDatasets.end())
+    {
+        return;
+    }
+    oWriteBehind.apoDatasets.push_back(poDS);
+    ++nWriteBehindDatasets;
+    if (!oWriteBehind.oThread.joinable())
+        oWriteBehind.oThread = std::thread(WriteBehindThreadFunc);
+}
+
+/************************************************************************/
+/*                    UnregisterWriteBehindDataset()                    */
+/************************************************************************/
+
+// Called by GDALDataset::DisableWriteBehindFlushing(). When this returns,
+// the write-behind thread no longer accesses poDS.
+void GDALRasterBlock::UnregisterWriteBehindDataset(GDALDataset *poDS)
+{
+    auto &oWriteBehind = GetWriteBehind();
+    std::unique_lock<std::mutex> oLock(oWriteBehind.oMutex);
+    auto oIter = std::find(oWriteBehind.apoDatasets.begin(),
+                           oWriteBehind.apoDatasets.end(), poDS);
+    if (oIter != oWriteBehind.apoDatasets.end())
+    {
+        oWriteBehind.apoDatasets.erase(oIter);
+        --nWriteBehindDatasets;
+    }
+
+    if (oWriteBehind.poBusyDS == poDS &&
+        std::this_thread::get_id() != oWriteBehind.oThread.get_id())
+    {
+        bWriteBehindCancelBusy = true;
+        // The write-behind thread may be waiting for the read/write mutex
+        // of the dataset that the current thread holds.
+        oLock.unlock();
+        poDS->TemporarilyDropReadWriteLock();
+        oLock.lock();
+        oWriteBehind.oIdleCV.wait(oLock, [&oWriteBehind, poDS]
+                                  { return oWriteBehind.poBusyDS != poDS; });
+        oLock.unlock();
+        poDS->ReacquireReadWriteLock();
+    }
+}
+
+/*! @endcond */
+
 /************************************************************************/
 /*                      EnterDisableDirtyBlockFlush()                   */
 /************************************************************************/
@@ -656,10 +1277,10 @@ GDALRasterBlock::~GDALRasterBlock()
 {
     Detach();
 
-    if (pData != nullptr)
-    {
-        VSIFreeAligned(pData);
-    }
+    if (bDirty && poBand)
+        nDirtyBlockBytes -= GetBlockSize();
+
+    GDALRBReleaseBuffer(pData, static_cast<size_t>(GetBlockSize()));
 
     CPLAssert(nLockCount <= 0);
 
@@ -701,19 +1322,20 @@ void GDALRasterBlock::Detach()
 {
     if (bMustDetach)
     {
-        TAKE_LOCK;
+        TAKE_LOCK(GetShard(this).hLock);
         Detach_unlocked();
     }
 }
 
 void GDALRasterBlock::Detach_unlocked()
 {
-    if (poOldest == this)
-        poOldest = poPrevious;
+    GDALRasterBlockCacheShard &oShard = GetShard(this);
+    if (oShard.poOldest == this)
+        oShard.poOldest = poPrevious;
 
-    if (poNewest == this)
+    if (oShard.poNewest == this)
     {
-        poNewest = poNext;
+        oShard.poNewest = poNext;
     }
 
     if (poPrevious != nullptr)
@@ -727,7 +1349,13 @@ void GDALRasterBlock::Detach_unlocked()
     bMustDetach = false;
 
     if (pData)
-        nCacheUsed -= GetEffectiveBlockSize(GetBlockSize());
+    {
+        const auto nEffectiveSize = GetEffectiveBlockSize(GetBlockSize());
+        nCacheUsed -= nEffectiveSize;
+        GDALDataset *poDS = poBand ? poBand->GetDataset() : nullptr;
+        if (poDS)
+            poDS->AddToCacheUsed(-static_cast<GIntBig>(nEffectiveSize));
+    }
 
 #ifdef ENABLE_DEBUG
     Verify();
@@ -747,26 +1375,30 @@ void GDALRasterBlock::Detach_unlocked()
 void GDALRasterBlock::Verify()
 
 {
-    TAKE_LOCK;
-
-    CPLAssert((poNewest == nullptr && poOldest == nullptr) ||
-              (poNewest != nullptr && poOldest != nullptr));
-
-    if (poNewest != nullptr)
+    for (int iShard = 0; iShard < nShards; ++iShard)
     {
-        CPLAssert(poNewest->poPrevious == nullptr);
-        CPLAssert(poOldest->poNext == nullptr);
+        GDALRasterBlockCacheShard &oShard = asShards[iShard];
+        TAKE_LOCK(oShard.hLock);
 
-        GDALRasterBlock *poLast = nullptr;
-        for (GDALRasterBlock *poBlock = poNewest; poBlock != nullptr;
-             poBlock = poBlock->poNext)
+        CPLAssert((oShard.poNewest == nullptr && oShard.poOldest == nullptr) ||
+                  (oShard.poNewest != nullptr && oShard.poOldest != nullptr));
+
+        if (oShard.poNewest != nullptr)
         {
-            CPLAssert(poBlock->poPrevious == poLast);
+            CPLAssert(oShard.poNewest->poPrevious == nullptr);
+            CPLAssert(oShard.poOldest->poNext == nullptr);
 
-            poLast = poBlock;
-        }
+            GDALRasterBlock *poLast = nullptr;
+            for (GDALRasterBlock *poBlock = oShard.poNewest; poBlock != nullptr;
+                 poBlock = poBlock->poNext)
+            {
+                CPLAssert(poBlock->poPrevious == poLast);
+
+                poLast = poBlock;
+            }
 
-        CPLAssert(poOldest == poLast);
+            CPLAssert(oShard.poOldest == poLast);
+        }
     }
 }
 
@@ -779,24 +1411,27 @@ void GDALRasterBlock::Verify()
 #ifdef notdef
 void GDALRasterBlock::CheckNonOrphanedBlocks(GDALRasterBand *poBand)
 {
-    TAKE_LOCK;
-    for (GDALRasterBlock *poBlock = poNewest; poBlock != nullptr;
-         poBlock = poBlock->poNext)
+    for (int iShard = 0; iShard < nShards; ++iShard)
     {
-        if (poBlock->GetBand() == poBand)
+        TAKE_LOCK(asShards[iShard].hLock);
+        for (GDALRasterBlock *poBlock = asShards[iShard].poNewest;
+             poBlock != nullptr; poBlock = poBlock->poNext)
         {
-            printf("Cache has still blocks of band %p\n", poBand); /*ok*/
-            printf("Band : %d\n", poBand->GetBand());              /*ok*/
-            printf("nRasterXSize = %d\n", poBand->GetXSize());     /*ok*/
-            printf("nRasterYSize = %d\n", poBand->GetYSize());     /*ok*/
-            int nBlockXSize, nBlockYSize;
-            poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
-            printf("nBlockXSize = %d\n", nBlockXSize);      /*ok*/
-            printf("nBlockYSize = %d\n", nBlockYSize);      /*ok*/
-            printf("Dataset : %p\n", poBand->GetDataset()); /*ok*/
-            if (poBand->GetDataset())
-                printf("Dataset : %s\n", /*ok*/
-                       poBand->GetDataset()->GetDescription());
+            if (poBlock->GetBand() == poBand)
+            {
+                printf("Cache has still blocks of band %p\n", poBand); /*ok*/
+                printf("Band : %d\n", poBand->GetBand());              /*ok*/
+                printf("nRasterXSize = %d\n", poBand->GetXSize());     /*ok*/
+                printf("nRasterYSize = %d\n", poBand->GetYSize());     /*ok*/
+                int nBlockXSize, nBlockYSize;
+                poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+                printf("nBlockXSize = %d\n", nBlockXSize);      /*ok*/
+                printf("nBlockYSize = %d\n", nBlockYSize);      /*ok*/
+                printf("Dataset : %p\n", poBand->GetDataset()); /*ok*/
+                if (poBand->GetDataset())
+                    printf("Dataset : %s\n", /*ok*/
+                           poBand->GetDataset()->GetDescription());
+            }
         }
     }
 }
@@ -830,7 +1465,12 @@ CPLErr GDALRasterBlock::Write()
     if (poBand->eFlushBlockErr == CE_None)
     {
         int bCallLeaveReadWrite = poBand->EnterReadWrite(GF_Write);
-        CPLErr eErr = poBand->IWriteBlock(nXOff, nYOff, pData);
+        CPLErr eErr;
+        {
+            CPL_TRACE_SCOPE("GDALRasterBand::IWriteBlock");
+            eErr = poBand->IWriteBlock(nXOff, nYOff, pData);
+        }
+        CPLRuntimeMetricAdd(CPLRuntimeMetric::BLOCK_CACHE_DIRTY_BLOCK_WRITES);
         if (bCallLeaveReadWrite)
             poBand->LeaveReadWrite();
         return eErr;
@@ -853,11 +1493,13 @@ CPLErr GDALRasterBlock::Write()
 void GDALRasterBlock::Touch()
 
 {
+    GDALRasterBlockCacheShard &oShard = GetShard(this);
+
     // Can be safely tested outside the lock
-    if (poNewest == this)
+    if (oShard.poNewest == this)
         return;
 
-    TAKE_LOCK;
+    TAKE_LOCK(oShard.hLock);
     Touch_unlocked();
 }
 
@@ -870,15 +1512,16 @@ void GDALRasterBlock::Touch_unlocked()
     // 1. Thread 1 calls Touch() and poNewest != this at that point
     // 2. Thread 2 detaches poNewest
     // 3. Thread 1 arrives here
-    if (poNewest == this)
+    GDALRasterBlockCacheShard &oShard = GetShard(this);
+    if (oShard.poNewest == this)
         return;
 
     // We should not try to touch a block that has been detached.
     // If that happen, corruption has already occurred.
     CPLAssert(bMustDetach);
 
-    if (poOldest == this)
-        poOldest = this->poPrevious;
+    if (oShard.poOldest == this)
+        oShard.poOldest = this->poPrevious;
 
     if (poPrevious != nullptr)
         poPrevious->poNext = poNext;
@@ -887,19 +1530,19 @@ void GDALRasterBlock::Touch_unlocked()
         poNext->poPrevious = poPrevious;
 
     poPrevious = nullptr;
-    poNext = poNewest;
+    poNext = oShard.poNewest;
 
-    if (poNewest != nullptr)
+    if (oShard.poNewest != nullptr)
     {
-        CPLAssert(poNewest->poPrevious == nullptr);
-        poNewest->poPrevious = this;
+        CPLAssert(oShard.poNewest->poPrevious == nullptr);
+        oShard.poNewest->poPrevious = this;
     }
-    poNewest = this;
+    oShard.poNewest = this;
 
-    if (poOldest == nullptr)
+    if (oShard.poOldest == nullptr)
     {
         CPLAssert(poPrevious == nullptr && poNext == nullptr);
-        poOldest = this;
+        oShard.poOldest = this;
     }
 #ifdef ENABLE_DEBUG
     Verify();
@@ -928,7 +1571,7 @@ CPLErr GDALRasterBlock::Internalize()
 
     void *pNewData = nullptr;
 
-    // This call will initialize the hRBLock mutex. Other call places can
+    // This call will initialize the block cache shards. Other call places can
     // only be called if we have go through there.
     const GIntBig nCurCacheMax = GDALGetCacheMax64();
 
@@ -941,18 +1584,93 @@ CPLErr GDALRasterBlock::Internalize()
     bool bFirstIter = true;
     bool bLoopAgain = false;
     GDALDataset *poThisDS = poBand->GetDataset();
+    const int iThisShard = GetShardIdx(poBand, nXOff, nYOff);
     do
     {
         bLoopAgain = false;
         GDALRasterBlock *apoBlocksToFree[64] = {nullptr};
         int nBlocksToFree = 0;
+        bool bStopEviction = false;
+
+        // Detach a block that has been locked for eviction, while the lock
+        // of its shard is held.
+        const auto EvictTarget = [&](GDALRasterBlock *poTarget)
         {
-            TAKE_LOCK;
+            if (bSleepsForBockCacheDebug)
+            {
+                // coverity[tainted_data]
+                const double dfDelay = CPLAtof(CPLGetConfigOption(
+                    "GDAL_RB_INTERNALIZE_SLEEP_AFTER_DROP_LOCK", "0"));
+                if (dfDelay > 0)
+                    CPLSleep(dfDelay);
+            }
+
+            poTarget->Detach_unlocked();
+            poTarget->GetBand()->UnreferenceBlock(poTarget);
+            CPLRuntimeMetricAdd(CPLRuntimeMetric::BLOCK_CACHE_EVICTIONS);
 
-            if (bFirstIter)
-                nCacheUsed += GetEffectiveBlockSize(nSizeInBytes);
-            GDALRasterBlock *poTarget = poOldest;
-            while (nCacheUsed > nCurCacheMax)
+            apoBlocksToFree[nBlocksToFree++] = poTarget;
+            if (poTarget->GetDirty())
+            {
+                // Only free one dirty block at a time so that
+                // other dirty blocks of other bands with the same
+                // coordinates can be found with TryGetLockedBlock()
+                bLoopAgain = nCacheUsed > nCurCacheMax;
+                bStopEviction = true;
+            }
+            else if (nBlocksToFree == 64)
+            {
+                bLoopAgain = (nCacheUsed > nCurCacheMax);
+                bStopEviction = true;
+            }
+        };
+
+        if (bFirstIter)
+        {
+            const auto nEffectiveSize = GetEffectiveBlockSize(nSizeInBytes);
+            nCacheUsed += nEffectiveSize;
+            if (poThisDS)
+                poThisDS->AddToCacheUsed(nEffectiveSize);
+        }
+
+        // Evict blocks from the other shards first (if any), and finish with
+        // the shard of this block, whose lock is needed to add it to the list.
+        for (int iIter = 1; iIter <= nShards; ++iIter)
+        {
+            const int iShard = (iThisShard + iIter) % nShards;
+            if (iShard != iThisShard &&
+                (bStopEviction || nCacheUsed <= nCurCacheMax))
+            {
+                continue;
+            }
+            GDALRasterBlockCacheShard &oShard = asShards[iShard];
+            TAKE_LOCK(oShard.hLock);
+
+            // First evict blocks of datasets exceeding their cache budget,
+            // if there are any.
+            if (GDALDataset::IsAnyCacheBudgetSet())
+            {
+                GDALRasterBlock *poTarget = oShard.poOldest;
+                while (!bStopEviction && poTarget != nullptr &&
+                       nCacheUsed > nCurCacheMax)
+                {
+                    GDALRasterBlock *_poPrevious = poTarget->poPrevious;
+                    GDALDataset *poTargetDS = poTarget->poBand->GetDataset();
+                    if (poTargetDS && poTargetDS->IsOverCacheBudget() &&
+                        (!poTarget->GetDirty() ||
+                         (nDisableDirtyBlockFlushCounter == 0 &&
+                          poTargetDS == poThisDS)) &&
+                        CPLAtomicCompareAndExchange(&(poTarget->nLockCount), 0,
+                                                    -1))
+                    {
+                        EvictTarget(poTarget);
+                    }
+                    poTarget = _poPrevious;
+                }
+            }
+
+            GDALRasterBlock *poTarget = oShard.poOldest;
+            while (!bStopEviction && nCacheUsed > nCurCacheMax)
             {
                 GDALRasterBlock *poDirtyBlockOtherDataset = nullptr;
                 // In this first pass, only discard dirty blocks of this
@@ -998,7 +1716,7 @@ CPLErr GDALRasterBlock::Internalize()
                     }
                     else
                     {
-                        poTarget = poOldest;
+                        poTarget = oShard.poOldest;
                         while (poTarget != nullptr)
                         {
                             if (CPLAtomicCompareAndExchange(
@@ -1016,35 +1734,8 @@ CPLErr GDALRasterBlock::Internalize()
 
                 if (poTarget != nullptr)
                 {
-                    if (bSleepsForBockCacheDebug)
-                    {
-                        // coverity[tainted_data]
-                        const double dfDelay = CPLAtof(CPLGetConfigOption(
-                            "GDAL_RB_INTERNALIZE_SLEEP_AFTER_DROP_LOCK", "0"));
-                        if (dfDelay > 0)
-                            CPLSleep(dfDelay);
-                    }
-
                     GDALRasterBlock *_poPrevious = poTarget->poPrevious;
-
-                    poTarget->Detach_unlocked();
-                    poTarget->GetBand()->UnreferenceBlock(poTarget);
-
-                    apoBlocksToFree[nBlocksToFree++] = poTarget;
-                    if (poTarget->GetDirty())
-                    {
-                        // Only free one dirty block at a time so that
-                        // other dirty blocks of other bands with the same
-                        // coordinates can be found with TryGetLockedBlock()
-                        bLoopAgain = nCacheUsed > nCurCacheMax;
-                        break;
-                    }
-                    if (nBlocksToFree == 64)
-                    {
-                        bLoopAgain = (nCacheUsed > nCurCacheMax);
-                        break;
-                    }
-
+                    EvictTarget(poTarget);
                     poTarget = _poPrevious;
                 }
                 else
@@ -1058,7 +1749,7 @@ CPLErr GDALRasterBlock::Internalize()
             /*      Add this block to the list. */
             /* ------------------------------------------------------------------
              */
-            if (!bLoopAgain)
+            if (iShard == iThisShard && !bLoopAgain)
                 Touch_unlocked();
         }
 
@@ -1098,7 +1789,8 @@ CPLErr GDALRasterBlock::Internalize()
             }
             else
             {
-                VSIFreeAligned(poBlock->pData);
+                GDALRBReleaseBuffer(
+                    pDataBlock, static_cast<size_t>(poBlock->GetBlockSize()));
             }
             poBlock->pData = nullptr;
 
@@ -1108,7 +1800,7 @@ CPLErr GDALRasterBlock::Internalize()
 
     if (pNewData == nullptr)
     {
-        pNewData = VSI_MALLOC_ALIGNED_AUTO_VERBOSE(nSizeInBytes);
+        pNewData = GDALRBAcquireBuffer(static_cast<size_t>(nSizeInBytes));
         if (pNewData == nullptr)
         {
             return (CE_Failure);
@@ -1137,7 +1829,22 @@ void GDALRasterBlock::MarkDirty()
     {
         poBand->InitRWLock();
         if (!bDirty)
+        {
             poBand->IncDirtyBlocks(1);
+            const GIntBig nDirty = nDirtyBlockBytes += GetBlockSize();
+            GDALDataset *poDS = poBand->GetDataset();
+            if (poDS)
+                poDS->RegisterForWriteBehindFlushing();
+            if (nWriteBehindDatasets > 0 && nDirty > nCacheMax / 2 &&
+                !bWriteBehindRequested.exchange(true))
+            {
+                auto &oWriteBehind = GetWriteBehind();
+                std::lock_guard<std::mutex> oLock(oWriteBehind.oMutex);
+                oWriteBehind.oCV.notify_one();
+            }
+        }
+        poBand->InvalidateBlockStatistics(nXOff * nXSize, nYOff * nYSize, 1,
+                                          1);
     }
     bDirty = true;
 }
@@ -1156,7 +1863,10 @@ void GDALRasterBlock::MarkDirty()
 void GDALRasterBlock::MarkClean()
 {
     if (bDirty && poBand)
+    {
         poBand->IncDirtyBlocks(-1);
+        nDirtyBlockBytes -= GetBlockSize();
+    }
     bDirty = false;
 }
 
@@ -1167,9 +1877,14 @@ void GDALRasterBlock::MarkClean()
 /*! @cond Doxygen_Suppress */
 void GDALRasterBlock::DestroyRBMutex()
 {
-    if (hRBLock != nullptr)
-        DESTROY_LOCK;
-    hRBLock = nullptr;
+    GetWriteBehind().Stop();
+    GDALRBTrimBufferPool(0);
+    for (auto &oShard : asShards)
+    {
+        if (oShard.hLock != nullptr)
+            DESTROY_LOCK(oShard.hLock);
+        oShard.hLock = nullptr;
+    }
 }
 
 /*! @endcond */
@@ -1248,7 +1963,7 @@ int GDALRasterBlock::DropLockForRemovalFromStorage()
 #endif
 
     // Wait for the block for having been unreferenced.
-    TAKE_LOCK;
+    TAKE_LOCK(GetShard(this).hLock);
 
     return FALSE;
 }
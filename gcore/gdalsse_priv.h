@@ -209,6 +209,14 @@ class XMMReg2Double
         return reg;
     }
 
+    static inline XMMReg2Double Max(const XMMReg2Double &expr1,
+                                    const XMMReg2Double &expr2)
+    {
+        XMMReg2Double reg;
+        reg.xmm = _mm_max_pd(expr1.xmm, expr2.xmm);
+        return reg;
+    }
+
     inline void nsLoad1ValHighAndLow(const double *ptr)
     {
         xmm = _mm_load1_pd(ptr);
@@ -559,6 +567,15 @@ class XMMReg2Double
         return reg;
     }
 
+    static inline XMMReg2Double Max(const XMMReg2Double &expr1,
+                                    const XMMReg2Double &expr2)
+    {
+        XMMReg2Double reg;
+        reg.low = (expr1.low > expr2.low) ? expr1.low : expr2.low;
+        reg.high = (expr1.high > expr2.high) ? expr1.high : expr2.high;
+        return reg;
+    }
+
     static inline XMMReg2Double Load2Val(const double *ptr)
     {
         XMMReg2Double reg;
@@ -959,6 +976,14 @@ class XMMReg4Double
         return reg;
     }
 
+    static inline XMMReg4Double Max(const XMMReg4Double &expr1,
+                                    const XMMReg4Double &expr2)
+    {
+        XMMReg4Double reg;
+        reg.ymm = _mm256_max_pd(expr1.ymm, expr2.ymm);
+        return reg;
+    }
+
     inline XMMReg4Double &operator=(const XMMReg4Double &other)
     {
         ymm = other.ymm;
@@ -1198,6 +1223,15 @@ class XMMReg4Double
         return reg;
     }
 
+    static inline XMMReg4Double Max(const XMMReg4Double &expr1,
+                                    const XMMReg4Double &expr2)
+    {
+        XMMReg4Double reg;
+        reg.low = XMMReg2Double::Max(expr1.low, expr2.low);
+        reg.high = XMMReg2Double::Max(expr1.high, expr2.high);
+        return reg;
+    }
+
     inline XMMReg4Double &operator=(const XMMReg4Double &other)
     {
         low = other.low;
@@ -0,0 +1,597 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  Dataset that can be used concurrently by several threads for
+ *           read-only raster access (GDAL_OF_THREAD_SAFE)
+ * Author:   agent, <agent at local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent at local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "gdal_proxy.h"
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "cpl_error.h"
+#include "cpl_multiproc.h"
+#include "cpl_string.h"
+#include "gdal_priv.h"
+
+//! @cond Doxygen_Suppress
+
+/* A GDALThreadSafeDataset is a proxy dataset that owns one "real" dataset
+ * per thread using it, all opened with the same parameters. Each call is
+ * forwarded to the dataset of the calling thread, so that concurrent calls
+ * never operate on the same driver objects. Bands, overview bands and mask
+ * bands are wrapped the same way, so that pointers to them can be shared
+ * between threads.
+ *
+ * The dataset of the thread that opened the GDALThreadSafeDataset is reused,
+ * and the datasets of other threads are opened the first time they use it,
+ * and kept until the GDALThreadSafeDataset is closed.
+ */
+
+namespace
+{
+
+class GDALThreadSafeRasterBand;
+
+/************************************************************************/
+/*                        GDALThreadSafeDataset                         */
+/************************************************************************/
+
+class GDALThreadSafeDataset final : public GDALProxyDataset
+{
+  public:
+    GDALThreadSafeDataset(std::unique_ptr<GDALDataset> poPrototypeDS,
+                          const char *pszFilename, unsigned int nOpenFlagsIn,
+                          CSLConstList papszOpenOptionsIn);
+    ~GDALThreadSafeDataset() override;
+
+    GDALDataset *GetThreadDataset() const;
+
+    CPLErr SetMetadata(char **, const char *) override;
+    CPLErr SetMetadataItem(const char *, const char *, const char *) override;
+    CPLErr SetSpatialRef(const OGRSpatialReference *) override;
+    CPLErr SetGeoTransform(double *) override;
+    CPLErr SetGCPs(int, const GDAL_GCP *, const OGRSpatialReference *) override;
+    CPLErr CreateMaskBand(int) override;
+
+    bool IsThreadSafe(int nScopeFlags) const override
+    {
+        return nScopeFlags == GDAL_OF_RASTER;
+    }
+
+  protected:
+    GDALDataset *RefUnderlyingDataset() const override;
+
+    void UnrefUnderlyingDataset(GDALDataset *) const override
+    {
+        // Thread datasets are kept until we are closed
+    }
+
+    CPLErr IBuildOverviews(const char *, int, const int *, int, const int *,
+                           GDALProgressFunc, void *,
+                           CSLConstList papszOptions) override;
+    CPLErr IRasterIO(GDALRWFlag, int, int, int, int, void *, int, int,
+                     GDALDataType, int, BANDMAP_TYPE, GSpacing, GSpacing,
+                     GSpacing, GDALRasterIOExtraArg *psExtraArg) override;
+
+  private:
+    friend class GDALThreadSafeRasterBand;
+
+    // Unique identifier of this dataset, never reused, for the per-thread
+    // cache of GetThreadDataset().
+    const uint64_t m_nId;
+    const std::string m_osFilename;
+    const unsigned int m_nOpenFlags;
+    const CPLStringList m_aosOpenOptions;
+    const std::string m_osDriverName;
+
+    mutable std::mutex m_oMutex{};
+    mutable std::map<GIntBig, std::unique_ptr<GDALDataset>>
+        m_oMapThreadToDataset{};
+    std::atomic<bool> m_bClosing{false};
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALThreadSafeDataset)
+};
+
+/************************************************************************/
+/*                       GDALThreadSafeRasterBand                       */
+/************************************************************************/
+
+class GDALThreadSafeRasterBand final : public GDALProxyRasterBand
+{
+  public:
+    GDALThreadSafeRasterBand(GDALThreadSafeDataset *poTSDS,
+                             GDALDataset *poParentDS, int nBandIn,
+                             GDALThreadSafeRasterBand *poParentBand,
+                             int nOvrIdx, GDALRasterBand *poPrototypeBand);
+
+    GDALRasterBand *GetOverview(int nIdx) override;
+    GDALRasterBand *GetRasterSampleOverview(GUIntBig nDesiredSamples) override;
+    GDALRasterBand *GetMaskBand() override;
+
+    CPLErr SetMetadata(char **, const char *) override;
+    CPLErr SetMetadataItem(const char *, const char *, const char *) override;
+    CPLErr Fill(double, double) override;
+    CPLErr SetCategoryNames(char **) override;
+    CPLErr SetNoDataValue(double) override;
+    CPLErr DeleteNoDataValue() override;
+    CPLErr SetColorTable(GDALColorTable *) override;
+    CPLErr SetColorInterpretation(GDALColorInterp) override;
+    CPLErr SetOffset(double) override;
+    CPLErr SetScale(double) override;
+    CPLErr SetUnitType(const char *) override;
+    CPLErr SetStatistics(double, double, double, double) override;
+    CPLErr SetDefaultHistogram(double, double, int, GUIntBig *) override;
+    CPLErr SetDefaultRAT(const GDALRasterAttributeTable *) override;
+    CPLErr BuildOverviews(const char *, int, const int *, GDALProgressFunc,
+                          void *, CSLConstList papszOptions) override;
+    CPLErr CreateMaskBand(int) override;
+
+  protected:
+    GDALRasterBand *
+    RefUnderlyingRasterBand(bool bForceOpen = true) const override;
+
+    void UnrefUnderlyingRasterBand(GDALRasterBand *) const override
+    {
+    }
+
+    CPLErr IWriteBlock(int, int, void *) override;
+    CPLErr IRasterIO(GDALRWFlag, int, int, int, int, void *, int, int,
+                     GDALDataType, GSpacing, GSpacing,
+                     GDALRasterIOExtraArg *psExtraArg) override;
+
+  private:
+    GDALThreadSafeDataset *const m_poTSDS;
+    // Band of which we are an overview or the mask band, or nullptr
+    GDALThreadSafeRasterBand *const m_poParentBand;
+    // Overview index in m_poParentBand, or -1 for its mask band
+    const int m_nOvrIdx;
+
+    std::vector<std::unique_ptr<GDALThreadSafeRasterBand>> m_apoOverviews{};
+    std::unique_ptr<GDALThreadSafeRasterBand> m_poMaskBand{};
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALThreadSafeRasterBand)
+};
+
+/************************************************************************/
+/*                          ReportReadOnly()                            */
+/************************************************************************/
+
+static CPLErr ReportReadOnly(const char *pszFunc)
+{
+    CPLError(CE_Failure, CPLE_NotSupported,
+             "%s() not supported on a dataset opened with GDAL_OF_THREAD_SAFE",
+             pszFunc);
+    return CE_Failure;
+}
+
+static std::atomic<uint64_t> gnNextThreadSafeDatasetId{1};
+
+/************************************************************************/
+/*                       GDALThreadSafeDataset()                        */
+/************************************************************************/
+
+GDALThreadSafeDataset::GDALThreadSafeDataset(
+    std::unique_ptr<GDALDataset> poPrototypeDS, const char *pszFilename,
+    unsigned int nOpenFlagsIn, CSLConstList papszOpenOptionsIn)
+    : m_nId(gnNextThreadSafeDatasetId++), m_osFilename(pszFilename),
+      m_nOpenFlags(nOpenFlagsIn), m_aosOpenOptions(papszOpenOptionsIn),
+      m_osDriverName(poPrototypeDS->GetDriver()
+                         ? poPrototypeDS->GetDriver()->GetDescription()
+                         : "")
+{
+    SetDescription(poPrototypeDS->GetDescription());
+    eAccess = GA_ReadOnly;
+    nRasterXSize = poPrototypeDS->GetRasterXSize();
+    nRasterYSize = poPrototypeDS->GetRasterYSize();
+    poDriver = poPrototypeDS->GetDriver();
+    for (int i = 1; i <= poPrototypeDS->GetRasterCount(); ++i)
+    {
+        SetBand(i, std::make_unique<GDALThreadSafeRasterBand>(
+                       this, this, i, nullptr, -1,
+                       poPrototypeDS->GetRasterBand(i)));
+    }
+    m_oMapThreadToDataset[CPLGetPID()] = std::move(poPrototypeDS);
+}
+
+/************************************************************************/
+/*                      ~GDALThreadSafeDataset()                        */
+/************************************************************************/
+
+GDALThreadSafeDataset::~GDALThreadSafeDataset()
+{
+    std::map<GIntBig, std::unique_ptr<GDALDataset>> oMap;
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        m_bClosing = true;
+        std::swap(oMap, m_oMapThreadToDataset);
+    }
+    // Thread datasets are closed here, before the base destructor flushes
+    // our bands, which are then no longer connected to anything.
+}
+
+/************************************************************************/
+/*                         GetThreadDataset()                           */
+/************************************************************************/
+
+GDALDataset *GDALThreadSafeDataset::GetThreadDataset() const
+{
+    // Cache of the last dataset used by the current thread, to avoid
+    // taking the mutex in the common case.
+    struct LastUsed
+    {
+        uint64_t nId;
+        GDALDataset *poDS;
+    };
+
+    static thread_local LastUsed tlsLastUsed{0, nullptr};
+    if (m_bClosing)
+        return nullptr;
+    if (tlsLastUsed.nId == m_nId)
+        return tlsLastUsed.poDS;
+
+    const GIntBig nThreadId = CPLGetPID();
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        const auto oIter = m_oMapThreadToDataset.find(nThreadId);
+        if (oIter != m_oMapThreadToDataset.end())
+        {
+            tlsLastUsed = {m_nId, oIter->second.get()};
+            return oIter->second.get();
+        }
+    }
+
+    // Open outside of the mutex, not to block other threads
+    const CPLStringList aosAllowedDrivers(
+        m_osDriverName.empty() ? nullptr
+                               : CSLAddString(nullptr, m_osDriverName.c_str()));
+    std::unique_ptr<GDALDataset> poDS(GDALDataset::Open(
+        m_osFilename.c_str(), m_nOpenFlags | GDAL_OF_INTERNAL,
+        aosAllowedDrivers.List(), m_aosOpenOptions.List(), nullptr));
+    if (!poDS)
+        return nullptr;
+    if (poDS->GetRasterXSize() != nRasterXSize ||
+        poDS->GetRasterYSize() != nRasterYSize ||
+        poDS->GetRasterCount() != nBands)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "%s: dataset opened by thread " CPL_FRMT_GIB
+                 " has not the same characteristics as the one opened "
+                 "initially",
+                 m_osFilename.c_str(), nThreadId);
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    if (m_bClosing)
+        return nullptr;
+    GDALDataset *poRet = poDS.get();
+    m_oMapThreadToDataset[nThreadId] = std::move(poDS);
+    tlsLastUsed = {m_nId, poRet};
+    return poRet;
+}
+
+/************************************************************************/
+/*                        RefUnderlyingDataset()                        */
+/************************************************************************/
+
+GDALDataset *GDALThreadSafeDataset::RefUnderlyingDataset() const
+{
+    return GetThreadDataset();
+}
+
+/************************************************************************/
+/*                      Write operations (rejected)                     */
+/************************************************************************/
+
+CPLErr GDALThreadSafeDataset::SetMetadata(char **, const char *)
+{
+    return ReportReadOnly("SetMetadata");
+}
+
+CPLErr GDALThreadSafeDataset::SetMetadataItem(const char *, const char *,
+                                              const char *)
+{
+    return ReportReadOnly("SetMetadataItem");
+}
+
+CPLErr GDALThreadSafeDataset::SetSpatialRef(const OGRSpatialReference *)
+{
+    return ReportReadOnly("SetSpatialRef");
+}
+
+CPLErr GDALThreadSafeDataset::SetGeoTransform(double *)
+{
+    return ReportReadOnly("SetGeoTransform");
+}
+
+CPLErr GDALThreadSafeDataset::SetGCPs(int, const GDAL_GCP *,
+                                      const OGRSpatialReference *)
+{
+    return ReportReadOnly("SetGCPs");
+}
+
+CPLErr GDALThreadSafeDataset::CreateMaskBand(int)
+{
+    return ReportReadOnly("CreateMaskBand");
+}
+
+CPLErr GDALThreadSafeDataset::IBuildOverviews(const char *, int, const int *,
+                                              int, const int *,
+                                              GDALProgressFunc, void *,
+                                              CSLConstList)
+{
+    return ReportReadOnly("BuildOverviews");
+}
+
+CPLErr GDALThreadSafeDataset::IRasterIO(
+    GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
+    void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
+    int nBandCount, BANDMAP_TYPE panBandMap, GSpacing nPixelSpace,
+    GSpacing nLineSpace, GSpacing nBandSpace, GDALRasterIOExtraArg *psExtraArg)
+{
+    if (eRWFlag == GF_Write)
+        return ReportReadOnly("RasterIO(GF_Write)");
+    return GDALProxyDataset::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                                       pData, nBufXSize, nBufYSize, eBufType,
+                                       nBandCount, panBandMap, nPixelSpace,
+                                       nLineSpace, nBandSpace, psExtraArg);
+}
+
+/************************************************************************/
+/*                     GDALThreadSafeRasterBand()                       */
+/************************************************************************/
+
+GDALThreadSafeRasterBand::GDALThreadSafeRasterBand(
+    GDALThreadSafeDataset *poTSDS, GDALDataset *poParentDS, int nBandIn,
+    GDALThreadSafeRasterBand *poParentBand, int nOvrIdx,
+    GDALRasterBand *poPrototypeBand)
+    : m_poTSDS(poTSDS), m_poParentBand(poParentBand), m_nOvrIdx(nOvrIdx)
+{
+    poDS = poParentDS;
+    nBand = nBandIn;
+    eAccess = GA_ReadOnly;
+    nRasterXSize = poPrototypeBand->GetXSize();
+    nRasterYSize = poPrototypeBand->GetYSize();
+    eDataType = poPrototypeBand->GetRasterDataType();
+    poPrototypeBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+}
+
+/************************************************************************/
+/*                      RefUnderlyingRasterBand()                       */
+/************************************************************************/
+
+GDALRasterBand *GDALThreadSafeRasterBand::RefUnderlyingRasterBand(bool) const
+{
+    if (m_poParentBand)
+    {
+        GDALRasterBand *poParent = m_poParentBand->RefUnderlyingRasterBand();
+        if (!poParent)
+            return nullptr;
+        return m_nOvrIdx >= 0 ? poParent->GetOverview(m_nOvrIdx)
+                              : poParent->GetMaskBand();
+    }
+    GDALDataset *poThreadDS = m_poTSDS->GetThreadDataset();
+    return poThreadDS ? poThreadDS->GetRasterBand(nBand) : nullptr;
+}
+
+/************************************************************************/
+/*                            GetOverview()                             */
+/************************************************************************/
+
+GDALRasterBand *GDALThreadSafeRasterBand::GetOverview(int nIdx)
+{
+    GDALRasterBand *poSrcBand = RefUnderlyingRasterBand();
+    if (!poSrcBand || nIdx < 0)
+        return nullptr;
+    GDALRasterBand *poSrcOvrBand = poSrcBand->GetOverview(nIdx);
+    if (!poSrcOvrBand)
+        return nullptr;
+
+    std::lock_guard<std::mutex> oLock(m_poTSDS->m_oMutex);
+    if (static_cast<size_t>(nIdx) >= m_apoOverviews.size())
+        m_apoOverviews.resize(nIdx + 1);
+    if (!m_apoOverviews[nIdx])
+    {
+        m_apoOverviews[nIdx] = std::make_unique<GDALThreadSafeRasterBand>(
+            m_poTSDS, nullptr, 0, this, nIdx, poSrcOvrBand);
+    }
+    return m_apoOverviews[nIdx].get();
+}
+
+/************************************************************************/
+/*                      GetRasterSampleOverview()                       */
+/************************************************************************/
+
+GDALRasterBand *
+GDALThreadSafeRasterBand::GetRasterSampleOverview(GUIntBig nDesiredSamples)
+{
+    // Go through our GetOverview()
+    return GDALRasterBand::GetRasterSampleOverview(nDesiredSamples);
+}
+
+/************************************************************************/
+/*                            GetMaskBand()                             */
+/************************************************************************/
+
+GDALRasterBand *GDALThreadSafeRasterBand::GetMaskBand()
+{
+    GDALRasterBand *poSrcBand = RefUnderlyingRasterBand();
+    if (!poSrcBand)
+        return nullptr;
+    GDALRasterBand *poSrcMaskBand = poSrcBand->GetMaskBand();
+    if (!poSrcMaskBand)
+        return nullptr;
+
+    std::lock_guard<std::mutex> oLock(m_poTSDS->m_oMutex);
+    if (!m_poMaskBand)
+    {
+        m_poMaskBand = std::make_unique<GDALThreadSafeRasterBand>(
+            m_poTSDS, poDS, 0, this, -1, poSrcMaskBand);
+    }
+    return m_poMaskBand.get();
+}
+
+/************************************************************************/
+/*                      Write operations (rejected)                     */
+/************************************************************************/
+
+CPLErr GDALThreadSafeRasterBand::SetMetadata(char **, const char *)
+{
+    return ReportReadOnly("SetMetadata");
+}
+
+CPLErr GDALThreadSafeRasterBand::SetMetadataItem(const char *, const char *,
+                                                 const char *)
+{
+    return ReportReadOnly("SetMetadataItem");
+}
+
+CPLErr GDALThreadSafeRasterBand::Fill(double, double)
+{
+    return ReportReadOnly("Fill");
+}
+
+CPLErr GDALThreadSafeRasterBand::SetCategoryNames(char **)
+{
+    return ReportReadOnly("SetCategoryNames");
+}
+
+CPLErr GDALThreadSafeRasterBand::SetNoDataValue(double)
+{
+    return ReportReadOnly("SetNoDataValue");
+}
+
+CPLErr GDALThreadSafeRasterBand::DeleteNoDataValue()
+{
+    return ReportReadOnly("DeleteNoDataValue");
+}
+
+CPLErr GDALThreadSafeRasterBand::SetColorTable(GDALColorTable *)
+{
+    return ReportReadOnly("SetColorTable");
+}
+
+CPLErr GDALThreadSafeRasterBand::SetColorInterpretation(GDALColorInterp)
+{
+    return ReportReadOnly("SetColorInterpretation");
+}
+
+CPLErr GDALThreadSafeRasterBand::SetOffset(double)
+{
+    return ReportReadOnly("SetOffset");
+}
+
+CPLErr GDALThreadSafeRasterBand::SetScale(double)
+{
+    return ReportReadOnly("SetScale");
+}
+
+CPLErr GDALThreadSafeRasterBand::SetUnitType(const char *)
+{
+    return ReportReadOnly("SetUnitType");
+}
+
+CPLErr GDALThreadSafeRasterBand::SetStatistics(double, double, double, double)
+{
+    return ReportReadOnly("SetStatistics");
+}
+
+CPLErr GDALThreadSafeRasterBand::SetDefaultHistogram(double, double, int,
+                                                     GUIntBig *)
+{
+    return ReportReadOnly("SetDefaultHistogram");
+}
+
+CPLErr GDALThreadSafeRasterBand::SetDefaultRAT(const GDALRasterAttributeTable *)
+{
+    return ReportReadOnly("SetDefaultRAT");
+}
+
+CPLErr GDALThreadSafeRasterBand::BuildOverviews(const char *, int, const int *,
+                                                GDALProgressFunc, void *,
+                                                CSLConstList)
+{
+    return ReportReadOnly("BuildOverviews");
+}
+
+CPLErr GDALThreadSafeRasterBand::CreateMaskBand(int)
+{
+    return ReportReadOnly("CreateMaskBand");
+}
+
+CPLErr GDALThreadSafeRasterBand::IWriteBlock(int, int, void *)
+{
+    return ReportReadOnly("WriteBlock");
+}
+
+CPLErr GDALThreadSafeRasterBand::IRasterIO(
+    GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
+    void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
+    GSpacing nPixelSpace, GSpacing nLineSpace, GDALRasterIOExtraArg *psExtraArg)
+{
+    if (eRWFlag == GF_Write)
+        return ReportReadOnly("RasterIO(GF_Write)");
+    return GDALProxyRasterBand::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                                          pData, nBufXSize, nBufYSize, eBufType,
+                                          nPixelSpace, nLineSpace, psExtraArg);
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                     GDALCreateThreadSafeDataset()                    */
+/************************************************************************/
+
+/** Wraps poPrototypeDS, opened from pszFilename with nOpenFlags and
+ * papszOpenOptions, into a dataset that can be used concurrently by several
+ * threads for read-only raster access.
+ *
+ * nOpenFlags must not contain GDAL_OF_THREAD_SAFE, and is used to open the
+ * datasets of the other threads.
+ */
+std::unique_ptr<GDALDataset>
+GDALCreateThreadSafeDataset(std::unique_ptr<GDALDataset> poPrototypeDS,
+                            const char *pszFilename, unsigned int nOpenFlags,
+                            CSLConstList papszOpenOptions)
+{
+    if (poPrototypeDS->GetRasterCount() == 0)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "GDAL_OF_THREAD_SAFE only supported on raster datasets with "
+                 "at least one band");
+        return nullptr;
+    }
+    return std::make_unique<GDALThreadSafeDataset>(
+        std::move(poPrototypeDS), pszFilename, nOpenFlags, papszOpenOptions);
+}
+
+//! @endcond
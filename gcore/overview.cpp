@@ -1103,8 +1103,108 @@ static int AverageFloatSSE2(int nDstXWidth, int nChunkXSize,
     return iDstPixel;
 }
 
+/************************************************************************/
+/*                  AverageOrQuadraticMeanDoubleSSE2()                  */
+/************************************************************************/
+
+template <bool bQuadraticMean>
+static int AverageOrQuadraticMeanDoubleSSE2(
+    int nDstXWidth, int nChunkXSize,
+    const double *&CPL_RESTRICT pSrcScanlineShiftedInOut,
+    double *CPL_RESTRICT pDstScanline)
+{
+    // Optimized implementation for average and RMS on Float64 by
+    // processing by group of 2 output pixels.
+    // The additions are done in the same order as in the generic code
+    // (top left, top right, bottom left, bottom right) so that results are
+    // bit-identical.
+    const double *CPL_RESTRICT pSrcScanlineShifted = pSrcScanlineShiftedInOut;
+
+    int iDstPixel = 0;
+    const auto zeroDot25 = _mm_set1_pd(0.25);
+
+    for (; iDstPixel < nDstXWidth - 1; iDstPixel += 2)
+    {
+        // Load 4 Float64 from each line
+        auto firstLineLo = _mm_loadu_pd(pSrcScanlineShifted);
+        auto firstLineHi = _mm_loadu_pd(pSrcScanlineShifted + 2);
+        auto secondLineLo = _mm_loadu_pd(pSrcScanlineShifted + nChunkXSize);
+        auto secondLineHi =
+            _mm_loadu_pd(pSrcScanlineShifted + 2 + nChunkXSize);
+        if constexpr (bQuadraticMean)
+        {
+            firstLineLo = _mm_mul_pd(firstLineLo, firstLineLo);
+            firstLineHi = _mm_mul_pd(firstLineHi, firstLineHi);
+            secondLineLo = _mm_mul_pd(secondLineLo, secondLineLo);
+            secondLineHi = _mm_mul_pd(secondLineHi, secondLineHi);
+        }
+
+        // De-interleave even and odd columns
+        const auto firstLineEven = _mm_unpacklo_pd(firstLineLo, firstLineHi);
+        const auto firstLineOdd = _mm_unpackhi_pd(firstLineLo, firstLineHi);
+        const auto secondLineEven =
+            _mm_unpacklo_pd(secondLineLo, secondLineHi);
+        const auto secondLineOdd = _mm_unpackhi_pd(secondLineLo, secondLineHi);
+
+        const auto sum = _mm_add_pd(
+            _mm_add_pd(_mm_add_pd(firstLineEven, firstLineOdd),
+                       secondLineEven),
+            secondLineOdd);
+
+        auto res = _mm_mul_pd(sum, zeroDot25);
+        if constexpr (bQuadraticMean)
+            res = _mm_sqrt_pd(res);
+
+        _mm_storeu_pd(&pDstScanline[iDstPixel], res);
+        pSrcScanlineShifted += 4;
+    }
+
+    pSrcScanlineShiftedInOut = pSrcScanlineShifted;
+    return iDstPixel;
+}
+
 #endif
 
+/************************************************************************/
+/*                   SumIntegerFactorBlock()                            */
+/************************************************************************/
+
+// Sum (or sum the squares of) the values of nFactor x nFactor blocks of
+// integer values. The vertical accumulation is done on full lines, in a
+// form compilers can auto-vectorize (SSE2, or AVX2 when enabled), and the
+// horizontal reduction is done afterwards.
+template <class T, class Tacc, bool bQuadraticMean>
+static void SumIntegerFactorBlock(const T *CPL_RESTRICT pSrc, int nChunkXSize,
+                                  int nFactor, int nDstXWidth,
+                                  Tacc *CPL_RESTRICT pAccLine,
+                                  Tacc *CPL_RESTRICT pAccDst)
+{
+    const int nSrcWidth = nDstXWidth * nFactor;
+    for (int iX = 0; iX < nSrcWidth; ++iX)
+    {
+        const Tacc val = pSrc[iX];
+        pAccLine[iX] = bQuadraticMean ? val * val : val;
+    }
+    for (int iY = 1; iY < nFactor; ++iY)
+    {
+        const T *CPL_RESTRICT pSrcLine =
+            pSrc + static_cast<GPtrDiff_t>(iY) * nChunkXSize;
+        for (int iX = 0; iX < nSrcWidth; ++iX)
+        {
+            const Tacc val = pSrcLine[iX];
+            pAccLine[iX] += bQuadraticMean ? val * val : val;
+        }
+    }
+    for (int iDstPixel = 0; iDstPixel < nDstXWidth; ++iDstPixel)
+    {
+        const Tacc *CPL_RESTRICT pAccBlock = pAccLine + iDstPixel * nFactor;
+        Tacc nTotal = 0;
+        for (int iX = 0; iX < nFactor; ++iX)
+            nTotal += pAccBlock[iX];
+        pAccDst[iDstPixel] = nTotal;
+    }
+}
+
 /************************************************************************/
 /*                    GDALResampleChunk_AverageOrRMS()                  */
 /************************************************************************/
@@ -1193,6 +1293,7 @@ static CPLErr GDALResampleChunk_AverageOrRMS_T(
     /*      Precompute inner loop constants.                                */
     /* ==================================================================== */
     bool bSrcXSpacingIsTwo = true;
+    int nSrcXIntegerFactor = -1;
     int nLastSrcXOff2 = -1;
     for (int iDstPixel = nDstXOff; iDstPixel < nDstXOff2; ++iDstPixel)
     {
@@ -1231,9 +1332,35 @@ static CPLErr GDALResampleChunk_AverageOrRMS_T(
         {
             bSrcXSpacingIsTwo = false;
         }
+        if (nSrcXIntegerFactor < 0)
+            nSrcXIntegerFactor = nSrcXOff2 - nSrcXOff;
+        if (nSrcXOff2 - nSrcXOff != nSrcXIntegerFactor ||
+            (nLastSrcXOff2 >= 0 && nLastSrcXOff2 != nSrcXOff) ||
+            pasSrcX[iDstPixel - nDstXOff].dfLeftWeight != 1.0 ||
+            pasSrcX[iDstPixel - nDstXOff].dfRightWeight != 1.0)
+        {
+            nSrcXIntegerFactor = 0;
+        }
         nLastSrcXOff2 = nSrcXOff2;
     }
 
+    // Integer downsampling factors greater than 2, without nodata, on
+    // integer data types can be processed by accumulating full lines in
+    // integer arithmetics. The maximum factor is such that the squared sums
+    // cannot overflow the accumulator.
+    using Tacc =
+        typename std::conditional<eWrkDataType == GDT_UInt16, uint64_t,
+                                  GUInt32>::type;
+    Tacc *pAccBuffer = nullptr;
+    if ((eWrkDataType == GDT_Byte || eWrkDataType == GDT_UInt16) &&
+        nSrcXIntegerFactor > 2 && nSrcXIntegerFactor <= 256 &&
+        pabyChunkNodataMask == nullptr && poColorTable == nullptr)
+    {
+        pAccBuffer = static_cast<Tacc *>(VSI_MALLOC2_VERBOSE(
+            static_cast<size_t>(nDstXWidth) * (nSrcXIntegerFactor + 1),
+            sizeof(Tacc)));
+    }
+
     /* ==================================================================== */
     /*      Loop over destination scanlines.                                */
     /* ==================================================================== */
@@ -1340,7 +1467,7 @@ static CPLErr GDALResampleChunk_AverageOrRMS_T(
                             nChunkXSize;
                     int iDstPixel = 0;
 #ifdef USE_SSE2
-                    if (eWrkDataType == GDT_Float32)
+                    if constexpr (eWrkDataType == GDT_Float32)
                     {
                         if (bQuadraticMean)
                         {
@@ -1355,6 +1482,22 @@ static CPLErr GDALResampleChunk_AverageOrRMS_T(
                                 pDstScanline);
                         }
                     }
+                    else if constexpr (eWrkDataType == GDT_Float64)
+                    {
+                        if (bQuadraticMean)
+                        {
+                            iDstPixel = AverageOrQuadraticMeanDoubleSSE2<true>(
+                                nDstXWidth, nChunkXSize, pSrcScanlineShifted,
+                                pDstScanline);
+                        }
+                        else
+                        {
+                            iDstPixel =
+                                AverageOrQuadraticMeanDoubleSSE2<false>(
+                                    nDstXWidth, nChunkXSize,
+                                    pSrcScanlineShifted, pDstScanline);
+                        }
+                    }
 #endif
 
                     for (; iDstPixel < nDstXWidth; ++iDstPixel)
@@ -1390,6 +1533,56 @@ static CPLErr GDALResampleChunk_AverageOrRMS_T(
                     }
                 }
             }
+            else if (pAccBuffer && nSrcYOff2 - nSrcYOff == nSrcXIntegerFactor &&
+                     1.0 - (dfSrcYOff - nSrcYOff) == 1.0 &&
+                     1.0 - (nSrcYOff2 - dfSrcYOff2) == 1.0)
+            {
+                if constexpr (eWrkDataType == GDT_Byte ||
+                              eWrkDataType == GDT_UInt16)
+                {
+                    // Optimized case : no nodata, overview by an integer
+                    // factor and regular x and y src spacing with unit
+                    // weights. Sums are exact in integer arithmetics, hence
+                    // we get the same results as the generic case below.
+                    const int nFactor = nSrcXIntegerFactor;
+                    const T *pSrcScanlineShifted =
+                        pChunk + pasSrcX[0].nLeftXOffShifted +
+                        static_cast<GPtrDiff_t>(nSrcYOff - nChunkYOff) *
+                            nChunkXSize;
+                    Tacc *const pAccDst =
+                        pAccBuffer + static_cast<size_t>(nDstXWidth) * nFactor;
+                    if (bQuadraticMean)
+                        SumIntegerFactorBlock<T, Tacc, true>(
+                            pSrcScanlineShifted, nChunkXSize, nFactor,
+                            nDstXWidth, pAccBuffer, pAccDst);
+                    else
+                        SumIntegerFactorBlock<T, Tacc, false>(
+                            pSrcScanlineShifted, nChunkXSize, nFactor,
+                            nDstXWidth, pAccBuffer, pAccDst);
+
+                    const double dfTotalWeight =
+                        static_cast<double>(nFactor) * nFactor;
+                    for (int iDstPixel = 0; iDstPixel < nDstXWidth;
+                         ++iDstPixel)
+                    {
+                        const double dfTotal =
+                            static_cast<double>(pAccDst[iDstPixel]);
+                        T nVal;
+                        if (bQuadraticMean)
+                            nVal = ComputeIntegerRMS<
+                                T, typename std::conditional<
+                                       eWrkDataType == GDT_Byte, int,
+                                       uint64_t>::type>(dfTotal,
+                                                        dfTotalWeight);
+                        else
+                            nVal =
+                                static_cast<T>(dfTotal / dfTotalWeight + 0.5);
+                        if (bHasNoData && nVal == tNoDataValue)
+                            nVal = tReplacementVal;
+                        pDstScanline[iDstPixel] = nVal;
+                    }
+                }
+            }
             else
             {
                 const double dfBottomWeight =
@@ -1704,6 +1897,7 @@ static CPLErr GDALResampleChunk_AverageOrRMS_T(
     }
 
     CPLFree(pasSrcX);
+    CPLFree(pAccBuffer);
 
     return CE_None;
 }
@@ -4933,6 +5127,10 @@ CPLErr GDALRegenerateOverviewsEx(GDALRasterBandH hSrcBand, int nOverviewCount,
  * Starting with GDAL 3.2, the GDAL_NUM_THREADS configuration option can be set
  * to "ALL_CPUS" or a integer value to specify the number of threads to use for
  * overview computation.
+ * Starting with GDAL 3.10, when an overview level is computed from the
+ * previous one, its computation starts as soon as the lines of the previous
+ * level it depends on have been written, instead of waiting for the previous
+ * level to be completely computed.
  *
  * @param nBands the number of bands, size of papoSrcBands and size of
  *               first dimension of papapoOverviewBands
@@ -5106,12 +5304,87 @@ CPLErr GDALRegenerateOverviewsMultiBand(
         atoi(CPLGetConfigOption("GDAL_OVR_CHUNK_MAX_SIZE", "10485760"));
 
     // Second pass to do the real job.
-    double dfCurPixelCount = 0;
-    CPLErr eErr = CE_None;
-    for (int iOverview = 0; iOverview < nOverviews && eErr == CE_None;
-         ++iOverview)
+
+    // Parameters and progress of the generation of one overview level.
+    struct OvrLevel
     {
+        int iOverview = 0;
         int iSrcOverview = -1;  // -1 means the source bands.
+        int nSrcWidth = 0;
+        int nSrcHeight = 0;
+        int nDstTotalWidth = 0;
+        int nDstTotalHeight = 0;
+        int nDstXOffStart = 0;
+        int nDstXOffEnd = 0;
+        int nDstYOffStart = 0;
+        int nDstYOffEnd = 0;
+        int nDstChunkXSize = 0;
+        int nDstChunkYSize = 0;
+        double dfXRatioDstToSrc = 0;
+        double dfYRatioDstToSrc = 0;
+        int nOvrFactor = 1;
+        int nFullResXChunk = 0;
+        int nFullResXChunkQueried = 0;
+        int nFullResYChunk = 0;
+        int nFullResYChunkQueried = 0;
+
+        // Next destination row chunk to submit.
+        int nNextDstYOff = 0;
+
+        // Number of not yet written jobs, and end destination line, of each
+        // row chunk submitted so far.
+        std::vector<int> anPendingJobs{};
+        std::vector<int> anRowChunkDstYEnd{};
+        // Index of the first row chunk that is not completely written.
+        size_t iFirstIncompleteRowChunk = 0;
+        // Lines of the overview that have been completely written, starting
+        // at nDstYOffStart.
+        int nDstYOffWrittenEnd = 0;
+
+        // Whether the overview uses a lossy compression, in which case
+        // following levels must read it only once it is completely written
+        // and flushed, to get the same result as if they were computed
+        // afterwards.
+        bool bLossy = false;
+        bool bFlushed = false;
+
+        std::vector<void *> apaChunk{};
+        std::vector<GByte *> apabyChunkNoDataMask{};
+
+        bool IsSubmissionDone() const
+        {
+            return nNextDstYOff >= nDstYOffEnd;
+        }
+
+        bool IsDone() const
+        {
+            return IsSubmissionDone() &&
+                   iFirstIncompleteRowChunk == anPendingJobs.size();
+        }
+
+        void JobWritten(int iRowChunk)
+        {
+            --anPendingJobs[iRowChunk];
+            while (iFirstIncompleteRowChunk < anPendingJobs.size() &&
+                   anPendingJobs[iFirstIncompleteRowChunk] == 0 &&
+                   // The row chunk currently being submitted is not
+                   // complete, even if its submitted jobs are written.
+                   (iFirstIncompleteRowChunk + 1 < anPendingJobs.size() ||
+                    nNextDstYOff >=
+                        anRowChunkDstYEnd[iFirstIncompleteRowChunk]))
+            {
+                nDstYOffWrittenEnd =
+                    anRowChunkDstYEnd[iFirstIncompleteRowChunk];
+                ++iFirstIncompleteRowChunk;
+            }
+        }
+    };
+
+    std::vector<OvrLevel> aoLevels(nOverviews);
+    for (int iOverview = 0; iOverview < nOverviews; ++iOverview)
+    {
+        OvrLevel &oLevel = aoLevels[iOverview];
+        oLevel.iOverview = iOverview;
 
         int nDstChunkXSize = 0;
         int nDstChunkYSize = 0;
@@ -5155,7 +5428,7 @@ CPLErr GDALRegenerateOverviewsMultiBand(
         {
             nSrcWidth = papapoOverviewBands[0][iOverview - 1]->GetXSize();
             nSrcHeight = papapoOverviewBands[0][iOverview - 1]->GetYSize();
-            iSrcOverview = iOverview - 1;
+            oLevel.iSrcOverview = iOverview - 1;
         }
 
         const double dfXRatioDstToSrc =
@@ -5200,340 +5473,478 @@ CPLErr GDALRegenerateOverviewsMultiBand(
         const int nFullResXChunkQueried =
             nFullResXChunk + 2 * nKernelRadius * nOvrFactor;
 
-        // Structure describing a resampling job
-        struct OvrJob
-        {
-            // Buffers to free when job is finished
-            std::unique_ptr<PointerHolder> oSrcMaskBufferHolder{};
-            std::unique_ptr<PointerHolder> oSrcBufferHolder{};
-            std::unique_ptr<PointerHolder> oDstBufferHolder{};
-
-            // Input parameters of pfnResampleFn
-            GDALResampleFunction pfnResampleFn = nullptr;
-            double dfXRatioDstToSrc{};
-            double dfYRatioDstToSrc{};
-            GDALDataType eWrkDataType = GDT_Unknown;
-            const void *pChunk = nullptr;
-            const GByte *pabyChunkNodataMask = nullptr;
-            int nChunkXOff = 0;
-            int nChunkXSize = 0;
-            int nChunkYOff = 0;
-            int nChunkYSize = 0;
-            int nDstXOff = 0;
-            int nDstXOff2 = 0;
-            int nDstYOff = 0;
-            int nDstYOff2 = 0;
-            GDALRasterBand *poOverview = nullptr;
-            const char *pszResampling = nullptr;
-            bool bHasNoData = false;
-            double dfNoDataValue = 0.0;
-            GDALDataType eSrcDataType = GDT_Unknown;
-            bool bPropagateNoData = false;
-
-            // Output values of resampling function
-            CPLErr eErr = CE_Failure;
-            void *pDstBuffer = nullptr;
-            GDALDataType eDstBufferDataType = GDT_Unknown;
-
-            // Synchronization
-            bool bFinished = false;
-            std::mutex mutex{};
-            std::condition_variable cv{};
-        };
-
-        // Thread function to resample
-        const auto JobResampleFunc = [](void *pData)
-        {
-            OvrJob *poJob = static_cast<OvrJob *>(pData);
+        oLevel.nSrcWidth = nSrcWidth;
+        oLevel.nSrcHeight = nSrcHeight;
+        oLevel.nDstTotalWidth = nDstTotalWidth;
+        oLevel.nDstTotalHeight = nDstTotalHeight;
+        oLevel.nDstXOffStart = nDstXOffStart;
+        oLevel.nDstXOffEnd = nDstXOffEnd;
+        oLevel.nDstYOffStart = nDstYOffStart;
+        oLevel.nDstYOffEnd = nDstYOffEnd;
+        oLevel.nDstChunkXSize = nDstChunkXSize;
+        oLevel.nDstChunkYSize = nDstChunkYSize;
+        oLevel.dfXRatioDstToSrc = dfXRatioDstToSrc;
+        oLevel.dfYRatioDstToSrc = dfYRatioDstToSrc;
+        oLevel.nOvrFactor = nOvrFactor;
+        oLevel.nFullResXChunk = nFullResXChunk;
+        oLevel.nFullResXChunkQueried = nFullResXChunkQueried;
+        oLevel.nFullResYChunk = nFullResYChunk;
+        oLevel.nFullResYChunkQueried = nFullResYChunkQueried;
+        oLevel.nNextDstYOff = nDstYOffStart;
+        oLevel.nDstYOffWrittenEnd = nDstYOffStart;
+        oLevel.apaChunk.resize(nBands);
+        oLevel.apabyChunkNoDataMask.resize(nBands);
+
+        GDALDataset *poOvrDS = papapoOverviewBands[0][iOverview]->GetDataset();
+        const char *pszCompression =
+            poOvrDS ? poOvrDS->GetMetadataItem("COMPRESSION", "IMAGE_STRUCTURE")
+                    : nullptr;
+        oLevel.bLossy =
+            pszCompression != nullptr &&
+            (EQUAL(pszCompression, "JPEG") || EQUAL(pszCompression, "WEBP") ||
+             EQUAL(pszCompression, "JXL") ||
+             STARTS_WITH_CI(pszCompression, "LERC"));
+    }
 
-            poJob->eErr = poJob->pfnResampleFn(
-                poJob->dfXRatioDstToSrc, poJob->dfYRatioDstToSrc, 0.0, 0.0,
-                poJob->eWrkDataType, poJob->pChunk, poJob->pabyChunkNodataMask,
-                poJob->nChunkXOff, poJob->nChunkXSize, poJob->nChunkYOff,
-                poJob->nChunkYSize, poJob->nDstXOff, poJob->nDstXOff2,
-                poJob->nDstYOff, poJob->nDstYOff2, poJob->poOverview,
-                &(poJob->pDstBuffer), &(poJob->eDstBufferDataType),
-                poJob->pszResampling, poJob->bHasNoData, poJob->dfNoDataValue,
-                nullptr, poJob->eSrcDataType, poJob->bPropagateNoData);
+    // Structure describing a resampling job
+    struct OvrJob
+    {
+        // Buffers to free when job is finished
+        std::unique_ptr<PointerHolder> oSrcMaskBufferHolder{};
+        std::unique_ptr<PointerHolder> oSrcBufferHolder{};
+        std::unique_ptr<PointerHolder> oDstBufferHolder{};
+
+        // Input parameters of pfnResampleFn
+        GDALResampleFunction pfnResampleFn = nullptr;
+        double dfXRatioDstToSrc{};
+        double dfYRatioDstToSrc{};
+        GDALDataType eWrkDataType = GDT_Unknown;
+        const void *pChunk = nullptr;
+        const GByte *pabyChunkNodataMask = nullptr;
+        int nChunkXOff = 0;
+        int nChunkXSize = 0;
+        int nChunkYOff = 0;
+        int nChunkYSize = 0;
+        int nDstXOff = 0;
+        int nDstXOff2 = 0;
+        int nDstYOff = 0;
+        int nDstYOff2 = 0;
+        GDALRasterBand *poOverview = nullptr;
+        const char *pszResampling = nullptr;
+        bool bHasNoData = false;
+        double dfNoDataValue = 0.0;
+        GDALDataType eSrcDataType = GDT_Unknown;
+        bool bPropagateNoData = false;
+
+        // Level and row chunk the job belongs to
+        OvrLevel *poLevel = nullptr;
+        int iRowChunk = 0;
+
+        // Output values of resampling function
+        CPLErr eErr = CE_Failure;
+        void *pDstBuffer = nullptr;
+        GDALDataType eDstBufferDataType = GDT_Unknown;
 
-            poJob->oDstBufferHolder.reset(new PointerHolder(poJob->pDstBuffer));
+        // Synchronization
+        bool bFinished = false;
+        std::mutex mutex{};
+        std::condition_variable cv{};
+    };
 
+    // Thread function to resample
+    const auto JobResampleFunc = [](void *pData)
+    {
+        OvrJob *poJob = static_cast<OvrJob *>(pData);
+
+        poJob->eErr = poJob->pfnResampleFn(
+            poJob->dfXRatioDstToSrc, poJob->dfYRatioDstToSrc, 0.0, 0.0,
+            poJob->eWrkDataType, poJob->pChunk, poJob->pabyChunkNodataMask,
+            poJob->nChunkXOff, poJob->nChunkXSize, poJob->nChunkYOff,
+            poJob->nChunkYSize, poJob->nDstXOff, poJob->nDstXOff2,
+            poJob->nDstYOff, poJob->nDstYOff2, poJob->poOverview,
+            &(poJob->pDstBuffer), &(poJob->eDstBufferDataType),
+            poJob->pszResampling, poJob->bHasNoData, poJob->dfNoDataValue,
+            nullptr, poJob->eSrcDataType, poJob->bPropagateNoData);
+
+        poJob->oDstBufferHolder.reset(new PointerHolder(poJob->pDstBuffer));
+
+        {
+            std::lock_guard<std::mutex> guard(poJob->mutex);
+            poJob->bFinished = true;
+            poJob->cv.notify_one();
+        }
+    };
+
+    // Function to write resample data to target band
+    const auto WriteJobData = [](const OvrJob *poJob)
+    {
+        const CPLErr l_eErr = poJob->poOverview->RasterIO(
+            GF_Write, poJob->nDstXOff, poJob->nDstYOff,
+            poJob->nDstXOff2 - poJob->nDstXOff,
+            poJob->nDstYOff2 - poJob->nDstYOff, poJob->pDstBuffer,
+            poJob->nDstXOff2 - poJob->nDstXOff,
+            poJob->nDstYOff2 - poJob->nDstYOff, poJob->eDstBufferDataType, 0,
+            0, nullptr);
+        poJob->poLevel->JobWritten(poJob->iRowChunk);
+        return l_eErr;
+    };
+
+    // Wait for completion of oldest job and serialize it
+    const auto WaitAndFinalizeOldestJob =
+        [WriteJobData](std::list<std::unique_ptr<OvrJob>> &jobList)
+    {
+        auto poOldestJob = jobList.front().get();
+        {
+            std::unique_lock<std::mutex> oGuard(poOldestJob->mutex);
+            // coverity[missing_lock:FALSE]
+            while (!poOldestJob->bFinished)
             {
-                std::lock_guard<std::mutex> guard(poJob->mutex);
-                poJob->bFinished = true;
-                poJob->cv.notify_one();
+                poOldestJob->cv.wait(oGuard);
             }
-        };
+        }
+        CPLErr l_eErr = poOldestJob->eErr;
+        if (l_eErr == CE_None)
+        {
+            l_eErr = WriteJobData(poOldestJob);
+        }
+
+        jobList.pop_front();
+        return l_eErr;
+    };
+
+    // Queue of jobs
+    std::list<std::unique_ptr<OvrJob>> jobList;
 
-        // Function to write resample data to target band
-        const auto WriteJobData = [](const OvrJob *poJob)
+    // Return the source lines needed to compute the given destination lines
+    // of a level.
+    const auto GetSrcLinesQueried =
+        [nKernelRadius](const OvrLevel &oLevel, int nDstYOff, int nDstYCount,
+                        int &nChunkYOffQueried, int &nChunkYSizeQueried)
+    {
+        const int nChunkYOff =
+            static_cast<int>(nDstYOff * oLevel.dfYRatioDstToSrc);
+        int nChunkYOff2 = static_cast<int>(
+            ceil((nDstYOff + nDstYCount) * oLevel.dfYRatioDstToSrc));
+        if (nChunkYOff2 > oLevel.nSrcHeight ||
+            nDstYOff + nDstYCount == oLevel.nDstTotalHeight)
+            nChunkYOff2 = oLevel.nSrcHeight;
+        const int nYCount = nChunkYOff2 - nChunkYOff;
+        CPLAssert(nYCount <= oLevel.nFullResYChunk);
+
+        nChunkYOffQueried = nChunkYOff - nKernelRadius * oLevel.nOvrFactor;
+        nChunkYSizeQueried = nYCount + 2 * nKernelRadius * oLevel.nOvrFactor;
+        if (nChunkYOffQueried < 0)
         {
-            return poJob->poOverview->RasterIO(
-                GF_Write, poJob->nDstXOff, poJob->nDstYOff,
-                poJob->nDstXOff2 - poJob->nDstXOff,
-                poJob->nDstYOff2 - poJob->nDstYOff, poJob->pDstBuffer,
-                poJob->nDstXOff2 - poJob->nDstXOff,
-                poJob->nDstYOff2 - poJob->nDstYOff, poJob->eDstBufferDataType,
-                0, 0, nullptr);
-        };
-
-        // Wait for completion of oldest job and serialize it
-        const auto WaitAndFinalizeOldestJob =
-            [WriteJobData](std::list<std::unique_ptr<OvrJob>> &jobList)
+            nChunkYSizeQueried += nChunkYOffQueried;
+            nChunkYOffQueried = 0;
+        }
+        if (nChunkYSizeQueried + nChunkYOffQueried > oLevel.nSrcHeight)
+            nChunkYSizeQueried = oLevel.nSrcHeight - nChunkYOffQueried;
+        CPLAssert(nChunkYSizeQueried <= oLevel.nFullResYChunkQueried);
+    };
+
+    // Return whether the next row chunk of a level can be submitted, that
+    // is if the lines of the previous level it depends on have been
+    // completely written.
+    const auto IsLevelReady = [&aoLevels, &GetSrcLinesQueried](int iLevel)
+    {
+        const OvrLevel &oLevel = aoLevels[iLevel];
+        if (oLevel.IsSubmissionDone())
+            return false;
+        if (oLevel.iSrcOverview < 0)
+            return true;
+        const OvrLevel &oSrcLevel = aoLevels[oLevel.iSrcOverview];
+        if (oSrcLevel.IsDone())
+            return oSrcLevel.bFlushed;
+        if (oSrcLevel.bLossy)
+            return false;
+        const int nDstYCount =
+            std::min(oLevel.nDstChunkYSize,
+                     oLevel.nDstYOffEnd - oLevel.nNextDstYOff);
+        int nChunkYOffQueried = 0;
+        int nChunkYSizeQueried = 0;
+        GetSrcLinesQueried(oLevel, oLevel.nNextDstYOff, nDstYCount,
+                           nChunkYOffQueried, nChunkYSizeQueried);
+        return nChunkYOffQueried + nChunkYSizeQueried <=
+               oSrcLevel.nDstYOffWrittenEnd;
+    };
+
+    // Main loop. Row chunks of the different levels are scheduled as soon as
+    // the lines of the previous level they depend on have been written, so
+    // that the computation of a level does not have to wait for the previous
+    // one to be completely finished. The deepest ready level is preferred,
+    // so that the source lines it reads are likely still in the block cache.
+    // The number of jobs in flight is bounded by the number of threads.
+    double dfCurPixelCount = 0;
+    CPLErr eErr = CE_None;
+    while (eErr == CE_None)
+    {
+        // Flush the data of completed levels.
+        for (auto &oLevel : aoLevels)
         {
-            auto poOldestJob = jobList.front().get();
+            if (!oLevel.bFlushed && oLevel.IsDone())
             {
-                std::unique_lock<std::mutex> oGuard(poOldestJob->mutex);
-                // coverity[missing_lock:FALSE]
-                while (!poOldestJob->bFinished)
+                for (int iBand = 0; iBand < nBands; ++iBand)
                 {
-                    poOldestJob->cv.wait(oGuard);
+                    papapoOverviewBands[iBand][oLevel.iOverview]->FlushCache(
+                        false);
                 }
+                oLevel.bFlushed = true;
             }
-            CPLErr l_eErr = poOldestJob->eErr;
-            if (l_eErr == CE_None)
+        }
+
+        int iLevel = -1;
+        for (int i = nOverviews - 1; i >= 0; --i)
+        {
+            if (IsLevelReady(i))
             {
-                l_eErr = WriteJobData(poOldestJob);
+                iLevel = i;
+                break;
             }
+        }
+        if (iLevel < 0)
+        {
+            if (jobList.empty())
+            {
+                // All done.
+                CPLAssert(std::all_of(aoLevels.begin(), aoLevels.end(),
+                                      [](const OvrLevel &oLevel)
+                                      { return oLevel.IsDone(); }));
+                break;
+            }
+            // Wait for dependencies to be written
+            eErr = WaitAndFinalizeOldestJob(jobList);
+            continue;
+        }
 
-            jobList.pop_front();
-            return l_eErr;
-        };
-
-        // Queue of jobs
-        std::list<std::unique_ptr<OvrJob>> jobList;
-
-        std::vector<void *> apaChunk(nBands);
-        std::vector<GByte *> apabyChunkNoDataMask(nBands);
+        OvrLevel &oLevel = aoLevels[iLevel];
+        const int iOverview = oLevel.iOverview;
+        const int nDstYOff = oLevel.nNextDstYOff;
+        const int nDstYCount =
+            std::min(oLevel.nDstChunkYSize, oLevel.nDstYOffEnd - nDstYOff);
+        const int iRowChunk = static_cast<int>(oLevel.anPendingJobs.size());
+        oLevel.anPendingJobs.push_back(0);
+        oLevel.anRowChunkDstYEnd.push_back(nDstYOff + nDstYCount);
+
+        int nChunkYOffQueried = 0;
+        int nChunkYSizeQueried = 0;
+        GetSrcLinesQueried(oLevel, nDstYOff, nDstYCount, nChunkYOffQueried,
+                           nChunkYSizeQueried);
+
+        if (!pfnProgress(dfCurPixelCount / dfTotalPixelCount, nullptr,
+                         pProgressData))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
 
         // Iterate on destination overview, block by block.
-        for (int nDstYOff = nDstYOffStart;
-             nDstYOff < nDstYOffEnd && eErr == CE_None;
-             nDstYOff += nDstChunkYSize)
+        for (int nDstXOff = oLevel.nDstXOffStart;
+             nDstXOff < oLevel.nDstXOffEnd && eErr == CE_None;
+             nDstXOff += oLevel.nDstChunkXSize)
         {
-            int nDstYCount;
-            if (nDstYOff + nDstChunkYSize <= nDstYOffEnd)
-                nDstYCount = nDstChunkYSize;
+            int nDstXCount = 0;
+            if (nDstXOff + oLevel.nDstChunkXSize <= oLevel.nDstXOffEnd)
+                nDstXCount = oLevel.nDstChunkXSize;
             else
-                nDstYCount = nDstYOffEnd - nDstYOff;
-
-            int nChunkYOff = static_cast<int>(nDstYOff * dfYRatioDstToSrc);
-            int nChunkYOff2 = static_cast<int>(
-                ceil((nDstYOff + nDstYCount) * dfYRatioDstToSrc));
-            if (nChunkYOff2 > nSrcHeight ||
-                nDstYOff + nDstYCount == nDstTotalHeight)
-                nChunkYOff2 = nSrcHeight;
-            int nYCount = nChunkYOff2 - nChunkYOff;
-            CPLAssert(nYCount <= nFullResYChunk);
-
-            int nChunkYOffQueried = nChunkYOff - nKernelRadius * nOvrFactor;
-            int nChunkYSizeQueried = nYCount + 2 * nKernelRadius * nOvrFactor;
-            if (nChunkYOffQueried < 0)
+                nDstXCount = oLevel.nDstXOffEnd - nDstXOff;
+
+            dfCurPixelCount += static_cast<double>(nDstXCount) * nDstYCount;
+
+            int nChunkXOff =
+                static_cast<int>(nDstXOff * oLevel.dfXRatioDstToSrc);
+            int nChunkXOff2 = static_cast<int>(
+                ceil((nDstXOff + nDstXCount) * oLevel.dfXRatioDstToSrc));
+            if (nChunkXOff2 > oLevel.nSrcWidth ||
+                nDstXOff + nDstXCount == oLevel.nDstTotalWidth)
+                nChunkXOff2 = oLevel.nSrcWidth;
+            const int nXCount = nChunkXOff2 - nChunkXOff;
+            CPLAssert(nXCount <= oLevel.nFullResXChunk);
+
+            int nChunkXOffQueried =
+                nChunkXOff - nKernelRadius * oLevel.nOvrFactor;
+            int nChunkXSizeQueried =
+                nXCount + 2 * nKernelRadius * oLevel.nOvrFactor;
+            if (nChunkXOffQueried < 0)
             {
-                nChunkYSizeQueried += nChunkYOffQueried;
-                nChunkYOffQueried = 0;
+                nChunkXSizeQueried += nChunkXOffQueried;
+                nChunkXOffQueried = 0;
             }
-            if (nChunkYSizeQueried + nChunkYOffQueried > nSrcHeight)
-                nChunkYSizeQueried = nSrcHeight - nChunkYOffQueried;
-            CPLAssert(nChunkYSizeQueried <= nFullResYChunkQueried);
-
-            if (!pfnProgress(dfCurPixelCount / dfTotalPixelCount, nullptr,
-                             pProgressData))
-            {
-                CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                eErr = CE_Failure;
-            }
-
-            // Iterate on destination overview, block by block.
-            for (int nDstXOff = nDstXOffStart;
-                 nDstXOff < nDstXOffEnd && eErr == CE_None;
-                 nDstXOff += nDstChunkXSize)
-            {
-                int nDstXCount = 0;
-                if (nDstXOff + nDstChunkXSize <= nDstXOffEnd)
-                    nDstXCount = nDstChunkXSize;
-                else
-                    nDstXCount = nDstXOffEnd - nDstXOff;
-
-                dfCurPixelCount += static_cast<double>(nDstXCount) * nDstYCount;
-
-                int nChunkXOff = static_cast<int>(nDstXOff * dfXRatioDstToSrc);
-                int nChunkXOff2 = static_cast<int>(
-                    ceil((nDstXOff + nDstXCount) * dfXRatioDstToSrc));
-                if (nChunkXOff2 > nSrcWidth ||
-                    nDstXOff + nDstXCount == nDstTotalWidth)
-                    nChunkXOff2 = nSrcWidth;
-                const int nXCount = nChunkXOff2 - nChunkXOff;
-                CPLAssert(nXCount <= nFullResXChunk);
-
-                int nChunkXOffQueried = nChunkXOff - nKernelRadius * nOvrFactor;
-                int nChunkXSizeQueried =
-                    nXCount + 2 * nKernelRadius * nOvrFactor;
-                if (nChunkXOffQueried < 0)
-                {
-                    nChunkXSizeQueried += nChunkXOffQueried;
-                    nChunkXOffQueried = 0;
-                }
-                if (nChunkXSizeQueried + nChunkXOffQueried > nSrcWidth)
-                    nChunkXSizeQueried = nSrcWidth - nChunkXOffQueried;
-                CPLAssert(nChunkXSizeQueried <= nFullResXChunkQueried);
+            if (nChunkXSizeQueried + nChunkXOffQueried > oLevel.nSrcWidth)
+                nChunkXSizeQueried = oLevel.nSrcWidth - nChunkXOffQueried;
+            CPLAssert(nChunkXSizeQueried <= oLevel.nFullResXChunkQueried);
 #if DEBUG_VERBOSE
-                CPLDebug("GDAL",
-                         "Reading (%dx%d -> %dx%d) for output (%dx%d -> %dx%d)",
-                         nChunkXOffQueried, nChunkYOffQueried,
-                         nChunkXSizeQueried, nChunkYSizeQueried, nDstXOff,
-                         nDstYOff, nDstXCount, nDstYCount);
+            CPLDebug("GDAL",
+                     "Reading (%dx%d -> %dx%d) for output (%dx%d -> %dx%d)",
+                     nChunkXOffQueried, nChunkYOffQueried, nChunkXSizeQueried,
+                     nChunkYSizeQueried, nDstXOff, nDstYOff, nDstXCount,
+                     nDstYCount);
 #endif
 
-                // Avoid accumulating too many tasks and exhaust RAM
+            // Avoid accumulating too many tasks and exhaust RAM
 
-                // Try to complete already finished jobs
-                while (eErr == CE_None && !jobList.empty())
+            // Try to complete already finished jobs
+            while (eErr == CE_None && !jobList.empty())
+            {
+                auto poOldestJob = jobList.front().get();
                 {
-                    auto poOldestJob = jobList.front().get();
-                    {
-                        std::lock_guard<std::mutex> oGuard(poOldestJob->mutex);
-                        if (!poOldestJob->bFinished)
-                        {
-                            break;
-                        }
-                    }
-                    eErr = poOldestJob->eErr;
-                    if (eErr == CE_None)
+                    std::lock_guard<std::mutex> oGuard(poOldestJob->mutex);
+                    if (!poOldestJob->bFinished)
                     {
-                        eErr = WriteJobData(poOldestJob);
+                        break;
                     }
-
-                    jobList.pop_front();
                 }
-
-                // And in case we have saturated the number of threads,
-                // wait for completion of tasks to go below the threshold.
-                while (eErr == CE_None &&
-                       jobList.size() >= static_cast<size_t>(nThreads))
+                eErr = poOldestJob->eErr;
+                if (eErr == CE_None)
                 {
-                    eErr = WaitAndFinalizeOldestJob(jobList);
+                    eErr = WriteJobData(poOldestJob);
                 }
 
-                // (Re)allocate buffers if needed
-                for (int iBand = 0; iBand < nBands; ++iBand)
+                jobList.pop_front();
+            }
+
+            // And in case we have saturated the number of threads,
+            // wait for completion of tasks to go below the threshold.
+            while (eErr == CE_None &&
+                   jobList.size() >= static_cast<size_t>(nThreads))
+            {
+                eErr = WaitAndFinalizeOldestJob(jobList);
+            }
+
+            // (Re)allocate buffers if needed
+            for (int iBand = 0; iBand < nBands; ++iBand)
+            {
+                if (oLevel.apaChunk[iBand] == nullptr)
                 {
-                    if (apaChunk[iBand] == nullptr)
+                    oLevel.apaChunk[iBand] = VSI_MALLOC3_VERBOSE(
+                        oLevel.nFullResXChunkQueried,
+                        oLevel.nFullResYChunkQueried,
+                        GDALGetDataTypeSizeBytes(eWrkDataType));
+                    if (oLevel.apaChunk[iBand] == nullptr)
                     {
-                        apaChunk[iBand] = VSI_MALLOC3_VERBOSE(
-                            nFullResXChunkQueried, nFullResYChunkQueried,
-                            GDALGetDataTypeSizeBytes(eWrkDataType));
-                        if (apaChunk[iBand] == nullptr)
-                        {
-                            eErr = CE_Failure;
-                        }
+                        eErr = CE_Failure;
                     }
-                    if (bUseNoDataMask &&
-                        apabyChunkNoDataMask[iBand] == nullptr)
+                }
+                if (bUseNoDataMask &&
+                    oLevel.apabyChunkNoDataMask[iBand] == nullptr)
+                {
+                    oLevel.apabyChunkNoDataMask[iBand] =
+                        static_cast<GByte *>(VSI_MALLOC2_VERBOSE(
+                            oLevel.nFullResXChunkQueried,
+                            oLevel.nFullResYChunkQueried));
+                    if (oLevel.apabyChunkNoDataMask[iBand] == nullptr)
                     {
-                        apabyChunkNoDataMask[iBand] =
-                            static_cast<GByte *>(VSI_MALLOC2_VERBOSE(
-                                nFullResXChunkQueried, nFullResYChunkQueried));
-                        if (apabyChunkNoDataMask[iBand] == nullptr)
-                        {
-                            eErr = CE_Failure;
-                        }
+                        eErr = CE_Failure;
                     }
                 }
+            }
 
-                // Read the source buffers for all the bands.
-                for (int iBand = 0; iBand < nBands && eErr == CE_None; ++iBand)
+            // Read the source buffers for all the bands.
+            for (int iBand = 0; iBand < nBands && eErr == CE_None; ++iBand)
+            {
+                GDALRasterBand *poSrcBand = nullptr;
+                if (oLevel.iSrcOverview == -1)
+                    poSrcBand = papoSrcBands[iBand];
+                else
+                    poSrcBand = papapoOverviewBands[iBand][oLevel.iSrcOverview];
+                eErr = poSrcBand->RasterIO(
+                    GF_Read, nChunkXOffQueried, nChunkYOffQueried,
+                    nChunkXSizeQueried, nChunkYSizeQueried,
+                    oLevel.apaChunk[iBand], nChunkXSizeQueried,
+                    nChunkYSizeQueried, eWrkDataType, 0, 0, nullptr);
+
+                if (bUseNoDataMask && eErr == CE_None)
                 {
-                    GDALRasterBand *poSrcBand = nullptr;
-                    if (iSrcOverview == -1)
-                        poSrcBand = papoSrcBands[iBand];
-                    else
-                        poSrcBand = papapoOverviewBands[iBand][iSrcOverview];
-                    eErr = poSrcBand->RasterIO(
+                    auto poMaskBand = poSrcBand->IsMaskBand()
+                                          ? poSrcBand
+                                          : poSrcBand->GetMaskBand();
+                    eErr = poMaskBand->RasterIO(
                         GF_Read, nChunkXOffQueried, nChunkYOffQueried,
-                        nChunkXSizeQueried, nChunkYSizeQueried, apaChunk[iBand],
-                        nChunkXSizeQueried, nChunkYSizeQueried, eWrkDataType, 0,
-                        0, nullptr);
-
-                    if (bUseNoDataMask && eErr == CE_None)
-                    {
-                        auto poMaskBand = poSrcBand->IsMaskBand()
-                                              ? poSrcBand
-                                              : poSrcBand->GetMaskBand();
-                        eErr = poMaskBand->RasterIO(
-                            GF_Read, nChunkXOffQueried, nChunkYOffQueried,
-                            nChunkXSizeQueried, nChunkYSizeQueried,
-                            apabyChunkNoDataMask[iBand], nChunkXSizeQueried,
-                            nChunkYSizeQueried, GDT_Byte, 0, 0, nullptr);
-                    }
+                        nChunkXSizeQueried, nChunkYSizeQueried,
+                        oLevel.apabyChunkNoDataMask[iBand], nChunkXSizeQueried,
+                        nChunkYSizeQueried, GDT_Byte, 0, 0, nullptr);
                 }
+            }
 
-                // Compute the resulting overview block.
-                for (int iBand = 0; iBand < nBands && eErr == CE_None; ++iBand)
+            // Compute the resulting overview block.
+            for (int iBand = 0; iBand < nBands && eErr == CE_None; ++iBand)
+            {
+                auto poJob = std::unique_ptr<OvrJob>(new OvrJob());
+                poJob->pfnResampleFn = pfnResampleFn;
+                poJob->dfXRatioDstToSrc = oLevel.dfXRatioDstToSrc;
+                poJob->dfYRatioDstToSrc = oLevel.dfYRatioDstToSrc;
+                poJob->eWrkDataType = eWrkDataType;
+                poJob->pChunk = oLevel.apaChunk[iBand];
+                poJob->pabyChunkNodataMask = oLevel.apabyChunkNoDataMask[iBand];
+                poJob->nChunkXOff = nChunkXOffQueried;
+                poJob->nChunkXSize = nChunkXSizeQueried;
+                poJob->nChunkYOff = nChunkYOffQueried;
+                poJob->nChunkYSize = nChunkYSizeQueried;
+                poJob->nDstXOff = nDstXOff;
+                poJob->nDstXOff2 = nDstXOff + nDstXCount;
+                poJob->nDstYOff = nDstYOff;
+                poJob->nDstYOff2 = nDstYOff + nDstYCount;
+                poJob->poOverview = papapoOverviewBands[iBand][iOverview];
+                poJob->pszResampling = pszResampling;
+                poJob->bHasNoData = pabHasNoData[iBand];
+                poJob->dfNoDataValue = padfNoDataValue[iBand];
+                poJob->eSrcDataType = eDataType;
+                poJob->bPropagateNoData = bPropagateNoData;
+                poJob->poLevel = &oLevel;
+                poJob->iRowChunk = iRowChunk;
+                ++oLevel.anPendingJobs[iRowChunk];
+
+                if (poJobQueue)
                 {
-                    auto poJob = std::unique_ptr<OvrJob>(new OvrJob());
-                    poJob->pfnResampleFn = pfnResampleFn;
-                    poJob->dfXRatioDstToSrc = dfXRatioDstToSrc;
-                    poJob->dfYRatioDstToSrc = dfYRatioDstToSrc;
-                    poJob->eWrkDataType = eWrkDataType;
-                    poJob->pChunk = apaChunk[iBand];
-                    poJob->pabyChunkNodataMask = apabyChunkNoDataMask[iBand];
-                    poJob->nChunkXOff = nChunkXOffQueried;
-                    poJob->nChunkXSize = nChunkXSizeQueried;
-                    poJob->nChunkYOff = nChunkYOffQueried;
-                    poJob->nChunkYSize = nChunkYSizeQueried;
-                    poJob->nDstXOff = nDstXOff;
-                    poJob->nDstXOff2 = nDstXOff + nDstXCount;
-                    poJob->nDstYOff = nDstYOff;
-                    poJob->nDstYOff2 = nDstYOff + nDstYCount;
-                    poJob->poOverview = papapoOverviewBands[iBand][iOverview];
-                    poJob->pszResampling = pszResampling;
-                    poJob->bHasNoData = pabHasNoData[iBand];
-                    poJob->dfNoDataValue = padfNoDataValue[iBand];
-                    poJob->eSrcDataType = eDataType;
-                    poJob->bPropagateNoData = bPropagateNoData;
-
-                    if (poJobQueue)
-                    {
-                        poJob->oSrcMaskBufferHolder.reset(
-                            new PointerHolder(apabyChunkNoDataMask[iBand]));
-                        apabyChunkNoDataMask[iBand] = nullptr;
+                    poJob->oSrcMaskBufferHolder.reset(
+                        new PointerHolder(oLevel.apabyChunkNoDataMask[iBand]));
+                    oLevel.apabyChunkNoDataMask[iBand] = nullptr;
 
-                        poJob->oSrcBufferHolder.reset(
-                            new PointerHolder(apaChunk[iBand]));
-                        apaChunk[iBand] = nullptr;
+                    poJob->oSrcBufferHolder.reset(
+                        new PointerHolder(oLevel.apaChunk[iBand]));
+                    oLevel.apaChunk[iBand] = nullptr;
 
-                        poJobQueue->SubmitJob(JobResampleFunc, poJob.get());
-                        jobList.emplace_back(std::move(poJob));
-                    }
-                    else
+                    poJobQueue->SubmitJob(JobResampleFunc, poJob.get());
+                    jobList.emplace_back(std::move(poJob));
+                }
+                else
+                {
+                    JobResampleFunc(poJob.get());
+                    eErr = poJob->eErr;
+                    if (eErr == CE_None)
                     {
-                        JobResampleFunc(poJob.get());
-                        eErr = poJob->eErr;
-                        if (eErr == CE_None)
-                        {
-                            eErr = WriteJobData(poJob.get());
-                        }
+                        eErr = WriteJobData(poJob.get());
                     }
                 }
             }
         }
 
-        // Wait for all pending jobs to complete
-        while (!jobList.empty())
-        {
-            const auto l_eErr = WaitAndFinalizeOldestJob(jobList);
-            if (l_eErr != CE_None && eErr == CE_None)
-                eErr = l_eErr;
-        }
+        // The row chunk is now completely submitted. This may complete it,
+        // if all its jobs have already been written.
+        oLevel.nNextDstYOff = nDstYOff + nDstYCount;
+        ++oLevel.anPendingJobs[iRowChunk];
+        oLevel.JobWritten(iRowChunk);
+    }
 
-        // Flush the data to overviews.
+    // Wait for all pending jobs to complete
+    while (!jobList.empty())
+    {
+        const auto l_eErr = WaitAndFinalizeOldestJob(jobList);
+        if (l_eErr != CE_None && eErr == CE_None)
+            eErr = l_eErr;
+    }
+
+    // Flush the data to overviews.
+    for (int iOverview = 0; iOverview < nOverviews; ++iOverview)
+    {
+        OvrLevel &oLevel = aoLevels[iOverview];
         for (int iBand = 0; iBand < nBands; ++iBand)
         {
-            CPLFree(apaChunk[iBand]);
-            papapoOverviewBands[iBand][iOverview]->FlushCache(false);
+            CPLFree(oLevel.apaChunk[iBand]);
+            if (!oLevel.bFlushed)
+                papapoOverviewBands[iBand][iOverview]->FlushCache(false);
 
-            CPLFree(apabyChunkNoDataMask[iBand]);
+            CPLFree(oLevel.apabyChunkNoDataMask[iBand]);
         }
     }
 
@@ -41,13 +41,18 @@
 #include <cstring>
 
 #include <algorithm>
+#include <condition_variable>
 #include <limits>
+#include <mutex>
 #include <stdexcept>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_cpu_features.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
@@ -2604,6 +2609,164 @@ void GDALCopyWordsT(const double *const CPL_RESTRICT pSrcData,
                             nDstPixelStride, nWordCount);
 }
 
+// Sign-extend (for Int16) or zero-extend (for UInt16) 8 values of xmm
+// into 2 registers of 4 int32 values.
+template <class Tin>
+static inline void GDALExpand16BitTo32Bit(const __m128i xmm, __m128i &xmm0,
+                                          __m128i &xmm1)
+{
+    if (std::is_signed<Tin>::value)
+    {
+        xmm0 = _mm_srai_epi32(_mm_unpacklo_epi16(xmm, xmm), 16);
+        xmm1 = _mm_srai_epi32(_mm_unpackhi_epi16(xmm, xmm), 16);
+    }
+    else
+    {
+        const __m128i xmm_zero = _mm_setzero_si128();
+        xmm0 = _mm_unpacklo_epi16(xmm, xmm_zero);
+        xmm1 = _mm_unpackhi_epi16(xmm, xmm_zero);
+    }
+}
+
+template <class Tin, class Tout>
+void GDALCopyWords16BitTo32Bit(const Tin *const CPL_RESTRICT pSrcData,
+                               int nSrcPixelStride,
+                               Tout *const CPL_RESTRICT pDstData,
+                               int nDstPixelStride, GPtrDiff_t nWordCount)
+{
+    static_assert(std::is_integral<Tin>::value &&
+                      sizeof(Tin) == sizeof(uint16_t),
+                  "Bad Tin");
+    static_assert(sizeof(Tout) == sizeof(uint32_t), "Bad Tout");
+    if (nSrcPixelStride == static_cast<int>(sizeof(*pSrcData)) &&
+        nDstPixelStride == static_cast<int>(sizeof(*pDstData)))
+    {
+        decltype(nWordCount) n = 0;
+        GByte *CPL_RESTRICT pabyDstDataPtr =
+            reinterpret_cast<GByte *>(pDstData);
+        for (; n < nWordCount - 7; n += 8)
+        {
+            __m128i xmm = _mm_loadu_si128(
+                reinterpret_cast<const __m128i *>(pSrcData + n));
+            __m128i xmm0;
+            __m128i xmm1;
+            GDALExpand16BitTo32Bit<Tin>(xmm, xmm0, xmm1);
+            if (std::is_integral<Tout>::value)
+            {
+                _mm_storeu_si128(
+                    reinterpret_cast<__m128i *>(pabyDstDataPtr + n * 4), xmm0);
+                _mm_storeu_si128(
+                    reinterpret_cast<__m128i *>(pabyDstDataPtr + n * 4 + 16),
+                    xmm1);
+            }
+            else
+            {
+                _mm_storeu_ps(
+                    reinterpret_cast<float *>(pabyDstDataPtr + n * 4),
+                    _mm_cvtepi32_ps(xmm0));
+                _mm_storeu_ps(
+                    reinterpret_cast<float *>(pabyDstDataPtr + n * 4 + 16),
+                    _mm_cvtepi32_ps(xmm1));
+            }
+        }
+        for (; n < nWordCount; n++)
+        {
+            pDstData[n] = static_cast<Tout>(pSrcData[n]);
+        }
+    }
+    else
+    {
+        GDALCopyWordsGenericT(pSrcData, nSrcPixelStride, pDstData,
+                              nDstPixelStride, nWordCount);
+    }
+}
+
+template <>
+void GDALCopyWordsT(const GInt16 *const CPL_RESTRICT pSrcData,
+                    int nSrcPixelStride, GInt32 *const CPL_RESTRICT pDstData,
+                    int nDstPixelStride, GPtrDiff_t nWordCount)
+{
+    GDALCopyWords16BitTo32Bit(pSrcData, nSrcPixelStride, pDstData,
+                              nDstPixelStride, nWordCount);
+}
+
+template <>
+void GDALCopyWordsT(const GInt16 *const CPL_RESTRICT pSrcData,
+                    int nSrcPixelStride, float *const CPL_RESTRICT pDstData,
+                    int nDstPixelStride, GPtrDiff_t nWordCount)
+{
+    GDALCopyWords16BitTo32Bit(pSrcData, nSrcPixelStride, pDstData,
+                              nDstPixelStride, nWordCount);
+}
+
+template <>
+void GDALCopyWordsT(const GUInt16 *const CPL_RESTRICT pSrcData,
+                    int nSrcPixelStride, GUInt32 *const CPL_RESTRICT pDstData,
+                    int nDstPixelStride, GPtrDiff_t nWordCount)
+{
+    GDALCopyWords16BitTo32Bit(pSrcData, nSrcPixelStride, pDstData,
+                              nDstPixelStride, nWordCount);
+}
+
+template <>
+void GDALCopyWordsT(const GUInt16 *const CPL_RESTRICT pSrcData,
+                    int nSrcPixelStride, GInt32 *const CPL_RESTRICT pDstData,
+                    int nDstPixelStride, GPtrDiff_t nWordCount)
+{
+    GDALCopyWords16BitTo32Bit(pSrcData, nSrcPixelStride, pDstData,
+                              nDstPixelStride, nWordCount);
+}
+
+template <>
+void GDALCopyWordsT(const GInt16 *const CPL_RESTRICT pSrcData,
+                    int nSrcPixelStride, double *const CPL_RESTRICT pDstData,
+                    int nDstPixelStride, GPtrDiff_t nWordCount)
+{
+    if (nSrcPixelStride == static_cast<int>(sizeof(*pSrcData)) &&
+        nDstPixelStride == static_cast<int>(sizeof(*pDstData)))
+    {
+        decltype(nWordCount) n = 0;
+        GByte *CPL_RESTRICT pabyDstDataPtr =
+            reinterpret_cast<GByte *>(pDstData);
+        for (; n < nWordCount - 7; n += 8)
+        {
+            __m128i xmm = _mm_loadu_si128(
+                reinterpret_cast<const __m128i *>(pSrcData + n));
+            __m128i xmm0;
+            __m128i xmm1;
+            GDALExpand16BitTo32Bit<GInt16>(xmm, xmm0, xmm1);
+
+            __m128d xmm0_low_d = _mm_cvtepi32_pd(xmm0);
+            __m128d xmm1_low_d = _mm_cvtepi32_pd(xmm1);
+            xmm0 = _mm_srli_si128(xmm0, 8);
+            xmm1 = _mm_srli_si128(xmm1, 8);
+            __m128d xmm0_high_d = _mm_cvtepi32_pd(xmm0);
+            __m128d xmm1_high_d = _mm_cvtepi32_pd(xmm1);
+
+            _mm_storeu_pd(reinterpret_cast<double *>(pabyDstDataPtr + n * 8),
+                          xmm0_low_d);
+            _mm_storeu_pd(
+                reinterpret_cast<double *>(pabyDstDataPtr + n * 8 + 16),
+                xmm0_high_d);
+            _mm_storeu_pd(
+                reinterpret_cast<double *>(pabyDstDataPtr + n * 8 + 32),
+                xmm1_low_d);
+            _mm_storeu_pd(
+                reinterpret_cast<double *>(pabyDstDataPtr + n * 8 + 48),
+                xmm1_high_d);
+        }
+        for (; n < nWordCount; n++)
+        {
+            pDstData[n] = pSrcData[n];
+        }
+    }
+    else
+    {
+        GDALCopyWordsGenericT(pSrcData, nSrcPixelStride, pDstData,
+                              nDstPixelStride, nWordCount);
+    }
+}
+
 #endif  // defined(__x86_64) || defined(_M_X64)
 
 template <>
@@ -4548,6 +4711,210 @@ static void GDALCopyWholeRasterGetSwathSize(GDALRasterBand *poSrcPrototypeBand,
     *pnSwathLines = nSwathLines;
 }
 
+/************************************************************************/
+/*                      GDALCopyWholeRasterChunk                        */
+/************************************************************************/
+
+/** Window of the source dataset copied in one RasterIO() round-trip. */
+struct GDALCopyWholeRasterChunk
+{
+    int nBand = 0;  // 0 for all bands (interleaved case)
+    int iX = 0;
+    int iY = 0;
+    int nCols = 0;
+    int nLines = 0;
+};
+
+/************************************************************************/
+/*                   GDALCopyWholeRasterChunkHasData()                  */
+/************************************************************************/
+
+static bool GDALCopyWholeRasterChunkHasData(
+    GDALDataset *poSrcDS, int nBandCount, bool bCheckHoles,
+    const GDALCopyWholeRasterChunk &sChunk)
+{
+    int nStatus = GDAL_DATA_COVERAGE_STATUS_DATA;
+    if (bCheckHoles && sChunk.nBand > 0)
+    {
+        nStatus =
+            poSrcDS->GetRasterBand(sChunk.nBand)
+                ->GetDataCoverageStatus(sChunk.iX, sChunk.iY, sChunk.nCols,
+                                        sChunk.nLines,
+                                        GDAL_DATA_COVERAGE_STATUS_DATA);
+    }
+    else if (bCheckHoles)
+    {
+        for (int iBand = 0; iBand < nBandCount; iBand++)
+        {
+            nStatus |= poSrcDS->GetRasterBand(iBand + 1)
+                           ->GetDataCoverageStatus(
+                               sChunk.iX, sChunk.iY, sChunk.nCols,
+                               sChunk.nLines, GDAL_DATA_COVERAGE_STATUS_DATA);
+            if (nStatus & GDAL_DATA_COVERAGE_STATUS_DATA)
+                break;
+        }
+    }
+    return (nStatus & GDAL_DATA_COVERAGE_STATUS_DATA) != 0;
+}
+
+/************************************************************************/
+/*                      GDALCopyWholeRasterChunkIO()                    */
+/************************************************************************/
+
+static CPLErr GDALCopyWholeRasterChunkIO(GDALRWFlag eRWFlag, GDALDataset *poDS,
+                                         int nBandCount, GDALDataType eDT,
+                                         const GDALCopyWholeRasterChunk &sChunk,
+                                         void *pBuf,
+                                         GDALProgressFunc pfnProgress,
+                                         void *pProgressData)
+{
+    GDALRasterIOExtraArg sExtraArg;
+    INIT_RASTERIO_EXTRA_ARG(sExtraArg);
+    sExtraArg.pfnProgress = pfnProgress;
+    sExtraArg.pProgressData = pProgressData;
+
+    const int nBand = sChunk.nBand;
+    return poDS->RasterIO(eRWFlag, sChunk.iX, sChunk.iY, sChunk.nCols,
+                          sChunk.nLines, pBuf, sChunk.nCols, sChunk.nLines,
+                          eDT, nBand > 0 ? 1 : nBandCount,
+                          nBand > 0 ? &nBand : nullptr, 0, 0, 0,
+                          eRWFlag == GF_Read ? &sExtraArg : nullptr);
+}
+
+/************************************************************************/
+/*                  GDALCopyWholeRasterWithPrefetch()                   */
+/************************************************************************/
+
+/** Copies the chunks while a helper thread reads the next chunk from the
+ * source, so that reading (and decoding) overlaps writing (and encoding).
+ *
+ * The helper thread only accesses poSrcDS and the main thread only
+ * poDstDS, which is the usual threading contract of GDAL datasets.
+ * Chunks are written in order, from the main thread, which is also the only
+ * one to call the progress callback.
+ *
+ * @return false if the helper thread could not be started, in which case
+ * nothing has been copied.
+ */
+static bool GDALCopyWholeRasterWithPrefetch(
+    GDALDataset *poSrcDS, GDALDataset *poDstDS, int nBandCount,
+    GDALDataType eDT, bool bCheckHoles,
+    const std::vector<GDALCopyWholeRasterChunk> &asChunks,
+    void *const apBuffers[2], GDALProgressFunc pfnProgress,
+    void *pProgressData, CPLErr &eErr)
+{
+    constexpr size_t N_BUFFERS = 2;
+
+    struct ChunkState
+    {
+        bool bDone = false;
+        bool bHasData = false;
+        CPLErr eErr = CE_None;
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+    };
+
+    std::vector<ChunkState> asStates(asChunks.size());
+    std::mutex oMutex;
+    std::condition_variable oCV;
+    size_t nWritten = 0;
+    bool bStop = false;
+
+    const CPLStringList aosThreadLocalConfigOptions(
+        CPLGetThreadLocalConfigOptions());
+
+    const auto ReaderFunc = [&]()
+    {
+        CPLSetThreadLocalConfigOptions(aosThreadLocalConfigOptions.List());
+        for (size_t i = 0; i < asChunks.size(); ++i)
+        {
+            {
+                // Wait for the buffer of chunk i to have been written
+                std::unique_lock<std::mutex> oLock(oMutex);
+                oCV.wait(oLock,
+                         [&] { return bStop || i < nWritten + N_BUFFERS; });
+                if (bStop)
+                    break;
+            }
+
+            ChunkState sState;
+            CPLInstallErrorHandlerAccumulator(sState.aoErrors);
+            sState.bHasData = GDALCopyWholeRasterChunkHasData(
+                poSrcDS, nBandCount, bCheckHoles, asChunks[i]);
+            if (sState.bHasData)
+            {
+                sState.eErr = GDALCopyWholeRasterChunkIO(
+                    GF_Read, poSrcDS, nBandCount, eDT, asChunks[i],
+                    apBuffers[i % N_BUFFERS], nullptr, nullptr);
+            }
+            CPLUninstallErrorHandlerAccumulator();
+            sState.bDone = true;
+
+            const bool bFailed = sState.eErr != CE_None;
+            {
+                std::lock_guard<std::mutex> oLock(oMutex);
+                asStates[i] = std::move(sState);
+                oCV.notify_all();
+            }
+            if (bFailed)
+                break;
+        }
+    };
+
+    std::thread oReaderThread;
+    try
+    {
+        oReaderThread = std::thread(ReaderFunc);
+    }
+    catch (const std::exception &e)
+    {
+        CPLDebug("GDAL", "Cannot start prefetching thread: %s", e.what());
+        return false;
+    }
+
+    eErr = CE_None;
+    const double dfTotalChunks = static_cast<double>(asChunks.size());
+    for (size_t i = 0; i < asChunks.size(); ++i)
+    {
+        ChunkState sState;
+        {
+            std::unique_lock<std::mutex> oLock(oMutex);
+            oCV.wait(oLock, [&] { return asStates[i].bDone; });
+            sState = std::move(asStates[i]);
+        }
+
+        for (const auto &oError : sState.aoErrors)
+            CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+
+        eErr = sState.eErr;
+        if (eErr == CE_None && sState.bHasData)
+        {
+            eErr = GDALCopyWholeRasterChunkIO(
+                GF_Write, poDstDS, nBandCount, eDT, asChunks[i],
+                apBuffers[i % N_BUFFERS], nullptr, nullptr);
+        }
+
+        if (eErr == CE_None &&
+            !pfnProgress((i + 1) / dfTotalChunks, nullptr, pProgressData))
+        {
+            eErr = CE_Failure;
+            CPLError(CE_Failure, CPLE_UserInterrupt,
+                     "User terminated CreateCopy()");
+        }
+
+        {
+            std::lock_guard<std::mutex> oLock(oMutex);
+            nWritten = i + 1;
+            bStop = eErr != CE_None;
+            oCV.notify_all();
+        }
+        if (eErr != CE_None)
+            break;
+    }
+
+    oReaderThread.join();
+    return true;
+}
+
 /************************************************************************/
 /*                     GDALDatasetCopyWholeRaster()                     */
 /************************************************************************/
@@ -4576,6 +4943,13 @@ static void GDALCopyWholeRasterGetSwathSize(GDALRasterBand *poSrcPrototypeBand,
  * </ul>
  * More options may be supported in the future.
  *
+ * Starting with GDAL 3.10, when the copy involves several swaths, the next
+ * swath is read from the source dataset by a helper thread while the current
+ * one is written to the destination dataset, so that decoding and encoding
+ * overlap for any pair of drivers. This requires memory for a second swath,
+ * and can be disabled by setting the GDAL_COPY_WHOLE_RASTER_PREFETCH
+ * configuration option to NO.
+ *
  * @param hSrcDS the source dataset
  * @param hDstDS the destination dataset
  * @param papszOptions transfer hints in "StringList" Name=Value format.
@@ -4708,167 +5082,86 @@ CPLErr CPL_STDCALL GDALDatasetCopyWholeRaster(GDALDatasetH hSrcDS,
     poSrcDS->AdviseRead(0, 0, nXSize, nYSize, nXSize, nYSize, eDT, nBandCount,
                         nullptr, nullptr);
 
-    /* ==================================================================== */
-    /*      Band oriented (uninterleaved) case.                             */
-    /* ==================================================================== */
+    /* -------------------------------------------------------------------- */
+    /*      Enumerate the chunks to copy, in the order they are written.    */
+    /* -------------------------------------------------------------------- */
     CPLErr eErr = CE_None;
     const bool bCheckHoles =
         CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_HOLES", "NO"));
 
-    if (!bInterleave)
+    std::vector<GDALCopyWholeRasterChunk> asChunks;
+    for (int iBand = 0; iBand < (bInterleave ? 1 : nBandCount); iBand++)
     {
-        GDALRasterIOExtraArg sExtraArg;
-        INIT_RASTERIO_EXTRA_ARG(sExtraArg);
-        CPL_IGNORE_RET_VAL(sExtraArg.pfnProgress);  // to make cppcheck happy
-
-        const GIntBig nTotalBlocks = static_cast<GIntBig>(nBandCount) *
-                                     DIV_ROUND_UP(nYSize, nSwathLines) *
-                                     DIV_ROUND_UP(nXSize, nSwathCols);
-        GIntBig nBlocksDone = 0;
-
-        for (int iBand = 0; iBand < nBandCount && eErr == CE_None; iBand++)
+        for (int iY = 0; iY < nYSize; iY += nSwathLines)
         {
-            int nBand = iBand + 1;
-
-            for (int iY = 0; iY < nYSize && eErr == CE_None; iY += nSwathLines)
+            for (int iX = 0; iX < nXSize; iX += nSwathCols)
             {
-                int nThisLines = nSwathLines;
-
-                if (iY + nThisLines > nYSize)
-                    nThisLines = nYSize - iY;
-
-                for (int iX = 0; iX < nXSize && eErr == CE_None;
-                     iX += nSwathCols)
-                {
-                    int nThisCols = nSwathCols;
-
-                    if (iX + nThisCols > nXSize)
-                        nThisCols = nXSize - iX;
-
-                    int nStatus = GDAL_DATA_COVERAGE_STATUS_DATA;
-                    if (bCheckHoles)
-                    {
-                        nStatus = poSrcDS->GetRasterBand(nBand)
-                                      ->GetDataCoverageStatus(
-                                          iX, iY, nThisCols, nThisLines,
-                                          GDAL_DATA_COVERAGE_STATUS_DATA);
-                    }
-                    if (nStatus & GDAL_DATA_COVERAGE_STATUS_DATA)
-                    {
-                        sExtraArg.pfnProgress = GDALScaledProgress;
-                        sExtraArg.pProgressData = GDALCreateScaledProgress(
-                            nBlocksDone / static_cast<double>(nTotalBlocks),
-                            (nBlocksDone + 0.5) /
-                                static_cast<double>(nTotalBlocks),
-                            pfnProgress, pProgressData);
-                        if (sExtraArg.pProgressData == nullptr)
-                            sExtraArg.pfnProgress = nullptr;
-
-                        eErr = poSrcDS->RasterIO(GF_Read, iX, iY, nThisCols,
-                                                 nThisLines, pSwathBuf,
-                                                 nThisCols, nThisLines, eDT, 1,
-                                                 &nBand, 0, 0, 0, &sExtraArg);
-
-                        GDALDestroyScaledProgress(sExtraArg.pProgressData);
-
-                        if (eErr == CE_None)
-                            eErr = poDstDS->RasterIO(
-                                GF_Write, iX, iY, nThisCols, nThisLines,
-                                pSwathBuf, nThisCols, nThisLines, eDT, 1,
-                                &nBand, 0, 0, 0, nullptr);
-                    }
-
-                    nBlocksDone++;
-                    if (eErr == CE_None &&
-                        !pfnProgress(nBlocksDone /
-                                         static_cast<double>(nTotalBlocks),
-                                     nullptr, pProgressData))
-                    {
-                        eErr = CE_Failure;
-                        CPLError(CE_Failure, CPLE_UserInterrupt,
-                                 "User terminated CreateCopy()");
-                    }
-                }
+                GDALCopyWholeRasterChunk sChunk;
+                sChunk.nBand = bInterleave ? 0 : iBand + 1;
+                sChunk.iX = iX;
+                sChunk.iY = iY;
+                sChunk.nCols = std::min(nSwathCols, nXSize - iX);
+                sChunk.nLines = std::min(nSwathLines, nYSize - iY);
+                asChunks.push_back(sChunk);
             }
         }
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Overlap reading of the next chunk with writing of the current   */
+    /*      one, if there are several chunks and memory for a second swath. */
+    /* -------------------------------------------------------------------- */
+    void *apBuffers[2] = {pSwathBuf, nullptr};
+    if (asChunks.size() > 1 &&
+        CPLTestBool(
+            CPLGetConfigOption("GDAL_COPY_WHOLE_RASTER_PREFETCH", "YES")))
+    {
+        apBuffers[1] = VSIMalloc3(nSwathCols, nSwathLines, nPixelSize);
+    }
+    if (apBuffers[1] &&
+        GDALCopyWholeRasterWithPrefetch(poSrcDS, poDstDS, nBandCount, eDT,
+                                        bCheckHoles, asChunks, apBuffers,
+                                        pfnProgress, pProgressData, eErr))
+    {
+        VSIFree(apBuffers[1]);
+        CPLFree(pSwathBuf);
+        return eErr;
+    }
+    VSIFree(apBuffers[1]);
+
     /* ==================================================================== */
-    /*      Pixel interleaved case.                                         */
+    /*      Sequential case.                                                */
     /* ==================================================================== */
-    else /* if( bInterleave ) */
+    const double dfTotalChunks = static_cast<double>(asChunks.size());
+    for (size_t i = 0; i < asChunks.size() && eErr == CE_None; ++i)
     {
-        GDALRasterIOExtraArg sExtraArg;
-        INIT_RASTERIO_EXTRA_ARG(sExtraArg);
-        CPL_IGNORE_RET_VAL(sExtraArg.pfnProgress);  // to make cppcheck happy
-
-        const GIntBig nTotalBlocks =
-            static_cast<GIntBig>(DIV_ROUND_UP(nYSize, nSwathLines)) *
-            DIV_ROUND_UP(nXSize, nSwathCols);
-        GIntBig nBlocksDone = 0;
-
-        for (int iY = 0; iY < nYSize && eErr == CE_None; iY += nSwathLines)
+        const auto &sChunk = asChunks[i];
+        if (GDALCopyWholeRasterChunkHasData(poSrcDS, nBandCount, bCheckHoles,
+                                            sChunk))
         {
-            int nThisLines = nSwathLines;
+            void *pScaledProgress = GDALCreateScaledProgress(
+                i / dfTotalChunks, (i + 0.5) / dfTotalChunks, pfnProgress,
+                pProgressData);
 
-            if (iY + nThisLines > nYSize)
-                nThisLines = nYSize - iY;
+            eErr = GDALCopyWholeRasterChunkIO(
+                GF_Read, poSrcDS, nBandCount, eDT, sChunk, pSwathBuf,
+                pScaledProgress ? GDALScaledProgress : nullptr,
+                pScaledProgress);
 
-            for (int iX = 0; iX < nXSize && eErr == CE_None; iX += nSwathCols)
-            {
-                int nThisCols = nSwathCols;
+            GDALDestroyScaledProgress(pScaledProgress);
 
-                if (iX + nThisCols > nXSize)
-                    nThisCols = nXSize - iX;
-
-                int nStatus = GDAL_DATA_COVERAGE_STATUS_DATA;
-                if (bCheckHoles)
-                {
-                    for (int iBand = 0; iBand < nBandCount; iBand++)
-                    {
-                        nStatus |= poSrcDS->GetRasterBand(iBand + 1)
-                                       ->GetDataCoverageStatus(
-                                           iX, iY, nThisCols, nThisLines,
-                                           GDAL_DATA_COVERAGE_STATUS_DATA);
-                        if (nStatus & GDAL_DATA_COVERAGE_STATUS_DATA)
-                            break;
-                    }
-                }
-                if (nStatus & GDAL_DATA_COVERAGE_STATUS_DATA)
-                {
-                    sExtraArg.pfnProgress = GDALScaledProgress;
-                    sExtraArg.pProgressData = GDALCreateScaledProgress(
-                        nBlocksDone / static_cast<double>(nTotalBlocks),
-                        (nBlocksDone + 0.5) / static_cast<double>(nTotalBlocks),
-                        pfnProgress, pProgressData);
-                    if (sExtraArg.pProgressData == nullptr)
-                        sExtraArg.pfnProgress = nullptr;
-
-                    eErr = poSrcDS->RasterIO(GF_Read, iX, iY, nThisCols,
-                                             nThisLines, pSwathBuf, nThisCols,
-                                             nThisLines, eDT, nBandCount,
-                                             nullptr, 0, 0, 0, &sExtraArg);
-
-                    GDALDestroyScaledProgress(sExtraArg.pProgressData);
-
-                    if (eErr == CE_None)
-                        eErr = poDstDS->RasterIO(
-                            GF_Write, iX, iY, nThisCols, nThisLines, pSwathBuf,
-                            nThisCols, nThisLines, eDT, nBandCount, nullptr, 0,
-                            0, 0, nullptr);
-                }
+            if (eErr == CE_None)
+                eErr = GDALCopyWholeRasterChunkIO(GF_Write, poDstDS,
+                                                  nBandCount, eDT, sChunk,
+                                                  pSwathBuf, nullptr, nullptr);
+        }
 
-                nBlocksDone++;
-                if (eErr == CE_None &&
-                    !pfnProgress(nBlocksDone /
-                                     static_cast<double>(nTotalBlocks),
-                                 nullptr, pProgressData))
-                {
-                    eErr = CE_Failure;
-                    CPLError(CE_Failure, CPLE_UserInterrupt,
-                             "User terminated CreateCopy()");
-                }
-            }
+        if (eErr == CE_None &&
+            !pfnProgress((i + 1) / dfTotalChunks, nullptr, pProgressData))
+        {
+            eErr = CE_Failure;
+            CPLError(CE_Failure, CPLE_UserInterrupt,
+                     "User terminated CreateCopy()");
         }
     }
 
@@ -5520,7 +5813,8 @@ static void GDALDeinterleave4Byte(const GByte *CPL_RESTRICT pabySrc,
     \endverbatim
 
     The implementation is optimized for a few cases, like de-interleaving
-    of 3 or 4-components Byte buffers.
+    of 3 or 4-components Byte buffers. Other cases are processed by chunks
+    of pixels, to remain cache friendly with a large number of components.
 
     \since GDAL 3.6
  */
@@ -5610,11 +5904,188 @@ void GDALDeinterleave(const void *pSourceBuffer, GDALDataType eSourceDT,
 
     const int nSourceDTSize = GDALGetDataTypeSizeBytes(eSourceDT);
     const int nDestDTSize = GDALGetDataTypeSizeBytes(eDestDT);
-    for (int iComp = 0; iComp < nComponents; iComp++)
+
+    // Process the pixels by chunks, so that the part of the source buffer
+    // being de-interleaved remains in the CPU cache while it is scattered to
+    // each destination buffer. Otherwise, with a large number of components,
+    // each component pass reloads the whole source buffer from memory.
+    constexpr size_t CHUNK_SIZE_BYTES = 32 * 1024;
+    const size_t nSrcPixelSize =
+        static_cast<size_t>(nComponents) * nSourceDTSize;
+    const size_t nChunkIters = std::max<size_t>(
+        1, CHUNK_SIZE_BYTES / std::max<size_t>(1, nSrcPixelSize));
+    for (size_t iStart = 0; iStart < nIters; iStart += nChunkIters)
+    {
+        const size_t nChunkCount = std::min(nChunkIters, nIters - iStart);
+        const GByte *pabySrc =
+            static_cast<const GByte *>(pSourceBuffer) + iStart * nSrcPixelSize;
+        for (int iComp = 0; iComp < nComponents; iComp++)
+        {
+            GDALCopyWords64(pabySrc + iComp * nSourceDTSize, eSourceDT,
+                            nComponents * nSourceDTSize,
+                            static_cast<GByte *>(ppDestBuffer[iComp]) +
+                                iStart * nDestDTSize,
+                            eDestDT, nDestDTSize,
+                            static_cast<GPtrDiff_t>(nChunkCount));
+        }
+    }
+}
+
+/************************************************************************/
+/*                      GDALInterleave4Byte()                           */
+/************************************************************************/
+
+static void GDALInterleave4Byte(const GByte *CPL_RESTRICT pabySrc0,
+                                const GByte *CPL_RESTRICT pabySrc1,
+                                const GByte *CPL_RESTRICT pabySrc2,
+                                const GByte *CPL_RESTRICT pabySrc3,
+                                GByte *CPL_RESTRICT pabyDest, size_t nIters)
+{
+    size_t i = 0;
+#if defined(__x86_64) || defined(_M_X64)
+    for (; i + 15 < nIters; i += 16)
     {
-        GDALCopyWords64(static_cast<const GByte *>(pSourceBuffer) +
-                            iComp * nSourceDTSize,
-                        eSourceDT, nComponents * nSourceDTSize,
-                        ppDestBuffer[iComp], eDestDT, nDestDTSize, nIters);
+        const __m128i xmm0 =
+            _mm_loadu_si128(reinterpret_cast<__m128i const *>(pabySrc0 + i));
+        const __m128i xmm1 =
+            _mm_loadu_si128(reinterpret_cast<__m128i const *>(pabySrc1 + i));
+        const __m128i xmm2 =
+            _mm_loadu_si128(reinterpret_cast<__m128i const *>(pabySrc2 + i));
+        const __m128i xmm3 =
+            _mm_loadu_si128(reinterpret_cast<__m128i const *>(pabySrc3 + i));
+        // c0[0] c1[0] c0[1] c1[1] ... c0[7] c1[7]
+        const __m128i xmm01_lo = _mm_unpacklo_epi8(xmm0, xmm1);
+        const __m128i xmm01_hi = _mm_unpackhi_epi8(xmm0, xmm1);
+        const __m128i xmm23_lo = _mm_unpacklo_epi8(xmm2, xmm3);
+        const __m128i xmm23_hi = _mm_unpackhi_epi8(xmm2, xmm3);
+        // c0[0] c1[0] c2[0] c3[0] ... c0[3] c1[3] c2[3] c3[3]
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(pabyDest + 4 * i + 0),
+                         _mm_unpacklo_epi16(xmm01_lo, xmm23_lo));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(pabyDest + 4 * i + 16),
+                         _mm_unpackhi_epi16(xmm01_lo, xmm23_lo));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(pabyDest + 4 * i + 32),
+                         _mm_unpacklo_epi16(xmm01_hi, xmm23_hi));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(pabyDest + 4 * i + 48),
+                         _mm_unpackhi_epi16(xmm01_hi, xmm23_hi));
+    }
+#endif
+    for (; i < nIters; ++i)
+    {
+        pabyDest[4 * i + 0] = pabySrc0[i];
+        pabyDest[4 * i + 1] = pabySrc1[i];
+        pabyDest[4 * i + 2] = pabySrc2[i];
+        pabyDest[4 * i + 3] = pabySrc3[i];
+    }
+}
+
+/************************************************************************/
+/*                      GDALInterleave3Byte()                           */
+/************************************************************************/
+
+static void GDALInterleave3Byte(const GByte *CPL_RESTRICT pabySrc0,
+                                const GByte *CPL_RESTRICT pabySrc1,
+                                const GByte *CPL_RESTRICT pabySrc2,
+                                GByte *CPL_RESTRICT pabyDest, size_t nIters)
+{
+    size_t i = 0;
+    // Assemble 4 pixels into 3 32-bit words, which is faster than 12 byte
+    // stores, at least when the compiler doesn't vectorize any of them.
+    for (; i + 3 < nIters; i += 4)
+    {
+        unsigned int word0 =
+            pabySrc0[i] | (pabySrc1[i] << 8) | (pabySrc2[i] << 16) |
+            (static_cast<unsigned int>(pabySrc0[i + 1]) << 24);
+        unsigned int word1 =
+            pabySrc1[i + 1] | (pabySrc2[i + 1] << 8) |
+            (pabySrc0[i + 2] << 16) |
+            (static_cast<unsigned int>(pabySrc1[i + 2]) << 24);
+        unsigned int word2 =
+            pabySrc2[i + 2] | (pabySrc0[i + 3] << 8) |
+            (pabySrc1[i + 3] << 16) |
+            (static_cast<unsigned int>(pabySrc2[i + 3]) << 24);
+        CPL_LSBPTR32(&word0);
+        CPL_LSBPTR32(&word1);
+        CPL_LSBPTR32(&word2);
+        memcpy(pabyDest + 3 * i, &word0, sizeof(word0));
+        memcpy(pabyDest + 3 * i + 4, &word1, sizeof(word1));
+        memcpy(pabyDest + 3 * i + 8, &word2, sizeof(word2));
+    }
+    for (; i < nIters; ++i)
+    {
+        pabyDest[3 * i + 0] = pabySrc0[i];
+        pabyDest[3 * i + 1] = pabySrc1[i];
+        pabyDest[3 * i + 2] = pabySrc2[i];
+    }
+}
+
+/************************************************************************/
+/*                       GDALInterleave()                               */
+/************************************************************************/
+
+/*! Copy values from multiple per-component buffers to a pixel-interleave
+    buffer. This is the reverse operation of GDALDeinterleave().
+
+    In pseudo-code
+    \verbatim
+    for(size_t i = 0; i < nIters; ++i)
+        for(int iComp = 0; iComp < nComponents; iComp++ )
+            pDestBuffer[nComponents * i + iComp] = ppSourceBuffer[iComp][i]
+    \endverbatim
+
+    The implementation is optimized for interleaving of 3 or 4-components Byte
+    buffers. Other cases are processed by chunks of pixels, to remain cache
+    friendly with a large number of components.
+
+    \since GDAL 3.10
+ */
+void GDALInterleave(const void *const *ppSourceBuffer, GDALDataType eSourceDT,
+                    int nComponents, void *pDestBuffer, GDALDataType eDestDT,
+                    size_t nIters)
+{
+    if (eSourceDT == eDestDT && eSourceDT == GDT_Byte)
+    {
+        if (nComponents == 3)
+        {
+            GDALInterleave3Byte(static_cast<const GByte *>(ppSourceBuffer[0]),
+                                static_cast<const GByte *>(ppSourceBuffer[1]),
+                                static_cast<const GByte *>(ppSourceBuffer[2]),
+                                static_cast<GByte *>(pDestBuffer), nIters);
+            return;
+        }
+        else if (nComponents == 4)
+        {
+            GDALInterleave4Byte(static_cast<const GByte *>(ppSourceBuffer[0]),
+                                static_cast<const GByte *>(ppSourceBuffer[1]),
+                                static_cast<const GByte *>(ppSourceBuffer[2]),
+                                static_cast<const GByte *>(ppSourceBuffer[3]),
+                                static_cast<GByte *>(pDestBuffer), nIters);
+            return;
+        }
+    }
+
+    const int nSourceDTSize = GDALGetDataTypeSizeBytes(eSourceDT);
+    const int nDestDTSize = GDALGetDataTypeSizeBytes(eDestDT);
+
+    // Process the pixels by chunks, so that the part of the destination
+    // buffer being built remains in the CPU cache while each source buffer
+    // is gathered into it.
+    constexpr size_t CHUNK_SIZE_BYTES = 32 * 1024;
+    const size_t nDstPixelSize = static_cast<size_t>(nComponents) * nDestDTSize;
+    const size_t nChunkIters = std::max<size_t>(
+        1, CHUNK_SIZE_BYTES / std::max<size_t>(1, nDstPixelSize));
+    for (size_t iStart = 0; iStart < nIters; iStart += nChunkIters)
+    {
+        const size_t nChunkCount = std::min(nChunkIters, nIters - iStart);
+        GByte *pabyDest =
+            static_cast<GByte *>(pDestBuffer) + iStart * nDstPixelSize;
+        for (int iComp = 0; iComp < nComponents; iComp++)
+        {
+            GDALCopyWords64(static_cast<const GByte *>(ppSourceBuffer[iComp]) +
+                                iStart * nSourceDTSize,
+                            eSourceDT, nSourceDTSize,
+                            pabyDest + iComp * nDestDTSize, eDestDT,
+                            nComponents * nDestDTSize,
+                            static_cast<GPtrDiff_t>(nChunkCount));
+        }
     }
 }
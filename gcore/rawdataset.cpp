@@ -1148,12 +1148,8 @@ CPLErr RawRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
             const size_t nBytesToRW =
                 static_cast<size_t>(nPixelOffset) * (nXSize - 1) +
                 GDALGetDataTypeSizeBytes(eDataType);
-            GByte *pabyData =
-                static_cast<GByte *>(VSI_MALLOC_VERBOSE(nBytesToRW));
-            if (pabyData == nullptr)
-                return CE_Failure;
 
-            for (int iLine = 0; iLine < nBufYSize; iLine++)
+            const auto GetLineOffset = [&](int iLine)
             {
                 const vsi_l_offset nLine =
                     static_cast<vsi_l_offset>(nYOff) +
@@ -1167,7 +1163,69 @@ CPLErr RawRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                     nOffset += nXOff * static_cast<vsi_l_offset>(nPixelOffset);
                 else
                     nOffset -= nXOff * static_cast<vsi_l_offset>(-nPixelOffset);
-                AccessBlock(nOffset, nBytesToRW, pabyData, nXSize);
+                return nOffset;
+            };
+
+            // On network file systems, read the strided lines by batches
+            // with VSIFReadMultiRangeL(), which can fetch them in parallel,
+            // rather than with one request per line.
+            constexpr size_t MAX_BATCH_SIZE = 4 * 1024 * 1024;
+            const int nLinesPerBatch =
+                (nBufYSize > 1 && poDS != nullptr &&
+                 !VSIIsLocal(poDS->GetDescription()))
+                    ? static_cast<int>(std::max<size_t>(
+                          1, std::min<size_t>(nBufYSize,
+                                              MAX_BATCH_SIZE / nBytesToRW)))
+                    : 1;
+            GByte *pabyBatch = static_cast<GByte *>(
+                VSI_MALLOC2_VERBOSE(nBytesToRW, nLinesPerBatch));
+            if (pabyBatch == nullptr)
+                return CE_Failure;
+            std::vector<void *> apLines(nLinesPerBatch);
+            std::vector<vsi_l_offset> anOffsets(nLinesPerBatch);
+            std::vector<size_t> anSizes(nLinesPerBatch, nBytesToRW);
+            GByte *pabyData = pabyBatch;
+
+            for (int iLine = 0; iLine < nBufYSize; iLine++)
+            {
+                const int iLineInBatch = iLine % nLinesPerBatch;
+                pabyData = pabyBatch + iLineInBatch * nBytesToRW;
+                if (nLinesPerBatch == 1)
+                {
+                    AccessBlock(GetLineOffset(iLine), nBytesToRW, pabyData,
+                                nXSize);
+                }
+                else if (iLineInBatch == 0)
+                {
+                    const int nLines =
+                        std::min(nLinesPerBatch, nBufYSize - iLine);
+                    for (int i = 0; i < nLines; ++i)
+                    {
+                        apLines[i] = pabyBatch + i * nBytesToRW;
+                        anOffsets[i] = GetLineOffset(iLine + i);
+                    }
+                    if (VSIFReadMultiRangeL(nLines, apLines.data(),
+                                            anOffsets.data(), anSizes.data(),
+                                            fpRawL) == 0)
+                    {
+                        if (NeedsByteOrderChange())
+                        {
+                            for (int i = 0; i < nLines; ++i)
+                                DoByteSwap(apLines[i], nXSize,
+                                           std::abs(nPixelOffset), true);
+                        }
+                    }
+                    else
+                    {
+                        // Fallback to line per line reading, which deals
+                        // with sparse or truncated files.
+                        for (int i = 0; i < nLines; ++i)
+                        {
+                            AccessBlock(anOffsets[i], nBytesToRW, apLines[i],
+                                        nXSize);
+                        }
+                    }
+                }
                 // Copy data from disk buffer to user block buffer and
                 // subsample, if needed.
                 if (nXSize == nBufXSize && nYSize == nBufYSize)
@@ -1196,12 +1254,12 @@ CPLErr RawRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                     !psExtraArg->pfnProgress(1.0 * (iLine + 1) / nBufYSize, "",
                                              psExtraArg->pProgressData))
                 {
-                    CPLFree(pabyData);
+                    CPLFree(pabyBatch);
                     return CE_Failure;
                 }
             }
 
-            CPLFree(pabyData);
+            CPLFree(pabyBatch);
         }
     }
     // Write data.
@@ -1636,8 +1694,7 @@ CPLErr RawDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                 const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
                 if (poBand->bNeedFileFlush || poBand->bLoadedScanlineDirty ||
                     poBand->HasDirtyBlocks() ||
-                    panBandMap[iBandIndex] != iBandIndex + 1 ||
-                    nPixelSpace != poBand->nPixelOffset)
+                    panBandMap[iBandIndex] != iBandIndex + 1)
                 {
                     bCanDirectAccessToBIPDataset = false;
                 }
@@ -1646,10 +1703,17 @@ CPLErr RawDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                     if (poFirstBand == nullptr)
                     {
                         poFirstBand = poBand;
+                        // The output buffer must be either pixel-interleaved
+                        // like the file, or have each band contiguous
+                        // along lines, in which case lines are deinterleaved
+                        // after having been read.
                         bCanDirectAccessToBIPDataset =
-                            eDT == eBufType && nBandSpace == nDTSize &&
+                            eDT == eBufType &&
                             poFirstBand->nPixelOffset ==
-                                cpl::fits_on<int>(nBands * nDTSize);
+                                cpl::fits_on<int>(nBands * nDTSize) &&
+                            ((nPixelSpace == poFirstBand->nPixelOffset &&
+                              nBandSpace == nDTSize) ||
+                             nPixelSpace == nDTSize);
                     }
                     else
                     {
@@ -1673,27 +1737,79 @@ CPLErr RawDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
             const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
             const bool bNeedsByteOrderChange =
                 poFirstBand->NeedsByteOrderChange();
-            for (int iY = 0; iY < nYSize; ++iY)
+            const bool bDeinterleave = nPixelSpace == nDTSize;
+            const size_t nLineBytes =
+                static_cast<size_t>(nXSize) * poFirstBand->nPixelOffset;
+
+            // Lines are read with VSIFReadMultiRangeL(), so that they can
+            // be fetched in parallel on network file systems. When
+            // deinterleaving, they go through a temporary buffer of a few
+            // MB, otherwise they are directly read into the output buffer.
+            constexpr size_t MAX_TMP_BUFFER_SIZE = 4 * 1024 * 1024;
+            const int nLinesPerBatch =
+                bDeinterleave
+                    ? static_cast<int>(std::max<size_t>(
+                          1, std::min<size_t>(nYSize, MAX_TMP_BUFFER_SIZE /
+                                                          nLineBytes)))
+                    : nYSize;
+            std::vector<GByte> abyTmp;
+            std::vector<void *> apDstLines(nLinesPerBatch);
+            std::vector<vsi_l_offset> anOffsets(nLinesPerBatch);
+            std::vector<size_t> anSizes(nLinesPerBatch, nLineBytes);
+            std::vector<void *> apDstBands(nBands);
+            try
             {
-                GByte *pabyOut = static_cast<GByte *>(pData) + iY * nLineSpace;
-                VSIFSeekL(poFirstBand->fpRawL,
-                          poFirstBand->nImgOffset +
-                              static_cast<vsi_l_offset>(nYOff + iY) *
-                                  poFirstBand->nLineOffset +
-                              static_cast<vsi_l_offset>(nXOff) *
-                                  poFirstBand->nPixelOffset,
-                          SEEK_SET);
-                if (VSIFReadL(pabyOut,
-                              static_cast<size_t>(nXSize * nPixelSpace), 1,
-                              poFirstBand->fpRawL) != 1)
+                if (bDeinterleave)
+                    abyTmp.resize(nLineBytes * nLinesPerBatch);
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Out of memory allocating temporary buffer");
+                return CE_Failure;
+            }
+
+            for (int iY0 = 0; iY0 < nYSize; iY0 += nLinesPerBatch)
+            {
+                const int nLines = std::min(nLinesPerBatch, nYSize - iY0);
+                for (int i = 0; i < nLines; ++i)
+                {
+                    const int iY = iY0 + i;
+                    apDstLines[i] =
+                        bDeinterleave
+                            ? static_cast<void *>(abyTmp.data() +
+                                                  i * nLineBytes)
+                            : static_cast<GByte *>(pData) + iY * nLineSpace;
+                    anOffsets[i] = poFirstBand->nImgOffset +
+                                   static_cast<vsi_l_offset>(nYOff + iY) *
+                                       poFirstBand->nLineOffset +
+                                   static_cast<vsi_l_offset>(nXOff) *
+                                       poFirstBand->nPixelOffset;
+                }
+                if (VSIFReadMultiRangeL(nLines, apDstLines.data(),
+                                        anOffsets.data(), anSizes.data(),
+                                        poFirstBand->fpRawL) != 0)
                 {
                     return CE_Failure;
                 }
-                if (bNeedsByteOrderChange)
+                for (int i = 0; i < nLines; ++i)
                 {
-                    poFirstBand->DoByteSwap(
-                        pabyOut, static_cast<size_t>(nXSize) * nBands, nDTSize,
-                        true);
+                    if (bNeedsByteOrderChange)
+                    {
+                        poFirstBand->DoByteSwap(
+                            apDstLines[i],
+                            static_cast<size_t>(nXSize) * nBands, nDTSize,
+                            true);
+                    }
+                    if (bDeinterleave)
+                    {
+                        GByte *pabyOut = static_cast<GByte *>(pData) +
+                                         (iY0 + i) * nLineSpace;
+                        for (int iBand = 0; iBand < nBands; ++iBand)
+                            apDstBands[iBand] = pabyOut + iBand * nBandSpace;
+                        GDALDeinterleave(apDstLines[i], eDT, nBands,
+                                         apDstBands.data(), eDT, nXSize);
+                    }
                 }
             }
             return CE_None;
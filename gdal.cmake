@@ -24,6 +24,11 @@ option(GDAL_ENABLE_PLUGINS "Set ON to build drivers that have non-core external
 option(GDAL_ENABLE_PLUGINS_NO_DEPS "Set ON to build drivers that have no non-core external dependencies as plugin" OFF)
 mark_as_advanced(GDAL_ENABLE_PLUGINS_NO_DEPS)
 
+# This option is to register built-in drivers that have a "drivercore" part in a deferred way, like deferred loaded
+# plugins: GDALAllRegister() only declares their identification metadata, and their full registration happens when
+# they are first used.
+option(GDAL_ENABLE_DEFERRED_BUILTIN_DRIVERS "Set ON to defer the full registration of built-in drivers until first use" OFF)
+
 option(ENABLE_IPO "Enable Inter-Procedural Optimization if possible" OFF)
 if (${CMAKE_SYSTEM_NAME} MATCHES "Darwin")
   option(GDAL_ENABLE_MACOSX_FRAMEWORK "Enable Framework on Mac OS X" OFF)
@@ -31,8 +31,11 @@
 #include "gnmgraph.h"
 #include "gnm_priv.h"
 #include <algorithm>
+#include <cmath>
+#include <functional>
 #include <limits>
 #include <set>
+#include <tuple>
 
 //! @cond Doxygen_Suppress
 GNMGraph::GNMGraph()
@@ -51,11 +54,13 @@ void GNMGraph::AddVertex(GNMGFID nFID)
     GNMStdVertex stVertex;
     stVertex.bIsBlocked = false;
     m_mstVertices[nFID] = std::move(stVertex);
+    m_bFrozen = false;
 }
 
 void GNMGraph::DeleteVertex(GNMGFID nFID)
 {
     m_mstVertices.erase(nFID);
+    m_bFrozen = false;
 
     // remove all edges with this vertex
     std::vector<GNMGFID> aoIdsToErase;
@@ -103,6 +108,7 @@ void GNMGraph::AddEdge(GNMGFID nConFID, GNMGFID nSrcFID, GNMGFID nTgtFID,
     stEdge.bIsBlocked = false;
 
     m_mstEdges[nConFID] = stEdge;
+    m_bFrozen = false;
 
     if (bIsBidir)
     {
@@ -118,6 +124,7 @@ void GNMGraph::AddEdge(GNMGFID nConFID, GNMGFID nSrcFID, GNMGFID nTgtFID,
 void GNMGraph::DeleteEdge(GNMGFID nConFID)
 {
     m_mstEdges.erase(nConFID);
+    m_bFrozen = false;
 
     // remove edge from all vertices anOutEdgeFIDs
     for (auto &it : m_mstVertices)
@@ -136,11 +143,14 @@ void GNMGraph::ChangeEdge(GNMGFID nFID, double dfCost, double dfInvCost)
     {
         it->second.dfDirCost = dfCost;
         it->second.dfInvCost = dfInvCost;
+        m_bFrozenAttributesValid = false;
     }
 }
 
 void GNMGraph::ChangeBlockState(GNMGFID nFID, bool bBlock)
 {
+    m_bFrozenAttributesValid = false;
+
     // check vertices
     std::map<GNMGFID, GNMStdVertex>::iterator itv = m_mstVertices.find(nFID);
     if (itv != m_mstVertices.end())
@@ -168,6 +178,8 @@ bool GNMGraph::CheckVertexBlocked(GNMGFID nFID) const
 
 void GNMGraph::ChangeAllBlockState(bool bBlock)
 {
+    m_bFrozenAttributesValid = false;
+
     for (std::map<GNMGFID, GNMStdVertex>::iterator itv = m_mstVertices.begin();
          itv != m_mstVertices.end(); ++itv)
     {
@@ -185,58 +197,44 @@ GNMPATH
 GNMGraph::DijkstraShortestPath(GNMGFID nStartFID, GNMGFID nEndFID,
                                const std::map<GNMGFID, GNMStdEdge> &mstEdges)
 {
-    std::map<GNMGFID, GNMGFID> mnShortestTree;
-    DijkstraShortestPathTree(nStartFID, mstEdges, mnShortestTree);
-
-    // We search for a path in the resulting tree, starting from end point to
-    // start point.
-
     GNMPATH aoShortestPath;
-    GNMGFID nNextVertexId = nEndFID;
-    std::map<GNMGFID, GNMGFID>::iterator it;
-    EDGEVERTEXPAIR buf;
-
-    while (true)
+    if (nStartFID == nEndFID)
     {
-        it = mnShortestTree.find(nNextVertexId);
+        aoShortestPath.push_back(std::make_pair(nStartFID, -1));
+        return aoShortestPath;
+    }
 
-        if (it == mnShortestTree.end())
-        {
-            // We haven't found the start vertex - there is no path between
-            // to given vertices in a shortest-path tree.
-            break;
-        }
-        else if (it->first == nStartFID)
-        {
-            // We've reached the start vertex and return an array.
-            aoShortestPath.push_back(std::make_pair(nNextVertexId, -1));
+    FreezeGraph();
+    const int iStart = GetFrozenVertexIndex(nStartFID);
+    const int iEnd = GetFrozenVertexIndex(nEndFID);
+    if (iStart < 0 || iEnd < 0)
+        return aoShortestPath;
+
+    std::vector<double> adfTmpCosts;
+    std::vector<double> adfMarks;
+    std::vector<int> anPredEdge;
+    std::vector<int> anPredVertex;
+    FrozenDijkstra(iStart, iEnd, GetFrozenEdgeCostsFor(mstEdges, adfTmpCosts),
+                   adfMarks, anPredEdge, anPredVertex);
+    if (!(adfMarks[iEnd] < std::numeric_limits<double>::infinity()))
+    {
+        // There is no path between the two given vertices.
+        return aoShortestPath;
+    }
 
-            // Revert array because the first vertex is now the last in path.
-            int size = static_cast<int>(aoShortestPath.size());
-            for (int i = 0; i < size / 2; ++i)
-            {
-                buf = aoShortestPath[i];
-                aoShortestPath[i] = aoShortestPath[size - i - 1];
-                aoShortestPath[size - i - 1] = buf;
-            }
-            return aoShortestPath;
-        }
-        else
-        {
-            // There is only one edge which leads to this vertex, because we
-            // analyse a tree. We add this edge with its target vertex into
-            // final array.
-            aoShortestPath.push_back(std::make_pair(nNextVertexId, it->second));
-
-            // An edge has only two vertices, so we get the opposite one to the
-            // current vertex in order to continue search backwards.
-            nNextVertexId = GetOppositVertex(it->second, it->first);
-        }
+    // We go backwards from the end point to the start point by the
+    // predecessors in the shortest-path tree.
+    for (int iVertex = iEnd; iVertex != iStart; iVertex = anPredVertex[iVertex])
+    {
+        aoShortestPath.push_back(
+            std::make_pair(m_anFrozenVertexFIDs[iVertex],
+                           m_anFrozenEdgeFIDs[anPredEdge[iVertex]]));
     }
+    aoShortestPath.push_back(std::make_pair(nStartFID, -1));
 
-    // return empty array
-    GNMPATH oRet;
-    return oRet;
+    // Revert array because the first vertex is now the last in path.
+    std::reverse(aoShortestPath.begin(), aoShortestPath.end());
+    return aoShortestPath;
 }
 
 GNMPATH GNMGraph::DijkstraShortestPath(GNMGFID nStartFID, GNMGFID nEndFID)
@@ -452,89 +450,201 @@ void GNMGraph::Clear()
 {
     m_mstVertices.clear();
     m_mstEdges.clear();
+    m_bFrozen = false;
 }
 
 void GNMGraph::DijkstraShortestPathTree(
     GNMGFID nFID, const std::map<GNMGFID, GNMStdEdge> &mstEdges,
     std::map<GNMGFID, GNMGFID> &mnPathTree)
 {
-    // Initialize all vertices in graph with infinity mark.
-    double dfInfinity = std::numeric_limits<double>::infinity();
+    mnPathTree[nFID] = -1;
+
+    FreezeGraph();
+    const int iStart = GetFrozenVertexIndex(nFID);
+    if (iStart < 0)
+        return;
+
+    std::vector<double> adfTmpCosts;
+    std::vector<double> adfMarks;
+    std::vector<int> anPredEdge;
+    std::vector<int> anPredVertex;
+    FrozenDijkstra(iStart, -1, GetFrozenEdgeCostsFor(mstEdges, adfTmpCosts),
+                   adfMarks, anPredEdge, anPredVertex);
 
-    std::map<GNMGFID, double> mMarks;
-    std::map<GNMGFID, GNMStdVertex>::iterator itv;
-    for (itv = m_mstVertices.begin(); itv != m_mstVertices.end(); ++itv)
+    const double dfInfinity = std::numeric_limits<double>::infinity();
+    for (size_t i = 0; i < adfMarks.size(); ++i)
     {
-        mMarks[itv->first] = dfInfinity;
+        if (static_cast<int>(i) != iStart && adfMarks[i] < dfInfinity)
+        {
+            mnPathTree[m_anFrozenVertexFIDs[i]] =
+                m_anFrozenEdgeFIDs[anPredEdge[i]];
+        }
     }
+}
 
-    mMarks[nFID] = 0.0;
-    mnPathTree[nFID] = -1;
-
-    // Initialize all vertices as unseen (there are no seen vertices).
-    std::set<GNMGFID> snSeen;
+void GNMGraph::FreezeGraph()
+{
+    if (!m_bFrozen)
+    {
+        // Vertices and edges get dense indices, following the order of their
+        // identifiers, and the outgoing edges of all vertices are stored in
+        // the same array, so that traversals do not need any map lookup.
+        m_anFrozenVertexFIDs.clear();
+        m_anFrozenVertexFIDs.reserve(m_mstVertices.size());
+        for (const auto &oIter : m_mstVertices)
+            m_anFrozenVertexFIDs.push_back(oIter.first);
+
+        m_anFrozenEdgeFIDs.clear();
+        m_anFrozenEdgeFIDs.reserve(m_mstEdges.size());
+        for (const auto &oIter : m_mstEdges)
+            m_anFrozenEdgeFIDs.push_back(oIter.first);
+
+        m_anFrozenOffsets.clear();
+        m_anFrozenOffsets.reserve(m_mstVertices.size() + 1);
+        m_anFrozenOffsets.push_back(0);
+        m_anFrozenTargets.clear();
+        m_anFrozenEdges.clear();
+        for (const auto &oIter : m_mstVertices)
+        {
+            for (const GNMGFID nEdgeFID : oIter.second.anOutEdgeFIDs)
+            {
+                const auto oIterEdge = std::lower_bound(
+                    m_anFrozenEdgeFIDs.begin(), m_anFrozenEdgeFIDs.end(),
+                    nEdgeFID);
+                if (oIterEdge == m_anFrozenEdgeFIDs.end() ||
+                    *oIterEdge != nEdgeFID)
+                    continue;
+                const GNMStdEdge &stEdge = m_mstEdges[nEdgeFID];
+                const GNMGFID nTargetFID =
+                    oIter.first == stEdge.nSrcVertexFID ? stEdge.nTgtVertexFID
+                    : oIter.first == stEdge.nTgtVertexFID
+                        ? stEdge.nSrcVertexFID
+                        : -1;
+                const int iTarget = GetFrozenVertexIndex(nTargetFID);
+                if (iTarget < 0)
+                    continue;
+                m_anFrozenTargets.push_back(iTarget);
+                m_anFrozenEdges.push_back(static_cast<int>(
+                    oIterEdge - m_anFrozenEdgeFIDs.begin()));
+            }
+            m_anFrozenOffsets.push_back(m_anFrozenTargets.size());
+        }
+        m_bFrozen = true;
+        m_bFrozenAttributesValid = false;
+    }
 
-    // We use multimap to maintain the ascending order of costs and because
-    // there can be different vertices with the equal cost.
-    std::multimap<double, GNMGFID> to_see;
-    std::multimap<double, GNMGFID>::iterator it;
-    to_see.insert(std::pair<double, GNMGFID>(0.0, nFID));
-    LPGNMCONSTVECTOR panOutcomeEdgeId;
+    if (!m_bFrozenAttributesValid)
+    {
+        GetFrozenEdgeCosts(m_mstEdges, m_adfFrozenEdgeCosts);
+        m_abFrozenVertexBlocked.clear();
+        m_abFrozenVertexBlocked.reserve(m_mstVertices.size());
+        for (const auto &oIter : m_mstVertices)
+            m_abFrozenVertexBlocked.push_back(oIter.second.bIsBlocked);
+        m_bFrozenAttributesValid = true;
+    }
+}
 
-    size_t i;
-    GNMGFID nCurrentVertId, nCurrentEdgeId, nTargetVertId;
-    double dfCurrentEdgeCost, dfCurrentVertMark, dfNewVertexMark;
-    std::map<GNMGFID, GNMStdEdge>::const_iterator ite;
+int GNMGraph::GetFrozenVertexIndex(GNMGFID nFID) const
+{
+    const auto oIter = std::lower_bound(m_anFrozenVertexFIDs.begin(),
+                                        m_anFrozenVertexFIDs.end(), nFID);
+    if (oIter == m_anFrozenVertexFIDs.end() || *oIter != nFID)
+        return -1;
+    return static_cast<int>(oIter - m_anFrozenVertexFIDs.begin());
+}
 
-    // Continue iterations while there are some vertices to see.
-    while (!to_see.empty())
+void GNMGraph::GetFrozenEdgeCosts(
+    const std::map<GNMGFID, GNMStdEdge> &mstEdges,
+    std::vector<double> &adfCosts) const
+{
+    // Both the map and the frozen edges are sorted by identifier, so this
+    // is a linear merge. Blocked or missing edges get a NaN cost.
+    adfCosts.resize(m_anFrozenEdgeFIDs.size());
+    auto oIter = mstEdges.begin();
+    for (size_t i = 0; i < m_anFrozenEdgeFIDs.size(); ++i)
     {
-        // We must see vertices with minimal costs at first.
-        // In multimap the first cost is the minimal.
-        it = to_see.begin();
+        const GNMGFID nFID = m_anFrozenEdgeFIDs[i];
+        while (oIter != mstEdges.end() && oIter->first < nFID)
+            ++oIter;
+        if (oIter != mstEdges.end() && oIter->first == nFID &&
+            !oIter->second.bIsBlocked)
+            adfCosts[i] = oIter->second.dfDirCost;
+        else
+            adfCosts[i] = std::numeric_limits<double>::quiet_NaN();
+    }
+}
 
-        nCurrentVertId = it->second;
-        dfCurrentVertMark = it->first;
-        snSeen.insert(it->second);
-        to_see.erase(it);
+const std::vector<double> &
+GNMGraph::GetFrozenEdgeCostsFor(const std::map<GNMGFID, GNMStdEdge> &mstEdges,
+                                std::vector<double> &adfTmpCosts) const
+{
+    if (&mstEdges == &m_mstEdges)
+        return m_adfFrozenEdgeCosts;
+    GetFrozenEdgeCosts(mstEdges, adfTmpCosts);
+    return adfTmpCosts;
+}
 
-        // For all neighbours for the current vertex.
-        panOutcomeEdgeId = GetOutEdges(nCurrentVertId);
-        if (nullptr == panOutcomeEdgeId)
+void GNMGraph::FrozenDijkstra(int iStart, int iEnd,
+                              const std::vector<double> &adfCosts,
+                              std::vector<double> &adfMarks,
+                              std::vector<int> &anPredEdge,
+                              std::vector<int> &anPredVertex) const
+{
+    // Initialize all vertices in graph with infinity mark.
+    const size_t nVertices = m_anFrozenVertexFIDs.size();
+    adfMarks.assign(nVertices, std::numeric_limits<double>::infinity());
+    anPredEdge.assign(nVertices, -1);
+    anPredVertex.assign(nVertices, -1);
+    std::vector<bool> abSeen(nVertices, false);
+
+    // Binary heap of (cost, insertion order, vertex). The insertion order
+    // makes vertices with equal costs be seen first in, first out.
+    typedef std::tuple<double, size_t, int> QueueItem;
+    std::priority_queue<QueueItem, std::vector<QueueItem>,
+                        std::greater<QueueItem>>
+        oQueue;
+    size_t nInsertionCounter = 0;
+
+    adfMarks[iStart] = 0.0;
+    oQueue.emplace(0.0, nInsertionCounter++, iStart);
+
+    // Continue iterations while there are some vertices to see.
+    while (!oQueue.empty())
+    {
+        const double dfCurrentVertMark = std::get<0>(oQueue.top());
+        const int iCurrentVert = std::get<2>(oQueue.top());
+        oQueue.pop();
+        if (abSeen[iCurrentVert])
             continue;
+        abSeen[iCurrentVert] = true;
+        if (iCurrentVert == iEnd)
+            break;
 
-        for (i = 0; i < panOutcomeEdgeId->size(); ++i)
+        // For all neighbours for the current vertex.
+        for (size_t iSlot = m_anFrozenOffsets[iCurrentVert];
+             iSlot < m_anFrozenOffsets[iCurrentVert + 1]; ++iSlot)
         {
-            nCurrentEdgeId = panOutcomeEdgeId->operator[](i);
-
-            ite = mstEdges.find(nCurrentEdgeId);
-            if (ite == mstEdges.end() || ite->second.bIsBlocked)
-                continue;
-
             // We go in any edge from source to target so we take only
             // direct cost (even if an edge is bi-directed).
-            dfCurrentEdgeCost = ite->second.dfDirCost;
-
-            // While we see outcome edges of current vertex id we definitely
-            // know that target vertex id will be target for current edge id.
-            nTargetVertId = GetOppositVertex(nCurrentEdgeId, nCurrentVertId);
+            const int iEdge = m_anFrozenEdges[iSlot];
+            const double dfCurrentEdgeCost = adfCosts[iEdge];
+            if (std::isnan(dfCurrentEdgeCost))
+                continue;
 
-            // Calculate a new mark assuming the full path cost (mark of the
-            // current vertex) to this vertex.
-            dfNewVertexMark = dfCurrentVertMark + dfCurrentEdgeCost;
+            const int iTargetVert = m_anFrozenTargets[iSlot];
+            const double dfNewVertexMark =
+                dfCurrentVertMark + dfCurrentEdgeCost;
 
             // Update mark of the vertex if needed.
-            if (snSeen.find(nTargetVertId) == snSeen.end() &&
-                dfNewVertexMark < mMarks[nTargetVertId] &&
-                !CheckVertexBlocked(nTargetVertId))
+            if (!abSeen[iTargetVert] &&
+                dfNewVertexMark < adfMarks[iTargetVert] &&
+                !m_abFrozenVertexBlocked[iTargetVert])
             {
-                mMarks[nTargetVertId] = dfNewVertexMark;
-                mnPathTree[nTargetVertId] = nCurrentEdgeId;
-
-                // The vertex with minimal cost will be inserted to the
-                // beginning.
-                to_see.insert(
-                    std::pair<double, GNMGFID>(dfNewVertexMark, nTargetVertId));
+                adfMarks[iTargetVert] = dfNewVertexMark;
+                anPredEdge[iTargetVert] = iEdge;
+                anPredVertex[iTargetVert] = iCurrentVert;
+                oQueue.emplace(dfNewVertexMark, nInsertionCounter++,
+                               iTargetVert);
             }
         }
     }
@@ -247,9 +247,34 @@ class CPL_DLL GNMGraph
                               std::set<GNMGFID> &markedVertIds,
                               GNMPATH &connectedIds);
 
+    void FreezeGraph();
+    int GetFrozenVertexIndex(GNMGFID nFID) const;
+    void GetFrozenEdgeCosts(const std::map<GNMGFID, GNMStdEdge> &mstEdges,
+                            std::vector<double> &adfCosts) const;
+    const std::vector<double> &
+    GetFrozenEdgeCostsFor(const std::map<GNMGFID, GNMStdEdge> &mstEdges,
+                          std::vector<double> &adfTmpCosts) const;
+    void FrozenDijkstra(int iStart, int iEnd,
+                        const std::vector<double> &adfCosts,
+                        std::vector<double> &adfMarks,
+                        std::vector<int> &anPredEdge,
+                        std::vector<int> &anPredVertex) const;
+
   protected:
     std::map<GNMGFID, GNMStdVertex> m_mstVertices;
     std::map<GNMGFID, GNMStdEdge> m_mstEdges;
+
+    // Frozen compressed sparse row (CSR) representation of the graph, built
+    // on demand by the analysis methods and invalidated by modifications.
+    bool m_bFrozen = false;
+    bool m_bFrozenAttributesValid = false;
+    std::vector<GNMGFID> m_anFrozenVertexFIDs{};  // sorted
+    std::vector<GNMGFID> m_anFrozenEdgeFIDs{};    // sorted
+    std::vector<size_t> m_anFrozenOffsets{};  // first out slot of each vertex
+    std::vector<int> m_anFrozenTargets{};     // target vertex of each slot
+    std::vector<int> m_anFrozenEdges{};       // edge of each slot
+    std::vector<double> m_adfFrozenEdgeCosts{};  // NaN if blocked
+    std::vector<bool> m_abFrozenVertexBlocked{};
     //! @endcond
 };
 
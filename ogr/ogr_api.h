@@ -738,6 +738,7 @@ void CPL_DLL OGR_L_SetSpatialFilterRectEx(OGRLayerH, int iGeomField,
 OGRErr CPL_DLL OGR_L_SetAttributeFilter(OGRLayerH, const char *);
 void CPL_DLL OGR_L_ResetReading(OGRLayerH);
 OGRFeatureH CPL_DLL OGR_L_GetNextFeature(OGRLayerH) CPL_WARN_UNUSED_RESULT;
+int CPL_DLL OGR_L_GetNextFeatureInto(OGRLayerH, OGRFeatureH);
 
 /** Conveniency macro to iterate over features of a layer.
  *
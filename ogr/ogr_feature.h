@@ -850,6 +850,14 @@ class CPL_DLL OGRFeatureDefn
     TemporaryUnsealer GetTemporaryUnsealer(bool bSealFields = true);
 
   private:
+    //! @cond Doxygen_Suppress
+    // Case-insensitive index of field names, used by GetFieldIndex() and
+    // GetGeomFieldIndex() on definitions with many fields.
+    struct NameIndex;
+    std::unique_ptr<NameIndex> m_poFieldNameIndex;
+    std::unique_ptr<NameIndex> m_poGeomFieldNameIndex;
+    //! @endcond
+
     CPL_DISALLOW_COPY_ASSIGN(OGRFeatureDefn)
 };
 
@@ -1228,6 +1236,10 @@ class CPL_DLL OGRFeature
 
     void Reset();
 
+    //! @cond Doxygen_Suppress
+    void SwapContent(OGRFeature &oOther);
+    //! @endcond
+
     OGRFeature *Clone() const CPL_WARN_UNUSED_RESULT;
     virtual OGRBoolean Equal(const OGRFeature *poFeature) const;
 
@@ -1950,6 +1962,7 @@ class OGRLayer;
 class swq_expr_node;
 class swq_custom_func_registrar;
 struct swq_evaluation_context;
+class OGRFeatureQueryProgram;
 
 class CPL_DLL OGRFeatureQuery
 {
@@ -1957,6 +1970,7 @@ class CPL_DLL OGRFeatureQuery
     OGRFeatureDefn *poTargetDefn;
     void *pSWQExpr;
     swq_evaluation_context *m_psContext = nullptr;
+    OGRFeatureQueryProgram *m_poProgram = nullptr;
 
     char **FieldCollector(void *, char **);
 
@@ -1526,11 +1526,13 @@ class CPL_DLL OGRSimpleCurve : public OGRCurve
     OGRRawPoint *paoPoints;
     double *padfZ;
     double *padfM;
+    bool m_bPointsBorrowed = false;
 
     void Make3D();
     void Make2D();
     void RemoveM();
     void AddM();
+    bool MakePointsOwned();
 
     OGRErr importFromWKTListOnly(const char **ppszInput, int bHasZ, int bHasM,
                                  OGRRawPoint *&paoPointsIn, int &nMaxPoints,
@@ -1697,6 +1699,19 @@ class CPL_DLL OGRSimpleCurve : public OGRCurve
                     const double *padfMIn = nullptr);
     void setPoints(int, const double *padfX, const double *padfY,
                    const double *padfZIn, const double *padfMIn);
+    void setBorrowedPoints(int, const OGRRawPoint *,
+                           const double *padfZIn = nullptr,
+                           const double *padfMIn = nullptr);
+
+    /** Returns whether the points are borrowed from external arrays
+     * assigned with setBorrowedPoints().
+     * @since GDAL 3.10
+     */
+    bool hasBorrowedPoints() const
+    {
+        return m_bPointsBorrowed;
+    }
+
     void addPoint(const OGRPoint *);
     void addPoint(double, double);
     void addPoint(double, double, double);
@@ -4275,6 +4290,10 @@ struct CPL_DLL OGRPreparedGeometryUniquePtrDeleter
     void operator()(OGRPreparedGeometry *) const;
 };
 
+void CPL_DLL OGRPreparedGeometryIntersectsWKBBatch(
+    OGRPreparedGeometry *poPreparedGeom, size_t nCount,
+    const GByte *const *papabyWKB, const size_t *panWKBSize, int *panResults);
+
 //! @endcond
 
 /** Unique pointer type for OGRPreparedGeometry.
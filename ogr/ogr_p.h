@@ -109,6 +109,11 @@ std::string CPL_DLL OGRFormatDouble(double val, const OGRWktOptions &opts,
 int OGRFormatFloat(char *pszBuffer, int nBufferLen, float fVal, int nPrecision,
                    char chConversionSpecifier);
 
+/* Counter incremented each time a field or geometry field is renamed, so */
+/* that name indices of OGRFeatureDefn can detect they are stale.         */
+void OGRIncrementFieldNameChangeCounter();
+unsigned OGRGetFieldNameChangeCounter();
+
 /* -------------------------------------------------------------------- */
 /*      Date-time parsing and processing functions                      */
 /* -------------------------------------------------------------------- */
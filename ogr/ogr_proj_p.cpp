@@ -340,6 +340,8 @@ void OSRProjTLSCache::clear()
 {
     m_oCacheEPSG.clear();
     m_oCacheWKT.clear();
+    m_oCachePROJJSON.clear();
+    m_oCacheIdentify.clear();
     m_tlsContext = nullptr;
 }
 
@@ -384,6 +386,48 @@ void OSRProjTLSCache::CachePJForWKT(const std::string &wkt, PJ *pj)
     m_oCacheWKT.insert(wkt, UniquePtrPJ(proj_clone(GetPJContext(), pj)));
 }
 
+PJ *OSRProjTLSCache::GetPJForPROJJSON(const std::string &projjson)
+{
+    auto cached = m_oCachePROJJSON.getPtr(projjson);
+    if (cached)
+    {
+        return proj_clone(GetPJContext(), cached->get());
+    }
+    return nullptr;
+}
+
+void OSRProjTLSCache::CachePJForPROJJSON(const std::string &projjson, PJ *pj)
+{
+    m_oCachePROJJSON.insert(projjson,
+                            UniquePtrPJ(proj_clone(GetPJContext(), pj)));
+}
+
+// Returns clones of the cached matches, to be destroyed by the caller
+bool OSRProjTLSCache::GetIdentifyResult(const std::string &wkt,
+                                        std::vector<PJ *> &apoMatches,
+                                        std::vector<int> &anConfidence)
+{
+    auto cached = m_oCacheIdentify.getPtr(wkt);
+    if (!cached)
+        return false;
+    apoMatches.clear();
+    for (const auto &poMatch : cached->apoMatches)
+        apoMatches.push_back(proj_clone(GetPJContext(), poMatch.get()));
+    anConfidence = cached->anConfidence;
+    return true;
+}
+
+void OSRProjTLSCache::CacheIdentifyResult(const std::string &wkt,
+                                          const std::vector<PJ *> &apoMatches,
+                                          const std::vector<int> &anConfidence)
+{
+    IdentifyResult oResult;
+    for (PJ *pj : apoMatches)
+        oResult.apoMatches.emplace_back(proj_clone(GetPJContext(), pj));
+    oResult.anConfidence = anConfidence;
+    m_oCacheIdentify.insert(wkt, std::move(oResult));
+}
+
 /************************************************************************/
 /*                         OSRCleanupTLSContext()                       */
 /************************************************************************/
@@ -35,7 +35,9 @@
 
 #include <unordered_map>
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 /*! @cond Doxygen_Suppress */
 
@@ -92,6 +94,17 @@ class OSRProjTLSCache
                                     EPSGCacheKeyHasher>>
         m_oCacheEPSG{};
     lru11::Cache<std::string, UniquePtrPJ> m_oCacheWKT{};
+    lru11::Cache<std::string, UniquePtrPJ> m_oCachePROJJSON{};
+
+    // Result of proj_identify()
+    struct IdentifyResult
+    {
+        std::vector<UniquePtrPJ> apoMatches{};
+        std::vector<int> anConfidence{};
+    };
+
+    // Key is the WKT2_2019 export of the identified CRS
+    lru11::Cache<std::string, IdentifyResult> m_oCacheIdentify{};
 
     PJ_CONTEXT *GetPJContext();
 
@@ -111,6 +124,16 @@ class OSRProjTLSCache
 
     PJ *GetPJForWKT(const std::string &wkt);
     void CachePJForWKT(const std::string &wkt, PJ *pj);
+
+    PJ *GetPJForPROJJSON(const std::string &projjson);
+    void CachePJForPROJJSON(const std::string &projjson, PJ *pj);
+
+    bool GetIdentifyResult(const std::string &wkt,
+                           std::vector<PJ *> &apoMatches,
+                           std::vector<int> &anConfidence);
+    void CacheIdentifyResult(const std::string &wkt,
+                             const std::vector<PJ *> &apoMatches,
+                             const std::vector<int> &anConfidence);
 };
 
 OSRProjTLSCache *OSRGetProjTLSCache();
@@ -880,6 +880,38 @@ class CPL_DLL OGRCoordinateTransformation
                                         double *z, double *t,
                                         int *panErrorCodes);
 
+    /**
+     * Transform points from source to destination space, using several
+     * threads.
+     *
+     * The arrays are split in chunks that are transformed concurrently, each
+     * one by a Clone() of this object, in the global GDAL thread pool. When
+     * nCount is small, or cloning is not possible, this is equivalent to
+     * TransformWithErrorCodes().
+     *
+     * As chunks are transformed independently, when several candidate
+     * operations exist and none has been forced, the operation may be
+     * selected per chunk rather than once for the whole array.
+     *
+     * @param nCount number of points to transform.
+     * @param x array of nCount X vertices, modified in place. Should not be
+     * NULL.
+     * @param y array of nCount Y vertices, modified in place. Should not be
+     * NULL.
+     * @param z array of nCount Z vertices, modified in place. Might be NULL.
+     * @param t array of nCount time values, modified in place. Might be NULL.
+     * @param panErrorCodes Output array of nCount value that will be set to 0
+     * for success, or a non-zero value for failure. Might be NULL
+     * @param nThreads Number of threads to use, or 0 to use the value of the
+     * GDAL_NUM_THREADS configuration option (ALL_CPUS if not set).
+     * @return TRUE if a transformation could be found for all chunks (but not
+     * all points may have necessarily succeed to transform), otherwise FALSE.
+     * @since GDAL 3.10
+     */
+    int TransformParallel(size_t nCount, double *x, double *y,
+                          double *z = nullptr, double *t = nullptr,
+                          int *panErrorCodes = nullptr, int nThreads = 0);
+
     /** \brief Transform boundary.
      *
      * This method is the same as the C function OCTTransformBounds().
@@ -1095,6 +1095,8 @@ int CPL_DLL CPL_STDCALL OCTTransformBounds(OGRCoordinateTransformationH hCT,
                                            double *out_xmax, double *out_ymax,
                                            const int densify_pts);
 
+void CPL_DLL OCTGetCacheStatistics(GIntBig *pnHits, GIntBig *pnMisses);
+
 CPL_C_END
 
 #endif /* ndef SWIG */
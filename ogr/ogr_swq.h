@@ -371,6 +371,14 @@ typedef struct
     int ascending_flag;
 } swq_order_def;
 
+typedef struct
+{
+    char *table_name;
+    char *field_name;
+    int table_index;
+    int field_index;
+} swq_group_def;
+
 typedef struct
 {
     int secondary_table;
@@ -436,6 +444,10 @@ class CPL_UNSTABLE_API swq_select
 
     swq_expr_node *where_expr = nullptr;
 
+    void PushGroupBy(const char *pszTableName, const char *pszFieldName);
+    int group_specs = 0;
+    swq_group_def *group_defs = nullptr;
+
     void PushOrderBy(const char *pszTableName, const char *pszFieldName,
                      int bAscending);
     int order_specs = 0;
@@ -463,6 +475,7 @@ class CPL_UNSTABLE_API swq_select
 
   private:
     bool IsFieldExcluded(int src_index, const char *table, const char *field);
+    bool IsGroupByColumn(const swq_col_def *def) const;
 
     // map of EXCLUDE columns keyed according to the index of the
     // asterisk with which it should be associated. key of -1 is
@@ -31,11 +31,15 @@
 #include "ogr_core.h"
 #include "ogr_geometry.h"
 #include "ogr_p.h"
+#include "ogr_spatialref.h"
+
+#include "gdalsse_priv.h"
 
 #include <algorithm>
 #include <cmath>
 #include <climits>
 #include <limits>
+#include <vector>
 
 #include <algorithm>
 #include <limits>
@@ -300,6 +304,65 @@ static uint32_t OGRWKBReadUInt32AtOffset(const uint8_t *data,
     return v;
 }
 
+/************************************************************************/
+/*                        OGRExtendEnvelopeXY()                         */
+/************************************************************************/
+
+/** Extend sEnvelope with the X and Y coordinates of nPoints points.
+ *
+ * X and Y must be consecutive doubles in native byte order, the ones of
+ * the first point starting at pData, and the ones of each following point
+ * nStride bytes after the ones of the previous point. pData does not need
+ * to be aligned.
+ *
+ * As with std::min() / std::max(), NaN coordinates are ignored.
+ */
+void OGRExtendEnvelopeXY(const void *pData, size_t nStride, size_t nPoints,
+                         OGREnvelope &sEnvelope)
+{
+    const GByte *pabyData = static_cast<const GByte *>(pData);
+    const double adfMin[] = {sEnvelope.MinX, sEnvelope.MinY};
+    const double adfMax[] = {sEnvelope.MaxX, sEnvelope.MaxY};
+
+    // X and Y are processed together, as the low and high parts of a
+    // register. Two accumulators break the dependency chain between
+    // consecutive points. The new value is the first argument of Min() /
+    // Max() so that a NaN coordinate leaves the accumulator unchanged.
+    auto oMin0 = XMMReg2Double::Load2Val(adfMin);
+    auto oMax0 = XMMReg2Double::Load2Val(adfMax);
+    auto oMin1 = oMin0;
+    auto oMax1 = oMax0;
+    size_t i = 0;
+    for (; i + 1 < nPoints; i += 2)
+    {
+        const auto oXY0 = XMMReg2Double::Load2Val(
+            reinterpret_cast<const double *>(pabyData + i * nStride));
+        const auto oXY1 = XMMReg2Double::Load2Val(
+            reinterpret_cast<const double *>(pabyData + (i + 1) * nStride));
+        oMin0 = XMMReg2Double::Min(oXY0, oMin0);
+        oMax0 = XMMReg2Double::Max(oXY0, oMax0);
+        oMin1 = XMMReg2Double::Min(oXY1, oMin1);
+        oMax1 = XMMReg2Double::Max(oXY1, oMax1);
+    }
+    if (i < nPoints)
+    {
+        const auto oXY = XMMReg2Double::Load2Val(
+            reinterpret_cast<const double *>(pabyData + i * nStride));
+        oMin0 = XMMReg2Double::Min(oXY, oMin0);
+        oMax0 = XMMReg2Double::Max(oXY, oMax0);
+    }
+    oMin0 = XMMReg2Double::Min(oMin1, oMin0);
+    oMax0 = XMMReg2Double::Max(oMax1, oMax0);
+
+    double adfRes[2];
+    oMin0.Store2Val(adfRes);
+    sEnvelope.MinX = adfRes[0];
+    sEnvelope.MinY = adfRes[1];
+    oMax0.Store2Val(adfRes);
+    sEnvelope.MaxX = adfRes[0];
+    sEnvelope.MaxY = adfRes[1];
+}
+
 /************************************************************************/
 /*                         ReadWKBPointSequence()                       */
 /************************************************************************/
@@ -314,6 +377,29 @@ static bool ReadWKBPointSequence(const uint8_t *data, size_t size,
         OGRWKBReadUInt32AtOffset(data, eByteOrder, iOffset);
     if (nPoints > (size - iOffset) / (nDim * sizeof(double)))
         return false;
+    if (!OGR_SWAP(eByteOrder))
+    {
+        OGRExtendEnvelopeXY(data + iOffset, nDim * sizeof(double), nPoints,
+                            sEnvelope);
+        if constexpr (INCLUDE_Z)
+        {
+            if (bHasZ)
+            {
+                for (uint32_t j = 0; j < nPoints; j++)
+                {
+                    double dfZ;
+                    memcpy(&dfZ,
+                           data + iOffset + j * nDim * sizeof(double) +
+                               2 * sizeof(double),
+                           sizeof(double));
+                    sEnvelope.MinZ = std::min(sEnvelope.MinZ, dfZ);
+                    sEnvelope.MaxZ = std::max(sEnvelope.MaxZ, dfZ);
+                }
+            }
+        }
+        iOffset += static_cast<size_t>(nPoints) * nDim * sizeof(double);
+        return true;
+    }
     double dfX = 0;
     double dfY = 0;
     [[maybe_unused]] double dfZ = 0;
@@ -824,6 +910,728 @@ bool OGRWKBIntersectsPessimistic(const GByte *pabyWkb, size_t nWKBSize,
     return bRet;
 }
 
+/************************************************************************/
+/*                        OGRWKBPointSequence                           */
+/************************************************************************/
+
+namespace
+{
+/** View on the points of a WKB LineString or of a WKB polygon ring. */
+struct OGRWKBPointSequence
+{
+    const GByte *pabyData = nullptr;
+    uint32_t nPoints = 0;
+    int nDim = 2;
+    bool bNeedSwap = false;
+
+    inline void GetXY(uint32_t i, double &dfX, double &dfY) const
+    {
+        const GByte *pabyPoint =
+            pabyData + static_cast<size_t>(i) * nDim * sizeof(double);
+        dfX = OGRWKBReadFloat64(pabyPoint, bNeedSwap);
+        dfY = OGRWKBReadFloat64(pabyPoint + sizeof(double), bNeedSwap);
+    }
+};
+
+/************************************************************************/
+/*                        OGRWKBLinearWalker                            */
+/************************************************************************/
+
+/** Walks through the points, linestrings and polygons of a WKB geometry,
+ * and forwards them to the Point(), LineString() and Polygon() methods of
+ * the visitor. Those methods return false to stop the walk.
+ * The VisitParts() method of the visitor is called for each collection, and
+ * returns whether its parts must be forwarded to the visitor (they are
+ * walked through in all cases, to validate the WKB).
+ *
+ * Walk() returns false if the WKB is invalid, or if it contains curve
+ * geometries (circular strings, compound curves, curve polygons), which
+ * must be handled by the caller through OGRGeometry.
+ */
+template <class Visitor> class OGRWKBLinearWalker
+{
+    Visitor &m_oVisitor;
+    std::vector<OGRWKBPointSequence> m_aoRings{};
+    bool m_bStopped = false;
+
+    static bool ReadPointSequence(const GByte *data, size_t size,
+                                  OGRwkbByteOrder eByteOrder, int nDim,
+                                  size_t &iOffset, OGRWKBPointSequence &oSeq)
+    {
+        if (size - iOffset < sizeof(uint32_t))
+            return false;
+        const uint32_t nPoints =
+            OGRWKBReadUInt32AtOffset(data, eByteOrder, iOffset);
+        if (nPoints > (size - iOffset) / (nDim * sizeof(double)))
+            return false;
+        oSeq.pabyData = data + iOffset;
+        oSeq.nPoints = nPoints;
+        oSeq.nDim = nDim;
+        oSeq.bNeedSwap = OGR_SWAP(eByteOrder);
+        iOffset += static_cast<size_t>(nPoints) * nDim * sizeof(double);
+        return true;
+    }
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRWKBLinearWalker)
+
+  public:
+    explicit OGRWKBLinearWalker(Visitor &oVisitor) : m_oVisitor(oVisitor)
+    {
+    }
+
+    bool Walk(const GByte *data, size_t size, size_t &iOffset, int nRec,
+              bool bVisit = true)
+    {
+        if (m_bStopped)
+            return true;
+        if (iOffset > size || size - iOffset < WKB_PREFIX_SIZE)
+            return false;
+        const int nByteOrder = DB2_V72_FIX_BYTE_ORDER(data[iOffset]);
+        if (!(nByteOrder == wkbXDR || nByteOrder == wkbNDR))
+            return false;
+        const OGRwkbByteOrder eByteOrder =
+            static_cast<OGRwkbByteOrder>(nByteOrder);
+
+        OGRwkbGeometryType eGeometryType = wkbUnknown;
+        if (OGRReadWKBGeometryType(data + iOffset, wkbVariantIso,
+                                   &eGeometryType) != OGRERR_NONE)
+            return false;
+        iOffset += WKB_PREFIX_SIZE;
+        const auto eFlatType = wkbFlatten(eGeometryType);
+        const int nDim = 2 + (OGR_GT_HasZ(eGeometryType) ? 1 : 0) +
+                         (OGR_GT_HasM(eGeometryType) ? 1 : 0);
+
+        switch (eFlatType)
+        {
+            case wkbPoint:
+            {
+                if (size - iOffset < nDim * sizeof(double))
+                    return false;
+                const bool bNeedSwap = OGR_SWAP(eByteOrder);
+                const double dfX = OGRWKBReadFloat64(data + iOffset, bNeedSwap);
+                const double dfY = OGRWKBReadFloat64(
+                    data + iOffset + sizeof(double), bNeedSwap);
+                iOffset += nDim * sizeof(double);
+                // POINT EMPTY is encoded with NaN coordinates
+                if (bVisit && !std::isnan(dfX) &&
+                    !m_oVisitor.Point(dfX, dfY))
+                    m_bStopped = true;
+                return true;
+            }
+
+            case wkbLineString:
+            {
+                OGRWKBPointSequence oSeq;
+                if (!ReadPointSequence(data, size, eByteOrder, nDim, iOffset,
+                                       oSeq))
+                    return false;
+                if (bVisit && oSeq.nPoints > 0 &&
+                    !m_oVisitor.LineString(oSeq))
+                    m_bStopped = true;
+                return true;
+            }
+
+            case wkbPolygon:
+            case wkbTriangle:
+            {
+                if (size - iOffset < sizeof(uint32_t))
+                    return false;
+                const uint32_t nRings =
+                    OGRWKBReadUInt32AtOffset(data, eByteOrder, iOffset);
+                if (nRings > (size - iOffset) / sizeof(uint32_t))
+                    return false;
+                m_aoRings.resize(nRings);
+                for (auto &oRing : m_aoRings)
+                {
+                    if (!ReadPointSequence(data, size, eByteOrder, nDim,
+                                           iOffset, oRing))
+                        return false;
+                }
+                if (bVisit && nRings > 0 && !m_oVisitor.Polygon(m_aoRings))
+                    m_bStopped = true;
+                return true;
+            }
+
+            case wkbMultiPoint:
+            case wkbMultiLineString:
+            case wkbMultiPolygon:
+            case wkbGeometryCollection:
+            case wkbMultiCurve:
+            case wkbMultiSurface:
+            case wkbPolyhedralSurface:
+            case wkbTIN:
+            {
+                if (nRec == 128)
+                    return false;
+                if (size - iOffset < sizeof(uint32_t))
+                    return false;
+                const uint32_t nParts =
+                    OGRWKBReadUInt32AtOffset(data, eByteOrder, iOffset);
+                if (nParts > (size - iOffset) / MIN_WKB_SIZE)
+                    return false;
+                const bool bVisitParts =
+                    bVisit && m_oVisitor.VisitParts(eFlatType);
+                for (uint32_t k = 0; k < nParts && !m_bStopped; k++)
+                {
+                    if (!Walk(data, size, iOffset, nRec + 1, bVisitParts))
+                        return false;
+                }
+                return true;
+            }
+
+            default:
+                break;
+        }
+        return false;
+    }
+};
+
+/************************************************************************/
+/*                  OGRWKBSegmentIntersectsEnvelope()                   */
+/************************************************************************/
+
+// Liang-Barsky clipping of the segment against the envelope.
+static bool OGRWKBSegmentIntersectsEnvelope(double dfX0, double dfY0,
+                                            double dfX1, double dfY1,
+                                            const OGREnvelope &sEnvelope)
+{
+    if (std::max(dfX0, dfX1) < sEnvelope.MinX ||
+        std::min(dfX0, dfX1) > sEnvelope.MaxX ||
+        std::max(dfY0, dfY1) < sEnvelope.MinY ||
+        std::min(dfY0, dfY1) > sEnvelope.MaxY)
+    {
+        return false;
+    }
+
+    const double dfDX = dfX1 - dfX0;
+    const double dfDY = dfY1 - dfY0;
+    const double adfP[] = {-dfDX, dfDX, -dfDY, dfDY};
+    const double adfQ[] = {dfX0 - sEnvelope.MinX, sEnvelope.MaxX - dfX0,
+                           dfY0 - sEnvelope.MinY, sEnvelope.MaxY - dfY0};
+    double dfT0 = 0;
+    double dfT1 = 1;
+    for (int i = 0; i < 4; ++i)
+    {
+        if (adfP[i] == 0)
+        {
+            if (adfQ[i] < 0)
+                return false;
+        }
+        else
+        {
+            const double dfT = adfQ[i] / adfP[i];
+            if (adfP[i] < 0)
+            {
+                if (dfT > dfT1)
+                    return false;
+                dfT0 = std::max(dfT0, dfT);
+            }
+            else
+            {
+                if (dfT < dfT0)
+                    return false;
+                dfT1 = std::min(dfT1, dfT);
+            }
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                  OGRWKBPointSequenceIntersectsEnvelope()             */
+/************************************************************************/
+
+static bool
+OGRWKBPointSequenceIntersectsEnvelope(const OGRWKBPointSequence &oSeq,
+                                      const OGREnvelope &sEnvelope)
+{
+    double dfX0 = 0;
+    double dfY0 = 0;
+    oSeq.GetXY(0, dfX0, dfY0);
+    if (oSeq.nPoints == 1)
+    {
+        return dfX0 >= sEnvelope.MinX && dfX0 <= sEnvelope.MaxX &&
+               dfY0 >= sEnvelope.MinY && dfY0 <= sEnvelope.MaxY;
+    }
+    for (uint32_t i = 1; i < oSeq.nPoints; ++i)
+    {
+        double dfX1 = 0;
+        double dfY1 = 0;
+        oSeq.GetXY(i, dfX1, dfY1);
+        if (OGRWKBSegmentIntersectsEnvelope(dfX0, dfY0, dfX1, dfY1, sEnvelope))
+            return true;
+        dfX0 = dfX1;
+        dfY0 = dfY1;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                      OGRWKBPolygonContainsPoint()                    */
+/************************************************************************/
+
+// Returns whether the point is inside the polygon or on its boundary,
+// using the even-odd rule over all rings.
+static bool
+OGRWKBPolygonContainsPoint(const std::vector<OGRWKBPointSequence> &aoRings,
+                           double dfX, double dfY)
+{
+    bool bInside = false;
+    for (const auto &oRing : aoRings)
+    {
+        if (oRing.nPoints == 0)
+            continue;
+        double dfX0 = 0;
+        double dfY0 = 0;
+        oRing.GetXY(0, dfX0, dfY0);
+        for (uint32_t i = 1; i < oRing.nPoints; ++i)
+        {
+            double dfX1 = 0;
+            double dfY1 = 0;
+            oRing.GetXY(i, dfX1, dfY1);
+            const double dfCross =
+                (dfX1 - dfX0) * (dfY - dfY0) - (dfY1 - dfY0) * (dfX - dfX0);
+            if (dfCross == 0 && dfX >= std::min(dfX0, dfX1) &&
+                dfX <= std::max(dfX0, dfX1) && dfY >= std::min(dfY0, dfY1) &&
+                dfY <= std::max(dfY0, dfY1))
+            {
+                return true;
+            }
+            if ((dfY0 > dfY) != (dfY1 > dfY) &&
+                dfX < dfX0 + (dfY - dfY0) * (dfX1 - dfX0) / (dfY1 - dfY0))
+            {
+                bInside = !bInside;
+            }
+            dfX0 = dfX1;
+            dfY0 = dfY1;
+        }
+    }
+    return bInside;
+}
+
+/************************************************************************/
+/*                    OGRWKBSquareDistanceToSegment()                   */
+/************************************************************************/
+
+static double OGRWKBSquareDistanceToSegment(double dfX, double dfY,
+                                            double dfX0, double dfY0,
+                                            double dfX1, double dfY1)
+{
+    const double dfDX = dfX1 - dfX0;
+    const double dfDY = dfY1 - dfY0;
+    const double dfSqLength = dfDX * dfDX + dfDY * dfDY;
+    double dfT = 0;
+    if (dfSqLength > 0)
+    {
+        dfT = ((dfX - dfX0) * dfDX + (dfY - dfY0) * dfDY) / dfSqLength;
+        dfT = std::max(0.0, std::min(1.0, dfT));
+    }
+    const double dfProjX = dfX0 + dfT * dfDX - dfX;
+    const double dfProjY = dfY0 + dfT * dfDY - dfY;
+    return dfProjX * dfProjX + dfProjY * dfProjY;
+}
+
+/************************************************************************/
+/*                      OGRWKBPointSequenceGetArea()                    */
+/************************************************************************/
+
+// Same formula as OGRSimpleCurve::get_LinearArea()
+static double OGRWKBPointSequenceGetArea(const OGRWKBPointSequence &oSeq)
+{
+    const uint32_t nPoints = oSeq.nPoints;
+    if (nPoints < 2)
+        return 0;
+
+    double dfXPrev = 0;
+    double dfYPrev = 0;
+    oSeq.GetXY(nPoints - 1, dfXPrev, dfYPrev);
+    double dfXCur = 0;
+    double dfYCur = 0;
+    oSeq.GetXY(0, dfXCur, dfYCur);
+    double dfAreaSum = 0;
+    for (uint32_t i = 0; i < nPoints; ++i)
+    {
+        double dfXNext = 0;
+        double dfYNext = 0;
+        oSeq.GetXY(i + 1 < nPoints ? i + 1 : 0, dfXNext, dfYNext);
+        dfAreaSum += dfXCur * (dfYNext - dfYPrev);
+        dfYPrev = dfYCur;
+        dfXCur = dfXNext;
+        dfYCur = dfYNext;
+    }
+    return 0.5 * fabs(dfAreaSum);
+}
+
+/************************************************************************/
+/*                  OGRWKBEnvelopeIntersectsVisitor                     */
+/************************************************************************/
+
+struct OGRWKBEnvelopeIntersectsVisitor
+{
+    const OGREnvelope &sEnvelope;
+    bool bIntersects = false;
+
+    explicit OGRWKBEnvelopeIntersectsVisitor(const OGREnvelope &sEnvelopeIn)
+        : sEnvelope(sEnvelopeIn)
+    {
+    }
+
+    bool VisitParts(OGRwkbGeometryType)
+    {
+        return true;
+    }
+
+    bool Point(double dfX, double dfY)
+    {
+        bIntersects = dfX >= sEnvelope.MinX && dfX <= sEnvelope.MaxX &&
+                      dfY >= sEnvelope.MinY && dfY <= sEnvelope.MaxY;
+        return !bIntersects;
+    }
+
+    bool LineString(const OGRWKBPointSequence &oSeq)
+    {
+        bIntersects = OGRWKBPointSequenceIntersectsEnvelope(oSeq, sEnvelope);
+        return !bIntersects;
+    }
+
+    bool Polygon(const std::vector<OGRWKBPointSequence> &aoRings)
+    {
+        for (const auto &oRing : aoRings)
+        {
+            if (oRing.nPoints > 0 &&
+                OGRWKBPointSequenceIntersectsEnvelope(oRing, sEnvelope))
+            {
+                bIntersects = true;
+                return false;
+            }
+        }
+        // No ring crosses the envelope: either the envelope is fully
+        // inside the polygon, or they are disjoint.
+        bIntersects =
+            OGRWKBPolygonContainsPoint(aoRings, sEnvelope.MinX, sEnvelope.MinY);
+        return !bIntersects;
+    }
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRWKBEnvelopeIntersectsVisitor)
+};
+
+/************************************************************************/
+/*                     OGRWKBIntersectsPointVisitor                     */
+/************************************************************************/
+
+struct OGRWKBIntersectsPointVisitor
+{
+    double dfX = 0;
+    double dfY = 0;
+    bool bIntersects = false;
+
+    bool VisitParts(OGRwkbGeometryType)
+    {
+        return true;
+    }
+
+    bool Point(double dfXIn, double dfYIn)
+    {
+        bIntersects = dfXIn == dfX && dfYIn == dfY;
+        return !bIntersects;
+    }
+
+    bool LineString(const OGRWKBPointSequence &oSeq)
+    {
+        OGREnvelope sEnvelope;
+        sEnvelope.MinX = dfX;
+        sEnvelope.MinY = dfY;
+        sEnvelope.MaxX = dfX;
+        sEnvelope.MaxY = dfY;
+        bIntersects = OGRWKBPointSequenceIntersectsEnvelope(oSeq, sEnvelope);
+        return !bIntersects;
+    }
+
+    bool Polygon(const std::vector<OGRWKBPointSequence> &aoRings)
+    {
+        bIntersects = OGRWKBPolygonContainsPoint(aoRings, dfX, dfY);
+        return !bIntersects;
+    }
+};
+
+/************************************************************************/
+/*                    OGRWKBDistanceToPointVisitor                      */
+/************************************************************************/
+
+struct OGRWKBDistanceToPointVisitor
+{
+    double dfX = 0;
+    double dfY = 0;
+    double dfSquareDistance = std::numeric_limits<double>::infinity();
+
+    bool VisitParts(OGRwkbGeometryType)
+    {
+        return true;
+    }
+
+    bool Point(double dfXIn, double dfYIn)
+    {
+        const double dfDX = dfXIn - dfX;
+        const double dfDY = dfYIn - dfY;
+        dfSquareDistance =
+            std::min(dfSquareDistance, dfDX * dfDX + dfDY * dfDY);
+        return dfSquareDistance > 0;
+    }
+
+    bool LineString(const OGRWKBPointSequence &oSeq)
+    {
+        double dfX0 = 0;
+        double dfY0 = 0;
+        oSeq.GetXY(0, dfX0, dfY0);
+        if (oSeq.nPoints == 1)
+            return Point(dfX0, dfY0);
+        for (uint32_t i = 1; i < oSeq.nPoints && dfSquareDistance > 0; ++i)
+        {
+            double dfX1 = 0;
+            double dfY1 = 0;
+            oSeq.GetXY(i, dfX1, dfY1);
+            dfSquareDistance =
+                std::min(dfSquareDistance,
+                         OGRWKBSquareDistanceToSegment(dfX, dfY, dfX0, dfY0,
+                                                       dfX1, dfY1));
+            dfX0 = dfX1;
+            dfY0 = dfY1;
+        }
+        return dfSquareDistance > 0;
+    }
+
+    bool Polygon(const std::vector<OGRWKBPointSequence> &aoRings)
+    {
+        if (OGRWKBPolygonContainsPoint(aoRings, dfX, dfY))
+        {
+            dfSquareDistance = 0;
+            return false;
+        }
+        for (const auto &oRing : aoRings)
+        {
+            if (oRing.nPoints > 0 && !LineString(oRing))
+                return false;
+        }
+        return true;
+    }
+};
+
+/************************************************************************/
+/*                       OGRWKBGetLengthVisitor                         */
+/************************************************************************/
+
+struct OGRWKBGetLengthVisitor
+{
+    double dfLength = 0;
+
+    // Consistent with OGRGeometryCollection::get_Length(), which only
+    // takes into account curves and collections of curves
+    bool VisitParts(OGRwkbGeometryType eFlatType)
+    {
+        return eFlatType == wkbMultiLineString || eFlatType == wkbMultiCurve ||
+               eFlatType == wkbGeometryCollection;
+    }
+
+    bool Point(double, double)
+    {
+        return true;
+    }
+
+    bool LineString(const OGRWKBPointSequence &oSeq)
+    {
+        double dfX0 = 0;
+        double dfY0 = 0;
+        oSeq.GetXY(0, dfX0, dfY0);
+        for (uint32_t i = 1; i < oSeq.nPoints; ++i)
+        {
+            double dfX1 = 0;
+            double dfY1 = 0;
+            oSeq.GetXY(i, dfX1, dfY1);
+            const double dfDX = dfX1 - dfX0;
+            const double dfDY = dfY1 - dfY0;
+            dfLength += sqrt(dfDX * dfDX + dfDY * dfDY);
+            dfX0 = dfX1;
+            dfY0 = dfY1;
+        }
+        return true;
+    }
+
+    bool Polygon(const std::vector<OGRWKBPointSequence> &)
+    {
+        return true;
+    }
+};
+
+/************************************************************************/
+/*                        OGRWKBGetAreaVisitor                          */
+/************************************************************************/
+
+struct OGRWKBGetAreaVisitor
+{
+    double dfArea = 0;
+    bool bUnsupported = false;
+
+    // Consistent with OGRGeometryCollection::get_Area(), which ignores
+    // collections of points and curves
+    bool VisitParts(OGRwkbGeometryType eFlatType)
+    {
+        // The area of polyhedral surfaces is computed by SFCGAL
+        if (eFlatType == wkbPolyhedralSurface || eFlatType == wkbTIN)
+            bUnsupported = true;
+        return eFlatType == wkbMultiPolygon || eFlatType == wkbMultiSurface ||
+               eFlatType == wkbGeometryCollection;
+    }
+
+    bool Point(double, double)
+    {
+        return true;
+    }
+
+    // Consistent with OGRSimpleCurve::get_LinearArea(): a closed linestring
+    // has the area of the ring it forms.
+    bool LineString(const OGRWKBPointSequence &oSeq)
+    {
+        double dfXStart = 0;
+        double dfYStart = 0;
+        oSeq.GetXY(0, dfXStart, dfYStart);
+        double dfXEnd = 0;
+        double dfYEnd = 0;
+        oSeq.GetXY(oSeq.nPoints - 1, dfXEnd, dfYEnd);
+        if (dfXStart == dfXEnd && dfYStart == dfYEnd)
+            dfArea += OGRWKBPointSequenceGetArea(oSeq);
+        return true;
+    }
+
+    bool Polygon(const std::vector<OGRWKBPointSequence> &aoRings)
+    {
+        dfArea += OGRWKBPointSequenceGetArea(aoRings[0]);
+        for (size_t i = 1; i < aoRings.size(); ++i)
+            dfArea -= OGRWKBPointSequenceGetArea(aoRings[i]);
+        return true;
+    }
+};
+
+}  // namespace
+
+/************************************************************************/
+/*                       OGRWKBIntersectsEnvelope()                     */
+/************************************************************************/
+
+/** Computes whether the geometry (pabyWkb, nWKBSize) intersects the passed
+ * envelope, taking into account the exact geometry of edges, and not only
+ * their bounding box as OGRWKBIntersectsPessimistic() does.
+ *
+ * Points and edges touching the envelope are considered as intersecting it.
+ *
+ * @return false if the WKB is invalid or contains curve geometries, in which
+ * case bIntersects is not set and the caller must fall back to OGRGeometry.
+ */
+bool OGRWKBIntersectsEnvelope(const GByte *pabyWkb, size_t nWKBSize,
+                              const OGREnvelope &sEnvelope, bool &bIntersects)
+{
+    OGRWKBEnvelopeIntersectsVisitor oVisitor(sEnvelope);
+    OGRWKBLinearWalker<OGRWKBEnvelopeIntersectsVisitor> oWalker(oVisitor);
+    size_t iOffset = 0;
+    if (!oWalker.Walk(pabyWkb, nWKBSize, iOffset, 0))
+        return false;
+    bIntersects = oVisitor.bIntersects;
+    return true;
+}
+
+/************************************************************************/
+/*                        OGRWKBIntersectsPoint()                       */
+/************************************************************************/
+
+/** Computes whether the geometry (pabyWkb, nWKBSize) intersects the point
+ * (dfX, dfY). For polygons, this is a point-in-polygon test, where a point on
+ * the boundary of the polygon is considered as intersecting it.
+ *
+ * @return false if the WKB is invalid or contains curve geometries, in which
+ * case bIntersects is not set and the caller must fall back to OGRGeometry.
+ */
+bool OGRWKBIntersectsPoint(const GByte *pabyWkb, size_t nWKBSize, double dfX,
+                           double dfY, bool &bIntersects)
+{
+    OGRWKBIntersectsPointVisitor oVisitor;
+    oVisitor.dfX = dfX;
+    oVisitor.dfY = dfY;
+    OGRWKBLinearWalker<OGRWKBIntersectsPointVisitor> oWalker(oVisitor);
+    size_t iOffset = 0;
+    if (!oWalker.Walk(pabyWkb, nWKBSize, iOffset, 0))
+        return false;
+    bIntersects = oVisitor.bIntersects;
+    return true;
+}
+
+/************************************************************************/
+/*                       OGRWKBGetDistanceToPoint()                     */
+/************************************************************************/
+
+/** Computes the 2D distance between the geometry (pabyWkb, nWKBSize) and the
+ * point (dfX, dfY). The distance is 0 if the point is inside a polygon.
+ *
+ * @return false if the WKB is invalid, contains curve geometries or is empty,
+ * in which case dfDistance is not set.
+ */
+bool OGRWKBGetDistanceToPoint(const GByte *pabyWkb, size_t nWKBSize,
+                              double dfX, double dfY, double &dfDistance)
+{
+    OGRWKBDistanceToPointVisitor oVisitor;
+    oVisitor.dfX = dfX;
+    oVisitor.dfY = dfY;
+    OGRWKBLinearWalker<OGRWKBDistanceToPointVisitor> oWalker(oVisitor);
+    size_t iOffset = 0;
+    if (!oWalker.Walk(pabyWkb, nWKBSize, iOffset, 0) ||
+        std::isinf(oVisitor.dfSquareDistance))
+        return false;
+    dfDistance = sqrt(oVisitor.dfSquareDistance);
+    return true;
+}
+
+/************************************************************************/
+/*                           OGRWKBGetLength()                          */
+/************************************************************************/
+
+/** Computes the 2D length of the linear parts of the geometry (pabyWkb,
+ * nWKBSize), with the same semantics as OGR_G_Length(): surfaces and points
+ * are ignored.
+ *
+ * @return false if the WKB is invalid or contains curve geometries.
+ */
+bool OGRWKBGetLength(const GByte *pabyWkb, size_t nWKBSize, double &dfLength)
+{
+    OGRWKBGetLengthVisitor oVisitor;
+    OGRWKBLinearWalker<OGRWKBGetLengthVisitor> oWalker(oVisitor);
+    size_t iOffset = 0;
+    if (!oWalker.Walk(pabyWkb, nWKBSize, iOffset, 0))
+        return false;
+    dfLength = oVisitor.dfLength;
+    return true;
+}
+
+/************************************************************************/
+/*                            OGRWKBGetArea()                           */
+/************************************************************************/
+
+/** Computes the 2D area of the geometry (pabyWkb, nWKBSize), with the same
+ * semantics as OGR_G_Area(): area of the exterior ring minus the ones of the
+ * interior rings for polygons, area of the ring for closed linestrings,
+ * and sum of the areas of the parts for collections.
+ *
+ * @return false if the WKB is invalid, contains curve geometries, or
+ * polyhedral surfaces or TINs (whose area is computed by SFCGAL).
+ */
+bool OGRWKBGetArea(const GByte *pabyWkb, size_t nWKBSize, double &dfArea)
+{
+    OGRWKBGetAreaVisitor oVisitor;
+    OGRWKBLinearWalker<OGRWKBGetAreaVisitor> oWalker(oVisitor);
+    size_t iOffset = 0;
+    if (!oWalker.Walk(pabyWkb, nWKBSize, iOffset, 0) || oVisitor.bUnsupported)
+        return false;
+    dfArea = oVisitor.dfArea;
+    return true;
+}
+
 /************************************************************************/
 /*                            epsilonEqual()                            */
 /************************************************************************/
@@ -1072,6 +1880,272 @@ void OGRWKBFixupCounterClockWiseExternalRing(GByte *pabyWkb, size_t nWKBSize)
         pabyWkb, nWKBSize, iOffsetInOut, /* nRec = */ 0);
 }
 
+/************************************************************************/
+/*                    OGRWKBTransformBatch::Clear()                     */
+/************************************************************************/
+
+void OGRWKBTransformBatch::Clear()
+{
+    m_asSeqs.clear();
+    m_anGeomFirstSeq.clear();
+    m_adfX.clear();
+    m_adfY.clear();
+    m_adfZ.clear();
+    m_abSuccess.clear();
+}
+
+/************************************************************************/
+/*               OGRWKBTransformBatch::AddPointSequence()               */
+/************************************************************************/
+
+void OGRWKBTransformBatch::AddPointSequence(GByte *pabyData, uint32_t nPoints,
+                                            int nDim, bool bHasZ,
+                                            bool bNeedSwap, bool bIsRing)
+{
+    PointSequence sSeq;
+    sSeq.pabyData = pabyData;
+    sSeq.nFirstPoint = m_adfX.size();
+    sSeq.nPoints = nPoints;
+    sSeq.nDim = nDim;
+    sSeq.bHasZ = bHasZ;
+    sSeq.bNeedSwap = bNeedSwap;
+    sSeq.bIsRing = bIsRing;
+    m_asSeqs.push_back(sSeq);
+
+    const size_t nPointSize = nDim * sizeof(double);
+    for (uint32_t i = 0; i < nPoints; ++i)
+    {
+        const GByte *pabyPoint = pabyData + i * nPointSize;
+        m_adfX.push_back(OGRWKBReadFloat64(pabyPoint, bNeedSwap));
+        m_adfY.push_back(OGRWKBReadFloat64(pabyPoint + sizeof(double),
+                                           bNeedSwap));
+        // Like OGRGeometry::transform(), use z=0 for 2D geometries
+        m_adfZ.push_back(bHasZ ? OGRWKBReadFloat64(
+                                     pabyPoint + 2 * sizeof(double), bNeedSwap)
+                               : 0.0);
+    }
+}
+
+/************************************************************************/
+/*              OGRWKBTransformBatch::AddGeometryInternal()             */
+/************************************************************************/
+
+bool OGRWKBTransformBatch::AddGeometryInternal(GByte *data, size_t size,
+                                               size_t &iOffsetInOut,
+                                               const int nRec)
+{
+    if (size - iOffsetInOut < MIN_WKB_SIZE)
+    {
+        return false;
+    }
+    const int nByteOrder = DB2_V72_FIX_BYTE_ORDER(data[iOffsetInOut]);
+    if (!(nByteOrder == wkbXDR || nByteOrder == wkbNDR))
+    {
+        return false;
+    }
+    const OGRwkbByteOrder eByteOrder = static_cast<OGRwkbByteOrder>(nByteOrder);
+    const bool bNeedSwap = OGR_SWAP(eByteOrder);
+
+    OGRwkbGeometryType eGeometryType = wkbUnknown;
+    if (OGRReadWKBGeometryType(data + iOffsetInOut, wkbVariantIso,
+                               &eGeometryType) != OGRERR_NONE)
+    {
+        return false;
+    }
+    iOffsetInOut += 5;
+    const auto eFlatType = wkbFlatten(eGeometryType);
+    const bool bHasZ = CPL_TO_BOOL(OGR_GT_HasZ(eGeometryType));
+    const int nDim = 2 + (bHasZ ? 1 : 0) +
+                     (OGR_GT_HasM(eGeometryType) ? 1 : 0);
+    const size_t nPointSize = nDim * sizeof(double);
+
+    if (eFlatType == wkbPoint)
+    {
+        if (size - iOffsetInOut < nPointSize)
+            return false;
+        GByte *pabyPoint = data + iOffsetInOut;
+        iOffsetInOut += nPointSize;
+        // Empty points are encoded with NaN coordinates
+        if (!(std::isnan(OGRWKBReadFloat64(pabyPoint, bNeedSwap)) &&
+              std::isnan(
+                  OGRWKBReadFloat64(pabyPoint + sizeof(double), bNeedSwap))))
+        {
+            AddPointSequence(pabyPoint, 1, nDim, bHasZ, bNeedSwap, false);
+        }
+        return true;
+    }
+
+    if (eFlatType == wkbLineString || eFlatType == wkbCircularString)
+    {
+        if (size - iOffsetInOut < sizeof(uint32_t))
+            return false;
+        const uint32_t nPoints =
+            OGRWKBReadUInt32AtOffset(data, eByteOrder, iOffsetInOut);
+        if (nPoints > (size - iOffsetInOut) / nPointSize)
+            return false;
+        AddPointSequence(data + iOffsetInOut, nPoints, nDim, bHasZ, bNeedSwap,
+                         false);
+        iOffsetInOut += nPoints * nPointSize;
+        return true;
+    }
+
+    if (eFlatType == wkbPolygon || eFlatType == wkbTriangle)
+    {
+        if (size - iOffsetInOut < sizeof(uint32_t))
+            return false;
+        const uint32_t nRings =
+            OGRWKBReadUInt32AtOffset(data, eByteOrder, iOffsetInOut);
+        if (nRings > (size - iOffsetInOut) / sizeof(uint32_t))
+            return false;
+        for (uint32_t iRing = 0; iRing < nRings; ++iRing)
+        {
+            if (size - iOffsetInOut < sizeof(uint32_t))
+                return false;
+            const uint32_t nPoints =
+                OGRWKBReadUInt32AtOffset(data, eByteOrder, iOffsetInOut);
+            if (nPoints > (size - iOffsetInOut) / nPointSize)
+                return false;
+            AddPointSequence(data + iOffsetInOut, nPoints, nDim, bHasZ,
+                             bNeedSwap, true);
+            iOffsetInOut += nPoints * nPointSize;
+        }
+        return true;
+    }
+
+    if (eFlatType == wkbMultiPoint || eFlatType == wkbMultiLineString ||
+        eFlatType == wkbMultiPolygon || eFlatType == wkbGeometryCollection ||
+        eFlatType == wkbCompoundCurve || eFlatType == wkbCurvePolygon ||
+        eFlatType == wkbMultiCurve || eFlatType == wkbMultiSurface ||
+        eFlatType == wkbPolyhedralSurface || eFlatType == wkbTIN)
+    {
+        if (nRec == 128)
+            return false;
+        if (size - iOffsetInOut < sizeof(uint32_t))
+            return false;
+        const uint32_t nParts =
+            OGRWKBReadUInt32AtOffset(data, eByteOrder, iOffsetInOut);
+        if (nParts > (size - iOffsetInOut) / MIN_WKB_SIZE)
+            return false;
+        for (uint32_t k = 0; k < nParts; k++)
+        {
+            if (!AddGeometryInternal(data, size, iOffsetInOut, nRec + 1))
+                return false;
+        }
+        return true;
+    }
+
+    return false;
+}
+
+/************************************************************************/
+/*                  OGRWKBTransformBatch::AddGeometry()                 */
+/************************************************************************/
+
+bool OGRWKBTransformBatch::AddGeometry(GByte *pabyWkb, size_t nWKBSize)
+{
+    const size_t nSeqCountBefore = m_asSeqs.size();
+    const size_t nPointCountBefore = m_adfX.size();
+    size_t iOffset = 0;
+    if (!AddGeometryInternal(pabyWkb, nWKBSize, iOffset, /* nRec = */ 0))
+    {
+        m_asSeqs.resize(nSeqCountBefore);
+        m_adfX.resize(nPointCountBefore);
+        m_adfY.resize(nPointCountBefore);
+        m_adfZ.resize(nPointCountBefore);
+        return false;
+    }
+    m_anGeomFirstSeq.push_back(nSeqCountBefore);
+    return true;
+}
+
+/************************************************************************/
+/*                   OGRWKBTransformBatch::WriteBack()                  */
+/************************************************************************/
+
+void OGRWKBTransformBatch::WriteBack(const PointSequence &sSeq)
+{
+    const size_t nPointSize = sSeq.nDim * sizeof(double);
+    const size_t nCoordsSize = (sSeq.bHasZ ? 3 : 2) * sizeof(double);
+
+    // Same as OGRLinearRing::transform(): if a closed ring is no longer
+    // closed after reprojection, force its last point to be the first one.
+    if (sSeq.bIsRing && sSeq.nPoints > 2)
+    {
+        GByte *pabyFirst = sSeq.pabyData;
+        GByte *pabyLast = sSeq.pabyData + (sSeq.nPoints - 1) * nPointSize;
+        const size_t iFirst = sSeq.nFirstPoint;
+        const size_t iLast = sSeq.nFirstPoint + sSeq.nPoints - 1;
+        if (memcmp(pabyFirst, pabyLast, nCoordsSize) == 0 &&
+            (m_adfX[iFirst] != m_adfX[iLast] ||
+             m_adfY[iFirst] != m_adfY[iLast] ||
+             (sSeq.bHasZ && m_adfZ[iFirst] != m_adfZ[iLast])))
+        {
+            m_adfX[iLast] = m_adfX[iFirst];
+            m_adfY[iLast] = m_adfY[iFirst];
+            m_adfZ[iLast] = m_adfZ[iFirst];
+            memcpy(pabyLast, pabyFirst, nPointSize);
+        }
+    }
+
+    for (uint32_t i = 0; i < sSeq.nPoints; ++i)
+    {
+        double adfXYZ[3] = {m_adfX[sSeq.nFirstPoint + i],
+                            m_adfY[sSeq.nFirstPoint + i],
+                            m_adfZ[sSeq.nFirstPoint + i]};
+        if (sSeq.bNeedSwap)
+        {
+            CPL_SWAP64PTR(&adfXYZ[0]);
+            CPL_SWAP64PTR(&adfXYZ[1]);
+            CPL_SWAP64PTR(&adfXYZ[2]);
+        }
+        memcpy(sSeq.pabyData + i * nPointSize, adfXYZ, nCoordsSize);
+    }
+}
+
+/************************************************************************/
+/*                   OGRWKBTransformBatch::Transform()                  */
+/************************************************************************/
+
+bool OGRWKBTransformBatch::Transform(OGRCoordinateTransformation *poCT,
+                                     int nThreads)
+{
+    const size_t nGeoms = m_anGeomFirstSeq.size();
+    m_abSuccess.clear();
+    m_abSuccess.resize(nGeoms, false);
+
+    std::vector<int> anErrorCodes(m_adfX.size());
+    const bool bRet =
+        m_adfX.empty() ||
+        poCT->TransformParallel(m_adfX.size(), m_adfX.data(), m_adfY.data(),
+                                m_adfZ.data(), nullptr, anErrorCodes.data(),
+                                nThreads) != FALSE;
+
+    for (size_t iGeom = 0; iGeom < nGeoms; ++iGeom)
+    {
+        const size_t iFirstSeq = m_anGeomFirstSeq[iGeom];
+        const size_t iEndSeq = iGeom + 1 < nGeoms ? m_anGeomFirstSeq[iGeom + 1]
+                                                  : m_asSeqs.size();
+        bool bSuccess = true;
+        if (iFirstSeq < iEndSeq)
+        {
+            const size_t iFirstPoint = m_asSeqs[iFirstSeq].nFirstPoint;
+            const size_t iEndPoint = iEndSeq < m_asSeqs.size()
+                                         ? m_asSeqs[iEndSeq].nFirstPoint
+                                         : m_adfX.size();
+            for (size_t i = iFirstPoint; bSuccess && i < iEndPoint; ++i)
+                bSuccess = bRet && anErrorCodes[i] == 0;
+            if (bSuccess)
+            {
+                for (size_t iSeq = iFirstSeq; iSeq < iEndSeq; ++iSeq)
+                    WriteBack(m_asSeqs[iSeq]);
+            }
+        }
+        m_abSuccess[iGeom] = bSuccess;
+    }
+
+    return bRet;
+}
+
 /************************************************************************/
 /*                         OGRAppendBuffer()                            */
 /************************************************************************/
@@ -32,6 +32,10 @@
 #include "cpl_port.h"
 #include "ogr_core.h"
 
+#include <vector>
+
+class OGRCoordinateTransformation;
+
 bool CPL_DLL OGRWKBGetGeomType(const GByte *pabyWkb, size_t nWKBSize,
                                bool &bNeedSwap, uint32_t &nType);
 bool OGRWKBPolygonGetArea(const GByte *&pabyWkb, size_t &nWKBSize,
@@ -45,9 +49,29 @@ bool CPL_DLL OGRWKBGetBoundingBox(const GByte *pabyWkb, size_t nWKBSize,
 bool CPL_DLL OGRWKBGetBoundingBox(const GByte *pabyWkb, size_t nWKBSize,
                                   OGREnvelope &sEnvelope);
 
+void CPL_DLL OGRExtendEnvelopeXY(const void *pData, size_t nStride,
+                                 size_t nPoints, OGREnvelope &sEnvelope);
+
 bool CPL_DLL OGRWKBIntersectsPessimistic(const GByte *pabyWkb, size_t nWKBSize,
                                          const OGREnvelope &sEnvelope);
 
+bool CPL_DLL OGRWKBIntersectsEnvelope(const GByte *pabyWkb, size_t nWKBSize,
+                                      const OGREnvelope &sEnvelope,
+                                      bool &bIntersects);
+
+bool CPL_DLL OGRWKBIntersectsPoint(const GByte *pabyWkb, size_t nWKBSize,
+                                   double dfX, double dfY, bool &bIntersects);
+
+bool CPL_DLL OGRWKBGetDistanceToPoint(const GByte *pabyWkb, size_t nWKBSize,
+                                      double dfX, double dfY,
+                                      double &dfDistance);
+
+bool CPL_DLL OGRWKBGetLength(const GByte *pabyWkb, size_t nWKBSize,
+                             double &dfLength);
+
+bool CPL_DLL OGRWKBGetArea(const GByte *pabyWkb, size_t nWKBSize,
+                           double &dfArea);
+
 void CPL_DLL OGRWKBFixupCounterClockWiseExternalRing(GByte *pabyWkb,
                                                      size_t nWKBSize);
 
@@ -62,6 +86,86 @@ void CPL_DLL OGRWKBFixupCounterClockWiseExternalRing(GByte *pabyWkb,
 const GByte CPL_DLL *WKBFromEWKB(GByte *pabyEWKB, size_t nEWKBSize,
                                  size_t &nWKBSizeOut, int *pnSRIDOut);
 
+/************************************************************************/
+/*                       OGRWKBTransformBatch                           */
+/************************************************************************/
+
+/** Reprojects in place the coordinates of a batch of WKB geometries, with a
+ * single OGRCoordinateTransformation::TransformParallel() call.
+ *
+ * The coordinates of a geometry are only modified if all its points could
+ * be transformed, so that the caller can fall back to
+ * OGRGeometry::transform() for the others.
+ */
+class CPL_DLL OGRWKBTransformBatch
+{
+  public:
+    /** Constructor */
+    OGRWKBTransformBatch() = default;
+
+    /** Remove all geometries from the batch. */
+    void Clear();
+
+    /** Add a geometry to the batch. The buffer must remain valid until
+     * Transform() has been called.
+     *
+     * Returns false if the WKB geometry is invalid or of an unhandled type,
+     * in which case it is not added.
+     */
+    bool AddGeometry(GByte *pabyWkb, size_t nWKBSize);
+
+    /** Return the number of geometries of the batch. */
+    size_t GetGeometryCount() const
+    {
+        return m_anGeomFirstSeq.size();
+    }
+
+    /** Return the number of points of the batch. */
+    size_t GetPointCount() const
+    {
+        return m_adfX.size();
+    }
+
+    /** Transform the geometries of the batch.
+     *
+     * Returns false if the transformation failed as a whole.
+     */
+    bool Transform(OGRCoordinateTransformation *poCT, int nThreads = 0);
+
+    /** Return whether the iGeom-th added geometry has been transformed by
+     * the last Transform() call.
+     */
+    bool GetSuccess(size_t iGeom) const
+    {
+        return m_abSuccess[iGeom];
+    }
+
+  private:
+    struct PointSequence
+    {
+        GByte *pabyData = nullptr;
+        size_t nFirstPoint = 0;
+        uint32_t nPoints = 0;
+        int nDim = 2;
+        bool bHasZ = false;
+        bool bNeedSwap = false;
+        bool bIsRing = false;
+    };
+
+    std::vector<PointSequence> m_asSeqs{};
+    std::vector<size_t> m_anGeomFirstSeq{};
+    std::vector<double> m_adfX{};
+    std::vector<double> m_adfY{};
+    std::vector<double> m_adfZ{};
+    std::vector<bool> m_abSuccess{};
+
+    bool AddGeometryInternal(GByte *pabyWkb, size_t nWKBSize, size_t &iOffset,
+                             int nRec);
+    void AddPointSequence(GByte *pabyData, uint32_t nPoints, int nDim,
+                          bool bHasZ, bool bNeedSwap, bool bIsRing);
+    void WriteBack(const PointSequence &sSeq);
+};
+
 /************************************************************************/
 /*                       OGRAppendBuffer                                */
 /************************************************************************/
@@ -550,6 +550,8 @@ void OGRCircularString::segmentize(double dfMaxLength)
     // Is there actually something to modify?
     if (nPointCount < static_cast<int>(aoRawPoint.size()))
     {
+        if (!MakePointsOwned())
+            return;
         nPointCount = static_cast<int>(aoRawPoint.size());
         paoPoints = static_cast<OGRRawPoint *>(
             CPLRealloc(paoPoints, sizeof(OGRRawPoint) * nPointCount));
@@ -36,12 +36,17 @@
 #include <cstring>
 #include <limits>
 #include <list>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_mem_cache.h"
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 #include "ogr_core.h"
 #include "ogr_srs_api.h"
 #include "ogr_proj_p.h"
@@ -85,12 +90,14 @@ static void CPLGettimeofday(struct CPLTimeVal *tp, void * /* timezonep*/)
 
 #endif  // DEBUG_PERF
 
-// Cache of OGRProjCT objects
+// Cache of OGRProjCT objects, used as templates to clone new instances from
 static std::mutex g_oCTCacheMutex;
 class OGRProjCT;
 typedef std::string CTCacheKey;
 typedef std::unique_ptr<OGRProjCT> CTCacheValue;
 static lru11::Cache<CTCacheKey, CTCacheValue> *g_poCTCache = nullptr;
+static GIntBig g_nCTCacheHits = 0;
+static GIntBig g_nCTCacheMisses = 0;
 
 /************************************************************************/
 /*             OGRCoordinateTransformationOptions::Private              */
@@ -863,7 +870,7 @@ class OGRProjCT : public OGRCoordinateTransformation
 
     OGRCoordinateTransformation *GetInverse() const override;
 
-    static void InsertIntoCache(OGRProjCT *poCT);
+    static void InsertIntoCache(const OGRProjCT *poCT);
 
     static OGRProjCT *
     FindFromCache(const OGRSpatialReference *poSource, const char *pszSrcSRS,
@@ -916,15 +923,7 @@ OCTDestroyCoordinateTransformation(OGRCoordinateTransformationH hCT)
 
 void OGRCoordinateTransformation::DestroyCT(OGRCoordinateTransformation *poCT)
 {
-    auto poProjCT = dynamic_cast<OGRProjCT *>(poCT);
-    if (poProjCT)
-    {
-        OGRProjCT::InsertIntoCache(poProjCT);
-    }
-    else
-    {
-        delete poCT;
-    }
+    delete poCT;
 }
 
 /************************************************************************/
@@ -1039,8 +1038,12 @@ OGRCoordinateTransformation *OGRCreateCoordinateTransformation(
     if (poCT == nullptr)
     {
         poCT = new OGRProjCT();
-        if (!poCT->Initialize(poSource, pszSrcSRS, poTarget, pszTargetSRS,
-                              options))
+        if (poCT->Initialize(poSource, pszSrcSRS, poTarget, pszTargetSRS,
+                             options))
+        {
+            OGRProjCT::InsertIntoCache(poCT);
+        }
+        else
         {
             delete poCT;
             poCT = nullptr;
@@ -2258,6 +2261,114 @@ int OGRCoordinateTransformation::TransformWithErrorCodes(size_t nCount,
     return bOverallSuccess;
 }
 
+/************************************************************************/
+/*                         TransformParallel()                          */
+/************************************************************************/
+
+namespace
+{
+struct OGRCTParallelJob
+{
+    OGRCoordinateTransformation *poCT = nullptr;
+    size_t nCount = 0;
+    double *x = nullptr;
+    double *y = nullptr;
+    double *z = nullptr;
+    double *t = nullptr;
+    int *panErrorCodes = nullptr;
+    int bRet = FALSE;
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+
+    void Run()
+    {
+        bRet = poCT->TransformWithErrorCodes(nCount, x, y, z, t, panErrorCodes);
+    }
+
+    static void RunInWorker(void *pData)
+    {
+        auto psJob = static_cast<OGRCTParallelJob *>(pData);
+        CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+        psJob->Run();
+        CPLUninstallErrorHandlerAccumulator();
+    }
+};
+}  // namespace
+
+int OGRCoordinateTransformation::TransformParallel(size_t nCount, double *x,
+                                                   double *y, double *z,
+                                                   double *t,
+                                                   int *panErrorCodes,
+                                                   int nThreads)
+{
+    // Below that number of points per thread, the cost of cloning the
+    // transformation and of the thread synchronization dominates.
+    constexpr size_t MIN_POINTS_PER_THREAD = 10000;
+
+    if (nThreads <= 0)
+    {
+        const char *pszThreads =
+            CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS");
+        if (EQUAL(pszThreads, "ALL_CPUS"))
+            nThreads = CPLGetNumCPUs();
+        else
+            nThreads = atoi(pszThreads);
+    }
+    nThreads = GDALCapThreadCount(std::min(nThreads, 128));
+    nThreads = static_cast<int>(std::min(
+        static_cast<size_t>(std::max(nThreads, 1)),
+        std::max<size_t>(1, nCount / MIN_POINTS_PER_THREAD)));
+
+    CPLWorkerThreadPool *poPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    std::unique_ptr<CPLJobQueue> poQueue;
+    if (poPool)
+        poQueue = poPool->CreateJobQueue();
+    if (!poQueue)
+        return TransformWithErrorCodes(nCount, x, y, z, t, panErrorCodes);
+
+    std::vector<std::unique_ptr<OGRCoordinateTransformation>> apoClones;
+    for (int i = 1; i < nThreads; ++i)
+    {
+        apoClones.emplace_back(Clone());
+        if (!apoClones.back())
+            return TransformWithErrorCodes(nCount, x, y, z, t, panErrorCodes);
+        apoClones.back()->SetEmitErrors(GetEmitErrors());
+    }
+
+    std::vector<OGRCTParallelJob> asJobs(nThreads);
+    const size_t nChunkSize = (nCount + nThreads - 1) / nThreads;
+    for (int i = 0; i < nThreads; ++i)
+    {
+        auto &sJob = asJobs[i];
+        const size_t nStart = i * nChunkSize;
+        sJob.poCT = i == 0 ? this : apoClones[i - 1].get();
+        sJob.nCount = std::min(nChunkSize, nCount - nStart);
+        sJob.x = x + nStart;
+        sJob.y = y + nStart;
+        sJob.z = z ? z + nStart : nullptr;
+        sJob.t = t ? t + nStart : nullptr;
+        sJob.panErrorCodes = panErrorCodes ? panErrorCodes + nStart : nullptr;
+    }
+
+    for (int i = 1; i < nThreads; ++i)
+    {
+        if (!poQueue->SubmitJob(OGRCTParallelJob::RunInWorker, &asJobs[i]))
+            OGRCTParallelJob::RunInWorker(&asJobs[i]);
+    }
+    asJobs[0].Run();
+    poQueue->WaitCompletion();
+
+    int bRet = TRUE;
+    for (const auto &sJob : asJobs)
+    {
+        for (const auto &oError : sJob.aoErrors)
+            CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+        if (!sJob.bRet)
+            bRet = FALSE;
+    }
+    return bRet;
+}
+
 /************************************************************************/
 /*                             Transform()                             */
 /************************************************************************/
@@ -3616,6 +3727,43 @@ void OSRCTCleanCache()
     g_poCTCache = nullptr;
 }
 
+//! @endcond
+
+/************************************************************************/
+/*                       OCTGetCacheStatistics()                        */
+/************************************************************************/
+
+/**
+ * \brief Return statistics on the cache of coordinate transformations.
+ *
+ * OGRCreateCoordinateTransformation() keeps a pristine copy of the
+ * transformations it creates, keyed by the definition of the source and
+ * target CRS (including their data axis to SRS axis mapping and coordinate
+ * epoch) and by the transformation options. Subsequent requests for the same
+ * transformation return a copy of it, which avoids the potentially costly
+ * search of the candidate coordinate operations.
+ *
+ * The cache holds at most 256 transformations by default, which can be
+ * changed with the OSR_CT_CACHE_SIZE configuration option (0 to disable the
+ * cache). The option is read when the cache is first used.
+ *
+ * @param pnHits Pointer to the number of requests served from the cache, or
+ *               NULL.
+ * @param pnMisses Pointer to the number of requests that required the
+ *                 instantiation of a new transformation, or NULL.
+ * @since GDAL 3.10
+ */
+void OCTGetCacheStatistics(GIntBig *pnHits, GIntBig *pnMisses)
+{
+    std::lock_guard<std::mutex> oGuard(g_oCTCacheMutex);
+    if (pnHits)
+        *pnHits = g_nCTCacheHits;
+    if (pnMisses)
+        *pnMisses = g_nCTCacheMisses;
+}
+
+//! @cond Doxygen_Suppress
+
 /************************************************************************/
 /*                          MakeCacheKey()                              */
 /************************************************************************/
@@ -3636,6 +3784,12 @@ CTCacheKey OGRProjCT::MakeCacheKey(
             {
                 ret += std::to_string(axis);
             }
+            const double dfEpoch = poSRS->GetCoordinateEpoch();
+            if (dfEpoch > 0)
+            {
+                ret += '@';
+                ret += std::to_string(dfEpoch);
+            }
             return ret;
         }
         else
@@ -3654,26 +3808,29 @@ CTCacheKey OGRProjCT::MakeCacheKey(
 /*                           InsertIntoCache()                          */
 /************************************************************************/
 
-void OGRProjCT::InsertIntoCache(OGRProjCT *poCT)
+// Insert a copy of poCT, that must not have been used yet, as the template
+// for the transformations with the same source, target and options.
+void OGRProjCT::InsertIntoCache(const OGRProjCT *poCT)
 {
     {
         std::lock_guard<std::mutex> oGuard(g_oCTCacheMutex);
         if (g_poCTCache == nullptr)
         {
-            g_poCTCache = new lru11::Cache<CTCacheKey, CTCacheValue>();
+            const int nSize = std::max(
+                0, atoi(CPLGetConfigOption("OSR_CT_CACHE_SIZE", "256")));
+            g_poCTCache = new lru11::Cache<CTCacheKey, CTCacheValue>(nSize, 0);
         }
+        if (g_poCTCache->getMaxSize() == 0)
+            return;
     }
     const auto key = MakeCacheKey(poCT->poSRSSource, poCT->m_osSrcSRS.c_str(),
                                   poCT->poSRSTarget,
                                   poCT->m_osTargetSRS.c_str(), poCT->m_options);
 
+    std::unique_ptr<OGRProjCT> poTemplate(new OGRProjCT(*poCT));
     std::lock_guard<std::mutex> oGuard(g_oCTCacheMutex);
-    if (g_poCTCache->contains(key))
-    {
-        delete poCT;
-        return;
-    }
-    g_poCTCache->insert(key, std::unique_ptr<OGRProjCT>(poCT));
+    if (!g_poCTCache->contains(key))
+        g_poCTCache->insert(key, std::move(poTemplate));
 }
 
 /************************************************************************/
@@ -3688,20 +3845,23 @@ OGRProjCT *OGRProjCT::FindFromCache(
     {
         std::lock_guard<std::mutex> oGuard(g_oCTCacheMutex);
         if (g_poCTCache == nullptr || g_poCTCache->empty())
+        {
+            ++g_nCTCacheMisses;
             return nullptr;
+        }
     }
 
     const auto key =
         MakeCacheKey(poSource, pszSrcSRS, poTarget, pszTargetSRS, options);
-    // Get value from cache and remove it
+    // Return a copy of the cached template, which stays in the cache
     std::lock_guard<std::mutex> oGuard(g_oCTCacheMutex);
     CTCacheValue *cachedValue = g_poCTCache->getPtr(key);
     if (cachedValue)
     {
-        auto poCT = cachedValue->release();
-        g_poCTCache->remove(key);
-        return poCT;
+        ++g_nCTCacheHits;
+        return new OGRProjCT(**cachedValue);
     }
+    ++g_nCTCacheMisses;
     return nullptr;
 }
 
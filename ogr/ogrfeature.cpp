@@ -43,6 +43,7 @@
 #include <limits>
 #include <map>
 #include <new>
+#include <utility>
 #include <vector>
 
 #include "cpl_conv.h"
@@ -375,6 +376,32 @@ void OGRFeature::Reset()
     }
 }
 
+/************************************************************************/
+/*                            SwapContent()                             */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+/** Exchange the FID, field values, geometries, style and native data of
+ * this feature with the ones of another feature sharing the same
+ * definition.
+ *
+ * This is used by OGRLayer::GetNextFeatureInto() to hand over the content
+ * of a freshly read feature to a caller-owned feature without copying.
+ */
+void OGRFeature::SwapContent(OGRFeature &oOther)
+{
+    CPLAssert(poDefn == oOther.poDefn);
+    std::swap(nFID, oOther.nFID);
+    std::swap(pauFields, oOther.pauFields);
+    std::swap(papoGeometries, oOther.papoGeometries);
+    std::swap(m_pszStyleString, oOther.m_pszStyleString);
+    std::swap(m_poStyleTable, oOther.m_poStyleTable);
+    std::swap(m_pszNativeData, oOther.m_pszNativeData);
+    std::swap(m_pszNativeMediaType, oOther.m_pszNativeMediaType);
+}
+
+//! @endcond
+
 /************************************************************************/
 /*                        SetFDefnUnsafe()                              */
 /************************************************************************/
@@ -31,8 +31,12 @@
 #include "ogr_feature.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstring>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -59,7 +63,82 @@
  * need to be unique.
  */
 
+/************************************************************************/
+/*                    OGRFeatureDefn::NameIndex                         */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+
+static std::atomic<unsigned> gnFieldNameChangeCounter{0};
+
+void OGRIncrementFieldNameChangeCounter()
+{
+    ++gnFieldNameChangeCounter;
+}
+
+unsigned OGRGetFieldNameChangeCounter()
+{
+    return gnFieldNameChangeCounter.load();
+}
+
+// Below that number of fields, a linear search is as fast as the index
+constexpr int MIN_FIELD_COUNT_FOR_NAME_INDEX = 16;
+
+// Maps the lower-cased name of fields to the index of the first one with
+// that name. It is rebuilt on demand when fields have been added, removed,
+// reordered or renamed since it was last built. The mutex is there because
+// several threads may look up fields of a same definition concurrently.
+struct OGRFeatureDefn::NameIndex
+{
+    std::mutex oMutex{};
+    bool bValid = false;
+    int nFieldCount = 0;
+    unsigned nNameChangeCounter = 0;
+    std::unordered_map<std::string, int> oMap{};
+
+    void Invalidate()
+    {
+        std::lock_guard<std::mutex> oLock(oMutex);
+        bValid = false;
+    }
+
+    template <class GetNameFunc>
+    int Find(const char *pszName, int nFieldCountIn, GetNameFunc pfnGetName)
+    {
+        CPLString osKey(pszName);
+        osKey.tolower();
+
+        std::lock_guard<std::mutex> oLock(oMutex);
+        const unsigned nCurNameChangeCounter = OGRGetFieldNameChangeCounter();
+        if (!bValid || nFieldCount != nFieldCountIn ||
+            nNameChangeCounter != nCurNameChangeCounter)
+        {
+            oMap.clear();
+            for (int i = 0; i < nFieldCountIn; ++i)
+            {
+                const char *pszFieldName = pfnGetName(i);
+                if (pszFieldName)
+                {
+                    CPLString osFieldKey(pszFieldName);
+                    osFieldKey.tolower();
+                    oMap.emplace(std::move(osFieldKey), i);
+                }
+            }
+            bValid = true;
+            nFieldCount = nFieldCountIn;
+            nNameChangeCounter = nCurNameChangeCounter;
+        }
+
+        const auto oIter = oMap.find(osKey);
+        return oIter == oMap.end() ? -1 : oIter->second;
+    }
+};
+
+//! @endcond
+
 OGRFeatureDefn::OGRFeatureDefn(const char *pszName)
+    : m_poFieldNameIndex(std::make_unique<NameIndex>()),
+      m_poGeomFieldNameIndex(std::make_unique<NameIndex>())
 {
     pszFeatureClassName = CPLStrdup(pszName);
     apoGeomFieldDefn.emplace_back(
@@ -430,6 +509,7 @@ void OGRFeatureDefn::AddFieldDefn(const OGRFieldDefn *poNewDefn)
         return;
     }
     apoFieldDefn.emplace_back(std::make_unique<OGRFieldDefn>(poNewDefn));
+    m_poFieldNameIndex->Invalidate();
 }
 
 /************************************************************************/
@@ -494,6 +574,7 @@ OGRErr OGRFeatureDefn::DeleteFieldDefn(int iField)
         return OGRERR_FAILURE;
 
     apoFieldDefn.erase(apoFieldDefn.begin() + iField);
+    m_poFieldNameIndex->Invalidate();
     return OGRERR_NONE;
 }
 
@@ -571,6 +652,7 @@ OGRErr OGRFeatureDefn::ReorderFieldDefns(const int *panMap)
         apoFieldDefnNew[i] = std::move(apoFieldDefn[panMap[i]]);
     }
     apoFieldDefn = std::move(apoFieldDefnNew);
+    m_poFieldNameIndex->Invalidate();
     return OGRERR_NONE;
 }
 
@@ -777,6 +859,7 @@ void OGRFeatureDefn::AddGeomFieldDefn(const OGRGeomFieldDefn *poNewDefn)
     }
     apoGeomFieldDefn.emplace_back(
         std::make_unique<OGRGeomFieldDefn>(poNewDefn));
+    m_poGeomFieldNameIndex->Invalidate();
 }
 
 /**
@@ -799,6 +882,7 @@ void OGRFeatureDefn::AddGeomFieldDefn(
     std::unique_ptr<OGRGeomFieldDefn> &&poNewDefn)
 {
     apoGeomFieldDefn.emplace_back(std::move(poNewDefn));
+    m_poGeomFieldNameIndex->Invalidate();
 }
 
 /************************************************************************/
@@ -868,6 +952,7 @@ OGRErr OGRFeatureDefn::DeleteGeomFieldDefn(int iGeomField)
         return OGRERR_FAILURE;
 
     apoGeomFieldDefn.erase(apoGeomFieldDefn.begin() + iGeomField);
+    m_poGeomFieldNameIndex->Invalidate();
     return OGRERR_NONE;
 }
 
@@ -922,6 +1007,17 @@ int OGRFeatureDefn::GetGeomFieldIndex(const char *pszGeomFieldName) const
 
 {
     const int nGeomFieldCount = GetGeomFieldCount();
+    if (nGeomFieldCount >= MIN_FIELD_COUNT_FOR_NAME_INDEX)
+    {
+        return m_poGeomFieldNameIndex->Find(
+            pszGeomFieldName, nGeomFieldCount,
+            [this](int i) -> const char *
+            {
+                const OGRGeomFieldDefn *poGFldDefn = GetGeomFieldDefn(i);
+                return poGFldDefn ? poGFldDefn->GetNameRef() : nullptr;
+            });
+    }
+
     for (int i = 0; i < nGeomFieldCount; i++)
     {
         const OGRGeomFieldDefn *poGFldDefn = GetGeomFieldDefn(i);
@@ -1231,6 +1327,17 @@ int OGRFeatureDefn::GetFieldIndex(const char *pszFieldName) const
 
 {
     const int nFieldCount = GetFieldCount();
+    if (nFieldCount >= MIN_FIELD_COUNT_FOR_NAME_INDEX)
+    {
+        return m_poFieldNameIndex->Find(
+            pszFieldName, nFieldCount,
+            [this](int i) -> const char *
+            {
+                const OGRFieldDefn *poFDefn = GetFieldDefn(i);
+                return poFDefn ? poFDefn->GetNameRef() : nullptr;
+            });
+    }
+
     for (int i = 0; i < nFieldCount; i++)
     {
         const OGRFieldDefn *poFDefn = GetFieldDefn(i);
@@ -32,12 +32,17 @@
 #include "ogr_feature.h"
 #include "ogr_swq.h"
 
+#include <climits>
+#include <cmath>
 #include <cstddef>
 #include <cstdlib>
+#include <cstring>
 #include <algorithm>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_safemaths.hpp"
 #include "cpl_string.h"
 #include "ogr_attrind.h"
 #include "ogr_core.h"
@@ -56,6 +61,101 @@ const char *const SpecialFieldNames[SPECIAL_FIELD_COUNT] = {
 const swq_field_type SpecialFieldTypes[SPECIAL_FIELD_COUNT] = {
     SWQ_INTEGER, SWQ_STRING, SWQ_STRING, SWQ_STRING, SWQ_FLOAT};
 
+/************************************************************************/
+/*                        OGRFeatureQueryProgram                        */
+/************************************************************************/
+
+/** Flat bytecode version of a swq expression tree, evaluated on a feature
+ * with typed registers and no per-feature allocation.
+ *
+ * Only a subset of expressions is compiled: logical operators, comparisons,
+ * BETWEEN, IN, LIKE, ILIKE, IS NULL and arithmetic on integer, real and
+ * string attribute fields and constants. Compile() returns nullptr for other
+ * expressions, which are evaluated by swq_expr_node::Evaluate(). The
+ * semantics (type promotion, null propagation, comparison rules) are those
+ * of SWQGeneralEvaluator().
+ */
+class OGRFeatureQueryProgram
+{
+  public:
+    static OGRFeatureQueryProgram *Compile(const swq_expr_node *poNode,
+                                           OGRFeatureDefn *poDefn);
+
+    /** Return 1 or 0 with the result of the evaluation, or -1 if the feature
+     * is not of the expected feature definition. */
+    int Execute(const OGRFeature *poFeature, bool bUTF8Strings);
+
+  private:
+    enum class Op
+    {
+        LOAD_INT,
+        LOAD_INT64,
+        LOAD_FLOAT,
+        LOAD_STRING,
+        LOAD_NULL_FLAG,
+        INT_TO_FLOAT,
+        AND,
+        OR,
+        NOT,
+        ISNULL,
+        CMP_INT,
+        CMP_FLOAT,
+        CMP_STRING,
+        BETWEEN_INT,
+        BETWEEN_FLOAT,
+        BETWEEN_STRING,
+        IN_INT,
+        IN_FLOAT,
+        IN_STRING,
+        LIKE,
+        ARITH_INT,
+        ARITH_FLOAT,
+    };
+
+    struct Instruction
+    {
+        Op eOp = Op::LOAD_INT;
+        swq_op nOperation = SWQ_OR;  // comparison or arithmetic operation
+        int nDst = 0;
+        int nA = 0;  // first operand register, or field index for LOAD_xxx
+        int nB = 0;
+        int nC = 0;
+        int nFirstExtraOperand = 0;  // index in m_anExtraOperands for IN
+        int nExtraOperandCount = 0;
+        char chEscape = 0;  // for LIKE
+        bool bInsensitive = false;
+    };
+
+    struct Register
+    {
+        GIntBig nInt = 0;
+        double dfFloat = 0;
+        const char *pszStr = nullptr;
+        bool bNull = false;
+    };
+
+    OGRFeatureDefn *m_poDefn = nullptr;
+    std::vector<Instruction> m_aoInstructions{};
+    std::vector<Register> m_aoRegisters{};
+    std::vector<swq_field_type> m_aeRegisterTypes{};
+    std::vector<int> m_anExtraOperands{};
+    int m_nResultRegister = 0;
+
+    OGRFeatureQueryProgram() = default;
+
+    int NewRegister(swq_field_type eType);
+    int CompileNode(const swq_expr_node *poNode, int nRecLevel);
+    int CompileColumn(const swq_expr_node *poNode, bool bNullFlagOnly);
+    int CompileOperation(const swq_expr_node *poNode, int nRecLevel);
+    int ToFloat(int nReg);
+
+    static bool StringEqual(const char *pszA, const char *pszB);
+    template <class T>
+    static bool Compare(swq_op nOperation, T a, T b);
+    static bool CompareStrings(swq_op nOperation, const char *pszA,
+                               const char *pszB);
+};
+
 /************************************************************************/
 /*                          OGRFeatureQuery()                           */
 /************************************************************************/
@@ -73,6 +173,7 @@ OGRFeatureQuery::OGRFeatureQuery()
 OGRFeatureQuery::~OGRFeatureQuery()
 
 {
+    delete m_poProgram;
     delete m_psContext;
     delete static_cast<swq_expr_node *>(pSWQExpr);
 }
@@ -117,6 +218,8 @@ OGRFeatureQuery::Compile(OGRLayer *poLayer, OGRFeatureDefn *poDefn,
                          swq_custom_func_registrar *poCustomFuncRegistrar)
 {
     // Clear any existing expression.
+    delete m_poProgram;
+    m_poProgram = nullptr;
     if (pSWQExpr != nullptr)
     {
         delete static_cast<swq_expr_node *>(pSWQExpr);
@@ -243,6 +346,12 @@ OGRFeatureQuery::Compile(OGRLayer *poLayer, OGRFeatureDefn *poDefn,
         eErr = OGRERR_CORRUPT_DATA;
         pSWQExpr = nullptr;
     }
+    else if (CPLTestBool(
+                 CPLGetConfigOption("OGR_SQL_COMPILED_EXPRESSIONS", "YES")))
+    {
+        m_poProgram = OGRFeatureQueryProgram::Compile(
+            static_cast<swq_expr_node *>(pSWQExpr), poDefn);
+    }
 
     CPLFree(papszFieldNames);
     CPLFree(paeFieldTypes);
@@ -318,6 +427,652 @@ static swq_expr_node *OGRFeatureFetcher(swq_expr_node *op, void *pFeatureIn)
     return poRetNode;
 }
 
+/************************************************************************/
+/*                            NewRegister()                             */
+/************************************************************************/
+
+int OGRFeatureQueryProgram::NewRegister(swq_field_type eType)
+{
+    m_aoRegisters.emplace_back();
+    m_aeRegisterTypes.push_back(eType);
+    return static_cast<int>(m_aoRegisters.size()) - 1;
+}
+
+/************************************************************************/
+/*                              ToFloat()                               */
+/************************************************************************/
+
+/** Return a float register with the value of nReg, converted if needed. */
+int OGRFeatureQueryProgram::ToFloat(int nReg)
+{
+    if (m_aeRegisterTypes[nReg] == SWQ_FLOAT)
+        return nReg;
+    Instruction sInstr;
+    sInstr.eOp = Op::INT_TO_FLOAT;
+    sInstr.nA = nReg;
+    sInstr.nDst = NewRegister(SWQ_FLOAT);
+    m_aoInstructions.push_back(sInstr);
+    return sInstr.nDst;
+}
+
+/************************************************************************/
+/*                           CompileColumn()                            */
+/************************************************************************/
+
+int OGRFeatureQueryProgram::CompileColumn(const swq_expr_node *poNode,
+                                          bool bNullFlagOnly)
+{
+    if (poNode->table_index != 0 || poNode->field_type == SWQ_GEOMETRY)
+        return -1;
+    const int nIdx = OGRFeatureFetcherFixFieldIndex(m_poDefn,
+                                                    poNode->field_index);
+    if (nIdx < 0 || nIdx >= m_poDefn->GetFieldCount() + SPECIAL_FIELD_COUNT)
+        return -1;
+
+    Instruction sInstr;
+    sInstr.nA = nIdx;
+    swq_field_type eType = poNode->field_type;
+    if (bNullFlagOnly)
+    {
+        sInstr.eOp = Op::LOAD_NULL_FLAG;
+        eType = SWQ_OTHER;
+    }
+    else
+    {
+        switch (poNode->field_type)
+        {
+            case SWQ_INTEGER:
+            case SWQ_BOOLEAN:
+                // OGRFeatureFetcher() returns integer nodes for both
+                sInstr.eOp = Op::LOAD_INT;
+                eType = SWQ_INTEGER;
+                break;
+            case SWQ_INTEGER64:
+                sInstr.eOp = Op::LOAD_INT64;
+                break;
+            case SWQ_FLOAT:
+                sInstr.eOp = Op::LOAD_FLOAT;
+                break;
+            case SWQ_STRING:
+                // Only the strings of OFTString fields are stored in the
+                // feature, and can be referenced without copy.
+                if (nIdx >= m_poDefn->GetFieldCount() ||
+                    m_poDefn->GetFieldDefn(nIdx)->GetType() != OFTString)
+                {
+                    return -1;
+                }
+                sInstr.eOp = Op::LOAD_STRING;
+                break;
+            default:
+                return -1;
+        }
+    }
+    sInstr.nDst = NewRegister(eType);
+    m_aoInstructions.push_back(sInstr);
+    return sInstr.nDst;
+}
+
+/************************************************************************/
+/*                          CompileOperation()                          */
+/************************************************************************/
+
+int OGRFeatureQueryProgram::CompileOperation(const swq_expr_node *poNode,
+                                             int nRecLevel)
+{
+    const auto nOp = poNode->nOperation;
+    const int nSubExprCount = poNode->nSubExprCount;
+
+    const auto IsInt = [](swq_field_type eType)
+    { return SWQ_IS_INTEGER(eType) || eType == SWQ_BOOLEAN; };
+    // Integer types that SWQGeneralEvaluator() converts to float
+    const auto IsNumeric = [](swq_field_type eType)
+    { return SWQ_IS_INTEGER(eType) || eType == SWQ_FLOAT; };
+
+    if (nOp == SWQ_ISNULL)
+    {
+        if (nSubExprCount != 1)
+            return -1;
+        const auto poSub = poNode->papoSubExpr[0];
+        const int nA = poSub->eNodeType == SNT_COLUMN
+                           ? CompileColumn(poSub, true)
+                           : CompileNode(poSub, nRecLevel + 1);
+        if (nA < 0)
+            return -1;
+        Instruction sInstr;
+        sInstr.eOp = Op::ISNULL;
+        sInstr.nA = nA;
+        sInstr.nDst = NewRegister(poNode->field_type);
+        m_aoInstructions.push_back(sInstr);
+        return sInstr.nDst;
+    }
+
+    std::vector<int> anSubRegs;
+    for (int i = 0; i < nSubExprCount; ++i)
+    {
+        const int nReg = CompileNode(poNode->papoSubExpr[i], nRecLevel + 1);
+        if (nReg < 0)
+            return -1;
+        anSubRegs.push_back(nReg);
+    }
+    std::vector<swq_field_type> aeTypes;
+    for (int nReg : anSubRegs)
+        aeTypes.push_back(m_aeRegisterTypes[nReg]);
+
+    Instruction sInstr;
+    sInstr.nOperation = nOp;
+    sInstr.nDst = NewRegister(poNode->field_type);
+
+    switch (nOp)
+    {
+        case SWQ_AND:
+        case SWQ_OR:
+        {
+            if (nSubExprCount != 2 || !IsInt(aeTypes[0]) || !IsInt(aeTypes[1]))
+                return -1;
+            sInstr.eOp = nOp == SWQ_AND ? Op::AND : Op::OR;
+            sInstr.nA = anSubRegs[0];
+            sInstr.nB = anSubRegs[1];
+            break;
+        }
+
+        case SWQ_NOT:
+        {
+            if (nSubExprCount != 1 || !IsInt(aeTypes[0]))
+                return -1;
+            sInstr.eOp = Op::NOT;
+            sInstr.nA = anSubRegs[0];
+            break;
+        }
+
+        case SWQ_EQ:
+        case SWQ_NE:
+        case SWQ_LT:
+        case SWQ_LE:
+        case SWQ_GT:
+        case SWQ_GE:
+        case SWQ_BETWEEN:
+        case SWQ_IN:
+        {
+            if ((nOp == SWQ_BETWEEN && nSubExprCount != 3) ||
+                (nOp == SWQ_IN && nSubExprCount < 2) ||
+                (nOp != SWQ_BETWEEN && nOp != SWQ_IN && nSubExprCount != 2))
+            {
+                return -1;
+            }
+            const bool bFloat =
+                aeTypes[0] == SWQ_FLOAT || aeTypes[1] == SWQ_FLOAT;
+            if (bFloat)
+            {
+                // Only the first two operands are converted to float
+                if (!IsNumeric(aeTypes[0]) || !IsNumeric(aeTypes[1]))
+                    return -1;
+                for (int i = 2; i < nSubExprCount; ++i)
+                {
+                    if (aeTypes[i] != SWQ_FLOAT)
+                        return -1;
+                }
+                anSubRegs[0] = ToFloat(anSubRegs[0]);
+                anSubRegs[1] = ToFloat(anSubRegs[1]);
+                sInstr.eOp = nOp == SWQ_BETWEEN ? Op::BETWEEN_FLOAT
+                             : nOp == SWQ_IN    ? Op::IN_FLOAT
+                                                : Op::CMP_FLOAT;
+            }
+            else if (IsInt(aeTypes[0]))
+            {
+                for (int i = 1; i < nSubExprCount; ++i)
+                {
+                    if (!IsInt(aeTypes[i]))
+                        return -1;
+                }
+                sInstr.eOp = nOp == SWQ_BETWEEN ? Op::BETWEEN_INT
+                             : nOp == SWQ_IN    ? Op::IN_INT
+                                                : Op::CMP_INT;
+            }
+            else if (aeTypes[0] == SWQ_STRING)
+            {
+                for (int i = 1; i < nSubExprCount; ++i)
+                {
+                    if (aeTypes[i] != SWQ_STRING)
+                        return -1;
+                }
+                sInstr.eOp = nOp == SWQ_BETWEEN ? Op::BETWEEN_STRING
+                             : nOp == SWQ_IN    ? Op::IN_STRING
+                                                : Op::CMP_STRING;
+            }
+            else
+            {
+                return -1;
+            }
+            sInstr.nA = anSubRegs[0];
+            sInstr.nB = anSubRegs[1];
+            if (nOp == SWQ_BETWEEN)
+                sInstr.nC = anSubRegs[2];
+            if (nOp == SWQ_IN)
+            {
+                sInstr.nFirstExtraOperand =
+                    static_cast<int>(m_anExtraOperands.size());
+                sInstr.nExtraOperandCount = nSubExprCount - 1;
+                m_anExtraOperands.insert(m_anExtraOperands.end(),
+                                         anSubRegs.begin() + 1,
+                                         anSubRegs.end());
+            }
+            break;
+        }
+
+        case SWQ_LIKE:
+        case SWQ_ILIKE:
+        {
+            if ((nSubExprCount != 2 && nSubExprCount != 3) ||
+                aeTypes[0] != SWQ_STRING || aeTypes[1] != SWQ_STRING)
+            {
+                return -1;
+            }
+            if (nSubExprCount == 3)
+            {
+                const auto poEscape = poNode->papoSubExpr[2];
+                if (poEscape->eNodeType != SNT_CONSTANT ||
+                    poEscape->field_type != SWQ_STRING ||
+                    poEscape->string_value == nullptr)
+                {
+                    return -1;
+                }
+                sInstr.chEscape = poEscape->string_value[0];
+            }
+            sInstr.eOp = Op::LIKE;
+            sInstr.bInsensitive =
+                nOp == SWQ_ILIKE ||
+                CPLTestBool(
+                    CPLGetConfigOption("OGR_SQL_LIKE_AS_ILIKE", "FALSE"));
+            sInstr.nA = anSubRegs[0];
+            sInstr.nB = anSubRegs[1];
+            break;
+        }
+
+        case SWQ_ADD:
+        case SWQ_SUBTRACT:
+        case SWQ_MULTIPLY:
+        case SWQ_DIVIDE:
+        case SWQ_MODULUS:
+        {
+            if (nSubExprCount != 2)
+                return -1;
+            if (aeTypes[0] == SWQ_FLOAT || aeTypes[1] == SWQ_FLOAT)
+            {
+                if (!IsNumeric(aeTypes[0]) || !IsNumeric(aeTypes[1]) ||
+                    poNode->field_type != SWQ_FLOAT)
+                {
+                    return -1;
+                }
+                anSubRegs[0] = ToFloat(anSubRegs[0]);
+                anSubRegs[1] = ToFloat(anSubRegs[1]);
+                sInstr.eOp = Op::ARITH_FLOAT;
+            }
+            else if (IsInt(aeTypes[0]) && IsInt(aeTypes[1]) &&
+                     SWQ_IS_INTEGER(poNode->field_type))
+            {
+                sInstr.eOp = Op::ARITH_INT;
+            }
+            else
+            {
+                return -1;
+            }
+            sInstr.nA = anSubRegs[0];
+            sInstr.nB = anSubRegs[1];
+            break;
+        }
+
+        default:
+            return -1;
+    }
+
+    m_aoInstructions.push_back(sInstr);
+    return sInstr.nDst;
+}
+
+/************************************************************************/
+/*                            CompileNode()                             */
+/************************************************************************/
+
+int OGRFeatureQueryProgram::CompileNode(const swq_expr_node *poNode,
+                                        int nRecLevel)
+{
+    // Let swq_expr_node::Evaluate() emit its error
+    if (nRecLevel == 32)
+        return -1;
+
+    switch (poNode->eNodeType)
+    {
+        case SNT_CONSTANT:
+        {
+            switch (poNode->field_type)
+            {
+                case SWQ_INTEGER:
+                case SWQ_INTEGER64:
+                case SWQ_BOOLEAN:
+                case SWQ_FLOAT:
+                case SWQ_STRING:
+                    break;
+                default:
+                    return -1;
+            }
+            const int nReg = NewRegister(poNode->field_type);
+            auto &sReg = m_aoRegisters[nReg];
+            sReg.nInt = poNode->int_value;
+            sReg.dfFloat = poNode->float_value;
+            sReg.pszStr = poNode->string_value;
+            sReg.bNull = poNode->is_null != 0;
+            if (poNode->field_type == SWQ_STRING && sReg.pszStr == nullptr)
+                return -1;
+            return nReg;
+        }
+
+        case SNT_COLUMN:
+            return CompileColumn(poNode, false);
+
+        case SNT_OPERATION:
+            return CompileOperation(poNode, nRecLevel);
+    }
+    return -1;
+}
+
+/************************************************************************/
+/*                              Compile()                               */
+/************************************************************************/
+
+/** Compile an expression, or return nullptr if it contains constructs that
+ * are not handled. */
+OGRFeatureQueryProgram *
+OGRFeatureQueryProgram::Compile(const swq_expr_node *poNode,
+                                OGRFeatureDefn *poDefn)
+{
+    auto poProgram = new OGRFeatureQueryProgram();
+    poProgram->m_poDefn = poDefn;
+    poProgram->m_nResultRegister = poProgram->CompileNode(poNode, 0);
+    if (poProgram->m_nResultRegister < 0)
+    {
+        delete poProgram;
+        return nullptr;
+    }
+    return poProgram;
+}
+
+/************************************************************************/
+/*                            StringEqual()                             */
+/************************************************************************/
+
+/** Equality of strings, with the special handling of SWQGeneralEvaluator()
+ * for timestamps whose +00 timezone might be omitted on one side. */
+bool OGRFeatureQueryProgram::StringEqual(const char *pszA, const char *pszB)
+{
+    const size_t nLenA = strlen(pszA);
+    const size_t nLenB = strlen(pszB);
+    if (nLenA > 3 && nLenB > 3)
+    {
+        if (strcmp(pszA + nLenA - 3, "+00") == 0 && pszB[nLenB - 3] == ':')
+            return EQUALN(pszA, pszB, nLenB);
+        if (pszA[nLenA - 3] == ':' && strcmp(pszB + nLenB - 3, "+00") == 0)
+            return EQUALN(pszA, pszB, nLenA);
+    }
+    return strcasecmp(pszA, pszB) == 0;
+}
+
+/************************************************************************/
+/*                              Compare()                               */
+/************************************************************************/
+
+template <class T>
+bool OGRFeatureQueryProgram::Compare(swq_op nOperation, T a, T b)
+{
+    switch (nOperation)
+    {
+        case SWQ_EQ:
+            return a == b;
+        case SWQ_NE:
+            return a != b;
+        case SWQ_LT:
+            return a < b;
+        case SWQ_LE:
+            return a <= b;
+        case SWQ_GT:
+            return a > b;
+        case SWQ_GE:
+            return a >= b;
+        default:
+            break;
+    }
+    CPLAssert(false);
+    return false;
+}
+
+bool OGRFeatureQueryProgram::CompareStrings(swq_op nOperation,
+                                            const char *pszA,
+                                            const char *pszB)
+{
+    if (nOperation == SWQ_EQ)
+        return StringEqual(pszA, pszB);
+    return Compare(nOperation, strcasecmp(pszA, pszB), 0);
+}
+
+/************************************************************************/
+/*                              Execute()                               */
+/************************************************************************/
+
+int OGRFeatureQueryProgram::Execute(const OGRFeature *poFeature,
+                                    bool bUTF8Strings)
+{
+    if (poFeature->GetDefnRef() != m_poDefn)
+        return -1;
+
+    Register *pRegs = m_aoRegisters.data();
+    for (const auto &sInstr : m_aoInstructions)
+    {
+        Register &sDst = pRegs[sInstr.nDst];
+        const Register &sA = pRegs[sInstr.nA];
+        const Register &sB = pRegs[sInstr.nB];
+        sDst.nInt = 0;
+        sDst.dfFloat = 0;
+        sDst.bNull = false;
+        switch (sInstr.eOp)
+        {
+            case Op::LOAD_INT:
+                sDst.nInt = poFeature->GetFieldAsInteger(sInstr.nA);
+                sDst.bNull = !poFeature->IsFieldSetAndNotNull(sInstr.nA);
+                break;
+
+            case Op::LOAD_INT64:
+                sDst.nInt = poFeature->GetFieldAsInteger64(sInstr.nA);
+                sDst.bNull = !poFeature->IsFieldSetAndNotNull(sInstr.nA);
+                break;
+
+            case Op::LOAD_FLOAT:
+                sDst.dfFloat = poFeature->GetFieldAsDouble(sInstr.nA);
+                sDst.bNull = !poFeature->IsFieldSetAndNotNull(sInstr.nA);
+                break;
+
+            case Op::LOAD_STRING:
+                sDst.pszStr = poFeature->GetFieldAsString(sInstr.nA);
+                sDst.bNull = !poFeature->IsFieldSetAndNotNull(sInstr.nA);
+                break;
+
+            case Op::LOAD_NULL_FLAG:
+                sDst.bNull = !poFeature->IsFieldSetAndNotNull(sInstr.nA);
+                break;
+
+            case Op::INT_TO_FLOAT:
+                sDst.dfFloat = static_cast<double>(sA.nInt);
+                sDst.bNull = sA.bNull;
+                break;
+
+            case Op::AND:
+                sDst.bNull = sA.bNull || sB.bNull;
+                sDst.nInt = !sDst.bNull && sA.nInt && sB.nInt;
+                break;
+
+            case Op::OR:
+                sDst.bNull = sA.bNull || sB.bNull;
+                sDst.nInt = sA.nInt || sB.nInt;
+                break;
+
+            case Op::NOT:
+                sDst.bNull = sA.bNull;
+                sDst.nInt = !sA.bNull && !sA.nInt;
+                break;
+
+            case Op::ISNULL:
+                sDst.nInt = sA.bNull;
+                break;
+
+            case Op::CMP_INT:
+            case Op::CMP_FLOAT:
+            case Op::CMP_STRING:
+                sDst.bNull = sA.bNull || sB.bNull;
+                if (!sDst.bNull)
+                {
+                    sDst.nInt =
+                        sInstr.eOp == Op::CMP_INT
+                            ? Compare(sInstr.nOperation, sA.nInt, sB.nInt)
+                        : sInstr.eOp == Op::CMP_FLOAT
+                            ? Compare(sInstr.nOperation, sA.dfFloat,
+                                      sB.dfFloat)
+                            : CompareStrings(sInstr.nOperation, sA.pszStr,
+                                             sB.pszStr);
+                }
+                break;
+
+            case Op::BETWEEN_INT:
+            case Op::BETWEEN_FLOAT:
+            case Op::BETWEEN_STRING:
+            {
+                const Register &sC = pRegs[sInstr.nC];
+                sDst.bNull = sA.bNull || sB.bNull || sC.bNull;
+                if (!sDst.bNull)
+                {
+                    if (sInstr.eOp == Op::BETWEEN_INT)
+                        sDst.nInt = sA.nInt >= sB.nInt && sA.nInt <= sC.nInt;
+                    else if (sInstr.eOp == Op::BETWEEN_FLOAT)
+                        sDst.nInt = sA.dfFloat >= sB.dfFloat &&
+                                    sA.dfFloat <= sC.dfFloat;
+                    else
+                        sDst.nInt = strcasecmp(sA.pszStr, sB.pszStr) >= 0 &&
+                                    strcasecmp(sA.pszStr, sC.pszStr) <= 0;
+                }
+                break;
+            }
+
+            case Op::IN_INT:
+            case Op::IN_FLOAT:
+            case Op::IN_STRING:
+            {
+                if (sA.bNull)
+                {
+                    sDst.bNull = true;
+                    break;
+                }
+                bool bNullFound = false;
+                for (int i = 0; i < sInstr.nExtraOperandCount; ++i)
+                {
+                    const Register &sItem =
+                        pRegs[m_anExtraOperands[sInstr.nFirstExtraOperand + i]];
+                    if (sItem.bNull)
+                    {
+                        bNullFound = true;
+                    }
+                    else if (sInstr.eOp == Op::IN_INT
+                                 ? sA.nInt == sItem.nInt
+                             : sInstr.eOp == Op::IN_FLOAT
+                                 ? sA.dfFloat == sItem.dfFloat
+                                 : strcasecmp(sA.pszStr, sItem.pszStr) == 0)
+                    {
+                        sDst.nInt = 1;
+                        break;
+                    }
+                }
+                if (bNullFound && !sDst.nInt)
+                    sDst.bNull = true;
+                break;
+            }
+
+            case Op::LIKE:
+                sDst.bNull = sA.bNull || sB.bNull;
+                if (!sDst.bNull)
+                {
+                    sDst.nInt =
+                        swq_test_like(sA.pszStr, sB.pszStr, sInstr.chEscape,
+                                      sInstr.bInsensitive, bUTF8Strings);
+                }
+                break;
+
+            case Op::ARITH_INT:
+            {
+                sDst.bNull = sA.bNull || sB.bNull;
+                if (sDst.bNull)
+                    break;
+                const auto nOp = sInstr.nOperation;
+                if ((nOp == SWQ_DIVIDE || nOp == SWQ_MODULUS) && sB.nInt == 0)
+                {
+                    sDst.nInt = INT_MAX;
+                }
+                else if (nOp == SWQ_MODULUS)
+                {
+                    sDst.nInt = sA.nInt % sB.nInt;
+                }
+                else
+                {
+                    try
+                    {
+                        const auto a = CPLSM(sA.nInt);
+                        const auto b = CPLSM(sB.nInt);
+                        sDst.nInt = nOp == SWQ_ADD        ? (a + b).v()
+                                    : nOp == SWQ_SUBTRACT ? (a - b).v()
+                                    : nOp == SWQ_MULTIPLY ? (a * b).v()
+                                                          : (a / b).v();
+                    }
+                    catch (const std::exception &)
+                    {
+                        CPLError(CE_Failure, CPLE_AppDefined, "Int overflow");
+                        sDst.nInt = 0;
+                        sDst.bNull = true;
+                    }
+                }
+                break;
+            }
+
+            case Op::ARITH_FLOAT:
+            {
+                sDst.bNull = sA.bNull || sB.bNull;
+                if (sDst.bNull)
+                    break;
+                const auto nOp = sInstr.nOperation;
+                if ((nOp == SWQ_DIVIDE || nOp == SWQ_MODULUS) &&
+                    sB.dfFloat == 0)
+                {
+                    sDst.dfFloat = INT_MAX;
+                }
+                else
+                {
+                    sDst.dfFloat =
+                        nOp == SWQ_ADD        ? sA.dfFloat + sB.dfFloat
+                        : nOp == SWQ_SUBTRACT ? sA.dfFloat - sB.dfFloat
+                        : nOp == SWQ_MULTIPLY ? sA.dfFloat * sB.dfFloat
+                        : nOp == SWQ_DIVIDE
+                            ? sA.dfFloat / sB.dfFloat
+                            : fmod(sA.dfFloat, sB.dfFloat);
+                }
+                break;
+            }
+        }
+    }
+
+    // Same logic as in OGRFeatureQuery::Evaluate()
+    const auto eResultType = m_aeRegisterTypes[m_nResultRegister];
+    if (eResultType == SWQ_INTEGER || eResultType == SWQ_INTEGER64 ||
+        eResultType == SWQ_BOOLEAN)
+    {
+        return static_cast<int>(pRegs[m_nResultRegister].nInt) != 0;
+    }
+    return 0;
+}
+
 /************************************************************************/
 /*                              Evaluate()                              */
 /************************************************************************/
@@ -328,6 +1083,14 @@ int OGRFeatureQuery::Evaluate(OGRFeature *poFeature)
     if (pSWQExpr == nullptr)
         return FALSE;
 
+    if (m_poProgram)
+    {
+        const int nRet =
+            m_poProgram->Execute(poFeature, m_psContext->bUTF8Strings);
+        if (nRet >= 0)
+            return nRet;
+    }
+
     swq_expr_node *poResult = static_cast<swq_expr_node *>(pSWQExpr)->Evaluate(
         OGRFeatureFetcher, poFeature, *m_psContext);
 
@@ -170,6 +170,7 @@ void OGRFieldDefn::SetName(const char *pszNameIn)
     {
         CPLFree(pszName);
         pszName = CPLStrdup(pszNameIn);
+        OGRIncrementFieldNameChangeCounter();
     }
 }
 
@@ -6856,6 +6856,8 @@ struct _OGRPreparedGeometry
     GEOSContextHandle_t hGEOSCtxt;
     GEOSGeom hGEOSGeom;
     const GEOSPreparedGeometry *poPreparedGEOSGeom;
+    // Lazily created by OGRPreparedGeometryIntersectsWKBBatch()
+    GEOSWKBReader *hWKBReader;
 };
 #endif
 
@@ -6912,6 +6914,7 @@ OGRCreatePreparedGeometry(UNUSED_IF_NO_GEOS OGRGeometryH hGeom)
     poPreparedGeom->hGEOSCtxt = hGEOSCtxt;
     poPreparedGeom->hGEOSGeom = hGEOSGeom;
     poPreparedGeom->poPreparedGEOSGeom = poPreparedGEOSGeom;
+    poPreparedGeom->hWKBReader = nullptr;
 
     return poPreparedGeom;
 #else
@@ -6933,6 +6936,9 @@ void OGRDestroyPreparedGeometry(
 #if defined(HAVE_GEOS)
     if (hPreparedGeom != nullptr)
     {
+        if (hPreparedGeom->hWKBReader)
+            GEOSWKBReader_destroy_r(hPreparedGeom->hGEOSCtxt,
+                                    hPreparedGeom->hWKBReader);
         GEOSPreparedGeom_destroy_r(hPreparedGeom->hGEOSCtxt,
                                    hPreparedGeom->poPreparedGEOSGeom);
         GEOSGeom_destroy_r(hPreparedGeom->hGEOSCtxt, hPreparedGeom->hGEOSGeom);
@@ -6983,6 +6989,81 @@ int OGRPreparedGeometryIntersects(
 #endif
 }
 
+/************************************************************************/
+/*                OGRPreparedGeometryIntersectsWKBBatch()               */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+
+/** Evaluates whether a prepared geometry intersects each of nCount WKB
+ * geometries.
+ *
+ * The WKB geometries are directly ingested by the GEOS WKB reader, sharing
+ * the GEOS context and the reader of the prepared geometry, which avoids
+ * instantiating intermediate OGRGeometry objects.
+ *
+ * panResults[i] is set to 1 if the geometry intersects, 0 if it does not,
+ * and -1 if GEOS cannot read it (e.g. curve geometries), in which case the
+ * caller should fallback to OGRPreparedGeometryIntersects().
+ */
+void OGRPreparedGeometryIntersectsWKBBatch(
+    UNUSED_IF_NO_GEOS OGRPreparedGeometry *poPreparedGeom, size_t nCount,
+    UNUSED_IF_NO_GEOS const GByte *const *papabyWKB,
+    UNUSED_IF_NO_GEOS const size_t *panWKBSize, int *panResults)
+{
+#if defined(HAVE_GEOS)
+    if (poPreparedGeom == nullptr)
+    {
+        for (size_t i = 0; i < nCount; ++i)
+            panResults[i] = -1;
+        return;
+    }
+
+    GEOSContextHandle_t hGEOSCtxt = poPreparedGeom->hGEOSCtxt;
+    if (poPreparedGeom->hWKBReader == nullptr)
+        poPreparedGeom->hWKBReader = GEOSWKBReader_create_r(hGEOSCtxt);
+
+    // Geometries GEOS cannot read are reported with -1, so do not let the
+    // GEOS error handler emit errors for them.
+    CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+    for (size_t i = 0; i < nCount; ++i)
+    {
+        panResults[i] = -1;
+        OGRwkbGeometryType eGeomType = wkbUnknown;
+        if (poPreparedGeom->hWKBReader == nullptr || panWKBSize[i] < 5 ||
+            OGRReadWKBGeometryType(papabyWKB[i], wkbVariantIso, &eGeomType) !=
+                OGRERR_NONE ||
+            OGR_GT_IsNonLinear(eGeomType))
+        {
+            continue;
+        }
+
+        GEOSGeom hGEOSOtherGeom =
+            GEOSWKBReader_read_r(hGEOSCtxt, poPreparedGeom->hWKBReader,
+                                 papabyWKB[i], panWKBSize[i]);
+        if (hGEOSOtherGeom == nullptr)
+            continue;
+
+        // The check for GEOSisEmpty_r() is for buggy GEOS versions.
+        // See https://github.com/libgeos/geos/pull/423
+        if (GEOSisEmpty_r(hGEOSCtxt, hGEOSOtherGeom) == 1)
+            panResults[i] = 0;
+        else
+            panResults[i] = GEOSPreparedIntersects_r(
+                                hGEOSCtxt, poPreparedGeom->poPreparedGEOSGeom,
+                                hGEOSOtherGeom) == 1
+                                ? 1
+                                : 0;
+        GEOSGeom_destroy_r(hGEOSCtxt, hGEOSOtherGeom);
+    }
+#else
+    for (size_t i = 0; i < nCount; ++i)
+        panResults[i] = -1;
+#endif
+}
+
+//! @endcond
+
 /** Returns whether a prepared geometry contains a geometry.
  * @param hPreparedGeom prepared geometry.
  * @param hOtherGeom other geometry.
@@ -32,6 +32,7 @@
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_quad_tree.h"
 #include "cpl_string.h"
 #include "ogr_geometry.h"
 #include "ogr_api.h"
@@ -54,6 +55,7 @@
 #include <cstddef>
 
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <new>
 #include <utility>
@@ -1509,6 +1511,10 @@ static bool OGRGeometryFactoryCompareByIndex(const sPolyExtended &sPoly1,
 
 constexpr int N_CRITICAL_PART_NUMBER = 100;
 
+// Minimum number of parts from which candidate enclosing polygons are
+// retrieved through a spatial index on their envelopes.
+constexpr int N_MIN_PART_NUMBER_FOR_SPATIAL_INDEX = 16;
+
 enum OrganizePolygonMethod
 {
     METHOD_NORMAL,
@@ -1879,7 +1885,12 @@ OGRGeometry *OGRGeometryFactory::organizePolygons(OGRGeometry **papoPolygons,
           outer ring
        5) Add the top-level polygons to the multipolygon
 
-       Complexity : O(nPolygonCount^2)
+       Complexity : O(nPolygonCount^2) in the worst case. When there are
+       enough polygons, the candidates of step 2 are restricted to the ones
+       whose envelope intersects the one of the polygon of rank i, using a
+       quad tree, which makes it close to O(nPolygonCount * log(nPolygonCount))
+       for typical inputs (many holes in a few outer rings, or many
+       scattered islands).
     */
 
     /* Compute how each polygon relate to the other ones
@@ -1916,6 +1927,43 @@ OGRGeometry *OGRGeometryFactory::organizePolygons(OGRGeometry **papoPolygons,
 
     int nCountTopLevel = 1;
 
+    // Spatial index of the envelopes of the polygons that may enclose
+    // other ones.
+    CPLQuadTree *hQuadTree = nullptr;
+    if (!bMixedUpGeometries &&
+        static_cast<int>(asPolyEx.size()) >=
+            N_MIN_PART_NUMBER_FOR_SPATIAL_INDEX)
+    {
+        OGREnvelope sGlobalEnvelope;
+        for (const auto &sPolyEx : asPolyEx)
+            sGlobalEnvelope.Merge(sPolyEx.sEnvelope);
+        CPLRectObj sGlobalBounds;
+        sGlobalBounds.minx = sGlobalEnvelope.MinX;
+        sGlobalBounds.miny = sGlobalEnvelope.MinY;
+        sGlobalBounds.maxx = sGlobalEnvelope.MaxX;
+        sGlobalBounds.maxy = sGlobalEnvelope.MaxY;
+        hQuadTree = CPLQuadTreeCreate(&sGlobalBounds, nullptr);
+        CPLQuadTreeSetMaxDepth(hQuadTree,
+                               CPLQuadTreeGetAdvisedMaxDepth(
+                                   static_cast<int>(asPolyEx.size())));
+        for (auto &sPolyEx : asPolyEx)
+        {
+            // In ONLY_CCW mode, only CW polygons can be enclosing ones.
+            if (method == METHOD_ONLY_CCW && !sPolyEx.bIsCW)
+                continue;
+            CPLRectObj sBounds;
+            sBounds.minx = sPolyEx.sEnvelope.MinX;
+            sBounds.miny = sPolyEx.sEnvelope.MinY;
+            sBounds.maxx = sPolyEx.sEnvelope.MaxX;
+            sBounds.maxy = sPolyEx.sEnvelope.MaxY;
+            CPLQuadTreeInsertWithBounds(hQuadTree, &sPolyEx, &sBounds);
+        }
+    }
+
+    // Indices of the polygons that may enclose the current one, by
+    // decreasing rank (that is increasing area).
+    std::vector<int> anCandidates;
+
     // STEP 2.
     for (int i = 1; !bMixedUpGeometries && bValidTopology &&
                     i < static_cast<int>(asPolyEx.size());
@@ -1929,9 +1977,40 @@ OGRGeometry *OGRGeometryFactory::organizePolygons(OGRGeometry **papoPolygons,
             continue;
         }
 
-        int j = i - 1;  // Used after for.
-        for (; bValidTopology && j >= 0; j--)
+        anCandidates.clear();
+        if (hQuadTree)
         {
+            CPLRectObj sAoi;
+            sAoi.minx = asPolyEx[i].sEnvelope.MinX;
+            sAoi.miny = asPolyEx[i].sEnvelope.MinY;
+            sAoi.maxx = asPolyEx[i].sEnvelope.MaxX;
+            sAoi.maxy = asPolyEx[i].sEnvelope.MaxY;
+            int nFeatureCount = 0;
+            void **pahFeatures =
+                CPLQuadTreeSearch(hQuadTree, &sAoi, &nFeatureCount);
+            for (int k = 0; k < nFeatureCount; ++k)
+            {
+                const int j = static_cast<int>(
+                    static_cast<const sPolyExtended *>(pahFeatures[k]) -
+                    asPolyEx.data());
+                if (j < i)
+                    anCandidates.push_back(j);
+            }
+            CPLFree(pahFeatures);
+            std::sort(anCandidates.begin(), anCandidates.end(),
+                      std::greater<int>());
+        }
+        else
+        {
+            for (int j = i - 1; j >= 0; j--)
+                anCandidates.push_back(j);
+        }
+
+        bool bEnclosed = false;
+        for (size_t iCandidate = 0;
+             bValidTopology && iCandidate < anCandidates.size(); ++iCandidate)
+        {
+            const int j = anCandidates[iCandidate];
             bool b_i_inside_j = false;
 
             if (method == METHOD_ONLY_CCW && asPolyEx[j].bIsCW == false)
@@ -2072,6 +2151,7 @@ OGRGeometry *OGRGeometryFactory::organizePolygons(OGRGeometry **papoPolygons,
                     asPolyEx[i].bIsTopLevel = true;
                     asPolyEx[i].poEnclosingPolygon = nullptr;
                 }
+                bEnclosed = true;
                 break;
             }
             // Use Overlaps instead of Intersects to be more
@@ -2105,7 +2185,7 @@ OGRGeometry *OGRGeometryFactory::organizePolygons(OGRGeometry **papoPolygons,
             }
         }
 
-        if (j < 0)
+        if (!bEnclosed)
         {
             // We come here because we are not included in anything.
             // We are toplevel.
@@ -2115,6 +2195,9 @@ OGRGeometry *OGRGeometryFactory::organizePolygons(OGRGeometry **papoPolygons,
         }
     }
 
+    if (hQuadTree)
+        CPLQuadTreeDestroy(hQuadTree);
+
     if (pbIsValidGeometry)
         *pbIsValidGeometry = bValidTopology && !bMixedUpGeometries;
 
@@ -191,6 +191,7 @@ void OGRGeomFieldDefn::SetName(const char *pszNameIn)
     {
         CPLFree(pszName);
         pszName = CPLStrdup(pszNameIn);
+        OGRIncrementFieldNameChangeCounter();
     }
 }
 
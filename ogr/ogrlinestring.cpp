@@ -30,6 +30,7 @@
 #include "ogr_geometry.h"
 #include "ogr_geos.h"
 #include "ogr_p.h"
+#include "ogr_wkb.h"
 
 #include "geodesic.h"  // from PROJ
 
@@ -93,9 +94,12 @@ OGRSimpleCurve::OGRSimpleCurve(const OGRSimpleCurve &other)
 OGRSimpleCurve::~OGRSimpleCurve()
 
 {
-    CPLFree(paoPoints);
-    CPLFree(padfZ);
-    CPLFree(padfM);
+    if (!m_bPointsBorrowed)
+    {
+        CPLFree(paoPoints);
+        CPLFree(padfZ);
+        CPLFree(padfM);
+    }
 }
 
 /************************************************************************/
@@ -201,7 +205,8 @@ void OGRSimpleCurve::Make2D()
 {
     if (padfZ != nullptr)
     {
-        CPLFree(padfZ);
+        if (!m_bPointsBorrowed)
+            CPLFree(padfZ);
         padfZ = nullptr;
     }
     flags &= ~OGR_G_3D;
@@ -216,6 +221,11 @@ void OGRSimpleCurve::Make3D()
 {
     if (padfZ == nullptr)
     {
+        if (!MakePointsOwned())
+        {
+            flags &= ~OGR_G_3D;
+            return;
+        }
         padfZ = static_cast<double *>(
             VSI_CALLOC_VERBOSE(sizeof(double), std::max(1, m_nPointCapacity)));
         if (padfZ == nullptr)
@@ -238,7 +248,8 @@ void OGRSimpleCurve::RemoveM()
 {
     if (padfM != nullptr)
     {
-        CPLFree(padfM);
+        if (!m_bPointsBorrowed)
+            CPLFree(padfM);
         padfM = nullptr;
     }
     flags &= ~OGR_G_MEASURED;
@@ -253,6 +264,11 @@ void OGRSimpleCurve::AddM()
 {
     if (padfM == nullptr)
     {
+        if (!MakePointsOwned())
+        {
+            flags &= ~OGR_G_MEASURED;
+            return;
+        }
         padfM = static_cast<double *>(
             VSI_CALLOC_VERBOSE(sizeof(double), std::max(1, m_nPointCapacity)));
         if (padfM == nullptr)
@@ -266,6 +282,51 @@ void OGRSimpleCurve::AddM()
     flags |= OGR_G_MEASURED;
 }
 
+/************************************************************************/
+/*                          MakePointsOwned()                           */
+/************************************************************************/
+
+/* Replaces the points borrowed with setBorrowedPoints() by a copy of them
+ * owned by the curve, before they get modified.
+ */
+bool OGRSimpleCurve::MakePointsOwned()
+
+{
+    if (!m_bPointsBorrowed)
+        return true;
+
+    OGRRawPoint *paoNewPoints = static_cast<OGRRawPoint *>(
+        VSI_MALLOC2_VERBOSE(sizeof(OGRRawPoint), nPointCount));
+    double *padfNewZ =
+        padfZ ? static_cast<double *>(
+                    VSI_MALLOC2_VERBOSE(sizeof(double), nPointCount))
+              : nullptr;
+    double *padfNewM =
+        padfM ? static_cast<double *>(
+                    VSI_MALLOC2_VERBOSE(sizeof(double), nPointCount))
+              : nullptr;
+    if (paoNewPoints == nullptr || (padfZ && padfNewZ == nullptr) ||
+        (padfM && padfNewM == nullptr))
+    {
+        VSIFree(paoNewPoints);
+        VSIFree(padfNewZ);
+        VSIFree(padfNewM);
+        return false;
+    }
+
+    memcpy(paoNewPoints, paoPoints, sizeof(OGRRawPoint) * nPointCount);
+    if (padfZ)
+        memcpy(padfNewZ, padfZ, sizeof(double) * nPointCount);
+    if (padfM)
+        memcpy(padfNewM, padfM, sizeof(double) * nPointCount);
+    paoPoints = paoNewPoints;
+    padfZ = padfNewZ;
+    padfM = padfNewM;
+    m_nPointCapacity = nPointCount;
+    m_bPointsBorrowed = false;
+    return true;
+}
+
 //! @endcond
 
 /************************************************************************/
@@ -407,6 +468,23 @@ void OGRSimpleCurve::setNumPoints(int nNewPointCount, int bZeroizeNewContent)
 {
     CPLAssert(nNewPointCount >= 0);
 
+    if (m_bPointsBorrowed)
+    {
+        if (nNewPointCount == 0)
+        {
+            // No need to copy points that are going to be discarded
+            nPointCount = 0;
+            m_nPointCapacity = 0;
+            paoPoints = nullptr;
+            padfZ = nullptr;
+            padfM = nullptr;
+            m_bPointsBorrowed = false;
+            return;
+        }
+        if (!MakePointsOwned())
+            return;
+    }
+
     if (nNewPointCount > m_nPointCapacity)
     {
         // Overflow of sizeof(OGRRawPoint) * nNewPointCount can only occur on
@@ -565,6 +643,8 @@ void OGRSimpleCurve::setPoint(int iPoint, double xIn, double yIn, double zIn)
     if (paoPoints == nullptr)
         return;
 #endif
+    if (m_bPointsBorrowed && !MakePointsOwned())
+        return;
 
     paoPoints[iPoint].x = xIn;
     paoPoints[iPoint].y = yIn;
@@ -606,6 +686,8 @@ void OGRSimpleCurve::setPointM(int iPoint, double xIn, double yIn, double mIn)
     if (paoPoints == nullptr)
         return;
 #endif
+    if (m_bPointsBorrowed && !MakePointsOwned())
+        return;
 
     paoPoints[iPoint].x = xIn;
     paoPoints[iPoint].y = yIn;
@@ -651,6 +733,8 @@ void OGRSimpleCurve::setPoint(int iPoint, double xIn, double yIn, double zIn,
     if (paoPoints == nullptr)
         return;
 #endif
+    if (m_bPointsBorrowed && !MakePointsOwned())
+        return;
 
     paoPoints[iPoint].x = xIn;
     paoPoints[iPoint].y = yIn;
@@ -688,6 +772,8 @@ void OGRSimpleCurve::setPoint(int iPoint, double xIn, double yIn)
         if (nPointCount < iPoint + 1 || paoPoints == nullptr)
             return;
     }
+    if (m_bPointsBorrowed && !MakePointsOwned())
+        return;
 
     paoPoints[iPoint].x = xIn;
     paoPoints[iPoint].y = yIn;
@@ -722,6 +808,9 @@ void OGRSimpleCurve::setZ(int iPoint, double zIn)
             return;
     }
 
+    if (m_bPointsBorrowed && !MakePointsOwned())
+        return;
+
     if (padfZ != nullptr)
         padfZ[iPoint] = zIn;
 }
@@ -755,6 +844,9 @@ void OGRSimpleCurve::setM(int iPoint, double mIn)
             return;
     }
 
+    if (m_bPointsBorrowed && !MakePointsOwned())
+        return;
+
     if (padfM != nullptr)
         padfM[iPoint] = mIn;
 }
@@ -887,6 +979,8 @@ bool OGRSimpleCurve::removePoint(int nIndex)
 {
     if (nIndex < 0 || nIndex >= nPointCount)
         return false;
+    if (!MakePointsOwned())
+        return false;
     if (nIndex < nPointCount - 1)
     {
         memmove(paoPoints + nIndex, paoPoints + nIndex + 1,
@@ -1227,6 +1321,85 @@ void OGRSimpleCurve::setPoints(int nPointsIn, const double *padfX,
         memcpy(padfM, padfMIn, sizeof(double) * nPointsIn);
 }
 
+/************************************************************************/
+/*                         setBorrowedPoints()                          */
+/************************************************************************/
+
+/**
+ * \brief Assign all points in a line string, without copying them.
+ *
+ * Contrary to setPoints(), the passed arrays are referenced by the line string
+ * instead of being copied into it. This avoids allocations and copies when
+ * building geometries from existing coordinate buffers, for example
+ * interleaved XY coordinates of an Arrow array, or the output of a coordinate
+ * transformation.
+ *
+ * The arrays must remain valid and unmodified during the lifetime of the line
+ * string, or until it is modified: any method modifying the points
+ * (setPoint(), addPoint(), setNumPoints(), transform(), etc.) first replaces
+ * them by a copy owned by the line string. Copies of the line string, made by
+ * clone(), the copy constructor or the assignment operator, also own their
+ * points.
+ *
+ * There is no SFCOM analog to this method.
+ *
+ * @param nPointsIn number of points being passed in paoPointsIn
+ * @param paoPointsIn list of points being assigned.
+ * @param padfZIn the Z values that go with the points, or NULL.
+ * @param padfMIn the M values that go with the points, or NULL.
+ * @since GDAL 3.10
+ */
+
+void OGRSimpleCurve::setBorrowedPoints(int nPointsIn,
+                                       const OGRRawPoint *paoPointsIn,
+                                       const double *padfZIn,
+                                       const double *padfMIn)
+
+{
+    if (!m_bPointsBorrowed)
+    {
+        CPLFree(paoPoints);
+        CPLFree(padfZ);
+        CPLFree(padfM);
+    }
+    paoPoints = nullptr;
+    padfZ = nullptr;
+    padfM = nullptr;
+    nPointCount = 0;
+    m_nPointCapacity = 0;
+    m_bPointsBorrowed = false;
+
+    if (nPointsIn <= 0)
+    {
+        if (padfZIn)
+            Make3D();
+        else
+            Make2D();
+        if (padfMIn)
+            AddM();
+        else
+            RemoveM();
+        return;
+    }
+
+    // The arrays are not modified as long as m_bPointsBorrowed is set
+    paoPoints = const_cast<OGRRawPoint *>(paoPointsIn);
+    padfZ = const_cast<double *>(padfZIn);
+    padfM = const_cast<double *>(padfMIn);
+    nPointCount = nPointsIn;
+    m_nPointCapacity = nPointsIn;
+    m_bPointsBorrowed = true;
+
+    if (padfZIn)
+        flags |= OGR_G_3D;
+    else
+        flags &= ~OGR_G_3D;
+    if (padfMIn)
+        flags |= OGR_G_MEASURED;
+    else
+        flags &= ~OGR_G_MEASURED;
+}
+
 /************************************************************************/
 /*                          getPoints()                                 */
 /************************************************************************/
@@ -1378,6 +1551,9 @@ void OGRSimpleCurve::getPoints(void *pabyX, int nXStride, void *pabyY,
 void OGRSimpleCurve::reversePoints()
 
 {
+    if (!MakePointsOwned())
+        return;
+
     for (int i = 0; i < nPointCount / 2; i++)
     {
         std::swap(paoPoints[i], paoPoints[nPointCount - i - 1]);
@@ -2289,27 +2465,13 @@ void OGRSimpleCurve::getEnvelope(OGREnvelope *psEnvelope) const
         return;
     }
 
-    double dfMinX = paoPoints[0].x;
-    double dfMaxX = paoPoints[0].x;
-    double dfMinY = paoPoints[0].y;
-    double dfMaxY = paoPoints[0].y;
+    psEnvelope->MinX = paoPoints[0].x;
+    psEnvelope->MaxX = paoPoints[0].x;
+    psEnvelope->MinY = paoPoints[0].y;
+    psEnvelope->MaxY = paoPoints[0].y;
 
-    for (int iPoint = 1; iPoint < nPointCount; iPoint++)
-    {
-        if (dfMaxX < paoPoints[iPoint].x)
-            dfMaxX = paoPoints[iPoint].x;
-        if (dfMaxY < paoPoints[iPoint].y)
-            dfMaxY = paoPoints[iPoint].y;
-        if (dfMinX > paoPoints[iPoint].x)
-            dfMinX = paoPoints[iPoint].x;
-        if (dfMinY > paoPoints[iPoint].y)
-            dfMinY = paoPoints[iPoint].y;
-    }
-
-    psEnvelope->MinX = dfMinX;
-    psEnvelope->MaxX = dfMaxX;
-    psEnvelope->MinY = dfMinY;
-    psEnvelope->MaxY = dfMaxY;
+    OGRExtendEnvelopeXY(paoPoints + 1, sizeof(OGRRawPoint), nPointCount - 1,
+                        *psEnvelope);
 }
 
 /************************************************************************/
@@ -2649,21 +2811,25 @@ void OGRSimpleCurve::segmentize(double dfMaxLength)
         }
     }
 
-    CPLFree(paoPoints);
+    if (!m_bPointsBorrowed)
+        CPLFree(paoPoints);
     paoPoints = paoNewPoints;
     nPointCount = nNewPointCount;
     m_nPointCapacity = nNewPointCount;
 
     if (padfZ != nullptr)
     {
-        CPLFree(padfZ);
+        if (!m_bPointsBorrowed)
+            CPLFree(padfZ);
         padfZ = padfNewZ;
     }
     if (padfM != nullptr)
     {
-        CPLFree(padfM);
+        if (!m_bPointsBorrowed)
+            CPLFree(padfM);
         padfM = padfNewM;
     }
+    m_bPointsBorrowed = false;
 }
 
 /************************************************************************/
@@ -2672,6 +2838,9 @@ void OGRSimpleCurve::segmentize(double dfMaxLength)
 
 void OGRSimpleCurve::swapXY()
 {
+    if (!MakePointsOwned())
+        return;
+
     for (int i = 0; i < nPointCount; i++)
     {
         std::swap(paoPoints[i].x, paoPoints[i].y);
@@ -2878,11 +3047,13 @@ OGRLineString *OGRLineString::TransferMembersAndDestroy(OGRLineString *poSrc,
     poDst->paoPoints = poSrc->paoPoints;
     poDst->padfZ = poSrc->padfZ;
     poDst->padfM = poSrc->padfM;
+    poDst->m_bPointsBorrowed = poSrc->m_bPointsBorrowed;
     poSrc->nPointCount = 0;
     poSrc->m_nPointCapacity = 0;
     poSrc->paoPoints = nullptr;
     poSrc->padfZ = nullptr;
     poSrc->padfM = nullptr;
+    poSrc->m_bPointsBorrowed = false;
     delete poSrc;
     return poDst;
 }
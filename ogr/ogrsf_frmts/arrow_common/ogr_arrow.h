@@ -124,6 +124,10 @@ class OGRArrowLayer CPL_NON_FINAL
 
     bool SkipToNextFeatureDueToAttributeFilter() const;
     void ExploreExprNode(const swq_expr_node *poNode);
+    bool FillConstraintFromComparisonNode(const swq_expr_node *poNode,
+                                          Constraint &constraint) const;
+    bool ExploreOrExprNode(const swq_expr_node *poNode,
+                           std::vector<Constraint> &asConstraints) const;
     bool UseRecordBatchBaseImplementation() const;
 
     template <typename SourceOffset>
@@ -210,6 +214,12 @@ class OGRArrowLayer CPL_NON_FINAL
 
     std::vector<Constraint> m_asAttributeFilterConstraints{};
 
+    //! Disjunctions of constraints, coming from OR and IN expressions
+    // found in the top-level AND chain of the attribute filter. A feature can
+    // only match if, for each disjunction, at least one of its constraints is
+    // true. Only used to skip whole row groups, not for per-feature filtering.
+    std::vector<std::vector<Constraint>> m_aasAttributeFilterOrConstraints{};
+
     //! Whether attribute filter should be skipped.
     // This is set to true by OGRParquetDatasetLayer when it can fully translate
     // a filter, as an optimization.
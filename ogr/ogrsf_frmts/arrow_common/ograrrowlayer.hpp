@@ -3329,6 +3329,141 @@ inline void OGRArrowLayer::ComputeConstraintsArrayIdx()
     }
 }
 
+/***********************************************************************/
+/*                  FillConstraintFromComparisonNode()                 */
+/***********************************************************************/
+
+inline bool OGRArrowLayer::FillConstraintFromComparisonNode(
+    const swq_expr_node *poNode, Constraint &constraint) const
+{
+    const swq_expr_node *poColumn = GetColumnSubNode(poNode);
+    const swq_expr_node *poValue = GetConstantSubNode(poNode);
+    if (poColumn != nullptr && poValue != nullptr &&
+        (poColumn->field_index < m_poFeatureDefn->GetFieldCount() ||
+         poColumn->field_index == m_poFeatureDefn->GetFieldCount() + SPF_FID))
+    {
+        const OGRFieldDefn oDummyFIDFieldDefn(m_osFIDColumn.c_str(),
+                                              OFTInteger64);
+        const OGRFieldDefn *poFieldDefn =
+            (poColumn->field_index ==
+             m_poFeatureDefn->GetFieldCount() + SPF_FID)
+                ? &oDummyFIDFieldDefn
+                : m_poFeatureDefn->GetFieldDefn(poColumn->field_index);
+
+        constraint.iField = poColumn->field_index;
+        constraint.nOperation = poNode->nOperation;
+
+        if (FillTargetValueFromSrcExpr(poFieldDefn, &constraint, poValue))
+        {
+            if (poColumn == poNode->papoSubExpr[0])
+            {
+                // nothing to do
+            }
+            else
+            {
+                /* If "constant op column", then we must reverse */
+                /* the operator for LE, LT, GE, GT */
+                switch (poNode->nOperation)
+                {
+                    case SWQ_LE:
+                        constraint.nOperation = SWQ_GE;
+                        break;
+                    case SWQ_LT:
+                        constraint.nOperation = SWQ_GT;
+                        break;
+                    case SWQ_NE: /* do nothing */;
+                        break;
+                    case SWQ_EQ: /* do nothing */;
+                        break;
+                    case SWQ_GE:
+                        constraint.nOperation = SWQ_LE;
+                        break;
+                    case SWQ_GT:
+                        constraint.nOperation = SWQ_LT;
+                        break;
+                    default:
+                        CPLAssert(false);
+                        break;
+                }
+            }
+
+            return true;
+        }
+    }
+    return false;
+}
+
+/***********************************************************************/
+/*                        ExploreOrExprNode()                          */
+/***********************************************************************/
+
+//! Collect the constraints of a disjunction made of comparisons, IN lists
+// and nested OR. Returns false if a member of the disjunction cannot be
+// expressed as a constraint, in which case the disjunction is unusable.
+inline bool
+OGRArrowLayer::ExploreOrExprNode(const swq_expr_node *poNode,
+                                 std::vector<Constraint> &asConstraints) const
+{
+    if (poNode->eNodeType != SNT_OPERATION)
+        return false;
+
+    if (poNode->nOperation == SWQ_OR && poNode->nSubExprCount == 2)
+    {
+        return ExploreOrExprNode(poNode->papoSubExpr[0], asConstraints) &&
+               ExploreOrExprNode(poNode->papoSubExpr[1], asConstraints);
+    }
+
+    if (IsComparisonOp(poNode->nOperation) && poNode->nSubExprCount == 2)
+    {
+        Constraint constraint;
+        if (!FillConstraintFromComparisonNode(poNode, constraint))
+            return false;
+        asConstraints.emplace_back(std::move(constraint));
+        return true;
+    }
+
+    if (poNode->nOperation == SWQ_IN && poNode->nSubExprCount >= 2)
+    {
+        const swq_expr_node *poColumn = poNode->papoSubExpr[0];
+        if (poColumn->eNodeType != SNT_COLUMN ||
+            !(poColumn->field_index < m_poFeatureDefn->GetFieldCount() ||
+              poColumn->field_index ==
+                  m_poFeatureDefn->GetFieldCount() + SPF_FID))
+        {
+            return false;
+        }
+        const OGRFieldDefn oDummyFIDFieldDefn(m_osFIDColumn.c_str(),
+                                              OFTInteger64);
+        const OGRFieldDefn *poFieldDefn =
+            (poColumn->field_index ==
+             m_poFeatureDefn->GetFieldCount() + SPF_FID)
+                ? &oDummyFIDFieldDefn
+                : m_poFeatureDefn->GetFieldDefn(poColumn->field_index);
+        for (int i = 1; i < poNode->nSubExprCount; ++i)
+        {
+            const swq_expr_node *poValue = poNode->papoSubExpr[i];
+            if (poValue->eNodeType != SNT_CONSTANT || poValue->is_null)
+                return false;
+            const bool bIsStringValue = poValue->field_type == SWQ_STRING;
+            const bool bIsNumericValue = poValue->field_type == SWQ_INTEGER ||
+                                         poValue->field_type == SWQ_INTEGER64 ||
+                                         poValue->field_type == SWQ_FLOAT;
+            if (poFieldDefn->GetType() == OFTString ? !bIsStringValue
+                                                    : !bIsNumericValue)
+                return false;
+            Constraint constraint;
+            constraint.iField = poColumn->field_index;
+            constraint.nOperation = SWQ_EQ;
+            if (!FillTargetValueFromSrcExpr(poFieldDefn, &constraint, poValue))
+                return false;
+            asConstraints.emplace_back(std::move(constraint));
+        }
+        return true;
+    }
+
+    return false;
+}
+
 /***********************************************************************/
 /*                     ExploreExprNode()                               */
 /***********************************************************************/
@@ -3348,61 +3483,19 @@ inline void OGRArrowLayer::ExploreExprNode(const swq_expr_node *poNode)
     else if (poNode->eNodeType == SNT_OPERATION &&
              IsComparisonOp(poNode->nOperation) && poNode->nSubExprCount == 2)
     {
-        const swq_expr_node *poColumn = GetColumnSubNode(poNode);
-        const swq_expr_node *poValue = GetConstantSubNode(poNode);
-        if (poColumn != nullptr && poValue != nullptr &&
-            (poColumn->field_index < m_poFeatureDefn->GetFieldCount() ||
-             poColumn->field_index ==
-                 m_poFeatureDefn->GetFieldCount() + SPF_FID))
-        {
-            const OGRFieldDefn oDummyFIDFieldDefn(m_osFIDColumn.c_str(),
-                                                  OFTInteger64);
-            const OGRFieldDefn *poFieldDefn =
-                (poColumn->field_index ==
-                 m_poFeatureDefn->GetFieldCount() + SPF_FID)
-                    ? &oDummyFIDFieldDefn
-                    : m_poFeatureDefn->GetFieldDefn(poColumn->field_index);
-
-            Constraint constraint;
-            constraint.iField = poColumn->field_index;
-            constraint.nOperation = poNode->nOperation;
-
-            if (FillTargetValueFromSrcExpr(poFieldDefn, &constraint, poValue))
-            {
-                if (poColumn == poNode->papoSubExpr[0])
-                {
-                    // nothing to do
-                }
-                else
-                {
-                    /* If "constant op column", then we must reverse */
-                    /* the operator for LE, LT, GE, GT */
-                    switch (poNode->nOperation)
-                    {
-                        case SWQ_LE:
-                            constraint.nOperation = SWQ_GE;
-                            break;
-                        case SWQ_LT:
-                            constraint.nOperation = SWQ_GT;
-                            break;
-                        case SWQ_NE: /* do nothing */;
-                            break;
-                        case SWQ_EQ: /* do nothing */;
-                            break;
-                        case SWQ_GE:
-                            constraint.nOperation = SWQ_LE;
-                            break;
-                        case SWQ_GT:
-                            constraint.nOperation = SWQ_LT;
-                            break;
-                        default:
-                            CPLAssert(false);
-                            break;
-                    }
-                }
+        Constraint constraint;
+        if (FillConstraintFromComparisonNode(poNode, constraint))
+            AddConstraint(constraint);
+    }
 
-                AddConstraint(constraint);
-            }
+    else if (poNode->eNodeType == SNT_OPERATION &&
+             (poNode->nOperation == SWQ_OR || poNode->nOperation == SWQ_IN))
+    {
+        std::vector<Constraint> asConstraints;
+        if (ExploreOrExprNode(poNode, asConstraints) && !asConstraints.empty())
+        {
+            m_aasAttributeFilterOrConstraints.emplace_back(
+                std::move(asConstraints));
         }
     }
 
@@ -3445,6 +3538,7 @@ inline void OGRArrowLayer::ExploreExprNode(const swq_expr_node *poNode)
 inline OGRErr OGRArrowLayer::SetAttributeFilter(const char *pszFilter)
 {
     m_asAttributeFilterConstraints.clear();
+    m_aasAttributeFilterOrConstraints.clear();
 
     // When changing filters, we need to invalidate cached batches, as
     // PostFilterArrowArray() has potentially modified array contents
@@ -33,6 +33,7 @@
 
 #include "ogrsf_frmts.h"
 
+#include <memory>
 #include <set>
 
 typedef enum
@@ -46,6 +47,7 @@ typedef enum
 } OGRCSVGeometryFormat;
 
 class OGRCSVDataSource;
+class OGRCSVParallelReader;
 
 typedef enum
 {
@@ -148,7 +150,12 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
 
     StringQuoting m_eStringQuoting = StringQuoting::IF_AMBIGUOUS;
 
+    std::unique_ptr<OGRCSVParallelReader> m_poParallelReader{};
+    bool m_bParallelReaderTried = false;
+
     char **GetNextLineTokens();
+    void Rewind();
+    OGRPoint *BuildPointFromXYZ(char **papszTokens, int nAttrCount) const;
 
     static bool Matches(const char *pszFieldName, char **papszPossibleNames);
 
@@ -227,6 +234,8 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
     void ResetReading() override;
     OGRFeature *GetNextFeature() override;
     virtual OGRFeature *GetFeature(GIntBig nFID) override;
+    int GetNextArrowArray(struct ArrowArrayStream *,
+                          struct ArrowArray *out_array) override;
 
     OGRFeatureDefn *GetLayerDefn() override
     {
@@ -246,6 +255,9 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
                                    int bApproxOK = TRUE) override;
 
     virtual OGRErr ICreateFeature(OGRFeature *poFeature) override;
+    bool WriteArrowBatch(const struct ArrowSchema *schema,
+                         struct ArrowArray *array,
+                         CSLConstList papszOptions = nullptr) override;
 
     void SetCRLF(bool bNewValue);
     void SetWriteGeometry(OGRwkbGeometryType eGType,
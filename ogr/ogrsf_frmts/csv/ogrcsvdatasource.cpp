@@ -902,6 +902,13 @@ bool OGRCSVDataSource::OpenTable(const char *pszFilename,
     poCSVLayer->BuildFeatureDefn(pszNfdcRunwaysGeomField,
                                  pszGeonamesGeomFieldPrefix,
                                  papszOpenOptionsIn);
+    if (!bUpdate && !EQUAL(pszFilename, "/vsistdin/") &&
+        pszNfdcRunwaysGeomField == nullptr &&
+        pszGeonamesGeomFieldPrefix == nullptr &&
+        poCSVLayer->GetLayerDefn()->GetGeomFieldCount() > 0)
+    {
+        poCSVLayer->InitializeSidecarSpatialIndexSupport(pszFilename);
+    }
     if (bUpdate)
     {
         m_apoLayers.emplace_back(std::make_unique<OGRCSVEditableLayer>(
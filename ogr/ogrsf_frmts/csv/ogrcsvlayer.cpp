@@ -40,26 +40,436 @@
 #include <fcntl.h>
 #endif
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
+#if defined(__x86_64) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
 #include "cpl_conv.h"
 #include "cpl_csv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "cpl_vsi_virtual.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
 #include "ogr_geometry.h"
 #include "ogr_p.h"
 #include "ogr_spatialref.h"
+#include "ograrrowarrayhelper.h"
+#include "ogrlayerarrow.h"
 #include "ogrsf_frmts.h"
 
 #define DIGIT_ZERO '0'
 
+/************************************************************************/
+/*                        OGRCSVParallelReader                          */
+/*                                                                      */
+/*      Used by OGRCSVLayer::GetNextLineTokens() when several threads   */
+/*      are allowed. The calling thread reads the file by large blocks  */
+/*      and only looks for the line endings that are outside of quoted  */
+/*      fields, which delimit chunks made of whole records. Worker      */
+/*      threads split the records of those chunks into fields, with     */
+/*      the same rules as CSVReadParseLine3L(), and records are         */
+/*      returned in file order.                                         */
+/************************************************************************/
+
+class OGRCSVParallelReader
+{
+  public:
+    static std::unique_ptr<OGRCSVParallelReader>
+    Create(VSILFILE *fp, int nThreads, int nMaxLineSize,
+           const char *pszDelimiter, bool bHonourStrings, bool bMergeDelimiter);
+
+    ~OGRCSVParallelReader();
+
+    char **GetNextTokens();
+
+    // Make the next call to GetNextTokens() return papszTokens
+    void UngetTokens(char **papszTokens)
+    {
+        CPLAssert(m_papszUngetTokens == nullptr);
+        m_papszUngetTokens = papszTokens;
+    }
+
+  private:
+    struct Chunk
+    {
+        OGRCSVParallelReader *poReader = nullptr;
+        std::string osData{};
+        std::vector<char **> apapszTokens{};
+        // Set if reading must stop after the records of this chunk.
+        bool bError = false;
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+        bool bDone = false;
+
+        Chunk() = default;
+
+        ~Chunk()
+        {
+            for (char **papszTokens : apapszTokens)
+                CSLDestroy(papszTokens);
+        }
+
+        CPL_DISALLOW_COPY_ASSIGN(Chunk)
+    };
+
+    static constexpr size_t CHUNK_SIZE = 1024 * 1024;
+    static constexpr size_t BUFFER_SIZE = 256 * 1024;
+
+    VSILFILE *m_fp = nullptr;
+    int m_nMaxLineSize = 0;
+    std::string m_osDelimiter{};
+    bool m_bHonourStrings = true;
+    bool m_bMergeDelimiter = false;
+    char **m_papszUngetTokens = nullptr;
+
+    // Bytes read from the file, and not yet assigned to a chunk
+    std::string m_osPending{};
+    bool m_bEOF = false;
+    bool m_bFinished = false;
+
+    // State of the byte scanner
+    size_t m_nScanPos = 0;
+    size_t m_nLastRecordEnd = 0;
+    size_t m_nCurLineLen = 0;
+    bool m_bOddQuoteCount = false;
+    bool m_bNulInLine = false;
+
+    std::unique_ptr<CPLJobQueue> m_poJobQueue{};
+    std::deque<std::unique_ptr<Chunk>> m_apoChunks{};
+    size_t m_nMaxChunksInFlight = 0;
+    size_t m_iNextInFrontChunk = 0;
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+
+    OGRCSVParallelReader() = default;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRCSVParallelReader)
+
+    void Scan();
+    bool FillChunk(Chunk &oChunk);
+    void SubmitChunks();
+    static void ProcessChunk(void *pData);
+};
+
+/************************************************************************/
+/*                     OGRCSVSkipRegularBytes()                         */
+/*                                                                      */
+/*      Return the number of leading bytes of pabyData that are not a   */
+/*      double quote, a line ending or a nul character.                 */
+/************************************************************************/
+
+static size_t OGRCSVSkipRegularBytes(const char *pabyData, size_t nLen)
+{
+    size_t i = 0;
+#if defined(__x86_64) || defined(_M_X64)
+    const __m128i xmmQuote = _mm_set1_epi8('"');
+    const __m128i xmmCR = _mm_set1_epi8('\r');
+    const __m128i xmmLF = _mm_set1_epi8('\n');
+    const __m128i xmmZero = _mm_setzero_si128();
+    while (i + sizeof(__m128i) <= nLen)
+    {
+        const __m128i xmm =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(pabyData + i));
+        const __m128i xmmMatch =
+            _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(xmm, xmmQuote),
+                                      _mm_cmpeq_epi8(xmm, xmmZero)),
+                         _mm_or_si128(_mm_cmpeq_epi8(xmm, xmmCR),
+                                      _mm_cmpeq_epi8(xmm, xmmLF)));
+        if (_mm_movemask_epi8(xmmMatch))
+            break;
+        i += sizeof(__m128i);
+    }
+#endif
+    while (i < nLen)
+    {
+        const char ch = pabyData[i];
+        if (ch == '"' || ch == '\r' || ch == '\n' || ch == '\0')
+            break;
+        ++i;
+    }
+    return i;
+}
+
+/************************************************************************/
+/*                   OGRCSVParallelReader::Create()                     */
+/************************************************************************/
+
+std::unique_ptr<OGRCSVParallelReader>
+OGRCSVParallelReader::Create(VSILFILE *fp, int nThreads, int nMaxLineSize,
+                             const char *pszDelimiter, bool bHonourStrings,
+                             bool bMergeDelimiter)
+{
+    CPLWorkerThreadPool *poPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poPool)
+        return nullptr;
+    auto poJobQueue = poPool->CreateJobQueue();
+    if (!poJobQueue)
+        return nullptr;
+
+    auto poReader =
+        std::unique_ptr<OGRCSVParallelReader>(new OGRCSVParallelReader());
+    poReader->m_fp = fp;
+    poReader->m_nMaxLineSize = nMaxLineSize;
+    poReader->m_osDelimiter = pszDelimiter;
+    poReader->m_bHonourStrings = bHonourStrings;
+    poReader->m_bMergeDelimiter = bMergeDelimiter;
+    poReader->m_poJobQueue = std::move(poJobQueue);
+    // Keep enough work queued so that workers do not starve while the
+    // calling thread consumes records.
+    poReader->m_nMaxChunksInFlight = 2 * static_cast<size_t>(nThreads);
+    poReader->SubmitChunks();
+    return poReader;
+}
+
+/************************************************************************/
+/*                   ~OGRCSVParallelReader()                            */
+/************************************************************************/
+
+OGRCSVParallelReader::~OGRCSVParallelReader()
+{
+    if (m_poJobQueue)
+        m_poJobQueue->WaitCompletion();
+    CSLDestroy(m_papszUngetTokens);
+}
+
+/************************************************************************/
+/*                    OGRCSVParallelReader::Scan()                      */
+/*                                                                      */
+/*      Scan the pending bytes not yet looked at, to find the end of    */
+/*      the last complete record. Like CSVReadParseLine3L(), a record   */
+/*      spans several lines as long as it has an odd number of double   */
+/*      quotes, and each line is only considered up to its first nul    */
+/*      character.                                                      */
+/************************************************************************/
+
+void OGRCSVParallelReader::Scan()
+{
+    const char *pabyData = m_osPending.data();
+    const size_t nLen = m_osPending.size();
+    size_t i = m_nScanPos;
+    while (i < nLen)
+    {
+        const size_t nRegular = OGRCSVSkipRegularBytes(pabyData + i, nLen - i);
+        m_nCurLineLen += nRegular;
+        i += nRegular;
+        if (i == nLen)
+            break;
+
+        const char ch = pabyData[i];
+        if (ch == '\r' || ch == '\n')
+        {
+            m_nCurLineLen = 0;
+            m_bNulInLine = false;
+            if (!m_bOddQuoteCount)
+                m_nLastRecordEnd = i + 1;
+        }
+        else
+        {
+            m_nCurLineLen++;
+            if (ch == '\0')
+                m_bNulInLine = true;
+            else if (m_bHonourStrings && !m_bNulInLine)
+                m_bOddQuoteCount = !m_bOddQuoteCount;
+        }
+        ++i;
+    }
+    m_nScanPos = nLen;
+}
+
+/************************************************************************/
+/*                  OGRCSVParallelReader::FillChunk()                   */
+/************************************************************************/
+
+bool OGRCSVParallelReader::FillChunk(Chunk &oChunk)
+{
+    bool bTakeAll = false;
+    while (!m_bEOF && m_nLastRecordEnd < CHUNK_SIZE)
+    {
+        const size_t nOldSize = m_osPending.size();
+        try
+        {
+            m_osPending.resize(nOldSize + BUFFER_SIZE);
+        }
+        catch (const std::exception &e)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+            return false;
+        }
+        const size_t nRead =
+            VSIFReadL(&m_osPending[nOldSize], 1, BUFFER_SIZE, m_fp);
+        m_osPending.resize(nOldSize + nRead);
+        if (nRead < BUFFER_SIZE)
+            m_bEOF = true;
+        Scan();
+
+        // Let the worker thread emit the error about the too long line.
+        if (m_nMaxLineSize > 0 &&
+            m_nCurLineLen >= static_cast<size_t>(m_nMaxLineSize))
+        {
+            bTakeAll = true;
+            m_bEOF = true;
+            break;
+        }
+    }
+
+    const size_t nChunkSize =
+        (m_bEOF || bTakeAll) ? m_osPending.size() : m_nLastRecordEnd;
+    oChunk.osData.assign(m_osPending, 0, nChunkSize);
+    m_osPending.erase(0, nChunkSize);
+    m_nScanPos -= nChunkSize;
+    m_nLastRecordEnd =
+        m_nLastRecordEnd >= nChunkSize ? m_nLastRecordEnd - nChunkSize : 0;
+    if (m_bEOF && m_osPending.empty())
+        m_bFinished = true;
+    return true;
+}
+
+/************************************************************************/
+/*                OGRCSVParallelReader::SubmitChunks()                  */
+/************************************************************************/
+
+void OGRCSVParallelReader::SubmitChunks()
+{
+    while (!m_bFinished && m_apoChunks.size() < m_nMaxChunksInFlight)
+    {
+        auto poChunk = std::make_unique<Chunk>();
+        poChunk->poReader = this;
+        if (!FillChunk(*poChunk))
+        {
+            poChunk->bError = true;
+            m_bFinished = true;
+        }
+        else if (poChunk->osData.empty())
+        {
+            break;
+        }
+        Chunk *poChunkPtr = poChunk.get();
+        m_apoChunks.push_back(std::move(poChunk));
+        if (!m_poJobQueue->SubmitJob(ProcessChunk, poChunkPtr))
+            ProcessChunk(poChunkPtr);
+    }
+}
+
+/************************************************************************/
+/*                OGRCSVParallelReader::ProcessChunk()                  */
+/************************************************************************/
+
+void OGRCSVParallelReader::ProcessChunk(void *pData)
+{
+    Chunk *poChunk = static_cast<Chunk *>(pData);
+    OGRCSVParallelReader *poReader = poChunk->poReader;
+
+    CPLInstallErrorHandlerAccumulator(poChunk->aoErrors);
+
+    const std::string osTmpFilename(
+        CPLSPrintf("/vsimem/ogrcsv_chunk_%p", poChunk));
+    VSILFILE *fp = VSIFileFromMemBuffer(
+        osTmpFilename.c_str(),
+        reinterpret_cast<GByte *>(poChunk->osData.data()),
+        poChunk->osData.size(), FALSE);
+    while (fp)
+    {
+        char **papszTokens = CSVReadParseLine3L(
+            fp, poReader->m_nMaxLineSize, poReader->m_osDelimiter.c_str(),
+            poReader->m_bHonourStrings,
+            false,  // bKeepLeadingAndClosingQuotes
+            poReader->m_bMergeDelimiter,
+            true  // bSkipBOM
+        );
+        if (papszTokens == nullptr)
+        {
+            // Stop at the first error, as the sequential reader does
+            if (VSIFTellL(fp) < poChunk->osData.size())
+                poChunk->bError = true;
+            break;
+        }
+        if (papszTokens[0] == nullptr)
+        {
+            CSLDestroy(papszTokens);
+            continue;
+        }
+        poChunk->apapszTokens.push_back(papszTokens);
+    }
+    if (fp)
+        VSIFCloseL(fp);
+    VSIUnlink(osTmpFilename.c_str());
+    poChunk->osData = std::string();
+
+    CPLUninstallErrorHandlerAccumulator();
+
+    std::lock_guard<std::mutex> oLock(poReader->m_oMutex);
+    poChunk->bDone = true;
+    poReader->m_oCV.notify_one();
+}
+
+/************************************************************************/
+/*               OGRCSVParallelReader::GetNextTokens()                  */
+/************************************************************************/
+
+char **OGRCSVParallelReader::GetNextTokens()
+{
+    if (m_papszUngetTokens)
+    {
+        char **papszTokens = m_papszUngetTokens;
+        m_papszUngetTokens = nullptr;
+        return papszTokens;
+    }
+
+    while (true)
+    {
+        if (m_apoChunks.empty())
+            return nullptr;
+
+        Chunk *poChunk = m_apoChunks.front().get();
+        if (m_iNextInFrontChunk == 0)
+        {
+            {
+                std::unique_lock<std::mutex> oLock(m_oMutex);
+                while (!poChunk->bDone)
+                    m_oCV.wait(oLock);
+            }
+            for (const auto &oError : poChunk->aoErrors)
+            {
+                CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+            }
+            poChunk->aoErrors.clear();
+        }
+
+        if (m_iNextInFrontChunk < poChunk->apapszTokens.size())
+        {
+            char **papszTokens = poChunk->apapszTokens[m_iNextInFrontChunk];
+            poChunk->apapszTokens[m_iNextInFrontChunk] = nullptr;
+            ++m_iNextInFrontChunk;
+            return papszTokens;
+        }
+
+        if (poChunk->bError)
+        {
+            m_bFinished = true;
+            m_poJobQueue->WaitCompletion();
+            m_apoChunks.clear();
+            return nullptr;
+        }
+
+        m_apoChunks.pop_front();
+        m_iNextInFrontChunk = 0;
+        SubmitChunks();
+    }
+}
+
 /************************************************************************/
 /*                            OGRCSVLayer()                             */
 /*                                                                      */
@@ -1285,6 +1695,23 @@ OGRCSVLayer::~OGRCSVLayer()
 void OGRCSVLayer::ResetReading()
 
 {
+    Rewind();
+    ResetSidecarSpatialIndexReading();
+}
+
+/************************************************************************/
+/*                               Rewind()                               */
+/*                                                                      */
+/*      Go back to the first record of the file, without resetting the  */
+/*      iteration over the sidecar spatial index results.               */
+/************************************************************************/
+
+void OGRCSVLayer::Rewind()
+
+{
+    m_poParallelReader.reset();
+    m_bParallelReaderTried = false;
+
     if (fpCSV)
         VSIRewindL(fpCSV);
 
@@ -1301,12 +1728,44 @@ void OGRCSVLayer::ResetReading()
     nNextFID = 1;
 }
 
+/************************************************************************/
+/*                     OGRCSVGetReadThreadCount()                       */
+/************************************************************************/
+
+static int OGRCSVGetReadThreadCount()
+{
+    const char *pszNumThreads =
+        CPLGetConfigOption("OGR_CSV_NUM_THREADS", nullptr);
+    if (!pszNumThreads)
+        pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (!pszNumThreads)
+        return 1;
+    const int nThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                             ? CPLGetNumCPUs()
+                             : atoi(pszNumThreads);
+    return std::max(1, GDALCapThreadCount(std::min(nThreads, 128)));
+}
+
 /************************************************************************/
 /*                        GetNextLineTokens()                           */
 /************************************************************************/
 
 char **OGRCSVLayer::GetNextLineTokens()
 {
+    if (!m_bParallelReaderTried)
+    {
+        m_bParallelReaderTried = true;
+        const int nThreads = OGRCSVGetReadThreadCount();
+        if (nThreads > 1 && !bInWriteMode && fpCSV)
+        {
+            m_poParallelReader = OGRCSVParallelReader::Create(
+                fpCSV, nThreads, m_nMaxLineSize, szDelimiter, bHonourStrings,
+                bMergeDelimiter);
+        }
+    }
+    if (m_poParallelReader)
+        return m_poParallelReader->GetNextTokens();
+
     while (true)
     {
         // Read the CSV record.
@@ -1335,7 +1794,7 @@ OGRFeature *OGRCSVLayer::GetFeature(GIntBig nFID)
     if (nFID < 1 || fpCSV == nullptr)
         return nullptr;
     if (nFID < nNextFID || bNeedRewindBeforeRead)
-        ResetReading();
+        Rewind();
     while (nNextFID < nFID)
     {
         char **papszTokens = GetNextLineTokens();
@@ -1347,6 +1806,97 @@ OGRFeature *OGRCSVLayer::GetFeature(GIntBig nFID)
     return GetNextUnfilteredFeature();
 }
 
+/************************************************************************/
+/*                        OGRCSVParseGeometry()                         */
+/*                                                                      */
+/*      Parse a geometry column value, either as WKT, GeoJSON or        */
+/*      hexadecimal (E)WKB.                                             */
+/************************************************************************/
+
+static OGRGeometry *OGRCSVParseGeometry(const char *pszStr,
+                                        const OGRSpatialReference *poSRS)
+{
+    while (*pszStr == ' ')
+        pszStr++;
+    OGRGeometry *poGeom = nullptr;
+
+    CPLPushErrorHandler(CPLQuietErrorHandler);
+    if (OGRGeometryFactory::createFromWkt(pszStr, nullptr, &poGeom) ==
+        OGRERR_NONE)
+    {
+        poGeom->assignSpatialReference(poSRS);
+    }
+    else if (*pszStr == '{')
+    {
+        poGeom =
+            OGRGeometry::FromHandle(OGR_G_CreateGeometryFromJson(pszStr));
+    }
+    else if ((*pszStr >= '0' && *pszStr <= '9') ||
+             (*pszStr >= 'a' && *pszStr <= 'z') ||
+             (*pszStr >= 'A' && *pszStr <= 'Z'))
+    {
+        poGeom = OGRGeometryFromHexEWKB(pszStr, nullptr, FALSE);
+    }
+    CPLPopErrorHandler();
+    return poGeom;
+}
+
+/************************************************************************/
+/*                     OGRCSVIsCPLAtofMParsable()                       */
+/************************************************************************/
+
+// Is it a numeric value parsable by local-aware CPLAtofM()
+static bool OGRCSVIsCPLAtofMParsable(char *pszVal)
+{
+    auto l_eType = CPLGetValueType(pszVal);
+    if (l_eType == CPL_VALUE_INTEGER || l_eType == CPL_VALUE_REAL)
+        return true;
+    char *pszComma = strchr(pszVal, ',');
+    if (pszComma)
+    {
+        *pszComma = '.';
+        l_eType = CPLGetValueType(pszVal);
+        *pszComma = ',';
+    }
+    return l_eType == CPL_VALUE_REAL;
+}
+
+/************************************************************************/
+/*                         BuildPointFromXYZ()                          */
+/*                                                                      */
+/*      Build the point geometry from the X/Y(/Z) columns of a record,  */
+/*      or return nullptr if they are missing or invalid.               */
+/************************************************************************/
+
+OGRPoint *OGRCSVLayer::BuildPointFromXYZ(char **papszTokens,
+                                         int nAttrCount) const
+{
+    if (nAttrCount > iLatitudeField && nAttrCount > iLongitudeField &&
+        papszTokens[iLongitudeField][0] != 0 &&
+        papszTokens[iLatitudeField][0] != 0 &&
+        OGRCSVIsCPLAtofMParsable(papszTokens[iLongitudeField]) &&
+        OGRCSVIsCPLAtofMParsable(papszTokens[iLatitudeField]))
+    {
+        if (!m_bIsGNIS ||
+            // GNIS specific: some records have dummy 0,0 value.
+            (papszTokens[iLongitudeField][0] != DIGIT_ZERO ||
+             papszTokens[iLongitudeField][1] != '\0' ||
+             papszTokens[iLatitudeField][0] != DIGIT_ZERO ||
+             papszTokens[iLatitudeField][1] != '\0'))
+        {
+            const double dfLon = CPLAtofM(papszTokens[iLongitudeField]);
+            const double dfLat = CPLAtofM(papszTokens[iLatitudeField]);
+            if (iZField != -1 && nAttrCount > iZField &&
+                papszTokens[iZField][0] != 0 &&
+                OGRCSVIsCPLAtofMParsable(papszTokens[iZField]))
+                return new OGRPoint(dfLon, dfLat,
+                                    CPLAtofM(papszTokens[iZField]));
+            return new OGRPoint(dfLon, dfLat);
+        }
+    }
+    return nullptr;
+}
+
 /************************************************************************/
 /*                      GetNextUnfilteredFeature()                      */
 /************************************************************************/
@@ -1393,35 +1943,11 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
             if (papszTokens[iAttr][0] != '\0' &&
                 !(poFeatureDefn->GetGeomFieldDefn(iGeom)->IsIgnored()))
             {
-                const char *pszStr = papszTokens[iAttr];
-                while (*pszStr == ' ')
-                    pszStr++;
-                OGRGeometry *poGeom = nullptr;
-
-                CPLPushErrorHandler(CPLQuietErrorHandler);
-                if (OGRGeometryFactory::createFromWkt(pszStr, nullptr,
-                                                      &poGeom) == OGRERR_NONE)
-                {
-                    poGeom->assignSpatialReference(
-                        poFeatureDefn->GetGeomFieldDefn(iGeom)
-                            ->GetSpatialRef());
-                    poFeature->SetGeomFieldDirectly(iGeom, poGeom);
-                }
-                else if (*pszStr == '{' &&
-                         (poGeom = OGRGeometry::FromHandle(
-                              OGR_G_CreateGeometryFromJson(pszStr))) != nullptr)
-                {
-                    poFeature->SetGeomFieldDirectly(iGeom, poGeom);
-                }
-                else if (((*pszStr >= '0' && *pszStr <= '9') ||
-                          (*pszStr >= 'a' && *pszStr <= 'z') ||
-                          (*pszStr >= 'A' && *pszStr <= 'Z')) &&
-                         (poGeom = OGRGeometryFromHexEWKB(pszStr, nullptr,
-                                                          FALSE)) != nullptr)
-                {
+                OGRGeometry *poGeom = OGRCSVParseGeometry(
+                    papszTokens[iAttr],
+                    poFeatureDefn->GetGeomFieldDefn(iGeom)->GetSpatialRef());
+                if (poGeom)
                     poFeature->SetGeomFieldDirectly(iGeom, poGeom);
-                }
-                CPLPopErrorHandler();
             }
             if (!bKeepGeomColumns || (iAttr == 0 && bHiddenWKTColumn))
                 continue;
@@ -1626,22 +2152,6 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
         }
     }
 
-    // Is it a numeric value parsable by local-aware CPLAtofM()
-    const auto IsCPLAtofMParsable = [](char *pszVal)
-    {
-        auto l_eType = CPLGetValueType(pszVal);
-        if (l_eType == CPL_VALUE_INTEGER || l_eType == CPL_VALUE_REAL)
-            return true;
-        char *pszComma = strchr(pszVal, ',');
-        if (pszComma)
-        {
-            *pszComma = '.';
-            l_eType = CPLGetValueType(pszVal);
-            *pszComma = ',';
-        }
-        return l_eType == CPL_VALUE_REAL;
-    };
-
     // http://www.faa.gov/airports/airport_safety/airportdata_5010/menu/index.cfm
     // specific
 
@@ -1661,32 +2171,11 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
     }
 
     else if (iLatitudeField != -1 && iLongitudeField != -1 &&
-             nAttrCount > iLatitudeField && nAttrCount > iLongitudeField &&
-             papszTokens[iLongitudeField][0] != 0 &&
-             papszTokens[iLatitudeField][0] != 0 &&
-             IsCPLAtofMParsable(papszTokens[iLongitudeField]) &&
-             IsCPLAtofMParsable(papszTokens[iLatitudeField]))
+             !poFeatureDefn->GetGeomFieldDefn(0)->IsIgnored())
     {
-        if (!m_bIsGNIS ||
-            // GNIS specific: some records have dummy 0,0 value.
-            (papszTokens[iLongitudeField][0] != DIGIT_ZERO ||
-             papszTokens[iLongitudeField][1] != '\0' ||
-             papszTokens[iLatitudeField][0] != DIGIT_ZERO ||
-             papszTokens[iLatitudeField][1] != '\0'))
-        {
-            const double dfLon = CPLAtofM(papszTokens[iLongitudeField]);
-            const double dfLat = CPLAtofM(papszTokens[iLatitudeField]);
-            if (!poFeatureDefn->GetGeomFieldDefn(0)->IsIgnored())
-            {
-                if (iZField != -1 && nAttrCount > iZField &&
-                    papszTokens[iZField][0] != 0 &&
-                    IsCPLAtofMParsable(papszTokens[iZField]))
-                    poFeature->SetGeometryDirectly(new OGRPoint(
-                        dfLon, dfLat, CPLAtofM(papszTokens[iZField])));
-                else
-                    poFeature->SetGeometryDirectly(new OGRPoint(dfLon, dfLat));
-            }
-        }
+        OGRPoint *poPoint = BuildPointFromXYZ(papszTokens, nAttrCount);
+        if (poPoint)
+            poFeature->SetGeometryDirectly(poPoint);
     }
 
     CSLDestroy(papszTokens);
@@ -1713,7 +2202,20 @@ OGRFeature *OGRCSVLayer::GetNextFeature()
     // spatial criteria.
     while (true)
     {
-        OGRFeature *poFeature = GetNextUnfilteredFeature();
+        OGRFeature *poFeature = nullptr;
+        if (UseSidecarSpatialIndex())
+        {
+            GIntBig nFID = 0;
+            if (!GetNextSidecarSpatialIndexFID(nFID))
+                return nullptr;
+            poFeature = GetFeature(nFID);
+            if (poFeature == nullptr)
+                continue;
+        }
+        else
+        {
+            poFeature = GetNextUnfilteredFeature();
+        }
         if (poFeature == nullptr)
             return nullptr;
 
@@ -1726,6 +2228,423 @@ OGRFeature *OGRCSVLayer::GetNextFeature()
     }
 }
 
+/************************************************************************/
+/*                        GetNextArrowArray()                           */
+/************************************************************************/
+
+// Specialized implementation that parses CSV records directly into the Arrow
+// array buffers, without going through OGRFeature objects.
+// Restricted to the most common situations (no spatial filter, no
+// Eurostat TSV or NFDC specific handling, and field types that have a
+// direct Arrow equivalent). In other cases, fall back to generic
+// implementation.
+int OGRCSVLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
+                                   struct ArrowArray *out_array)
+{
+    if (fpCSV == nullptr || m_poFilterGeom != nullptr || bIsEurostatTSV ||
+        iNfdcLatitudeS != -1 ||
+        CPLTestBool(CPLGetConfigOption("OGR_CSV_STREAM_BASE_IMPL", "NO")))
+    {
+        return OGRLayer::GetNextArrowArray(stream, out_array);
+    }
+
+    const int nFieldCount = poFeatureDefn->GetFieldCount();
+    for (int i = 0; i < nFieldCount; ++i)
+    {
+        const OGRFieldDefn *poFieldDefn = poFeatureDefn->GetFieldDefn(i);
+        const OGRFieldSubType eSubType = poFieldDefn->GetSubType();
+        switch (poFieldDefn->GetType())
+        {
+            case OFTString:
+            case OFTInteger64:
+            case OFTDate:
+            case OFTDateTime:
+                break;
+            case OFTInteger:
+                if (eSubType != OFSTNone && eSubType != OFSTBoolean &&
+                    eSubType != OFSTInt16)
+                    return OGRLayer::GetNextArrowArray(stream, out_array);
+                break;
+            case OFTReal:
+                if (eSubType != OFSTNone && eSubType != OFSTFloat32)
+                    return OGRLayer::GetNextArrowArray(stream, out_array);
+                break;
+            default:
+                return OGRLayer::GetNextArrowArray(stream, out_array);
+        }
+    }
+
+    if (bNeedRewindBeforeRead)
+        ResetReading();
+
+begin:
+    OGRArrowArrayHelper sHelper(m_poDS, poFeatureDefn,
+                                m_aosArrowArrayStreamOptions, out_array);
+    if (out_array->release == nullptr)
+    {
+        return ENOMEM;
+    }
+
+    const int nGeomFieldCount = poFeatureDefn->GetGeomFieldCount();
+    std::vector<bool> abSetFields(nFieldCount);
+    std::vector<bool> abSetGeomFields(nGeomFieldCount);
+    const uint32_t nMemLimit = OGRArrowArrayHelper::GetMemLimit();
+    const int nFIDStart = nNextFID;
+
+    struct tm brokenDown;
+    memset(&brokenDown, 0, sizeof(brokenDown));
+
+    const auto WarnInvalidValue = [this](const OGRFieldDefn *poFieldDefn)
+    {
+        if (!bWarningBadTypeOrWidth)
+        {
+            bWarningBadTypeOrWidth = true;
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Invalid value type found in record %d for field %s. "
+                     "This warning will no longer be emitted",
+                     nNextFID, poFieldDefn->GetNameRef());
+        }
+    };
+
+    int iFeat = 0;
+    bool bEOF = false;
+    while (iFeat < sHelper.m_nMaxBatchSize)
+    {
+        const vsi_l_offset nOffsetBeforeLine = VSIFTellL(fpCSV);
+        char **papszTokens = GetNextLineTokens();
+        if (papszTokens == nullptr)
+        {
+            bEOF = true;
+            break;
+        }
+
+        bool bBatchFull = false;
+        bool bOutOfMemory = false;
+
+        // Returns a pointer where to write a string or binary value of nLen
+        // bytes, or nullptr if this would exceed the memory limit of the
+        // batch (in which case bBatchFull is set) or in case of allocation
+        // failure (in which case bOutOfMemory is set).
+        const auto GetPtrForStringOrBinary =
+            [&sHelper, out_array, nMemLimit, iFeat, &bBatchFull,
+             &bOutOfMemory](int iArrowField, size_t nLen) -> GByte *
+        {
+            if (iFeat > 0)
+            {
+                const auto psArray = out_array->children[iArrowField];
+                const auto panOffsets =
+                    static_cast<const int32_t *>(psArray->buffers[1]);
+                const uint32_t nCurLength =
+                    static_cast<uint32_t>(panOffsets[iFeat]);
+                if (nLen <= nMemLimit && nLen > nMemLimit - nCurLength)
+                {
+                    bBatchFull = true;
+                    return nullptr;
+                }
+            }
+            GByte *outPtr =
+                sHelper.GetPtrForStringOrBinary(iArrowField, iFeat, nLen);
+            if (outPtr == nullptr)
+                bOutOfMemory = true;
+            return outPtr;
+        };
+
+        const auto AppendString =
+            [&GetPtrForStringOrBinary](int iArrowField, const char *pszVal)
+        {
+            const size_t nLen = strlen(pszVal);
+            GByte *outPtr = GetPtrForStringOrBinary(iArrowField, nLen);
+            if (outPtr)
+                memcpy(outPtr, pszVal, nLen);
+        };
+
+        const auto AppendGeometry =
+            [&sHelper, &abSetGeomFields,
+             &GetPtrForStringOrBinary](int iGeom, const OGRGeometry *poGeom)
+        {
+            const int iArrowField =
+                sHelper.m_mapOGRGeomFieldToArrowField[iGeom];
+            GByte *outPtr =
+                GetPtrForStringOrBinary(iArrowField, poGeom->WkbSize());
+            if (outPtr)
+            {
+                poGeom->exportToWkb(wkbNDR, outPtr, wkbVariantIso);
+                abSetGeomFields[iGeom] = true;
+            }
+        };
+
+        std::fill(abSetFields.begin(), abSetFields.end(), false);
+        std::fill(abSetGeomFields.begin(), abSetGeomFields.end(), false);
+
+        // Set attributes for any indicated attribute records.
+        // The logic mimics the one of GetNextUnfilteredFeature().
+        int iOGRField = 0;
+        const int nAttrCount =
+            std::min(CSLCount(papszTokens),
+                     nCSVFieldCount + (bHiddenWKTColumn ? 1 : 0));
+
+        for (int iAttr = 0;
+             iAttr < nAttrCount && !bBatchFull && !bOutOfMemory; iAttr++)
+        {
+            if ((iAttr == iLongitudeField || iAttr == iLatitudeField ||
+                 iAttr == iZField) &&
+                !bKeepGeomColumns)
+            {
+                continue;
+            }
+            int iGeom = 0;
+            if (bHiddenWKTColumn)
+            {
+                if (iAttr != 0)
+                    iGeom = panGeomFieldIndex[iAttr - 1];
+            }
+            else
+            {
+                iGeom = panGeomFieldIndex[iAttr];
+            }
+            const char *pszToken = papszTokens[iAttr];
+            if (iGeom >= 0)
+            {
+                if (pszToken[0] != '\0' &&
+                    sHelper.m_mapOGRGeomFieldToArrowField[iGeom] >= 0)
+                {
+                    std::unique_ptr<OGRGeometry> poGeom(
+                        OGRCSVParseGeometry(pszToken, nullptr));
+                    if (poGeom)
+                        AppendGeometry(iGeom, poGeom.get());
+                }
+                if (!bKeepGeomColumns || (iAttr == 0 && bHiddenWKTColumn))
+                    continue;
+            }
+
+            const OGRFieldDefn *poFieldDefn =
+                poFeatureDefn->GetFieldDefnUnsafe(iOGRField);
+            const OGRFieldType eFieldType = poFieldDefn->GetType();
+            const OGRFieldSubType eFieldSubType = poFieldDefn->GetSubType();
+            const int iArrowField =
+                sHelper.m_mapOGRFieldToArrowField[iOGRField];
+            auto psArray =
+                iArrowField >= 0 ? out_array->children[iArrowField] : nullptr;
+
+            if (psArray == nullptr)
+            {
+                // Ignored field
+            }
+            else if (eFieldType == OFTString)
+            {
+                if (!(bEmptyStringNull && pszToken[0] == '\0'))
+                {
+                    AppendString(iArrowField, pszToken);
+                    abSetFields[iOGRField] = true;
+                }
+            }
+            else if (pszToken[0] == '\0')
+            {
+                // Null value
+            }
+            else if (eFieldType == OFTInteger && eFieldSubType == OFSTBoolean)
+            {
+                if (OGRCSVIsTrue(pszToken) || strcmp(pszToken, "1") == 0)
+                {
+                    OGRArrowArrayHelper::SetBoolOn(psArray, iFeat);
+                    abSetFields[iOGRField] = true;
+                }
+                else if (OGRCSVIsFalse(pszToken) || strcmp(pszToken, "0") == 0)
+                {
+                    abSetFields[iOGRField] = true;
+                }
+                else
+                {
+                    WarnInvalidValue(poFieldDefn);
+                }
+            }
+            else if (eFieldType == OFTReal || eFieldType == OFTInteger ||
+                     eFieldType == OFTInteger64)
+            {
+                if (eFieldType == OFTReal)
+                {
+                    char *chComma = strchr(papszTokens[iAttr], ',');
+                    if (chComma)
+                        *chComma = '.';
+                }
+                const CPLValueType eType = CPLGetValueType(pszToken);
+                if (eType == CPL_VALUE_INTEGER || eType == CPL_VALUE_REAL)
+                {
+                    if (eFieldType != OFTReal && eType == CPL_VALUE_REAL)
+                        WarnInvalidValue(poFieldDefn);
+                    abSetFields[iOGRField] = true;
+                    if (eFieldType == OFTReal)
+                    {
+                        const double dfVal = CPLAtof(pszToken);
+                        if (eFieldSubType == OFSTFloat32)
+                            OGRArrowArrayHelper::SetFloat(
+                                psArray, iFeat, static_cast<float>(dfVal));
+                        else
+                            OGRArrowArrayHelper::SetDouble(psArray, iFeat,
+                                                           dfVal);
+                    }
+                    else if (eFieldType == OFTInteger64)
+                    {
+                        OGRArrowArrayHelper::SetInt64(psArray, iFeat,
+                                                      CPLAtoGIntBig(pszToken));
+                    }
+                    else
+                    {
+                        const long long nVal64 =
+                            std::strtoll(pszToken, nullptr, 10);
+                        if (eFieldSubType == OFSTInt16)
+                        {
+                            OGRArrowArrayHelper::SetInt16(
+                                psArray, iFeat,
+                                static_cast<int16_t>(std::clamp<long long>(
+                                    nVal64, INT16_MIN, INT16_MAX)));
+                        }
+                        else
+                        {
+                            OGRArrowArrayHelper::SetInt32(
+                                psArray, iFeat,
+                                static_cast<int32_t>(std::clamp<long long>(
+                                    nVal64, INT_MIN, INT_MAX)));
+                        }
+                    }
+                }
+                else
+                {
+                    WarnInvalidValue(poFieldDefn);
+                }
+            }
+            else
+            {
+                // OFTDate or OFTDateTime
+                OGRField sField;
+                if (OGRParseDate(pszToken, &sField, 0))
+                {
+                    abSetFields[iOGRField] = true;
+                    if (eFieldType == OFTDate)
+                        OGRArrowArrayHelper::SetDate(psArray, iFeat,
+                                                     brokenDown, sField);
+                    else
+                        OGRArrowArrayHelper::SetDateTime(
+                            psArray, iFeat, brokenDown,
+                            sHelper.m_anTZFlags[iOGRField], sField);
+                }
+                else
+                {
+                    WarnInvalidValue(poFieldDefn);
+                }
+            }
+
+            if (bKeepSourceColumns && eFieldType != OFTString)
+            {
+                iOGRField++;
+                const int iArrowFieldSrc =
+                    sHelper.m_mapOGRFieldToArrowField[iOGRField];
+                if (pszToken[0] != '\0' && iArrowFieldSrc >= 0)
+                {
+                    AppendString(iArrowFieldSrc, pszToken);
+                    abSetFields[iOGRField] = true;
+                }
+            }
+
+            iOGRField++;
+        }
+
+        if (!bBatchFull && !bOutOfMemory && iLatitudeField != -1 &&
+            iLongitudeField != -1 && nGeomFieldCount > 0 &&
+            sHelper.m_mapOGRGeomFieldToArrowField[0] >= 0)
+        {
+            std::unique_ptr<OGRGeometry> poPoint(
+                BuildPointFromXYZ(papszTokens, nAttrCount));
+            if (poPoint)
+                AppendGeometry(0, poPoint.get());
+        }
+
+        if (bBatchFull && m_poParallelReader)
+        {
+            // Re-read that record in the next batch
+            m_poParallelReader->UngetTokens(papszTokens);
+            break;
+        }
+        CSLDestroy(papszTokens);
+
+        if (bOutOfMemory)
+        {
+            sHelper.ClearArray();
+            return ENOMEM;
+        }
+        if (bBatchFull)
+        {
+            // Re-read that record in the next batch
+            VSIFSeekL(fpCSV, nOffsetBeforeLine, SEEK_SET);
+            break;
+        }
+
+        // Mark null fields
+        for (int i = 0; i < nFieldCount; ++i)
+        {
+            const int iArrowField = sHelper.m_mapOGRFieldToArrowField[i];
+            if (!abSetFields[i] && iArrowField >= 0)
+            {
+                if (sHelper.m_abNullableFields[i])
+                {
+                    if (!sHelper.SetNull(iArrowField, iFeat))
+                    {
+                        sHelper.ClearArray();
+                        return ENOMEM;
+                    }
+                }
+                else if (out_array->children[iArrowField]->n_buffers == 3)
+                {
+                    OGRArrowArrayHelper::SetEmptyStringOrBinary(
+                        out_array->children[iArrowField], iFeat);
+                }
+            }
+        }
+        for (int i = 0; i < nGeomFieldCount; ++i)
+        {
+            const int iArrowField = sHelper.m_mapOGRGeomFieldToArrowField[i];
+            if (!abSetGeomFields[i] && iArrowField >= 0 &&
+                !sHelper.SetNull(iArrowField, iFeat))
+            {
+                sHelper.ClearArray();
+                return ENOMEM;
+            }
+        }
+
+        if (sHelper.m_panFIDValues)
+            sHelper.m_panFIDValues[iFeat] = nNextFID;
+        nNextFID++;
+        m_nFeaturesRead++;
+        iFeat++;
+    }
+
+    sHelper.Shrink(iFeat);
+
+    if (out_array->length != 0 && m_poAttrQuery)
+    {
+        struct ArrowSchema schema;
+        stream->get_schema(stream, &schema);
+        CPLAssert(schema.release != nullptr);
+        CPLAssert(schema.n_children == out_array->n_children);
+        CPLStringList aosOptions;
+        aosOptions.SetNameValue("BASE_SEQUENTIAL_FID",
+                                CPLSPrintf("%d", nFIDStart));
+        PostFilterArrowArray(&schema, out_array, aosOptions.List());
+        schema.release(&schema);
+    }
+
+    if (out_array->length == 0)
+    {
+        sHelper.ClearArray();
+        if (m_poAttrQuery && !bEOF)
+        {
+            goto begin;
+        }
+    }
+
+    return 0;
+}
+
 /************************************************************************/
 /*                           TestCapability()                           */
 /************************************************************************/
@@ -2445,6 +3364,88 @@ OGRErr OGRCSVLayer::ICreateFeature(OGRFeature *poNewFeature)
     return bRet ? OGRERR_NONE : OGRERR_FAILURE;
 }
 
+/************************************************************************/
+/*                          WriteArrowBatch()                           */
+/************************************************************************/
+
+// Specialized implementation that fills a single recycled OGRFeature directly
+// from the Arrow column buffers, and hands it to the CSV record serializer
+// of ICreateFeature(), so that the text output is identical to the one of
+// CreateFeature(). In situations not handled by GetArrowWriteColumns(), fall
+// back to generic implementation.
+bool OGRCSVLayer::WriteArrowBatch(const struct ArrowSchema *schema,
+                                  struct ArrowArray *array,
+                                  CSLConstList papszOptions)
+{
+    std::vector<OGRArrowWriteColumn> aoFieldColumns;
+    OGRArrowWriteColumn oGeomColumn;
+    OGRArrowWriteColumn oFIDColumn;
+    if (!bInWriteMode ||
+        CPLTestBool(
+            CPLGetConfigOption("OGR_CSV_WRITE_ARROW_BASE_IMPL", "NO")) ||
+        !GetArrowWriteColumns(schema, array, papszOptions, aoFieldColumns,
+                              oGeomColumn, oFIDColumn))
+    {
+        return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+    }
+
+    const int nFieldCount = poFeatureDefn->GetFieldCount();
+    OGRFeature oFeature(poFeatureDefn);
+    OGRField sField;
+    std::string osTmp;
+    for (size_t iRow = 0; iRow < static_cast<size_t>(array->length); ++iRow)
+    {
+        for (int i = 0; i < nFieldCount; ++i)
+        {
+            const auto &oColumn = aoFieldColumns[i];
+            if (!oColumn.IsSet())
+            {
+                oFeature.UnsetField(i);
+            }
+            else if (oColumn.IsNull(iRow))
+            {
+                oFeature.SetFieldNull(i);
+            }
+            else
+            {
+                oColumn.GetAsOGRField(iRow,
+                                      poFeatureDefn->GetFieldDefn(i)->GetType(),
+                                      sField, osTmp);
+                oFeature.SetField(i, &sField);
+            }
+        }
+
+        if (oGeomColumn.IsSet())
+        {
+            OGRGeometry *poGeom = nullptr;
+            if (!oGeomColumn.IsNull(iRow))
+            {
+                size_t nWKBSize = 0;
+                const GByte *pabyWKB = oGeomColumn.GetBytes(iRow, nWKBSize);
+                if (OGRGeometryFactory::createFromWkb(
+                        pabyWKB, nullptr, &poGeom, nWKBSize) != OGRERR_NONE)
+                {
+                    CPLError(
+                        CE_Failure, CPLE_AppDefined,
+                        "WriteArrowBatch(): invalid WKB geometry at row %d",
+                        static_cast<int>(iRow));
+                    return false;
+                }
+                poGeom->assignSpatialReference(
+                    poFeatureDefn->GetGeomFieldDefn(0)->GetSpatialRef());
+            }
+            oFeature.SetGeomFieldDirectly(0, poGeom);
+        }
+
+        // The CSV writer does not assign FIDs, so the FID column is left
+        // untouched, as in the generic implementation.
+        if (ICreateFeature(&oFeature) != OGRERR_NONE)
+            return false;
+    }
+
+    return true;
+}
+
 /************************************************************************/
 /*                              SetCRLF()                               */
 /************************************************************************/
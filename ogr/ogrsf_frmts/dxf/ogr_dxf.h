@@ -60,6 +60,20 @@ class DXFBlockDefinition
     ~DXFBlockDefinition();
 
     std::vector<OGRDXFFeature *> apoFeatures;
+
+    // Cache of the geometry resulting from merging the features of the
+    // block, in block coordinates, when ShouldMergeBlockGeometries() is set.
+    enum class MergedGeometryCache
+    {
+        NOT_COMPUTED,
+        AVAILABLE,
+        // The block produces other features than its merged geometry
+        NOT_CACHEABLE,
+    };
+
+    MergedGeometryCache eMergedGeometryCache =
+        MergedGeometryCache::NOT_COMPUTED;
+    std::unique_ptr<OGRGeometry> poMergedGeometry{};
 };
 
 /************************************************************************/
@@ -185,6 +199,8 @@ class OGRDXFInsertTransformer final : public OGRCoordinateTransformation
     int Transform(size_t nCount, double *x, double *y, double *z,
                   double * /* t */, int *pabSuccess) override
     {
+        const double dfCos = cos(dfAngle);
+        const double dfSin = sin(dfAngle);
         for (size_t i = 0; i < nCount; i++)
         {
             x[i] *= dfXScale;
@@ -192,8 +208,8 @@ class OGRDXFInsertTransformer final : public OGRCoordinateTransformation
             if (z)
                 z[i] *= dfZScale;
 
-            const double dfXNew = x[i] * cos(dfAngle) - y[i] * sin(dfAngle);
-            const double dfYNew = x[i] * sin(dfAngle) + y[i] * cos(dfAngle);
+            const double dfXNew = x[i] * dfCos - y[i] * dfSin;
+            const double dfYNew = x[i] * dfSin + y[i] * dfCos;
 
             x[i] = dfXNew;
             y[i] = dfYNew;
@@ -527,6 +543,8 @@ class OGRDXFLayer final : public OGRLayer
     OGRDXFFeature *TranslateASMEntity();
 
     bool GenerateINSERTFeatures();
+    const DXFBlockDefinition *
+    GetBlockWithMergedGeometry(const CPLString &osBlockName);
     std::unique_ptr<OGRLineString>
     InsertSplineWithChecks(const int nDegree,
                            std::vector<double> &adfControlPoints,
@@ -3234,6 +3234,66 @@ bool OGRDXFLayer::TranslateINSERT()
     return true;
 }
 
+/************************************************************************/
+/*                     GetBlockWithMergedGeometry()                     */
+/*                                                                      */
+/*     Returns the block definition if the result of inlining it with   */
+/*     merged geometries is only its merged geometry (which is then     */
+/*     cached in block coordinates), or NULL if the block must go       */
+/*     through InsertBlockInline() for each INSERT.                     */
+/************************************************************************/
+
+const DXFBlockDefinition *
+OGRDXFLayer::GetBlockWithMergedGeometry(const CPLString &osBlockName)
+{
+    DXFBlockDefinition *poBlock = poDS->LookupBlock(osBlockName);
+    if (poBlock == nullptr)
+        return nullptr;
+
+    if (poBlock->eMergedGeometryCache ==
+        DXFBlockDefinition::MergedGeometryCache::NOT_COMPUTED)
+    {
+        // Insert the block with an identity transformation. Features that
+        // are not merged (texts, ASM entities, attributes of nested
+        // inserts...) depend on the inserting feature, so their presence
+        // makes the block not cacheable.
+        poBlock->eMergedGeometryCache =
+            DXFBlockDefinition::MergedGeometryCache::NOT_CACHEABLE;
+
+        OGRDXFFeatureQueue apoExtraFeatures;
+        OGRDXFFeature *poFeature = nullptr;
+        try
+        {
+            poFeature = InsertBlockInline(
+                CPLGetErrorCounter(), osBlockName, OGRDXFInsertTransformer(),
+                new OGRDXFFeature(poFeatureDefn), apoExtraFeatures, true, true);
+        }
+        catch (const std::invalid_argument &)
+        {
+            return nullptr;
+        }
+
+        if (apoExtraFeatures.empty())
+        {
+            if (poFeature)
+                poBlock->poMergedGeometry.reset(poFeature->StealGeometry());
+            poBlock->eMergedGeometryCache =
+                DXFBlockDefinition::MergedGeometryCache::AVAILABLE;
+        }
+        while (!apoExtraFeatures.empty())
+        {
+            delete apoExtraFeatures.front();
+            apoExtraFeatures.pop();
+        }
+        delete poFeature;
+    }
+
+    if (poBlock->eMergedGeometryCache !=
+        DXFBlockDefinition::MergedGeometryCache::AVAILABLE)
+        return nullptr;
+    return poBlock;
+}
+
 /************************************************************************/
 /*                       GenerateINSERTFeatures()                       */
 /************************************************************************/
@@ -3276,21 +3336,72 @@ bool OGRDXFLayer::GenerateINSERTFeatures()
     // Otherwise, try inlining the contents of this block
     else
     {
+        // When merging geometries, blocks that only produce their merged
+        // geometry are expanded once, and the insertion transformation is
+        // then applied to a copy of that geometry. Degenerate scalings
+        // may change the result of SimplifyBlockGeometry(), so they go
+        // through the generic code path.
+        const DXFBlockDefinition *poBlock =
+            poDS->ShouldMergeBlockGeometries() && oTransformer.dfXScale != 0 &&
+                    oTransformer.dfYScale != 0
+                ? GetBlockWithMergedGeometry(m_oInsertState.m_osBlockName)
+                : nullptr;
+
         OGRDXFFeatureQueue apoExtraFeatures;
-        try
+        if (poBlock && poBlock->poMergedGeometry)
         {
-            poFeature = InsertBlockInline(
-                CPLGetErrorCounter(), m_oInsertState.m_osBlockName,
-                std::move(oTransformer), poFeature, apoExtraFeatures, true,
-                poDS->ShouldMergeBlockGeometries());
+            OGRGeometry *poGeom = poBlock->poMergedGeometry->clone();
+
+            OGRPoint oInsertionPoint(oTransformer.dfXOffset,
+                                     oTransformer.dfYOffset,
+                                     oTransformer.dfZOffset);
+            poFeature->ApplyOCSTransformer(&oInsertionPoint);
+            oTransformer.dfXOffset = oInsertionPoint.getX();
+            oTransformer.dfYOffset = oInsertionPoint.getY();
+            oTransformer.dfZOffset = oInsertionPoint.getZ();
+
+            if (poFeature->oOCS == DXFTriple(0.0, 0.0, 1.0))
+            {
+                // Scaling, rotation and offset in a single pass
+                poGeom->transform(&oTransformer);
+            }
+            else
+            {
+                // Same sequence as in InsertBlockInline()
+                OGRDXFInsertTransformer oInnerTrans =
+                    oTransformer.GetRotateScaleTransformer();
+                poGeom->transform(&oInnerTrans);
+                poFeature->ApplyOCSTransformer(poGeom);
+                oInnerTrans = oTransformer.GetOffsetTransformer();
+                poGeom->transform(&oInnerTrans);
+            }
+
+            poFeature->SetGeometryDirectly(poGeom);
+            PrepareLineStyle(poFeature);
         }
-        catch (const std::invalid_argument &)
+        else if (poBlock)
         {
-            // Block doesn't exist
-            CPLError(CE_Warning, CPLE_AppDefined, "Block %s does not exist",
-                     m_oInsertState.m_osBlockName.c_str());
+            // Block without any geometry
             delete poFeature;
-            return false;
+            poFeature = nullptr;
+        }
+        else
+        {
+            try
+            {
+                poFeature = InsertBlockInline(
+                    CPLGetErrorCounter(), m_oInsertState.m_osBlockName,
+                    std::move(oTransformer), poFeature, apoExtraFeatures, true,
+                    poDS->ShouldMergeBlockGeometries());
+            }
+            catch (const std::invalid_argument &)
+            {
+                // Block doesn't exist
+                CPLError(CE_Warning, CPLE_AppDefined, "Block %s does not exist",
+                         m_oInsertState.m_osBlockName.c_str());
+                delete poFeature;
+                return false;
+            }
         }
 
         if (poFeature)
@@ -37,9 +37,11 @@
 #include "ogr_p.h"
 #include "cpl_http.h"
 #include "cpl_json.h"
+#include "cpl_worker_thread_pool.h"
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <vector>
 
@@ -94,6 +96,12 @@ class OGRElasticLayer final : public OGRLayer
     CPLString m_osBulkContent{};
     int m_nBulkUpload{};
 
+    // Maximum number of _bulk requests in flight
+    int m_nBulkConcurrency = 1;
+    std::unique_ptr<CPLJobQueue> m_poBulkJobQueue{};
+    std::mutex m_oBulkMutex{};
+    std::string m_osBulkUploadError{};  // protected by m_oBulkMutex
+
     CPLString m_osFID{};
 
     std::vector<std::vector<CPLString>> m_aaosFieldPaths{};
@@ -139,7 +147,9 @@ class OGRElasticLayer final : public OGRLayer
 
     void CopyMembersTo(OGRElasticLayer *poNew);
 
-    bool PushIndex();
+    bool PushIndex(bool bWaitCompletion = true);
+    static void BulkUploadJob(void *pData);
+    bool ReportBulkUploadError();
     CPLString BuildMap();
 
     OGRErr WriteMapIfNecessary();
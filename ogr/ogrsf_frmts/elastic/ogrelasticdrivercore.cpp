@@ -115,6 +115,9 @@ void OGRElasticsearchDriverSetCommonMetadata(GDALDriver *poDriver)
         "use bulk insert for feature creation' default='YES'/>"
         "  <Option name='BULK_SIZE' type='integer' description='Size in bytes "
         "of the buffer for bulk upload' default='1000000'/>"
+        "  <Option name='BULK_CONCURRENCY' type='integer' "
+        "description='Maximum number of bulk upload requests in flight' "
+        "default='1'/>"
         "  <Option name='DOT_AS_NESTED_FIELD' type='boolean' "
         "description='Whether to consider dot character in field name as "
         "sub-document' default='YES'/>"
@@ -163,6 +166,9 @@ void OGRElasticsearchDriverSetCommonMetadata(GDALDriver *poDriver)
         "use bulk insert for feature creation' default='YES'/>"
         "  <Option name='BULK_SIZE' type='integer' description='Size in bytes "
         "of the buffer for bulk upload' default='1000000'/>"
+        "  <Option name='BULK_CONCURRENCY' type='integer' "
+        "description='Maximum number of bulk upload requests in flight' "
+        "default='1'/>"
         "  <Option name='FID' type='string' description='Field name, with "
         "integer values, to use as FID' default='ogc_fid'/>"
         "  <Option name='FORWARD_HTTP_HEADERS_FROM_ENV' type='string' "
@@ -29,6 +29,7 @@
 
 #include "ogr_elastic.h"
 #include "cpl_conv.h"
+#include "cpl_error_internal.h"
 #include "cpl_minixml.h"
 #include "cpl_http.h"
 #include "ogr_api.h"
@@ -38,7 +39,9 @@
 #include "../geojson/ogrgeojsonreader.h"
 #include "../geojson/ogrgeojsonutils.h"
 #include "ogr_geo_utils.h"
+#include "gdal_thread_pool.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <set>
 
@@ -121,6 +124,9 @@ OGRElasticLayer::OGRElasticLayer(const char *pszLayerName,
     {
         m_nBulkUpload =
             atoi(CSLFetchNameValueDef(papszOptions, "BULK_SIZE", "1000000"));
+        m_nBulkConcurrency = std::max(
+            1, atoi(CSLFetchNameValueDef(papszOptions, "BULK_CONCURRENCY",
+                                         "1")));
     }
 
     const char *pszStoredFields =
@@ -260,6 +266,7 @@ void OGRElasticLayer::CopyMembersTo(OGRElasticLayer *poNew)
     poNew->m_bFeatureDefnFinalized = true;
     poNew->m_osBulkContent = m_osBulkContent;
     poNew->m_nBulkUpload = m_nBulkUpload;
+    poNew->m_nBulkConcurrency = m_nBulkConcurrency;
     poNew->m_osFID = m_osFID;
     poNew->m_aaosFieldPaths = m_aaosFieldPaths;
     poNew->m_aosMapToFieldIndex = m_aosMapToFieldIndex;
@@ -2714,7 +2721,7 @@ OGRErr OGRElasticLayer::ICreateFeature(OGRFeature *poFeature)
         // Only push the data if we are over our bulk upload limit
         if ((int)m_osBulkContent.length() > m_nBulkUpload)
         {
-            if (!PushIndex())
+            if (!PushIndex(/* bWaitCompletion = */ false))
             {
                 return OGRERR_FAILURE;
             }
@@ -2888,20 +2895,119 @@ OGRErr OGRElasticLayer::IUpsertFeature(OGRFeature *poFeature)
 /*                             PushIndex()                              */
 /************************************************************************/
 
-bool OGRElasticLayer::PushIndex()
+namespace
+{
+struct OGRElasticBulkUploadJob
+{
+    OGRElasticLayer *poLayer = nullptr;
+    CPLString osContent{};
+    CPLStringList aosThreadLocalConfigOptions{};
+};
+}  // namespace
+
+// Sends the content of m_osBulkContent to the _bulk endpoint.
+// When BULK_CONCURRENCY > 1, the request is run by a worker thread, and
+// this only waits for a slot to be available, unless bWaitCompletion is set,
+// in which case all in-flight requests are waited for.
+bool OGRElasticLayer::PushIndex(bool bWaitCompletion)
 {
-    if (m_osBulkContent.empty())
+    bool bRet = true;
+    if (!m_osBulkContent.empty())
     {
-        return true;
+        if (m_nBulkConcurrency > 1 && !m_poBulkJobQueue)
+        {
+            auto poPool = GDALGetGlobalThreadPool(m_nBulkConcurrency);
+            if (poPool)
+                m_poBulkJobQueue = poPool->CreateJobQueue();
+        }
+
+        if (m_poBulkJobQueue)
+        {
+            m_poBulkJobQueue->WaitCompletion(m_nBulkConcurrency - 1);
+            if (!ReportBulkUploadError())
+                bRet = false;
+
+            auto psJob = new OGRElasticBulkUploadJob();
+            psJob->poLayer = this;
+            std::swap(psJob->osContent, m_osBulkContent);
+            psJob->aosThreadLocalConfigOptions.Assign(
+                CPLGetThreadLocalConfigOptions(), /* bTakeOwnership = */ true);
+            if (!m_poBulkJobQueue->SubmitJob(BulkUploadJob, psJob))
+            {
+                delete psJob;
+                bRet = false;
+            }
+        }
+        else
+        {
+            bRet = m_poDS->UploadFile(CPLSPrintf("%s/_bulk", m_poDS->GetURL()),
+                                      m_osBulkContent);
+            m_osBulkContent.clear();
+        }
     }
 
-    const bool bRet = m_poDS->UploadFile(
-        CPLSPrintf("%s/_bulk", m_poDS->GetURL()), m_osBulkContent);
-    m_osBulkContent.clear();
+    if (bWaitCompletion && m_poBulkJobQueue)
+    {
+        m_poBulkJobQueue->WaitCompletion();
+        if (!ReportBulkUploadError())
+            bRet = false;
+    }
 
     return bRet;
 }
 
+/************************************************************************/
+/*                           BulkUploadJob()                            */
+/************************************************************************/
+
+void OGRElasticLayer::BulkUploadJob(void *pData)
+{
+    std::unique_ptr<OGRElasticBulkUploadJob> psJob(
+        static_cast<OGRElasticBulkUploadJob *>(pData));
+    OGRElasticLayer *poLayer = psJob->poLayer;
+
+    CPLSetThreadLocalConfigOptions(psJob->aosThreadLocalConfigOptions.List());
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors;
+    CPLInstallErrorHandlerAccumulator(aoErrors);
+    const bool bOK = poLayer->m_poDS->UploadFile(
+        CPLSPrintf("%s/_bulk", poLayer->m_poDS->GetURL()), psJob->osContent);
+    CPLUninstallErrorHandlerAccumulator();
+    CPLSetThreadLocalConfigOptions(nullptr);
+
+    if (!bOK)
+    {
+        std::lock_guard<std::mutex> oLock(poLayer->m_oBulkMutex);
+        // Only the first error is kept
+        if (poLayer->m_osBulkUploadError.empty())
+        {
+            poLayer->m_osBulkUploadError = "Bulk upload failed";
+            for (const auto &oError : aoErrors)
+            {
+                if (oError.type == CE_Failure)
+                {
+                    poLayer->m_osBulkUploadError = oError.msg;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+/************************************************************************/
+/*                       ReportBulkUploadError()                        */
+/************************************************************************/
+
+// Emits the error of a failed asynchronous _bulk request, if any.
+bool OGRElasticLayer::ReportBulkUploadError()
+{
+    std::lock_guard<std::mutex> oLock(m_oBulkMutex);
+    if (m_osBulkUploadError.empty())
+        return true;
+    CPLError(CE_Failure, CPLE_AppDefined, "%s", m_osBulkUploadError.c_str());
+    m_osBulkUploadError.clear();
+    return false;
+}
+
 /************************************************************************/
 /*                            CreateField()                             */
 /************************************************************************/
@@ -102,6 +102,13 @@ class OGRFlatGeobufLayer final : public OGRLayer,
     bool m_ignoreSpatialFilter = false;
     bool m_ignoreAttributeFilter = false;
 
+    // multi-range prefetching of the features found in the spatial index
+    bool m_bPrefetchFoundItems = false;
+    size_t m_prefetchStartPos = 0;  // index in m_foundItems of first item
+    std::vector<uint32_t> m_prefetchSizes{};  // feature sizes
+    std::vector<size_t> m_prefetchOffsets{};  // offsets in m_prefetchBuf
+    std::vector<GByte> m_prefetchBuf{};
+
     // creation
     GDALDataset *m_poDS = nullptr;  // parent dataset to get metadata from it
     bool m_create = false;
@@ -129,13 +136,18 @@ class OGRFlatGeobufLayer final : public OGRLayer,
     void ensurePadfBuffers(size_t count);
     OGRErr ensureFeatureBuf(uint32_t featureSize);
     OGRErr parseFeature(OGRFeature *poFeature);
+    OGRFeature *GetNextFeatureInternal(OGRFeature *poFeatureToReuse);
     const std::vector<flatbuffers::Offset<FlatGeobuf::Column>>
     writeColumns(flatbuffers::FlatBufferBuilder &fbb);
     void readColumns();
     OGRErr readIndex();
+    OGRErr prefetchFoundItems();
+    OGRErr readFoundItemFeature(uint32_t &featureSize);
     OGRErr readFeatureOffset(uint64_t index, uint64_t &featureOffset);
 
     // serialize
+    OGRErr AppendProperty(int i, const OGRField *field);
+    OGRErr WriteFeature(const OGRGeometry *ogrGeometry);
     bool CreateFinalFile();
     void writeHeader(VSILFILE *poFp, uint64_t featuresCount,
                      std::vector<double> *extentVector);
@@ -172,9 +184,13 @@ class OGRFlatGeobufLayer final : public OGRLayer,
 
     virtual OGRFeature *GetFeature(GIntBig nFeatureId) override;
     virtual OGRFeature *GetNextFeature() override;
+    bool GetNextFeatureInto(OGRFeature &oFeature) override;
     virtual OGRErr CreateField(const OGRFieldDefn *poField,
                                int bApproxOK = true) override;
     virtual OGRErr ICreateFeature(OGRFeature *poFeature) override;
+    bool WriteArrowBatch(const struct ArrowSchema *schema,
+                         struct ArrowArray *array,
+                         CSLConstList papszOptions = nullptr) override;
     virtual int TestCapability(const char *) override;
 
     virtual void ResetReading() override;
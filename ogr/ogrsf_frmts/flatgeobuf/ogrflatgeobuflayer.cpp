@@ -34,6 +34,7 @@
 #include "cpl_time.h"
 #include "ogr_p.h"
 #include "ograrrowarrayhelper.h"
+#include "ogrlayerarrow.h"
 #include "ogr_recordbatch.h"
 
 #include "ogr_flatgeobuf.h"
@@ -43,6 +44,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <memory>
 #include <new>
 #include <stdexcept>
 
@@ -958,6 +960,14 @@ OGRErr OGRFlatGeobufLayer::readIndex()
                          static_cast<long unsigned int>(m_featuresCount));
 
             m_queriedSpatialIndex = true;
+
+            // Fetching the found features with multi-range reads is
+            // interesting for network file systems, where each discontiguous
+            // read would otherwise be a separate request.
+            m_bPrefetchFoundItems = CPLTestBool(CPLGetConfigOption(
+                "OGR_FLATGEOBUF_MULTI_RANGE_READ",
+                VSIIsLocal(m_osFilename.c_str()) ? "NO" : "YES"));
+            m_prefetchSizes.clear();
         }
     }
     catch (const std::exception &e)
@@ -970,6 +980,129 @@ OGRErr OGRFlatGeobufLayer::readIndex()
     return OGRERR_NONE;
 }
 
+/************************************************************************/
+/*                        prefetchFoundItems()                          */
+/************************************************************************/
+
+// Read the features found in the spatial index search, starting at
+// m_featuresPos, with two multi-range reads: one for the feature sizes, and
+// one for the feature contents.
+OGRErr OGRFlatGeobufLayer::prefetchFoundItems()
+{
+    constexpr size_t MAX_ITEMS = 1000;
+    constexpr size_t MAX_BYTES = 10 * 1024 * 1024;
+
+    m_prefetchStartPos = m_featuresPos;
+    m_prefetchSizes.clear();
+    m_prefetchOffsets.clear();
+
+    const size_t nItems =
+        std::min(MAX_ITEMS, m_foundItems.size() - m_featuresPos);
+    if (nItems == 0)
+        return CPLErrorIO("reading feature");
+
+    std::vector<uint32_t> anSizes(nItems);
+    std::vector<void *> apData(nItems);
+    std::vector<vsi_l_offset> anOffsets(nItems);
+    std::vector<size_t> anRangeSizes(nItems, sizeof(uint32_t));
+    for (size_t i = 0; i < nItems; ++i)
+    {
+        apData[i] = &anSizes[i];
+        anOffsets[i] =
+            m_offsetFeatures + m_foundItems[m_featuresPos + i].offset;
+    }
+    if (VSIFReadMultiRangeL(static_cast<int>(nItems), apData.data(),
+                            anOffsets.data(), anRangeSizes.data(),
+                            m_poFp) != 0)
+        return CPLErrorIO("reading feature size");
+
+    size_t nTotalSize = 0;
+    size_t nKept = 0;
+    for (; nKept < nItems; ++nKept)
+    {
+        uint32_t featureSize = anSizes[nKept];
+        CPL_LSBPTR32(&featureSize);
+        if (featureSize > feature_max_buffer_size)
+            return CPLErrorInvalidSize("feature");
+        if (nKept > 0 && nTotalSize + featureSize > MAX_BYTES)
+            break;
+        if (featureSize > 100 * 1024 * 1024)
+        {
+            if (m_nFileSize == 0)
+            {
+                VSIStatBufL sStatBuf;
+                if (VSIStatL(m_osFilename.c_str(), &sStatBuf) == 0)
+                {
+                    m_nFileSize = sStatBuf.st_size;
+                }
+            }
+            if (anOffsets[nKept] + featureSize > m_nFileSize)
+                return CPLErrorIO("reading feature size");
+        }
+        m_prefetchSizes.push_back(featureSize);
+        m_prefetchOffsets.push_back(nTotalSize);
+        nTotalSize += featureSize;
+    }
+
+    try
+    {
+        m_prefetchBuf.resize(nTotalSize);
+    }
+    catch (const std::exception &)
+    {
+        m_prefetchSizes.clear();
+        return CPLErrorMemoryAllocation("feature buffer resize");
+    }
+
+    int nRanges = 0;
+    for (size_t i = 0; i < nKept; ++i)
+    {
+        if (m_prefetchSizes[i] == 0)
+            continue;
+        apData[nRanges] = m_prefetchBuf.data() + m_prefetchOffsets[i];
+        anOffsets[nRanges] = anOffsets[i] + sizeof(uint32_t);
+        anRangeSizes[nRanges] = m_prefetchSizes[i];
+        ++nRanges;
+    }
+    if (nRanges > 0 &&
+        VSIFReadMultiRangeL(nRanges, apData.data(), anOffsets.data(),
+                            anRangeSizes.data(), m_poFp) != 0)
+    {
+        m_prefetchSizes.clear();
+        return CPLErrorIO("reading feature");
+    }
+
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                       readFoundItemFeature()                         */
+/************************************************************************/
+
+// Load in m_featureBuf the feature found in the spatial index search at
+// m_featuresPos.
+OGRErr OGRFlatGeobufLayer::readFoundItemFeature(uint32_t &featureSize)
+{
+    if (m_prefetchSizes.empty() || m_featuresPos < m_prefetchStartPos ||
+        m_featuresPos - m_prefetchStartPos >= m_prefetchSizes.size())
+    {
+        const auto err = prefetchFoundItems();
+        if (err != OGRERR_NONE)
+            return err;
+    }
+
+    const size_t idx = m_featuresPos - m_prefetchStartPos;
+    featureSize = m_prefetchSizes[idx];
+    const auto err = ensureFeatureBuf(featureSize);
+    if (err != OGRERR_NONE)
+        return err;
+    if (featureSize)
+        memcpy(m_featureBuf, m_prefetchBuf.data() + m_prefetchOffsets[idx],
+               featureSize);
+    m_offset += featureSize + sizeof(featureSize);
+    return OGRERR_NONE;
+}
+
 GIntBig OGRFlatGeobufLayer::GetFeatureCount(int bForce)
 {
     if (m_poFilterGeom != nullptr || m_poAttrQuery != nullptr ||
@@ -991,6 +1124,27 @@ static inline bool ParseDateTime(const char *pszInput, size_t nLen,
 }
 
 OGRFeature *OGRFlatGeobufLayer::GetNextFeature()
+{
+    return GetNextFeatureInternal(nullptr);
+}
+
+bool OGRFlatGeobufLayer::GetNextFeatureInto(OGRFeature &oFeature)
+{
+    if (oFeature.GetDefnRef() != m_poFeatureDefn)
+        return OGRLayer::GetNextFeatureInto(oFeature);
+
+    if (GetNextFeatureInternal(&oFeature) == nullptr)
+    {
+        oFeature.Reset();
+        return false;
+    }
+    return true;
+}
+
+// If poFeatureToReuse is not null, features are read into it instead of
+// being allocated, and it is returned on success.
+OGRFeature *
+OGRFlatGeobufLayer::GetNextFeatureInternal(OGRFeature *poFeatureToReuse)
 {
     if (m_create)
         return nullptr;
@@ -1015,8 +1169,18 @@ OGRFeature *OGRFlatGeobufLayer::GetNextFeature()
             return nullptr;
         }
 
-        auto poFeature = std::make_unique<OGRFeature>(m_poFeatureDefn);
-        if (parseFeature(poFeature.get()) != OGRERR_NONE)
+        std::unique_ptr<OGRFeature> poNewFeature;
+        OGRFeature *poFeature = poFeatureToReuse;
+        if (poFeature)
+        {
+            poFeature->Reset();
+        }
+        else
+        {
+            poNewFeature = std::make_unique<OGRFeature>(m_poFeatureDefn);
+            poFeature = poNewFeature.get();
+        }
+        if (parseFeature(poFeature) != OGRERR_NONE)
         {
             CPLError(CE_Failure, CPLE_AppDefined,
                      "Fatal error parsing feature");
@@ -1034,8 +1198,12 @@ OGRFeature *OGRFlatGeobufLayer::GetNextFeature()
         if ((m_poFilterGeom == nullptr || m_ignoreSpatialFilter ||
              FilterGeometry(poFeature->GetGeometryRef())) &&
             (m_poAttrQuery == nullptr || m_ignoreAttributeFilter ||
-             m_poAttrQuery->Evaluate(poFeature.get())))
-            return poFeature.release();
+             m_poAttrQuery->Evaluate(poFeature)))
+        {
+            if (poNewFeature)
+                return poNewFeature.release();
+            return poFeature;
+        }
     }
 }
 
@@ -1088,51 +1256,61 @@ OGRErr OGRFlatGeobufLayer::parseFeature(OGRFeature *poFeature)
     // CPLDebugOnly("FlatGeobuf", "m_featuresPos: %lu", static_cast<long
     // unsigned int>(m_featuresPos));
 
-    if (m_featuresPos == 0)
-        seek = true;
-
-    if (seek && VSIFSeekL(m_poFp, m_offset, SEEK_SET) == -1)
-    {
-        if (VSIFEofL(m_poFp))
-            return OGRERR_NONE;
-        return CPLErrorIO("seeking to feature location");
-    }
-    uint32_t featureSize;
-    if (VSIFReadL(&featureSize, sizeof(featureSize), 1, m_poFp) != 1)
+    uint32_t featureSize = 0;
+    if (m_queriedSpatialIndex && !m_ignoreSpatialFilter &&
+        m_bPrefetchFoundItems)
     {
-        if (VSIFEofL(m_poFp))
-            return OGRERR_NONE;
-        return CPLErrorIO("reading feature size");
+        const auto err = readFoundItemFeature(featureSize);
+        if (err != OGRERR_NONE)
+            return err;
     }
-    CPL_LSBPTR32(&featureSize);
-
-    // Sanity check to avoid allocated huge amount of memory on corrupted
-    // feature
-    if (featureSize > 100 * 1024 * 1024)
+    else
     {
-        if (featureSize > feature_max_buffer_size)
-            return CPLErrorInvalidSize("feature");
+        if (m_featuresPos == 0)
+            seek = true;
 
-        if (m_nFileSize == 0)
+        if (seek && VSIFSeekL(m_poFp, m_offset, SEEK_SET) == -1)
         {
-            VSIStatBufL sStatBuf;
-            if (VSIStatL(m_osFilename.c_str(), &sStatBuf) == 0)
-            {
-                m_nFileSize = sStatBuf.st_size;
-            }
+            if (VSIFEofL(m_poFp))
+                return OGRERR_NONE;
+            return CPLErrorIO("seeking to feature location");
         }
-        if (m_offset + featureSize > m_nFileSize)
+        if (VSIFReadL(&featureSize, sizeof(featureSize), 1, m_poFp) != 1)
         {
+            if (VSIFEofL(m_poFp))
+                return OGRERR_NONE;
             return CPLErrorIO("reading feature size");
         }
-    }
+        CPL_LSBPTR32(&featureSize);
 
-    const auto err = ensureFeatureBuf(featureSize);
-    if (err != OGRERR_NONE)
-        return err;
-    if (VSIFReadL(m_featureBuf, 1, featureSize, m_poFp) != featureSize)
-        return CPLErrorIO("reading feature");
-    m_offset += featureSize + sizeof(featureSize);
+        // Sanity check to avoid allocated huge amount of memory on corrupted
+        // feature
+        if (featureSize > 100 * 1024 * 1024)
+        {
+            if (featureSize > feature_max_buffer_size)
+                return CPLErrorInvalidSize("feature");
+
+            if (m_nFileSize == 0)
+            {
+                VSIStatBufL sStatBuf;
+                if (VSIStatL(m_osFilename.c_str(), &sStatBuf) == 0)
+                {
+                    m_nFileSize = sStatBuf.st_size;
+                }
+            }
+            if (m_offset + featureSize > m_nFileSize)
+            {
+                return CPLErrorIO("reading feature size");
+            }
+        }
+
+        const auto err = ensureFeatureBuf(featureSize);
+        if (err != OGRERR_NONE)
+            return err;
+        if (VSIFReadL(m_featureBuf, 1, featureSize, m_poFp) != featureSize)
+            return CPLErrorIO("reading feature");
+        m_offset += featureSize + sizeof(featureSize);
+    }
 
     if (m_bVerifyBuffers)
     {
@@ -1526,58 +1704,67 @@ begin:
         if (sHelper.m_panFIDValues)
             sHelper.m_panFIDValues[iFeat] = fid;
 
-        if (m_featuresPos == 0)
-            seek = true;
-
-        if (seek && VSIFSeekL(m_poFp, m_offset, SEEK_SET) == -1)
+        uint32_t featureSize = 0;
+        if (m_queriedSpatialIndex && !m_ignoreSpatialFilter &&
+            m_bPrefetchFoundItems)
         {
-            break;
+            if (readFoundItemFeature(featureSize) != OGRERR_NONE)
+                goto error;
         }
-        uint32_t featureSize;
-        if (VSIFReadL(&featureSize, sizeof(featureSize), 1, m_poFp) != 1)
+        else
         {
-            if (VSIFEofL(m_poFp))
-                break;
-            CPLErrorIO("reading feature size");
-            goto error;
-        }
-        CPL_LSBPTR32(&featureSize);
+            if (m_featuresPos == 0)
+                seek = true;
 
-        // Sanity check to avoid allocated huge amount of memory on corrupted
-        // feature
-        if (featureSize > 100 * 1024 * 1024)
-        {
-            if (featureSize > feature_max_buffer_size)
+            if (seek && VSIFSeekL(m_poFp, m_offset, SEEK_SET) == -1)
+            {
+                break;
+            }
+            if (VSIFReadL(&featureSize, sizeof(featureSize), 1, m_poFp) != 1)
             {
-                CPLErrorInvalidSize("feature");
+                if (VSIFEofL(m_poFp))
+                    break;
+                CPLErrorIO("reading feature size");
                 goto error;
             }
+            CPL_LSBPTR32(&featureSize);
 
-            if (m_nFileSize == 0)
+            // Sanity check to avoid allocated huge amount of memory on
+            // corrupted feature
+            if (featureSize > 100 * 1024 * 1024)
             {
-                VSIStatBufL sStatBuf;
-                if (VSIStatL(m_osFilename.c_str(), &sStatBuf) == 0)
+                if (featureSize > feature_max_buffer_size)
                 {
-                    m_nFileSize = sStatBuf.st_size;
+                    CPLErrorInvalidSize("feature");
+                    goto error;
+                }
+
+                if (m_nFileSize == 0)
+                {
+                    VSIStatBufL sStatBuf;
+                    if (VSIStatL(m_osFilename.c_str(), &sStatBuf) == 0)
+                    {
+                        m_nFileSize = sStatBuf.st_size;
+                    }
+                }
+                if (m_offset + featureSize > m_nFileSize)
+                {
+                    CPLErrorIO("reading feature size");
+                    goto error;
                 }
             }
-            if (m_offset + featureSize > m_nFileSize)
+
+            const auto err = ensureFeatureBuf(featureSize);
+            if (err != OGRERR_NONE)
+                goto error;
+            if (VSIFReadL(m_featureBuf, 1, featureSize, m_poFp) != featureSize)
             {
-                CPLErrorIO("reading feature size");
+                CPLErrorIO("reading feature");
                 goto error;
             }
+            m_offset += featureSize + sizeof(featureSize);
         }
 
-        const auto err = ensureFeatureBuf(featureSize);
-        if (err != OGRERR_NONE)
-            goto error;
-        if (VSIFReadL(m_featureBuf, 1, featureSize, m_poFp) != featureSize)
-        {
-            CPLErrorIO("reading feature");
-            goto error;
-        }
-        m_offset += featureSize + sizeof(featureSize);
-
         if (m_bVerifyBuffers)
         {
             Verifier v(m_featureBuf, featureSize);
@@ -2066,208 +2253,231 @@ OGRErr OGRFlatGeobufLayer::ICreateFeature(OGRFeature *poNewFeature)
 
     const auto fieldCount = m_poFeatureDefn->GetFieldCount();
 
-    std::vector<uint8_t> &properties = m_writeProperties;
-    properties.clear();
-    properties.reserve(1024 * 4);
-    FlatBufferBuilder fbb;
-    fbb.TrackMinAlign(8);
+    m_writeProperties.clear();
+    m_writeProperties.reserve(1024 * 4);
 
     for (int i = 0; i < fieldCount; i++)
     {
-        const auto fieldDef = m_poFeatureDefn->GetFieldDefn(i);
         if (!poNewFeature->IsFieldSetAndNotNull(i))
             continue;
+        if (AppendProperty(i, poNewFeature->GetRawFieldRef(i)) != OGRERR_NONE)
+            return OGRERR_FAILURE;
+    }
+
+    // CPLDebugOnly("FlatGeobuf", "DEBUG ICreateFeature: properties.size():
+    // %lu", static_cast<long unsigned int>(m_writeProperties.size()));
+
+    return WriteFeature(poNewFeature->GetGeometryRef());
+}
 
-        uint16_t column_index_le = static_cast<uint16_t>(i);
-        CPL_LSBPTR16(&column_index_le);
+/************************************************************************/
+/*                           AppendProperty()                           */
+/************************************************************************/
+
+// Serialize the (non-null) value of the i-th field into m_writeProperties
+OGRErr OGRFlatGeobufLayer::AppendProperty(int i, const OGRField *field)
+{
+    std::vector<uint8_t> &properties = m_writeProperties;
+    const auto fieldDef = m_poFeatureDefn->GetFieldDefn(i);
+    uint16_t column_index_le = static_cast<uint16_t>(i);
+    CPL_LSBPTR16(&column_index_le);
 
-        // CPLDebugOnly("FlatGeobuf", "DEBUG ICreateFeature: column_index_le:
-        // %hu", column_index_le);
+    // CPLDebugOnly("FlatGeobuf", "DEBUG ICreateFeature: column_index_le:
+    // %hu", column_index_le);
 
-        std::copy(reinterpret_cast<const uint8_t *>(&column_index_le),
-                  reinterpret_cast<const uint8_t *>(&column_index_le + 1),
-                  std::back_inserter(properties));
+    std::copy(reinterpret_cast<const uint8_t *>(&column_index_le),
+              reinterpret_cast<const uint8_t *>(&column_index_le + 1),
+              std::back_inserter(properties));
 
-        const auto fieldType = fieldDef->GetType();
-        const auto fieldSubType = fieldDef->GetSubType();
-        const auto field = poNewFeature->GetRawFieldRef(i);
-        switch (fieldType)
+    const auto fieldType = fieldDef->GetType();
+    const auto fieldSubType = fieldDef->GetSubType();
+    switch (fieldType)
+    {
+        case OGRFieldType::OFTInteger:
         {
-            case OGRFieldType::OFTInteger:
+            int nVal = field->Integer;
+            if (fieldSubType == OFSTBoolean)
             {
-                int nVal = field->Integer;
-                if (fieldSubType == OFSTBoolean)
-                {
-                    GByte byVal = static_cast<GByte>(nVal);
-                    std::copy(reinterpret_cast<const uint8_t *>(&byVal),
-                              reinterpret_cast<const uint8_t *>(&byVal + 1),
-                              std::back_inserter(properties));
-                }
-                else if (fieldSubType == OFSTInt16)
-                {
-                    short sVal = static_cast<short>(nVal);
-                    CPL_LSBPTR16(&sVal);
-                    std::copy(reinterpret_cast<const uint8_t *>(&sVal),
-                              reinterpret_cast<const uint8_t *>(&sVal + 1),
-                              std::back_inserter(properties));
-                }
-                else
-                {
-                    CPL_LSBPTR32(&nVal);
-                    std::copy(reinterpret_cast<const uint8_t *>(&nVal),
-                              reinterpret_cast<const uint8_t *>(&nVal + 1),
-                              std::back_inserter(properties));
-                }
-                break;
+                GByte byVal = static_cast<GByte>(nVal);
+                std::copy(reinterpret_cast<const uint8_t *>(&byVal),
+                          reinterpret_cast<const uint8_t *>(&byVal + 1),
+                          std::back_inserter(properties));
             }
-            case OGRFieldType::OFTInteger64:
+            else if (fieldSubType == OFSTInt16)
+            {
+                short sVal = static_cast<short>(nVal);
+                CPL_LSBPTR16(&sVal);
+                std::copy(reinterpret_cast<const uint8_t *>(&sVal),
+                          reinterpret_cast<const uint8_t *>(&sVal + 1),
+                          std::back_inserter(properties));
+            }
+            else
             {
-                GIntBig nVal = field->Integer64;
-                CPL_LSBPTR64(&nVal);
+                CPL_LSBPTR32(&nVal);
                 std::copy(reinterpret_cast<const uint8_t *>(&nVal),
                           reinterpret_cast<const uint8_t *>(&nVal + 1),
                           std::back_inserter(properties));
-                break;
             }
-            case OGRFieldType::OFTReal:
+            break;
+        }
+        case OGRFieldType::OFTInteger64:
+        {
+            GIntBig nVal = field->Integer64;
+            CPL_LSBPTR64(&nVal);
+            std::copy(reinterpret_cast<const uint8_t *>(&nVal),
+                      reinterpret_cast<const uint8_t *>(&nVal + 1),
+                      std::back_inserter(properties));
+            break;
+        }
+        case OGRFieldType::OFTReal:
+        {
+            double dfVal = field->Real;
+            if (fieldSubType == OFSTFloat32)
             {
-                double dfVal = field->Real;
-                if (fieldSubType == OFSTFloat32)
-                {
-                    float fVal = static_cast<float>(dfVal);
-                    CPL_LSBPTR32(&fVal);
-                    std::copy(reinterpret_cast<const uint8_t *>(&fVal),
-                              reinterpret_cast<const uint8_t *>(&fVal + 1),
-                              std::back_inserter(properties));
-                }
-                else
-                {
-                    CPL_LSBPTR64(&dfVal);
-                    std::copy(reinterpret_cast<const uint8_t *>(&dfVal),
-                              reinterpret_cast<const uint8_t *>(&dfVal + 1),
-                              std::back_inserter(properties));
-                }
-                break;
+                float fVal = static_cast<float>(dfVal);
+                CPL_LSBPTR32(&fVal);
+                std::copy(reinterpret_cast<const uint8_t *>(&fVal),
+                          reinterpret_cast<const uint8_t *>(&fVal + 1),
+                          std::back_inserter(properties));
             }
-            case OGRFieldType::OFTDate:
-            case OGRFieldType::OFTTime:
-            case OGRFieldType::OFTDateTime:
+            else
             {
-                char szBuffer[OGR_SIZEOF_ISO8601_DATETIME_BUFFER];
-                const size_t len =
-                    OGRGetISO8601DateTime(field, false, szBuffer);
-                uint32_t l_le = static_cast<uint32_t>(len);
-                CPL_LSBPTR32(&l_le);
-                std::copy(reinterpret_cast<const uint8_t *>(&l_le),
-                          reinterpret_cast<const uint8_t *>(&l_le + 1),
-                          std::back_inserter(properties));
-                std::copy(szBuffer, szBuffer + len,
+                CPL_LSBPTR64(&dfVal);
+                std::copy(reinterpret_cast<const uint8_t *>(&dfVal),
+                          reinterpret_cast<const uint8_t *>(&dfVal + 1),
                           std::back_inserter(properties));
-                break;
             }
-            case OGRFieldType::OFTString:
+            break;
+        }
+        case OGRFieldType::OFTDate:
+        case OGRFieldType::OFTTime:
+        case OGRFieldType::OFTDateTime:
+        {
+            char szBuffer[OGR_SIZEOF_ISO8601_DATETIME_BUFFER];
+            const size_t len =
+                OGRGetISO8601DateTime(field, false, szBuffer);
+            uint32_t l_le = static_cast<uint32_t>(len);
+            CPL_LSBPTR32(&l_le);
+            std::copy(reinterpret_cast<const uint8_t *>(&l_le),
+                      reinterpret_cast<const uint8_t *>(&l_le + 1),
+                      std::back_inserter(properties));
+            std::copy(szBuffer, szBuffer + len,
+                      std::back_inserter(properties));
+            break;
+        }
+        case OGRFieldType::OFTString:
+        {
+            const size_t len = strlen(field->String);
+            if (len >= feature_max_buffer_size ||
+                properties.size() > feature_max_buffer_size - len)
             {
-                const size_t len = strlen(field->String);
-                if (len >= feature_max_buffer_size ||
-                    properties.size() > feature_max_buffer_size - len)
-                {
-                    CPLError(CE_Failure, CPLE_AppDefined,
-                             "ICreateFeature: String too long");
-                    return OGRERR_FAILURE;
-                }
-                if (!CPLIsUTF8(field->String, static_cast<int>(len)))
-                {
-                    CPLError(CE_Failure, CPLE_AppDefined,
-                             "ICreateFeature: String '%s' is not a valid UTF-8 "
-                             "string",
-                             field->String);
-                    return OGRERR_FAILURE;
-                }
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "ICreateFeature: String too long");
+                return OGRERR_FAILURE;
+            }
+            if (!CPLIsUTF8(field->String, static_cast<int>(len)))
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "ICreateFeature: String '%s' is not a valid UTF-8 "
+                         "string",
+                         field->String);
+                return OGRERR_FAILURE;
+            }
 
-                // Valid cast since feature_max_buffer_size is 2 GB
-                uint32_t l_le = static_cast<uint32_t>(len);
-                CPL_LSBPTR32(&l_le);
-                std::copy(reinterpret_cast<const uint8_t *>(&l_le),
-                          reinterpret_cast<const uint8_t *>(&l_le + 1),
-                          std::back_inserter(properties));
-                try
-                {
-                    // to avoid coverity scan warning: "To avoid a quadratic
-                    // time penalty when using reserve(), always increase the
-                    // capacity
-                    /// by a multiple of its current value"
-                    if (properties.size() + len > properties.capacity() &&
-                        properties.size() <
-                            std::numeric_limits<size_t>::max() / 2)
-                    {
-                        properties.reserve(std::max(2 * properties.size(),
-                                                    properties.size() + len));
-                    }
-                }
-                catch (const std::bad_alloc &)
+            // Valid cast since feature_max_buffer_size is 2 GB
+            uint32_t l_le = static_cast<uint32_t>(len);
+            CPL_LSBPTR32(&l_le);
+            std::copy(reinterpret_cast<const uint8_t *>(&l_le),
+                      reinterpret_cast<const uint8_t *>(&l_le + 1),
+                      std::back_inserter(properties));
+            try
+            {
+                // to avoid coverity scan warning: "To avoid a quadratic
+                // time penalty when using reserve(), always increase the
+                // capacity
+                /// by a multiple of its current value"
+                if (properties.size() + len > properties.capacity() &&
+                    properties.size() <
+                        std::numeric_limits<size_t>::max() / 2)
                 {
-                    CPLError(CE_Failure, CPLE_OutOfMemory,
-                             "ICreateFeature: String too long");
-                    return OGRERR_FAILURE;
+                    properties.reserve(std::max(2 * properties.size(),
+                                                properties.size() + len));
                 }
-                std::copy(field->String, field->String + len,
-                          std::back_inserter(properties));
-                break;
             }
+            catch (const std::bad_alloc &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "ICreateFeature: String too long");
+                return OGRERR_FAILURE;
+            }
+            std::copy(field->String, field->String + len,
+                      std::back_inserter(properties));
+            break;
+        }
 
-            case OGRFieldType::OFTBinary:
+        case OGRFieldType::OFTBinary:
+        {
+            const size_t len = field->Binary.nCount;
+            if (len >= feature_max_buffer_size ||
+                properties.size() > feature_max_buffer_size - len)
             {
-                const size_t len = field->Binary.nCount;
-                if (len >= feature_max_buffer_size ||
-                    properties.size() > feature_max_buffer_size - len)
-                {
-                    CPLError(CE_Failure, CPLE_AppDefined,
-                             "ICreateFeature: Binary too long");
-                    return OGRERR_FAILURE;
-                }
-                uint32_t l_le = static_cast<uint32_t>(len);
-                CPL_LSBPTR32(&l_le);
-                std::copy(reinterpret_cast<const uint8_t *>(&l_le),
-                          reinterpret_cast<const uint8_t *>(&l_le + 1),
-                          std::back_inserter(properties));
-                try
-                {
-                    // to avoid coverity scan warning: "To avoid a quadratic
-                    // time penalty when using reserve(), always increase the
-                    // capacity
-                    /// by a multiple of its current value"
-                    if (properties.size() + len > properties.capacity() &&
-                        properties.size() <
-                            std::numeric_limits<size_t>::max() / 2)
-                    {
-                        properties.reserve(std::max(2 * properties.size(),
-                                                    properties.size() + len));
-                    }
-                }
-                catch (const std::bad_alloc &)
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "ICreateFeature: Binary too long");
+                return OGRERR_FAILURE;
+            }
+            uint32_t l_le = static_cast<uint32_t>(len);
+            CPL_LSBPTR32(&l_le);
+            std::copy(reinterpret_cast<const uint8_t *>(&l_le),
+                      reinterpret_cast<const uint8_t *>(&l_le + 1),
+                      std::back_inserter(properties));
+            try
+            {
+                // to avoid coverity scan warning: "To avoid a quadratic
+                // time penalty when using reserve(), always increase the
+                // capacity
+                /// by a multiple of its current value"
+                if (properties.size() + len > properties.capacity() &&
+                    properties.size() <
+                        std::numeric_limits<size_t>::max() / 2)
                 {
-                    CPLError(CE_Failure, CPLE_OutOfMemory,
-                             "ICreateFeature: Binary too long");
-                    return OGRERR_FAILURE;
+                    properties.reserve(std::max(2 * properties.size(),
+                                                properties.size() + len));
                 }
-                std::copy(field->Binary.paData, field->Binary.paData + len,
-                          std::back_inserter(properties));
-                break;
             }
-
-            default:
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "ICreateFeature: Missing implementation for "
-                         "OGRFieldType %d",
-                         fieldType);
+            catch (const std::bad_alloc &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "ICreateFeature: Binary too long");
                 return OGRERR_FAILURE;
+            }
+            std::copy(field->Binary.paData, field->Binary.paData + len,
+                      std::back_inserter(properties));
+            break;
         }
+
+        default:
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "ICreateFeature: Missing implementation for "
+                     "OGRFieldType %d",
+                     fieldType);
+            return OGRERR_FAILURE;
     }
 
-    // CPLDebugOnly("FlatGeobuf", "DEBUG ICreateFeature: properties.size():
-    // %lu", static_cast<long unsigned int>(properties.size()));
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                            WriteFeature()                            */
+/************************************************************************/
+
+// Write a feature made of the current content of m_writeProperties and of
+// the passed geometry
+OGRErr OGRFlatGeobufLayer::WriteFeature(const OGRGeometry *ogrGeometry)
+{
+    const std::vector<uint8_t> &properties = m_writeProperties;
+    FlatBufferBuilder fbb;
+    fbb.TrackMinAlign(8);
 
-    const auto ogrGeometry = poNewFeature->GetGeometryRef();
 #ifdef DEBUG
     // char *wkt;
     // ogrGeometry->exportToWkt(&wkt);
@@ -2390,6 +2600,70 @@ OGRErr OGRFlatGeobufLayer::ICreateFeature(OGRFeature *poNewFeature)
     }
 }
 
+/************************************************************************/
+/*                          WriteArrowBatch()                           */
+/************************************************************************/
+
+bool OGRFlatGeobufLayer::WriteArrowBatch(const struct ArrowSchema *schema,
+                                         struct ArrowArray *array,
+                                         CSLConstList papszOptions)
+{
+    // Serialize features directly from the Arrow columns, without
+    // going through OGRFeature, when all columns can be handled natively
+    std::vector<OGRArrowWriteColumn> aoFieldColumns;
+    OGRArrowWriteColumn oGeomColumn;
+    OGRArrowWriteColumn oFIDColumn;
+    if (!m_create ||
+        CPLTestBool(CPLGetConfigOption("OGR_FLATGEOBUF_WRITE_ARROW_BASE_IMPL",
+                                       "NO")) ||
+        !GetArrowWriteColumns(schema, array, papszOptions, aoFieldColumns,
+                              oGeomColumn, oFIDColumn))
+    {
+        return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+    }
+
+    const int fieldCount = m_poFeatureDefn->GetFieldCount();
+    std::string osTmp;
+    for (size_t iRow = 0; iRow < static_cast<size_t>(array->length); ++iRow)
+    {
+        m_writeProperties.clear();
+        for (int i = 0; i < fieldCount; i++)
+        {
+            const auto &oColumn = aoFieldColumns[i];
+            if (!oColumn.IsSet() || oColumn.IsNull(iRow))
+                continue;
+            OGRField sField;
+            oColumn.GetAsOGRField(iRow,
+                                  m_poFeatureDefn->GetFieldDefn(i)->GetType(),
+                                  sField, osTmp);
+            if (AppendProperty(i, &sField) != OGRERR_NONE)
+                return false;
+        }
+
+        std::unique_ptr<OGRGeometry> poGeom;
+        if (oGeomColumn.IsSet() && !oGeomColumn.IsNull(iRow))
+        {
+            size_t nWKBSize = 0;
+            const GByte *pabyWKB = oGeomColumn.GetBytes(iRow, nWKBSize);
+            OGRGeometry *poGeomRaw = nullptr;
+            if (OGRGeometryFactory::createFromWkb(pabyWKB, nullptr, &poGeomRaw,
+                                                  nWKBSize) != OGRERR_NONE)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "WriteArrowBatch(): invalid WKB geometry at row %d",
+                         static_cast<int>(iRow));
+                return false;
+            }
+            poGeom.reset(poGeomRaw);
+        }
+
+        if (WriteFeature(poGeom.get()) != OGRERR_NONE)
+            return false;
+    }
+
+    return true;
+}
+
 OGRErr OGRFlatGeobufLayer::GetExtent(OGREnvelope *psExtent, int bForce)
 {
     if (m_sExtent.IsInit())
@@ -2438,6 +2712,8 @@ void OGRFlatGeobufLayer::ResetReading()
     m_bEOF = false;
     m_featuresPos = 0;
     m_foundItems.clear();
+    m_prefetchSizes.clear();
+    m_prefetchBuf.clear();
     m_featuresCount = m_poHeader ? m_poHeader->features_count() : 0;
     m_queriedSpatialIndex = false;
     m_ignoreSpatialFilter = false;
@@ -34,7 +34,9 @@
 #include "ogr_api.h"
 #include "cpl_time.h"
 #include <algorithm>
+#include <cstdint>
 #include <limits>
+#include <numeric>
 #include <vector>
 
 //! @cond Doxygen_Suppress
@@ -54,6 +56,61 @@ class OGRGenSQLGeomFieldDefn final : public OGRGeomFieldDefn
     int bForceGeomType;
 };
 
+/************************************************************************/
+/*                 OGRGenSQLResultsLayer::SortedRuns                    */
+/************************************************************************/
+
+// Source features of an ORDER BY, each serialized with
+// OGRFeature::SerializeToBinary() after its size as a 32-bit integer, and
+// grouped in sorted runs. All runs but the last one are written to a
+// temporary file. The features are read back in order by merging the runs.
+struct OGRGenSQLResultsLayer::SortedRuns
+{
+    struct Cursor
+    {
+        bool bInMemory = false;
+        vsi_l_offset nPos = 0;
+        vsi_l_offset nEnd = 0;
+        std::vector<GByte> abyBuffer{};
+        size_t nBufferPos = 0;
+        size_t nBufferSize = 0;
+        // Current feature of the run and its sort keys
+        std::unique_ptr<OGRFeature> poFeature{};
+        std::vector<OGRField> asKeys{};
+    };
+
+    OGRGenSQLResultsLayer *const poLayer;
+    std::string osTmpFilename{};
+    VSILFILE *fp = nullptr;
+    // [start, end[ offsets of the runs written in fp
+    std::vector<std::pair<vsi_l_offset, vsi_l_offset>> aoFileRuns{};
+    std::vector<GByte> abyMemRun{};
+
+    std::vector<Cursor> aoCursors{};
+    // Min-heap of the indices of the cursors that have a current feature
+    std::vector<size_t> anHeap{};
+    bool bRewound = false;
+    // Number of features returned by Next() since Rewind()
+    GIntBig nReadFeatures = 0;
+
+    explicit SortedRuns(OGRGenSQLResultsLayer *poLayerIn) : poLayer(poLayerIn)
+    {
+    }
+
+    ~SortedRuns();
+
+    bool WriteRun(const std::vector<GByte> &abyRun);
+    void Rewind();
+    std::unique_ptr<OGRFeature> Next();
+
+  private:
+    bool FillBuffer(Cursor &oCursor, size_t nBytes);
+    bool Advance(Cursor &oCursor);
+    bool IsGreater(size_t iFirst, size_t iSecond) const;
+
+    CPL_DISALLOW_COPY_ASSIGN(SortedRuns)
+};
+
 /************************************************************************/
 /*               OGRGenSQLResultsLayerHasSpecialField()                 */
 /************************************************************************/
@@ -131,6 +188,7 @@ OGRGenSQLResultsLayer::OGRGenSQLResultsLayer(
 
     m_poSrcLayer = m_apoTableLayers[0];
     SetMetadata(m_poSrcLayer->GetMetadata("NATIVE_DATA"), "NATIVE_DATA");
+    m_aoHashJoins.resize(psSelectInfo->join_count);
 
     /* -------------------------------------------------------------------- */
     /*      If the user has explicitly requested a OGRSQL dialect, then    */
@@ -484,6 +542,8 @@ OGRGenSQLResultsLayer::~OGRGenSQLResultsLayer()
 
     OGRGenSQLResultsLayer::ClearFilters();
 
+    m_poSortedRuns.reset();
+
     if (m_poDefn != nullptr)
     {
         m_poDefn->Release();
@@ -634,7 +694,8 @@ OGRErr OGRGenSQLResultsLayer::SetNextByIndex(GIntBig nIndex)
         return OGRERR_FAILURE;
     }
     if (psSelectInfo->query_mode == SWQM_SUMMARY_RECORD ||
-        psSelectInfo->query_mode == SWQM_DISTINCT_LIST || !m_anFIDIndex.empty())
+        psSelectInfo->query_mode == SWQM_DISTINCT_LIST ||
+        !m_anFIDIndex.empty() || m_poSortedRuns)
     {
         m_nNextIndexFID = nIndex + psSelectInfo->offset;
         return OGRERR_NONE;
@@ -706,6 +767,14 @@ GIntBig OGRGenSQLResultsLayer::GetFeatureCount(int bForce)
 
         nRet = psSelectInfo->column_summary[0].count;
     }
+    else if (psSelectInfo->query_mode == SWQM_SUMMARY_RECORD &&
+             psSelectInfo->group_specs > 0)
+    {
+        if (!PrepareSummary())
+            return 0;
+
+        nRet = static_cast<GIntBig>(m_apoGroupFeatures.size());
+    }
     else if (psSelectInfo->query_mode != SWQM_RECORDSET)
         return 1;
     else if (m_poAttrQuery == nullptr && !MustEvaluateSpatialFilterOnGenSQL())
@@ -860,6 +929,18 @@ bool OGRGenSQLResultsLayer::PrepareSummary()
                 break;
             }
         }
+        for (int iGroup = 0; iGroup < psSelectInfo->group_specs; iGroup++)
+        {
+            const int nSpecialFieldIdx =
+                psSelectInfo->group_defs[iGroup].field_index -
+                m_poSrcLayer->GetLayerDefn()->GetFieldCount();
+            if (nSpecialFieldIdx == SPF_OGR_GEOMETRY ||
+                nSpecialFieldIdx == SPF_OGR_GEOM_WKT ||
+                nSpecialFieldIdx == SPF_OGR_GEOM_AREA)
+            {
+                bFoundGeomExpr = TRUE;
+            }
+        }
         if (!bFoundGeomExpr)
             m_poSrcLayer->GetLayerDefn()->SetGeometryIgnored(TRUE);
     }
@@ -871,7 +952,8 @@ bool OGRGenSQLResultsLayer::PrepareSummary()
 
     if (psSelectInfo->result_columns() == 1 &&
         psSelectInfo->column_defs[0].col_func == SWQCF_COUNT &&
-        psSelectInfo->column_defs[0].field_index < 0)
+        psSelectInfo->column_defs[0].field_index < 0 &&
+        psSelectInfo->group_specs == 0)
     {
         GIntBig nRes = m_poSrcLayer->GetFeatureCount(TRUE);
         m_poSummaryFeature->SetField(0, nRes);
@@ -892,11 +974,51 @@ bool OGRGenSQLResultsLayer::PrepareSummary()
     /* -------------------------------------------------------------------- */
     /*      Otherwise, process all source feature through the summary       */
     /*      building facilities of SWQ.                                     */
+    /*                                                                      */
+    /*      With GROUP BY, each group has its own summary, which is         */
+    /*      swapped with psSelectInfo->column_summary while the group       */
+    /*      features are processed. Groups are found with a hash table      */
+    /*      indexed by the values of the GROUP BY fields.                   */
     /* -------------------------------------------------------------------- */
     const char *pszError = nullptr;
 
+    const bool bGroupBy = psSelectInfo->group_specs > 0;
+    const int nOrderItems = bGroupBy ? psSelectInfo->order_specs : 0;
+    std::unordered_map<std::string, size_t> oMapKeyToGroup;
+    std::vector<std::vector<swq_summary>> aoGroupSummaries;
+    std::vector<OGRField> asGroupOrderFields;
+    std::string osGroupKey;
+
     for (auto &&poSrcFeature : *m_poSrcLayer)
     {
+        size_t iGroup = 0;
+        if (bGroupBy)
+        {
+            GetGroupByKey(poSrcFeature.get(), osGroupKey);
+            const auto oIter = oMapKeyToGroup.find(osGroupKey);
+            if (oIter == oMapKeyToGroup.end())
+            {
+                iGroup = m_apoGroupFeatures.size();
+                oMapKeyToGroup[osGroupKey] = iGroup;
+                aoGroupSummaries.emplace_back();
+                m_apoGroupFeatures.push_back(
+                    CreateGroupFeature(poSrcFeature.get()));
+                if (nOrderItems > 0)
+                {
+                    asGroupOrderFields.resize(asGroupOrderFields.size() +
+                                              nOrderItems);
+                    ReadIndexFields(poSrcFeature.get(), nOrderItems,
+                                    asGroupOrderFields.data() +
+                                        iGroup * nOrderItems);
+                }
+            }
+            else
+            {
+                iGroup = oIter->second;
+            }
+            std::swap(psSelectInfo->column_summary, aoGroupSummaries[iGroup]);
+        }
+
         for (int iField = 0; iField < psSelectInfo->result_columns(); iField++)
         {
             swq_col_def *psColDef = &psSelectInfo->column_defs[iField];
@@ -938,6 +1060,14 @@ bool OGRGenSQLResultsLayer::PrepareSummary()
 
             if (pszError != nullptr)
             {
+                if (bGroupBy)
+                {
+                    std::swap(psSelectInfo->column_summary,
+                              aoGroupSummaries[iGroup]);
+                    FreeIndexFields(asGroupOrderFields.data(),
+                                    m_apoGroupFeatures.size());
+                    m_apoGroupFeatures.clear();
+                }
                 m_poSummaryFeature.reset();
 
                 m_poSrcLayer->GetLayerDefn()->SetGeometryIgnored(
@@ -947,6 +1077,9 @@ bool OGRGenSQLResultsLayer::PrepareSummary()
                 return false;
             }
         }
+
+        if (bGroupBy)
+            std::swap(psSelectInfo->column_summary, aoGroupSummaries[iGroup]);
     }
 
     m_poSrcLayer->GetLayerDefn()->SetGeometryIgnored(bSaveIsGeomIgnored);
@@ -957,6 +1090,59 @@ bool OGRGenSQLResultsLayer::PrepareSummary()
     /* -------------------------------------------------------------------- */
     ClearFilters();
 
+    /* -------------------------------------------------------------------- */
+    /*      Apply the values to the group features, and sort them if        */
+    /*      needed.                                                         */
+    /* -------------------------------------------------------------------- */
+    if (bGroupBy)
+    {
+        for (int iField = 0; iField < psSelectInfo->result_columns(); iField++)
+        {
+            if (psSelectInfo->column_defs[iField].col_func != SWQCF_COUNT)
+                continue;
+            bool bFitsOnInt32 = true;
+            for (const auto &aoSummary : aoGroupSummaries)
+            {
+                if (!aoSummary.empty() &&
+                    !CPL_INT64_FITS_ON_INT32(aoSummary[iField].count))
+                {
+                    bFitsOnInt32 = false;
+                    break;
+                }
+            }
+            if (bFitsOnInt32)
+                m_poDefn->GetFieldDefn(iField)->SetType(OFTInteger);
+        }
+
+        for (size_t i = 0; i < m_apoGroupFeatures.size(); ++i)
+            SetSummaryFields(m_apoGroupFeatures[i].get(), aoGroupSummaries[i]);
+
+        if (nOrderItems > 0)
+        {
+            std::vector<size_t> anOrder(m_apoGroupFeatures.size());
+            for (size_t i = 0; i < anOrder.size(); ++i)
+                anOrder[i] = i;
+            std::stable_sort(
+                anOrder.begin(), anOrder.end(),
+                [this, &asGroupOrderFields, nOrderItems](size_t a, size_t b)
+                {
+                    return Compare(&asGroupOrderFields[a * nOrderItems],
+                                   &asGroupOrderFields[b * nOrderItems]) < 0;
+                });
+            std::vector<std::unique_ptr<OGRFeature>> apoSorted;
+            apoSorted.reserve(anOrder.size());
+            for (size_t i : anOrder)
+                apoSorted.push_back(std::move(m_apoGroupFeatures[i]));
+            m_apoGroupFeatures = std::move(apoSorted);
+            FreeIndexFields(asGroupOrderFields.data(), anOrder.size());
+        }
+
+        for (size_t i = 0; i < m_apoGroupFeatures.size(); ++i)
+            m_apoGroupFeatures[i]->SetFID(static_cast<GIntBig>(i));
+
+        return true;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Now apply the values to the summary feature.  If we are in      */
     /*      DISTINCT_LIST mode we don't do this step.                       */
@@ -987,69 +1173,194 @@ bool OGRGenSQLResultsLayer::PrepareSummary()
             m_poSummaryFeature->SetFID(0);
         }
 
-        for (int iField = 0; iField < psSelectInfo->result_columns(); iField++)
+        SetSummaryFields(m_poSummaryFeature.get(),
+                         psSelectInfo->column_summary);
+    }
+
+    return TRUE;
+}
+
+/************************************************************************/
+/*                          SetSummaryFields()                          */
+/************************************************************************/
+
+/** Set the fields of a summary record from the column summaries. */
+void OGRGenSQLResultsLayer::SetSummaryFields(
+    OGRFeature *poFeature, const std::vector<swq_summary> &aoSummary)
+{
+    swq_select *psSelectInfo = m_pSelectInfo.get();
+
+    for (int iField = 0; iField < psSelectInfo->result_columns(); iField++)
+    {
+        swq_col_def *psColDef = &psSelectInfo->column_defs[iField];
+        if (!aoSummary.empty())
         {
-            swq_col_def *psColDef = &psSelectInfo->column_defs[iField];
-            if (!psSelectInfo->column_summary.empty())
-            {
-                const swq_summary &oSummary =
-                    psSelectInfo->column_summary[iField];
+            const swq_summary &oSummary = aoSummary[iField];
 
-                if (psColDef->col_func == SWQCF_AVG && oSummary.count > 0)
-                {
-                    if (psColDef->field_type == SWQ_DATE ||
-                        psColDef->field_type == SWQ_TIME ||
-                        psColDef->field_type == SWQ_TIMESTAMP)
-                    {
-                        struct tm brokendowntime;
-                        double dfAvg = oSummary.sum / oSummary.count;
-                        CPLUnixTimeToYMDHMS(static_cast<GIntBig>(dfAvg),
-                                            &brokendowntime);
-                        m_poSummaryFeature->SetField(
-                            iField, brokendowntime.tm_year + 1900,
-                            brokendowntime.tm_mon + 1, brokendowntime.tm_mday,
-                            brokendowntime.tm_hour, brokendowntime.tm_min,
-                            static_cast<float>(brokendowntime.tm_sec +
-                                               fmod(dfAvg, 1)),
-                            0);
-                    }
-                    else
-                        m_poSummaryFeature->SetField(
-                            iField, oSummary.sum / oSummary.count);
-                }
-                else if (psColDef->col_func == SWQCF_MIN && oSummary.count > 0)
-                {
-                    if (psColDef->field_type == SWQ_DATE ||
-                        psColDef->field_type == SWQ_TIME ||
-                        psColDef->field_type == SWQ_TIMESTAMP ||
-                        psColDef->field_type == SWQ_STRING)
-                        m_poSummaryFeature->SetField(iField,
-                                                     oSummary.osMin.c_str());
-                    else
-                        m_poSummaryFeature->SetField(iField, oSummary.min);
-                }
-                else if (psColDef->col_func == SWQCF_MAX && oSummary.count > 0)
+            if (psColDef->col_func == SWQCF_AVG && oSummary.count > 0)
+            {
+                if (psColDef->field_type == SWQ_DATE ||
+                    psColDef->field_type == SWQ_TIME ||
+                    psColDef->field_type == SWQ_TIMESTAMP)
                 {
-                    if (psColDef->field_type == SWQ_DATE ||
-                        psColDef->field_type == SWQ_TIME ||
-                        psColDef->field_type == SWQ_TIMESTAMP ||
-                        psColDef->field_type == SWQ_STRING)
-                        m_poSummaryFeature->SetField(iField,
-                                                     oSummary.osMax.c_str());
-                    else
-                        m_poSummaryFeature->SetField(iField, oSummary.max);
+                    struct tm brokendowntime;
+                    double dfAvg = oSummary.sum / oSummary.count;
+                    CPLUnixTimeToYMDHMS(static_cast<GIntBig>(dfAvg),
+                                        &brokendowntime);
+                    poFeature->SetField(
+                        iField, brokendowntime.tm_year + 1900,
+                        brokendowntime.tm_mon + 1, brokendowntime.tm_mday,
+                        brokendowntime.tm_hour, brokendowntime.tm_min,
+                        static_cast<float>(brokendowntime.tm_sec +
+                                           fmod(dfAvg, 1)),
+                        0);
                 }
-                else if (psColDef->col_func == SWQCF_COUNT)
-                    m_poSummaryFeature->SetField(iField, oSummary.count);
-                else if (psColDef->col_func == SWQCF_SUM && oSummary.count > 0)
-                    m_poSummaryFeature->SetField(iField, oSummary.sum);
+                else
+                    poFeature->SetField(iField,
+                                        oSummary.sum / oSummary.count);
+            }
+            else if (psColDef->col_func == SWQCF_MIN && oSummary.count > 0)
+            {
+                if (psColDef->field_type == SWQ_DATE ||
+                    psColDef->field_type == SWQ_TIME ||
+                    psColDef->field_type == SWQ_TIMESTAMP ||
+                    psColDef->field_type == SWQ_STRING)
+                    poFeature->SetField(iField, oSummary.osMin.c_str());
+                else
+                    poFeature->SetField(iField, oSummary.min);
+            }
+            else if (psColDef->col_func == SWQCF_MAX && oSummary.count > 0)
+            {
+                if (psColDef->field_type == SWQ_DATE ||
+                    psColDef->field_type == SWQ_TIME ||
+                    psColDef->field_type == SWQ_TIMESTAMP ||
+                    psColDef->field_type == SWQ_STRING)
+                    poFeature->SetField(iField, oSummary.osMax.c_str());
+                else
+                    poFeature->SetField(iField, oSummary.max);
             }
             else if (psColDef->col_func == SWQCF_COUNT)
-                m_poSummaryFeature->SetField(iField, 0);
+                poFeature->SetField(iField, oSummary.count);
+            else if (psColDef->col_func == SWQCF_SUM && oSummary.count > 0)
+                poFeature->SetField(iField, oSummary.sum);
         }
+        else if (psColDef->col_func == SWQCF_COUNT)
+            poFeature->SetField(iField, 0);
     }
+}
 
-    return TRUE;
+/************************************************************************/
+/*                           GetGroupByKey()                            */
+/************************************************************************/
+
+/** Build the hash key of the group a source feature belongs to. */
+void OGRGenSQLResultsLayer::GetGroupByKey(OGRFeature *poSrcFeat,
+                                          std::string &osKey)
+{
+    swq_select *psSelectInfo = m_pSelectInfo.get();
+
+    osKey.clear();
+    for (int iGroup = 0; iGroup < psSelectInfo->group_specs; iGroup++)
+    {
+        const int iSrcField = psSelectInfo->group_defs[iGroup].field_index;
+        // Null and unset values form their own group, distinct from the
+        // empty string.
+        if (iSrcField < m_iFIDFieldIndex &&
+            !poSrcFeat->IsFieldSetAndNotNull(iSrcField))
+        {
+            osKey.push_back('\0');
+            continue;
+        }
+        osKey.push_back('\1');
+        if (iSrcField < m_iFIDFieldIndex &&
+            poSrcFeat->GetFieldDefnRef(iSrcField)->GetType() == OFTReal)
+        {
+            osKey += CPLSPrintf("%.17g",
+                                poSrcFeat->GetFieldAsDouble(iSrcField));
+        }
+        else
+        {
+            osKey += poSrcFeat->GetFieldAsString(iSrcField);
+        }
+        osKey.push_back('\0');
+    }
+}
+
+/************************************************************************/
+/*                         CreateGroupFeature()                         */
+/************************************************************************/
+
+/** Create the output feature of a new group, with the values of the GROUP BY
+ * columns taken from the first source feature of the group. */
+std::unique_ptr<OGRFeature>
+OGRGenSQLResultsLayer::CreateGroupFeature(OGRFeature *poSrcFeat)
+{
+    swq_select *psSelectInfo = m_pSelectInfo.get();
+
+    auto poFeature = std::make_unique<OGRFeature>(m_poDefn);
+    for (int iField = 0; iField < psSelectInfo->result_columns(); iField++)
+    {
+        const swq_col_def *psColDef = &psSelectInfo->column_defs[iField];
+        if (psColDef->col_func != SWQCF_NONE)
+            continue;
+
+        const int iSrcField = psColDef->field_index;
+        if (iSrcField >= m_iFIDFieldIndex)
+        {
+            CPLAssert(iSrcField < m_iFIDFieldIndex + SPECIAL_FIELD_COUNT);
+            switch (SpecialFieldTypes[iSrcField - m_iFIDFieldIndex])
+            {
+                case SWQ_INTEGER:
+                case SWQ_INTEGER64:
+                    poFeature->SetField(
+                        iField, poSrcFeat->GetFieldAsInteger64(iSrcField));
+                    break;
+                case SWQ_FLOAT:
+                    poFeature->SetField(iField,
+                                        poSrcFeat->GetFieldAsDouble(iSrcField));
+                    break;
+                default:
+                    poFeature->SetField(iField,
+                                        poSrcFeat->GetFieldAsString(iSrcField));
+                    break;
+            }
+            continue;
+        }
+
+        if (!poSrcFeat->IsFieldSet(iSrcField))
+            continue;
+        if (poSrcFeat->IsFieldNull(iSrcField))
+        {
+            poFeature->SetFieldNull(iField);
+            continue;
+        }
+
+        const OGRFieldType eDstType =
+            m_poDefn->GetFieldDefn(iField)->GetType();
+        if (eDstType == poSrcFeat->GetFieldDefnRef(iSrcField)->GetType())
+        {
+            poFeature->SetField(iField, poSrcFeat->GetRawFieldRef(iSrcField));
+        }
+        else if (eDstType == OFTInteger)
+        {
+            poFeature->SetField(iField,
+                                poSrcFeat->GetFieldAsInteger(iSrcField));
+        }
+        else if (eDstType == OFTInteger64)
+        {
+            poFeature->SetField(iField,
+                                poSrcFeat->GetFieldAsInteger64(iSrcField));
+        }
+        else if (eDstType == OFTReal)
+        {
+            poFeature->SetField(iField, poSrcFeat->GetFieldAsDouble(iSrcField));
+        }
+        else
+        {
+            poFeature->SetField(iField, poSrcFeat->GetFieldAsString(iSrcField));
+        }
+    }
+    return poFeature;
 }
 
 /************************************************************************/
@@ -1267,6 +1578,272 @@ static CPLString GetFilterForJoin(swq_expr_node *poExpr, OGRFeature *poSrcFeat,
     return "";
 }
 
+/************************************************************************/
+/*                          GetSQLMaxMemory()                           */
+/************************************************************************/
+
+/** Return the amount of memory, in bytes, that may be used by a hash join or
+ * an ORDER BY, from a configuration option expressed in megabytes, or 10% of
+ * the usable physical RAM by default.
+ */
+static GIntBig GetSQLMaxMemory(const char *pszConfigOption)
+{
+    const char *pszMaxMemory = CPLGetConfigOption(pszConfigOption, nullptr);
+    if (pszMaxMemory)
+        return static_cast<GIntBig>(CPLAtof(pszMaxMemory) * 1024 * 1024);
+    const GIntBig nMaxMemory = CPLGetUsablePhysicalRAM() / 10;
+    return nMaxMemory > 0 ? nMaxMemory : 256 * 1024 * 1024;
+}
+
+/************************************************************************/
+/*                       CollectHashJoinKeyFields()                     */
+/************************************************************************/
+
+/** Collect the (primary field, secondary field) pairs of a JOIN expression
+ * made of one or several equality comparisons between fields, combined with
+ * AND. Returns false for any other expression.
+ */
+static bool
+CollectHashJoinKeyFields(const swq_expr_node *poExpr, int secondary_table,
+                         std::vector<std::pair<int, int>> &aoKeyFields)
+{
+    if (poExpr->eNodeType != SNT_OPERATION || poExpr->nSubExprCount != 2)
+        return false;
+
+    if (poExpr->nOperation == SWQ_AND)
+    {
+        return CollectHashJoinKeyFields(poExpr->papoSubExpr[0],
+                                        secondary_table, aoKeyFields) &&
+               CollectHashJoinKeyFields(poExpr->papoSubExpr[1],
+                                        secondary_table, aoKeyFields);
+    }
+
+    if (poExpr->nOperation != SWQ_EQ)
+        return false;
+
+    const swq_expr_node *poA = poExpr->papoSubExpr[0];
+    const swq_expr_node *poB = poExpr->papoSubExpr[1];
+    if (poA->eNodeType != SNT_COLUMN || poB->eNodeType != SNT_COLUMN)
+        return false;
+    if (poA->table_index == secondary_table && poB->table_index == 0)
+        std::swap(poA, poB);
+    if (poA->table_index != 0 || poB->table_index != secondary_table)
+        return false;
+
+    aoKeyFields.emplace_back(poA->field_index, poB->field_index);
+    return true;
+}
+
+/************************************************************************/
+/*                          GetHashJoinKey()                            */
+/************************************************************************/
+
+/** Compute the hash join key of a feature, from either its primary
+ * (bPrimary = true) or secondary fields. Returns false if one of the fields
+ * is null, in which case the feature cannot be joined.
+ */
+static bool GetHashJoinKey(OGRFeature *poFeature,
+                           const std::vector<std::pair<int, int>> &aoKeyFields,
+                           bool bPrimary, std::string &osKey)
+{
+    osKey.clear();
+    for (const auto &oKeyField : aoKeyFields)
+    {
+        const int iField = bPrimary ? oKeyField.first : oKeyField.second;
+        if (!poFeature->IsFieldSetAndNotNull(iField))
+            return false;
+        const OGRField *psField = poFeature->GetRawFieldRef(iField);
+        if (poFeature->GetFieldDefnRef(iField)->GetType() == OFTString)
+        {
+            // String equality of the OGR SQL dialect is case insensitive
+            for (const char *pszIter = psField->String; *pszIter; ++pszIter)
+                osKey += static_cast<char>(
+                    CPLToupper(static_cast<unsigned char>(*pszIter)));
+        }
+        else
+        {
+            osKey += CPLSPrintf(CPL_FRMT_GIB,
+                                poFeature->GetFieldAsInteger64(iField));
+        }
+        osKey += '\0';
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                           BuildHashJoin()                            */
+/************************************************************************/
+
+/** Load the features of the secondary layer of a JOIN in a hash table, if
+ * its expression is compatible with it.
+ *
+ * This is attempted only once per join. Returns whether the hash table can
+ * be used.
+ */
+bool OGRGenSQLResultsLayer::BuildHashJoin(int iJoin)
+{
+    HashJoin &oHashJoin = m_aoHashJoins[iJoin];
+    if (oHashJoin.bBuildTried)
+        return oHashJoin.bUsable;
+    oHashJoin.bBuildTried = true;
+
+    if (!CPLTestBool(CPLGetConfigOption("OGR_SQL_HASH_JOIN", "YES")))
+        return false;
+
+    const swq_join_def *psJoinInfo = m_pSelectInfo->join_defs + iJoin;
+    OGRLayer *poJoinLayer = m_apoTableLayers[psJoinInfo->secondary_table];
+    // Reading the primary layer while iterating over it
+    if (poJoinLayer == m_poSrcLayer)
+        return false;
+
+    if (!CollectHashJoinKeyFields(psJoinInfo->poExpr,
+                                  psJoinInfo->secondary_table,
+                                  oHashJoin.aoKeyFields))
+        return false;
+
+    // Only handle integer and string keys, for which the semantics of the
+    // attribute filter used by the non-hashed code path are easily
+    // reproduced.
+    OGRFeatureDefn *poPrimaryDefn = m_poSrcLayer->GetLayerDefn();
+    OGRFeatureDefn *poJoinDefn = poJoinLayer->GetLayerDefn();
+    for (const auto &oKeyField : oHashJoin.aoKeyFields)
+    {
+        if (oKeyField.first >= poPrimaryDefn->GetFieldCount() ||
+            oKeyField.second >= poJoinDefn->GetFieldCount())
+        {
+            return false;
+        }
+        const auto ePrimaryType =
+            poPrimaryDefn->GetFieldDefn(oKeyField.first)->GetType();
+        const auto eJoinType =
+            poJoinDefn->GetFieldDefn(oKeyField.second)->GetType();
+        const bool bPrimaryInt =
+            ePrimaryType == OFTInteger || ePrimaryType == OFTInteger64;
+        const bool bJoinInt =
+            eJoinType == OFTInteger || eJoinType == OFTInteger64;
+        if (!(bPrimaryInt && bJoinInt) &&
+            !(ePrimaryType == OFTString && eJoinType == OFTString))
+        {
+            return false;
+        }
+    }
+
+    // Beyond that size, only keep the FIDs of the features and fetch them
+    // with GetFeature(), if the layer has fast random read.
+    const GIntBig nMaxMemory = GetSQLMaxMemory("OGR_SQL_HASH_JOIN_MAX_MEMORY");
+    const bool bCanUseFIDs = poJoinLayer->TestCapability(OLCRandomRead) != 0;
+
+    poJoinLayer->SetAttributeFilter(nullptr);
+    poJoinLayer->ResetReading();
+
+    GIntBig nKeyMemory = 0;
+    GIntBig nFeatureMemory = 0;
+    bool bKeepFeatures = true;
+    std::string osKey;
+    while (auto poFeature =
+               std::unique_ptr<OGRFeature>(poJoinLayer->GetNextFeature()))
+    {
+        if (!GetHashJoinKey(poFeature.get(), oHashJoin.aoKeyFields, false,
+                            osKey))
+        {
+            continue;
+        }
+        // Only the first matching feature is joined
+        if (!oHashJoin.oMapKeyToIdx
+                 .insert({osKey, oHashJoin.anFIDs.size()})
+                 .second)
+        {
+            continue;
+        }
+        oHashJoin.anFIDs.push_back(poFeature->GetFID());
+        nKeyMemory += static_cast<GIntBig>(osKey.size()) + 64;
+
+        if (bKeepFeatures)
+        {
+            nFeatureMemory += static_cast<GIntBig>(sizeof(OGRFeature)) +
+                              poJoinDefn->GetFieldCount() *
+                                  static_cast<GIntBig>(sizeof(OGRField));
+            for (int i = 0; i < poJoinDefn->GetFieldCount(); ++i)
+            {
+                if (poJoinDefn->GetFieldDefn(i)->GetType() == OFTString &&
+                    poFeature->IsFieldSetAndNotNull(i))
+                {
+                    nFeatureMemory += static_cast<GIntBig>(
+                        strlen(poFeature->GetFieldAsString(i)));
+                }
+            }
+            for (int i = 0; i < poFeature->GetGeomFieldCount(); ++i)
+            {
+                const OGRGeometry *poGeom = poFeature->GetGeomFieldRef(i);
+                if (poGeom)
+                    nFeatureMemory +=
+                        static_cast<GIntBig>(poGeom->WkbSize());
+            }
+            oHashJoin.apoFeatures.push_back(std::move(poFeature));
+            if (nKeyMemory + nFeatureMemory > nMaxMemory)
+            {
+                bKeepFeatures = false;
+                oHashJoin.apoFeatures.clear();
+            }
+        }
+
+        if (!bKeepFeatures &&
+            (!bCanUseFIDs || oHashJoin.anFIDs.back() == OGRNullFID ||
+             nKeyMemory > nMaxMemory))
+        {
+            CPLDebug("GenSQL",
+                     "Secondary layer %s too big for a hash join. "
+                     "Using attribute filters instead",
+                     poJoinLayer->GetName());
+            oHashJoin.oMapKeyToIdx.clear();
+            oHashJoin.anFIDs.clear();
+            poJoinLayer->ResetReading();
+            return false;
+        }
+    }
+    poJoinLayer->ResetReading();
+
+    CPLDebug("GenSQL", "Using hash join on secondary layer %s (%d entries%s)",
+             poJoinLayer->GetName(),
+             static_cast<int>(oHashJoin.anFIDs.size()),
+             bKeepFeatures ? "" : ", fetched by FID");
+    oHashJoin.bUsable = true;
+    return true;
+}
+
+/************************************************************************/
+/*                        GetHashJoinFeature()                          */
+/************************************************************************/
+
+/** Return the feature of the secondary layer of a JOIN matching a primary
+ * feature, or nullptr. If the returned feature had to be fetched from the
+ * layer, apoOwned takes its ownership.
+ */
+OGRFeature *OGRGenSQLResultsLayer::GetHashJoinFeature(
+    int iJoin, OGRFeature *poSrcFeat,
+    std::vector<std::unique_ptr<OGRFeature>> &apoOwned)
+{
+    const HashJoin &oHashJoin = m_aoHashJoins[iJoin];
+
+    std::string osKey;
+    if (!GetHashJoinKey(poSrcFeat, oHashJoin.aoKeyFields, true, osKey))
+        return nullptr;
+
+    const auto oIter = oHashJoin.oMapKeyToIdx.find(osKey);
+    if (oIter == oHashJoin.oMapKeyToIdx.end())
+        return nullptr;
+
+    if (!oHashJoin.apoFeatures.empty())
+        return oHashJoin.apoFeatures[oIter->second].get();
+
+    const swq_join_def *psJoinInfo = m_pSelectInfo->join_defs + iJoin;
+    OGRLayer *poJoinLayer = m_apoTableLayers[psJoinInfo->secondary_table];
+    OGRFeature *poJoinFeature =
+        poJoinLayer->GetFeature(oHashJoin.anFIDs[oIter->second]);
+    apoOwned.emplace_back(poJoinFeature);
+    return poJoinFeature;
+}
+
 /************************************************************************/
 /*                          TranslateFeature()                          */
 /************************************************************************/
@@ -1276,6 +1853,9 @@ OGRFeature *OGRGenSQLResultsLayer::TranslateFeature(OGRFeature *poSrcFeat)
 {
     swq_select *psSelectInfo = m_pSelectInfo.get();
     std::vector<OGRFeature *> apoFeatures;
+    // Joined features that must be destroyed. Those coming from a hash join
+    // table are owned by it.
+    std::vector<std::unique_ptr<OGRFeature>> apoOwnedJoinFeatures;
 
     if (poSrcFeat == nullptr)
         return nullptr;
@@ -1300,6 +1880,13 @@ OGRFeature *OGRGenSQLResultsLayer::TranslateFeature(OGRFeature *poSrcFeat)
 
         OGRLayer *poJoinLayer = m_apoTableLayers[psJoinInfo->secondary_table];
 
+        if (BuildHashJoin(iJoin))
+        {
+            apoFeatures.push_back(
+                GetHashJoinFeature(iJoin, poSrcFeat, apoOwnedJoinFeatures));
+            continue;
+        }
+
         osFilter = GetFilterForJoin(psJoinInfo->poExpr, poSrcFeat, poJoinLayer,
                                     psJoinInfo->secondary_table);
         // CPLDebug("OGR", "Filter = %s\n", osFilter.c_str());
@@ -1318,6 +1905,7 @@ OGRFeature *OGRGenSQLResultsLayer::TranslateFeature(OGRFeature *poSrcFeat)
             poJoinFeature = poJoinLayer->GetNextFeature();
 
         apoFeatures.push_back(poJoinFeature);
+        apoOwnedJoinFeatures.emplace_back(poJoinFeature);
     }
 
     /* -------------------------------------------------------------------- */
@@ -1559,8 +2147,6 @@ OGRFeature *OGRGenSQLResultsLayer::TranslateFeature(OGRFeature *poSrcFeat)
 
             iRegularField++;
         }
-
-        delete poJoinFeature;
     }
 
     return poDstFeat;
@@ -1583,7 +2169,7 @@ OGRFeature *OGRGenSQLResultsLayer::GetNextFeature()
         return nullptr;
 
     CreateOrderByIndex();
-    if (m_anFIDIndex.empty() && m_nIteratedFeatures < 0 &&
+    if (m_anFIDIndex.empty() && !m_poSortedRuns && m_nIteratedFeatures < 0 &&
         psSelectInfo->offset > 0 && psSelectInfo->query_mode == SWQM_RECORDSET)
     {
         m_poSrcLayer->SetNextByIndex(psSelectInfo->offset);
@@ -1626,6 +2212,10 @@ OGRFeature *OGRGenSQLResultsLayer::GetNextFeature()
                 m_anFIDIndex[static_cast<size_t>(m_nNextIndexFID)]));
             m_nNextIndexFID++;
         }
+        else if (m_poSortedRuns)
+        {
+            poSrcFeat = GetNextSortedFeature();
+        }
         else
         {
             poSrcFeat.reset(m_poSrcLayer->GetNextFeature());
@@ -1666,6 +2256,15 @@ OGRFeature *OGRGenSQLResultsLayer::GetFeature(GIntBig nFID)
     /* -------------------------------------------------------------------- */
     /*      Handle request for summary record.                              */
     /* -------------------------------------------------------------------- */
+    if (psSelectInfo->query_mode == SWQM_SUMMARY_RECORD &&
+        psSelectInfo->group_specs > 0)
+    {
+        if (!PrepareSummary() || nFID < 0 ||
+            nFID >= static_cast<GIntBig>(m_apoGroupFeatures.size()))
+            return nullptr;
+        return m_apoGroupFeatures[static_cast<size_t>(nFID)]->Clone();
+    }
+
     if (psSelectInfo->query_mode == SWQM_SUMMARY_RECORD)
     {
         if (!PrepareSummary() || nFID != 0 || !m_poSummaryFeature)
@@ -1912,14 +2511,13 @@ void OGRGenSQLResultsLayer::ReadIndexFields(OGRFeature *poSrcFeat,
 /*      ordered access to the features according to the supplied        */
 /*      ORDER BY clauses.                                               */
 /*                                                                      */
-/*      This is accomplished by making one pass through all the         */
-/*      eligible source features, and capturing the order by fields     */
-/*      of all records in memory.  A quick sort is then applied to      */
-/*      this in memory copy of the order-by fields to create the        */
-/*      required index.                                                 */
-/*                                                                      */
-/*      Keeping all the key values in memory will *not* scale up to     */
-/*      very large input datasets.                                      */
+/*      For ORDER BY ... LIMIT, only the first features are kept in a   */
+/*      heap. Otherwise, if the source layer supports random reading,   */
+/*      the order by fields of all records are captured in memory and   */
+/*      sorted to create an index of FIDs. If they do not fit in        */
+/*      OGR_SQL_ORDER_BY_MAX_MEMORY, or if the layer has no random      */
+/*      read, the source features themselves are sorted with an         */
+/*      external merge sort.                                            */
 /************************************************************************/
 
 void OGRGenSQLResultsLayer::CreateOrderByIndex()
@@ -1936,49 +2534,56 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
 
     m_bOrderByValid = true;
     m_anFIDIndex.clear();
+    m_poSortedRuns.reset();
 
     ResetReading();
 
+    const GIntBig nMaxMemory = GetSQLMaxMemory("OGR_SQL_ORDER_BY_MAX_MEMORY");
+
     /* -------------------------------------------------------------------- */
-    /*      Optimize (memory-wise) ORDER BY ... LIMIT 1 [OFFSET 0] case.    */
+    /*      Optimize ORDER BY ... LIMIT n [OFFSET m] case.                  */
     /* -------------------------------------------------------------------- */
-    if (psSelectInfo->offset == 0 && psSelectInfo->limit == 1)
+    constexpr GIntBig MAX_TOP_K = 100 * 1000;
+    if (psSelectInfo->limit > 0 && psSelectInfo->limit <= MAX_TOP_K &&
+        psSelectInfo->offset <= MAX_TOP_K - psSelectInfo->limit)
     {
-        std::vector<OGRField> asCurrentFields(nOrderItems);
-        std::vector<OGRField> asBestFields(nOrderItems);
-        memset(asCurrentFields.data(), 0, sizeof(OGRField) * nOrderItems);
-        memset(asBestFields.data(), 0, sizeof(OGRField) * nOrderItems);
-        bool bFoundSrcFeature = false;
-        GIntBig nBestFID = 0;
-        for (auto &&poSrcFeat : *m_poSrcLayer)
-        {
-            ReadIndexFields(poSrcFeat.get(), nOrderItems,
-                            asCurrentFields.data());
-            if (!bFoundSrcFeature ||
-                Compare(asCurrentFields.data(), asBestFields.data()) < 0)
-            {
-                bFoundSrcFeature = true;
-                nBestFID = poSrcFeat->GetFID();
-                FreeIndexFields(asBestFields.data(), 1);
-                memcpy(asBestFields.data(), asCurrentFields.data(),
-                       sizeof(OGRField) * nOrderItems);
-            }
-            else
-            {
-                FreeIndexFields(asCurrentFields.data(), 1);
-            }
-            memset(asCurrentFields.data(), 0, sizeof(OGRField) * nOrderItems);
-        }
-        FreeIndexFields(asBestFields.data(), 1);
+        const bool bOK = CreateTopKSortedRuns(
+            static_cast<size_t>(psSelectInfo->offset + psSelectInfo->limit),
+            nMaxMemory);
+        ResetReading();
+        if (bOK)
+            return;
+    }
 
-        if (bFoundSrcFeature)
-        {
-            m_anFIDIndex.resize(1);
-            m_anFIDIndex[0] = nBestFID;
-        }
-        return;
+    if (m_poSrcLayer->TestCapability(OLCRandomRead))
+    {
+        const bool bOK = CreateOrderByIndexInMemory(nMaxMemory);
+        ResetReading();
+        if (bOK)
+            return;
+        m_anFIDIndex.clear();
     }
 
+    CreateExternalSortedRuns(nMaxMemory);
+    ResetReading();
+}
+
+/************************************************************************/
+/*                     CreateOrderByIndexInMemory()                     */
+/*                                                                      */
+/*      Make one pass through all the eligible source features,         */
+/*      capturing the order by fields of all records in memory, and     */
+/*      sort them to create m_anFIDIndex.                               */
+/*                                                                      */
+/*      Returns false if the keys do not fit in nMaxMemory.             */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::CreateOrderByIndexInMemory(GIntBig nMaxMemory)
+
+{
+    swq_select *psSelectInfo = m_pSelectInfo.get();
+    const int nOrderItems = psSelectInfo->order_specs;
+
     /* -------------------------------------------------------------------- */
     /*      Allocate set of key values, and the output index.               */
     /* -------------------------------------------------------------------- */
@@ -2015,6 +2620,22 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
 
     IndexFieldsFreer oIndexFieldsFreer(*this, asIndexFields, nIndexSize);
 
+    // Whether each key is a string, for memory accounting
+    std::vector<bool> abStringKey(nOrderItems);
+    for (int iKey = 0; iKey < nOrderItems; iKey++)
+    {
+        const swq_order_def *psKeyDef = psSelectInfo->order_defs + iKey;
+        if (psKeyDef->field_index >= m_iFIDFieldIndex)
+            abStringKey[iKey] =
+                SpecialFieldTypes[psKeyDef->field_index - m_iFIDFieldIndex] ==
+                SWQ_STRING;
+        else
+            abStringKey[iKey] = m_poSrcLayer->GetLayerDefn()
+                                    ->GetFieldDefn(psKeyDef->field_index)
+                                    ->GetType() == OFTString;
+    }
+    GIntBig nMemory = 0;
+
     /* -------------------------------------------------------------------- */
     /*      Read in all the key values.                                     */
     /* -------------------------------------------------------------------- */
@@ -2035,7 +2656,7 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
             {
                 CPLError(CE_Failure, CPLE_AppDefined,
                          "Cannot allocate pasIndexFields");
-                return;
+                return true;
             }
 #endif
             const size_t nNewFeaturesAlloc =
@@ -2050,7 +2671,7 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
             {
                 CPLError(CE_Failure, CPLE_OutOfMemory,
                          "CreateOrderByIndex(): out of memory");
-                return;
+                return true;
             }
 
             memset(asIndexFields.data() + nFeaturesAlloc * nOrderItems, 0,
@@ -2066,6 +2687,26 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
         anFIDList.push_back(poSrcFeat->GetFID());
 
         nIndexSize++;
+
+        nMemory += nOrderItems * static_cast<GIntBig>(sizeof(OGRField)) +
+                   static_cast<GIntBig>(sizeof(GIntBig));
+        for (int iKey = 0; iKey < nOrderItems; iKey++)
+        {
+            const OGRField *psField =
+                asIndexFields.data() + (nIndexSize - 1) * nOrderItems + iKey;
+            if (abStringKey[iKey] && !OGR_RawField_IsUnset(psField) &&
+                !OGR_RawField_IsNull(psField))
+            {
+                nMemory += static_cast<GIntBig>(strlen(psField->String));
+            }
+        }
+        if (nMemory > nMaxMemory)
+        {
+            CPLDebug("GenSQL",
+                     "ORDER BY keys do not fit in OGR_SQL_ORDER_BY_MAX_MEMORY. "
+                     "Using an external sort");
+            return false;
+        }
     }
 
     // CPLDebug("GenSQL", "CreateOrderByIndex() = %zu features", nIndexSize);
@@ -2081,7 +2722,7 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
     {
         CPLError(CE_Failure, CPLE_OutOfMemory,
                  "CreateOrderByIndex(): out of memory");
-        return;
+        return true;
     }
     for (size_t i = 0; i < nIndexSize; i++)
         m_anFIDIndex.push_back(static_cast<GIntBig>(i));
@@ -2095,7 +2736,7 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
     if (panMerged == nullptr)
     {
         m_anFIDIndex.clear();
-        return;
+        return true;
     }
 
     // Note: this merge sort is slightly faster than std::sort()
@@ -2123,7 +2764,496 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
         m_anFIDIndex.clear();
     }
 
-    ResetReading();
+    return true;
+}
+
+/************************************************************************/
+/*                        CreateTopKSortedRuns()                        */
+/*                                                                      */
+/*      Keep the nK first source features, in ORDER BY order, in a      */
+/*      heap. Returns false if they do not fit in nMaxMemory.           */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::CreateTopKSortedRuns(size_t nK, GIntBig nMaxMemory)
+
+{
+    swq_select *psSelectInfo = m_pSelectInfo.get();
+    const int nOrderItems = psSelectInfo->order_specs;
+
+    // Slot nK is used for the keys of the feature being read
+    std::vector<OGRField> asKeys;
+    std::vector<std::vector<GByte>> aabyFeatures;
+    std::vector<GIntBig> anSequence;
+    std::vector<size_t> anHeap;
+    try
+    {
+        asKeys.resize((nK + 1) * nOrderItems);
+        aabyFeatures.resize(nK);
+        anSequence.resize(nK + 1);
+        anHeap.reserve(nK);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "CreateOrderByIndex(): out of memory");
+        return false;
+    }
+    memset(asKeys.data(), 0, sizeof(OGRField) * asKeys.size());
+
+    // Features with equal keys are sorted by their order in the source layer
+    const auto IsLess = [this, &asKeys, &anSequence, nOrderItems](size_t a,
+                                                                  size_t b)
+    {
+        const int nRes = Compare(asKeys.data() + a * nOrderItems,
+                                 asKeys.data() + b * nOrderItems);
+        return nRes < 0 || (nRes == 0 && anSequence[a] < anSequence[b]);
+    };
+
+    const auto FreeHeapKeys = [this, &asKeys, &anHeap, nOrderItems]()
+    {
+        for (size_t iSlot : anHeap)
+            FreeIndexFields(asKeys.data() + iSlot * nOrderItems, 1);
+    };
+
+    OGRField *pasCurKeys = asKeys.data() + nK * nOrderItems;
+    GIntBig nSequence = 0;
+    GIntBig nMemory = 0;
+    for (auto &&poSrcFeat : *m_poSrcLayer)
+    {
+        ReadIndexFields(poSrcFeat.get(), nOrderItems, pasCurKeys);
+        anSequence[nK] = nSequence++;
+
+        size_t iSlot = anHeap.size();
+        if (anHeap.size() == nK)
+        {
+            // Discard the feature if it is after the last one of the heap
+            if (!IsLess(nK, anHeap.front()))
+            {
+                FreeIndexFields(pasCurKeys, 1);
+                memset(pasCurKeys, 0, sizeof(OGRField) * nOrderItems);
+                continue;
+            }
+            std::pop_heap(anHeap.begin(), anHeap.end(), IsLess);
+            iSlot = anHeap.back();
+            anHeap.pop_back();
+            FreeIndexFields(asKeys.data() + iSlot * nOrderItems, 1);
+            nMemory -= static_cast<GIntBig>(aabyFeatures[iSlot].size());
+        }
+
+        memcpy(asKeys.data() + iSlot * nOrderItems, pasCurKeys,
+               sizeof(OGRField) * nOrderItems);
+        memset(pasCurKeys, 0, sizeof(OGRField) * nOrderItems);
+        anSequence[iSlot] = anSequence[nK];
+        anHeap.push_back(iSlot);
+        std::push_heap(anHeap.begin(), anHeap.end(), IsLess);
+
+        if (!poSrcFeat->SerializeToBinary(aabyFeatures[iSlot]))
+        {
+            FreeHeapKeys();
+            return false;
+        }
+        nMemory += static_cast<GIntBig>(aabyFeatures[iSlot].size());
+        if (nMemory > nMaxMemory)
+        {
+            CPLDebug("GenSQL",
+                     "ORDER BY ... LIMIT features do not fit in "
+                     "OGR_SQL_ORDER_BY_MAX_MEMORY");
+            FreeHeapKeys();
+            return false;
+        }
+    }
+
+    std::sort_heap(anHeap.begin(), anHeap.end(), IsLess);
+    FreeHeapKeys();
+
+    auto poSortedRuns = std::make_unique<SortedRuns>(this);
+    try
+    {
+        for (size_t iSlot : anHeap)
+        {
+            const auto &abyFeature = aabyFeatures[iSlot];
+            const uint32_t nSize = static_cast<uint32_t>(abyFeature.size());
+            const GByte *pabySize = reinterpret_cast<const GByte *>(&nSize);
+            poSortedRuns->abyMemRun.insert(poSortedRuns->abyMemRun.end(),
+                                           pabySize, pabySize + sizeof(nSize));
+            poSortedRuns->abyMemRun.insert(poSortedRuns->abyMemRun.end(),
+                                           abyFeature.begin(),
+                                           abyFeature.end());
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "CreateOrderByIndex(): out of memory");
+        return false;
+    }
+    m_poSortedRuns = std::move(poSortedRuns);
+    return true;
+}
+
+/************************************************************************/
+/*                      CreateExternalSortedRuns()                      */
+/*                                                                      */
+/*      Read the source features in runs of at most nMaxMemory bytes,   */
+/*      sort each run, and write it to a temporary file, except the     */
+/*      last one that is kept in memory.                                */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::CreateExternalSortedRuns(GIntBig nMaxMemory)
+
+{
+    swq_select *psSelectInfo = m_pSelectInfo.get();
+    const int nOrderItems = psSelectInfo->order_specs;
+
+    auto poSortedRuns = std::make_unique<SortedRuns>(this);
+
+    // Serialized features of the current run, their offset in abyRun, and
+    // their sort keys.
+    std::vector<GByte> abyRun;
+    std::vector<size_t> anOffsets;
+    std::vector<OGRField> asKeys;
+    std::vector<GByte> abyFeature;
+    GIntBig nRunMemory = 0;
+    GIntBig nFeatures = 0;
+
+    const auto FreeKeys = [this, &asKeys, &anOffsets]()
+    {
+        FreeIndexFields(asKeys.data(), anOffsets.size());
+        asKeys.clear();
+    };
+
+    // Sort the current run, and append it to the temporary file, or keep it
+    // in memory if it is the last one.
+    const auto FlushRun = [this, &poSortedRuns, &abyRun, &anOffsets, &asKeys,
+                           &FreeKeys, nOrderItems](bool bLastRun)
+    {
+        std::vector<size_t> anOrder(anOffsets.size());
+        std::iota(anOrder.begin(), anOrder.end(), 0);
+        std::stable_sort(anOrder.begin(), anOrder.end(),
+                         [this, &asKeys, nOrderItems](size_t a, size_t b)
+                         {
+                             return Compare(asKeys.data() + a * nOrderItems,
+                                            asKeys.data() + b * nOrderItems) <
+                                    0;
+                         });
+
+        std::vector<GByte> abySortedRun;
+        abySortedRun.reserve(abyRun.size());
+        for (size_t i : anOrder)
+        {
+            const size_t nEnd =
+                i + 1 < anOffsets.size() ? anOffsets[i + 1] : abyRun.size();
+            abySortedRun.insert(abySortedRun.end(),
+                                abyRun.begin() + anOffsets[i],
+                                abyRun.begin() + nEnd);
+        }
+        FreeKeys();
+        anOffsets.clear();
+        abyRun.clear();
+
+        if (bLastRun)
+        {
+            poSortedRuns->abyMemRun = std::move(abySortedRun);
+            return true;
+        }
+        return poSortedRuns->WriteRun(abySortedRun);
+    };
+
+    try
+    {
+        for (auto &&poSrcFeat : *m_poSrcLayer)
+        {
+            if (!poSrcFeat->SerializeToBinary(abyFeature))
+            {
+                FreeKeys();
+                return false;
+            }
+            if (abyFeature.size() > std::numeric_limits<uint32_t>::max())
+            {
+                CPLError(CE_Failure, CPLE_NotSupported,
+                         "ORDER BY: features larger than 4 GB are not "
+                         "supported");
+                FreeKeys();
+                return false;
+            }
+            const uint32_t nSize = static_cast<uint32_t>(abyFeature.size());
+            const GByte *pabySize = reinterpret_cast<const GByte *>(&nSize);
+
+            anOffsets.push_back(abyRun.size());
+            abyRun.insert(abyRun.end(), pabySize, pabySize + sizeof(nSize));
+            abyRun.insert(abyRun.end(), abyFeature.begin(), abyFeature.end());
+            asKeys.resize(anOffsets.size() * nOrderItems);
+            ReadIndexFields(poSrcFeat.get(), nOrderItems,
+                            asKeys.data() +
+                                (anOffsets.size() - 1) * nOrderItems);
+            ++nFeatures;
+
+            nRunMemory += static_cast<GIntBig>(sizeof(nSize) + nSize +
+                                               sizeof(size_t) +
+                                               nOrderItems * sizeof(OGRField));
+            if (nRunMemory > nMaxMemory)
+            {
+                if (!FlushRun(false))
+                    return false;
+                nRunMemory = 0;
+            }
+        }
+
+        FlushRun(true);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "CreateOrderByIndex(): out of memory");
+        FreeKeys();
+        return false;
+    }
+
+    CPLDebug("GenSQL",
+             "ORDER BY: external sort of " CPL_FRMT_GIB
+             " features, with %d run(s) written to a temporary file",
+             nFeatures, static_cast<int>(poSortedRuns->aoFileRuns.size()));
+
+    m_poSortedRuns = std::move(poSortedRuns);
+    return true;
+}
+
+/************************************************************************/
+/*                        GetNextSortedFeature()                        */
+/************************************************************************/
+
+/** Return the source feature at index m_nNextIndexFID of m_poSortedRuns. */
+std::unique_ptr<OGRFeature> OGRGenSQLResultsLayer::GetNextSortedFeature()
+{
+    if (!m_poSortedRuns->bRewound ||
+        m_poSortedRuns->nReadFeatures > m_nNextIndexFID)
+    {
+        m_poSortedRuns->Rewind();
+    }
+    while (m_poSortedRuns->nReadFeatures < m_nNextIndexFID)
+    {
+        if (!m_poSortedRuns->Next())
+            return nullptr;
+    }
+    m_nNextIndexFID++;
+    return m_poSortedRuns->Next();
+}
+
+/************************************************************************/
+/*                        SortedRuns::~SortedRuns()                     */
+/************************************************************************/
+
+OGRGenSQLResultsLayer::SortedRuns::~SortedRuns()
+{
+    for (auto &oCursor : aoCursors)
+    {
+        if (oCursor.poFeature)
+            poLayer->FreeIndexFields(oCursor.asKeys.data(), 1);
+    }
+    if (fp)
+        VSIFCloseL(fp);
+    if (!osTmpFilename.empty())
+        VSIUnlink(osTmpFilename.c_str());
+}
+
+/************************************************************************/
+/*                        SortedRuns::WriteRun()                        */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::SortedRuns::WriteRun(
+    const std::vector<GByte> &abyRun)
+{
+    if (fp == nullptr)
+    {
+        osTmpFilename = CPLGenerateTempFilename("ogr_sql_order_by");
+        fp = VSIFOpenL(osTmpFilename.c_str(), "wb+");
+        if (fp == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_FileIO,
+                     "Cannot create temporary file %s", osTmpFilename.c_str());
+            osTmpFilename.clear();
+            return false;
+        }
+    }
+
+    const vsi_l_offset nStart =
+        aoFileRuns.empty() ? 0 : aoFileRuns.back().second;
+    if (VSIFSeekL(fp, nStart, SEEK_SET) != 0 ||
+        VSIFWriteL(abyRun.data(), 1, abyRun.size(), fp) != abyRun.size())
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot write in temporary file %s",
+                 osTmpFilename.c_str());
+        return false;
+    }
+    aoFileRuns.emplace_back(nStart, nStart + abyRun.size());
+    return true;
+}
+
+/************************************************************************/
+/*                         SortedRuns::Rewind()                         */
+/************************************************************************/
+
+void OGRGenSQLResultsLayer::SortedRuns::Rewind()
+{
+    for (auto &oCursor : aoCursors)
+    {
+        if (oCursor.poFeature)
+            poLayer->FreeIndexFields(oCursor.asKeys.data(), 1);
+    }
+    aoCursors.clear();
+    anHeap.clear();
+
+    // Runs are in the order of the source features, so that ties are
+    // resolved by taking the feature of the first run.
+    aoCursors.resize(aoFileRuns.size() + 1);
+    for (size_t i = 0; i < aoCursors.size(); ++i)
+    {
+        Cursor &oCursor = aoCursors[i];
+        oCursor.asKeys.resize(poLayer->m_pSelectInfo->order_specs);
+        if (i < aoFileRuns.size())
+        {
+            oCursor.nPos = aoFileRuns[i].first;
+            oCursor.nEnd = aoFileRuns[i].second;
+        }
+        else
+        {
+            oCursor.bInMemory = true;
+            oCursor.nEnd = abyMemRun.size();
+        }
+        if (Advance(oCursor))
+            anHeap.push_back(i);
+    }
+    std::make_heap(anHeap.begin(), anHeap.end(),
+                   [this](size_t a, size_t b) { return IsGreater(a, b); });
+
+    bRewound = true;
+    nReadFeatures = 0;
+}
+
+/************************************************************************/
+/*                          SortedRuns::Next()                          */
+/************************************************************************/
+
+std::unique_ptr<OGRFeature> OGRGenSQLResultsLayer::SortedRuns::Next()
+{
+    if (anHeap.empty())
+        return nullptr;
+
+    const auto IsGreaterLambda = [this](size_t a, size_t b)
+    { return IsGreater(a, b); };
+    std::pop_heap(anHeap.begin(), anHeap.end(), IsGreaterLambda);
+    Cursor &oCursor = aoCursors[anHeap.back()];
+    auto poFeature = std::move(oCursor.poFeature);
+    poLayer->FreeIndexFields(oCursor.asKeys.data(), 1);
+    if (Advance(oCursor))
+        std::push_heap(anHeap.begin(), anHeap.end(), IsGreaterLambda);
+    else
+        anHeap.pop_back();
+
+    nReadFeatures++;
+    return poFeature;
+}
+
+/************************************************************************/
+/*                        SortedRuns::IsGreater()                       */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::SortedRuns::IsGreater(size_t iFirst,
+                                                  size_t iSecond) const
+{
+    const int nRes = poLayer->Compare(aoCursors[iFirst].asKeys.data(),
+                                      aoCursors[iSecond].asKeys.data());
+    return nRes > 0 || (nRes == 0 && iFirst > iSecond);
+}
+
+/************************************************************************/
+/*                       SortedRuns::FillBuffer()                       */
+/************************************************************************/
+
+/** Make sure that at least nBytes of the run of a file cursor are available
+ * in its buffer. */
+bool OGRGenSQLResultsLayer::SortedRuns::FillBuffer(Cursor &oCursor,
+                                                   size_t nBytes)
+{
+    const size_t nAvail = oCursor.nBufferSize - oCursor.nBufferPos;
+    if (nAvail >= nBytes)
+        return true;
+
+    if (nAvail > 0)
+    {
+        memmove(oCursor.abyBuffer.data(),
+                oCursor.abyBuffer.data() + oCursor.nBufferPos, nAvail);
+    }
+    oCursor.nBufferPos = 0;
+    oCursor.nBufferSize = nAvail;
+
+    constexpr size_t BUFFER_SIZE = 64 * 1024;
+    const size_t nToRead = static_cast<size_t>(
+        std::min(static_cast<vsi_l_offset>(std::max(nBytes, BUFFER_SIZE) -
+                                           nAvail),
+                 oCursor.nEnd - oCursor.nPos));
+    if (nAvail + nToRead < nBytes)
+        return false;
+    if (oCursor.abyBuffer.size() < nAvail + nToRead)
+        oCursor.abyBuffer.resize(nAvail + nToRead);
+    if (VSIFSeekL(fp, oCursor.nPos, SEEK_SET) != 0 ||
+        VSIFReadL(oCursor.abyBuffer.data() + nAvail, 1, nToRead, fp) !=
+            nToRead)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot read temporary file %s",
+                 osTmpFilename.c_str());
+        return false;
+    }
+    oCursor.nPos += nToRead;
+    oCursor.nBufferSize += nToRead;
+    return true;
+}
+
+/************************************************************************/
+/*                        SortedRuns::Advance()                         */
+/************************************************************************/
+
+/** Read the next feature of the run of a cursor, and its sort keys.
+ * Returns false at the end of the run. */
+bool OGRGenSQLResultsLayer::SortedRuns::Advance(Cursor &oCursor)
+{
+    uint32_t nSize = 0;
+    const GByte *pabyData = nullptr;
+    if (oCursor.bInMemory)
+    {
+        if (oCursor.nPos + sizeof(nSize) > oCursor.nEnd)
+            return false;
+        const size_t nPos = static_cast<size_t>(oCursor.nPos);
+        memcpy(&nSize, abyMemRun.data() + nPos, sizeof(nSize));
+        pabyData = abyMemRun.data() + nPos + sizeof(nSize);
+        oCursor.nPos += sizeof(nSize) + nSize;
+    }
+    else
+    {
+        if (!FillBuffer(oCursor, sizeof(nSize)))
+            return false;
+        memcpy(&nSize, oCursor.abyBuffer.data() + oCursor.nBufferPos,
+               sizeof(nSize));
+        oCursor.nBufferPos += sizeof(nSize);
+        if (!FillBuffer(oCursor, nSize))
+            return false;
+        pabyData = oCursor.abyBuffer.data() + oCursor.nBufferPos;
+        oCursor.nBufferPos += nSize;
+    }
+
+    auto poFeature =
+        std::make_unique<OGRFeature>(poLayer->m_poSrcLayer->GetLayerDefn());
+    if (!poFeature->DeserializeFromBinary(pabyData, nSize))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "ORDER BY: cannot deserialize feature");
+        return false;
+    }
+    poLayer->ReadIndexFields(poFeature.get(),
+                             poLayer->m_pSelectInfo->order_specs,
+                             oCursor.asKeys.data());
+    oCursor.poFeature = std::move(poFeature);
+    return true;
 }
 
 /************************************************************************/
@@ -2368,6 +3498,13 @@ void OGRGenSQLResultsLayer::FindAndSetIgnoredFields()
                           hSet);
     }
 
+    for (int iGroup = 0; iGroup < psSelectInfo->group_specs; iGroup++)
+    {
+        swq_group_def *psGroupDef = psSelectInfo->group_defs + iGroup;
+        AddFieldDefnToSet(psGroupDef->table_index, psGroupDef->field_index,
+                          hSet);
+    }
+
     /* -------------------------------------------------------------------- */
     /*      2nd phase : now, we can exclude the unused fields               */
     /* -------------------------------------------------------------------- */
@@ -2404,6 +3541,7 @@ void OGRGenSQLResultsLayer::FindAndSetIgnoredFields()
 void OGRGenSQLResultsLayer::InvalidateOrderByIndex()
 {
     m_anFIDIndex.clear();
+    m_poSortedRuns.reset();
     m_bOrderByValid = false;
 }
 
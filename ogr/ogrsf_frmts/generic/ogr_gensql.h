@@ -36,6 +36,9 @@
 #include "cpl_hash_set.h"
 #include "cpl_string.h"
 
+#include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 /*! @cond Doxygen_Suppress */
@@ -82,6 +85,12 @@ class OGRGenSQLResultsLayer final : public OGRLayer
     std::vector<GIntBig> m_anFIDIndex{};
     bool m_bOrderByValid = false;
 
+    // Source features of an ORDER BY read back in sorted order, used instead
+    // of m_anFIDIndex for ORDER BY ... LIMIT and when the sort keys do not
+    // fit in memory or the source layer has no random read.
+    struct SortedRuns;
+    std::unique_ptr<SortedRuns> m_poSortedRuns{};
+
     GIntBig m_nNextIndexFID = 0;
     std::unique_ptr<OGRFeature> m_poSummaryFeature{};
 
@@ -90,10 +99,43 @@ class OGRGenSQLResultsLayer final : public OGRLayer
     GIntBig m_nIteratedFeatures = -1;
     std::vector<std::string> m_aosDistinctList{};
 
+    // Result records of a GROUP BY query, in output order
+    std::vector<std::unique_ptr<OGRFeature>> m_apoGroupFeatures{};
+
+    // In-memory hash table of the features of a secondary (joined) layer,
+    // indexed by the value(s) of its field(s) used in the JOIN clause.
+    struct HashJoin
+    {
+        bool bBuildTried = false;
+        bool bUsable = false;
+        // Pairs of (primary table field index, secondary table field index)
+        std::vector<std::pair<int, int>> aoKeyFields{};
+        std::unordered_map<std::string, size_t> oMapKeyToIdx{};
+        std::vector<GIntBig> anFIDs{};
+        // Empty if the features did not fit in memory, in which case they
+        // are fetched with GetFeature(anFIDs[idx])
+        std::vector<std::unique_ptr<OGRFeature>> apoFeatures{};
+    };
+
+    std::vector<HashJoin> m_aoHashJoins{};
+
     bool PrepareSummary();
+    void SetSummaryFields(OGRFeature *poFeature,
+                          const std::vector<swq_summary> &aoSummary);
+    void GetGroupByKey(OGRFeature *poSrcFeat, std::string &osKey);
+    std::unique_ptr<OGRFeature> CreateGroupFeature(OGRFeature *poSrcFeat);
+
+    bool BuildHashJoin(int iJoin);
+    OGRFeature *
+    GetHashJoinFeature(int iJoin, OGRFeature *poSrcFeat,
+                       std::vector<std::unique_ptr<OGRFeature>> &apoOwned);
 
     OGRFeature *TranslateFeature(OGRFeature *);
     void CreateOrderByIndex();
+    bool CreateOrderByIndexInMemory(GIntBig nMaxMemory);
+    bool CreateTopKSortedRuns(size_t nK, GIntBig nMaxMemory);
+    bool CreateExternalSortedRuns(GIntBig nMaxMemory);
+    std::unique_ptr<OGRFeature> GetNextSortedFeature();
     void ReadIndexFields(OGRFeature *poSrcFeat, int nOrderItems,
                          OGRField *pasIndexFields);
     void SortIndexSection(const OGRField *pasIndexFields, GIntBig *panMerged,
@@ -476,6 +476,10 @@ OGRErr OGRMILayerAttrIndex::CreateIndex(int iField)
             eTABFT = TABFInteger;
             break;
 
+        case OFTInteger64:
+            eTABFT = TABFLargeInt;
+            break;
+
         case OFTReal:
             eTABFT = TABFFloat;
             break;
@@ -738,6 +742,13 @@ GByte *OGRMIAttrIndex::BuildKey(OGRField *psKey)
 
         case OFTInteger64:
         {
+            // Indexes created by older versions use 32 bit keys
+            if (poINDFile->GetKeyLength(iIndex) == 8)
+            {
+                ret = poINDFile->BuildKey(
+                    iIndex, static_cast<GInt64>(psKey->Integer64));
+                break;
+            }
             if (!CPL_INT64_FITS_ON_INT32(psKey->Integer64))
             {
                 CPLError(
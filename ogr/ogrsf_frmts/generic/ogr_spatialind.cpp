@@ -0,0 +1,781 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Generic sidecar spatial index for sequential-access drivers.
+ * Author:   agent, <agent at local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent at local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "ogr_spatialind.h"
+#include "ogrsf_frmts.h"
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_hilbert.h"
+#include "cpl_string.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+//! @cond Doxygen_Suppress
+
+/*
+ * File layout (all values little-endian):
+ *
+ *   "OGRSIDX1"                  8 bytes
+ *   block size (items/block)    uint32
+ *   reserved                    uint32
+ *   size of the data file       uint64
+ *   mtime of the data file      int64
+ *   number of items             uint64
+ *   number of blocks            uint64
+ *   block extents               number of blocks x 4 doubles
+ *   items                       number of items x (4 doubles + int64 FID)
+ *
+ * Extents are stored as MinX, MinY, MaxX, MaxY.
+ */
+
+constexpr const char SIDX_MAGIC[] = "OGRSIDX1";
+constexpr int SIDX_MAGIC_SIZE = 8;
+constexpr int SIDX_HEADER_SIZE = SIDX_MAGIC_SIZE + 4 + 4 + 8 + 8 + 8 + 8;
+constexpr int SIDX_EXTENT_SIZE = 4 * 8;
+constexpr int SIDX_ITEM_SIZE = SIDX_EXTENT_SIZE + 8;
+constexpr GUInt32 SIDX_BLOCK_SIZE = 256;
+
+namespace
+{
+struct SidecarItem
+{
+    OGREnvelope sExtent{};
+    GIntBig nFID = 0;
+    GUInt64 nHilbert = 0;
+};
+
+bool SidecarItemLess(const SidecarItem &a, const SidecarItem &b)
+{
+    if (a.nHilbert != b.nHilbert)
+        return a.nHilbert < b.nHilbert;
+    return a.nFID < b.nFID;
+}
+}  // namespace
+
+/************************************************************************/
+/*                        ReadExtent() / WriteExtent()                  */
+/************************************************************************/
+
+static void ReadExtent(const GByte *pabyData, OGREnvelope &sExtent)
+{
+    double adf[4];
+    memcpy(adf, pabyData, sizeof(adf));
+    for (double &df : adf)
+        CPL_LSBPTR64(&df);
+    sExtent.MinX = adf[0];
+    sExtent.MinY = adf[1];
+    sExtent.MaxX = adf[2];
+    sExtent.MaxY = adf[3];
+}
+
+static void WriteExtent(GByte *pabyData, const OGREnvelope &sExtent)
+{
+    double adf[4] = {sExtent.MinX, sExtent.MinY, sExtent.MaxX, sExtent.MaxY};
+    for (double &df : adf)
+        CPL_LSBPTR64(&df);
+    memcpy(pabyData, adf, sizeof(adf));
+}
+
+/************************************************************************/
+/*                      ~OGRSidecarSpatialIndex()                       */
+/************************************************************************/
+
+OGRSidecarSpatialIndex::~OGRSidecarSpatialIndex()
+{
+    if (m_fp)
+        VSIFCloseL(m_fp);
+}
+
+/************************************************************************/
+/*                          GetIndexFilename()                          */
+/************************************************************************/
+
+std::string
+OGRSidecarSpatialIndex::GetIndexFilename(const char *pszDataFilename)
+{
+    return std::string(pszDataFilename).append(".ogrsidx");
+}
+
+/************************************************************************/
+/*                                Open()                                */
+/*                                                                      */
+/*      Returns nullptr if there is no index, or if it does not match   */
+/*      the current size and modification time of the data file.        */
+/************************************************************************/
+
+std::unique_ptr<OGRSidecarSpatialIndex>
+OGRSidecarSpatialIndex::Open(const char *pszDataFilename)
+{
+    VSIStatBufL sStatData;
+    if (VSIStatL(pszDataFilename, &sStatData) != 0)
+        return nullptr;
+
+    const std::string osIndexFilename = GetIndexFilename(pszDataFilename);
+    VSIStatBufL sStatIndex;
+    if (VSIStatExL(osIndexFilename.c_str(), &sStatIndex,
+                   VSI_STAT_EXISTS_FLAG | VSI_STAT_SIZE_FLAG) != 0)
+        return nullptr;
+
+    VSILFILE *fp = VSIFOpenL(osIndexFilename.c_str(), "rb");
+    if (fp == nullptr)
+        return nullptr;
+
+    std::unique_ptr<OGRSidecarSpatialIndex> poIndex(
+        new OGRSidecarSpatialIndex());
+    poIndex->m_fp = fp;
+
+    GByte abyHeader[SIDX_HEADER_SIZE];
+    if (VSIFReadL(abyHeader, 1, SIDX_HEADER_SIZE, fp) != SIDX_HEADER_SIZE ||
+        memcmp(abyHeader, SIDX_MAGIC, SIDX_MAGIC_SIZE) != 0)
+    {
+        CPLDebug("OGR", "%s is not a valid spatial index",
+                 osIndexFilename.c_str());
+        return nullptr;
+    }
+
+    int nOffset = SIDX_MAGIC_SIZE;
+    memcpy(&poIndex->m_nBlockSize, abyHeader + nOffset, 4);
+    CPL_LSBPTR32(&poIndex->m_nBlockSize);
+    nOffset += 4 + 4;
+
+    GUInt64 nDataSize = 0;
+    memcpy(&nDataSize, abyHeader + nOffset, 8);
+    CPL_LSBPTR64(&nDataSize);
+    nOffset += 8;
+
+    GInt64 nDataMTime = 0;
+    memcpy(&nDataMTime, abyHeader + nOffset, 8);
+    CPL_LSBPTR64(&nDataMTime);
+    nOffset += 8;
+
+    memcpy(&poIndex->m_nItemCount, abyHeader + nOffset, 8);
+    CPL_LSBPTR64(&poIndex->m_nItemCount);
+    nOffset += 8;
+
+    GUInt64 nBlockCount = 0;
+    memcpy(&nBlockCount, abyHeader + nOffset, 8);
+    CPL_LSBPTR64(&nBlockCount);
+
+    if (nDataSize != static_cast<GUInt64>(sStatData.st_size) ||
+        nDataMTime != static_cast<GInt64>(sStatData.st_mtime))
+    {
+        CPLDebug("OGR", "%s is out of date regarding %s. Ignoring it",
+                 osIndexFilename.c_str(), pszDataFilename);
+        return nullptr;
+    }
+
+    const GUInt32 nBlockSize = poIndex->m_nBlockSize;
+    const GUInt64 nItemCount = poIndex->m_nItemCount;
+    if (nBlockSize == 0 ||
+        nBlockCount != (nItemCount + nBlockSize - 1) / nBlockSize ||
+        nBlockCount >
+            static_cast<GUInt64>(sStatIndex.st_size) / SIDX_EXTENT_SIZE ||
+        static_cast<GUInt64>(sStatIndex.st_size) !=
+            SIDX_HEADER_SIZE + nBlockCount * SIDX_EXTENT_SIZE +
+                nItemCount * SIDX_ITEM_SIZE)
+    {
+        CPLDebug("OGR", "%s is corrupted", osIndexFilename.c_str());
+        return nullptr;
+    }
+
+    std::vector<GByte> abyExtents;
+    std::vector<CPLRectObj> asBlockExtents;
+    try
+    {
+        abyExtents.resize(static_cast<size_t>(nBlockCount) * SIDX_EXTENT_SIZE);
+        asBlockExtents.resize(static_cast<size_t>(nBlockCount));
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for spatial index %s",
+                 osIndexFilename.c_str());
+        return nullptr;
+    }
+    if (!abyExtents.empty() &&
+        VSIFReadL(abyExtents.data(), abyExtents.size(), 1, fp) != 1)
+    {
+        CPLDebug("OGR", "%s is corrupted", osIndexFilename.c_str());
+        return nullptr;
+    }
+    OGREnvelope sBlockExtent;
+    for (size_t i = 0; i < asBlockExtents.size(); ++i)
+    {
+        ReadExtent(abyExtents.data() + i * SIDX_EXTENT_SIZE, sBlockExtent);
+        asBlockExtents[i].minx = sBlockExtent.MinX;
+        asBlockExtents[i].miny = sBlockExtent.MinY;
+        asBlockExtents[i].maxx = sBlockExtent.MaxX;
+        asBlockExtents[i].maxy = sBlockExtent.MaxY;
+    }
+    if (!poIndex->m_oBlockTree.Build(asBlockExtents.data(),
+                                     asBlockExtents.size()))
+        return nullptr;
+    poIndex->m_nItemsOffset = static_cast<vsi_l_offset>(SIDX_HEADER_SIZE) +
+                              nBlockCount * SIDX_EXTENT_SIZE;
+
+    return poIndex;
+}
+
+/************************************************************************/
+/*                               Search()                               */
+/*                                                                      */
+/*      Returns the FIDs, in increasing order, of the features whose    */
+/*      extent intersects sEnvelope. Matching blocks are visited in     */
+/*      file order, and consecutive ones are read at once.              */
+/************************************************************************/
+
+std::vector<GIntBig>
+OGRSidecarSpatialIndex::Search(const OGREnvelope &sEnvelope) const
+{
+    constexpr size_t MAX_BLOCKS_PER_READ = 64;
+
+    CPLRectObj sAOI;
+    sAOI.minx = sEnvelope.MinX;
+    sAOI.miny = sEnvelope.MinY;
+    sAOI.maxx = sEnvelope.MaxX;
+    sAOI.maxy = sEnvelope.MaxY;
+    std::vector<size_t> anBlocks = m_oBlockTree.Search(sAOI);
+    std::sort(anBlocks.begin(), anBlocks.end());
+
+    std::vector<GIntBig> anFIDs;
+    std::vector<GByte> abyBlocks;
+    OGREnvelope sItemExtent;
+    for (size_t iMatch = 0; iMatch < anBlocks.size();)
+    {
+        const size_t iBlock = anBlocks[iMatch];
+        size_t iEndBlock = iBlock + 1;
+        ++iMatch;
+        while (iMatch < anBlocks.size() && anBlocks[iMatch] == iEndBlock &&
+               iEndBlock - iBlock < MAX_BLOCKS_PER_READ)
+        {
+            ++iEndBlock;
+            ++iMatch;
+        }
+
+        const GUInt64 nFirstItem = static_cast<GUInt64>(iBlock) * m_nBlockSize;
+        const size_t nItems = static_cast<size_t>(std::min<GUInt64>(
+            static_cast<GUInt64>(iEndBlock - iBlock) * m_nBlockSize,
+            m_nItemCount - nFirstItem));
+        abyBlocks.resize(nItems * SIDX_ITEM_SIZE);
+        if (VSIFSeekL(m_fp, m_nItemsOffset + nFirstItem * SIDX_ITEM_SIZE,
+                      SEEK_SET) != 0 ||
+            VSIFReadL(abyBlocks.data(), SIDX_ITEM_SIZE, nItems, m_fp) != nItems)
+        {
+            CPLError(CE_Failure, CPLE_FileIO,
+                     "Cannot read block %d of spatial index",
+                     static_cast<int>(iBlock));
+            break;
+        }
+        for (size_t i = 0; i < nItems; ++i)
+        {
+            const GByte *pabyItem = abyBlocks.data() + i * SIDX_ITEM_SIZE;
+            ReadExtent(pabyItem, sItemExtent);
+            if (sItemExtent.Intersects(sEnvelope))
+            {
+                GIntBig nFID = 0;
+                memcpy(&nFID, pabyItem + SIDX_EXTENT_SIZE, sizeof(nFID));
+                CPL_LSBPTR64(&nFID);
+                anFIDs.push_back(nFID);
+            }
+        }
+    }
+    std::sort(anFIDs.begin(), anFIDs.end());
+    return anFIDs;
+}
+
+/************************************************************************/
+/*                          SidecarIndexWriter                          */
+/*                                                                      */
+/*      Writes items, received in Hilbert order, to a new index file.   */
+/*      Block extents are only known once all items have been written,  */
+/*      so they are written last, in the space reserved after the       */
+/*      header.                                                         */
+/************************************************************************/
+
+namespace
+{
+class SidecarIndexWriter
+{
+    VSILFILE *m_fp = nullptr;
+    GUInt64 m_nItemCount = 0;
+    GUInt64 m_nWrittenItems = 0;
+    std::vector<OGREnvelope> m_asBlockExtents{};
+    std::vector<GByte> m_abyBuffer{};
+    bool m_bOK = true;
+
+    SidecarIndexWriter(const SidecarIndexWriter &) = delete;
+    SidecarIndexWriter &operator=(const SidecarIndexWriter &) = delete;
+
+    void FlushBuffer()
+    {
+        if (m_bOK && !m_abyBuffer.empty())
+        {
+            m_bOK = VSIFWriteL(m_abyBuffer.data(), m_abyBuffer.size(), 1,
+                               m_fp) == 1;
+        }
+        m_abyBuffer.clear();
+    }
+
+  public:
+    SidecarIndexWriter() = default;
+
+    bool Start(VSILFILE *fp, const VSIStatBufL &sStatData, GUInt64 nItemCount);
+    void AddItem(const SidecarItem &oItem);
+    bool Finish();
+};
+
+/************************************************************************/
+/*                     SidecarIndexWriter::Start()                      */
+/************************************************************************/
+
+bool SidecarIndexWriter::Start(VSILFILE *fp, const VSIStatBufL &sStatData,
+                               GUInt64 nItemCount)
+{
+    m_fp = fp;
+    m_nItemCount = nItemCount;
+    const GUInt64 nBlockCount =
+        (nItemCount + SIDX_BLOCK_SIZE - 1) / SIDX_BLOCK_SIZE;
+    try
+    {
+        m_asBlockExtents.resize(static_cast<size_t>(nBlockCount));
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for spatial index block extents");
+        return false;
+    }
+
+    GByte abyHeader[SIDX_HEADER_SIZE];
+    memcpy(abyHeader, SIDX_MAGIC, SIDX_MAGIC_SIZE);
+    int nOffset = SIDX_MAGIC_SIZE;
+    GUInt32 nBlockSize = SIDX_BLOCK_SIZE;
+    CPL_LSBPTR32(&nBlockSize);
+    memcpy(abyHeader + nOffset, &nBlockSize, 4);
+    nOffset += 4;
+    memset(abyHeader + nOffset, 0, 4);
+    nOffset += 4;
+    GUInt64 nDataSize = static_cast<GUInt64>(sStatData.st_size);
+    CPL_LSBPTR64(&nDataSize);
+    memcpy(abyHeader + nOffset, &nDataSize, 8);
+    nOffset += 8;
+    GInt64 nDataMTime = static_cast<GInt64>(sStatData.st_mtime);
+    CPL_LSBPTR64(&nDataMTime);
+    memcpy(abyHeader + nOffset, &nDataMTime, 8);
+    nOffset += 8;
+    GUInt64 nTmp = nItemCount;
+    CPL_LSBPTR64(&nTmp);
+    memcpy(abyHeader + nOffset, &nTmp, 8);
+    nOffset += 8;
+    nTmp = nBlockCount;
+    CPL_LSBPTR64(&nTmp);
+    memcpy(abyHeader + nOffset, &nTmp, 8);
+
+    m_bOK = VSIFWriteL(abyHeader, SIDX_HEADER_SIZE, 1, fp) == 1;
+
+    // Placeholder for the block extents
+    const GByte abyZero[SIDX_EXTENT_SIZE] = {0};
+    for (GUInt64 i = 0; m_bOK && i < nBlockCount; ++i)
+        m_bOK = VSIFWriteL(abyZero, SIDX_EXTENT_SIZE, 1, fp) == 1;
+
+    m_abyBuffer.reserve(static_cast<size_t>(SIDX_BLOCK_SIZE) * SIDX_ITEM_SIZE);
+    return m_bOK;
+}
+
+/************************************************************************/
+/*                    SidecarIndexWriter::AddItem()                     */
+/************************************************************************/
+
+void SidecarIndexWriter::AddItem(const SidecarItem &oItem)
+{
+    CPLAssert(m_nWrittenItems < m_nItemCount);
+    m_asBlockExtents[static_cast<size_t>(m_nWrittenItems / SIDX_BLOCK_SIZE)]
+        .Merge(oItem.sExtent);
+    ++m_nWrittenItems;
+
+    GByte abyItem[SIDX_ITEM_SIZE];
+    WriteExtent(abyItem, oItem.sExtent);
+    GIntBig nFID = oItem.nFID;
+    CPL_LSBPTR64(&nFID);
+    memcpy(abyItem + SIDX_EXTENT_SIZE, &nFID, sizeof(nFID));
+    m_abyBuffer.insert(m_abyBuffer.end(), abyItem, abyItem + SIDX_ITEM_SIZE);
+    if (m_abyBuffer.size() == m_abyBuffer.capacity())
+        FlushBuffer();
+}
+
+/************************************************************************/
+/*                     SidecarIndexWriter::Finish()                     */
+/************************************************************************/
+
+bool SidecarIndexWriter::Finish()
+{
+    FlushBuffer();
+    if (!m_bOK || m_nWrittenItems != m_nItemCount)
+        return false;
+
+    if (VSIFSeekL(m_fp, SIDX_HEADER_SIZE, SEEK_SET) != 0)
+        return false;
+    for (const auto &sBlockExtent : m_asBlockExtents)
+    {
+        GByte abyExtent[SIDX_EXTENT_SIZE];
+        WriteExtent(abyExtent, sBlockExtent);
+        m_abyBuffer.insert(m_abyBuffer.end(), abyExtent,
+                           abyExtent + SIDX_EXTENT_SIZE);
+        if (m_abyBuffer.size() >= 64 * 1024)
+            FlushBuffer();
+    }
+    FlushBuffer();
+    return m_bOK;
+}
+
+/************************************************************************/
+/*                          SidecarSortedRuns                           */
+/*                                                                      */
+/*      Items sorted by runs that do not fit in the memory budget, in a */
+/*      temporary file, and merged back with a heap.                    */
+/************************************************************************/
+
+class SidecarSortedRuns
+{
+    struct Cursor
+    {
+        vsi_l_offset nPos = 0;
+        vsi_l_offset nEnd = 0;
+        std::vector<SidecarItem> aoBuffer{};
+        size_t iBuffer = 0;
+    };
+
+    std::string m_osTmpFilename{};
+    VSILFILE *m_fp = nullptr;
+    std::vector<std::pair<vsi_l_offset, vsi_l_offset>> m_aoRuns{};
+    std::vector<Cursor> m_aoCursors{};
+    std::vector<size_t> m_anHeap{};
+
+    SidecarSortedRuns(const SidecarSortedRuns &) = delete;
+    SidecarSortedRuns &operator=(const SidecarSortedRuns &) = delete;
+
+    bool Advance(Cursor &oCursor);
+
+    bool IsGreater(size_t iFirst, size_t iSecond) const
+    {
+        const Cursor &oFirst = m_aoCursors[iFirst];
+        const Cursor &oSecond = m_aoCursors[iSecond];
+        return SidecarItemLess(oSecond.aoBuffer[oSecond.iBuffer],
+                               oFirst.aoBuffer[oFirst.iBuffer]);
+    }
+
+  public:
+    SidecarSortedRuns() = default;
+    ~SidecarSortedRuns();
+
+    bool IsEmpty() const
+    {
+        return m_aoRuns.empty();
+    }
+
+    bool WriteRun(const std::vector<SidecarItem> &aoItems);
+    bool Merge(SidecarIndexWriter &oWriter);
+};
+
+/************************************************************************/
+/*                 SidecarSortedRuns::~SidecarSortedRuns()              */
+/************************************************************************/
+
+SidecarSortedRuns::~SidecarSortedRuns()
+{
+    if (m_fp)
+        VSIFCloseL(m_fp);
+    if (!m_osTmpFilename.empty())
+        VSIUnlink(m_osTmpFilename.c_str());
+}
+
+/************************************************************************/
+/*                     SidecarSortedRuns::WriteRun()                    */
+/************************************************************************/
+
+bool SidecarSortedRuns::WriteRun(const std::vector<SidecarItem> &aoItems)
+{
+    if (m_fp == nullptr)
+    {
+        m_osTmpFilename = CPLGenerateTempFilename("ogr_sidx");
+        m_fp = VSIFOpenL(m_osTmpFilename.c_str(), "wb+");
+        if (m_fp == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot create temporary file %s",
+                     m_osTmpFilename.c_str());
+            m_osTmpFilename.clear();
+            return false;
+        }
+    }
+
+    const vsi_l_offset nStart = m_aoRuns.empty() ? 0 : m_aoRuns.back().second;
+    const size_t nSize = aoItems.size() * sizeof(SidecarItem);
+    if (VSIFSeekL(m_fp, nStart, SEEK_SET) != 0 ||
+        VSIFWriteL(aoItems.data(), 1, nSize, m_fp) != nSize)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot write in temporary file %s",
+                 m_osTmpFilename.c_str());
+        return false;
+    }
+    m_aoRuns.emplace_back(nStart, nStart + nSize);
+    return true;
+}
+
+/************************************************************************/
+/*                     SidecarSortedRuns::Advance()                     */
+/*                                                                      */
+/*      Moves the cursor to its next item. Returns false at the end of  */
+/*      its run.                                                        */
+/************************************************************************/
+
+bool SidecarSortedRuns::Advance(Cursor &oCursor)
+{
+    ++oCursor.iBuffer;
+    if (oCursor.iBuffer < oCursor.aoBuffer.size())
+        return true;
+
+    constexpr size_t BUFFER_ITEMS = 4096;
+    const size_t nItems = static_cast<size_t>(std::min<vsi_l_offset>(
+        BUFFER_ITEMS, (oCursor.nEnd - oCursor.nPos) / sizeof(SidecarItem)));
+    if (nItems == 0)
+        return false;
+    oCursor.aoBuffer.resize(nItems);
+    oCursor.iBuffer = 0;
+    if (VSIFSeekL(m_fp, oCursor.nPos, SEEK_SET) != 0 ||
+        VSIFReadL(oCursor.aoBuffer.data(), sizeof(SidecarItem), nItems, m_fp) !=
+            nItems)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot read temporary file %s",
+                 m_osTmpFilename.c_str());
+        oCursor.aoBuffer.clear();
+        oCursor.nPos = oCursor.nEnd;
+        return false;
+    }
+    oCursor.nPos += nItems * sizeof(SidecarItem);
+    return true;
+}
+
+/************************************************************************/
+/*                      SidecarSortedRuns::Merge()                      */
+/************************************************************************/
+
+bool SidecarSortedRuns::Merge(SidecarIndexWriter &oWriter)
+{
+    m_aoCursors.resize(m_aoRuns.size());
+    for (size_t i = 0; i < m_aoCursors.size(); ++i)
+    {
+        Cursor &oCursor = m_aoCursors[i];
+        oCursor.nPos = m_aoRuns[i].first;
+        oCursor.nEnd = m_aoRuns[i].second;
+        if (Advance(oCursor))
+            m_anHeap.push_back(i);
+    }
+
+    const auto IsGreaterLambda = [this](size_t a, size_t b)
+    { return IsGreater(a, b); };
+    std::make_heap(m_anHeap.begin(), m_anHeap.end(), IsGreaterLambda);
+    while (!m_anHeap.empty())
+    {
+        std::pop_heap(m_anHeap.begin(), m_anHeap.end(), IsGreaterLambda);
+        Cursor &oCursor = m_aoCursors[m_anHeap.back()];
+        oWriter.AddItem(oCursor.aoBuffer[oCursor.iBuffer]);
+        if (Advance(oCursor))
+            std::push_heap(m_anHeap.begin(), m_anHeap.end(), IsGreaterLambda);
+        else
+            m_anHeap.pop_back();
+    }
+
+    for (const auto &oCursor : m_aoCursors)
+    {
+        if (oCursor.nPos != oCursor.nEnd)
+            return false;
+    }
+    return true;
+}
+}  // namespace
+
+/************************************************************************/
+/*                               Create()                               */
+/*                                                                      */
+/*      Builds the index from the features returned by the layer, which */
+/*      is expected to have no filter installed. Items are sorted in    */
+/*      memory up to OGR_SPATIAL_INDEX_BUILD_MAX_MEMORY, and by runs    */
+/*      merged from a temporary file beyond.                            */
+/************************************************************************/
+
+bool OGRSidecarSpatialIndex::Create(const char *pszDataFilename,
+                                    OGRLayer *poLayer)
+{
+    VSIStatBufL sStatData;
+    if (VSIStatL(pszDataFilename, &sStatData) != 0)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot stat %s", pszDataFilename);
+        return false;
+    }
+
+    // The Hilbert codes are computed relative to the layer extent, so it
+    // must be known before the items are collected.
+    OGREnvelope sGlobalExtent;
+    if (poLayer->GetExtent(0, &sGlobalExtent, TRUE) != OGRERR_NONE)
+    {
+        poLayer->ResetReading();
+        for (auto &&poFeature : *poLayer)
+        {
+            const OGRGeometry *poGeom = poFeature->GetGeomFieldRef(0);
+            if (poGeom == nullptr || poGeom->IsEmpty())
+                continue;
+            OGREnvelope sExtent;
+            poGeom->getEnvelope(&sExtent);
+            sGlobalExtent.Merge(sExtent);
+        }
+    }
+
+    const double dfWidth = sGlobalExtent.MaxX - sGlobalExtent.MinX;
+    const double dfHeight = sGlobalExtent.MaxY - sGlobalExtent.MinY;
+    // Sort items along a Hilbert curve of their center, so that the
+    // items of a block are spatially close to each other.
+    const auto ComputeHilbertCode =
+        [&sGlobalExtent, dfWidth, dfHeight](SidecarItem &oItem)
+    {
+        oItem.nHilbert = CPLHilbertCodeInExtent(
+            (oItem.sExtent.MinX + oItem.sExtent.MaxX) / 2,
+            (oItem.sExtent.MinY + oItem.sExtent.MaxY) / 2, sGlobalExtent.MinX,
+            sGlobalExtent.MinY, dfWidth, dfHeight);
+    };
+
+    const char *pszMaxMemory =
+        CPLGetConfigOption("OGR_SPATIAL_INDEX_BUILD_MAX_MEMORY", nullptr);
+    GIntBig nMaxMemory =
+        pszMaxMemory ? static_cast<GIntBig>(CPLAtof(pszMaxMemory) * 1024 * 1024)
+                     : CPLGetUsablePhysicalRAM() / 10;
+    if (nMaxMemory <= 0)
+        nMaxMemory = 256 * 1024 * 1024;
+    const size_t nMaxItemsInRun = static_cast<size_t>(std::max<GIntBig>(
+        SIDX_BLOCK_SIZE, std::min<GIntBig>(nMaxMemory / sizeof(SidecarItem),
+                                           std::numeric_limits<int>::max())));
+
+    std::vector<SidecarItem> aoItems;
+    SidecarSortedRuns oRuns;
+    GUInt64 nItemCount = 0;
+    bool bOK = true;
+    poLayer->ResetReading();
+    for (auto &&poFeature : *poLayer)
+    {
+        const OGRGeometry *poGeom = poFeature->GetGeomFieldRef(0);
+        if (poGeom == nullptr || poGeom->IsEmpty())
+            continue;
+        SidecarItem oItem;
+        poGeom->getEnvelope(&oItem.sExtent);
+        oItem.nFID = poFeature->GetFID();
+        ComputeHilbertCode(oItem);
+        aoItems.emplace_back(oItem);
+        ++nItemCount;
+        if (aoItems.size() == nMaxItemsInRun)
+        {
+            std::sort(aoItems.begin(), aoItems.end(), SidecarItemLess);
+            if (!oRuns.WriteRun(aoItems))
+            {
+                bOK = false;
+                break;
+            }
+            aoItems.clear();
+        }
+    }
+    poLayer->ResetReading();
+    if (!bOK)
+        return false;
+
+    std::sort(aoItems.begin(), aoItems.end(), SidecarItemLess);
+    if (!oRuns.IsEmpty() && !aoItems.empty())
+    {
+        if (!oRuns.WriteRun(aoItems))
+            return false;
+        aoItems.clear();
+        aoItems.shrink_to_fit();
+    }
+
+    const std::string osIndexFilename = GetIndexFilename(pszDataFilename);
+    VSILFILE *fp = VSIFOpenL(osIndexFilename.c_str(), "wb+");
+    if (fp == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                 osIndexFilename.c_str());
+        return false;
+    }
+
+    SidecarIndexWriter oWriter;
+    bOK = oWriter.Start(fp, sStatData, nItemCount);
+    if (bOK && oRuns.IsEmpty())
+    {
+        for (const auto &oItem : aoItems)
+            oWriter.AddItem(oItem);
+    }
+    else if (bOK)
+    {
+        bOK = oRuns.Merge(oWriter);
+    }
+    bOK = bOK && oWriter.Finish();
+
+    if (VSIFCloseL(fp) != 0)
+        bOK = false;
+    if (!bOK)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Error while writing %s",
+                 osIndexFilename.c_str());
+        VSIUnlink(osIndexFilename.c_str());
+    }
+    return bOK;
+}
+
+/************************************************************************/
+/*                                Drop()                                */
+/************************************************************************/
+
+bool OGRSidecarSpatialIndex::Drop(const char *pszDataFilename)
+{
+    const std::string osIndexFilename = GetIndexFilename(pszDataFilename);
+    VSIStatBufL sStat;
+    if (VSIStatL(osIndexFilename.c_str(), &sStat) != 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "No spatial index %s",
+                 osIndexFilename.c_str());
+        return false;
+    }
+    if (VSIUnlink(osIndexFilename.c_str()) != 0)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot delete %s",
+                 osIndexFilename.c_str());
+        return false;
+    }
+    return true;
+}
+
+//! @endcond
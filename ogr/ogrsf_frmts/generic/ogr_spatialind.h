@@ -0,0 +1,88 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Generic sidecar spatial index for sequential-access drivers.
+ * Author:   agent, <agent at local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent at local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#ifndef OGR_SPATIALIND_H_INCLUDED
+#define OGR_SPATIALIND_H_INCLUDED
+
+#include "cpl_packed_rtree.h"
+#include "cpl_vsi.h"
+#include "ogr_core.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+class OGRLayer;
+
+//! @cond Doxygen_Suppress
+
+/************************************************************************/
+/*                        OGRSidecarSpatialIndex                        */
+/*                                                                      */
+/*      Read-only packed spatial index stored next to a data file, as   */
+/*      <datafile>.ogrsidx. Items are sorted along a Hilbert curve and  */
+/*      grouped in fixed-size blocks whose extents are indexed in       */
+/*      memory by a CPLPackedRTree, so that a query only reads the      */
+/*      blocks it intersects.                                           */
+/************************************************************************/
+
+class OGRSidecarSpatialIndex
+{
+    VSILFILE *m_fp = nullptr;
+    GUInt32 m_nBlockSize = 0;
+    GUInt64 m_nItemCount = 0;
+    CPLPackedRTree m_oBlockTree{};
+    vsi_l_offset m_nItemsOffset = 0;
+
+    OGRSidecarSpatialIndex() = default;
+    OGRSidecarSpatialIndex(const OGRSidecarSpatialIndex &) = delete;
+    OGRSidecarSpatialIndex &operator=(const OGRSidecarSpatialIndex &) = delete;
+
+  public:
+    ~OGRSidecarSpatialIndex();
+
+    static std::string GetIndexFilename(const char *pszDataFilename);
+
+    static std::unique_ptr<OGRSidecarSpatialIndex>
+    Open(const char *pszDataFilename);
+
+    static bool Create(const char *pszDataFilename, OGRLayer *poLayer);
+
+    static bool Drop(const char *pszDataFilename);
+
+    GUInt64 GetItemCount() const
+    {
+        return m_nItemCount;
+    }
+
+    std::vector<GIntBig> Search(const OGREnvelope &sEnvelope) const;
+};
+
+//! @endcond
+
+#endif /* OGR_SPATIALIND_H_INCLUDED */
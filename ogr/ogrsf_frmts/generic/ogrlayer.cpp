@@ -37,6 +37,7 @@
 #include "ogrlayer_private.h"
 
 #include "cpl_time.h"
+#include "cpl_trace.h"
 #include <cassert>
 #include <limits>
 #include <set>
@@ -647,9 +648,99 @@ OGRFeatureH OGR_L_GetNextFeature(OGRLayerH hLayer)
         OGRAPISpy_L_GetNextFeature(hLayer);
 #endif
 
+    CPL_TRACE_SCOPE_CAT("OGRLayer::GetNextFeature", "ogr");
     return OGRFeature::ToHandle(OGRLayer::FromHandle(hLayer)->GetNextFeature());
 }
 
+/************************************************************************/
+/*                        GetNextFeatureInto()                          */
+/************************************************************************/
+
+/**
+ \brief Fetch the next available feature from this layer into an existing
+ feature object.
+
+ This method is equivalent to GetNextFeature(), except that the content of
+ the next feature is stored into the caller-provided oFeature object, which
+ can be reused across calls. For drivers that implement it natively (e.g.
+ Shapefile and GeoPackage), this avoids allocating and freeing a feature,
+ its field array and its geometry array for each row, which is beneficial
+ when iterating over layers with many small features.
+
+ oFeature must have been created with the OGRFeatureDefn returned by
+ GetLayerDefn(). Its previous content is discarded.
+
+ The default implementation calls GetNextFeature() and moves its content
+ into oFeature.
+
+ This method is the same as the C function OGR_L_GetNextFeatureInto().
+
+ @param oFeature feature that receives the content of the next feature.
+ @return true if a feature has been read, false when there are no more
+ features or in case of error (in which case oFeature is reset).
+
+ @since GDAL 3.10
+*/
+
+bool OGRLayer::GetNextFeatureInto(OGRFeature &oFeature)
+{
+    if (oFeature.GetDefnRef() != GetLayerDefn())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "GetNextFeatureInto(): feature definition of the passed "
+                 "feature is not the one of the layer");
+        return false;
+    }
+
+    std::unique_ptr<OGRFeature> poFeature(GetNextFeature());
+    if (!poFeature)
+    {
+        oFeature.Reset();
+        return false;
+    }
+    if (poFeature->GetDefnRef() != oFeature.GetDefnRef())
+    {
+        // Should not happen, but be robust to layers returning features
+        // with a different definition than GetLayerDefn().
+        oFeature.Reset();
+        oFeature.SetFrom(poFeature.get());
+        oFeature.SetFID(poFeature->GetFID());
+        return true;
+    }
+    oFeature.SwapContent(*poFeature);
+    return true;
+}
+
+/************************************************************************/
+/*                      OGR_L_GetNextFeatureInto()                      */
+/************************************************************************/
+
+/**
+ \brief Fetch the next available feature from this layer into an existing
+ feature object.
+
+ This function is the same as the C++ method OGRLayer::GetNextFeatureInto().
+
+ @param hLayer handle to the layer from which feature are read.
+ @param hFeature handle to a feature created with the definition returned
+ by OGR_L_GetLayerDefn(hLayer), which receives the content of the next
+ feature.
+ @return TRUE if a feature has been read, FALSE when there are no more
+ features or in case of error.
+
+ @since GDAL 3.10
+*/
+
+int OGR_L_GetNextFeatureInto(OGRLayerH hLayer, OGRFeatureH hFeature)
+
+{
+    VALIDATE_POINTER1(hLayer, "OGR_L_GetNextFeatureInto", FALSE);
+    VALIDATE_POINTER1(hFeature, "OGR_L_GetNextFeatureInto", FALSE);
+
+    return OGRLayer::FromHandle(hLayer)->GetNextFeatureInto(
+        *OGRFeature::FromHandle(hFeature));
+}
+
 /************************************************************************/
 /*                       ConvertGeomsIfNecessary()                      */
 /************************************************************************/
@@ -1666,6 +1757,9 @@ int OGRLayer::InstallFilter(OGRGeometry *poFilter)
         m_pPreparedFilterGeom = nullptr;
     }
 
+    m_poPrivate->m_anSidecarSpatialIndexFIDs.clear();
+    m_poPrivate->m_bSidecarSpatialIndexQueryDone = false;
+
     if (poFilter != nullptr)
         m_poFilterGeom = poFilter->clone();
 
@@ -1852,6 +1946,78 @@ bool OGRLayer::FilterWKBGeometry(const GByte *pabyWKB, size_t nWKBSize,
     return bRet;
 }
 
+/************************************************************************/
+/*                     FilterWKBGeometryWithoutGEOS()                   */
+/*                                                                      */
+/*      Returns 1 if the geometry is known to intersect the filter, 0   */
+/*      if it is known not to, and -1 if a GEOS test is needed.         */
+/************************************************************************/
+
+static int FilterWKBGeometryWithoutGEOS(const GByte *pabyWKB, size_t nWKBSize,
+                                        bool bEnvelopeAlreadySet,
+                                        OGREnvelope &sEnvelope,
+                                        bool bFilterIsEnvelope,
+                                        const OGREnvelope &sFilterEnvelope)
+{
+    if (!((bEnvelopeAlreadySet ||
+           OGRWKBGetBoundingBox(pabyWKB, nWKBSize, sEnvelope)) &&
+          sFilterEnvelope.Intersects(sEnvelope)))
+    {
+        return 0;
+    }
+
+    if (bFilterIsEnvelope && sFilterEnvelope.Contains(sEnvelope))
+        return 1;
+
+    bool bIntersects = false;
+    if (bFilterIsEnvelope &&
+        OGRWKBIntersectsPessimistic(pabyWKB, nWKBSize, sFilterEnvelope))
+    {
+        return 1;
+    }
+    else if (bFilterIsEnvelope &&
+             OGRWKBIntersectsEnvelope(pabyWKB, nWKBSize, sFilterEnvelope,
+                                      bIntersects))
+    {
+        // Exact test on linear geometries, without having to
+        // instantiate a OGRGeometry
+        return bIntersects ? 1 : 0;
+    }
+    else if (!OGRGeometryFactory::haveGEOS())
+    {
+        // Assume intersection
+        return 1;
+    }
+    return -1;
+}
+
+/************************************************************************/
+/*                       FilterWKBGeometryWithGEOS()                    */
+/*                                                                      */
+/*      Full intersection test through OGRGeometry, used when the GEOS  */
+/*      WKB reader cannot ingest the geometry.                          */
+/************************************************************************/
+
+static bool FilterWKBGeometryWithGEOS(const GByte *pabyWKB, size_t nWKBSize,
+                                      const OGRGeometry *poFilterGeom,
+                                      OGRPreparedGeometry *pPreparedFilterGeom)
+{
+    OGRGeometry *poGeom = nullptr;
+    int ret = FALSE;
+    if (OGRGeometryFactory::createFromWkb(pabyWKB, nullptr, &poGeom,
+                                          nWKBSize) == OGRERR_NONE)
+    {
+        if (pPreparedFilterGeom)
+            ret = OGRPreparedGeometryIntersects(
+                pPreparedFilterGeom,
+                OGRGeometry::ToHandle(const_cast<OGRGeometry *>(poGeom)));
+        else
+            ret = poFilterGeom->Intersects(poGeom);
+    }
+    delete poGeom;
+    return CPL_TO_BOOL(ret);
+}
+
 /* static */
 bool OGRLayer::FilterWKBGeometry(const GByte *pabyWKB, size_t nWKBSize,
                                  bool bEnvelopeAlreadySet,
@@ -1864,54 +2030,106 @@ bool OGRLayer::FilterWKBGeometry(const GByte *pabyWKB, size_t nWKBSize,
     if (!poFilterGeom)
         return true;
 
-    if ((bEnvelopeAlreadySet ||
-         OGRWKBGetBoundingBox(pabyWKB, nWKBSize, sEnvelope)) &&
-        sFilterEnvelope.Intersects(sEnvelope))
+    const int nRet = FilterWKBGeometryWithoutGEOS(
+        pabyWKB, nWKBSize, bEnvelopeAlreadySet, sEnvelope, bFilterIsEnvelope,
+        sFilterEnvelope);
+    if (nRet >= 0)
+        return nRet == 1;
+
+    if (!pPreparedFilterGeom)
+    {
+        pPreparedFilterGeom = OGRCreatePreparedGeometry(
+            OGRGeometry::ToHandle(const_cast<OGRGeometry *>(poFilterGeom)));
+    }
+    if (pPreparedFilterGeom)
     {
-        if (bFilterIsEnvelope && sFilterEnvelope.Contains(sEnvelope))
+        // Fast path: direct WKB to GEOS conversion.
+        int nIntersects = -1;
+        OGRPreparedGeometryIntersectsWKBBatch(pPreparedFilterGeom, 1, &pabyWKB,
+                                              &nWKBSize, &nIntersects);
+        if (nIntersects >= 0)
+            return nIntersects == 1;
+    }
+    return FilterWKBGeometryWithGEOS(pabyWKB, nWKBSize, poFilterGeom,
+                                     pPreparedFilterGeom);
+}
+
+/************************************************************************/
+/*                       FilterWKBGeometryBatch()                       */
+/*                                                                      */
+/*      Evaluate the spatial filter against nCount WKB geometries.      */
+/*      Geometries that need a full intersection test are submitted     */
+/*      together to GEOS. Returns the number of geometries that pass.   */
+/************************************************************************/
+
+size_t OGRLayer::FilterWKBGeometryBatch(size_t nCount,
+                                        const GByte *const *papabyWKB,
+                                        const size_t *panWKBSize,
+                                        std::vector<bool> &abResults) const
+{
+    abResults.assign(nCount, true);
+    if (!m_poFilterGeom)
+        return nCount;
+
+    size_t nCountIntersecting = 0;
+    std::vector<size_t> anCandidates;
+    OGREnvelope sEnvelope;
+    for (size_t i = 0; i < nCount; ++i)
+    {
+        const int nRet = FilterWKBGeometryWithoutGEOS(
+            papabyWKB[i], panWKBSize[i], /* bEnvelopeAlreadySet = */ false,
+            sEnvelope, CPL_TO_BOOL(m_bFilterIsEnvelope), m_sFilterEnvelope);
+        if (nRet < 0)
         {
-            return true;
+            anCandidates.push_back(i);
         }
         else
         {
-            if (bFilterIsEnvelope &&
-                OGRWKBIntersectsPessimistic(pabyWKB, nWKBSize, sFilterEnvelope))
-            {
-                return true;
-            }
-            else if (OGRGeometryFactory::haveGEOS())
-            {
-                OGRGeometry *poGeom = nullptr;
-                int ret = FALSE;
-                if (OGRGeometryFactory::createFromWkb(pabyWKB, nullptr, &poGeom,
-                                                      nWKBSize) == OGRERR_NONE)
-                {
-                    if (!pPreparedFilterGeom)
-                    {
-                        pPreparedFilterGeom =
-                            OGRCreatePreparedGeometry(OGRGeometry::ToHandle(
-                                const_cast<OGRGeometry *>(poFilterGeom)));
-                    }
-                    if (pPreparedFilterGeom)
-                        ret = OGRPreparedGeometryIntersects(
-                            pPreparedFilterGeom,
-                            OGRGeometry::ToHandle(
-                                const_cast<OGRGeometry *>(poGeom)));
-                    else
-                        ret = poFilterGeom->Intersects(poGeom);
-                }
-                delete poGeom;
-                return CPL_TO_BOOL(ret);
-            }
-            else
-            {
-                // Assume intersection
-                return true;
-            }
+            abResults[i] = nRet == 1;
+            nCountIntersecting += nRet;
         }
     }
+    if (anCandidates.empty())
+        return nCountIntersecting;
 
-    return false;
+    if (!m_pPreparedFilterGeom)
+    {
+        const_cast<OGRLayer *>(this)->m_pPreparedFilterGeom =
+            OGRCreatePreparedGeometry(OGRGeometry::ToHandle(m_poFilterGeom));
+    }
+
+    std::vector<const GByte *> apabyCandidateWKB;
+    std::vector<size_t> anCandidateWKBSize;
+    apabyCandidateWKB.reserve(anCandidates.size());
+    anCandidateWKBSize.reserve(anCandidates.size());
+    for (size_t i : anCandidates)
+    {
+        apabyCandidateWKB.push_back(papabyWKB[i]);
+        anCandidateWKBSize.push_back(panWKBSize[i]);
+    }
+    std::vector<int> anIntersects(anCandidates.size(), -1);
+    if (m_pPreparedFilterGeom)
+    {
+        OGRPreparedGeometryIntersectsWKBBatch(
+            m_pPreparedFilterGeom, anCandidates.size(),
+            apabyCandidateWKB.data(), anCandidateWKBSize.data(),
+            anIntersects.data());
+    }
+
+    for (size_t j = 0; j < anCandidates.size(); ++j)
+    {
+        const size_t i = anCandidates[j];
+        const bool bIntersects =
+            anIntersects[j] >= 0
+                ? anIntersects[j] == 1
+                : FilterWKBGeometryWithGEOS(papabyWKB[i], panWKBSize[i],
+                                            m_poFilterGeom,
+                                            m_pPreparedFilterGeom);
+        abResults[i] = bIntersects;
+        if (bIntersects)
+            nCountIntersecting++;
+    }
+    return nCountIntersecting;
 }
 
 //! @endcond
@@ -1962,6 +2180,166 @@ OGRErr OGRLayer::InitializeIndexSupport(const char *pszFilename)
     return eErr;
 }
 
+/************************************************************************/
+/*                InitializeSidecarSpatialIndexSupport()                */
+/*                                                                      */
+/*      Declares that the layer is backed by pszDataFilename and can    */
+/*      use a <pszDataFilename>.ogrsidx spatial index to answer         */
+/*      spatial filters on its first geometry field. Drivers calling    */
+/*      this must use UseSidecarSpatialIndex() and                      */
+/*      GetNextSidecarSpatialIndexFID() in their reading loop, and      */
+/*      call ResetSidecarSpatialIndexReading() from ResetReading().     */
+/************************************************************************/
+
+void OGRLayer::InitializeSidecarSpatialIndexSupport(const char *pszDataFilename)
+
+{
+    m_poPrivate->m_osSidecarSpatialIndexDataFilename = pszDataFilename;
+    m_poPrivate->m_poSidecarSpatialIndex =
+        OGRSidecarSpatialIndex::Open(pszDataFilename);
+    if (m_poPrivate->m_poSidecarSpatialIndex)
+    {
+        CPLDebug("OGR", "Using sidecar spatial index for layer %s",
+                 GetDescription());
+    }
+    m_poPrivate->m_anSidecarSpatialIndexFIDs.clear();
+    m_poPrivate->m_bSidecarSpatialIndexQueryDone = false;
+}
+
+/************************************************************************/
+/*                   HasSidecarSpatialIndexSupport()                    */
+/************************************************************************/
+
+bool OGRLayer::HasSidecarSpatialIndexSupport() const
+
+{
+    return !m_poPrivate->m_osSidecarSpatialIndexDataFilename.empty();
+}
+
+/************************************************************************/
+/*                     CreateSidecarSpatialIndex()                      */
+/************************************************************************/
+
+OGRErr OGRLayer::CreateSidecarSpatialIndex()
+
+{
+    if (!HasSidecarSpatialIndexSupport())
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Layer %s does not support sidecar spatial indexes",
+                 GetDescription());
+        return OGRERR_FAILURE;
+    }
+    if (GetLayerDefn()->GetGeomFieldCount() == 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Layer %s has no geometry field",
+                 GetDescription());
+        return OGRERR_FAILURE;
+    }
+
+    // Index all features, whatever the currently installed filters.
+    std::unique_ptr<OGRGeometry> poSavedFilterGeom(
+        m_poFilterGeom ? m_poFilterGeom->clone() : nullptr);
+    const int iSavedGeomFieldFilter = m_iGeomFieldFilter;
+    const std::string osSavedAttrQuery(
+        m_pszAttrQueryString ? m_pszAttrQueryString : "");
+    const bool bHadAttrQuery = m_pszAttrQueryString != nullptr;
+
+    SetSpatialFilter(nullptr);
+    SetAttributeFilter(nullptr);
+
+    const std::string osDataFilename(
+        m_poPrivate->m_osSidecarSpatialIndexDataFilename);
+    m_poPrivate->m_poSidecarSpatialIndex.reset();
+    const bool bOK =
+        OGRSidecarSpatialIndex::Create(osDataFilename.c_str(), this);
+    InitializeSidecarSpatialIndexSupport(osDataFilename.c_str());
+
+    if (bHadAttrQuery)
+        SetAttributeFilter(osSavedAttrQuery.c_str());
+    if (poSavedFilterGeom)
+        SetSpatialFilter(iSavedGeomFieldFilter, poSavedFilterGeom.get());
+
+    return bOK ? OGRERR_NONE : OGRERR_FAILURE;
+}
+
+/************************************************************************/
+/*                      DropSidecarSpatialIndex()                       */
+/************************************************************************/
+
+OGRErr OGRLayer::DropSidecarSpatialIndex()
+
+{
+    if (!HasSidecarSpatialIndexSupport())
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Layer %s does not support sidecar spatial indexes",
+                 GetDescription());
+        return OGRERR_FAILURE;
+    }
+
+    m_poPrivate->m_poSidecarSpatialIndex.reset();
+    m_poPrivate->m_anSidecarSpatialIndexFIDs.clear();
+    m_poPrivate->m_bSidecarSpatialIndexQueryDone = false;
+    ResetReading();
+    return OGRSidecarSpatialIndex::Drop(
+               m_poPrivate->m_osSidecarSpatialIndexDataFilename.c_str())
+               ? OGRERR_NONE
+               : OGRERR_FAILURE;
+}
+
+/************************************************************************/
+/*                       UseSidecarSpatialIndex()                       */
+/*                                                                      */
+/*      Whether the driver should iterate over the FIDs returned by     */
+/*      GetNextSidecarSpatialIndexFID() instead of scanning the file.   */
+/************************************************************************/
+
+bool OGRLayer::UseSidecarSpatialIndex()
+
+{
+    return m_poFilterGeom != nullptr && m_iGeomFieldFilter == 0 &&
+           m_poPrivate->m_poSidecarSpatialIndex != nullptr;
+}
+
+/************************************************************************/
+/*                   GetNextSidecarSpatialIndexFID()                    */
+/*                                                                      */
+/*      Returns, in increasing order, the FIDs of the features whose    */
+/*      extent intersects the spatial filter extent. The caller must    */
+/*      still apply FilterGeometry() and the attribute filter.          */
+/************************************************************************/
+
+bool OGRLayer::GetNextSidecarSpatialIndexFID(GIntBig &nFID)
+
+{
+    if (!m_poPrivate->m_bSidecarSpatialIndexQueryDone)
+    {
+        m_poPrivate->m_anSidecarSpatialIndexFIDs =
+            m_poPrivate->m_poSidecarSpatialIndex->Search(m_sFilterEnvelope);
+        m_poPrivate->m_iNextSidecarSpatialIndexFID = 0;
+        m_poPrivate->m_bSidecarSpatialIndexQueryDone = true;
+    }
+    if (m_poPrivate->m_iNextSidecarSpatialIndexFID >=
+        m_poPrivate->m_anSidecarSpatialIndexFIDs.size())
+    {
+        return false;
+    }
+    nFID = m_poPrivate->m_anSidecarSpatialIndexFIDs
+               [m_poPrivate->m_iNextSidecarSpatialIndexFID++];
+    return true;
+}
+
+/************************************************************************/
+/*                  ResetSidecarSpatialIndexReading()                   */
+/************************************************************************/
+
+void OGRLayer::ResetSidecarSpatialIndexReading()
+
+{
+    m_poPrivate->m_iNextSidecarSpatialIndexFID = 0;
+}
+
 //! @endcond
 
 /************************************************************************/
@@ -30,6 +30,11 @@
 #define OGRLAYER_PRIVATE_H_INCLUDED
 
 #include "ogrsf_frmts.h"
+#include "ogr_spatialind.h"
+
+#include <memory>
+#include <string>
+#include <vector>
 
 //! @cond Doxygen_Suppress
 struct OGRLayer::Private
@@ -56,6 +61,22 @@ struct OGRLayer::Private
 
     //! Whether OGRGeometry::SetPrecision() should be applied. Only valid after ConvertGeomsIfNecessary() has been called.
     bool m_bApplyGeomSetPrecision = false;
+
+    //! Data file whose sidecar spatial index may be used, or empty if the
+    //! layer does not support sidecar spatial indexes.
+    std::string m_osSidecarSpatialIndexDataFilename{};
+
+    //! Sidecar spatial index, if one exists and is up to date.
+    std::unique_ptr<OGRSidecarSpatialIndex> m_poSidecarSpatialIndex{};
+
+    //! Result of the sidecar spatial index query for the current filter.
+    std::vector<GIntBig> m_anSidecarSpatialIndexFIDs{};
+
+    //! Position in m_anSidecarSpatialIndexFIDs.
+    size_t m_iNextSidecarSpatialIndexFID = 0;
+
+    //! Whether m_anSidecarSpatialIndexFIDs is valid for the current filter.
+    bool m_bSidecarSpatialIndexQueryDone = false;
 };
 
 //! @endcond
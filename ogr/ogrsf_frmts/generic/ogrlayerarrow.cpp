@@ -2443,6 +2443,13 @@ From OGR using the Arrow C Stream data interface</a> tutorial.
  *     (possibly using GeoArrow encoding).</li>
  * </ul>
  *
+ * The GeoPackage driver recognizes the following option:
+ * <ul>
+ * <li>MAX_THREADS=integer or ALL_CPUS (GDAL >= 3.10). Number of threads used
+ *     to read the table. Overrides the OGR_GPKG_NUM_THREADS configuration
+ *     option.</li>
+ * </ul>
+ *
  * @param out_stream Output stream. Must *not* be NULL. The content of the
  *                  structure does not need to be initialized.
  * @param papszOptions NULL terminated list of key=value options.
@@ -2637,6 +2644,13 @@ YES.</li>
  *     (possibly using GeoArrow encoding).</li>
  * </ul>
  *
+ * The GeoPackage driver recognizes the following option:
+ * <ul>
+ * <li>MAX_THREADS=integer or ALL_CPUS (GDAL >= 3.10). Number of threads used
+ *     to read the table. Overrides the OGR_GPKG_NUM_THREADS configuration
+ *     option.</li>
+ * </ul>
+ *
  * @param hLayer Layer
  * @param out_stream Output stream. Must *not* be NULL. The content of the
  *                  structure does not need to be initialized.
@@ -3565,25 +3579,36 @@ FillValidityArrayFromWKBArray(struct ArrowArray *array, const OGRLayer *poLayer,
     const OffsetType *panOffsets =
         static_cast<const OffsetType *>(array->buffers[1]) + nOffset;
     const GByte *pabyData = static_cast<const GByte *>(array->buffers[2]);
-    OGREnvelope sEnvelope;
+    abyValidityFromFilters.clear();
     abyValidityFromFilters.resize(nLength);
-    size_t nCountIntersecting = 0;
+
+    // Evaluate all non-null geometries of the batch at once, so that those
+    // needing a GEOS test share the same conversion pipeline.
+    std::vector<size_t> anRows;
+    std::vector<const GByte *> apabyWKB;
+    std::vector<size_t> anWKBSize;
+    anRows.reserve(nLength);
+    apabyWKB.reserve(nLength);
+    anWKBSize.reserve(nLength);
     for (size_t i = 0; i < nLength; ++i)
     {
         if (!pabyValidity || TestBit(pabyValidity, i + nOffset))
         {
-            const GByte *pabyWKB = pabyData + panOffsets[i];
-            const size_t nWKBSize =
-                static_cast<size_t>(panOffsets[i + 1] - panOffsets[i]);
-            if (poLayer->FilterWKBGeometry(pabyWKB, nWKBSize,
-                                           /* bEnvelopeAlreadySet=*/false,
-                                           sEnvelope))
-            {
-                abyValidityFromFilters[i] = true;
-                nCountIntersecting++;
-            }
+            anRows.push_back(i);
+            apabyWKB.push_back(pabyData + panOffsets[i]);
+            anWKBSize.push_back(
+                static_cast<size_t>(panOffsets[i + 1] - panOffsets[i]));
         }
     }
+
+    std::vector<bool> abIntersects;
+    const size_t nCountIntersecting = poLayer->FilterWKBGeometryBatch(
+        anRows.size(), apabyWKB.data(), anWKBSize.data(), abIntersects);
+    for (size_t j = 0; j < anRows.size(); ++j)
+    {
+        if (abIntersects[j])
+            abyValidityFromFilters[anRows[j]] = true;
+    }
     return nCountIntersecting;
 }
 
@@ -4678,6 +4703,684 @@ static bool SetFieldForOtherFormats(OGRFeature &oFeature,
     return true;
 }
 
+/************************************************************************/
+/*                    OGRArrowColumnarFilterEvaluator                   */
+/************************************************************************/
+
+namespace
+{
+
+/** Column-at-a-time evaluator of a subset of swq expressions over the
+ * columns of an Arrow array.
+ *
+ * Handled expressions are AND, OR, NOT, IS NULL, and comparisons (=, <>, <,
+ * <=, >, >=, BETWEEN, IN, LIKE, ILIKE) between an attribute column and
+ * constant(s) of the same type family. The result for each row is
+ * represented by a value and a null flag, following the semantics of
+ * SWQGeneralEvaluator(), so that the outcome is identical to the one of
+ * OGRFeatureQuery::Evaluate(). Evaluate() returns false when the expression
+ * contains constructs that are not handled, in which case the caller must
+ * use the feature per feature evaluation.
+ */
+class OGRArrowColumnarFilterEvaluator
+{
+  public:
+    OGRArrowColumnarFilterEvaluator(const OGRLayer *poLayer,
+                                    const struct ArrowSchema *schema,
+                                    const struct ArrowArray *array,
+                                    size_t nLength);
+
+    bool Evaluate(const swq_expr_node *poNode, std::vector<uint8_t> &abyValue,
+                  std::vector<uint8_t> &abyNull);
+
+  private:
+    struct Column
+    {
+        const struct ArrowSchema *psSchema = nullptr;
+        const struct ArrowArray *psArray = nullptr;
+        std::vector<uint8_t> abyNull{};
+    };
+
+    OGRFeatureDefn *m_poFeatureDefn = nullptr;
+    const struct ArrowSchema *m_psSchema = nullptr;
+    const struct ArrowArray *m_psArray = nullptr;
+    const size_t m_nLength;
+    const bool m_bUTF8Strings;
+    std::map<std::string, std::vector<int>> m_oMapFieldNameToArrowPath{};
+
+    bool GetColumn(const swq_expr_node *poNode, Column &sColumn) const;
+
+    bool GetColumnAsInt64(const Column &sColumn,
+                          std::vector<int64_t> &anValues) const;
+    bool GetColumnAsDouble(const Column &sColumn,
+                           std::vector<double> &adfValues) const;
+
+    template <class T>
+    void CompareNumeric(const swq_expr_node *poNode,
+                        const std::vector<T> &aValues, const T *pConstants,
+                        std::vector<uint8_t> &abyValue) const;
+
+    bool EvaluateComparison(const swq_expr_node *poNode,
+                            std::vector<uint8_t> &abyValue,
+                            std::vector<uint8_t> &abyNull);
+    bool EvaluateStringComparison(const swq_expr_node *poNode,
+                                  const Column &sColumn,
+                                  std::vector<uint8_t> &abyValue) const;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRArrowColumnarFilterEvaluator)
+};
+
+/************************************************************************/
+/*                   OGRArrowColumnarFilterEvaluator()                  */
+/************************************************************************/
+
+OGRArrowColumnarFilterEvaluator::OGRArrowColumnarFilterEvaluator(
+    const OGRLayer *poLayer, const struct ArrowSchema *schema,
+    const struct ArrowArray *array, size_t nLength)
+    : m_poFeatureDefn(const_cast<OGRLayer *>(poLayer)->GetLayerDefn()),
+      m_psSchema(schema), m_psArray(array), m_nLength(nLength),
+      m_bUTF8Strings(CPL_TO_BOOL(
+          const_cast<OGRLayer *>(poLayer)->TestCapability(OLCStringsAsUTF8)))
+{
+    std::vector<int> anArrowPathTmp;
+    BuildMapFieldNameToArrowPath(schema, m_oMapFieldNameToArrowPath,
+                                 std::string(), anArrowPathTmp);
+}
+
+/************************************************************************/
+/*                             GetColumn()                              */
+/************************************************************************/
+
+/** Resolve a SNT_COLUMN node to its Arrow array, and compute its null flags,
+ * taking into account the validity of the parent structures. */
+bool OGRArrowColumnarFilterEvaluator::GetColumn(const swq_expr_node *poNode,
+                                                Column &sColumn) const
+{
+    if (poNode->eNodeType != SNT_COLUMN || poNode->table_index != 0 ||
+        poNode->field_index < 0 ||
+        poNode->field_index >= m_poFeatureDefn->GetFieldCount())
+    {
+        return false;
+    }
+    const auto oIter = m_oMapFieldNameToArrowPath.find(
+        m_poFeatureDefn->GetFieldDefn(poNode->field_index)->GetNameRef());
+    if (oIter == m_oMapFieldNameToArrowPath.end())
+        return false;
+
+    sColumn.abyNull.assign(m_nLength, 0);
+    const struct ArrowSchema *psSchemaField = m_psSchema;
+    const struct ArrowArray *psArray = m_psArray;
+    const auto &anArrowPath = oIter->second;
+    for (size_t i = 0; i <= anArrowPath.size(); ++i)
+    {
+        if (i > 0)
+        {
+            if (psArray->null_count != 0 && psArray->buffers[0])
+            {
+                const auto pabyValidity =
+                    static_cast<const uint8_t *>(psArray->buffers[0]);
+                const size_t nOffset = static_cast<size_t>(psArray->offset);
+                for (size_t iRow = 0; iRow < m_nLength; ++iRow)
+                {
+                    sColumn.abyNull[iRow] |= static_cast<uint8_t>(
+                        !TestBit(pabyValidity, iRow + nOffset));
+                }
+            }
+        }
+        if (i == anArrowPath.size())
+            break;
+        psSchemaField = psSchemaField->children[anArrowPath[i]];
+        psArray = psArray->children[anArrowPath[i]];
+    }
+    if (psSchemaField->dictionary)
+        return false;
+
+    sColumn.psSchema = psSchemaField;
+    sColumn.psArray = psArray;
+    return true;
+}
+
+/************************************************************************/
+/*                         GetColumnAsInt64()                           */
+/************************************************************************/
+
+template <class T>
+static void ConvertArrowValues(const struct ArrowArray *psArray, size_t nLength,
+                               std::vector<int64_t> &anValues)
+{
+    const T *panSrc = static_cast<const T *>(psArray->buffers[1]) +
+                      static_cast<size_t>(psArray->offset);
+    anValues.resize(nLength);
+    for (size_t i = 0; i < nLength; ++i)
+        anValues[i] = static_cast<int64_t>(panSrc[i]);
+}
+
+bool OGRArrowColumnarFilterEvaluator::GetColumnAsInt64(
+    const Column &sColumn, std::vector<int64_t> &anValues) const
+{
+    const char *format = sColumn.psSchema->format;
+    const auto psArray = sColumn.psArray;
+    if (IsInt8(format))
+        ConvertArrowValues<int8_t>(psArray, m_nLength, anValues);
+    else if (IsUInt8(format))
+        ConvertArrowValues<uint8_t>(psArray, m_nLength, anValues);
+    else if (IsInt16(format))
+        ConvertArrowValues<int16_t>(psArray, m_nLength, anValues);
+    else if (IsUInt16(format))
+        ConvertArrowValues<uint16_t>(psArray, m_nLength, anValues);
+    else if (IsInt32(format))
+        ConvertArrowValues<int32_t>(psArray, m_nLength, anValues);
+    else if (IsUInt32(format))
+        ConvertArrowValues<uint32_t>(psArray, m_nLength, anValues);
+    else if (IsInt64(format))
+        ConvertArrowValues<int64_t>(psArray, m_nLength, anValues);
+    else
+        return false;
+    return true;
+}
+
+/************************************************************************/
+/*                         GetColumnAsDouble()                          */
+/************************************************************************/
+
+template <class T>
+static void ConvertArrowValues(const struct ArrowArray *psArray, size_t nLength,
+                               std::vector<double> &adfValues)
+{
+    const T *pSrc = static_cast<const T *>(psArray->buffers[1]) +
+                    static_cast<size_t>(psArray->offset);
+    adfValues.resize(nLength);
+    for (size_t i = 0; i < nLength; ++i)
+        adfValues[i] = static_cast<double>(pSrc[i]);
+}
+
+bool OGRArrowColumnarFilterEvaluator::GetColumnAsDouble(
+    const Column &sColumn, std::vector<double> &adfValues) const
+{
+    const char *format = sColumn.psSchema->format;
+    const auto psArray = sColumn.psArray;
+    if (IsFloat32(format))
+        ConvertArrowValues<float>(psArray, m_nLength, adfValues);
+    else if (IsFloat64(format))
+        ConvertArrowValues<double>(psArray, m_nLength, adfValues);
+    else if (IsInt8(format))
+        ConvertArrowValues<int8_t>(psArray, m_nLength, adfValues);
+    else if (IsUInt8(format))
+        ConvertArrowValues<uint8_t>(psArray, m_nLength, adfValues);
+    else if (IsInt16(format))
+        ConvertArrowValues<int16_t>(psArray, m_nLength, adfValues);
+    else if (IsUInt16(format))
+        ConvertArrowValues<uint16_t>(psArray, m_nLength, adfValues);
+    else if (IsInt32(format))
+        ConvertArrowValues<int32_t>(psArray, m_nLength, adfValues);
+    else if (IsUInt32(format))
+        ConvertArrowValues<uint32_t>(psArray, m_nLength, adfValues);
+    else if (IsInt64(format))
+        ConvertArrowValues<int64_t>(psArray, m_nLength, adfValues);
+    else
+        return false;
+    return true;
+}
+
+/************************************************************************/
+/*                          CompareNumeric()                            */
+/************************************************************************/
+
+template <class T>
+void OGRArrowColumnarFilterEvaluator::CompareNumeric(
+    const swq_expr_node *poNode, const std::vector<T> &aValues,
+    const T *pConstants, std::vector<uint8_t> &abyValue) const
+{
+    const T *pValues = aValues.data();
+    uint8_t *pabyValue = abyValue.data();
+    const size_t nLength = m_nLength;
+    const T c = pConstants[0];
+    switch (poNode->nOperation)
+    {
+        case SWQ_EQ:
+            for (size_t i = 0; i < nLength; ++i)
+                pabyValue[i] = pValues[i] == c;
+            break;
+        case SWQ_NE:
+            for (size_t i = 0; i < nLength; ++i)
+                pabyValue[i] = pValues[i] != c;
+            break;
+        case SWQ_LT:
+            for (size_t i = 0; i < nLength; ++i)
+                pabyValue[i] = pValues[i] < c;
+            break;
+        case SWQ_LE:
+            for (size_t i = 0; i < nLength; ++i)
+                pabyValue[i] = pValues[i] <= c;
+            break;
+        case SWQ_GT:
+            for (size_t i = 0; i < nLength; ++i)
+                pabyValue[i] = pValues[i] > c;
+            break;
+        case SWQ_GE:
+            for (size_t i = 0; i < nLength; ++i)
+                pabyValue[i] = pValues[i] >= c;
+            break;
+        case SWQ_BETWEEN:
+        {
+            const T c2 = pConstants[1];
+            for (size_t i = 0; i < nLength; ++i)
+                pabyValue[i] = pValues[i] >= c && pValues[i] <= c2;
+            break;
+        }
+        case SWQ_IN:
+        {
+            std::fill(abyValue.begin(), abyValue.end(), 0);
+            for (int j = 0; j < poNode->nSubExprCount - 1; ++j)
+            {
+                const T cj = pConstants[j];
+                for (size_t i = 0; i < nLength; ++i)
+                    pabyValue[i] |= pValues[i] == cj;
+            }
+            break;
+        }
+        default:
+            CPLAssert(false);
+            break;
+    }
+}
+
+/************************************************************************/
+/*                      EvaluateStringComparison()                      */
+/************************************************************************/
+
+bool OGRArrowColumnarFilterEvaluator::EvaluateStringComparison(
+    const swq_expr_node *poNode, const Column &sColumn,
+    std::vector<uint8_t> &abyValue) const
+{
+    const char *format = sColumn.psSchema->format;
+    const bool bLargeString = IsLargeString(format);
+    if (!bLargeString && !IsString(format))
+        return false;
+
+    const auto nOp = poNode->nOperation;
+    for (int j = 1; j < poNode->nSubExprCount; ++j)
+    {
+        const auto poConstant = poNode->papoSubExpr[j];
+        if (poConstant->eNodeType != SNT_CONSTANT ||
+            poConstant->field_type != SWQ_STRING || poConstant->is_null ||
+            poConstant->string_value == nullptr)
+        {
+            return false;
+        }
+    }
+    if ((nOp == SWQ_LIKE || nOp == SWQ_ILIKE) &&
+        poNode->nSubExprCount == 3 &&
+        poNode->papoSubExpr[2]->string_value[0] == '\0')
+    {
+        return false;
+    }
+    if (nOp == SWQ_EQ)
+    {
+        // SWQGeneralEvaluator() has special rules for the comparison of
+        // timestamps with a +00 timezone. Do not attempt to reproduce them.
+        const char *pszConstant = poNode->papoSubExpr[1]->string_value;
+        const size_t nConstantLen = strlen(pszConstant);
+        if (nConstantLen > 3 &&
+            (strcmp(pszConstant + nConstantLen - 3, "+00") == 0 ||
+             pszConstant[nConstantLen - 3] == ':'))
+        {
+            return false;
+        }
+    }
+
+    const auto psArray = sColumn.psArray;
+    const size_t nOffset = static_cast<size_t>(psArray->offset);
+    const uint32_t *panOffsets32 =
+        static_cast<const uint32_t *>(psArray->buffers[1]);
+    const uint64_t *panOffsets64 =
+        static_cast<const uint64_t *>(psArray->buffers[1]);
+    const char *pachData = static_cast<const char *>(psArray->buffers[2]);
+
+    const bool bInsensitive =
+        nOp == SWQ_ILIKE ||
+        (nOp == SWQ_LIKE &&
+         CPLTestBool(CPLGetConfigOption("OGR_SQL_LIKE_AS_ILIKE", "FALSE")));
+    const char chEscape = (nOp == SWQ_LIKE || nOp == SWQ_ILIKE) &&
+                                  poNode->nSubExprCount == 3
+                              ? poNode->papoSubExpr[2]->string_value[0]
+                              : '\0';
+
+    // Values are copied in a reused buffer to get a nul-terminated string,
+    // and compared with the same functions as SWQGeneralEvaluator()
+    std::string osValue;
+    for (size_t iRow = 0; iRow < m_nLength; ++iRow)
+    {
+        if (sColumn.abyNull[iRow])
+            continue;
+        const size_t nIdx = iRow + nOffset;
+        if (bLargeString)
+        {
+            osValue.assign(
+                pachData + static_cast<size_t>(panOffsets64[nIdx]),
+                static_cast<size_t>(panOffsets64[nIdx + 1] -
+                                    panOffsets64[nIdx]));
+        }
+        else
+        {
+            osValue.assign(pachData + panOffsets32[nIdx],
+                           panOffsets32[nIdx + 1] - panOffsets32[nIdx]);
+        }
+        const char *pszValue = osValue.c_str();
+
+        bool bRes = false;
+        switch (nOp)
+        {
+            case SWQ_EQ:
+                bRes = strcasecmp(pszValue,
+                                  poNode->papoSubExpr[1]->string_value) == 0;
+                break;
+            case SWQ_NE:
+                bRes = strcasecmp(pszValue,
+                                  poNode->papoSubExpr[1]->string_value) != 0;
+                break;
+            case SWQ_LT:
+                bRes = strcasecmp(pszValue,
+                                  poNode->papoSubExpr[1]->string_value) < 0;
+                break;
+            case SWQ_LE:
+                bRes = strcasecmp(pszValue,
+                                  poNode->papoSubExpr[1]->string_value) <= 0;
+                break;
+            case SWQ_GT:
+                bRes = strcasecmp(pszValue,
+                                  poNode->papoSubExpr[1]->string_value) > 0;
+                break;
+            case SWQ_GE:
+                bRes = strcasecmp(pszValue,
+                                  poNode->papoSubExpr[1]->string_value) >= 0;
+                break;
+            case SWQ_BETWEEN:
+                bRes = strcasecmp(pszValue,
+                                  poNode->papoSubExpr[1]->string_value) >= 0 &&
+                       strcasecmp(pszValue,
+                                  poNode->papoSubExpr[2]->string_value) <= 0;
+                break;
+            case SWQ_IN:
+                for (int j = 1; !bRes && j < poNode->nSubExprCount; ++j)
+                {
+                    bRes = strcasecmp(pszValue,
+                                      poNode->papoSubExpr[j]->string_value) ==
+                           0;
+                }
+                break;
+            case SWQ_LIKE:
+            case SWQ_ILIKE:
+                bRes = swq_test_like(pszValue,
+                                     poNode->papoSubExpr[1]->string_value,
+                                     chEscape, bInsensitive, m_bUTF8Strings) !=
+                       0;
+                break;
+            default:
+                return false;
+        }
+        abyValue[iRow] = bRes;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                        EvaluateComparison()                          */
+/************************************************************************/
+
+bool OGRArrowColumnarFilterEvaluator::EvaluateComparison(
+    const swq_expr_node *poNode, std::vector<uint8_t> &abyValue,
+    std::vector<uint8_t> &abyNull)
+{
+    const auto nOp = poNode->nOperation;
+    const int nExpectedSubExpr =
+        nOp == SWQ_BETWEEN ? 3 : (nOp == SWQ_LIKE || nOp == SWQ_ILIKE) ? -1
+                             : nOp == SWQ_IN                           ? 0
+                                                                       : 2;
+    if ((nExpectedSubExpr > 0 && poNode->nSubExprCount != nExpectedSubExpr) ||
+        (nOp == SWQ_IN && poNode->nSubExprCount < 2) ||
+        ((nOp == SWQ_LIKE || nOp == SWQ_ILIKE) &&
+         poNode->nSubExprCount != 2 && poNode->nSubExprCount != 3))
+    {
+        return false;
+    }
+
+    Column sColumn;
+    if (!GetColumn(poNode->papoSubExpr[0], sColumn))
+        return false;
+
+    abyValue.assign(m_nLength, 0);
+    const auto eColumnType = poNode->papoSubExpr[0]->field_type;
+    if (eColumnType == SWQ_STRING)
+    {
+        if (!EvaluateStringComparison(poNode, sColumn, abyValue))
+            return false;
+    }
+    else if (nOp == SWQ_LIKE || nOp == SWQ_ILIKE)
+    {
+        return false;
+    }
+    else if (eColumnType == SWQ_INTEGER || eColumnType == SWQ_INTEGER64 ||
+             eColumnType == SWQ_FLOAT)
+    {
+        // Mimic the promotion rules of SWQGeneralEvaluator(): the comparison
+        // is done on doubles if the column or the first constant is a float.
+        for (int j = 1; j < poNode->nSubExprCount; ++j)
+        {
+            const auto poConstant = poNode->papoSubExpr[j];
+            if (poConstant->eNodeType != SNT_CONSTANT || poConstant->is_null)
+                return false;
+        }
+        const auto eFirstConstantType = poNode->papoSubExpr[1]->field_type;
+        const bool bFloat =
+            eColumnType == SWQ_FLOAT || eFirstConstantType == SWQ_FLOAT;
+        for (int j = 1; j < poNode->nSubExprCount; ++j)
+        {
+            // Only the first constant is converted from integer to float,
+            // and other constants must be of the type of the comparison.
+            const auto eType = poNode->papoSubExpr[j]->field_type;
+            const bool bTypeOK =
+                j == 1 ? (eType == SWQ_FLOAT || SWQ_IS_INTEGER(eType))
+                : bFloat ? eType == SWQ_FLOAT
+                         : SWQ_IS_INTEGER(eType);
+            if (!bTypeOK)
+                return false;
+        }
+
+        const char *format = sColumn.psSchema->format;
+        if (bFloat)
+        {
+            // Only accept Arrow types whose conversion to the OGR field type
+            // is lossless, to get the same values as in OGRFeature.
+            if (eColumnType == SWQ_INTEGER &&
+                !(IsInt8(format) || IsUInt8(format) || IsInt16(format) ||
+                  IsUInt16(format) || IsInt32(format)))
+            {
+                return false;
+            }
+            std::vector<double> adfValues;
+            if (!GetColumnAsDouble(sColumn, adfValues))
+                return false;
+            std::vector<double> adfConstants;
+            for (int j = 1; j < poNode->nSubExprCount; ++j)
+            {
+                const auto poConstant = poNode->papoSubExpr[j];
+                adfConstants.push_back(
+                    poConstant->field_type == SWQ_FLOAT
+                        ? poConstant->float_value
+                        : static_cast<double>(poConstant->int_value));
+            }
+            CompareNumeric(poNode, adfValues, adfConstants.data(), abyValue);
+        }
+        else
+        {
+            if (eColumnType == SWQ_INTEGER &&
+                !(IsInt8(format) || IsUInt8(format) || IsInt16(format) ||
+                  IsUInt16(format) || IsInt32(format)))
+            {
+                return false;
+            }
+            std::vector<int64_t> anValues;
+            if (!GetColumnAsInt64(sColumn, anValues))
+                return false;
+            std::vector<int64_t> anConstants;
+            for (int j = 1; j < poNode->nSubExprCount; ++j)
+                anConstants.push_back(poNode->papoSubExpr[j]->int_value);
+            CompareNumeric(poNode, anValues, anConstants.data(), abyValue);
+        }
+    }
+    else
+    {
+        return false;
+    }
+
+    // Comparisons involving a null value evaluate to null
+    abyNull = std::move(sColumn.abyNull);
+    for (size_t i = 0; i < m_nLength; ++i)
+        abyValue[i] &= static_cast<uint8_t>(!abyNull[i]);
+    return true;
+}
+
+/************************************************************************/
+/*                             Evaluate()                               */
+/************************************************************************/
+
+bool OGRArrowColumnarFilterEvaluator::Evaluate(const swq_expr_node *poNode,
+                                               std::vector<uint8_t> &abyValue,
+                                               std::vector<uint8_t> &abyNull)
+{
+    if (poNode->eNodeType != SNT_OPERATION)
+        return false;
+
+    switch (poNode->nOperation)
+    {
+        case SWQ_AND:
+        case SWQ_OR:
+        {
+            if (poNode->nSubExprCount < 1 ||
+                !Evaluate(poNode->papoSubExpr[0], abyValue, abyNull))
+            {
+                return false;
+            }
+            std::vector<uint8_t> abySubValue;
+            std::vector<uint8_t> abySubNull;
+            const bool bAnd = poNode->nOperation == SWQ_AND;
+            for (int j = 1; j < poNode->nSubExprCount; ++j)
+            {
+                if (!Evaluate(poNode->papoSubExpr[j], abySubValue, abySubNull))
+                    return false;
+                for (size_t i = 0; i < m_nLength; ++i)
+                {
+                    abyNull[i] |= abySubNull[i];
+                    if (bAnd)
+                        abyValue[i] &= abySubValue[i];
+                    else
+                        abyValue[i] |= abySubValue[i];
+                }
+            }
+            // AND evaluates to null (and false) as soon as an operand is
+            // null, whereas OR keeps its value.
+            if (bAnd)
+            {
+                for (size_t i = 0; i < m_nLength; ++i)
+                    abyValue[i] &= static_cast<uint8_t>(!abyNull[i]);
+            }
+            return true;
+        }
+
+        case SWQ_NOT:
+        {
+            if (poNode->nSubExprCount != 1 ||
+                !Evaluate(poNode->papoSubExpr[0], abyValue, abyNull))
+            {
+                return false;
+            }
+            for (size_t i = 0; i < m_nLength; ++i)
+            {
+                abyValue[i] =
+                    static_cast<uint8_t>(!abyValue[i] && !abyNull[i]);
+            }
+            return true;
+        }
+
+        case SWQ_ISNULL:
+        {
+            Column sColumn;
+            if (poNode->nSubExprCount != 1 ||
+                !GetColumn(poNode->papoSubExpr[0], sColumn))
+            {
+                return false;
+            }
+            abyValue = std::move(sColumn.abyNull);
+            abyNull.assign(m_nLength, 0);
+            return true;
+        }
+
+        case SWQ_EQ:
+        case SWQ_NE:
+        case SWQ_LT:
+        case SWQ_LE:
+        case SWQ_GT:
+        case SWQ_GE:
+        case SWQ_BETWEEN:
+        case SWQ_IN:
+        case SWQ_LIKE:
+        case SWQ_ILIKE:
+            return EvaluateComparison(poNode, abyValue, abyNull);
+
+        default:
+            break;
+    }
+    return false;
+}
+
+}  // namespace
+
+/************************************************************************/
+/*            FillValidityArrayFromAttrQueryColumnar()                  */
+/************************************************************************/
+
+/** Evaluate the attribute filter column-at-a-time on the Arrow array.
+ *
+ * Returns false if the expression cannot be evaluated that way, in which case
+ * abyValidityFromFilters is left untouched.
+ */
+static bool FillValidityArrayFromAttrQueryColumnar(
+    const OGRLayer *poLayer, OGRFeatureQuery *poAttrQuery,
+    const struct ArrowSchema *schema, const struct ArrowArray *array,
+    std::vector<bool> &abyValidityFromFilters, size_t &nCountIntersecting)
+{
+    if (!CPLTestBool(
+            CPLGetConfigOption("OGR_ARROW_COLUMNAR_ATTR_FILTER", "YES")))
+    {
+        return false;
+    }
+
+    const size_t nLength = abyValidityFromFilters.size();
+    OGRArrowColumnarFilterEvaluator oEvaluator(poLayer, schema, array,
+                                               nLength);
+    std::vector<uint8_t> abyValue;
+    std::vector<uint8_t> abyNull;
+    if (!oEvaluator.Evaluate(
+            static_cast<const swq_expr_node *>(poAttrQuery->GetSWQExpr()),
+            abyValue, abyNull))
+    {
+        return false;
+    }
+
+    nCountIntersecting = 0;
+    for (size_t iRow = 0; iRow < nLength; ++iRow)
+    {
+        if (!abyValidityFromFilters[iRow])
+            continue;
+        if (abyValue[iRow])
+            ++nCountIntersecting;
+        else
+            abyValidityFromFilters[iRow] = false;
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                 FillValidityArrayFromAttrQuery()                     */
 /************************************************************************/
@@ -4688,6 +5391,13 @@ static size_t FillValidityArrayFromAttrQuery(
     std::vector<bool> &abyValidityFromFilters, CSLConstList papszOptions)
 {
     size_t nCountIntersecting = 0;
+    if (FillValidityArrayFromAttrQueryColumnar(poLayer, poAttrQuery, schema,
+                                               array, abyValidityFromFilters,
+                                               nCountIntersecting))
+    {
+        return nCountIntersecting;
+    }
+
     auto poFeatureDefn = const_cast<OGRLayer *>(poLayer)->GetLayerDefn();
     OGRFeature oFeature(poFeatureDefn);
 
@@ -7716,6 +8426,150 @@ bool OGRLayer::WriteArrowBatch(const struct ArrowSchema *schema,
     return bRet;
 }
 
+/************************************************************************/
+/*                  OGRLayer::GetArrowWriteColumns()                    */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+
+/** Determine if a batch passed to WriteArrowBatch() is simple enough to be
+ * written by a native implementation, without going through OGRFeature.
+ *
+ * This is the case if all children of the array are primitive, string,
+ * binary or date32 arrays whose type exactly matches the one of the OGR
+ * field they map to, or a WKB geometry column, or the FID column.
+ *
+ * On success, aoFieldColumns[i] is set for each OGR field i that has a
+ * corresponding Arrow array, oGeomColumn for the geometry column and
+ * oFIDColumn for the FID column (when present).
+ *
+ * When false is returned, the caller should defer to the implementation of
+ * OGRLayer::WriteArrowBatch(), which handles more cases and reports errors.
+ */
+bool OGRLayer::GetArrowWriteColumns(
+    const struct ArrowSchema *schema, struct ArrowArray *array,
+    CSLConstList papszOptions, std::vector<OGRArrowWriteColumn> &aoFieldColumns,
+    OGRArrowWriteColumn &oGeomColumn, OGRArrowWriteColumn &oFIDColumn)
+{
+    if (!IsStructure(schema->format) ||
+        schema->n_children != array->n_children || array->offset != 0 ||
+        array->null_count != 0)
+    {
+        return false;
+    }
+
+    // Such options are only handled by the base implementation
+    if (!EQUAL(CSLFetchNameValueDef(papszOptions, "IF_FID_NOT_PRESERVED",
+                                    "NOTHING"),
+               "NOTHING"))
+    {
+        return false;
+    }
+
+    const auto poLayerDefn = GetLayerDefn();
+    if (poLayerDefn->GetGeomFieldCount() > 1)
+        return false;
+    if (poLayerDefn->GetGeomFieldCount() == 1 &&
+        poLayerDefn->GetGeomFieldDefn(0)
+                ->GetCoordinatePrecision()
+                .dfXYResolution != OGRGeomCoordinatePrecision::UNKNOWN &&
+        CPLTestBool(
+            CPLGetConfigOption("OGR_APPLY_GEOM_SET_PRECISION", "FALSE")))
+    {
+        return false;
+    }
+
+    const char *pszFIDName =
+        CSLFetchNameValueDef(papszOptions, "FID", GetFIDColumn());
+    if (!pszFIDName || pszFIDName[0] == 0)
+        pszFIDName = DEFAULT_ARROW_FID_NAME;
+    const char *pszGeomFieldName = CSLFetchNameValueDef(
+        papszOptions, "GEOMETRY_NAME", GetGeometryColumn());
+    if (!pszGeomFieldName || pszGeomFieldName[0] == 0)
+        pszGeomFieldName = DEFAULT_ARROW_GEOMETRY_NAME;
+
+    aoFieldColumns.clear();
+    aoFieldColumns.resize(poLayerDefn->GetFieldCount());
+    oGeomColumn = OGRArrowWriteColumn();
+    oFIDColumn = OGRArrowWriteColumn();
+
+    const auto &oMapArrowFieldNameToOGRFieldName =
+        m_poPrivate->m_oMapArrowFieldNameToOGRFieldName;
+    for (int64_t i = 0; i < schema->n_children; ++i)
+    {
+        const auto psSchemaChild = schema->children[i];
+        const auto psArrayChild = array->children[i];
+        const char *format = psSchemaChild->format;
+        if (psSchemaChild->dictionary || psSchemaChild->n_children != 0 ||
+            psArrayChild->length < array->length)
+        {
+            return false;
+        }
+        OGRArrowWriteColumn oColumn;
+        oColumn.pszFormat = format;
+        oColumn.psArray = psArrayChild;
+
+        const char *pszName = psSchemaChild->name;
+        if (strcmp(pszName, pszFIDName) == 0)
+        {
+            if (!IsInt32(format) && !IsInt64(format))
+                return false;
+            oFIDColumn = oColumn;
+            continue;
+        }
+
+        const auto oIter = oMapArrowFieldNameToOGRFieldName.find(pszName);
+        const char *pszOGRName =
+            oIter != oMapArrowFieldNameToOGRFieldName.end()
+                ? oIter->second.c_str()
+                : pszName;
+        const int iField = poLayerDefn->GetFieldIndex(pszOGRName);
+        if (iField >= 0)
+        {
+            const auto eType = poLayerDefn->GetFieldDefn(iField)->GetType();
+            const bool bTypeOK =
+                (eType == OFTInteger &&
+                 (IsBoolean(format) || IsInt16(format) || IsInt32(format))) ||
+                (eType == OFTInteger64 && IsInt64(format)) ||
+                (eType == OFTReal &&
+                 (IsFloat32(format) || IsFloat64(format))) ||
+                (eType == OFTString &&
+                 (IsString(format) || IsLargeString(format))) ||
+                (eType == OFTBinary &&
+                 (IsBinary(format) || IsLargeBinary(format))) ||
+                (eType == OFTDate && strcmp(format, "tdD") == 0);
+            if (!bTypeOK || aoFieldColumns[iField].IsSet())
+                return false;
+            aoFieldColumns[iField] = oColumn;
+            continue;
+        }
+
+        bool bIsGeom = poLayerDefn->GetGeomFieldCount() == 1 &&
+                       (poLayerDefn->GetGeomFieldIndex(pszOGRName) == 0 ||
+                        strcmp(pszName, pszGeomFieldName) == 0);
+        if (!bIsGeom && poLayerDefn->GetGeomFieldCount() == 1 &&
+            psSchemaChild->metadata)
+        {
+            const auto oMetadata =
+                OGRParseArrowMetadata(psSchemaChild->metadata);
+            const auto oIterExt = oMetadata.find(ARROW_EXTENSION_NAME_KEY);
+            bIsGeom = oIterExt != oMetadata.end() &&
+                      (oIterExt->second == EXTENSION_NAME_OGC_WKB ||
+                       oIterExt->second == EXTENSION_NAME_GEOARROW_WKB);
+        }
+        if (!bIsGeom || oGeomColumn.IsSet() ||
+            !(IsBinary(format) || IsLargeBinary(format)))
+        {
+            return false;
+        }
+        oGeomColumn = oColumn;
+    }
+
+    return true;
+}
+
+//! @endcond
+
 /************************************************************************/
 /*                      OGR_L_WriteArrowBatch()                         */
 /************************************************************************/
@@ -30,7 +30,11 @@
 #define OGRLAYERARROW_H_DEFINED
 
 #include "cpl_port.h"
+#include "cpl_time.h"
+#include "ogr_core.h"
+#include "ogr_recordbatch.h"
 
+#include <cstdint>
 #include <map>
 #include <string>
 
@@ -47,4 +51,182 @@ bool CPL_DLL OGRCloneArrowArray(const struct ArrowSchema *schema,
                                 const struct ArrowArray *array,
                                 struct ArrowArray *out_array);
 
+/************************************************************************/
+/*                         OGRArrowWriteColumn                          */
+/************************************************************************/
+
+/** Read access to a top-level child of an ArrowArray, for native
+ * implementations of OGRLayer::WriteArrowBatch().
+ *
+ * Only the Arrow formats accepted by OGRLayer::GetArrowWriteColumns() are
+ * handled, that is "b", "s", "i", "l", "f", "g", "u", "U", "z", "Z" and "tdD".
+ */
+struct OGRArrowWriteColumn
+{
+    const char *pszFormat = nullptr;
+    struct ArrowArray *psArray = nullptr;
+
+    /** Whether this column is associated with an array */
+    bool IsSet() const
+    {
+        return psArray != nullptr;
+    }
+
+    /** Whether the value at row iRow is null */
+    bool IsNull(size_t iRow) const
+    {
+        const auto pabyValidity =
+            static_cast<const uint8_t *>(psArray->buffers[0]);
+        if (psArray->null_count == 0 || pabyValidity == nullptr)
+            return false;
+        const size_t nIdx = iRow + static_cast<size_t>(psArray->offset);
+        return (pabyValidity[nIdx / 8] & (1 << (nIdx % 8))) == 0;
+    }
+
+    /** Value of a boolean or integer column */
+    int64_t GetInteger(size_t iRow) const
+    {
+        const size_t nIdx = iRow + static_cast<size_t>(psArray->offset);
+        switch (pszFormat[0])
+        {
+            case 'b':
+            {
+                const auto pabyData =
+                    static_cast<const uint8_t *>(psArray->buffers[1]);
+                return (pabyData[nIdx / 8] & (1 << (nIdx % 8))) != 0;
+            }
+            case 's':
+                return static_cast<const int16_t *>(psArray->buffers[1])[nIdx];
+            case 'i':
+                return static_cast<const int32_t *>(psArray->buffers[1])[nIdx];
+            default:
+                break;
+        }
+        return static_cast<const int64_t *>(psArray->buffers[1])[nIdx];
+    }
+
+    /** Value of a float32 or float64 column */
+    double GetDouble(size_t iRow) const
+    {
+        const size_t nIdx = iRow + static_cast<size_t>(psArray->offset);
+        if (pszFormat[0] == 'f')
+            return static_cast<const float *>(psArray->buffers[1])[nIdx];
+        return static_cast<const double *>(psArray->buffers[1])[nIdx];
+    }
+
+    /** Value of a (large) string or binary column. Strings are not
+     * nul-terminated. */
+    const GByte *GetBytes(size_t iRow, size_t &nLen) const
+    {
+        const size_t nIdx = iRow + static_cast<size_t>(psArray->offset);
+        size_t nStart;
+        if (pszFormat[0] == 'U' || pszFormat[0] == 'Z')
+        {
+            const auto panOffsets =
+                static_cast<const int64_t *>(psArray->buffers[1]);
+            nStart = static_cast<size_t>(panOffsets[nIdx]);
+            nLen = static_cast<size_t>(panOffsets[nIdx + 1]) - nStart;
+        }
+        else
+        {
+            const auto panOffsets =
+                static_cast<const uint32_t *>(psArray->buffers[1]);
+            nStart = panOffsets[nIdx];
+            nLen = panOffsets[nIdx + 1] - nStart;
+        }
+        return static_cast<const GByte *>(psArray->buffers[2]) + nStart;
+    }
+
+    /** Fill a OGRField of type eType (which must be the one of the OGR field
+     * this column is associated with) with the value at row iRow, that must
+     * not be null. For string fields, osTmp is used as the storage of the
+     * nul-terminated string. For binary fields, the value points to the
+     * ArrowArray buffer. */
+    void GetAsOGRField(size_t iRow, OGRFieldType eType, OGRField &sField,
+                       std::string &osTmp) const
+    {
+        switch (eType)
+        {
+            case OFTInteger:
+                sField.Integer = static_cast<int>(GetInteger(iRow));
+                break;
+            case OFTInteger64:
+                sField.Integer64 = GetInteger(iRow);
+                break;
+            case OFTReal:
+                sField.Real = GetDouble(iRow);
+                break;
+            case OFTString:
+            {
+                size_t nLen = 0;
+                const GByte *pabyData = GetBytes(iRow, nLen);
+                osTmp.assign(reinterpret_cast<const char *>(pabyData), nLen);
+                sField.String = &osTmp[0];
+                break;
+            }
+            case OFTBinary:
+            {
+                size_t nLen = 0;
+                sField.Binary.paData =
+                    const_cast<GByte *>(GetBytes(iRow, nLen));
+                sField.Binary.nCount = static_cast<int>(nLen);
+                break;
+            }
+            case OFTDate:
+            {
+                const GIntBig nDays =
+                    static_cast<const int32_t *>(psArray->buffers[1])
+                        [iRow + static_cast<size_t>(psArray->offset)];
+                struct tm brokenDown;
+                CPLUnixTimeToYMDHMS(nDays * 86400, &brokenDown);
+                sField.Date.Year =
+                    static_cast<GInt16>(brokenDown.tm_year + 1900);
+                sField.Date.Month = static_cast<GByte>(brokenDown.tm_mon + 1);
+                sField.Date.Day = static_cast<GByte>(brokenDown.tm_mday);
+                sField.Date.Hour = 0;
+                sField.Date.Minute = 0;
+                sField.Date.Second = 0;
+                sField.Date.TZFlag = 0;
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    /** Set the value at row iRow of a int32 or int64 FID column, with the
+     * FID of the created feature. Returns false if it does not fit into an
+     * int32 column, in which case the value is set to null if possible. */
+    bool SetFID(size_t iRow, GIntBig nFID)
+    {
+        const size_t nIdx = iRow + static_cast<size_t>(psArray->offset);
+        auto pabyValidity =
+            static_cast<uint8_t *>(const_cast<void *>(psArray->buffers[0]));
+        if (pszFormat[0] == 'i' && nFID > INT32_MAX)
+        {
+            if (pabyValidity)
+            {
+                if ((pabyValidity[nIdx / 8] & (1 << (nIdx % 8))) != 0)
+                    ++psArray->null_count;
+                pabyValidity[nIdx / 8] &=
+                    static_cast<uint8_t>(~(1 << (nIdx % 8)));
+            }
+            return false;
+        }
+        if (pabyValidity)
+        {
+            if ((pabyValidity[nIdx / 8] & (1 << (nIdx % 8))) == 0)
+                --psArray->null_count;
+            pabyValidity[nIdx / 8] |= static_cast<uint8_t>(1 << (nIdx % 8));
+        }
+        if (pszFormat[0] == 'i')
+            static_cast<int32_t *>(const_cast<void *>(psArray->buffers[1]))
+                [nIdx] = static_cast<int32_t>(nFID);
+        else
+            static_cast<int64_t *>(const_cast<void *>(psArray->buffers[1]))
+                [nIdx] = nFID;
+        return true;
+    }
+};
+
 #endif  // OGRLAYERARROW_H_DEFINED
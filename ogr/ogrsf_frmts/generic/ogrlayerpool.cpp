@@ -89,15 +89,25 @@ void OGRLayerPool::SetLastUsedLayer(OGRAbstractProxiedLayer *poLayer)
         /* Remove current layer from its current place in the list */
         UnchainLayer(poLayer);
     }
-    else if (nMRUListSize == nMaxSimultaneouslyOpened)
+    else
     {
         /* If we have reached the maximum allowed number of layers */
         /* simultaneously opened, then close the LRU one that */
-        /* was still active until now */
-        CPLAssert(poLRULayer != nullptr);
-
-        poLRULayer->CloseUnderlyingLayer();
-        UnchainLayer(poLRULayer);
+        /* was still active until now, and is not pinned. If all are */
+        /* pinned, temporarily exceed the maximum. */
+        while (nMRUListSize >= nMaxSimultaneouslyOpened)
+        {
+            CPLAssert(poLRULayer != nullptr);
+
+            OGRAbstractProxiedLayer *poLayerToClose = poLRULayer;
+            while (poLayerToClose != nullptr && poLayerToClose->nPinCount > 0)
+                poLayerToClose = poLayerToClose->poPrevLayer;
+            if (poLayerToClose == nullptr)
+                break;
+
+            poLayerToClose->CloseUnderlyingLayer();
+            UnchainLayer(poLayerToClose);
+        }
     }
 
     /* Put current layer on top of MRU list */
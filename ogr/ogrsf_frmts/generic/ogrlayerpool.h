@@ -54,6 +54,8 @@ class CPL_DLL OGRAbstractProxiedLayer : public OGRLayer
     OGRAbstractProxiedLayer
         *poNextLayer; /* Chain to a layer that was used less recently */
 
+    int nPinCount = 0; /* Number of Pin() calls not balanced by Unpin() */
+
   protected:
     OGRLayerPool *poPool;
 
@@ -62,6 +64,19 @@ class CPL_DLL OGRAbstractProxiedLayer : public OGRLayer
   public:
     explicit OGRAbstractProxiedLayer(OGRLayerPool *poPool);
     virtual ~OGRAbstractProxiedLayer();
+
+    /* Prevent the pool from closing the underlying layer, e.g. while it */
+    /* is read by another thread. */
+    void Pin()
+    {
+        nPinCount++;
+    }
+
+    void Unpin()
+    {
+        CPLAssert(nPinCount > 0);
+        nPinCount--;
+    }
 };
 
 /************************************************************************/
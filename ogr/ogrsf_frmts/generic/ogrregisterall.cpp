@@ -83,8 +83,13 @@ void OGRRegisterAllInternal()
     RegisterOGRGPX();
 #endif
 #ifdef LIBKML_ENABLED
+#ifdef DEFERRED_BUILTIN_LIBKML_DRIVER
+    GetGDALDriverManager()->DeclareDeferredBuiltinDriver(
+        DeclareDeferredOGRLIBKMLPlugin, RegisterOGRLIBKML);
+#else
     RegisterOGRLIBKML();
 #endif
+#endif
 #ifdef KML_ENABLED
     RegisterOGRKML();
 #endif
@@ -108,8 +113,13 @@ void OGRRegisterAllInternal()
     RegisterOGRSQLite();
 #endif
 #ifdef ODBC_ENABLED
+#ifdef DEFERRED_BUILTIN_ODBC_DRIVER
+    GetGDALDriverManager()->DeclareDeferredBuiltinDriver(
+        DeclareDeferredOGRODBCPlugin, RegisterOGRODBC);
+#else
     RegisterOGRODBC();
 #endif
+#endif
 #ifdef WASP_ENABLED
     RegisterOGRWAsP();
 #endif
@@ -117,24 +127,54 @@ void OGRRegisterAllInternal()
     RegisterOGRPGeo();
 #endif
 #ifdef MSSQLSPATIAL_ENABLED
+#ifdef DEFERRED_BUILTIN_MSSQLSPATIAL_DRIVER
+    GetGDALDriverManager()->DeclareDeferredBuiltinDriver(
+        DeclareDeferredOGRMSSQLSpatialPlugin, RegisterOGRMSSQLSpatial);
+#else
     RegisterOGRMSSQLSpatial();
 #endif
+#endif
 #ifdef OGDI_ENABLED
+#ifdef DEFERRED_BUILTIN_OGDI_DRIVER
+    GetGDALDriverManager()->DeclareDeferredBuiltinDriver(
+        DeclareDeferredOGROGDIPlugin, RegisterOGROGDI);
+#else
     RegisterOGROGDI();
 #endif
+#endif
 #ifdef PG_ENABLED
+#ifdef DEFERRED_BUILTIN_PG_DRIVER
+    GetGDALDriverManager()->DeclareDeferredBuiltinDriver(
+        DeclareDeferredOGRPGPlugin, RegisterOGRPG);
+#else
     RegisterOGRPG();
 #endif
+#endif
 #ifdef MYSQL_ENABLED
+#ifdef DEFERRED_BUILTIN_MYSQL_DRIVER
+    GetGDALDriverManager()->DeclareDeferredBuiltinDriver(
+        DeclareDeferredOGRMySQLPlugin, RegisterOGRMySQL);
+#else
     RegisterOGRMySQL();
 #endif
+#endif
 #ifdef OCI_ENABLED
+#ifdef DEFERRED_BUILTIN_OCI_DRIVER
+    GetGDALDriverManager()->DeclareDeferredBuiltinDriver(
+        DeclareDeferredOGROCIPlugin, RegisterOGROCI);
+#else
     RegisterOGROCI();
 #endif
+#endif
 /* Register OpenFileGDB before FGDB as it is more capable for read-only */
 #ifdef OPENFILEGDB_ENABLED
+#ifdef DEFERRED_BUILTIN_OPENFILEGDB_DRIVER
+    GetGDALDriverManager()->DeclareDeferredBuiltinDriver(
+        DeclareDeferredOGROpenFileGDBPlugin, RegisterOGROpenFileGDB);
+#else
     RegisterOGROpenFileGDB();
 #endif
+#endif
 #ifdef FGDB_ENABLED
     RegisterOGRFileGDB();
 #endif
@@ -148,14 +188,24 @@ void OGRRegisterAllInternal()
     RegisterOGRDXF();
 #endif
 #ifdef CAD_ENABLED
+#ifdef DEFERRED_BUILTIN_CAD_DRIVER
+    GetGDALDriverManager()->DeclareDeferredBuiltinDriver(
+        DeclareDeferredOGRCADPlugin, RegisterOGRCAD);
+#else
     RegisterOGRCAD();
 #endif
+#endif
 #ifdef FLATGEOBUF_ENABLED
     RegisterOGRFlatGeobuf();
 #endif
 #ifdef IDB_ENABLED
+#ifdef DEFERRED_BUILTIN_IDB_DRIVER
+    GetGDALDriverManager()->DeclareDeferredBuiltinDriver(
+        DeclareDeferredOGRIDBPlugin, RegisterOGRIDB);
+#else
     RegisterOGRIDB();
 #endif
+#endif
 #ifdef GEOCONCEPT_ENABLED
     RegisterOGRGeoconcept();
 #endif
@@ -163,8 +213,13 @@ void OGRRegisterAllInternal()
     RegisterOGRGeoRSS();
 #endif
 #ifdef VFK_ENABLED
+#ifdef DEFERRED_BUILTIN_VFK_DRIVER
+    GetGDALDriverManager()->DeclareDeferredBuiltinDriver(
+        DeclareDeferredOGRVFKPlugin, RegisterOGRVFK);
+#else
     RegisterOGRVFK();
 #endif
+#endif
 #ifdef PGDUMP_ENABLED
     RegisterOGRPGDump();
 #endif
@@ -183,8 +238,13 @@ void OGRRegisterAllInternal()
     RegisterOGROAPIF();
 #endif
 #ifdef SOSI_ENABLED
+#ifdef DEFERRED_BUILTIN_SOSI_DRIVER
+    GetGDALDriverManager()->DeclareDeferredBuiltinDriver(
+        DeclareDeferredOGRSOSIPlugin, RegisterOGRSOSI);
+#else
     RegisterOGRSOSI();
 #endif
+#endif
 #ifdef EDIGEO_ENABLED
     RegisterOGREDIGEO();
 #endif
@@ -195,8 +255,13 @@ void OGRRegisterAllInternal()
     RegisterOGRIdrisi();
 #endif
 #ifdef XLS_ENABLED
+#ifdef DEFERRED_BUILTIN_XLS_DRIVER
+    GetGDALDriverManager()->DeclareDeferredBuiltinDriver(
+        DeclareDeferredOGRXLSPlugin, RegisterOGRXLS);
+#else
     RegisterOGRXLS();
 #endif
+#endif
 #ifdef ODS_ENABLED
     RegisterOGRODS();
 #endif
@@ -204,11 +269,21 @@ void OGRRegisterAllInternal()
     RegisterOGRXLSX();
 #endif
 #ifdef ELASTIC_ENABLED
+#ifdef DEFERRED_BUILTIN_ELASTIC_DRIVER
+    GetGDALDriverManager()->DeclareDeferredBuiltinDriver(
+        DeclareDeferredOGRElasticPlugin, RegisterOGRElastic);
+#else
     RegisterOGRElastic();
 #endif
+#endif
 #ifdef CARTO_ENABLED
+#ifdef DEFERRED_BUILTIN_CARTO_DRIVER
+    GetGDALDriverManager()->DeclareDeferredBuiltinDriver(
+        DeclareDeferredOGRCartoPlugin, RegisterOGRCarto);
+#else
     RegisterOGRCarto();
 #endif
+#endif
 #ifdef AMIGOCLOUD_ENABLED
     RegisterOGRAmigoCloud();
 #endif
@@ -222,20 +297,35 @@ void OGRRegisterAllInternal()
     RegisterOGRJML();
 #endif
 #ifdef PLSCENES_ENABLED
+#ifdef DEFERRED_BUILTIN_PLSCENES_DRIVER
+    GetGDALDriverManager()->DeclareDeferredBuiltinDriver(
+        DeclareDeferredOGRPLSCENESPlugin, RegisterOGRPLSCENES);
+#else
     RegisterOGRPLSCENES();
 #endif
+#endif
 #ifdef CSW_ENABLED
     RegisterOGRCSW();
 #endif
 #ifdef MONGODBV3_ENABLED
+#ifdef DEFERRED_BUILTIN_MONGODBV3_DRIVER
+    GetGDALDriverManager()->DeclareDeferredBuiltinDriver(
+        DeclareDeferredOGRMongoDBv3Plugin, RegisterOGRMongoDBv3);
+#else
     RegisterOGRMongoDBv3();
 #endif
+#endif
 #ifdef VDV_ENABLED
     RegisterOGRVDV();
 #endif
 #ifdef GMLAS_ENABLED
+#ifdef DEFERRED_BUILTIN_GMLAS_DRIVER
+    GetGDALDriverManager()->DeclareDeferredBuiltinDriver(
+        DeclareDeferredOGRGMLASPlugin, RegisterOGRGMLAS);
+#else
     RegisterOGRGMLAS();
 #endif
+#endif
 #ifdef MVT_ENABLED
     RegisterOGRMVT();
 #endif
@@ -246,14 +336,29 @@ void OGRRegisterAllInternal()
     RegisterOGRMapML();
 #endif
 #ifdef HANA_ENABLED
+#ifdef DEFERRED_BUILTIN_HANA_DRIVER
+    GetGDALDriverManager()->DeclareDeferredBuiltinDriver(
+        DeclareDeferredOGRHANAPlugin, RegisterOGRHANA);
+#else
     RegisterOGRHANA();
 #endif
+#endif
 #ifdef PARQUET_ENABLED
+#ifdef DEFERRED_BUILTIN_PARQUET_DRIVER
+    GetGDALDriverManager()->DeclareDeferredBuiltinDriver(
+        DeclareDeferredOGRParquetPlugin, RegisterOGRParquet);
+#else
     RegisterOGRParquet();
 #endif
+#endif
 #ifdef ARROW_ENABLED
+#ifdef DEFERRED_BUILTIN_ARROW_DRIVER
+    GetGDALDriverManager()->DeclareDeferredBuiltinDriver(
+        DeclareDeferredOGRArrowPlugin, RegisterOGRArrow);
+#else
     RegisterOGRArrow();
 #endif
+#endif
 #ifdef GTFS_ENABLED
     RegisterOGRGTFS();
 #endif
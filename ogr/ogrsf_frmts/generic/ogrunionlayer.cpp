@@ -29,9 +29,183 @@
 #ifndef DOXYGEN_SKIP
 
 #include "ogrunionlayer.h"
+#include "ogrlayerpool.h"
 #include "ogrwarpedlayer.h"
 #include "ogr_p.h"
 
+#include "cpl_error_internal.h"
+#include "cpl_worker_thread_pool.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+/************************************************************************/
+/*                     OGRUnionLayerParallelReader                      */
+/************************************************************************/
+
+// Maximum number of features read ahead for a source layer
+constexpr size_t UNION_MAX_QUEUED_FEATURES = 256;
+
+struct OGRUnionLayerSourceReader
+{
+    OGRUnionLayerParallelReader *poParent = nullptr;
+    int iSrcLayer = 0;
+    OGRLayer *poSrcLayer = nullptr;
+    // Pinned in its layer pool while it is read
+    OGRAbstractProxiedLayer *poPinnedLayer = nullptr;
+    std::vector<int> anMap{};
+
+    // Protected by poParent->oMutex
+    std::deque<std::unique_ptr<OGRFeature>> apoFeatures{};
+    bool bFinished = false;
+    bool bJobRunning = false;
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+};
+
+// Reads several source layers at once, each one by jobs of a private
+// thread pool (so that source layers can use the global thread pool
+// without risking a deadlock), while the features are translated and
+// filtered by the thread calling GetNextFeature().
+struct OGRUnionLayerParallelReader
+{
+    std::unique_ptr<CPLWorkerThreadPool> poPool{};
+    std::mutex oMutex{};
+    std::condition_variable oCV{};
+    bool bStop = false;
+    int nPauseCount = 0;
+    int nNextSrcLayer = 0;
+    // Source layers being read, in the order of the union
+    std::deque<std::unique_ptr<OGRUnionLayerSourceReader>> apoSources{};
+
+    bool SubmitIfNeeded(OGRUnionLayerSourceReader *poSource);
+    void WaitForIdleJobs(std::unique_lock<std::mutex> &oLock);
+};
+
+/************************************************************************/
+/*                     OGRUnionLayerReadSourceJob()                     */
+/************************************************************************/
+
+static void OGRUnionLayerReadSourceJob(void *pData)
+{
+    auto poSource = static_cast<OGRUnionLayerSourceReader *>(pData);
+    auto poParent = poSource->poParent;
+
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors;
+    CPLInstallErrorHandlerAccumulator(aoErrors);
+    bool bFinished = false;
+    while (true)
+    {
+        {
+            std::lock_guard<std::mutex> oLock(poParent->oMutex);
+            if (poParent->bStop || poParent->nPauseCount > 0 ||
+                poSource->apoFeatures.size() >= UNION_MAX_QUEUED_FEATURES)
+            {
+                break;
+            }
+        }
+
+        std::unique_ptr<OGRFeature> poFeature(
+            poSource->poSrcLayer->GetNextFeature());
+
+        std::lock_guard<std::mutex> oLock(poParent->oMutex);
+        if (!poFeature)
+        {
+            bFinished = true;
+            break;
+        }
+        poSource->apoFeatures.push_back(std::move(poFeature));
+        poParent->oCV.notify_all();
+    }
+    CPLUninstallErrorHandlerAccumulator();
+
+    std::lock_guard<std::mutex> oLock(poParent->oMutex);
+    poSource->aoErrors.insert(poSource->aoErrors.end(), aoErrors.begin(),
+                              aoErrors.end());
+    if (bFinished)
+        poSource->bFinished = true;
+    poSource->bJobRunning = false;
+    poParent->oCV.notify_all();
+}
+
+/************************************************************************/
+/*                           SubmitIfNeeded()                           */
+/*                                                                      */
+/*      Must be called with oMutex held. Returns whether a job is       */
+/*      running for the source layer.                                   */
+/************************************************************************/
+
+bool OGRUnionLayerParallelReader::SubmitIfNeeded(
+    OGRUnionLayerSourceReader *poSource)
+{
+    if (!poSource->bJobRunning && !poSource->bFinished && !bStop &&
+        nPauseCount == 0 &&
+        poSource->apoFeatures.size() <= UNION_MAX_QUEUED_FEATURES / 2)
+    {
+        poSource->bJobRunning = true;
+        if (!poPool->SubmitJob(OGRUnionLayerReadSourceJob, poSource))
+        {
+            poSource->bJobRunning = false;
+            poSource->bFinished = true;
+            poSource->aoErrors.emplace_back(CE_Failure, CPLE_AppDefined,
+                                            "Cannot submit read job");
+        }
+    }
+    return poSource->bJobRunning;
+}
+
+/************************************************************************/
+/*                          WaitForIdleJobs()                           */
+/************************************************************************/
+
+void OGRUnionLayerParallelReader::WaitForIdleJobs(
+    std::unique_lock<std::mutex> &oLock)
+{
+    while (std::any_of(apoSources.begin(), apoSources.end(),
+                       [](const std::unique_ptr<OGRUnionLayerSourceReader> &p)
+                       { return p->bJobRunning; }))
+    {
+        oCV.wait(oLock);
+    }
+}
+
+/************************************************************************/
+/*                 OGRUnionLayerParallelReadingPauser                   */
+/*                                                                      */
+/*      Suspends the reading jobs while source layers are accessed by   */
+/*      the calling thread, without changing the reading position.      */
+/************************************************************************/
+
+class OGRUnionLayerParallelReadingPauser
+{
+    OGRUnionLayerParallelReader *m_poReader;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRUnionLayerParallelReadingPauser)
+
+  public:
+    explicit OGRUnionLayerParallelReadingPauser(
+        OGRUnionLayerParallelReader *poReader)
+        : m_poReader(poReader)
+    {
+        if (m_poReader)
+        {
+            std::unique_lock<std::mutex> oLock(m_poReader->oMutex);
+            m_poReader->nPauseCount++;
+            m_poReader->WaitForIdleJobs(oLock);
+        }
+    }
+
+    ~OGRUnionLayerParallelReadingPauser()
+    {
+        if (m_poReader)
+        {
+            std::lock_guard<std::mutex> oLock(m_poReader->oMutex);
+            m_poReader->nPauseCount--;
+        }
+    }
+};
+
 /************************************************************************/
 /*                      OGRUnionLayerGeomFieldDefn()                    */
 /************************************************************************/
@@ -86,7 +260,7 @@ OGRUnionLayer::OGRUnionLayer(const char *pszName, int nSrcLayersIn,
       nFields(0), papoFields(nullptr), nGeomFields(0), papoGeomFields(nullptr),
       eFieldStrategy(FIELD_UNION_ALL_LAYERS), bPreserveSrcFID(FALSE),
       nFeatureCount(-1), iCurLayer(-1), pszAttributeFilter(nullptr),
-      nNextFID(0), panMap(nullptr), bAttrFilterPassThroughValue(-1),
+      nNextFID(0), bAttrFilterPassThroughValue(-1),
       pabModifiedLayers(static_cast<int *>(CPLCalloc(sizeof(int), nSrcLayers))),
       pabCheckIfAutoWrap(
           static_cast<int *>(CPLCalloc(sizeof(int), nSrcLayers))),
@@ -103,6 +277,9 @@ OGRUnionLayer::OGRUnionLayer(const char *pszName, int nSrcLayersIn,
 
 OGRUnionLayer::~OGRUnionLayer()
 {
+    StopParallelReading();
+    m_poParallelReader.reset();
+
     if (bHasLayerOwnership)
     {
         for (int i = 0; i < nSrcLayers; i++)
@@ -118,7 +295,6 @@ OGRUnionLayer::~OGRUnionLayer()
     CPLFree(papoGeomFields);
 
     CPLFree(pszAttributeFilter);
-    CPLFree(panMap);
     CPLFree(pabModifiedLayers);
     CPLFree(pabCheckIfAutoWrap);
 
@@ -195,6 +371,39 @@ void OGRUnionLayer::SetFeatureCount(int nFeatureCountIn)
     nFeatureCount = nFeatureCountIn;
 }
 
+/************************************************************************/
+/*                        SetSourceLayerExtent()                        */
+/************************************************************************/
+
+/* Declares the extent of the geometry field iGeomField (index in the */
+/* union layer) of a source layer, expressed in the SRS of the union */
+/* layer. Source layers whose extent does not intersect the spatial */
+/* filter are skipped without being accessed. */
+void OGRUnionLayer::SetSourceLayerExtent(int iSrcLayer, int iGeomField,
+                                         const OGREnvelope &sExtent)
+{
+    CPLAssert(iSrcLayer >= 0 && iSrcLayer < nSrcLayers);
+
+    m_oMapSrcLayerExtents[std::make_pair(iSrcLayer, iGeomField)] = sExtent;
+}
+
+/************************************************************************/
+/*                         SetParallelReading()                         */
+/************************************************************************/
+
+/* Reads up to nThreads source layers at once in GetNextFeature(). If */
+/* bPreserveOrder is false, features are returned as soon as they are */
+/* read, whatever their source layer. */
+/* The source layers must not share a dataset. */
+void OGRUnionLayer::SetParallelReading(int nThreads, bool bPreserveOrder)
+{
+    CPLAssert(poFeatureDefn == nullptr);
+
+    m_nParallelReadingThreads = std::max(1, nThreads);
+    m_bParallelReadingPreserveOrder = bPreserveOrder;
+    m_nCanReadInParallel = -1;
+}
+
 /************************************************************************/
 /*                         MergeFieldDefn()                             */
 /************************************************************************/
@@ -506,32 +715,40 @@ void OGRUnionLayer::SetSpatialFilterToSourceLayer(OGRLayer *poSrcLayer)
 
 void OGRUnionLayer::ConfigureActiveLayer()
 {
-    AutoWarpLayerIfNecessary(iCurLayer);
-    ApplyAttributeFilterToSrcLayer(iCurLayer);
-    SetSpatialFilterToSourceLayer(papoSrcLayers[iCurLayer]);
-    papoSrcLayers[iCurLayer]->ResetReading();
+    ConfigureSourceLayer(iCurLayer, m_anMap);
+}
+
+/************************************************************************/
+/*                        ConfigureSourceLayer()                        */
+/************************************************************************/
+
+void OGRUnionLayer::ConfigureSourceLayer(int iSrcLayer,
+                                         std::vector<int> &anMap)
+{
+    AutoWarpLayerIfNecessary(iSrcLayer);
+    ApplyAttributeFilterToSrcLayer(iSrcLayer);
+    SetSpatialFilterToSourceLayer(papoSrcLayers[iSrcLayer]);
+    papoSrcLayers[iSrcLayer]->ResetReading();
 
     /* Establish map */
     GetLayerDefn();
-    OGRFeatureDefn *poSrcFeatureDefn = papoSrcLayers[iCurLayer]->GetLayerDefn();
-    CPLFree(panMap);
-    panMap = static_cast<int *>(
-        CPLMalloc(poSrcFeatureDefn->GetFieldCount() * sizeof(int)));
+    OGRFeatureDefn *poSrcFeatureDefn = papoSrcLayers[iSrcLayer]->GetLayerDefn();
+    anMap.resize(poSrcFeatureDefn->GetFieldCount());
     for (int i = 0; i < poSrcFeatureDefn->GetFieldCount(); i++)
     {
         OGRFieldDefn *poSrcFieldDefn = poSrcFeatureDefn->GetFieldDefn(i);
         if (m_aosIgnoredFields.FindString(poSrcFieldDefn->GetNameRef()) == -1)
         {
-            panMap[i] =
+            anMap[i] =
                 poFeatureDefn->GetFieldIndex(poSrcFieldDefn->GetNameRef());
         }
         else
         {
-            panMap[i] = -1;
+            anMap[i] = -1;
         }
     }
 
-    if (papoSrcLayers[iCurLayer]->TestCapability(OLCIgnoreFields))
+    if (papoSrcLayers[iSrcLayer]->TestCapability(OLCIgnoreFields))
     {
         CPLStringList aosFieldSrc;
         for (const char *pszFieldName : cpl::Iterate(m_aosIgnoredFields))
@@ -591,7 +808,7 @@ void OGRUnionLayer::ConfigureActiveLayer()
             }
         }
 
-        papoSrcLayers[iCurLayer]->SetIgnoredFields(aosFieldSrc.List());
+        papoSrcLayers[iSrcLayer]->SetIgnoredFields(aosFieldSrc.List());
     }
 }
 
@@ -601,8 +818,13 @@ void OGRUnionLayer::ConfigureActiveLayer()
 
 void OGRUnionLayer::ResetReading()
 {
+    StopParallelReading();
+
     iCurLayer = 0;
-    ConfigureActiveLayer();
+    while (iCurLayer < nSrcLayers && !SourceLayerIntersectsFilter(iCurLayer))
+        iCurLayer++;
+    if (iCurLayer < nSrcLayers)
+        ConfigureActiveLayer();
     nNextFID = 0;
 }
 
@@ -684,6 +906,9 @@ OGRFeature *OGRUnionLayer::GetNextFeature()
     if (iCurLayer < 0)
         ResetReading();
 
+    if (CanReadInParallel())
+        return GetNextFeatureParallel();
+
     if (iCurLayer == nSrcLayers)
         return nullptr;
 
@@ -693,6 +918,11 @@ OGRFeature *OGRUnionLayer::GetNextFeature()
         if (poSrcFeature == nullptr)
         {
             iCurLayer++;
+            while (iCurLayer < nSrcLayers &&
+                   !SourceLayerIntersectsFilter(iCurLayer))
+            {
+                iCurLayer++;
+            }
             if (iCurLayer < nSrcLayers)
             {
                 ConfigureActiveLayer();
@@ -702,7 +932,8 @@ OGRFeature *OGRUnionLayer::GetNextFeature()
                 break;
         }
 
-        OGRFeature *poFeature = TranslateFromSrcLayer(poSrcFeature);
+        OGRFeature *poFeature =
+            TranslateFromSrcLayer(poSrcFeature, iCurLayer, m_anMap.data());
         delete poSrcFeature;
 
         if ((m_poFilterGeom == nullptr ||
@@ -723,6 +954,8 @@ OGRFeature *OGRUnionLayer::GetNextFeature()
 
 OGRFeature *OGRUnionLayer::GetFeature(GIntBig nFeatureId)
 {
+    StopParallelReading();
+
     OGRFeature *poFeature = nullptr;
 
     if (!bPreserveSrcFID)
@@ -744,7 +977,8 @@ OGRFeature *OGRUnionLayer::GetFeature(GIntBig nFeatureId)
             OGRFeature *poSrcFeature = papoSrcLayers[i]->GetFeature(nFeatureId);
             if (poSrcFeature != nullptr)
             {
-                poFeature = TranslateFromSrcLayer(poSrcFeature);
+                poFeature = TranslateFromSrcLayer(poSrcFeature, i,
+                                                  m_anMap.data());
                 delete poSrcFeature;
 
                 break;
@@ -766,6 +1000,8 @@ OGRFeature *OGRUnionLayer::GetFeature(GIntBig nFeatureId)
 
 OGRErr OGRUnionLayer::ICreateFeature(OGRFeature *poFeature)
 {
+    StopParallelReading();
+
     if (osSourceLayerFieldName.empty())
     {
         CPLError(CE_Failure, CPLE_NotSupported,
@@ -795,6 +1031,7 @@ OGRErr OGRUnionLayer::ICreateFeature(OGRFeature *poFeature)
         if (strcmp(pszSrcLayerName, papoSrcLayers[i]->GetName()) == 0)
         {
             pabModifiedLayers[i] = TRUE;
+            InvalidateSourceLayerExtents(i);
 
             OGRFeature *poSrcFeature =
                 new OGRFeature(papoSrcLayers[i]->GetLayerDefn());
@@ -819,6 +1056,8 @@ OGRErr OGRUnionLayer::ICreateFeature(OGRFeature *poFeature)
 
 OGRErr OGRUnionLayer::ISetFeature(OGRFeature *poFeature)
 {
+    StopParallelReading();
+
     if (!bPreserveSrcFID)
     {
         CPLError(CE_Failure, CPLE_NotSupported,
@@ -855,6 +1094,7 @@ OGRErr OGRUnionLayer::ISetFeature(OGRFeature *poFeature)
         if (strcmp(pszSrcLayerName, papoSrcLayers[i]->GetName()) == 0)
         {
             pabModifiedLayers[i] = TRUE;
+            InvalidateSourceLayerExtents(i);
 
             OGRFeature *poSrcFeature =
                 new OGRFeature(papoSrcLayers[i]->GetLayerDefn());
@@ -899,6 +1139,8 @@ OGRErr OGRUnionLayer::IUpdateFeature(OGRFeature *poFeature,
                                      const int *panUpdatedGeomFieldsIdx,
                                      bool bUpdateStyleString)
 {
+    StopParallelReading();
+
     if (!bPreserveSrcFID)
     {
         CPLError(CE_Failure, CPLE_NotSupported,
@@ -935,6 +1177,7 @@ OGRErr OGRUnionLayer::IUpdateFeature(OGRFeature *poFeature,
         if (strcmp(pszSrcLayerName, papoSrcLayers[i]->GetName()) == 0)
         {
             pabModifiedLayers[i] = TRUE;
+            InvalidateSourceLayerExtents(i);
 
             const auto poSrcLayerDefn = papoSrcLayers[i]->GetLayerDefn();
             OGRFeature *poSrcFeature = new OGRFeature(poSrcLayerDefn);
@@ -1084,12 +1327,16 @@ GIntBig OGRUnionLayer::GetFeatureCount(int bForce)
         return nFeatureCount;
     }
 
+    StopParallelReading();
+
     if (!GetAttrFilterPassThroughValue())
         return OGRLayer::GetFeatureCount(bForce);
 
     GIntBig nRet = 0;
     for (int i = 0; i < nSrcLayers; i++)
     {
+        if (!SourceLayerIntersectsFilter(i))
+            continue;
         AutoWarpLayerIfNecessary(i);
         ApplyAttributeFilterToSrcLayer(i);
         SetSpatialFilterToSourceLayer(papoSrcLayers[i]);
@@ -1114,6 +1361,8 @@ OGRErr OGRUnionLayer::SetAttributeFilter(const char *pszAttributeFilterIn)
     if (poFeatureDefn == nullptr)
         GetLayerDefn();
 
+    StopParallelReading();
+
     bAttrFilterPassThroughValue = -1;
 
     OGRErr eErr = OGRLayer::SetAttributeFilter(pszAttributeFilterIn);
@@ -1136,6 +1385,8 @@ OGRErr OGRUnionLayer::SetAttributeFilter(const char *pszAttributeFilterIn)
 
 int OGRUnionLayer::TestCapability(const char *pszCap)
 {
+    OGRUnionLayerParallelReadingPauser oPauser(m_poParallelReader.get());
+
     if (EQUAL(pszCap, OLCFastFeatureCount))
     {
         if (nFeatureCount >= 0 && m_poFilterGeom == nullptr &&
@@ -1264,29 +1515,43 @@ OGRErr OGRUnionLayer::GetExtent(int iGeomField, OGREnvelope *psExtent,
         return OGRERR_FAILURE;
     }
 
+    OGRUnionLayerParallelReadingPauser oPauser(m_poParallelReader.get());
+
     int bInit = FALSE;
     for (int i = 0; i < nSrcLayers; i++)
     {
-        AutoWarpLayerIfNecessary(i);
-        int iSrcGeomField = papoSrcLayers[i]->GetLayerDefn()->GetGeomFieldIndex(
-            GetLayerDefn()->GetGeomFieldDefn(iGeomField)->GetNameRef());
-        if (iSrcGeomField >= 0)
+        // Use the cached extent of the source layer if available, so as
+        // not to access it.
+        OGREnvelope sExtent;
+        const auto oKey = std::make_pair(i, iGeomField);
+        const auto oIter = m_oMapSrcLayerExtents.find(oKey);
+        if (oIter != m_oMapSrcLayerExtents.end())
         {
-            if (!bInit)
-            {
-                if (papoSrcLayers[i]->GetExtent(iSrcGeomField, psExtent,
-                                                bForce) == OGRERR_NONE)
-                    bInit = TRUE;
-            }
-            else
+            sExtent = oIter->second;
+        }
+        else
+        {
+            AutoWarpLayerIfNecessary(i);
+            int iSrcGeomField =
+                papoSrcLayers[i]->GetLayerDefn()->GetGeomFieldIndex(
+                    GetLayerDefn()->GetGeomFieldDefn(iGeomField)->GetNameRef());
+            if (iSrcGeomField < 0 ||
+                papoSrcLayers[i]->GetExtent(iSrcGeomField, &sExtent,
+                                            bForce) != OGRERR_NONE)
             {
-                OGREnvelope sExtent;
-                if (papoSrcLayers[i]->GetExtent(iSrcGeomField, &sExtent,
-                                                bForce) == OGRERR_NONE)
-                {
-                    psExtent->Merge(sExtent);
-                }
+                continue;
             }
+            m_oMapSrcLayerExtents[oKey] = sExtent;
+        }
+
+        if (!bInit)
+        {
+            *psExtent = sExtent;
+            bInit = TRUE;
+        }
+        else
+        {
+            psExtent->Merge(sExtent);
         }
     }
     return (bInit) ? OGRERR_NONE : OGRERR_FAILURE;
@@ -1326,6 +1591,8 @@ void OGRUnionLayer::SetSpatialFilter(int iGeomField, OGRGeometry *poGeom)
         }
     }
 
+    StopParallelReading();
+
     m_iGeomFieldFilter = iGeomField;
     if (InstallFilter(poGeom))
         ResetReading();
@@ -1336,14 +1603,238 @@ void OGRUnionLayer::SetSpatialFilter(int iGeomField, OGRGeometry *poGeom)
     }
 }
 
+/************************************************************************/
+/*                    SourceLayerIntersectsFilter()                     */
+/*                                                                      */
+/*      Returns false if the known extent of the source layer does not  */
+/*      intersect the spatial filter.                                   */
+/************************************************************************/
+
+bool OGRUnionLayer::SourceLayerIntersectsFilter(int iSrcLayer) const
+{
+    if (m_poFilterGeom == nullptr)
+        return true;
+    const auto oIter = m_oMapSrcLayerExtents.find(
+        std::make_pair(iSrcLayer, m_iGeomFieldFilter));
+    return oIter == m_oMapSrcLayerExtents.end() ||
+           oIter->second.Intersects(m_sFilterEnvelope);
+}
+
+/************************************************************************/
+/*                   InvalidateSourceLayerExtents()                     */
+/************************************************************************/
+
+void OGRUnionLayer::InvalidateSourceLayerExtents(int iSrcLayer)
+{
+    for (auto oIter = m_oMapSrcLayerExtents.begin();
+         oIter != m_oMapSrcLayerExtents.end();)
+    {
+        if (oIter->first.first == iSrcLayer)
+            oIter = m_oMapSrcLayerExtents.erase(oIter);
+        else
+            ++oIter;
+    }
+}
+
+/************************************************************************/
+/*                         CanReadInParallel()                          */
+/************************************************************************/
+
+bool OGRUnionLayer::CanReadInParallel()
+{
+    if (m_nCanReadInParallel < 0)
+    {
+        m_nCanReadInParallel = m_nParallelReadingThreads > 1;
+        for (int i = 0; m_nCanReadInParallel && i < nSrcLayers; i++)
+        {
+            OGRLayer *poLayer = papoSrcLayers[i];
+            while (auto poDecorator =
+                       dynamic_cast<OGRLayerDecorator *>(poLayer))
+                poLayer = poDecorator->GetBaseLayer();
+
+            // Union layers, and pooled layers other than OGRProxiedLayer
+            // (which only uses its pool when opening), may open or close
+            // other layers while being read.
+            if (dynamic_cast<OGRUnionLayer *>(poLayer) ||
+                (dynamic_cast<OGRAbstractProxiedLayer *>(poLayer) &&
+                 !dynamic_cast<OGRProxiedLayer *>(poLayer)))
+            {
+                CPLDebug("UNION",
+                         "%s: source layer %s cannot be read in a worker "
+                         "thread. Disabling parallel reading",
+                         GetName(), poLayer->GetName());
+                m_nCanReadInParallel = FALSE;
+            }
+        }
+
+        if (m_nCanReadInParallel)
+        {
+            auto poReader = std::make_unique<OGRUnionLayerParallelReader>();
+            poReader->poPool = std::make_unique<CPLWorkerThreadPool>();
+            if (poReader->poPool->Setup(m_nParallelReadingThreads, nullptr,
+                                        nullptr))
+            {
+                m_poParallelReader = std::move(poReader);
+            }
+            else
+            {
+                m_nCanReadInParallel = FALSE;
+            }
+        }
+    }
+    return m_nCanReadInParallel != 0;
+}
+
+/************************************************************************/
+/*                       GetNextFeatureParallel()                       */
+/************************************************************************/
+
+OGRFeature *OGRUnionLayer::GetNextFeatureParallel()
+{
+    auto &oReader = *m_poParallelReader;
+
+    while (true)
+    {
+        // Start reading the next source layers, up to the number of threads
+        while (static_cast<int>(oReader.apoSources.size()) <
+                   m_nParallelReadingThreads &&
+               oReader.nNextSrcLayer < nSrcLayers)
+        {
+            const int iSrcLayer = oReader.nNextSrcLayer++;
+            if (!SourceLayerIntersectsFilter(iSrcLayer))
+                continue;
+
+            auto poSource = std::make_unique<OGRUnionLayerSourceReader>();
+            poSource->poParent = &oReader;
+            poSource->iSrcLayer = iSrcLayer;
+            ConfigureSourceLayer(iSrcLayer, poSource->anMap);
+            poSource->poSrcLayer = papoSrcLayers[iSrcLayer];
+
+            OGRLayer *poBaseLayer = poSource->poSrcLayer;
+            while (auto poDecorator =
+                       dynamic_cast<OGRLayerDecorator *>(poBaseLayer))
+                poBaseLayer = poDecorator->GetBaseLayer();
+            if (auto poProxiedLayer =
+                    dynamic_cast<OGRProxiedLayer *>(poBaseLayer))
+            {
+                // Make sure the worker thread will not have to open it
+                if (poProxiedLayer->GetUnderlyingLayer() == nullptr)
+                    continue;
+                poProxiedLayer->Pin();
+                poSource->poPinnedLayer = poProxiedLayer;
+            }
+
+            std::lock_guard<std::mutex> oLock(oReader.oMutex);
+            oReader.SubmitIfNeeded(poSource.get());
+            oReader.apoSources.push_back(std::move(poSource));
+        }
+        if (oReader.apoSources.empty())
+            return nullptr;
+
+        // Wait for a feature, or the end of a source layer: of the first
+        // one if the order is preserved, or of any one otherwise.
+        std::unique_lock<std::mutex> oLock(oReader.oMutex);
+        auto oIterSource = oReader.apoSources.end();
+        while (true)
+        {
+            for (auto oIter = oReader.apoSources.begin();
+                 oIter != oReader.apoSources.end(); ++oIter)
+            {
+                auto poSource = oIter->get();
+                if (!poSource->apoFeatures.empty() ||
+                    !oReader.SubmitIfNeeded(poSource))
+                {
+                    if (!poSource->apoFeatures.empty() || poSource->bFinished)
+                    {
+                        oIterSource = oIter;
+                        break;
+                    }
+                }
+                if (m_bParallelReadingPreserveOrder)
+                    break;
+            }
+            if (oIterSource != oReader.apoSources.end())
+                break;
+            oReader.oCV.wait(oLock);
+        }
+
+        auto poSource = oIterSource->get();
+        if (!poSource->apoFeatures.empty())
+        {
+            std::unique_ptr<OGRFeature> poSrcFeature =
+                std::move(poSource->apoFeatures.front());
+            poSource->apoFeatures.pop_front();
+            oReader.SubmitIfNeeded(poSource);
+            oLock.unlock();
+
+            OGRFeature *poFeature = TranslateFromSrcLayer(
+                poSrcFeature.get(), poSource->iSrcLayer,
+                poSource->anMap.data());
+
+            if ((m_poFilterGeom == nullptr ||
+                 FilterGeometry(
+                     poFeature->GetGeomFieldRef(m_iGeomFieldFilter))) &&
+                (m_poAttrQuery == nullptr ||
+                 m_poAttrQuery->Evaluate(poFeature)))
+            {
+                return poFeature;
+            }
+
+            delete poFeature;
+            continue;
+        }
+
+        // The source layer has been completely read
+        auto poFinishedSource = std::move(*oIterSource);
+        oReader.apoSources.erase(oIterSource);
+        oLock.unlock();
+
+        for (const auto &oError : poFinishedSource->aoErrors)
+        {
+            CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+        }
+        if (poFinishedSource->poPinnedLayer)
+            poFinishedSource->poPinnedLayer->Unpin();
+    }
+}
+
+/************************************************************************/
+/*                        StopParallelReading()                         */
+/************************************************************************/
+
+void OGRUnionLayer::StopParallelReading()
+{
+    if (!m_poParallelReader)
+        return;
+
+    auto &oReader = *m_poParallelReader;
+    {
+        std::unique_lock<std::mutex> oLock(oReader.oMutex);
+        oReader.bStop = true;
+        oReader.WaitForIdleJobs(oLock);
+    }
+    oReader.poPool->WaitCompletion();
+
+    for (auto &poSource : oReader.apoSources)
+    {
+        if (poSource->poPinnedLayer)
+            poSource->poPinnedLayer->Unpin();
+    }
+    oReader.apoSources.clear();
+    oReader.nNextSrcLayer = 0;
+    oReader.bStop = false;
+}
+
 /************************************************************************/
 /*                        TranslateFromSrcLayer()                       */
 /************************************************************************/
 
-OGRFeature *OGRUnionLayer::TranslateFromSrcLayer(OGRFeature *poSrcFeature)
+OGRFeature *OGRUnionLayer::TranslateFromSrcLayer(OGRFeature *poSrcFeature,
+                                                 int iSrcLayer,
+                                                 const int *panMap)
 {
     CPLAssert(poSrcFeature->GetFieldCount() == 0 || panMap != nullptr);
-    CPLAssert(iCurLayer >= 0 && iCurLayer < nSrcLayers);
+    CPLAssert(iSrcLayer >= 0 && iSrcLayer < nSrcLayers);
 
     OGRFeature *poFeature = new OGRFeature(poFeatureDefn);
     poFeature->SetFrom(poSrcFeature, panMap, TRUE);
@@ -1351,7 +1842,7 @@ OGRFeature *OGRUnionLayer::TranslateFromSrcLayer(OGRFeature *poSrcFeature)
     if (!osSourceLayerFieldName.empty() &&
         !poFeatureDefn->GetFieldDefn(0)->IsIgnored())
     {
-        poFeature->SetField(0, papoSrcLayers[iCurLayer]->GetName());
+        poFeature->SetField(0, papoSrcLayers[iSrcLayer]->GetName());
     }
 
     for (int i = 0; i < poFeatureDefn->GetGeomFieldCount(); i++)
@@ -1382,6 +1873,8 @@ OGRFeature *OGRUnionLayer::TranslateFromSrcLayer(OGRFeature *poSrcFeature)
 
 OGRErr OGRUnionLayer::SetIgnoredFields(CSLConstList papszFields)
 {
+    StopParallelReading();
+
     OGRErr eErr = OGRLayer::SetIgnoredFields(papszFields);
     if (eErr != OGRERR_NONE)
         return eErr;
@@ -1397,6 +1890,8 @@ OGRErr OGRUnionLayer::SetIgnoredFields(CSLConstList papszFields)
 
 OGRErr OGRUnionLayer::SyncToDisk()
 {
+    StopParallelReading();
+
     for (int i = 0; i < nSrcLayers; i++)
     {
         if (pabModifiedLayers[i])
@@ -34,6 +34,11 @@
 
 #include "ogrsf_frmts.h"
 
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
 /************************************************************************/
 /*                      OGRUnionLayerGeomFieldDefn                      */
 /************************************************************************/
@@ -56,6 +61,8 @@ class CPL_DLL OGRUnionLayerGeomFieldDefn final : public OGRGeomFieldDefn
 /*                         OGRUnionLayer                                */
 /************************************************************************/
 
+struct OGRUnionLayerParallelReader;
+
 typedef enum
 {
     FIELD_FROM_FIRST_LAYER,
@@ -89,19 +96,36 @@ class CPL_DLL OGRUnionLayer final : public OGRLayer
     int iCurLayer;
     char *pszAttributeFilter;
     int nNextFID;
-    int *panMap;
+    std::vector<int> m_anMap{};
     CPLStringList m_aosIgnoredFields{};
     int bAttrFilterPassThroughValue;
     int *pabModifiedLayers;
     int *pabCheckIfAutoWrap;
     const OGRSpatialReference *poGlobalSRS;
 
+    // Known extents of source layers, indexed by (source layer index,
+    // geometry field index of the union layer), and expressed in the SRS
+    // of the union layer.
+    std::map<std::pair<int, int>, OGREnvelope> m_oMapSrcLayerExtents{};
+
+    int m_nParallelReadingThreads = 1;
+    bool m_bParallelReadingPreserveOrder = true;
+    int m_nCanReadInParallel = -1;
+    std::unique_ptr<OGRUnionLayerParallelReader> m_poParallelReader{};
+
     void AutoWarpLayerIfNecessary(int iSubLayer);
-    OGRFeature *TranslateFromSrcLayer(OGRFeature *poSrcFeature);
+    OGRFeature *TranslateFromSrcLayer(OGRFeature *poSrcFeature, int iSrcLayer,
+                                      const int *panMap);
     void ApplyAttributeFilterToSrcLayer(int iSubLayer);
     int GetAttrFilterPassThroughValue();
     void ConfigureActiveLayer();
+    void ConfigureSourceLayer(int iSrcLayer, std::vector<int> &anMap);
     void SetSpatialFilterToSourceLayer(OGRLayer *poSrcLayer);
+    bool SourceLayerIntersectsFilter(int iSrcLayer) const;
+    void InvalidateSourceLayerExtents(int iSrcLayer);
+    bool CanReadInParallel();
+    OGRFeature *GetNextFeatureParallel();
+    void StopParallelReading();
 
   public:
     OGRUnionLayer(
@@ -125,6 +149,9 @@ class CPL_DLL OGRUnionLayer final : public OGRLayer
     void SetSourceLayerFieldName(const char *pszSourceLayerFieldName);
     void SetPreserveSrcFID(int bPreserveSrcFID);
     void SetFeatureCount(int nFeatureCount);
+    void SetSourceLayerExtent(int iSrcLayer, int iGeomField,
+                              const OGREnvelope &sExtent);
+    void SetParallelReading(int nThreads, bool bPreserveOrder);
 
     virtual const char *GetName() override
     {
@@ -29,6 +29,206 @@
 #ifndef DOXYGEN_SKIP
 
 #include "ogrwarpedlayer.h"
+#include "ogrlayerarrow.h"
+#include "ogr_wkb.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <string>
+
+/************************************************************************/
+/*                      OGRWarpedLayerPointGatherer                     */
+/************************************************************************/
+
+namespace
+{
+
+// Collects the coordinates of the geometries of a batch of features, so
+// that they can be reprojected with a single
+// OGRCoordinateTransformation::TransformParallel() call.
+class OGRWarpedLayerPointGatherer final : public OGRDefaultGeometryVisitor
+{
+    struct Part
+    {
+        OGRPoint *poPoint = nullptr;
+        OGRSimpleCurve *poCurve = nullptr;
+        size_t nFirstPoint = 0;
+        bool bIsClosedRing = false;
+    };
+
+    std::vector<Part> m_asParts{};
+    std::vector<OGRGeometry *> m_apoGeoms{};
+    std::vector<size_t> m_anGeomFirstPart{};
+    std::vector<double> m_adfX{};
+    std::vector<double> m_adfY{};
+    std::vector<double> m_adfZ{};
+
+    void AddCurve(OGRSimpleCurve *poCurve, bool bIsRing);
+
+  public:
+    using OGRDefaultGeometryVisitor::visit;
+
+    void visit(OGRPoint *poPoint) override;
+
+    void visit(OGRLineString *poLS) override
+    {
+        AddCurve(poLS, false);
+    }
+
+    void visit(OGRLinearRing *poLR) override
+    {
+        AddCurve(poLR, true);
+    }
+
+    void visit(OGRCircularString *poCS) override
+    {
+        AddCurve(poCS, false);
+    }
+
+    void AddGeometry(OGRGeometry *poGeom)
+    {
+        m_apoGeoms.push_back(poGeom);
+        m_anGeomFirstPart.push_back(m_asParts.size());
+        poGeom->accept(this);
+    }
+
+    size_t GetPointCount() const
+    {
+        return m_adfX.size();
+    }
+
+    std::vector<bool> Transform(OGRCoordinateTransformation *poCT);
+};
+
+void OGRWarpedLayerPointGatherer::visit(OGRPoint *poPoint)
+{
+    Part sPart;
+    sPart.poPoint = poPoint;
+    sPart.nFirstPoint = m_adfX.size();
+    m_asParts.push_back(sPart);
+    // Same as OGRPoint::transform(), which also transforms empty points
+    m_adfX.push_back(poPoint->getX());
+    m_adfY.push_back(poPoint->getY());
+    m_adfZ.push_back(poPoint->getZ());
+}
+
+void OGRWarpedLayerPointGatherer::AddCurve(OGRSimpleCurve *poCurve,
+                                           bool bIsRing)
+{
+    Part sPart;
+    sPart.poCurve = poCurve;
+    sPart.nFirstPoint = m_adfX.size();
+    // Same as OGRLinearRing::transform()
+    sPart.bIsClosedRing =
+        bIsRing && poCurve->getNumPoints() > 2 && poCurve->get_IsClosed();
+    m_asParts.push_back(sPart);
+
+    const size_t nPoints = static_cast<size_t>(poCurve->getNumPoints());
+    m_adfX.resize(sPart.nFirstPoint + nPoints);
+    m_adfY.resize(sPart.nFirstPoint + nPoints);
+    // z=0 for 2D curves, as OGRSimpleCurve::transform()
+    m_adfZ.resize(sPart.nFirstPoint + nPoints);
+    if (nPoints)
+    {
+        poCurve->getPoints(m_adfX.data() + sPart.nFirstPoint, sizeof(double),
+                           m_adfY.data() + sPart.nFirstPoint, sizeof(double),
+                           poCurve->Is3D() ? m_adfZ.data() + sPart.nFirstPoint
+                                           : nullptr,
+                           sizeof(double));
+    }
+}
+
+// Returns, for each added geometry, whether it has been reprojected. The
+// other geometries are left unmodified.
+std::vector<bool>
+OGRWarpedLayerPointGatherer::Transform(OGRCoordinateTransformation *poCT)
+{
+    const size_t nGeoms = m_apoGeoms.size();
+    std::vector<bool> abSuccess(nGeoms, false);
+
+    std::vector<int> anErrorCodes(m_adfX.size());
+    const bool bRet =
+        m_adfX.empty() ||
+        poCT->TransformParallel(m_adfX.size(), m_adfX.data(), m_adfY.data(),
+                                m_adfZ.data(), nullptr,
+                                anErrorCodes.data()) != FALSE;
+    if (!bRet)
+        return abSuccess;
+
+    for (size_t iGeom = 0; iGeom < nGeoms; ++iGeom)
+    {
+        const size_t iFirstPart = m_anGeomFirstPart[iGeom];
+        const size_t iEndPart = iGeom + 1 < nGeoms
+                                    ? m_anGeomFirstPart[iGeom + 1]
+                                    : m_asParts.size();
+        const size_t iFirstPoint = iFirstPart < m_asParts.size()
+                                       ? m_asParts[iFirstPart].nFirstPoint
+                                       : m_adfX.size();
+        const size_t iEndPoint = iEndPart < m_asParts.size()
+                                     ? m_asParts[iEndPart].nFirstPoint
+                                     : m_adfX.size();
+        if (std::any_of(anErrorCodes.begin() + iFirstPoint,
+                        anErrorCodes.begin() + iEndPoint,
+                        [](int nErrorCode) { return nErrorCode != 0; }))
+        {
+            continue;
+        }
+
+        for (size_t iPart = iFirstPart; iPart < iEndPart; ++iPart)
+        {
+            const Part &sPart = m_asParts[iPart];
+            const size_t i = sPart.nFirstPoint;
+            if (sPart.poPoint)
+            {
+                if (!sPart.poPoint->IsEmpty())
+                {
+                    sPart.poPoint->setX(m_adfX[i]);
+                    sPart.poPoint->setY(m_adfY[i]);
+                    if (sPart.poPoint->Is3D())
+                        sPart.poPoint->setZ(m_adfZ[i]);
+                }
+            }
+            else
+            {
+                OGRSimpleCurve *poCurve = sPart.poCurve;
+                poCurve->setPoints(poCurve->getNumPoints(), m_adfX.data() + i,
+                                   m_adfY.data() + i,
+                                   poCurve->Is3D() ? m_adfZ.data() + i
+                                                   : nullptr);
+                if (sPart.bIsClosedRing && !poCurve->get_IsClosed())
+                {
+                    OGRPoint oStartPoint;
+                    poCurve->StartPoint(&oStartPoint);
+                    poCurve->setPoint(poCurve->getNumPoints() - 1,
+                                      &oStartPoint);
+                }
+            }
+        }
+        m_apoGeoms[iGeom]->assignSpatialReference(poCT->GetTargetCS());
+        abSuccess[iGeom] = true;
+    }
+
+    return abSuccess;
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                OGRWarpedLayer::ArrowStreamPrivateData                */
+/************************************************************************/
+
+struct OGRWarpedLayer::ArrowStreamPrivateData
+{
+    OGRWarpedLayer *poLayer = nullptr;
+    struct ArrowArrayStream sSrcStream{};
+    struct ArrowSchema sSrcSchema{};
+    int64_t iGeomChild = -1;
+    bool bLargeBinary = false;
+    CPLStringList aosOptions{};
+    std::string osLastError{};
+};
 
 /************************************************************************/
 /*                          OGRWarpedLayer()                            */
@@ -58,6 +258,8 @@ OGRWarpedLayer::OGRWarpedLayer(OGRLayer *poDecoratedLayer, int iGeomField,
 
 OGRWarpedLayer::~OGRWarpedLayer()
 {
+    if (m_psArrowStreamPrivateData)
+        m_psArrowStreamPrivateData->poLayer = nullptr;
     if (m_poFeatureDefn != nullptr)
         m_poFeatureDefn->Release();
     if (m_poSRS != nullptr)
@@ -98,6 +300,9 @@ void OGRWarpedLayer::SetSpatialFilter(int iGeomField, OGRGeometry *poGeom)
         return;
     }
 
+    // The decorated layer restarts reading
+    ClearBatch();
+
     m_iGeomFieldFilter = iGeomField;
     if (InstallFilter(poGeom))
         ResetReading();
@@ -201,6 +406,118 @@ OGRFeature *OGRWarpedLayer::WarpedFeatureToSrcFeature(OGRFeature *poFeature)
     return poSrcFeature;
 }
 
+/************************************************************************/
+/*                         SetAttributeFilter()                         */
+/************************************************************************/
+
+OGRErr OGRWarpedLayer::SetAttributeFilter(const char *pszFilter)
+{
+    ClearBatch();
+    return OGRLayerDecorator::SetAttributeFilter(pszFilter);
+}
+
+/************************************************************************/
+/*                            ResetReading()                            */
+/************************************************************************/
+
+void OGRWarpedLayer::ResetReading()
+{
+    ClearBatch();
+    OGRLayerDecorator::ResetReading();
+}
+
+/************************************************************************/
+/*                           SetNextByIndex()                           */
+/************************************************************************/
+
+OGRErr OGRWarpedLayer::SetNextByIndex(GIntBig nIndex)
+{
+    ClearBatch();
+    return OGRLayerDecorator::SetNextByIndex(nIndex);
+}
+
+/************************************************************************/
+/*                             ClearBatch()                             */
+/************************************************************************/
+
+void OGRWarpedLayer::ClearBatch()
+{
+    m_apoBatchFeatures.clear();
+    m_iBatchFeature = 0;
+    m_nBatchSize = 0;
+}
+
+/************************************************************************/
+/*                        DisableBatchReading()                         */
+/************************************************************************/
+
+// Once the layer is written, features are no longer read ahead, so that
+// modifications of the decorated layer are seen by the next features read.
+// The features already read ahead are still returned.
+void OGRWarpedLayer::DisableBatchReading()
+{
+    m_bBatchReading = false;
+}
+
+/************************************************************************/
+/*                             ReadBatch()                              */
+/************************************************************************/
+
+// Reads the next features of the decorated layer, and reprojects all their
+// geometries at once, possibly using several threads (according to
+// GDAL_NUM_THREADS).
+void OGRWarpedLayer::ReadBatch()
+{
+    // Start with small batches, so that reading only the first features of
+    // the layer does not read much ahead.
+    constexpr size_t INITIAL_BATCH_SIZE = 16;
+    constexpr size_t MAX_FEATURES_PER_BATCH = 10 * 1000;
+    constexpr size_t MAX_POINTS_PER_BATCH = 1000 * 1000;
+
+    m_apoBatchFeatures.clear();
+    m_iBatchFeature = 0;
+    m_nBatchSize = m_nBatchSize == 0
+                       ? INITIAL_BATCH_SIZE
+                       : std::min(m_nBatchSize * 2, MAX_FEATURES_PER_BATCH);
+
+    OGRWarpedLayerPointGatherer oGatherer;
+    std::vector<size_t> anGeomFeatureIdx;
+    while (m_apoBatchFeatures.size() < m_nBatchSize &&
+           oGatherer.GetPointCount() < MAX_POINTS_PER_BATCH)
+    {
+        std::unique_ptr<OGRFeature> poSrcFeature(
+            m_poDecoratedLayer->GetNextFeature());
+        if (!poSrcFeature)
+            break;
+
+        auto poFeature = std::make_unique<OGRFeature>(GetLayerDefn());
+        poFeature->SetFrom(poSrcFeature.get());
+        poFeature->SetFID(poSrcFeature->GetFID());
+        OGRGeometry *poGeom = poFeature->GetGeomFieldRef(m_iGeomField);
+        if (poGeom)
+        {
+            anGeomFeatureIdx.push_back(m_apoBatchFeatures.size());
+            oGatherer.AddGeometry(poGeom);
+        }
+        m_apoBatchFeatures.push_back(std::move(poFeature));
+    }
+
+    const std::vector<bool> abSuccess = oGatherer.Transform(m_poCT);
+    for (size_t i = 0; i < abSuccess.size(); ++i)
+    {
+        if (abSuccess[i])
+            continue;
+        // Same as SrcFeatureToWarpedFeature(), which is needed for partial
+        // reprojection, and to get the same error messages.
+        OGRFeature *poFeature = m_apoBatchFeatures[anGeomFeatureIdx[i]].get();
+        if (poFeature->GetGeomFieldRef(m_iGeomField)->transform(m_poCT) !=
+            OGRERR_NONE)
+        {
+            delete poFeature->StealGeometry(m_iGeomField);
+        }
+    }
+}
+
 /************************************************************************/
 /*                          GetNextFeature()                            */
 /************************************************************************/
@@ -209,12 +526,28 @@ OGRFeature *OGRWarpedLayer::GetNextFeature()
 {
     while (true)
     {
-        OGRFeature *poFeature = m_poDecoratedLayer->GetNextFeature();
-        if (poFeature == nullptr)
+        if (m_iBatchFeature == m_apoBatchFeatures.size() && m_bBatchReading)
+            ReadBatch();
+
+        OGRFeature *poFeatureNew = nullptr;
+        if (m_iBatchFeature < m_apoBatchFeatures.size())
+        {
+            poFeatureNew = m_apoBatchFeatures[m_iBatchFeature].release();
+            ++m_iBatchFeature;
+        }
+        else if (m_bBatchReading)
+        {
             return nullptr;
+        }
+        else
+        {
+            OGRFeature *poFeature = m_poDecoratedLayer->GetNextFeature();
+            if (poFeature == nullptr)
+                return nullptr;
 
-        OGRFeature *poFeatureNew = SrcFeatureToWarpedFeature(poFeature);
-        delete poFeature;
+            poFeatureNew = SrcFeatureToWarpedFeature(poFeature);
+            delete poFeature;
+        }
 
         OGRGeometry *poGeom = poFeatureNew->GetGeomFieldRef(m_iGeomField);
         if (m_poFilterGeom != nullptr && !FilterGeometry(poGeom))
@@ -251,6 +584,8 @@ OGRErr OGRWarpedLayer::ISetFeature(OGRFeature *poFeature)
 {
     OGRErr eErr;
 
+    DisableBatchReading();
+
     OGRFeature *poFeatureNew = WarpedFeatureToSrcFeature(poFeature);
     if (poFeatureNew == nullptr)
         return OGRERR_FAILURE;
@@ -270,6 +605,8 @@ OGRErr OGRWarpedLayer::ICreateFeature(OGRFeature *poFeature)
 {
     OGRErr eErr;
 
+    DisableBatchReading();
+
     OGRFeature *poFeatureNew = WarpedFeatureToSrcFeature(poFeature);
     if (poFeatureNew == nullptr)
         return OGRERR_FAILURE;
@@ -289,6 +626,8 @@ OGRErr OGRWarpedLayer::IUpsertFeature(OGRFeature *poFeature)
 {
     OGRErr eErr;
 
+    DisableBatchReading();
+
     OGRFeature *poFeatureNew = WarpedFeatureToSrcFeature(poFeature);
     if (poFeatureNew == nullptr)
         return OGRERR_FAILURE;
@@ -313,6 +652,8 @@ OGRErr OGRWarpedLayer::IUpdateFeature(OGRFeature *poFeature,
 {
     OGRErr eErr;
 
+    DisableBatchReading();
+
     OGRFeature *poFeatureNew = WarpedFeatureToSrcFeature(poFeature);
     if (poFeatureNew == nullptr)
         return OGRERR_FAILURE;
@@ -580,6 +921,451 @@ int OGRWarpedLayer::ReprojectEnvelope(OGREnvelope *psEnvelope,
     return bRet;
 }
 
+/************************************************************************/
+/*                   OGRWarpedLayerTransformWKBArray()                  */
+/************************************************************************/
+
+// Creates in sOutArray a copy of the WKB binary array psArray, with
+// reprojected geometries. Geometries that cannot be reprojected are set to
+// null.
+template <class OffsetType>
+static bool
+OGRWarpedLayerTransformWKBArray(const struct ArrowArray *psArray,
+                                OGRCoordinateTransformation *poCT,
+                                void (*pfnRelease)(struct ArrowArray *),
+                                struct ArrowArray &sOutArray)
+{
+    const size_t nRows =
+        static_cast<size_t>(psArray->offset + psArray->length);
+    const auto pabyValidity = static_cast<const uint8_t *>(psArray->buffers[0]);
+    const auto panOffsets =
+        static_cast<const OffsetType *>(psArray->buffers[1]);
+    const auto pabySrcValues = static_cast<const GByte *>(psArray->buffers[2]);
+    const OffsetType nBaseOffset = panOffsets[0];
+    const size_t nValuesSize =
+        static_cast<size_t>(panOffsets[nRows] - nBaseOffset);
+    const auto IsNull = [pabyValidity, psArray](size_t iRow)
+    {
+        return psArray->null_count != 0 && pabyValidity &&
+               (pabyValidity[iRow / 8] & (1 << (iRow % 8))) == 0;
+    };
+
+    memset(&sOutArray, 0, sizeof(sOutArray));
+    sOutArray.release = pfnRelease;
+    sOutArray.length = psArray->length;
+    sOutArray.offset = psArray->offset;
+    sOutArray.null_count = psArray->null_count;
+    sOutArray.n_buffers = 3;
+    sOutArray.buffers =
+        static_cast<const void **>(CPLCalloc(3, sizeof(const void *)));
+
+    GByte *pabyValues = static_cast<GByte *>(
+        VSI_MALLOC_ALIGNED_AUTO_VERBOSE(std::max<size_t>(1, nValuesSize)));
+    if (!pabyValues)
+    {
+        sOutArray.release(&sOutArray);
+        return false;
+    }
+    sOutArray.buffers[2] = pabyValues;
+    if (nValuesSize)
+        memcpy(pabyValues, pabySrcValues + nBaseOffset, nValuesSize);
+
+    // Reproject in place the copied geometries
+    OGRWKBTransformBatch oBatch;
+    std::vector<size_t> anGeomRows;
+    std::vector<size_t> anFailedRows;
+    for (size_t iRow = static_cast<size_t>(psArray->offset); iRow < nRows;
+         ++iRow)
+    {
+        const size_t nLen =
+            static_cast<size_t>(panOffsets[iRow + 1] - panOffsets[iRow]);
+        if (IsNull(iRow) || nLen == 0)
+            continue;
+        const size_t nStart =
+            static_cast<size_t>(panOffsets[iRow] - nBaseOffset);
+        if (oBatch.AddGeometry(pabyValues + nStart, nLen))
+            anGeomRows.push_back(iRow);
+        else
+            anFailedRows.push_back(iRow);
+    }
+    oBatch.Transform(poCT);
+    for (size_t i = 0; i < anGeomRows.size(); ++i)
+    {
+        if (!oBatch.GetSuccess(i))
+            anFailedRows.push_back(anGeomRows[i]);
+    }
+
+    const size_t nOffsetsSize = (nRows + 1) * sizeof(OffsetType);
+    OffsetType *panNewOffsets = static_cast<OffsetType *>(
+        VSI_MALLOC_ALIGNED_AUTO_VERBOSE(nOffsetsSize));
+    if (!panNewOffsets)
+    {
+        sOutArray.release(&sOutArray);
+        return false;
+    }
+    sOutArray.buffers[1] = panNewOffsets;
+
+    const size_t nValidityBytes = (nRows + 7) / 8;
+    if (anFailedRows.empty())
+    {
+        // Fast path: the layout of the array is unchanged
+        for (size_t iRow = 0; iRow <= nRows; ++iRow)
+            panNewOffsets[iRow] = panOffsets[iRow] - nBaseOffset;
+        if (pabyValidity)
+        {
+            uint8_t *pabyNewValidity = static_cast<uint8_t *>(
+                VSI_MALLOC_ALIGNED_AUTO_VERBOSE(nValidityBytes));
+            if (!pabyNewValidity)
+            {
+                sOutArray.release(&sOutArray);
+                return false;
+            }
+            sOutArray.buffers[0] = pabyNewValidity;
+            memcpy(pabyNewValidity, pabyValidity, nValidityBytes);
+        }
+        return true;
+    }
+
+    // Same as OGRWarpedLayer::SrcFeatureToWarpedFeature() for the geometries
+    // that could not be reprojected by batch: use OGRGeometry::transform(),
+    // for partial reprojection, and set them to null if it fails.
+    std::sort(anFailedRows.begin(), anFailedRows.end());
+    std::vector<std::string> aosFallbackWKB(anFailedRows.size());
+    std::vector<bool> abFallbackOK(anFailedRows.size(), false);
+    for (size_t i = 0; i < anFailedRows.size(); ++i)
+    {
+        const size_t iRow = anFailedRows[i];
+        OGRGeometry *poGeom = nullptr;
+        OGRGeometryFactory::createFromWkb(
+            pabySrcValues + panOffsets[iRow], nullptr, &poGeom,
+            static_cast<size_t>(panOffsets[iRow + 1] - panOffsets[iRow]),
+            wkbVariantIso);
+        std::unique_ptr<OGRGeometry> poGeomUniquePtr(poGeom);
+        if (poGeom && poGeom->transform(poCT) == OGRERR_NONE)
+        {
+            std::string &osWKB = aosFallbackWKB[i];
+            osWKB.resize(poGeom->WkbSize());
+            poGeom->exportToWkb(wkbNDR,
+                                reinterpret_cast<unsigned char *>(&osWKB[0]),
+                                wkbVariantIso);
+            abFallbackOK[i] = true;
+        }
+    }
+
+    uint8_t *pabyNewValidity =
+        static_cast<uint8_t *>(VSI_MALLOC_ALIGNED_AUTO_VERBOSE(nValidityBytes));
+    if (!pabyNewValidity)
+    {
+        sOutArray.release(&sOutArray);
+        return false;
+    }
+    sOutArray.buffers[0] = pabyNewValidity;
+    if (pabyValidity)
+        memcpy(pabyNewValidity, pabyValidity, nValidityBytes);
+    else
+        memset(pabyNewValidity, 0xFF, nValidityBytes);
+
+    std::vector<GByte> abyNewValues;
+    abyNewValues.reserve(nValuesSize);
+    size_t iFailed = 0;
+    panNewOffsets[0] = 0;
+    for (size_t iRow = 0; iRow < nRows; ++iRow)
+    {
+        const size_t nStart =
+            static_cast<size_t>(panOffsets[iRow] - nBaseOffset);
+        const size_t nLen =
+            static_cast<size_t>(panOffsets[iRow + 1] - panOffsets[iRow]);
+        if (iFailed < anFailedRows.size() && anFailedRows[iFailed] == iRow)
+        {
+            const std::string &osWKB = aosFallbackWKB[iFailed];
+            if (abFallbackOK[iFailed])
+            {
+                abyNewValues.insert(abyNewValues.end(), osWKB.begin(),
+                                    osWKB.end());
+            }
+            else
+            {
+                pabyNewValidity[iRow / 8] &=
+                    static_cast<uint8_t>(~(1 << (iRow % 8)));
+            }
+            ++iFailed;
+        }
+        else
+        {
+            abyNewValues.insert(abyNewValues.end(), pabyValues + nStart,
+                                pabyValues + nStart + nLen);
+        }
+        if (abyNewValues.size() >
+            static_cast<size_t>(std::numeric_limits<OffsetType>::max()))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Too large WKB content in Arrow array");
+            sOutArray.release(&sOutArray);
+            return false;
+        }
+        panNewOffsets[iRow + 1] = static_cast<OffsetType>(abyNewValues.size());
+    }
+
+    VSIFreeAligned(pabyValues);
+    pabyValues = static_cast<GByte *>(VSI_MALLOC_ALIGNED_AUTO_VERBOSE(
+        std::max<size_t>(1, abyNewValues.size())));
+    sOutArray.buffers[2] = pabyValues;
+    if (!pabyValues)
+    {
+        sOutArray.release(&sOutArray);
+        return false;
+    }
+    if (!abyNewValues.empty())
+        memcpy(pabyValues, abyNewValues.data(), abyNewValues.size());
+    sOutArray.null_count = -1;
+    return true;
+}
+
+/************************************************************************/
+/*                    TransformArrowGeometryColumn()                    */
+/************************************************************************/
+
+// Replaces the WKB geometry column psGeomArray, a child of an array of the
+// decorated layer, with reprojected geometries.
+bool OGRWarpedLayer::TransformArrowGeometryColumn(
+    struct ArrowArray *psGeomArray, bool bLargeBinary)
+{
+    struct ArrowArray sNewArray;
+    const bool bOK =
+        bLargeBinary
+            ? OGRWarpedLayerTransformWKBArray<int64_t>(
+                  psGeomArray, m_poCT, OGRLayer::ReleaseArray, sNewArray)
+            : OGRWarpedLayerTransformWKBArray<int32_t>(
+                  psGeomArray, m_poCT, OGRLayer::ReleaseArray, sNewArray);
+    if (!bOK)
+        return false;
+
+    // Move the new array in place of the original one, which is owned by
+    // its parent.
+    psGeomArray->release(psGeomArray);
+    memcpy(psGeomArray, &sNewArray, sizeof(sNewArray));
+    return true;
+}
+
+/************************************************************************/
+/*                           GetArrowStream()                           */
+/************************************************************************/
+
+// When the decorated layer returns WKB geometries, its Arrow stream is used,
+// and the geometries of each of its batches are reprojected at once.
+// Otherwise the generic implementation, based on GetNextFeature(), is used.
+bool OGRWarpedLayer::GetArrowStream(struct ArrowArrayStream *out_stream,
+                                    CSLConstList papszOptions)
+{
+    memset(out_stream, 0, sizeof(*out_stream));
+    if (m_psArrowStreamPrivateData)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "An arrow Arrow Stream is in progress on that layer. Only "
+                 "one at a time is allowed in this implementation.");
+        return false;
+    }
+
+    const char *pszGeometryEncoding =
+        CSLFetchNameValue(papszOptions, "GEOMETRY_ENCODING");
+    if (m_iGeomField < 0 ||
+        m_iGeomField >= GetLayerDefn()->GetGeomFieldCount() ||
+        (pszGeometryEncoding && !EQUAL(pszGeometryEncoding, "WKB")))
+    {
+        return OGRLayer::GetArrowStream(out_stream, papszOptions);
+    }
+
+    auto psPrivate = std::make_unique<ArrowStreamPrivateData>();
+    psPrivate->aosOptions.Assign(CSLDuplicate(papszOptions), true);
+    CPLStringList aosSrcOptions(papszOptions);
+    aosSrcOptions.SetNameValue("GEOMETRY_ENCODING", "WKB");
+    if (!m_poDecoratedLayer->GetArrowStream(&psPrivate->sSrcStream,
+                                            aosSrcOptions.List()))
+    {
+        return false;
+    }
+    auto &sSrcStream = psPrivate->sSrcStream;
+    auto &sSrcSchema = psPrivate->sSrcSchema;
+    if (sSrcStream.get_schema(&sSrcStream, &sSrcSchema) != 0)
+    {
+        const char *pszError = sSrcStream.get_last_error(&sSrcStream);
+        CPLError(CE_Failure, CPLE_AppDefined, "get_schema() failed: %s",
+                 pszError ? pszError : "unknown error");
+        sSrcStream.release(&sSrcStream);
+        return false;
+    }
+
+    bool bFallback = false;
+    const auto poGeomFieldDefn = GetLayerDefn()->GetGeomFieldDefn(m_iGeomField);
+    if (!poGeomFieldDefn->IsIgnored())
+    {
+        const char *pszGeomFieldName = poGeomFieldDefn->GetNameRef();
+        if (pszGeomFieldName[0] == '\0')
+            pszGeomFieldName = DEFAULT_ARROW_GEOMETRY_NAME;
+        for (int64_t i = 0; i < sSrcSchema.n_children; ++i)
+        {
+            const auto psChild = sSrcSchema.children[i];
+            if (strcmp(psChild->name, pszGeomFieldName) == 0)
+            {
+                if (strcmp(psChild->format, "z") == 0 ||
+                    strcmp(psChild->format, "Z") == 0)
+                {
+                    psPrivate->iGeomChild = i;
+                    psPrivate->bLargeBinary =
+                        strcmp(psChild->format, "Z") == 0;
+                }
+                break;
+            }
+        }
+        bFallback = psPrivate->iGeomChild < 0;
+    }
+    if (m_poFilterGeom && !CanPostFilterArrowArray(&sSrcSchema))
+        bFallback = true;
+    if (bFallback)
+    {
+        sSrcSchema.release(&sSrcSchema);
+        sSrcStream.release(&sSrcStream);
+        return OGRLayer::GetArrowStream(out_stream, papszOptions);
+    }
+
+    psPrivate->poLayer = this;
+    m_psArrowStreamPrivateData = psPrivate.get();
+    out_stream->get_schema = ArrowStreamGetSchema;
+    out_stream->get_next = ArrowStreamGetNext;
+    out_stream->get_last_error = ArrowStreamGetLastError;
+    out_stream->release = ArrowStreamRelease;
+    out_stream->private_data = psPrivate.release();
+    return true;
+}
+
+/************************************************************************/
+/*                        ArrowStreamGetSchema()                        */
+/************************************************************************/
+
+int OGRWarpedLayer::ArrowStreamGetSchema(struct ArrowArrayStream *stream,
+                                         struct ArrowSchema *out_schema)
+{
+    auto psPrivate =
+        static_cast<ArrowStreamPrivateData *>(stream->private_data);
+    auto poLayer = psPrivate->poLayer;
+    if (!poLayer)
+    {
+        psPrivate->osLastError =
+            "Calling get_schema() on a freed OGRLayer is not supported";
+        return EINVAL;
+    }
+
+    auto &sSrcStream = psPrivate->sSrcStream;
+    const int ret = sSrcStream.get_schema(&sSrcStream, out_schema);
+    if (ret != 0 || psPrivate->iGeomChild < 0)
+        return ret;
+
+    // Replace the schema of the geometry column, so that it advertises the
+    // target CRS.
+    const char *pszGeometryMetadataEncoding =
+        psPrivate->aosOptions.FetchNameValue("GEOMETRY_METADATA_ENCODING");
+    const char *pszExtensionName =
+        pszGeometryMetadataEncoding &&
+                EQUAL(pszGeometryMetadataEncoding, "GEOARROW")
+            ? EXTENSION_NAME_GEOARROW_WKB
+            : EXTENSION_NAME_OGC_WKB;
+    auto psNewSchema = CreateSchemaForWKBGeometryColumn(
+        poLayer->GetLayerDefn()->GetGeomFieldDefn(poLayer->m_iGeomField),
+        psPrivate->bLargeBinary ? "Z" : "z", pszExtensionName);
+    auto psGeomSchema = out_schema->children[psPrivate->iGeomChild];
+    psGeomSchema->release(psGeomSchema);
+    memcpy(psGeomSchema, psNewSchema, sizeof(*psNewSchema));
+    CPLFree(psNewSchema);
+    return 0;
+}
+
+/************************************************************************/
+/*                         ArrowStreamGetNext()                         */
+/************************************************************************/
+
+int OGRWarpedLayer::ArrowStreamGetNext(struct ArrowArrayStream *stream,
+                                       struct ArrowArray *out_array)
+{
+    auto psPrivate =
+        static_cast<ArrowStreamPrivateData *>(stream->private_data);
+    auto poLayer = psPrivate->poLayer;
+    if (!poLayer)
+    {
+        psPrivate->osLastError =
+            "Calling get_next() on a freed OGRLayer is not supported";
+        return EINVAL;
+    }
+
+    auto &sSrcStream = psPrivate->sSrcStream;
+    while (true)
+    {
+        const int ret = sSrcStream.get_next(&sSrcStream, out_array);
+        if (ret != 0 || out_array->release == nullptr)
+            return ret;
+
+        if (psPrivate->iGeomChild >= 0)
+        {
+            if (!poLayer->TransformArrowGeometryColumn(
+                    out_array->children[psPrivate->iGeomChild],
+                    psPrivate->bLargeBinary))
+            {
+                out_array->release(out_array);
+                memset(out_array, 0, sizeof(*out_array));
+                psPrivate->osLastError = CPLGetLastErrorMsg();
+                return ENOMEM;
+            }
+
+            poLayer->PostFilterArrowArray(&psPrivate->sSrcSchema, out_array,
+                                          psPrivate->aosOptions.List());
+            if (out_array->release == nullptr)
+            {
+                psPrivate->osLastError = CPLGetLastErrorMsg();
+                return ENOMEM;
+            }
+        }
+
+        if (out_array->length > 0)
+            return 0;
+
+        // All features of that batch have been filtered out
+        out_array->release(out_array);
+    }
+}
+
+/************************************************************************/
+/*                       ArrowStreamGetLastError()                      */
+/************************************************************************/
+
+const char *
+OGRWarpedLayer::ArrowStreamGetLastError(struct ArrowArrayStream *stream)
+{
+    auto psPrivate =
+        static_cast<ArrowStreamPrivateData *>(stream->private_data);
+    if (!psPrivate->osLastError.empty())
+        return psPrivate->osLastError.c_str();
+    auto &sSrcStream = psPrivate->sSrcStream;
+    return sSrcStream.get_last_error(&sSrcStream);
+}
+
+/************************************************************************/
+/*                         ArrowStreamRelease()                         */
+/************************************************************************/
+
+void OGRWarpedLayer::ArrowStreamRelease(struct ArrowArrayStream *stream)
+{
+    auto psPrivate =
+        static_cast<ArrowStreamPrivateData *>(stream->private_data);
+    if (psPrivate->poLayer)
+        psPrivate->poLayer->m_psArrowStreamPrivateData = nullptr;
+    if (psPrivate->sSrcSchema.release)
+        psPrivate->sSrcSchema.release(&psPrivate->sSrcSchema);
+    if (psPrivate->sSrcStream.release)
+        psPrivate->sSrcStream.release(&psPrivate->sSrcStream);
+    delete psPrivate;
+    stream->private_data = nullptr;
+    stream->release = nullptr;
+}
+
 /************************************************************************/
 /*                             TestCapability()                         */
 /************************************************************************/
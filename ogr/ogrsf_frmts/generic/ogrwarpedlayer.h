@@ -34,6 +34,9 @@
 
 #include "ogrlayerdecorator.h"
 
+#include <memory>
+#include <vector>
+
 /************************************************************************/
 /*                           OGRWarpedLayer                             */
 /************************************************************************/
@@ -52,12 +55,36 @@ class OGRWarpedLayer : public OGRLayerDecorator
 
     OGREnvelope sStaticEnvelope{};
 
+    // Features read ahead from the decorated layer, whose geometries have
+    // been reprojected by batch.
+    std::vector<std::unique_ptr<OGRFeature>> m_apoBatchFeatures{};
+    size_t m_iBatchFeature = 0;
+    size_t m_nBatchSize = 0;
+    bool m_bBatchReading = true;
+
+    struct ArrowStreamPrivateData;
+    ArrowStreamPrivateData *m_psArrowStreamPrivateData = nullptr;
+
     static int ReprojectEnvelope(OGREnvelope *psEnvelope,
                                  OGRCoordinateTransformation *poCT);
 
     OGRFeature *SrcFeatureToWarpedFeature(OGRFeature *poFeature);
     OGRFeature *WarpedFeatureToSrcFeature(OGRFeature *poFeature);
 
+    void ReadBatch();
+    void ClearBatch();
+    void DisableBatchReading();
+
+    bool TransformArrowGeometryColumn(struct ArrowArray *psGeomArray,
+                                      bool bLargeBinary);
+
+    static int ArrowStreamGetSchema(struct ArrowArrayStream *stream,
+                                    struct ArrowSchema *out_schema);
+    static int ArrowStreamGetNext(struct ArrowArrayStream *stream,
+                                  struct ArrowArray *out_array);
+    static const char *ArrowStreamGetLastError(struct ArrowArrayStream *stream);
+    static void ArrowStreamRelease(struct ArrowArrayStream *stream);
+
   public:
     OGRWarpedLayer(
         OGRLayer *poDecoratedLayer, int iGeomField, int bTakeOwnership,
@@ -77,8 +104,14 @@ class OGRWarpedLayer : public OGRLayerDecorator
                                       double dfMinY, double dfMaxX,
                                       double dfMaxY) override;
 
+    virtual OGRErr SetAttributeFilter(const char *) override;
+
+    virtual void ResetReading() override;
     virtual OGRFeature *GetNextFeature() override;
+    virtual OGRErr SetNextByIndex(GIntBig nIndex) override;
     virtual OGRFeature *GetFeature(GIntBig nFID) override;
+    virtual bool GetArrowStream(struct ArrowArrayStream *out_stream,
+                                CSLConstList papszOptions = nullptr) override;
     virtual OGRErr ISetFeature(OGRFeature *poFeature) override;
     virtual OGRErr ICreateFeature(OGRFeature *poFeature) override;
     virtual OGRErr IUpsertFeature(OGRFeature *poFeature) override;
@@ -32,8 +32,15 @@
 #include "ogr_geojson.h"
 #include "ogrjsoncollectionstreamingparser.h"
 #include "ogr_api.h"
+#include "cpl_error_internal.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 
+#include <condition_variable>
+#include <deque>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <functional>
 
@@ -56,6 +63,10 @@ class OGRGeoJSONReaderStreamingParser final
     std::vector<std::unique_ptr<OGRFieldDefn>> m_apoFieldDefn{};
     gdal::DirectedAcyclicGraph<int, std::string> m_dag{};
 
+    // Number of features analyzed to establish the layer schema, or 0
+    // to analyze all of them
+    GIntBig m_nMaxFeaturesForSchema = 0;
+
     void AnalyzeFeature();
 
     CPL_DISALLOW_COPY_ASSIGN(OGRGeoJSONReaderStreamingParser)
@@ -63,6 +74,7 @@ class OGRGeoJSONReaderStreamingParser final
   protected:
     void GotFeature(json_object *poObj, bool bFirstPass,
                     const std::string &osJson) override;
+    void GotLightFeature(const LightFeature &oFeature) override;
     void TooComplex() override;
 
   public:
@@ -73,6 +85,11 @@ class OGRGeoJSONReaderStreamingParser final
 
     void FinalizeLayerDefn();
 
+    inline void SetMaxFeaturesForSchema(GIntBig nMaxFeatures)
+    {
+        m_nMaxFeaturesForSchema = nMaxFeatures;
+    }
+
     OGRFeature *GetNextFeature();
 
     inline bool GetOriginalIdModifiedEmitted() const
@@ -86,6 +103,96 @@ class OGRGeoJSONReaderStreamingParser final
     }
 };
 
+/************************************************************************/
+/*                    OGRGeoJSONReaderParallelParser                    */
+/*                                                                      */
+/*      Used by OGRGeoJSONReader::GetNextFeature() when several         */
+/*      threads are allowed. The calling thread only scans the bytes    */
+/*      of the file to find the boundaries of the elements of the       */
+/*      "features" array of the FeatureCollection. Batches of those     */
+/*      elements are parsed and translated to OGRFeature by worker      */
+/*      threads, and features are returned in file order.               */
+/************************************************************************/
+
+class OGRGeoJSONReaderParallelParser
+{
+  public:
+    static OGRGeoJSONReaderParallelParser *
+    Create(OGRGeoJSONReader &oReader, OGRGeoJSONLayer *poLayer, VSILFILE *fp,
+           int nThreads, bool bOriginalIdModifiedEmitted);
+
+    ~OGRGeoJSONReaderParallelParser();
+
+    OGRFeature *GetNextFeature();
+
+    inline bool GetOriginalIdModifiedEmitted() const
+    {
+        return m_bOriginalIdModifiedEmitted;
+    }
+
+  private:
+    struct Chunk
+    {
+        OGRGeoJSONReaderParallelParser *poParser = nullptr;
+        std::vector<std::string> aosFeatures{};
+        std::vector<std::unique_ptr<OGRFeature>> apoFeatures{};
+        // Set if processing must stop after the features of this chunk.
+        bool bError = false;
+        // Error found by the byte scanner, to emit after the features.
+        std::string osScanError{};
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+        bool bDone = false;
+    };
+
+    static constexpr size_t CHUNK_MAX_FEATURES = 1000;
+    static constexpr size_t CHUNK_MAX_BYTES = 4 * 1024 * 1024;
+    static constexpr size_t BUFFER_SIZE = 1024 * 1024;
+
+    OGRGeoJSONReader &m_oReader;
+    OGRGeoJSONLayer *m_poLayer = nullptr;
+    VSILFILE *m_fp = nullptr;
+    size_t m_nMaxObjectSize = 0;
+    std::vector<char> m_abyBuffer{};
+    size_t m_nBufferPos = 0;
+    size_t m_nBufferLen = 0;
+    bool m_bEOF = false;
+
+    // State of the byte scanner
+    int m_nDepth = 0;
+    bool m_bInString = false;
+    bool m_bEscape = false;
+    bool m_bExpectKey = false;
+    bool m_bInKey = false;
+    std::string m_osKey{};
+    bool m_bInFeaturesArray = false;
+    bool m_bInFeature = false;
+    size_t m_nFeatureStartInBuffer = 0;
+    std::string m_osCurFeature{};
+
+    std::unique_ptr<CPLJobQueue> m_poJobQueue{};
+    std::deque<std::unique_ptr<Chunk>> m_apoChunks{};
+    size_t m_nMaxChunksInFlight = 0;
+    size_t m_iNextInFrontChunk = 0;
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+
+    std::set<GIntBig> m_oSetUsedFIDs{};
+    bool m_bOriginalIdModifiedEmitted = false;
+
+    OGRGeoJSONReaderParallelParser(OGRGeoJSONReader &oReader,
+                                   OGRGeoJSONLayer *poLayer, VSILFILE *fp)
+        : m_oReader(oReader), m_poLayer(poLayer), m_fp(fp)
+    {
+    }
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRGeoJSONReaderParallelParser)
+
+    bool FillChunk(Chunk &oChunk);
+    bool Scan(Chunk &oChunk, size_t &nChunkBytes);
+    void SubmitChunks();
+    static void ProcessChunk(void *pData);
+};
+
 /************************************************************************/
 /*                        OGRGeoJSONBaseReader()                        */
 /************************************************************************/
@@ -170,6 +277,7 @@ OGRGeoJSONReader::~OGRGeoJSONReader()
     {
         json_object_put(poGJObject_);
     }
+    delete poParallelParser_;
     if (fp_ != nullptr)
     {
         VSIFCloseL(fp_);
@@ -280,6 +388,48 @@ OGRFeature *OGRGeoJSONReaderStreamingParser::GetNextFeature()
     return nullptr;
 }
 
+/************************************************************************/
+/*                   OGRGeoJSONReaderAssignUniqueFID()                  */
+/************************************************************************/
+
+// Keep the FID of the feature if it has not been used yet, otherwise
+// (or if it has no FID) assign it the first unused value starting at
+// the number of features already read.
+static void OGRGeoJSONReaderAssignUniqueFID(OGRFeature *poFeat,
+                                            std::set<GIntBig> &oSetUsedFIDs,
+                                            bool &bOriginalIdModifiedEmitted)
+{
+    GIntBig nFID = poFeat->GetFID();
+    if (nFID == OGRNullFID)
+    {
+        nFID = static_cast<GIntBig>(oSetUsedFIDs.size());
+        while (oSetUsedFIDs.find(nFID) != oSetUsedFIDs.end())
+        {
+            ++nFID;
+        }
+    }
+    else if (oSetUsedFIDs.find(nFID) != oSetUsedFIDs.end())
+    {
+        if (!bOriginalIdModifiedEmitted)
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Several features with id = " CPL_FRMT_GIB " have "
+                     "been found. Altering it to be unique. "
+                     "This warning will not be emitted anymore for "
+                     "this layer",
+                     nFID);
+            bOriginalIdModifiedEmitted = true;
+        }
+        nFID = static_cast<GIntBig>(oSetUsedFIDs.size());
+        while (oSetUsedFIDs.find(nFID) != oSetUsedFIDs.end())
+        {
+            ++nFID;
+        }
+    }
+    oSetUsedFIDs.insert(nFID);
+    poFeat->SetFID(nFID);
+}
+
 /************************************************************************/
 /*                          GotFeature()                                */
 /************************************************************************/
@@ -295,6 +445,13 @@ void OGRGeoJSONReaderStreamingParser::GotFeature(json_object *poObj,
         {
         }
         m_poLayer->IncFeatureCount();
+
+        // Only count the next features and compute their extent
+        if (m_nMaxFeaturesForSchema > 0 &&
+            m_poLayer->GetFeatureCount(FALSE) >= m_nMaxFeaturesForSchema)
+        {
+            SetLightParsing(true);
+        }
     }
     else
     {
@@ -302,41 +459,27 @@ void OGRGeoJSONReaderStreamingParser::GotFeature(json_object *poObj,
             m_oReader.ReadFeature(m_poLayer, poObj, osJson.c_str());
         if (poFeat)
         {
-            GIntBig nFID = poFeat->GetFID();
-            if (nFID == OGRNullFID)
-            {
-                nFID = static_cast<GIntBig>(m_oSetUsedFIDs.size());
-                while (m_oSetUsedFIDs.find(nFID) != m_oSetUsedFIDs.end())
-                {
-                    ++nFID;
-                }
-            }
-            else if (m_oSetUsedFIDs.find(nFID) != m_oSetUsedFIDs.end())
-            {
-                if (!m_bOriginalIdModifiedEmitted)
-                {
-                    CPLError(CE_Warning, CPLE_AppDefined,
-                             "Several features with id = " CPL_FRMT_GIB " have "
-                             "been found. Altering it to be unique. "
-                             "This warning will not be emitted anymore for "
-                             "this layer",
-                             nFID);
-                    m_bOriginalIdModifiedEmitted = true;
-                }
-                nFID = static_cast<GIntBig>(m_oSetUsedFIDs.size());
-                while (m_oSetUsedFIDs.find(nFID) != m_oSetUsedFIDs.end())
-                {
-                    ++nFID;
-                }
-            }
-            m_oSetUsedFIDs.insert(nFID);
-            poFeat->SetFID(nFID);
-
+            OGRGeoJSONReaderAssignUniqueFID(poFeat, m_oSetUsedFIDs,
+                                            m_bOriginalIdModifiedEmitted);
             m_apoFeatures.push_back(poFeat);
         }
     }
 }
 
+/************************************************************************/
+/*                          GotLightFeature()                           */
+/************************************************************************/
+
+void OGRGeoJSONReaderStreamingParser::GotLightFeature(
+    const LightFeature &oFeature)
+{
+    m_oReader.UpdateFromLightFeature(
+        oFeature.osGeometryType, oFeature.nFirstPositionDim,
+        oFeature.bHasExtent ? &oFeature.sEnvelope : nullptr,
+        oFeature.bHasIntegerId ? &oFeature.nId : nullptr);
+    m_poLayer->IncFeatureCount();
+}
+
 /************************************************************************/
 /*                         FinalizeLayerDefn()                          */
 /************************************************************************/
@@ -369,6 +512,396 @@ void OGRGeoJSONReaderStreamingParser::TooComplex()
                       "for larger features, or 0 to remove any size limit.");
 }
 
+/************************************************************************/
+/*                      SWAR byte search helpers                        */
+/************************************************************************/
+
+// Non-zero if one of the 8 bytes of nWord is equal to ch.
+static inline uint64_t OGRGeoJSONHasByte(uint64_t nWord, GByte ch)
+{
+    constexpr uint64_t ONES = 0x0101010101010101ULL;
+    constexpr uint64_t HIGHS = 0x8080808080808080ULL;
+    const uint64_t x = nWord ^ (ONES * ch);
+    return (x - ONES) & ~x & HIGHS;
+}
+
+// Index of the first byte of [i, n[ that may end a string, that is
+// a double quote or a backslash, or n.
+static inline size_t OGRGeoJSONSkipStringContent(const char *p, size_t i,
+                                                 size_t n)
+{
+    while (i + sizeof(uint64_t) <= n)
+    {
+        uint64_t nWord;
+        memcpy(&nWord, p + i, sizeof(nWord));
+        if (OGRGeoJSONHasByte(nWord, '"') | OGRGeoJSONHasByte(nWord, '\\'))
+            break;
+        i += sizeof(uint64_t);
+    }
+    while (i < n && p[i] != '"' && p[i] != '\\')
+        ++i;
+    return i;
+}
+
+// Index of the first byte of [i, n[ that matters for finding the end of a
+// feature (string delimiter or bracket), or n.
+static inline size_t OGRGeoJSONSkipFeatureContent(const char *p, size_t i,
+                                                  size_t n)
+{
+    while (i + sizeof(uint64_t) <= n)
+    {
+        uint64_t nWord;
+        memcpy(&nWord, p + i, sizeof(nWord));
+        if (OGRGeoJSONHasByte(nWord, '"') | OGRGeoJSONHasByte(nWord, '{') |
+            OGRGeoJSONHasByte(nWord, '}') | OGRGeoJSONHasByte(nWord, '[') |
+            OGRGeoJSONHasByte(nWord, ']'))
+        {
+            break;
+        }
+        i += sizeof(uint64_t);
+    }
+    while (i < n && p[i] != '"' && p[i] != '{' && p[i] != '}' &&
+           p[i] != '[' && p[i] != ']')
+    {
+        ++i;
+    }
+    return i;
+}
+
+/************************************************************************/
+/*                OGRGeoJSONReaderParallelParser::Create()              */
+/************************************************************************/
+
+OGRGeoJSONReaderParallelParser *OGRGeoJSONReaderParallelParser::Create(
+    OGRGeoJSONReader &oReader, OGRGeoJSONLayer *poLayer, VSILFILE *fp,
+    int nThreads, bool bOriginalIdModifiedEmitted)
+{
+    CPLWorkerThreadPool *poPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poPool)
+        return nullptr;
+    auto poJobQueue = poPool->CreateJobQueue();
+    if (!poJobQueue)
+        return nullptr;
+
+    auto poParser = new OGRGeoJSONReaderParallelParser(oReader, poLayer, fp);
+    poParser->m_nMaxObjectSize =
+        OGRGeoJSONReaderStreamingParserGetMaxObjectSize();
+    poParser->m_abyBuffer.resize(BUFFER_SIZE);
+    poParser->m_poJobQueue = std::move(poJobQueue);
+    // Keep enough work queued to avoid workers starving while the
+    // calling thread consumes features.
+    poParser->m_nMaxChunksInFlight = 2 * static_cast<size_t>(nThreads);
+    poParser->m_bOriginalIdModifiedEmitted = bOriginalIdModifiedEmitted;
+    VSIFSeekL(fp, 0, SEEK_SET);
+    poParser->SubmitChunks();
+    return poParser;
+}
+
+/************************************************************************/
+/*                  ~OGRGeoJSONReaderParallelParser()                   */
+/************************************************************************/
+
+OGRGeoJSONReaderParallelParser::~OGRGeoJSONReaderParallelParser()
+{
+    if (m_poJobQueue)
+        m_poJobQueue->WaitCompletion();
+}
+
+/************************************************************************/
+/*               OGRGeoJSONReaderParallelParser::Scan()                 */
+/*                                                                      */
+/*      Consumes the current buffer from m_nBufferPos, and appends      */
+/*      the complete features found to the chunk, until the chunk is    */
+/*      full or the buffer exhausted. Returns false on error.           */
+/************************************************************************/
+
+bool OGRGeoJSONReaderParallelParser::Scan(Chunk &oChunk, size_t &nChunkBytes)
+{
+    const char *p = m_abyBuffer.data();
+    const size_t n = m_nBufferLen;
+    size_t i = m_nBufferPos;
+    while (i < n)
+    {
+        if (m_bInString)
+        {
+            if (m_bEscape)
+            {
+                m_bEscape = false;
+                if (m_bInKey)
+                    m_osKey += p[i];
+                ++i;
+                continue;
+            }
+            if (m_bInKey)
+            {
+                if (p[i] == '"')
+                    m_bInString = m_bInKey = false;
+                else
+                {
+                    m_bEscape = p[i] == '\\';
+                    m_osKey += p[i];
+                }
+                ++i;
+                continue;
+            }
+            i = OGRGeoJSONSkipStringContent(p, i, n);
+            if (i == n)
+                break;
+            if (p[i] == '\\')
+                m_bEscape = true;
+            else
+                m_bInString = false;
+            ++i;
+            continue;
+        }
+
+        if (m_bInFeature)
+        {
+            i = OGRGeoJSONSkipFeatureContent(p, i, n);
+            if (i == n)
+                break;
+        }
+
+        const char ch = p[i];
+        switch (ch)
+        {
+            case '"':
+                m_bInString = true;
+                if (m_nDepth == 1 && m_bExpectKey)
+                {
+                    m_bInKey = true;
+                    m_bExpectKey = false;
+                    m_osKey.clear();
+                }
+                break;
+
+            case '{':
+            case '[':
+                if (m_nDepth == 2 && m_bInFeaturesArray && ch == '{')
+                {
+                    m_bInFeature = true;
+                    m_nFeatureStartInBuffer = i;
+                    m_osCurFeature.clear();
+                }
+                else if (m_nDepth == 1 && ch == '[' && m_osKey == "features")
+                {
+                    m_bInFeaturesArray = true;
+                }
+                else if (m_nDepth == 0 && ch == '{')
+                {
+                    m_bExpectKey = true;
+                }
+                ++m_nDepth;
+                break;
+
+            case '}':
+            case ']':
+                --m_nDepth;
+                if (m_bInFeature && m_nDepth == 2)
+                {
+                    m_bInFeature = false;
+                    m_osCurFeature.append(p + m_nFeatureStartInBuffer,
+                                          i + 1 - m_nFeatureStartInBuffer);
+                    nChunkBytes += m_osCurFeature.size();
+                    oChunk.aosFeatures.emplace_back(std::move(m_osCurFeature));
+                    m_osCurFeature.clear();
+                    if (oChunk.aosFeatures.size() == CHUNK_MAX_FEATURES ||
+                        nChunkBytes >= CHUNK_MAX_BYTES)
+                    {
+                        m_nBufferPos = i + 1;
+                        return true;
+                    }
+                }
+                else if (m_nDepth == 1)
+                {
+                    m_bInFeaturesArray = false;
+                }
+                else if (m_nDepth <= 0)
+                {
+                    // End of the root object (or extra closing bracket)
+                    m_bEOF = true;
+                    m_nBufferPos = n;
+                    return true;
+                }
+                break;
+
+            case ',':
+                if (m_nDepth == 1)
+                    m_bExpectKey = true;
+                break;
+
+            default:
+                break;
+        }
+        ++i;
+    }
+
+    if (m_bInFeature)
+    {
+        m_osCurFeature.append(p + m_nFeatureStartInBuffer,
+                              n - m_nFeatureStartInBuffer);
+        m_nFeatureStartInBuffer = 0;
+        if (m_nMaxObjectSize > 0 && m_osCurFeature.size() > m_nMaxObjectSize)
+        {
+            oChunk.osScanError =
+                "GeoJSON object too complex/large. You may define the "
+                "OGR_GEOJSON_MAX_OBJ_SIZE configuration option to "
+                "a value in megabytes to allow "
+                "for larger features, or 0 to remove any size limit.";
+            return false;
+        }
+    }
+    m_nBufferPos = n;
+    return true;
+}
+
+/************************************************************************/
+/*             OGRGeoJSONReaderParallelParser::FillChunk()              */
+/************************************************************************/
+
+bool OGRGeoJSONReaderParallelParser::FillChunk(Chunk &oChunk)
+{
+    size_t nChunkBytes = 0;
+    while (!m_bEOF && oChunk.aosFeatures.size() < CHUNK_MAX_FEATURES &&
+           nChunkBytes < CHUNK_MAX_BYTES)
+    {
+        if (m_nBufferPos == m_nBufferLen)
+        {
+            m_nBufferLen = VSIFReadL(m_abyBuffer.data(), 1, BUFFER_SIZE, m_fp);
+            m_nBufferPos = 0;
+            if (m_nBufferLen == 0)
+            {
+                m_bEOF = true;
+                break;
+            }
+        }
+        if (!Scan(oChunk, nChunkBytes))
+            return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*            OGRGeoJSONReaderParallelParser::SubmitChunks()            */
+/************************************************************************/
+
+void OGRGeoJSONReaderParallelParser::SubmitChunks()
+{
+    while (!m_bEOF && m_apoChunks.size() < m_nMaxChunksInFlight)
+    {
+        auto poChunk = std::make_unique<Chunk>();
+        poChunk->poParser = this;
+        if (!FillChunk(*poChunk))
+        {
+            poChunk->bError = true;
+            m_bEOF = true;
+        }
+        if (poChunk->aosFeatures.empty() && !poChunk->bError)
+            break;
+        Chunk *poChunkPtr = poChunk.get();
+        m_apoChunks.push_back(std::move(poChunk));
+        if (!m_poJobQueue->SubmitJob(ProcessChunk, poChunkPtr))
+            ProcessChunk(poChunkPtr);
+    }
+}
+
+/************************************************************************/
+/*            OGRGeoJSONReaderParallelParser::ProcessChunk()            */
+/************************************************************************/
+
+void OGRGeoJSONReaderParallelParser::ProcessChunk(void *pData)
+{
+    Chunk *poChunk = static_cast<Chunk *>(pData);
+    OGRGeoJSONReaderParallelParser *poParser = poChunk->poParser;
+
+    CPLInstallErrorHandlerAccumulator(poChunk->aoErrors);
+
+    poChunk->apoFeatures.reserve(poChunk->aosFeatures.size());
+    for (auto &osJson : poChunk->aosFeatures)
+    {
+        json_object *poObj = nullptr;
+        if (!OGRJSonParse(osJson.c_str(), &poObj))
+        {
+            poChunk->bError = true;
+            break;
+        }
+        json_object *poObjType =
+            json_object_get_type(poObj) == json_type_object
+                ? CPL_json_object_object_get(poObj, "type")
+                : nullptr;
+        if (poObjType && json_object_get_type(poObjType) == json_type_string &&
+            strcmp(json_object_get_string(poObjType), "Feature") == 0)
+        {
+            OGRFeature *poFeat = poParser->m_oReader.ReadFeature(
+                poParser->m_poLayer, poObj, nullptr);
+            if (poFeat)
+                poChunk->apoFeatures.emplace_back(poFeat);
+        }
+        json_object_put(poObj);
+        osJson = std::string();
+    }
+    poChunk->aosFeatures = std::vector<std::string>();
+
+    CPLUninstallErrorHandlerAccumulator();
+
+    std::lock_guard<std::mutex> oLock(poParser->m_oMutex);
+    poChunk->bDone = true;
+    poParser->m_oCV.notify_one();
+}
+
+/************************************************************************/
+/*           OGRGeoJSONReaderParallelParser::GetNextFeature()           */
+/************************************************************************/
+
+OGRFeature *OGRGeoJSONReaderParallelParser::GetNextFeature()
+{
+    while (true)
+    {
+        if (m_apoChunks.empty())
+            return nullptr;
+
+        Chunk *poChunk = m_apoChunks.front().get();
+        if (m_iNextInFrontChunk == 0)
+        {
+            {
+                std::unique_lock<std::mutex> oLock(m_oMutex);
+                while (!poChunk->bDone)
+                    m_oCV.wait(oLock);
+            }
+            for (const auto &oError : poChunk->aoErrors)
+            {
+                CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+            }
+            poChunk->aoErrors.clear();
+        }
+
+        if (m_iNextInFrontChunk < poChunk->apoFeatures.size())
+        {
+            OGRFeature *poFeat =
+                poChunk->apoFeatures[m_iNextInFrontChunk].release();
+            ++m_iNextInFrontChunk;
+            OGRGeoJSONReaderAssignUniqueFID(poFeat, m_oSetUsedFIDs,
+                                            m_bOriginalIdModifiedEmitted);
+            return poFeat;
+        }
+
+        if (poChunk->bError)
+        {
+            if (!poChunk->osScanError.empty())
+                CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                         poChunk->osScanError.c_str());
+            m_bEOF = true;
+            m_poJobQueue->WaitCompletion();
+            m_apoChunks.clear();
+            return nullptr;
+        }
+
+        m_apoChunks.pop_front();
+        m_iNextInFrontChunk = 0;
+        SubmitChunks();
+    }
+}
+
 /************************************************************************/
 /*                       SetCoordinatePrecision()                       */
 /************************************************************************/
@@ -457,6 +990,8 @@ bool OGRGeoJSONReader::FirstPassReadLayer(OGRGeoJSONDataSource *poDS,
         CPLGetConfigOption("OGR_GEOJSON_MAX_BYTES_FIRST_PASS", "0"));
     const GIntBig nLimitFeaturesFirstPass = CPLAtoGIntBig(
         CPLGetConfigOption("OGR_GEOJSON_MAX_FEATURES_FIRST_PASS", "0"));
+    oParser.SetMaxFeaturesForSchema(CPLAtoGIntBig(
+        CPLGetConfigOption("OGR_GEOJSON_MAX_FEATURES_FOR_SCHEMA", "0")));
     while (true)
     {
         nIter++;
@@ -670,6 +1205,31 @@ void OGRGeoJSONReader::ResetReading()
             poStreamingParser_->GetOriginalIdModifiedEmitted();
     delete poStreamingParser_;
     poStreamingParser_ = nullptr;
+    if (poParallelParser_)
+        bOriginalIdModifiedEmitted_ =
+            poParallelParser_->GetOriginalIdModifiedEmitted();
+    delete poParallelParser_;
+    poParallelParser_ = nullptr;
+}
+
+/************************************************************************/
+/*                       GetParallelThreadCount()                       */
+/************************************************************************/
+
+// Number of threads for GetNextFeature(), or 1 if features must be read
+// by the streaming parser.
+static int GetParallelThreadCount()
+{
+    const char *pszNumThreads =
+        CPLGetConfigOption("OGR_GEOJSON_NUM_THREADS", nullptr);
+    if (!pszNumThreads)
+        pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (!pszNumThreads)
+        return 1;
+    const int nThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                             ? CPLGetNumCPUs()
+                             : atoi(pszNumThreads);
+    return std::max(1, GDALCapThreadCount(std::min(nThreads, 128)));
 }
 
 /************************************************************************/
@@ -679,8 +1239,22 @@ void OGRGeoJSONReader::ResetReading()
 OGRFeature *OGRGeoJSONReader::GetNextFeature(OGRGeoJSONLayer *poLayer)
 {
     CPLAssert(fp_);
+    if (poParallelParser_)
+        return poParallelParser_->GetNextFeature();
+
     if (poStreamingParser_ == nullptr)
     {
+        // Native data is built by the streaming parser, so stick to it
+        // when it is requested.
+        const int nThreads = bStoreNativeData_ ? 1 : GetParallelThreadCount();
+        if (nThreads > 1)
+        {
+            poParallelParser_ = OGRGeoJSONReaderParallelParser::Create(
+                *this, poLayer, fp_, nThreads, bOriginalIdModifiedEmitted_);
+            if (poParallelParser_)
+                return poParallelParser_->GetNextFeature();
+        }
+
         poStreamingParser_ = new OGRGeoJSONReaderStreamingParser(
             *this, poLayer, false, bStoreNativeData_);
         poStreamingParser_->SetOriginalIdModifiedEmitted(
@@ -738,11 +1312,7 @@ OGRFeature *OGRGeoJSONReader::GetFeature(OGRGeoJSONLayer *poLayer, GIntBig nFID)
         CPLDebug("GeoJSON",
                  "Establishing index to features for first GetFeature() call");
 
-        if (poStreamingParser_)
-            bOriginalIdModifiedEmitted_ =
-                poStreamingParser_->GetOriginalIdModifiedEmitted();
-        delete poStreamingParser_;
-        poStreamingParser_ = nullptr;
+        ResetReading();
 
         OGRGeoJSONReaderStreamingParser oParser(*this, poLayer, false,
                                                 bStoreNativeData_);
@@ -1963,6 +2533,59 @@ bool OGRGeoJSONUpdateLayerGeomType(bool &bFirstGeom,
     return true;
 }
 
+/************************************************************************/
+/*                OGRGeoJSONGetOGRGeometryTypeFromName()                */
+/************************************************************************/
+
+static OGRwkbGeometryType OGRGeoJSONGetOGRGeometryTypeFromName(const char *name)
+{
+    if (EQUAL(name, "Point"))
+        return wkbPoint;
+    else if (EQUAL(name, "LineString"))
+        return wkbLineString;
+    else if (EQUAL(name, "Polygon"))
+        return wkbPolygon;
+    else if (EQUAL(name, "MultiPoint"))
+        return wkbMultiPoint;
+    else if (EQUAL(name, "MultiLineString"))
+        return wkbMultiLineString;
+    else if (EQUAL(name, "MultiPolygon"))
+        return wkbMultiPolygon;
+    else if (EQUAL(name, "GeometryCollection"))
+        return wkbGeometryCollection;
+    return wkbUnknown;
+}
+
+/************************************************************************/
+/*                       UpdateFromLightFeature()                       */
+/************************************************************************/
+
+// Equivalent of GenerateFeatureDefn() for a feature whose properties are
+// not looked at, so that feature count, geometry type and extent are still
+// computed on all features.
+void OGRGeoJSONBaseReader::UpdateFromLightFeature(
+    const std::string &osGeometryType, int nFirstPositionDim,
+    const OGREnvelope3D *psEnvelope, const GIntBig *pnId)
+{
+    if (pnId && !CPL_INT64_FITS_ON_INT32(*pnId))
+        m_bNeedFID64 = true;
+
+    if (osGeometryType.empty())
+        return;
+
+    OGRwkbGeometryType eType =
+        OGRGeoJSONGetOGRGeometryTypeFromName(osGeometryType.c_str());
+    if (eType != wkbUnknown && nFirstPositionDim == 3)
+        eType = OGR_GT_SetZ(eType);
+    OGRGeoJSONUpdateLayerGeomType(m_bFirstGeometry, eType, m_eLayerGeomType);
+
+    if (eType != wkbUnknown && psEnvelope)
+    {
+        m_oEnvelope3D.Merge(*psEnvelope);
+        m_bExtentRead = true;
+    }
+}
+
 /************************************************************************/
 /*                           AddFeature                                 */
 /************************************************************************/
@@ -2540,23 +3163,9 @@ OGRwkbGeometryType OGRGeoJSONGetOGRGeometryType(json_object *poObj)
     if (nullptr == poObjType)
         return wkbUnknown;
 
-    OGRwkbGeometryType eType = wkbUnknown;
-    const char *name = json_object_get_string(poObjType);
-    if (EQUAL(name, "Point"))
-        eType = wkbPoint;
-    else if (EQUAL(name, "LineString"))
-        eType = wkbLineString;
-    else if (EQUAL(name, "Polygon"))
-        eType = wkbPolygon;
-    else if (EQUAL(name, "MultiPoint"))
-        eType = wkbMultiPoint;
-    else if (EQUAL(name, "MultiLineString"))
-        eType = wkbMultiLineString;
-    else if (EQUAL(name, "MultiPolygon"))
-        eType = wkbMultiPolygon;
-    else if (EQUAL(name, "GeometryCollection"))
-        eType = wkbGeometryCollection;
-    else
+    OGRwkbGeometryType eType = OGRGeoJSONGetOGRGeometryTypeFromName(
+        json_object_get_string(poObjType));
+    if (eType == wkbUnknown)
         return wkbUnknown;
 
     json_object *poCoordinates;
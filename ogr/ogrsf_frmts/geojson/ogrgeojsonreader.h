@@ -109,6 +109,10 @@ class OGRGeoJSONBaseReader
         std::vector<std::unique_ptr<OGRFieldDefn>> &apoFieldDefn,
         gdal::DirectedAcyclicGraph<int, std::string> &dag, OGRLayer *poLayer,
         json_object *poObj);
+    void UpdateFromLightFeature(const std::string &osGeometryType,
+                                int nFirstPositionDim,
+                                const OGREnvelope3D *psEnvelope,
+                                const GIntBig *pnId);
     void FinalizeLayerDefn(OGRLayer *poLayer, CPLString &osFIDColumn);
 
     OGRGeometry *ReadGeometry(json_object *poObj,
@@ -158,6 +162,7 @@ class OGRGeoJSONBaseReader
 
 class OGRGeoJSONDataSource;
 class OGRGeoJSONReaderStreamingParser;
+class OGRGeoJSONReaderParallelParser;
 
 class OGRGeoJSONReader : public OGRGeoJSONBaseReader
 {
@@ -202,6 +207,7 @@ class OGRGeoJSONReader : public OGRGeoJSONBaseReader
 
     json_object *poGJObject_;
     OGRGeoJSONReaderStreamingParser *poStreamingParser_;
+    OGRGeoJSONReaderParallelParser *poParallelParser_ = nullptr;
     bool bFirstSeg_;
     bool bJSonPLikeWrapper_;
     VSILFILE *fp_;
@@ -373,6 +373,9 @@ OGRGeoJSONSeqLayer::OGRGeoJSONSeqLayer(
         CSLFetchNameValueDef(papszOptions, "WRITE_NON_FINITE_VALUES", "FALSE"));
     m_oWriteOptions.bAutodetectJsonStrings = CPLTestBool(
         CSLFetchNameValueDef(papszOptions, "AUTODETECT_JSON_STRINGS", "TRUE"));
+    // Features are serialized before being released in ICreateFeature()
+    m_oWriteOptions.bStreamCoordinates = CPLTestBool(
+        CPLGetConfigOption("OGR_GEOJSON_STREAM_COORDINATES", "YES"));
 }
 
 /************************************************************************/
@@ -94,6 +94,9 @@ OGRGeoJSONWriteLayer::OGRGeoJSONWriteLayer(const char *pszName,
         CSLFetchNameValueDef(papszOptions, "WRITE_NON_FINITE_VALUES", "FALSE"));
     oWriteOptions_.bAutodetectJsonStrings = CPLTestBool(
         CSLFetchNameValueDef(papszOptions, "AUTODETECT_JSON_STRINGS", "TRUE"));
+    // Features are serialized before being released in ICreateFeature()
+    oWriteOptions_.bStreamCoordinates = CPLTestBool(
+        CPLGetConfigOption("OGR_GEOJSON_STREAM_COORDINATES", "YES"));
 }
 
 /************************************************************************/
@@ -44,6 +44,7 @@
 #include "ogr_p.h"
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <limits>
 
@@ -51,6 +52,30 @@ static json_object *
 json_object_new_float_with_significant_figures(float fVal,
                                                int nSignificantFigures);
 
+static int OGRGeoJSONFormatDoubleWithPrecision(char *pszBuffer,
+                                               size_t nBufferSize, double dfVal,
+                                               const OGRWktOptions &oOpts);
+
+static int OGRGeoJSONFormatDoubleWithSignificantFigures(
+    char *pszBuffer, size_t nBufferSize, double dfVal,
+    int nSignificantFigures);
+
+/************************************************************************/
+/*                     OGRGeoJSONInitFormatOptions()                    */
+/************************************************************************/
+
+// Set the options equivalent to OGRFormatDouble() with '%f' formatting,
+// as used by json_object_new_double_with_precision().
+static void OGRGeoJSONInitFormatOptions(OGRWktOptions &oOpts, int nPrecision)
+{
+    if (nPrecision < 0)
+        nPrecision = 15;
+    oOpts.xyPrecision = nPrecision;
+    oOpts.zPrecision = nPrecision;
+    oOpts.mPrecision = nPrecision;
+    oOpts.format = OGRWktFormat::F;
+}
+
 /************************************************************************/
 /*                         SetRFC7946Settings()                         */
 /************************************************************************/
@@ -738,7 +763,10 @@ json_object *OGRGeoJSONWriteFeature(OGRFeature *poFeature,
     OGRGeometry *poGeometry = poFeature->GetGeometryRef();
     if (nullptr != poGeometry)
     {
-        poObjGeom = OGRGeoJSONWriteGeometry(poGeometry, oOptions);
+        if (oOptions.bStreamCoordinates && poNativeGeom == nullptr)
+            poObjGeom = OGRGeoJSONWriteGeometryStreamed(poGeometry, oOptions);
+        else
+            poObjGeom = OGRGeoJSONWriteGeometry(poGeometry, oOptions);
 
         if (bWriteBBOX && !poGeometry->IsEmpty())
         {
@@ -1500,6 +1528,377 @@ json_object *OGRGeoJSONWriteRingCoords(const OGRLinearRing *poLine,
     return poObjCoords;
 }
 
+/************************************************************************/
+/*                    OGRGeoJSONCanStreamCoordinates()                  */
+/************************************************************************/
+
+// Returns whether OGRGeoJSONWriteGeometry() would build a "coordinates"
+// member for this geometry, that is it is not a point empty, it has only
+// finite coordinates, and MultiPoints have no empty point.
+static bool OGRGeoJSONCanStreamCoordinates(const OGRGeometry *poGeometry)
+{
+    const auto IsFinite = [](const OGRSimpleCurve *poCurve)
+    {
+        const int nCount = poCurve->getNumPoints();
+        const bool bHasZ = wkbHasZ(poCurve->getGeometryType());
+        for (int i = 0; i < nCount; ++i)
+        {
+            if (!std::isfinite(poCurve->getX(i)) ||
+                !std::isfinite(poCurve->getY(i)) ||
+                (bHasZ && !std::isfinite(poCurve->getZ(i))))
+                return false;
+        }
+        return true;
+    };
+
+    const auto IsPolygonFinite = [&IsFinite](const OGRPolygon *poPolygon)
+    {
+        for (const auto *poRing : *poPolygon)
+        {
+            if (!IsFinite(poRing))
+                return false;
+        }
+        return true;
+    };
+
+    switch (wkbFlatten(poGeometry->getGeometryType()))
+    {
+        case wkbPoint:
+        {
+            const auto poPoint = poGeometry->toPoint();
+            return !poPoint->IsEmpty() && std::isfinite(poPoint->getX()) &&
+                   std::isfinite(poPoint->getY()) &&
+                   (!wkbHasZ(poPoint->getGeometryType()) ||
+                    std::isfinite(poPoint->getZ()));
+        }
+
+        case wkbLineString:
+            return IsFinite(poGeometry->toLineString());
+
+        case wkbPolygon:
+            return IsPolygonFinite(poGeometry->toPolygon());
+
+        case wkbMultiPoint:
+        {
+            for (const auto *poPoint : *(poGeometry->toMultiPoint()))
+            {
+                if (!OGRGeoJSONCanStreamCoordinates(poPoint))
+                    return false;
+            }
+            return true;
+        }
+
+        case wkbMultiLineString:
+        {
+            for (const auto *poLine : *(poGeometry->toMultiLineString()))
+            {
+                if (!IsFinite(poLine))
+                    return false;
+            }
+            return true;
+        }
+
+        case wkbMultiPolygon:
+        {
+            for (const auto *poPolygon : *(poGeometry->toMultiPolygon()))
+            {
+                if (!IsPolygonFinite(poPolygon))
+                    return false;
+            }
+            return true;
+        }
+
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                    OGRGeoJSONCoordinatesWriter                       */
+/************************************************************************/
+
+namespace
+{
+
+// Writes the "coordinates" member of a geometry directly into a json-c
+// print buffer, with the same output as the json-c arrays built by
+// OGRGeoJSONWriteGeometry() would have.
+class OGRGeoJSONCoordinatesWriter
+{
+    printbuf *m_pb;
+    const OGRGeoJSONWriteOptions &m_oOptions;
+    const bool m_bSpaced;
+    OGRWktOptions m_oXYFormatOptions{};
+    OGRWktOptions m_oZFormatOptions{};
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRGeoJSONCoordinatesWriter)
+
+    void BeginArray()
+    {
+        printbuf_strappend(m_pb, "[");
+    }
+
+    void Separator(bool bFirst)
+    {
+        if (!bFirst)
+            printbuf_strappend(m_pb, ",");
+        if (m_bSpaced)
+            printbuf_strappend(m_pb, " ");
+    }
+
+    void EndArray()
+    {
+        if (m_bSpaced)
+            printbuf_strappend(m_pb, " ]");
+        else
+            printbuf_strappend(m_pb, "]");
+    }
+
+    void WriteValue(double dfVal, int nDimIdx)
+    {
+        // Same logic as json_object_new_coord()
+        char szBuffer[75];
+        int nSize;
+        const int nPrecision = nDimIdx <= 2 ? m_oOptions.nXYCoordPrecision
+                                            : m_oOptions.nZCoordPrecision;
+        if (nPrecision >= 0 || m_oOptions.nSignificantFigures < 0)
+        {
+            nSize = OGRGeoJSONFormatDoubleWithPrecision(
+                szBuffer, sizeof(szBuffer), dfVal,
+                nDimIdx <= 2 ? m_oXYFormatOptions : m_oZFormatOptions);
+        }
+        else
+        {
+            nSize = OGRGeoJSONFormatDoubleWithSignificantFigures(
+                szBuffer, sizeof(szBuffer), dfVal,
+                m_oOptions.nSignificantFigures);
+        }
+        printbuf_memappend(m_pb, szBuffer, nSize);
+    }
+
+    void WritePosition(double dfX, double dfY, const double *pdfZ)
+    {
+        BeginArray();
+        Separator(true);
+        WriteValue(dfX, 1);
+        Separator(false);
+        WriteValue(dfY, 2);
+        if (pdfZ)
+        {
+            Separator(false);
+            WriteValue(*pdfZ, 3);
+        }
+        EndArray();
+    }
+
+    void WritePoint(const OGRPoint *poPoint)
+    {
+        const double dfZ = poPoint->getZ();
+        WritePosition(poPoint->getX(), poPoint->getY(),
+                      wkbHasZ(poPoint->getGeometryType()) ? &dfZ : nullptr);
+    }
+
+    void WriteCurve(const OGRSimpleCurve *poCurve, bool bInvertOrder)
+    {
+        const int nCount = poCurve->getNumPoints();
+        const bool bHasZ = wkbHasZ(poCurve->getGeometryType());
+        BeginArray();
+        for (int i = 0; i < nCount; ++i)
+        {
+            const int nIdx = bInvertOrder ? nCount - 1 - i : i;
+            const double dfZ = bHasZ ? poCurve->getZ(nIdx) : 0.0;
+            Separator(i == 0);
+            WritePosition(poCurve->getX(nIdx), poCurve->getY(nIdx),
+                          bHasZ ? &dfZ : nullptr);
+        }
+        EndArray();
+    }
+
+    void WriteRing(const OGRLinearRing *poRing, bool bIsExteriorRing)
+    {
+        // Same logic as OGRGeoJSONWriteRingCoords()
+        const bool bInvertOrder =
+            m_oOptions.bPolygonRightHandRule &&
+            ((bIsExteriorRing && poRing->isClockwise()) ||
+             (!bIsExteriorRing && !poRing->isClockwise()));
+        WriteCurve(poRing, bInvertOrder);
+    }
+
+    void WritePolygon(const OGRPolygon *poPolygon)
+    {
+        BeginArray();
+        bool bFirst = true;
+        for (const auto *poRing : *poPolygon)
+        {
+            Separator(bFirst);
+            WriteRing(poRing, bFirst);
+            bFirst = false;
+        }
+        EndArray();
+    }
+
+    template <class T, class F>
+    void WriteCollection(const T *poColl, F pfnWritePart)
+    {
+        BeginArray();
+        bool bFirst = true;
+        for (const auto *poPart : *poColl)
+        {
+            Separator(bFirst);
+            (this->*pfnWritePart)(poPart);
+            bFirst = false;
+        }
+        EndArray();
+    }
+
+    void WriteLineString(const OGRLineString *poLine)
+    {
+        WriteCurve(poLine, false);
+    }
+
+  public:
+    OGRGeoJSONCoordinatesWriter(printbuf *pb,
+                                const OGRGeoJSONWriteOptions &oOptions,
+                                int nFlags)
+        : m_pb(pb), m_oOptions(oOptions),
+          m_bSpaced((nFlags & JSON_C_TO_STRING_SPACED) != 0)
+    {
+        OGRGeoJSONInitFormatOptions(m_oXYFormatOptions,
+                                    oOptions.nXYCoordPrecision);
+        OGRGeoJSONInitFormatOptions(m_oZFormatOptions,
+                                    oOptions.nZCoordPrecision);
+    }
+
+    void Write(const OGRGeometry *poGeometry)
+    {
+        switch (wkbFlatten(poGeometry->getGeometryType()))
+        {
+            case wkbPoint:
+                WritePoint(poGeometry->toPoint());
+                break;
+            case wkbLineString:
+                WriteLineString(poGeometry->toLineString());
+                break;
+            case wkbPolygon:
+                WritePolygon(poGeometry->toPolygon());
+                break;
+            case wkbMultiPoint:
+                WriteCollection(poGeometry->toMultiPoint(),
+                                &OGRGeoJSONCoordinatesWriter::WritePoint);
+                break;
+            case wkbMultiLineString:
+                WriteCollection(poGeometry->toMultiLineString(),
+                                &OGRGeoJSONCoordinatesWriter::WriteLineString);
+                break;
+            case wkbMultiPolygon:
+                WriteCollection(poGeometry->toMultiPolygon(),
+                                &OGRGeoJSONCoordinatesWriter::WritePolygon);
+                break;
+            default:
+                CPLAssert(false);
+                break;
+        }
+    }
+};
+
+struct OGRGeoJSONStreamedCoordinates
+{
+    const OGRGeometry *poGeometry;
+    const OGRGeoJSONWriteOptions *poOptions;
+};
+
+}  // namespace
+
+/************************************************************************/
+/*                 OGR_json_streamed_coordinates_to_string()            */
+/************************************************************************/
+
+static int OGR_json_streamed_coordinates_to_string(struct json_object *jso,
+                                                   struct printbuf *pb,
+                                                   int /* level */, int flags)
+{
+    const void *userData =
+#if (!defined(JSON_C_VERSION_NUM)) || (JSON_C_VERSION_NUM < JSON_C_VER_013)
+        jso->_userdata;
+#else
+        json_object_get_userdata(jso);
+#endif
+    const auto psStreamed =
+        static_cast<const OGRGeoJSONStreamedCoordinates *>(userData);
+    OGRGeoJSONCoordinatesWriter oWriter(pb, *(psStreamed->poOptions), flags);
+    oWriter.Write(psStreamed->poGeometry);
+    return 0;
+}
+
+/************************************************************************/
+/*                  OGR_json_streamed_coordinates_free()                */
+/************************************************************************/
+
+static void OGR_json_streamed_coordinates_free(struct json_object *,
+                                               void *userData)
+{
+    delete static_cast<OGRGeoJSONStreamedCoordinates *>(userData);
+}
+
+/************************************************************************/
+/*                   OGRGeoJSONWriteGeometryStreamed()                  */
+/************************************************************************/
+
+/** Equivalent of OGRGeoJSONWriteGeometry(), except that "coordinates"
+ * members are serialized directly from poGeometry when the returned object
+ * is converted to a string, instead of being built as arrays of json-c
+ * objects, which saves a lot of allocations for large geometries.
+ * poGeometry and oOptions must hence be kept alive until then.
+ */
+json_object *
+OGRGeoJSONWriteGeometryStreamed(const OGRGeometry *poGeometry,
+                                const OGRGeoJSONWriteOptions &oOptions)
+{
+    const OGRwkbGeometryType eFType = wkbFlatten(poGeometry->getGeometryType());
+    if (eFType == wkbGeometryCollection)
+    {
+        json_object *poObjGeoms = json_object_new_array();
+        for (const auto *poSubGeom : *(poGeometry->toGeometryCollection()))
+        {
+            json_object *poObjSubGeom =
+                OGRGeoJSONWriteGeometryStreamed(poSubGeom, oOptions);
+            if (poObjSubGeom == nullptr)
+            {
+                json_object_put(poObjGeoms);
+                return nullptr;
+            }
+            json_object_array_add(poObjGeoms, poObjSubGeom);
+        }
+        json_object *poObj = json_object_new_object();
+        json_object_object_add(
+            poObj, "type",
+            json_object_new_string(OGRGeoJSONGetGeometryName(poGeometry)));
+        json_object_object_add(poObj, "geometries", poObjGeoms);
+        return poObj;
+    }
+
+    if (!OGRGeoJSONCanStreamCoordinates(poGeometry))
+    {
+        // Let the general code emit the appropriate null geometry and
+        // warnings.
+        return OGRGeoJSONWriteGeometry(poGeometry, oOptions);
+    }
+
+    json_object *poObjCoords = json_object_new_array();
+    json_object_set_serializer(
+        poObjCoords, OGR_json_streamed_coordinates_to_string,
+        new OGRGeoJSONStreamedCoordinates{poGeometry, &oOptions},
+        OGR_json_streamed_coordinates_free);
+
+    json_object *poObj = json_object_new_object();
+    json_object_object_add(
+        poObj, "type",
+        json_object_new_string(OGRGeoJSONGetGeometryName(poGeometry)));
+    json_object_object_add(poObj, "coordinates", poObjCoords);
+    return poObj;
+}
+
 /************************************************************************/
 /*                           OGR_G_ExportToJson                         */
 /************************************************************************/
@@ -1626,21 +2025,42 @@ static int OGR_json_double_with_precision_to_string(struct json_object *jso,
 #endif
     // Precision is stored as a uintptr_t content casted to void*
     const uintptr_t nPrecision = reinterpret_cast<uintptr_t>(userData);
+    const bool bPrecisionIsNegative =
+        (nPrecision >> (8 * sizeof(nPrecision) - 1)) != 0;
+    OGRWktOptions oOpts;
+    OGRGeoJSONInitFormatOptions(
+        oOpts, bPrecisionIsNegative ? -1 : static_cast<int>(nPrecision));
     char szBuffer[75] = {};
-    const double dfVal = json_object_get_double(jso);
+    const int nSize = OGRGeoJSONFormatDoubleWithPrecision(
+        szBuffer, sizeof(szBuffer), json_object_get_double(jso), oOpts);
+    return printbuf_memappend(pb, szBuffer, nSize);
+}
+
+/************************************************************************/
+/*                 OGRGeoJSONFormatDoubleWithPrecision()                */
+/************************************************************************/
+
+static int OGRGeoJSONFormatDoubleWithPrecision(char *pszBuffer,
+                                               size_t nBufferSize, double dfVal,
+                                               const OGRWktOptions &oOpts)
+{
     if (fabs(dfVal) > 1e50 && !CPLIsInf(dfVal))
     {
-        CPLsnprintf(szBuffer, sizeof(szBuffer), "%.18g", dfVal);
+        CPLsnprintf(pszBuffer, nBufferSize, "%.18g", dfVal);
+        return static_cast<int>(strlen(pszBuffer));
     }
-    else
+
+    std::string s = OGRFormatDouble(dfVal, oOpts, 1);
+    if (s.size() + 1 > nBufferSize)
     {
-        const bool bPrecisionIsNegative =
-            (nPrecision >> (8 * sizeof(nPrecision) - 1)) != 0;
-        OGRFormatDouble(szBuffer, sizeof(szBuffer), dfVal, '.',
-                        bPrecisionIsNegative ? 15
-                                             : static_cast<int>(nPrecision));
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "Truncated double value %s to "
+                 "%s.",
+                 s.c_str(), s.substr(0, nBufferSize - 1).c_str());
+        s.resize(nBufferSize - 1);
     }
-    return printbuf_memappend(pb, szBuffer, static_cast<int>(strlen(szBuffer)));
+    memcpy(pszBuffer, s.c_str(), s.size() + 1);
+    return static_cast<int>(s.size());
 }
 
 /************************************************************************/
@@ -1664,38 +2084,48 @@ static int OGR_json_double_with_significant_figures_to_string(
     struct json_object *jso, struct printbuf *pb, int /* level */,
     int /* flags */)
 {
+    const void *userData =
+#if (!defined(JSON_C_VERSION_NUM)) || (JSON_C_VERSION_NUM < JSON_C_VER_013)
+        jso->_userdata;
+#else
+        json_object_get_userdata(jso);
+#endif
+    const uintptr_t nSignificantFigures = reinterpret_cast<uintptr_t>(userData);
+    const bool bSignificantFiguresIsNegative =
+        (nSignificantFigures >> (8 * sizeof(nSignificantFigures) - 1)) != 0;
     char szBuffer[75] = {};
+    const int nSize = OGRGeoJSONFormatDoubleWithSignificantFigures(
+        szBuffer, sizeof(szBuffer), json_object_get_double(jso),
+        bSignificantFiguresIsNegative ? -1
+                                      : static_cast<int>(nSignificantFigures));
+    return printbuf_memappend(pb, szBuffer, nSize);
+}
+
+/************************************************************************/
+/*             OGRGeoJSONFormatDoubleWithSignificantFigures()           */
+/************************************************************************/
+
+static int OGRGeoJSONFormatDoubleWithSignificantFigures(
+    char *szBuffer, size_t nBufferSize, double dfVal, int nSignificantFigures)
+{
     int nSize = 0;
-    const double dfVal = json_object_get_double(jso);
     if (CPLIsNan(dfVal))
-        nSize = CPLsnprintf(szBuffer, sizeof(szBuffer), "NaN");
+        nSize = CPLsnprintf(szBuffer, nBufferSize, "NaN");
     else if (CPLIsInf(dfVal))
     {
         if (dfVal > 0)
-            nSize = CPLsnprintf(szBuffer, sizeof(szBuffer), "Infinity");
+            nSize = CPLsnprintf(szBuffer, nBufferSize, "Infinity");
         else
-            nSize = CPLsnprintf(szBuffer, sizeof(szBuffer), "-Infinity");
+            nSize = CPLsnprintf(szBuffer, nBufferSize, "-Infinity");
     }
     else
     {
         char szFormatting[32] = {};
-        const void *userData =
-#if (!defined(JSON_C_VERSION_NUM)) || (JSON_C_VERSION_NUM < JSON_C_VER_013)
-            jso->_userdata;
-#else
-            json_object_get_userdata(jso);
-#endif
-        const uintptr_t nSignificantFigures =
-            reinterpret_cast<uintptr_t>(userData);
-        const bool bSignificantFiguresIsNegative =
-            (nSignificantFigures >> (8 * sizeof(nSignificantFigures) - 1)) != 0;
         const int nInitialSignificantFigures =
-            bSignificantFiguresIsNegative
-                ? 17
-                : static_cast<int>(nSignificantFigures);
+            nSignificantFigures < 0 ? 17 : nSignificantFigures;
         CPLsnprintf(szFormatting, sizeof(szFormatting), "%%.%dg",
                     nInitialSignificantFigures);
-        nSize = CPLsnprintf(szBuffer, sizeof(szBuffer), szFormatting, dfVal);
+        nSize = CPLsnprintf(szBuffer, nBufferSize, szFormatting, dfVal);
         const char *pszDot = strchr(szBuffer, '.');
 
         // Try to avoid .xxxx999999y or .xxxx000000y rounding issues by
@@ -1709,8 +2139,7 @@ static int OGR_json_double_with_significant_figures_to_string(
             {
                 CPLsnprintf(szFormatting, sizeof(szFormatting), "%%.%dg",
                             nInitialSignificantFigures - i);
-                nSize = CPLsnprintf(szBuffer, sizeof(szBuffer), szFormatting,
-                                    dfVal);
+                nSize = CPLsnprintf(szBuffer, nBufferSize, szFormatting, dfVal);
                 pszDot = strchr(szBuffer, '.');
                 if (pszDot != nullptr && strstr(pszDot, "999999") == nullptr &&
                     strstr(pszDot, "000000") == nullptr)
@@ -1723,21 +2152,19 @@ static int OGR_json_double_with_significant_figures_to_string(
             {
                 CPLsnprintf(szFormatting, sizeof(szFormatting), "%%.%dg",
                             nInitialSignificantFigures);
-                nSize = CPLsnprintf(szBuffer, sizeof(szBuffer), szFormatting,
-                                    dfVal);
+                nSize = CPLsnprintf(szBuffer, nBufferSize, szFormatting, dfVal);
             }
         }
 
-        if (nSize + 2 < static_cast<int>(sizeof(szBuffer)) &&
+        if (nSize + 2 < static_cast<int>(nBufferSize) &&
             strchr(szBuffer, '.') == nullptr &&
             strchr(szBuffer, 'e') == nullptr)
         {
-            nSize +=
-                CPLsnprintf(szBuffer + nSize, sizeof(szBuffer) - nSize, ".0");
+            nSize += CPLsnprintf(szBuffer + nSize, nBufferSize - nSize, ".0");
         }
     }
 
-    return printbuf_memappend(pb, szBuffer, nSize);
+    return nSize;
 }
 
 /************************************************************************/
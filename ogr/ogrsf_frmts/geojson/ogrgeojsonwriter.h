@@ -87,6 +87,10 @@ class OGRGeoJSONWriteOptions
     OGRFieldType eForcedIDFieldType = OFTString;
     bool bAllowNonFiniteValues = false;
     bool bAutodetectJsonStrings = true;
+    // Whether OGRGeoJSONWriteFeature() can use
+    // OGRGeoJSONWriteGeometryStreamed(). The feature must then be kept alive
+    // until the returned object is serialized.
+    bool bStreamCoordinates = false;
 
     void SetRFC7946Settings();
     void SetIDOptions(CSLConstList papszOptions);
@@ -107,6 +111,9 @@ json_object *OGRGeoJSONWriteAttributes(
 json_object CPL_DLL *
 OGRGeoJSONWriteGeometry(const OGRGeometry *poGeometry,
                         const OGRGeoJSONWriteOptions &oOptions);
+json_object *
+OGRGeoJSONWriteGeometryStreamed(const OGRGeometry *poGeometry,
+                                const OGRGeoJSONWriteOptions &oOptions);
 json_object *OGRGeoJSONWritePoint(const OGRPoint *poPoint,
                                   const OGRGeoJSONWriteOptions &oOptions);
 json_object *OGRGeoJSONWriteLineString(const OGRLineString *poLine,
@@ -130,7 +130,25 @@ void OGRJSONCollectionStreamingParser::StartObject()
         return;
     }
 
-    if (m_bInFeaturesArray && m_nDepth == 2)
+    if (m_bInFeaturesArray && m_nDepth == 2 && m_bLightParsing)
+    {
+        m_bInLightFeature = true;
+        m_bLightInFeatureType = false;
+        m_bLightInId = false;
+        m_bLightInGeometryKey = false;
+        m_bLightInGeometryType = false;
+        m_bLightIsFeature = false;
+        m_nLightGeometryDepth = 0;
+        m_nLightCoordinatesDepth = 0;
+        m_oLightFeature = LightFeature();
+        m_bStartFeature = true;
+    }
+    else if (m_bInLightFeature)
+    {
+        if (m_nDepth == 3 && m_bLightInGeometryKey)
+            m_nLightGeometryDepth = m_nDepth + 1;
+    }
+    else if (m_bInFeaturesArray && m_nDepth == 2)
     {
         m_poCurObj = json_object_new_object();
         m_apoCurObj.push_back(m_poCurObj);
@@ -179,7 +197,25 @@ void OGRJSONCollectionStreamingParser::EndObject()
 
     m_nDepth--;
 
-    if (m_bInFeaturesArray && m_nDepth == 2 && m_poCurObj)
+    if (m_bInLightFeature)
+    {
+        if (m_nDepth == 2)
+        {
+            m_bInLightFeature = false;
+            if (m_bLightIsFeature)
+                GotLightFeature(m_oLightFeature);
+            m_nTotalOGRFeatureMemEstimate += sizeof(OGRFeature);
+            m_bEndFeature = true;
+        }
+        else
+        {
+            if (m_nDepth < m_nLightGeometryDepth)
+                m_nLightGeometryDepth = 0;
+            if (m_nDepth < m_nLightCoordinatesDepth)
+                m_nLightCoordinatesDepth = 0;
+        }
+    }
+    else if (m_bInFeaturesArray && m_nDepth == 2 && m_poCurObj)
     {
         if (m_bStoreNativeData)
         {
@@ -240,6 +276,29 @@ void OGRJSONCollectionStreamingParser::StartObjectMember(const char *pszKey,
         return;
     }
 
+    if (m_bInLightFeature)
+    {
+        if (m_nDepth == 3)
+        {
+            m_bLightInFeatureType = strcmp(pszKey, "type") == 0;
+            m_bLightInId = strcmp(pszKey, "id") == 0;
+            m_bLightInGeometryKey = strcmp(pszKey, "geometry") == 0;
+        }
+        else if (m_nLightGeometryDepth > 0)
+        {
+            m_bLightInGeometryType = m_nDepth == m_nLightGeometryDepth &&
+                                     strcmp(pszKey, "type") == 0;
+            if (m_nLightCoordinatesDepth == m_nDepth)
+                m_nLightCoordinatesDepth = 0;
+            if (m_nLightCoordinatesDepth == 0 &&
+                strcmp(pszKey, "coordinates") == 0)
+            {
+                m_nLightCoordinatesDepth = m_nDepth;
+            }
+        }
+        return;
+    }
+
     if (m_nDepth == 1)
     {
         m_bInFeatures = strcmp(pszKey, "features") == 0;
@@ -294,7 +353,15 @@ void OGRJSONCollectionStreamingParser::StartArray()
         return;
     }
 
-    if (m_nDepth == 1 && m_bInFeatures)
+    if (m_bInLightFeature)
+    {
+        if (m_nLightCoordinatesDepth > 0)
+        {
+            m_nLightPositionIdx = 0;
+            m_nLightPositionValues = 0;
+        }
+    }
+    else if (m_nDepth == 1 && m_bInFeatures)
     {
         m_bInFeaturesArray = true;
     }
@@ -321,7 +388,12 @@ void OGRJSONCollectionStreamingParser::StartArray()
 
 void OGRJSONCollectionStreamingParser::StartArrayMember()
 {
-    if (m_poCurObj)
+    if (m_bInLightFeature)
+    {
+        if (m_nLightCoordinatesDepth > 0)
+            m_nLightPositionIdx++;
+    }
+    else if (m_poCurObj)
     {
         m_nCurObjMemEstimate += ESTIMATE_ARRAY_ELT_SIZE;
 
@@ -347,7 +419,36 @@ void OGRJSONCollectionStreamingParser::EndArray()
     }
 
     m_nDepth--;
-    if (m_nDepth == 1 && m_bInFeaturesArray)
+    if (m_bInLightFeature)
+    {
+        if (m_nLightCoordinatesDepth > 0)
+        {
+            // Only arrays made of 2 or more numbers are positions
+            if (m_nLightPositionValues >= 2 &&
+                m_nLightPositionValues == m_nLightPositionIdx)
+            {
+                if (m_oLightFeature.nFirstPositionDim == 0)
+                    m_oLightFeature.nFirstPositionDim = m_nLightPositionValues;
+                if (m_nLightPositionValues == 2)
+                {
+                    static_cast<OGREnvelope &>(m_oLightFeature.sEnvelope)
+                        .Merge(m_adfLightPosition[0], m_adfLightPosition[1]);
+                }
+                else
+                {
+                    m_oLightFeature.sEnvelope.Merge(m_adfLightPosition[0],
+                                                    m_adfLightPosition[1],
+                                                    m_adfLightPosition[2]);
+                }
+                m_oLightFeature.bHasExtent = true;
+            }
+            m_nLightPositionIdx = 0;
+            m_nLightPositionValues = 0;
+            if (m_nDepth == m_nLightCoordinatesDepth)
+                m_nLightCoordinatesDepth = 0;
+        }
+    }
+    else if (m_nDepth == 1 && m_bInFeaturesArray)
     {
         m_bInFeaturesArray = false;
     }
@@ -375,7 +476,19 @@ void OGRJSONCollectionStreamingParser::String(const char *pszValue, size_t nLen)
         return;
     }
 
-    if (m_nDepth == 1 && m_bInType)
+    if (m_bInLightFeature)
+    {
+        m_nTotalOGRFeatureMemEstimate += sizeof(OGRField) + nLen;
+        if (m_nDepth == 3 && m_bLightInFeatureType)
+        {
+            m_bLightIsFeature = strcmp(pszValue, "Feature") == 0;
+        }
+        else if (m_nDepth == m_nLightGeometryDepth && m_bLightInGeometryType)
+        {
+            m_oLightFeature.osGeometryType.assign(pszValue, nLen);
+        }
+    }
+    else if (m_nDepth == 1 && m_bInType)
     {
         m_bIsTypeKnown = true;
         m_bIsFeatureCollection = strcmp(pszValue, "FeatureCollection") == 0;
@@ -410,7 +523,28 @@ void OGRJSONCollectionStreamingParser::Number(const char *pszValue, size_t nLen)
         return;
     }
 
-    if (m_poCurObj)
+    if (m_bInLightFeature)
+    {
+        if (m_nLightCoordinatesDepth > 0)
+        {
+            m_nTotalOGRFeatureMemEstimate += sizeof(double);
+            const int nIdx = m_nLightPositionIdx - 1;
+            if (nIdx >= 0 && nIdx < 3)
+                m_adfLightPosition[nIdx] = CPLAtof(pszValue);
+            m_nLightPositionValues++;
+        }
+        else
+        {
+            m_nTotalOGRFeatureMemEstimate += sizeof(OGRField);
+            if (m_nDepth == 3 && m_bLightInId &&
+                CPLGetValueType(pszValue) == CPL_VALUE_INTEGER)
+            {
+                m_oLightFeature.bHasIntegerId = true;
+                m_oLightFeature.nId = CPLAtoGIntBig(pszValue);
+            }
+        }
+    }
+    else if (m_poCurObj)
     {
         if (m_bFirstPass)
         {
@@ -467,7 +601,11 @@ void OGRJSONCollectionStreamingParser::Boolean(bool bVal)
         return;
     }
 
-    if (m_poCurObj)
+    if (m_bInLightFeature)
+    {
+        m_nTotalOGRFeatureMemEstimate += sizeof(OGRField);
+    }
+    else if (m_poCurObj)
     {
         if (m_bFirstPass)
         {
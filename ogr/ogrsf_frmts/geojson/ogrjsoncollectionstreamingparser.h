@@ -30,6 +30,7 @@
 #define OGRJSONCOLLECTIONSTREAMING_PARSER_H_INCLUDED
 
 #include "cpl_json_streaming_parser.h"
+#include "ogr_core.h"
 
 #include <json.h>  // JSON-C
 
@@ -67,6 +68,36 @@ class OGRJSONCollectionStreamingParser CPL_NON_FINAL
     bool m_bStartFeature = false;
     bool m_bEndFeature = false;
 
+    // State of the light parsing of features, where no json_object is built
+    bool m_bLightParsing = false;
+    bool m_bInLightFeature = false;
+    bool m_bLightInFeatureType = false;
+    bool m_bLightInId = false;
+    bool m_bLightInGeometryKey = false;
+    bool m_bLightInGeometryType = false;
+    bool m_bLightIsFeature = false;
+    int m_nLightGeometryDepth = 0;
+    int m_nLightCoordinatesDepth = 0;
+    int m_nLightPositionIdx = 0;
+    int m_nLightPositionValues = 0;
+    double m_adfLightPosition[3] = {0, 0, 0};
+
+  public:
+    /** Information collected on a feature when light parsing is enabled */
+    struct LightFeature
+    {
+        std::string osGeometryType{};
+        // Number of values of the first position of the geometry, or 0
+        int nFirstPositionDim = 0;
+        bool bHasExtent = false;
+        OGREnvelope3D sEnvelope{};
+        bool bHasIntegerId = false;
+        GIntBig nId = 0;
+    };
+
+  private:
+    LightFeature m_oLightFeature{};
+
     void AppendObject(json_object *poNewObj);
 
     CPL_DISALLOW_COPY_ASSIGN(OGRJSONCollectionStreamingParser)
@@ -81,6 +112,19 @@ class OGRJSONCollectionStreamingParser CPL_NON_FINAL
                             const std::string &osJson) = 0;
     virtual void TooComplex() = 0;
 
+    /** Called instead of GotFeature() when light parsing is enabled */
+    virtual void GotLightFeature(const LightFeature & /* oFeature */)
+    {
+    }
+
+    /** Enable or disable light parsing of the next features of the
+     * first pass: they are not translated to json_object, and only
+     * their type, identifier and coordinates are looked at. */
+    inline void SetLightParsing(bool bLightParsing)
+    {
+        m_bLightParsing = bLightParsing && m_bFirstPass;
+    }
+
   public:
     OGRJSONCollectionStreamingParser(bool bFirstPass, bool bStoreNativeData,
                                      size_t nMaxObjectSize);
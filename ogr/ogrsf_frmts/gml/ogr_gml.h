@@ -32,11 +32,13 @@
 #ifndef OGR_GML_H_INCLUDED
 #define OGR_GML_H_INCLUDED
 
+#include "cpl_worker_thread_pool.h"
 #include "ogrsf_frmts.h"
 #include "gmlreader.h"
 #include "gmlutils.h"
 
 #include <memory>
+#include <string>
 #include <vector>
 
 class OGRGMLDataSource;
@@ -73,6 +75,41 @@ class OGRGMLLayer final : public OGRLayer
 
     bool bFaceHoleNegative;
 
+    // Read-ahead of GML features whose geometry is built by worker threads.
+    struct PrefetchedFeature
+    {
+        std::unique_ptr<GMLFeature> poGMLFeature{};
+        std::unique_ptr<OGRGeometry> poGeom{};
+        bool bGeomBuilt = false;
+        std::string osErrorMsg{};
+    };
+
+    int m_nThreads = 0;  // 0 = not determined yet
+    std::unique_ptr<CPLJobQueue> m_poJobQueue{};
+    std::vector<PrefetchedFeature> m_aoPrefetched{};  // being consumed
+    size_t m_iNextPrefetched = 0;
+    std::vector<PrefetchedFeature> m_aoPrefetchedNext{};  // being built
+    std::string m_osPrefetchSRSName{};
+    bool m_bPrefetchHasSRSName = false;
+    bool m_bPrefetchEOF = false;
+
+    GMLFeature *NextGMLFeature(std::unique_ptr<OGRGeometry> &poGeom,
+                               bool &bGeomBuilt, std::string &osErrorMsg);
+    struct GeometryBuildJob
+    {
+        OGRGMLLayer *poLayer = nullptr;
+        PrefetchedFeature *pasBatch = nullptr;
+        size_t iStart = 0;
+        size_t iEnd = 0;
+    };
+
+    static void BuildGeometriesJob(void *pData);
+    void PrefetchFeatures();
+    void ClearPrefetchedFeatures();
+    OGRGeometry *BuildGeometry(const CPLXMLNode *const *papsGeometry,
+                               const char *pszSRSName, void *hCacheSRSIn,
+                               std::string &osErrorMsg);
+
   public:
     OGRGMLLayer(const char *pszName, bool bWriter, OGRGMLDataSource *poDS);
 
@@ -34,6 +34,9 @@
 #include "cpl_string.h"
 #include "ogr_p.h"
 #include "ogr_api.h"
+#include "gdal_thread_pool.h"
+
+#include <algorithm>
 
 /************************************************************************/
 /*                           OGRGMLLayer()                              */
@@ -69,6 +72,8 @@ OGRGMLLayer::OGRGMLLayer(const char *pszName, bool bWriterIn,
 OGRGMLLayer::~OGRGMLLayer()
 
 {
+    ClearPrefetchedFeatures();
+
     CPLFree(pszFIDPrefix);
 
     if (poFeatureDefn)
@@ -87,6 +92,8 @@ void OGRGMLLayer::ResetReading()
     if (bWriter)
         return;
 
+    ClearPrefetchedFeatures();
+
     if (poDS->GetReadMode() == INTERLEAVED_LAYERS ||
         poDS->GetReadMode() == SEQUENTIAL_LAYERS)
     {
@@ -113,6 +120,227 @@ void OGRGMLLayer::ResetReading()
     }
 }
 
+/************************************************************************/
+/*                       GetParallelThreadCount()                       */
+/************************************************************************/
+
+static int GetParallelThreadCount()
+{
+    const char *pszNumThreads =
+        CPLGetConfigOption("OGR_GML_NUM_THREADS", nullptr);
+    if (!pszNumThreads)
+        pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (!pszNumThreads)
+        return 1;
+    const int nThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                             ? CPLGetNumCPUs()
+                             : atoi(pszNumThreads);
+    return std::max(1, GDALCapThreadCount(std::min(nThreads, 128)));
+}
+
+/************************************************************************/
+/*                       GetFeatureGeometryList()                       */
+/************************************************************************/
+
+// Returns the geometry elements to build the geometry of the feature from,
+// that is its geometry properties, or its gml:boundedBy.
+static const CPLXMLNode *const *
+GetFeatureGeometryList(const GMLFeature *poGMLFeature,
+                       const CPLXMLNode *apsGeometries[2])
+{
+    const CPLXMLNode *const *papsGeometry = poGMLFeature->GetGeometryList();
+    const CPLXMLNode *psBoundedByGeometry =
+        poGMLFeature->GetBoundedByGeometry();
+    if (psBoundedByGeometry && !(papsGeometry && papsGeometry[0]))
+    {
+        apsGeometries[0] = psBoundedByGeometry;
+        apsGeometries[1] = nullptr;
+        papsGeometry = apsGeometries;
+    }
+    return papsGeometry;
+}
+
+/************************************************************************/
+/*                           BuildGeometry()                            */
+/************************************************************************/
+
+OGRGeometry *OGRGMLLayer::BuildGeometry(const CPLXMLNode *const *papsGeometry,
+                                        const char *pszSRSName,
+                                        void *hCacheSRSIn,
+                                        std::string &osErrorMsg)
+{
+    CPLPushErrorHandler(CPLQuietErrorHandler);
+    OGRGeometry *poGeom = GML_BuildOGRGeometryFromList(
+        papsGeometry, true, poDS->GetInvertAxisOrderIfLatLong(), pszSRSName,
+        poDS->GetConsiderEPSGAsURN(), poDS->GetSwapCoordinates(),
+        poDS->GetSecondaryGeometryOption(), hCacheSRSIn, bFaceHoleNegative);
+    CPLPopErrorHandler();
+
+    // Do geometry type changes if needed to match layer geometry type.
+    if (poGeom != nullptr)
+        poGeom = OGRGeometryFactory::forceTo(poGeom, GetGeomType());
+    else
+        osErrorMsg = CPLGetLastErrorMsg();
+    return poGeom;
+}
+
+/************************************************************************/
+/*                      ClearPrefetchedFeatures()                       */
+/************************************************************************/
+
+void OGRGMLLayer::ClearPrefetchedFeatures()
+{
+    if (m_poJobQueue)
+        m_poJobQueue->WaitCompletion();
+    m_aoPrefetched.clear();
+    m_aoPrefetchedNext.clear();
+    m_iNextPrefetched = 0;
+    m_bPrefetchEOF = false;
+}
+
+/************************************************************************/
+/*                         BuildGeometriesJob()                         */
+/************************************************************************/
+
+void OGRGMLLayer::BuildGeometriesJob(void *pData)
+{
+    auto poJob = static_cast<GeometryBuildJob *>(pData);
+    OGRGMLLayer *poLayer = poJob->poLayer;
+    const char *pszSRSName = poLayer->m_bPrefetchHasSRSName
+                                 ? poLayer->m_osPrefetchSRSName.c_str()
+                                 : nullptr;
+    void *hCacheSRSJob = GML_BuildOGRGeometryFromList_CreateCache();
+    for (size_t i = poJob->iStart; i < poJob->iEnd; ++i)
+    {
+        auto &oPrefetched = poJob->pasBatch[i];
+        if (oPrefetched.poGMLFeature->GetClass() != poLayer->poFClass)
+            continue;
+        const CPLXMLNode *apsGeometries[2] = {nullptr, nullptr};
+        const CPLXMLNode *const *papsGeometry = GetFeatureGeometryList(
+            oPrefetched.poGMLFeature.get(), apsGeometries);
+        if (papsGeometry[0] == nullptr ||
+            strcmp(papsGeometry[0]->pszValue, "null") == 0)
+            continue;
+        CPLErrorReset();
+        oPrefetched.poGeom.reset(poLayer->BuildGeometry(
+            papsGeometry, pszSRSName, hCacheSRSJob, oPrefetched.osErrorMsg));
+        oPrefetched.bGeomBuilt = true;
+    }
+    GML_BuildOGRGeometryFromList_DestroyCache(hCacheSRSJob);
+    delete poJob;
+}
+
+/************************************************************************/
+/*                          PrefetchFeatures()                          */
+/*                                                                      */
+/*      The features whose geometry was being built by worker threads   */
+/*      become the ones to consume, and the next batch is read by the   */
+/*      calling thread while the worker threads are still busy.         */
+/************************************************************************/
+
+void OGRGMLLayer::PrefetchFeatures()
+{
+    const auto ReadBatch = [this](std::vector<PrefetchedFeature> &aoBatch)
+    {
+        const size_t nBatchSize = 32 * static_cast<size_t>(m_nThreads);
+        while (!m_bPrefetchEOF && aoBatch.size() < nBatchSize)
+        {
+            GMLFeature *poGMLFeature = poDS->GetReader()->NextFeature();
+            if (poGMLFeature == nullptr)
+            {
+                m_bPrefetchEOF = true;
+                break;
+            }
+            aoBatch.emplace_back();
+            aoBatch.back().poGMLFeature.reset(poGMLFeature);
+        }
+    };
+
+    const auto SubmitJobs = [this](std::vector<PrefetchedFeature> &aoBatch)
+    {
+        // No job is running at that point, so this is safe.
+        const char *pszSRSName = poDS->GetGlobalSRSName();
+        m_bPrefetchHasSRSName = pszSRSName != nullptr;
+        m_osPrefetchSRSName = pszSRSName ? pszSRSName : "";
+
+        // The vector may be moved while jobs run, but its buffer not.
+        PrefetchedFeature *pasBatch = aoBatch.data();
+        const size_t nCount = aoBatch.size();
+        const size_t nPerJob =
+            (nCount + static_cast<size_t>(m_nThreads) - 1) / m_nThreads;
+        for (size_t iStart = 0; iStart < nCount; iStart += nPerJob)
+        {
+            auto poJob = new GeometryBuildJob();
+            poJob->poLayer = this;
+            poJob->pasBatch = pasBatch;
+            poJob->iStart = iStart;
+            poJob->iEnd = std::min(nCount, iStart + nPerJob);
+            if (!m_poJobQueue->SubmitJob(BuildGeometriesJob, poJob))
+            {
+                // Geometries not built will be built by GetNextFeature().
+                delete poJob;
+                break;
+            }
+        }
+    };
+
+    m_aoPrefetched = std::move(m_aoPrefetchedNext);
+    m_aoPrefetchedNext.clear();
+    m_iNextPrefetched = 0;
+    if (m_aoPrefetched.empty())
+    {
+        ReadBatch(m_aoPrefetched);
+        SubmitJobs(m_aoPrefetched);
+    }
+    ReadBatch(m_aoPrefetchedNext);
+    m_poJobQueue->WaitCompletion();
+    SubmitJobs(m_aoPrefetchedNext);
+}
+
+/************************************************************************/
+/*                           NextGMLFeature()                           */
+/*                                                                      */
+/*      Returns the next GML feature of the reader, and its geometry    */
+/*      if it has been built by a worker thread (bGeomBuilt = true).    */
+/************************************************************************/
+
+GMLFeature *OGRGMLLayer::NextGMLFeature(std::unique_ptr<OGRGeometry> &poGeom,
+                                        bool &bGeomBuilt,
+                                        std::string &osErrorMsg)
+{
+    bGeomBuilt = false;
+    if (m_nThreads == 0)
+    {
+        // Other read modes may have to stop reading at a feature of another
+        // layer, and several geometry fields are built with errors reported.
+        m_nThreads = 1;
+        const int nThreads = GetParallelThreadCount();
+        if (nThreads > 1 && poDS->GetReadMode() == STANDARD &&
+            poFeatureDefn->GetGeomFieldCount() <= 1)
+        {
+            CPLWorkerThreadPool *poPool = GDALGetGlobalThreadPool(nThreads);
+            if (poPool)
+                m_poJobQueue = poPool->CreateJobQueue();
+            if (m_poJobQueue)
+                m_nThreads = nThreads;
+        }
+    }
+    if (m_nThreads <= 1)
+        return poDS->GetReader()->NextFeature();
+
+    if (m_iNextPrefetched == m_aoPrefetched.size())
+    {
+        PrefetchFeatures();
+        if (m_aoPrefetched.empty())
+            return nullptr;
+    }
+    auto &oPrefetched = m_aoPrefetched[m_iNextPrefetched++];
+    poGeom = std::move(oPrefetched.poGeom);
+    bGeomBuilt = oPrefetched.bGeomBuilt;
+    osErrorMsg = std::move(oPrefetched.osErrorMsg);
+    return oPrefetched.poGMLFeature.release();
+}
+
 /************************************************************************/
 /*                              Increment()                             */
 /************************************************************************/
@@ -151,6 +379,10 @@ OGRFeature *OGRGMLLayer::GetNextFeature()
     /* ==================================================================== */
     while (true)
     {
+        std::unique_ptr<OGRGeometry> poPrebuiltGeom;
+        bool bGeomPrebuilt = false;
+        std::string osPrebuiltErrorMsg;
+
         GMLFeature *poGMLFeature = poDS->PeekStoredGMLFeature();
         if (poGMLFeature != nullptr)
         {
@@ -158,7 +390,8 @@ OGRFeature *OGRGMLLayer::GetNextFeature()
         }
         else
         {
-            poGMLFeature = poDS->GetReader()->NextFeature();
+            poGMLFeature = NextGMLFeature(poPrebuiltGeom, bGeomPrebuilt,
+                                          osPrebuiltErrorMsg);
             if (poGMLFeature == nullptr)
                 return nullptr;
 
@@ -277,16 +510,9 @@ OGRFeature *OGRGMLLayer::GetNextFeature()
          */
 
         OGRGeometry **papoGeometries = nullptr;
-        const CPLXMLNode *const *papsGeometry = poGMLFeature->GetGeometryList();
-
         const CPLXMLNode *apsGeometries[2] = {nullptr, nullptr};
-        const CPLXMLNode *psBoundedByGeometry =
-            poGMLFeature->GetBoundedByGeometry();
-        if (psBoundedByGeometry && !(papsGeometry && papsGeometry[0]))
-        {
-            apsGeometries[0] = psBoundedByGeometry;
-            papsGeometry = apsGeometries;
-        }
+        const CPLXMLNode *const *papsGeometry =
+            GetFeatureGeometryList(poGMLFeature, apsGeometries);
 
         OGRGeometry *poGeom = nullptr;
 
@@ -355,24 +581,20 @@ OGRFeature *OGRGMLLayer::GetNextFeature()
         }
         else if (papsGeometry[0] != nullptr)
         {
-            const char *pszSRSName = poDS->GetGlobalSRSName();
-            CPLPushErrorHandler(CPLQuietErrorHandler);
-            poGeom = GML_BuildOGRGeometryFromList(
-                papsGeometry, true, poDS->GetInvertAxisOrderIfLatLong(),
-                pszSRSName, poDS->GetConsiderEPSGAsURN(),
-                poDS->GetSwapCoordinates(), poDS->GetSecondaryGeometryOption(),
-                hCacheSRS, bFaceHoleNegative);
-            CPLPopErrorHandler();
-
-            // Do geometry type changes if needed to match layer geometry type.
-            if (poGeom != nullptr)
+            std::string osLastErrorMsg;
+            if (bGeomPrebuilt)
             {
-                poGeom = OGRGeometryFactory::forceTo(poGeom, GetGeomType());
+                poGeom = poPrebuiltGeom.release();
+                osLastErrorMsg = std::move(osPrebuiltErrorMsg);
             }
             else
             {
-                const CPLString osLastErrorMsg(CPLGetLastErrorMsg());
+                poGeom = BuildGeometry(papsGeometry, poDS->GetGlobalSRSName(),
+                                       hCacheSRS, osLastErrorMsg);
+            }
 
+            if (poGeom == nullptr)
+            {
                 const bool bGoOn = CPLTestBool(
                     CPLGetConfigOption("GML_SKIP_CORRUPTED_FEATURES", "NO"));
 
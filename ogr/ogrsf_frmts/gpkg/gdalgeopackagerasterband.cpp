@@ -31,9 +31,11 @@
 #include "gdal_alg_priv.h"
 #include "ogrsqlitevfs.h"
 #include "cpl_error.h"
+#include "gdal_thread_pool.h"
 
 #include <algorithm>
 #include <limits>
+#include <vector>
 
 #if !defined(DEBUG_VERBOSE) && defined(DEBUG_VERBOSE_GPKG)
 #define DEBUG_VERBOSE
@@ -65,6 +67,10 @@ GDALGPKGMBTilesLikePseudoDataset::GDALGPKGMBTilesLikePseudoDataset()
 
 GDALGPKGMBTilesLikePseudoDataset::~GDALGPKGMBTilesLikePseudoDataset()
 {
+    // Should have been emptied by FlushTiles(), but make sure no worker
+    // thread is still using a job
+    if (m_poTileEncodingQueue)
+        m_poTileEncodingQueue->WaitCompletion();
     if (m_poParentDS == nullptr && m_hTempDB != nullptr)
     {
         sqlite3_close(m_hTempDB);
@@ -82,6 +88,155 @@ GDALGPKGMBTilesLikePseudoDataset::~GDALGPKGMBTilesLikePseudoDataset()
     CPLFree(m_pabyHugeColorArray);
 }
 
+/************************************************************************/
+/*                    GDALGPKGMBTilesTileEncodingJob                    */
+/************************************************************************/
+
+struct GDALGPKGMBTilesTileEncodingJob
+{
+    GDALGPKGMBTilesLikePseudoDataset *poDS = nullptr;
+    int nRow = 0;
+    int nCol = 0;
+    GDALDriver *poDriver = nullptr;
+    CPLStringList aosOptions{};
+    CPLString osMemFileName{};
+    std::vector<GByte> abyData{};
+    // Must be declared after abyData, whose content it points to
+    std::unique_ptr<GDALDataset> poMEMDS{};
+    std::mutex *poMutex = nullptr;
+
+    // Members below are protected by *poMutex
+    bool bReady = false;
+    GByte *pabyBlob = nullptr;
+    vsi_l_offset nBlobSize = 0;
+
+    GDALGPKGMBTilesTileEncodingJob() = default;
+    GDALGPKGMBTilesTileEncodingJob(const GDALGPKGMBTilesTileEncodingJob &) =
+        delete;
+    GDALGPKGMBTilesTileEncodingJob &
+    operator=(const GDALGPKGMBTilesTileEncodingJob &) = delete;
+
+    ~GDALGPKGMBTilesTileEncodingJob()
+    {
+        CPLFree(pabyBlob);
+    }
+};
+
+/************************************************************************/
+/*                        GetTileEncodingQueue()                        */
+/************************************************************************/
+
+// Returns the queue in which tiles are encoded by worker threads, or nullptr
+// if tiles must be encoded synchronously (GDAL_NUM_THREADS not set or <= 1).
+CPLJobQueue *GDALGPKGMBTilesLikePseudoDataset::GetTileEncodingQueue()
+{
+    GDALGPKGMBTilesLikePseudoDataset *poMainDS =
+        m_poParentDS ? m_poParentDS : this;
+    if (poMainDS->m_nTileEncodingThreads < 0)
+    {
+        poMainDS->m_nTileEncodingThreads = 0;
+        const char *pszNumThreads =
+            CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+        if (pszNumThreads)
+        {
+            const int nThreads =
+                std::min(128, EQUAL(pszNumThreads, "ALL_CPUS")
+                                  ? CPLGetNumCPUs()
+                                  : atoi(pszNumThreads));
+            if (nThreads > 1)
+            {
+                auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+                if (poThreadPool)
+                {
+                    poMainDS->m_poTileEncodingQueue =
+                        poThreadPool->CreateJobQueue();
+                    poMainDS->m_nTileEncodingThreads = nThreads;
+                }
+            }
+        }
+    }
+    return poMainDS->m_poTileEncodingQueue.get();
+}
+
+/************************************************************************/
+/*                         EncodeTileJobFunc()                          */
+/************************************************************************/
+
+void GDALGPKGMBTilesLikePseudoDataset::EncodeTileJobFunc(void *pData)
+{
+    auto psJob = static_cast<GDALGPKGMBTilesTileEncodingJob *>(pData);
+
+    GDALDataset *poOutDS = psJob->poDriver->CreateCopy(
+        psJob->osMemFileName, psJob->poMEMDS.get(), FALSE,
+        psJob->aosOptions.List(), nullptr, nullptr);
+    GByte *pabyBlob = nullptr;
+    vsi_l_offset nBlobSize = 0;
+    if (poOutDS)
+    {
+        GDALClose(poOutDS);
+        pabyBlob = VSIGetMemFileBuffer(psJob->osMemFileName, &nBlobSize, TRUE);
+    }
+    VSIUnlink(psJob->osMemFileName);
+    psJob->poMEMDS.reset();
+    psJob->abyData.clear();
+    psJob->abyData.shrink_to_fit();
+
+    std::lock_guard oLock(*(psJob->poMutex));
+    psJob->pabyBlob = pabyBlob;
+    psJob->nBlobSize = nBlobSize;
+    psJob->bReady = true;
+}
+
+/************************************************************************/
+/*                        WaitTileEncodingJobs()                        */
+/************************************************************************/
+
+// Waits for the oldest tile encoding jobs, and inserts their result in the
+// database, until no more than nMaxRemainingJobs are pending.
+CPLErr
+GDALGPKGMBTilesLikePseudoDataset::WaitTileEncodingJobs(size_t nMaxRemainingJobs)
+{
+    GDALGPKGMBTilesLikePseudoDataset *poMainDS =
+        m_poParentDS ? m_poParentDS : this;
+    auto &apoJobs = poMainDS->m_apoTileEncodingJobs;
+    CPLErr eErr = CE_None;
+    while (apoJobs.size() > nMaxRemainingJobs)
+    {
+        std::unique_ptr<GDALGPKGMBTilesTileEncodingJob> poJob =
+            std::move(apoJobs.front());
+        apoJobs.pop_front();
+        while (true)
+        {
+            {
+                std::lock_guard oLock(poMainDS->m_oTileEncodingMutex);
+                if (poJob->bReady)
+                    break;
+            }
+            poMainDS->m_poTileEncodingQueue->GetPool()->WaitEvent();
+        }
+
+        if (poJob->pabyBlob == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Failure when encoding tile (row=%d,col=%d) at "
+                     "zoom_level=%d",
+                     poJob->poDS->GetRowFromIntoTopConvention(poJob->nRow),
+                     poJob->nCol, poJob->poDS->m_nZoomLevel);
+            eErr = CE_Failure;
+        }
+        else
+        {
+            GByte *pabyBlob = poJob->pabyBlob;
+            poJob->pabyBlob = nullptr;
+            if (poJob->poDS->InsertTile(poJob->nRow, poJob->nCol, pabyBlob,
+                                        static_cast<size_t>(
+                                            poJob->nBlobSize)) != CE_None)
+                eErr = CE_Failure;
+        }
+    }
+    return eErr;
+}
+
 /************************************************************************/
 /*                            SetDataType()                             */
 /************************************************************************/
@@ -168,6 +323,9 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::FlushTiles()
         }
     }
 
+    if (WaitTileEncodingJobs() != CE_None)
+        eErr = CE_Failure;
+
     if (poMainDS->m_nTileInsertionCount > 0)
     {
         if (poMainDS->ICommitTransaction() != OGRERR_NONE)
@@ -881,6 +1039,9 @@ GByte *GDALGPKGMBTilesLikePseudoDataset::ReadTile(int nRow, int nCol,
     CPLDebug("GPKG", "ReadTile(row=%d, col=%d)", nRow, nCol);
 #endif
 
+    // Make sure tiles being encoded have reached the database
+    WaitTileEncodingJobs();
+
     char *pszSQL = sqlite3_mprintf(
         "SELECT tile_data%s FROM \"%w\" "
         "WHERE zoom_level = %d AND tile_row = %d AND tile_column = %d%s",
@@ -1280,6 +1441,9 @@ GIntBig GDALGPKGMBTilesLikePseudoDataset::GetTileId(int nRow, int nCol)
 
 bool GDALGPKGMBTilesLikePseudoDataset::DeleteTile(int nRow, int nCol)
 {
+    // A previous version of that tile might still be being encoded
+    WaitTileEncodingJobs();
+
     char *pszSQL =
         sqlite3_mprintf("DELETE FROM \"%w\" "
                         "WHERE zoom_level = %d AND tile_row = %d AND "
@@ -1455,6 +1619,79 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTile()
     return eErr;
 }
 
+/************************************************************************/
+/*                             InsertTile()                             */
+/************************************************************************/
+
+/* Takes ownership of pabyBlob */
+CPLErr GDALGPKGMBTilesLikePseudoDataset::InsertTile(int nRow, int nCol,
+                                                    GByte *pabyBlob,
+                                                    size_t nBlobSize)
+{
+    /* Create or commit and recreate transaction */
+    GDALGPKGMBTilesLikePseudoDataset *poMainDS =
+        m_poParentDS ? m_poParentDS : this;
+    if (poMainDS->m_nTileInsertionCount < 0)
+    {
+        CPLFree(pabyBlob);
+        return CE_Failure;
+    }
+    if (poMainDS->m_nTileInsertionCount == 0)
+    {
+        poMainDS->IStartTransaction();
+    }
+    else if (poMainDS->m_nTileInsertionCount == 1000)
+    {
+        if (poMainDS->ICommitTransaction() != OGRERR_NONE)
+        {
+            poMainDS->m_nTileInsertionCount = -1;
+            CPLFree(pabyBlob);
+            return CE_Failure;
+        }
+        poMainDS->IStartTransaction();
+        poMainDS->m_nTileInsertionCount = 0;
+    }
+    poMainDS->m_nTileInsertionCount++;
+
+    CPLErr eErr = CE_Failure;
+    char *pszSQL = sqlite3_mprintf("INSERT OR REPLACE INTO \"%w\" "
+                                   "(zoom_level, tile_row, tile_column, "
+                                   "tile_data) VALUES (%d, %d, %d, ?)",
+                                   m_osRasterTable.c_str(), m_nZoomLevel,
+                                   GetRowFromIntoTopConvention(nRow), nCol);
+#ifdef DEBUG_VERBOSE
+    CPLDebug("GPKG", "%s", pszSQL);
+#endif
+    sqlite3_stmt *hStmt = nullptr;
+    int rc = sqlite3_prepare_v2(IGetDB(), pszSQL, -1, &hStmt, nullptr);
+    if (rc != SQLITE_OK)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "failed to prepare SQL %s: %s",
+                 pszSQL, sqlite3_errmsg(IGetDB()));
+        CPLFree(pabyBlob);
+    }
+    else
+    {
+        sqlite3_bind_blob(hStmt, 1, pabyBlob, static_cast<int>(nBlobSize),
+                          CPLFree);
+        rc = sqlite3_step(hStmt);
+        if (rc == SQLITE_DONE)
+            eErr = CE_None;
+        else
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Failure when inserting tile (row=%d,col=%d) at "
+                     "zoom_level=%d : %s",
+                     GetRowFromIntoTopConvention(nRow), nCol, m_nZoomLevel,
+                     sqlite3_errmsg(IGetDB()));
+        }
+    }
+    sqlite3_finalize(hStmt);
+    sqlite3_free(pszSQL);
+
+    return eErr;
+}
+
 /* should only be called by WriteTile() */
 CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
 {
@@ -2218,6 +2455,73 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
                                     CPLSPrintf("%d", nBlockYSize));
             }
         }
+        CPLJobQueue *poQueue =
+            m_eDT == GDT_Byte ? GetTileEncodingQueue() : nullptr;
+        if (poQueue)
+        {
+            // Encode the tile in a worker thread. Its insertion in the
+            // database is done later by WaitTileEncodingJobs()
+            GDALGPKGMBTilesLikePseudoDataset *poMainDS =
+                m_poParentDS ? m_poParentDS : this;
+            eErr = WaitTileEncodingJobs(
+                2 * static_cast<size_t>(poMainDS->m_nTileEncodingThreads) - 1);
+
+            auto poJob = std::make_unique<GDALGPKGMBTilesTileEncodingJob>();
+            poJob->poDS = this;
+            poJob->nRow = nRow;
+            poJob->nCol = nCol;
+            poJob->poDriver = l_poDriver;
+            poJob->aosOptions.Assign(CSLDuplicate(papszDriverOptions), TRUE);
+            poJob->osMemFileName.Printf("/vsimem/gpkg_write_tile_%p",
+                                        poJob.get());
+            poJob->poMutex = &poMainDS->m_oTileEncodingMutex;
+            poJob->abyData.resize(nTileBands * nBandBlockSize);
+            if (poMEMDS->RasterIO(GF_Read, 0, 0, nBlockXSize, nBlockYSize,
+                                  poJob->abyData.data(), nBlockXSize,
+                                  nBlockYSize, GDT_Byte, nTileBands, nullptr,
+                                  1, nBlockXSize, nBandBlockSize,
+                                  nullptr) != CE_None)
+            {
+                eErr = CE_Failure;
+            }
+            else
+            {
+                auto poJobMEMDS =
+                    std::unique_ptr<MEMDataset>(MEMDataset::Create(
+                        "", nBlockXSize, nBlockYSize, 0, GDT_Byte, nullptr));
+                for (int i = 0; i < nTileBands; i++)
+                {
+                    auto hBand = MEMCreateRasterBandEx(
+                        poJobMEMDS.get(), i + 1,
+                        poJob->abyData.data() + i * nBandBlockSize, GDT_Byte,
+                        0, 0, false);
+                    poJobMEMDS->AddMEMBand(hBand);
+                }
+                if (nTileBands == 1)
+                {
+                    const GDALColorTable *poTileCT =
+                        poMEMDS->GetRasterBand(1)->GetColorTable();
+                    if (poTileCT)
+                        poJobMEMDS->GetRasterBand(1)->SetColorTable(
+                            const_cast<GDALColorTable *>(poTileCT));
+                }
+                poJob->poMEMDS = std::move(poJobMEMDS);
+
+                auto psJob = poJob.get();
+                poMainDS->m_apoTileEncodingJobs.push_back(std::move(poJob));
+                if (!poQueue->SubmitJob(EncodeTileJobFunc, psJob))
+                {
+                    poMainDS->m_apoTileEncodingJobs.pop_back();
+                    eErr = CE_Failure;
+                }
+            }
+
+            CSLDestroy(papszDriverOptions);
+            CPLFree(pTempTileBuffer);
+            delete poMEMDS;
+            return eErr;
+        }
+
 #ifdef DEBUG
         VSIStatBufL sStat;
         CPLAssert(VSIStatL(osMemFileName, &sStat) != 0);
@@ -2235,64 +2539,16 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
             GByte *pabyBlob =
                 VSIGetMemFileBuffer(osMemFileName, &nBlobSize, TRUE);
 
-            /* Create or commit and recreate transaction */
+            eErr = InsertTile(nRow, nCol, pabyBlob,
+                              static_cast<size_t>(nBlobSize));
             GDALGPKGMBTilesLikePseudoDataset *poMainDS =
                 m_poParentDS ? m_poParentDS : this;
-            if (poMainDS->m_nTileInsertionCount == 0)
-            {
-                poMainDS->IStartTransaction();
-            }
-            else if (poMainDS->m_nTileInsertionCount == 1000)
-            {
-                if (poMainDS->ICommitTransaction() != OGRERR_NONE)
-                {
-                    poMainDS->m_nTileInsertionCount = -1;
-                    CPLFree(pabyBlob);
-                    VSIUnlink(osMemFileName);
-                    delete poMEMDS;
-                    return CE_Failure;
-                }
-                poMainDS->IStartTransaction();
-                poMainDS->m_nTileInsertionCount = 0;
-            }
-            poMainDS->m_nTileInsertionCount++;
-
-            char *pszSQL =
-                sqlite3_mprintf("INSERT OR REPLACE INTO \"%w\" "
-                                "(zoom_level, tile_row, tile_column, "
-                                "tile_data) VALUES (%d, %d, %d, ?)",
-                                m_osRasterTable.c_str(), m_nZoomLevel,
-                                GetRowFromIntoTopConvention(nRow), nCol);
-#ifdef DEBUG_VERBOSE
-            CPLDebug("GPKG", "%s", pszSQL);
-#endif
-            sqlite3_stmt *hStmt = nullptr;
-            int rc = sqlite3_prepare_v2(IGetDB(), pszSQL, -1, &hStmt, nullptr);
-            if (rc != SQLITE_OK)
-            {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "failed to prepare SQL %s: %s", pszSQL,
-                         sqlite3_errmsg(IGetDB()));
-                CPLFree(pabyBlob);
-            }
-            else
+            if (poMainDS->m_nTileInsertionCount < 0)
             {
-                sqlite3_bind_blob(hStmt, 1, pabyBlob,
-                                  static_cast<int>(nBlobSize), CPLFree);
-                rc = sqlite3_step(hStmt);
-                if (rc == SQLITE_DONE)
-                    eErr = CE_None;
-                else
-                {
-                    CPLError(CE_Failure, CPLE_AppDefined,
-                             "Failure when inserting tile (row=%d,col=%d) at "
-                             "zoom_level=%d : %s",
-                             GetRowFromIntoTopConvention(nRow), nCol,
-                             m_nZoomLevel, sqlite3_errmsg(IGetDB()));
-                }
+                VSIUnlink(osMemFileName);
+                delete poMEMDS;
+                return CE_Failure;
             }
-            sqlite3_finalize(hStmt);
-            sqlite3_free(pszSQL);
 
             if (m_eTF == GPKG_TF_PNG_16BIT || m_eTF == GPKG_TF_TIFF_32BIT_FLOAT)
             {
@@ -2303,7 +2559,7 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
                 {
                     DeleteFromGriddedTileAncillary(nTileId);
 
-                    pszSQL = sqlite3_mprintf(
+                    char *pszSQL = sqlite3_mprintf(
                         "INSERT INTO gpkg_2d_gridded_tile_ancillary "
                         "(tpudt_name, tpudt_id, scale, offset, min, max, "
                         "mean, std_dev) VALUES "
@@ -2312,9 +2568,9 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
 #ifdef DEBUG_VERBOSE
                     CPLDebug("GPKG", "%s", pszSQL);
 #endif
-                    hStmt = nullptr;
-                    rc = sqlite3_prepare_v2(IGetDB(), pszSQL, -1, &hStmt,
-                                            nullptr);
+                    sqlite3_stmt *hStmt = nullptr;
+                    int rc = sqlite3_prepare_v2(IGetDB(), pszSQL, -1, &hStmt,
+                                                nullptr);
                     if (rc != SQLITE_OK)
                     {
                         eErr = CE_Failure;
@@ -31,9 +31,14 @@
 #define GPKGMBTILESCOMMON_H_INCLUDED
 
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_pam.h"
 #include <sqlite3.h>
 
+#include <deque>
+#include <memory>
+#include <mutex>
+
 typedef struct
 {
     int nRow;
@@ -56,6 +61,8 @@ typedef enum
 GPKGTileFormat GDALGPKGMBTilesGetTileFormat(const char *pszTF);
 const char *GDALMBTilesGetTileFormatName(GPKGTileFormat);
 
+struct GDALGPKGMBTilesTileEncodingJob;
+
 class GDALGPKGMBTilesLikePseudoDataset
 {
     friend class GDALGPKGMBTilesLikeRasterBand;
@@ -114,6 +121,18 @@ class GDALGPKGMBTilesLikePseudoDataset
 
   private:
     bool m_bInWriteTile = false;
+
+    // Only used on the main dataset, shared with the overview datasets
+    int m_nTileEncodingThreads = -1;
+    std::unique_ptr<CPLJobQueue> m_poTileEncodingQueue{};
+    std::deque<std::unique_ptr<GDALGPKGMBTilesTileEncodingJob>>
+        m_apoTileEncodingJobs{};
+    std::mutex m_oTileEncodingMutex{};
+
+    CPLJobQueue *GetTileEncodingQueue();
+    static void EncodeTileJobFunc(void *pData);
+    CPLErr InsertTile(int nRow, int nCol, GByte *pabyBlob, size_t nBlobSize);
+
     CPLErr WriteTileInternal(); /* should only be called by WriteTile() */
     GIntBig GetTileId(int nRow, int nCol);
     bool DeleteTile(int nRow, int nCol);
@@ -139,6 +158,7 @@ class GDALGPKGMBTilesLikePseudoDataset
                     bool *pbIsLossyFormat = nullptr);
 
     CPLErr WriteTile();
+    CPLErr WaitTileEncodingJobs(size_t nMaxRemainingJobs = 0);
 
     CPLErr FlushTiles();
     CPLErr FlushRemainingShiftedTiles(bool bPartialFlush);
@@ -605,7 +605,9 @@ class OGRGeoPackageLayer CPL_NON_FINAL : public OGRLayer,
 
     void BuildFeatureDefn(const char *pszLayerName, sqlite3_stmt *hStmt);
 
-    OGRFeature *TranslateFeature(sqlite3_stmt *hStmt);
+    OGRFeature *TranslateFeature(sqlite3_stmt *hStmt,
+                                 OGRFeature *poFeatureToReuse = nullptr);
+    OGRFeature *GetNextFeatureInternal(OGRFeature *poFeatureToReuse);
     bool ParseDateField(const char *pszTxt, OGRField *psField,
                         const OGRFieldDefn *poFieldDefn, GIntBig nFID);
     bool ParseDateField(sqlite3_stmt *hStmt, int iRawField, int nSqlite3ColType,
@@ -714,6 +716,21 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
     std::string m_osInsertionBuffer{};  // used by FeatureBindParameters to
                                         // store datetime values
 
+    // BULK_LOAD=YES layer creation option: features are inserted with
+    // explicit FIDs, several rows per execution of m_poBulkInsertStatement
+    bool m_bBulkLoad = false;
+    sqlite3_stmt *m_poBulkInsertStatement = nullptr;
+    int m_nBulkInsertRowsPerStatement = 0;
+    int m_nBulkInsertParamsPerRow = 0;
+    int m_nBulkInsertPendingRows = 0;
+    // Index of the row of m_poBulkInsertStatement being bound, or -1
+    int m_iBulkInsertRow = -1;
+    GIntBig m_nBulkInsertNextFID = -1;
+    // Geometry blobs of the pending rows, bound with SQLITE_STATIC
+    std::vector<std::vector<GByte>> m_aabyBulkInsertGeomBuffers{};
+    bool m_bBulkLoadCacheSizeChanged = false;
+    int m_nBulkLoadPrevCacheSize = 0;
+
     CPLString m_osIdentifierLCO{};
     CPLString m_osDescriptionLCO{};
     bool m_bHasReadMetadataFromStorage = false;
@@ -722,6 +739,10 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
     std::set<OGRwkbGeometryType> m_eSetBadGeomTypeWarned{};
 
     int m_nIsCompatOfOptimizedGetNextArrowArray = -1;
+    // Used when m_nIsCompatOfOptimizedGetNextArrowArray == TRUE
+    GIntBig m_nArrowMinFID = 0;
+    GIntBig m_nArrowMaxFID = 0;
+    GIntBig m_iNextArrowFID = 0;  // start of the next range of FIDs to read
     bool m_bGetNextArrowArrayCalledSinceResetReading = false;
 
     int m_nCountInsertInTransactionThreshold = -1;
@@ -817,7 +838,8 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
         std::string m_osErrorMsg{};
         std::unique_ptr<GDALGeoPackageDataset> m_poDS{};
         OGRGeoPackageTableLayer *m_poLayer{};
-        GIntBig m_iStartShapeId = 0;
+        GIntBig m_iStartFID = 0;
+        int m_nRet = 0;
         std::unique_ptr<struct ArrowArray> m_psArrowArray = nullptr;
     };
 
@@ -838,6 +860,7 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
                                       struct ArrowArray *out_array);
     void GetNextArrowArrayAsynchronousWorker();
     void CancelAsyncNextArrowArray();
+    bool PrepareGetNextFeature();
 
   protected:
     friend void OGR_GPKG_Intersects_Spatial_Filter(sqlite3_context *pContext,
@@ -896,6 +919,7 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
     OGRErr SetAttributeFilter(const char *pszQuery) override;
     OGRErr SyncToDisk() override;
     OGRFeature *GetNextFeature() override;
+    bool GetNextFeatureInto(OGRFeature &oFeature) override;
     OGRFeature *GetFeature(GIntBig nFID) override;
     OGRErr StartTransaction() override;
     OGRErr CommitTransaction() override;
@@ -931,6 +955,11 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
         const char *pszDescription);
     void SetDeferredSpatialIndexCreation(bool bFlag);
 
+    void SetBulkLoad(bool bFlag)
+    {
+        m_bBulkLoad = bFlag;
+    }
+
     void SetASpatialVariant(GPKGASpatialVariant eASpatialVariant)
     {
         m_eASpatialVariant = eASpatialVariant;
@@ -946,6 +975,8 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
     void CreateSpatialIndexIfNecessary();
     void FinishOrDisableThreadedRTree();
     bool FlushInMemoryRTree(sqlite3 *hRTreeDB, const char *pszRTreeName);
+    bool CollectRTreeEntriesInParallel(const char *pszTableName,
+                                       std::vector<GPKGRTreeEntry> &aoEntries);
     bool CreateSpatialIndex(const char *pszTableName = nullptr);
     bool DropSpatialIndex(bool bCalledFromSQLFunction = false);
     CPLString ReturnSQLCreateSpatialIndexTriggers(const char *pszTableName,
@@ -1048,6 +1079,14 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
                                  int nUpdatedGeomFieldsCount,
                                  const int *panUpdatedGeomFieldsIdx);
 
+    OGRErr InsertFeature(OGRFeature *poFeature, bool bUpsert,
+                         bool bHasDefaultValue,
+                         const std::string &osUpsertUniqueColumnName);
+    OGRErr BulkInsertFeature(OGRFeature *poFeature);
+    bool FlushPendingBulkInsert();
+    void DiscardPendingBulkInsert();
+    void RestoreBulkLoadCacheSize();
+
     void UpdateContentsToNullExtent();
 
     void CheckUnknownExtensions();
@@ -6931,6 +6931,8 @@ GDALGeoPackageDataset::ICreateLayer(const char *pszLayerName,
         poLayer->SetDeferredSpatialIndexCreation(true);
     }
 
+    poLayer->SetBulkLoad(CPLFetchBool(papszOptions, "BULK_LOAD", false));
+
     poLayer->SetPrecisionFlag(CPLFetchBool(papszOptions, "PRECISION", true));
     poLayer->SetTruncateFieldsFlag(
         CPLFetchBool(papszOptions, "TRUNCATE_FIELDS", false));
@@ -8008,6 +8010,18 @@ void OGR_GPKG_Intersects_Spatial_Filter(sqlite3_context *pContext, int argc,
             sqlite3_result_int(pContext, 1);
             return;
         }
+
+        // Exact test on linear geometries, without instantiating a
+        // OGRGeometry
+        bool bIntersects = false;
+        if (sHeader.nHeaderLen > 0 &&
+            OGRWKBIntersectsEnvelope(pabyBLOB + sHeader.nHeaderLen,
+                                     nBLOBLen - sHeader.nHeaderLen,
+                                     poLayer->m_sFilterEnvelope, bIntersects))
+        {
+            sqlite3_result_int(pContext, bIntersects ? 1 : 0);
+            return;
+        }
     }
 
     auto poGeom = std::unique_ptr<OGRGeometry>(
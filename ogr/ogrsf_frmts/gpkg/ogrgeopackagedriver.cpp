@@ -698,6 +698,9 @@ void RegisterOGRGeoPackage()
         "to truncate text content that exceeds maximum width' default='NO'/>"
         "  <Option name='SPATIAL_INDEX' type='boolean' description='Whether to "
         "create a spatial index' default='YES'/>"
+        "  <Option name='BULK_LOAD' type='boolean' description='Whether to "
+        "insert features by batches of rows, with feature IDs assigned by the "
+        "driver' default='NO'/>"
         "  <Option name='IDENTIFIER' type='string' description='Identifier of "
         "the layer, as put in the contents table'/>"
         "  <Option name='DESCRIPTION' type='string' description='Description "
@@ -92,6 +92,20 @@ void OGRGeoPackageLayer::ClearStatement()
 
 OGRFeature *OGRGeoPackageLayer::GetNextFeature()
 
+{
+    return GetNextFeatureInternal(nullptr);
+}
+
+/************************************************************************/
+/*                       GetNextFeatureInternal()                       */
+/*                                                                      */
+/*      If poFeatureToReuse is not null, features are read into it      */
+/*      instead of being allocated, and it is returned on success.      */
+/************************************************************************/
+
+OGRFeature *
+OGRGeoPackageLayer::GetNextFeatureInternal(OGRFeature *poFeatureToReuse)
+
 {
     if (m_bEOF)
         return nullptr;
@@ -134,14 +148,16 @@ OGRFeature *OGRGeoPackageLayer::GetNextFeature()
             m_bDoStep = true;
         }
 
-        OGRFeature *poFeature = TranslateFeature(m_poQueryStatement);
+        OGRFeature *poFeature =
+            TranslateFeature(m_poQueryStatement, poFeatureToReuse);
 
         if ((m_poFilterGeom == nullptr ||
              FilterGeometry(poFeature->GetGeomFieldRef(m_iGeomFieldFilter))) &&
             (m_poAttrQuery == nullptr || m_poAttrQuery->Evaluate(poFeature)))
             return poFeature;
 
-        delete poFeature;
+        if (poFeature != poFeatureToReuse)
+            delete poFeature;
     }
 }
 
@@ -343,13 +359,18 @@ bool OGRGeoPackageLayer::ParseDateTimeField(const char *pszTxt,
 /*                         TranslateFeature()                           */
 /************************************************************************/
 
-OGRFeature *OGRGeoPackageLayer::TranslateFeature(sqlite3_stmt *hStmt)
+OGRFeature *OGRGeoPackageLayer::TranslateFeature(sqlite3_stmt *hStmt,
+                                                 OGRFeature *poFeatureToReuse)
 
 {
     /* -------------------------------------------------------------------- */
     /*      Create a feature from the current result.                       */
     /* -------------------------------------------------------------------- */
-    OGRFeature *poFeature = new OGRFeature(m_poFeatureDefn);
+    OGRFeature *poFeature = poFeatureToReuse;
+    if (poFeature)
+        poFeature->Reset();
+    else
+        poFeature = new OGRFeature(m_poFeatureDefn);
 
     /* -------------------------------------------------------------------- */
     /*      Set FID if we have a column to set it from.                     */
@@ -30,14 +30,19 @@
 #include "ogr_geopackage.h"
 #include "ogrgeopackageutility.h"
 #include "ogrsqliteutility.h"
+#include "cpl_hilbert.h"
 #include "cpl_md5.h"
 #include "cpl_time.h"
 #include "ogr_p.h"
 #include "sqlite_rtree_bulk_load/wrapper.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
+#include "ogr_wkb.h"
 
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <functional>
 #include <limits>
 
 #undef SQLITE_STATIC
@@ -221,7 +226,13 @@ OGRErr OGRGeoPackageTableLayer::FeatureBindParameters(
 {
     OGRFeatureDefn *poFeatureDefn = poFeature->GetDefnRef();
 
-    int nColCount = 1;
+    // In bulk insert mode, bind the parameters of the current row of the
+    // multi-row statement. Values are copied by SQLite, except the geometry
+    // blob that lives in a per-row buffer, since the statement is only
+    // executed once all its rows have been bound.
+    const bool bBulkInsertRow = m_iBulkInsertRow >= 0;
+    int nColCount =
+        1 + (bBulkInsertRow ? m_iBulkInsertRow * m_nBulkInsertParamsPerRow : 0);
     if (bAddFID)
     {
         int err = sqlite3_bind_int64(poStmt, nColCount++, poFeature->GetFID());
@@ -247,13 +258,27 @@ OGRErr OGRGeoPackageTableLayer::FeatureBindParameters(
         OGRGeometry *poGeom = poFeature->GetGeomFieldRef(0);
         if (poGeom)
         {
-            size_t szWkb = 0;
-            GByte *pabyWkb = GPkgGeometryFromOGR(poGeom, m_iSrs,
-                                                 &m_sBinaryPrecision, &szWkb);
-            if (!pabyWkb)
-                return OGRERR_FAILURE;
-            int err = sqlite3_bind_blob(poStmt, nColCount++, pabyWkb,
+            int err;
+            if (bBulkInsertRow)
+            {
+                auto &abyBuffer = m_aabyBulkInsertGeomBuffers[m_iBulkInsertRow];
+                if (!GPkgGeometryFromOGR(poGeom, m_iSrs, &m_sBinaryPrecision,
+                                         abyBuffer))
+                    return OGRERR_FAILURE;
+                err = sqlite3_bind_blob(poStmt, nColCount++, abyBuffer.data(),
+                                        static_cast<int>(abyBuffer.size()),
+                                        SQLITE_STATIC);
+            }
+            else
+            {
+                size_t szWkb = 0;
+                GByte *pabyWkb = GPkgGeometryFromOGR(
+                    poGeom, m_iSrs, &m_sBinaryPrecision, &szWkb);
+                if (!pabyWkb)
+                    return OGRERR_FAILURE;
+                err = sqlite3_bind_blob(poStmt, nColCount++, pabyWkb,
                                         static_cast<int>(szWkb), CPLFree);
+            }
             if (err != SQLITE_OK)
             {
                 if (err == SQLITE_TOOBIG)
@@ -351,8 +376,9 @@ OGRErr OGRGeoPackageTableLayer::FeatureBindParameters(
                     int szBlob = 0;
                     GByte *pabyBlob =
                         poFeature->GetFieldAsBinary(iField, &szBlob);
-                    err = sqlite3_bind_blob(poStmt, nColCount++, pabyBlob,
-                                            szBlob, SQLITE_STATIC);
+                    err = sqlite3_bind_blob(
+                        poStmt, nColCount++, pabyBlob, szBlob,
+                        bBulkInsertRow ? SQLITE_TRANSIENT : SQLITE_STATIC);
                     break;
                 }
                 default:
@@ -523,6 +549,8 @@ OGRErr OGRGeoPackageTableLayer::FeatureBindParameters(
                         pszVal = poFeature->GetFieldAsString(iField);
                     }
 
+                    if (bBulkInsertRow && destructorType == SQLITE_STATIC)
+                        destructorType = SQLITE_TRANSIENT;
                     err = sqlite3_bind_text(poStmt, nColCount++, pszVal,
                                             nValLengthBytes, destructorType);
                     break;
@@ -1540,6 +1568,9 @@ OGRGeoPackageTableLayer::~OGRGeoPackageTableLayer()
     if (m_poInsertStatement)
         sqlite3_finalize(m_poInsertStatement);
 
+    if (m_poBulkInsertStatement)
+        sqlite3_finalize(m_poBulkInsertStatement);
+
     if (m_poGetFeatureStatement)
         sqlite3_finalize(m_poGetFeatureStatement);
 
@@ -2276,6 +2307,303 @@ static float rtreeValueUp(double d)
     return f;
 }
 
+/************************************************************************/
+/*                           InsertFeature()                            */
+/************************************************************************/
+
+// Insert a single feature with m_poInsertStatement.
+OGRErr OGRGeoPackageTableLayer::InsertFeature(
+    OGRFeature *poFeature, bool bUpsert, bool bHasDefaultValue,
+    const std::string &osUpsertUniqueColumnName)
+{
+    if (!FlushPendingBulkInsert())
+        return OGRERR_FAILURE;
+
+    /* If there's a unset field with a default value, then we must create */
+    /* a specific INSERT statement to avoid unset fields to be bound to NULL */
+    if (m_poInsertStatement &&
+        (bHasDefaultValue ||
+         m_bInsertStatementWithFID != (poFeature->GetFID() != OGRNullFID) ||
+         m_bInsertStatementWithUpsert != bUpsert ||
+         m_osInsertStatementUpsertUniqueColumnName != osUpsertUniqueColumnName))
+    {
+        sqlite3_finalize(m_poInsertStatement);
+        m_poInsertStatement = nullptr;
+    }
+
+    if (!m_poInsertStatement)
+    {
+        /* Construct a SQL INSERT statement from the OGRFeature */
+        /* Only work with fields that are set */
+        /* Do not stick values into SQL, use placeholder and bind values later
+         */
+        m_bInsertStatementWithFID = poFeature->GetFID() != OGRNullFID;
+        m_bInsertStatementWithUpsert = bUpsert;
+        m_osInsertStatementUpsertUniqueColumnName = osUpsertUniqueColumnName;
+        CPLString osCommand = FeatureGenerateInsertSQL(
+            poFeature, m_bInsertStatementWithFID, !bHasDefaultValue, bUpsert,
+            osUpsertUniqueColumnName);
+
+        /* Prepare the SQL into a statement */
+        sqlite3 *poDb = m_poDS->GetDB();
+        int err = sqlite3_prepare_v2(poDb, osCommand, -1, &m_poInsertStatement,
+                                     nullptr);
+        if (err != SQLITE_OK)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "failed to prepare SQL: %s - %s", osCommand.c_str(),
+                     sqlite3_errmsg(poDb));
+            return OGRERR_FAILURE;
+        }
+    }
+
+    /* Bind values onto the statement now */
+    OGRErr errOgr = FeatureBindInsertParameters(poFeature, m_poInsertStatement,
+                                                m_bInsertStatementWithFID,
+                                                !bHasDefaultValue);
+    if (errOgr != OGRERR_NONE)
+    {
+        sqlite3_reset(m_poInsertStatement);
+        sqlite3_clear_bindings(m_poInsertStatement);
+        sqlite3_finalize(m_poInsertStatement);
+        m_poInsertStatement = nullptr;
+        return errOgr;
+    }
+
+    /* From here execute the statement and check errors */
+    const int err = sqlite3_step(m_poInsertStatement);
+    if (!(err == SQLITE_OK || err == SQLITE_DONE
+#if SQLITE_VERSION_NUMBER >= 3035000L
+          || err == SQLITE_ROW
+#endif
+          ))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "failed to execute insert : %s",
+                 sqlite3_errmsg(m_poDS->GetDB())
+                     ? sqlite3_errmsg(m_poDS->GetDB())
+                     : "");
+        sqlite3_reset(m_poInsertStatement);
+        sqlite3_clear_bindings(m_poInsertStatement);
+        sqlite3_finalize(m_poInsertStatement);
+        m_poInsertStatement = nullptr;
+        return OGRERR_FAILURE;
+    }
+
+    /* Read the latest FID value */
+    const GIntBig nFID = (bUpsert && !osUpsertUniqueColumnName.empty())
+                             ?
+#if SQLITE_VERSION_NUMBER >= 3035000L
+                             sqlite3_column_int64(m_poInsertStatement, 0)
+#else
+                             OGRNullFID
+#endif
+                             : sqlite3_last_insert_rowid(m_poDS->GetDB());
+
+    sqlite3_reset(m_poInsertStatement);
+    sqlite3_clear_bindings(m_poInsertStatement);
+
+    if (bHasDefaultValue)
+    {
+        sqlite3_finalize(m_poInsertStatement);
+        m_poInsertStatement = nullptr;
+    }
+
+    if (nFID != OGRNullFID)
+    {
+        poFeature->SetFID(nFID);
+        if (m_iFIDAsRegularColumnIndex >= 0)
+            poFeature->SetField(m_iFIDAsRegularColumnIndex, nFID);
+    }
+    else
+    {
+        poFeature->SetFID(OGRNullFID);
+    }
+
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                         BulkInsertFeature()                          */
+/************************************************************************/
+
+// BULK_LOAD=YES mode: bind the feature as the next row of a multi-row
+// INSERT, which is executed once all its rows have been bound.
+// The FID is assigned here, so that it is known before the row is actually
+// inserted, and that the spatial index entries can be built.
+OGRErr OGRGeoPackageTableLayer::BulkInsertFeature(OGRFeature *poFeature)
+{
+    sqlite3 *hDB = m_poDS->GetDB();
+    if (!m_poBulkInsertStatement)
+    {
+        if (m_nBulkInsertNextFID < 0)
+        {
+            char *pszSQL = sqlite3_mprintf("SELECT MAX(\"%w\") FROM \"%w\"",
+                                           GetFIDColumn(), m_pszTableName);
+            m_nBulkInsertNextFID =
+                std::max<GIntBig>(0, SQLGetInteger64(hDB, pszSQL, nullptr)) +
+                1;
+            sqlite3_free(pszSQL);
+        }
+
+        if (!m_bBulkLoadCacheSizeChanged &&
+            CPLGetConfigOption("OGR_SQLITE_CACHE", nullptr) == nullptr)
+        {
+            // Raise the page cache to 256 MB, unless it is already larger.
+            // Negative values of cache_size are in KiB, positive ones in pages
+            constexpr int BULK_LOAD_CACHE_SIZE_KB = 256 * 1024;
+            const int nCacheSize =
+                SQLGetInteger(hDB, "PRAGMA cache_size", nullptr);
+            const GIntBig nCacheSizeKB =
+                nCacheSize < 0
+                    ? -static_cast<GIntBig>(nCacheSize)
+                    : static_cast<GIntBig>(nCacheSize) *
+                          SQLGetInteger(hDB, "PRAGMA page_size", nullptr) /
+                          1024;
+            if (nCacheSizeKB < BULK_LOAD_CACHE_SIZE_KB &&
+                SQLCommand(hDB, CPLSPrintf("PRAGMA cache_size = -%d",
+                                           BULK_LOAD_CACHE_SIZE_KB)) ==
+                    OGRERR_NONE)
+            {
+                m_bBulkLoadCacheSizeChanged = true;
+                m_nBulkLoadPrevCacheSize = nCacheSize;
+            }
+        }
+
+        // INSERT INTO "t" ( "fid", "geom", ... ) VALUES (?, ?, ...)
+        const CPLString osSingleRowSQL = FeatureGenerateInsertSQL(
+            poFeature, /* bAddFID = */ true, /* bBindUnsetFields = */ true,
+            /* bUpsert = */ false, std::string());
+        const auto nValuesPos = osSingleRowSQL.rfind(") VALUES (");
+        if (nValuesPos == std::string::npos)
+            return OGRERR_FAILURE;
+        const std::string osTuple =
+            osSingleRowSQL.substr(nValuesPos + strlen(") VALUES "));
+        m_nBulkInsertParamsPerRow =
+            static_cast<int>(std::count(osTuple.begin(), osTuple.end(), '?'));
+
+        const int nMaxParams =
+            sqlite3_limit(hDB, SQLITE_LIMIT_VARIABLE_NUMBER, -1);
+        m_nBulkInsertRowsPerStatement = std::max(
+            1, std::min(atoi(CPLGetConfigOption("OGR_GPKG_BULK_INSERT_ROWS",
+                                                "100")),
+                        nMaxParams / std::max(1, m_nBulkInsertParamsPerRow)));
+
+        // Rows that are not bound have a NULL FID, and are filtered out,
+        // so that the same statement can be used for a partial last batch.
+        std::string osSQL(osSingleRowSQL.substr(0, nValuesPos + 1));
+        osSQL += " SELECT * FROM (VALUES ";
+        for (int i = 0; i < m_nBulkInsertRowsPerStatement; ++i)
+        {
+            if (i > 0)
+                osSQL += ", ";
+            osSQL += osTuple;
+        }
+        osSQL += ") WHERE column1 IS NOT NULL";
+
+        if (sqlite3_prepare_v2(hDB, osSQL.c_str(), -1, &m_poBulkInsertStatement,
+                               nullptr) != SQLITE_OK)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "failed to prepare SQL: %s - %s", osSQL.c_str(),
+                     sqlite3_errmsg(hDB));
+            m_poBulkInsertStatement = nullptr;
+            return OGRERR_FAILURE;
+        }
+        m_aabyBulkInsertGeomBuffers.resize(m_nBulkInsertRowsPerStatement);
+        m_nBulkInsertPendingRows = 0;
+    }
+
+    const GIntBig nFIDBackup = poFeature->GetFID();
+    if (nFIDBackup == OGRNullFID)
+        poFeature->SetFID(m_nBulkInsertNextFID);
+
+    m_iBulkInsertRow = m_nBulkInsertPendingRows;
+    const OGRErr eErr = FeatureBindInsertParameters(
+        poFeature, m_poBulkInsertStatement, /* bAddFID = */ true,
+        /* bBindUnsetFields = */ true);
+    if (eErr != OGRERR_NONE)
+    {
+        // Make sure the partially bound row is ignored
+        sqlite3_bind_null(m_poBulkInsertStatement,
+                          1 + m_iBulkInsertRow * m_nBulkInsertParamsPerRow);
+        m_iBulkInsertRow = -1;
+        poFeature->SetFID(nFIDBackup);
+        return eErr;
+    }
+    m_iBulkInsertRow = -1;
+    ++m_nBulkInsertPendingRows;
+
+    m_nBulkInsertNextFID =
+        std::max(m_nBulkInsertNextFID, poFeature->GetFID() + 1);
+    if (m_iFIDAsRegularColumnIndex >= 0)
+        poFeature->SetField(m_iFIDAsRegularColumnIndex, poFeature->GetFID());
+
+    if (m_nBulkInsertPendingRows == m_nBulkInsertRowsPerStatement &&
+        !FlushPendingBulkInsert())
+    {
+        return OGRERR_FAILURE;
+    }
+
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                      FlushPendingBulkInsert()                        */
+/************************************************************************/
+
+// Insert the rows bound by BulkInsertFeature(). Must be called before
+// anything reads or modifies the table by other means.
+bool OGRGeoPackageTableLayer::FlushPendingBulkInsert()
+{
+    if (m_nBulkInsertPendingRows == 0)
+        return true;
+    m_nBulkInsertPendingRows = 0;
+
+    const int err = sqlite3_step(m_poBulkInsertStatement);
+    bool bRet = true;
+    if (err != SQLITE_DONE)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "failed to execute insert : %s",
+                 sqlite3_errmsg(m_poDS->GetDB())
+                     ? sqlite3_errmsg(m_poDS->GetDB())
+                     : "");
+        bRet = false;
+    }
+    sqlite3_reset(m_poBulkInsertStatement);
+    sqlite3_clear_bindings(m_poBulkInsertStatement);
+    return bRet;
+}
+
+/************************************************************************/
+/*                     DiscardPendingBulkInsert()                       */
+/************************************************************************/
+
+void OGRGeoPackageTableLayer::DiscardPendingBulkInsert()
+{
+    if (m_poBulkInsertStatement)
+    {
+        sqlite3_reset(m_poBulkInsertStatement);
+        sqlite3_clear_bindings(m_poBulkInsertStatement);
+    }
+    m_nBulkInsertPendingRows = 0;
+    // FIDs will be assigned again from the content of the table
+    m_nBulkInsertNextFID = -1;
+}
+
+/************************************************************************/
+/*                     RestoreBulkLoadCacheSize()                       */
+/************************************************************************/
+
+void OGRGeoPackageTableLayer::RestoreBulkLoadCacheSize()
+{
+    if (m_bBulkLoadCacheSizeChanged)
+    {
+        m_bBulkLoadCacheSizeChanged = false;
+        SQLCommand(m_poDS->GetDB(), CPLSPrintf("PRAGMA cache_size = %d",
+                                               m_nBulkLoadPrevCacheSize));
+    }
+}
+
 OGRErr OGRGeoPackageTableLayer::CreateOrUpsertFeature(OGRFeature *poFeature,
                                                       bool bUpsert)
 {
@@ -2428,105 +2756,20 @@ OGRErr OGRGeoPackageTableLayer::CreateOrUpsertFeature(OGRFeature *poFeature,
         }
     }
 
-    /* If there's a unset field with a default value, then we must create */
-    /* a specific INSERT statement to avoid unset fields to be bound to NULL */
-    if (m_poInsertStatement &&
-        (bHasDefaultValue ||
-         m_bInsertStatementWithFID != (poFeature->GetFID() != OGRNullFID) ||
-         m_bInsertStatementWithUpsert != bUpsert ||
-         m_osInsertStatementUpsertUniqueColumnName != osUpsertUniqueColumnName))
-    {
-        sqlite3_finalize(m_poInsertStatement);
-        m_poInsertStatement = nullptr;
-    }
-
-    if (!m_poInsertStatement)
-    {
-        /* Construct a SQL INSERT statement from the OGRFeature */
-        /* Only work with fields that are set */
-        /* Do not stick values into SQL, use placeholder and bind values later
-         */
-        m_bInsertStatementWithFID = poFeature->GetFID() != OGRNullFID;
-        m_bInsertStatementWithUpsert = bUpsert;
-        m_osInsertStatementUpsertUniqueColumnName = osUpsertUniqueColumnName;
-        CPLString osCommand = FeatureGenerateInsertSQL(
-            poFeature, m_bInsertStatementWithFID, !bHasDefaultValue, bUpsert,
-            osUpsertUniqueColumnName);
-
-        /* Prepare the SQL into a statement */
-        sqlite3 *poDb = m_poDS->GetDB();
-        int err = sqlite3_prepare_v2(poDb, osCommand, -1, &m_poInsertStatement,
-                                     nullptr);
-        if (err != SQLITE_OK)
-        {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "failed to prepare SQL: %s - %s", osCommand.c_str(),
-                     sqlite3_errmsg(poDb));
-            return OGRERR_FAILURE;
-        }
-    }
-
-    /* Bind values onto the statement now */
-    OGRErr errOgr = FeatureBindInsertParameters(poFeature, m_poInsertStatement,
-                                                m_bInsertStatementWithFID,
-                                                !bHasDefaultValue);
-    if (errOgr != OGRERR_NONE)
-    {
-        sqlite3_reset(m_poInsertStatement);
-        sqlite3_clear_bindings(m_poInsertStatement);
-        sqlite3_finalize(m_poInsertStatement);
-        m_poInsertStatement = nullptr;
-        return errOgr;
-    }
-
-    /* From here execute the statement and check errors */
-    const int err = sqlite3_step(m_poInsertStatement);
-    if (!(err == SQLITE_OK || err == SQLITE_DONE
-#if SQLITE_VERSION_NUMBER >= 3035000L
-          || err == SQLITE_ROW
-#endif
-          ))
-    {
-        CPLError(CE_Failure, CPLE_AppDefined, "failed to execute insert : %s",
-                 sqlite3_errmsg(m_poDS->GetDB())
-                     ? sqlite3_errmsg(m_poDS->GetDB())
-                     : "");
-        sqlite3_reset(m_poInsertStatement);
-        sqlite3_clear_bindings(m_poInsertStatement);
-        sqlite3_finalize(m_poInsertStatement);
-        m_poInsertStatement = nullptr;
-        return OGRERR_FAILURE;
-    }
-
-    /* Read the latest FID value */
-    const GIntBig nFID = (bUpsert && !osUpsertUniqueColumnName.empty())
-                             ?
-#if SQLITE_VERSION_NUMBER >= 3035000L
-                             sqlite3_column_int64(m_poInsertStatement, 0)
-#else
-                             OGRNullFID
-#endif
-                             : sqlite3_last_insert_rowid(m_poDS->GetDB());
-
-    sqlite3_reset(m_poInsertStatement);
-    sqlite3_clear_bindings(m_poInsertStatement);
-
-    if (bHasDefaultValue)
+    if (m_bBulkLoad && !bUpsert && !bHasDefaultValue)
     {
-        sqlite3_finalize(m_poInsertStatement);
-        m_poInsertStatement = nullptr;
-    }
-
-    if (nFID != OGRNullFID)
-    {
-        poFeature->SetFID(nFID);
-        if (m_iFIDAsRegularColumnIndex >= 0)
-            poFeature->SetField(m_iFIDAsRegularColumnIndex, nFID);
+        const OGRErr eErr = BulkInsertFeature(poFeature);
+        if (eErr != OGRERR_NONE)
+            return eErr;
     }
     else
     {
-        poFeature->SetFID(OGRNullFID);
+        const OGRErr eErr = InsertFeature(poFeature, bUpsert, bHasDefaultValue,
+                                          osUpsertUniqueColumnName);
+        if (eErr != OGRERR_NONE)
+            return eErr;
     }
+    const GIntBig nFID = poFeature->GetFID();
 
     /* Update the layer extents with this new object */
     if (IsGeomFieldSet(poFeature))
@@ -3444,6 +3687,13 @@ void OGRGeoPackageTableLayer::ResetReading()
         m_poInsertStatement = nullptr;
     }
 
+    if (m_poBulkInsertStatement)
+    {
+        FlushPendingBulkInsert();
+        sqlite3_finalize(m_poBulkInsertStatement);
+        m_poBulkInsertStatement = nullptr;
+    }
+
     if (m_poUpdateStatement)
     {
         sqlite3_finalize(m_poUpdateStatement);
@@ -3572,12 +3822,12 @@ OGRErr OGRGeoPackageTableLayer::ResetStatementInternal(GIntBig nStartIndex)
 /*                           GetNextFeature()                           */
 /************************************************************************/
 
-OGRFeature *OGRGeoPackageTableLayer::GetNextFeature()
+bool OGRGeoPackageTableLayer::PrepareGetNextFeature()
 {
     if (!m_bFeatureDefnCompleted)
         GetLayerDefn();
     if (m_bDeferredCreation && RunDeferredCreationIfNecessary() != OGRERR_NONE)
-        return nullptr;
+        return false;
 
     CancelAsyncNextArrowArray();
 
@@ -3586,9 +3836,17 @@ OGRFeature *OGRGeoPackageTableLayer::GetNextFeature()
         // Both are exclusive
         CreateSpatialIndexIfNecessary();
         if (!RunDeferredSpatialIndexUpdate())
-            return nullptr;
+            return false;
     }
 
+    return true;
+}
+
+OGRFeature *OGRGeoPackageTableLayer::GetNextFeature()
+{
+    if (!PrepareGetNextFeature())
+        return nullptr;
+
     OGRFeature *poFeature = OGRGeoPackageLayer::GetNextFeature();
     if (poFeature && m_iFIDAsRegularColumnIndex >= 0)
     {
@@ -3597,6 +3855,27 @@ OGRFeature *OGRGeoPackageTableLayer::GetNextFeature()
     return poFeature;
 }
 
+/************************************************************************/
+/*                         GetNextFeatureInto()                         */
+/************************************************************************/
+
+bool OGRGeoPackageTableLayer::GetNextFeatureInto(OGRFeature &oFeature)
+{
+    if (oFeature.GetDefnRef() != GetLayerDefn())
+        return OGRLayer::GetNextFeatureInto(oFeature);
+
+    if (!PrepareGetNextFeature() || !GetNextFeatureInternal(&oFeature))
+    {
+        oFeature.Reset();
+        return false;
+    }
+    if (m_iFIDAsRegularColumnIndex >= 0)
+    {
+        oFeature.SetField(m_iFIDAsRegularColumnIndex, oFeature.GetFID());
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                        GetFeature()                                  */
 /************************************************************************/
@@ -3608,6 +3887,8 @@ OGRFeature *OGRGeoPackageTableLayer::GetFeature(GIntBig nFID)
     if (m_bDeferredCreation && RunDeferredCreationIfNecessary() != OGRERR_NONE)
         return nullptr;
     CancelAsyncNextArrowArray();
+    if (!FlushPendingBulkInsert())
+        return nullptr;
 
     if (m_pszFidColumn == nullptr)
         return OGRLayer::GetFeature(nFID);
@@ -3744,6 +4025,9 @@ OGRErr OGRGeoPackageTableLayer::DeleteFeature(GIntBig nFID)
 
 bool OGRGeoPackageTableLayer::DoJobAtTransactionCommit()
 {
+    if (!FlushPendingBulkInsert())
+        return false;
+
     if (m_bAllowedRTreeThread)
         return true;
 
@@ -3761,6 +4045,7 @@ bool OGRGeoPackageTableLayer::DoJobAtTransactionCommit()
 
 bool OGRGeoPackageTableLayer::DoJobAtTransactionRollback()
 {
+    DiscardPendingBulkInsert();
     if (m_bThreadRTreeStarted)
         CancelAsyncRTree();
     m_nCountInsertInTransaction = 0;
@@ -3908,6 +4193,11 @@ bool OGRGeoPackageTableLayer::FlushPendingSpatialIndexUpdate()
 
 bool OGRGeoPackageTableLayer::RunDeferredSpatialIndexUpdate()
 {
+    // This is called before the table is read or modified other than through
+    // CreateFeature()
+    if (!FlushPendingBulkInsert())
+        return false;
+
     m_nCountInsertInTransaction = 0;
     if (m_aoRTreeTriggersSQL.empty())
         return true;
@@ -3936,11 +4226,15 @@ OGRErr OGRGeoPackageTableLayer::SyncToDisk()
     if (m_bDeferredCreation && RunDeferredCreationIfNecessary() != OGRERR_NONE)
         return OGRERR_FAILURE;
 
+    if (!FlushPendingBulkInsert())
+        return OGRERR_FAILURE;
+
     // Both are exclusive
     CreateSpatialIndexIfNecessary();
     if (!RunDeferredSpatialIndexUpdate())
         return OGRERR_FAILURE;
     RevertWorkaroundUpdate1TriggerIssue();
+    RestoreBulkLoadCacheSize();
 
     /* Save metadata back to the database */
     SaveExtent();
@@ -4401,10 +4695,281 @@ void OGRGeoPackageTableLayer::CreateSpatialIndexIfNecessary()
 {
     if (m_bDeferredSpatialIndexCreation)
     {
+        FlushPendingBulkInsert();
         CreateSpatialIndex();
     }
 }
 
+/************************************************************************/
+/*                   CollectRTreeEntriesInParallel()                    */
+/************************************************************************/
+
+// Used by CreateSpatialIndex() on a table that has been bulk loaded without
+// a spatial index. The FID range of the table is split between worker
+// threads, each of them with its own read-only connection to the database,
+// that decode the bounding box of the geometry blobs directly (from the
+// GeoPackage header envelope when present, from the WKB otherwise), rather
+// than through the ST_MinX() & co SQL functions. The resulting entries are
+// sorted along a Hilbert curve, so that consecutive insertions in the
+// in-memory RTree are spatially clustered.
+// Returns false if the parallel path cannot be used, in which case the
+// caller must fallback to the sequential one.
+
+bool OGRGeoPackageTableLayer::CollectRTreeEntriesInParallel(
+    const char *pszTableName, std::vector<GPKGRTreeEntry> &aoEntries)
+{
+    const char *pszNumThreads =
+        CPLGetConfigOption("OGR_GPKG_NUM_THREADS", nullptr);
+    int nThreads = !pszNumThreads ? std::min(4, CPLGetNumCPUs())
+                   : EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                      : atoi(pszNumThreads);
+    nThreads = GDALCapThreadCount(std::min(nThreads, 128));
+    if (nThreads <= 1 || sqlite3_threadsafe() == 0)
+        return false;
+
+    // Worker connections would not see rows not yet committed
+    if (m_poDS->IsInTransaction())
+        return false;
+    const std::string osFilename(m_poDS->GetDescription());
+    if (osFilename.empty() || STARTS_WITH(osFilename.c_str(), ":memory:"))
+        return false;
+
+    const char *pszC = m_poFeatureDefn->GetGeomFieldDefn(0)->GetNameRef();
+    char *pszSQL =
+        sqlite3_mprintf("SELECT MIN(\"%w\"), MAX(\"%w\") FROM \"%w\"",
+                        m_pszFidColumn, m_pszFidColumn, pszTableName);
+    auto oResult = SQLQuery(m_poDS->GetDB(), pszSQL);
+    sqlite3_free(pszSQL);
+    if (!oResult || oResult->RowCount() != 1 || !oResult->GetValue(0, 0) ||
+        !oResult->GetValue(1, 0))
+    {
+        return false;
+    }
+    const GIntBig nMinFID = CPLAtoGIntBig(oResult->GetValue(0, 0));
+    const GIntBig nMaxFID = CPLAtoGIntBig(oResult->GetValue(1, 0));
+    if (nMaxFID < nMinFID)
+        return false;
+    const GUIntBig nRange = static_cast<GUIntBig>(nMaxFID) -
+                            static_cast<GUIntBig>(nMinFID) + 1;
+
+    // For unit tests
+    const GUIntBig nMinRowsPerThread = std::max<GUIntBig>(
+        1, static_cast<GUIntBig>(std::strtoull(
+               CPLGetConfigOption("OGR_GPKG_PARALLEL_RTREE_MIN_ROWS_PER_THREAD",
+                                  "100000"),
+               nullptr, 10)));
+    if (nRange / nMinRowsPerThread < static_cast<GUIntBig>(nThreads))
+        nThreads = static_cast<int>(nRange / nMinRowsPerThread);
+    if (nThreads <= 1)
+        return false;
+
+    // Entries, sort keys and the in-memory RTree (about 41 bytes per row)
+    // must fit within the RAM budget of the RTree.
+    constexpr GUIntBig BYTES_PER_ROW =
+        sizeof(GPKGRTreeEntry) + sizeof(std::pair<GUInt32, GPKGRTreeEntry>) +
+        41;
+    if (nRange > GetMaxRAMUsageAllowedForRTree() / BYTES_PER_ROW)
+        return false;
+
+    CPLWorkerThreadPool *poPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poPool)
+        return false;
+    auto poJobQueue = poPool->CreateJobQueue();
+
+    struct Job
+    {
+        GIntBig nStartFID = 0;
+        GIntBig nEndFID = 0;
+        std::vector<GPKGRTreeEntry> aoEntries{};
+        std::string osErrorMsg{};
+    };
+
+    std::vector<Job> asJobs(nThreads);
+    const GUIntBig nRowsPerJob = nRange / nThreads;
+    for (int i = 0; i < nThreads; ++i)
+    {
+        asJobs[i].nStartFID =
+            static_cast<GIntBig>(static_cast<GUIntBig>(nMinFID) +
+                                 static_cast<GUIntBig>(i) * nRowsPerJob);
+        asJobs[i].nEndFID =
+            (i + 1 == nThreads)
+                ? nMaxFID
+                : static_cast<GIntBig>(static_cast<GUIntBig>(nMinFID) +
+                                       static_cast<GUIntBig>(i + 1) *
+                                           nRowsPerJob -
+                                       1);
+    }
+
+    pszSQL = sqlite3_mprintf("SELECT \"%w\", \"%w\" FROM \"%w\" WHERE \"%w\" "
+                             "BETWEEN ? AND ?",
+                             m_pszFidColumn, pszC, pszTableName,
+                             m_pszFidColumn);
+    const std::string osSQL(pszSQL);
+    sqlite3_free(pszSQL);
+    const char *pszVFS = m_poDS->GetVFS() ? m_poDS->GetVFS()->zName : nullptr;
+
+    std::vector<std::function<void()>> apfnJobs;
+    for (auto &oJob : asJobs)
+    {
+        apfnJobs.emplace_back(
+            [&oJob, &osFilename, &osSQL, pszVFS]()
+            {
+                sqlite3 *hDB = nullptr;
+                if (sqlite3_open_v2(osFilename.c_str(), &hDB,
+                                    SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX,
+                                    pszVFS) != SQLITE_OK)
+                {
+                    oJob.osErrorMsg = "sqlite3_open_v2() failed";
+                    sqlite3_close(hDB);
+                    return;
+                }
+                sqlite3_stmt *hStmt = nullptr;
+                if (sqlite3_prepare_v2(hDB, osSQL.c_str(), -1, &hStmt,
+                                       nullptr) != SQLITE_OK)
+                {
+                    oJob.osErrorMsg = sqlite3_errmsg(hDB);
+                    sqlite3_close(hDB);
+                    return;
+                }
+                sqlite3_bind_int64(hStmt, 1, oJob.nStartFID);
+                sqlite3_bind_int64(hStmt, 2, oJob.nEndFID);
+
+                int rc = SQLITE_DONE;
+                try
+                {
+                    while ((rc = sqlite3_step(hStmt)) == SQLITE_ROW)
+                    {
+                        if (sqlite3_column_type(hStmt, 1) != SQLITE_BLOB)
+                            continue;
+                        const GByte *pabyBlob = static_cast<const GByte *>(
+                            sqlite3_column_blob(hStmt, 1));
+                        const size_t nBlobLen =
+                            static_cast<size_t>(sqlite3_column_bytes(hStmt, 1));
+                        GPkgHeader sHeader;
+                        if (GPkgHeaderFromWKB(pabyBlob, nBlobLen, &sHeader) !=
+                                OGRERR_NONE ||
+                            sHeader.bEmpty)
+                        {
+                            continue;
+                        }
+                        OGREnvelope sEnv;
+                        if (sHeader.bExtentHasXY)
+                        {
+                            sEnv.MinX = sHeader.MinX;
+                            sEnv.MinY = sHeader.MinY;
+                            sEnv.MaxX = sHeader.MaxX;
+                            sEnv.MaxY = sHeader.MaxY;
+                        }
+                        else if (!OGRWKBGetBoundingBox(
+                                     pabyBlob + sHeader.nHeaderLen,
+                                     nBlobLen - sHeader.nHeaderLen, sEnv))
+                        {
+                            continue;
+                        }
+                        GPKGRTreeEntry sEntry;
+                        sEntry.nId = sqlite3_column_int64(hStmt, 0);
+                        sEntry.fMinX = rtreeValueDown(sEnv.MinX);
+                        sEntry.fMaxX = rtreeValueUp(sEnv.MaxX);
+                        sEntry.fMinY = rtreeValueDown(sEnv.MinY);
+                        sEntry.fMaxY = rtreeValueUp(sEnv.MaxY);
+                        oJob.aoEntries.push_back(sEntry);
+                    }
+                    if (rc != SQLITE_DONE)
+                        oJob.osErrorMsg = sqlite3_errmsg(hDB);
+                }
+                catch (const std::exception &)
+                {
+                    oJob.osErrorMsg = "out of memory";
+                }
+                sqlite3_finalize(hStmt);
+                sqlite3_close(hDB);
+            });
+    }
+    struct JobRunner
+    {
+        static void Run(void *pData)
+        {
+            (*static_cast<std::function<void()> *>(pData))();
+        }
+    };
+    for (auto &pfnJob : apfnJobs)
+    {
+        if (!poJobQueue->SubmitJob(JobRunner::Run, &pfnJob))
+            pfnJob();
+    }
+    poJobQueue->WaitCompletion();
+
+    size_t nTotalEntries = 0;
+    for (const auto &oJob : asJobs)
+    {
+        if (!oJob.osErrorMsg.empty())
+        {
+            CPLDebug("GPKG",
+                     "Parallel extraction of RTree entries failed (%s). "
+                     "Using sequential path",
+                     oJob.osErrorMsg.c_str());
+            return false;
+        }
+        nTotalEntries += oJob.aoEntries.size();
+    }
+    CPLDebug("GPKG",
+             "%d threads extracted " CPL_FRMT_GUIB " RTree entries from %s",
+             nThreads, static_cast<GUIntBig>(nTotalEntries), pszTableName);
+
+    OGREnvelope sExtent;
+    for (const auto &oJob : asJobs)
+    {
+        for (const auto &sEntry : oJob.aoEntries)
+        {
+            sExtent.Merge(sEntry.fMinX, sEntry.fMinY);
+            sExtent.Merge(sEntry.fMaxX, sEntry.fMaxY);
+        }
+    }
+    const double dfWidth = sExtent.MaxX - sExtent.MinX;
+    const double dfHeight = sExtent.MaxY - sExtent.MinY;
+
+    try
+    {
+        std::vector<std::pair<GUInt32, GPKGRTreeEntry>> aoSorted;
+        aoSorted.reserve(nTotalEntries);
+        for (auto &oJob : asJobs)
+        {
+            for (const auto &sEntry : oJob.aoEntries)
+            {
+                aoSorted.emplace_back(
+                    CPLHilbertCodeInExtent(0.5 * (sEntry.fMinX + sEntry.fMaxX),
+                                           0.5 * (sEntry.fMinY + sEntry.fMaxY),
+                                           sExtent.MinX, sExtent.MinY, dfWidth,
+                                           dfHeight),
+                    sEntry);
+            }
+            oJob.aoEntries = std::vector<GPKGRTreeEntry>();
+        }
+        std::sort(aoSorted.begin(), aoSorted.end(),
+                  [](const std::pair<GUInt32, GPKGRTreeEntry> &a,
+                     const std::pair<GUInt32, GPKGRTreeEntry> &b)
+                  {
+                      if (a.first != b.first)
+                          return a.first < b.first;
+                      return a.second.nId < b.second.nId;
+                  });
+
+        aoEntries.clear();
+        aoEntries.reserve(nTotalEntries);
+        for (const auto &oPair : aoSorted)
+            aoEntries.push_back(oPair.second);
+    }
+    catch (const std::exception &)
+    {
+        CPLDebug("GPKG", "Out of memory while sorting RTree entries. "
+                         "Using sequential path");
+        aoEntries.clear();
+        return false;
+    }
+
+    return true;
+}
+
 /************************************************************************/
 /*                       CreateSpatialIndex()                           */
 /************************************************************************/
@@ -4494,6 +5059,13 @@ bool OGRGeoPackageTableLayer::CreateSpatialIndex(const char *pszTableName)
         }
     }
 
+    // Must be done before starting the transaction, as worker connections
+    // only see committed rows.
+    std::vector<GPKGRTreeEntry> aoParallelEntries;
+    const bool bPopulateFromParallelEntries =
+        !m_hRTree && !bPopulateFromThreadRTree &&
+        CollectRTreeEntriesInParallel(pszT, aoParallelEntries);
+
     m_poDS->SoftStartTransaction();
 
     if (m_hRTree)
@@ -4538,6 +5110,41 @@ bool OGRGeoPackageTableLayer::CreateSpatialIndex(const char *pszTableName)
             return false;
         }
     }
+    else if (bPopulateFromParallelEntries)
+    {
+        const int nPageSize =
+            SQLGetInteger(m_poDS->GetDB(), "PRAGMA page_size", nullptr);
+        m_hRTree = gdal_sqlite_rtree_bl_new(nPageSize);
+        bool bOK = m_hRTree != nullptr;
+        for (const auto &sEntry : aoParallelEntries)
+        {
+            if (!gdal_sqlite_rtree_bl_insert(m_hRTree, sEntry.nId,
+                                             sEntry.fMinX, sEntry.fMinY,
+                                             sEntry.fMaxX, sEntry.fMaxY))
+            {
+                bOK = false;
+                break;
+            }
+        }
+        aoParallelEntries = std::vector<GPKGRTreeEntry>();
+        if (!bOK)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot insert entries in in-memory RTree");
+            if (m_hRTree)
+            {
+                gdal_sqlite_rtree_bl_free(m_hRTree);
+                m_hRTree = nullptr;
+            }
+            m_poDS->SoftRollbackTransaction();
+            return false;
+        }
+        if (!FlushInMemoryRTree(m_poDS->GetDB(), m_osRTreeName.c_str()))
+        {
+            m_poDS->SoftRollbackTransaction();
+            return false;
+        }
+    }
     else
     {
         /* Populate the RTree */
@@ -8566,111 +9173,160 @@ int OGRGeoPackageTableLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
         return GetNextArrowArrayAsynchronous(stream, out_array);
     }
 
-    // We can use this optimized version only if there is no hole in FID
-    // numbering. That is min(fid) == 1 and max(fid) == m_nTotalFeatureCount
+    // We can use this optimized version only if the FID numbering is dense
+    // enough, so that reading ranges of FIDs does not produce too many
+    // empty or tiny batches.
     if (m_nIsCompatOfOptimizedGetNextArrowArray < 0)
     {
         m_nIsCompatOfOptimizedGetNextArrowArray = FALSE;
         const auto nTotalFeatureCount = GetTotalFeatureCount();
-        if (nTotalFeatureCount < 0)
+        if (nTotalFeatureCount <= 0)
             return GetNextArrowArrayAsynchronous(stream, out_array);
+        GIntBig nMaxFID;
         {
             char *pszSQL = sqlite3_mprintf("SELECT MAX(\"%w\") FROM \"%w\"",
                                            m_pszFidColumn, m_pszTableName);
             OGRErr err;
-            const auto nMaxFID = SQLGetInteger64(m_poDS->GetDB(), pszSQL, &err);
+            nMaxFID = SQLGetInteger64(m_poDS->GetDB(), pszSQL, &err);
             sqlite3_free(pszSQL);
-            if (nMaxFID != nTotalFeatureCount)
+            if (err != OGRERR_NONE)
                 return GetNextArrowArrayAsynchronous(stream, out_array);
         }
+        GIntBig nMinFID;
         {
             char *pszSQL = sqlite3_mprintf("SELECT MIN(\"%w\") FROM \"%w\"",
                                            m_pszFidColumn, m_pszTableName);
             OGRErr err;
-            const auto nMinFID = SQLGetInteger64(m_poDS->GetDB(), pszSQL, &err);
+            nMinFID = SQLGetInteger64(m_poDS->GetDB(), pszSQL, &err);
             sqlite3_free(pszSQL);
-            if (nMinFID != 1)
+            if (err != OGRERR_NONE)
                 return GetNextArrowArrayAsynchronous(stream, out_array);
         }
+        // Also avoids integer overflows when iterating over FID ranges
+        if (nMinFID <= GINTBIG_MIN / 2 || nMaxFID >= GINTBIG_MAX / 2 ||
+            nMaxFID - nMinFID >= 2 * nTotalFeatureCount)
+        {
+            return GetNextArrowArrayAsynchronous(stream, out_array);
+        }
+        m_nArrowMinFID = nMinFID;
+        m_nArrowMaxFID = nMaxFID;
         m_nIsCompatOfOptimizedGetNextArrowArray = TRUE;
     }
 
+    if (!m_bGetNextArrowArrayCalledSinceResetReading)
+    {
+        // m_iNextShapeId == 0 given the above tests
+        m_iNextArrowFID = m_nArrowMinFID;
+    }
     m_bGetNextArrowArrayCalledSinceResetReading = true;
 
-    // CPLDebug("GPKG", "m_iNextShapeId = " CPL_FRMT_GIB, m_iNextShapeId);
+    // CPLDebug("GPKG", "m_iNextArrowFID = " CPL_FRMT_GIB, m_iNextArrowFID);
 
     const int nMaxBatchSize = OGRArrowArrayHelper::GetMaxFeaturesInBatch(
         m_aosArrowArrayStreamOptions);
 
-    // Fetch the answer from a potentially queued asynchronous task
-    if (!m_oQueueArrowArrayPrefetchTasks.empty())
+    const auto GetThreadsAvailable = [this]()
     {
-        const size_t nTasks = m_oQueueArrowArrayPrefetchTasks.size();
-        auto task = std::move(m_oQueueArrowArrayPrefetchTasks.front());
-        m_oQueueArrowArrayPrefetchTasks.pop();
+        const char *pszMaxThreads =
+            m_aosArrowArrayStreamOptions.FetchNameValue("MAX_THREADS");
+        if (pszMaxThreads == nullptr)
+            pszMaxThreads = CPLGetConfigOption("OGR_GPKG_NUM_THREADS", nullptr);
+        if (pszMaxThreads == nullptr)
+            return std::min(4, CPLGetNumCPUs());
+        else if (EQUAL(pszMaxThreads, "ALL_CPUS"))
+            return CPLGetNumCPUs();
+        else
+            return atoi(pszMaxThreads);
+    };
 
-        // Wait for thread to be ready
+    // Each iteration processes one range of nMaxBatchSize FIDs. We only
+    // iterate more than once when ranges do not contain any feature.
+    while (true)
+    {
+        // Fetch the answer from a potentially queued asynchronous task
+        while (!m_oQueueArrowArrayPrefetchTasks.empty())
         {
-            std::unique_lock<std::mutex> oLock(task->m_oMutex);
-            while (!task->m_bArrayReady)
-            {
-                task->m_oCV.wait(oLock);
-            }
-            task->m_bArrayReady = false;
-        }
-        if (!task->m_osErrorMsg.empty())
-            CPLError(CE_Failure, CPLE_AppDefined, "%s",
-                     task->m_osErrorMsg.c_str());
+            const size_t nTasks = m_oQueueArrowArrayPrefetchTasks.size();
+            auto task = std::move(m_oQueueArrowArrayPrefetchTasks.front());
+            m_oQueueArrowArrayPrefetchTasks.pop();
 
-        const auto stopThread = [&task]()
-        {
+            // Wait for thread to be ready
             {
-                std::lock_guard oLock(task->m_oMutex);
-                task->m_bStop = true;
-                task->m_oCV.notify_one();
+                std::unique_lock<std::mutex> oLock(task->m_oMutex);
+                while (!task->m_bArrayReady)
+                {
+                    task->m_oCV.wait(oLock);
+                }
+                task->m_bArrayReady = false;
             }
-            if (task->m_oThread.joinable())
-                task->m_oThread.join();
-        };
+            if (!task->m_osErrorMsg.empty())
+                CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                         task->m_osErrorMsg.c_str());
 
-        if (task->m_iStartShapeId != m_iNextShapeId)
-        {
-            // Should not normally happen, unless the user messes with
-            // GetNextFeature()
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Worker thread task has not expected m_iStartShapeId "
-                     "value. Got " CPL_FRMT_GIB ", expected " CPL_FRMT_GIB,
-                     task->m_iStartShapeId, m_iNextShapeId);
-            if (task->m_psArrowArray->release)
-                task->m_psArrowArray->release(task->m_psArrowArray.get());
+            const auto stopThread = [&task]()
+            {
+                {
+                    std::lock_guard oLock(task->m_oMutex);
+                    task->m_bStop = true;
+                    task->m_oCV.notify_one();
+                }
+                if (task->m_oThread.joinable())
+                    task->m_oThread.join();
+            };
 
-            stopThread();
-        }
-        else if (task->m_psArrowArray->release)
-        {
-            m_iNextShapeId += task->m_psArrowArray->length;
+            if (task->m_iStartFID != m_iNextArrowFID)
+            {
+                // Should not normally happen, unless the user messes with
+                // GetNextFeature()
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Worker thread task has not expected m_iStartFID "
+                         "value. Got " CPL_FRMT_GIB ", expected " CPL_FRMT_GIB,
+                         task->m_iStartFID, m_iNextArrowFID);
+                if (task->m_psArrowArray->release)
+                    task->m_psArrowArray->release(task->m_psArrowArray.get());
 
-            // Transfer the task ArrowArray to the client array
-            memcpy(out_array, task->m_psArrowArray.get(),
-                   sizeof(struct ArrowArray));
-            memset(task->m_psArrowArray.get(), 0, sizeof(struct ArrowArray));
+                stopThread();
+                break;
+            }
 
-            if (task->m_bMemoryLimitReached)
+            if (task->m_nRet != 0)
             {
-                m_nIsCompatOfOptimizedGetNextArrowArray = false;
+                // Let the synchronous read below report the error
                 stopThread();
-                CancelAsyncNextArrowArray();
-                return 0;
+                break;
+            }
+
+            bool bGotArray = false;
+            if (task->m_psArrowArray->release)
+            {
+                m_iNextShapeId += task->m_psArrowArray->length;
+
+                // Transfer the task ArrowArray to the client array
+                memcpy(out_array, task->m_psArrowArray.get(),
+                       sizeof(struct ArrowArray));
+                memset(task->m_psArrowArray.get(), 0,
+                       sizeof(struct ArrowArray));
+                bGotArray = true;
+
+                if (task->m_bMemoryLimitReached)
+                {
+                    m_nIsCompatOfOptimizedGetNextArrowArray = false;
+                    stopThread();
+                    CancelAsyncNextArrowArray();
+                    return 0;
+                }
             }
+            m_iNextArrowFID += nMaxBatchSize;
+
             // Are the records still available for reading beyond the current
             // queued tasks ? If so, recycle this task to read them
-            else if (task->m_iStartShapeId +
-                         static_cast<GIntBig>(nTasks) * nMaxBatchSize <=
-                     m_nTotalFeatureCount)
+            if (task->m_iStartFID +
+                    static_cast<GIntBig>(nTasks) * nMaxBatchSize <=
+                m_nArrowMaxFID)
             {
-                task->m_iStartShapeId +=
+                task->m_iStartFID +=
                     static_cast<GIntBig>(nTasks) * nMaxBatchSize;
-                task->m_poLayer->m_iNextShapeId = task->m_iStartShapeId;
+                task->m_poLayer->m_iNextArrowFID = task->m_iStartFID;
                 try
                 {
                     // Wake-up thread with new task
@@ -8680,154 +9336,159 @@ int OGRGeoPackageTableLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
                         task->m_oCV.notify_one();
                     }
                     m_oQueueArrowArrayPrefetchTasks.push(std::move(task));
-                    return 0;
                 }
                 catch (const std::exception &e)
                 {
                     CPLError(CE_Failure, CPLE_AppDefined,
                              "Cannot start worker thread: %s", e.what());
+                    stopThread();
+                    if (bGotArray)
+                        return 0;
+                    break;
                 }
             }
             else
             {
                 stopThread();
-                return 0;
-            }
-        }
-
-        stopThread();
-    }
-
-    const auto GetThreadsAvailable = []()
-    {
-        const char *pszMaxThreads =
-            CPLGetConfigOption("OGR_GPKG_NUM_THREADS", nullptr);
-        if (pszMaxThreads == nullptr)
-            return std::min(4, CPLGetNumCPUs());
-        else if (EQUAL(pszMaxThreads, "ALL_CPUS"))
-            return CPLGetNumCPUs();
-        else
-            return atoi(pszMaxThreads);
-    };
-
-    // Start asynchronous tasks to prefetch the next ArrowArray
-    if (m_poDS->GetAccess() == GA_ReadOnly &&
-        m_oQueueArrowArrayPrefetchTasks.empty() &&
-        m_iNextShapeId + 2 * static_cast<GIntBig>(nMaxBatchSize) <=
-            m_nTotalFeatureCount &&
-        sqlite3_threadsafe() != 0 && GetThreadsAvailable() >= 2 &&
-        CPLGetUsablePhysicalRAM() > 1024 * 1024 * 1024)
-    {
-        const int nMaxTasks = static_cast<int>(std::min<GIntBig>(
-            DIV_ROUND_UP(m_nTotalFeatureCount - nMaxBatchSize - m_iNextShapeId,
-                         nMaxBatchSize),
-            GetThreadsAvailable()));
-        CPLDebug("GPKG", "Using %d threads", nMaxTasks);
-        GDALOpenInfo oOpenInfo(m_poDS->GetDescription(), GA_ReadOnly);
-        oOpenInfo.papszOpenOptions = m_poDS->GetOpenOptions();
-        oOpenInfo.nOpenFlags = GDAL_OF_VECTOR;
-        for (int iTask = 0; iTask < nMaxTasks; ++iTask)
-        {
-            auto task = std::make_unique<ArrowArrayPrefetchTask>();
-            task->m_iStartShapeId =
-                m_iNextShapeId +
-                static_cast<GIntBig>(iTask + 1) * nMaxBatchSize;
-            task->m_poDS = std::make_unique<GDALGeoPackageDataset>();
-            if (!task->m_poDS->Open(&oOpenInfo, m_poDS->m_osFilenameInZip))
-            {
-                break;
-            }
-            auto poOtherLayer = dynamic_cast<OGRGeoPackageTableLayer *>(
-                task->m_poDS->GetLayerByName(GetName()));
-            if (poOtherLayer == nullptr ||
-                poOtherLayer->GetLayerDefn()->GetFieldCount() !=
-                    m_poFeatureDefn->GetFieldCount())
-            {
-                break;
             }
 
-            // Install query logging callback
-            if (m_poDS->pfnQueryLoggerFunc)
+            if (bGotArray)
+                return 0;
+            // Otherwise, the FID range of this task was empty: go on with the
+            // next task.
+        }
+
+        // Start asynchronous tasks to prefetch the next ArrowArray
+        if (m_poDS->GetAccess() == GA_ReadOnly &&
+            m_oQueueArrowArrayPrefetchTasks.empty() &&
+            m_iNextArrowFID + 2 * static_cast<GIntBig>(nMaxBatchSize) <=
+                m_nArrowMaxFID + 1 &&
+            sqlite3_threadsafe() != 0 && GetThreadsAvailable() >= 2 &&
+            CPLGetUsablePhysicalRAM() > 1024 * 1024 * 1024)
+        {
+            const int nMaxTasks = static_cast<int>(std::min<GIntBig>(
+                DIV_ROUND_UP(m_nArrowMaxFID + 1 - nMaxBatchSize -
+                                 m_iNextArrowFID,
+                             nMaxBatchSize),
+                GetThreadsAvailable()));
+            CPLDebug("GPKG", "Using %d threads", nMaxTasks);
+            GDALOpenInfo oOpenInfo(m_poDS->GetDescription(), GA_ReadOnly);
+            oOpenInfo.papszOpenOptions = m_poDS->GetOpenOptions();
+            oOpenInfo.nOpenFlags = GDAL_OF_VECTOR;
+            for (int iTask = 0; iTask < nMaxTasks; ++iTask)
             {
-                task->m_poDS->SetQueryLoggerFunc(m_poDS->pfnQueryLoggerFunc,
-                                                 m_poDS->poQueryLoggerArg);
-            }
+                auto task = std::make_unique<ArrowArrayPrefetchTask>();
+                task->m_iStartFID =
+                    m_iNextArrowFID +
+                    static_cast<GIntBig>(iTask + 1) * nMaxBatchSize;
+                task->m_poDS = std::make_unique<GDALGeoPackageDataset>();
+                if (!task->m_poDS->Open(&oOpenInfo, m_poDS->m_osFilenameInZip))
+                {
+                    break;
+                }
+                auto poOtherLayer = dynamic_cast<OGRGeoPackageTableLayer *>(
+                    task->m_poDS->GetLayerByName(GetName()));
+                if (poOtherLayer == nullptr ||
+                    poOtherLayer->GetLayerDefn()->GetFieldCount() !=
+                        m_poFeatureDefn->GetFieldCount())
+                {
+                    break;
+                }
 
-            task->m_poLayer = poOtherLayer;
-            task->m_psArrowArray = std::make_unique<struct ArrowArray>();
-            memset(task->m_psArrowArray.get(), 0, sizeof(struct ArrowArray));
+                // Install query logging callback
+                if (m_poDS->pfnQueryLoggerFunc)
+                {
+                    task->m_poDS->SetQueryLoggerFunc(
+                        m_poDS->pfnQueryLoggerFunc, m_poDS->poQueryLoggerArg);
+                }
 
-            poOtherLayer->m_nTotalFeatureCount = m_nTotalFeatureCount;
-            poOtherLayer->m_aosArrowArrayStreamOptions =
-                m_aosArrowArrayStreamOptions;
-            auto poOtherFDefn = poOtherLayer->GetLayerDefn();
-            for (int i = 0; i < m_poFeatureDefn->GetGeomFieldCount(); ++i)
-            {
-                poOtherFDefn->GetGeomFieldDefn(i)->SetIgnored(
-                    m_poFeatureDefn->GetGeomFieldDefn(i)->IsIgnored());
-            }
-            for (int i = 0; i < m_poFeatureDefn->GetFieldCount(); ++i)
-            {
-                poOtherFDefn->GetFieldDefn(i)->SetIgnored(
-                    m_poFeatureDefn->GetFieldDefn(i)->IsIgnored());
-            }
+                task->m_poLayer = poOtherLayer;
+                task->m_psArrowArray = std::make_unique<struct ArrowArray>();
+                memset(task->m_psArrowArray.get(), 0,
+                       sizeof(struct ArrowArray));
+
+                poOtherLayer->m_nArrowMinFID = m_nArrowMinFID;
+                poOtherLayer->m_nArrowMaxFID = m_nArrowMaxFID;
+                poOtherLayer->m_aosArrowArrayStreamOptions =
+                    m_aosArrowArrayStreamOptions;
+                auto poOtherFDefn = poOtherLayer->GetLayerDefn();
+                for (int i = 0; i < m_poFeatureDefn->GetGeomFieldCount(); ++i)
+                {
+                    poOtherFDefn->GetGeomFieldDefn(i)->SetIgnored(
+                        m_poFeatureDefn->GetGeomFieldDefn(i)->IsIgnored());
+                }
+                for (int i = 0; i < m_poFeatureDefn->GetFieldCount(); ++i)
+                {
+                    poOtherFDefn->GetFieldDefn(i)->SetIgnored(
+                        m_poFeatureDefn->GetFieldDefn(i)->IsIgnored());
+                }
 
-            poOtherLayer->m_iNextShapeId = task->m_iStartShapeId;
+                poOtherLayer->m_iNextArrowFID = task->m_iStartFID;
 
-            auto taskPtr = task.get();
-            auto taskRunner = [taskPtr]()
-            {
-                std::unique_lock oLock(taskPtr->m_oMutex);
-                do
+                auto taskPtr = task.get();
+                auto taskRunner = [taskPtr]()
                 {
-                    taskPtr->m_bFetchRows = false;
-                    taskPtr->m_poLayer->GetNextArrowArrayInternal(
-                        taskPtr->m_psArrowArray.get(), taskPtr->m_osErrorMsg,
-                        taskPtr->m_bMemoryLimitReached);
-                    taskPtr->m_bArrayReady = true;
-                    taskPtr->m_oCV.notify_one();
-                    if (taskPtr->m_bMemoryLimitReached)
-                        break;
-                    // cppcheck-suppress knownConditionTrueFalse
-                    // Coverity apparently is confused by the fact that we
-                    // use unique_lock here to guard access for m_bStop whereas
-                    // in other places we use a lock_guard, but there's nothing
-                    // wrong.
-                    // coverity[missing_lock:FALSE]
-                    while (!taskPtr->m_bStop && !taskPtr->m_bFetchRows)
+                    std::unique_lock oLock(taskPtr->m_oMutex);
+                    do
                     {
-                        taskPtr->m_oCV.wait(oLock);
-                    }
-                } while (!taskPtr->m_bStop);
-            };
+                        taskPtr->m_bFetchRows = false;
+                        taskPtr->m_nRet =
+                            taskPtr->m_poLayer->GetNextArrowArrayInternal(
+                                taskPtr->m_psArrowArray.get(),
+                                taskPtr->m_osErrorMsg,
+                                taskPtr->m_bMemoryLimitReached);
+                        taskPtr->m_bArrayReady = true;
+                        taskPtr->m_oCV.notify_one();
+                        if (taskPtr->m_bMemoryLimitReached ||
+                            taskPtr->m_nRet != 0)
+                            break;
+                        // cppcheck-suppress knownConditionTrueFalse
+                        // Coverity apparently is confused by the fact that we
+                        // use unique_lock here to guard access for m_bStop
+                        // whereas in other places we use a lock_guard, but
+                        // there's nothing wrong.
+                        // coverity[missing_lock:FALSE]
+                        while (!taskPtr->m_bStop && !taskPtr->m_bFetchRows)
+                        {
+                            taskPtr->m_oCV.wait(oLock);
+                        }
+                    } while (!taskPtr->m_bStop);
+                };
 
-            task->m_bFetchRows = true;
-            try
-            {
-                task->m_oThread = std::thread(taskRunner);
-            }
-            catch (const std::exception &e)
-            {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Cannot start worker thread: %s", e.what());
-                break;
+                task->m_bFetchRows = true;
+                try
+                {
+                    task->m_oThread = std::thread(taskRunner);
+                }
+                catch (const std::exception &e)
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Cannot start worker thread: %s", e.what());
+                    break;
+                }
+                m_oQueueArrowArrayPrefetchTasks.push(std::move(task));
             }
-            m_oQueueArrowArrayPrefetchTasks.push(std::move(task));
         }
-    }
 
-    std::string osErrorMsg;
-    bool bMemoryLimitReached = false;
-    int ret =
-        GetNextArrowArrayInternal(out_array, osErrorMsg, bMemoryLimitReached);
-    if (!osErrorMsg.empty())
-        CPLError(CE_Failure, CPLE_AppDefined, "%s", osErrorMsg.c_str());
-    if (bMemoryLimitReached)
-    {
-        CancelAsyncNextArrowArray();
-        m_nIsCompatOfOptimizedGetNextArrowArray = false;
+        std::string osErrorMsg;
+        bool bMemoryLimitReached = false;
+        int ret = GetNextArrowArrayInternal(out_array, osErrorMsg,
+                                            bMemoryLimitReached);
+        if (!osErrorMsg.empty())
+            CPLError(CE_Failure, CPLE_AppDefined, "%s", osErrorMsg.c_str());
+        if (bMemoryLimitReached)
+        {
+            CancelAsyncNextArrowArray();
+            m_nIsCompatOfOptimizedGetNextArrowArray = false;
+        }
+        if (ret != 0 || out_array->release != nullptr ||
+            bMemoryLimitReached || !osErrorMsg.empty() ||
+            m_iNextArrowFID > m_nArrowMaxFID)
+        {
+            return ret;
+        }
+        // Otherwise the FID range was empty: go on with the next one.
     }
-    return ret;
 }
 
 /************************************************************************/
@@ -8841,7 +9502,7 @@ int OGRGeoPackageTableLayer::GetNextArrowArrayInternal(
     bMemoryLimitReached = false;
     memset(out_array, 0, sizeof(*out_array));
 
-    if (m_iNextShapeId >= m_nTotalFeatureCount)
+    if (m_iNextArrowFID > m_nArrowMaxFID)
     {
         return 0;
     }
@@ -8917,10 +9578,10 @@ int OGRGeoPackageTableLayer::GetNextArrowArrayInternal(
     osSQL += "\" WHERE \"";
     osSQL += SQLEscapeName(m_pszFidColumn);
     osSQL += "\" BETWEEN ";
-    osSQL += std::to_string(m_iNextShapeId + 1);
+    osSQL += std::to_string(m_iNextArrowFID);
     osSQL += " AND ";
-    osSQL += std::to_string(m_iNextShapeId +
-                            sFillArrowArray.psHelper->m_nMaxBatchSize);
+    osSQL += std::to_string(m_iNextArrowFID +
+                            sFillArrowArray.psHelper->m_nMaxBatchSize - 1);
 
     // CPLDebug("GPKG", "%s", osSQL.c_str());
 
@@ -8956,6 +9617,7 @@ int OGRGeoPackageTableLayer::GetNextArrowArrayInternal(
     }
 
     m_iNextShapeId += sFillArrowArray.nCountRows;
+    m_iNextArrowFID += sFillArrowArray.psHelper->m_nMaxBatchSize;
 
     return 0;
 }
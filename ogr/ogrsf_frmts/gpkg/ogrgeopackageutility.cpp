@@ -31,6 +31,7 @@
 #include "ogr_wkb.h"
 #include "sqlite/ogrsqlitebase.h"
 #include <limits>
+#include <new>
 
 /* Requirement 20: A GeoPackage SHALL store feature table geometries */
 /* with the basic simple feature geometry types (Geometry, Point, */
@@ -241,9 +242,13 @@ const char *GPkgFieldFromOGR(OGRFieldType eType, OGRFieldSubType eSubType,
  *
  */
 
-GByte *GPkgGeometryFromOGR(const OGRGeometry *poGeometry, int iSrsId,
-                           const OGRGeomCoordinateBinaryPrecision *psPrecision,
-                           size_t *pnWkbLen)
+// If pabyBuffer is not null, the blob is serialized into it, and the
+// returned pointer is pabyBuffer->data(). Otherwise it is allocated with
+// VSIMalloc() and must be freed with CPLFree().
+static GByte *
+GPkgGeometryFromOGR(const OGRGeometry *poGeometry, int iSrsId,
+                    const OGRGeomCoordinateBinaryPrecision *psPrecision,
+                    size_t *pnWkbLen, std::vector<GByte> *pabyBuffer)
 {
     CPLAssert(poGeometry != nullptr);
 
@@ -276,9 +281,27 @@ GByte *GPkgGeometryFromOGR(const OGRGeometry *poGeometry, int iSrsId,
         CPLError(CE_Failure, CPLE_NotSupported, "too big geometry blob");
         return nullptr;
     }
-    GByte *pabyWkb = static_cast<GByte *>(VSI_MALLOC_VERBOSE(nWkbLen));
-    if (!pabyWkb)
-        return nullptr;
+    GByte *pabyWkb = nullptr;
+    if (pabyBuffer)
+    {
+        try
+        {
+            pabyBuffer->resize(nWkbLen);
+        }
+        catch (const std::bad_alloc &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate geometry blob");
+            return nullptr;
+        }
+        pabyWkb = pabyBuffer->data();
+    }
+    else
+    {
+        pabyWkb = static_cast<GByte *>(VSI_MALLOC_VERBOSE(nWkbLen));
+        if (!pabyWkb)
+            return nullptr;
+    }
     if (pnWkbLen)
         *pnWkbLen = nWkbLen;
 
@@ -358,13 +381,32 @@ GByte *GPkgGeometryFromOGR(const OGRGeometry *poGeometry, int iSrsId,
     err = poGeometry->exportToWkb(pabyPtr, &wkbExportOptions);
     if (err != OGRERR_NONE)
     {
-        CPLFree(pabyWkb);
+        if (!pabyBuffer)
+            CPLFree(pabyWkb);
         return nullptr;
     }
 
     return pabyWkb;
 }
 
+GByte *GPkgGeometryFromOGR(const OGRGeometry *poGeometry, int iSrsId,
+                           const OGRGeomCoordinateBinaryPrecision *psPrecision,
+                           size_t *pnWkbLen)
+{
+    return GPkgGeometryFromOGR(poGeometry, iSrsId, psPrecision, pnWkbLen,
+                               nullptr);
+}
+
+// Same as above, but serializes into abyBuffer, which can be reused from
+// one geometry to the other to avoid an allocation per call.
+bool GPkgGeometryFromOGR(const OGRGeometry *poGeometry, int iSrsId,
+                         const OGRGeomCoordinateBinaryPrecision *psPrecision,
+                         std::vector<GByte> &abyBuffer)
+{
+    return GPkgGeometryFromOGR(poGeometry, iSrsId, psPrecision, nullptr,
+                               &abyBuffer) != nullptr;
+}
+
 OGRErr GPkgHeaderFromWKB(const GByte *pabyGpkg, size_t nGpkgLen,
                          GPkgHeader *poHeader)
 {
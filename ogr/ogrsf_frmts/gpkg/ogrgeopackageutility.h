@@ -30,6 +30,8 @@
 #include "ogrsf_frmts.h"
 #include <sqlite3.h>
 
+#include <vector>
+
 #ifndef OGR_GEOPACKAGEUTILITY_H_INCLUDED
 #define OGR_GEOPACKAGEUTILITY_H_INCLUDED
 
@@ -61,6 +63,9 @@ OGRwkbGeometryType GPkgGeometryTypeToWKB(const char *pszGpkgType, bool bHasZ,
 GByte *GPkgGeometryFromOGR(const OGRGeometry *poGeometry, int iSrsId,
                            const OGRGeomCoordinateBinaryPrecision *psPrecision,
                            size_t *pnWkbLen);
+bool GPkgGeometryFromOGR(const OGRGeometry *poGeometry, int iSrsId,
+                         const OGRGeomCoordinateBinaryPrecision *psPrecision,
+                         std::vector<GByte> &abyBuffer);
 OGRGeometry *GPkgGeometryToOGR(const GByte *pabyGpkg, size_t nGpkgLen,
                                OGRSpatialReference *poSrs);
 
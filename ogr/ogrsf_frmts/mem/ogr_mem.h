@@ -31,9 +31,11 @@
 #ifndef OGRMEM_H_INCLUDED
 #define OGRMEM_H_INCLUDED
 
+#include "cpl_quad_tree.h"
 #include "ogrsf_frmts.h"
 
 #include <map>
+#include <vector>
 
 /************************************************************************/
 /*                             OGRMemLayer                              */
@@ -72,12 +74,29 @@ class CPL_DLL OGRMemLayer CPL_NON_FINAL : public OGRLayer
 
     GDALDataset *m_poDS{};
 
+    // Spatial index of the envelopes of the geometries of the
+    // m_iSpatialIndexGeomField geometry field. Built on the first spatially
+    // filtered read, and then kept up to date when features are modified.
+    CPLQuadTree *m_hSpatialIndex = nullptr;
+    int m_iSpatialIndexGeomField = -1;
+
+    // FIDs of the features returned by the spatial index for the current
+    // spatial filter, in increasing order.
+    std::vector<GIntBig> m_anSpatialIndexFIDs{};
+    size_t m_iNextSpatialIndexFID = 0;
+    bool m_bSpatialIndexQueryDone = false;
+
     // Only use it in the lifetime of a function where the list of features
     // doesn't change.
     IOGRMemLayerFeatureIterator *GetIterator();
 
     OGRFeature *GetFeatureRef(GIntBig nFeatureId);
 
+    bool CanUseSpatialIndex();
+    void BuildSpatialIndex();
+    void InsertIntoSpatialIndex(OGRFeature *poFeature);
+    void RemoveFromSpatialIndex(OGRFeature *poFeature);
+
   public:
     // Clone poSRS if not nullptr
     OGRMemLayer(const char *pszName, const OGRSpatialReference *poSRS,
@@ -110,6 +110,9 @@ OGRMemLayer::~OGRMemLayer()
         CPLFree(m_papoFeatures);
     }
 
+    if (m_hSpatialIndex)
+        CPLQuadTreeDestroy(m_hSpatialIndex);
+
     if (m_poFeatureDefn)
         m_poFeatureDefn->Release();
 }
@@ -123,6 +126,149 @@ void OGRMemLayer::ResetReading()
 {
     m_iNextReadFID = 0;
     m_oMapFeaturesIter = m_oMapFeatures.begin();
+    m_anSpatialIndexFIDs.clear();
+    m_iNextSpatialIndexFID = 0;
+    m_bSpatialIndexQueryDone = false;
+}
+
+/************************************************************************/
+/*                          GetGeometryBounds()                         */
+/************************************************************************/
+
+static bool GetGeometryBounds(const OGRFeature *poFeature, int iGeomField,
+                              CPLRectObj &sRect)
+{
+    const OGRGeometry *poGeom = poFeature->GetGeomFieldRef(iGeomField);
+    if (poGeom == nullptr || poGeom->IsEmpty())
+        return false;
+    OGREnvelope sEnvelope;
+    poGeom->getEnvelope(&sEnvelope);
+    sRect.minx = sEnvelope.MinX;
+    sRect.miny = sEnvelope.MinY;
+    sRect.maxx = sEnvelope.MaxX;
+    sRect.maxy = sEnvelope.MaxY;
+    return true;
+}
+
+/************************************************************************/
+/*                         CanUseSpatialIndex()                         */
+/************************************************************************/
+
+// Returns whether the features matching the current spatial filter must be
+// fetched through the spatial index, building it if needed.
+bool OGRMemLayer::CanUseSpatialIndex()
+{
+    if (m_bSpatialIndexQueryDone)
+        return true;
+
+    // Not worth the effort for small layers, and do not switch to the index
+    // once a sequential read has started.
+    constexpr GIntBig MIN_FEATURE_COUNT_FOR_SPATIAL_INDEX = 100;
+    if (m_nFeatureCount < MIN_FEATURE_COUNT_FOR_SPATIAL_INDEX ||
+        m_iNextReadFID != 0 || m_oMapFeaturesIter != m_oMapFeatures.begin())
+    {
+        return false;
+    }
+
+    if (m_hSpatialIndex && m_iSpatialIndexGeomField != m_iGeomFieldFilter)
+    {
+        CPLQuadTreeDestroy(m_hSpatialIndex);
+        m_hSpatialIndex = nullptr;
+    }
+    if (!m_hSpatialIndex)
+    {
+        m_iSpatialIndexGeomField = m_iGeomFieldFilter;
+        BuildSpatialIndex();
+    }
+
+    CPLRectObj sRect;
+    sRect.minx = m_sFilterEnvelope.MinX;
+    sRect.miny = m_sFilterEnvelope.MinY;
+    sRect.maxx = m_sFilterEnvelope.MaxX;
+    sRect.maxy = m_sFilterEnvelope.MaxY;
+    int nCount = 0;
+    void **pahFeatures = CPLQuadTreeSearch(m_hSpatialIndex, &sRect, &nCount);
+    m_anSpatialIndexFIDs.resize(nCount);
+    for (int i = 0; i < nCount; ++i)
+    {
+        m_anSpatialIndexFIDs[i] =
+            static_cast<const OGRFeature *>(pahFeatures[i])->GetFID();
+    }
+    CPLFree(pahFeatures);
+    // Return features in the same order as a sequential scan would.
+    std::sort(m_anSpatialIndexFIDs.begin(), m_anSpatialIndexFIDs.end());
+    m_iNextSpatialIndexFID = 0;
+    m_bSpatialIndexQueryDone = true;
+    return true;
+}
+
+/************************************************************************/
+/*                          BuildSpatialIndex()                         */
+/************************************************************************/
+
+void OGRMemLayer::BuildSpatialIndex()
+{
+    std::vector<std::pair<OGRFeature *, CPLRectObj>> aoItems;
+    aoItems.reserve(static_cast<size_t>(m_nFeatureCount));
+    CPLRectObj sGlobalBounds;
+    sGlobalBounds.minx = sGlobalBounds.miny = 0;
+    sGlobalBounds.maxx = sGlobalBounds.maxy = 0;
+    auto poIter = std::unique_ptr<IOGRMemLayerFeatureIterator>(GetIterator());
+    while (OGRFeature *poFeature = poIter->Next())
+    {
+        CPLRectObj sRect;
+        if (!GetGeometryBounds(poFeature, m_iSpatialIndexGeomField, sRect))
+            continue;
+        if (aoItems.empty())
+        {
+            sGlobalBounds = sRect;
+        }
+        else
+        {
+            sGlobalBounds.minx = std::min(sGlobalBounds.minx, sRect.minx);
+            sGlobalBounds.miny = std::min(sGlobalBounds.miny, sRect.miny);
+            sGlobalBounds.maxx = std::max(sGlobalBounds.maxx, sRect.maxx);
+            sGlobalBounds.maxy = std::max(sGlobalBounds.maxy, sRect.maxy);
+        }
+        aoItems.emplace_back(poFeature, sRect);
+    }
+
+    // Geometries inserted later outside of the global bounds end up in the
+    // root node, which is correct, but less efficient.
+    m_hSpatialIndex = CPLQuadTreeCreate(&sGlobalBounds, nullptr);
+    for (auto &oItem : aoItems)
+    {
+        CPLQuadTreeInsertWithBounds(m_hSpatialIndex, oItem.first,
+                                    &oItem.second);
+    }
+}
+
+/************************************************************************/
+/*                       InsertIntoSpatialIndex()                       */
+/************************************************************************/
+
+void OGRMemLayer::InsertIntoSpatialIndex(OGRFeature *poFeature)
+{
+    CPLRectObj sRect;
+    if (m_hSpatialIndex &&
+        GetGeometryBounds(poFeature, m_iSpatialIndexGeomField, sRect))
+    {
+        CPLQuadTreeInsertWithBounds(m_hSpatialIndex, poFeature, &sRect);
+    }
+}
+
+/************************************************************************/
+/*                       RemoveFromSpatialIndex()                       */
+/************************************************************************/
+
+void OGRMemLayer::RemoveFromSpatialIndex(OGRFeature *poFeature)
+{
+    CPLRectObj sRect;
+    if (m_hSpatialIndex &&
+        GetGeometryBounds(poFeature, m_iSpatialIndexGeomField, sRect))
+    {
+        CPLQuadTreeRemove(m_hSpatialIndex, poFeature, &sRect);
+    }
 }
 
 /************************************************************************/
@@ -132,6 +278,26 @@ void OGRMemLayer::ResetReading()
 OGRFeature *OGRMemLayer::GetNextFeature()
 
 {
+    if (m_poFilterGeom != nullptr && CanUseSpatialIndex())
+    {
+        while (m_iNextSpatialIndexFID < m_anSpatialIndexFIDs.size())
+        {
+            // The feature may have been deleted since the query.
+            OGRFeature *poFeature = GetFeatureRef(
+                m_anSpatialIndexFIDs[m_iNextSpatialIndexFID++]);
+            if (poFeature &&
+                FilterGeometry(
+                    poFeature->GetGeomFieldRef(m_iGeomFieldFilter)) &&
+                (m_poAttrQuery == nullptr ||
+                 m_poAttrQuery->Evaluate(poFeature)))
+            {
+                m_nFeaturesRead++;
+                return poFeature->Clone();
+            }
+        }
+        return nullptr;
+    }
+
     while (true)
     {
         OGRFeature *poFeature = nullptr;
@@ -366,6 +532,7 @@ OGRErr OGRMemLayer::ISetFeature(OGRFeature *poFeature)
 
         if (m_papoFeatures[nFID] != nullptr)
         {
+            RemoveFromSpatialIndex(m_papoFeatures[nFID]);
             delete m_papoFeatures[nFID];
             m_papoFeatures[nFID] = nullptr;
         }
@@ -374,6 +541,7 @@ OGRErr OGRMemLayer::ISetFeature(OGRFeature *poFeature)
             ++m_nFeatureCount;
         }
 
+        InsertIntoSpatialIndex(poFeatureCloned.get());
         m_papoFeatures[nFID] = poFeatureCloned.release();
     }
     else
@@ -381,13 +549,17 @@ OGRErr OGRMemLayer::ISetFeature(OGRFeature *poFeature)
         FeatureIterator oIter = m_oMapFeatures.find(nFID);
         if (oIter != m_oMapFeatures.end())
         {
+            RemoveFromSpatialIndex(oIter->second.get());
+            InsertIntoSpatialIndex(poFeatureCloned.get());
             oIter->second = std::move(poFeatureCloned);
         }
         else
         {
             try
             {
+                OGRFeature *poFeatureRaw = poFeatureCloned.get();
                 m_oMapFeatures[nFID] = std::move(poFeatureCloned);
+                InsertIntoSpatialIndex(poFeatureRaw);
                 m_oMapFeaturesIter = m_oMapFeatures.end();
                 m_nFeatureCount++;
             }
@@ -487,12 +659,16 @@ OGRErr OGRMemLayer::IUpdateFeature(OGRFeature *poFeature,
             panUpdatedFieldsIdx[i],
             poFeature->GetRawFieldRef(panUpdatedFieldsIdx[i]));
     }
+    if (nUpdatedGeomFieldsCount > 0)
+        RemoveFromSpatialIndex(poFeatureRef);
     for (int i = 0; i < nUpdatedGeomFieldsCount; ++i)
     {
         poFeatureRef->SetGeomFieldDirectly(
             panUpdatedGeomFieldsIdx[i],
             poFeature->StealGeometry(panUpdatedGeomFieldsIdx[i]));
     }
+    if (nUpdatedGeomFieldsCount > 0)
+        InsertIntoSpatialIndex(poFeatureRef);
     if (bUpdateStyleString)
     {
         poFeatureRef->SetStyleString(poFeature->GetStyleString());
@@ -521,6 +697,7 @@ OGRErr OGRMemLayer::DeleteFeature(GIntBig nFID)
         {
             return OGRERR_FAILURE;
         }
+        RemoveFromSpatialIndex(m_papoFeatures[nFID]);
         delete m_papoFeatures[nFID];
         m_papoFeatures[nFID] = nullptr;
     }
@@ -531,6 +708,7 @@ OGRErr OGRMemLayer::DeleteFeature(GIntBig nFID)
         {
             return OGRERR_FAILURE;
         }
+        RemoveFromSpatialIndex(oIter->second.get());
         m_oMapFeatures.erase(oIter);
     }
 
@@ -113,6 +113,7 @@ CPL_C_START  // Necessary for compiling in GDAL project
 #define MM_INCR_NUMBER_OF_VERTICES 1000
 
 #define MM_1MB 1048576  // 1 MB of buffer
+#define MM_64KB 65536   // 64 KB of buffer
 
 // Version asked for user
 #define MM_UNKNOWN_VERSION 0
@@ -275,6 +276,10 @@ struct MM_FLUSH_INFO
 
     // Internal Use
     MM_FILE_OFFSET CurrentOffset;
+
+    // Reading mode: offset that follows the last read data. Used to
+    // detect sequential reading
+    MM_FILE_OFFSET NextOffsetToRead;
 };
 
 // MIRAMON METADATA
@@ -491,11 +496,10 @@ struct MiraMonPointLayer
     char pszLayerName[MM_CPL_PATH_BUF_SIZE];
     FILE_TYPE *pF;
 
-    // Coordinates x,y of the points
+    // Coordinates x,y of the points. They are flushed directly to pF,
+    // just after the space reserved for the header.
     struct MM_FLUSH_INFO FlushTL;
-    char *pTL;                             // (II mode)
-    char pszTLName[MM_CPL_PATH_BUF_SIZE];  // Temporary file where to flush
-    FILE_TYPE *pFTL;  // Pointer to temporary file where to flush
+    char *pTL;  // (II mode)
 
     // Z section
     // Temporary file where the Z coordinates are stored
@@ -715,6 +719,11 @@ struct MiraMonVectLayerInfo
     // Final number of elements of the layer.
     MM_INTERNAL_FID nFinalElemCount;  // Real element count after conversion
 
+    // Expected number of elements (writing mode). If not 0, the in-memory
+    // headers are sized with it from the beginning, so they don't need
+    // to be reallocated while the features are written.
+    GUInt64 nFeatureCountHint;
+
     // Header of the layer
     size_t nHeaderDiskSize;
     struct MM_TH TopHeader;
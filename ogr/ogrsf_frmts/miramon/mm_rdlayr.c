@@ -564,6 +564,59 @@ MMGetMultiPolygonCoordinates(struct MiraMonVectLayerInfo *hMiraMonLayer,
     return 0;
 }
 
+// Reads nBytes at nOffset of the file of pFlush.
+// When the read follows the previous one, a whole block is read in
+// *ppBuffer, so that the following consecutive reads are served from
+// memory. In reading mode, FlushTL/pTL and FlushZL/pZL are used that way
+// for the coordinates of the points.
+static int MMReadThroughFlushBuffer(struct MM_FLUSH_INFO *pFlush,
+                                    char **ppBuffer, FILE_TYPE *pF,
+                                    MM_FILE_OFFSET nOffset, void *pDest,
+                                    size_t nBytes)
+{
+    if (!*ppBuffer || pFlush->pF != pF ||
+        nOffset < pFlush->OffsetWhereToFlush ||
+        nOffset + nBytes > pFlush->OffsetWhereToFlush + pFlush->nNumBytes)
+    {
+        if (nOffset != pFlush->NextOffsetToRead)
+        {
+            // Random access: do not read ahead
+            pFlush->NextOffsetToRead = nOffset + nBytes;
+            fseek_function(pF, nOffset, SEEK_SET);
+            if (nBytes != fread_function(pDest, 1, nBytes, pF))
+                return 1;
+            return 0;
+        }
+
+        if (!*ppBuffer || pFlush->pF != pF)
+        {
+            if (*ppBuffer)
+                free_function(*ppBuffer);
+            if (MMInitFlush(pFlush, pF, MM_64KB, ppBuffer, 0, 0))
+                return 1;
+            pFlush->pBlockWhereToSaveOrRead = *ppBuffer;
+        }
+        if (nBytes > pFlush->nBlockSize)
+            return 1;
+
+        fseek_function(pF, nOffset, SEEK_SET);
+        pFlush->OffsetWhereToFlush = nOffset;
+        pFlush->nNumBytes =
+            fread_function(*ppBuffer, 1, (size_t)pFlush->nBlockSize, pF);
+        if (pFlush->nNumBytes < nBytes)
+        {
+            pFlush->nNumBytes = 0;
+            return 1;
+        }
+    }
+
+    pFlush->NextOffsetToRead = nOffset + nBytes;
+    pFlush->CurrentOffset = nOffset - pFlush->OffsetWhereToFlush;
+    pFlush->SizeOfBlockToBeSaved = nBytes;
+    pFlush->pBlockToBeSaved = pDest;
+    return MMReadBlockFromBuffer(pFlush);
+}
+
 // Reads the geographical part of a MiraMon layer feature
 int MMGetGeoFeatureFromVector(struct MiraMonVectLayerInfo *hMiraMonLayer,
                               MM_INTERNAL_FID i_elem)
@@ -585,12 +638,6 @@ int MMGetGeoFeatureFromVector(struct MiraMonVectLayerInfo *hMiraMonLayer,
     {
         pF = hMiraMonLayer->MMPoint.pF;
 
-        // Getting to the i-th element offset
-        fseek_function(pF,
-                       hMiraMonLayer->nHeaderDiskSize +
-                           sizeof(MM_COORD_TYPE) * 2 * i_elem,
-                       SEEK_SET);
-
         // Reading the point
         if (MMResizeMM_POINT2DPointer(&hMiraMonLayer->ReadFeature.pCoord,
                                       &hMiraMonLayer->ReadFeature.nMaxpCoord,
@@ -598,8 +645,14 @@ int MMGetGeoFeatureFromVector(struct MiraMonVectLayerInfo *hMiraMonLayer,
                                       1))
             return 1;
 
-        if (1 != fread_function(hMiraMonLayer->ReadFeature.pCoord,
-                                sizeof(MM_COORD_TYPE) * 2, 1, pF))
+        // Getting the i-th element, through a read-ahead buffer when the
+        // elements are read sequentially
+        if (MMReadThroughFlushBuffer(&hMiraMonLayer->MMPoint.FlushTL,
+                                     &hMiraMonLayer->MMPoint.pTL, pF,
+                                     hMiraMonLayer->nHeaderDiskSize +
+                                         sizeof(MM_COORD_TYPE) * 2 * i_elem,
+                                     hMiraMonLayer->ReadFeature.pCoord,
+                                     sizeof(MM_COORD_TYPE) * 2))
         {
             return 1;
         }
@@ -637,11 +690,10 @@ int MMGetGeoFeatureFromVector(struct MiraMonVectLayerInfo *hMiraMonLayer,
                 else
                 {
                     // Reading the first z coordinate
-                    fseek_function(pF, pZDescription->nOffsetZ, SEEK_SET);
-                    if ((size_t)1 !=
-                        fread_function(
-                            &cz, sizeof(*hMiraMonLayer->ReadFeature.pZCoord), 1,
-                            pF))
+                    if (MMReadThroughFlushBuffer(
+                            &hMiraMonLayer->MMPoint.pZSection.FlushZL,
+                            &hMiraMonLayer->MMPoint.pZSection.pZL, pF,
+                            pZDescription->nOffsetZ, &cz, sizeof(cz)))
                     {
                         return 1;
                     }
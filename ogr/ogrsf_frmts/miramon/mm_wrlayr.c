@@ -749,6 +749,8 @@ static int MMInitZSectionLayer(struct MiraMonVectLayerInfo *hMiraMonLayer,
     {
         pZSection->nMaxZDescription =
             MM_FIRST_NUMBER_OF_VERTICES * sizeof(double);
+        if (hMiraMonLayer->nFeatureCountHint > pZSection->nMaxZDescription)
+            pZSection->nMaxZDescription = hMiraMonLayer->nFeatureCountHint;
         if (MMInitZSectionDescription(pZSection))
             return 1;
     }
@@ -884,25 +886,12 @@ static int MMInitPointLayer(struct MiraMonVectLayerInfo *hMiraMonLayer)
 
     if (hMiraMonLayer->ReadOrWrite == MM_WRITING_MODE)
     {
-        // TL
-        snprintf(hMiraMonLayer->MMPoint.pszTLName,
-                 sizeof(hMiraMonLayer->MMPoint.pszTLName), "%sT.~xy",
-                 hMiraMonLayer->pszSrcLayerName);
-
-        if (nullptr == (hMiraMonLayer->MMPoint.pFTL =
-                            fopen_function(hMiraMonLayer->MMPoint.pszTLName,
-                                           hMiraMonLayer->pszFlags)))
-        {
-            MMCPLError(CE_Failure, CPLE_OpenFailed,
-                       "Error MMPoint.pFTL: Cannot open file %s.",
-                       hMiraMonLayer->MMPoint.pszTLName);
-            return 1;
-        }
-        fseek_function(hMiraMonLayer->MMPoint.pFTL, 0, SEEK_SET);
-
+        // TL: the coordinates are written in place, just after the
+        // header, that is written at the end (its size is already known).
         if (MMInitFlush(&hMiraMonLayer->MMPoint.FlushTL,
-                        hMiraMonLayer->MMPoint.pFTL, MM_1MB,
-                        &hMiraMonLayer->MMPoint.pTL, 0, MM_SIZE_OF_TL))
+                        hMiraMonLayer->MMPoint.pF, MM_1MB,
+                        &hMiraMonLayer->MMPoint.pTL,
+                        hMiraMonLayer->nHeaderDiskSize, MM_SIZE_OF_TL))
             return 1;
 
         // 3D part
@@ -1047,6 +1036,11 @@ static int MMInitNodeLayer(struct MiraMonVectLayerInfo *hMiraMonLayer)
     {
         // Node Header
         pMMArcLayer->MMNode.nMaxNodeHeader = MM_FIRST_NUMBER_OF_NODES;
+        // Every arc has at most two nodes
+        if (hMiraMonLayer->nFeatureCountHint >
+            pMMArcLayer->MMNode.nMaxNodeHeader / 2)
+            pMMArcLayer->MMNode.nMaxNodeHeader =
+                2 * hMiraMonLayer->nFeatureCountHint;
         if (MMCheckSize_t(pMMArcLayer->MMNode.nMaxNodeHeader,
                           sizeof(*pMMArcLayer->MMNode.pNodeHeader)))
             return 1;
@@ -1193,7 +1187,11 @@ static int MMInitArcLayer(struct MiraMonVectLayerInfo *hMiraMonLayer)
         pMMArcLayer->nSizeArcHeader = MM_SIZE_OF_AH_64BITS;
 
     if (hMiraMonLayer->ReadOrWrite == MM_WRITING_MODE)
+    {
         pMMArcLayer->nMaxArcHeader = MM_FIRST_NUMBER_OF_ARCS;
+        if (hMiraMonLayer->nFeatureCountHint > pMMArcLayer->nMaxArcHeader)
+            pMMArcLayer->nMaxArcHeader = hMiraMonLayer->nFeatureCountHint;
+    }
     else
         pMMArcLayer->nMaxArcHeader = pArcTopHeader->nElemCount;
 
@@ -1493,7 +1491,14 @@ static int MMInitPolygonLayer(struct MiraMonVectLayerInfo *hMiraMonLayer)
         pMMPolygonLayer->nPHElementSize = MM_SIZE_OF_PH_64BITS;
 
     if (hMiraMonLayer->ReadOrWrite == MM_WRITING_MODE)
+    {
+        // The first polygon is the universal one
         pMMPolygonLayer->nMaxPolHeader = MM_FIRST_NUMBER_OF_POLYGONS + 1;
+        if (hMiraMonLayer->nFeatureCountHint >=
+            pMMPolygonLayer->nMaxPolHeader)
+            pMMPolygonLayer->nMaxPolHeader =
+                hMiraMonLayer->nFeatureCountHint + 1;
+    }
     else
         pMMPolygonLayer->nMaxPolHeader = hMiraMonLayer->TopHeader.nElemCount;
 
@@ -1973,9 +1978,7 @@ static int MMClosePointLayer(struct MiraMonVectLayerInfo *hMiraMonLayer)
                        hMiraMonLayer->MMPoint.pszLayerName);
             goto end_label;
         }
-        hMiraMonLayer->OffsetCheck = hMiraMonLayer->nHeaderDiskSize;
-
-        // TL Section
+        // TL Section: flushing what remains in the buffer
         hMiraMonLayer->MMPoint.FlushTL.SizeOfBlockToBeSaved = 0;
         if (MMAppendBlockToBuffer(&hMiraMonLayer->MMPoint.FlushTL))
         {
@@ -1984,20 +1987,9 @@ static int MMClosePointLayer(struct MiraMonVectLayerInfo *hMiraMonLayer)
                        hMiraMonLayer->MMPoint.pszLayerName);
             goto end_label;
         }
-        if (MMMoveFromFileToFile(hMiraMonLayer->MMPoint.pFTL,
-                                 hMiraMonLayer->MMPoint.pF,
-                                 &hMiraMonLayer->OffsetCheck))
-        {
-            MMCPLError(CE_Failure, CPLE_NoWriteAccess,
-                       "Error writing to file %s",
-                       hMiraMonLayer->MMPoint.pszLayerName);
-            goto end_label;
-        }
-
-        fclose_and_nullify(&hMiraMonLayer->MMPoint.pFTL);
-
-        if (*hMiraMonLayer->MMPoint.pszTLName != '\0')
-            remove_function(hMiraMonLayer->MMPoint.pszTLName);
+        hMiraMonLayer->OffsetCheck =
+            hMiraMonLayer->nHeaderDiskSize +
+            hMiraMonLayer->MMPoint.FlushTL.TotalSavedBytes;
 
         if (MMClose3DSectionLayer(
                 hMiraMonLayer, hMiraMonLayer->TopHeader.nElemCount,
@@ -34,6 +34,11 @@
 #include "cpl_string.h"
 #include "mm_wrlayr.h"
 
+#include <memory>
+#include <vector>
+
+class OGRMiraMonPolygonPipeline;
+
 /************************************************************************/
 /*                             OGRMiraMonLayer                          */
 /************************************************************************/
@@ -71,19 +76,41 @@ class OGRMiraMonLayer final
     double *padfValues;
     GInt64 *pnInt64Values;
 
+    bool m_bLastGetNextArrowArrayUsedOptimizedCodePath = false;
+
+    // FIDs matching the attribute filter, from the attribute index
+    std::vector<GIntBig> m_anAttrIndexFIDs{};
+    size_t m_iNextAttrIndexFID = 0;
+    bool m_bAttrIndexQueryDone = false;
+    bool m_bUseAttrIndexFIDs = false;
+
+    bool GetNextAttrIndexFID(GIntBig &nFID);
+
     OGRFeature *GetNextRawFeature();
+    bool IsElementBBoxOutsideSpatialFilter(GUIntBig nFID) const;
     OGRFeature *GetFeature(GIntBig nFeatureId) override;
     void GoToFieldOfMultipleRecord(MM_INTERNAL_FID iFID,
                                    MM_EXT_DBF_N_RECORDS nIRecord,
                                    MM_EXT_DBF_N_FIELDS nIField);
+    const char *ReadFieldOfMultipleRecord(MM_INTERNAL_FID iFID,
+                                          MM_EXT_DBF_N_RECORDS nIRecord,
+                                          MM_EXT_DBF_N_FIELDS nIField);
+    void RecodeStringToOperate(MM_EXT_DBF_N_FIELDS nIField);
+    bool GetRecordOfSimpleField(MM_INTERNAL_FID iFID,
+                                MM_EXT_DBF_N_MULTIPLE_RECORDS &nIRecord) const;
+
+    // Polygons whose geometry is being loaded by worker threads
+    // (NUM_THREADS layer creation option)
+    std::unique_ptr<OGRMiraMonPolygonPipeline> m_poPolygonPipeline{};
 
-    OGRErr MMDumpVertices(OGRGeometryH hGeom, MM_BOOLEAN bExternalRing,
-                          MM_BOOLEAN bUseVFG);
     OGRErr MMProcessGeometry(OGRGeometryH poGeom, OGRFeature *poFeature,
-                             MM_BOOLEAN bcalculateRecord);
+                             MM_BOOLEAN bcalculateRecord,
+                             struct MiraMonFeature *psPrepared = nullptr);
     OGRErr MMProcessMultiGeometry(OGRGeometryH hGeom, OGRFeature *poFeature);
-    OGRErr MMLoadGeometry(OGRGeometryH hGeom);
+    OGRErr MMLoadGeometry(OGRGeometryH hGeom,
+                          struct MiraMonFeature *psPrepared);
     OGRErr MMWriteGeometry();
+    OGRErr WritePreparedPolygons(bool bWaitAll);
     GIntBig GetFeatureCount(int bForce) override;
 
   public:
@@ -96,8 +123,14 @@ class OGRMiraMonLayer final
     virtual ~OGRMiraMonLayer();
 
     void ResetReading() override;
+    OGRErr SetAttributeFilter(const char *pszQuery) override;
     DEFINE_GET_NEXT_FEATURE_THROUGH_RAW(OGRMiraMonLayer)
 
+    int GetNextArrowArray(struct ArrowArrayStream *,
+                          struct ArrowArray *out_array) override;
+    const char *GetMetadataItem(const char *pszName,
+                                const char *pszDomain) override;
+
     OGRErr TranslateFieldsToMM();
     OGRErr TranslateFieldsValuesToMM(OGRFeature *poFeature);
     OGRErr GetExtent(OGREnvelope *psExtent, int bForce) override;
@@ -193,6 +193,12 @@ void RegisterOGRMiraMon()
         "    <Value>CAT</Value>"
         "    <Value>SPA</Value>"
         "  </Option>"
+        "  <Option name='FEATURE_COUNT_HINT' type='integer' "
+        "description='Expected number of features of the layer. Used to "
+        "size the in-memory headers from the beginning.'/>"
+        "  <Option name='NUM_THREADS' type='string' "
+        "description='Number of worker threads used to prepare the geometry "
+        "of polygons. Can be set to ALL_CPUS' default='1'/>"
         "</LayerCreationOptionList>");
 
     poDriver->SetMetadataItem(
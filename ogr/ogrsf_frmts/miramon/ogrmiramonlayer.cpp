@@ -31,6 +31,199 @@
 #include <algorithm>            // For std::clamp()
 #include <string>               // For std::string
 #include <algorithm>            // For std::max
+#include <condition_variable>   // For std::condition_variable
+#include <deque>                // For std::deque
+#include <mutex>                // For std::mutex
+#include <vector>               // For std::vector
+
+#include "cpl_error_internal.h"      // For CPLErrorHandlerAccumulatorStruct
+#include "cpl_worker_thread_pool.h"  // For CPLJobQueue
+#include "gdal_thread_pool.h"        // For GDALGetGlobalThreadPool()
+#include "ograrrowarrayhelper.h"     // For OGRArrowArrayHelper
+
+static OGRErr MMLoadGeometryInto(OGRGeometryH hGeom,
+                                 struct MiraMonFeature &sFeature,
+                                 bool &bIsReal3d);
+
+/****************************************************************************/
+/*                       OGRMiraMonPolygonPipeline                          */
+/*                                                                          */
+/*      Loads the rings of polygon features (orientation, vertices and      */
+/*      Z values) in worker threads. The thread calling CreateFeature()     */
+/*      still writes the records, arcs, nodes and polygons, in the order    */
+/*      the features were received.                                        */
+/****************************************************************************/
+
+class OGRMiraMonPolygonPipeline
+{
+  public:
+    struct Item
+    {
+        std::unique_ptr<OGRFeature> poFeature{};
+        struct MiraMonFeature sFeature{};
+        bool bIsReal3d = false;
+        OGRErr eErr = OGRERR_NONE;
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+    };
+
+    struct Chunk
+    {
+        OGRMiraMonPolygonPipeline *poPipeline = nullptr;
+        std::vector<Item> aoItems{};
+        bool bDone = false;
+
+        Chunk() = default;
+        Chunk(const Chunk &) = delete;
+        Chunk &operator=(const Chunk &) = delete;
+
+        ~Chunk()
+        {
+            for (auto &sItem : aoItems)
+                MMDestroyFeature(&sItem.sFeature);
+        }
+    };
+
+    static std::unique_ptr<OGRMiraMonPolygonPipeline> Create(int nThreads);
+
+    ~OGRMiraMonPolygonPipeline()
+    {
+        m_poJobQueue->WaitCompletion();
+    }
+
+    void Add(std::unique_ptr<OGRFeature> poFeature);
+    std::unique_ptr<Chunk> GetNextChunk(bool bWaitAll);
+
+    // Number of features added and not yet returned by GetNextChunk()
+    size_t GetPendingCount() const
+    {
+        return m_nPending;
+    }
+
+  private:
+    static constexpr size_t CHUNK_SIZE = 256;
+
+    std::unique_ptr<CPLJobQueue> m_poJobQueue{};
+    size_t m_nMaxChunksInFlight = 0;
+    std::unique_ptr<Chunk> m_poCurrentChunk{};
+    std::deque<std::unique_ptr<Chunk>> m_apoChunks{};
+    size_t m_nPending = 0;
+
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+
+    OGRMiraMonPolygonPipeline() = default;
+
+    void SubmitCurrentChunk();
+    static void ProcessChunk(void *pData);
+};
+
+/****************************************************************************/
+/*                  OGRMiraMonPolygonPipeline::Create()                     */
+/****************************************************************************/
+
+std::unique_ptr<OGRMiraMonPolygonPipeline>
+OGRMiraMonPolygonPipeline::Create(int nThreads)
+{
+    CPLWorkerThreadPool *poPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poPool)
+        return nullptr;
+    auto poJobQueue = poPool->CreateJobQueue();
+    if (!poJobQueue)
+        return nullptr;
+
+    auto poPipeline = std::unique_ptr<OGRMiraMonPolygonPipeline>(
+        new OGRMiraMonPolygonPipeline());
+    poPipeline->m_poJobQueue = std::move(poJobQueue);
+    // Keep enough work queued to avoid workers starving while the
+    // calling thread writes features.
+    poPipeline->m_nMaxChunksInFlight = 2 * static_cast<size_t>(nThreads);
+    return poPipeline;
+}
+
+/****************************************************************************/
+/*                   OGRMiraMonPolygonPipeline::Add()                       */
+/****************************************************************************/
+
+void OGRMiraMonPolygonPipeline::Add(std::unique_ptr<OGRFeature> poFeature)
+{
+    if (!m_poCurrentChunk)
+    {
+        m_poCurrentChunk = std::make_unique<Chunk>();
+        m_poCurrentChunk->poPipeline = this;
+        m_poCurrentChunk->aoItems.reserve(CHUNK_SIZE);
+    }
+    m_poCurrentChunk->aoItems.emplace_back();
+    m_poCurrentChunk->aoItems.back().poFeature = std::move(poFeature);
+    ++m_nPending;
+    if (m_poCurrentChunk->aoItems.size() == CHUNK_SIZE)
+        SubmitCurrentChunk();
+}
+
+/****************************************************************************/
+/*            OGRMiraMonPolygonPipeline::SubmitCurrentChunk()               */
+/****************************************************************************/
+
+void OGRMiraMonPolygonPipeline::SubmitCurrentChunk()
+{
+    Chunk *poChunk = m_poCurrentChunk.get();
+    m_apoChunks.push_back(std::move(m_poCurrentChunk));
+    if (!m_poJobQueue->SubmitJob(ProcessChunk, poChunk))
+        ProcessChunk(poChunk);
+}
+
+/****************************************************************************/
+/*               OGRMiraMonPolygonPipeline::ProcessChunk()                  */
+/****************************************************************************/
+
+void OGRMiraMonPolygonPipeline::ProcessChunk(void *pData)
+{
+    Chunk *poChunk = static_cast<Chunk *>(pData);
+    for (auto &sItem : poChunk->aoItems)
+    {
+        CPLInstallErrorHandlerAccumulator(sItem.aoErrors);
+        sItem.eErr = MMLoadGeometryInto(
+            OGRGeometry::ToHandle(sItem.poFeature->GetGeometryRef()),
+            sItem.sFeature, sItem.bIsReal3d);
+        CPLUninstallErrorHandlerAccumulator();
+    }
+
+    OGRMiraMonPolygonPipeline *poPipeline = poChunk->poPipeline;
+    std::lock_guard<std::mutex> oLock(poPipeline->m_oMutex);
+    poChunk->bDone = true;
+    poPipeline->m_oCV.notify_one();
+}
+
+/****************************************************************************/
+/*               OGRMiraMonPolygonPipeline::GetNextChunk()                  */
+/*                                                                          */
+/*      Returns the oldest chunk once its geometries are loaded. Only       */
+/*      waits for it if too many chunks are in flight, or if bWaitAll is    */
+/*      set, in which case the chunk being filled is also submitted.        */
+/*      Returns nullptr when there is nothing to write yet.                 */
+/****************************************************************************/
+
+std::unique_ptr<OGRMiraMonPolygonPipeline::Chunk>
+OGRMiraMonPolygonPipeline::GetNextChunk(bool bWaitAll)
+{
+    if (bWaitAll && m_poCurrentChunk)
+        SubmitCurrentChunk();
+    if (m_apoChunks.empty())
+        return nullptr;
+
+    Chunk *poChunk = m_apoChunks.front().get();
+    {
+        std::unique_lock<std::mutex> oLock(m_oMutex);
+        if (!poChunk->bDone && !bWaitAll &&
+            m_apoChunks.size() <= m_nMaxChunksInFlight)
+            return nullptr;
+        m_oCV.wait(oLock, [poChunk] { return poChunk->bDone; });
+    }
+
+    auto poRet = std::move(m_apoChunks.front());
+    m_apoChunks.pop_front();
+    m_nPending -= poRet->aoItems.size();
+    return poRet;
+}
 
 /****************************************************************************/
 /*                            OGRMiraMonLayer()                             */
@@ -113,6 +306,42 @@ OGRMiraMonLayer::OGRMiraMonLayer(GDALDataset *poDS, const char *pszFilename,
         else
             nMMLanguage = MM_DEF_LANGUAGE;  // Default
 
+        /* ---------------------------------------------------------------- */
+        /*      Expected number of features, used to size the in-memory     */
+        /*      headers of the layer from the beginning                     */
+        /* ---------------------------------------------------------------- */
+        GUInt64 nFeatureCountHint = 0;
+        const char *pszFeatureCountHint =
+            CSLFetchNameValue(papszOpenOptions, "FEATURE_COUNT_HINT");
+        if (pszFeatureCountHint)
+        {
+            const GIntBig nHint = CPLAtoGIntBig(pszFeatureCountHint);
+            if (nHint > 0)
+                nFeatureCountHint = static_cast<GUInt64>(nHint);
+            else
+                CPLError(CE_Warning, CPLE_IllegalArg,
+                         "Invalid value for FEATURE_COUNT_HINT: %s. Ignored",
+                         pszFeatureCountHint);
+        }
+
+        /* ---------------------------------------------------------------- */
+        /*      Number of threads used to prepare polygon geometries        */
+        /* ---------------------------------------------------------------- */
+        const char *pszNumThreads =
+            CSLFetchNameValue(papszOpenOptions, "NUM_THREADS");
+        if (!pszNumThreads)
+            pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+        if (pszNumThreads)
+        {
+            int nThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                               ? CPLGetNumCPUs()
+                               : atoi(pszNumThreads);
+            nThreads = GDALCapThreadCount(std::min(nThreads, 128));
+            if (nThreads > 1)
+                m_poPolygonPipeline =
+                    OGRMiraMonPolygonPipeline::Create(nThreads);
+        }
+
         /* ---------------------------------------------------------------- */
         /*      Preparing to write the layer                                */
         /* ---------------------------------------------------------------- */
@@ -133,6 +362,7 @@ OGRMiraMonLayer::OGRMiraMonLayer(GDALDataset *poDS, const char *pszFilename,
             return;
         }
         hMiraMonLayerPNT.bIsBeenInit = 0;
+        hMiraMonLayerPNT.nFeatureCountHint = nFeatureCountHint;
 
         CPLDebugOnly("MiraMon", "Initializing MiraMon arcs layer...");
         if (MMInitLayer(&hMiraMonLayerARC, pszFilename, nMMVersion, nMMRecode,
@@ -142,6 +372,7 @@ OGRMiraMonLayer::OGRMiraMonLayer(GDALDataset *poDS, const char *pszFilename,
             return;
         }
         hMiraMonLayerARC.bIsBeenInit = 0;
+        hMiraMonLayerARC.nFeatureCountHint = nFeatureCountHint;
 
         CPLDebugOnly("MiraMon", "Initializing MiraMon polygons layer...");
         if (MMInitLayer(&hMiraMonLayerPOL, pszFilename, nMMVersion, nMMRecode,
@@ -151,6 +382,7 @@ OGRMiraMonLayer::OGRMiraMonLayer(GDALDataset *poDS, const char *pszFilename,
             return;
         }
         hMiraMonLayerPOL.bIsBeenInit = 0;
+        hMiraMonLayerPOL.nFeatureCountHint = nFeatureCountHint;
 
         // Just in case that there is no geometry but some other
         // information to get. A DBF will be generated
@@ -504,6 +736,16 @@ OGRMiraMonLayer::OGRMiraMonLayer(GDALDataset *poDS, const char *pszFilename,
         }
     }
 
+    if (!m_bUpdate && phMiraMonLayer &&
+        m_poFeatureDefn->GetGeomType() != wkbNone)
+        InitializeSidecarSpatialIndexSupport(pszFilename);
+
+    // Attribute indexes are stored as <datafile>.idm and <datafile>.ind,
+    // so that the arcs of a polygon layer, which share its basename, do
+    // not pick the index of the polygons.
+    if (!m_bUpdate && phMiraMonLayer)
+        InitializeIndexSupport((std::string(pszFilename) + ".idm").c_str());
+
     bValidFile = true;
 }
 
@@ -514,6 +756,12 @@ OGRMiraMonLayer::OGRMiraMonLayer(GDALDataset *poDS, const char *pszFilename,
 OGRMiraMonLayer::~OGRMiraMonLayer()
 
 {
+    if (m_poPolygonPipeline)
+    {
+        WritePreparedPolygons(true);
+        m_poPolygonPipeline.reset();
+    }
+
     if (m_nFeaturesRead > 0 && m_poFeatureDefn != nullptr)
     {
         CPLDebugOnly("MiraMon", "%d features read on layer '%s'.",
@@ -703,6 +951,9 @@ OGRMiraMonLayer::~OGRMiraMonLayer()
 void OGRMiraMonLayer::ResetReading()
 
 {
+    ResetSidecarSpatialIndexReading();
+    m_iNextAttrIndexFID = 0;
+
     if (m_iNextFID == 0)
         return;
 
@@ -760,6 +1011,41 @@ OGRFeature *OGRMiraMonLayer::GetNextRawFeature()
     if (!phMiraMonLayer)
         return nullptr;
 
+    {
+        GIntBig nFID = 0;
+        while (GetNextAttrIndexFID(nFID))
+        {
+            if (IsElementBBoxOutsideSpatialFilter(nFID))
+                continue;
+            OGRFeature *poFeature = GetFeature(nFID);
+            if (poFeature)
+                return poFeature;
+        }
+        if (m_bUseAttrIndexFIDs)
+            return nullptr;
+    }
+
+    if (UseSidecarSpatialIndex())
+    {
+        GIntBig nFID = 0;
+        while (GetNextSidecarSpatialIndexFID(nFID))
+        {
+            OGRFeature *poFeature = GetFeature(nFID);
+            if (poFeature)
+                return poFeature;
+        }
+        return nullptr;
+    }
+
+    // Skip the elements whose bounding box, from the arc or polygon
+    // header section, does not intersect the spatial filter, without
+    // reading their coordinates.
+    while (m_iNextFID < (GUInt64)phMiraMonLayer->TopHeader.nElemCount &&
+           IsElementBBoxOutsideSpatialFilter(m_iNextFID))
+    {
+        m_iNextFID++;
+    }
+
     if (m_iNextFID >= (GUInt64)phMiraMonLayer->TopHeader.nElemCount)
         return nullptr;
 
@@ -772,6 +1058,90 @@ OGRFeature *OGRMiraMonLayer::GetNextRawFeature()
     return poFeature;
 }
 
+/****************************************************************************/
+/*                        SetAttributeFilter()                              */
+/****************************************************************************/
+
+OGRErr OGRMiraMonLayer::SetAttributeFilter(const char *pszQuery)
+{
+    m_anAttrIndexFIDs.clear();
+    m_iNextAttrIndexFID = 0;
+    m_bAttrIndexQueryDone = false;
+    m_bUseAttrIndexFIDs = false;
+    return OGRLayer::SetAttributeFilter(pszQuery);
+}
+
+/****************************************************************************/
+/*                        GetNextAttrIndexFID()                             */
+/*                                                                          */
+/*      Returns, in increasing order, the FIDs that the attribute index     */
+/*      gives for the attribute filter. Returns false when they have all    */
+/*      been returned, or when the filter cannot be resolved with the       */
+/*      index, in which case m_bUseAttrIndexFIDs remains false.            */
+/****************************************************************************/
+
+bool OGRMiraMonLayer::GetNextAttrIndexFID(GIntBig &nFID)
+{
+    if (!m_bAttrIndexQueryDone)
+    {
+        m_bAttrIndexQueryDone = true;
+        if (m_poAttrQuery && m_poAttrIndex &&
+            phMiraMonLayer->ReadOrWrite == MM_READING_MODE)
+        {
+            OGRErr eErr = OGRERR_NONE;
+            GIntBig *panFIDs =
+                m_poAttrQuery->EvaluateAgainstIndices(this, &eErr);
+            if (panFIDs)
+            {
+                for (int i = 0; panFIDs[i] != OGRNullFID; ++i)
+                    m_anAttrIndexFIDs.push_back(panFIDs[i]);
+                CPLFree(panFIDs);
+                std::sort(m_anAttrIndexFIDs.begin(), m_anAttrIndexFIDs.end());
+                m_bUseAttrIndexFIDs = true;
+                CPLDebug("MiraMon", "Used attribute index, got %d matches.",
+                         static_cast<int>(m_anAttrIndexFIDs.size()));
+            }
+        }
+    }
+    if (!m_bUseAttrIndexFIDs ||
+        m_iNextAttrIndexFID >= m_anAttrIndexFIDs.size())
+        return false;
+    nFID = m_anAttrIndexFIDs[m_iNextAttrIndexFID++];
+    return true;
+}
+
+/****************************************************************************/
+/*                  IsElementBBoxOutsideSpatialFilter()                     */
+/****************************************************************************/
+
+bool OGRMiraMonLayer::IsElementBBoxOutsideSpatialFilter(GUIntBig nFID) const
+{
+    if (!m_poFilterGeom || phMiraMonLayer->ReadOrWrite != MM_READING_MODE)
+        return false;
+
+    const struct MMBoundingBox *psBB = nullptr;
+    if (phMiraMonLayer->bIsPolygon)
+    {
+        // The first polygon is the universal one, not exposed as a feature
+        const GUIntBig nIElem = nFID + 1;
+        if (phMiraMonLayer->MMPolygon.pPolHeader &&
+            nIElem < (GUInt64)phMiraMonLayer->TopHeader.nElemCount)
+            psBB = &phMiraMonLayer->MMPolygon.pPolHeader[nIElem].dfBB;
+    }
+    else if (phMiraMonLayer->bIsArc)
+    {
+        if (phMiraMonLayer->MMArc.pArcHeader)
+            psBB = &phMiraMonLayer->MMArc.pArcHeader[nFID].dfBB;
+    }
+    if (!psBB)
+        return false;
+
+    return psBB->dfMaxX < m_sFilterEnvelope.MinX ||
+           psBB->dfMinX > m_sFilterEnvelope.MaxX ||
+           psBB->dfMaxY < m_sFilterEnvelope.MinY ||
+           psBB->dfMinY > m_sFilterEnvelope.MaxY;
+}
+
 /****************************************************************************/
 /*                         GetFeature()                                     */
 /****************************************************************************/
@@ -1516,11 +1886,802 @@ OGRFeature *OGRMiraMonLayer::GetFeature(GIntBig nFeatureId)
     return poFeature.release();
 }
 
+/****************************************************************************/
+/*                      ReadFieldOfMultipleRecord()                         */
+/****************************************************************************/
+
+// Reads the raw value of the nIField field of the nIRecord record of the
+// iFID element in szStringToOperate, and returns it.
+const char *
+OGRMiraMonLayer::ReadFieldOfMultipleRecord(MM_INTERNAL_FID iFID,
+                                           MM_EXT_DBF_N_RECORDS nIRecord,
+                                           MM_EXT_DBF_N_FIELDS nIField)
+{
+    const MM_BYTES_PER_FIELD_TYPE_DBF nBytesPerField =
+        phMiraMonLayer->pMMBDXP->pField[nIField].BytesPerField;
+    if (MMResizeStringToOperateIfNeeded(phMiraMonLayer, nBytesPerField + 1))
+        return nullptr;
+
+    GoToFieldOfMultipleRecord(iFID, nIRecord, nIField);
+    memset(phMiraMonLayer->szStringToOperate, 0, nBytesPerField);
+    fread_function(phMiraMonLayer->szStringToOperate, nBytesPerField, 1,
+                   phMiraMonLayer->pMMBDXP->pfDataBase);
+    phMiraMonLayer->szStringToOperate[nBytesPerField] = '\0';
+    return phMiraMonLayer->szStringToOperate;
+}
+
+/****************************************************************************/
+/*                        RecodeStringToOperate()                           */
+/****************************************************************************/
+
+// Recodes to UTF-8 the value of the nIField field in szStringToOperate.
+void OGRMiraMonLayer::RecodeStringToOperate(MM_EXT_DBF_N_FIELDS nIField)
+{
+    if (phMiraMonLayer->pMMBDXP->CharSet == MM_JOC_CARAC_OEM850_DBASE)
+        MM_oemansi(phMiraMonLayer->szStringToOperate);
+
+    if (phMiraMonLayer->pMMBDXP->CharSet != MM_JOC_CARAC_UTF8_DBF)
+    {
+        // MiraMon encoding is ISO 8859-1 (Latin1) -> Recode to UTF-8
+        char *pszString = CPLRecode(phMiraMonLayer->szStringToOperate,
+                                    CPL_ENC_ISO8859_1, CPL_ENC_UTF8);
+        CPLStrlcpy(
+            phMiraMonLayer->szStringToOperate, pszString,
+            (size_t)phMiraMonLayer->pMMBDXP->pField[nIField].BytesPerField +
+                1);
+        CPLFree(pszString);
+    }
+}
+
+/****************************************************************************/
+/*                        GetRecordOfSimpleField()                          */
+/****************************************************************************/
+
+// Returns in nIRecord the record of the iFID element from which the value
+// of a field that is not a list is taken, according to the
+// MultiRecordIndex open option. Returns false if there is no such record.
+bool OGRMiraMonLayer::GetRecordOfSimpleField(
+    MM_INTERNAL_FID iFID, MM_EXT_DBF_N_MULTIPLE_RECORDS &nIRecord) const
+{
+    if (!phMiraMonLayer->pMultRecordIndex ||
+        phMiraMonLayer->pMultRecordIndex[iFID].nMR == 0)
+        return false;
+
+    const MM_EXT_DBF_N_MULTIPLE_RECORDS nMR =
+        phMiraMonLayer->pMultRecordIndex[iFID].nMR;
+    if (phMiraMonLayer->iMultiRecord == MM_MULTIRECORD_NO_MULTIRECORD)
+        nIRecord = 0;
+    else if (phMiraMonLayer->iMultiRecord == MM_MULTIRECORD_LAST)
+        nIRecord = nMR - 1;
+    else if ((MM_EXT_DBF_N_MULTIPLE_RECORDS)phMiraMonLayer->iMultiRecord <
+             nMR)
+        nIRecord = (MM_EXT_DBF_N_MULTIPLE_RECORDS)phMiraMonLayer->iMultiRecord;
+    else
+        return false;
+    return true;
+}
+
+/****************************************************************************/
+/*                       MMGetWKBFromReadFeature()                          */
+/****************************************************************************/
+
+// Writes in pabyWKB, as little endian ISO WKB, the geometry of the last
+// element read by MMGetGeoFeatureFromVector(), with the same organization
+// of the rings in polygons as GetFeature(). If pabyWKB is null, only the
+// size is computed. Returns the size of the WKB, or 0 if the rings of the
+// polygon are not correct.
+static size_t
+MMGetWKBFromReadFeature(const struct MiraMonVectLayerInfo *hMiraMonLayer,
+                        GByte *pabyWKB)
+{
+    const struct MiraMonFeature &sFeature = hMiraMonLayer->ReadFeature;
+    const bool bIsPoint = hMiraMonLayer->eLT == MM_LayerType_Point ||
+                          hMiraMonLayer->eLT == MM_LayerType_Point3d;
+    const bool bIsArc = hMiraMonLayer->eLT == MM_LayerType_Arc ||
+                        hMiraMonLayer->eLT == MM_LayerType_Arc3d;
+
+    // Same as OGRGeometry: empty geometries are 2D
+    bool bIs3d = hMiraMonLayer->TopHeader.bIs3d && sFeature.pZCoord;
+    if (bIs3d && !bIsPoint)
+    {
+        const MM_POLYGON_RINGS_COUNT nRings = bIsArc ? 1 : sFeature.nNRings;
+        bIs3d = false;
+        for (MM_POLYGON_RINGS_COUNT nIRing = 0; nIRing < nRings; nIRing++)
+        {
+            if (sFeature.pNCoordRing[nIRing] > 0)
+            {
+                bIs3d = true;
+                break;
+            }
+        }
+    }
+    const size_t nPointSize = (bIs3d ? 3 : 2) * sizeof(double);
+
+    size_t nOffset = 0;
+    const auto WriteUInt32 = [pabyWKB, &nOffset](uint32_t nVal)
+    {
+        if (pabyWKB)
+        {
+            CPL_LSBPTR32(&nVal);
+            memcpy(pabyWKB + nOffset, &nVal, sizeof(nVal));
+        }
+        nOffset += sizeof(nVal);
+    };
+    const auto WriteHeader = [pabyWKB, &nOffset, &WriteUInt32,
+                              bIs3d](OGRwkbGeometryType eType)
+    {
+        if (pabyWKB)
+            pabyWKB[nOffset] = static_cast<GByte>(wkbNDR);
+        nOffset++;
+        WriteUInt32(static_cast<uint32_t>(eType) + (bIs3d ? 1000 : 0));
+    };
+    const auto WritePoints =
+        [pabyWKB, &nOffset, &sFeature, bIs3d,
+         nPointSize](MM_N_VERTICES_TYPE nFirst, MM_N_VERTICES_TYPE nCount)
+    {
+        if (!pabyWKB)
+        {
+            nOffset += static_cast<size_t>(nCount) * nPointSize;
+            return;
+        }
+        for (MM_N_VERTICES_TYPE nIVrt = nFirst; nIVrt < nFirst + nCount;
+             nIVrt++)
+        {
+            double adfXYZ[3] = {sFeature.pCoord[nIVrt].dfX,
+                                sFeature.pCoord[nIVrt].dfY,
+                                bIs3d ? sFeature.pZCoord[nIVrt] : 0.0};
+            CPL_LSBPTR64(&adfXYZ[0]);
+            CPL_LSBPTR64(&adfXYZ[1]);
+            CPL_LSBPTR64(&adfXYZ[2]);
+            memcpy(pabyWKB + nOffset, adfXYZ, nPointSize);
+            nOffset += nPointSize;
+        }
+    };
+    // A ring starts a new polygon of a multipolygon if it is external
+    const auto IsExternalRing = [&sFeature](MM_POLYGON_RINGS_COUNT nIRing)
+    { return (sFeature.flag_VFG[nIRing] & MM_EXTERIOR_ARC_SIDE) != 0; };
+    const auto WriteRings = [&WriteUInt32, &WritePoints,
+                             &sFeature](MM_POLYGON_RINGS_COUNT nFirstRing,
+                                        MM_POLYGON_RINGS_COUNT nRingCount,
+                                        MM_N_VERTICES_TYPE &nIVrt)
+    {
+        WriteUInt32(static_cast<uint32_t>(nRingCount));
+        for (MM_POLYGON_RINGS_COUNT nIRing = nFirstRing;
+             nIRing < nFirstRing + nRingCount; nIRing++)
+        {
+            WriteUInt32(static_cast<uint32_t>(sFeature.pNCoordRing[nIRing]));
+            WritePoints(nIVrt, sFeature.pNCoordRing[nIRing]);
+            nIVrt += sFeature.pNCoordRing[nIRing];
+        }
+    };
+
+    if (bIsPoint)
+    {
+        WriteHeader(wkbPoint);
+        WritePoints(0, 1);
+    }
+    else if (bIsArc)
+    {
+        WriteHeader(wkbLineString);
+        WriteUInt32(static_cast<uint32_t>(sFeature.pNCoordRing[0]));
+        WritePoints(0, sFeature.pNCoordRing[0]);
+    }
+    else if (hMiraMonLayer->TopHeader.bIsMultipolygon)
+    {
+        if (!IsExternalRing(0))
+            return 0;
+
+        uint32_t nPolygons = 0;
+        for (MM_POLYGON_RINGS_COUNT nIRing = 0; nIRing < sFeature.nNRings;
+             nIRing++)
+        {
+            if (nIRing == 0 || IsExternalRing(nIRing))
+                nPolygons++;
+        }
+
+        WriteHeader(wkbMultiPolygon);
+        WriteUInt32(nPolygons);
+        MM_N_VERTICES_TYPE nIVrt = 0;
+        MM_POLYGON_RINGS_COUNT nFirstRing = 0;
+        while (nFirstRing < sFeature.nNRings)
+        {
+            MM_POLYGON_RINGS_COUNT nNextPolygonRing = nFirstRing + 1;
+            while (nNextPolygonRing < sFeature.nNRings &&
+                   !IsExternalRing(nNextPolygonRing))
+                nNextPolygonRing++;
+
+            WriteHeader(wkbPolygon);
+            WriteRings(nFirstRing, nNextPolygonRing - nFirstRing, nIVrt);
+            nFirstRing = nNextPolygonRing;
+        }
+    }
+    else
+    {
+        WriteHeader(wkbPolygon);
+        if (sFeature.nNRings && sFeature.nNumpCoord)
+        {
+            if (!IsExternalRing(0))
+                return 0;
+            MM_N_VERTICES_TYPE nIVrt = 0;
+            WriteRings(0, sFeature.nNRings, nIVrt);
+        }
+        else
+        {
+            WriteUInt32(0);
+        }
+    }
+
+    return nOffset;
+}
+
+/************************************************************************/
+/*                         MMArrowListBuilder                           */
+/************************************************************************/
+
+namespace
+{
+// Accumulates the values of a list field while GetNextArrowArray() fills
+// a batch, and then attaches them to the Arrow list array of the field.
+struct MMArrowListBuilder
+{
+    std::vector<int32_t> anOffsets{0};
+    std::vector<bool> abValid{};
+    size_t nValueCount = 0;
+
+    std::vector<GByte> abyBoolValues{};
+    std::vector<int32_t> anInt32Values{};
+    std::vector<int64_t> anInt64Values{};
+    std::vector<double> adfValues{};
+    std::vector<int32_t> anStringOffsets{0};
+    std::string osStringValues{};
+
+    void EndFeature(bool bIsNull)
+    {
+        anOffsets.push_back(static_cast<int32_t>(nValueCount));
+        abValid.push_back(!bIsNull);
+    }
+
+    void AddString(const char *pszVal)
+    {
+        osStringValues.append(pszVal);
+        anStringOffsets.push_back(static_cast<int32_t>(osStringValues.size()));
+        ++nValueCount;
+    }
+
+    bool Finalize(struct ArrowArray *psArray, int nFeatures,
+                  const OGRFieldDefn *poFieldDefn) const;
+};
+
+bool MMArrowListBuilder::Finalize(struct ArrowArray *psArray, int nFeatures,
+                                  const OGRFieldDefn *poFieldDefn) const
+{
+    const auto Dup = [](const void *pData, size_t nSize)
+    {
+        void *pRet =
+            VSI_MALLOC_ALIGNED_AUTO_VERBOSE(std::max<size_t>(nSize, 1));
+        if (pRet && nSize)
+            memcpy(pRet, pData, nSize);
+        return pRet;
+    };
+
+    const size_t nValues = static_cast<size_t>(anOffsets[nFeatures]);
+
+    psArray->length = nFeatures;
+    psArray->n_buffers = 2;
+    psArray->buffers =
+        static_cast<const void **>(CPLCalloc(2, sizeof(void *)));
+    psArray->buffers[1] =
+        Dup(anOffsets.data(), sizeof(int32_t) * (nFeatures + 1));
+    if (!psArray->buffers[1])
+        return false;
+
+    for (int i = 0; i < nFeatures; ++i)
+    {
+        if (abValid[i])
+            continue;
+        uint8_t *pabyNull =
+            static_cast<uint8_t *>(const_cast<void *>(psArray->buffers[0]));
+        if (pabyNull == nullptr)
+        {
+            pabyNull = static_cast<uint8_t *>(
+                VSI_MALLOC_ALIGNED_AUTO_VERBOSE((nFeatures + 7) / 8));
+            if (!pabyNull)
+                return false;
+            memset(pabyNull, 0xFF, (nFeatures + 7) / 8);
+            psArray->buffers[0] = pabyNull;
+        }
+        pabyNull[i / 8] &= static_cast<uint8_t>(~(1 << (i % 8)));
+        ++psArray->null_count;
+    }
+
+    psArray->n_children = 1;
+    psArray->children = static_cast<struct ArrowArray **>(
+        CPLCalloc(1, sizeof(struct ArrowArray *)));
+    psArray->children[0] = static_cast<struct ArrowArray *>(
+        CPLCalloc(1, sizeof(struct ArrowArray)));
+    auto psValues = psArray->children[0];
+    psValues->release = psArray->release;
+    psValues->length = static_cast<int64_t>(nValues);
+    psValues->n_buffers = poFieldDefn->GetType() == OFTStringList ? 3 : 2;
+    psValues->buffers = static_cast<const void **>(
+        CPLCalloc(psValues->n_buffers, sizeof(void *)));
+
+    switch (poFieldDefn->GetType())
+    {
+        case OFTIntegerList:
+        {
+            if (poFieldDefn->GetSubType() == OFSTBoolean)
+            {
+                const size_t nBytes = std::max<size_t>((nValues + 7) / 8, 1);
+                auto pabyBits = static_cast<uint8_t *>(
+                    VSI_MALLOC_ALIGNED_AUTO_VERBOSE(nBytes));
+                if (!pabyBits)
+                    return false;
+                memset(pabyBits, 0, nBytes);
+                for (size_t i = 0; i < nValues; ++i)
+                {
+                    if (abyBoolValues[i])
+                        pabyBits[i / 8] |= static_cast<uint8_t>(1 << (i % 8));
+                }
+                psValues->buffers[1] = pabyBits;
+            }
+            else
+            {
+                psValues->buffers[1] =
+                    Dup(anInt32Values.data(), sizeof(int32_t) * nValues);
+            }
+            break;
+        }
+
+        case OFTInteger64List:
+            psValues->buffers[1] =
+                Dup(anInt64Values.data(), sizeof(int64_t) * nValues);
+            break;
+
+        case OFTRealList:
+            psValues->buffers[1] =
+                Dup(adfValues.data(), sizeof(double) * nValues);
+            break;
+
+        default:
+        {
+            CPLAssert(poFieldDefn->GetType() == OFTStringList);
+            psValues->buffers[1] =
+                Dup(anStringOffsets.data(), sizeof(int32_t) * (nValues + 1));
+            psValues->buffers[2] =
+                Dup(osStringValues.data(),
+                    static_cast<size_t>(anStringOffsets[nValues]));
+            if (!psValues->buffers[2])
+                return false;
+            break;
+        }
+    }
+    return psValues->buffers[1] != nullptr;
+}
+}  // namespace
+
+/****************************************************************************/
+/*                         GetNextArrowArray()                              */
+/****************************************************************************/
+
+// Specialized implementation that fills the Arrow array buffers directly
+// from the extended DBF records and from the coordinates of the elements,
+// without going through OGRFeature objects. Multiple records are exported
+// as Arrow lists. Restricted to situations without attribute or spatial
+// filters. In other cases, fall back to generic implementation.
+int OGRMiraMonLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
+                                       struct ArrowArray *out_array)
+{
+    m_bLastGetNextArrowArrayUsedOptimizedCodePath = false;
+    if (!phMiraMonLayer || phMiraMonLayer->ReadOrWrite != MM_READING_MODE ||
+        m_poAttrQuery != nullptr || m_poFilterGeom != nullptr ||
+        CPLTestBool(CPLGetConfigOption("OGR_MIRAMON_STREAM_BASE_IMPL", "NO")))
+    {
+        return OGRLayer::GetNextArrowArray(stream, out_array);
+    }
+
+    bool bIsPolygon = false;
+    switch (phMiraMonLayer->eLT)
+    {
+        case MM_LayerType_Point:
+        case MM_LayerType_Point3d:
+        case MM_LayerType_Arc:
+        case MM_LayerType_Arc3d:
+            break;
+        case MM_LayerType_Pol:
+        case MM_LayerType_Pol3d:
+            bIsPolygon = true;
+            break;
+        default:
+            return OGRLayer::GetNextArrowArray(stream, out_array);
+    }
+
+    // If any field has a type or subtype that is not handled below, use
+    // generic implementation
+    const int nFieldCount = m_poFeatureDefn->GetFieldCount();
+    for (int i = 0; i < nFieldCount; ++i)
+    {
+        const OGRFieldDefn *poFieldDefn = m_poFeatureDefn->GetFieldDefn(i);
+        if (poFieldDefn->IsIgnored())
+            continue;
+        const OGRFieldSubType eSubType = poFieldDefn->GetSubType();
+        switch (poFieldDefn->GetType())
+        {
+            case OFTString:
+                if (eSubType != OFSTNone && eSubType != OFSTJSON)
+                    return OGRLayer::GetNextArrowArray(stream, out_array);
+                break;
+            case OFTInteger:
+            case OFTIntegerList:
+                if (eSubType != OFSTNone && eSubType != OFSTBoolean)
+                    return OGRLayer::GetNextArrowArray(stream, out_array);
+                break;
+            case OFTInteger64:
+            case OFTReal:
+            case OFTDate:
+            case OFTInteger64List:
+            case OFTRealList:
+            case OFTStringList:
+                if (eSubType != OFSTNone)
+                    return OGRLayer::GetNextArrowArray(stream, out_array);
+                break;
+            default:
+                return OGRLayer::GetNextArrowArray(stream, out_array);
+        }
+    }
+
+    OGRArrowArrayHelper sHelper(m_poDS, m_poFeatureDefn,
+                                m_aosArrowArrayStreamOptions, out_array);
+    if (out_array->release == nullptr)
+    {
+        return ENOMEM;
+    }
+
+    if (sHelper.m_nChildren == 0)
+    {
+        sHelper.ClearArray();
+        return OGRLayer::GetNextArrowArray(stream, out_array);
+    }
+
+    const int iGeomArrowField = m_poFeatureDefn->GetGeomFieldCount() > 0
+                                    ? sHelper.m_mapOGRGeomFieldToArrowField[0]
+                                    : -1;
+    const uint32_t nMemLimit = OGRArrowArrayHelper::GetMemLimit();
+    std::vector<MMArrowListBuilder> aoListBuilders(sHelper.m_nChildren);
+
+    struct tm brokenDown;
+    memset(&brokenDown, 0, sizeof(brokenDown));
+
+    // Returns true if appending nLen bytes to the string/binary array of
+    // index iArrowField would exceed the memory limit, in which case the
+    // current batch should be terminated before the current feature.
+    const auto WouldExceedMemLimit =
+        [out_array, nMemLimit](int iArrowField, int iFeat, size_t nLen)
+    {
+        if (iFeat == 0)
+            return false;
+        const auto psArray = out_array->children[iArrowField];
+        const auto panOffsets =
+            static_cast<const int32_t *>(psArray->buffers[1]);
+        const uint32_t nCurLength = static_cast<uint32_t>(panOffsets[iFeat]);
+        return nLen <= nMemLimit && nLen > nMemLimit - nCurLength;
+    };
+
+    // Returns 0 on success, 1 if the batch is full, or -1 on error
+    const auto SetString =
+        [&sHelper, &WouldExceedMemLimit](int iArrowField, int iFeat,
+                                         const char *pszVal, size_t nLen)
+    {
+        if (WouldExceedMemLimit(iArrowField, iFeat, nLen))
+            return 1;
+        GByte *outPtr =
+            sHelper.GetPtrForStringOrBinary(iArrowField, iFeat, nLen);
+        if (outPtr == nullptr)
+            return -1;
+        memcpy(outPtr, pszVal, nLen);
+        return 0;
+    };
+
+    m_bLastGetNextArrowArrayUsedOptimizedCodePath = true;
+    int iFeat = 0;
+    while (iFeat < sHelper.m_nMaxBatchSize)
+    {
+        // The first polygon is the universal one, not exposed as a feature
+        const MM_INTERNAL_FID nIElem =
+            bIsPolygon ? (MM_INTERNAL_FID)(m_iNextFID + 1)
+                       : (MM_INTERNAL_FID)m_iNextFID;
+        if (nIElem >= phMiraMonLayer->TopHeader.nElemCount)
+            break;
+
+        if (sHelper.m_panFIDValues)
+            sHelper.m_panFIDValues[iFeat] = static_cast<int64_t>(m_iNextFID);
+
+        if (iGeomArrowField >= 0)
+        {
+            if (MMGetGeoFeatureFromVector(phMiraMonLayer, nIElem))
+            {
+                CPLError(CE_Failure, CPLE_AppDefined, "Wrong file format.");
+                break;
+            }
+            const size_t nWKBSize =
+                MMGetWKBFromReadFeature(phMiraMonLayer, nullptr);
+            if (nWKBSize == 0)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined, "Wrong polygon format.");
+                break;
+            }
+            if (WouldExceedMemLimit(iGeomArrowField, iFeat, nWKBSize))
+                break;
+            GByte *outPtr = sHelper.GetPtrForStringOrBinary(iGeomArrowField,
+                                                            iFeat, nWKBSize);
+            if (outPtr == nullptr)
+            {
+                sHelper.ClearArray();
+                return ENOMEM;
+            }
+            MMGetWKBFromReadFeature(phMiraMonLayer, outPtr);
+        }
+
+        const bool bHasRecord =
+            phMiraMonLayer->pMMBDXP &&
+            (MM_EXT_DBF_N_RECORDS)nIElem < phMiraMonLayer->pMMBDXP->nRecords;
+        const MM_EXT_DBF_N_MULTIPLE_RECORDS nMR =
+            bHasRecord && phMiraMonLayer->pMultRecordIndex
+                ? phMiraMonLayer->pMultRecordIndex[nIElem].nMR
+                : 0;
+
+        bool bBatchFull = false;
+        for (int iField = 0; iField < nFieldCount; ++iField)
+        {
+            const int iArrowField = sHelper.m_mapOGRFieldToArrowField[iField];
+            if (iArrowField < 0)
+                continue;
+            const OGRFieldDefn *poFieldDefn =
+                m_poFeatureDefn->GetFieldDefnUnsafe(iField);
+            const OGRFieldType eType = poFieldDefn->GetType();
+            const OGRFieldSubType eSubType = poFieldDefn->GetSubType();
+            const MM_EXT_DBF_N_FIELDS nIField = (MM_EXT_DBF_N_FIELDS)iField;
+            auto psArray = out_array->children[iArrowField];
+
+            int nRet = 0;
+            if (eType == OFTIntegerList || eType == OFTInteger64List ||
+                eType == OFTRealList || eType == OFTStringList)
+            {
+                MMArrowListBuilder &oList = aoListBuilders[iArrowField];
+                if (nMR == 0)
+                {
+                    oList.EndFeature(true);
+                    continue;
+                }
+                if (iFeat > 0 &&
+                    nMR > static_cast<size_t>(INT_MAX) - oList.nValueCount)
+                {
+                    bBatchFull = true;
+                    break;
+                }
+                for (MM_EXT_DBF_N_MULTIPLE_RECORDS nIRecord = 0;
+                     nIRecord < nMR && nRet == 0; nIRecord++)
+                {
+                    const char *pszVal =
+                        ReadFieldOfMultipleRecord(nIElem, nIRecord, nIField);
+                    if (!pszVal)
+                    {
+                        nRet = -1;
+                        break;
+                    }
+                    if (eType == OFTStringList)
+                    {
+                        MM_RemoveWhitespacesFromEndOfString(
+                            phMiraMonLayer->szStringToOperate);
+                        RecodeStringToOperate(nIField);
+                        const size_t nLen = strlen(pszVal);
+                        if (iFeat > 0 && nLen <= nMemLimit &&
+                            nLen > nMemLimit - oList.osStringValues.size())
+                            nRet = 1;
+                        else
+                            oList.AddString(pszVal);
+                        continue;
+                    }
+                    if (MMIsEmptyString(pszVal))
+                        continue;
+                    if (eType == OFTInteger64List)
+                    {
+                        oList.anInt64Values.push_back(CPLAtoGIntBig(pszVal));
+                    }
+                    else if (eSubType == OFSTBoolean)
+                    {
+                        oList.abyBoolValues.push_back(
+                            *pszVal == 'T' || *pszVal == 'S' || *pszVal == 'Y');
+                    }
+                    else if (eType == OFTIntegerList)
+                    {
+                        const double dfVal = CPLAtof(pszVal);
+                        oList.anInt32Values.push_back(
+                            dfVal < INT_MIN   ? INT_MIN
+                            : dfVal > INT_MAX ? INT_MAX
+                                              : static_cast<int>(dfVal));
+                    }
+                    else
+                    {
+                        oList.adfValues.push_back(CPLAtof(pszVal));
+                    }
+                    ++oList.nValueCount;
+                }
+                if (nRet == 0)
+                    oList.EndFeature(false);
+            }
+            else if (eType == OFTString && eSubType == OFSTJSON)
+            {
+                if (nMR == 0)
+                {
+                    nRet = sHelper.SetNull(iArrowField, iFeat) ? 0 : -1;
+                }
+                else
+                {
+                    std::string osJSON = "[";
+                    for (MM_EXT_DBF_N_MULTIPLE_RECORDS nIRecord = 0;
+                         nIRecord < nMR; nIRecord++)
+                    {
+                        if (!ReadFieldOfMultipleRecord(nIElem, nIRecord,
+                                                       nIField))
+                        {
+                            nRet = -1;
+                            break;
+                        }
+                        MM_RemoveLeadingWhitespaceOfString(
+                            phMiraMonLayer->szStringToOperate);
+                        MM_RemoveWhitespacesFromEndOfString(
+                            phMiraMonLayer->szStringToOperate);
+                        RecodeStringToOperate(nIField);
+                        if (nIRecord > 0)
+                            osJSON += ',';
+                        osJSON += phMiraMonLayer->szStringToOperate;
+                    }
+                    osJSON += ']';
+                    if (nRet == 0)
+                        nRet = SetString(iArrowField, iFeat, osJSON.c_str(),
+                                         osJSON.size());
+                }
+            }
+            else
+            {
+                MM_EXT_DBF_N_MULTIPLE_RECORDS nIRecord = 0;
+                const char *pszVal = nullptr;
+                if (bHasRecord && GetRecordOfSimpleField(nIElem, nIRecord))
+                {
+                    pszVal =
+                        ReadFieldOfMultipleRecord(nIElem, nIRecord, nIField);
+                    if (!pszVal)
+                    {
+                        sHelper.ClearArray();
+                        return ENOMEM;
+                    }
+                    MM_RemoveWhitespacesFromEndOfString(
+                        phMiraMonLayer->szStringToOperate);
+                    if (eType == OFTDate && MMIsEmptyString(pszVal))
+                        pszVal = nullptr;
+                }
+
+                if (!pszVal)
+                {
+                    nRet = sHelper.SetNull(iArrowField, iFeat) ? 0 : -1;
+                }
+                else if (eType == OFTString)
+                {
+                    RecodeStringToOperate(nIField);
+                    nRet = SetString(iArrowField, iFeat, pszVal,
+                                     strlen(pszVal));
+                }
+                else if (eType == OFTInteger64)
+                {
+                    OGRArrowArrayHelper::SetInt64(psArray, iFeat,
+                                                  CPLAtoGIntBig(pszVal));
+                }
+                else if (eType == OFTInteger && eSubType == OFSTBoolean)
+                {
+                    if (*pszVal == 'T' || *pszVal == 'S' || *pszVal == 'Y')
+                        OGRArrowArrayHelper::SetBoolOn(psArray, iFeat);
+                }
+                else if (eType == OFTInteger)
+                {
+                    const double dfVal = CPLAtof(pszVal);
+                    OGRArrowArrayHelper::SetInt32(
+                        psArray, iFeat,
+                        dfVal < INT_MIN   ? INT_MIN
+                        : dfVal > INT_MAX ? INT_MAX
+                                          : static_cast<int>(dfVal));
+                }
+                else if (eType == OFTReal)
+                {
+                    OGRArrowArrayHelper::SetDouble(psArray, iFeat,
+                                                   CPLAtof(pszVal));
+                }
+                else
+                {
+                    CPLAssert(eType == OFTDate);
+                    char szDate[5];
+                    OGRField sField;
+                    CPLStrlcpy(szDate, pszVal, 5);
+                    sField.Date.Year = static_cast<GInt16>(atoi(szDate));
+                    CPLStrlcpy(szDate, pszVal + 4, 3);
+                    sField.Date.Month = static_cast<GByte>(atoi(szDate));
+                    CPLStrlcpy(szDate, pszVal + 6, 3);
+                    sField.Date.Day = static_cast<GByte>(atoi(szDate));
+                    OGRArrowArrayHelper::SetDate(psArray, iFeat, brokenDown,
+                                                 sField);
+                }
+            }
+
+            if (nRet < 0)
+            {
+                sHelper.ClearArray();
+                return ENOMEM;
+            }
+            if (nRet > 0)
+            {
+                bBatchFull = true;
+                break;
+            }
+        }
+        if (bBatchFull)
+            break;
+
+        m_iNextFID++;
+        ++iFeat;
+    }
+
+    if (iFeat == 0)
+    {
+        sHelper.ClearArray();
+        return 0;
+    }
+
+    for (int iField = 0; iField < nFieldCount; ++iField)
+    {
+        const int iArrowField = sHelper.m_mapOGRFieldToArrowField[iField];
+        if (iArrowField < 0)
+            continue;
+        const OGRFieldDefn *poFieldDefn =
+            m_poFeatureDefn->GetFieldDefnUnsafe(iField);
+        const OGRFieldType eType = poFieldDefn->GetType();
+        if ((eType == OFTIntegerList || eType == OFTInteger64List ||
+             eType == OFTRealList || eType == OFTStringList) &&
+            !aoListBuilders[iArrowField].Finalize(
+                out_array->children[iArrowField], iFeat, poFieldDefn))
+        {
+            sHelper.ClearArray();
+            return ENOMEM;
+        }
+    }
+
+    sHelper.Shrink(iFeat);
+    m_nFeaturesRead += iFeat;
+    return 0;
+}
+
+/****************************************************************************/
+/*                          GetMetadataItem()                               */
+/****************************************************************************/
+
+const char *OGRMiraMonLayer::GetMetadataItem(const char *pszName,
+                                             const char *pszDomain)
+{
+    if (pszName && pszDomain && EQUAL(pszDomain, "__DEBUG__") &&
+        EQUAL(pszName, "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH"))
+    {
+        return m_bLastGetNextArrowArrayUsedOptimizedCodePath ? "YES" : "NO";
+    }
+    return OGRLayer::GetMetadataItem(pszName, pszDomain);
+}
+
 /****************************************************************************/
 /*                         GetFeatureCount()                                */
 /****************************************************************************/
 GIntBig OGRMiraMonLayer::GetFeatureCount(int bForce)
 {
+    if (m_poPolygonPipeline)
+        WritePreparedPolygons(true);
+
     if (!phMiraMonLayer || m_poFilterGeom != nullptr ||
         m_poAttrQuery != nullptr)
         return OGRLayer::GetFeatureCount(bForce);
@@ -1589,7 +2750,8 @@ OGRErr OGRMiraMonLayer::MMProcessMultiGeometry(OGRGeometryH hGeom,
 /****************************************************************************/
 OGRErr OGRMiraMonLayer::MMProcessGeometry(OGRGeometryH hGeom,
                                           OGRFeature *poFeature,
-                                          MM_BOOLEAN bcalculateRecord)
+                                          MM_BOOLEAN bcalculateRecord,
+                                          struct MiraMonFeature *psPrepared)
 
 {
     OGRErr eErr = OGRERR_NONE;
@@ -1675,7 +2837,7 @@ OGRErr OGRMiraMonLayer::MMProcessGeometry(OGRGeometryH hGeom,
     // Reads objects with coordinates and transform them to MiraMon
     if (poGeom)
     {
-        eErr = MMLoadGeometry(OGRGeometry::ToHandle(poGeom));
+        eErr = MMLoadGeometry(OGRGeometry::ToHandle(poGeom), psPrepared);
     }
     else
     {
@@ -1717,6 +2879,36 @@ OGRErr OGRMiraMonLayer::ICreateFeature(OGRFeature *poFeature)
     /* -------------------------------------------------------------------- */
     OGRGeometry *poGeom = poFeature->GetGeometryRef();
 
+    // Polygons can have their geometry loaded by worker threads, and be
+    // written later. Everything else is written right now, after the
+    // polygons received before.
+    if (m_poPolygonPipeline)
+    {
+        const auto eFlatType =
+            poGeom ? wkbFlatten(poGeom->getGeometryType()) : wkbNone;
+        const bool bDeferred =
+            (eFlatType == wkbPolygon || eFlatType == wkbMultiPolygon) &&
+            !poGeom->IsEmpty();
+        eErr = WritePreparedPolygons(!bDeferred);
+        if (bDeferred)
+        {
+            // Polygon FIDs start at 0, after the universal polygon
+            const GIntBig nWrittenPolygons =
+                hMiraMonLayerPOL.TopHeader.nElemCount > 1
+                    ? static_cast<GIntBig>(
+                          hMiraMonLayerPOL.TopHeader.nElemCount - 1)
+                    : 0;
+            poFeature->SetFID(
+                nWrittenPolygons +
+                static_cast<GIntBig>(m_poPolygonPipeline->GetPendingCount()));
+            m_poPolygonPipeline->Add(
+                std::unique_ptr<OGRFeature>(poFeature->Clone()));
+            return eErr;
+        }
+        if (eErr != OGRERR_NONE)
+            return eErr;
+    }
+
     // Processing a feature without geometry.
     if (poGeom == nullptr)
     {
@@ -1762,99 +2954,126 @@ OGRErr OGRMiraMonLayer::ICreateFeature(OGRFeature *poFeature)
 
 /****************************************************************************/
 /*                          MMDumpVertices()                                */
+/*                                                                          */
+/*      Appends the vertices of a ring (or of a point or a line) to         */
+/*      sFeature. It only uses its arguments, so that it can run in a       */
+/*      worker thread.                                                      */
 /****************************************************************************/
 
-OGRErr OGRMiraMonLayer::MMDumpVertices(OGRGeometryH hGeom,
-                                       MM_BOOLEAN bExternalRing,
-                                       MM_BOOLEAN bUseVFG)
+static OGRErr MMDumpVertices(OGRGeometryH hGeom, MM_BOOLEAN bExternalRing,
+                             MM_BOOLEAN bUseVFG,
+                             struct MiraMonFeature &sFeature, bool &bIsReal3d)
 {
-    // If the MiraMonLayer structure has not been init,
-    // here is the moment to do that.
-    if (!phMiraMonLayer)
-        return OGRERR_FAILURE;
-
-    if (!phMiraMonLayer->bIsBeenInit)
-    {
-        if (MMInitLayerByType(phMiraMonLayer))
-            return OGRERR_FAILURE;
-        phMiraMonLayer->bIsBeenInit = 1;
-    }
     if (MMResize_MM_N_VERTICES_TYPE_Pointer(
-            &hMMFeature.pNCoordRing, &hMMFeature.nMaxpNCoordRing,
-            (MM_N_VERTICES_TYPE)hMMFeature.nNRings + 1, MM_MEAN_NUMBER_OF_RINGS,
+            &sFeature.pNCoordRing, &sFeature.nMaxpNCoordRing,
+            (MM_N_VERTICES_TYPE)sFeature.nNRings + 1, MM_MEAN_NUMBER_OF_RINGS,
             0))
         return OGRERR_FAILURE;
 
     if (bUseVFG)
     {
-        if (MMResizeVFGPointer(&hMMFeature.flag_VFG, &hMMFeature.nMaxVFG,
-                               (MM_INTERNAL_FID)hMMFeature.nNRings + 1,
+        if (MMResizeVFGPointer(&sFeature.flag_VFG, &sFeature.nMaxVFG,
+                               (MM_INTERNAL_FID)sFeature.nNRings + 1,
                                MM_MEAN_NUMBER_OF_RINGS, 0))
             return OGRERR_FAILURE;
 
-        hMMFeature.flag_VFG[hMMFeature.nIRing] = MM_END_ARC_IN_RING;
+        sFeature.flag_VFG[sFeature.nIRing] = MM_END_ARC_IN_RING;
         if (bExternalRing)
-            hMMFeature.flag_VFG[hMMFeature.nIRing] |= MM_EXTERIOR_ARC_SIDE;
+            sFeature.flag_VFG[sFeature.nIRing] |= MM_EXTERIOR_ARC_SIDE;
         // In MiraMon the external ring is clockwise and the internals are
         // coounterclockwise.
         OGRGeometry *poGeom = OGRGeometry::FromHandle(hGeom);
         if ((bExternalRing && !poGeom->toLinearRing()->isClockwise()) ||
             (!bExternalRing && poGeom->toLinearRing()->isClockwise()))
-            hMMFeature.flag_VFG[hMMFeature.nIRing] |= MM_ROTATE_ARC;
+            sFeature.flag_VFG[sFeature.nIRing] |= MM_ROTATE_ARC;
     }
 
-    hMMFeature.pNCoordRing[hMMFeature.nIRing] = OGR_G_GetPointCount(hGeom);
+    sFeature.pNCoordRing[sFeature.nIRing] = OGR_G_GetPointCount(hGeom);
 
-    if (MMResizeMM_POINT2DPointer(&hMMFeature.pCoord, &hMMFeature.nMaxpCoord,
-                                  hMMFeature.nICoord +
-                                      hMMFeature.pNCoordRing[hMMFeature.nIRing],
+    if (MMResizeMM_POINT2DPointer(&sFeature.pCoord, &sFeature.nMaxpCoord,
+                                  sFeature.nICoord +
+                                      sFeature.pNCoordRing[sFeature.nIRing],
                                   MM_MEAN_NUMBER_OF_NCOORDS, 0))
         return OGRERR_FAILURE;
-    if (MMResizeDoublePointer(&hMMFeature.pZCoord, &hMMFeature.nMaxpZCoord,
-                              hMMFeature.nICoord +
-                                  hMMFeature.pNCoordRing[hMMFeature.nIRing],
+    if (MMResizeDoublePointer(&sFeature.pZCoord, &sFeature.nMaxpZCoord,
+                              sFeature.nICoord +
+                                  sFeature.pNCoordRing[sFeature.nIRing],
                               MM_MEAN_NUMBER_OF_NCOORDS, 0))
         return OGRERR_FAILURE;
 
-    hMMFeature.bAllZHaveSameValue = TRUE;
+    sFeature.bAllZHaveSameValue = TRUE;
     for (int iPoint = 0;
-         (MM_N_VERTICES_TYPE)iPoint < hMMFeature.pNCoordRing[hMMFeature.nIRing];
+         (MM_N_VERTICES_TYPE)iPoint < sFeature.pNCoordRing[sFeature.nIRing];
          iPoint++)
     {
-        hMMFeature.pCoord[hMMFeature.nICoord].dfX = OGR_G_GetX(hGeom, iPoint);
-        hMMFeature.pCoord[hMMFeature.nICoord].dfY = OGR_G_GetY(hGeom, iPoint);
+        sFeature.pCoord[sFeature.nICoord].dfX = OGR_G_GetX(hGeom, iPoint);
+        sFeature.pCoord[sFeature.nICoord].dfY = OGR_G_GetY(hGeom, iPoint);
         if (OGR_G_GetCoordinateDimension(hGeom) == 2)
-            hMMFeature.pZCoord[hMMFeature.nICoord] =
+            sFeature.pZCoord[sFeature.nICoord] =
                 MM_NODATA_COORD_Z;  // Possible rare case
         else
         {
-            hMMFeature.pZCoord[hMMFeature.nICoord] = OGR_G_GetZ(hGeom, iPoint);
-            phMiraMonLayer->bIsReal3d = 1;
+            sFeature.pZCoord[sFeature.nICoord] = OGR_G_GetZ(hGeom, iPoint);
+            bIsReal3d = true;
         }
 
         // Asking if last Z-coordinate is the same than this one.
         // If all Z-coordinates are the same, following MiraMon specification
-        // only the hMMFeature.pZCoord[0] value will be used and the number of
+        // only the sFeature.pZCoord[0] value will be used and the number of
         // vertices will be saved as a negative number on disk
-        if (iPoint > 0 &&
-            !CPLIsEqual(hMMFeature.pZCoord[hMMFeature.nICoord],
-                        hMMFeature.pZCoord[hMMFeature.nICoord - 1]))
-            hMMFeature.bAllZHaveSameValue = FALSE;
+        if (iPoint > 0 && !CPLIsEqual(sFeature.pZCoord[sFeature.nICoord],
+                                      sFeature.pZCoord[sFeature.nICoord - 1]))
+            sFeature.bAllZHaveSameValue = FALSE;
 
-        hMMFeature.nICoord++;
+        sFeature.nICoord++;
     }
-    hMMFeature.nIRing++;
-    hMMFeature.nNRings++;
+    sFeature.nIRing++;
+    sFeature.nNRings++;
     return OGRERR_NONE;
 }
 
 /****************************************************************************/
-/*                           MMLoadGeometry()                               */
+/*                       WritePreparedPolygons()                            */
+/*                                                                          */
+/*      Writes the polygons whose geometry has already been loaded by the   */
+/*      worker threads. Returns the first error found, if any.             */
+/****************************************************************************/
+
+OGRErr OGRMiraMonLayer::WritePreparedPolygons(bool bWaitAll)
+{
+    OGRErr eErr = OGRERR_NONE;
+    while (auto poChunk = m_poPolygonPipeline->GetNextChunk(bWaitAll))
+    {
+        for (auto &sItem : poChunk->aoItems)
+        {
+            for (const auto &oError : sItem.aoErrors)
+                CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+
+            OGRErr eItemErr = sItem.eErr;
+            if (eItemErr == OGRERR_NONE)
+            {
+                if (sItem.bIsReal3d)
+                    hMiraMonLayerPOL.bIsReal3d = 1;
+                eItemErr = MMProcessGeometry(
+                    OGRGeometry::ToHandle(sItem.poFeature->GetGeometryRef()),
+                    sItem.poFeature.get(), TRUE, &sItem.sFeature);
+            }
+            if (eErr == OGRERR_NONE)
+                eErr = eItemErr;
+        }
+    }
+    return eErr;
+}
+
+/****************************************************************************/
+/*                         MMLoadGeometryInto()                             */
 /*                                                                          */
 /*      Loads on a MiraMon object Feature all coordinates from feature      */
 /*                                                                          */
 /****************************************************************************/
-OGRErr OGRMiraMonLayer::MMLoadGeometry(OGRGeometryH hGeom)
+static OGRErr MMLoadGeometryInto(OGRGeometryH hGeom,
+                                 struct MiraMonFeature &sFeature,
+                                 bool &bIsReal3d)
 
 {
     OGRErr eErr = OGRERR_NONE;
@@ -1874,7 +3093,7 @@ OGRErr OGRMiraMonLayer::MMLoadGeometry(OGRGeometryH hGeom)
             OGRGeometryH poSubGeometry = OGR_G_GetGeometryRef(hGeom, iGeom);
 
             // Reads all coordinates
-            eErr = MMLoadGeometry(poSubGeometry);
+            eErr = MMLoadGeometryInto(poSubGeometry, sFeature, bIsReal3d);
             if (eErr != OGRERR_NONE)
                 return eErr;
         }
@@ -1886,7 +3105,8 @@ OGRErr OGRMiraMonLayer::MMLoadGeometry(OGRGeometryH hGeom)
             OGRGeometryH poSubGeometry = OGR_G_GetGeometryRef(hGeom, iGeom);
 
             // Reads all coordinates
-            eErr = MMDumpVertices(poSubGeometry, TRUE, TRUE);
+            eErr = MMDumpVertices(poSubGeometry, TRUE, TRUE, sFeature,
+                                  bIsReal3d);
             if (eErr != OGRERR_NONE)
                 return eErr;
         }
@@ -1902,7 +3122,8 @@ OGRErr OGRMiraMonLayer::MMLoadGeometry(OGRGeometryH hGeom)
             else
                 bExternalRing = false;
 
-            eErr = MMDumpVertices(poSubGeometry, bExternalRing, TRUE);
+            eErr = MMDumpVertices(poSubGeometry, bExternalRing, TRUE, sFeature,
+                                  bIsReal3d);
             if (eErr != OGRERR_NONE)
                 return eErr;
         }
@@ -1910,7 +3131,7 @@ OGRErr OGRMiraMonLayer::MMLoadGeometry(OGRGeometryH hGeom)
     else if (eLT == wkbPoint || eLT == wkbLineString)
     {
         // Reads all coordinates
-        eErr = MMDumpVertices(hGeom, true, FALSE);
+        eErr = MMDumpVertices(hGeom, true, FALSE, sFeature, bIsReal3d);
 
         if (eErr != OGRERR_NONE)
             return eErr;
@@ -1926,6 +3147,64 @@ OGRErr OGRMiraMonLayer::MMLoadGeometry(OGRGeometryH hGeom)
     return OGRERR_NONE;
 }
 
+/****************************************************************************/
+/*                       MMSwapFeatureGeometry()                            */
+/****************************************************************************/
+
+static void MMSwapFeatureGeometry(struct MiraMonFeature &sA,
+                                  struct MiraMonFeature &sB)
+{
+    std::swap(sA.nNRings, sB.nNRings);
+    std::swap(sA.nIRing, sB.nIRing);
+    std::swap(sA.nMaxpNCoordRing, sB.nMaxpNCoordRing);
+    std::swap(sA.pNCoordRing, sB.pNCoordRing);
+    std::swap(sA.nMaxpCoord, sB.nMaxpCoord);
+    std::swap(sA.nNumpCoord, sB.nNumpCoord);
+    std::swap(sA.nICoord, sB.nICoord);
+    std::swap(sA.pCoord, sB.pCoord);
+    std::swap(sA.nMaxVFG, sB.nMaxVFG);
+    std::swap(sA.flag_VFG, sB.flag_VFG);
+    std::swap(sA.nMaxpZCoord, sB.nMaxpZCoord);
+    std::swap(sA.nNumpZCoord, sB.nNumpZCoord);
+    std::swap(sA.pZCoord, sB.pZCoord);
+    std::swap(sA.bAllZHaveSameValue, sB.bAllZHaveSameValue);
+}
+
+/****************************************************************************/
+/*                           MMLoadGeometry()                               */
+/*                                                                          */
+/*      Loads on hMMFeature all coordinates from the geometry, or takes     */
+/*      them from psPrepared if they have already been loaded by a          */
+/*      worker thread.                                                      */
+/****************************************************************************/
+OGRErr OGRMiraMonLayer::MMLoadGeometry(OGRGeometryH hGeom,
+                                       struct MiraMonFeature *psPrepared)
+
+{
+    if (!phMiraMonLayer)
+        return OGRERR_FAILURE;
+
+    OGRErr eErr = OGRERR_NONE;
+    bool bIsReal3d = false;
+    if (psPrepared)
+        MMSwapFeatureGeometry(hMMFeature, *psPrepared);
+    else
+        eErr = MMLoadGeometryInto(hGeom, hMMFeature, bIsReal3d);
+    if (bIsReal3d)
+        phMiraMonLayer->bIsReal3d = 1;
+
+    // If the MiraMonLayer structure has not been init,
+    // here is the moment to do that.
+    if (hMMFeature.nNRings > 0 && !phMiraMonLayer->bIsBeenInit)
+    {
+        if (MMInitLayerByType(phMiraMonLayer))
+            return OGRERR_FAILURE;
+        phMiraMonLayer->bIsBeenInit = 1;
+    }
+
+    return eErr;
+}
+
 /****************************************************************************/
 /*                           WriteGeometry()                                */
 /*                                                                          */
@@ -2689,6 +3968,9 @@ OGRFeatureDefn *OGRMiraMonLayer::GetLayerDefn()
 OGRErr OGRMiraMonLayer::GetExtent(OGREnvelope *psExtent, int bForce)
 
 {
+    if (m_poPolygonPipeline)
+        WritePreparedPolygons(true);
+
     if (phMiraMonLayer)
     {
         if (phMiraMonLayer->bIsDBF)
@@ -2736,6 +4018,15 @@ int OGRMiraMonLayer::TestCapability(const char *pszCap)
     if (EQUAL(pszCap, OLCFastGetExtent))
         return TRUE;
 
+    if (EQUAL(pszCap, OLCFastSpatialFilter))
+        return phMiraMonLayer &&
+               (phMiraMonLayer->bIsArc || phMiraMonLayer->bIsPolygon) &&
+               phMiraMonLayer->ReadOrWrite == MM_READING_MODE;
+
+    if (EQUAL(pszCap, OLCFastGetArrowStream))
+        return phMiraMonLayer &&
+               phMiraMonLayer->ReadOrWrite == MM_READING_MODE;
+
     if (EQUAL(pszCap, OLCCreateField))
         return m_bUpdate;
 
@@ -666,6 +666,23 @@ GByte *TABINDFile::BuildKey(int nIndexNumber, GInt64 nValue)
     return m_papbyKeyBuffers[nIndexNumber - 1];
 }
 
+/**********************************************************************
+ *                   TABINDFile::GetKeyLength()
+ *
+ * Return the length in bytes of the keys of one of the indexes.
+ *
+ * Note that index numbers are positive values starting at 1.
+ *
+ * Returns a value > 0 on success, -1 on error.
+ **********************************************************************/
+int TABINDFile::GetKeyLength(int nIndexNumber)
+{
+    if (ValidateIndexNo(nIndexNumber) != 0)
+        return -1;
+
+    return m_papoIndexRootNodes[nIndexNumber - 1]->GetKeyLength();
+}
+
 /**********************************************************************
  *                   TABINDFile::FindFirst()
  *
@@ -1796,6 +1796,7 @@ class TABINDFile
 
     int SetIndexFieldType(int nIndexNumber, TABFieldType eType);
     int SetIndexUnique(int nIndexNumber, GBool bUnique = TRUE);
+    int GetKeyLength(int nIndexNumber);
     GByte *BuildKey(int nIndexNumber, GInt32 nValue);
     GByte *BuildKey(int nIndexNumber, GInt64 nValue);
     GByte *BuildKey(int nIndexNumber, const char *pszStr);
@@ -45,6 +45,7 @@
 #include "gpb.h"
 
 #include <algorithm>
+#include <array>
 #include <memory>
 #include <vector>
 #include <set>
@@ -90,6 +91,9 @@ constexpr size_t knMAX_STRING_VALUE_LENGTH = 256;
 constexpr size_t knMAX_LAYER_NAME_LENGTH = 256;
 constexpr size_t knMAX_FIELD_NAME_LENGTH = 256;
 
+// Maximum number of tiles of a feature pre-generated by a single job
+constexpr size_t knMAX_TILES_PER_TASK = 64;
+
 #undef SQLITE_STATIC
 #define SQLITE_STATIC ((sqlite3_destructor_type) nullptr)
 
@@ -3266,6 +3270,20 @@ struct OGRMVTFeatureContent
     GIntBig nFID;
 };
 
+// Encoded feature for a tile, to be inserted in the temporary database
+struct OGRMVTTempTileRow
+{
+    int nZ = 0;
+    int nX = 0;
+    int nY = 0;
+    int nGeomType = 0;
+    double dfAreaOrLength = 0;
+    std::string osFeature{};
+};
+
+// Tile coordinates (z, x, y) whose content must be pre-generated
+using OGRMVTTileCoord = std::array<int, 3>;
+
 class OGRMVTWriterDataset final : public GDALDataset
 {
     class MVTFieldProperties
@@ -3312,6 +3330,7 @@ class OGRMVTWriterDataset final : public GDALDataset
     mutable CPLWorkerThreadPool m_oThreadPool;
     bool m_bThreadPoolOK = false;
     mutable GIntBig m_nTempTiles = 0;
+    mutable bool m_bTempDBInTransaction = false;
     CPLString m_osName;
     CPLString m_osDescription;
     CPLString m_osType{"overlay"};
@@ -3330,21 +3349,32 @@ class OGRMVTWriterDataset final : public GDALDataset
     double m_dfTileDim0 = 0.0;
     bool m_bReuseTempFile = false;  // debug only
 
-    OGRErr PreGenerateForTile(
-        int nZ, int nX, int nY, const CPLString &osTargetName,
-        bool bIsMaxZoomForLayer,
+    OGRErr PreGenerateForTiles(
+        std::vector<OGRMVTTileCoord> &&aoTiles, const CPLString &osTargetName,
+        int nMaxZoomForLayer,
         const std::shared_ptr<OGRMVTFeatureContent> &poFeatureContent,
         GIntBig nSerial, const std::shared_ptr<OGRGeometry> &poGeom,
         const OGREnvelope &sEnvelope) const;
 
     static void WriterTaskFunc(void *pParam);
 
+    OGRErr PreGenerateForTilesReal(const std::vector<OGRMVTTileCoord> &aoTiles,
+                                   const CPLString &osTargetName,
+                                   int nMaxZoomForLayer,
+                                   const OGRMVTFeatureContent *poFeatureContent,
+                                   GIntBig nSerial, const OGRGeometry *poGeom,
+                                   const OGREnvelope &sEnvelope) const;
+
     OGRErr PreGenerateForTileReal(int nZ, int nX, int nY,
-                                  const CPLString &osTargetName,
                                   bool bIsMaxZoomForLayer,
                                   const OGRMVTFeatureContent *poFeatureContent,
-                                  GIntBig nSerial, const OGRGeometry *poGeom,
-                                  const OGREnvelope &sEnvelope) const;
+                                  const OGRGeometry *poGeom,
+                                  const OGREnvelope &sEnvelope,
+                                  std::vector<OGRMVTTempTileRow> &aoRows) const;
+
+    OGRErr InsertTempTiles(const std::vector<OGRMVTTempTileRow> &aoRows,
+                           const CPLString &osTargetName,
+                           GIntBig nSerial) const;
 
     void ConvertToTileCoords(double dfX, double dfY, int &nX, int &nY,
                              double dfTopX, double dfTopY,
@@ -3917,10 +3947,9 @@ bool OGRMVTWriterDataset::EncodePolygon(MVTTileLayerFeature *poGPBFeature,
 /************************************************************************/
 
 OGRErr OGRMVTWriterDataset::PreGenerateForTileReal(
-    int nZ, int nTileX, int nTileY, const CPLString &osTargetName,
-    bool bIsMaxZoomForLayer, const OGRMVTFeatureContent *poFeatureContent,
-    GIntBig nSerial, const OGRGeometry *poGeom,
-    const OGREnvelope &sEnvelope) const
+    int nZ, int nTileX, int nTileY, bool bIsMaxZoomForLayer,
+    const OGRMVTFeatureContent *poFeatureContent, const OGRGeometry *poGeom,
+    const OGREnvelope &sEnvelope, std::vector<OGRMVTTempTileRow> &aoRows) const
 {
     double dfTileDim = m_dfTileDim0 / (1 << nZ);
     double dfBuffer = dfTileDim * m_nBuffer / m_nExtent;
@@ -4262,36 +4291,93 @@ OGRErr OGRMVTWriterDataset::PreGenerateForTileReal(
     size_t nCompressedSize = 0;
     void *pCompressed = CPLZLibDeflate(oBuffer.data(), oBuffer.size(), -1,
                                        nullptr, 0, &nCompressedSize);
-    oBuffer.assign(static_cast<char *>(pCompressed), nCompressedSize);
+    OGRMVTTempTileRow oRow;
+    oRow.nZ = nZ;
+    oRow.nX = nTileX;
+    oRow.nY = nTileY;
+    oRow.nGeomType = static_cast<int>(poGPBFeature->getType());
+    oRow.dfAreaOrLength = dfAreaOrLength;
+    oRow.osFeature.assign(static_cast<char *>(pCompressed), nCompressedSize);
     CPLFree(pCompressed);
+    aoRows.emplace_back(std::move(oRow));
+
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                          InsertTempTiles()                           */
+/************************************************************************/
+
+OGRErr OGRMVTWriterDataset::InsertTempTiles(
+    const std::vector<OGRMVTTempTileRow> &aoRows, const CPLString &osTargetName,
+    GIntBig nSerial) const
+{
+    if (aoRows.empty())
+        return OGRERR_NONE;
 
     std::unique_ptr<std::lock_guard<std::mutex>> poLockGuard;
     if (m_bThreadPoolOK)
         poLockGuard = std::make_unique<std::lock_guard<std::mutex>>(m_oDBMutex);
 
-    m_nTempTiles++;
-    sqlite3_bind_int(m_hInsertStmt, 1, nZ);
-    sqlite3_bind_int(m_hInsertStmt, 2, nTileX);
-    sqlite3_bind_int(m_hInsertStmt, 3, nTileY);
-    sqlite3_bind_text(m_hInsertStmt, 4, osTargetName.c_str(), -1,
-                      SQLITE_STATIC);
-    sqlite3_bind_int64(m_hInsertStmt, 5, nSerial);
-    sqlite3_bind_blob(m_hInsertStmt, 6, oBuffer.data(),
-                      static_cast<int>(oBuffer.size()), SQLITE_STATIC);
-    sqlite3_bind_int(m_hInsertStmt, 7,
-                     static_cast<int>(poGPBFeature->getType()));
-    sqlite3_bind_double(m_hInsertStmt, 8, dfAreaOrLength);
-    int rc = sqlite3_step(m_hInsertStmt);
-    sqlite3_reset(m_hInsertStmt);
-
-    if (!(rc == SQLITE_OK || rc == SQLITE_DONE))
-    {
-        return OGRERR_FAILURE;
+    // Group all insertions in a single transaction, committed in
+    // CreateOutput(), rather than one implicit transaction per row.
+    if (!m_bTempDBInTransaction)
+    {
+        if (SQLCommand(m_hDB, "BEGIN") != OGRERR_NONE)
+            return OGRERR_FAILURE;
+        m_bTempDBInTransaction = true;
+    }
+
+    for (const auto &oRow : aoRows)
+    {
+        m_nTempTiles++;
+        sqlite3_bind_int(m_hInsertStmt, 1, oRow.nZ);
+        sqlite3_bind_int(m_hInsertStmt, 2, oRow.nX);
+        sqlite3_bind_int(m_hInsertStmt, 3, oRow.nY);
+        sqlite3_bind_text(m_hInsertStmt, 4, osTargetName.c_str(), -1,
+                          SQLITE_STATIC);
+        sqlite3_bind_int64(m_hInsertStmt, 5, nSerial);
+        sqlite3_bind_blob(m_hInsertStmt, 6, oRow.osFeature.data(),
+                          static_cast<int>(oRow.osFeature.size()),
+                          SQLITE_STATIC);
+        sqlite3_bind_int(m_hInsertStmt, 7, oRow.nGeomType);
+        sqlite3_bind_double(m_hInsertStmt, 8, oRow.dfAreaOrLength);
+        int rc = sqlite3_step(m_hInsertStmt);
+        sqlite3_reset(m_hInsertStmt);
+
+        if (!(rc == SQLITE_OK || rc == SQLITE_DONE))
+        {
+            return OGRERR_FAILURE;
+        }
     }
 
     return OGRERR_NONE;
 }
 
+/************************************************************************/
+/*                      PreGenerateForTilesReal()                       */
+/************************************************************************/
+
+OGRErr OGRMVTWriterDataset::PreGenerateForTilesReal(
+    const std::vector<OGRMVTTileCoord> &aoTiles, const CPLString &osTargetName,
+    int nMaxZoomForLayer, const OGRMVTFeatureContent *poFeatureContent,
+    GIntBig nSerial, const OGRGeometry *poGeom,
+    const OGREnvelope &sEnvelope) const
+{
+    std::vector<OGRMVTTempTileRow> aoRows;
+    for (const auto &oTile : aoTiles)
+    {
+        if (PreGenerateForTileReal(oTile[0], oTile[1], oTile[2],
+                                   oTile[0] == nMaxZoomForLayer,
+                                   poFeatureContent, poGeom, sEnvelope,
+                                   aoRows) != OGRERR_NONE)
+        {
+            return OGRERR_FAILURE;
+        }
+    }
+    return InsertTempTiles(aoRows, osTargetName, nSerial);
+}
+
 /************************************************************************/
 /*                           MVTWriterTask()                            */
 /************************************************************************/
@@ -4300,11 +4386,9 @@ class MVTWriterTask
 {
   public:
     const OGRMVTWriterDataset *poDS;
-    int nZ;
-    int nTileX;
-    int nTileY;
+    std::vector<OGRMVTTileCoord> aoTiles;
     CPLString osTargetName;
-    bool bIsMaxZoomForLayer;
+    int nMaxZoomForLayer;
     std::shared_ptr<OGRMVTFeatureContent> poFeatureContent;
     GIntBig nSerial;
     std::shared_ptr<OGRGeometry> poGeom;
@@ -4318,10 +4402,10 @@ class MVTWriterTask
 void OGRMVTWriterDataset::WriterTaskFunc(void *pParam)
 {
     MVTWriterTask *poTask = static_cast<MVTWriterTask *>(pParam);
-    OGRErr eErr = poTask->poDS->PreGenerateForTileReal(
-        poTask->nZ, poTask->nTileX, poTask->nTileY, poTask->osTargetName,
-        poTask->bIsMaxZoomForLayer, poTask->poFeatureContent.get(),
-        poTask->nSerial, poTask->poGeom.get(), poTask->sEnvelope);
+    OGRErr eErr = poTask->poDS->PreGenerateForTilesReal(
+        poTask->aoTiles, poTask->osTargetName, poTask->nMaxZoomForLayer,
+        poTask->poFeatureContent.get(), poTask->nSerial, poTask->poGeom.get(),
+        poTask->sEnvelope);
     if (eErr != OGRERR_NONE)
     {
         std::lock_guard oLock(poTask->poDS->m_oDBMutex);
@@ -4331,31 +4415,29 @@ void OGRMVTWriterDataset::WriterTaskFunc(void *pParam)
 }
 
 /************************************************************************/
-/*                         PreGenerateForTile()                         */
+/*                        PreGenerateForTiles()                         */
 /************************************************************************/
 
-OGRErr OGRMVTWriterDataset::PreGenerateForTile(
-    int nZ, int nTileX, int nTileY, const CPLString &osTargetName,
-    bool bIsMaxZoomForLayer,
+OGRErr OGRMVTWriterDataset::PreGenerateForTiles(
+    std::vector<OGRMVTTileCoord> &&aoTiles, const CPLString &osTargetName,
+    int nMaxZoomForLayer,
     const std::shared_ptr<OGRMVTFeatureContent> &poFeatureContent,
     GIntBig nSerial, const std::shared_ptr<OGRGeometry> &poGeom,
     const OGREnvelope &sEnvelope) const
 {
     if (!m_bThreadPoolOK)
     {
-        return PreGenerateForTileReal(
-            nZ, nTileX, nTileY, osTargetName, bIsMaxZoomForLayer,
-            poFeatureContent.get(), nSerial, poGeom.get(), sEnvelope);
+        return PreGenerateForTilesReal(
+            aoTiles, osTargetName, nMaxZoomForLayer, poFeatureContent.get(),
+            nSerial, poGeom.get(), sEnvelope);
     }
     else
     {
         MVTWriterTask *poTask = new MVTWriterTask;
         poTask->poDS = this;
-        poTask->nZ = nZ;
-        poTask->nTileX = nTileX;
-        poTask->nTileY = nTileY;
+        poTask->aoTiles = std::move(aoTiles);
         poTask->osTargetName = osTargetName;
-        poTask->bIsMaxZoomForLayer = bIsMaxZoomForLayer;
+        poTask->nMaxZoomForLayer = nMaxZoomForLayer;
         poTask->poFeatureContent = poFeatureContent;
         poTask->nSerial = nSerial;
         poTask->poGeom = poGeom;
@@ -5167,6 +5249,13 @@ bool OGRMVTWriterDataset::CreateOutput()
     if (m_bThreadPoolOK)
         m_oThreadPool.WaitCompletion();
 
+    if (m_bTempDBInTransaction)
+    {
+        m_bTempDBInTransaction = false;
+        if (SQLCommand(m_hDB, "COMMIT") != OGRERR_NONE)
+            return false;
+    }
+
     std::map<CPLString, MVTLayerProperties> oMapLayerProps;
     std::set<CPLString> oSetLayers;
 
@@ -5779,6 +5868,9 @@ OGRErr OGRMVTWriterDataset::WriteFeature(OGRMVTWriterLayer *poLayer,
             }
         }
 
+        // The tiles intersecting the feature, at all zoom levels, are
+        // processed by batches, each batch being a job for the thread pool.
+        std::vector<OGRMVTTileCoord> aoTiles;
         for (int nZ = poLayer->m_nMinZoom; nZ <= poLayer->m_nMaxZoom; nZ++)
         {
             double dfTileDim = m_dfTileDim0 / (1 << nZ);
@@ -5801,16 +5893,28 @@ OGRErr OGRMVTWriterDataset::WriteFeature(OGRMVTWriterLayer *poLayer,
             {
                 for (int iY = nTileMinY; iY <= nTileMaxY; iY++)
                 {
-                    if (PreGenerateForTile(
-                            nZ, iX, iY, poLayer->m_osTargetName,
-                            (nZ == poLayer->m_nMaxZoom), poFeatureContent,
-                            nSerial, poSharedGeom, sExtent) != OGRERR_NONE)
+                    aoTiles.push_back(OGRMVTTileCoord{nZ, iX, iY});
+                    if (aoTiles.size() == knMAX_TILES_PER_TASK)
                     {
-                        return OGRERR_FAILURE;
+                        if (PreGenerateForTiles(
+                                std::move(aoTiles), poLayer->m_osTargetName,
+                                poLayer->m_nMaxZoom, poFeatureContent, nSerial,
+                                poSharedGeom, sExtent) != OGRERR_NONE)
+                        {
+                            return OGRERR_FAILURE;
+                        }
+                        aoTiles.clear();
                     }
                 }
             }
         }
+        if (!aoTiles.empty() &&
+            PreGenerateForTiles(std::move(aoTiles), poLayer->m_osTargetName,
+                                poLayer->m_nMaxZoom, poFeatureContent, nSerial,
+                                poSharedGeom, sExtent) != OGRERR_NONE)
+        {
+            return OGRERR_FAILURE;
+        }
     }
 
     return OGRERR_NONE;
@@ -57,6 +57,7 @@ class OGRLayerAttrIndex;
 class OGRSFDriver;
 
 struct ArrowArrayStream;
+struct OGRArrowWriteColumn;
 
 /************************************************************************/
 /*                               OGRLayer                               */
@@ -181,6 +182,12 @@ class CPL_DLL OGRLayer : public GDALMajorObject
     bool CreateFieldFromArrowSchemaInternal(const struct ArrowSchema *schema,
                                             const std::string &osFieldPrefix,
                                             CSLConstList papszOptions);
+    bool GetArrowWriteColumns(const struct ArrowSchema *schema,
+                              struct ArrowArray *array,
+                              CSLConstList papszOptions,
+                              std::vector<OGRArrowWriteColumn> &aoFieldColumns,
+                              OGRArrowWriteColumn &oGeomColumn,
+                              OGRArrowWriteColumn &oFIDColumn);
     //! @endcond
 
   public:
@@ -216,6 +223,7 @@ class CPL_DLL OGRLayer : public GDALMajorObject
 
     virtual void ResetReading() = 0;
     virtual OGRFeature *GetNextFeature() CPL_WARN_UNUSED_RESULT = 0;
+    virtual bool GetNextFeatureInto(OGRFeature &oFeature);
     virtual OGRErr SetNextByIndex(GIntBig nIndex);
     virtual OGRFeature *GetFeature(GIntBig nFID) CPL_WARN_UNUSED_RESULT;
 
@@ -355,6 +363,15 @@ class CPL_DLL OGRLayer : public GDALMajorObject
         return m_poAttrIndex;
     }
 
+    void InitializeSidecarSpatialIndexSupport(const char *pszDataFilename);
+    bool HasSidecarSpatialIndexSupport() const;
+    OGRErr CreateSidecarSpatialIndex();
+    OGRErr DropSidecarSpatialIndex();
+
+    bool UseSidecarSpatialIndex();
+    bool GetNextSidecarSpatialIndexFID(GIntBig &nFID);
+    void ResetSidecarSpatialIndexReading();
+
     int GetGeomFieldFilter() const
     {
         return m_iGeomFieldFilter;
@@ -395,6 +412,10 @@ class CPL_DLL OGRLayer : public GDALMajorObject
                                   bool bFilterIsEnvelope,
                                   const OGREnvelope &sFilterEnvelope,
                                   OGRPreparedGeometry *&poPreparedFilterGeom);
+
+    size_t FilterWKBGeometryBatch(size_t nCount, const GByte *const *papabyWKB,
+                                  const size_t *panWKBSize,
+                                  std::vector<bool> &abResults) const;
     //! @endcond
 
     /** Field name used by GetArrowSchema() for a FID column when
@@ -312,6 +312,7 @@ class FileGDBIndexIterator final : public FileGDBIndexIteratorBase
 
     GUInt16 asUTF16Str[MAX_CAR_COUNT_INDEXED_STR];
     int nStrLen = 0;
+    int nCompareStrLen = 0;  // number of characters compared, <= nStrLen
     char szUUID[UUID_LEN_AS_STRING + 1];
 
     OGRField sMin{};
@@ -916,6 +917,8 @@ static const char *FileGDBSQLOpToStr(FileGDBSQLOp op)
             return ">=";
         case FGSO_GT:
             return ">";
+        case FGSO_STARTS_WITH:
+            return "STARTS WITH";
     }
     return "unknown_op";
 }
@@ -1007,6 +1010,8 @@ int FileGDBIndexIterator::SetConstraint(int nFieldIdx, FileGDBSQLOp op,
     eFieldType = poField->GetType();
     eOp = op;
 
+    returnErrorIf(eOp == FGSO_STARTS_WITH && eFieldType != FGFT_STRING);
+
     returnErrorIf(eFieldType != FGFT_INT16 && eFieldType != FGFT_INT32 &&
                   eFieldType != FGFT_FLOAT32 && eFieldType != FGFT_FLOAT64 &&
                   eFieldType != FGFT_STRING && eFieldType != FGFT_DATETIME &&
@@ -1065,6 +1070,7 @@ int FileGDBIndexIterator::SetConstraint(int nFieldIdx, FileGDBSQLOp op,
             returnErrorIf(m_nValueSize == 0);
             returnErrorIf(m_nValueSize > 2 * MAX_CAR_COUNT_INDEXED_STR);
             nStrLen = m_nValueSize / 2;
+            nCompareStrLen = nStrLen;
             if (eOp != FGSO_ISNOTNULL)
             {
                 returnErrorIf(eOGRFieldType != OFTString);
@@ -1074,10 +1080,19 @@ int FileGDBIndexIterator::SetConstraint(int nFieldIdx, FileGDBSQLOp op,
                 int nCount = 0;
                 while (pWide[nCount] != 0)
                 {
+                    if (nCount == nStrLen && eOp == FGSO_STARTS_WITH)
+                    {
+                        // The indexed values are truncated, so a truncated
+                        // prefix selects a super-set of the matching rows.
+                        break;
+                    }
                     returnErrorAndCleanupIf(nCount == nStrLen, CPLFree(pWide));
                     asUTF16Str[nCount] = pWide[nCount];
                     nCount++;
                 }
+                // Only compare the prefix, and not the space padding.
+                if (eOp == FGSO_STARTS_WITH)
+                    nCompareStrLen = nCount;
                 while (nCount < nStrLen)
                 {
                     asUTF16Str[nCount] = 32; /* space character */
@@ -1342,7 +1357,8 @@ bool FileGDBIndexIterator::FindPages(int iLevel, int nPage)
                                                               nStrLen) < 0);
                 memcpy(asLastMax, pasMax, nStrLen * 2);
 #endif
-                nComp = FileGDBUTF16StrCompare(asUTF16Str, pasMax, nStrLen);
+                nComp =
+                    FileGDBUTF16StrCompare(asUTF16Str, pasMax, nCompareStrLen);
                 break;
             }
 
@@ -1392,6 +1408,7 @@ bool FileGDBIndexIterator::FindPages(int iLevel, int nPage)
                 break;
 
             case FGSO_EQ:
+            case FGSO_STARTS_WITH:
                 if (iFirstPageIdx[iLevel] < 0)
                 {
                     if (nComp <= 0)
@@ -1691,7 +1708,8 @@ int FileGDBIndexIterator::GetNextRow()
                            nStrLen * 2);
                     for (int j = 0; j < nStrLen; j++)
                         CPL_LSBPTR16(&asVal[j]);
-                    nComp = FileGDBUTF16StrCompare(asUTF16Str, asVal, nStrLen);
+                    nComp = FileGDBUTF16StrCompare(asUTF16Str, asVal,
+                                                   nCompareStrLen);
                     break;
                 }
 
@@ -1743,6 +1761,7 @@ int FileGDBIndexIterator::GetNextRow()
                     break;
 
                 case FGSO_EQ:
+                case FGSO_STARTS_WITH:
                     if (nComp < 0 && bAscending)
                     {
                         bEOF = true;
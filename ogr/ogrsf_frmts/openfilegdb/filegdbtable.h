@@ -750,7 +750,8 @@ typedef enum
     FGSO_LE,
     FGSO_EQ,
     FGSO_GE,
-    FGSO_GT
+    FGSO_GT,
+    FGSO_STARTS_WITH /* string fields only */
 } FileGDBSQLOp;
 
 /************************************************************************/
@@ -1839,6 +1839,7 @@ OGRLayer *OGROpenFileGDBDataSource::ExecuteSQL(const char *pszSQLCommand,
          */
         if (oSelect.join_count == 0 && oSelect.poOtherSelect == nullptr &&
             oSelect.table_count == 1 && oSelect.order_specs == 0 &&
+            oSelect.group_specs == 0 &&
             oSelect.query_mode != SWQM_DISTINCT_LIST &&
             oSelect.where_expr == nullptr)
         {
@@ -1985,6 +1986,7 @@ OGRLayer *OGROpenFileGDBDataSource::ExecuteSQL(const char *pszSQLCommand,
          */
         if (oSelect.join_count == 0 && oSelect.poOtherSelect == nullptr &&
             oSelect.table_count == 1 && oSelect.order_specs == 1 &&
+            oSelect.group_specs == 0 &&
             oSelect.query_mode != SWQM_DISTINCT_LIST)
         {
             OGROpenFileGDBLayer *poLayer =
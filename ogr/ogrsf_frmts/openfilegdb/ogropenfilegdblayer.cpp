@@ -1265,6 +1265,32 @@ static swq_expr_node *GetConstantSubNode(swq_expr_node *poNode)
     return nullptr;
 }
 
+/***********************************************************************/
+/*                        GetLikePatternPrefix()                       */
+/***********************************************************************/
+
+/* Returns the literal characters of a LIKE pattern before its first */
+/* wildcard */
+static std::string GetLikePatternPrefix(const char *pszPattern, char chEscape)
+{
+    std::string osPrefix;
+    for (; *pszPattern != '\0'; ++pszPattern)
+    {
+        if (chEscape != '\0' && *pszPattern == chEscape)
+        {
+            ++pszPattern;
+            if (*pszPattern == '\0')
+                break;
+        }
+        else if (*pszPattern == '%' || *pszPattern == '_')
+        {
+            break;
+        }
+        osPrefix += *pszPattern;
+    }
+    return osPrefix;
+}
+
 /***********************************************************************/
 /*                     BuildIteratorFromExprNode()                     */
 /***********************************************************************/
@@ -1613,6 +1639,79 @@ OGROpenFileGDBLayer::BuildIteratorFromExprNode(swq_expr_node *poNode)
             }
         }
     }
+    else if (poNode->eNodeType == SNT_OPERATION &&
+             (poNode->nOperation == SWQ_LIKE ||
+              poNode->nOperation == SWQ_ILIKE) &&
+             (poNode->nSubExprCount == 2 || poNode->nSubExprCount == 3))
+    {
+        /* A pattern starting with literal characters selects a range of */
+        /* the index, that contains all the features matching it */
+        swq_expr_node *poColumn = poNode->papoSubExpr[0];
+        swq_expr_node *poPattern = poNode->papoSubExpr[1];
+        swq_expr_node *poEscape =
+            poNode->nSubExprCount == 3 ? poNode->papoSubExpr[2] : nullptr;
+        if (poColumn->eNodeType == SNT_COLUMN &&
+            poColumn->field_index < GetLayerDefn()->GetFieldCount() &&
+            poPattern->eNodeType == SNT_CONSTANT &&
+            poPattern->field_type == SWQ_STRING &&
+            poPattern->string_value != nullptr &&
+            (poEscape == nullptr || (poEscape->eNodeType == SNT_CONSTANT &&
+                                     poEscape->field_type == SWQ_STRING &&
+                                     poEscape->string_value != nullptr)))
+        {
+            OGRFieldDefn *poFieldDefn =
+                GetLayerDefn()->GetFieldDefn(poColumn->field_index);
+
+            int nTableColIdx =
+                m_poLyrTable->GetFieldIdx(poFieldDefn->GetNameRef());
+            auto poField =
+                nTableColIdx >= 0 ? m_poLyrTable->GetField(nTableColIdx)
+                                  : nullptr;
+            std::string osPrefix = GetLikePatternPrefix(
+                poPattern->string_value,
+                poEscape ? poEscape->string_value[0] : '\0');
+            if (poField && poField->HasIndex() &&
+                poField->GetType() == FGFT_STRING &&
+                poFieldDefn->GetType() == OFTString && !osPrefix.empty())
+            {
+                const bool bInsensitive =
+                    poNode->nOperation == SWQ_ILIKE ||
+                    CPLTestBool(
+                        CPLGetConfigOption("OGR_SQL_LIKE_AS_ILIKE", "FALSE"));
+                /* Indexes on LOWER(field) store values whose ASCII */
+                /* letters are lower-cased */
+                const bool bLowerIndex = STARTS_WITH_CI(
+                    poField->GetIndex()->GetExpression().c_str(), "LOWER(");
+                bool bCanUseIndex = true;
+                for (char &ch : osPrefix)
+                {
+                    const bool bIsASCIILetter =
+                        (ch >= 'A' && ch <= 'Z') || (ch >= 'a' && ch <= 'z');
+                    if ((bInsensitive || bLowerIndex) &&
+                        static_cast<unsigned char>(ch) > 127)
+                        bCanUseIndex = false;
+                    else if (bLowerIndex && ch >= 'A' && ch <= 'Z')
+                        ch = static_cast<char>(ch - 'A' + 'a');
+                    else if (bInsensitive && !bLowerIndex && bIsASCIILetter)
+                        bCanUseIndex = false;
+                }
+
+                OGRField sValue;
+                sValue.String = &osPrefix[0];
+                FileGDBIterator *poIter =
+                    bCanUseIndex ? FileGDBIterator::Build(
+                                       m_poLyrTable, nTableColIdx, TRUE,
+                                       FGSO_STARTS_WITH, OFTString, &sValue)
+                                 : nullptr;
+                if (poIter != nullptr)
+                {
+                    /* The rest of the pattern must still be evaluated */
+                    m_bIteratorSufficientToEvaluateFilter = FALSE;
+                    return poIter;
+                }
+            }
+        }
+    }
     else if (poNode->eNodeType == SNT_OPERATION &&
              poNode->nOperation == SWQ_NOT && poNode->nSubExprCount == 1)
     {
@@ -35,6 +35,7 @@
 
 #include "ogrsf_frmts.h"
 #include "cpl_string.h"
+#include "cpl_virtualmem.h"
 
 #include <array>
 #include <set>
@@ -512,6 +513,17 @@ class OGROSMDataSource final : public OGRDataSource
     std::map<int, Bucket> m_oMapBuckets{};
     Bucket *GetBucket(int nBucketId);
 
+    bool m_bDenseNodesIndex = false;
+    std::vector<LonLat> m_asDenseNodesBuffer{};
+    GIntBig m_nDenseNodesBufferFirstId = 0;
+    CPLVirtualMem *m_psDenseNodesMapping = nullptr;
+    vsi_l_offset m_nDenseNodesMappingSize = 0;
+    // Coordinates of the nodes of the ways of the current batch
+    std::vector<LonLat> m_asDenseWayCoords{};
+    std::vector<size_t> m_anDenseWayCoordsOffset{};
+    std::vector<unsigned int> m_anDenseWayCoordsCount{};
+    int m_nMaxThreads = 1;
+
     bool m_bNeedsToSaveWayInfo = false;
 
     static const GIntBig FILESIZE_NOT_INIT = -2;
@@ -538,6 +550,11 @@ class OGROSMDataSource final : public OGRDataSource
     bool FlushCurrentSectorCompressedCase();
     bool FlushCurrentSectorNonCompressedCase();
     bool IndexPointCustom(OSMNode *psNode);
+    bool IndexPointDense(OSMNode *psNode);
+    bool FlushDenseNodesBuffer();
+    bool MapDenseNodes();
+    bool GetDenseNode(GIntBig nID, LonLat &sLonLat) const;
+    void ResolveWaysNodesDense();
 
     void IndexWay(GIntBig nWayID, bool bIsArea, unsigned int nTags,
                   IndexedKVP *pasTags, LonLat *pasLonLatPairs, int nPairs,
@@ -556,6 +573,7 @@ class OGROSMDataSource final : public OGRDataSource
     void LookupNodesCustom();
     void LookupNodesCustomCompressedCase();
     void LookupNodesCustomNonCompressedCase();
+    void LookupNodesDense();
 
     unsigned int
     LookupWays(std::map<GIntBig, std::pair<int, void *>> &aoMapWays,
@@ -55,7 +55,10 @@
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_time.h"
+#include "cpl_virtualmem.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
@@ -98,6 +101,14 @@ static bool VALID_ID_FOR_CUSTOM_INDEXING(GIntBig _id)
     return _id >= 0 && _id / NODE_PER_BUCKET < INT_MAX;
 }
 
+// The dense nodes file is limited to 64 TB, which is below the maximum
+// size of a memory mapping on 64-bit Linux.
+constexpr GIntBig DENSE_NODES_MAX_ID = (static_cast<GIntBig>(1) << 43) - 1;
+// Maximum number of missing nodes between two consecutive nodes that are
+// written as "no node" entries rather than with a seek.
+constexpr GIntBig DENSE_NODES_MAX_GAP = 512;
+constexpr size_t DENSE_NODES_BUFFER_SIZE = 65536;
+
 // Minimum size of data written on disk, in *uncompressed* case.
 constexpr int SECTOR_SIZE = 512;
 // Which represents, 64 nodes
@@ -313,6 +324,8 @@ OGROSMDataSource::~OGROSMDataSource()
         }
     }
 
+    if (m_psDenseNodesMapping)
+        CPLVirtualMemFree(m_psDenseNodesMapping);
     if (m_fpNodes)
         VSIFCloseL(m_fpNodes);
     if (!m_osNodesFilename.empty() && m_bMustUnlinkNodesFile)
@@ -419,6 +432,8 @@ bool OGROSMDataSource::IndexPoint(OSMNode *psNode)
     if (!m_bIndexPoints)
         return true;
 
+    if (m_bDenseNodesIndex)
+        return IndexPointDense(psNode);
     if (m_bCustomIndexing)
         return IndexPointCustom(psNode);
 
@@ -722,6 +737,155 @@ bool OGROSMDataSource::IndexPointCustom(OSMNode *psNode)
     return true;
 }
 
+/************************************************************************/
+/*                          IndexPointDense()                           */
+/*                                                                      */
+/*      The dense index stores the coordinates of node N at offset      */
+/*      N * sizeof(LonLat) of the nodes file, relying on the file       */
+/*      system to not allocate the holes, and it is memory-mapped for   */
+/*      lookups. Runs of consecutive node ids are buffered to limit     */
+/*      the number of seeks.                                            */
+/************************************************************************/
+
+bool OGROSMDataSource::IndexPointDense(OSMNode *psNode)
+{
+    if (psNode->nID <= m_nPrevNodeId)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Non increasing node id. Use OSM_USE_CUSTOM_INDEXING=NO");
+        m_bStopParsing = true;
+        return false;
+    }
+    if (psNode->nID < 0 || psNode->nID > DENSE_NODES_MAX_ID)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Unsupported node id value (" CPL_FRMT_GIB
+                 "). Use OSM_DENSE_NODES_INDEX=NO",
+                 psNode->nID);
+        m_bStopParsing = true;
+        return false;
+    }
+
+    if (!m_asDenseNodesBuffer.empty())
+    {
+        const GIntBig nNextId =
+            m_nDenseNodesBufferFirstId +
+            static_cast<GIntBig>(m_asDenseNodesBuffer.size());
+        if (psNode->nID - nNextId <= DENSE_NODES_MAX_GAP &&
+            m_asDenseNodesBuffer.size() < DENSE_NODES_BUFFER_SIZE)
+        {
+            // Fill the small gaps with "no node" entries
+            m_asDenseNodesBuffer.resize(
+                m_asDenseNodesBuffer.size() +
+                    static_cast<size_t>(psNode->nID - nNextId),
+                LonLat{0, 0});
+        }
+        else if (!FlushDenseNodesBuffer())
+        {
+            m_bStopParsing = true;
+            return false;
+        }
+    }
+    if (m_asDenseNodesBuffer.empty())
+        m_nDenseNodesBufferFirstId = psNode->nID;
+
+    LonLat sLonLat;
+    sLonLat.nLon = DBL_TO_INT(psNode->dfLon);
+    sLonLat.nLat = DBL_TO_INT(psNode->dfLat);
+    m_asDenseNodesBuffer.push_back(sLonLat);
+
+    m_nPrevNodeId = psNode->nID;
+
+    return true;
+}
+
+/************************************************************************/
+/*                        FlushDenseNodesBuffer()                       */
+/************************************************************************/
+
+bool OGROSMDataSource::FlushDenseNodesBuffer()
+{
+    if (m_asDenseNodesBuffer.empty())
+        return true;
+
+    const size_t nCount = m_asDenseNodesBuffer.size();
+    if (VSIFSeekL(m_fpNodes,
+                  static_cast<vsi_l_offset>(m_nDenseNodesBufferFirstId) *
+                      sizeof(LonLat),
+                  SEEK_SET) != 0 ||
+        VSIFWriteL(m_asDenseNodesBuffer.data(), sizeof(LonLat), nCount,
+                   m_fpNodes) != nCount)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Cannot write in temporary node file %s : %s",
+                 m_osNodesFilename.c_str(), VSIStrerror(errno));
+        return false;
+    }
+    m_asDenseNodesBuffer.clear();
+    return true;
+}
+
+/************************************************************************/
+/*                          MapDenseNodes()                             */
+/*                                                                      */
+/*      Make sure that all indexed nodes are visible through the        */
+/*      memory mapping of the nodes file.                               */
+/************************************************************************/
+
+bool OGROSMDataSource::MapDenseNodes()
+{
+    if (!FlushDenseNodesBuffer() || VSIFFlushL(m_fpNodes) != 0 ||
+        VSIFSeekL(m_fpNodes, 0, SEEK_END) != 0)
+    {
+        m_bStopParsing = true;
+        return false;
+    }
+
+    const vsi_l_offset nFileSize = VSIFTellL(m_fpNodes);
+    if (m_psDenseNodesMapping && nFileSize == m_nDenseNodesMappingSize)
+        return true;
+    if (m_psDenseNodesMapping)
+    {
+        CPLVirtualMemFree(m_psDenseNodesMapping);
+        m_psDenseNodesMapping = nullptr;
+        m_nDenseNodesMappingSize = 0;
+    }
+    if (nFileSize == 0)
+        return true;
+
+    m_psDenseNodesMapping = CPLVirtualMemFileMapNew(
+        m_fpNodes, 0, nFileSize, VIRTUALMEM_READONLY, nullptr, nullptr);
+    if (m_psDenseNodesMapping == nullptr)
+    {
+        m_bStopParsing = true;
+        return false;
+    }
+    // Node lookups are scattered, and read-ahead would mostly read holes
+    CPLVirtualMemAdviseRandomAccess(m_psDenseNodesMapping);
+    m_nDenseNodesMappingSize = nFileSize;
+    return true;
+}
+
+/************************************************************************/
+/*                          GetDenseNode()                              */
+/*                                                                      */
+/*      Can be called from several threads once MapDenseNodes() has     */
+/*      succeeded.                                                      */
+/************************************************************************/
+
+bool OGROSMDataSource::GetDenseNode(GIntBig nID, LonLat &sLonLat) const
+{
+    if (nID < 0 || static_cast<GUIntBig>(nID) >= m_nDenseNodesMappingSize /
+                                                     sizeof(LonLat))
+        return false;
+    const GByte *pabyMapping = static_cast<const GByte *>(
+        CPLVirtualMemGetAddr(m_psDenseNodesMapping));
+    memcpy(&sLonLat,
+           pabyMapping + static_cast<size_t>(nID) * sizeof(LonLat),
+           sizeof(LonLat));
+    return sLonLat.nLon != 0 || sLonLat.nLat != 0;
+}
+
 /************************************************************************/
 /*                             NotifyNodes()                            */
 /************************************************************************/
@@ -802,7 +966,9 @@ static void OGROSMNotifyNodes(unsigned int nNodes, OSMNode *pasNodes,
 
 void OGROSMDataSource::LookupNodes()
 {
-    if (m_bCustomIndexing)
+    if (m_bDenseNodesIndex)
+        LookupNodesDense();
+    else if (m_bCustomIndexing)
         LookupNodesCustom();
     else
         LookupNodesSQLite();
@@ -1298,6 +1464,33 @@ void OGROSMDataSource::LookupNodesCustomNonCompressedCase()
     m_nReqIds = j;
 }
 
+/************************************************************************/
+/*                          LookupNodesDense()                          */
+/************************************************************************/
+
+void OGROSMDataSource::LookupNodesDense()
+{
+    m_nReqIds = 0;
+    if (!MapDenseNodes())
+        return;
+
+    for (unsigned int i = 0; i < m_nUnsortedReqIds; i++)
+        m_panReqIds[m_nReqIds++] = m_panUnsortedReqIds[i];
+
+    std::sort(m_panReqIds, m_panReqIds + m_nReqIds);
+
+    /* Remove duplicates and nodes that are not indexed */
+    unsigned int j = 0;
+    for (unsigned int i = 0; i < m_nReqIds; i++)
+    {
+        if (i > 0 && m_panReqIds[i] == m_panReqIds[i - 1])
+            continue;
+        if (GetDenseNode(m_panReqIds[i], m_pasLonLatArray[j]))
+            m_panReqIds[j++] = m_panReqIds[i];
+    }
+    m_nReqIds = j;
+}
+
 /************************************************************************/
 /*                            WriteVarInt()                             */
 /************************************************************************/
@@ -1616,6 +1809,97 @@ int OGROSMDataSource::FindNode(GIntBig nID)
     return -1;
 }
 
+/************************************************************************/
+/*                        ResolveWaysNodesDense()                       */
+/*                                                                      */
+/*      Fetch the coordinates of the nodes of all the ways of the       */
+/*      current batch from the dense index. Each way gets a slot in     */
+/*      m_asDenseWayCoords, so that ways can be spread over several     */
+/*      threads, which hides the latency of page faults on large        */
+/*      files.                                                          */
+/************************************************************************/
+
+void OGROSMDataSource::ResolveWaysNodesDense()
+{
+    m_anDenseWayCoordsOffset.resize(m_nWayFeaturePairs);
+    m_anDenseWayCoordsCount.assign(m_nWayFeaturePairs, 0);
+    size_t nTotalRefs = 0;
+    for (int iPair = 0; iPair < m_nWayFeaturePairs; iPair++)
+    {
+        m_anDenseWayCoordsOffset[iPair] = nTotalRefs;
+        nTotalRefs += m_pasWayFeaturePairs[iPair].nRefs;
+    }
+    m_asDenseWayCoords.resize(nTotalRefs);
+
+    if (!MapDenseNodes())
+        return;
+
+    struct JobStruct
+    {
+        OGROSMDataSource *poDS = nullptr;
+        int iFirstPair = 0;
+        int iLastPair = 0;
+    };
+
+    const auto ResolveWays = [](void *pData)
+    {
+        const JobStruct *psJob = static_cast<const JobStruct *>(pData);
+        OGROSMDataSource *poDS = psJob->poDS;
+        for (int iPair = psJob->iFirstPair; iPair < psJob->iLastPair; iPair++)
+        {
+            const WayFeaturePair *psWayFeaturePairs =
+                &poDS->m_pasWayFeaturePairs[iPair];
+            LonLat *pasCoords = poDS->m_asDenseWayCoords.data() +
+                                poDS->m_anDenseWayCoordsOffset[iPair];
+            unsigned int nCount = 0;
+            for (unsigned int i = 0; i < psWayFeaturePairs->nRefs; i++)
+            {
+                if (poDS->GetDenseNode(psWayFeaturePairs->panNodeRefs[i],
+                                       pasCoords[nCount]))
+                    nCount++;
+            }
+            poDS->m_anDenseWayCoordsCount[iPair] = nCount;
+        }
+    };
+
+    // Only worth it if there is enough work to share
+    constexpr size_t MIN_REFS_PER_JOB = 100 * 1000;
+    const int nThreads = static_cast<int>(std::min<size_t>(
+        m_nMaxThreads, std::max<size_t>(1, nTotalRefs / MIN_REFS_PER_JOB)));
+    CPLWorkerThreadPool *poPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poQueue = poPool ? poPool->CreateJobQueue() : nullptr;
+    if (!poQueue)
+    {
+        JobStruct sJob;
+        sJob.poDS = this;
+        sJob.iLastPair = m_nWayFeaturePairs;
+        ResolveWays(&sJob);
+        return;
+    }
+
+    // Split the ways in jobs with approximately the same number of nodes
+    std::vector<JobStruct> asJobs(nThreads);
+    const size_t nRefsPerJob = (nTotalRefs + nThreads - 1) / nThreads;
+    int iPair = 0;
+    for (int iJob = 0; iJob < nThreads; iJob++)
+    {
+        asJobs[iJob].poDS = this;
+        asJobs[iJob].iFirstPair = iPair;
+        const size_t nRefsLimit =
+            std::min(nTotalRefs, (iJob + 1) * nRefsPerJob);
+        while (iPair < m_nWayFeaturePairs &&
+               m_anDenseWayCoordsOffset[iPair] < nRefsLimit)
+            iPair++;
+        if (iJob == nThreads - 1)
+            iPair = m_nWayFeaturePairs;
+        asJobs[iJob].iLastPair = iPair;
+        if (!poQueue->SubmitJob(ResolveWays, &asJobs[iJob]))
+            ResolveWays(&asJobs[iJob]);
+    }
+    poQueue->WaitCompletion();
+}
+
 /************************************************************************/
 /*                         ProcessWaysBatch()                           */
 /************************************************************************/
@@ -1626,7 +1910,10 @@ void OGROSMDataSource::ProcessWaysBatch()
         return;
 
     // printf("nodes = %d, features = %d\n", nUnsortedReqIds, nWayFeaturePairs);
-    LookupNodes();
+    if (m_bDenseNodesIndex)
+        ResolveWaysNodesDense();
+    else
+        LookupNodes();
 
     for (int iPair = 0; iPair < m_nWayFeaturePairs; iPair++)
     {
@@ -1635,8 +1922,15 @@ void OGROSMDataSource::ProcessWaysBatch()
         const bool bIsArea = psWayFeaturePairs->bIsArea;
         m_asLonLatCache.clear();
 
+        if (m_bDenseNodesIndex)
+        {
+            const LonLat *pasFirst =
+                m_asDenseWayCoords.data() + m_anDenseWayCoordsOffset[iPair];
+            m_asLonLatCache.assign(pasFirst,
+                                   pasFirst + m_anDenseWayCoordsCount[iPair]);
+        }
 #ifdef ENABLE_NODE_LOOKUP_BY_HASHING
-        if (m_bHashedIndexValid)
+        else if (m_bHashedIndexValid)
         {
             for (unsigned int i = 0; i < psWayFeaturePairs->nRefs; i++)
             {
@@ -1671,8 +1965,8 @@ void OGROSMDataSource::ProcessWaysBatch()
                 }
             }
         }
-        else
 #endif  // ENABLE_NODE_LOOKUP_BY_HASHING
+        else
         {
             int nIdx = -1;
             for (unsigned int i = 0; i < psWayFeaturePairs->nRefs; i++)
@@ -2777,6 +3071,33 @@ int OGROSMDataSource::Open(const char *pszFilename, char **papszOpenOptionsIn)
                              CPLGetConfigOption("OSM_COMPRESS_NODES", "NO")));
     if (m_bCompressNodes)
         CPLDebug("OSM", "Using compression for nodes DB");
+    m_bDenseNodesIndex =
+        m_bCustomIndexing &&
+        CPLTestBool(CSLFetchNameValueDef(
+            papszOpenOptionsIn, "DENSE_NODES_INDEX",
+            CPLGetConfigOption("OSM_DENSE_NODES_INDEX", "NO")));
+    if (m_bDenseNodesIndex)
+    {
+        if (sizeof(void *) < 8 || !CPLIsVirtualMemFileMapAvailable())
+        {
+            CPLDebug("OSM", "Dense index for nodes not available on this "
+                            "platform");
+            m_bDenseNodesIndex = false;
+        }
+        else
+        {
+            CPLDebug("OSM", "Using dense index for nodes");
+        }
+    }
+    {
+        const char *pszNumThreads =
+            CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS");
+        const int nThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                                 ? CPLGetNumCPUs()
+                                 : atoi(pszNumThreads);
+        m_nMaxThreads =
+            std::max(1, GDALCapThreadCount(std::min(nThreads, 128)));
+    }
 
     m_nLayers = 5;
     m_papoLayers = static_cast<OGROSMLayer **>(
@@ -2891,7 +3212,35 @@ int OGROSMDataSource::Open(const char *pszFilename, char **papszOpenOptionsIn)
         nSize = static_cast<GIntBig>(m_nMaxSizeForInMemoryDBInMB) * 1024 * 1024;
     }
 
-    if (m_bCustomIndexing)
+    if (m_bDenseNodesIndex)
+    {
+        // Needed by MyResetReading()
+        m_pabySector = static_cast<GByte *>(VSI_CALLOC_VERBOSE(1, SECTOR_SIZE));
+        if (m_pabySector == nullptr)
+        {
+            return FALSE;
+        }
+
+        // The dense index relies on sparse files and memory mapping, so it
+        // cannot go through /vsimem/
+        m_osNodesFilename = CPLGenerateTempFilename("osm_tmp_nodes");
+        m_fpNodes = VSIFOpenL(m_osNodesFilename, "wb+");
+        if (m_fpNodes == nullptr)
+        {
+            return FALSE;
+        }
+
+        /* On Unix filesystems, you can remove a file even if it */
+        /* opened */
+        const char *pszVal = CPLGetConfigOption("OSM_UNLINK_TMPFILE", "YES");
+        if (EQUAL(pszVal, "YES"))
+        {
+            CPLPushErrorHandler(CPLQuietErrorHandler);
+            m_bMustUnlinkNodesFile = VSIUnlink(m_osNodesFilename) != 0;
+            CPLPopErrorHandler();
+        }
+    }
+    else if (m_bCustomIndexing)
     {
         m_pabySector = static_cast<GByte *>(VSI_CALLOC_VERBOSE(1, SECTOR_SIZE));
 
@@ -3853,6 +4202,14 @@ int OGROSMDataSource::MyResetReading()
         m_nBucketOld = -1;
         m_nOffInBucketReducedOld = -1;
 
+        if (m_psDenseNodesMapping)
+        {
+            CPLVirtualMemFree(m_psDenseNodesMapping);
+            m_psDenseNodesMapping = nullptr;
+            m_nDenseNodesMappingSize = 0;
+        }
+        m_asDenseNodesBuffer.clear();
+
         VSIFSeekL(m_fpNodes, 0, SEEK_SET);
         VSIFTruncateL(m_fpNodes, 0);
         m_nNodesFileSize = 0;
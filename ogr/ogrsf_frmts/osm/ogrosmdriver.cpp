@@ -125,6 +125,9 @@ void RegisterOGROSM()
         "description='Whether to enable custom indexing.' default='YES'/>"
         "  <Option name='COMPRESS_NODES' type='boolean' description='Whether "
         "to compress nodes in temporary DB.' default='NO'/>"
+        "  <Option name='DENSE_NODES_INDEX' type='boolean' "
+        "description='Whether to use a memory-mapped dense index for nodes.' "
+        "default='NO'/>"
         "  <Option name='MAX_TMPFILE_SIZE' type='int' description='Maximum "
         "size in MB of in-memory temporary file. If it exceeds that value, it "
         "will go to disk' default='100'/>"
@@ -59,6 +59,11 @@
 #include "parquet/arrow/writer.h"
 #include "parquet/arrow/schema.h"
 
+#if PARQUET_VERSION_MAJOR >= 12
+#include "parquet/bloom_filter.h"
+#include "parquet/bloom_filter_reader.h"
+#endif
+
 #ifdef GDAL_USE_ARROWDATASET
 #include "arrow/filesystem/filesystem.h"
 #include "arrow/compute/api_scalar.h"
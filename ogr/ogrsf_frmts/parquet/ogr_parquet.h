@@ -32,6 +32,7 @@
 #include "ogrsf_frmts.h"
 
 #include "cpl_json.h"
+#include "cpl_worker_thread_pool.h"
 
 #include <functional>
 #include <map>
@@ -59,8 +60,6 @@ class OGRParquetLayerBase CPL_NON_FINAL : public OGRArrowLayer
     CPLStringList m_aosGeomPossibleNames{};
     std::string m_osCRS{};
 
-    static int GetNumCPUs();
-
     void LoadGeoMetadata(
         const std::shared_ptr<const arrow::KeyValueMetadata> &kv_metadata);
     bool DealWithGeometryColumn(
@@ -82,6 +81,8 @@ class OGRParquetLayerBase CPL_NON_FINAL : public OGRArrowLayer
     void ResetReading() override;
 
     GDALDataset *GetDataset() override;
+
+    static int GetNumCPUs();
 };
 
 /************************************************************************/
@@ -134,6 +135,8 @@ class OGRParquetLayer final : public OGRParquetLayerBase
     bool CreateRecordBatchReader(int iStartingRowGroup);
     bool CreateRecordBatchReader(const std::vector<int> &anRowGroups);
     bool ReadNextBatch() override;
+    bool IsConstraintExcludedByBloomFilter(
+        int iRowGroup, const OGRArrowLayer::Constraint &constraint) const;
 
     void InvalidateCachedBatches() override;
 
@@ -334,12 +337,27 @@ class OGRParquetWriterLayer final : public OGRArrowWriterLayer
     bool m_bEdgesSpherical = false;
     parquet::WriterProperties::Builder m_oWriterPropertiesBuilder{};
 
-    //! Temporary GeoPackage dataset. Only used in SORT_BY_BBOX mode
+    //! Temporary GeoPackage dataset. Only used in SORT_BY_BBOX/HILBERT mode
     std::unique_ptr<GDALDataset> m_poTmpGPKG{};
-    //! Temporary GeoPackage layer. Only used in SORT_BY_BBOX mode
+    //! Temporary GeoPackage layer. Only used in SORT_BY_BBOX/HILBERT mode
     OGRLayer *m_poTmpGPKGLayer = nullptr;
-    //! Number of features written by ICreateFeature(). Only used in SORT_BY_BBOX mode
+    //! Number of features written by ICreateFeature().
+    //! Only used in SORT_BY_BBOX/HILBERT mode
     GIntBig m_nTmpFeatureCount = 0;
+    //! Whether features are sorted along a Hilbert curve
+    bool m_bSortByHilbert = false;
+    //! Extent of features written by ICreateFeature(). SORT_BY_HILBERT mode
+    OGREnvelope m_sTmpExtent{};
+
+    //! Whether column chunks are encoded in parallel, and row groups
+    //! written by a worker thread while the next one is being filled
+    bool m_bUseThreads = false;
+    //! Job queue for the row group being written in the background
+    std::unique_ptr<CPLJobQueue> m_poWriteJobQueue{};
+    //! Record batch being written by the background job
+    std::shared_ptr<arrow::RecordBatch> m_poPendingBatch{};
+    //! Error message of the background job, if it failed
+    std::string m_osPendingWriteError{};
 
     virtual bool IsFileWriterCreated() const override
     {
@@ -375,6 +393,10 @@ class OGRParquetWriterLayer final : public OGRArrowWriterLayer
 
     //! Copy temporary GeoPackage layer to final Parquet file
     bool CopyTmpGpkgLayerToFinalFile();
+    bool CopyTmpGpkgLayerInHilbertOrder(OGRFeature &oFeat);
+
+    static void WriteRecordBatchJob(void *pData);
+    bool WaitPendingWrite();
 
   public:
     OGRParquetWriterLayer(
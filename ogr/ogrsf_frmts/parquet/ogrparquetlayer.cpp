@@ -1435,6 +1435,103 @@ void OGRParquetLayer::IncrFeatureIdx()
     }
 }
 
+/************************************************************************/
+/*                  IsConstraintExcludedByBloomFilter()                 */
+/************************************************************************/
+
+//! Returns true if the bloom filter of the column of the constraint proves
+// that the value of an equality constraint is absent from the row group.
+bool OGRParquetLayer::IsConstraintExcludedByBloomFilter(
+    [[maybe_unused]] int iRowGroup,
+    [[maybe_unused]] const OGRArrowLayer::Constraint &constraint) const
+{
+#if PARQUET_VERSION_MAJOR >= 12
+    if (constraint.nOperation != SWQ_EQ)
+        return false;
+
+    const int iCol =
+        constraint.iField == m_poFeatureDefn->GetFieldCount() + SPF_FID
+            ? m_iFIDParquetColumn
+            : GetMapFieldIndexToParquetColumn()[constraint.iField];
+    if (iCol < 0)
+        return false;
+
+    // Bloom filters hash the IEEE representation of doubles, so -0 and +0
+    // would be considered as different.
+    if (constraint.eType == OGRArrowLayer::Constraint::Type::Real &&
+        constraint.sValue.Real == 0)
+    {
+        return false;
+    }
+
+    try
+    {
+        const auto metadata = m_poArrowReader->parquet_reader()->metadata();
+        const auto physicalType =
+            metadata->schema()->Column(iCol)->physical_type();
+        const bool bCompatibleType =
+            (constraint.eType == OGRArrowLayer::Constraint::Type::Integer &&
+             physicalType == parquet::Type::INT32) ||
+            (constraint.eType == OGRArrowLayer::Constraint::Type::Integer64 &&
+             physicalType == parquet::Type::INT64) ||
+            (constraint.eType == OGRArrowLayer::Constraint::Type::Real &&
+             physicalType == parquet::Type::DOUBLE) ||
+            (constraint.eType == OGRArrowLayer::Constraint::Type::String &&
+             physicalType == parquet::Type::BYTE_ARRAY);
+        if (!bCompatibleType)
+            return false;
+
+        auto &bloomFilterReader =
+            m_poArrowReader->parquet_reader()->GetBloomFilterReader();
+        const auto rowGroupBloomFilterReader =
+            bloomFilterReader.RowGroup(iRowGroup);
+        if (!rowGroupBloomFilterReader)
+            return false;
+        const auto bloomFilter =
+            rowGroupBloomFilterReader->GetColumnBloomFilter(iCol);
+        if (!bloomFilter)
+            return false;
+
+        uint64_t nHash = 0;
+        switch (constraint.eType)
+        {
+            case OGRArrowLayer::Constraint::Type::Integer:
+                nHash = bloomFilter->Hash(
+                    static_cast<int32_t>(constraint.sValue.Integer));
+                break;
+            case OGRArrowLayer::Constraint::Type::Integer64:
+                nHash = bloomFilter->Hash(
+                    static_cast<int64_t>(constraint.sValue.Integer64));
+                break;
+            case OGRArrowLayer::Constraint::Type::Real:
+                nHash = bloomFilter->Hash(constraint.sValue.Real);
+                break;
+            case OGRArrowLayer::Constraint::Type::String:
+            {
+                const parquet::ByteArray value(
+                    static_cast<uint32_t>(constraint.osValue.size()),
+                    reinterpret_cast<const uint8_t *>(
+                        constraint.osValue.data()));
+                nHash = bloomFilter->Hash(&value);
+                break;
+            }
+        }
+        if (!bloomFilter->FindHash(nHash))
+        {
+            CPLDebugOnly("PARQUET",
+                         "Row group %d excluded by bloom filter of column %d",
+                         iRowGroup, iCol);
+            return true;
+        }
+    }
+    catch (const std::exception &e)
+    {
+        CPLDebug("PARQUET", "Cannot read bloom filter: %s", e.what());
+    }
+#endif
+    return false;
+}
+
 /************************************************************************/
 /*                           ReadNextBatch()                            */
 /************************************************************************/
@@ -1477,7 +1574,8 @@ bool OGRParquetLayer::ReadNextBatch()
                  2 &&
              OGRArrowIsGeoArrowStruct(m_aeGeomEncoding[m_iGeomFieldFilter]));
 
-        if (m_asAttributeFilterConstraints.empty() && !bUSEBBOXFields &&
+        if (m_asAttributeFilterConstraints.empty() &&
+            m_aasAttributeFilterOrConstraints.empty() && !bUSEBBOXFields &&
             !(bIsGeoArrowStruct && m_poFilterGeom))
         {
             bIterateEverything = true;
@@ -1538,6 +1636,190 @@ bool OGRParquetLayer::ReadNextBatch()
                 iYMaxField = oIterToGeomColBBOX->second.iParquetYMax;
             }
 
+            const auto IsConstraintPossibleFromStats =
+                [this, &sMin, &sMax, &bFoundMin, &bFoundMax, &eType, &eSubType,
+                 &osMinTmp,
+                 &osMaxTmp](const Constraint &constraint, int iRowGroup,
+                            const parquet::RowGroupReader *poRowGroup,
+                            int64_t nFeatureIdxTotal)
+            {
+                int iOGRField = constraint.iField;
+                if (constraint.iField ==
+                    m_poFeatureDefn->GetFieldCount() + SPF_FID)
+                {
+                    iOGRField = OGR_FID_INDEX;
+                }
+                if (constraint.nOperation != SWQ_ISNULL &&
+                    constraint.nOperation != SWQ_ISNOTNULL)
+                {
+                    if (iOGRField == OGR_FID_INDEX &&
+                        m_iFIDParquetColumn < 0)
+                    {
+                        sMin.Integer64 = nFeatureIdxTotal;
+                        sMax.Integer64 =
+                            nFeatureIdxTotal +
+                            poRowGroup->metadata()->num_rows() - 1;
+                        eType = OFTInteger64;
+                    }
+                    else if (!GetMinMaxForOGRField(
+                                 iRowGroup, iOGRField, true, sMin,
+                                 bFoundMin, true, sMax, bFoundMax,
+                                 eType, eSubType, osMinTmp, osMaxTmp) ||
+                             !bFoundMin || !bFoundMax)
+                    {
+                        return IsConstraintPossibleRes::UNKNOWN;
+                    }
+                }
+
+                IsConstraintPossibleRes res =
+                    IsConstraintPossibleRes::UNKNOWN;
+                if (constraint.eType ==
+                        OGRArrowLayer::Constraint::Type::Integer &&
+                    eType == OFTInteger)
+                {
+#if 0
+                    CPLDebug("PARQUET",
+                             "Group %d, field %s, min = %d, max = %d",
+                             iRowGroup,
+                             iOGRField == OGR_FID_INDEX
+                                 ? m_osFIDColumn.c_str()
+                                 : m_poFeatureDefn->GetFieldDefn(iOGRField)
+                                       ->GetNameRef(),
+                             sMin.Integer, sMax.Integer);
+#endif
+                    res = IsConstraintPossible(
+                        constraint.nOperation,
+                        constraint.sValue.Integer, sMin.Integer,
+                        sMax.Integer);
+                }
+                else if (constraint.eType == OGRArrowLayer::Constraint::
+                                                 Type::Integer64 &&
+                         eType == OFTInteger64)
+                {
+#if 0
+                    CPLDebug("PARQUET",
+                             "Group %d, field %s, min = " CPL_FRMT_GIB
+                             ", max = " CPL_FRMT_GIB,
+                             iRowGroup,
+                             iOGRField == OGR_FID_INDEX
+                                 ? m_osFIDColumn.c_str()
+                                 : m_poFeatureDefn->GetFieldDefn(iOGRField)
+                                       ->GetNameRef(),
+                             static_cast<GIntBig>(sMin.Integer64),
+                             static_cast<GIntBig>(sMax.Integer64));
+#endif
+                    res = IsConstraintPossible(
+                        constraint.nOperation,
+                        constraint.sValue.Integer64, sMin.Integer64,
+                        sMax.Integer64);
+                }
+                else if (constraint.eType ==
+                             OGRArrowLayer::Constraint::Type::Real &&
+                         eType == OFTReal)
+                {
+#if 0
+                    CPLDebug("PARQUET",
+                             "Group %d, field %s, min = %g, max = %g",
+                             iRowGroup,
+                             iOGRField == OGR_FID_INDEX
+                                 ? m_osFIDColumn.c_str()
+                                 : m_poFeatureDefn->GetFieldDefn(iOGRField)
+                                       ->GetNameRef(),
+                             sMin.Real, sMax.Real);
+#endif
+                    res = IsConstraintPossible(constraint.nOperation,
+                                               constraint.sValue.Real,
+                                               sMin.Real, sMax.Real);
+                }
+                else if (constraint.eType ==
+                             OGRArrowLayer::Constraint::Type::String &&
+                         eType == OFTString)
+                {
+#if 0
+                    CPLDebug("PARQUET",
+                             "Group %d, field %s, min = %s, max = %s",
+                             iRowGroup,
+                             iOGRField == OGR_FID_INDEX
+                                 ? m_osFIDColumn.c_str()
+                                 : m_poFeatureDefn->GetFieldDefn(iOGRField)
+                                       ->GetNameRef(),
+                             sMin.String, sMax.String);
+#endif
+                    res = IsConstraintPossible(
+                        constraint.nOperation,
+                        std::string(constraint.sValue.String),
+                        std::string(sMin.String),
+                        std::string(sMax.String));
+                }
+                else if (constraint.nOperation == SWQ_ISNULL ||
+                         constraint.nOperation == SWQ_ISNOTNULL)
+                {
+                    const int iCol =
+                        iOGRField == OGR_FID_INDEX
+                            ? m_iFIDParquetColumn
+                            : GetMapFieldIndexToParquetColumn()
+                                  [iOGRField];
+                    if (iCol >= 0)
+                    {
+                        const auto metadata =
+                            m_poArrowReader->parquet_reader()
+                                ->metadata();
+                        const auto rowGroupColumnChunk =
+                            metadata->RowGroup(iRowGroup)->ColumnChunk(
+                                iCol);
+                        const auto rowGroupStats =
+                            rowGroupColumnChunk->statistics();
+                        if (rowGroupColumnChunk->is_stats_set() &&
+                            rowGroupStats)
+                        {
+                            res = IsConstraintPossibleRes::YES;
+                            if (constraint.nOperation == SWQ_ISNULL &&
+                                rowGroupStats->num_values() ==
+                                    poRowGroup->metadata()->num_rows())
+                            {
+                                res = IsConstraintPossibleRes::NO;
+                            }
+                            else if (constraint.nOperation ==
+                                         SWQ_ISNOTNULL &&
+                                     rowGroupStats->num_values() == 0)
+                            {
+                                res = IsConstraintPossibleRes::NO;
+                            }
+                        }
+                    }
+                }
+                else
+                {
+                    CPLDebug(
+                        "PARQUET",
+                        "Unhandled combination of constraint.eType "
+                        "(%d) and eType (%d)",
+                        static_cast<int>(constraint.eType), eType);
+                }
+
+                return res;
+            };
+
+            // Takes into account bloom filters, when statistics are not
+            // enough to exclude an equality.
+            const bool bUseBloomFilter = CPLTestBool(
+                CPLGetConfigOption("OGR_PARQUET_USE_BLOOM_FILTER", "YES"));
+            const auto IsConstraintPossibleForRowGroup =
+                [this, bUseBloomFilter, &IsConstraintPossibleFromStats](
+                    const Constraint &constraint, int iRowGroup,
+                    const parquet::RowGroupReader *poRowGroup,
+                    int64_t nFeatureIdxTotal)
+            {
+                const auto res = IsConstraintPossibleFromStats(
+                    constraint, iRowGroup, poRowGroup, nFeatureIdxTotal);
+                if (res != IsConstraintPossibleRes::NO && bUseBloomFilter &&
+                    IsConstraintExcludedByBloomFilter(iRowGroup, constraint))
+                {
+                    return IsConstraintPossibleRes::NO;
+                }
+                return res;
+            };
+
             for (int iRowGroup = 0;
                  iRowGroup < nNumGroups && !bIterateEverything; ++iRowGroup)
             {
@@ -1601,173 +1883,49 @@ bool OGRParquetLayer::ReadNextBatch()
 
                 if (bSelectGroup)
                 {
-                    for (auto &constraint : m_asAttributeFilterConstraints)
+                    for (const auto &constraint :
+                         m_asAttributeFilterConstraints)
                     {
-                        int iOGRField = constraint.iField;
-                        if (constraint.iField ==
-                            m_poFeatureDefn->GetFieldCount() + SPF_FID)
+                        const auto res = IsConstraintPossibleForRowGroup(
+                            constraint, iRowGroup, poRowGroup.get(),
+                            nFeatureIdxTotal);
+                        if (res == IsConstraintPossibleRes::NO)
                         {
-                            iOGRField = OGR_FID_INDEX;
+                            bSelectGroup = false;
+                            break;
                         }
-                        if (constraint.nOperation != SWQ_ISNULL &&
-                            constraint.nOperation != SWQ_ISNOTNULL)
+                        else if (res == IsConstraintPossibleRes::UNKNOWN)
                         {
-                            if (iOGRField == OGR_FID_INDEX &&
-                                m_iFIDParquetColumn < 0)
-                            {
-                                sMin.Integer64 = nFeatureIdxTotal;
-                                sMax.Integer64 =
-                                    nFeatureIdxTotal +
-                                    poRowGroup->metadata()->num_rows() - 1;
-                                eType = OFTInteger64;
-                            }
-                            else if (!GetMinMaxForOGRField(
-                                         iRowGroup, iOGRField, true, sMin,
-                                         bFoundMin, true, sMax, bFoundMax,
-                                         eType, eSubType, osMinTmp, osMaxTmp) ||
-                                     !bFoundMin || !bFoundMax)
-                            {
-                                bIterateEverything = true;
-                                break;
-                            }
+                            bIterateEverything = true;
+                            break;
                         }
+                    }
+                }
 
-                        IsConstraintPossibleRes res =
-                            IsConstraintPossibleRes::UNKNOWN;
-                        if (constraint.eType ==
-                                OGRArrowLayer::Constraint::Type::Integer &&
-                            eType == OFTInteger)
-                        {
-#if 0
-                            CPLDebug("PARQUET",
-                                     "Group %d, field %s, min = %d, max = %d",
-                                     iRowGroup,
-                                     iOGRField == OGR_FID_INDEX
-                                         ? m_osFIDColumn.c_str()
-                                         : m_poFeatureDefn->GetFieldDefn(iOGRField)
-                                               ->GetNameRef(),
-                                     sMin.Integer, sMax.Integer);
-#endif
-                            res = IsConstraintPossible(
-                                constraint.nOperation,
-                                constraint.sValue.Integer, sMin.Integer,
-                                sMax.Integer);
-                        }
-                        else if (constraint.eType == OGRArrowLayer::Constraint::
-                                                         Type::Integer64 &&
-                                 eType == OFTInteger64)
-                        {
-#if 0
-                            CPLDebug("PARQUET",
-                                     "Group %d, field %s, min = " CPL_FRMT_GIB
-                                     ", max = " CPL_FRMT_GIB,
-                                     iRowGroup,
-                                     iOGRField == OGR_FID_INDEX
-                                         ? m_osFIDColumn.c_str()
-                                         : m_poFeatureDefn->GetFieldDefn(iOGRField)
-                                               ->GetNameRef(),
-                                     static_cast<GIntBig>(sMin.Integer64),
-                                     static_cast<GIntBig>(sMax.Integer64));
-#endif
-                            res = IsConstraintPossible(
-                                constraint.nOperation,
-                                constraint.sValue.Integer64, sMin.Integer64,
-                                sMax.Integer64);
-                        }
-                        else if (constraint.eType ==
-                                     OGRArrowLayer::Constraint::Type::Real &&
-                                 eType == OFTReal)
-                        {
-#if 0
-                            CPLDebug("PARQUET",
-                                     "Group %d, field %s, min = %g, max = %g",
-                                     iRowGroup,
-                                     iOGRField == OGR_FID_INDEX
-                                         ? m_osFIDColumn.c_str()
-                                         : m_poFeatureDefn->GetFieldDefn(iOGRField)
-                                               ->GetNameRef(),
-                                     sMin.Real, sMax.Real);
-#endif
-                            res = IsConstraintPossible(constraint.nOperation,
-                                                       constraint.sValue.Real,
-                                                       sMin.Real, sMax.Real);
-                        }
-                        else if (constraint.eType ==
-                                     OGRArrowLayer::Constraint::Type::String &&
-                                 eType == OFTString)
-                        {
-#if 0
-                            CPLDebug("PARQUET",
-                                     "Group %d, field %s, min = %s, max = %s",
-                                     iRowGroup,
-                                     iOGRField == OGR_FID_INDEX
-                                         ? m_osFIDColumn.c_str()
-                                         : m_poFeatureDefn->GetFieldDefn(iOGRField)
-                                               ->GetNameRef(),
-                                     sMin.String, sMax.String);
-#endif
-                            res = IsConstraintPossible(
-                                constraint.nOperation,
-                                std::string(constraint.sValue.String),
-                                std::string(sMin.String),
-                                std::string(sMax.String));
-                        }
-                        else if (constraint.nOperation == SWQ_ISNULL ||
-                                 constraint.nOperation == SWQ_ISNOTNULL)
+                // For OR and IN expressions, the row group can be skipped
+                // only if none of the alternatives is possible.
+                if (bSelectGroup && !bIterateEverything)
+                {
+                    for (const auto &asConstraints :
+                         m_aasAttributeFilterOrConstraints)
+                    {
+                        bool bAnyPossible = false;
+                        for (const auto &constraint : asConstraints)
                         {
-                            const int iCol =
-                                iOGRField == OGR_FID_INDEX
-                                    ? m_iFIDParquetColumn
-                                    : GetMapFieldIndexToParquetColumn()
-                                          [iOGRField];
-                            if (iCol >= 0)
+                            if (IsConstraintPossibleForRowGroup(
+                                    constraint, iRowGroup, poRowGroup.get(),
+                                    nFeatureIdxTotal) !=
+                                IsConstraintPossibleRes::NO)
                             {
-                                const auto metadata =
-                                    m_poArrowReader->parquet_reader()
-                                        ->metadata();
-                                const auto rowGroupColumnChunk =
-                                    metadata->RowGroup(iRowGroup)->ColumnChunk(
-                                        iCol);
-                                const auto rowGroupStats =
-                                    rowGroupColumnChunk->statistics();
-                                if (rowGroupColumnChunk->is_stats_set() &&
-                                    rowGroupStats)
-                                {
-                                    res = IsConstraintPossibleRes::YES;
-                                    if (constraint.nOperation == SWQ_ISNULL &&
-                                        rowGroupStats->num_values() ==
-                                            poRowGroup->metadata()->num_rows())
-                                    {
-                                        res = IsConstraintPossibleRes::NO;
-                                    }
-                                    else if (constraint.nOperation ==
-                                                 SWQ_ISNOTNULL &&
-                                             rowGroupStats->num_values() == 0)
-                                    {
-                                        res = IsConstraintPossibleRes::NO;
-                                    }
-                                }
+                                bAnyPossible = true;
+                                break;
                             }
                         }
-                        else
-                        {
-                            CPLDebug(
-                                "PARQUET",
-                                "Unhandled combination of constraint.eType "
-                                "(%d) and eType (%d)",
-                                static_cast<int>(constraint.eType), eType);
-                        }
-
-                        if (res == IsConstraintPossibleRes::NO)
+                        if (!bAnyPossible)
                         {
                             bSelectGroup = false;
                             break;
                         }
-                        else if (res == IsConstraintPossibleRes::UNKNOWN)
-                        {
-                            bIterateEverything = true;
-                            break;
-                        }
                     }
                 }
 
@@ -33,8 +33,11 @@
 
 #include "../arrow_common/ograrrowwriterlayer.hpp"
 
+#include "cpl_hilbert.h"
+#include "gdal_thread_pool.h"
 #include "ogr_wkb.h"
 
+#include <algorithm>
 #include <utility>
 
 /************************************************************************/
@@ -133,6 +136,9 @@ bool OGRParquetWriterLayer::CopyTmpGpkgLayerToFinalFile()
         }
     }
 
+    if (m_bSortByHilbert)
+        return CopyTmpGpkgLayerInHilbertOrder(oFeat);
+
     // Now walk through the GPKG RTree for features with geometries
     // Cf https://github.com/sqlite/sqlite/blob/master/ext/rtree/rtree.c
     // for the description of the content of the rtree _node table
@@ -291,6 +297,97 @@ bool OGRParquetWriterLayer::CopyTmpGpkgLayerToFinalFile()
     return true;
 }
 
+/************************************************************************/
+/*                   CopyTmpGpkgLayerInHilbertOrder()                   */
+/************************************************************************/
+
+// Write the features with geometries of the temporary GeoPackage layer,
+// ordered by the position along a Hilbert curve of the center of their
+// bounding box, which is read back from the RTree of the temporary layer.
+bool OGRParquetWriterLayer::CopyTmpGpkgLayerInHilbertOrder(OGRFeature &oFeat)
+{
+    std::vector<std::pair<GUInt32, GIntBig>> aoCodeAndFID;
+    try
+    {
+        auto poRTreeLayer = std::unique_ptr<OGRLayer>(m_poTmpGPKG->ExecuteSQL(
+            "SELECT id, (minx + maxx) / 2 AS cx, (miny + maxy) / 2 AS cy "
+            "FROM rtree_tmp_geom",
+            nullptr, nullptr));
+        if (!poRTreeLayer)
+            return false;
+        const auto poRTreeDefn = poRTreeLayer->GetLayerDefn();
+        const int iIdField = poRTreeDefn->GetFieldIndex("id");
+        const int iCXField = poRTreeDefn->GetFieldIndex("cx");
+        const int iCYField = poRTreeDefn->GetFieldIndex("cy");
+        if (iCXField < 0 || iCYField < 0)
+            return false;
+
+        const double dfWidth = m_sTmpExtent.MaxX - m_sTmpExtent.MinX;
+        const double dfHeight = m_sTmpExtent.MaxY - m_sTmpExtent.MinY;
+
+        aoCodeAndFID.reserve(static_cast<size_t>(m_nTmpFeatureCount));
+        for (const auto &poRTreeFeature : poRTreeLayer.get())
+        {
+            // The id column might have been promoted to being the FID
+            aoCodeAndFID.emplace_back(
+                CPLHilbertCodeInExtent(
+                    poRTreeFeature->GetFieldAsDouble(iCXField),
+                    poRTreeFeature->GetFieldAsDouble(iCYField),
+                    m_sTmpExtent.MinX, m_sTmpExtent.MinY, dfWidth, dfHeight),
+                iIdField >= 0 ? poRTreeFeature->GetFieldAsInteger64(iIdField)
+                              : poRTreeFeature->GetFID());
+        }
+        std::sort(aoCodeAndFID.begin(), aoCodeAndFID.end());
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory while sorting features along a Hilbert curve");
+        return false;
+    }
+
+    // Interval in terms of features between 2 debug progress report messages
+    constexpr int PROGRESS_FC_INTERVAL = 100 * 1000;
+
+    for (const auto &oCodeAndFID : aoCodeAndFID)
+    {
+        const GIntBig nFID = oCodeAndFID.second;
+        const auto poSrcFeature = std::unique_ptr<const OGRFeature>(
+            m_poTmpGPKGLayer->GetFeature(nFID));
+        if (!poSrcFeature)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot get feature " CPL_FRMT_GIB, nFID);
+            return false;
+        }
+
+        int nBytesFeature = 0;
+        const GByte *pabyFeatureData =
+            poSrcFeature->GetFieldAsBinary(0, &nBytesFeature);
+        if (!oFeat.DeserializeFromBinary(pabyFeatureData, nBytesFeature))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "Cannot deserialize feature");
+            return false;
+        }
+        if (OGRArrowWriterLayer::ICreateFeature(&oFeat) != OGRERR_NONE)
+        {
+            return false;
+        }
+
+        if ((m_nFeatureCount % PROGRESS_FC_INTERVAL) == 0)
+        {
+            CPLDebugProgress("PARQUET",
+                             "CopyTmpGpkgLayerToFinalFile(): %.02f%% progress",
+                             100.0 * double(m_nFeatureCount) /
+                                 double(m_nTmpFeatureCount));
+        }
+    }
+
+    CPLDebug("PARQUET",
+             "CopyTmpGpkgLayerToFinalFile(): 100%%, successfully finished");
+    return true;
+}
+
 /************************************************************************/
 /*                       IsSupportedGeometryType()                      */
 /************************************************************************/
@@ -330,16 +427,28 @@ bool OGRParquetWriterLayer::SetOptions(CSLConstList papszOptions,
         papszOptions, "WRITE_COVERING_BBOX",
         CPLGetConfigOption("OGR_PARQUET_WRITE_COVERING_BBOX", "YES")));
 
-    if (CPLTestBool(CSLFetchNameValueDef(papszOptions, "SORT_BY_BBOX", "NO")))
+    const bool bSortByBBox =
+        CPLTestBool(CSLFetchNameValueDef(papszOptions, "SORT_BY_BBOX", "NO"));
+    m_bSortByHilbert = CPLTestBool(
+        CSLFetchNameValueDef(papszOptions, "SORT_BY_HILBERT", "NO"));
+    if (bSortByBBox && m_bSortByHilbert)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "SORT_BY_BBOX and SORT_BY_HILBERT layer creation options "
+                 "are mutually exclusive");
+        return false;
+    }
+
+    if (bSortByBBox || m_bSortByHilbert)
     {
         const std::string osTmpGPKG(std::string(m_poDataset->GetDescription()) +
                                     ".tmp.gpkg");
         auto poGPKGDrv = GetGDALDriverManager()->GetDriverByName("GPKG");
         if (!poGPKGDrv)
         {
-            CPLError(
-                CE_Failure, CPLE_AppDefined,
-                "Driver GPKG required for SORT_BY_BBOX layer creation option");
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Driver GPKG required for %s layer creation option",
+                     bSortByBBox ? "SORT_BY_BBOX" : "SORT_BY_HILBERT");
             return false;
         }
         m_poTmpGPKG.reset(poGPKGDrv->Create(osTmpGPKG.c_str(), 0, 0, 0,
@@ -498,6 +607,26 @@ bool OGRParquetWriterLayer::SetOptions(CSLConstList papszOptions,
             m_nRowGroupSize = nRowGroupSize;
         }
     }
+    // Row groups written with WriteRecordBatch() are split by libparquet
+    // beyond max_row_group_length
+    if (m_nRowGroupSize > parquet::DEFAULT_MAX_ROW_GROUP_LENGTH)
+        m_oWriterPropertiesBuilder.max_row_group_length(m_nRowGroupSize);
+
+#if PARQUET_VERSION_MAJOR > 10
+    const char *pszUseThreads =
+        CPLGetConfigOption("OGR_PARQUET_USE_THREADS", nullptr);
+    if (!pszUseThreads && OGRParquetLayerBase::GetNumCPUs() > 1)
+    {
+        pszUseThreads = "YES";
+    }
+    m_bUseThreads = CPLTestBool(pszUseThreads ? pszUseThreads : "NO");
+    if (m_bUseThreads)
+    {
+        CPLWorkerThreadPool *poPool = GDALGetGlobalThreadPool(1);
+        if (poPool)
+            m_poWriteJobQueue = poPool->CreateJobQueue();
+    }
+#endif
 
     m_bEdgesSpherical = EQUAL(
         CSLFetchNameValueDef(papszOptions, "EDGES", "PLANAR"), "SPHERICAL");
@@ -512,14 +641,16 @@ bool OGRParquetWriterLayer::SetOptions(CSLConstList papszOptions,
 
 bool OGRParquetWriterLayer::CloseFileWriter()
 {
+    bool ret = WaitPendingWrite();
     auto status = m_poFileWriter->Close();
     if (!status.ok())
     {
         CPLError(CE_Failure, CPLE_AppDefined,
                  "FileWriter::Close() failed with %s",
                  status.message().c_str());
+        ret = false;
     }
-    return status.ok();
+    return ret;
 }
 
 /************************************************************************/
@@ -839,6 +970,11 @@ std::string OGRParquetWriterLayer::GetGeoMetadata() const
 
 void OGRParquetWriterLayer::PerformStepsBeforeFinalFlushGroup()
 {
+    // The key-value metadata is altered below. Errors of the pending write,
+    // if any, will be reported by the final FlushGroup()
+    if (m_poWriteJobQueue)
+        m_poWriteJobQueue->WaitCompletion();
+
     if (m_poKeyValueMetadata)
     {
         const std::string osGeoMetadata = GetGeoMetadata();
@@ -1015,8 +1151,13 @@ void OGRParquetWriterLayer::CreateWriter()
         FinalizeSchema();
     }
 
-    auto arrowWriterProperties =
-        parquet::ArrowWriterProperties::Builder().store_schema()->build();
+    parquet::ArrowWriterProperties::Builder oArrowWriterPropertiesBuilder;
+    oArrowWriterPropertiesBuilder.store_schema();
+#if PARQUET_VERSION_MAJOR > 10
+    // Encode the column chunks of a row group in parallel
+    oArrowWriterPropertiesBuilder.set_use_threads(m_bUseThreads);
+#endif
+    auto arrowWriterProperties = oArrowWriterPropertiesBuilder.build();
     CPL_IGNORE_RET_VAL(Open(*m_poSchema, m_poMemoryPool, m_poOutputStream,
                             m_oWriterPropertiesBuilder.build(),
                             std::move(arrowWriterProperties), &m_poFileWriter,
@@ -1081,6 +1222,8 @@ OGRErr OGRParquetWriterLayer::ICreateFeature(OGRFeature *poFeature)
         poLR->addPoint(sEnvelope.MinX, sEnvelope.MinY);
         poPoly->addRingDirectly(poLR.release());
         oFeat.SetGeometryDirectly(poPoly.release());
+        if (m_bSortByHilbert)
+            m_sTmpExtent.Merge(sEnvelope);
     }
     return m_poTmpGPKGLayer->CreateFeature(&oFeat);
 }
@@ -1091,6 +1234,39 @@ OGRErr OGRParquetWriterLayer::ICreateFeature(OGRFeature *poFeature)
 
 bool OGRParquetWriterLayer::FlushGroup()
 {
+#if PARQUET_VERSION_MAJOR > 10
+    if (m_bUseThreads)
+    {
+        // Double buffering: the arrays of this row group are finalized while
+        // the previous row group is still being encoded and written by the
+        // worker thread, and the caller can start filling the next one as
+        // soon as this one has been submitted.
+        std::vector<std::shared_ptr<arrow::Array>> columns;
+        const bool ret =
+            WriteArrays([&columns](const std::shared_ptr<arrow::Field> &,
+                                   const std::shared_ptr<arrow::Array> &array)
+                        {
+                            columns.emplace_back(array);
+                            return true;
+                        });
+        ClearArrayBuilers();
+
+        if (!WaitPendingWrite() || !ret)
+            return false;
+
+        const int64_t nRows = !columns.empty() ? columns[0]->length() : 0;
+        m_poPendingBatch =
+            arrow::RecordBatch::Make(m_poSchema, nRows, std::move(columns));
+        if (m_poWriteJobQueue &&
+            m_poWriteJobQueue->SubmitJob(WriteRecordBatchJob, this))
+        {
+            return true;
+        }
+        WriteRecordBatchJob(this);
+        return WaitPendingWrite();
+    }
+#endif
+
     auto status = m_poFileWriter->NewRowGroup(m_apoBuilders[0]->length());
     if (!status.ok())
     {
@@ -1119,6 +1295,51 @@ bool OGRParquetWriterLayer::FlushGroup()
     return ret;
 }
 
+/************************************************************************/
+/*                        WriteRecordBatchJob()                         */
+/************************************************************************/
+
+// Executed by a worker thread in OGR_PARQUET_USE_THREADS mode. Errors are
+// reported by WaitPendingWrite(), in the thread of the caller.
+void OGRParquetWriterLayer::WriteRecordBatchJob(void *pData)
+{
+    auto poLayer = static_cast<OGRParquetWriterLayer *>(pData);
+    auto status = poLayer->m_poFileWriter->NewBufferedRowGroup();
+    if (!status.ok())
+    {
+        poLayer->m_osPendingWriteError =
+            "NewBufferedRowGroup() failed with " + status.message();
+        return;
+    }
+
+    status = poLayer->m_poFileWriter->WriteRecordBatch(
+        *(poLayer->m_poPendingBatch));
+    if (!status.ok())
+    {
+        poLayer->m_osPendingWriteError =
+            "WriteRecordBatch() failed: " + status.message();
+    }
+}
+
+/************************************************************************/
+/*                         WaitPendingWrite()                           */
+/************************************************************************/
+
+bool OGRParquetWriterLayer::WaitPendingWrite()
+{
+    if (m_poWriteJobQueue)
+        m_poWriteJobQueue->WaitCompletion();
+    m_poPendingBatch.reset();
+    if (!m_osPendingWriteError.empty())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                 m_osPendingWriteError.c_str());
+        m_osPendingWriteError.clear();
+        return false;
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                    FixupWKBGeometryBeforeWriting()                   */
 /************************************************************************/
@@ -1190,6 +1411,9 @@ OGRParquetWriterLayer::WriteArrowBatch(const struct ArrowSchema *schema,
         schema, array, papszOptions,
         [this](const std::shared_ptr<arrow::RecordBatch> &poBatch)
         {
+            if (!WaitPendingWrite())
+                return false;
+
             auto status = m_poFileWriter->NewBufferedRowGroup();
             if (!status.ok())
             {
@@ -335,6 +335,34 @@ class OGRPGTableLayer final : public OGRPGLayer
     OGRErr CreateFeatureViaInsert(OGRFeature *poFeature);
     CPLString BuildCopyFields();
 
+    // Server side types handled by the binary COPY encoder.
+    enum class CopyBinaryType
+    {
+        NONE,
+        GEOMETRY,
+        WKB,
+        INT2,
+        INT4,
+        INT8,
+        BOOL,
+        FLOAT4,
+        FLOAT8,
+        NUMERIC,
+        TEXT,
+        JSONB,
+        BYTEA,
+        DATE,
+        TIME,
+        TIMESTAMP,
+        TIMESTAMPTZ
+    };
+
+    bool m_bCopyBinary = false;
+    bool m_bCopyBinaryDisabled = false;
+    std::vector<CopyBinaryType> m_aeCopyBinaryTypes{};
+    bool PrepareCopyBinary();
+    bool BuildCopyBinaryRow(OGRFeature *poFeature, std::string &osRow);
+
     int bHasWarnedIncompatibleGeom = false;
     void CheckGeomTypeCompatibility(int iGeomField, OGRGeometry *poGeom);
 
@@ -35,7 +35,11 @@
 #include "ogr_p.h"
 
 #include <chrono>
+#include <climits>
+#include <cmath>
 #include <condition_variable>
+#include <limits>
+#include <map>
 #include <mutex>
 #include <thread>
 
@@ -2123,6 +2127,42 @@ OGRErr OGRPGTableLayer::CreateFeatureViaCopy(OGRFeature *poFeature)
     /* Tell the datasource we are now planning to copy data */
     poDS->StartCopy(this);
 
+    if (m_bCopyBinary)
+    {
+        std::string osRow;
+        if (BuildCopyBinaryRow(poFeature, osRow))
+        {
+            const int copyResult = PQputCopyData(
+                hPGConn, osRow.data(), static_cast<int>(osRow.size()));
+            if (copyResult == 0)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Writing COPY data blocked.");
+                return OGRERR_FAILURE;
+            }
+            else if (copyResult == -1)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                         PQerrorMessage(hPGConn));
+                return OGRERR_FAILURE;
+            }
+            return OGRERR_NONE;
+        }
+
+        // The feature has a value that cannot be encoded in binary form
+        // (or that must be reported as invalid): continue with a text COPY.
+        CPLDebug("PG", "Switching to text COPY for layer %s",
+                 poFeatureDefn->GetName());
+        m_bCopyBinaryDisabled = true;
+        const int bUseCopySaved = bUseCopy;
+        const bool bNeedToUpdateSequenceSaved = bNeedToUpdateSequence;
+        if (poDS->EndCopy() != OGRERR_NONE)
+            return OGRERR_FAILURE;
+        bUseCopy = bUseCopySaved;
+        bNeedToUpdateSequence = bNeedToUpdateSequenceSaved;
+        poDS->StartCopy(this);
+    }
+
     /* First process geometry */
     for (int i = 0; i < poFeatureDefn->GetGeomFieldCount(); i++)
     {
@@ -2220,6 +2260,616 @@ OGRErr OGRPGTableLayer::CreateFeatureViaCopy(OGRFeature *poFeature)
     return result;
 }
 
+/************************************************************************/
+/*                     Binary COPY encoding helpers                     */
+/************************************************************************/
+
+// Days between 1970-01-01 and 2000-01-01, the PostgreSQL epoch.
+constexpr int PG_EPOCH_JDATE_OFFSET = 10957;
+constexpr GIntBig USECS_PER_DAY = static_cast<GIntBig>(86400) * 1000000;
+
+static void OGRPGCopyBinaryAppendInt16(std::string &osRow, GInt16 nVal)
+{
+    CPL_MSBPTR16(&nVal);
+    osRow.append(reinterpret_cast<const char *>(&nVal), sizeof(nVal));
+}
+
+static void OGRPGCopyBinaryAppendInt32(std::string &osRow, GInt32 nVal)
+{
+    CPL_MSBPTR32(&nVal);
+    osRow.append(reinterpret_cast<const char *>(&nVal), sizeof(nVal));
+}
+
+static void OGRPGCopyBinaryAppendInt64(std::string &osRow, GIntBig nVal)
+{
+    CPL_MSBPTR64(&nVal);
+    osRow.append(reinterpret_cast<const char *>(&nVal), sizeof(nVal));
+}
+
+// Number of days since 1970-01-01 of a proleptic Gregorian date.
+static GIntBig OGRPGDaysFromCivil(int nYear, int nMonth, int nDay)
+{
+    const GIntBig y = static_cast<GIntBig>(nYear) - (nMonth <= 2 ? 1 : 0);
+    const GIntBig era = (y >= 0 ? y : y - 399) / 400;
+    const GIntBig yoe = y - era * 400;
+    const GIntBig doy = (153 * (nMonth + (nMonth > 2 ? -3 : 9)) + 2) / 5 +
+                        static_cast<GIntBig>(nDay) - 1;
+    const GIntBig doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+// Microseconds since midnight, with the millisecond resolution used by
+// the text representation of OGR date/time values.
+static GIntBig OGRPGTimeToUSecs(const OGRField *psField)
+{
+    return (static_cast<GIntBig>(psField->Date.Hour) * 3600 +
+            psField->Date.Minute * 60) *
+               1000000 +
+           static_cast<GIntBig>(
+               std::llround(static_cast<double>(psField->Date.Second) * 1000)) *
+               1000;
+}
+
+/************************************************************************/
+/*                      OGRPGCopyBinaryAppendNumeric()                  */
+/*                                                                      */
+/*      Encode a decimal string, as formatted for the text COPY, in     */
+/*      the binary numeric representation: base 10000 digits, weight   */
+/*      of the first digit, sign and display scale.                     */
+/************************************************************************/
+
+static bool OGRPGCopyBinaryAppendNumeric(std::string &osRow,
+                                         const char *pszValue)
+{
+    while (*pszValue == ' ')
+        ++pszValue;
+
+    constexpr GUInt16 NUMERIC_POS = 0x0000;
+    constexpr GUInt16 NUMERIC_NEG = 0x4000;
+    constexpr GUInt16 NUMERIC_NAN = 0xC000;
+
+    if (EQUAL(pszValue, "NaN"))
+    {
+        OGRPGCopyBinaryAppendInt32(osRow, 8);
+        OGRPGCopyBinaryAppendInt16(osRow, 0);
+        OGRPGCopyBinaryAppendInt16(osRow, 0);
+        OGRPGCopyBinaryAppendInt16(osRow, static_cast<GInt16>(NUMERIC_NAN));
+        OGRPGCopyBinaryAppendInt16(osRow, 0);
+        return true;
+    }
+
+    GUInt16 nSign = NUMERIC_POS;
+    if (*pszValue == '-' || *pszValue == '+')
+    {
+        if (*pszValue == '-')
+            nSign = NUMERIC_NEG;
+        ++pszValue;
+    }
+
+    std::string osInt;
+    std::string osFrac;
+    while (*pszValue >= '0' && *pszValue <= '9')
+        osInt += *(pszValue++);
+    if (*pszValue == '.')
+    {
+        ++pszValue;
+        while (*pszValue >= '0' && *pszValue <= '9')
+            osFrac += *(pszValue++);
+    }
+    if (osInt.empty() && osFrac.empty())
+        return false;
+    if (*pszValue == 'e' || *pszValue == 'E')
+    {
+        char *pszEnd = nullptr;
+        const long nExp = strtol(pszValue + 1, &pszEnd, 10);
+        if (pszEnd == pszValue + 1 || nExp > 1000 || nExp < -1000)
+            return false;
+        pszValue = pszEnd;
+        if (nExp > 0)
+        {
+            if (osFrac.size() < static_cast<size_t>(nExp))
+                osFrac.append(nExp - osFrac.size(), '0');
+            osInt += osFrac.substr(0, nExp);
+            osFrac = osFrac.substr(nExp);
+        }
+        else if (nExp < 0)
+        {
+            if (osInt.size() < static_cast<size_t>(-nExp))
+                osInt.insert(0, -nExp - osInt.size(), '0');
+            osFrac = osInt.substr(osInt.size() + nExp) + osFrac;
+            osInt.resize(osInt.size() + nExp);
+        }
+    }
+    while (*pszValue == ' ')
+        ++pszValue;
+    if (*pszValue != '\0')
+        return false;
+
+    const int nDScale = static_cast<int>(osFrac.size());
+    if (osInt.size() % 4)
+        osInt.insert(0, 4 - osInt.size() % 4, '0');
+    if (osFrac.size() % 4)
+        osFrac.append(4 - osFrac.size() % 4, '0');
+
+    std::vector<GInt16> anDigits;
+    int nWeight = static_cast<int>(osInt.size() / 4) - 1;
+    const std::string osAll(osInt + osFrac);
+    for (size_t i = 0; i < osAll.size(); i += 4)
+        anDigits.push_back(
+            static_cast<GInt16>(atoi(osAll.substr(i, 4).c_str())));
+    size_t nFirst = 0;
+    while (nFirst < anDigits.size() && anDigits[nFirst] == 0)
+    {
+        ++nFirst;
+        --nWeight;
+    }
+    size_t nLast = anDigits.size();
+    while (nLast > nFirst && anDigits[nLast - 1] == 0)
+        --nLast;
+    if (nFirst == nLast)
+    {
+        nWeight = 0;
+        nSign = NUMERIC_POS;
+    }
+    if (nLast - nFirst > 10000 || nDScale > 10000)
+        return false;
+
+    const int nDigits = static_cast<int>(nLast - nFirst);
+    OGRPGCopyBinaryAppendInt32(osRow, 8 + 2 * nDigits);
+    OGRPGCopyBinaryAppendInt16(osRow, static_cast<GInt16>(nDigits));
+    OGRPGCopyBinaryAppendInt16(osRow, static_cast<GInt16>(nWeight));
+    OGRPGCopyBinaryAppendInt16(osRow, static_cast<GInt16>(nSign));
+    OGRPGCopyBinaryAppendInt16(osRow, static_cast<GInt16>(nDScale));
+    for (size_t i = nFirst; i < nLast; ++i)
+        OGRPGCopyBinaryAppendInt16(osRow, anDigits[i]);
+    return true;
+}
+
+/************************************************************************/
+/*                       OGRPGCopyBinaryAppendWKB()                     */
+/************************************************************************/
+
+static bool OGRPGCopyBinaryAppendWKB(std::string &osRow,
+                                     const OGRGeometry *poGeom, int nSRSId,
+                                     int nPostGISMajor, int nPostGISMinor)
+{
+    const size_t nWkbSize = poGeom->WkbSize();
+    std::vector<GByte> abyWKB;
+    try
+    {
+        abyWKB.resize(nWkbSize);
+    }
+    catch (const std::exception &)
+    {
+        return false;
+    }
+
+    // Same WKB variant selection as OGRGeometryToHexEWKB()
+    OGRwkbVariant eVariant =
+        (nPostGISMajor < 2) ? wkbVariantPostGIS1 : wkbVariantOldOgc;
+    if ((nPostGISMajor > 2 || (nPostGISMajor == 2 && nPostGISMinor >= 2)) &&
+        wkbFlatten(poGeom->getGeometryType()) == wkbPoint && poGeom->IsEmpty())
+    {
+        eVariant = wkbVariantIso;
+    }
+    if (nWkbSize < 5 ||
+        poGeom->exportToWkb(wkbNDR, abyWKB.data(), eVariant) != OGRERR_NONE)
+    {
+        return false;
+    }
+
+    const size_t nTotalSize = nWkbSize + (nSRSId > 0 ? 4 : 0);
+    if (nTotalSize > static_cast<size_t>(std::numeric_limits<int>::max()))
+        return false;
+    OGRPGCopyBinaryAppendInt32(osRow, static_cast<GInt32>(nTotalSize));
+    if (nSRSId > 0)
+    {
+        osRow.append(reinterpret_cast<const char *>(abyWKB.data()), 1);
+        GUInt32 nGeomType;
+        memcpy(&nGeomType, abyWKB.data() + 1, 4);
+        constexpr GUInt32 WKBSRIDFLAG = 0x20000000;
+        nGeomType |= CPL_LSBWORD32(WKBSRIDFLAG);
+        osRow.append(reinterpret_cast<const char *>(&nGeomType), 4);
+        const GUInt32 nGSRSId = CPL_LSBWORD32(static_cast<GUInt32>(nSRSId));
+        osRow.append(reinterpret_cast<const char *>(&nGSRSId), 4);
+        osRow.append(reinterpret_cast<const char *>(abyWKB.data()) + 5,
+                     nWkbSize - 5);
+    }
+    else
+    {
+        osRow.append(reinterpret_cast<const char *>(abyWKB.data()), nWkbSize);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                         PrepareCopyBinary()                          */
+/*                                                                      */
+/*      Check that the server side types of all the columns of the      */
+/*      COPY can be encoded in the binary format from their OGR type.   */
+/************************************************************************/
+
+bool OGRPGTableLayer::PrepareCopyBinary()
+{
+    m_aeCopyBinaryTypes.clear();
+
+    if (poDS->sPostgreSQLVersion.nMajor < 9)
+        return false;
+
+    PGconn *hPGConn = poDS->GetPGConn();
+    CPLString osCommand;
+    osCommand.Printf(
+        "SELECT a.attname, t.typname FROM pg_attribute a "
+        "JOIN pg_type t ON t.oid = a.atttypid "
+        "WHERE a.attrelid = %s::regclass AND a.attnum > 0 "
+        "AND NOT a.attisdropped",
+        OGRPGEscapeString(hPGConn, pszSqlTableName).c_str());
+    PGresult *hResult = OGRPG_PQexec(hPGConn, osCommand.c_str());
+    if (!hResult || PQresultStatus(hResult) != PGRES_TUPLES_OK)
+    {
+        OGRPGClearResult(hResult);
+        return false;
+    }
+    std::map<std::string, std::string> oMapColumnTypes;
+    for (int i = 0; i < PQntuples(hResult); i++)
+    {
+        oMapColumnTypes[PQgetvalue(hResult, i, 0)] = PQgetvalue(hResult, i, 1);
+    }
+    OGRPGClearResult(hResult);
+
+    const auto GetColumnType = [&oMapColumnTypes](const char *pszName)
+    {
+        const auto oIter = oMapColumnTypes.find(pszName);
+        return oIter == oMapColumnTypes.end() ? std::string()
+                                              : oIter->second;
+    };
+
+    for (int i = 0; i < poFeatureDefn->GetGeomFieldCount(); i++)
+    {
+        OGRPGGeomFieldDefn *poGeomFieldDefn =
+            poFeatureDefn->GetGeomFieldDefn(i);
+        const std::string osType =
+            GetColumnType(poGeomFieldDefn->GetNameRef());
+        if ((poGeomFieldDefn->ePostgisType == GEOM_TYPE_GEOMETRY &&
+             osType == "geometry") ||
+            (poGeomFieldDefn->ePostgisType == GEOM_TYPE_GEOGRAPHY &&
+             osType == "geography"))
+            m_aeCopyBinaryTypes.push_back(CopyBinaryType::GEOMETRY);
+        else if (poGeomFieldDefn->ePostgisType == GEOM_TYPE_WKB &&
+                 osType == "bytea")
+            m_aeCopyBinaryTypes.push_back(CopyBinaryType::WKB);
+        else
+            return false;
+    }
+
+    int nFIDIndex = -1;
+    if (bFIDColumnInCopyFields)
+    {
+        nFIDIndex = poFeatureDefn->GetFieldIndex(pszFIDColumn);
+        const std::string osType = GetColumnType(pszFIDColumn);
+        if (osType == "int2")
+            m_aeCopyBinaryTypes.push_back(CopyBinaryType::INT2);
+        else if (osType == "int4")
+            m_aeCopyBinaryTypes.push_back(CopyBinaryType::INT4);
+        else if (osType == "int8")
+            m_aeCopyBinaryTypes.push_back(CopyBinaryType::INT8);
+        else
+            return false;
+    }
+
+    for (int i = 0; i < poFeatureDefn->GetFieldCount(); i++)
+    {
+        if (i == nFIDIndex)
+            continue;
+        if (m_abGeneratedColumns[i])
+            continue;
+
+        const OGRFieldDefn *poFieldDefn = poFeatureDefn->GetFieldDefn(i);
+        const OGRFieldType eType = poFieldDefn->GetType();
+        const std::string osType = GetColumnType(poFieldDefn->GetNameRef());
+        const bool bIsInteger = eType == OFTInteger || eType == OFTInteger64;
+
+        CopyBinaryType eBinaryType = CopyBinaryType::NONE;
+        if (bIsInteger && osType == "int2")
+            eBinaryType = CopyBinaryType::INT2;
+        else if (bIsInteger && osType == "int4")
+            eBinaryType = CopyBinaryType::INT4;
+        else if (bIsInteger && osType == "int8")
+            eBinaryType = CopyBinaryType::INT8;
+        else if (eType == OFTInteger && osType == "bool")
+            eBinaryType = CopyBinaryType::BOOL;
+        else if (eType == OFTReal && osType == "float4")
+            eBinaryType = CopyBinaryType::FLOAT4;
+        else if (eType == OFTReal && osType == "float8")
+            eBinaryType = CopyBinaryType::FLOAT8;
+        else if ((eType == OFTReal || bIsInteger) && osType == "numeric")
+            eBinaryType = CopyBinaryType::NUMERIC;
+        else if (eType == OFTString &&
+                 (osType == "varchar" || osType == "text" ||
+                  osType == "bpchar" || osType == "json"))
+            eBinaryType = CopyBinaryType::TEXT;
+        else if (eType == OFTString && osType == "jsonb")
+            eBinaryType = CopyBinaryType::JSONB;
+        else if (eType == OFTBinary && osType == "bytea")
+            eBinaryType = CopyBinaryType::BYTEA;
+        else if (eType == OFTDate && osType == "date")
+            eBinaryType = CopyBinaryType::DATE;
+        else if (eType == OFTTime && osType == "time")
+            eBinaryType = CopyBinaryType::TIME;
+        else if (eType == OFTDateTime && osType == "timestamp")
+            eBinaryType = CopyBinaryType::TIMESTAMP;
+        else if (eType == OFTDateTime && osType == "timestamptz")
+            eBinaryType = CopyBinaryType::TIMESTAMPTZ;
+        else
+        {
+            CPLDebug("PG",
+                     "Binary COPY not possible for layer %s due to "
+                     "field %s of type %s",
+                     poFeatureDefn->GetName(), poFieldDefn->GetNameRef(),
+                     osType.c_str());
+            return false;
+        }
+        m_aeCopyBinaryTypes.push_back(eBinaryType);
+    }
+
+    return !m_aeCopyBinaryTypes.empty() &&
+           m_aeCopyBinaryTypes.size() <
+               static_cast<size_t>(std::numeric_limits<GInt16>::max());
+}
+
+/************************************************************************/
+/*                        BuildCopyBinaryRow()                          */
+/*                                                                      */
+/*      Returns false if a value of the feature cannot be encoded, in   */
+/*      which case the caller must fall back to a text COPY.            */
+/************************************************************************/
+
+bool OGRPGTableLayer::BuildCopyBinaryRow(OGRFeature *poFeature,
+                                         std::string &osRow)
+{
+    OGRPGCopyBinaryAppendInt16(osRow,
+                               static_cast<GInt16>(m_aeCopyBinaryTypes.size()));
+    size_t iCol = 0;
+
+    for (int i = 0; i < poFeatureDefn->GetGeomFieldCount(); i++, iCol++)
+    {
+        OGRPGGeomFieldDefn *poGeomFieldDefn =
+            poFeatureDefn->GetGeomFieldDefn(i);
+        OGRGeometry *poGeom = poFeature->GetGeomFieldRef(i);
+        if (poGeom == nullptr)
+        {
+            OGRPGCopyBinaryAppendInt32(osRow, -1);
+            continue;
+        }
+
+        CheckGeomTypeCompatibility(i, poGeom);
+
+        poGeom->closeRings();
+        poGeom->set3D(poGeomFieldDefn->GeometryTypeFlags &
+                      OGRGeometry::OGR_G_3D);
+        poGeom->setMeasured(poGeomFieldDefn->GeometryTypeFlags &
+                            OGRGeometry::OGR_G_MEASURED);
+
+        if (!OGRPGCopyBinaryAppendWKB(
+                osRow, poGeom,
+                m_aeCopyBinaryTypes[iCol] == CopyBinaryType::WKB
+                    ? 0
+                    : poGeomFieldDefn->nSRSId,
+                poDS->sPostGISVersion.nMajor, poDS->sPostGISVersion.nMinor))
+        {
+            return false;
+        }
+    }
+
+    const auto AppendInteger = [&osRow](CopyBinaryType eType, GIntBig nVal)
+    {
+        if (eType == CopyBinaryType::INT2)
+        {
+            if (nVal < std::numeric_limits<GInt16>::min() ||
+                nVal > std::numeric_limits<GInt16>::max())
+                return false;
+            OGRPGCopyBinaryAppendInt32(osRow, 2);
+            OGRPGCopyBinaryAppendInt16(osRow, static_cast<GInt16>(nVal));
+        }
+        else if (eType == CopyBinaryType::INT4)
+        {
+            if (nVal < std::numeric_limits<GInt32>::min() ||
+                nVal > std::numeric_limits<GInt32>::max())
+                return false;
+            OGRPGCopyBinaryAppendInt32(osRow, 4);
+            OGRPGCopyBinaryAppendInt32(osRow, static_cast<GInt32>(nVal));
+        }
+        else
+        {
+            OGRPGCopyBinaryAppendInt32(osRow, 8);
+            OGRPGCopyBinaryAppendInt64(osRow, nVal);
+        }
+        return true;
+    };
+
+    int nFIDIndex = -1;
+    if (bFIDColumnInCopyFields)
+    {
+        nFIDIndex = poFeatureDefn->GetFieldIndex(pszFIDColumn);
+        if (poFeature->GetFID() == OGRNullFID)
+            OGRPGCopyBinaryAppendInt32(osRow, -1);
+        else if (!AppendInteger(m_aeCopyBinaryTypes[iCol], poFeature->GetFID()))
+            return false;
+        iCol++;
+    }
+
+    const bool bCheckUTF8 = poDS->IsUTF8ClientEncoding();
+    for (int i = 0; i < poFeatureDefn->GetFieldCount(); i++)
+    {
+        if (i == nFIDIndex)
+            continue;
+        if (m_abGeneratedColumns[i])
+            continue;
+
+        const CopyBinaryType eType = m_aeCopyBinaryTypes[iCol++];
+        if (!poFeature->IsFieldSetAndNotNull(i))
+        {
+            OGRPGCopyBinaryAppendInt32(osRow, -1);
+            continue;
+        }
+
+        const OGRField *psField = poFeature->GetRawFieldRef(i);
+        switch (eType)
+        {
+            case CopyBinaryType::INT2:
+            case CopyBinaryType::INT4:
+            case CopyBinaryType::INT8:
+                if (!AppendInteger(eType, poFeature->GetFieldAsInteger64(i)))
+                    return false;
+                break;
+
+            case CopyBinaryType::BOOL:
+            {
+                const int nVal = psField->Integer;
+                if (nVal != 0 && nVal != 1)
+                    return false;
+                OGRPGCopyBinaryAppendInt32(osRow, 1);
+                osRow += static_cast<char>(nVal);
+                break;
+            }
+
+            case CopyBinaryType::FLOAT4:
+            {
+                float fVal = static_cast<float>(psField->Real);
+                GInt32 nVal;
+                memcpy(&nVal, &fVal, sizeof(nVal));
+                OGRPGCopyBinaryAppendInt32(osRow, 4);
+                OGRPGCopyBinaryAppendInt32(osRow, nVal);
+                break;
+            }
+
+            case CopyBinaryType::FLOAT8:
+            {
+                GIntBig nVal;
+                memcpy(&nVal, &(psField->Real), sizeof(nVal));
+                OGRPGCopyBinaryAppendInt32(osRow, 8);
+                OGRPGCopyBinaryAppendInt64(osRow, nVal);
+                break;
+            }
+
+            case CopyBinaryType::NUMERIC:
+            {
+                // Infinity is only supported by numeric since PostgreSQL 14
+                if (poFeatureDefn->GetFieldDefn(i)->GetType() == OFTReal &&
+                    CPLIsInf(psField->Real))
+                    return false;
+                if (!OGRPGCopyBinaryAppendNumeric(
+                        osRow, poFeature->GetFieldAsString(i)))
+                    return false;
+                break;
+            }
+
+            case CopyBinaryType::TEXT:
+            case CopyBinaryType::JSONB:
+            {
+                const char *pszStrValue = psField->String;
+                size_t nLen = strlen(pszStrValue);
+                if (bCheckUTF8 &&
+                    !CPLIsUTF8(pszStrValue, static_cast<int>(nLen)))
+                    return false;
+
+                // Same truncation as the text COPY
+                const int nMaxWidth =
+                    poFeatureDefn->GetFieldDefn(i)->GetWidth();
+                if (nMaxWidth > 0)
+                {
+                    int iUTFChar = 0;
+                    for (size_t iChar = 0; iChar < nLen; iChar++)
+                    {
+                        if ((pszStrValue[iChar] & 0xc0) != 0x80)
+                        {
+                            if (iUTFChar == nMaxWidth)
+                            {
+                                CPLDebug("PG",
+                                         "Truncated %s field value, it was "
+                                         "too long.",
+                                         poFeatureDefn->GetFieldDefn(i)
+                                             ->GetNameRef());
+                                nLen = iChar;
+                                break;
+                            }
+                            iUTFChar++;
+                        }
+                    }
+                }
+                if (nLen >= static_cast<size_t>(INT_MAX))
+                    return false;
+
+                const bool bJSONB = eType == CopyBinaryType::JSONB;
+                OGRPGCopyBinaryAppendInt32(
+                    osRow, static_cast<GInt32>(nLen + (bJSONB ? 1 : 0)));
+                // jsonb binary format version
+                if (bJSONB)
+                    osRow += '\1';
+                osRow.append(pszStrValue, nLen);
+                break;
+            }
+
+            case CopyBinaryType::BYTEA:
+            {
+                OGRPGCopyBinaryAppendInt32(osRow, psField->Binary.nCount);
+                osRow.append(
+                    reinterpret_cast<const char *>(psField->Binary.paData),
+                    psField->Binary.nCount);
+                break;
+            }
+
+            case CopyBinaryType::DATE:
+            {
+                const GIntBig nDays =
+                    OGRPGDaysFromCivil(psField->Date.Year, psField->Date.Month,
+                                       psField->Date.Day) -
+                    PG_EPOCH_JDATE_OFFSET;
+                OGRPGCopyBinaryAppendInt32(osRow, 4);
+                OGRPGCopyBinaryAppendInt32(osRow, static_cast<GInt32>(nDays));
+                break;
+            }
+
+            case CopyBinaryType::TIME:
+            {
+                OGRPGCopyBinaryAppendInt32(osRow, 8);
+                OGRPGCopyBinaryAppendInt64(osRow, OGRPGTimeToUSecs(psField));
+                break;
+            }
+
+            case CopyBinaryType::TIMESTAMP:
+            case CopyBinaryType::TIMESTAMPTZ:
+            {
+                GIntBig nUSecs =
+                    (OGRPGDaysFromCivil(psField->Date.Year, psField->Date.Month,
+                                        psField->Date.Day) -
+                     PG_EPOCH_JDATE_OFFSET) *
+                        USECS_PER_DAY +
+                    OGRPGTimeToUSecs(psField);
+                if (eType == CopyBinaryType::TIMESTAMPTZ)
+                {
+                    // Unknown or local time zones are interpreted by the
+                    // server according to the session time zone.
+                    if (psField->Date.TZFlag < 100)
+                        return false;
+                    nUSecs -= static_cast<GIntBig>(psField->Date.TZFlag - 100) *
+                              15 * 60 * 1000000;
+                }
+                OGRPGCopyBinaryAppendInt32(osRow, 8);
+                OGRPGCopyBinaryAppendInt64(osRow, nUSecs);
+                break;
+            }
+
+            case CopyBinaryType::NONE:
+            case CopyBinaryType::GEOMETRY:
+            case CopyBinaryType::WKB:
+                return false;
+        }
+    }
+
+    return true;
+}
+
 /************************************************************************/
 /*                           TestCapability()                           */
 /************************************************************************/
@@ -3424,11 +4074,16 @@ OGRErr OGRPGTableLayer::StartCopy()
 
     CPLString osFields = BuildCopyFields();
 
+    m_bCopyBinary =
+        !m_bCopyBinaryDisabled &&
+        CPLTestBool(CPLGetConfigOption("PG_USE_COPY_BINARY", "NO")) &&
+        PrepareCopyBinary();
+
     size_t size = osFields.size() + strlen(pszSqlTableName) + 100;
     char *pszCommand = static_cast<char *>(CPLMalloc(size));
 
-    snprintf(pszCommand, size, "COPY %s (%s) FROM STDIN;", pszSqlTableName,
-             osFields.c_str());
+    snprintf(pszCommand, size, "COPY %s (%s) FROM STDIN%s;", pszSqlTableName,
+             osFields.c_str(), m_bCopyBinary ? " (FORMAT binary)" : "");
 
     PGconn *hPGConn = poDS->GetPGConn();
     PGresult *hResult = OGRPG_PQexec(hPGConn, pszCommand);
@@ -3436,9 +4091,25 @@ OGRErr OGRPGTableLayer::StartCopy()
     if (!hResult || (PQresultStatus(hResult) != PGRES_COPY_IN))
     {
         CPLError(CE_Failure, CPLE_AppDefined, "%s", PQerrorMessage(hPGConn));
+        m_bCopyBinary = false;
     }
     else
+    {
         bCopyActive = TRUE;
+        if (m_bCopyBinary)
+        {
+            // Signature, flags and header extension length
+            std::string osHeader("PGCOPY\n\377\r\n\0", 11);
+            OGRPGCopyBinaryAppendInt32(osHeader, 0);
+            OGRPGCopyBinaryAppendInt32(osHeader, 0);
+            if (PQputCopyData(hPGConn, osHeader.data(),
+                              static_cast<int>(osHeader.size())) != 1)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                         PQerrorMessage(hPGConn));
+            }
+        }
+    }
 
     OGRPGClearResult(hResult);
     CPLFree(pszCommand);
@@ -3466,6 +4137,21 @@ OGRErr OGRPGTableLayer::EndCopy()
 
     bCopyActive = FALSE;
 
+    if (m_bCopyBinary)
+    {
+        m_bCopyBinary = false;
+        // File trailer
+        std::string osTrailer;
+        OGRPGCopyBinaryAppendInt16(osTrailer, -1);
+        if (PQputCopyData(hPGConn, osTrailer.data(),
+                          static_cast<int>(osTrailer.size())) != 1)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                     PQerrorMessage(hPGConn));
+            result = OGRERR_FAILURE;
+        }
+    }
+
     int copyResult = PQputCopyEnd(hPGConn, nullptr);
 
     switch (copyResult)
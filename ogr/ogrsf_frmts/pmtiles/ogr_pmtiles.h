@@ -37,9 +37,12 @@
 
 #include "include_pmtiles.h"
 
+#include <deque>
 #include <limits>
+#include <memory>
 #include <set>
 #include <stack>
+#include <utility>
 
 // #define DEBUG_PMTILES
 
@@ -116,6 +119,24 @@ class OGRPMTilesDataset final : public GDALDataset
      */
     const std::string *ReadTileData(uint64_t nOffset, uint64_t nSize);
 
+    /** Read the decompressed data of several tiles, with a single
+     * multi-range request (done in parallel by network file systems).
+     * anOffsetSize is an array of (offset, size) pairs.
+     * Return false in case of error.
+     */
+    bool ReadTilesData(
+        const std::vector<std::pair<uint64_t, uint64_t>> &anOffsetSize,
+        std::vector<std::string> &aosData);
+
+    /** Return the entries of a directory, from a process-wide cache of
+     * decoded directories when possible, or nullptr in case of error.
+     * May throw an exception if the directory is corrupted.
+     */
+    std::shared_ptr<const std::vector<pmtiles::entryv3>>
+    ReadDirectory(uint64_t nOffset, uint64_t nSize, const char *pszDataType);
+
+    static void ClearDirectoryCache();
+
   private:
     VSIVirtualHandleUniquePtr m_poFile{};
 
@@ -131,6 +152,9 @@ class OGRPMTilesDataset final : public GDALDataset
     //! Value of the CLIP open option
     std::string m_osClipOpenOption{};
 
+    //! Prefix of the keys of this file in the directory cache
+    std::string m_osDirectoryCacheKey{};
+
     //! Decompressor for metadata and directories
     const CPLCompressor *m_psInternalDecompressor = nullptr;
 
@@ -157,6 +181,10 @@ class OGRPMTilesDataset final : public GDALDataset
                             uint64_t nOffset, uint64_t nSize,
                             const char *pszDataType);
 
+    bool Decompress(const CPLCompressor *psDecompressor,
+                    const std::string &osInput, std::string &osOutput,
+                    uint64_t nOffset, const char *pszDataType);
+
     CPL_DISALLOW_COPY_ASSIGN(OGRPMTilesDataset)
 };
 
@@ -223,8 +251,8 @@ class OGRPMTilesTileIterator
     struct DirectoryContext
     {
         // Entries, either tiles (sEntry.run_length > 0) or subdiretories
-        // (sEntry.run_length == 0)
-        std::vector<pmtiles::entryv3> sEntries{};
+        // (sEntry.run_length == 0). Shared with the directory cache.
+        std::shared_ptr<const std::vector<pmtiles::entryv3>> poEntries{};
 
         // Next index of sEntries[] to explore
         uint32_t nIdxInEntries = 0;
@@ -314,6 +342,15 @@ class OGRPMTilesVectorLayer final
     //! Offset of the currently opened tile
     uint64_t m_nLastTileOffset = 0;
 
+    struct PrefetchedTile
+    {
+        pmtiles::entry_zxy sTile{0, 0, 0, 0, 0};
+        std::string osData{};  // empty if same offset as the previous tile
+    };
+
+    //! Next tiles of m_poTileIterator, whose data has been read
+    std::deque<PrefetchedTile> m_aoPrefetchedTiles{};
+
     //! Uncompressed MVT tile
     std::string m_osTileData{};
 
@@ -347,6 +384,7 @@ class OGRPMTilesVectorLayer final
     //! Whether we should expose the tile fields in a "json" field
     bool m_bJsonField = false;
 
+    bool PrefetchTiles();
     std::unique_ptr<OGRFeature> GetNextSrcFeature();
     std::unique_ptr<OGRFeature> CreateFeatureFrom(OGRFeature *poSrcFeature);
     GIntBig GetTotalFeatureCount() const;
@@ -29,10 +29,26 @@
 #include "ogr_pmtiles.h"
 
 #include "cpl_json.h"
+#include "cpl_mem_cache.h"
 
 #include "mvtutils.h"
 
 #include <math.h>
+#include <mutex>
+
+/************************************************************************/
+/*                           Directory cache                            */
+/************************************************************************/
+
+// Process-wide cache of decoded directories, so that re-opening a file
+// (which /vsipmtiles/ does for each file access) or iterating again over
+// tiles does not re-read and re-decode them. Keys are made of the file
+// name, the raw header (which changes when the file is rewritten) and the
+// offset and size of the directory.
+static lru11::Cache<std::string,
+                    std::shared_ptr<const std::vector<pmtiles::entryv3>>,
+                    std::mutex>
+    goDirectoryCache{256, 0};
 
 /************************************************************************/
 /*                       ~OGRPMTilesDataset()                           */
@@ -136,6 +152,9 @@ bool OGRPMTilesDataset::Open(GDALOpenInfo *poOpenInfo)
     std::string osHeader;
     osHeader.assign(reinterpret_cast<const char *>(poOpenInfo->pabyHeader),
                     127);
+    m_osDirectoryCacheKey = poOpenInfo->pszFilename;
+    m_osDirectoryCacheKey += '\0';
+    m_osDirectoryCacheKey += osHeader;
     try
     {
         m_sHeader = pmtiles::deserialize_header(osHeader);
@@ -404,47 +423,63 @@ const std::string *OGRPMTilesDataset::Read(const CPLCompressor *psDecompressor,
 
     if (psDecompressor)
     {
-        m_osDecompressedBuffer.resize(32 + 16 * m_osBuffer.size());
-        for (int iTry = 0; iTry < 2; ++iTry)
+        if (!Decompress(psDecompressor, m_osBuffer, m_osDecompressedBuffer,
+                        nOffset, pszDataType))
+            return nullptr;
+        return &m_osDecompressedBuffer;
+    }
+    else
+    {
+        return &m_osBuffer;
+    }
+}
+
+/************************************************************************/
+/*                             Decompress()                             */
+/************************************************************************/
+
+bool OGRPMTilesDataset::Decompress(const CPLCompressor *psDecompressor,
+                                   const std::string &osInput,
+                                   std::string &osOutput, uint64_t nOffset,
+                                   const char *pszDataType)
+{
+    const size_t nSize = osInput.size();
+    osOutput.resize(32 + 16 * nSize);
+    for (int iTry = 0; iTry < 2; ++iTry)
+    {
+        void *pOutputData = &osOutput[0];
+        size_t nOutputSize = osOutput.size();
+        if (!psDecompressor->pfnFunc(osInput.data(), nSize, &pOutputData,
+                                     &nOutputSize, nullptr,
+                                     psDecompressor->user_data))
         {
-            void *pOutputData = &m_osDecompressedBuffer[0];
-            size_t nOutputSize = m_osDecompressedBuffer.size();
-            if (!psDecompressor->pfnFunc(m_osBuffer.data(), m_osBuffer.size(),
-                                         &pOutputData, &nOutputSize, nullptr,
-                                         psDecompressor->user_data))
+            if (iTry == 0)
             {
-                if (iTry == 0)
+                pOutputData = nullptr;
+                nOutputSize = 0;
+                if (psDecompressor->pfnFunc(osInput.data(), nSize,
+                                            &pOutputData, &nOutputSize,
+                                            nullptr, psDecompressor->user_data))
                 {
-                    pOutputData = nullptr;
-                    nOutputSize = 0;
-                    if (psDecompressor->pfnFunc(
-                            m_osBuffer.data(), m_osBuffer.size(), &pOutputData,
-                            &nOutputSize, nullptr, psDecompressor->user_data))
-                    {
-                        CPLDebug("PMTiles",
-                                 "Buffer of size %u uncompresses to %u bytes",
-                                 unsigned(nSize), unsigned(nOutputSize));
-                        m_osDecompressedBuffer.resize(nOutputSize);
-                        continue;
-                    }
+                    CPLDebug("PMTiles",
+                             "Buffer of size %u uncompresses to %u bytes",
+                             unsigned(nSize), unsigned(nOutputSize));
+                    osOutput.resize(nOutputSize);
+                    continue;
                 }
-
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Cannot decompress %s of length %u at "
-                         "offset " CPL_FRMT_GUIB,
-                         pszDataType, unsigned(nSize),
-                         static_cast<GUIntBig>(nOffset));
-                return nullptr;
             }
-            m_osDecompressedBuffer.resize(nOutputSize);
-            break;
+
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot decompress %s of length %u at "
+                     "offset " CPL_FRMT_GUIB,
+                     pszDataType, unsigned(nSize),
+                     static_cast<GUIntBig>(nOffset));
+            return false;
         }
-        return &m_osDecompressedBuffer;
-    }
-    else
-    {
-        return &m_osBuffer;
+        osOutput.resize(nOutputSize);
+        break;
     }
+    return true;
 }
 
 /************************************************************************/
@@ -467,3 +502,96 @@ const std::string *OGRPMTilesDataset::ReadTileData(uint64_t nOffset,
 {
     return Read(m_psTileDataDecompressor, nOffset, nSize, "tile data");
 }
+
+/************************************************************************/
+/*                            ReadTilesData()                           */
+/************************************************************************/
+
+bool OGRPMTilesDataset::ReadTilesData(
+    const std::vector<std::pair<uint64_t, uint64_t>> &anOffsetSize,
+    std::vector<std::string> &aosData)
+{
+    const size_t nCount = anOffsetSize.size();
+    std::vector<std::string> aosRawData(nCount);
+    std::vector<void *> apData(nCount);
+    std::vector<vsi_l_offset> anOffsets(nCount);
+    std::vector<size_t> anSizes(nCount);
+    for (size_t i = 0; i < nCount; ++i)
+    {
+        const uint64_t nOffset = anOffsetSize[i].first;
+        const uint64_t nSize = anOffsetSize[i].second;
+        if (nSize == 0 || nSize > 10 * 1024 * 1024)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Invalid amount of tile data to read: " CPL_FRMT_GUIB
+                     " bytes at offset " CPL_FRMT_GUIB,
+                     static_cast<GUIntBig>(nSize),
+                     static_cast<GUIntBig>(nOffset));
+            return false;
+        }
+        aosRawData[i].resize(static_cast<size_t>(nSize));
+        apData[i] = &aosRawData[i][0];
+        anOffsets[i] = nOffset;
+        anSizes[i] = static_cast<size_t>(nSize);
+    }
+    if (nCount == 0)
+        return true;
+
+    if (m_poFile->ReadMultiRange(static_cast<int>(nCount), apData.data(),
+                                 anOffsets.data(), anSizes.data()) != 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Cannot read tile data of %u tiles", unsigned(nCount));
+        return false;
+    }
+
+    aosData.resize(nCount);
+    for (size_t i = 0; i < nCount; ++i)
+    {
+        if (m_psTileDataDecompressor)
+        {
+            if (!Decompress(m_psTileDataDecompressor, aosRawData[i],
+                            aosData[i], anOffsets[i], "tile data"))
+                return false;
+        }
+        else
+        {
+            aosData[i] = std::move(aosRawData[i]);
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                            ReadDirectory()                           */
+/************************************************************************/
+
+std::shared_ptr<const std::vector<pmtiles::entryv3>>
+OGRPMTilesDataset::ReadDirectory(uint64_t nOffset, uint64_t nSize,
+                                 const char *pszDataType)
+{
+    std::string osKey(m_osDirectoryCacheKey);
+    osKey += CPLSPrintf("/" CPL_FRMT_GUIB "/" CPL_FRMT_GUIB,
+                        static_cast<GUIntBig>(nOffset),
+                        static_cast<GUIntBig>(nSize));
+    std::shared_ptr<const std::vector<pmtiles::entryv3>> poEntries;
+    if (goDirectoryCache.tryGet(osKey, poEntries))
+        return poEntries;
+
+    const auto *posStr = ReadInternal(nOffset, nSize, pszDataType);
+    if (!posStr)
+        return nullptr;
+    poEntries = std::make_shared<const std::vector<pmtiles::entryv3>>(
+        pmtiles::deserialize_directory(*posStr));
+    goDirectoryCache.insert(osKey, poEntries);
+    return poEntries;
+}
+
+/************************************************************************/
+/*                         ClearDirectoryCache()                        */
+/************************************************************************/
+
+void OGRPMTilesDataset::ClearDirectoryCache()
+{
+    goDirectoryCache.clear();
+}
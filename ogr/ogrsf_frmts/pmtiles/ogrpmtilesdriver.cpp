@@ -150,6 +150,15 @@ static GDALDataset *OGRPMTilesDriverCreate(const char *pszFilename, int nXSize,
 }
 #endif
 
+/************************************************************************/
+/*                        OGRPMTilesDriverUnload()                      */
+/************************************************************************/
+
+static void OGRPMTilesDriverUnload(GDALDriver *)
+{
+    OGRPMTilesDataset::ClearDirectoryCache();
+}
+
 /************************************************************************/
 /*                          RegisterOGRPMTiles()                        */
 /************************************************************************/
@@ -191,6 +200,7 @@ void RegisterOGRPMTiles()
     poDriver->SetMetadataItem(GDAL_DCAP_VIRTUALIO, "YES");
 
     poDriver->pfnOpen = OGRPMTilesDriverOpen;
+    poDriver->pfnUnloadDriver = OGRPMTilesDriverUnload;
     poDriver->pfnIdentify = OGRPMTilesDriverIdentify;
     poDriver->pfnCanVectorTranslateFrom =
         OGRPMTilesDriverCanVectorTranslateFrom;
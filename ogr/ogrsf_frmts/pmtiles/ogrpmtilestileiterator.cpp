@@ -124,17 +124,15 @@ bool OGRPMTilesTileIterator::LoadRootDirectory()
     }
 
     const auto &sHeader = m_poDS->GetHeader();
-    const auto *posStr = m_poDS->ReadInternal(
+    DirectoryContext sContext;
+    sContext.poEntries = m_poDS->ReadDirectory(
         sHeader.root_dir_offset, static_cast<uint32_t>(sHeader.root_dir_bytes),
         "header");
-    if (!posStr)
+    if (!sContext.poEntries)
     {
         return false;
     }
 
-    DirectoryContext sContext;
-    sContext.sEntries = pmtiles::deserialize_directory(*posStr);
-
     if (m_nZoomLevel >= 0)
     {
         if (m_nCurX >= 0)
@@ -142,7 +140,7 @@ bool OGRPMTilesTileIterator::LoadRootDirectory()
             while (true)
             {
                 const int nMinEntryIdx = find_tile_idx_lesser_or_equal(
-                    sContext.sEntries, m_nMinTileId);
+                    *sContext.poEntries, m_nMinTileId);
                 if (nMinEntryIdx < 0)
                 {
                     m_nCurX++;
@@ -168,8 +166,8 @@ bool OGRPMTilesTileIterator::LoadRootDirectory()
         }
         else
         {
-            const int nMinEntryIdx =
-                find_tile_idx_lesser_or_equal(sContext.sEntries, m_nMinTileId);
+            const int nMinEntryIdx = find_tile_idx_lesser_or_equal(
+                *sContext.poEntries, m_nMinTileId);
             if (nMinEntryIdx < 0)
             {
                 return false;
@@ -191,10 +189,10 @@ void OGRPMTilesTileIterator::SkipRunLength()
     if (!m_aoStack.empty())
     {
         auto &topContext = m_aoStack.top();
-        if (topContext.nIdxInEntries < topContext.sEntries.size())
+        if (topContext.nIdxInEntries < topContext.poEntries->size())
         {
             const auto &sCurrentEntry =
-                topContext.sEntries[topContext.nIdxInEntries];
+                (*topContext.poEntries)[topContext.nIdxInEntries];
             if (sCurrentEntry.run_length > 1)
             {
                 m_nLastTileId =
@@ -255,7 +253,7 @@ pmtiles::entry_zxy OGRPMTilesTileIterator::GetNextTile(uint32_t *pnRunLength)
                         while (m_aoStack.size() > 1)
                             m_aoStack.pop();
                         const int nMinEntryIdx = find_tile_idx_lesser_or_equal(
-                            m_aoStack.top().sEntries, m_nMinTileId);
+                            *m_aoStack.top().poEntries, m_nMinTileId);
                         if (nMinEntryIdx < 0)
                         {
                             continue;
@@ -273,7 +271,7 @@ pmtiles::entry_zxy OGRPMTilesTileIterator::GetNextTile(uint32_t *pnRunLength)
         while (true)
         {
             if (m_aoStack.top().nIdxInEntries ==
-                m_aoStack.top().sEntries.size())
+                m_aoStack.top().poEntries->size())
             {
                 if (m_aoStack.size() == 1 && AdvanceToNextTile())
                     continue;
@@ -285,7 +283,7 @@ pmtiles::entry_zxy OGRPMTilesTileIterator::GetNextTile(uint32_t *pnRunLength)
             }
             auto &topContext = m_aoStack.top();
             const auto &sCurrentEntry =
-                topContext.sEntries[topContext.nIdxInEntries];
+                (*topContext.poEntries)[topContext.nIdxInEntries];
             if (sCurrentEntry.run_length == 0)
             {
                 // Arbitrary limit. 5 seems to be the maximum value supported
@@ -306,10 +304,12 @@ pmtiles::entry_zxy OGRPMTilesTileIterator::GetNextTile(uint32_t *pnRunLength)
                              "Invalid directory offset");
                     break;
                 }
-                const auto *posStr = m_poDS->ReadInternal(
+
+                DirectoryContext sContext;
+                sContext.poEntries = m_poDS->ReadDirectory(
                     sHeader.leaf_dirs_offset + sCurrentEntry.offset,
                     sCurrentEntry.length, "directory");
-                if (!posStr)
+                if (!sContext.poEntries)
                 {
                     m_bEOF = true;
                     CPLError(
@@ -323,9 +323,8 @@ pmtiles::entry_zxy OGRPMTilesTileIterator::GetNextTile(uint32_t *pnRunLength)
                     break;
                 }
 
-                DirectoryContext sContext;
-                sContext.sEntries = pmtiles::deserialize_directory(*posStr);
-                if (sContext.sEntries.empty())
+                const auto &sEntries = *sContext.poEntries;
+                if (sEntries.empty())
                 {
                     m_bEOF = true;
                     // In theory empty directories could exist, but for now
@@ -337,7 +336,7 @@ pmtiles::entry_zxy OGRPMTilesTileIterator::GetNextTile(uint32_t *pnRunLength)
                 }
 
                 if (m_nLastTileId != INVALID_LAST_TILE_ID &&
-                    sContext.sEntries[0].tile_id <= m_nLastTileId)
+                    sEntries[0].tile_id <= m_nLastTileId)
                 {
                     m_bEOF = true;
                     CPLError(CE_Failure, CPLE_AppDefined,
@@ -348,7 +347,7 @@ pmtiles::entry_zxy OGRPMTilesTileIterator::GetNextTile(uint32_t *pnRunLength)
                 if (m_nZoomLevel >= 0)
                 {
                     const int nMinEntryIdx = find_tile_idx_lesser_or_equal(
-                        sContext.sEntries, m_nMinTileId);
+                        sEntries, m_nMinTileId);
                     if (nMinEntryIdx < 0)
                     {
                         if (AdvanceToNextTile())
@@ -357,8 +356,7 @@ pmtiles::entry_zxy OGRPMTilesTileIterator::GetNextTile(uint32_t *pnRunLength)
                     }
                     sContext.nIdxInEntries = nMinEntryIdx;
                 }
-                m_nLastTileId =
-                    sContext.sEntries[sContext.nIdxInEntries].tile_id;
+                m_nLastTileId = sEntries[sContext.nIdxInEntries].tile_id;
 
                 m_aoStack.emplace(std::move(sContext));
 
@@ -31,6 +31,7 @@
 #include "mvtutils.h"
 
 #include <algorithm>
+#include <map>
 #include <time.h>
 
 /************************************************************************/
@@ -118,6 +119,7 @@ void OGRPMTilesVectorLayer::ResetReading()
     m_poTileDS.reset();
     m_poTileLayer = nullptr;
     m_poTileIterator.reset();
+    m_aoPrefetchedTiles.clear();
 }
 
 /************************************************************************/
@@ -342,6 +344,69 @@ OGRFeature *OGRPMTilesVectorLayer::GetFeature(GIntBig nFID)
     return poFeature.release();
 }
 
+/************************************************************************/
+/*                           PrefetchTiles()                            */
+/************************************************************************/
+
+// Fetch the next tiles of the iterator, so that their data is read with a
+// single multi-range request, instead of one request per tile.
+bool OGRPMTilesVectorLayer::PrefetchTiles()
+{
+    constexpr size_t MAX_PREFETCHED_TILES = 64;
+    constexpr uint64_t MAX_PREFETCHED_BYTES = 10 * 1024 * 1024;
+
+    std::vector<std::pair<uint64_t, uint64_t>> anOffsetSize;
+    std::vector<size_t> anRangeIdx;
+    std::map<uint64_t, size_t> oMapOffsetToRangeIdx;
+    uint64_t nTotalSize = 0;
+    uint64_t nPrevOffset = m_nLastTileOffset;
+    while (m_aoPrefetchedTiles.size() < MAX_PREFETCHED_TILES &&
+           nTotalSize < MAX_PREFETCHED_BYTES)
+    {
+        const auto sTile = m_poTileIterator->GetNextTile();
+        if (sTile.offset == 0)
+            break;
+
+        PrefetchedTile oTile;
+        oTile.sTile = sTile;
+        m_aoPrefetchedTiles.push_back(std::move(oTile));
+        if (sTile.offset == nPrevOffset)
+        {
+            // In case of run-length encoded tiles, we do not need to
+            // re-read it
+            anRangeIdx.push_back(std::numeric_limits<size_t>::max());
+            continue;
+        }
+        nPrevOffset = sTile.offset;
+
+        const auto oIter = oMapOffsetToRangeIdx.find(sTile.offset);
+        if (oIter != oMapOffsetToRangeIdx.end())
+        {
+            anRangeIdx.push_back(oIter->second);
+        }
+        else
+        {
+            oMapOffsetToRangeIdx[sTile.offset] = anOffsetSize.size();
+            anRangeIdx.push_back(anOffsetSize.size());
+            anOffsetSize.emplace_back(sTile.offset, sTile.length);
+            nTotalSize += sTile.length;
+        }
+    }
+
+    std::vector<std::string> aosData;
+    if (!m_poDS->ReadTilesData(anOffsetSize, aosData))
+    {
+        m_aoPrefetchedTiles.clear();
+        return false;
+    }
+    for (size_t i = 0; i < anRangeIdx.size(); ++i)
+    {
+        if (anRangeIdx[i] != std::numeric_limits<size_t>::max())
+            m_aoPrefetchedTiles[i].osData = aosData[anRangeIdx[i]];
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                        GetNextSrcFeature()                           */
 /************************************************************************/
@@ -378,11 +443,14 @@ std::unique_ptr<OGRFeature> OGRPMTilesVectorLayer::GetNextSrcFeature()
 
         while (true)
         {
-            const auto sTile = m_poTileIterator->GetNextTile();
-            if (sTile.offset == 0)
+            if (m_aoPrefetchedTiles.empty() &&
+                (!PrefetchTiles() || m_aoPrefetchedTiles.empty()))
             {
                 return nullptr;
             }
+            PrefetchedTile oTile = std::move(m_aoPrefetchedTiles.front());
+            m_aoPrefetchedTiles.pop_front();
+            const auto &sTile = oTile.sTile;
 
             m_nX = sTile.x;
             m_nY = sTile.y;
@@ -397,14 +465,7 @@ std::unique_ptr<OGRFeature> OGRPMTilesVectorLayer::GetNextSrcFeature()
                 m_nLastTileOffset = sTile.offset;
                 CPLDebugOnly("PMTiles", "Opening tile X=%u, Y=%u, Z=%d",
                              sTile.x, sTile.y, m_nZoomLevel);
-
-                const auto *posStr =
-                    m_poDS->ReadTileData(sTile.offset, sTile.length);
-                if (!posStr)
-                {
-                    return nullptr;
-                }
-                m_osTileData = *posStr;
+                m_osTileData = std::move(oTile.osData);
             }
 
             m_poTileDS.reset();
@@ -40,6 +40,7 @@
 #include "shapefil.h"
 #include "shp_vsi.h"
 #include "ogrlayerpool.h"
+#include <memory>
 #include <set>
 #include <vector>
 
@@ -55,9 +56,14 @@
 OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
                               OGRFeatureDefn *poDefn, int iShape,
                               SHPObject *psShape, const char *pszSHPEncoding,
-                              bool &bHasWarnedWrongWindingOrder);
+                              bool &bHasWarnedWrongWindingOrder,
+                              OGRFeature *poFeatureToReuse = nullptr);
 OGRGeometry *SHPReadOGRObject(SHPHandle hSHP, int iShape, SHPObject *psShape,
                               bool &bHasWarnedWrongWindingOrder);
+OGRGeometry *SHPReadOGRGeometry(SHPHandle hSHP, int iShape, SHPObject *psShape,
+                                OGRwkbGeometryType eLayerGeomType,
+                                bool &bHasWarnedWrongWindingOrder);
+void SHPParseOGRDate(const char *pszDateValue, OGRField *psField);
 OGRFeatureDefn *SHPReadOGRFeatureDefn(const char *pszName, SHPHandle hSHP,
                                       DBFHandle hDBF,
                                       const char *pszSHPEncoding,
@@ -66,6 +72,12 @@ OGRErr SHPWriteOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
                           OGRFeatureDefn *poFeatureDefn, OGRFeature *poFeature,
                           const char *pszSHPEncoding,
                           bool *pbTruncationWarningEmitted, bool bRewind);
+OGRErr SHPWriteOGRRecord(SHPHandle hSHP, DBFHandle hDBF,
+                         OGRFeatureDefn *poFeatureDefn, GIntBig &nFID,
+                         const OGRGeometry *poGeom,
+                         const OGRField *const *papsFields,
+                         const char *pszSHPEncoding,
+                         bool *pbTruncationWarningEmitted, bool bRewind);
 
 /************************************************************************/
 /*                         OGRShapeGeomFieldDefn                        */
@@ -116,6 +128,8 @@ class OGRShapeGeomFieldDefn final : public OGRGeomFieldDefn
 /************************************************************************/
 
 class OGRShapeDataSource;
+class OGRShapeReadAhead;
+class OGRSidecarSpatialIndex;
 
 class OGRShapeLayer final : public OGRAbstractProxiedLayer
 {
@@ -136,6 +150,7 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
 
     OGRwkbGeometryType eRequestedGeomType;
     int ResetGeomType(int nNewType);
+    void SetGeomTypeFromFirstGeometry(const OGRGeometry *poGeom);
 
     bool ScanIndices();
 
@@ -158,6 +173,12 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
     SBNSearchHandle hSBN;
     bool CheckForSBN();
 
+    // Packed Hilbert index, as <file>.shp.ogrsidx
+    bool m_bCheckedForSidecarIndex = false;
+    std::unique_ptr<OGRSidecarSpatialIndex> m_poSidecarIndex{};
+    bool CheckForSidecarIndex();
+    void InvalidateSidecarIndex();
+
     bool bSbnSbxDeleted;
 
     CPLString ConvertCodePage(const char *);
@@ -191,6 +212,12 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
     bool m_bHasWarnedWrongWindingOrder = false;
     bool m_bLastGetNextArrowArrayUsedOptimizedCodePath = false;
 
+    // Background decoding of records for sequential reads.
+    int m_nReadAheadThreads = 0;
+    bool m_bReadAheadAborted = false;
+    std::unique_ptr<OGRShapeReadAhead> m_poReadAhead{};
+    void StopReadAhead();
+
     bool m_bAutoRepack;
 
     typedef enum
@@ -216,6 +243,7 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
 
   public:
     OGRErr CreateSpatialIndex(int nMaxDepth);
+    OGRErr CreatePackedSpatialIndex();
     OGRErr DropSpatialIndex();
     OGRErr Repack();
     OGRErr RecomputeExtent();
@@ -233,7 +261,8 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
 
     void UpdateFollowingDeOrRecompression();
 
-    OGRFeature *FetchShape(int iShapeId);
+    OGRFeature *FetchShape(int iShapeId, OGRFeature *poFeatureToReuse);
+    OGRFeature *GetNextFeatureInternal(OGRFeature *poFeatureToReuse);
     int GetFeatureCountWithSpatialFilterOnly();
 
     OGRShapeLayer(OGRShapeDataSource *poDSIn, const char *pszName,
@@ -248,6 +277,7 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
 
     void ResetReading() override;
     OGRFeature *GetNextFeature() override;
+    bool GetNextFeatureInto(OGRFeature &oFeature) override;
     OGRErr SetNextByIndex(GIntBig nIndex) override;
 
     int GetNextArrowArray(struct ArrowArrayStream *,
@@ -259,6 +289,9 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
     OGRErr ISetFeature(OGRFeature *poFeature) override;
     OGRErr DeleteFeature(GIntBig nFID) override;
     OGRErr ICreateFeature(OGRFeature *poFeature) override;
+    bool WriteArrowBatch(const struct ArrowSchema *schema,
+                         struct ArrowArray *array,
+                         CSLConstList papszOptions = nullptr) override;
     OGRErr SyncToDisk() override;
 
     OGRFeatureDefn *GetLayerDefn() override
@@ -296,6 +329,7 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
     }
 
     OGRErr SetAttributeFilter(const char *) override;
+    OGRErr SetIgnoredFields(CSLConstList papszFields) override;
 
     OGRErr Rename(const char *pszNewName) override;
 
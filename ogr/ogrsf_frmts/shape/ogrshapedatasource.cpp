@@ -1089,7 +1089,7 @@ OGRLayer *OGRShapeDataSource::GetLayerByName(const char *pszLayerNameIn)
 /*      We override this to provide special handling of CREATE          */
 /*      SPATIAL INDEX commands.  Support forms are:                     */
 /*                                                                      */
-/*        CREATE SPATIAL INDEX ON layer_name [DEPTH n]                  */
+/*        CREATE SPATIAL INDEX ON layer_name [DEPTH n | PACKED]         */
 /*        DROP SPATIAL INDEX ON layer_name                              */
 /*        REPACK layer_name                                             */
 /*        RECOMPUTE EXTENT ON layer_name                                */
@@ -1227,14 +1227,15 @@ OGRLayer *OGRShapeDataSource::ExecuteSQL(const char *pszStatement,
     if (CSLCount(papszTokens) < 5 || !EQUAL(papszTokens[0], "CREATE") ||
         !EQUAL(papszTokens[1], "SPATIAL") || !EQUAL(papszTokens[2], "INDEX") ||
         !EQUAL(papszTokens[3], "ON") || CSLCount(papszTokens) > 7 ||
-        (CSLCount(papszTokens) == 7 && !EQUAL(papszTokens[5], "DEPTH")))
+        (CSLCount(papszTokens) == 7 && !EQUAL(papszTokens[5], "DEPTH")) ||
+        (CSLCount(papszTokens) == 6 && !EQUAL(papszTokens[5], "PACKED")))
     {
         CSLDestroy(papszTokens);
         CPLError(CE_Failure, CPLE_AppDefined,
                  "Syntax error in CREATE SPATIAL INDEX command.\n"
                  "Was '%s'\n"
                  "Should be of form 'CREATE SPATIAL INDEX ON <table> "
-                 "[DEPTH <n>]'",
+                 "[DEPTH <n> | PACKED]'",
                  pszStatement);
         return nullptr;
     }
@@ -1243,6 +1244,7 @@ OGRLayer *OGRShapeDataSource::ExecuteSQL(const char *pszStatement,
     /*      Get depth if provided.                                          */
     /* -------------------------------------------------------------------- */
     const int nDepth = CSLCount(papszTokens) == 7 ? atoi(papszTokens[6]) : 0;
+    const bool bPacked = CSLCount(papszTokens) == 6;
 
     /* -------------------------------------------------------------------- */
     /*      What layer are we operating on.                                 */
@@ -1260,7 +1262,10 @@ OGRLayer *OGRShapeDataSource::ExecuteSQL(const char *pszStatement,
 
     CSLDestroy(papszTokens);
 
-    poLayer->CreateSpatialIndex(nDepth);
+    if (bPacked)
+        poLayer->CreatePackedSpatialIndex();
+    else
+        poLayer->CreateSpatialIndex(nDepth);
     return nullptr;
 }
 
@@ -30,6 +30,7 @@
 #include "ogrshape.h"
 
 #include <cerrno>
+#include <climits>
 #include <limits>
 #include <cstddef>
 #include <cstdio>
@@ -37,15 +38,25 @@
 #include <cstring>
 #include <ctime>
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_multiproc.h"
 #include "cpl_port.h"
 #include "cpl_string.h"
 #include "cpl_time.h"
 #include "cpl_vsi.h"
+#include "cpl_vsi_virtual.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
 #include "ogr_geometry.h"
@@ -54,10 +65,384 @@
 #include "ogr_srs_api.h"
 #include "ogrlayerpool.h"
 #include "ograrrowarrayhelper.h"
+#include "ogrlayerarrow.h"
+#include "ogr_spatialind.h"
 #include "ogrsf_frmts.h"
 #include "shapefil.h"
 #include "shp_vsi.h"
 
+/************************************************************************/
+/*                          OGRShapeReadAhead                           */
+/*                                                                      */
+/*      Decodes the records following the current read position in     */
+/*      chunks on the global thread pool, so that a sequential scan     */
+/*      on the calling thread only has to pick up translated features.  */
+/*      Each worker reads through its own .shp/.dbf handles, and asks   */
+/*      for the byte range of a whole chunk before decoding it, which   */
+/*      turns per-record reads into large ones on network file systems. */
+/************************************************************************/
+
+class OGRShapeReadAhead
+{
+  public:
+    struct Chunk
+    {
+        OGRShapeReadAhead *poReadAhead = nullptr;
+        int nFirstShapeId = 0;
+        int nShapeCount = 0;
+        // One entry per record read. nullptr for deleted records.
+        std::vector<std::unique_ptr<OGRFeature>> apoFeatures{};
+        // Set if reading stopped before nShapeCount records.
+        bool bIOError = false;
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+        bool bDone = false;
+    };
+
+    static std::unique_ptr<OGRShapeReadAhead>
+    Create(OGRShapeDataSource *poDS, SHPHandle hSHP, DBFHandle hDBF,
+           OGRFeatureDefn *poFeatureDefn, const CPLString &osEncoding,
+           int nTotalShapeCount, int iStartShapeId, int nThreads,
+           bool bHasWarnedWrongWindingOrder);
+
+    ~OGRShapeReadAhead();
+
+    bool GetNext(int &iShapeId, std::unique_ptr<OGRFeature> &poFeature);
+
+    bool HasWarnedWrongWindingOrder() const
+    {
+        return m_bHasWarnedWrongWindingOrder;
+    }
+
+  private:
+    static constexpr int CHUNK_SIZE = 1000;
+
+    struct Handles
+    {
+        SHPHandle hSHP = nullptr;
+        DBFHandle hDBF = nullptr;
+    };
+
+    OGRShapeDataSource *m_poDS = nullptr;
+    OGRFeatureDefn *m_poFeatureDefn = nullptr;
+    std::string m_osSHPFilename{};
+    std::string m_osDBFFilename{};
+    CPLString m_osEncoding{};
+    int m_nTotalShapeCount = 0;
+    int m_iNextShapeIdToSubmit = 0;
+    size_t m_nMaxChunksInFlight = 0;
+    size_t m_iNextInFrontChunk = 0;
+    bool m_bEOF = false;
+    std::atomic<bool> m_bHasWarnedWrongWindingOrder{false};
+
+    std::unique_ptr<CPLJobQueue> m_poJobQueue{};
+    std::deque<std::unique_ptr<Chunk>> m_apoChunks{};
+    std::vector<Handles> m_asFreeHandles{};
+
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+
+    OGRShapeReadAhead() = default;
+    CPL_DISALLOW_COPY_ASSIGN(OGRShapeReadAhead)
+
+    void SubmitChunks();
+    bool AcquireHandles(Handles &sHandles);
+    void ReleaseHandles(const Handles &sHandles);
+    static void AdviseRead(VSILFILE *fp, vsi_l_offset nStart, size_t nSize);
+    static void ProcessChunk(void *pData);
+};
+
+/************************************************************************/
+/*                     OGRShapeReadAhead::Create()                      */
+/************************************************************************/
+
+std::unique_ptr<OGRShapeReadAhead> OGRShapeReadAhead::Create(
+    OGRShapeDataSource *poDS, SHPHandle hSHP, DBFHandle hDBF,
+    OGRFeatureDefn *poFeatureDefn, const CPLString &osEncoding,
+    int nTotalShapeCount, int iStartShapeId, int nThreads,
+    bool bHasWarnedWrongWindingOrder)
+{
+    CPLWorkerThreadPool *poPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poPool)
+        return nullptr;
+    auto poJobQueue = poPool->CreateJobQueue();
+    if (!poJobQueue)
+        return nullptr;
+
+    auto poReadAhead =
+        std::unique_ptr<OGRShapeReadAhead>(new OGRShapeReadAhead());
+    poReadAhead->m_poDS = poDS;
+    poReadAhead->m_poFeatureDefn = poFeatureDefn;
+    poFeatureDefn->Reference();
+    if (hSHP)
+        poReadAhead->m_osSHPFilename = VSI_SHP_GetFilename(hSHP->fpSHP);
+    if (hDBF)
+        poReadAhead->m_osDBFFilename = VSI_SHP_GetFilename(hDBF->fp);
+    poReadAhead->m_osEncoding = osEncoding;
+    poReadAhead->m_nTotalShapeCount = nTotalShapeCount;
+    poReadAhead->m_iNextShapeIdToSubmit = iStartShapeId;
+    poReadAhead->m_bHasWarnedWrongWindingOrder = bHasWarnedWrongWindingOrder;
+    poReadAhead->m_poJobQueue = std::move(poJobQueue);
+    // Keep enough work queued to avoid workers starving while the
+    // calling thread consumes features.
+    poReadAhead->m_nMaxChunksInFlight = 2 * static_cast<size_t>(nThreads);
+    poReadAhead->SubmitChunks();
+    return poReadAhead;
+}
+
+/************************************************************************/
+/*                    ~OGRShapeReadAhead()                              */
+/************************************************************************/
+
+OGRShapeReadAhead::~OGRShapeReadAhead()
+{
+    if (m_poJobQueue)
+        m_poJobQueue->WaitCompletion();
+    m_apoChunks.clear();
+    for (const auto &sHandles : m_asFreeHandles)
+    {
+        if (sHandles.hSHP)
+            SHPClose(sHandles.hSHP);
+        if (sHandles.hDBF)
+            DBFClose(sHandles.hDBF);
+    }
+    if (m_poFeatureDefn)
+        m_poFeatureDefn->Release();
+}
+
+/************************************************************************/
+/*                  OGRShapeReadAhead::SubmitChunks()                   */
+/************************************************************************/
+
+void OGRShapeReadAhead::SubmitChunks()
+{
+    while (!m_bEOF && m_iNextShapeIdToSubmit < m_nTotalShapeCount &&
+           m_apoChunks.size() < m_nMaxChunksInFlight)
+    {
+        auto poChunk = std::make_unique<Chunk>();
+        poChunk->poReadAhead = this;
+        poChunk->nFirstShapeId = m_iNextShapeIdToSubmit;
+        poChunk->nShapeCount =
+            std::min(CHUNK_SIZE, m_nTotalShapeCount - m_iNextShapeIdToSubmit);
+        m_iNextShapeIdToSubmit += poChunk->nShapeCount;
+        Chunk *poChunkPtr = poChunk.get();
+        m_apoChunks.push_back(std::move(poChunk));
+        if (!m_poJobQueue->SubmitJob(ProcessChunk, poChunkPtr))
+            ProcessChunk(poChunkPtr);
+    }
+}
+
+/************************************************************************/
+/*                 OGRShapeReadAhead::AcquireHandles()                  */
+/************************************************************************/
+
+bool OGRShapeReadAhead::AcquireHandles(Handles &sHandles)
+{
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        if (!m_asFreeHandles.empty())
+        {
+            sHandles = m_asFreeHandles.back();
+            m_asFreeHandles.pop_back();
+            return true;
+        }
+    }
+
+    if (!m_osSHPFilename.empty())
+    {
+        sHandles.hSHP = m_poDS->DS_SHPOpen(m_osSHPFilename.c_str(), "r");
+        if (!sHandles.hSHP)
+            return false;
+    }
+    if (!m_osDBFFilename.empty())
+    {
+        sHandles.hDBF = m_poDS->DS_DBFOpen(m_osDBFFilename.c_str(), "r");
+        if (!sHandles.hDBF)
+        {
+            if (sHandles.hSHP)
+                SHPClose(sHandles.hSHP);
+            sHandles.hSHP = nullptr;
+            return false;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                 OGRShapeReadAhead::ReleaseHandles()                  */
+/************************************************************************/
+
+void OGRShapeReadAhead::ReleaseHandles(const Handles &sHandles)
+{
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    m_asFreeHandles.push_back(sHandles);
+}
+
+/************************************************************************/
+/*                   OGRShapeReadAhead::AdviseRead()                    */
+/************************************************************************/
+
+void OGRShapeReadAhead::AdviseRead(VSILFILE *fp, vsi_l_offset nStart,
+                                   size_t nSize)
+{
+    const size_t nLimit = fp->GetAdviseReadTotalBytesLimit();
+    if (nLimit == 0 || nSize <= nLimit)
+        fp->AdviseRead(1, &nStart, &nSize);
+}
+
+/************************************************************************/
+/*                  OGRShapeReadAhead::ProcessChunk()                   */
+/************************************************************************/
+
+void OGRShapeReadAhead::ProcessChunk(void *pData)
+{
+    Chunk *poChunk = static_cast<Chunk *>(pData);
+    OGRShapeReadAhead *poReadAhead = poChunk->poReadAhead;
+
+    CPLInstallErrorHandlerAccumulator(poChunk->aoErrors);
+
+    Handles sHandles;
+    if (!poReadAhead->AcquireHandles(sHandles))
+    {
+        poChunk->bIOError = true;
+    }
+    else
+    {
+        const int nFirst = poChunk->nFirstShapeId;
+        const int nLast = nFirst + poChunk->nShapeCount - 1;
+        SHPHandle hSHP = sHandles.hSHP;
+        DBFHandle hDBF = sHandles.hDBF;
+
+        // Let the file system fetch the records of the chunk at once.
+        // With lazy .shx loading, offsets of records not read yet are 0.
+        if (hSHP && nLast < hSHP->nRecords && hSHP->panRecOffset &&
+            hSHP->panRecSize)
+        {
+            vsi_l_offset nStart = hSHP->panRecOffset[nFirst];
+            vsi_l_offset nEnd = nStart;
+            for (int i = nFirst; i <= nLast && nStart != 0; ++i)
+            {
+                const vsi_l_offset nOffset = hSHP->panRecOffset[i];
+                nStart = std::min(nStart, nOffset);
+                nEnd = std::max(nEnd, nOffset + hSHP->panRecSize[i] + 8);
+            }
+            if (nStart != 0)
+            {
+                const size_t nSize = static_cast<size_t>(nEnd - nStart);
+                AdviseRead(VSI_SHP_GetVSIL(hSHP->fpSHP), nStart, nSize);
+            }
+        }
+        if (hDBF && nLast < hDBF->nRecords)
+        {
+            const vsi_l_offset nStart =
+                hDBF->nHeaderLength +
+                static_cast<vsi_l_offset>(nFirst) * hDBF->nRecordLength;
+            const size_t nSize = static_cast<size_t>(poChunk->nShapeCount) *
+                                 hDBF->nRecordLength;
+            AdviseRead(VSI_SHP_GetVSIL(hDBF->fp), nStart, nSize);
+        }
+
+        bool bHasWarnedWrongWindingOrder =
+            poReadAhead->m_bHasWarnedWrongWindingOrder;
+        poChunk->apoFeatures.reserve(poChunk->nShapeCount);
+        for (int iShapeId = nFirst; iShapeId <= nLast; ++iShapeId)
+        {
+            OGRFeature *poFeature = nullptr;
+            if (hDBF)
+            {
+                if (DBFIsRecordDeleted(hDBF, iShapeId))
+                {
+                    poChunk->apoFeatures.emplace_back(nullptr);
+                    continue;
+                }
+                if (VSIFEofL(VSI_SHP_GetVSIL(hDBF->fp)) ||
+                    VSIFErrorL(VSI_SHP_GetVSIL(hDBF->fp)))
+                {
+                    poChunk->bIOError = true;
+                    break;
+                }
+            }
+            poFeature = SHPReadOGRFeature(
+                hSHP, hDBF, poReadAhead->m_poFeatureDefn, iShapeId, nullptr,
+                poReadAhead->m_osEncoding, bHasWarnedWrongWindingOrder);
+            poChunk->apoFeatures.emplace_back(poFeature);
+        }
+        if (bHasWarnedWrongWindingOrder)
+            poReadAhead->m_bHasWarnedWrongWindingOrder = true;
+
+        if (hDBF)
+            VSIFClearErrL(VSI_SHP_GetVSIL(hDBF->fp));
+        poReadAhead->ReleaseHandles(sHandles);
+    }
+
+    CPLUninstallErrorHandlerAccumulator();
+
+    std::lock_guard<std::mutex> oLock(poReadAhead->m_oMutex);
+    poChunk->bDone = true;
+    poReadAhead->m_oCV.notify_one();
+}
+
+/************************************************************************/
+/*                     OGRShapeReadAhead::GetNext()                     */
+/*                                                                      */
+/*      Returns the next record in sequence. poFeature is set to        */
+/*      nullptr for a deleted record. Returns false at the end of the   */
+/*      layer or after a read error, with iShapeId set to the first     */
+/*      record that was not returned.                                   */
+/************************************************************************/
+
+bool OGRShapeReadAhead::GetNext(int &iShapeId,
+                                std::unique_ptr<OGRFeature> &poFeature)
+{
+    while (true)
+    {
+        if (m_apoChunks.empty())
+        {
+            iShapeId = m_iNextShapeIdToSubmit;
+            return false;
+        }
+
+        Chunk *poChunk = m_apoChunks.front().get();
+        if (m_iNextInFrontChunk == 0)
+        {
+            {
+                std::unique_lock<std::mutex> oLock(m_oMutex);
+                while (!poChunk->bDone)
+                    m_oCV.wait(oLock);
+            }
+            for (const auto &oError : poChunk->aoErrors)
+            {
+                CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+            }
+            poChunk->aoErrors.clear();
+        }
+
+        if (m_iNextInFrontChunk < poChunk->apoFeatures.size())
+        {
+            iShapeId =
+                poChunk->nFirstShapeId + static_cast<int>(m_iNextInFrontChunk);
+            poFeature = std::move(poChunk->apoFeatures[m_iNextInFrontChunk]);
+            ++m_iNextInFrontChunk;
+            return true;
+        }
+
+        if (poChunk->bIOError)
+        {
+            // Do not go past a record that could not be read
+            iShapeId = poChunk->nFirstShapeId +
+                       static_cast<int>(poChunk->apoFeatures.size());
+            m_iNextShapeIdToSubmit = iShapeId;
+            m_bEOF = true;
+            m_poJobQueue->WaitCompletion();
+            m_apoChunks.clear();
+            return false;
+        }
+
+        m_apoChunks.pop_front();
+        m_iNextInFrontChunk = 0;
+        SubmitChunks();
+    }
+}
+
 /************************************************************************/
 /*                           OGRShapeLayer()                            */
 /************************************************************************/
@@ -110,6 +495,18 @@ OGRShapeLayer::OGRShapeLayer(OGRShapeDataSource *poDSIn,
         CPLDebug("Shape", "TouchLayer in shape ctor failed. ");
     }
 
+    if (!bUpdateAccess)
+    {
+        const char *pszReadAheadThreads =
+            CPLGetConfigOption("SHAPE_READ_AHEAD_THREADS", "0");
+        const int nReadAheadThreads = EQUAL(pszReadAheadThreads, "ALL_CPUS")
+                                          ? CPLGetNumCPUs()
+                                          : atoi(pszReadAheadThreads);
+        if (nReadAheadThreads > 0)
+            m_nReadAheadThreads =
+                GDALCapThreadCount(std::min(nReadAheadThreads, 128));
+    }
+
     if (hDBF != nullptr && hDBF->pszCodePage != nullptr)
     {
         CPLDebug("Shape", "DBF Codepage = %s for %s", hDBF->pszCodePage,
@@ -243,6 +640,8 @@ OGRShapeLayer::OGRShapeLayer(OGRShapeDataSource *poDSIn,
 OGRShapeLayer::~OGRShapeLayer()
 
 {
+    StopReadAhead();
+
     if (m_eNeedRepack == YES && m_bAutoRepack)
         Repack();
 
@@ -632,6 +1031,50 @@ bool OGRShapeLayer::CheckForSBN()
     return hSBN != nullptr;
 }
 
+/************************************************************************/
+/*                        CheckForSidecarIndex()                        */
+/************************************************************************/
+
+bool OGRShapeLayer::CheckForSidecarIndex()
+
+{
+    if (m_bCheckedForSidecarIndex)
+        return m_poSidecarIndex != nullptr;
+
+    if (hSHP == nullptr)
+        return false;
+
+    m_poSidecarIndex =
+        OGRSidecarSpatialIndex::Open(VSI_SHP_GetFilename(hSHP->fpSHP));
+
+    m_bCheckedForSidecarIndex = true;
+
+    return m_poSidecarIndex != nullptr;
+}
+
+/************************************************************************/
+/*                       InvalidateSidecarIndex()                       */
+/*                                                                      */
+/*      Removes the packed spatial index before geometries or FIDs are  */
+/*      modified. Its modification time check cannot be relied upon     */
+/*      for changes done within the second following its creation.      */
+/************************************************************************/
+
+void OGRShapeLayer::InvalidateSidecarIndex()
+
+{
+    if (!CheckForSidecarIndex())
+        return;
+
+    m_poSidecarIndex.reset();
+    const std::string osIndexFilename =
+        OGRSidecarSpatialIndex::GetIndexFilename(
+            VSI_SHP_GetFilename(hSHP->fpSHP));
+    CPLDebug("SHAPE", "Unlinking index file %s", osIndexFilename.c_str());
+    VSIUnlink(osIndexFilename.c_str());
+    ClearSpatialFIDs();
+}
+
 /************************************************************************/
 /*                            ScanIndices()                             */
 /*                                                                      */
@@ -694,16 +1137,19 @@ bool OGRShapeLayer::ScanIndices()
 
     if (bTryQIXorSBN)
     {
-        if (!bCheckedForQIX)
+        if (!m_bCheckedForSidecarIndex)
+            CPL_IGNORE_RET_VAL(CheckForSidecarIndex());
+        if (m_poSidecarIndex == nullptr && !bCheckedForQIX)
             CPL_IGNORE_RET_VAL(CheckForQIX());
-        if (hQIX == nullptr && !bCheckedForSBN)
+        if (m_poSidecarIndex == nullptr && hQIX == nullptr && !bCheckedForSBN)
             CPL_IGNORE_RET_VAL(CheckForSBN());
     }
 
     /* -------------------------------------------------------------------- */
     /*      Compute spatial index if appropriate.                           */
     /* -------------------------------------------------------------------- */
-    if (bTryQIXorSBN && (hQIX != nullptr || hSBN != nullptr) &&
+    if (bTryQIXorSBN &&
+        (m_poSidecarIndex != nullptr || hQIX != nullptr || hSBN != nullptr) &&
         panSpatialFIDs == nullptr)
     {
         double adfBoundsMin[4] = {oSpatialFilterEnvelope.MinX,
@@ -711,7 +1157,19 @@ bool OGRShapeLayer::ScanIndices()
         double adfBoundsMax[4] = {oSpatialFilterEnvelope.MaxX,
                                   oSpatialFilterEnvelope.MaxY, 0.0, 0.0};
 
-        if (hQIX != nullptr)
+        if (m_poSidecarIndex != nullptr)
+        {
+            const std::vector<GIntBig> anFIDs =
+                m_poSidecarIndex->Search(oSpatialFilterEnvelope);
+            panSpatialFIDs = static_cast<int *>(
+                malloc(sizeof(int) * std::max<size_t>(1, anFIDs.size())));
+            if (panSpatialFIDs == nullptr)
+                return true;
+            nSpatialFIDCount = static_cast<int>(anFIDs.size());
+            for (int i = 0; i < nSpatialFIDCount; i++)
+                panSpatialFIDs[i] = static_cast<int>(anFIDs[i]);
+        }
+        else if (hQIX != nullptr)
             panSpatialFIDs = SHPSearchDiskTreeEx(
                 hQIX, adfBoundsMin, adfBoundsMax, &nSpatialFIDCount);
         else
@@ -779,6 +1237,9 @@ bool OGRShapeLayer::ScanIndices()
 void OGRShapeLayer::ResetReading()
 
 {
+    StopReadAhead();
+    m_bReadAheadAborted = false;
+
     if (!TouchLayer())
         return;
 
@@ -793,6 +1254,34 @@ void OGRShapeLayer::ResetReading()
         VSIFClearErrL(VSI_SHP_GetVSIL(hDBF->fp));
 }
 
+/************************************************************************/
+/*                           StopReadAhead()                            */
+/*                                                                      */
+/*      Discards records decoded ahead of the read position, which      */
+/*      stays the one of the last feature returned.                     */
+/************************************************************************/
+
+void OGRShapeLayer::StopReadAhead()
+{
+    if (m_poReadAhead)
+    {
+        if (m_poReadAhead->HasWarnedWrongWindingOrder())
+            m_bHasWarnedWrongWindingOrder = true;
+        m_poReadAhead.reset();
+    }
+}
+
+/************************************************************************/
+/*                         SetIgnoredFields()                           */
+/************************************************************************/
+
+OGRErr OGRShapeLayer::SetIgnoredFields(CSLConstList papszFields)
+{
+    // Features decoded ahead were read with the previous set.
+    StopReadAhead();
+    return OGRLayer::SetIgnoredFields(papszFields);
+}
+
 /************************************************************************/
 /*                        ClearMatchingFIDs()                           */
 /************************************************************************/
@@ -887,6 +1376,9 @@ OGRErr OGRShapeLayer::SetNextByIndex(GIntBig nIndex)
     if (m_poFilterGeom != nullptr || m_poAttrQuery != nullptr)
         return OGRLayer::SetNextByIndex(nIndex);
 
+    StopReadAhead();
+    m_bReadAheadAborted = false;
+
     iNextShapeId = static_cast<int>(nIndex);
 
     return OGRERR_NONE;
@@ -899,7 +1391,8 @@ OGRErr OGRShapeLayer::SetNextByIndex(GIntBig nIndex)
 /*      if the shapeid bbox intersects the geometry.                    */
 /************************************************************************/
 
-OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
+OGRFeature *OGRShapeLayer::FetchShape(int iShapeId,
+                                      OGRFeature *poFeatureToReuse)
 
 {
     OGRFeature *poFeature = nullptr;
@@ -920,7 +1413,8 @@ OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
         {
             poFeature =
                 SHPReadOGRFeature(hSHP, hDBF, poFeatureDefn, iShapeId, psShape,
-                                  osEncoding, m_bHasWarnedWrongWindingOrder);
+                                  osEncoding, m_bHasWarnedWrongWindingOrder,
+                                  poFeatureToReuse);
         }
         else if (m_sFilterEnvelope.MaxX < psShape->dfXMin ||
                  m_sFilterEnvelope.MaxY < psShape->dfYMin ||
@@ -934,14 +1428,16 @@ OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
         {
             poFeature =
                 SHPReadOGRFeature(hSHP, hDBF, poFeatureDefn, iShapeId, psShape,
-                                  osEncoding, m_bHasWarnedWrongWindingOrder);
+                                  osEncoding, m_bHasWarnedWrongWindingOrder,
+                                  poFeatureToReuse);
         }
     }
     else
     {
-        poFeature =
-            SHPReadOGRFeature(hSHP, hDBF, poFeatureDefn, iShapeId, nullptr,
-                              osEncoding, m_bHasWarnedWrongWindingOrder);
+        poFeature = SHPReadOGRFeature(hSHP, hDBF, poFeatureDefn, iShapeId,
+                                      nullptr, osEncoding,
+                                      m_bHasWarnedWrongWindingOrder,
+                                      poFeatureToReuse);
     }
 
     return poFeature;
@@ -953,6 +1449,37 @@ OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
 
 OGRFeature *OGRShapeLayer::GetNextFeature()
 
+{
+    return GetNextFeatureInternal(nullptr);
+}
+
+/************************************************************************/
+/*                         GetNextFeatureInto()                         */
+/************************************************************************/
+
+bool OGRShapeLayer::GetNextFeatureInto(OGRFeature &oFeature)
+
+{
+    if (oFeature.GetDefnRef() != poFeatureDefn)
+        return OGRLayer::GetNextFeatureInto(oFeature);
+
+    if (GetNextFeatureInternal(&oFeature) == nullptr)
+    {
+        oFeature.Reset();
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                       GetNextFeatureInternal()                       */
+/*                                                                      */
+/*      If poFeatureToReuse is not null, features are read into it      */
+/*      instead of being allocated, and it is returned on success.      */
+/************************************************************************/
+
+OGRFeature *OGRShapeLayer::GetNextFeatureInternal(OGRFeature *poFeatureToReuse)
+
 {
     if (!TouchLayer())
         return nullptr;
@@ -985,7 +1512,8 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
             // Check the shape object's geometry, and if it matches
             // any spatial filter, return it.
             poFeature =
-                FetchShape(static_cast<int>(panMatchingFIDs[iMatchingFID]));
+                FetchShape(static_cast<int>(panMatchingFIDs[iMatchingFID]),
+                           poFeatureToReuse);
 
             iMatchingFID++;
         }
@@ -996,7 +1524,39 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
                 return nullptr;
             }
 
-            if (hDBF)
+            if (!m_poReadAhead && m_nReadAheadThreads > 0 &&
+                !m_bReadAheadAborted && m_poFilterGeom == nullptr)
+            {
+                m_poReadAhead = OGRShapeReadAhead::Create(
+                    poDS, hSHP, hDBF, poFeatureDefn, osEncoding,
+                    nTotalShapeCount, iNextShapeId, m_nReadAheadThreads,
+                    m_bHasWarnedWrongWindingOrder);
+                if (!m_poReadAhead)
+                    m_bReadAheadAborted = true;
+            }
+
+            if (m_poReadAhead)
+            {
+                std::unique_ptr<OGRFeature> poNewFeature;
+                if (!m_poReadAhead->GetNext(iNextShapeId, poNewFeature))
+                {
+                    // End of layer, or resume without read-ahead from the
+                    // record that could not be read.
+                    StopReadAhead();
+                    m_bReadAheadAborted = true;
+                    continue;
+                }
+                if (poNewFeature && poFeatureToReuse)
+                {
+                    poFeatureToReuse->SwapContent(*poNewFeature);
+                    poFeature = poFeatureToReuse;
+                }
+                else
+                {
+                    poFeature = poNewFeature.release();
+                }
+            }
+            else if (hDBF)
             {
                 if (DBFIsRecordDeleted(hDBF, iNextShapeId))
                     poFeature = nullptr;
@@ -1004,10 +1564,10 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
                          VSIFErrorL(VSI_SHP_GetVSIL(hDBF->fp)))
                     return nullptr;  //* I/O error.
                 else
-                    poFeature = FetchShape(iNextShapeId);
+                    poFeature = FetchShape(iNextShapeId, poFeatureToReuse);
             }
             else
-                poFeature = FetchShape(iNextShapeId);
+                poFeature = FetchShape(iNextShapeId, poFeatureToReuse);
 
             iNextShapeId++;
         }
@@ -1029,7 +1589,8 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
                 return poFeature;
             }
 
-            delete poFeature;
+            if (poFeature != poFeatureToReuse)
+                delete poFeature;
         }
     }
 }
@@ -1097,6 +1658,8 @@ OGRErr OGRShapeLayer::ISetFeature(OGRFeature *poFeature)
     if (!StartUpdate("SetFeature"))
         return OGRERR_FAILURE;
 
+    InvalidateSidecarIndex();
+
     GIntBig nFID = poFeature->GetFID();
     if (nFID < 0 || (hSHP != nullptr && nFID >= hSHP->nRecords) ||
         (hDBF != nullptr && nFID >= hDBF->nRecords))
@@ -1189,32 +1752,18 @@ OGRErr OGRShapeLayer::DeleteFeature(GIntBig nFID)
 }
 
 /************************************************************************/
-/*                           ICreateFeature()                            */
+/*                   SetGeomTypeFromFirstGeometry()                     */
+/*                                                                      */
+/*      Establish the shape type of a layer created with wkbUnknown     */
+/*      from the geometry of the first written feature.                 */
 /************************************************************************/
 
-OGRErr OGRShapeLayer::ICreateFeature(OGRFeature *poFeature)
-
+void OGRShapeLayer::SetGeomTypeFromFirstGeometry(const OGRGeometry *poGeom)
 {
-    if (!StartUpdate("CreateFeature"))
-        return OGRERR_FAILURE;
-
-    if (hDBF != nullptr &&
-        !VSI_SHP_WriteMoreDataOK(hDBF->fp, hDBF->nRecordLength))
-    {
-        return OGRERR_FAILURE;
-    }
-
-    bHeaderDirty = true;
-    if (CheckForQIX() || CheckForSBN())
-        DropSpatialIndex();
-
-    poFeature->SetFID(OGRNullFID);
-
     if (nTotalShapeCount == 0 && wkbFlatten(eRequestedGeomType) == wkbUnknown &&
         hSHP != nullptr && hSHP->nShapeType != SHPT_MULTIPATCH &&
-        poFeature->GetGeometryRef() != nullptr)
+        poGeom != nullptr)
     {
-        OGRGeometry *poGeom = poFeature->GetGeometryRef();
         int nShapeType = -1;
 
         switch (poGeom->getGeometryType())
@@ -1355,6 +1904,33 @@ OGRErr OGRShapeLayer::ICreateFeature(OGRFeature *poFeature)
             ResetGeomType(nShapeType);
         }
     }
+}
+
+/************************************************************************/
+/*                           ICreateFeature()                            */
+/************************************************************************/
+
+OGRErr OGRShapeLayer::ICreateFeature(OGRFeature *poFeature)
+
+{
+    if (!StartUpdate("CreateFeature"))
+        return OGRERR_FAILURE;
+
+    InvalidateSidecarIndex();
+
+    if (hDBF != nullptr &&
+        !VSI_SHP_WriteMoreDataOK(hDBF->fp, hDBF->nRecordLength))
+    {
+        return OGRERR_FAILURE;
+    }
+
+    bHeaderDirty = true;
+    if (CheckForQIX() || CheckForSBN())
+        DropSpatialIndex();
+
+    poFeature->SetFID(OGRNullFID);
+
+    SetGeomTypeFromFirstGeometry(poFeature->GetGeometryRef());
 
     const OGRErr eErr =
         SHPWriteOGRFeature(hSHP, hDBF, poFeatureDefn, poFeature, osEncoding,
@@ -1373,6 +1949,114 @@ OGRErr OGRShapeLayer::ICreateFeature(OGRFeature *poFeature)
     return eErr;
 }
 
+/************************************************************************/
+/*                          WriteArrowBatch()                           */
+/************************************************************************/
+
+bool OGRShapeLayer::WriteArrowBatch(const struct ArrowSchema *schema,
+                                    struct ArrowArray *array,
+                                    CSLConstList papszOptions)
+{
+    // Write DBF and SHP records directly from the Arrow columns, without
+    // going through OGRFeature, when all columns can be handled natively
+    std::vector<OGRArrowWriteColumn> aoFieldColumns;
+    OGRArrowWriteColumn oGeomColumn;
+    OGRArrowWriteColumn oFIDColumn;
+    if (!TouchLayer() ||
+        CPLTestBool(
+            CPLGetConfigOption("OGR_SHAPE_WRITE_ARROW_BASE_IMPL", "NO")) ||
+        !GetArrowWriteColumns(schema, array, papszOptions, aoFieldColumns,
+                              oGeomColumn, oFIDColumn))
+    {
+        return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+    }
+
+    if (!StartUpdate("WriteArrowBatch"))
+        return false;
+
+    InvalidateSidecarIndex();
+
+    bHeaderDirty = true;
+    if (CheckForQIX() || CheckForSBN())
+        DropSpatialIndex();
+
+    const int nFieldCount = poFeatureDefn->GetFieldCount();
+    std::vector<OGRField> asFields(nFieldCount);
+    std::vector<const OGRField *> apsFields(nFieldCount);
+    std::vector<std::string> aosTmpStrings(nFieldCount);
+    for (size_t iRow = 0; iRow < static_cast<size_t>(array->length); ++iRow)
+    {
+        if (hDBF != nullptr &&
+            !VSI_SHP_WriteMoreDataOK(hDBF->fp, hDBF->nRecordLength))
+        {
+            return false;
+        }
+
+        for (int i = 0; i < nFieldCount; ++i)
+        {
+            const auto &oColumn = aoFieldColumns[i];
+            if (!oColumn.IsSet() || oColumn.IsNull(iRow))
+            {
+                apsFields[i] = nullptr;
+                continue;
+            }
+            oColumn.GetAsOGRField(iRow,
+                                  poFeatureDefn->GetFieldDefn(i)->GetType(),
+                                  asFields[i], aosTmpStrings[i]);
+            apsFields[i] = &asFields[i];
+        }
+
+        std::unique_ptr<OGRGeometry> poGeom;
+        if (oGeomColumn.IsSet() && !oGeomColumn.IsNull(iRow))
+        {
+            size_t nWKBSize = 0;
+            const GByte *pabyWKB = oGeomColumn.GetBytes(iRow, nWKBSize);
+            OGRGeometry *poGeomRaw = nullptr;
+            if (OGRGeometryFactory::createFromWkb(pabyWKB, nullptr, &poGeomRaw,
+                                                  nWKBSize) != OGRERR_NONE)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "WriteArrowBatch(): invalid WKB geometry at row %d",
+                         static_cast<int>(iRow));
+                return false;
+            }
+            poGeom.reset(poGeomRaw);
+            // Curve geometries are not supported by the format
+            const auto eGeomType = poGeom->getGeometryType();
+            if (OGR_GT_IsNonLinear(eGeomType))
+            {
+                poGeom.reset(OGRGeometryFactory::forceTo(
+                    poGeom.release(), OGR_GT_GetLinear(eGeomType)));
+            }
+        }
+
+        SetGeomTypeFromFirstGeometry(poGeom.get());
+
+        GIntBig nFID = OGRNullFID;
+        const OGRErr eErr = SHPWriteOGRRecord(
+            hSHP, hDBF, poFeatureDefn, nFID, poGeom.get(), apsFields.data(),
+            osEncoding, &bTruncationWarningEmitted, bRewindOnWrite);
+
+        if (hSHP != nullptr)
+            nTotalShapeCount = hSHP->nRecords;
+        else if (hDBF != nullptr)
+            nTotalShapeCount = hDBF->nRecords;
+
+        if (eErr != OGRERR_NONE)
+            return false;
+
+        if (oFIDColumn.IsSet() && !oFIDColumn.SetFID(iRow, nFID))
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "FID " CPL_FRMT_GIB
+                     " cannot be stored in FID array of type int32",
+                     nFID);
+        }
+    }
+
+    return true;
+}
+
 /************************************************************************/
 /*               GetFeatureCountWithSpatialFilterOnly()                 */
 /*                                                                      */
@@ -2634,7 +3318,18 @@ OGRErr OGRShapeLayer::DropSpatialIndex()
     if (!StartUpdate("DropSpatialIndex"))
         return OGRERR_FAILURE;
 
-    if (!CheckForQIX() && !CheckForSBN())
+    std::string osSidecarIndexFilename;
+    if (hSHP != nullptr)
+    {
+        osSidecarIndexFilename = OGRSidecarSpatialIndex::GetIndexFilename(
+            VSI_SHP_GetFilename(hSHP->fpSHP));
+    }
+    VSIStatBufL sStat;
+    const bool bHadSidecarIndex =
+        !osSidecarIndexFilename.empty() &&
+        VSIStatL(osSidecarIndexFilename.c_str(), &sStat) == 0;
+
+    if (!CheckForQIX() && !CheckForSBN() && !bHadSidecarIndex)
     {
         CPLError(CE_Warning, CPLE_AppDefined,
                  "Layer %s has no spatial index, DROP SPATIAL INDEX failed.",
@@ -2642,6 +3337,14 @@ OGRErr OGRShapeLayer::DropSpatialIndex()
         return OGRERR_FAILURE;
     }
 
+    if (bHadSidecarIndex)
+    {
+        m_poSidecarIndex.reset();
+        m_bCheckedForSidecarIndex = false;
+        if (!OGRSidecarSpatialIndex::Drop(VSI_SHP_GetFilename(hSHP->fpSHP)))
+            return OGRERR_FAILURE;
+    }
+
     const bool bHadQIX = hQIX != nullptr;
 
     SHPCloseDiskTree(hQIX);
@@ -2748,6 +3451,80 @@ OGRErr OGRShapeLayer::CreateSpatialIndex(int nMaxDepth)
     return OGRERR_NONE;
 }
 
+/************************************************************************/
+/*                      CreatePackedSpatialIndex()                      */
+/*                                                                      */
+/*      Builds a packed Hilbert R-tree as <file>.shp.ogrsidx. Unlike    */
+/*      .qix, it is built with a bounded amount of memory, and queries  */
+/*      read it in a single forward pass. It has priority over .qix     */
+/*      and .sbn files when present and up to date.                     */
+/************************************************************************/
+
+OGRErr OGRShapeLayer::CreatePackedSpatialIndex()
+
+{
+    if (!TouchLayer())
+        return OGRERR_FAILURE;
+
+    if (hSHP == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Layer %s has no geometry",
+                 poFeatureDefn->GetName());
+        return OGRERR_FAILURE;
+    }
+
+    // The index records the size and modification time of the .shp file,
+    // so pending header changes must be written first, and not again when
+    // closing the file.
+    if (bUpdateAccess)
+    {
+        OGRShapeLayer::SyncToDisk();
+        if (hSHP->bUpdated)
+        {
+            SHPWriteHeader(hSHP);
+            hSHP->sHooks.FFlush(hSHP->fpSHP);
+            hSHP->bUpdated = FALSE;
+        }
+    }
+
+    // Index all features, whatever the currently installed filters, and
+    // without decoding attributes.
+    std::unique_ptr<OGRGeometry> poSavedFilterGeom(
+        m_poFilterGeom ? m_poFilterGeom->clone() : nullptr);
+    const std::string osSavedAttrQuery(
+        m_pszAttrQueryString ? m_pszAttrQueryString : "");
+    const bool bHadAttrQuery = m_pszAttrQueryString != nullptr;
+    std::vector<bool> abSavedIgnored;
+    for (int i = 0; i < poFeatureDefn->GetFieldCount(); ++i)
+    {
+        OGRFieldDefn *poFieldDefn = poFeatureDefn->GetFieldDefn(i);
+        abSavedIgnored.push_back(CPL_TO_BOOL(poFieldDefn->IsIgnored()));
+        poFieldDefn->SetIgnored(TRUE);
+    }
+    StopReadAhead();
+
+    SetSpatialFilter(nullptr);
+    SetAttributeFilter(nullptr);
+
+    m_poSidecarIndex.reset();
+    m_bCheckedForSidecarIndex = false;
+    const std::string osSHPFilename(VSI_SHP_GetFilename(hSHP->fpSHP));
+    CPLDebug("SHAPE", "Creating index file %s",
+             OGRSidecarSpatialIndex::GetIndexFilename(osSHPFilename.c_str())
+                 .c_str());
+    const bool bOK =
+        OGRSidecarSpatialIndex::Create(osSHPFilename.c_str(), this);
+
+    for (int i = 0; i < poFeatureDefn->GetFieldCount(); ++i)
+        poFeatureDefn->GetFieldDefn(i)->SetIgnored(abSavedIgnored[i]);
+    if (bHadAttrQuery)
+        SetAttributeFilter(osSavedAttrQuery.c_str());
+    if (poSavedFilterGeom)
+        SetSpatialFilter(poSavedFilterGeom.get());
+
+    return bOK ? OGRERR_NONE : OGRERR_FAILURE;
+}
+
 /************************************************************************/
 /*                       CheckFileDeletion()                            */
 /************************************************************************/
@@ -2805,6 +3582,8 @@ OGRErr OGRShapeLayer::Repack()
     if (!StartUpdate("Repack"))
         return OGRERR_FAILURE;
 
+    InvalidateSidecarIndex();
+
     /* -------------------------------------------------------------------- */
     /*      Build a list of records to be dropped.                          */
     /* -------------------------------------------------------------------- */
@@ -3690,6 +4469,9 @@ void OGRShapeLayer::CloseUnderlyingLayer()
     hSBN = nullptr;
     bCheckedForSBN = false;
 
+    m_poSidecarIndex.reset();
+    m_bCheckedForSidecarIndex = false;
+
     eFileDescriptorsState = FD_CLOSED;
 }
 
@@ -3870,8 +4652,9 @@ GDALDataset *OGRShapeLayer::GetDataset()
 /*                        GetNextArrowArray()                           */
 /************************************************************************/
 
-// Specialized implementation restricted to situations where only retrieving
-// of FID values is asked (without filters)
+// Specialized implementation that reads DBF records and SHP shapes directly
+// into the Arrow array buffers, without going through OGRFeature objects.
+// Restricted to situations without attribute or spatial filters.
 // In other cases, fall back to generic implementation.
 int OGRShapeLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
                                      struct ArrowArray *out_array)
@@ -3883,21 +4666,38 @@ int OGRShapeLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
         return EIO;
     }
 
-    if (!hDBF || m_poAttrQuery != nullptr || m_poFilterGeom != nullptr)
+    if (m_poAttrQuery != nullptr || m_poFilterGeom != nullptr ||
+        CPLTestBool(CPLGetConfigOption("OGR_SHAPE_STREAM_BASE_IMPL", "NO")))
     {
         return OGRLayer::GetNextArrowArray(stream, out_array);
     }
 
-    // If any field is not ignored, use generic implementation
+    // If any field has a type or subtype that is not handled below, use
+    // generic implementation
     const int nFieldCount = poFeatureDefn->GetFieldCount();
     for (int i = 0; i < nFieldCount; ++i)
     {
-        if (!poFeatureDefn->GetFieldDefn(i)->IsIgnored())
-            return OGRLayer::GetNextArrowArray(stream, out_array);
+        const OGRFieldDefn *poFieldDefn = poFeatureDefn->GetFieldDefn(i);
+        if (poFieldDefn->IsIgnored())
+            continue;
+        const OGRFieldSubType eSubType = poFieldDefn->GetSubType();
+        switch (poFieldDefn->GetType())
+        {
+            case OFTString:
+            case OFTInteger64:
+            case OFTReal:
+            case OFTDate:
+                if (eSubType != OFSTNone)
+                    return OGRLayer::GetNextArrowArray(stream, out_array);
+                break;
+            case OFTInteger:
+                if (eSubType != OFSTNone && eSubType != OFSTBoolean)
+                    return OGRLayer::GetNextArrowArray(stream, out_array);
+                break;
+            default:
+                return OGRLayer::GetNextArrowArray(stream, out_array);
+        }
     }
-    if (GetGeomType() != wkbNone &&
-        !poFeatureDefn->GetGeomFieldDefn(0)->IsIgnored())
-        return OGRLayer::GetNextArrowArray(stream, out_array);
 
     OGRArrowArrayHelper sHelper(poDS, poFeatureDefn,
                                 m_aosArrowArrayStreamOptions, out_array);
@@ -3906,38 +4706,234 @@ int OGRShapeLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
         return ENOMEM;
     }
 
-    if (!sHelper.m_bIncludeFID)
+    if (sHelper.m_nChildren == 0)
+    {
+        sHelper.ClearArray();
         return OGRLayer::GetNextArrowArray(stream, out_array);
+    }
+
+    const int iGeomArrowField = hSHP && poFeatureDefn->GetGeomFieldCount() > 0
+                                    ? sHelper.m_mapOGRGeomFieldToArrowField[0]
+                                    : -1;
+    const OGRwkbGeometryType eLayerGeomType = poFeatureDefn->GetGeomType();
+    const uint32_t nMemLimit = OGRArrowArrayHelper::GetMemLimit();
+
+    struct tm brokenDown;
+    memset(&brokenDown, 0, sizeof(brokenDown));
+
+    // Returns true if appending nLen bytes to the string/binary array of
+    // index iArrowField would exceed the memory limit, in which case the
+    // current batch should be terminated before the current feature.
+    const auto WouldExceedMemLimit =
+        [out_array, nMemLimit](int iArrowField, int iFeat, size_t nLen)
+    {
+        if (iFeat == 0)
+            return false;
+        const auto psArray = out_array->children[iArrowField];
+        const auto panOffsets =
+            static_cast<const int32_t *>(psArray->buffers[1]);
+        const uint32_t nCurLength = static_cast<uint32_t>(panOffsets[iFeat]);
+        return nLen <= nMemLimit && nLen > nMemLimit - nCurLength;
+    };
+
+    const auto SetNullOrEmpty = [&sHelper, out_array](int iField,
+                                                      int iArrowField,
+                                                      int iFeat)
+    {
+        if (sHelper.m_abNullableFields[iField])
+            return sHelper.SetNull(iArrowField, iFeat);
+        auto psArray = out_array->children[iArrowField];
+        if (psArray->n_buffers == 3)
+            OGRArrowArrayHelper::SetEmptyStringOrBinary(psArray, iFeat);
+        return true;
+    };
 
+    StopReadAhead();
     m_bLastGetNextArrowArrayUsedOptimizedCodePath = true;
-    int nCount = 0;
-    while (iNextShapeId < nTotalShapeCount)
+    int iFeat = 0;
+    while (iFeat < sHelper.m_nMaxBatchSize && iNextShapeId < nTotalShapeCount)
     {
-        const bool bIsDeleted =
-            CPL_TO_BOOL(DBFIsRecordDeleted(hDBF, iNextShapeId));
-        if (bIsDeleted)
+        if (hDBF)
         {
-            ++iNextShapeId;
-            continue;
+            if (DBFIsRecordDeleted(hDBF, iNextShapeId))
+            {
+                ++iNextShapeId;
+                continue;
+            }
+            if (VSIFEofL(VSI_SHP_GetVSIL(hDBF->fp)) ||
+                VSIFErrorL(VSI_SHP_GetVSIL(hDBF->fp)))
+            {
+                sHelper.ClearArray();
+                return EIO;
+            }
+        }
+
+        if (sHelper.m_panFIDValues)
+            sHelper.m_panFIDValues[iFeat] = iNextShapeId;
+
+        if (iGeomArrowField >= 0)
+        {
+            std::unique_ptr<OGRGeometry> poGeom(
+                SHPReadOGRGeometry(hSHP, iNextShapeId, nullptr, eLayerGeomType,
+                                   m_bHasWarnedWrongWindingOrder));
+            if (!poGeom)
+            {
+                if (!sHelper.SetNull(iGeomArrowField, iFeat))
+                {
+                    sHelper.ClearArray();
+                    return ENOMEM;
+                }
+            }
+            else
+            {
+                const size_t nWKBSize = poGeom->WkbSize();
+                if (WouldExceedMemLimit(iGeomArrowField, iFeat, nWKBSize))
+                    break;
+                GByte *outPtr = sHelper.GetPtrForStringOrBinary(
+                    iGeomArrowField, iFeat, nWKBSize);
+                if (outPtr == nullptr)
+                {
+                    sHelper.ClearArray();
+                    return ENOMEM;
+                }
+                poGeom->exportToWkb(wkbNDR, outPtr, wkbVariantIso);
+            }
         }
-        if (VSIFEofL(VSI_SHP_GetVSIL(hDBF->fp)) ||
-            VSIFErrorL(VSI_SHP_GetVSIL(hDBF->fp)))
+
+        bool bBatchFull = false;
+        for (int iField = 0; hDBF != nullptr && iField < nFieldCount; ++iField)
         {
-            out_array->release(out_array);
-            memset(out_array, 0, sizeof(*out_array));
-            return EIO;
+            const int iArrowField = sHelper.m_mapOGRFieldToArrowField[iField];
+            if (iArrowField < 0)
+                continue;
+            const OGRFieldDefn *poFieldDefn =
+                poFeatureDefn->GetFieldDefnUnsafe(iField);
+            auto psArray = out_array->children[iArrowField];
+
+            bool bOK = true;
+            switch (poFieldDefn->GetType())
+            {
+                case OFTString:
+                {
+                    const char *pszVal =
+                        DBFReadStringAttribute(hDBF, iNextShapeId, iField);
+                    if (pszVal == nullptr || pszVal[0] == '\0')
+                    {
+                        bOK = SetNullOrEmpty(iField, iArrowField, iFeat);
+                        break;
+                    }
+                    char *pszUTF8 = nullptr;
+                    if (!osEncoding.empty())
+                    {
+                        pszUTF8 = CPLRecode(pszVal, osEncoding, CPL_ENC_UTF8);
+                        pszVal = pszUTF8;
+                    }
+                    const size_t nLen = strlen(pszVal);
+                    if (WouldExceedMemLimit(iArrowField, iFeat, nLen))
+                    {
+                        bBatchFull = true;
+                    }
+                    else
+                    {
+                        GByte *outPtr = sHelper.GetPtrForStringOrBinary(
+                            iArrowField, iFeat, nLen);
+                        if (outPtr)
+                            memcpy(outPtr, pszVal, nLen);
+                        else
+                            bOK = false;
+                    }
+                    CPLFree(pszUTF8);
+                    break;
+                }
+
+                case OFTInteger:
+                case OFTInteger64:
+                case OFTReal:
+                {
+                    if (DBFIsAttributeNULL(hDBF, iNextShapeId, iField))
+                    {
+                        bOK = SetNullOrEmpty(iField, iArrowField, iFeat);
+                    }
+                    else if (poFieldDefn->GetSubType() == OFSTBoolean)
+                    {
+                        const char *pszVal =
+                            DBFReadLogicalAttribute(hDBF, iNextShapeId, iField);
+                        if (pszVal[0] == 'T' || pszVal[0] == 't' ||
+                            pszVal[0] == 'Y' || pszVal[0] == 'y')
+                        {
+                            OGRArrowArrayHelper::SetBoolOn(psArray, iFeat);
+                        }
+                    }
+                    else
+                    {
+                        const char *pszVal =
+                            DBFReadStringAttribute(hDBF, iNextShapeId, iField);
+                        if (poFieldDefn->GetType() == OFTInteger)
+                        {
+                            const long long nVal64 =
+                                std::strtoll(pszVal, nullptr, 10);
+                            const int nVal32 =
+                                nVal64 > INT_MAX   ? INT_MAX
+                                : nVal64 < INT_MIN ? INT_MIN
+                                                   : static_cast<int>(nVal64);
+                            OGRArrowArrayHelper::SetInt32(psArray, iFeat,
+                                                          nVal32);
+                        }
+                        else if (poFieldDefn->GetType() == OFTInteger64)
+                        {
+                            OGRArrowArrayHelper::SetInt64(
+                                psArray, iFeat, CPLAtoGIntBig(pszVal));
+                        }
+                        else
+                        {
+                            OGRArrowArrayHelper::SetDouble(
+                                psArray, iFeat, CPLStrtod(pszVal, nullptr));
+                        }
+                    }
+                    break;
+                }
+
+                case OFTDate:
+                {
+                    if (DBFIsAttributeNULL(hDBF, iNextShapeId, iField))
+                    {
+                        bOK = SetNullOrEmpty(iField, iArrowField, iFeat);
+                    }
+                    else
+                    {
+                        OGRField sFld;
+                        SHPParseOGRDate(
+                            DBFReadStringAttribute(hDBF, iNextShapeId, iField),
+                            &sFld);
+                        OGRArrowArrayHelper::SetDate(psArray, iFeat,
+                                                     brokenDown, sFld);
+                    }
+                    break;
+                }
+
+                default:
+                    CPLAssert(false);
+                    break;
+            }
+
+            if (!bOK)
+            {
+                sHelper.ClearArray();
+                return ENOMEM;
+            }
+            if (bBatchFull)
+                break;
         }
-        sHelper.m_panFIDValues[nCount] = iNextShapeId;
-        ++iNextShapeId;
-        ++nCount;
-        if (nCount == sHelper.m_nMaxBatchSize)
+        if (bBatchFull)
             break;
+
+        ++iNextShapeId;
+        ++iFeat;
     }
-    sHelper.Shrink(nCount);
-    if (nCount == 0)
+    sHelper.Shrink(iFeat);
+    if (iFeat == 0)
     {
-        out_array->release(out_array);
-        memset(out_array, 0, sizeof(*out_array));
+        sHelper.ClearArray();
     }
     return 0;
 }
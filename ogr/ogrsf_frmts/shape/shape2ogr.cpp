@@ -1290,6 +1290,72 @@ OGRFeatureDefn *SHPReadOGRFeatureDefn(const char *pszName, SHPHandle hSHP,
     return poDefn;
 }
 
+/************************************************************************/
+/*                         SHPReadOGRGeometry()                         */
+/*                                                                      */
+/*      Read a shape as an OGR geometry, and set/unset its Z and M      */
+/*      flags so that they are consistent with the layer geometry type. */
+/************************************************************************/
+
+OGRGeometry *SHPReadOGRGeometry(SHPHandle hSHP, int iShape, SHPObject *psShape,
+                                OGRwkbGeometryType eLayerGeomType,
+                                bool &bHasWarnedWrongWindingOrder)
+
+{
+    OGRGeometry *poGeometry =
+        SHPReadOGRObject(hSHP, iShape, psShape, bHasWarnedWrongWindingOrder);
+
+    if (poGeometry && eLayerGeomType != wkbUnknown)
+    {
+        const OGRwkbGeometryType eGeomInType = poGeometry->getGeometryType();
+        if (wkbHasZ(eLayerGeomType) && !wkbHasZ(eGeomInType))
+        {
+            poGeometry->set3D(TRUE);
+        }
+        else if (!wkbHasZ(eLayerGeomType) && wkbHasZ(eGeomInType))
+        {
+            poGeometry->set3D(FALSE);
+        }
+        if (wkbHasM(eLayerGeomType) && !wkbHasM(eGeomInType))
+        {
+            poGeometry->setMeasured(TRUE);
+        }
+        else if (!wkbHasM(eLayerGeomType) && wkbHasM(eGeomInType))
+        {
+            poGeometry->setMeasured(FALSE);
+        }
+    }
+
+    return poGeometry;
+}
+
+/************************************************************************/
+/*                          SHPParseOGRDate()                           */
+/*                                                                      */
+/*      Parse a DBF date value, either in YYYYMMDD or MM/DD/YYYY form.  */
+/************************************************************************/
+
+void SHPParseOGRDate(const char *pszDateValue, OGRField *psField)
+
+{
+    memset(psField, 0, sizeof(*psField));
+
+    if (strlen(pszDateValue) >= 10 && pszDateValue[2] == '/' &&
+        pszDateValue[5] == '/')
+    {
+        psField->Date.Month = static_cast<GByte>(atoi(pszDateValue + 0));
+        psField->Date.Day = static_cast<GByte>(atoi(pszDateValue + 3));
+        psField->Date.Year = static_cast<GInt16>(atoi(pszDateValue + 6));
+    }
+    else
+    {
+        const int nFullDate = atoi(pszDateValue);
+        psField->Date.Year = static_cast<GInt16>(nFullDate / 10000);
+        psField->Date.Month = static_cast<GByte>((nFullDate / 100) % 100);
+        psField->Date.Day = static_cast<GByte>(nFullDate % 100);
+    }
+}
+
 /************************************************************************/
 /*                         SHPReadOGRFeature()                          */
 /************************************************************************/
@@ -1297,7 +1363,8 @@ OGRFeatureDefn *SHPReadOGRFeatureDefn(const char *pszName, SHPHandle hSHP,
 OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
                               OGRFeatureDefn *poDefn, int iShape,
                               SHPObject *psShape, const char *pszSHPEncoding,
-                              bool &bHasWarnedWrongWindingOrder)
+                              bool &bHasWarnedWrongWindingOrder,
+                              OGRFeature *poFeatureToReuse)
 
 {
     if (iShape < 0 || (hSHP != nullptr && iShape >= hSHP->nRecords) ||
@@ -1321,7 +1388,11 @@ OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
         return nullptr;
     }
 
-    OGRFeature *poFeature = new OGRFeature(poDefn);
+    OGRFeature *poFeature = poFeatureToReuse;
+    if (poFeature)
+        poFeature->Reset();
+    else
+        poFeature = new OGRFeature(poDefn);
 
     /* -------------------------------------------------------------------- */
     /*      Fetch geometry from Shapefile to OGRFeature.                    */
@@ -1330,9 +1401,6 @@ OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
     {
         if (!poDefn->IsGeometryIgnored())
         {
-            OGRGeometry *poGeometry = SHPReadOGRObject(
-                hSHP, iShape, psShape, bHasWarnedWrongWindingOrder);
-
             // Two possibilities are expected here (both are tested by
             // GDAL Autotests):
             //   1. Read valid geometry and assign it directly.
@@ -1340,35 +1408,9 @@ OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
             //      correctly from a shapefile.
             //
             // It is NOT required here to test poGeometry == NULL.
-
-            if (poGeometry)
-            {
-                // Set/unset flags.
-                const OGRwkbGeometryType eMyGeomType =
-                    poFeature->GetDefnRef()->GetGeomFieldDefn(0)->GetType();
-
-                if (eMyGeomType != wkbUnknown)
-                {
-                    OGRwkbGeometryType eGeomInType =
-                        poGeometry->getGeometryType();
-                    if (wkbHasZ(eMyGeomType) && !wkbHasZ(eGeomInType))
-                    {
-                        poGeometry->set3D(TRUE);
-                    }
-                    else if (!wkbHasZ(eMyGeomType) && wkbHasZ(eGeomInType))
-                    {
-                        poGeometry->set3D(FALSE);
-                    }
-                    if (wkbHasM(eMyGeomType) && !wkbHasM(eGeomInType))
-                    {
-                        poGeometry->setMeasured(TRUE);
-                    }
-                    else if (!wkbHasM(eMyGeomType) && wkbHasM(eGeomInType))
-                    {
-                        poGeometry->setMeasured(FALSE);
-                    }
-                }
-            }
+            OGRGeometry *poGeometry = SHPReadOGRGeometry(
+                hSHP, iShape, psShape, poDefn->GetGeomType(),
+                bHasWarnedWrongWindingOrder);
 
             poFeature->SetGeometryDirectly(poGeometry);
         }
@@ -1450,29 +1492,9 @@ OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
                     continue;
                 }
 
-                const char *const pszDateValue =
-                    DBFReadStringAttribute(hDBF, iShape, iField);
-
                 OGRField sFld;
-                memset(&sFld, 0, sizeof(sFld));
-
-                if (strlen(pszDateValue) >= 10 && pszDateValue[2] == '/' &&
-                    pszDateValue[5] == '/')
-                {
-                    sFld.Date.Month =
-                        static_cast<GByte>(atoi(pszDateValue + 0));
-                    sFld.Date.Day = static_cast<GByte>(atoi(pszDateValue + 3));
-                    sFld.Date.Year =
-                        static_cast<GInt16>(atoi(pszDateValue + 6));
-                }
-                else
-                {
-                    const int nFullDate = atoi(pszDateValue);
-                    sFld.Date.Year = static_cast<GInt16>(nFullDate / 10000);
-                    sFld.Date.Month =
-                        static_cast<GByte>((nFullDate / 100) % 100);
-                    sFld.Date.Day = static_cast<GByte>(nFullDate % 100);
-                }
+                SHPParseOGRDate(DBFReadStringAttribute(hDBF, iShape, iField),
+                                &sFld);
 
                 poFeature->SetField(iField, &sFld);
             }
@@ -1520,26 +1542,26 @@ static OGRErr GrowField(DBFHandle hDBF, int iField, OGRFieldDefn *poFieldDefn,
 }
 
 /************************************************************************/
-/*                         SHPWriteOGRFeature()                         */
-/*                                                                      */
-/*      Write to an existing feature in a shapefile, or create a new    */
-/*      feature.                                                        */
+/*                      SHPWriteOGRRecordInternal()                     */
 /************************************************************************/
 
-OGRErr SHPWriteOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
-                          OGRFeatureDefn *poDefn, OGRFeature *poFeature,
-                          const char *pszSHPEncoding,
-                          bool *pbTruncationWarningEmitted, bool bRewind)
-
+template <class GetFieldFunc>
+static OGRErr SHPWriteOGRRecordInternal(SHPHandle hSHP, DBFHandle hDBF,
+                                        OGRFeatureDefn *poDefn, GIntBig &nFID,
+                                        const OGRGeometry *poGeom,
+                                        GetFieldFunc getField,
+                                        const char *pszSHPEncoding,
+                                        bool *pbTruncationWarningEmitted,
+                                        bool bRewind)
 {
     /* -------------------------------------------------------------------- */
     /*      Write the geometry.                                             */
     /* -------------------------------------------------------------------- */
     if (hSHP != nullptr)
     {
-        const OGRErr eErr = SHPWriteOGRObject(
-            hSHP, static_cast<int>(poFeature->GetFID()),
-            poFeature->GetGeometryRef(), bRewind, poDefn->GetGeomType());
+        const OGRErr eErr =
+            SHPWriteOGRObject(hSHP, static_cast<int>(nFID), poGeom, bRewind,
+                              poDefn->GetGeomType());
         if (eErr != OGRERR_NONE)
             return eErr;
     }
@@ -1554,8 +1576,8 @@ OGRErr SHPWriteOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
         /*      If this is a new feature, establish its feature id. */
         /* --------------------------------------------------------------------
          */
-        if (hSHP != nullptr && poFeature->GetFID() == OGRNullFID)
-            poFeature->SetFID(hSHP->nRecords - 1);
+        if (hSHP != nullptr && nFID == OGRNullFID)
+            nFID = hSHP->nRecords - 1;
 
         return OGRERR_NONE;
     }
@@ -1563,8 +1585,8 @@ OGRErr SHPWriteOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
     /* -------------------------------------------------------------------- */
     /*      If this is a new feature, establish its feature id.             */
     /* -------------------------------------------------------------------- */
-    if (poFeature->GetFID() == OGRNullFID)
-        poFeature->SetFID(DBFGetRecordCount(hDBF));
+    if (nFID == OGRNullFID)
+        nFID = DBFGetRecordCount(hDBF);
 
     /* -------------------------------------------------------------------- */
     /*      If this is the first feature to be written, verify that we      */
@@ -1587,16 +1609,15 @@ OGRErr SHPWriteOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
     {
         if (DBFGetFieldCount(hDBF) == 1)
         {
-            DBFWriteIntegerAttribute(hDBF,
-                                     static_cast<int>(poFeature->GetFID()), 0,
-                                     static_cast<int>(poFeature->GetFID()));
+            DBFWriteIntegerAttribute(hDBF, static_cast<int>(nFID), 0,
+                                     static_cast<int>(nFID));
         }
         else if (DBFGetFieldCount(hDBF) == 0)
         {
             // Far from being nominal... Could happen if deleting all fields
             // of a DBF with rows
-            DBFWriteAttributeDirectly(
-                hDBF, static_cast<int>(poFeature->GetFID()), -1, nullptr);
+            DBFWriteAttributeDirectly(hDBF, static_cast<int>(nFID), -1,
+                                      nullptr);
         }
     }
 
@@ -1605,10 +1626,10 @@ OGRErr SHPWriteOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
     /* -------------------------------------------------------------------- */
     for (int iField = 0; iField < poDefn->GetFieldCount(); iField++)
     {
-        if (!poFeature->IsFieldSetAndNotNull(iField))
+        const OGRField *const psField = getField(iField);
+        if (psField == nullptr)
         {
-            DBFWriteNULLAttribute(hDBF, static_cast<int>(poFeature->GetFID()),
-                                  iField);
+            DBFWriteNULLAttribute(hDBF, static_cast<int>(nFID), iField);
             continue;
         }
 
@@ -1618,7 +1639,7 @@ OGRErr SHPWriteOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
         {
             case OFTString:
             {
-                const char *pszStr = poFeature->GetFieldAsString(iField);
+                const char *pszStr = psField->String;
                 char *pszEncoded = nullptr;
                 if (pszSHPEncoding[0] != '\0')
                 {
@@ -1638,7 +1659,7 @@ OGRErr SHPWriteOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
                             "Value '%s' of field %s has been truncated to %d "
                             "characters.  This warning will not be emitted any "
                             "more for that layer.",
-                            poFeature->GetFieldAsString(iField),
+                            psField->String,
                             poFieldDefn->GetNameRef(), OGR_DBF_MAX_FIELD_WIDTH);
                     }
 
@@ -1678,9 +1699,8 @@ OGRErr SHPWriteOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
                     }
                 }
 
-                DBFWriteStringAttribute(hDBF,
-                                        static_cast<int>(poFeature->GetFID()),
-                                        iField, pszStr);
+                DBFWriteStringAttribute(hDBF, static_cast<int>(nFID), iField,
+                                        pszStr);
 
                 CPLFree(pszEncoded);
                 break;
@@ -1690,9 +1710,9 @@ OGRErr SHPWriteOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
             {
                 if (poFieldDefn->GetSubType() == OFSTBoolean)
                 {
-                    DBFWriteAttributeDirectly(
-                        hDBF, static_cast<int>(poFeature->GetFID()), iField,
-                        poFeature->GetFieldAsInteger(iField) ? "T" : "F");
+                    DBFWriteAttributeDirectly(hDBF, static_cast<int>(nFID),
+                                              iField,
+                                              psField->Integer ? "T" : "F");
                 }
                 else
                 {
@@ -1702,7 +1722,9 @@ OGRErr SHPWriteOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
                              "%*" CPL_FRMT_GB_WITHOUT_PREFIX "d",
                              std::min(nFieldWidth,
                                       static_cast<int>(sizeof(szValue)) - 1),
-                             poFeature->GetFieldAsInteger64(iField));
+                             poFieldDefn->GetType() == OFTInteger
+                                 ? static_cast<GIntBig>(psField->Integer)
+                                 : psField->Integer64);
 
                     const int nStrLen = static_cast<int>(strlen(szValue));
                     if (nStrLen > nFieldWidth)
@@ -1714,9 +1736,8 @@ OGRErr SHPWriteOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
                         }
                     }
 
-                    DBFWriteAttributeDirectly(
-                        hDBF, static_cast<int>(poFeature->GetFID()), iField,
-                        szValue);
+                    DBFWriteAttributeDirectly(hDBF, static_cast<int>(nFID),
+                                              iField, szValue);
                 }
 
                 break;
@@ -1724,7 +1745,7 @@ OGRErr SHPWriteOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
 
             case OFTReal:
             {
-                const double dfVal = poFeature->GetFieldAsDouble(iField);
+                const double dfVal = psField->Real;
                 // IEEE754 doubles can store exact values of all integers
                 // below 2^53.
                 if (poFieldDefn->GetPrecision() == 0 &&
@@ -1739,16 +1760,15 @@ OGRErr SHPWriteOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
                                  " is bigger than 2^53. "
                                  "Precision loss likely occurred or going to "
                                  "happen.%s",
-                                 dfVal, poFieldDefn->GetNameRef(),
-                                 poFeature->GetFID(),
+                                 dfVal, poFieldDefn->GetNameRef(), nFID,
                                  (nCounter == 10) ? " This warning will not be "
                                                     "emitted anymore."
                                                   : "");
                         nCounter++;
                     }
                 }
-                int ret = DBFWriteDoubleAttribute(
-                    hDBF, static_cast<int>(poFeature->GetFID()), iField, dfVal);
+                int ret = DBFWriteDoubleAttribute(hDBF, static_cast<int>(nFID),
+                                                  iField, dfVal);
                 if (!ret)
                 {
                     CPLError(CE_Warning, CPLE_AppDefined,
@@ -1757,16 +1777,12 @@ OGRErr SHPWriteOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
                              "successfully written. Possibly due to too larger "
                              "number "
                              "with respect to field width",
-                             dfVal, poFieldDefn->GetNameRef(),
-                             poFeature->GetFID());
+                             dfVal, poFieldDefn->GetNameRef(), nFID);
                 }
                 break;
             }
             case OFTDate:
             {
-                const OGRField *const psField =
-                    poFeature->GetRawFieldRef(iField);
-
                 if (psField->Date.Year < 0 || psField->Date.Year > 9999)
                 {
                     CPLError(
@@ -1776,13 +1792,13 @@ OGRErr SHPWriteOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
                 else if (psField->Date.Year == 0 && psField->Date.Month == 0 &&
                          psField->Date.Day == 0)
                 {
-                    DBFWriteNULLAttribute(
-                        hDBF, static_cast<int>(poFeature->GetFID()), iField);
+                    DBFWriteNULLAttribute(hDBF, static_cast<int>(nFID),
+                                          iField);
                 }
                 else
                 {
                     DBFWriteIntegerAttribute(
-                        hDBF, static_cast<int>(poFeature->GetFID()), iField,
+                        hDBF, static_cast<int>(nFID), iField,
                         psField->Date.Year * 10000 + psField->Date.Month * 100 +
                             psField->Date.Day);
                 }
@@ -1799,3 +1815,52 @@ OGRErr SHPWriteOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
 
     return OGRERR_NONE;
 }
+
+/************************************************************************/
+/*                         SHPWriteOGRFeature()                         */
+/*                                                                      */
+/*      Write to an existing feature in a shapefile, or create a new    */
+/*      feature.                                                        */
+/************************************************************************/
+
+OGRErr SHPWriteOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
+                          OGRFeatureDefn *poDefn, OGRFeature *poFeature,
+                          const char *pszSHPEncoding,
+                          bool *pbTruncationWarningEmitted, bool bRewind)
+
+{
+    GIntBig nFID = poFeature->GetFID();
+    const OGRErr eErr = SHPWriteOGRRecordInternal(
+        hSHP, hDBF, poDefn, nFID, poFeature->GetGeometryRef(),
+        [poFeature](int iField) -> const OGRField *
+        {
+            return poFeature->IsFieldSetAndNotNull(iField)
+                       ? poFeature->GetRawFieldRef(iField)
+                       : nullptr;
+        },
+        pszSHPEncoding, pbTruncationWarningEmitted, bRewind);
+    poFeature->SetFID(nFID);
+    return eErr;
+}
+
+/************************************************************************/
+/*                          SHPWriteOGRRecord()                         */
+/*                                                                      */
+/*      Same as SHPWriteOGRFeature(), but taking the geometry and the   */
+/*      field values directly. papsFields[i] is the value of the i-th  */
+/*      field of poDefn, or nullptr if it is unset or null.             */
+/************************************************************************/
+
+OGRErr SHPWriteOGRRecord(SHPHandle hSHP, DBFHandle hDBF,
+                         OGRFeatureDefn *poDefn, GIntBig &nFID,
+                         const OGRGeometry *poGeom,
+                         const OGRField *const *papsFields,
+                         const char *pszSHPEncoding,
+                         bool *pbTruncationWarningEmitted, bool bRewind)
+
+{
+    return SHPWriteOGRRecordInternal(
+        hSHP, hDBF, poDefn, nFID, poGeom,
+        [papsFields](int iField) { return papsFields[iField]; },
+        pszSHPEncoding, pbTruncationWarningEmitted, bRewind);
+}
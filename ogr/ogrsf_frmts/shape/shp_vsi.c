@@ -31,8 +31,11 @@
 #include "shp_vsi.h"
 #include "cpl_error.h"
 #include "cpl_conv.h"
+#include "cpl_string.h"
 #include "cpl_vsi_error.h"
+#include "cpl_virtualmem.h"
 #include <limits.h>
+#include <string.h>
 
 typedef struct
 {
@@ -41,6 +44,13 @@ typedef struct
     int bEnforce2GBLimit;
     int bHasWarned2GB;
     SAOffset nCurOffset;
+    /* Memory mapping of the whole file, for read-only .dbf and .shx */
+    /* files of the local file system, if SHAPE_USE_MMAP=YES. The */
+    /* position of fp is then only kept in sync when falling back to */
+    /* VSIFReadL() for reads beyond the end of the mapping. */
+    CPLVirtualMem *psMapping;
+    const GByte *pabyMapping;
+    SAOffset nMappingSize;
 } OGRSHPDBFFile;
 
 /************************************************************************/
@@ -63,6 +73,43 @@ const char *VSI_SHP_GetFilename(SAFile file)
     return pFile->pszFilename;
 }
 
+/************************************************************************/
+/*                           VSI_SHP_MapFile()                          */
+/************************************************************************/
+
+static void VSI_SHP_MapFile(OGRSHPDBFFile *pFile, const char *pszAccess)
+{
+    const char *pszExt = CPLGetExtension(pFile->pszFilename);
+    vsi_l_offset nLength;
+
+    if (strchr(pszAccess, '+') != NULL || strchr(pszAccess, 'w') != NULL ||
+        strchr(pszAccess, 'a') != NULL)
+        return;
+    if (!EQUAL(pszExt, "dbf") && !EQUAL(pszExt, "shx"))
+        return;
+    if (!CPLTestBool(CPLGetConfigOption("SHAPE_USE_MMAP", "NO")))
+        return;
+    if (!CPLIsVirtualMemFileMapAvailable() ||
+        VSIFGetNativeFileDescriptorL(pFile->fp) == NULL)
+        return;
+
+    if (VSIFSeekL(pFile->fp, 0, SEEK_END) != 0)
+        return;
+    nLength = VSIFTellL(pFile->fp);
+    VSIFSeekL(pFile->fp, 0, SEEK_SET);
+    if (nLength == 0 || (vsi_l_offset)(size_t)nLength != nLength ||
+        (vsi_l_offset)(SAOffset)nLength != nLength)
+        return;
+
+    pFile->psMapping = CPLVirtualMemFileMapNew(
+        pFile->fp, 0, nLength, VIRTUALMEM_READONLY, NULL, NULL);
+    if (pFile->psMapping == NULL)
+        return;
+    pFile->pabyMapping =
+        (const GByte *)CPLVirtualMemGetAddr(pFile->psMapping);
+    pFile->nMappingSize = (SAOffset)nLength;
+}
+
 /************************************************************************/
 /*                         VSI_SHP_OpenInternal()                       */
 /************************************************************************/
@@ -80,6 +127,7 @@ static SAFile VSI_SHP_OpenInternal(const char *pszFilename,
     pFile->pszFilename = CPLStrdup(pszFilename);
     pFile->bEnforce2GBLimit = bEnforce2GBLimit;
     pFile->nCurOffset = 0;
+    VSI_SHP_MapFile(pFile, pszAccess);
     return (SAFile)pFile;
 }
 
@@ -116,8 +164,21 @@ static SAOffset VSI_SHP_Read(void *p, SAOffset size, SAOffset nmemb,
 
 {
     OGRSHPDBFFile *pFile = (OGRSHPDBFFile *)file;
-    SAOffset ret =
-        (SAOffset)VSIFReadL(p, (size_t)size, (size_t)nmemb, pFile->fp);
+    SAOffset ret;
+    if (pFile->pabyMapping)
+    {
+        if (size > 0 && nmemb <= (pFile->nMappingSize / size) &&
+            pFile->nCurOffset <= pFile->nMappingSize - size * nmemb)
+        {
+            memcpy(p, pFile->pabyMapping + pFile->nCurOffset,
+                   (size_t)(size * nmemb));
+            pFile->nCurOffset += size * nmemb;
+            return nmemb;
+        }
+        /* Let a short read set the end-of-file and error flags of fp */
+        VSIFSeekL(pFile->fp, (vsi_l_offset)pFile->nCurOffset, SEEK_SET);
+    }
+    ret = (SAOffset)VSIFReadL(p, (size_t)size, (size_t)nmemb, pFile->fp);
     pFile->nCurOffset += ret * size;
     return ret;
 }
@@ -176,7 +237,20 @@ static SAOffset VSI_SHP_Seek(SAFile file, SAOffset offset, int whence)
 
 {
     OGRSHPDBFFile *pFile = (OGRSHPDBFFile *)file;
-    SAOffset ret = (SAOffset)VSIFSeekL(pFile->fp, (vsi_l_offset)offset, whence);
+    SAOffset ret;
+    if (pFile->pabyMapping)
+    {
+        SAOffset nNewOffset;
+        if (whence == SEEK_SET)
+            nNewOffset = offset;
+        else if (whence == SEEK_CUR)
+            nNewOffset = pFile->nCurOffset + offset;
+        else
+            nNewOffset = pFile->nMappingSize + offset;
+        pFile->nCurOffset = nNewOffset;
+        return 0;
+    }
+    ret = (SAOffset)VSIFSeekL(pFile->fp, (vsi_l_offset)offset, whence);
     if (whence == 0 && ret == 0)
         pFile->nCurOffset = offset;
     else
@@ -214,7 +288,10 @@ static int VSI_SHP_Close(SAFile file)
 
 {
     OGRSHPDBFFile *pFile = (OGRSHPDBFFile *)file;
-    int ret = VSIFCloseL(pFile->fp);
+    int ret;
+    if (pFile->psMapping)
+        CPLVirtualMemFree(pFile->psMapping);
+    ret = VSIFCloseL(pFile->fp);
     CPLFree(pFile->pszFilename);
     CPLFree(pFile);
     return ret;
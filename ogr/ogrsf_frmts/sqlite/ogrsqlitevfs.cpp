@@ -29,13 +29,17 @@
 #include "cpl_port.h"
 #include "ogr_sqlite.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <limits>
+#include <vector>
 
 #include "cpl_atomic_ops.h"
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_mem_cache.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "ogrsqlitevfs.h"
@@ -60,12 +64,376 @@ typedef struct
 #define GET_UNDERLYING_VFS(pVFS)                                               \
     ((OGRSQLiteVFSAppDataStruct *)pVFS->pAppData)->pDefaultVFS
 
+/************************************************************************/
+/*                        OGRSQLiteVFSPageCache                         */
+/************************************************************************/
+
+// Page cache for database files opened read-only, which is mostly useful
+// on network file systems, where each SQLite page read would otherwise
+// result in a separate small range request.
+// Pages are read by runs of consecutive pages when sequential reads are
+// detected, and when a B-tree interior page is read, its child pages that
+// are not already cached are fetched at once with VSIFReadMultiRangeL().
+
+namespace
+{
+class OGRSQLiteVFSPageCache
+{
+  public:
+    OGRSQLiteVFSPageCache(VSILFILE *fp, size_t nMaxPages, int nMaxPrefetch,
+                          size_t nPageSize, vsi_l_offset nFileSize)
+        : m_fp(fp), m_nMaxPages(nMaxPages), m_nPageSize(nPageSize),
+          m_nFileSize(nFileSize), m_oCache(nMaxPages, 0)
+    {
+        // Runs of consecutive pages and batches of prefetched children are
+        // limited to a quarter of the cache, so that they cannot evict the
+        // page being read.
+        const size_t nMaxBatch = std::max<size_t>(1, m_nMaxPages / 4);
+        m_nMaxReadAheadPages = std::min<size_t>(
+            nMaxBatch, std::max<size_t>(1, MAX_READ_AHEAD_BYTES / nPageSize));
+        m_nMaxPrefetchPages =
+            std::min<size_t>(nMaxBatch, std::max(0, nMaxPrefetch));
+    }
+
+    ~OGRSQLiteVFSPageCache()
+    {
+        CPLDebug("SQLITE",
+                 "VFS page cache: %u hits, %u misses, %u read operations, "
+                 "%u prefetched pages",
+                 m_nHits, m_nMisses, m_nReads, m_nPrefetchedPages);
+    }
+
+    size_t Read(void *pBuffer, size_t nAmt, vsi_l_offset nOffset);
+
+    static OGRSQLiteVFSPageCache *Create(VSILFILE *fp, const char *pszName);
+
+  private:
+    // Maximum size of the run of consecutive pages read when sequential
+    // reads are detected.
+    static constexpr size_t MAX_READ_AHEAD_BYTES = 1024 * 1024;
+
+    VSILFILE *m_fp;
+    const size_t m_nMaxPages;
+    const size_t m_nPageSize;
+    const vsi_l_offset m_nFileSize;
+    size_t m_nMaxReadAheadPages = 1;
+    size_t m_nMaxPrefetchPages = 0;
+
+    // Key is the page index (0-based, that is SQLite page number minus one)
+    lru11::Cache<vsi_l_offset, std::vector<GByte>> m_oCache;
+
+    // Page following the last requested one, to detect sequential reads
+    vsi_l_offset m_nNextSequentialPage = 0;
+    size_t m_nReadAheadPages = 1;
+
+    unsigned m_nHits = 0;
+    unsigned m_nMisses = 0;
+    unsigned m_nReads = 0;
+    unsigned m_nPrefetchedPages = 0;
+
+    vsi_l_offset GetPageCount() const
+    {
+        return (m_nFileSize + m_nPageSize - 1) / m_nPageSize;
+    }
+
+    std::vector<GByte> GetRecycledBuffer();
+    bool InsertPages(vsi_l_offset nFirstPage, const GByte *pabyData,
+                     size_t nSize);
+    const std::vector<GByte> *GetPage(vsi_l_offset nPage);
+    void PrefetchChildren(vsi_l_offset nPage,
+                          const std::vector<GByte> &abyPage);
+
+    OGRSQLiteVFSPageCache(const OGRSQLiteVFSPageCache &) = delete;
+    OGRSQLiteVFSPageCache &operator=(const OGRSQLiteVFSPageCache &) = delete;
+};
+}  // namespace
+
+/************************************************************************/
+/*                   OGRSQLiteVFSPageCache::Create()                    */
+/************************************************************************/
+
+// Returns nullptr if the cache is disabled, or if the file does not look
+// like a SQLite database.
+OGRSQLiteVFSPageCache *OGRSQLiteVFSPageCache::Create(VSILFILE *fp,
+                                                     const char *pszName)
+{
+    const char *pszCache = CPLGetConfigOption("OGR_SQLITE_VFS_CACHE", "AUTO");
+    if (EQUAL(pszCache, "AUTO"))
+    {
+        if (VSIIsLocal(pszName))
+            return nullptr;
+    }
+    else if (!CPLTestBool(pszCache))
+    {
+        return nullptr;
+    }
+
+    const GIntBig nCacheSize = CPLAtoGIntBig(CPLGetConfigOption(
+        "OGR_SQLITE_VFS_CACHE_SIZE", CPLSPrintf("%d", 16 * 1024 * 1024)));
+    const int nMaxPrefetch =
+        atoi(CPLGetConfigOption("OGR_SQLITE_VFS_PREFETCH_MAX_PAGES", "512"));
+
+    if (VSIFSeekL(fp, 0, SEEK_END) != 0)
+        return nullptr;
+    const vsi_l_offset nFileSize = VSIFTellL(fp);
+
+    // Page size from the database header
+    GByte abyHeader[100];
+    if (VSIFSeekL(fp, 0, SEEK_SET) != 0 ||
+        VSIFReadL(abyHeader, 1, sizeof(abyHeader), fp) != sizeof(abyHeader) ||
+        memcmp(abyHeader, "SQLite format 3", 16) != 0)
+    {
+        return nullptr;
+    }
+    size_t nPageSize = (abyHeader[16] << 8) | abyHeader[17];
+    if (nPageSize == 1)
+        nPageSize = 65536;
+    if (nPageSize < 512 || nPageSize > 65536 ||
+        (nPageSize & (nPageSize - 1)) != 0)
+    {
+        return nullptr;
+    }
+    const size_t nMaxPages = static_cast<size_t>(
+        std::min<GIntBig>(nCacheSize, std::numeric_limits<int>::max()) /
+        static_cast<GIntBig>(nPageSize));
+    if (nMaxPages == 0)
+        return nullptr;
+
+    return new OGRSQLiteVFSPageCache(fp, nMaxPages, nMaxPrefetch, nPageSize,
+                                     nFileSize);
+}
+
+/************************************************************************/
+/*              OGRSQLiteVFSPageCache::GetRecycledBuffer()              */
+/************************************************************************/
+
+std::vector<GByte> OGRSQLiteVFSPageCache::GetRecycledBuffer()
+{
+    std::vector<GByte> abyBuffer;
+    if (m_oCache.size() >= m_nMaxPages)
+        m_oCache.removeAndRecycleOldestEntry(abyBuffer);
+    return abyBuffer;
+}
+
+/************************************************************************/
+/*                 OGRSQLiteVFSPageCache::InsertPages()                 */
+/************************************************************************/
+
+// Split nSize bytes read at the start of nFirstPage into cached pages.
+// Returns false if nothing could be read.
+bool OGRSQLiteVFSPageCache::InsertPages(vsi_l_offset nFirstPage,
+                                        const GByte *pabyData, size_t nSize)
+{
+    if (nSize == 0)
+        return false;
+    for (size_t nPos = 0; nPos < nSize; nPos += m_nPageSize)
+    {
+        const vsi_l_offset nPage = nFirstPage + nPos / m_nPageSize;
+        if (m_oCache.contains(nPage))
+            continue;
+        auto abyPage = GetRecycledBuffer();
+        abyPage.assign(pabyData + nPos,
+                       pabyData + std::min(nSize, nPos + m_nPageSize));
+        m_oCache.insert(nPage, std::move(abyPage));
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                   OGRSQLiteVFSPageCache::GetPage()                   */
+/************************************************************************/
+
+// The returned pointer is valid until the next call to a method of the
+// cache.
+const std::vector<GByte> *OGRSQLiteVFSPageCache::GetPage(vsi_l_offset nPage)
+{
+    const bool bSequential = nPage == m_nNextSequentialPage;
+    m_nNextSequentialPage = nPage + 1;
+
+    if (const auto pabyPage = m_oCache.getPtr(nPage))
+    {
+        ++m_nHits;
+        return pabyPage;
+    }
+    ++m_nMisses;
+
+    // The run of consecutive pages read doubles for each miss that follows
+    // sequential reads, since the previous run has been consumed.
+    if (bSequential)
+        m_nReadAheadPages =
+            std::min(m_nReadAheadPages * 2, m_nMaxReadAheadPages);
+    else
+        m_nReadAheadPages = 1;
+    const vsi_l_offset nPageCount = GetPageCount();
+    size_t nPages = 1;
+    while (nPages < m_nReadAheadPages && nPage + nPages < nPageCount &&
+           !m_oCache.contains(nPage + nPages))
+    {
+        ++nPages;
+    }
+
+    std::vector<GByte> abyData(nPages * m_nPageSize);
+    ++m_nReads;
+    if (VSIFSeekL(m_fp, nPage * m_nPageSize, SEEK_SET) != 0)
+        return nullptr;
+    const size_t nRead = VSIFReadL(abyData.data(), 1, abyData.size(), m_fp);
+    if (!InsertPages(nPage, abyData.data(), nRead))
+        return nullptr;
+
+    const auto pabyPage = m_oCache.getPtr(nPage);
+    if (pabyPage && m_nMaxPrefetchPages > 0)
+    {
+        // Copy, as prefetching inserts pages into the cache
+        const std::vector<GByte> abyPage(*pabyPage);
+        PrefetchChildren(nPage, abyPage);
+        return m_oCache.getPtr(nPage);
+    }
+    return pabyPage;
+}
+
+/************************************************************************/
+/*              OGRSQLiteVFSPageCache::PrefetchChildren()               */
+/************************************************************************/
+
+// If abyPage is a B-tree interior page, fetch its child pages that are not
+// cached yet. See https://www.sqlite.org/fileformat.html#b_tree_pages
+void OGRSQLiteVFSPageCache::PrefetchChildren(
+    vsi_l_offset nPage, const std::vector<GByte> &abyPage)
+{
+    // The first page starts with the 100-byte database header
+    const size_t nHeaderOffset = nPage == 0 ? 100 : 0;
+    constexpr size_t INTERIOR_HEADER_SIZE = 12;
+    if (abyPage.size() < nHeaderOffset + INTERIOR_HEADER_SIZE)
+        return;
+    const GByte *pabyHeader = abyPage.data() + nHeaderOffset;
+    constexpr GByte INTERIOR_INDEX_PAGE = 0x02;
+    constexpr GByte INTERIOR_TABLE_PAGE = 0x05;
+    if (pabyHeader[0] != INTERIOR_INDEX_PAGE &&
+        pabyHeader[0] != INTERIOR_TABLE_PAGE)
+    {
+        return;
+    }
+    const size_t nCells = (pabyHeader[3] << 8) | pabyHeader[4];
+    if (nHeaderOffset + INTERIOR_HEADER_SIZE + 2 * nCells > abyPage.size())
+        return;
+
+    const vsi_l_offset nPageCount = GetPageCount();
+    std::vector<vsi_l_offset> anChildren;
+    const auto AddChild = [this, nPageCount, &anChildren](const GByte *pabyPtr)
+    {
+        const vsi_l_offset nPageNumber =
+            (static_cast<vsi_l_offset>(pabyPtr[0]) << 24) |
+            (pabyPtr[1] << 16) | (pabyPtr[2] << 8) | pabyPtr[3];
+        if (nPageNumber == 0 || nPageNumber > nPageCount)
+            return false;
+        if (!m_oCache.contains(nPageNumber - 1))
+            anChildren.push_back(nPageNumber - 1);
+        return true;
+    };
+
+    const GByte *pabyCellPointers = pabyHeader + INTERIOR_HEADER_SIZE;
+    for (size_t i = 0; i < nCells; ++i)
+    {
+        const size_t nCellOffset =
+            (pabyCellPointers[2 * i] << 8) | pabyCellPointers[2 * i + 1];
+        // Cells start with the 4-byte page number of the left child
+        if (nCellOffset + 4 > abyPage.size() ||
+            !AddChild(abyPage.data() + nCellOffset))
+        {
+            // Not a valid interior page
+            return;
+        }
+    }
+    // Right-most pointer
+    if (!AddChild(pabyHeader + 8))
+        return;
+
+    // If there are too many children to fetch, reading them anticipatively
+    // would likely fetch a lot of pages that will not be needed.
+    if (anChildren.empty() || anChildren.size() > m_nMaxPrefetchPages)
+        return;
+    std::sort(anChildren.begin(), anChildren.end());
+    anChildren.erase(std::unique(anChildren.begin(), anChildren.end()),
+                     anChildren.end());
+
+    // Merge consecutive pages into a single range
+    std::vector<vsi_l_offset> anFirstPages;
+    std::vector<vsi_l_offset> anOffsets;
+    std::vector<size_t> anSizes;
+    for (const vsi_l_offset nChild : anChildren)
+    {
+        if (!anFirstPages.empty() &&
+            anFirstPages.back() + anSizes.back() / m_nPageSize == nChild)
+        {
+            anSizes.back() += m_nPageSize;
+        }
+        else
+        {
+            anFirstPages.push_back(nChild);
+            anOffsets.push_back(nChild * m_nPageSize);
+            anSizes.push_back(m_nPageSize);
+        }
+    }
+    // The last page of the file may be incomplete
+    if (anOffsets.back() + anSizes.back() > m_nFileSize)
+        anSizes.back() = static_cast<size_t>(m_nFileSize - anOffsets.back());
+
+    std::vector<GByte> abyData(anChildren.size() * m_nPageSize);
+    std::vector<void *> apData;
+    size_t nPos = 0;
+    for (const size_t nSize : anSizes)
+    {
+        apData.push_back(abyData.data() + nPos);
+        nPos += nSize;
+    }
+    ++m_nReads;
+    if (VSIFReadMultiRangeL(static_cast<int>(anOffsets.size()), apData.data(),
+                            anOffsets.data(), anSizes.data(), m_fp) != 0)
+    {
+        return;
+    }
+    for (size_t i = 0; i < anOffsets.size(); ++i)
+    {
+        InsertPages(anFirstPages[i], static_cast<GByte *>(apData[i]),
+                    anSizes[i]);
+    }
+    m_nPrefetchedPages += static_cast<unsigned>(anChildren.size());
+}
+
+/************************************************************************/
+/*                    OGRSQLiteVFSPageCache::Read()                     */
+/************************************************************************/
+
+// Returns the number of bytes read, which is less than nAmt at end of file
+// or in case of I/O error.
+size_t OGRSQLiteVFSPageCache::Read(void *pBuffer, size_t nAmt,
+                                   vsi_l_offset nOffset)
+{
+    size_t nDone = 0;
+    while (nDone < nAmt && nOffset + nDone < m_nFileSize)
+    {
+        const vsi_l_offset nCurOffset = nOffset + nDone;
+        const auto pabyPage = GetPage(nCurOffset / m_nPageSize);
+        const size_t nOffsetInPage =
+            static_cast<size_t>(nCurOffset % m_nPageSize);
+        if (!pabyPage || pabyPage->size() <= nOffsetInPage)
+            break;
+        const size_t nToCopy =
+            std::min(nAmt - nDone, pabyPage->size() - nOffsetInPage);
+        memcpy(static_cast<GByte *>(pBuffer) + nDone,
+               pabyPage->data() + nOffsetInPage, nToCopy);
+        nDone += nToCopy;
+    }
+    return nDone;
+}
+
 typedef struct
 {
     const struct sqlite3_io_methods *pMethods;
     VSILFILE *fp;
     int bDeleteOnClose;
     char *pszFilename;
+    OGRSQLiteVFSPageCache *poCache;
 } OGRSQLiteFileStruct;
 
 static int OGRSQLiteIOClose(sqlite3_file *pFile)
@@ -75,6 +443,7 @@ static int OGRSQLiteIOClose(sqlite3_file *pFile)
     CPLDebug("SQLITE", "OGRSQLiteIOClose(%p (%s))", pMyFile->fp,
              pMyFile->pszFilename);
 #endif
+    delete pMyFile->poCache;
     VSIFCloseL(pMyFile->fp);
     if (pMyFile->bDeleteOnClose)
         VSIUnlink(pMyFile->pszFilename);
@@ -86,8 +455,16 @@ static int OGRSQLiteIORead(sqlite3_file *pFile, void *pBuffer, int iAmt,
                            sqlite3_int64 iOfst)
 {
     OGRSQLiteFileStruct *pMyFile = (OGRSQLiteFileStruct *)pFile;
-    VSIFSeekL(pMyFile->fp, (vsi_l_offset)iOfst, SEEK_SET);
-    int nRead = (int)VSIFReadL(pBuffer, 1, iAmt, pMyFile->fp);
+    int nRead;
+    if (pMyFile->poCache)
+    {
+        nRead = (int)pMyFile->poCache->Read(pBuffer, iAmt, (vsi_l_offset)iOfst);
+    }
+    else
+    {
+        VSIFSeekL(pMyFile->fp, (vsi_l_offset)iOfst, SEEK_SET);
+        nRead = (int)VSIFReadL(pBuffer, 1, iAmt, pMyFile->fp);
+    }
 #ifdef DEBUG_IO
     CPLDebug("SQLITE", "OGRSQLiteIORead(%p, %d, %d) = %d", pMyFile->fp, iAmt,
              (int)iOfst, nRead);
@@ -252,6 +629,7 @@ static int OGRSQLiteVFSOpen(sqlite3_vfs *pVFS, const char *zName,
     pMyFile->pMethods = nullptr;
     pMyFile->bDeleteOnClose = FALSE;
     pMyFile->pszFilename = nullptr;
+    pMyFile->poCache = nullptr;
     if (flags & SQLITE_OPEN_READONLY)
         pMyFile->fp = VSIFOpenL(zName, "rb");
     else if (flags & SQLITE_OPEN_CREATE)
@@ -280,6 +658,9 @@ static int OGRSQLiteVFSOpen(sqlite3_vfs *pVFS, const char *zName,
         pfn(pAppData->pfnUserData, zName, pMyFile->fp);
     }
 
+    if ((flags & SQLITE_OPEN_READONLY) && (flags & SQLITE_OPEN_MAIN_DB))
+        pMyFile->poCache = OGRSQLiteVFSPageCache::Create(pMyFile->fp, zName);
+
     pMyFile->pMethods = &OGRSQLiteIOMethods;
     pMyFile->bDeleteOnClose = (flags & SQLITE_OPEN_DELETEONCLOSE);
     pMyFile->pszFilename = CPLStrdup(zName);
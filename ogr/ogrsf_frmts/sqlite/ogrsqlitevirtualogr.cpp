@@ -31,6 +31,7 @@
 #include "cpl_port.h"
 #include "ogrsqlitevirtualogr.h"
 
+#include <algorithm>
 #include <cctype>
 #include <cstdio>
 #include <cstdlib>
@@ -413,6 +414,12 @@ typedef struct
 
     GByte *pabyGeomBLOB;
     int nGeomBLOBLen;
+
+    /* Whether OGR2SQLITE_Filter() has set ignored fields and/or a spatial */
+    /* filter on poLayer, that must be cleared afterwards */
+    bool bIgnoredFieldsSet;
+    bool bSpatialFilterSet;
+    int iSpatialFilterGeomField;
 } OGR2SQLITE_vtab_cursor;
 
 #ifdef VIRTUAL_OGR_DYNAMIC_EXTENSION_ENABLED
@@ -949,7 +956,16 @@ static int OGR2SQLITE_BestIndex(sqlite3_vtab *pVTab, sqlite3_index_info *pIndex)
              osQueryPatternUsable.c_str(), osQueryPatternNotUsable.c_str());
 #endif
 
+    // Rough estimate of the number of rows returned, used to compute
+    // the estimated cost, so that SQLite favors query plans pushing
+    // constraints to the OGR layer.
+    double dfEstimatedRows = 1e6;
+    bool bUniqueRow = false;
+
     int nConstraints = 0;
+    int nAttributeConstraints = 0;
+    bool bHasSpatialConstraint = false;
+    int iOffsetConstraint = -1;
     for (int i = 0; i < pIndex->nConstraint; i++)
     {
         int iCol = pIndex->aConstraint[i].iColumn;
@@ -957,6 +973,38 @@ static int OGR2SQLITE_BestIndex(sqlite3_vtab *pVTab, sqlite3_index_info *pIndex)
         if (pMyVTab->bHasFIDColumn && iCol >= 0)
             --iCol;
 
+        pIndex->aConstraintUsage[i].argvIndex = 0;
+        pIndex->aConstraintUsage[i].omit = false;
+
+#ifdef SQLITE_INDEX_CONSTRAINT_FUNCTION
+        /* SQLite >= 3.25: spatial predicate overloaded by */
+        /* OGR2SQLITE_FindFunction() */
+        if (pIndex->aConstraint[i].op >= SQLITE_INDEX_CONSTRAINT_FUNCTION)
+        {
+            const int iGeomField = iCol - poFDefn->GetFieldCount() - 1;
+            if (pIndex->aConstraint[i].usable && !bHasSpatialConstraint &&
+                iGeomField >= 0 && iGeomField < poFDefn->GetGeomFieldCount())
+            {
+                // The predicate is still evaluated by SQLite. We only
+                // derive a bounding box spatial filter from it.
+                pIndex->aConstraintUsage[i].argvIndex = nConstraints + 1;
+                bHasSpatialConstraint = true;
+                dfEstimatedRows /= 10;
+                nConstraints++;
+            }
+            continue;
+        }
+#endif
+#ifdef SQLITE_INDEX_CONSTRAINT_OFFSET
+        /* SQLite >= 3.38 */
+        if (pIndex->aConstraint[i].op == SQLITE_INDEX_CONSTRAINT_OFFSET)
+        {
+            if (pIndex->aConstraint[i].usable)
+                iOffsetConstraint = i;
+            continue;
+        }
+#endif
+
         if (pIndex->aConstraint[i].usable &&
             OGR2SQLITE_IsHandledOp(pIndex->aConstraint[i].op) &&
             iCol < poFDefn->GetFieldCount() &&
@@ -965,52 +1013,98 @@ static int OGR2SQLITE_BestIndex(sqlite3_vtab *pVTab, sqlite3_index_info *pIndex)
             pIndex->aConstraintUsage[i].argvIndex = nConstraints + 1;
             pIndex->aConstraintUsage[i].omit = true;
 
+            if (pIndex->aConstraint[i].op == SQLITE_INDEX_CONSTRAINT_EQ)
+            {
+                if (iCol < 0)
+                    bUniqueRow = true;
+                dfEstimatedRows /= 10;
+            }
+            else
+            {
+                dfEstimatedRows /= 2;
+            }
+
             nConstraints++;
-        }
-        else
-        {
-            pIndex->aConstraintUsage[i].argvIndex = 0;
-            pIndex->aConstraintUsage[i].omit = false;
+            nAttributeConstraints++;
         }
     }
 
-    int *panConstraints = nullptr;
-
-    if (nConstraints)
+#ifdef SQLITE_INDEX_CONSTRAINT_OFFSET
+    // OFFSET is only provided by SQLite when all other constraints are
+    // consumed. We only take it into account when it can be implemented with
+    // a fast SetNextByIndex(), that is in the absence of attribute or spatial
+    // filter.
+    if (iOffsetConstraint >= 0 && nAttributeConstraints == 0 &&
+        !bHasSpatialConstraint &&
+        pMyVTab->poLayer->TestCapability(OLCFastSetNextByIndex))
     {
-        panConstraints =
-            (int *)sqlite3_malloc((int)sizeof(int) * (1 + 2 * nConstraints));
-        panConstraints[0] = nConstraints;
+        pIndex->aConstraintUsage[iOffsetConstraint].argvIndex =
+            nConstraints + 1;
+        pIndex->aConstraintUsage[iOffsetConstraint].omit = true;
+        nConstraints++;
+    }
+#else
+    CPL_IGNORE_RET_VAL(iOffsetConstraint);
+#endif
 
-        nConstraints = 0;
+    /* Layout of panConstraints: */
+    /* [0]: number of constraints, n */
+    /* [1 + 2 * i], [2 + 2 * i]: column and operator of the i-th argument */
+    /* [1 + 2 * n], [2 + 2 * n]: low and high 32 bits of colUsed */
+    int *panConstraints =
+        (int *)sqlite3_malloc((int)sizeof(int) * (3 + 2 * nConstraints));
+    if (panConstraints == nullptr)
+        return SQLITE_NOMEM;
+    panConstraints[0] = nConstraints;
 
-        for (int i = 0; i < pIndex->nConstraint; i++)
+    for (int i = 0; i < pIndex->nConstraint; i++)
+    {
+        const int iArg = pIndex->aConstraintUsage[i].argvIndex - 1;
+        if (iArg >= 0)
         {
-            if (pIndex->aConstraintUsage[i].omit)
-            {
-                panConstraints[2 * nConstraints + 1] =
-                    pIndex->aConstraint[i].iColumn;
-                panConstraints[2 * nConstraints + 2] =
-                    pIndex->aConstraint[i].op;
-
-                nConstraints++;
-            }
+            panConstraints[2 * iArg + 1] = pIndex->aConstraint[i].iColumn;
+            panConstraints[2 * iArg + 2] = pIndex->aConstraint[i].op;
         }
     }
 
-    pIndex->orderByConsumed = false;
     pIndex->idxNum = 0;
-
-    if (nConstraints != 0)
-    {
-        pIndex->idxStr = (char *)panConstraints;
-        pIndex->needToFreeIdxStr = true;
+    panConstraints[2 * nConstraints + 1] = 0;
+    panConstraints[2 * nConstraints + 2] = 0;
+#if SQLITE_VERSION_NUMBER >= 3010000L
+    /* SQLite >= 3.10: mask of the columns used by the statement */
+    if (sqlite3_libversion_number() >= 3010000)
+    {
+        const sqlite3_uint64 nColUsed =
+            static_cast<sqlite3_uint64>(pIndex->colUsed);
+        pIndex->idxNum = 1;
+        panConstraints[2 * nConstraints + 1] =
+            static_cast<int>(static_cast<GUInt32>(nColUsed & 0xFFFFFFFFU));
+        panConstraints[2 * nConstraints + 2] =
+            static_cast<int>(static_cast<GUInt32>(nColUsed >> 32));
     }
-    else
+#endif
+
+    pIndex->orderByConsumed = false;
+
+    pIndex->idxStr = (char *)panConstraints;
+    pIndex->needToFreeIdxStr = true;
+
+    if (bUniqueRow)
+        dfEstimatedRows = 1;
+    pIndex->estimatedCost = dfEstimatedRows;
+#if SQLITE_VERSION_NUMBER >= 3008002L
+    /* SQLite >= 3.8.2 */
+    if (sqlite3_libversion_number() >= 3008002)
     {
-        pIndex->idxStr = nullptr;
-        pIndex->needToFreeIdxStr = false;
+        pIndex->estimatedRows =
+            static_cast<sqlite3_int64>(std::max(1.0, dfEstimatedRows));
     }
+#endif
+#if SQLITE_VERSION_NUMBER >= 3009000L
+    /* SQLite >= 3.9.0 */
+    if (bUniqueRow && sqlite3_libversion_number() >= 3009000)
+        pIndex->idxFlags |= SQLITE_INDEX_SCAN_UNIQUE;
+#endif
 
     return SQLITE_OK;
 }
@@ -1109,6 +1203,13 @@ static int OGR2SQLITE_Close(sqlite3_vtab_cursor *pCursor)
 #endif
     pMyVTab->nMyRef--;
 
+    /* Restore the state of the layer */
+    if (pMyCursor->bIgnoredFieldsSet)
+        pMyCursor->poLayer->SetIgnoredFields(nullptr);
+    if (pMyCursor->bSpatialFilterSet)
+        pMyCursor->poLayer->SetSpatialFilter(pMyCursor->iSpatialFilterGeomField,
+                                             nullptr);
+
     delete pMyCursor->poFeature;
     delete pMyCursor->poDupDataSource;
 
@@ -1123,9 +1224,9 @@ static int OGR2SQLITE_Close(sqlite3_vtab_cursor *pCursor)
 /*                          OGR2SQLITE_Filter()                         */
 /************************************************************************/
 
-static int OGR2SQLITE_Filter(sqlite3_vtab_cursor *pCursor,
-                             CPL_UNUSED int idxNum, const char *idxStr,
-                             int argc, sqlite3_value **argv)
+static int OGR2SQLITE_Filter(sqlite3_vtab_cursor *pCursor, int idxNum,
+                             const char *idxStr, int argc,
+                             sqlite3_value **argv)
 {
     OGR2SQLITE_vtab_cursor *pMyCursor = (OGR2SQLITE_vtab_cursor *)pCursor;
 #ifdef DEBUG_OGR2SQLITE
@@ -1142,6 +1243,13 @@ static int OGR2SQLITE_Filter(sqlite3_vtab_cursor *pCursor,
 
     OGRFeatureDefn *poFDefn = pMyCursor->poLayer->GetLayerDefn();
 
+    int iSpatialFilterGeomField = -1;
+    OGREnvelope sSpatialFilterEnvelope;
+    GIntBig nOffset = 0;
+    // Columns that must not be ignored, because they are used by the
+    // attribute or spatial filter
+    std::set<int> oSetFilterColumns;
+
     for (int i = 0; i < argc; i++)
     {
         int nCol = panConstraints[2 * i + 1];
@@ -1152,14 +1260,50 @@ static int OGR2SQLITE_Filter(sqlite3_vtab_cursor *pCursor,
             --nCol;
         }
 
+#ifdef SQLITE_INDEX_CONSTRAINT_OFFSET
+        if (panConstraints[2 * i + 2] == SQLITE_INDEX_CONSTRAINT_OFFSET)
+        {
+            if (sqlite3_value_type(argv[i]) == SQLITE_INTEGER)
+                nOffset = std::max<GIntBig>(0, sqlite3_value_int64(argv[i]));
+            continue;
+        }
+#endif
+
+#ifdef SQLITE_INDEX_CONSTRAINT_FUNCTION
+        if (panConstraints[2 * i + 2] >= SQLITE_INDEX_CONSTRAINT_FUNCTION)
+        {
+            // Second argument of a spatial predicate on a geometry column:
+            // use its bounding box as a spatial filter, if it is a valid
+            // geometry. Otherwise the predicate will be evaluated on all
+            // features.
+            const int iGeomField = nCol - poFDefn->GetFieldCount() - 1;
+            bool bIsEmpty = false;
+            if (iGeomField >= 0 && iGeomField < poFDefn->GetGeomFieldCount() &&
+                sqlite3_value_type(argv[i]) == SQLITE_BLOB &&
+                OGRSQLiteLayer::GetSpatialiteGeometryHeader(
+                    static_cast<const GByte *>(sqlite3_value_blob(argv[i])),
+                    sqlite3_value_bytes(argv[i]), nullptr, nullptr, &bIsEmpty,
+                    &sSpatialFilterEnvelope.MinX, &sSpatialFilterEnvelope.MinY,
+                    &sSpatialFilterEnvelope.MaxX,
+                    &sSpatialFilterEnvelope.MaxY) == OGRERR_NONE &&
+                !bIsEmpty)
+            {
+                iSpatialFilterGeomField = iGeomField;
+                oSetFilterColumns.insert(nCol);
+            }
+            continue;
+        }
+#endif
+
         if (nCol >= 0)
         {
             poFieldDefn = poFDefn->GetFieldDefn(nCol);
             if (poFieldDefn == nullptr)
                 return SQLITE_ERROR;
+            oSetFilterColumns.insert(nCol);
         }
 
-        if (i != 0)
+        if (!osAttributeFilter.empty())
             osAttributeFilter += " AND ";
 
         if (poFieldDefn != nullptr)
@@ -1310,12 +1454,117 @@ static int OGR2SQLITE_Filter(sqlite3_vtab_cursor *pCursor,
         return SQLITE_ERROR;
     }
 
+    if (iSpatialFilterGeomField >= 0)
+    {
+#ifdef DEBUG_OGR2SQLITE
+        CPLDebug("OGR2SQLITE", "Spatial filter : %.18g, %.18g, %.18g, %.18g",
+                 sSpatialFilterEnvelope.MinX, sSpatialFilterEnvelope.MinY,
+                 sSpatialFilterEnvelope.MaxX, sSpatialFilterEnvelope.MaxY);
+#endif
+        if (pMyCursor->bSpatialFilterSet &&
+            pMyCursor->iSpatialFilterGeomField != iSpatialFilterGeomField)
+        {
+            pMyCursor->poLayer->SetSpatialFilter(
+                pMyCursor->iSpatialFilterGeomField, nullptr);
+        }
+        pMyCursor->poLayer->SetSpatialFilterRect(
+            iSpatialFilterGeomField, sSpatialFilterEnvelope.MinX,
+            sSpatialFilterEnvelope.MinY, sSpatialFilterEnvelope.MaxX,
+            sSpatialFilterEnvelope.MaxY);
+        pMyCursor->bSpatialFilterSet = true;
+        pMyCursor->iSpatialFilterGeomField = iSpatialFilterGeomField;
+    }
+    else if (pMyCursor->bSpatialFilterSet)
+    {
+        pMyCursor->poLayer->SetSpatialFilter(
+            pMyCursor->iSpatialFilterGeomField, nullptr);
+        pMyCursor->bSpatialFilterSet = false;
+    }
+
+    /* Do not fetch fields that are not used by the statement */
+    if (idxNum == 1)
+    {
+        const sqlite3_uint64 nColUsed =
+            static_cast<sqlite3_uint64>(
+                static_cast<GUInt32>(panConstraints[2 * nConstraints + 1])) |
+            (static_cast<sqlite3_uint64>(
+                 static_cast<GUInt32>(panConstraints[2 * nConstraints + 2]))
+             << 32);
+        const int nColOffset = pMyCursor->pVTab->bHasFIDColumn ? 1 : 0;
+        // Bit 63 is set if any column >= 63 is used
+        const auto IsColUsed = [nColUsed, nColOffset,
+                                &oSetFilterColumns](int iCol)
+        {
+            return iCol + nColOffset >= 63 ||
+                   (nColUsed & (static_cast<sqlite3_uint64>(1)
+                                << (iCol + nColOffset))) != 0 ||
+                   oSetFilterColumns.find(iCol) != oSetFilterColumns.end();
+        };
+
+        CPLStringList aosIgnoredFields;
+        const int nFieldCount = poFDefn->GetFieldCount();
+        for (int i = 0; i < nFieldCount; ++i)
+        {
+            if (!IsColUsed(i))
+                aosIgnoredFields.AddString(
+                    poFDefn->GetFieldDefn(i)->GetNameRef());
+        }
+        if (!IsColUsed(nFieldCount))
+            aosIgnoredFields.AddString("OGR_STYLE");
+        for (int i = 0; i < poFDefn->GetGeomFieldCount(); ++i)
+        {
+            if (!IsColUsed(nFieldCount + 1 + i))
+            {
+                const char *pszGeomFieldName =
+                    poFDefn->GetGeomFieldDefn(i)->GetNameRef();
+                aosIgnoredFields.AddString(
+                    pszGeomFieldName[0] ? pszGeomFieldName : "OGR_GEOMETRY");
+            }
+        }
+        if (!aosIgnoredFields.empty() || pMyCursor->bIgnoredFieldsSet)
+        {
+            pMyCursor->poLayer->SetIgnoredFields(
+                aosIgnoredFields.empty()
+                    ? nullptr
+                    : const_cast<const char **>(aosIgnoredFields.List()));
+            pMyCursor->bIgnoredFieldsSet = !aosIgnoredFields.empty();
+        }
+    }
+
     if (pMyCursor->poLayer->TestCapability(OLCFastFeatureCount))
         pMyCursor->nFeatureCount = pMyCursor->poLayer->GetFeatureCount();
     else
         pMyCursor->nFeatureCount = -1;
     pMyCursor->poLayer->ResetReading();
 
+    pMyCursor->nNextWishedIndex = 0;
+    pMyCursor->nCurFeatureIndex = -1;
+
+    /* OFFSET: skip the first features */
+    bool bSkippedByIndex = false;
+    if (nOffset > 0)
+    {
+        bSkippedByIndex =
+            pMyCursor->poLayer->SetNextByIndex(nOffset) == OGRERR_NONE;
+        if (pMyCursor->nFeatureCount >= 0)
+        {
+            pMyCursor->nNextWishedIndex = nOffset;
+            if (bSkippedByIndex)
+                pMyCursor->nCurFeatureIndex = nOffset - 1;
+        }
+        else if (!bSkippedByIndex)
+        {
+            for (GIntBig i = 0; i < nOffset; ++i)
+            {
+                OGRFeature *poSkippedFeature =
+                    pMyCursor->poLayer->GetNextFeature();
+                if (poSkippedFeature == nullptr)
+                    break;
+                delete poSkippedFeature;
+            }
+        }
+    }
+
     if (pMyCursor->nFeatureCount < 0)
     {
         pMyCursor->poFeature = pMyCursor->poLayer->GetNextFeature();
@@ -1325,9 +1574,6 @@ static int OGR2SQLITE_Filter(sqlite3_vtab_cursor *pCursor,
 #endif
     }
 
-    pMyCursor->nNextWishedIndex = 0;
-    pMyCursor->nCurFeatureIndex = -1;
-
     return SQLITE_OK;
 }
 
@@ -1683,23 +1929,97 @@ static int OGR2SQLITE_Rename(CPL_UNUSED sqlite3_vtab *pVtab,
     return SQLITE_ERROR;
 }
 
-#if 0
+#ifdef SQLITE_INDEX_CONSTRAINT_FUNCTION
+
+/************************************************************************/
+/*                   OGR2SQLITE_VirtualOGR_Intersects()                 */
+/************************************************************************/
+
+/* Overload of ST_Intersects() / Intersects() for geometry columns of */
+/* virtual tables */
+static void OGR2SQLITE_VirtualOGR_Intersects(sqlite3_context *pContext,
+                                             int argc, sqlite3_value **argv)
+{
+    if (argc != 2)
+    {
+        sqlite3_result_int(pContext, 0);
+        return;
+    }
+    auto poGeom1 = OGR2SQLITE_GetGeom(pContext, argc, argv, nullptr);
+    auto poGeom2 = OGR2SQLITE_GetGeom(pContext, argc - 1, argv + 1, nullptr);
+    if (!poGeom1 || !poGeom2)
+    {
+        sqlite3_result_int(pContext, 0);
+        return;
+    }
+    sqlite3_result_int(pContext, poGeom1->Intersects(poGeom2.get()));
+}
+
+/************************************************************************/
+/*                  OGR2SQLITE_VirtualOGR_MbrIntersects()               */
+/************************************************************************/
+
+/* Overload of MbrIntersects() for geometry columns of virtual tables */
+static void OGR2SQLITE_VirtualOGR_MbrIntersects(sqlite3_context *pContext,
+                                                int argc, sqlite3_value **argv)
+{
+    OGREnvelope asEnvelopes[2];
+    for (int i = 0; i < 2 && i < argc; ++i)
+    {
+        bool bIsEmpty = false;
+        if (sqlite3_value_type(argv[i]) != SQLITE_BLOB ||
+            OGRSQLiteLayer::GetSpatialiteGeometryHeader(
+                static_cast<const GByte *>(sqlite3_value_blob(argv[i])),
+                sqlite3_value_bytes(argv[i]), nullptr, nullptr, &bIsEmpty,
+                &asEnvelopes[i].MinX, &asEnvelopes[i].MinY,
+                &asEnvelopes[i].MaxX, &asEnvelopes[i].MaxY) != OGRERR_NONE ||
+            bIsEmpty)
+        {
+            sqlite3_result_int(pContext, 0);
+            return;
+        }
+    }
+    sqlite3_result_int(pContext,
+                       argc == 2 && asEnvelopes[0].Intersects(asEnvelopes[1]));
+}
+
 /************************************************************************/
 /*                        OGR2SQLITE_FindFunction()                     */
 /************************************************************************/
 
-static
-int OGR2SQLITE_FindFunction(sqlite3_vtab *pVtab,
-                            int nArg,
-                            const char *zName,
-                            void (**pxFunc)(sqlite3_context*,int,sqlite3_value**),
-                            void **ppArg)
+/* Overload spatial predicates whose first argument is a column of the */
+/* virtual table, so that they are presented as constraints to */
+/* OGR2SQLITE_BestIndex(), and translated as a spatial filter on the layer. */
+static int OGR2SQLITE_FindFunction(CPL_UNUSED sqlite3_vtab *pVtab, int nArg,
+                                   const char *zName,
+                                   void (**pxFunc)(sqlite3_context *, int,
+                                                   sqlite3_value **),
+                                   void **ppArg)
 {
+#ifdef DEBUG_OGR2SQLITE
     CPLDebug("OGR2SQLITE", "FindFunction %s", zName);
+#endif
+
+    if (nArg != 2)
+        return 0;
+
+    if (EQUAL(zName, "ST_Intersects") || EQUAL(zName, "Intersects"))
+    {
+        *pxFunc = OGR2SQLITE_VirtualOGR_Intersects;
+        *ppArg = nullptr;
+        return SQLITE_INDEX_CONSTRAINT_FUNCTION;
+    }
+    if (EQUAL(zName, "MbrIntersects"))
+    {
+        *pxFunc = OGR2SQLITE_VirtualOGR_MbrIntersects;
+        *ppArg = nullptr;
+        return SQLITE_INDEX_CONSTRAINT_FUNCTION;
+    }
 
     return 0;
 }
-#endif
+
+#endif  // SQLITE_INDEX_CONSTRAINT_FUNCTION
 
 /************************************************************************/
 /*                     OGR2SQLITE_FeatureFromArgs()                     */
@@ -1921,8 +2241,11 @@ static const struct sqlite3_module sOGR2SQLITEModule = {
     nullptr, /* xSync */
     nullptr, /* xCommit */
     nullptr, /* xFindFunctionRollback */
-    nullptr,
-    /* xFindFunction */  // OGR2SQLITE_FindFunction;
+#ifdef SQLITE_INDEX_CONSTRAINT_FUNCTION
+    OGR2SQLITE_FindFunction,
+#else
+    nullptr, /* xFindFunction */
+#endif
     OGR2SQLITE_Rename,
     nullptr,  // xSavepoint
     nullptr,  // xRelease
@@ -35,6 +35,8 @@
 #include <algorithm>
 #include <set>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -624,6 +626,7 @@ OGRLayer *OGRVRTDataSource::InstantiateUnionLayer(CPLXMLNode *psLTree,
     // Find source layers.
     int nSrcLayers = 0;
     OGRLayer **papoSrcLayers = nullptr;
+    std::vector<std::pair<int, OGREnvelope>> aoSrcLayerExtents;
 
     for (CPLXMLNode *psSubNode = psLTree->psChild; psSubNode != nullptr;
          psSubNode = psSubNode->psNext)
@@ -635,6 +638,30 @@ OGRLayer *OGRVRTDataSource::InstantiateUnionLayer(CPLXMLNode *psLTree,
                                                 bUpdate, nRecLevel + 1);
         if (poSrcLayer != nullptr)
         {
+            // The extent of a source layer allows skipping it without
+            // opening it when it does not intersect the spatial filter.
+            if (EQUAL(psSubNode->pszValue, "OGRVRTLayer"))
+            {
+                const char *pszSrcXMin =
+                    CPLGetXMLValue(psSubNode, "ExtentXMin", nullptr);
+                const char *pszSrcYMin =
+                    CPLGetXMLValue(psSubNode, "ExtentYMin", nullptr);
+                const char *pszSrcXMax =
+                    CPLGetXMLValue(psSubNode, "ExtentXMax", nullptr);
+                const char *pszSrcYMax =
+                    CPLGetXMLValue(psSubNode, "ExtentYMax", nullptr);
+                if (pszSrcXMin != nullptr && pszSrcYMin != nullptr &&
+                    pszSrcXMax != nullptr && pszSrcYMax != nullptr)
+                {
+                    OGREnvelope sExtent;
+                    sExtent.MinX = CPLAtof(pszSrcXMin);
+                    sExtent.MinY = CPLAtof(pszSrcYMin);
+                    sExtent.MaxX = CPLAtof(pszSrcXMax);
+                    sExtent.MaxY = CPLAtof(pszSrcYMax);
+                    aoSrcLayerExtents.emplace_back(nSrcLayers, sExtent);
+                }
+            }
+
             papoSrcLayers = static_cast<OGRLayer **>(CPLRealloc(
                 papoSrcLayers, sizeof(OGRLayer *) * (nSrcLayers + 1)));
             papoSrcLayers[nSrcLayers] = poSrcLayer;
@@ -719,6 +746,24 @@ OGRLayer *OGRVRTDataSource::InstantiateUnionLayer(CPLXMLNode *psLTree,
         poLayer->SetFeatureCount(atoi(pszFeatureCount));
     }
 
+    for (const auto &oSrcLayerExtent : aoSrcLayerExtents)
+    {
+        poLayer->SetSourceLayerExtent(oSrcLayerExtent.first, 0,
+                                      oSrcLayerExtent.second);
+    }
+
+    // Set parallel reading of source layers if asked.
+    const char *pszNumThreads = CPLGetXMLValue(psLTree, "NumThreads", nullptr);
+    if (pszNumThreads != nullptr)
+    {
+        const int nThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                                 ? CPLGetNumCPUs()
+                                 : atoi(pszNumThreads);
+        poLayer->SetParallelReading(
+            nThreads,
+            CPLTestBool(CPLGetXMLValue(psLTree, "PreserveOrder", "YES")));
+    }
+
     return poLayer;
 }
 
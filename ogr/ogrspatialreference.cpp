@@ -3892,7 +3892,14 @@ OGRErr OGRSpatialReference::SetFromUserInput(const char *pszDefinition,
          strstr(pszDefinition, "TemporalCRS") ||
          strstr(pszDefinition, "DerivedTemporalCRS")))
     {
-        PJ *pj;
+        auto tlsCache = OSRGetProjTLSCache();
+        PJ *pj = tlsCache->GetPJForPROJJSON(pszDefinition);
+        if (pj)
+        {
+            Clear();
+            d->setPjCRS(pj);
+            return OGRERR_NONE;
+        }
         if (strstr(pszDefinition, "datum_ensemble") != nullptr)
         {
             // PROJ < 9.0.1 doesn't like a datum_ensemble whose member have
@@ -3912,6 +3919,7 @@ OGRErr OGRSpatialReference::SetFromUserInput(const char *pszDefinition,
         {
             return OGRERR_FAILURE;
         }
+        tlsCache->CachePJForPROJJSON(pszDefinition, pj);
         Clear();
         d->setPjCRS(pj);
         return OGRERR_NONE;
@@ -11366,13 +11374,47 @@ OGRSpatialReference::FindMatches(char **papszOptions, int *pnEntries,
     if (!d->m_pj_crs)
         return nullptr;
 
-    int *panConfidence = nullptr;
-    auto list = proj_identify(d->getPROJContext(), d->m_pj_crs, nullptr,
-                              nullptr, &panConfidence);
-    if (!list)
-        return nullptr;
+    // proj_identify() queries the PROJ database, so its result is cached,
+    // keyed by the WKT2 representation of the CRS, so that SRS of
+    // successively opened datasets are not identified again and again.
+    auto ctxt = d->getPROJContext();
+    auto tlsCache = OSRGetProjTLSCache();
+    std::string osKey;
+    {
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        const char *pszWKT =
+            proj_as_wkt(ctxt, d->m_pj_crs, PJ_WKT2_2019, nullptr);
+        if (pszWKT)
+            osKey = pszWKT;
+    }
+
+    std::vector<PJ *> apoMatches;
+    std::vector<int> anConfidence;
+    if (osKey.empty() ||
+        !tlsCache->GetIdentifyResult(osKey, apoMatches, anConfidence))
+    {
+        int *panConfidence = nullptr;
+        auto list = proj_identify(ctxt, d->m_pj_crs, nullptr, nullptr,
+                                  &panConfidence);
+        if (!list)
+            return nullptr;
+
+        const int nListCount = proj_list_get_count(list);
+        for (int i = 0; i < nListCount; i++)
+        {
+            PJ *obj = proj_list_get(ctxt, list, i);
+            CPLAssert(obj);
+            apoMatches.push_back(obj);
+            anConfidence.push_back(panConfidence[i]);
+        }
+        proj_list_destroy(list);
+        proj_int_list_destroy(panConfidence);
+
+        if (!osKey.empty())
+            tlsCache->CacheIdentifyResult(osKey, apoMatches, anConfidence);
+    }
 
-    const int nMatches = proj_list_get_count(list);
+    const int nMatches = static_cast<int>(apoMatches.size());
 
     if (pnEntries)
         *pnEntries = static_cast<int>(nMatches);
@@ -11385,17 +11427,13 @@ OGRSpatialReference::FindMatches(char **papszOptions, int *pnEntries,
     }
     for (int i = 0; i < nMatches; i++)
     {
-        PJ *obj = proj_list_get(d->getPROJContext(), list, i);
-        CPLAssert(obj);
         OGRSpatialReference *poSRS = new OGRSpatialReference();
-        poSRS->d->setPjCRS(obj);
+        poSRS->d->setPjCRS(apoMatches[i]);
         pahRet[i] = ToHandle(poSRS);
         if (ppanMatchConfidence)
-            (*ppanMatchConfidence)[i] = panConfidence[i];
+            (*ppanMatchConfidence)[i] = anConfidence[i];
     }
     pahRet[nMatches] = nullptr;
-    proj_list_destroy(list);
-    proj_int_list_destroy(panConfidence);
 
     return pahRet;
 }
@@ -79,7 +79,7 @@ std::string removeTrailingZeros(std::string s)
     // Remove zeros at the end.  We know this won't be npos because we
     // have a decimal point.
     auto nzpos = s.find_last_not_of('0');
-    s = s.substr(0, nzpos + 1);
+    s.resize(nzpos + 1);
 
     // Make sure there is one 0 after the decimal point.
     if (s.back() == '.')
@@ -239,24 +239,42 @@ std::string OGRFormatDouble(double val, const OGRWktOptions &opts, int nDimIdx)
     if (std::isnan(val))
         return "nan";
 
-    std::ostringstream oss;
-    oss.imbue(std::locale::classic());  // Make sure we output decimal points.
+    const int nPrecision = nDimIdx < 3    ? opts.xyPrecision
+                           : nDimIdx == 3 ? opts.zPrecision
+                                          : opts.mPrecision;
     bool l_round(opts.round);
+    std::string sval;
     if (opts.format == OGRWktFormat::F ||
         (opts.format == OGRWktFormat::Default && fabs(val) < 1))
-        oss << std::fixed;
+    {
+        // Same as std::fixed formatting, but avoids the (costly) set up of
+        // a std::ostringstream for what is a hot path of vector writers.
+        char szBuffer[64];
+        const int nLen =
+            CPLsnprintf(szBuffer, sizeof(szBuffer), "%.*f", nPrecision, val);
+        if (nLen >= 0 && nLen < static_cast<int>(sizeof(szBuffer)))
+        {
+            sval.assign(szBuffer, nLen);
+        }
+        else if (nLen > 0)
+        {
+            sval.resize(nLen + 1);
+            CPLsnprintf(&sval[0], sval.size(), "%.*f", nPrecision, val);
+            sval.resize(nLen);
+        }
+    }
     else
     {
+        std::ostringstream oss;
+        // Make sure we output decimal points.
+        oss.imbue(std::locale::classic());
         // Uppercase because OGC spec says capital 'E'.
         oss << std::uppercase;
         l_round = false;
+        oss << std::setprecision(nPrecision);
+        oss << val;
+        sval = oss.str();
     }
-    oss << std::setprecision(nDimIdx < 3    ? opts.xyPrecision
-                             : nDimIdx == 3 ? opts.zPrecision
-                                            : opts.mPrecision);
-    oss << val;
-
-    std::string sval = oss.str();
 
     if (l_round)
         sval = intelliround(sval);
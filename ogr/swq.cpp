@@ -42,6 +42,24 @@
 
 #define YYSTYPE swq_expr_node *
 
+/************************************************************************/
+/*                          swq_next_word_is()                          */
+/************************************************************************/
+
+// Returns whether the next word after pszInput, skipping white space, is
+// pszWord (case insensitive).
+static bool swq_next_word_is(const char *pszInput, const char *pszWord)
+{
+    while (*pszInput == ' ' || *pszInput == '\t' || *pszInput == 10 ||
+           *pszInput == 13)
+        ++pszInput;
+    const size_t nLen = strlen(pszWord);
+    if (!EQUALN(pszInput, pszWord, nLen))
+        return false;
+    const unsigned char chNext = static_cast<unsigned char>(pszInput[nLen]);
+    return !isalnum(chNext) && chNext != '_' && chNext <= 127;
+}
+
 /************************************************************************/
 /*                               swqlex()                               */
 /************************************************************************/
@@ -269,6 +287,10 @@ int swqlex(YYSTYPE *ppNode, swq_parse_context *context)
             nReturn = SWQT_ORDER;
         else if (EQUAL(osToken, "BY"))
             nReturn = SWQT_BY;
+        // Only a keyword when followed by BY, so that "group" can still be
+        // used as a field name, in the select list or in WHERE expressions.
+        else if (EQUAL(osToken, "GROUP") && swq_next_word_is(pszNext, "BY"))
+            nReturn = SWQT_GROUP;
         else if (EQUAL(osToken, "FROM"))
             nReturn = SWQT_FROM;
         else if (EQUAL(osToken, "AS"))
@@ -935,9 +957,10 @@ CPLErr swq_expr_compile2(const char *where_clause, swq_field_list *field_list,
 /************************************************************************/
 
 static const char *const apszSQLReservedKeywords[] = {
-    "OR",    "AND",      "NOT",    "LIKE",   "IS",   "NULL", "IN",    "BETWEEN",
-    "CAST",  "DISTINCT", "ESCAPE", "SELECT", "LEFT", "JOIN", "WHERE", "ON",
-    "ORDER", "BY",       "FROM",   "AS",     "ASC",  "DESC", "UNION", "ALL"};
+    "OR",      "AND",   "NOT",      "LIKE",   "IS",     "NULL", "IN",
+    "BETWEEN", "CAST",  "DISTINCT", "ESCAPE", "SELECT", "LEFT", "JOIN",
+    "WHERE",   "ON",    "ORDER",    "BY",     "FROM",   "AS",   "ASC",
+    "DESC",    "UNION", "ALL",      "GROUP"};
 
 int swq_is_reserved_keyword(const char *pszStr)
 {
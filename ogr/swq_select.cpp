@@ -100,6 +100,14 @@ swq_select::~swq_select()
 
     CPLFree(order_defs);
 
+    for (int i = 0; i < group_specs; i++)
+    {
+        CPLFree(group_defs[i].table_name);
+        CPLFree(group_defs[i].field_name);
+    }
+
+    CPLFree(group_defs);
+
     for (int i = 0; i < join_count; i++)
     {
         delete join_defs[i].poExpr;
@@ -286,6 +294,24 @@ char *swq_select::Unparse()
         CPLFree(pszTmp);
     }
 
+    if (group_specs > 0)
+    {
+        osSelect += " GROUP BY ";
+        for (int i = 0; i < group_specs; i++)
+        {
+            if (i > 0)
+                osSelect += ", ";
+            if (group_defs[i].table_name[0] != '\0')
+            {
+                osSelect += swq_expr_node::QuoteIfNecessary(
+                    group_defs[i].table_name, '"');
+                osSelect += ".";
+            }
+            osSelect +=
+                swq_expr_node::QuoteIfNecessary(group_defs[i].field_name, '"');
+        }
+    }
+
     if (order_specs > 0)
     {
         osSelect += " ORDER BY ";
@@ -693,6 +719,25 @@ void swq_select::PushOrderBy(const char *pszTableName, const char *pszFieldName,
     order_defs[order_specs - 1].ascending_flag = bAscending;
 }
 
+/************************************************************************/
+/*                            PushGroupBy()                             */
+/************************************************************************/
+
+void swq_select::PushGroupBy(const char *pszTableName,
+                             const char *pszFieldName)
+
+{
+    group_specs++;
+    group_defs = static_cast<swq_group_def *>(
+        CPLRealloc(group_defs, sizeof(swq_group_def) * group_specs));
+
+    group_defs[group_specs - 1].table_name =
+        CPLStrdup(pszTableName ? pszTableName : "");
+    group_defs[group_specs - 1].field_name = CPLStrdup(pszFieldName);
+    group_defs[group_specs - 1].table_index = -1;
+    group_defs[group_specs - 1].field_index = -1;
+}
+
 /************************************************************************/
 /*                              PushJoin()                              */
 /************************************************************************/
@@ -1011,6 +1056,52 @@ CPLErr swq_select::parse(swq_field_list *field_list,
         }
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Process column names in GROUP BY specs.                         */
+    /* -------------------------------------------------------------------- */
+    for (int i = 0; i < group_specs; i++)
+    {
+        swq_group_def *def = group_defs + i;
+
+        swq_field_type field_type;
+        def->field_index =
+            swq_identify_field(def->table_name, def->field_name, field_list,
+                               &field_type, &(def->table_index));
+        if (def->field_index == -1)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Unrecognized field name %s in GROUP BY.",
+                     def->table_name[0]
+                         ? CPLSPrintf("%s.%s", def->table_name, def->field_name)
+                         : def->field_name);
+            return CE_Failure;
+        }
+
+        if (def->table_index != 0)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot use field '%s' of a secondary table in "
+                     "a GROUP BY clause",
+                     def->field_name);
+            return CE_Failure;
+        }
+
+        if (field_type == SWQ_GEOMETRY)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot use geometry field '%s' in a GROUP BY clause",
+                     def->field_name);
+            return CE_Failure;
+        }
+    }
+
+    if (group_specs > 0 && query_mode == SWQM_DISTINCT_LIST)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "SELECT DISTINCT and GROUP BY not supported together.");
+        return CE_Failure;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Check if we are producing a one row summary result or a set     */
     /*      of records.  Generate an error if we get conflicting            */
@@ -1064,10 +1155,32 @@ CPLErr swq_select::parse(swq_field_list *field_list,
                 def->distinct_flag = TRUE;
                 this_indicator = SWQM_DISTINCT_LIST;
             }
+            else if (group_specs > 0)
+            {
+                if (!IsGroupByColumn(def))
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Column %s must appear in the GROUP BY clause "
+                             "or be used in an aggregate function.",
+                             def->field_name);
+                    return CE_Failure;
+                }
+                this_indicator = SWQM_SUMMARY_RECORD;
+            }
             else
                 this_indicator = SWQM_RECORDSET;
         }
 
+        if (group_specs > 0 && def->col_func != SWQCF_NONE &&
+            def->table_index > 0)
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "Aggregate function on field '%s' of a secondary table "
+                     "not supported with GROUP BY.",
+                     def->field_name);
+            return CE_Failure;
+        }
+
         if (this_indicator != query_mode && this_indicator != -1 &&
             query_mode != 0)
         {
@@ -1138,6 +1251,23 @@ CPLErr swq_select::parse(swq_field_list *field_list,
                      def->field_name);
             return CE_Failure;
         }
+
+        if (group_specs > 0)
+        {
+            bool bFound = false;
+            for (int j = 0; !bFound && j < group_specs; j++)
+            {
+                bFound = group_defs[j].field_index == def->field_index;
+            }
+            if (!bFound)
+            {
+                CPLError(CE_Failure, CPLE_NotSupported,
+                         "Only GROUP BY fields can be used in the ORDER BY "
+                         "clause of a GROUP BY query, which '%s' is not",
+                         def->field_name);
+                return CE_Failure;
+            }
+        }
     }
 
     /* -------------------------------------------------------------------- */
@@ -1158,6 +1288,25 @@ CPLErr swq_select::parse(swq_field_list *field_list,
     return CE_None;
 }
 
+/************************************************************************/
+/*                           IsGroupByColumn()                          */
+/************************************************************************/
+
+bool swq_select::IsGroupByColumn(const swq_col_def *def) const
+{
+    if (def->expr != nullptr && def->expr->eNodeType != SNT_COLUMN)
+        return false;
+    for (int i = 0; i < group_specs; i++)
+    {
+        if (group_defs[i].table_index == def->table_index &&
+            group_defs[i].field_index == def->field_index)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 bool swq_select::IsFieldExcluded(int src_index, const char *pszTableName,
                                  const char *pszFieldName)
 {
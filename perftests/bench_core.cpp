@@ -0,0 +1,1156 @@
+/******************************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  Microbenchmarks of core hot paths
+ * Author:   agent, <agent at local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent at local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+// Each benchmark is run with an increasing number of iterations until it
+// lasts at least -min_time seconds, and this is repeated -repetitions times.
+// The median time per iteration is reported.
+// The -json output uses the layout of Google Benchmark, so that two runs
+// (e.g. of two commits) can be compared with its tools/compare.py script:
+//   compare.py benchmarks before.json after.json
+
+#include "cpl_conv.h"
+#include "cpl_json.h"
+#include "cpl_multiproc.h"
+#include "cpl_packed_rtree.h"
+#include "cpl_quad_tree.h"
+#include "cpl_spawn.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+#include "gdal_priv.h"
+#include "gdal_utils.h"
+#include "ogr_geometry.h"
+#include "ogr_spatialref.h"
+#include "ogrsf_frmts.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+/** Timed function: runs the operation nIters times */
+using BenchFunc = std::function<void(int64_t nIters)>;
+
+struct Benchmark
+{
+    std::string osName{};
+    // Number of processed items (pixels, points, features, ...) per iteration
+    double dfItemsPerIter = 0;
+    // Called only if the benchmark is selected. Returns nullptr on failure.
+    std::function<BenchFunc()> fnSetup{};
+};
+
+struct BenchResult
+{
+    std::string osName{};
+    int64_t nIters = 0;
+    double dfRealTimeNs = 0;
+    double dfCPUTimeNs = 0;
+    double dfItemsPerSecond = 0;
+};
+
+std::vector<Benchmark> gaoBenchmarks;
+
+void Register(const std::string &osName, double dfItemsPerIter,
+              std::function<BenchFunc()> fnSetup)
+{
+    Benchmark oBench;
+    oBench.osName = osName;
+    oBench.dfItemsPerIter = dfItemsPerIter;
+    oBench.fnSetup = std::move(fnSetup);
+    gaoBenchmarks.push_back(std::move(oBench));
+}
+
+/************************************************************************/
+/*                           RunBenchmark()                             */
+/************************************************************************/
+
+BenchResult RunBenchmark(const Benchmark &oBench, const BenchFunc &fn,
+                         double dfMinTime, int nRepetitions)
+{
+    // Warm-up
+    fn(1);
+
+    std::vector<std::pair<double, double>> adfTimesPerIter;
+    int64_t nIters = 1;
+    for (int iRep = 0; iRep < nRepetitions; ++iRep)
+    {
+        while (true)
+        {
+            const auto nCPUStart = std::clock();
+            const auto start = std::chrono::steady_clock::now();
+            fn(nIters);
+            const double dfElapsed =
+                std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                              start)
+                    .count();
+            const double dfCPUElapsed =
+                static_cast<double>(std::clock() - nCPUStart) / CLOCKS_PER_SEC;
+            if (dfElapsed >= dfMinTime || nIters >= (INT64_C(1) << 40))
+            {
+                adfTimesPerIter.emplace_back(
+                    dfElapsed * 1e9 / static_cast<double>(nIters),
+                    dfCPUElapsed * 1e9 / static_cast<double>(nIters));
+                break;
+            }
+            // Aim at 1.4 x dfMinTime for the next attempt
+            const double dfFactor =
+                dfElapsed > 0 ? dfMinTime * 1.4 / dfElapsed : 100;
+            nIters = std::max(nIters + 1,
+                              static_cast<int64_t>(static_cast<double>(nIters) *
+                                                   std::min(dfFactor, 100.0)));
+        }
+    }
+
+    std::sort(adfTimesPerIter.begin(), adfTimesPerIter.end());
+    const auto &oMedian = adfTimesPerIter[adfTimesPerIter.size() / 2];
+
+    BenchResult oRes;
+    oRes.osName = oBench.osName;
+    oRes.nIters = nIters;
+    oRes.dfRealTimeNs = oMedian.first;
+    oRes.dfCPUTimeNs = oMedian.second;
+    if (oBench.dfItemsPerIter > 0 && oMedian.first > 0)
+        oRes.dfItemsPerSecond = oBench.dfItemsPerIter * 1e9 / oMedian.first;
+    return oRes;
+}
+
+/************************************************************************/
+/*                        CreateMEMDataset()                            */
+/************************************************************************/
+
+// Creates a MEM dataset filled with a smooth pattern plus some noise, so that
+// it is neither trivially nor not at all compressible.
+GDALDatasetUniquePtr CreateMEMDataset(int nXSize, int nYSize, int nBands,
+                                      GDALDataType eDT)
+{
+    auto poMEMDrv = GetGDALDriverManager()->GetDriverByName("MEM");
+    if (!poMEMDrv)
+        return nullptr;
+    GDALDatasetUniquePtr poDS(
+        poMEMDrv->Create("", nXSize, nYSize, nBands, eDT, nullptr));
+    if (!poDS)
+        return nullptr;
+    double adfGT[] = {0, 1, 0, 0, 0, -1};
+    poDS->SetGeoTransform(adfGT);
+
+    std::vector<double> adfLine(nXSize);
+    unsigned nSeed = 12345;
+    for (int iBand = 1; iBand <= nBands; ++iBand)
+    {
+        auto poBand = poDS->GetRasterBand(iBand);
+        for (int iY = 0; iY < nYSize; ++iY)
+        {
+            for (int iX = 0; iX < nXSize; ++iX)
+            {
+                nSeed = nSeed * 1103515245U + 12345U;
+                adfLine[iX] = ((iX + iY + iBand * 32) % 200) +
+                              static_cast<double>((nSeed >> 16) % 16);
+            }
+            CPL_IGNORE_RET_VAL(poBand->RasterIO(GF_Write, 0, iY, nXSize, 1,
+                                                adfLine.data(), nXSize, 1,
+                                                GDT_Float64, 0, 0, nullptr));
+        }
+    }
+    return poDS;
+}
+
+/************************************************************************/
+/*                       RegisterCopyWords()                            */
+/************************************************************************/
+
+void RegisterCopyWords()
+{
+    constexpr int N = 256 * 256;
+    const GDALDataType aeTypes[] = {GDT_Byte,   GDT_UInt16, GDT_Int16,
+                                    GDT_UInt32, GDT_Int32,  GDT_Float32,
+                                    GDT_Float64};
+    for (const GDALDataType eSrcDT : aeTypes)
+    {
+        for (const GDALDataType eDstDT : aeTypes)
+        {
+            Register(std::string("GDALCopyWords64/")
+                         .append(GDALGetDataTypeName(eSrcDT))
+                         .append("->")
+                         .append(GDALGetDataTypeName(eDstDT)),
+                     N,
+                     [eSrcDT, eDstDT]() -> BenchFunc
+                     {
+                         auto pabySrc = std::make_shared<std::vector<GByte>>(
+                             N * GDALGetDataTypeSizeBytes(eSrcDT));
+                         for (size_t i = 0; i < pabySrc->size(); ++i)
+                             (*pabySrc)[i] = static_cast<GByte>(i * 7);
+                         auto pabyDst = std::make_shared<std::vector<GByte>>(
+                             N * GDALGetDataTypeSizeBytes(eDstDT));
+                         return [pabySrc, pabyDst, eSrcDT, eDstDT](int64_t n)
+                         {
+                             for (int64_t i = 0; i < n; ++i)
+                             {
+                                 GDALCopyWords64(
+                                     pabySrc->data(), eSrcDT,
+                                     GDALGetDataTypeSizeBytes(eSrcDT),
+                                     pabyDst->data(), eDstDT,
+                                     GDALGetDataTypeSizeBytes(eDstDT), N);
+                             }
+                         };
+                     });
+        }
+    }
+}
+
+/************************************************************************/
+/*                       RegisterBlockCache()                           */
+/************************************************************************/
+
+// Each thread reads all blocks of its own dataset handle. In "Hit" mode,
+// the blocks are in the block cache and the benchmark measures the cost of
+// the cache lookups, including the contention on the global cache mutex.
+// In "Miss" mode, the cache of the dataset is flushed before each
+// iteration, so blocks are read again and added to the cache.
+void RegisterBlockCache()
+{
+    constexpr int SIZE = 2048;
+    constexpr int BLOCK_SIZE = 256;
+    constexpr int N_BLOCKS = (SIZE / BLOCK_SIZE) * (SIZE / BLOCK_SIZE);
+    const char *pszFilename = "/vsimem/bench_core_blockcache.tif";
+
+    std::vector<int> anThreads{1, 2, 4};
+    if (CPLGetNumCPUs() > 4)
+        anThreads.push_back(CPLGetNumCPUs());
+
+    for (const bool bHit : {true, false})
+    {
+        for (const int nThreads : anThreads)
+        {
+            Register(
+                std::string("BlockCache/")
+                    .append(bHit ? "Hit" : "Miss")
+                    .append("/threads:")
+                    .append(std::to_string(nThreads)),
+                static_cast<double>(N_BLOCKS) * nThreads,
+                [pszFilename, bHit, nThreads]() -> BenchFunc
+                {
+                    VSIStatBufL sStat;
+                    if (VSIStatL(pszFilename, &sStat) != 0)
+                    {
+                        auto poSrcDS =
+                            CreateMEMDataset(SIZE, SIZE, 1, GDT_Byte);
+                        auto poGTiffDrv =
+                            GetGDALDriverManager()->GetDriverByName("GTiff");
+                        if (!poSrcDS || !poGTiffDrv)
+                            return nullptr;
+                        const char *const apszOptions[] = {
+                            "TILED=YES", "BLOCKXSIZE=256", "BLOCKYSIZE=256",
+                            nullptr};
+                        GDALDatasetUniquePtr(
+                            poGTiffDrv->CreateCopy(
+                                pszFilename, poSrcDS.get(), false,
+                                const_cast<char **>(apszOptions), nullptr,
+                                nullptr))
+                            .reset();
+                    }
+                    auto apoDS =
+                        std::make_shared<std::vector<GDALDatasetUniquePtr>>();
+                    for (int i = 0; i < nThreads; ++i)
+                    {
+                        apoDS->emplace_back(GDALDataset::Open(
+                            pszFilename,
+                            GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR));
+                        if (!apoDS->back())
+                            return nullptr;
+                    }
+                    return [apoDS, bHit, nThreads](int64_t n)
+                    {
+                        const auto Read = [apoDS, bHit, n](int iThread)
+                        {
+                            GDALDataset *poDS = (*apoDS)[iThread].get();
+                            auto poBand = poDS->GetRasterBand(1);
+                            std::vector<GByte> abyBuffer(BLOCK_SIZE *
+                                                         BLOCK_SIZE);
+                            for (int64_t i = 0; i < n; ++i)
+                            {
+                                if (!bHit)
+                                    poDS->FlushCache(false);
+                                for (int iY = 0; iY < SIZE; iY += BLOCK_SIZE)
+                                {
+                                    for (int iX = 0; iX < SIZE;
+                                         iX += BLOCK_SIZE)
+                                    {
+                                        CPL_IGNORE_RET_VAL(poBand->RasterIO(
+                                            GF_Read, iX, iY, BLOCK_SIZE,
+                                            BLOCK_SIZE, abyBuffer.data(),
+                                            BLOCK_SIZE, BLOCK_SIZE, GDT_Byte, 0,
+                                            0, nullptr));
+                                    }
+                                }
+                            }
+                        };
+                        if (nThreads == 1)
+                        {
+                            Read(0);
+                            return;
+                        }
+                        std::vector<std::thread> aoThreads;
+                        for (int i = 0; i < nThreads; ++i)
+                            aoThreads.emplace_back(Read, i);
+                        for (auto &oThread : aoThreads)
+                            oThread.join();
+                    };
+                });
+        }
+    }
+}
+
+/************************************************************************/
+/*                        RegisterGTiffDecode()                         */
+/************************************************************************/
+
+void RegisterGTiffDecode()
+{
+    auto poGTiffDrv = GetGDALDriverManager()->GetDriverByName("GTiff");
+    if (!poGTiffDrv)
+        return;
+    const char *pszCO =
+        poGTiffDrv->GetMetadataItem(GDAL_DMD_CREATIONOPTIONLIST);
+    constexpr int SIZE = 1024;
+    constexpr int BANDS = 3;
+
+    for (const char *pszCodec :
+         {"NONE", "PACKBITS", "LZW", "DEFLATE", "ZSTD", "LZMA", "LERC",
+          "LERC_ZSTD", "JPEG", "WEBP", "JXL"})
+    {
+        if (!EQUAL(pszCodec, "NONE") && pszCO &&
+            !strstr(pszCO, CPLSPrintf("<Value>%s</Value>", pszCodec)))
+        {
+            continue;
+        }
+        Register(
+            std::string("GTiffDecode/").append(pszCodec),
+            static_cast<double>(SIZE) * SIZE,
+            [pszCodec, poGTiffDrv]() -> BenchFunc
+            {
+                const std::string osFilename(
+                    CPLSPrintf("/vsimem/bench_core_%s.tif", pszCodec));
+                auto poSrcDS = CreateMEMDataset(SIZE, SIZE, BANDS, GDT_Byte);
+                if (!poSrcDS)
+                    return nullptr;
+                CPLStringList aosOptions;
+                aosOptions.SetNameValue("TILED", "YES");
+                aosOptions.SetNameValue("COMPRESS", pszCodec);
+                if (EQUAL(pszCodec, "WEBP") || EQUAL(pszCodec, "JPEG"))
+                    aosOptions.SetNameValue("INTERLEAVE", "PIXEL");
+                GDALDatasetUniquePtr poDS(poGTiffDrv->CreateCopy(
+                    osFilename.c_str(), poSrcDS.get(), false, aosOptions.List(),
+                    nullptr, nullptr));
+                if (!poDS)
+                    return nullptr;
+                poDS.reset();
+
+                auto pabyBuffer =
+                    std::make_shared<std::vector<GByte>>(SIZE * SIZE * BANDS);
+                return [osFilename, pabyBuffer](int64_t n)
+                {
+                    for (int64_t i = 0; i < n; ++i)
+                    {
+                        // Reopen it, so that blocks are decoded again
+                        GDALDatasetUniquePtr poReadDS(GDALDataset::Open(
+                            osFilename.c_str(), GDAL_OF_RASTER));
+                        if (!poReadDS)
+                            return;
+                        CPL_IGNORE_RET_VAL(poReadDS->RasterIO(
+                            GF_Read, 0, 0, SIZE, SIZE, pabyBuffer->data(), SIZE,
+                            SIZE, GDT_Byte, BANDS, nullptr, 0, 0, 0, nullptr));
+                    }
+                };
+            });
+    }
+}
+
+/************************************************************************/
+/*                           RegisterWarp()                             */
+/************************************************************************/
+
+void RegisterWarp()
+{
+    constexpr int SRC_SIZE = 1024;
+    // Non-integer ratio, so that all the kernels go through their general
+    // code path
+    constexpr int DST_SIZE = 700;
+    const GDALDataType aeTypes[] = {GDT_Byte, GDT_UInt16, GDT_Int16,
+                                    GDT_Float32, GDT_Float64};
+    for (const char *pszResampling :
+         {"near", "bilinear", "cubic", "cubicspline", "lanczos", "average",
+          "rms", "mode", "max", "min", "med", "q1", "q3", "sum"})
+    {
+        for (const GDALDataType eDT : aeTypes)
+        {
+            Register(std::string("Warp/")
+                         .append(pszResampling)
+                         .append("/")
+                         .append(GDALGetDataTypeName(eDT)),
+                     static_cast<double>(DST_SIZE) * DST_SIZE,
+                     [pszResampling, eDT]() -> BenchFunc
+                     {
+                         std::shared_ptr<GDALDataset> poSrcDS(
+                             CreateMEMDataset(SRC_SIZE, SRC_SIZE, 1, eDT));
+                         if (!poSrcDS)
+                             return nullptr;
+                         CPLStringList aosArgv;
+                         aosArgv.AddString("-of");
+                         aosArgv.AddString("MEM");
+                         aosArgv.AddString("-r");
+                         aosArgv.AddString(pszResampling);
+                         aosArgv.AddString("-ts");
+                         aosArgv.AddString(CPLSPrintf("%d", DST_SIZE));
+                         aosArgv.AddString(CPLSPrintf("%d", DST_SIZE));
+                         std::shared_ptr<GDALWarpAppOptions> psOptions(
+                             GDALWarpAppOptionsNew(aosArgv.List(), nullptr),
+                             GDALWarpAppOptionsFree);
+                         if (!psOptions)
+                             return nullptr;
+                         return [poSrcDS, psOptions](int64_t n)
+                         {
+                             for (int64_t i = 0; i < n; ++i)
+                             {
+                                 GDALDatasetH hSrcDS =
+                                     GDALDataset::ToHandle(poSrcDS.get());
+                                 GDALClose(GDALWarp("", nullptr, 1, &hSrcDS,
+                                                    psOptions.get(), nullptr));
+                             }
+                         };
+                     });
+        }
+    }
+}
+
+/************************************************************************/
+/*                         RegisterOverview()                           */
+/************************************************************************/
+
+void RegisterOverview()
+{
+    constexpr int SRC_SIZE = 2048;
+    constexpr int DST_SIZE = SRC_SIZE / 2;
+    const GDALDataType aeTypes[] = {GDT_Byte, GDT_UInt16, GDT_Float32};
+    for (const char *pszResampling :
+         {"NEAREST", "AVERAGE", "RMS", "BILINEAR", "CUBIC", "CUBICSPLINE",
+          "LANCZOS", "GAUSS", "MODE"})
+    {
+        for (const GDALDataType eDT : aeTypes)
+        {
+            Register(
+                std::string("Overview/")
+                    .append(pszResampling)
+                    .append("/")
+                    .append(GDALGetDataTypeName(eDT)),
+                static_cast<double>(DST_SIZE) * DST_SIZE,
+                [pszResampling, eDT]() -> BenchFunc
+                {
+                    std::shared_ptr<GDALDataset> poSrcDS(
+                        CreateMEMDataset(SRC_SIZE, SRC_SIZE, 1, eDT));
+                    std::shared_ptr<GDALDataset> poDstDS(
+                        CreateMEMDataset(DST_SIZE, DST_SIZE, 1, eDT));
+                    if (!poSrcDS || !poDstDS)
+                        return nullptr;
+                    return [poSrcDS, poDstDS, pszResampling](int64_t n)
+                    {
+                        GDALRasterBandH hSrcBand =
+                            GDALRasterBand::ToHandle(poSrcDS->GetRasterBand(1));
+                        GDALRasterBandH hDstBand =
+                            GDALRasterBand::ToHandle(poDstDS->GetRasterBand(1));
+                        for (int64_t i = 0; i < n; ++i)
+                        {
+                            CPL_IGNORE_RET_VAL(GDALRegenerateOverviews(
+                                hSrcBand, 1, &hDstBand, pszResampling, nullptr,
+                                nullptr));
+                        }
+                    };
+                });
+        }
+    }
+}
+
+/************************************************************************/
+/*                           RegisterWkb()                              */
+/************************************************************************/
+
+void RegisterWkb()
+{
+    const auto CreateRing = [](int nPoints, double dfX, double dfY)
+    {
+        auto poRing = std::make_unique<OGRLinearRing>();
+        poRing->setNumPoints(nPoints + 1);
+        for (int i = 0; i < nPoints; ++i)
+        {
+            const double dfAngle = 2 * M_PI * i / nPoints;
+            poRing->setPoint(i, dfX + cos(dfAngle), dfY + sin(dfAngle));
+        }
+        poRing->setPoint(nPoints, dfX + 1, dfY);
+        return poRing;
+    };
+
+    std::vector<std::pair<std::string, std::function<OGRGeometry *()>>> aoGeoms;
+    aoGeoms.emplace_back("Point", []() { return new OGRPoint(1, 2); });
+    aoGeoms.emplace_back("LineString10000",
+                         [CreateRing]()
+                         {
+                             auto poLS = new OGRLineString();
+                             auto poRing = CreateRing(10000, 0, 0);
+                             poLS->addSubLineString(poRing.get());
+                             return poLS;
+                         });
+    aoGeoms.emplace_back("Polygon1000",
+                         [CreateRing]()
+                         {
+                             auto poPoly = new OGRPolygon();
+                             poPoly->addRingDirectly(
+                                 CreateRing(1000, 0, 0).release());
+                             return poPoly;
+                         });
+    aoGeoms.emplace_back("MultiPolygon100x100",
+                         [CreateRing]()
+                         {
+                             auto poMP = new OGRMultiPolygon();
+                             for (int i = 0; i < 100; ++i)
+                             {
+                                 auto poPoly = new OGRPolygon();
+                                 poPoly->addRingDirectly(
+                                     CreateRing(100, i * 3, 0).release());
+                                 poMP->addGeometryDirectly(poPoly);
+                             }
+                             return poMP;
+                         });
+
+    for (const auto &oGeom : aoGeoms)
+    {
+        const auto &fnCreate = oGeom.second;
+        Register("OGRGeometry/exportToWkb/" + oGeom.first, 0,
+                 [fnCreate]() -> BenchFunc
+                 {
+                     std::shared_ptr<OGRGeometry> poGeom(fnCreate());
+                     auto pabyWkb = std::make_shared<std::vector<GByte>>(
+                         poGeom->WkbSize());
+                     return [poGeom, pabyWkb](int64_t n)
+                     {
+                         for (int64_t i = 0; i < n; ++i)
+                             poGeom->exportToWkb(wkbNDR, pabyWkb->data(),
+                                                 wkbVariantIso);
+                     };
+                 });
+        Register(
+            "OGRGeometryFactory/createFromWkb/" + oGeom.first, 0,
+            [fnCreate]() -> BenchFunc
+            {
+                std::unique_ptr<OGRGeometry> poGeom(fnCreate());
+                auto pabyWkb =
+                    std::make_shared<std::vector<GByte>>(poGeom->WkbSize());
+                poGeom->exportToWkb(wkbNDR, pabyWkb->data(), wkbVariantIso);
+                return [pabyWkb](int64_t n)
+                {
+                    for (int64_t i = 0; i < n; ++i)
+                    {
+                        OGRGeometry *poNewGeom = nullptr;
+                        OGRGeometryFactory::createFromWkb(pabyWkb->data(),
+                                                          nullptr, &poNewGeom,
+                                                          pabyWkb->size());
+                        delete poNewGeom;
+                    }
+                };
+            });
+    }
+}
+
+/************************************************************************/
+/*                          RegisterProjCT()                            */
+/************************************************************************/
+
+void RegisterProjCT()
+{
+    constexpr int N = 100 * 1000;
+    for (const auto &oPair : std::vector<std::pair<int, int>>{
+             {4326, 32631}, {4326, 3857}, {32631, 4326}, {4326, 4978}})
+    {
+        const int nSrcEPSG = oPair.first;
+        const int nDstEPSG = oPair.second;
+        Register(
+            CPLSPrintf("OGRCoordinateTransformation/Transform/EPSG:%d->EPSG:%d",
+                       nSrcEPSG, nDstEPSG),
+            N,
+            [nSrcEPSG, nDstEPSG]() -> BenchFunc
+            {
+                OGRSpatialReference oSrcSRS;
+                OGRSpatialReference oDstSRS;
+                oSrcSRS.SetAxisMappingStrategy(OAMS_TRADITIONAL_GIS_ORDER);
+                oDstSRS.SetAxisMappingStrategy(OAMS_TRADITIONAL_GIS_ORDER);
+                if (oSrcSRS.importFromEPSG(nSrcEPSG) != OGRERR_NONE ||
+                    oDstSRS.importFromEPSG(nDstEPSG) != OGRERR_NONE)
+                {
+                    return nullptr;
+                }
+                std::shared_ptr<OGRCoordinateTransformation> poCT(
+                    OGRCreateCoordinateTransformation(&oSrcSRS, &oDstSRS));
+                if (!poCT)
+                    return nullptr;
+
+                // Points around (3 E, 45 N) in the source CRS
+                std::vector<double> adfX(N), adfY(N), adfZ(N);
+                for (int i = 0; i < N; ++i)
+                {
+                    adfX[i] = 2.5 + (i % 1000) * 1e-3;
+                    adfY[i] = 45 + (i / 1000) * 1e-2;
+                    adfZ[i] = 0;
+                }
+                if (nSrcEPSG != 4326)
+                {
+                    std::unique_ptr<OGRCoordinateTransformation> poInvCT(
+                        OGRCreateCoordinateTransformation(&oDstSRS, &oSrcSRS));
+                    if (!poInvCT ||
+                        !poInvCT->Transform(N, adfX.data(), adfY.data(),
+                                            adfZ.data()))
+                        return nullptr;
+                }
+                auto padfBuffer = std::make_shared<std::vector<double>>(3 * N);
+                return [poCT, adfX, adfY, adfZ, padfBuffer](int64_t n)
+                {
+                    double *padfX = padfBuffer->data();
+                    double *padfY = padfX + N;
+                    double *padfZ = padfY + N;
+                    for (int64_t i = 0; i < n; ++i)
+                    {
+                        memcpy(padfX, adfX.data(), N * sizeof(double));
+                        memcpy(padfY, adfY.data(), N * sizeof(double));
+                        memcpy(padfZ, adfZ.data(), N * sizeof(double));
+                        poCT->Transform(N, padfX, padfY, padfZ);
+                    }
+                };
+            });
+    }
+}
+
+/************************************************************************/
+/*                       RegisterSpatialIndex()                         */
+/************************************************************************/
+
+// Building of, and window queries on, a CPLQuadTree and a CPLPackedRTree
+// indexing the same random small rectangles. Each query iteration runs
+// QUERIES windows, each one returning about 10 items.
+void RegisterSpatialIndex()
+{
+    constexpr int N = 100 * 1000;
+    constexpr int QUERIES = 1000;
+
+    struct Data
+    {
+        std::vector<CPLRectObj> asItems{};
+        std::vector<CPLRectObj> asQueries{};
+    };
+
+    const auto GetData = []()
+    {
+        static std::shared_ptr<Data> poData;
+        if (!poData)
+        {
+            poData = std::make_shared<Data>();
+            uint32_t nSeed = 1;
+            const auto Rand = [&nSeed]()
+            {
+                nSeed = nSeed * 1103515245 + 12345;
+                return static_cast<double>((nSeed >> 8) & 0xFFFF) / 65535;
+            };
+            constexpr double ITEM_SIZE = 1e-3;
+            for (int i = 0; i < N; ++i)
+            {
+                CPLRectObj sRect;
+                sRect.minx = Rand();
+                sRect.miny = Rand();
+                sRect.maxx = sRect.minx + Rand() * ITEM_SIZE;
+                sRect.maxy = sRect.miny + Rand() * ITEM_SIZE;
+                poData->asItems.push_back(sRect);
+            }
+            // Windows of area 10 / N
+            const double dfQuerySize = std::sqrt(10.0 / N);
+            for (int i = 0; i < QUERIES; ++i)
+            {
+                CPLRectObj sRect;
+                sRect.minx = Rand();
+                sRect.miny = Rand();
+                sRect.maxx = sRect.minx + dfQuerySize;
+                sRect.maxy = sRect.miny + dfQuerySize;
+                poData->asQueries.push_back(sRect);
+            }
+        }
+        return poData;
+    };
+
+    const auto GetItemBounds =
+        [](const void *hFeature, void *pUserData, CPLRectObj *pBounds)
+    {
+        const auto *pasItems = static_cast<const CPLRectObj *>(pUserData);
+        *pBounds = pasItems[reinterpret_cast<uintptr_t>(hFeature)];
+    };
+    const auto CreateQuadTree = [GetItemBounds](Data &oData)
+    {
+        CPLRectObj sGlobalBounds = {0, 0, 1 + 1e-3, 1 + 1e-3};
+        CPLQuadTree *hTree = CPLQuadTreeCreateEx(&sGlobalBounds, GetItemBounds,
+                                                 oData.asItems.data());
+        CPLQuadTreeSetMaxDepth(hTree, CPLQuadTreeGetAdvisedMaxDepth(N));
+        for (uintptr_t i = 0; i < static_cast<uintptr_t>(N); ++i)
+            CPLQuadTreeInsert(hTree, reinterpret_cast<void *>(i));
+        return hTree;
+    };
+
+    Register("SpatialIndex/Build/CPLQuadTree", N,
+             [GetData, CreateQuadTree]() -> BenchFunc
+             {
+                 auto poData = GetData();
+                 return [poData, CreateQuadTree](int64_t n)
+                 {
+                     for (int64_t i = 0; i < n; ++i)
+                         CPLQuadTreeDestroy(CreateQuadTree(*poData));
+                 };
+             });
+    for (const auto eMethod :
+         {CPLPackedRTree::SortMethod::HILBERT, CPLPackedRTree::SortMethod::STR})
+    {
+        Register(std::string("SpatialIndex/Build/CPLPackedRTree/")
+                     .append(eMethod == CPLPackedRTree::SortMethod::HILBERT
+                                 ? "Hilbert"
+                                 : "STR"),
+                 N,
+                 [GetData, eMethod]() -> BenchFunc
+                 {
+                     auto poData = GetData();
+                     return [poData, eMethod](int64_t n)
+                     {
+                         for (int64_t i = 0; i < n; ++i)
+                         {
+                             CPLPackedRTree oTree;
+                             oTree.Build(poData->asItems.data(), N, eMethod);
+                         }
+                     };
+                 });
+    }
+
+    Register("SpatialIndex/Query/CPLQuadTree", QUERIES,
+             [GetData, CreateQuadTree]() -> BenchFunc
+             {
+                 auto poData = GetData();
+                 std::shared_ptr<CPLQuadTree> poTree(CreateQuadTree(*poData),
+                                                     CPLQuadTreeDestroy);
+                 return [poData, poTree](int64_t n)
+                 {
+                     for (int64_t i = 0; i < n; ++i)
+                     {
+                         for (const auto &sQuery : poData->asQueries)
+                         {
+                             int nCount = 0;
+                             CPLFree(CPLQuadTreeSearch(poTree.get(), &sQuery,
+                                                       &nCount));
+                         }
+                     }
+                 };
+             });
+    Register("SpatialIndex/Query/CPLPackedRTree", QUERIES,
+             [GetData]() -> BenchFunc
+             {
+                 auto poData = GetData();
+                 auto poTree = std::make_shared<CPLPackedRTree>();
+                 if (!poTree->Build(poData->asItems.data(), N))
+                     return nullptr;
+                 return [poData, poTree](int64_t n)
+                 {
+                     size_t nTotal = 0;
+                     for (int64_t i = 0; i < n; ++i)
+                     {
+                         for (const auto &sQuery : poData->asQueries)
+                         {
+                             poTree->Search(sQuery,
+                                            [&nTotal](size_t)
+                                            {
+                                                ++nTotal;
+                                                return true;
+                                            });
+                         }
+                     }
+                     CPL_IGNORE_RET_VAL(nTotal);
+                 };
+             });
+    Register("SpatialIndex/Nearest10/CPLPackedRTree", QUERIES,
+             [GetData]() -> BenchFunc
+             {
+                 auto poData = GetData();
+                 auto poTree = std::make_shared<CPLPackedRTree>();
+                 if (!poTree->Build(poData->asItems.data(), N))
+                     return nullptr;
+                 return [poData, poTree](int64_t n)
+                 {
+                     for (int64_t i = 0; i < n; ++i)
+                     {
+                         for (const auto &sQuery : poData->asQueries)
+                         {
+                             CPL_IGNORE_RET_VAL(
+                                 poTree->Nearest(sQuery.minx, sQuery.miny, 10));
+                         }
+                     }
+                 };
+             });
+}
+
+/************************************************************************/
+/*                      RegisterVectorReaders()                         */
+/************************************************************************/
+
+void RegisterVectorReaders()
+{
+    constexpr int N = 10 * 1000;
+
+    const auto ReadAll = [](const std::string &osFilename)
+    {
+        return [osFilename](int64_t n)
+        {
+            for (int64_t i = 0; i < n; ++i)
+            {
+                GDALDatasetUniquePtr poDS(
+                    GDALDataset::Open(osFilename.c_str(), GDAL_OF_VECTOR));
+                if (!poDS)
+                    return;
+                for (auto &&poFeature : poDS->GetLayer(0))
+                {
+                    CPL_IGNORE_RET_VAL(poFeature);
+                }
+            }
+        };
+    };
+
+    Register("OGR/ReadAll/CSV", N,
+             [ReadAll]() -> BenchFunc
+             {
+                 const std::string osFilename("/vsimem/bench_core.csv");
+                 VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "wb");
+                 if (!fp)
+                     return nullptr;
+                 VSIFPrintfL(fp, "id,name,x,y,value,date\n");
+                 for (int i = 0; i < N; ++i)
+                 {
+                     VSIFPrintfL(fp,
+                                 "%d,\"name %d, with a comma\",%.8f,%.8f,%.3f,"
+                                 "2024-01-%02d\n",
+                                 i, i, 2 + i * 1e-4, 49 - i * 1e-4, i * 0.5,
+                                 1 + i % 28);
+                 }
+                 VSIFCloseL(fp);
+                 return ReadAll(osFilename);
+             });
+
+    Register("OGR/ReadAll/GeoJSON", N,
+             [ReadAll]() -> BenchFunc
+             {
+                 const std::string osFilename("/vsimem/bench_core.geojson");
+                 VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "wb");
+                 if (!fp)
+                     return nullptr;
+                 VSIFPrintfL(fp, "{\"type\":\"FeatureCollection\","
+                                 "\"features\":[\n");
+                 for (int i = 0; i < N; ++i)
+                 {
+                     VSIFPrintfL(
+                         fp,
+                         "%s{\"type\":\"Feature\",\"properties\":{\"id\":%d,"
+                         "\"name\":\"name %d\",\"value\":%.3f,"
+                         "\"flag\":%s},\"geometry\":{\"type\":\"LineString\","
+                         "\"coordinates\":[[%.8f,%.8f],[%.8f,%.8f],"
+                         "[%.8f,%.8f]]}}\n",
+                         i == 0 ? "" : ",", i, i, i * 0.5,
+                         (i % 2) ? "true" : "false", 2 + i * 1e-4,
+                         49 - i * 1e-4, 2.1 + i * 1e-4, 49.1 - i * 1e-4,
+                         2.2 + i * 1e-4, 49.2 - i * 1e-4);
+                 }
+                 VSIFPrintfL(fp, "]}\n");
+                 VSIFCloseL(fp);
+                 return ReadAll(osFilename);
+             });
+}
+
+/************************************************************************/
+/*                          RegisterVSICurl()                           */
+/************************************************************************/
+
+// Requires a URL served by a local HTTP server, e.g.
+// "python3 -m http.server" started in a directory with a large file.
+void RegisterVSICurl(const std::string &osURL)
+{
+    if (osURL.empty())
+        return;
+    const std::string osFilename = "/vsicurl/" + osURL;
+
+    Register("VSICurl/ReadWhole", 0,
+             [osFilename]() -> BenchFunc
+             {
+                 return [osFilename](int64_t n)
+                 {
+                     std::vector<GByte> abyBuffer(1024 * 1024);
+                     for (int64_t i = 0; i < n; ++i)
+                     {
+                         VSICurlClearCache();
+                         VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "rb");
+                         if (!fp)
+                             return;
+                         while (VSIFReadL(abyBuffer.data(), 1, abyBuffer.size(),
+                                          fp) == abyBuffer.size())
+                         {
+                         }
+                         VSIFCloseL(fp);
+                     }
+                 };
+             });
+
+    constexpr int N_RANGES = 100;
+    Register(
+        "VSICurl/RandomReads16KB", N_RANGES,
+        [osFilename]() -> BenchFunc
+        {
+            VSIStatBufL sStat;
+            if (VSIStatL(osFilename.c_str(), &sStat) != 0 ||
+                sStat.st_size < 16384)
+            {
+                return nullptr;
+            }
+            const vsi_l_offset nSize = sStat.st_size;
+            return [osFilename, nSize](int64_t n)
+            {
+                std::vector<GByte> abyBuffer(16384);
+                unsigned nSeed = 1;
+                for (int64_t i = 0; i < n; ++i)
+                {
+                    VSICurlClearCache();
+                    VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "rb");
+                    if (!fp)
+                        return;
+                    for (int j = 0; j < N_RANGES; ++j)
+                    {
+                        nSeed = nSeed * 1103515245U + 12345U;
+                        VSIFSeekL(fp,
+                                  (static_cast<vsi_l_offset>(nSeed) * 65537) %
+                                      (nSize - abyBuffer.size()),
+                                  SEEK_SET);
+                        CPL_IGNORE_RET_VAL(VSIFReadL(abyBuffer.data(), 1,
+                                                     abyBuffer.size(), fp));
+                    }
+                    VSIFCloseL(fp);
+                }
+            };
+        });
+}
+
+/************************************************************************/
+/*                          RegisterStartup()                           */
+/************************************************************************/
+
+// Measures the start-up of a process doing GDALAllRegister(), which is
+// mostly driven by driver registration (and thus by
+// GDAL_ENABLE_DEFERRED_BUILTIN_DRIVERS)
+void RegisterStartup(const char *pszSelf)
+{
+    const std::string osSelf(pszSelf);
+    Register("Startup/AllRegister", 0,
+             [osSelf]() -> BenchFunc
+             {
+                 const char *const apszArgs[] = {osSelf.c_str(),
+                                                 "-startup-child", nullptr};
+                 if (CPLSpawn(apszArgs, nullptr, nullptr, true) != 0)
+                     return nullptr;
+                 return [osSelf](int64_t n)
+                 {
+                     const char *const apszChildArgs[] = {
+                         osSelf.c_str(), "-startup-child", nullptr};
+                     for (int64_t i = 0; i < n; ++i)
+                         CPLSpawn(apszChildArgs, nullptr, nullptr, true);
+                 };
+             });
+}
+
+/************************************************************************/
+/*                              Usage()                                 */
+/************************************************************************/
+
+void Usage()
+{
+    printf("Usage: bench_core [-filter <substring>]* [-min_time <seconds>]\n");
+    printf("                  [-repetitions <count>] [-json <filename>]\n");
+    printf("                  [-http-url <url>] [-list]\n");
+    exit(1);
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                               main()                                 */
+/************************************************************************/
+
+int main(int argc, char *argv[])
+{
+    std::vector<std::string> aosFilters;
+    double dfMinTime = 0.5;
+    int nRepetitions = 3;
+    std::string osJSONFilename;
+    std::string osURL;
+    bool bList = false;
+    for (int iArg = 1; iArg < argc; iArg++)
+    {
+        // Child process spawned by the Startup/AllRegister benchmark
+        if (strcmp(argv[iArg], "-startup-child") == 0)
+        {
+            GDALAllRegister();
+            GDALDestroyDriverManager();
+            return 0;
+        }
+        if (strcmp(argv[iArg], "-filter") == 0 && iArg + 1 < argc)
+            aosFilters.push_back(argv[++iArg]);
+        else if (strcmp(argv[iArg], "-min_time") == 0 && iArg + 1 < argc)
+            dfMinTime = CPLAtof(argv[++iArg]);
+        else if (strcmp(argv[iArg], "-repetitions") == 0 && iArg + 1 < argc)
+            nRepetitions = std::max(1, atoi(argv[++iArg]));
+        else if (strcmp(argv[iArg], "-json") == 0 && iArg + 1 < argc)
+            osJSONFilename = argv[++iArg];
+        else if (strcmp(argv[iArg], "-http-url") == 0 && iArg + 1 < argc)
+            osURL = argv[++iArg];
+        else if (strcmp(argv[iArg], "-list") == 0)
+            bList = true;
+        else
+            Usage();
+    }
+
+    GDALAllRegister();
+
+    RegisterCopyWords();
+    RegisterBlockCache();
+    RegisterGTiffDecode();
+    RegisterWarp();
+    RegisterOverview();
+    RegisterWkb();
+    RegisterProjCT();
+    RegisterSpatialIndex();
+    RegisterVectorReaders();
+    RegisterVSICurl(osURL);
+    RegisterStartup(argv[0]);
+
+    std::vector<BenchResult> aoResults;
+    for (const auto &oBench : gaoBenchmarks)
+    {
+        if (!aosFilters.empty() &&
+            std::none_of(aosFilters.begin(), aosFilters.end(),
+                         [&oBench](const std::string &osFilter) {
+                             return oBench.osName.find(osFilter) !=
+                                    std::string::npos;
+                         }))
+        {
+            continue;
+        }
+        if (bList)
+        {
+            printf("%s\n", oBench.osName.c_str());
+            continue;
+        }
+
+        const BenchFunc fn = oBench.fnSetup();
+        if (!fn)
+        {
+            fprintf(stderr, "%s: setup failed, skipped\n",
+                    oBench.osName.c_str());
+            continue;
+        }
+        const auto oRes = RunBenchmark(oBench, fn, dfMinTime, nRepetitions);
+        if (oRes.dfItemsPerSecond > 0)
+        {
+            printf("%-60s %14.0f ns %12.3f M items/s\n", oRes.osName.c_str(),
+                   oRes.dfRealTimeNs, oRes.dfItemsPerSecond / 1e6);
+        }
+        else
+        {
+            printf("%-60s %14.0f ns\n", oRes.osName.c_str(), oRes.dfRealTimeNs);
+        }
+        fflush(stdout);
+        aoResults.push_back(oRes);
+    }
+
+    if (!osJSONFilename.empty())
+    {
+        CPLJSONDocument oDoc;
+        CPLJSONObject oRoot = oDoc.GetRoot();
+
+        CPLJSONObject oContext;
+        oContext.Add("executable", argv[0]);
+        oContext.Add("gdal_version", GDALVersionInfo("RELEASE_NAME"));
+        oContext.Add("gdal_build_info", GDALVersionInfo("BUILD_INFO"));
+        oContext.Add("num_cpus", CPLGetNumCPUs());
+        oContext.Add("min_time", dfMinTime);
+        oContext.Add("repetitions", nRepetitions);
+        oRoot.Add("context", oContext);
+
+        CPLJSONArray oBenchmarks;
+        for (const auto &oRes : aoResults)
+        {
+            CPLJSONObject oBench;
+            oBench.Add("name", oRes.osName);
+            oBench.Add("run_name", oRes.osName);
+            oBench.Add("run_type", "iteration");
+            oBench.Add("iterations", static_cast<GInt64>(oRes.nIters));
+            oBench.Add("real_time", oRes.dfRealTimeNs);
+            oBench.Add("cpu_time", oRes.dfCPUTimeNs);
+            oBench.Add("time_unit", "ns");
+            if (oRes.dfItemsPerSecond > 0)
+                oBench.Add("items_per_second", oRes.dfItemsPerSecond);
+            oBenchmarks.Add(oBench);
+        }
+        oRoot.Add("benchmarks", oBenchmarks);
+
+        if (!oDoc.Save(osJSONFilename))
+            return 1;
+    }
+
+    const CPLStringList aosFiles(VSIReadDir("/vsimem/"));
+    for (const char *pszFilename : aosFiles)
+    {
+        if (STARTS_WITH(pszFilename, "bench_core"))
+            VSIUnlink(CPLSPrintf("/vsimem/%s", pszFilename));
+    }
+    GDALDestroyDriverManager();
+
+    return 0;
+}
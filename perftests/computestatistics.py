@@ -43,3 +43,26 @@ print(
     "testFloat64(): %.3f"
     % timeit.timeit("test(gdal.GDT_Float64)", setup=setup, number=NITERS)
 )
+
+
+def test_all_cpus(dt):
+    with gdal.config_option("GDAL_NUM_THREADS", "ALL_CPUS"):
+        return tab_ds[dt].GetRasterBand(1).ComputeStatistics(False)
+
+
+for dt in (gdal.GDT_Int16, gdal.GDT_Float32, gdal.GDT_Float64):
+    assert test_all_cpus(dt) == tab_ds[dt].GetRasterBand(1).ComputeStatistics(False)
+
+setup = "from osgeo import gdal; from __main__ import test_all_cpus"
+print(
+    "testInt16_ALL_CPUS(): %.3f"
+    % timeit.timeit("test_all_cpus(gdal.GDT_Int16)", setup=setup, number=NITERS)
+)
+print(
+    "testFloat32_ALL_CPUS(): %.3f"
+    % timeit.timeit("test_all_cpus(gdal.GDT_Float32)", setup=setup, number=NITERS)
+)
+print(
+    "testFloat64_ALL_CPUS(): %.3f"
+    % timeit.timeit("test_all_cpus(gdal.GDT_Float64)", setup=setup, number=NITERS)
+)
@@ -27,6 +27,11 @@ ds_float32 = gdal.GetDriverByName("MEM").Create(
 )
 ds_float32.GetRasterBand(1).Fill(32767)
 
+ds_float64 = gdal.GetDriverByName("MEM").Create(
+    "", 1024 * 10, 1024 * 10, 1, gdal.GDT_Float64
+)
+ds_float64.GetRasterBand(1).Fill(32767)
+
 NITERS = 50
 
 
@@ -78,6 +83,14 @@ def testAverageFloat32(downsampling_factor):
     )
 
 
+def testAverageFloat64(downsampling_factor):
+    ds_float64.ReadRaster(
+        buf_xsize=ds_float64.RasterXSize // downsampling_factor,
+        buf_ysize=ds_float64.RasterYSize // downsampling_factor,
+        resample_alg=gdal.GRIORA_Average,
+    )
+
+
 def testAverageNoData(downsampling_factor):
     ds_nodata.ReadRaster(
         buf_xsize=ds_nodata.RasterXSize // downsampling_factor,
@@ -119,6 +132,14 @@ def testRMSFloat32(downsampling_factor):
     )
 
 
+def testRMSFloat64(downsampling_factor):
+    ds_float64.ReadRaster(
+        buf_xsize=ds_float64.RasterXSize // downsampling_factor,
+        buf_ysize=ds_float64.RasterYSize // downsampling_factor,
+        resample_alg=gdal.GRIORA_RMS,
+    )
+
+
 def testCubic(downsampling_factor):
     ds.ReadRaster(
         buf_xsize=ds.RasterXSize // downsampling_factor,
@@ -177,6 +198,22 @@ print(
         "testRMSFloat32(2)", setup="from __main__ import testRMSFloat32", number=NITERS
     )
 )
+print(
+    "testAverageFloat64(2): %.3f"
+    % timeit.timeit(
+        "testAverageFloat64(2)",
+        setup="from __main__ import testAverageFloat64",
+        number=NITERS,
+    )
+)
+print(
+    "testRMSFloat64(2): %.3f"
+    % timeit.timeit(
+        "testRMSFloat64(2)",
+        setup="from __main__ import testRMSFloat64",
+        number=NITERS,
+    )
+)
 
 print(
     "testNear(2): %.3f"
@@ -224,6 +261,86 @@ print(
     "testRMS(4): %.3f"
     % timeit.timeit("testRMS(4)", setup="from __main__ import testRMS", number=NITERS)
 )
+print(
+    "testAverage(3): %.3f"
+    % timeit.timeit(
+        "testAverage(3)",
+        setup="from __main__ import testAverage",
+        number=NITERS,
+    )
+)
+print(
+    "testRMS(3): %.3f"
+    % timeit.timeit(
+        "testRMS(3)",
+        setup="from __main__ import testRMS",
+        number=NITERS,
+    )
+)
+print(
+    "testAverage(8): %.3f"
+    % timeit.timeit(
+        "testAverage(8)",
+        setup="from __main__ import testAverage",
+        number=NITERS,
+    )
+)
+print(
+    "testRMS(8): %.3f"
+    % timeit.timeit(
+        "testRMS(8)",
+        setup="from __main__ import testRMS",
+        number=NITERS,
+    )
+)
+print(
+    "testAverageUInt16(3): %.3f"
+    % timeit.timeit(
+        "testAverageUInt16(3)",
+        setup="from __main__ import testAverageUInt16",
+        number=NITERS,
+    )
+)
+print(
+    "testRMSUInt16(3): %.3f"
+    % timeit.timeit(
+        "testRMSUInt16(3)",
+        setup="from __main__ import testRMSUInt16",
+        number=NITERS,
+    )
+)
+print(
+    "testAverageUInt16(4): %.3f"
+    % timeit.timeit(
+        "testAverageUInt16(4)",
+        setup="from __main__ import testAverageUInt16",
+        number=NITERS,
+    )
+)
+print(
+    "testRMSUInt16(4): %.3f"
+    % timeit.timeit(
+        "testRMSUInt16(4)",
+        setup="from __main__ import testRMSUInt16",
+        number=NITERS,
+    )
+)
+print(
+    "testAverageUInt16(8): %.3f"
+    % timeit.timeit(
+        "testAverageUInt16(8)",
+        setup="from __main__ import testAverageUInt16",
+        number=NITERS,
+    )
+)
+print(
+    "testRMSUInt16(8): %.3f"
+    % timeit.timeit(
+        "testRMSUInt16(8)",
+        setup="from __main__ import testRMSUInt16",
+        number=NITERS,
+    )
+)
 
 print(
     "testCubic(2): %.3f"
@@ -0,0 +1,46 @@
+# SPDX-License-Identifier: MIT
+# Copyright 2026 agent <agent at local>
+
+# Measures the driver probing overhead of GDALOpenEx() on many small files,
+# where most of the time is spent asking each driver whether it recognizes
+# the file.
+
+import sys
+import timeit
+
+from osgeo import gdal
+
+gdal.UseExceptions()
+
+NFILES = int(sys.argv[1]) if len(sys.argv) > 1 else 100000
+
+filenames = {}
+src_ds = gdal.GetDriverByName("MEM").Create("", 4, 4)
+for drv_name, ext in (("GTiff", "tif"), ("PNG", "png"), ("GIF", "gif")):
+    drv = gdal.GetDriverByName(drv_name)
+    if drv is None:
+        continue
+    filename = f"/vsimem/small.{ext}"
+    drv.CreateCopy(filename, src_ds)
+    # Remove .aux.xml side-car files that could be created
+    gdal.Unlink(filename + ".aux.xml")
+    filenames[drv_name] = filename
+
+
+def test(filename, n):
+    for i in range(n):
+        gdal.OpenEx(filename, gdal.OF_RASTER)
+
+
+setup = "from __main__ import test, filenames"
+for drv_name in filenames:
+    print(
+        "open %d %s files: %.3f"
+        % (
+            NFILES,
+            drv_name,
+            timeit.timeit(
+                f"test(filenames['{drv_name}'], {NFILES})", setup=setup, number=1
+            ),
+        )
+    )
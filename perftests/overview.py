@@ -6,7 +6,7 @@ import time
 from osgeo import gdal
 
 
-def doit(compress, threads):
+def doit(compress, threads, resampling="CUBIC"):
 
     gdal.SetConfigOption("GDAL_NUM_THREADS", str(threads))
 
@@ -21,9 +21,12 @@ def doit(compress, threads):
 
     ds = gdal.Open(filename, gdal.GA_Update)
     start = time.time()
-    ds.BuildOverviews("CUBIC", [2, 4, 8])
+    ds.BuildOverviews(resampling, [2, 4, 8, 16, 32])
     end = time.time()
-    print("COMPRESS=%s, NUM_THREADS=%d: %.2f" % (compress, threads, end - start))
+    print(
+        "COMPRESS=%s, NUM_THREADS=%d, %s: %.2f"
+        % (compress, threads, resampling, end - start)
+    )
 
     gdal.SetConfigOption("GDAL_NUM_THREADS", None)
 
@@ -37,3 +40,7 @@ doit("ZSTD", 0)
 doit("ZSTD", 2)
 doit("ZSTD", 4)
 doit("ZSTD", 8)
+
+for resampling in ("AVERAGE", "GAUSS", "MODE", "CUBICSPLINE"):
+    doit("NONE", 0, resampling)
+    doit("NONE", 8, resampling)
@@ -0,0 +1,169 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  Test performance and accuracy of the approximate transformer,
+ *           with the per-scanline approximation and with the transform grid.
+ * Author:   agent, <agent at local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent at local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "cpl_conv.h"
+#include "gdal_alg.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+struct BaseTransformerArg
+{
+    int nCost = 0;
+    long long nPoints = 0;
+};
+}  // namespace
+
+// Smooth non-linear transformer, with an artificial cost per point to
+// simulate an expensive (PROJ, RPC+DEM, ...) transformation.
+static int CurvedTransformer(void *pTransformerArg, int /*bDstToSrc*/,
+                             int nPointCount, double *x, double *y,
+                             double * /*z*/, int *panSuccess)
+{
+    auto psArg = static_cast<BaseTransformerArg *>(pTransformerArg);
+    psArg->nPoints += nPointCount;
+    for (int i = 0; i < nPointCount; i++)
+    {
+        double dfX = x[i];
+        double dfY = y[i];
+        for (int j = 0; j < psArg->nCost; ++j)
+        {
+            dfX = dfX + 1e-300 * sin(dfX);
+            dfY = dfY + 1e-300 * cos(dfY);
+        }
+        x[i] = dfX + 20 * sin(dfY / 500) + 1e-5 * dfX * dfY;
+        y[i] = dfY + 20 * cos(dfX / 500);
+        panSuccess[i] = TRUE;
+    }
+    return TRUE;
+}
+
+static void Usage()
+{
+    printf("Usage: testperfapproxtransformer [-size <pixels>] "
+           "[-step <pixels>] [-error <max_error>] [-chunk <lines>] "
+           "[-cost <iterations>]\n");
+    exit(1);
+}
+
+static void Run(const char *pszGridStep, int nSize, int nChunkLines,
+                double dfMaxError, int nCost)
+{
+    CPLSetConfigOption("GDAL_APPROX_TRANSFORMER_GRID_STEP", pszGridStep);
+    BaseTransformerArg sArg;
+    sArg.nCost = nCost;
+    void *hTransformArg =
+        GDALCreateApproxTransformer(CurvedTransformer, &sArg, dfMaxError);
+    CPLSetConfigOption("GDAL_APPROX_TRANSFORMER_GRID_STEP", nullptr);
+
+    std::vector<double> adfX(nSize), adfY(nSize), adfZ(nSize);
+    std::vector<int> anSuccess(nSize);
+    double dfTime = 0;
+    double dfMaxObservedError = 0;
+    BaseTransformerArg sExactArg;
+
+    // Process the output by chunks of lines, as the warper does, and check
+    // the accuracy of the first line of each chunk.
+    for (int iChunk = 0; iChunk < nSize; iChunk += nChunkLines)
+    {
+        const int nLines = std::min(nChunkLines, nSize - iChunk);
+        const auto start = std::chrono::steady_clock::now();
+        for (int iY = iChunk; iY < iChunk + nLines; ++iY)
+        {
+            for (int iX = 0; iX < nSize; ++iX)
+            {
+                adfX[iX] = iX + 0.5;
+                adfY[iX] = iY + 0.5;
+                adfZ[iX] = 0;
+            }
+            GDALApproxTransform(hTransformArg, TRUE, nSize, adfX.data(),
+                                adfY.data(), adfZ.data(), anSuccess.data());
+        }
+        const auto end = std::chrono::steady_clock::now();
+        dfTime += std::chrono::duration<double>(end - start).count();
+
+        for (int iX = 0; iX < nSize; ++iX)
+        {
+            double dfX = iX + 0.5;
+            double dfY = iChunk + nLines - 1 + 0.5;
+            double dfZ = 0;
+            int bSuccess = FALSE;
+            CurvedTransformer(&sExactArg, TRUE, 1, &dfX, &dfY, &dfZ,
+                              &bSuccess);
+            dfMaxObservedError =
+                std::max(dfMaxObservedError,
+                         fabs(dfX - adfX[iX]) + fabs(dfY - adfY[iX]));
+        }
+    }
+
+    printf("grid step %s: %.3f s, %lld exact points, max error %g\n",
+           pszGridStep, dfTime, sArg.nPoints, dfMaxObservedError);
+
+    GDALDestroyApproxTransformer(hTransformArg);
+}
+
+int main(int argc, char *argv[])
+{
+    int nSize = 4096;
+    int nChunkLines = 256;
+    double dfMaxError = 0.125;
+    int nCost = 100;
+    const char *pszStep = "32";
+    for (int iArg = 1; iArg < argc; iArg++)
+    {
+        if (strcmp(argv[iArg], "-size") == 0 && iArg + 1 < argc)
+            nSize = atoi(argv[++iArg]);
+        else if (strcmp(argv[iArg], "-step") == 0 && iArg + 1 < argc)
+            pszStep = argv[++iArg];
+        else if (strcmp(argv[iArg], "-error") == 0 && iArg + 1 < argc)
+            dfMaxError = CPLAtof(argv[++iArg]);
+        else if (strcmp(argv[iArg], "-chunk") == 0 && iArg + 1 < argc)
+            nChunkLines = atoi(argv[++iArg]);
+        else if (strcmp(argv[iArg], "-cost") == 0 && iArg + 1 < argc)
+            nCost = atoi(argv[++iArg]);
+        else
+            Usage();
+    }
+    if (nSize <= 0 || nChunkLines <= 0 || nCost < 0 || atoi(pszStep) <= 0)
+        Usage();
+
+    printf("%dx%d output, max error %g, chunks of %d lines\n", nSize, nSize,
+           dfMaxError, nChunkLines);
+    Run("0", nSize, nChunkLines, dfMaxError, nCost);
+    Run(pszStep, nSize, nChunkLines, dfMaxError, nCost);
+
+    return 0;
+}
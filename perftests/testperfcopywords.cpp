@@ -32,52 +32,75 @@
 
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <ctime>
 
-int main(int /* argc */, char * /* argv */[])
+static void Usage()
 {
+    printf("Usage: testperfcopywords [-iter <count>]\n");
+    exit(1);
+}
+
+int main(int argc, char *argv[])
+{
+    int nIters = 1000;
+    for (int iArg = 1; iArg < argc; iArg++)
+    {
+        if (strcmp(argv[iArg], "-iter") == 0 && iArg + 1 < argc)
+            nIters = atoi(argv[++iArg]);
+        else
+            Usage();
+    }
+
     void *in = calloc(1, 256 * 256 * 16);
     void *out = malloc(256 * 256 * 16);
 
     int i;
-    int intype, outtype;
 
     clock_t start, end;
 
-    for (intype = GDT_Byte; intype < GDT_TypeCount; intype++)
+    // Timing matrix of all input x output data type combinations, for
+    // packed buffers, strided input and packed output, and strided input
+    // and output.
+    const char *const apszModes[] = {"packed", "strided -> packed",
+                                     "strided -> strided"};
+    for (int iMode = 0; iMode < 3; iMode++)
     {
-        for (outtype = GDT_Byte; outtype < GDT_TypeCount; outtype++)
-        {
-            start = clock();
+        printf("\n%s (%d iterations, seconds)\n", apszModes[iMode], nIters);
+        printf("%-10s", "in \\ out");
+        for (int outtype = GDT_Byte; outtype < GDT_TypeCount; outtype++)
+            printf(" %9s", GDALGetDataTypeName((GDALDataType)outtype));
+        printf("\n");
 
-            for (i = 0; i < 1000; i++)
-                GDALCopyWords(in, (GDALDataType)intype, 16, out,
-                              (GDALDataType)outtype, 16, 256 * 256);
-
-            end = clock();
-
-            printf("%s -> %s : %.2f s\n",
-                   GDALGetDataTypeName((GDALDataType)intype),
-                   GDALGetDataTypeName((GDALDataType)outtype),
-                   (end - start) * 1.0 / CLOCKS_PER_SEC);
-
-            start = clock();
-
-            for (i = 0; i < 1000; i++)
-                GDALCopyWords(in, (GDALDataType)intype,
-                              GDALGetDataTypeSize((GDALDataType)intype) / 8,
-                              out, (GDALDataType)outtype,
-                              GDALGetDataTypeSize((GDALDataType)outtype) / 8,
-                              256 * 256);
-
-            end = clock();
-
-            printf("%s -> %s (packed) : %.2f s\n",
-                   GDALGetDataTypeName((GDALDataType)intype),
-                   GDALGetDataTypeName((GDALDataType)outtype),
-                   (end - start) * 1.0 / CLOCKS_PER_SEC);
+        for (int intype = GDT_Byte; intype < GDT_TypeCount; intype++)
+        {
+            printf("%-10s", GDALGetDataTypeName((GDALDataType)intype));
+            for (int outtype = GDT_Byte; outtype < GDT_TypeCount; outtype++)
+            {
+                const int nInStride =
+                    iMode == 0
+                        ? GDALGetDataTypeSizeBytes((GDALDataType)intype)
+                        : 16;
+                const int nOutStride =
+                    iMode == 2
+                        ? 16
+                        : GDALGetDataTypeSizeBytes((GDALDataType)outtype);
+
+                start = clock();
+
+                for (i = 0; i < nIters; i++)
+                    GDALCopyWords(in, (GDALDataType)intype, nInStride, out,
+                                  (GDALDataType)outtype, nOutStride,
+                                  256 * 256);
+
+                end = clock();
+
+                printf(" %9.3f", (end - start) * 1.0 / CLOCKS_PER_SEC);
+            }
+            printf("\n");
         }
     }
+    printf("\n");
 
     for (int k = 0; k < 2; k++)
     {
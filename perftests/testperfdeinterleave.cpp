@@ -33,6 +33,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <ctime>
+#include <vector>
 
 int main(int /* argc */, char * /* argv */[])
 {
@@ -97,6 +98,29 @@ int main(int /* argc */, char * /* argv */[])
     }
     CPLSetConfigOption("GDAL_USE_SSSE3", nullptr);
 
+    // Hyperspectral-like cases, with a large number of components
+    for (const GDALDataType eDT : {GDT_UInt16, GDT_Float32})
+    {
+        for (const int nComponents : {8, 32, 200})
+        {
+            std::vector<void *> apDstBuffers;
+            const size_t nIters = static_cast<size_t>(SIZE) * SIZE /
+                                  GDALGetDataTypeSizeBytes(eDT) / nComponents;
+            for (int i = 0; i < nComponents; ++i)
+                apDstBuffers.push_back(
+                    VSI_MALLOC_VERBOSE(nIters * GDALGetDataTypeSizeBytes(eDT)));
+            const auto start = clock();
+            for (int i = 0; i < 2000 * 4 / nComponents + 10; ++i)
+                GDALDeinterleave(src, eDT, nComponents, apDstBuffers.data(),
+                                 eDT, nIters);
+            const auto end = clock();
+            printf("GDALDeinterleave %s %d : %.2f\n", GDALGetDataTypeName(eDT),
+                   nComponents, (end - start) * 1.0 / CLOCKS_PER_SEC);
+            for (void *p : apDstBuffers)
+                VSIFree(p);
+        }
+    }
+
     VSIFree(src);
     VSIFree(dst0);
     VSIFree(dst1);
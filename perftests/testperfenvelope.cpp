@@ -0,0 +1,79 @@
+/******************************************************************************
+ *
+ * Project:  OGR
+ * Purpose:  Test performance of envelope computation of geometries.
+ * Author:   agent, <agent at local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent at local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "ogr_geometry.h"
+#include "ogr_wkb.h"
+
+#include <cstdio>
+#include <ctime>
+#include <vector>
+
+int main(int /* argc */, char * /* argv */[])
+{
+    constexpr int POINT_COUNT = 10 * 1000 * 1000;
+    constexpr int ITERATIONS = 20;
+
+    for (const bool bIs3D : {false, true})
+    {
+        OGRLineString oLS;
+        oLS.setNumPoints(POINT_COUNT, false);
+        for (int i = 0; i < POINT_COUNT; ++i)
+        {
+            if (bIs3D)
+                oLS.setPoint(i, i % 1000, i / 1000, i);
+            else
+                oLS.setPoint(i, i % 1000, i / 1000);
+        }
+
+        {
+            OGREnvelope3D sEnvelope;
+            const auto start = clock();
+            for (int i = 0; i < ITERATIONS; ++i)
+                oLS.getEnvelope(&sEnvelope);
+            const auto end = clock();
+            printf("OGRSimpleCurve::getEnvelope() %s: %.3f\n",
+                   bIs3D ? "XYZ" : "XY",
+                   (end - start) * 1.0 / CLOCKS_PER_SEC / ITERATIONS);
+        }
+
+        std::vector<GByte> abyWKB(oLS.WkbSize());
+        static_cast<const OGRGeometry &>(oLS).exportToWkb(
+            wkbNDR, abyWKB.data(), wkbVariantIso);
+        {
+            OGREnvelope3D sEnvelope;
+            const auto start = clock();
+            for (int i = 0; i < ITERATIONS; ++i)
+                OGRWKBGetBoundingBox(abyWKB.data(), abyWKB.size(), sEnvelope);
+            const auto end = clock();
+            printf("OGRWKBGetBoundingBox() %s: %.3f\n", bIs3D ? "XYZ" : "XY",
+                   (end - start) * 1.0 / CLOCKS_PER_SEC / ITERATIONS);
+        }
+    }
+
+    return 0;
+}
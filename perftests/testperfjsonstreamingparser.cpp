@@ -0,0 +1,108 @@
+/******************************************************************************
+ *
+ * Project:  CPL
+ * Purpose:  Test performance of CPLJSonStreamingParser.
+ * Author:   agent, <agent at local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent at local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "cpl_json_streaming_parser.h"
+#include "cpl_string.h"
+
+#include <cstdio>
+#include <algorithm>
+#include <ctime>
+#include <string>
+
+namespace
+{
+class CountingParser final : public CPLJSonStreamingParser
+{
+  public:
+    size_t m_nStringCount = 0;
+    size_t m_nNumberCount = 0;
+
+    void String(const char *, size_t) override
+    {
+        ++m_nStringCount;
+    }
+
+    void Number(const char *, size_t) override
+    {
+        ++m_nNumberCount;
+    }
+};
+}  // namespace
+
+int main(int /* argc */, char * /* argv */[])
+{
+    constexpr int FEATURE_COUNT = 200 * 1000;
+    constexpr int ITERATIONS = 5;
+
+    // Build a GeoJSON-like document, with both short and long strings
+    std::string osJSON("{\"type\":\"FeatureCollection\",\"features\":[");
+    for (int i = 0; i < FEATURE_COUNT; ++i)
+    {
+        if (i > 0)
+            osJSON += ',';
+        osJSON += CPLSPrintf(
+            "{\"type\":\"Feature\",\"properties\":{\"id\":%d,"
+            "\"name\":\"feature number %d\",\"description\":\"%s\"},"
+            "\"geometry\":{\"type\":\"LineString\",\"coordinates\":"
+            "[[%.8f,%.8f],[%.8f,%.8f],[%.8f,%.8f]]}}",
+            i, i,
+            "A rather long description, as often found in attributes of "
+            "real-world datasets, with an \\\"escaped\\\" part",
+            i * 1e-3, i * 2e-3, i * 3e-3, i * 4e-3, i * 5e-3, i * 6e-3);
+    }
+    osJSON += "]}";
+
+    for (const size_t nChunkSize :
+         {osJSON.size(), static_cast<size_t>(4096), static_cast<size_t>(100)})
+    {
+        const auto start = clock();
+        for (int iter = 0; iter < ITERATIONS; ++iter)
+        {
+            CountingParser oParser;
+            for (size_t i = 0; i < osJSON.size(); i += nChunkSize)
+            {
+                const size_t nSize = std::min(nChunkSize, osJSON.size() - i);
+                if (!oParser.Parse(osJSON.data() + i, nSize,
+                                   i + nSize == osJSON.size()))
+                {
+                    fprintf(stderr, "Parsing failed\n");
+                    return 1;
+                }
+            }
+        }
+        const auto end = clock();
+        const double dfSeconds =
+            (end - start) * 1.0 / CLOCKS_PER_SEC / ITERATIONS;
+        printf("CPLJSonStreamingParser::Parse() with chunks of %u bytes: "
+               "%.3f s (%.1f MB/s)\n",
+               static_cast<unsigned>(nChunkSize), dfSeconds,
+               osJSON.size() / dfSeconds / (1024 * 1024));
+    }
+
+    return 0;
+}
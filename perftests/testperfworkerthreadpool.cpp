@@ -0,0 +1,129 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Test performance of CPLWorkerThreadPool with many small jobs.
+ * Author:   agent, <agent at local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent at local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "cpl_conv.h"
+#include "cpl_multiproc.h"
+#include "cpl_worker_thread_pool.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+static std::atomic<int> gnCounter{0};
+
+static void TinyJob(void *)
+{
+    gnCounter++;
+}
+
+static void NestedJob(void *pData)
+{
+    auto poPool = static_cast<CPLWorkerThreadPool *>(pData);
+    auto poQueue = poPool->CreateJobQueue();
+    for (int i = 0; i < 16; ++i)
+        poQueue->SubmitJob(TinyJob, nullptr);
+    poQueue->WaitCompletion();
+}
+
+static void Usage()
+{
+    printf("Usage: testperfworkerthreadpool [-threads <count>] "
+           "[-jobs <count>]\n");
+    exit(1);
+}
+
+int main(int argc, char *argv[])
+{
+    int nThreads = CPLGetNumCPUs();
+    int nJobs = 1000 * 1000;
+    for (int iArg = 1; iArg < argc; iArg++)
+    {
+        if (strcmp(argv[iArg], "-threads") == 0 && iArg + 1 < argc)
+            nThreads = atoi(argv[++iArg]);
+        else if (strcmp(argv[iArg], "-jobs") == 0 && iArg + 1 < argc)
+            nJobs = atoi(argv[++iArg]);
+        else
+            Usage();
+    }
+    if (nThreads <= 0 || nJobs <= 0)
+        Usage();
+
+    CPLWorkerThreadPool oPool;
+    if (!oPool.Setup(nThreads, nullptr, nullptr))
+    {
+        fprintf(stderr, "Setup() failed\n");
+        return 1;
+    }
+    printf("%d threads, %d jobs\n", nThreads, nJobs);
+
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < nJobs; ++i)
+            oPool.SubmitJob(TinyJob, nullptr);
+        oPool.WaitCompletion();
+        const auto end = std::chrono::steady_clock::now();
+        printf("SubmitJob() from one thread : %.3f s\n",
+               std::chrono::duration<double>(end - start).count());
+    }
+
+    {
+        std::vector<void *> apData(nJobs, nullptr);
+        const auto start = std::chrono::steady_clock::now();
+        oPool.SubmitJobs(TinyJob, apData);
+        oPool.WaitCompletion();
+        const auto end = std::chrono::steady_clock::now();
+        printf("SubmitJobs() : %.3f s\n",
+               std::chrono::duration<double>(end - start).count());
+    }
+
+    {
+        const auto start = std::chrono::steady_clock::now();
+        auto poQueue = oPool.CreateJobQueue();
+        for (int i = 0; i < nJobs; ++i)
+            poQueue->SubmitJob(TinyJob, nullptr);
+        poQueue->WaitCompletion();
+        const auto end = std::chrono::steady_clock::now();
+        printf("CPLJobQueue::SubmitJob() : %.3f s\n",
+               std::chrono::duration<double>(end - start).count());
+    }
+
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < nJobs / 16; ++i)
+            oPool.SubmitJob(NestedJob, &oPool);
+        oPool.WaitCompletion();
+        const auto end = std::chrono::steady_clock::now();
+        printf("Nested submission from jobs : %.3f s\n",
+               std::chrono::duration<double>(end - start).count());
+    }
+
+    return 0;
+}
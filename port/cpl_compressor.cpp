@@ -29,6 +29,7 @@
 #include "cpl_error.h"
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
+#include "cpl_trace.h"
 #include "cpl_conv.h"  // CPLZLibInflate()
 
 #ifdef HAVE_BLOSC
@@ -75,6 +76,7 @@ static bool CPLBloscCompressor(const void *input_data, size_t input_size,
                                CSLConstList options,
                                void * /* compressor_user_data */)
 {
+    CPL_TRACE_SCOPE_CAT("CPLBloscCompressor", "codec");
     if (output_data != nullptr && *output_data != nullptr &&
         output_size != nullptr && *output_size != 0)
     {
@@ -153,6 +155,7 @@ static bool CPLBloscDecompressor(const void *input_data, size_t input_size,
                                  CSLConstList options,
                                  void * /* compressor_user_data */)
 {
+    CPL_TRACE_SCOPE_CAT("CPLBloscDecompressor", "codec");
     size_t nSafeSize = 0;
     if (blosc_cbuffer_validate(input_data, input_size, &nSafeSize) < 0)
     {
@@ -220,6 +223,7 @@ static bool CPLLZMACompressor(const void *input_data, size_t input_size,
                               CSLConstList options,
                               void * /* compressor_user_data */)
 {
+    CPL_TRACE_SCOPE_CAT("CPLLZMACompressor", "codec");
     if (output_data != nullptr && *output_data != nullptr &&
         output_size != nullptr && *output_size != 0)
     {
@@ -290,6 +294,7 @@ static bool CPLLZMADecompressor(const void *input_data, size_t input_size,
                                 CSLConstList options,
                                 void * /* compressor_user_data */)
 {
+    CPL_TRACE_SCOPE_CAT("CPLLZMADecompressor", "codec");
     if (output_data != nullptr && *output_data != nullptr &&
         output_size != nullptr && *output_size != 0)
     {
@@ -386,6 +391,7 @@ static bool CPLZSTDCompressor(const void *input_data, size_t input_size,
                               CSLConstList options,
                               void * /* compressor_user_data */)
 {
+    CPL_TRACE_SCOPE_CAT("CPLZSTDCompressor", "codec");
     if (output_data != nullptr && *output_data != nullptr &&
         output_size != nullptr && *output_size != 0)
     {
@@ -485,6 +491,7 @@ static bool CPLZSTDDecompressor(const void *input_data, size_t input_size,
                                 CSLConstList /* options */,
                                 void * /* compressor_user_data */)
 {
+    CPL_TRACE_SCOPE_CAT("CPLZSTDDecompressor", "codec");
     if (output_data != nullptr && *output_data != nullptr &&
         output_size != nullptr && *output_size != 0)
     {
@@ -543,6 +550,7 @@ static bool CPLLZ4Compressor(const void *input_data, size_t input_size,
                              CSLConstList options,
                              void * /* compressor_user_data */)
 {
+    CPL_TRACE_SCOPE_CAT("CPLLZ4Compressor", "codec");
     if (input_size > static_cast<size_t>(std::numeric_limits<int>::max()))
     {
         CPLError(CE_Failure, CPLE_NotSupported,
@@ -630,6 +638,7 @@ static bool CPLLZ4Decompressor(const void *input_data, size_t input_size,
                                CSLConstList options,
                                void * /* compressor_user_data */)
 {
+    CPL_TRACE_SCOPE_CAT("CPLLZ4Decompressor", "codec");
     if (input_size > static_cast<size_t>(std::numeric_limits<int>::max()))
     {
         CPLError(CE_Failure, CPLE_NotSupported,
@@ -885,6 +894,7 @@ static bool CPLZlibCompressor(const void *input_data, size_t input_size,
                               void **output_data, size_t *output_size,
                               CSLConstList options, void *compressor_user_data)
 {
+    CPL_TRACE_SCOPE_CAT("CPLZlibCompressor", "codec");
     const char *alg = static_cast<const char *>(compressor_user_data);
     const auto pfnCompress =
         strcmp(alg, "zlib") == 0 ? CPLZLibDeflate : CPLGZipCompress;
@@ -1439,6 +1449,7 @@ static bool CPLZlibDecompressor(const void *input_data, size_t input_size,
                                 CSLConstList /* options */,
                                 void * /* compressor_user_data */)
 {
+    CPL_TRACE_SCOPE_CAT("CPLZlibDecompressor", "codec");
     if (output_data != nullptr && *output_data != nullptr &&
         output_size != nullptr && *output_size != 0)
     {
@@ -43,6 +43,11 @@
 #include "gdal_csv.h"
 
 #include <algorithm>
+#include <string>
+
+#if defined(__x86_64) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
 
 /* ==================================================================== */
 /*      The CSVTable is a persistent set of info about an open CSV      */
@@ -266,6 +271,44 @@ void CSVDeaccess(const char *pszFilename)
     CSVDeaccessInternal(ppsCSVTableList, true, pszFilename);
 }
 
+/************************************************************************/
+/*                        CSVSkipRegularChars()                         */
+/*                                                                      */
+/*      Return the first position in [pszIter, pszEnd) that holds a    */
+/*      double quote or chSpecial, or pszEnd if there is none. Most     */
+/*      of the bytes of a record are skipped here, so this is done 32   */
+/*      bytes at a time with SSE2 when available.                       */
+/************************************************************************/
+
+static const char *CSVSkipRegularChars(const char *pszIter,
+                                       const char *pszEnd, char chSpecial)
+{
+#if defined(__x86_64) || defined(_M_X64)
+    const __m128i xmmQuote = _mm_set1_epi8('"');
+    const __m128i xmmSpecial = _mm_set1_epi8(chSpecial);
+    constexpr int BLOCK_SIZE = 2 * static_cast<int>(sizeof(__m128i));
+    while (pszEnd - pszIter >= BLOCK_SIZE)
+    {
+        const __m128i xmm0 =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(pszIter));
+        const __m128i xmm1 = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(pszIter + sizeof(__m128i)));
+        const __m128i xmmMatch0 =
+            _mm_or_si128(_mm_cmpeq_epi8(xmm0, xmmQuote),
+                         _mm_cmpeq_epi8(xmm0, xmmSpecial));
+        const __m128i xmmMatch1 =
+            _mm_or_si128(_mm_cmpeq_epi8(xmm1, xmmQuote),
+                         _mm_cmpeq_epi8(xmm1, xmmSpecial));
+        if (_mm_movemask_epi8(_mm_or_si128(xmmMatch0, xmmMatch1)))
+            break;
+        pszIter += BLOCK_SIZE;
+    }
+#endif
+    while (pszIter < pszEnd && *pszIter != '"' && *pszIter != chSpecial)
+        ++pszIter;
+    return pszIter;
+}
+
 /************************************************************************/
 /*                            CSVSplitLine()                            */
 /*                                                                      */
@@ -284,20 +327,32 @@ static char **CSVSplitLine(const char *pszString, const char *pszDelimiter,
     if (pszString == nullptr)
         return static_cast<char **>(CPLCalloc(sizeof(char *), 1));
 
-    char *pszToken = static_cast<char *>(CPLCalloc(10, 1));
-    int nTokenMax = 10;
+    std::string osToken;
     const size_t nDelimiterLength = strlen(pszDelimiter);
+    const char *const pszEnd = pszString + strlen(pszString);
 
     const char *pszIter = pszString;
     while (*pszIter != '\0')
     {
         bool bInString = false;
 
-        int nTokenLen = 0;
+        osToken.clear();
 
         // Try to find the next delimiter, marking end of token.
         do
         {
+            // Copy at once the characters that cannot end the token or
+            // change the quoting state.
+            const char *pszRunEnd = CSVSkipRegularChars(
+                pszIter, pszEnd, bInString ? '"' : pszDelimiter[0]);
+            if (pszRunEnd != pszIter)
+            {
+                osToken.append(pszIter, pszRunEnd - pszIter);
+                pszIter = pszRunEnd;
+                if (*pszIter == '\0')
+                    break;
+            }
+
             // End if this is a delimiter skip it and break.
             if (!bInString &&
                 strncmp(pszIter, pszDelimiter, nDelimiterLength) == 0)
@@ -314,7 +369,7 @@ static char **CSVSplitLine(const char *pszString, const char *pszDelimiter,
 
             if (*pszIter == '"')
             {
-                if (!bInString && nTokenLen > 0)
+                if (!bInString && !osToken.empty())
                 {
                     // do not treat in a special way double quotes that appear
                     // in the middle of a field (similarly to OpenOffice)
@@ -332,18 +387,10 @@ static char **CSVSplitLine(const char *pszString, const char *pszDelimiter,
                 }
             }
 
-            if (nTokenLen >= nTokenMax - 2)
-            {
-                nTokenMax = nTokenMax * 2 + 10;
-                pszToken = static_cast<char *>(CPLRealloc(pszToken, nTokenMax));
-            }
-
-            pszToken[nTokenLen] = *pszIter;
-            nTokenLen++;
+            osToken += *pszIter;
         } while (*(++pszIter) != '\0');
 
-        pszToken[nTokenLen] = '\0';
-        aosRetList.AddString(pszToken);
+        aosRetList.AddString(osToken.c_str());
 
         // If the last token is an empty token, then we have to catch
         // it now, otherwise we won't reenter the loop and it will be lost.
@@ -356,8 +403,6 @@ static char **CSVSplitLine(const char *pszString, const char *pszDelimiter,
         }
     }
 
-    CPLFree(pszToken);
-
     if (aosRetList.Count() == 0)
         return static_cast<char **>(CPLCalloc(sizeof(char *), 1));
     else
@@ -0,0 +1,132 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Hilbert curve index of a cell of a 2D grid
+ * Author:   agent, <agent at local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent at local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#ifndef CPL_HILBERT_H_INCLUDED
+#define CPL_HILBERT_H_INCLUDED
+
+#include "cpl_port.h"
+
+#include <algorithm>
+
+//! @cond Doxygen_Suppress
+
+/** Maximum coordinate of a cell given to CPLHilbertCode() */
+constexpr GUInt32 CPL_HILBERT_MAX_COORD = 0xFFFF;
+
+/************************************************************************/
+/*                           CPLHilbertCode()                           */
+/************************************************************************/
+
+/** Return the position along a Hilbert curve of order 16 of the cell
+ * (nX, nY), with nX and nY in [0, CPL_HILBERT_MAX_COORD].
+ *
+ * Based on public domain code at
+ * https://github.com/rawrunprotected/hilbert_curves
+ */
+inline GUInt32 CPLHilbertCode(GUInt32 nX, GUInt32 nY)
+{
+    const auto Interleave = [](GUInt32 x)
+    {
+        x = (x | (x << 8)) & 0x00FF00FF;
+        x = (x | (x << 4)) & 0x0F0F0F0F;
+        x = (x | (x << 2)) & 0x33333333;
+        x = (x | (x << 1)) & 0x55555555;
+        return x;
+    };
+
+    GUInt32 a = nX ^ nY;
+    GUInt32 b = 0xFFFF ^ a;
+    GUInt32 c = 0xFFFF ^ (nX | nY);
+    GUInt32 d = nX & (nY ^ 0xFFFF);
+
+    GUInt32 A = a | (b >> 1);
+    GUInt32 B = (a >> 1) ^ a;
+    GUInt32 C = ((c >> 1) ^ (b & (d >> 1))) ^ c;
+    GUInt32 D = ((a & (c >> 1)) ^ (d >> 1)) ^ d;
+
+    a = A;
+    b = B;
+    c = C;
+    d = D;
+    A = ((a & (a >> 2)) ^ (b & (b >> 2)));
+    B = ((a & (b >> 2)) ^ (b & ((a ^ b) >> 2)));
+    C ^= ((a & (c >> 2)) ^ (b & (d >> 2)));
+    D ^= ((b & (c >> 2)) ^ ((a ^ b) & (d >> 2)));
+
+    a = A;
+    b = B;
+    c = C;
+    d = D;
+    A = ((a & (a >> 4)) ^ (b & (b >> 4)));
+    B = ((a & (b >> 4)) ^ (b & ((a ^ b) >> 4)));
+    C ^= ((a & (c >> 4)) ^ (b & (d >> 4)));
+    D ^= ((b & (c >> 4)) ^ ((a ^ b) & (d >> 4)));
+
+    a = A;
+    b = B;
+    c = C;
+    d = D;
+    C ^= ((a & (c >> 8)) ^ (b & (d >> 8)));
+    D ^= ((b & (c >> 8)) ^ ((a ^ b) & (d >> 8)));
+
+    a = C ^ (C >> 1);
+    b = D ^ (D >> 1);
+
+    const GUInt32 i0 = nX ^ nY;
+    const GUInt32 i1 = b | (0xFFFF ^ (i0 | a));
+
+    return (Interleave(i1) << 1) | Interleave(i0);
+}
+
+/************************************************************************/
+/*                       CPLHilbertCodeInExtent()                       */
+/************************************************************************/
+
+/** Return CPLHilbertCode() of the cell of the point (dfX, dfY), in a grid of
+ * 65536 x 65536 cells covering the extent starting at (dfMinX, dfMinY), of
+ * size dfWidth x dfHeight. Points outside of the extent are clamped to it,
+ * and a null width or height maps all points to the first column or row.
+ */
+inline GUInt32 CPLHilbertCodeInExtent(double dfX, double dfY, double dfMinX,
+                                      double dfMinY, double dfWidth,
+                                      double dfHeight)
+{
+    constexpr double dfMax = CPL_HILBERT_MAX_COORD;
+    const double dfNormX = dfWidth > 0 ? (dfX - dfMinX) / dfWidth : 0;
+    const double dfNormY = dfHeight > 0 ? (dfY - dfMinY) / dfHeight : 0;
+    // The negated comparisons also map NaN to 0
+    const GUInt32 nX = static_cast<GUInt32>(
+        !(dfNormX > 0) ? 0 : std::min(dfNormX * dfMax, dfMax));
+    const GUInt32 nY = static_cast<GUInt32>(
+        !(dfNormY > 0) ? 0 : std::min(dfNormY * dfMax, dfMax));
+    return CPLHilbertCode(nX, nY);
+}
+
+//! @endcond
+
+#endif /* CPL_HILBERT_H_INCLUDED */
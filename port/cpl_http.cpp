@@ -292,6 +292,73 @@ static CURLcode CPL_ssl_ctx_callback(CURL *, void *pSSL, void *)
 
 #endif  // defined(_WIN32) && defined (HAVE_OPENSSL_CRYPTO)
 
+/************************************************************************/
+/*                       CPLHTTPGetShareHandle()                        */
+/************************************************************************/
+
+// Sharing of TLS sessions and DNS cache is available since curl 7.23
+#if LIBCURL_VERSION_NUM >= 0x071700
+#define HAVE_CURL_SHARE_HANDLE
+
+// Sharing of the connection cache is available since curl 7.57, but only
+// offered since 7.68, which fixed a number of issues with it
+#if LIBCURL_VERSION_NUM >= 0x074400
+#define HAVE_CURL_SHARED_CONNECTION_POOL
+#endif
+
+static std::mutex goShareHandleMutex;
+// Index 0: TLS sessions and DNS cache. Index 1: same plus connection cache.
+static std::array<CURLSH *, 2> gahShareHandles{};
+static std::array<std::mutex, CURL_LOCK_DATA_LAST> gaoShareDataMutex;
+
+static void CPLHTTPShareLock(CURL * /* handle */, curl_lock_data data,
+                             curl_lock_access /* access */,
+                             void * /* userptr */)
+{
+    if (static_cast<size_t>(data) < gaoShareDataMutex.size())
+        gaoShareDataMutex[data].lock();
+}
+
+static void CPLHTTPShareUnlock(CURL * /* handle */, curl_lock_data data,
+                               void * /* userptr */)
+{
+    if (static_cast<size_t>(data) < gaoShareDataMutex.size())
+        gaoShareDataMutex[data].unlock();
+}
+
+// Returns a process-wide share handle, so that TLS sessions and DNS
+// resolutions done by one thread can be reused by the others. If
+// bShareConnections is set, connections opened by one thread can also be
+// reused by the others, instead of each thread maintaining its own pool of
+// connections to the same host.
+static CURLSH *CPLHTTPGetShareHandle(bool bShareConnections)
+{
+    std::lock_guard<std::mutex> oLock(goShareHandleMutex);
+    CURLSH *&hShareHandle = gahShareHandles[bShareConnections ? 1 : 0];
+    if (hShareHandle == nullptr)
+    {
+        hShareHandle = curl_share_init();
+        if (hShareHandle)
+        {
+            curl_share_setopt(hShareHandle, CURLSHOPT_LOCKFUNC,
+                              CPLHTTPShareLock);
+            curl_share_setopt(hShareHandle, CURLSHOPT_UNLOCKFUNC,
+                              CPLHTTPShareUnlock);
+#ifdef HAVE_CURL_SHARED_CONNECTION_POOL
+            if (bShareConnections)
+                curl_share_setopt(hShareHandle, CURLSHOPT_SHARE,
+                                  CURL_LOCK_DATA_CONNECT);
+#endif
+            curl_share_setopt(hShareHandle, CURLSHOPT_SHARE,
+                              CURL_LOCK_DATA_SSL_SESSION);
+            curl_share_setopt(hShareHandle, CURLSHOPT_SHARE,
+                              CURL_LOCK_DATA_DNS);
+        }
+    }
+    return hShareHandle;
+}
+#endif
+
 /************************************************************************/
 /*                       CheckCurlFeatures()                            */
 /************************************************************************/
@@ -550,6 +617,7 @@ constexpr TupleEnvVarOptionName asAssocEnvVarOptionName[] = {
     {"GDAL_HTTP_TCP_KEEPALIVE", "TCP_KEEPALIVE"},
     {"GDAL_HTTP_TCP_KEEPIDLE", "TCP_KEEPIDLE"},
     {"GDAL_HTTP_TCP_KEEPINTVL", "TCP_KEEPINTVL"},
+    {"GDAL_HTTP_SHARED_CONNECTION_POOL", "SHARED_CONNECTION_POOL"},
 };
 
 char **CPLHTTPGetOptionsFromEnv(const char *pszFilename)
@@ -677,6 +745,9 @@ bool CPLHTTPRetryContext::CanRetry()
     if (m_nRetryCount >= m_oParameters.nMaxRetry)
         return false;
     m_nRetryCount++;
+#ifdef HAVE_CURL
+    cpl::NetworkStatisticsLogger::LogRetry();
+#endif
     return true;
 }
 
@@ -698,6 +769,9 @@ bool CPLHTTPRetryContext::CanRetry(int response_code, const char *pszErrBuf,
     if (m_dfNextDelay == 0.0)
         return false;
     m_nRetryCount++;
+#ifdef HAVE_CURL
+    cpl::NetworkStatisticsLogger::LogRetry();
+#endif
     return true;
 }
 
@@ -1185,6 +1259,12 @@ int CPLHTTPPopFetchCallback(void)
  * taken into account if TCP_KEEPALIVE=YES.
  * Corresponding configuration option: GDAL_HTTP_TCP_KEEPINTVL.
  * </li>
+ * <li>SHARED_CONNECTION_POOL=YES/NO (GDAL >= 3.10, and curl >= 7.68):
+ * whether the connection cache should be shared by all HTTP requests of the
+ * process, including the ones issued from different threads. TLS sessions
+ * and the DNS cache are always shared. Defaults to NO.
+ * Corresponding configuration option: GDAL_HTTP_SHARED_CONNECTION_POOL.
+ * </li>
  * <li>USERAGENT=string: value of User-Agent header. Starting with GDAL 3.7,
  * GDAL core sets it by default (during driver initialization) to GDAL/x.y.z
  * where x.y.z is the GDAL version number. Applications may override it with the
@@ -2541,6 +2621,20 @@ void *CPLHTTPSetOptions(void *pcurl, const char *pszURL,
         unchecked_curl_easy_setopt(http_handle, CURLOPT_COOKIEJAR,
                                    pszCookieJar);
 
+#ifdef HAVE_CURL_SHARE_HANDLE
+    bool bShareConnections = false;
+#ifdef HAVE_CURL_SHARED_CONNECTION_POOL
+    const char *pszSharedPool =
+        CSLFetchNameValue(papszOptions, "SHARED_CONNECTION_POOL");
+    if (pszSharedPool == nullptr)
+        pszSharedPool =
+            CPLGetConfigOption("GDAL_HTTP_SHARED_CONNECTION_POOL", "NO");
+    bShareConnections = CPLTestBool(pszSharedPool);
+#endif
+    if (CURLSH *hShareHandle = CPLHTTPGetShareHandle(bShareConnections))
+        unchecked_curl_easy_setopt(http_handle, CURLOPT_SHARE, hShareHandle);
+#endif
+
     // TCP keep-alive
     const char *pszTCPKeepAlive =
         CSLFetchNameValue(papszOptions, "TCP_KEEPALIVE");
@@ -2745,6 +2839,19 @@ void CPLHTTPCleanup()
     CPLDestroyMutex(hSessionMapMutex);
     hSessionMapMutex = nullptr;
 
+#ifdef HAVE_CURL_SHARE_HANDLE
+    {
+        std::lock_guard<std::mutex> oLock(goShareHandleMutex);
+        // Fails with CURLSHE_IN_USE if easy handles still reference it, in
+        // which case we prefer leaking it rather than crashing.
+        for (auto &hShareHandle : gahShareHandles)
+        {
+            if (hShareHandle && curl_share_cleanup(hShareHandle) == CURLSHE_OK)
+                hShareHandle = nullptr;
+        }
+    }
+#endif
+
 #if defined(_WIN32) && defined(HAVE_OPENSSL_CRYPTO)
     // This cleanup must be absolutely done before CPLOpenSSLCleanup()
     // for some unknown reason, but otherwise X509_free() in
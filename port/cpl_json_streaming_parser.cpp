@@ -32,6 +32,7 @@
 #include <ctype.h>   // isdigit...
 #include <stdio.h>   // snprintf
 #include <string.h>  // strlen
+#include <algorithm>
 #include <vector>
 #include <string>
 
@@ -39,6 +40,10 @@
 #include "cpl_string.h"
 #include "cpl_json_streaming_parser.h"
 
+#if defined(__x86_64) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
 /************************************************************************/
 /*                       CPLJSonStreamingParser()                       */
 /************************************************************************/
@@ -173,6 +178,95 @@ bool CPLJSonStreamingParser::EmitUnexpectedChar(char ch,
     return EmitException(szMessage);
 }
 
+/************************************************************************/
+/*                      GetStringPlainRunLength()                       */
+/************************************************************************/
+
+// Returns the number of bytes at the start of pStr that can be appended
+// as they are to a string token, that is up to the first double quote,
+// backslash or end-of-line character (the later matters for line counting)
+// This is the hot loop when parsing large documents, so the search is
+// done 32 bytes at a time with SSE2 on x86_64, and 8 bytes at a time
+// otherwise.
+static size_t GetStringPlainRunLength(const char *pStr, size_t nLength)
+{
+    size_t i = 0;
+#if defined(__x86_64) || defined(_M_X64)
+    const __m128i xmmQuote = _mm_set1_epi8('"');
+    const __m128i xmmBackslash = _mm_set1_epi8('\\');
+    const __m128i xmmCR = _mm_set1_epi8('\r');
+    const __m128i xmmLF = _mm_set1_epi8('\n');
+    const auto IsSpecial = [&](__m128i xmm)
+    {
+        return _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(xmm, xmmQuote),
+                                         _mm_cmpeq_epi8(xmm, xmmBackslash)),
+                            _mm_or_si128(_mm_cmpeq_epi8(xmm, xmmCR),
+                                         _mm_cmpeq_epi8(xmm, xmmLF)));
+    };
+    constexpr size_t BLOCK_SIZE = 2 * sizeof(__m128i);
+    while (i + BLOCK_SIZE <= nLength)
+    {
+        const __m128i xmm0 =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(pStr + i));
+        const __m128i xmm1 = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(pStr + i + sizeof(__m128i)));
+        if (_mm_movemask_epi8(_mm_or_si128(IsSpecial(xmm0), IsSpecial(xmm1))))
+            break;
+        i += BLOCK_SIZE;
+    }
+#else
+    // Non-zero if one of the bytes of nWord is equal to ch
+    const auto HasByte = [](uint64_t nWord, char ch)
+    {
+        constexpr uint64_t ONES = 0x0101010101010101ULL;
+        constexpr uint64_t HIGHS = 0x8080808080808080ULL;
+        const uint64_t x = nWord ^ (ONES * static_cast<GByte>(ch));
+        return (x - ONES) & ~x & HIGHS;
+    };
+    while (i + sizeof(uint64_t) <= nLength)
+    {
+        uint64_t nWord;
+        memcpy(&nWord, pStr + i, sizeof(nWord));
+        if (HasByte(nWord, '"') | HasByte(nWord, '\\') |
+            HasByte(nWord, '\r') | HasByte(nWord, '\n'))
+        {
+            break;
+        }
+        i += sizeof(uint64_t);
+    }
+#endif
+    while (i < nLength)
+    {
+        const char ch = pStr[i];
+        if (ch == '"' || ch == '\\' || ch == '\r' || ch == '\n')
+            break;
+        ++i;
+    }
+    return i;
+}
+
+/************************************************************************/
+/*                      GetNumberPlainRunLength()                       */
+/************************************************************************/
+
+// Returns the number of bytes at the start of pStr that are characters
+// of a regular number.
+static size_t GetNumberPlainRunLength(const char *pStr, size_t nLength)
+{
+    size_t i = 0;
+    while (i < nLength)
+    {
+        const char ch = pStr[i];
+        if (!((ch >= '0' && ch <= '9') || ch == '.' || ch == '-' ||
+              ch == '+' || ch == 'e' || ch == 'E'))
+        {
+            break;
+        }
+        ++i;
+    }
+    return i;
+}
+
 /************************************************************************/
 /*                            IsValidNewToken()                         */
 /************************************************************************/
@@ -466,6 +560,20 @@ bool CPLJSonStreamingParser::Parse(const char *pStr, size_t nLength,
         {
             while (nLength)
             {
+                // Fast path: append the run of number characters at once
+                const size_t nRun = std::min(
+                    GetNumberPlainRunLength(pStr, nLength),
+                    static_cast<size_t>(1024) - m_osToken.size());
+                if (nRun > 1)
+                {
+                    m_osToken.append(pStr, nRun);
+                    m_nLastChar = pStr[nRun - 1];
+                    pStr += nRun;
+                    nLength -= nRun;
+                    m_nCharCounter += static_cast<int>(nRun);
+                    continue;
+                }
+
                 char ch = *pStr;
                 if (ch == '+' || ch == '-' ||
                     isdigit(static_cast<unsigned char>(ch)) || ch == '.' ||
@@ -558,6 +666,24 @@ bool CPLJSonStreamingParser::Parse(const char *pStr, size_t nLength,
                     return EmitException("Too many characters in number");
                 }
 
+                if (!m_bInUnicode && !m_bInStringEscape)
+                {
+                    // Fast path: append the run of regular characters at
+                    // once
+                    const size_t nRun =
+                        std::min(GetStringPlainRunLength(pStr, nLength),
+                                 m_nMaxStringSize - m_osToken.size());
+                    if (nRun > 0)
+                    {
+                        m_osToken.append(pStr, nRun);
+                        m_nLastChar = pStr[nRun - 1];
+                        pStr += nRun;
+                        nLength -= nRun;
+                        m_nCharCounter += static_cast<int>(nRun);
+                        continue;
+                    }
+                }
+
                 char ch = *pStr;
                 if (m_bInUnicode)
                 {
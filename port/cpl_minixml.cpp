@@ -95,6 +95,9 @@ typedef struct
 static CPLXMLNode *_CPLCreateXMLNode(CPLXMLNode *poParent, CPLXMLNodeType eType,
                                      const char *pszText);
 
+static CPLXMLNode *_CPLCreateXMLNode(CPLXMLNode *poParent, CPLXMLNodeType eType,
+                                     const char *pszText, size_t nTextLen);
+
 /************************************************************************/
 /*                              ReadChar()                              */
 /************************************************************************/
@@ -185,6 +188,64 @@ static CPL_INLINE bool _AddToToken(ParseContext *psContext, char chNewChar)
     if (!_AddToToken(psContext, chNewChar))                                    \
         goto fail;
 
+/************************************************************************/
+/*                           AddSpanToToken()                           */
+/************************************************************************/
+
+static bool AddSpanToToken(ParseContext *psContext, const char *pszSpan,
+                           size_t nLen)
+
+{
+    while (psContext->nTokenSize + nLen >= psContext->nTokenMaxSize - 1)
+    {
+        if (!ReallocToken(psContext))
+            return false;
+    }
+
+    memcpy(psContext->pszToken + psContext->nTokenSize, pszSpan, nLen);
+    psContext->nTokenSize += nLen;
+    psContext->pszToken[psContext->nTokenSize] = '\0';
+    return true;
+}
+
+/************************************************************************/
+/*                          ReadSpanToToken()                           */
+/************************************************************************/
+
+/* Appends to the token all characters up to chTerminator (excluded) or the */
+/* end of input, and consumes the terminator. This is the same as calling   */
+/* ReadChar() and AddToToken() in a loop, but with a single copy.           */
+
+static bool ReadSpanToToken(ParseContext *psContext, char chTerminator,
+                            char &chNext)
+
+{
+    const char *pszStart = psContext->pszInput + psContext->nInputOffset;
+    const char *pszIter = pszStart;
+    int nLines = 0;
+    while (*pszIter != chTerminator && *pszIter != '\0')
+    {
+        if (*pszIter == 10)
+            ++nLines;
+        ++pszIter;
+    }
+
+    const size_t nLen = static_cast<size_t>(pszIter - pszStart);
+    if (!AddSpanToToken(psContext, pszStart, nLen))
+        return false;
+
+    chNext = *pszIter;
+    psContext->nInputOffset += static_cast<int>(nLen);
+    if (chNext != '\0')
+        psContext->nInputOffset++;
+    psContext->nInputLine += nLines;
+    return true;
+}
+
+#define ReadToTerminator(psContext, chTerminator, chNext)                      \
+    if (!ReadSpanToToken(psContext, chTerminator, chNext))                     \
+        goto fail;
+
 /************************************************************************/
 /*                             ReadToken()                              */
 /************************************************************************/
@@ -199,10 +260,15 @@ static XMLTokenType ReadToken(ParseContext *psContext, CPLErr &eLastErrorType)
     while (isspace(static_cast<unsigned char>(chNext)))
         chNext = ReadChar(psContext);
 
+    // Comments, DOCTYPE and CDATA all start with "<!", so only elements
+    // need to be tested for them.
+    const bool bOpenBang =
+        chNext == '<' && psContext->pszInput[psContext->nInputOffset] == '!';
+
     /* -------------------------------------------------------------------- */
     /*      Handle comments.                                                */
     /* -------------------------------------------------------------------- */
-    if (chNext == '<' &&
+    if (bOpenBang &&
         STARTS_WITH_CI(psContext->pszInput + psContext->nInputOffset, "!--"))
     {
         psContext->eTokenType = TComment;
@@ -225,7 +291,7 @@ static XMLTokenType ReadToken(ParseContext *psContext, CPLErr &eLastErrorType)
     /* -------------------------------------------------------------------- */
     /*      Handle DOCTYPE.                                                 */
     /* -------------------------------------------------------------------- */
-    else if (chNext == '<' &&
+    else if (bOpenBang &&
              STARTS_WITH_CI(psContext->pszInput + psContext->nInputOffset,
                             "!DOCTYPE"))
     {
@@ -304,7 +370,7 @@ static XMLTokenType ReadToken(ParseContext *psContext, CPLErr &eLastErrorType)
     /* -------------------------------------------------------------------- */
     /*      Handle CDATA.                                                   */
     /* -------------------------------------------------------------------- */
-    else if (chNext == '<' &&
+    else if (bOpenBang &&
              STARTS_WITH_CI(psContext->pszInput + psContext->nInputOffset,
                             "![CDATA["))
     {
@@ -384,8 +450,7 @@ static XMLTokenType ReadToken(ParseContext *psContext, CPLErr &eLastErrorType)
     {
         psContext->eTokenType = TString;
 
-        while ((chNext = ReadChar(psContext)) != '"' && chNext != '\0')
-            AddToToken(psContext, chNext);
+        ReadToTerminator(psContext, '"', chNext);
 
         if (chNext != '"')
         {
@@ -412,8 +477,7 @@ static XMLTokenType ReadToken(ParseContext *psContext, CPLErr &eLastErrorType)
     {
         psContext->eTokenType = TString;
 
-        while ((chNext = ReadChar(psContext)) != '\'' && chNext != '\0')
-            AddToToken(psContext, chNext);
+        ReadToTerminator(psContext, '\'', chNext);
 
         if (chNext != '\'')
         {
@@ -445,8 +509,7 @@ static XMLTokenType ReadToken(ParseContext *psContext, CPLErr &eLastErrorType)
         psContext->eTokenType = TString;
 
         AddToToken(psContext, chNext);
-        while ((chNext = ReadChar(psContext)) != '<' && chNext != '\0')
-            AddToToken(psContext, chNext);
+        ReadToTerminator(psContext, '<', chNext);
         UnreadChar(psContext, chNext);
 
         // Do we need to unescape it?
@@ -470,19 +533,23 @@ static XMLTokenType ReadToken(ParseContext *psContext, CPLErr &eLastErrorType)
         psContext->eTokenType = TToken;
 
         // Add the first character to the token regardless of what it is.
-        AddToToken(psContext, chNext);
-
-        for (chNext = ReadChar(psContext);
-             (chNext >= 'A' && chNext <= 'Z') ||
-             (chNext >= 'a' && chNext <= 'z') || chNext == '-' ||
-             chNext == '_' || chNext == '.' || chNext == ':' ||
-             (chNext >= '0' && chNext <= '9');
-             chNext = ReadChar(psContext))
+        const char *pszStart =
+            psContext->pszInput + psContext->nInputOffset - 1;
+        const char *pszIter = pszStart + 1;
+        for (char ch = *pszIter;
+             (ch >= 'A' && ch <= 'Z') || (ch >= 'a' && ch <= 'z') ||
+             ch == '-' || ch == '_' || ch == '.' || ch == ':' ||
+             (ch >= '0' && ch <= '9');
+             ch = *(++pszIter))
         {
-            AddToToken(psContext, chNext);
         }
 
-        UnreadChar(psContext, chNext);
+        // Token characters cannot be new lines, so there is no line count
+        // to update.
+        const size_t nLen = static_cast<size_t>(pszIter - pszStart);
+        if (!AddSpanToToken(psContext, pszStart, nLen))
+            goto fail;
+        psContext->nInputOffset += static_cast<int>(nLen) - 1;
     }
 
     return psContext->eTokenType;
@@ -692,8 +759,9 @@ CPLXMLNode *CPLParseXMLString(const char *pszString)
             CPLXMLNode *psElement = nullptr;
             if (sContext.pszToken[0] != '/')
             {
-                psElement =
-                    _CPLCreateXMLNode(nullptr, CXT_Element, sContext.pszToken);
+                psElement = _CPLCreateXMLNode(nullptr, CXT_Element,
+                                              sContext.pszToken,
+                                              sContext.nTokenSize);
                 if (!psElement)
                     break;
                 AttachNode(&sContext, psElement);
@@ -781,7 +849,8 @@ CPLXMLNode *CPLParseXMLString(const char *pszString)
         else if (sContext.eTokenType == TToken)
         {
             CPLXMLNode *psAttr =
-                _CPLCreateXMLNode(nullptr, CXT_Attribute, sContext.pszToken);
+                _CPLCreateXMLNode(nullptr, CXT_Attribute, sContext.pszToken,
+                                  sContext.nTokenSize);
             if (!psAttr)
                 break;
             AttachNode(&sContext, psAttr);
@@ -839,7 +908,8 @@ CPLXMLNode *CPLParseXMLString(const char *pszString)
                 break;
             }
 
-            if (!_CPLCreateXMLNode(psAttr, CXT_Text, sContext.pszToken))
+            if (!_CPLCreateXMLNode(psAttr, CXT_Text, sContext.pszToken,
+                                   sContext.nTokenSize))
                 break;
         }
 
@@ -916,7 +986,8 @@ CPLXMLNode *CPLParseXMLString(const char *pszString)
         else if (sContext.eTokenType == TComment)
         {
             CPLXMLNode *psValue =
-                _CPLCreateXMLNode(nullptr, CXT_Comment, sContext.pszToken);
+                _CPLCreateXMLNode(nullptr, CXT_Comment, sContext.pszToken,
+                                  sContext.nTokenSize);
             if (!psValue)
                 break;
             AttachNode(&sContext, psValue);
@@ -929,7 +1000,8 @@ CPLXMLNode *CPLParseXMLString(const char *pszString)
         else if (sContext.eTokenType == TLiteral)
         {
             CPLXMLNode *psValue =
-                _CPLCreateXMLNode(nullptr, CXT_Literal, sContext.pszToken);
+                _CPLCreateXMLNode(nullptr, CXT_Literal, sContext.pszToken,
+                                  sContext.nTokenSize);
             if (!psValue)
                 break;
             AttachNode(&sContext, psValue);
@@ -942,7 +1014,8 @@ CPLXMLNode *CPLParseXMLString(const char *pszString)
         else if (sContext.eTokenType == TString && !sContext.bInElement)
         {
             CPLXMLNode *psValue =
-                _CPLCreateXMLNode(nullptr, CXT_Text, sContext.pszToken);
+                _CPLCreateXMLNode(nullptr, CXT_Text, sContext.pszToken,
+                                  sContext.nTokenSize);
             if (!psValue)
                 break;
             AttachNode(&sContext, psValue);
@@ -1330,6 +1403,17 @@ CPLXMLNode *CPLCreateXMLNode(CPLXMLNode *poParent, CPLXMLNodeType eType,
 static CPLXMLNode *_CPLCreateXMLNode(CPLXMLNode *poParent, CPLXMLNodeType eType,
                                      const char *pszText)
 
+{
+    if (pszText == nullptr)
+        pszText = "";
+    return _CPLCreateXMLNode(poParent, eType, pszText, strlen(pszText));
+}
+
+/* Same as above, for a pszText whose length is known, as done by the parser */
+
+static CPLXMLNode *_CPLCreateXMLNode(CPLXMLNode *poParent, CPLXMLNodeType eType,
+                                     const char *pszText, size_t nTextLen)
+
 {
 
     /* -------------------------------------------------------------------- */
@@ -1344,7 +1428,12 @@ static CPLXMLNode *_CPLCreateXMLNode(CPLXMLNode *poParent, CPLXMLNodeType eType,
     }
 
     psNode->eType = eType;
-    psNode->pszValue = VSIStrdup(pszText ? pszText : "");
+    psNode->pszValue = static_cast<char *>(VSIMalloc(nTextLen + 1));
+    if (psNode->pszValue)
+    {
+        memcpy(psNode->pszValue, pszText, nTextLen);
+        psNode->pszValue[nTextLen] = '\0';
+    }
     if (psNode->pszValue == nullptr)
     {
         CPLError(CE_Failure, CPLE_OutOfMemory,
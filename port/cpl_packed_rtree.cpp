@@ -0,0 +1,300 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Static packed R-tree, bulk loaded from an array of envelopes
+ * Author:   agent, <agent at local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent at local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "cpl_packed_rtree.h"
+#include "cpl_error.h"
+#include "cpl_hilbert.h"
+
+#include <cmath>
+#include <exception>
+#include <functional>
+#include <queue>
+#include <utility>
+
+/************************************************************************/
+/*                               Build()                                */
+/************************************************************************/
+
+/** Build the tree from an array of envelopes.
+ *
+ * Any previous content of the tree is discarded. The array is not
+ * referenced after this call.
+ *
+ * @param pasItems Array of nItemCount envelopes. Item i of the tree is
+ *                 pasItems[i].
+ * @param nItemCount Number of items.
+ * @param eMethod Ordering of the items before they are packed.
+ * @param nNodeSize Maximum number of children of a node (at least 2).
+ * @return true in case of success.
+ */
+bool CPLPackedRTree::Build(const CPLRectObj *pasItems, size_t nItemCount,
+                           SortMethod eMethod, int nNodeSize)
+{
+    m_nItemCount = 0;
+    m_asBoxes.clear();
+    m_anIndices.clear();
+    m_anLevelEnds.clear();
+
+    if (nNodeSize < 2)
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg,
+                 "CPLPackedRTree::Build(): invalid node size: %d", nNodeSize);
+        return false;
+    }
+    m_nNodeSize = static_cast<size_t>(nNodeSize);
+    if (nItemCount == 0)
+        return true;
+
+    // Compute the total number of nodes, and the bounds of each level.
+    size_t nTotal = nItemCount;
+    {
+        size_t nCount = nItemCount;
+        m_anLevelEnds.push_back(nCount);
+        do
+        {
+            nCount = (nCount + m_nNodeSize - 1) / m_nNodeSize;
+            nTotal += nCount;
+            m_anLevelEnds.push_back(nTotal);
+        } while (nCount != 1);
+    }
+
+    try
+    {
+        m_asBoxes.resize(nTotal);
+        m_anIndices.resize(nTotal);
+
+        std::vector<size_t> anOrder(nItemCount);
+        for (size_t i = 0; i < nItemCount; ++i)
+            anOrder[i] = i;
+
+        const auto CenterX = [pasItems](size_t i)
+        { return (pasItems[i].minx + pasItems[i].maxx) / 2; };
+        const auto CenterY = [pasItems](size_t i)
+        { return (pasItems[i].miny + pasItems[i].maxy) / 2; };
+
+        if (eMethod == SortMethod::HILBERT)
+        {
+            CPLRectObj sExtent = pasItems[0];
+            for (size_t i = 1; i < nItemCount; ++i)
+            {
+                sExtent.minx = std::min(sExtent.minx, pasItems[i].minx);
+                sExtent.miny = std::min(sExtent.miny, pasItems[i].miny);
+                sExtent.maxx = std::max(sExtent.maxx, pasItems[i].maxx);
+                sExtent.maxy = std::max(sExtent.maxy, pasItems[i].maxy);
+            }
+            const double dfWidth = sExtent.maxx - sExtent.minx;
+            const double dfHeight = sExtent.maxy - sExtent.miny;
+
+            std::vector<std::pair<GUInt32, size_t>> anHilbert(nItemCount);
+            for (size_t i = 0; i < nItemCount; ++i)
+            {
+                anHilbert[i].first =
+                    CPLHilbertCodeInExtent(CenterX(i), CenterY(i), sExtent.minx,
+                                           sExtent.miny, dfWidth, dfHeight);
+                anHilbert[i].second = i;
+            }
+            std::sort(anHilbert.begin(), anHilbert.end());
+            for (size_t i = 0; i < nItemCount; ++i)
+                anOrder[i] = anHilbert[i].second;
+        }
+        else
+        {
+            // Sort by center X, cut into ceil(sqrt(number of leaf nodes))
+            // vertical slices, and sort each slice by center Y.
+            const size_t nLeafNodes = m_anLevelEnds[1] - m_anLevelEnds[0];
+            const size_t nSlices = static_cast<size_t>(
+                std::ceil(std::sqrt(static_cast<double>(nLeafNodes))));
+            const size_t nSliceSize =
+                ((nLeafNodes + nSlices - 1) / nSlices) * m_nNodeSize;
+            std::sort(anOrder.begin(), anOrder.end(),
+                      [&CenterX](size_t a, size_t b)
+                      { return CenterX(a) < CenterX(b); });
+            for (size_t i = 0; i < nItemCount; i += nSliceSize)
+            {
+                const auto oIterEnd =
+                    anOrder.begin() + std::min(nItemCount, i + nSliceSize);
+                std::sort(anOrder.begin() + i, oIterEnd,
+                          [&CenterY](size_t a, size_t b)
+                          { return CenterY(a) < CenterY(b); });
+            }
+        }
+
+        for (size_t i = 0; i < nItemCount; ++i)
+        {
+            m_asBoxes[i] = pasItems[anOrder[i]];
+            m_anIndices[i] = anOrder[i];
+        }
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "CPLPackedRTree::Build(): %s",
+                 e.what());
+        m_asBoxes.clear();
+        m_anIndices.clear();
+        m_anLevelEnds.clear();
+        return false;
+    }
+
+    // Build the nodes of each level from the boxes of the level below.
+    size_t nPos = nItemCount;
+    for (size_t iLevel = 0; iLevel + 1 < m_anLevelEnds.size(); ++iLevel)
+    {
+        const size_t nEnd = m_anLevelEnds[iLevel];
+        for (size_t i = iLevel == 0 ? 0 : m_anLevelEnds[iLevel - 1]; i < nEnd;
+             i += m_nNodeSize, ++nPos)
+        {
+            CPLRectObj sNode = m_asBoxes[i];
+            const size_t nChildEnd = std::min(i + m_nNodeSize, nEnd);
+            for (size_t j = i + 1; j < nChildEnd; ++j)
+            {
+                sNode.minx = std::min(sNode.minx, m_asBoxes[j].minx);
+                sNode.miny = std::min(sNode.miny, m_asBoxes[j].miny);
+                sNode.maxx = std::max(sNode.maxx, m_asBoxes[j].maxx);
+                sNode.maxy = std::max(sNode.maxy, m_asBoxes[j].maxy);
+            }
+            m_asBoxes[nPos] = sNode;
+            m_anIndices[nPos] = i;
+        }
+    }
+    CPLAssert(nPos == m_asBoxes.size());
+
+    m_nItemCount = nItemCount;
+    return true;
+}
+
+/************************************************************************/
+/*                             GetExtent()                              */
+/************************************************************************/
+
+/** Return the union of the envelopes of the items.
+ *
+ * @return false if the tree is empty.
+ */
+bool CPLPackedRTree::GetExtent(CPLRectObj &sExtent) const
+{
+    if (m_nItemCount == 0)
+        return false;
+    sExtent = m_asBoxes.back();
+    return true;
+}
+
+/************************************************************************/
+/*                              Search()                                */
+/************************************************************************/
+
+/** Return the indices of the items whose envelope intersects sAOI.
+ *
+ * Same as the Search() method with a callback, but collecting the items
+ * into an array.
+ */
+std::vector<size_t> CPLPackedRTree::Search(const CPLRectObj &sAOI) const
+{
+    std::vector<size_t> anRet;
+    Search(sAOI,
+           [&anRet](size_t nIdx)
+           {
+               anRet.push_back(nIdx);
+               return true;
+           });
+    return anRet;
+}
+
+/************************************************************************/
+/*                              Nearest()                               */
+/************************************************************************/
+
+/** Return the items that are the nearest of a point, by increasing
+ * distance.
+ *
+ * The distance of an item is the distance between the point and its
+ * envelope (zero if the point is inside the envelope).
+ *
+ * @param dfX X of the point.
+ * @param dfY Y of the point.
+ * @param nMaxResults Maximum number of returned items.
+ * @param dfMaxDistance Maximum distance of the returned items.
+ * @return the indices of the items.
+ */
+std::vector<size_t> CPLPackedRTree::Nearest(double dfX, double dfY,
+                                            size_t nMaxResults,
+                                            double dfMaxDistance) const
+{
+    std::vector<size_t> anRet;
+    if (m_nItemCount == 0 || nMaxResults == 0)
+        return anRet;
+
+    const auto SquareDist = [dfX, dfY](const CPLRectObj &sBox)
+    {
+        const double dx = dfX < sBox.minx   ? sBox.minx - dfX
+                          : dfX > sBox.maxx ? dfX - sBox.maxx
+                                            : 0;
+        const double dy = dfY < sBox.miny   ? sBox.miny - dfY
+                          : dfY > sBox.maxy ? dfY - sBox.maxy
+                                            : 0;
+        return dx * dx + dy * dy;
+    };
+    const double dfMaxSquareDist = dfMaxDistance * dfMaxDistance;
+
+    // Best-first traversal: the queue contains both nodes and items, ordered
+    // by increasing distance, so that an item that is popped is nearer than
+    // anything that remains.
+    using QueueElt = std::pair<double, size_t>;  // (square distance, box idx)
+    std::priority_queue<QueueElt, std::vector<QueueElt>, std::greater<QueueElt>>
+        oQueue;
+    oQueue.emplace(SquareDist(m_asBoxes.back()), m_asBoxes.size() - 1);
+    while (!oQueue.empty())
+    {
+        const QueueElt oElt = oQueue.top();
+        oQueue.pop();
+        if (oElt.first > dfMaxSquareDist)
+            break;
+        const size_t nBoxIdx = oElt.second;
+        if (nBoxIdx < m_nItemCount)
+        {
+            anRet.push_back(m_anIndices[nBoxIdx]);
+            if (anRet.size() == nMaxResults)
+                break;
+            continue;
+        }
+
+        const size_t nLevel =
+            static_cast<size_t>(std::upper_bound(m_anLevelEnds.begin(),
+                                                 m_anLevelEnds.end(), nBoxIdx) -
+                                m_anLevelEnds.begin());
+        const size_t nFirst = m_anIndices[nBoxIdx];
+        const size_t nEnd =
+            std::min(nFirst + m_nNodeSize, m_anLevelEnds[nLevel - 1]);
+        for (size_t i = nFirst; i < nEnd; ++i)
+        {
+            const double dfSquareDist = SquareDist(m_asBoxes[i]);
+            if (dfSquareDist <= dfMaxSquareDist)
+                oQueue.emplace(dfSquareDist, i);
+        }
+    }
+    return anRet;
+}
@@ -0,0 +1,160 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Static packed R-tree, bulk loaded from an array of envelopes
+ * Author:   agent, <agent at local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent at local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#ifndef CPL_PACKED_RTREE_H_INCLUDED
+#define CPL_PACKED_RTREE_H_INCLUDED
+
+#include "cpl_port.h"
+#include "cpl_quad_tree.h"
+
+#if defined(__cplusplus) && !defined(CPL_SUPRESS_CPLUSPLUS)
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+/**
+ * \file cpl_packed_rtree.h
+ *
+ * Static packed R-tree.
+ *
+ * Contrary to CPLQuadTree, the tree cannot be modified after it has been
+ * built: all envelopes are given at once to Build(), which sorts them
+ * (along a Hilbert curve, or with the Sort-Tile-Recursive algorithm) and
+ * packs them into full nodes. Nodes are stored level after level in a single
+ * array, which makes searches cache friendly, and intersection searches with
+ * a callback do not allocate memory.
+ *
+ * Items are identified by their index in the array given to Build().
+ *
+ * @since GDAL 3.10
+ */
+
+/** Static packed R-tree
+ *
+ * @since GDAL 3.10
+ */
+class CPL_DLL CPLPackedRTree
+{
+  public:
+    /** Default maximum number of children of a node */
+    static constexpr int DEFAULT_NODE_SIZE = 16;
+
+    /** Ordering of the items before they are packed into nodes */
+    enum class SortMethod
+    {
+        /** Order of the envelope centers along a Hilbert curve */
+        HILBERT,
+        /** Sort-Tile-Recursive: vertical slices sorted by center Y */
+        STR
+    };
+
+    CPLPackedRTree() = default;
+
+    bool Build(const CPLRectObj *pasItems, size_t nItemCount,
+               SortMethod eMethod = SortMethod::HILBERT,
+               int nNodeSize = DEFAULT_NODE_SIZE);
+
+    /** Return the number of items of the tree */
+    size_t GetItemCount() const
+    {
+        return m_nItemCount;
+    }
+
+    bool GetExtent(CPLRectObj &sExtent) const;
+
+    /** Call fnCallback(nItemIdx) for each item whose envelope intersects
+     * sAOI (envelopes touching sAOI are considered as intersecting).
+     *
+     * The callback must return true to continue the search, or false to
+     * stop it.
+     *
+     * @return false if the search has been stopped by the callback.
+     */
+    template <class Callback>
+    bool Search(const CPLRectObj &sAOI, Callback &&fnCallback) const
+    {
+        if (m_nItemCount == 0 || !Intersects(m_asBoxes.back(), sAOI))
+            return true;
+        return SearchNode(m_asBoxes.size() - 1, m_anLevelEnds.size() - 1, sAOI,
+                          fnCallback);
+    }
+
+    std::vector<size_t> Search(const CPLRectObj &sAOI) const;
+
+    std::vector<size_t> Nearest(
+        double dfX, double dfY, size_t nMaxResults,
+        double dfMaxDistance = std::numeric_limits<double>::infinity()) const;
+
+  private:
+    size_t m_nItemCount = 0;
+    size_t m_nNodeSize = DEFAULT_NODE_SIZE;
+    // Envelopes of the items (sorted), and then of the nodes of each level,
+    // up to the root node.
+    std::vector<CPLRectObj> m_asBoxes{};
+    // For items, their index in the array given to Build(). For nodes, the
+    // index in m_asBoxes of their first child.
+    std::vector<size_t> m_anIndices{};
+    // End index in m_asBoxes of each level, starting with the items.
+    std::vector<size_t> m_anLevelEnds{};
+
+    static bool Intersects(const CPLRectObj &a, const CPLRectObj &b)
+    {
+        return a.minx <= b.maxx && a.maxx >= b.minx && a.miny <= b.maxy &&
+               a.maxy >= b.miny;
+    }
+
+    template <class Callback>
+    bool SearchNode(size_t nNodeIdx, size_t nLevel, const CPLRectObj &sAOI,
+                    Callback &fnCallback) const
+    {
+        const size_t nFirst = m_anIndices[nNodeIdx];
+        const size_t nEnd =
+            std::min(nFirst + m_nNodeSize, m_anLevelEnds[nLevel - 1]);
+        for (size_t i = nFirst; i < nEnd; ++i)
+        {
+            if (!Intersects(m_asBoxes[i], sAOI))
+                continue;
+            if (nLevel == 1)
+            {
+                if (!fnCallback(m_anIndices[i]))
+                    return false;
+            }
+            else if (!SearchNode(i, nLevel - 1, sAOI, fnCallback))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+#endif /* __cplusplus */
+
+#endif /* CPL_PACKED_RTREE_H_INCLUDED */
@@ -0,0 +1,135 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Per-thread runtime metric counters
+ * Author:   agent, <agent at local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent at local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "cpl_runtime_metrics.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+//! @cond Doxygen_Suppress
+
+namespace
+{
+
+constexpr int METRIC_COUNT = static_cast<int>(CPLRuntimeMetric::COUNT);
+
+struct CPLRuntimeMetricsThreadCounters
+{
+    std::atomic<uint64_t> anValues[METRIC_COUNT];
+
+    CPLRuntimeMetricsThreadCounters();
+    ~CPLRuntimeMetricsThreadCounters();
+
+    CPLRuntimeMetricsThreadCounters(const CPLRuntimeMetricsThreadCounters &) =
+        delete;
+    CPLRuntimeMetricsThreadCounters &
+    operator=(const CPLRuntimeMetricsThreadCounters &) = delete;
+};
+
+struct CPLRuntimeMetricsRegistry
+{
+    std::mutex oMutex{};
+    std::vector<CPLRuntimeMetricsThreadCounters *> apoThreads{};
+    // Values of the threads that have terminated
+    uint64_t anRetired[METRIC_COUNT] = {};
+};
+
+// Intentionally leaked, as threads may still terminate after static
+// destruction.
+CPLRuntimeMetricsRegistry &GetRegistry()
+{
+    static CPLRuntimeMetricsRegistry *poRegistry =
+        new CPLRuntimeMetricsRegistry();
+    return *poRegistry;
+}
+
+CPLRuntimeMetricsThreadCounters::CPLRuntimeMetricsThreadCounters()
+{
+    for (auto &nValue : anValues)
+        nValue.store(0, std::memory_order_relaxed);
+    auto &oRegistry = GetRegistry();
+    std::lock_guard<std::mutex> oLock(oRegistry.oMutex);
+    oRegistry.apoThreads.push_back(this);
+}
+
+CPLRuntimeMetricsThreadCounters::~CPLRuntimeMetricsThreadCounters()
+{
+    auto &oRegistry = GetRegistry();
+    std::lock_guard<std::mutex> oLock(oRegistry.oMutex);
+    for (int i = 0; i < METRIC_COUNT; ++i)
+        oRegistry.anRetired[i] += anValues[i].load(std::memory_order_relaxed);
+    oRegistry.apoThreads.erase(std::find(oRegistry.apoThreads.begin(),
+                                         oRegistry.apoThreads.end(), this));
+}
+
+thread_local CPLRuntimeMetricsThreadCounters tlCounters;
+
+}  // namespace
+
+/************************************************************************/
+/*                        CPLRuntimeMetricAdd()                         */
+/************************************************************************/
+
+void CPLRuntimeMetricAdd(CPLRuntimeMetric eMetric, uint64_t nValue)
+{
+    // Only the current thread writes into its counters.
+    auto &nCounter = tlCounters.anValues[static_cast<int>(eMetric)];
+    nCounter.store(nCounter.load(std::memory_order_relaxed) + nValue,
+                   std::memory_order_relaxed);
+}
+
+/************************************************************************/
+/*                        CPLRuntimeMetricGet()                         */
+/************************************************************************/
+
+uint64_t CPLRuntimeMetricGet(CPLRuntimeMetric eMetric)
+{
+    const int iMetric = static_cast<int>(eMetric);
+    auto &oRegistry = GetRegistry();
+    std::lock_guard<std::mutex> oLock(oRegistry.oMutex);
+    uint64_t nSum = oRegistry.anRetired[iMetric];
+    for (const auto *poCounters : oRegistry.apoThreads)
+        nSum += poCounters->anValues[iMetric].load(std::memory_order_relaxed);
+    return nSum;
+}
+
+/************************************************************************/
+/*                       CPLRuntimeMetricNowNs()                        */
+/************************************************************************/
+
+int64_t CPLRuntimeMetricNowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+//! @endcond
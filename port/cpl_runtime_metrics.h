@@ -0,0 +1,76 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Per-thread runtime metric counters
+ * Author:   agent, <agent at local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent at local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#ifndef CPL_RUNTIME_METRICS_H_INCLUDED
+#define CPL_RUNTIME_METRICS_H_INCLUDED
+
+#include "cpl_port.h"
+
+#include <cstdint>
+
+//! @cond Doxygen_Suppress
+
+/** Counters exposed by GDALGetRuntimeMetrics() */
+enum class CPLRuntimeMetric : int
+{
+    BLOCK_CACHE_HITS,
+    BLOCK_CACHE_MISSES,
+    BLOCK_CACHE_EVICTIONS,
+    BLOCK_CACHE_DIRTY_BLOCK_WRITES,
+    BLOCK_CACHE_LOCK_WAIT_NS,
+    BLOCK_CACHE_BUFFER_POOL_HITS,
+    BLOCK_CACHE_WRITE_BEHIND_WRITES,
+    THREAD_POOL_JOBS_SUBMITTED,
+    THREAD_POOL_JOBS_STARTED,
+    THREAD_POOL_JOBS_COMPLETED,
+    THREAD_POOL_JOB_WAIT_NS,
+    THREAD_POOL_JOB_RUN_NS,
+    DATASET_POOL_HITS,
+    DATASET_POOL_MISSES,
+    DATASET_POOL_EVICTIONS,
+    COUNT
+};
+
+/** Adds nValue to a counter.
+ *
+ * Counters are kept in per-thread storage, with a single writer each, so
+ * that this is only a relaxed load and store, without any contention
+ * between threads.
+ */
+void CPLRuntimeMetricAdd(CPLRuntimeMetric eMetric, uint64_t nValue = 1);
+
+/** Returns the sum of a counter over all threads, including terminated ones.
+ */
+uint64_t CPLRuntimeMetricGet(CPLRuntimeMetric eMetric);
+
+/** Returns a monotonic timestamp in nanoseconds, to measure durations */
+int64_t CPLRuntimeMetricNowNs();
+
+//! @endcond
+
+#endif  // CPL_RUNTIME_METRICS_H_INCLUDED
@@ -0,0 +1,271 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Lightweight scoped tracing spans, exported as Chrome trace JSON
+ * Author:   agent, <agent at local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent at local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "cpl_trace.h"
+#include "cpl_conv.h"
+#include "cpl_error.h"
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+//! @cond Doxygen_Suppress
+
+std::atomic<int> CPLTraceScope::s_nState{CPLTraceScope::STATE_UNINITIALIZED};
+
+namespace
+{
+
+struct CPLTraceEvent
+{
+    const char *pszName;
+    const char *pszCategory;
+    int64_t nStartNs;
+    int64_t nDurationNs;
+};
+
+// Maximum number of recorded events per thread, to bound memory usage
+// (32 bytes per event)
+constexpr size_t MAX_EVENTS_PER_THREAD = 4 * 1024 * 1024;
+
+// Owned both by the recording thread and by the global state, so that the
+// events of terminated threads are kept.
+struct CPLTraceThreadBuffer
+{
+    std::mutex oMutex{};
+    int nTID = 0;
+    std::vector<CPLTraceEvent> aoEvents{};
+    size_t nDropped = 0;
+};
+
+thread_local std::shared_ptr<CPLTraceThreadBuffer> tlpoBuffer;
+
+}  // namespace
+
+struct CPLTraceState
+{
+    std::mutex oMutex{};
+    std::string osFilename{};
+    std::chrono::steady_clock::time_point oOrigin =
+        std::chrono::steady_clock::now();
+    std::vector<std::shared_ptr<CPLTraceThreadBuffer>> apoBuffers{};
+
+    CPLTraceState() = default;
+
+    ~CPLTraceState()
+    {
+        // Threads still running after this point must not touch the buffers
+        CPLTraceScope::s_nState = CPLTraceScope::STATE_DISABLED;
+        Write();
+    }
+
+    void Write();
+
+    CPLTraceState(const CPLTraceState &) = delete;
+    CPLTraceState &operator=(const CPLTraceState &) = delete;
+};
+
+static CPLTraceState &GetTraceState()
+{
+    static CPLTraceState oState;
+    return oState;
+}
+
+/************************************************************************/
+/*                     CPLTraceScope::Initialize()                      */
+/************************************************************************/
+
+bool CPLTraceScope::Initialize()
+{
+    // Fetched before taking the lock, in case getting the option would
+    // itself do traced file accesses.
+    const std::string osFilename =
+        CPLGetConfigOption("CPL_TRACE_FILE", "");
+    auto &oState = GetTraceState();
+    std::lock_guard<std::mutex> oLock(oState.oMutex);
+    if (s_nState == STATE_UNINITIALIZED)
+    {
+        if (!osFilename.empty())
+        {
+            oState.osFilename = osFilename;
+            oState.oOrigin = std::chrono::steady_clock::now();
+            s_nState = STATE_ENABLED;
+        }
+        else
+        {
+            s_nState = STATE_DISABLED;
+        }
+    }
+    return s_nState == STATE_ENABLED;
+}
+
+/************************************************************************/
+/*                        CPLTraceScope::Begin()                        */
+/************************************************************************/
+
+void CPLTraceScope::Begin(const char *pszName, const char *pszCategory)
+{
+    m_pszName = pszName;
+    m_pszCategory = pszCategory;
+    m_nStartNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                     std::chrono::steady_clock::now().time_since_epoch())
+                     .count();
+}
+
+/************************************************************************/
+/*                         CPLTraceScope::End()                         */
+/************************************************************************/
+
+void CPLTraceScope::End()
+{
+    const int64_t nEndNs =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    if (s_nState != STATE_ENABLED)
+        return;
+
+    if (!tlpoBuffer)
+    {
+        auto poBuffer = std::make_shared<CPLTraceThreadBuffer>();
+        auto &oState = GetTraceState();
+        std::lock_guard<std::mutex> oLock(oState.oMutex);
+        poBuffer->nTID = static_cast<int>(oState.apoBuffers.size()) + 1;
+        oState.apoBuffers.push_back(poBuffer);
+        tlpoBuffer = std::move(poBuffer);
+    }
+
+    std::lock_guard<std::mutex> oLock(tlpoBuffer->oMutex);
+    if (tlpoBuffer->aoEvents.size() < MAX_EVENTS_PER_THREAD)
+    {
+        tlpoBuffer->aoEvents.push_back(
+            {m_pszName, m_pszCategory, m_nStartNs, nEndNs - m_nStartNs});
+    }
+    else
+    {
+        ++tlpoBuffer->nDropped;
+    }
+}
+
+/************************************************************************/
+/*                        CPLTraceState::Write()                        */
+/************************************************************************/
+
+static void CPLTraceWriteJSONString(FILE *fp, const char *pszStr)
+{
+    fputc('"', fp);
+    for (; *pszStr; ++pszStr)
+    {
+        const unsigned char ch = static_cast<unsigned char>(*pszStr);
+        if (ch == '"' || ch == '\\')
+            fprintf(fp, "\\%c", ch);
+        else if (ch < 0x20)
+            fprintf(fp, "\\u%04X", ch);
+        else
+            fputc(ch, fp);
+    }
+    fputc('"', fp);
+}
+
+// Writes the Chrome trace event format ("X" complete events, with
+// timestamps in microseconds), which can be loaded in chrome://tracing or
+// https://ui.perfetto.dev
+void CPLTraceState::Write()
+{
+    std::lock_guard<std::mutex> oLock(oMutex);
+    if (osFilename.empty())
+        return;
+
+    // Plain stdio, as this may run during static destruction
+    FILE *fp = fopen(osFilename.c_str(), "wb");
+    if (!fp)
+    {
+        fprintf(stderr, "CPLTrace: cannot create %s\n", osFilename.c_str());
+        return;
+    }
+
+    const int64_t nOriginNs =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            oOrigin.time_since_epoch())
+            .count();
+    constexpr int PID = 1;
+
+    fprintf(fp, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    bool bFirst = true;
+    for (const auto &poBuffer : apoBuffers)
+    {
+        std::lock_guard<std::mutex> oBufferLock(poBuffer->oMutex);
+        fprintf(fp,
+                "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,"
+                "\"tid\":%d,\"args\":{\"name\":\"thread %d\"}}",
+                bFirst ? "" : ",\n", PID, poBuffer->nTID, poBuffer->nTID);
+        bFirst = false;
+        for (const auto &oEvent : poBuffer->aoEvents)
+        {
+            fprintf(fp, ",\n{\"name\":");
+            CPLTraceWriteJSONString(fp, oEvent.pszName);
+            fprintf(fp, ",\"cat\":");
+            CPLTraceWriteJSONString(fp, oEvent.pszCategory);
+            fprintf(fp,
+                    ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%d,"
+                    "\"tid\":%d}",
+                    static_cast<double>(oEvent.nStartNs - nOriginNs) / 1000,
+                    static_cast<double>(oEvent.nDurationNs) / 1000, PID,
+                    poBuffer->nTID);
+        }
+        if (poBuffer->nDropped)
+        {
+            CPLDebug("CPL", "CPLTrace: %u events dropped for thread %d",
+                     static_cast<unsigned>(poBuffer->nDropped),
+                     poBuffer->nTID);
+        }
+    }
+    fprintf(fp, "\n]}\n");
+    fclose(fp);
+}
+
+/************************************************************************/
+/*                           CPLTraceFlush()                            */
+/************************************************************************/
+
+/** Writes the spans recorded so far into the CPL_TRACE_FILE file.
+ *
+ * This is automatically done at process termination. Recording continues
+ * after this call, and a later flush overwrites the file with all the spans
+ * recorded since the start.
+ */
+void CPLTraceFlush(void)
+{
+    if (CPLTraceScope::s_nState == CPLTraceScope::STATE_ENABLED)
+        GetTraceState().Write();
+}
+
+//! @endcond
@@ -0,0 +1,113 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Lightweight scoped tracing spans, exported as Chrome trace JSON
+ * Author:   agent, <agent at local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent at local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#ifndef CPL_TRACE_H_INCLUDED
+#define CPL_TRACE_H_INCLUDED
+
+#include "cpl_port.h"
+
+//! @cond Doxygen_Suppress
+
+CPL_C_START
+void CPL_DLL CPLTraceFlush(void);
+CPL_C_END
+
+#if defined(__cplusplus) && !defined(CPL_SUPRESS_CPLUSPLUS)
+
+#include <atomic>
+#include <cstdint>
+
+/** Records the time spent in a C++ scope, when the CPL_TRACE_FILE
+ * configuration option is set.
+ *
+ * When tracing is disabled, the cost is a relaxed atomic load.
+ * pszName and pszCategory must be string literals (or outlive the process),
+ * as only their pointers are stored.
+ */
+class CPL_DLL CPLTraceScope
+{
+  public:
+    explicit CPLTraceScope(const char *pszName,
+                           const char *pszCategory = "gdal")
+    {
+        if (IsEnabled())
+            Begin(pszName, pszCategory);
+    }
+
+    ~CPLTraceScope()
+    {
+        if (m_pszName)
+            End();
+    }
+
+    CPLTraceScope(const CPLTraceScope &) = delete;
+    CPLTraceScope &operator=(const CPLTraceScope &) = delete;
+
+    /** Whether spans are recorded */
+    static bool IsEnabled()
+    {
+        const int nState = s_nState.load(std::memory_order_relaxed);
+        return nState == STATE_ENABLED ||
+               (nState == STATE_UNINITIALIZED && Initialize());
+    }
+
+  private:
+    static constexpr int STATE_UNINITIALIZED = 0;
+    static constexpr int STATE_DISABLED = 1;
+    static constexpr int STATE_ENABLED = 2;
+    static std::atomic<int> s_nState;
+
+    const char *m_pszName = nullptr;
+    const char *m_pszCategory = nullptr;
+    int64_t m_nStartNs = 0;
+
+    static bool Initialize();
+    void Begin(const char *pszName, const char *pszCategory);
+    void End();
+
+    friend void CPLTraceFlush(void);
+    friend struct CPLTraceState;
+};
+
+#define CPL_TRACE_CONCAT_INTERNAL(a, b) a##b
+#define CPL_TRACE_CONCAT(a, b) CPL_TRACE_CONCAT_INTERNAL(a, b)
+
+/** Declares a CPLTraceScope covering the rest of the enclosing scope */
+#define CPL_TRACE_SCOPE(name)                                                  \
+    const CPLTraceScope CPL_TRACE_CONCAT(oCPLTraceScope, __LINE__)(name)
+
+/** Same as CPL_TRACE_SCOPE() with an explicit category */
+#define CPL_TRACE_SCOPE_CAT(name, category)                                    \
+    const CPLTraceScope CPL_TRACE_CONCAT(oCPLTraceScope, __LINE__)(name,       \
+                                                                   category)
+
+#endif
+
+//! @endcond
+
+#endif  // CPL_TRACE_H_INCLUDED
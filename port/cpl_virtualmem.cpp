@@ -2118,6 +2118,22 @@ CPLVirtualMem *CPLVirtualMemFileMapNew(
     return ctxt;
 }
 
+/************************************************************************/
+/*                   CPLVirtualMemAdviseRandomAccess()                  */
+/************************************************************************/
+
+int CPLVirtualMemAdviseRandomAccess(CPLVirtualMem *ctxt)
+{
+    if (ctxt->eType != VIRTUAL_MEM_TYPE_FILE_MEMORY_MAPPED ||
+        ctxt->pVMemBase != nullptr)
+        return FALSE;
+    const size_t nMappingSize = ctxt->nSize +
+                                static_cast<GByte *>(ctxt->pData) -
+                                static_cast<GByte *>(ctxt->pDataToFree);
+    return posix_madvise(ctxt->pDataToFree, nMappingSize,
+                         POSIX_MADV_RANDOM) == 0;
+}
+
 #else  // HAVE_MMAP
 
 CPLVirtualMem *CPLVirtualMemFileMapNew(
@@ -2131,6 +2147,11 @@ CPLVirtualMem *CPLVirtualMemFileMapNew(
     return nullptr;
 }
 
+int CPLVirtualMemAdviseRandomAccess(CPLVirtualMem * /* ctxt */)
+{
+    return FALSE;
+}
+
 #endif  // HAVE_MMAP
 
 /************************************************************************/
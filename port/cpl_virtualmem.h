@@ -208,6 +208,19 @@ CPLVirtualMem CPL_DLL *CPLVirtualMemFileMapNew(
     CPLVirtualMemAccessMode eAccessMode,
     CPLVirtualMemFreeUserData pfnFreeUserData, void *pCbkUserData);
 
+/** Declare that a file memory mapping will be accessed in random order.
+ *
+ * This disables the read-ahead the operating system does when a page of the
+ * mapping is first accessed, which is wasteful when accesses are scattered
+ * over a large (possibly sparse) file.
+ *
+ * @param ctxt context returned by CPLVirtualMemFileMapNew().
+ * @return TRUE in case of success.
+ *
+ * @since GDAL 3.10
+ */
+int CPL_DLL CPLVirtualMemAdviseRandomAccess(CPLVirtualMem *ctxt);
+
 /** Create a new virtual memory mapping derived from an other virtual memory
  *  mapping.
  *
@@ -472,6 +472,8 @@ GIntBig CPL_DLL VSIGetDiskFreeSpace(const char *pszDirname);
 
 void CPL_DLL VSINetworkStatsReset(void);
 char CPL_DLL *VSINetworkStatsGetAsSerializedJSON(char **papszOptions);
+char CPL_DLL *VSIGetIOStatistics(const char *pszPrefix,
+                                  CSLConstList papszOptions);
 
 /* ==================================================================== */
 /*      Install special file access handlers.                           */
@@ -500,6 +502,7 @@ void VSIInstall7zFileHandler(void);   /* No reason to export that */
 void VSIInstallRarFileHandler(void);  /* No reason to export that */
 void VSIInstallGZipFileHandler(void); /* No reason to export that */
 void VSIInstallZipFileHandler(void);  /* No reason to export that */
+void VSIInstallZstdFileHandler(void); /* No reason to export that */
 void VSIInstallStdinHandler(void);    /* No reason to export that */
 void VSIInstallHdfsHandler(void);     /* No reason to export that */
 void VSIInstallWebHdfsHandler(void);  /* No reason to export that */
@@ -69,6 +69,19 @@ struct CPL_DLL VSIVirtualHandle
                                const vsi_l_offset *panOffsets,
                                const size_t *panSizes);
 
+    /** Callback invoked by ReadMultiRangeWithCallback() once a range has
+     * been read (bSuccess = true) or has failed (bSuccess = false).
+     * @since GDAL 3.10
+     */
+    typedef void (*ReadRangeCallback)(int iRange, bool bSuccess,
+                                      void *pUserData);
+
+    virtual int ReadMultiRangeWithCallback(int nRanges, void **ppData,
+                                           const vsi_l_offset *panOffsets,
+                                           const size_t *panSizes,
+                                           ReadRangeCallback pfnCallback,
+                                           void *pUserData);
+
     /** This method is called when code plans to access soon one or several
      * ranges in a file. Some file systems may be able to use this hint to
      * for example asynchronously start such requests.
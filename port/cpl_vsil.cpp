@@ -54,6 +54,7 @@
 #include "cpl_error.h"
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
+#include "cpl_trace.h"
 #include "cpl_vsi_virtual.h"
 #include "cpl_vsil_curl_class.h"
 
@@ -2154,6 +2155,7 @@ VSILFILE *VSIFOpenEx2L(const char *pszFilename, const char *pszAccess,
     if (CPLStrnlen(pszFilename, knMaxPath) == knMaxPath)
         return nullptr;
 
+    CPL_TRACE_SCOPE_CAT("VSIFOpenL", "vsi");
     VSIFilesystemHandler *poFSHandler = VSIFileManager::GetHandler(pszFilename);
 
     VSILFILE *fp = poFSHandler->Open(pszFilename, pszAccess,
@@ -2424,6 +2426,7 @@ int VSIFFlushL(VSILFILE *fp)
 size_t VSIFReadL(void *pBuffer, size_t nSize, size_t nCount, VSILFILE *fp)
 
 {
+    CPL_TRACE_SCOPE_CAT("VSIFReadL", "vsi");
     return fp->Read(pBuffer, nSize, nCount);
 }
 
@@ -2483,9 +2486,42 @@ int VSIFReadMultiRangeL(int nRanges, void **ppData,
                         const vsi_l_offset *panOffsets, const size_t *panSizes,
                         VSILFILE *fp)
 {
+    CPL_TRACE_SCOPE_CAT("VSIFReadMultiRangeL", "vsi");
     return fp->ReadMultiRange(nRanges, ppData, panOffsets, panSizes);
 }
 
+/**
+ * \fn VSIVirtualHandle::ReadMultiRangeWithCallback( int nRanges,
+ *         void ** ppData, const vsi_l_offset* panOffsets,
+ *         const size_t* panSizes, ReadRangeCallback pfnCallback,
+ *         void *pUserData )
+ * \brief Read several ranges of bytes from file, with notification of the
+ * completion of each range.
+ *
+ * Same as ReadMultiRange(), except that pfnCallback(iRange, bSuccess,
+ * pUserData) is called (from the calling thread) exactly once for each range,
+ * as soon as the content of ppData[iRange] is available, or when reading it
+ * has failed. This enables callers to start processing (or dispatching to
+ * worker threads the processing of) ranges already received, while the
+ * other ones are still in progress.
+ *
+ * Ranges may complete in any order. File systems that support parallel
+ * downloads, like /vsicurl/ and derived ones, notify ranges as soon as
+ * they are received. The default implementation calls ReadMultiRange() and
+ * then notifies all ranges.
+ *
+ * @param nRanges number of ranges to read.
+ * @param ppData array of nRanges buffer into which the data should be read
+ *               (ppData[i] must be at list panSizes[i] bytes).
+ * @param panOffsets array of nRanges offsets at which the data should be read.
+ * @param panSizes array of nRanges sizes of objects to read (in bytes).
+ * @param pfnCallback callback, or nullptr.
+ * @param pUserData user data passed to pfnCallback.
+ *
+ * @return 0 in case of success, -1 otherwise.
+ * @since GDAL 3.10
+ */
+
 /************************************************************************/
 /*                             VSIFWriteL()                             */
 /************************************************************************/
@@ -2535,6 +2571,7 @@ size_t VSIFWriteL(const void *pBuffer, size_t nSize, size_t nCount,
                   VSILFILE *fp)
 
 {
+    CPL_TRACE_SCOPE_CAT("VSIFWriteL", "vsi");
     return fp->Write(pBuffer, nSize, nCount);
 }
 
@@ -3465,6 +3502,9 @@ VSIFileManager *VSIFileManager::Get()
     VSIInstallGZipFileHandler();
     VSIInstallZipFileHandler();
 #endif
+#ifdef HAVE_ZSTD
+    VSIInstallZstdFileHandler();
+#endif
 #ifdef HAVE_LIBARCHIVE
     VSIInstall7zFileHandler();
     VSIInstallRarFileHandler();
@@ -3663,6 +3703,23 @@ int VSIVirtualHandle::ReadMultiRange(int nRanges, void **ppData,
     return nRet;
 }
 
+/************************************************************************/
+/*                     ReadMultiRangeWithCallback()                     */
+/************************************************************************/
+
+int VSIVirtualHandle::ReadMultiRangeWithCallback(
+    int nRanges, void **ppData, const vsi_l_offset *panOffsets,
+    const size_t *panSizes, ReadRangeCallback pfnCallback, void *pUserData)
+{
+    const int nRet = ReadMultiRange(nRanges, ppData, panOffsets, panSizes);
+    if (pfnCallback)
+    {
+        for (int i = 0; i < nRanges; ++i)
+            pfnCallback(i, nRet == 0, pUserData);
+    }
+    return nRet;
+}
+
 #endif  // #ifndef DOXYGEN_SKIP
 
 /************************************************************************/
@@ -32,14 +32,18 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 
 #include "cpl_aws.h"
 #include "cpl_json.h"
 #include "cpl_json_header.h"
+#include "cpl_md5.h"
 #include "cpl_minixml.h"
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
@@ -94,6 +98,13 @@ char *VSINetworkStatsGetAsSerializedJSON(char ** /* papszOptions */)
     return nullptr;
 }
 
+char *VSIGetIOStatistics(const char * /* pszPrefix */,
+                         CSLConstList /* papszOptions */)
+{
+    // Not supported
+    return nullptr;
+}
+
 /************************************************************************/
 /*                      VSICurlInstallReadCbk()                         */
 /************************************************************************/
@@ -482,6 +493,12 @@ VSICurlHandle::VSICurlHandle(VSICurlFilesystemHandlerBase *poFSIn,
 
     m_bCached = poFSIn->AllowCachedDataFor(pszFilename);
     poFS->GetCachedFileProp(m_pszURL, oFileProp);
+
+    m_bAdaptiveReadAhead = CPLTestBool(
+        CPLGetConfigOption("CPL_VSIL_CURL_ADAPTIVE_READ_AHEAD", "YES"));
+    m_nReadAheadMaxParallel = std::clamp(
+        atoi(CPLGetConfigOption("CPL_VSIL_CURL_READ_AHEAD_MAX_PARALLEL", "8")),
+        1, 64);
 }
 
 /************************************************************************/
@@ -870,7 +887,18 @@ void VSICURLMultiPerform(CURLM *hCurlMultiHandle, CURL *hEasyHandle)
     CPLHTTPRestoreSigPipeHandler(old_handler);
 
     if (hEasyHandle)
+    {
+        if (cpl::NetworkStatisticsLogger::IsEnabled())
+        {
+            double dfTotalTime = 0;
+            if (curl_easy_getinfo(hEasyHandle, CURLINFO_TOTAL_TIME,
+                                  &dfTotalTime) == CURLE_OK)
+            {
+                cpl::NetworkStatisticsLogger::LogRequestTime(dfTotalTime);
+            }
+        }
         curl_multi_remove_handle(hCurlMultiHandle, hEasyHandle);
+    }
 }
 
 /************************************************************************/
@@ -2076,6 +2104,14 @@ retry:
         }
     }
 
+    double dfStartTransferTime = 0;
+    double dfTotalTime = 0;
+    curl_easy_getinfo(hCurlHandle, CURLINFO_STARTTRANSFER_TIME,
+                      &dfStartTransferTime);
+    curl_easy_getinfo(hCurlHandle, CURLINFO_TOTAL_TIME, &dfTotalTime);
+    UpdateReadAheadStats(dfStartTransferTime, dfTotalTime,
+                         sWriteFuncData.nSize);
+
     DownloadRegionPostProcess(startOffset, nBlocks, sWriteFuncData.pBuffer,
                               sWriteFuncData.nSize);
 
@@ -2143,6 +2179,181 @@ void VSICurlHandle::UpdateRedirectInfo(
     }
 }
 
+/************************************************************************/
+/*                        UpdateReadAheadStats()                        */
+/************************************************************************/
+
+// Maintain exponentially weighted moving averages of the latency and of
+// the throughput of a single connection, as measured on GET requests.
+void VSICurlHandle::UpdateReadAheadStats(double dfLatency, double dfTotalTime,
+                                         size_t nBytes)
+{
+    constexpr double WEIGHT_NEW_SAMPLE = 0.5;
+    if (dfLatency > 0)
+    {
+        m_dfReadAheadLatency =
+            m_dfReadAheadLatency == 0
+                ? dfLatency
+                : WEIGHT_NEW_SAMPLE * dfLatency +
+                      (1 - WEIGHT_NEW_SAMPLE) * m_dfReadAheadLatency;
+    }
+    // Small transfers are dominated by latency and don't give a meaningful
+    // estimate of the bandwidth.
+    constexpr size_t MIN_BYTES_FOR_THROUGHPUT = 64 * 1024;
+    const double dfTransferTime = dfTotalTime - dfLatency;
+    if (nBytes >= MIN_BYTES_FOR_THROUGHPUT && dfTransferTime > 0)
+    {
+        const double dfThroughput =
+            static_cast<double>(nBytes) / dfTransferTime;
+        m_dfReadAheadThroughput =
+            m_dfReadAheadThroughput == 0
+                ? dfThroughput
+                : WEIGHT_NEW_SAMPLE * dfThroughput +
+                      (1 - WEIGHT_NEW_SAMPLE) * m_dfReadAheadThroughput;
+    }
+}
+
+/************************************************************************/
+/*                       GetReadAheadMaxBlocks()                        */
+/************************************************************************/
+
+// Return the maximum number of blocks a sequential read may request at
+// once.
+int VSICurlHandle::GetReadAheadMaxBlocks() const
+{
+    constexpr int MAX_CHUNK_SIZE_INCREASE_FACTOR = 128;
+    if (!m_bAdaptiveReadAhead || m_dfReadAheadLatency == 0 ||
+        m_dfReadAheadThroughput == 0)
+    {
+        return MAX_CHUNK_SIZE_INCREASE_FACTOR;
+    }
+
+    // Size requests after the bandwidth-delay product, so that waiting for
+    // the first byte accounts for at most 20% of the duration of a request.
+    constexpr double LATENCY_FACTOR = 4;
+    const double dfTargetBytes = LATENCY_FACTOR * m_dfReadAheadLatency *
+                                 m_dfReadAheadThroughput * m_nReadAheadParallel;
+    // Leave room in the region cache for the data being currently read.
+    const double dfMaxBlocks =
+        std::min(dfTargetBytes / VSICURLGetDownloadChunkSize(),
+                 GetMaxRegions() / 2.0);
+    return std::max(MAX_CHUNK_SIZE_INCREASE_FACTOR,
+                    static_cast<int>(dfMaxBlocks));
+}
+
+/************************************************************************/
+/*                      DownloadRegionReadAhead()                       */
+/************************************************************************/
+
+// Download a large region for a sequential read, possibly split into
+// several ranged GET requests issued in parallel.
+// The number of parallel requests is adjusted similarly to TCP slow start:
+// it is doubled as long as this increases significantly the aggregated
+// throughput, and then stays at the last value that did.
+std::string VSICurlHandle::DownloadRegionReadAhead(vsi_l_offset startOffset,
+                                                   int nBlocks)
+{
+    const int nParallel =
+        oFileProp.bHasComputedFileSize ? m_nReadAheadParallel : 1;
+    const auto nStartTime = std::chrono::steady_clock::now();
+
+    std::string osRet;
+    if (nParallel == 1)
+    {
+        osRet = DownloadRegion(startOffset, nBlocks);
+    }
+    else
+    {
+        const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
+        const vsi_l_offset nEndOffset = std::min(
+            oFileProp.fileSize,
+            startOffset +
+                static_cast<vsi_l_offset>(nBlocks) * knDOWNLOAD_CHUNK_SIZE);
+        if (nEndOffset <= startOffset)
+            return DownloadRegion(startOffset, nBlocks);
+        try
+        {
+            osRet.resize(static_cast<size_t>(nEndOffset - startOffset));
+        }
+        catch (const std::exception &)
+        {
+            return DownloadRegion(startOffset, nBlocks);
+        }
+
+        const size_t nPartSize =
+            static_cast<size_t>((nBlocks + nParallel - 1) / nParallel) *
+            knDOWNLOAD_CHUNK_SIZE;
+        std::vector<void *> apData;
+        std::vector<vsi_l_offset> anOffsets;
+        std::vector<size_t> anSizes;
+        for (vsi_l_offset nOffset = startOffset; nOffset < nEndOffset;
+             nOffset += nPartSize)
+        {
+            apData.push_back(
+                &osRet[static_cast<size_t>(nOffset - startOffset)]);
+            anOffsets.push_back(nOffset);
+            anSizes.push_back(static_cast<size_t>(
+                std::min<vsi_l_offset>(nPartSize, nEndOffset - nOffset)));
+        }
+
+        int nRet;
+        {
+            // Make sure that ReadMultiRange() issues one GET request per
+            // part, and that a fallback through Read() doesn't alter the
+            // sequential read heuristics.
+            CPLConfigOptionSetter oSetter("GDAL_HTTP_MERGE_CONSECUTIVE_RANGES",
+                                          "NO", false);
+            const int nBlocksToDownloadBackup = nBlocksToDownload;
+            m_bInReadAheadDownload = true;
+            nRet = ReadMultiRange(static_cast<int>(apData.size()),
+                                  apData.data(), anOffsets.data(),
+                                  anSizes.data());
+            m_bInReadAheadDownload = false;
+            nBlocksToDownload = nBlocksToDownloadBackup;
+        }
+        if (nRet != 0)
+            return std::string();
+
+        DownloadRegionPostProcess(startOffset, nBlocks, osRet.data(),
+                                  osRet.size());
+    }
+
+    const double dfElapsed =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                      nStartTime)
+            .count();
+    if (!osRet.empty() && dfElapsed > 0 && !m_bReadAheadParallelSettled &&
+        oFileProp.bHasComputedFileSize)
+    {
+        const double dfThroughput =
+            static_cast<double>(osRet.size()) / dfElapsed;
+        constexpr double MIN_GAIN_FACTOR = 1.25;
+        if (m_dfReadAheadAggregateThroughput == 0 ||
+            dfThroughput > MIN_GAIN_FACTOR * m_dfReadAheadAggregateThroughput)
+        {
+            m_dfReadAheadAggregateThroughput = dfThroughput;
+            if (nParallel < m_nReadAheadMaxParallel)
+                m_nReadAheadParallel =
+                    std::min(2 * nParallel, m_nReadAheadMaxParallel);
+            else
+                m_bReadAheadParallelSettled = true;
+        }
+        else
+        {
+            m_nReadAheadParallel = std::max(1, nParallel / 2);
+            m_bReadAheadParallelSettled = true;
+        }
+        if (m_bReadAheadParallelSettled)
+        {
+            CPLDebug(poFS->GetDebugKey(),
+                     "Using %d parallel request(s) for sequential reads",
+                     m_nReadAheadParallel);
+        }
+    }
+
+    return osRet;
+}
+
 /************************************************************************/
 /*                      DownloadRegionPostProcess()                     */
 /************************************************************************/
@@ -2230,20 +2441,22 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
         std::string osRegion;
         std::shared_ptr<std::string> psRegion =
             poFS->GetRegion(m_pszURL, nOffsetToDownload);
-        if (psRegion != nullptr)
+        const bool bFromCache = psRegion != nullptr;
+        if (bFromCache)
         {
             osRegion = *psRegion;
         }
         else
         {
-            if (nOffsetToDownload == lastDownloadedOffset)
+            const bool bSequentialRead =
+                nOffsetToDownload == lastDownloadedOffset;
+            if (bSequentialRead)
             {
                 // In case of consecutive reads (of small size), we use a
                 // heuristic that we will read the file sequentially, so
                 // we double the requested size to decrease the number of
                 // client/server roundtrips.
-                constexpr int MAX_CHUNK_SIZE_INCREASE_FACTOR = 128;
-                if (nBlocksToDownload < MAX_CHUNK_SIZE_INCREASE_FACTOR)
+                if (nBlocksToDownload < GetReadAheadMaxBlocks())
                     nBlocksToDownload *= 2;
             }
             else
@@ -2285,7 +2498,20 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
             if (nBlocksToDownload > knMAX_REGIONS)
                 nBlocksToDownload = knMAX_REGIONS;
 
-            osRegion = DownloadRegion(nOffsetToDownload, nBlocksToDownload);
+            // Large sequential reads may be split into parallel requests.
+            constexpr int MIN_BLOCKS_FOR_READ_AHEAD = 128;
+            if (bSequentialRead && m_bAdaptiveReadAhead &&
+                m_nReadAheadMaxParallel > 1 && !m_bInReadAheadDownload &&
+                nBlocksToDownload >= MIN_BLOCKS_FOR_READ_AHEAD)
+            {
+                osRegion = DownloadRegionReadAhead(nOffsetToDownload,
+                                                   nBlocksToDownload);
+            }
+            else
+            {
+                osRegion =
+                    DownloadRegion(nOffsetToDownload, nBlocksToDownload);
+            }
             if (osRegion.empty())
             {
                 if (!bInterrupted)
@@ -2311,6 +2537,8 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
             std::min(static_cast<vsi_l_offset>(nBufferRequestSize),
                      osRegion.size() - nRegionOffset));
         memcpy(pBuffer, osRegion.data() + nRegionOffset, nToCopy);
+        if (bFromCache)
+            NetworkStatisticsLogger::LogCacheHit(nToCopy);
         pBuffer = static_cast<char *>(pBuffer) + nToCopy;
         iterOffset += nToCopy;
         nBufferRequestSize -= nToCopy;
@@ -2321,6 +2549,9 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
         }
     }
 
+    NetworkStatisticsLogger::LogRead(
+        static_cast<size_t>(iterOffset - curOffset));
+
     const size_t ret = static_cast<size_t>((iterOffset - curOffset) / nSize);
     if (ret != nMemb)
         bEOF = true;
@@ -2338,12 +2569,40 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
                                   const vsi_l_offset *const panOffsets,
                                   const size_t *const panSizes)
 {
+    return ReadMultiRangeWithCallback(nRanges, ppData, panOffsets, panSizes,
+                                      nullptr, nullptr);
+}
+
+/************************************************************************/
+/*                     ReadMultiRangeWithCallback()                     */
+/************************************************************************/
+
+int VSICurlHandle::ReadMultiRangeWithCallback(
+    int const nRanges, void **const ppData,
+    const vsi_l_offset *const panOffsets, const size_t *const panSizes,
+    ReadRangeCallback pfnCallback, void *pUserData)
+{
+    // Used by the code paths that do not report progressively the completion
+    // of ranges
+    const auto NotifyAll = [nRanges, pfnCallback, pUserData](int nRet)
+    {
+        if (pfnCallback)
+        {
+            for (int i = 0; i < nRanges; ++i)
+                pfnCallback(i, nRet == 0, pUserData);
+        }
+        return nRet;
+    };
+
     if (bInterrupted && bStopOnInterruptUntilUninstall)
+    {
+        NotifyAll(-1);
         return FALSE;
+    }
 
     poFS->GetCachedFileProp(m_pszURL, oFileProp);
     if (oFileProp.eExists == EXIST_NO)
-        return -1;
+        return NotifyAll(-1);
 
     NetworkStatisticsFileSystem oContextFS(poFS->GetFSPrefix().c_str());
     NetworkStatisticsFile oContextFile(m_osFilename.c_str());
@@ -2355,12 +2614,13 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
     {
         // Just in case someone needs it, but the interest of this mode is
         // rather dubious now. We could probably remove it
-        return ReadMultiRangeSingleGet(nRanges, ppData, panOffsets, panSizes);
+        return NotifyAll(
+            ReadMultiRangeSingleGet(nRanges, ppData, panOffsets, panSizes));
     }
     else if (nRanges == 1 || EQUAL(pszMultiRangeStrategy, "SERIAL"))
     {
-        return VSIVirtualHandle::ReadMultiRange(nRanges, ppData, panOffsets,
-                                                panSizes);
+        return NotifyAll(VSIVirtualHandle::ReadMultiRange(
+            nRanges, ppData, panOffsets, panSizes));
     }
 
     ManagePlanetaryComputerSigning();
@@ -2369,8 +2629,8 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
     std::string osURL(GetRedirectURLIfValid(bHasExpired));
     if (bHasExpired)
     {
-        return VSIVirtualHandle::ReadMultiRange(nRanges, ppData, panOffsets,
-                                                panSizes);
+        return NotifyAll(VSIVirtualHandle::ReadMultiRange(
+            nRanges, ppData, panOffsets, panSizes));
     }
 
     CURLM *hMultiHandle = poFS->GetCurlMultiHandleFor(osURL);
@@ -2389,6 +2649,7 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
 #endif
 
     std::vector<CURL *> aHandles;
+    std::vector<int> anFirstRangeOfRequest;
     std::vector<WriteFuncStruct> asWriteFuncData(nRanges);
     std::vector<WriteFuncStruct> asWriteFuncHeaderData(nRanges);
     std::vector<char *> apszRanges;
@@ -2419,12 +2680,19 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
 
         if (nSize == 0)
         {
+            // Nothing to download: the ranges are immediately completed
+            if (pfnCallback)
+            {
+                for (int j = i; j <= iNext; ++j)
+                    pfnCallback(j, true, pUserData);
+            }
             i = iNext + 1;
             continue;
         }
 
         CURL *hCurlHandle = curl_easy_init();
         aHandles.push_back(hCurlHandle);
+        anFirstRangeOfRequest.push_back(i);
 
         // As the multi-range request is likely not the first one, we don't
         // need to wait as we already know if pipelining is possible
@@ -2487,28 +2755,19 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
         iRequest++;
     }
 
-    if (!aHandles.empty())
-    {
-        VSICURLMultiPerform(hMultiHandle);
-    }
-
     int nRet = 0;
-    size_t iReq = 0;
-    int iRange = 0;
     size_t nTotalDownloaded = 0;
-    for (; iReq < aHandles.size(); iReq++, iRange++)
+
+    // Process the result of a completed request: copy its content in the
+    // target buffer(s) and notify the caller
+    const auto ProcessRequest = [&](size_t iReq)
     {
-        while (iRange < nRanges && panSizes[iRange] == 0)
-        {
-            iRange++;
-        }
-        if (iRange == nRanges)
-            break;
+        int iRange = anFirstRangeOfRequest[iReq];
 
         long response_code = 0;
         curl_easy_getinfo(aHandles[iReq], CURLINFO_HTTP_CODE, &response_code);
 
-        if (ENABLE_DEBUG && asCurlErrors[iRange].szCurlErrBuf[0] != '\0')
+        if (ENABLE_DEBUG && asCurlErrors[iReq].szCurlErrBuf[0] != '\0')
         {
             char rangeStr[512] = {};
             snprintf(rangeStr, sizeof(rangeStr),
@@ -2516,13 +2775,14 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
                      asWriteFuncHeaderData[iReq].nStartOffset,
                      asWriteFuncHeaderData[iReq].nEndOffset);
 
-            const char *pszErrorMsg = &asCurlErrors[iRange].szCurlErrBuf[0];
+            const char *pszErrorMsg = &asCurlErrors[iReq].szCurlErrBuf[0];
             CPLDebug(poFS->GetDebugKey(),
                      "ReadMultiRange(%s), %s: response_code=%d, msg=%s",
                      osURL.c_str(), rangeStr, static_cast<int>(response_code),
                      pszErrorMsg);
         }
 
+        bool bSuccess = true;
         if ((response_code != 206 && response_code != 225) ||
             asWriteFuncHeaderData[iReq].nEndOffset + 1 !=
                 asWriteFuncHeaderData[iReq].nStartOffset +
@@ -2537,51 +2797,107 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
             CPLError(CE_Failure, CPLE_AppDefined,
                      "Request for %s failed with response_code=%ld", rangeStr,
                      response_code);
-            nRet = -1;
+            bSuccess = false;
         }
-        else if (nRet == 0)
-        {
-            size_t nOffset = 0;
-            size_t nRemainingSize = asWriteFuncData[iReq].nSize;
+
+        size_t nOffset = 0;
+        size_t nRemainingSize = asWriteFuncData[iReq].nSize;
+        if (bSuccess)
             nTotalDownloaded += nRemainingSize;
-            CPLAssert(iRange < nRanges);
-            while (true)
-            {
-                if (nRemainingSize < panSizes[iRange])
-                {
-                    nRet = -1;
-                    break;
-                }
+        CPLAssert(iRange < nRanges);
+        while (true)
+        {
+            if (bSuccess && nRemainingSize < panSizes[iRange])
+                bSuccess = false;
 
-                if (panSizes[iRange] > 0)
-                {
-                    memcpy(ppData[iRange],
-                           asWriteFuncData[iReq].pBuffer + nOffset,
-                           panSizes[iRange]);
-                }
+            if (bSuccess && panSizes[iRange] > 0)
+            {
+                memcpy(ppData[iRange], asWriteFuncData[iReq].pBuffer + nOffset,
+                       panSizes[iRange]);
+            }
+            if (!bSuccess)
+                nRet = -1;
+            if (pfnCallback)
+                pfnCallback(iRange, bSuccess, pUserData);
 
-                if (bMergeConsecutiveRanges && iRange + 1 < nRanges &&
-                    panOffsets[iRange] + panSizes[iRange] ==
-                        panOffsets[iRange + 1])
+            if (bMergeConsecutiveRanges && iRange + 1 < nRanges &&
+                panOffsets[iRange] + panSizes[iRange] == panOffsets[iRange + 1])
+            {
+                if (bSuccess)
                 {
                     nOffset += panSizes[iRange];
                     nRemainingSize -= panSizes[iRange];
-                    iRange++;
-                }
-                else
-                {
-                    break;
                 }
+                iRange++;
+            }
+            else
+            {
+                break;
             }
         }
 
         curl_multi_remove_handle(hMultiHandle, aHandles[iReq]);
         VSICURLResetHeaderAndWriterFunctions(aHandles[iReq]);
         curl_easy_cleanup(aHandles[iReq]);
+        aHandles[iReq] = nullptr;
         CPLFree(apszRanges[iReq]);
         CPLFree(asWriteFuncData[iReq].pBuffer);
         CPLFree(asWriteFuncHeaderData[iReq].pBuffer);
         curl_slist_free_all(aHeaders[iReq]);
+    };
+
+    if (!aHandles.empty())
+    {
+        // Similar to VSICURLMultiPerform(), except that requests are
+        // processed as soon as they complete.
+        std::map<CURL *, size_t> oMapHandleToRequest;
+        for (size_t iReq = 0; iReq < aHandles.size(); ++iReq)
+            oMapHandleToRequest[aHandles[iReq]] = iReq;
+
+        int repeats = 0;
+        void *old_handler = CPLHTTPIgnoreSigPipe();
+        while (true)
+        {
+            int still_running = 0;
+            while (curl_multi_perform(hMultiHandle, &still_running) ==
+                   CURLM_CALL_MULTI_PERFORM)
+            {
+                // loop
+            }
+
+            CURLMsg *msg;
+            do
+            {
+                int msgq = 0;
+                msg = curl_multi_info_read(hMultiHandle, &msgq);
+                if (msg && msg->msg == CURLMSG_DONE)
+                {
+                    const auto oIter =
+                        oMapHandleToRequest.find(msg->easy_handle);
+                    if (oIter != oMapHandleToRequest.end())
+                    {
+                        const size_t iReq = oIter->second;
+                        oMapHandleToRequest.erase(oIter);
+                        ProcessRequest(iReq);
+                    }
+                }
+            } while (msg);
+
+            if (!still_running)
+            {
+                break;
+            }
+
+            CPLMultiPerformWait(hMultiHandle, repeats);
+        }
+        CPLHTTPRestoreSigPipeHandler(old_handler);
+
+        // Should not happen, but make sure all requests are processed
+        for (size_t iReq = 0; iReq < aHandles.size(); ++iReq)
+        {
+            if (aHandles[iReq])
+                ProcessRequest(iReq);
+        }
     }
 
     NetworkStatisticsLogger::LogGET(nTotalDownloaded);
@@ -3681,6 +3997,240 @@ CURLM *VSICurlFilesystemHandlerBase::GetCurlMultiHandleFor(
     return conn.hCurlMultiHandle;
 }
 
+/************************************************************************/
+/*                     VSICurlGetDiskCacheFilename()                    */
+/************************************************************************/
+
+// Returns the filename in the CPL_VSIL_CURL_DISK_CACHE_DIR directory where
+// the chunk starting at nFileOffsetStart of pszURL is stored, or an empty
+// string if the disk cache is disabled or if the remote file has no
+// validator (ETag, or last modification time) that could guarantee that
+// the cached content is still up to date.
+static std::string VSICurlGetDiskCacheFilename(const char *pszURL,
+                                               vsi_l_offset nFileOffsetStart)
+{
+    const char *pszDir = CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_DIR", "");
+    if (pszDir[0] == '\0')
+        return std::string();
+
+    FileProp oFileProp;
+    if (!VSICURLGetCachedFileProp(pszURL, oFileProp) ||
+        oFileProp.eExists != EXIST_YES || !oFileProp.bHasComputedFileSize)
+    {
+        return std::string();
+    }
+    if (oFileProp.ETag.empty() && oFileProp.mTime == 0)
+        return std::string();
+
+    std::string osKey(pszURL);
+    osKey += '\n';
+    osKey += oFileProp.ETag;
+    osKey += CPLSPrintf("\n" CPL_FRMT_GUIB "\n" CPL_FRMT_GIB "\n" CPL_FRMT_GUIB
+                        "\n%d",
+                        static_cast<GUIntBig>(oFileProp.fileSize),
+                        static_cast<GIntBig>(oFileProp.mTime),
+                        static_cast<GUIntBig>(nFileOffsetStart),
+                        VSICURLGetDownloadChunkSize());
+    const std::string osHash(CPLMD5String(osKey.c_str()));
+
+    // Spread files in 256 sub-directories, to avoid too many files in a
+    // single directory.
+    return CPLFormFilename(CPLFormFilename(pszDir, osHash.substr(0, 2).c_str(),
+                                           nullptr),
+                           osHash.c_str(), nullptr);
+}
+
+/************************************************************************/
+/*                      VSICurlGetDiskCacheMaxSize()                    */
+/************************************************************************/
+
+static GUIntBig VSICurlGetDiskCacheMaxSize()
+{
+    constexpr GUIntBig DEFAULT_DISK_CACHE_SIZE = 1024 * 1024 * 1024;
+    const char *pszSize =
+        CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_SIZE", nullptr);
+    return pszSize ? CPLScanUIntBig(pszSize, static_cast<int>(strlen(pszSize)))
+                   : DEFAULT_DISK_CACHE_SIZE;
+}
+
+/************************************************************************/
+/*                        VSICurlCleanDiskCache()                       */
+/************************************************************************/
+
+// Removes the least recently used files of the disk cache, until its size
+// is below 90% of CPL_VSIL_CURL_DISK_CACHE_SIZE. This can safely run
+// concurrently with other processes using the same directory: at worst,
+// an entry is removed twice, or is read again from the network.
+static void VSICurlCleanDiskCache(const std::string &osDir, GUIntBig nMaxSize)
+{
+    struct Entry
+    {
+        std::string osFilename{};
+        time_t nMTime = 0;
+        GUIntBig nSize = 0;
+    };
+
+    std::vector<Entry> aoEntries;
+    GUIntBig nTotalSize = 0;
+    const time_t nNow = time(nullptr);
+    char **papszList = VSIReadDirRecursive(osDir.c_str());
+    for (char **papszIter = papszList; papszIter && *papszIter; ++papszIter)
+    {
+        std::string osFilename =
+            CPLFormFilename(osDir.c_str(), *papszIter, nullptr);
+        VSIStatBufL sStat;
+        if (VSIStatL(osFilename.c_str(), &sStat) != 0 ||
+            VSI_ISDIR(sStat.st_mode))
+        {
+            continue;
+        }
+        // Temporary files left behind by an interrupted process
+        if (EQUAL(CPLGetExtension(osFilename.c_str()), "tmp"))
+        {
+            if (nNow - sStat.st_mtime > 3600)
+                VSIUnlink(osFilename.c_str());
+            continue;
+        }
+        Entry oEntry;
+        oEntry.osFilename = std::move(osFilename);
+        oEntry.nMTime = sStat.st_mtime;
+        oEntry.nSize = static_cast<GUIntBig>(sStat.st_size);
+        nTotalSize += oEntry.nSize;
+        aoEntries.push_back(std::move(oEntry));
+    }
+    CSLDestroy(papszList);
+
+    if (nTotalSize <= nMaxSize)
+        return;
+
+    std::sort(aoEntries.begin(), aoEntries.end(),
+              [](const Entry &a, const Entry &b)
+              { return a.nMTime < b.nMTime; });
+    const GUIntBig nTargetSize = nMaxSize / 10 * 9;
+    size_t nRemoved = 0;
+    for (const auto &oEntry : aoEntries)
+    {
+        if (nTotalSize <= nTargetSize)
+            break;
+        VSIUnlink(oEntry.osFilename.c_str());
+        nTotalSize -= oEntry.nSize;
+        ++nRemoved;
+    }
+    CPLDebug("VSICURL", "Removed %u files from disk cache %s",
+             static_cast<unsigned>(nRemoved), osDir.c_str());
+}
+
+/************************************************************************/
+/*                       VSICurlGetFromDiskCache()                      */
+/************************************************************************/
+
+static std::shared_ptr<std::string>
+VSICurlGetFromDiskCache(const char *pszURL, vsi_l_offset nFileOffsetStart)
+{
+    const std::string osCacheFilename =
+        VSICurlGetDiskCacheFilename(pszURL, nFileOffsetStart);
+    if (osCacheFilename.empty())
+        return nullptr;
+
+    VSIStatBufL sStat;
+    if (VSIStatL(osCacheFilename.c_str(), &sStat) != 0 || sStat.st_size == 0 ||
+        sStat.st_size > VSICURLGetDownloadChunkSize())
+    {
+        return nullptr;
+    }
+
+    VSILFILE *fp = VSIFOpenL(osCacheFilename.c_str(), "rb");
+    if (fp == nullptr)
+        return nullptr;
+    auto value = std::make_shared<std::string>();
+    value->resize(static_cast<size_t>(sStat.st_size));
+    const bool bOK = VSIFReadL(&(*value)[0], value->size(), 1, fp) == 1;
+    VSIFCloseL(fp);
+    if (!bOK)
+        return nullptr;
+
+    // Refresh the modification time, which is used as the last access time
+    // for the LRU eviction. To limit the number of writes, only do it if it
+    // has not been done recently.
+    if (time(nullptr) - sStat.st_mtime > 60)
+    {
+        fp = VSIFOpenL(osCacheFilename.c_str(), "rb+");
+        if (fp)
+        {
+            VSIFWriteL(value->data(), 1, 1, fp);
+            VSIFCloseL(fp);
+        }
+    }
+
+    return value;
+}
+
+/************************************************************************/
+/*                        VSICurlAddToDiskCache()                       */
+/************************************************************************/
+
+static void VSICurlAddToDiskCache(const char *pszURL,
+                                  vsi_l_offset nFileOffsetStart, size_t nSize,
+                                  const char *pData)
+{
+    const std::string osCacheFilename =
+        VSICurlGetDiskCacheFilename(pszURL, nFileOffsetStart);
+    if (osCacheFilename.empty() || nSize == 0)
+        return;
+
+    VSIStatBufL sStat;
+    if (VSIStatL(osCacheFilename.c_str(), &sStat) == 0)
+        return;
+
+    const std::string osSubDir = CPLGetPath(osCacheFilename.c_str());
+    if (VSIStatL(osSubDir.c_str(), &sStat) != 0)
+        VSIMkdirRecursive(osSubDir.c_str(), 0755);
+
+    // Write into a temporary file that is atomically renamed once complete,
+    // so that other processes never see a partially written entry.
+    static std::atomic<int> nCounter{0};
+    const std::string osTmpFilename(
+        CPLSPrintf("%s." CPL_FRMT_GIB "_%d.tmp", osCacheFilename.c_str(),
+                   CPLGetPID(), ++nCounter));
+    VSILFILE *fp = VSIFOpenL(osTmpFilename.c_str(), "wb");
+    if (fp == nullptr)
+    {
+        CPLDebug("VSICURL", "Cannot write in disk cache %s",
+                     osSubDir.c_str());
+        return;
+    }
+    const bool bOK = VSIFWriteL(pData, nSize, 1, fp) == 1;
+    if (VSIFCloseL(fp) != 0 || !bOK ||
+        VSIRename(osTmpFilename.c_str(), osCacheFilename.c_str()) != 0)
+    {
+        VSIUnlink(osTmpFilename.c_str());
+        return;
+    }
+
+    // Trigger an eviction pass on the first insertion done by this process,
+    // and then each time 10% of the maximum size has been inserted.
+    static std::mutex oMutex;
+    static bool bFirstTime = true;
+    static GUIntBig nBytesSinceLastClean = 0;
+    const GUIntBig nMaxSize = VSICurlGetDiskCacheMaxSize();
+    bool bClean = false;
+    {
+        std::lock_guard<std::mutex> oLock(oMutex);
+        nBytesSinceLastClean += nSize;
+        if (bFirstTime || nBytesSinceLastClean > nMaxSize / 10)
+        {
+            bFirstTime = false;
+            nBytesSinceLastClean = 0;
+            bClean = true;
+        }
+    }
+    if (bClean)
+    {
+        VSICurlCleanDiskCache(
+            CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_DIR", ""), nMaxSize);
+    }
+}
+
 /************************************************************************/
 /*                          GetRegionCache()                            */
 /************************************************************************/
@@ -3705,20 +4255,30 @@ std::shared_ptr<std::string>
 VSICurlFilesystemHandlerBase::GetRegion(const char *pszURL,
                                         vsi_l_offset nFileOffsetStart)
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
     nFileOffsetStart =
         (nFileOffsetStart / knDOWNLOAD_CHUNK_SIZE) * knDOWNLOAD_CHUNK_SIZE;
 
     std::shared_ptr<std::string> out;
-    if (GetRegionCache()->tryGet(
-            FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), out))
     {
-        return out;
+        CPLMutexHolder oHolder(&hMutex);
+        if (GetRegionCache()->tryGet(
+                FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), out))
+        {
+            return out;
+        }
     }
 
-    return nullptr;
+    // Disk I/O done without holding the mutex
+    out = VSICurlGetFromDiskCache(pszURL, nFileOffsetStart);
+    if (out)
+    {
+        CPLMutexHolder oHolder(&hMutex);
+        GetRegionCache()->insert(
+            FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), out);
+    }
+
+    return out;
 }
 
 /************************************************************************/
@@ -3729,12 +4289,16 @@ void VSICurlFilesystemHandlerBase::AddRegion(const char *pszURL,
                                              vsi_l_offset nFileOffsetStart,
                                              size_t nSize, const char *pData)
 {
-    CPLMutexHolder oHolder(&hMutex);
+    {
+        CPLMutexHolder oHolder(&hMutex);
+
+        std::shared_ptr<std::string> value(new std::string());
+        value->assign(pData, nSize);
+        GetRegionCache()->insert(
+            FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), value);
+    }
 
-    std::shared_ptr<std::string> value(new std::string());
-    value->assign(pData, nSize);
-    GetRegionCache()->insert(
-        FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), value);
+    VSICurlAddToDiskCache(pszURL, nFileOffsetStart, nSize, pData);
 }
 
 /************************************************************************/
@@ -5774,6 +6338,65 @@ void NetworkStatisticsLogger::LogDELETE()
     }
 }
 
+void NetworkStatisticsLogger::LogRetry()
+{
+    if (!IsEnabled())
+        return;
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+    for (auto counters : gInstance.GetCountersForContext())
+    {
+        counters->nRetries++;
+    }
+}
+
+// Upper bounds of the latency histogram buckets, in milliseconds. The last
+// bucket collects requests slower than the last bound.
+constexpr double LATENCY_BUCKETS_MS[] = {10, 50, 100, 250, 500, 1000, 5000};
+
+void NetworkStatisticsLogger::LogRequestTime(double dfSeconds)
+{
+    if (!IsEnabled())
+        return;
+    const double dfMS = dfSeconds * 1000;
+    size_t iBucket = 0;
+    while (iBucket < CPL_ARRAYSIZE(LATENCY_BUCKETS_MS) &&
+           dfMS >= LATENCY_BUCKETS_MS[iBucket])
+    {
+        ++iBucket;
+    }
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+    for (auto counters : gInstance.GetCountersForContext())
+    {
+        counters->nTimedRequests++;
+        counters->dfRequestTime += dfSeconds;
+        counters->anLatencyHistogram[iBucket]++;
+    }
+}
+
+void NetworkStatisticsLogger::LogRead(size_t nBytes)
+{
+    if (!IsEnabled())
+        return;
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+    for (auto counters : gInstance.GetCountersForContext())
+    {
+        counters->nRead++;
+        counters->nReadBytes += nBytes;
+    }
+}
+
+void NetworkStatisticsLogger::LogCacheHit(size_t nBytes)
+{
+    if (!IsEnabled())
+        return;
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+    for (auto counters : gInstance.GetCountersForContext())
+    {
+        counters->nCacheHits++;
+        counters->nCacheHitBytes += nBytes;
+    }
+}
+
 void NetworkStatisticsLogger::Reset()
 {
     std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
@@ -5781,7 +6404,8 @@ void NetworkStatisticsLogger::Reset()
     gnEnabled = -1;
 }
 
-void NetworkStatisticsLogger::Stats::AsJSON(CPLJSONObject &oJSON) const
+void NetworkStatisticsLogger::Stats::AsJSON(CPLJSONObject &oJSON,
+                                            bool bExtended) const
 {
     CPLJSONObject oMethods;
     if (counters.nHEAD)
@@ -5803,12 +6427,52 @@ void NetworkStatisticsLogger::Stats::AsJSON(CPLJSONObject &oJSON) const
     if (counters.nDELETE)
         oMethods.Add("DELETE/count", counters.nDELETE);
     oJSON.Add("methods", oMethods);
+    if (bExtended)
+    {
+        if (counters.nRetries)
+            oJSON.Add("retry_count", counters.nRetries);
+        if (counters.nRead)
+        {
+            oJSON.Add("read/count", counters.nRead);
+            oJSON.Add("read/bytes", counters.nReadBytes);
+        }
+        if (counters.nCacheHits)
+        {
+            oJSON.Add("cache/hit_count", counters.nCacheHits);
+            oJSON.Add("cache/hit_bytes", counters.nCacheHitBytes);
+        }
+        if (counters.nTimedRequests)
+        {
+            CPLJSONObject oLatency;
+            oLatency.Add("request_count", counters.nTimedRequests);
+            oLatency.Add("total_ms", counters.dfRequestTime * 1000);
+            oLatency.Add("mean_ms", counters.dfRequestTime * 1000 /
+                                        counters.nTimedRequests);
+            CPLJSONObject oHistogram;
+            for (size_t i = 0; i < counters.anLatencyHistogram.size(); ++i)
+            {
+                if (counters.anLatencyHistogram[i] == 0)
+                    continue;
+                std::string osKey;
+                if (i == 0)
+                    osKey = CPLSPrintf("<%.0f", LATENCY_BUCKETS_MS[0]);
+                else if (i == CPL_ARRAYSIZE(LATENCY_BUCKETS_MS))
+                    osKey = CPLSPrintf(">=%.0f", LATENCY_BUCKETS_MS[i - 1]);
+                else
+                    osKey = CPLSPrintf("%.0f-%.0f", LATENCY_BUCKETS_MS[i - 1],
+                                       LATENCY_BUCKETS_MS[i]);
+                oHistogram.Add(osKey, counters.anLatencyHistogram[i]);
+            }
+            oLatency.Add("histogram_ms", oHistogram);
+            oJSON.Add("latency", oLatency);
+        }
+    }
     CPLJSONObject oFiles;
     bool bFilesAdded = false;
     for (const auto &kv : children)
     {
         CPLJSONObject childJSON;
-        kv.second.AsJSON(childJSON);
+        kv.second.AsJSON(childJSON, bExtended);
         if (kv.first.eType == ContextPathType::FILESYSTEM)
         {
             std::string osName(kv.first.osName);
@@ -5839,7 +6503,46 @@ std::string NetworkStatisticsLogger::GetReportAsSerializedJSON()
     std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
 
     CPLJSONObject oJSON;
-    gInstance.m_stats.AsJSON(oJSON);
+    gInstance.m_stats.AsJSON(oJSON, false);
+    return oJSON.Format(CPLJSONObject::PrettyFormat::Pretty);
+}
+
+std::string
+NetworkStatisticsLogger::GetIOStatisticsAsSerializedJSON(const char *pszPrefix)
+{
+    const auto NormalizeName = [](const std::string &osNameIn)
+    {
+        std::string osName(osNameIn);
+        if (!osName.empty() && osName[0] == '/')
+            osName = osName.substr(1);
+        if (!osName.empty() && osName.back() == '/')
+            osName.resize(osName.size() - 1);
+        return osName;
+    };
+
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+
+    CPLJSONObject oJSON;
+    if (pszPrefix == nullptr || pszPrefix[0] == 0)
+    {
+        gInstance.m_stats.AsJSON(oJSON, true);
+    }
+    else
+    {
+        const std::string osPrefix = NormalizeName(pszPrefix);
+        const Stats *poStats = nullptr;
+        for (const auto &kv : gInstance.m_stats.children)
+        {
+            if (kv.first.eType == ContextPathType::FILESYSTEM &&
+                NormalizeName(kv.first.osName) == osPrefix)
+            {
+                poStats = &kv.second;
+                break;
+            }
+        }
+        const Stats oEmptyStats;
+        (poStats ? poStats : &oEmptyStats)->AsJSON(oJSON, true);
+    }
     return oJSON.Format(CPLJSONObject::PrettyFormat::Pretty);
 }
 
@@ -6321,6 +7024,57 @@ char *VSINetworkStatsGetAsSerializedJSON(CPL_UNUSED char **papszOptions)
         cpl::NetworkStatisticsLogger::GetReportAsSerializedJSON().c_str());
 }
 
+/************************************************************************/
+/*                         VSIGetIOStatistics()                         */
+/************************************************************************/
+
+/**
+ * \brief Return I/O statistics of network file systems, as a JSON
+ * serialized object.
+ *
+ * Statistics collecting should be enabled as for
+ * VSINetworkStatsGetAsSerializedJSON(), with the
+ * CPL_VSIL_NETWORK_STATS_ENABLED configuration option set to YES before any
+ * network activity starts, or with the --io-stats switch of command line
+ * utilities.
+ *
+ * The returned object has the same structure as the one of
+ * VSINetworkStatsGetAsSerializedJSON(), and each level may additionally
+ * contain the following members:
+ * <ul>
+ * <li>"read": number of Read() calls ("count") and number of bytes
+ * returned by them ("bytes")</li>
+ * <li>"cache": number of times ("hit_count") data was served from the
+ * in-memory cache of downloaded regions, and the number of bytes served
+ * ("hit_bytes")</li>
+ * <li>"retry_count": number of retried HTTP requests</li>
+ * <li>"latency": number of timed HTTP requests ("request_count"), their
+ * cumulated and mean duration ("total_ms", "mean_ms"), and a histogram of
+ * their duration ("histogram_ms") with buckets "<10", "10-50", "50-100",
+ * "100-250", "250-500", "500-1000", "1000-5000" and ">=5000"
+ * milliseconds.</li>
+ * </ul>
+ *
+ * Comparing "read/bytes" with "methods/GET/downloaded_bytes" helps finding
+ * redundant reads or an inadequate chunk size.
+ *
+ * @param pszPrefix File system prefix, such as "/vsis3/", to restrict the
+ * statistics to a given file system, or NULL to get statistics for all file
+ * systems.
+ * @param papszOptions Unused.
+ * @return a JSON serialized string to free with VSIFree(), or nullptr
+ * @since GDAL 3.10
+ */
+
+char *VSIGetIOStatistics(const char *pszPrefix,
+                         CPL_UNUSED CSLConstList papszOptions)
+{
+    return CPLStrdup(
+        cpl::NetworkStatisticsLogger::GetIOStatisticsAsSerializedJSON(
+            pszPrefix)
+            .c_str());
+}
+
 #endif /* HAVE_CURL */
 
 #undef ENABLE_DEBUG
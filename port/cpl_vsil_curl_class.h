@@ -38,10 +38,12 @@
 #include "cpl_string.h"
 #include "cpl_vsil_curl_priv.h"
 #include "cpl_mem_cache.h"
+#include "cpl_worker_thread_pool.h"
 
 #include "cpl_curl_priv.h"
 
 #include <algorithm>
+#include <array>
 #include <condition_variable>
 #include <set>
 #include <map>
@@ -389,6 +391,21 @@ class VSICurlHandle : public VSIVirtualHandle
     vsi_l_offset lastDownloadedOffset = VSI_L_OFFSET_MAX;
     int nBlocksToDownload = 1;
 
+    // Adaptive read-ahead for sequential reads
+    bool m_bAdaptiveReadAhead = true;
+    int m_nReadAheadMaxParallel = 1;
+    int m_nReadAheadParallel = 1;
+    bool m_bReadAheadParallelSettled = false;
+    bool m_bInReadAheadDownload = false;
+    double m_dfReadAheadLatency = 0;     // time to first byte, in seconds
+    double m_dfReadAheadThroughput = 0;  // per connection, in bytes/second
+    double m_dfReadAheadAggregateThroughput = 0;  // in bytes/second
+
+    void UpdateReadAheadStats(double dfLatency, double dfTotalTime,
+                              size_t nBytes);
+    int GetReadAheadMaxBlocks() const;
+    std::string DownloadRegionReadAhead(vsi_l_offset startOffset, int nBlocks);
+
     bool bStopOnInterruptUntilUninstall = false;
     bool bInterrupted = false;
     VSICurlReadCbkFunc pfnReadCbk = nullptr;
@@ -490,6 +507,11 @@ class VSICurlHandle : public VSIVirtualHandle
     int ReadMultiRange(int nRanges, void **ppData,
                        const vsi_l_offset *panOffsets,
                        const size_t *panSizes) override;
+    int ReadMultiRangeWithCallback(int nRanges, void **ppData,
+                                   const vsi_l_offset *panOffsets,
+                                   const size_t *panSizes,
+                                   ReadRangeCallback pfnCallback,
+                                   void *pUserData) override;
     size_t Write(const void *pBuffer, size_t nSize, size_t nMemb) override;
     void ClearErr() override;
     int Eof() override;
@@ -590,6 +612,8 @@ class IVSIS3LikeFSHandler : public VSICurlFilesystemHandlerBaseWritable
 {
     CPL_DISALLOW_COPY_ASSIGN(IVSIS3LikeFSHandler)
 
+    friend class VSIS3LikeWriteHandle;
+
     virtual int MkdirInternal(const char *pszDirname, long nMode,
                               bool bDoStatCheck);
 
@@ -794,6 +818,28 @@ class VSIS3LikeWriteHandle final : public VSIVirtualHandle
 
     WriteFuncStruct m_sWriteFuncHeaderData{};
 
+    // Background upload of parts
+    struct PartUploadJob
+    {
+        VSIS3LikeWriteHandle *poHandle = nullptr;
+        int nPartNumber = 0;
+        GByte *pabyBuffer = nullptr;
+        size_t nBufferSize = 0;
+        std::string osEtag{};
+    };
+
+    int m_nUploadConcurrency = 1;
+    std::unique_ptr<CPLWorkerThreadPool> m_poUploadThreadPool{};
+    std::unique_ptr<CPLJobQueue> m_poUploadJobQueue{};
+    std::vector<std::unique_ptr<PartUploadJob>> m_apoPartUploadJobs{};
+    std::mutex m_oMutexUpload{};
+    std::vector<GByte *> m_apabyFreeBuffers{};  // protected by m_oMutexUpload
+    bool m_bUploadError = false;                // protected by m_oMutexUpload
+
+    static void UploadPartJob(void *pData);
+    bool UploadPartInBackground();
+    bool WaitPendingPartUploads();
+
     bool UploadPart();
     bool DoSinglePartPUT();
 
@@ -953,6 +999,15 @@ class NetworkStatisticsLogger
         GIntBig nPUTUploadedBytes = 0;
         GIntBig nPOSTDownloadedBytes = 0;
         GIntBig nPOSTUploadedBytes = 0;
+        GIntBig nRetries = 0;
+        GIntBig nRead = 0;
+        GIntBig nReadBytes = 0;
+        GIntBig nCacheHits = 0;
+        GIntBig nCacheHitBytes = 0;
+        GIntBig nTimedRequests = 0;
+        double dfRequestTime = 0;
+        // Number of requests per latency bucket. See LATENCY_BUCKETS_MS
+        std::array<GIntBig, 8> anLatencyHistogram{};
     };
 
     enum class ContextPathType
@@ -987,7 +1042,7 @@ class NetworkStatisticsLogger
         Counters counters{};
         std::map<ContextPathItem, Stats> children{};
 
-        void AsJSON(CPLJSONObject &oJSON) const;
+        void AsJSON(CPLJSONObject &oJSON, bool bExtended) const;
     };
 
     // Workaround bug in Coverity Scan
@@ -1032,9 +1087,19 @@ class NetworkStatisticsLogger
 
     static void LogDELETE();
 
+    static void LogRetry();
+
+    static void LogRequestTime(double dfSeconds);
+
+    static void LogRead(size_t nBytes);
+
+    static void LogCacheHit(size_t nBytes);
+
     static void Reset();
 
     static std::string GetReportAsSerializedJSON();
+
+    static std::string GetIOStatisticsAsSerializedJSON(const char *pszPrefix);
 };
 
 struct NetworkStatisticsFileSystem
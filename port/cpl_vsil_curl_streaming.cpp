@@ -32,6 +32,7 @@
 #include "cpl_vsil_curl_class.h"
 
 #include <algorithm>
+#include <limits>
 #include <map>
 
 #include "cpl_aws.h"
@@ -129,6 +130,7 @@ class RingBuffer
     void Reset();
     void Write(void *pBuffer, size_t nSize);
     void Read(void *pBuffer, size_t nSize);
+    bool Grow(size_t nNewCapacity);
 };
 
 RingBuffer::RingBuffer(size_t nCapacityIn)
@@ -178,6 +180,23 @@ void RingBuffer::Read(void *pBuffer, size_t nSize)
     nLength -= nSize;
 }
 
+bool RingBuffer::Grow(size_t nNewCapacity)
+{
+    CPLAssert(nNewCapacity >= nCapacity);
+
+    GByte *pabyNewBuffer = static_cast<GByte *>(VSIMalloc(nNewCapacity));
+    if (pabyNewBuffer == nullptr)
+        return false;
+    const size_t nLengthOri = nLength;
+    Read(pabyNewBuffer, nLengthOri);
+    CPLFree(pabyBuffer);
+    pabyBuffer = pabyNewBuffer;
+    nCapacity = nNewCapacity;
+    nOffset = 0;
+    nLength = nLengthOri;
+    return true;
+}
+
 /************************************************************************/
 
 namespace
@@ -295,6 +314,9 @@ class VSICurlStreamingHandle : public VSIVirtualHandle
     CPLCond *hCondProducer = nullptr;
     CPLCond *hCondConsumer = nullptr;
     RingBuffer oRingBuffer{};
+    // Set when the download thread had to wait for the consumer.
+    bool m_bProducerWaited = false;
+    size_t m_nMaxRingBufferSize = BKGND_BUFFER_SIZE;
     void StartDownload();
     void StopDownload();
     void PutRingBufferInCache();
@@ -398,6 +420,14 @@ VSICurlStreamingHandle::VSICurlStreamingHandle(VSICurlStreamingFSHandler *poFS,
     hCondProducer = CPLCreateCond();
     hCondConsumer = CPLCreateCond();
 
+    m_nMaxRingBufferSize = static_cast<size_t>(std::max<GIntBig>(
+        BKGND_BUFFER_SIZE,
+        std::min<GIntBig>(
+            CPLAtoGIntBig(CPLGetConfigOption(
+                "CPL_VSIL_CURL_STREAMING_MAX_BUFFER_SIZE",
+                CPLSPrintf("%d", 16 * BKGND_BUFFER_SIZE))),
+            std::numeric_limits<int>::max())));
+
     memset(m_szCurlErrBuf, 0, sizeof(m_szCurlErrBuf));
 }
 
@@ -849,6 +879,7 @@ size_t VSICurlStreamingHandle::ReceivedBytes(GByte *buffer, size_t count,
                 CPLDebug("VSICURL",
                          "Waiting for reader to consume some bytes...");
 
+            m_bProducerWaited = true;
             while (oRingBuffer.GetSize() == oRingBuffer.GetCapacity() &&
                    !bAskDownloadEnd)
             {
@@ -1354,6 +1385,22 @@ retry:
                          "Waiting for writer to produce some bytes...");
 
             AcquireMutex();
+            // If the download thread previously had to wait for us, and we
+            // now have to wait for it, the reader is bursty: a larger buffer
+            // lets the download go on while the reader is busy, instead of
+            // stalling the connection.
+            if (m_bProducerWaited && bDownloadInProgress &&
+                oRingBuffer.GetCapacity() < m_nMaxRingBufferSize)
+            {
+                const size_t nNewCapacity = std::min(
+                    2 * oRingBuffer.GetCapacity(), m_nMaxRingBufferSize);
+                if (oRingBuffer.Grow(nNewCapacity))
+                {
+                    CPLDebug("VSICURL", "Growing streaming buffer to %u bytes",
+                             static_cast<unsigned>(nNewCapacity));
+                }
+            }
+            m_bProducerWaited = false;
             while (oRingBuffer.GetSize() == 0 && bDownloadInProgress)
                 CPLCondWait(hCondProducer, hRingBufferMutex);
             const bool bBufferEmpty = oRingBuffer.GetSize() == 0;
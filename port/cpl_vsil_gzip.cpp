@@ -79,6 +79,7 @@
 
 #include <cerrno>
 #include <climits>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdio>
 #include <cstdlib>
@@ -109,13 +110,16 @@
 #include <vector>
 
 #include "cpl_error.h"
+#include "cpl_mem_cache.h"
 #include "cpl_minizip_ioapi.h"
 #include "cpl_minizip_unzip.h"
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
 #include "cpl_time.h"
+#include "cpl_trace.h"
 #include "cpl_vsi_virtual.h"
 #include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 
 constexpr int Z_BUFSIZE = 65536;           // Original size is 16384
 constexpr int gz_magic[2] = {0x1f, 0x8b};  // gzip magic header
@@ -351,6 +355,8 @@ class VSIDeflate64Handle final : public VSIVirtualHandle
 };
 #endif
 
+class VSIBGZFHandle;
+
 class VSIGZipFilesystemHandler final : public VSIFilesystemHandler
 {
     CPL_DISALLOW_COPY_ASSIGN(VSIGZipFilesystemHandler)
@@ -368,6 +374,7 @@ class VSIGZipFilesystemHandler final : public VSIFilesystemHandler
                            CSLConstList /* papszOptions */) override;
     VSIGZipHandle *OpenGZipReadOnly(const char *pszFilename,
                                     const char *pszAccess);
+    VSIBGZFHandle *OpenBGZFReadOnly(const char *pszFilename);
     int Stat(const char *pszFilename, VSIStatBufL *pStatBuf,
              int nFlags) override;
     int Unlink(const char *pszFilename) override;
@@ -2972,6 +2979,668 @@ vsi_l_offset VSIGZipWriteHandle::Tell()
     return nCurOffset;
 }
 
+/************************************************************************/
+/* ==================================================================== */
+/*                            VSIBGZFHandle                             */
+/* ==================================================================== */
+/************************************************************************/
+
+/* BGZF files (as produced by bgzip from htslib) are a concatenation of
+   gzip members, each of them holding at most 64 KB of uncompressed data,
+   and whose compressed size is stored in a "BC" subfield of the gzip extra
+   field. Member boundaries can thus be found without inflating anything,
+   which allows random access through an index of (compressed offset,
+   uncompressed offset) pairs, and decompression of several members in
+   parallel.
+
+   The index is compatible with the .gzi files of htslib (bgzip -i). When
+   there is none, it is built by walking over member headers, and saved
+   as a .gzi file next to the .gz file if possible.
+*/
+
+class VSIBGZFHandle final : public VSIVirtualHandle
+{
+    CPL_DISALLOW_COPY_ASSIGN(VSIBGZFHandle)
+
+    struct Block
+    {
+        std::vector<GByte> abyCompressed{};
+        std::vector<GByte> abyData{};
+        bool bDone = false;
+        bool bOK = false;
+    };
+
+    struct Job
+    {
+        VSIBGZFHandle *poParent = nullptr;
+        std::shared_ptr<Block> poBlock{};
+    };
+
+    VSIVirtualHandle *m_poBaseHandle = nullptr;
+    // Start offsets of each member, plus a final entry with the end offsets.
+    std::vector<vsi_l_offset> m_anCompressedOffsets{};
+    std::vector<vsi_l_offset> m_anUncompressedOffsets{};
+    vsi_l_offset m_nCurOffset = 0;
+    size_t m_iLastBlock = 0;
+    bool m_bEOF = false;
+    bool m_bError = false;
+    int m_nThreads = 1;
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+    std::map<size_t, std::shared_ptr<Block>> m_oMapBlocks{};
+    std::unique_ptr<CPLWorkerThreadPool> m_poPool{};
+
+    static bool GetBlockSize(const GByte *pabyHeader, size_t nHeaderSize,
+                             size_t &nBlockSize);
+    static bool ReadBlockSize(VSIVirtualHandle *poBaseHandle,
+                              vsi_l_offset nOffset, size_t &nBlockSize);
+    bool ReadIndex(const std::string &osIndexFilename,
+                   vsi_l_offset nFileSize);
+    bool ScanBlocks(vsi_l_offset nFileSize);
+    void WriteIndex(const std::string &osIndexFilename);
+    static void DecompressJob(void *pData);
+    std::shared_ptr<Block> GetBlock(size_t iBlock, size_t nBlocksNeeded,
+                                    bool bSequential);
+
+    VSIBGZFHandle(VSIVirtualHandle *poBaseHandle, int nThreads);
+
+  public:
+    ~VSIBGZFHandle() override;
+
+    static VSIBGZFHandle *Open(VSIVirtualHandle *poBaseHandle,
+                               const char *pszBaseFileName, int nThreads,
+                               bool bWriteIndex);
+
+    static bool IsBGZF(VSIVirtualHandle *poBaseHandle);
+
+    vsi_l_offset GetUncompressedSize() const
+    {
+        return m_anUncompressedOffsets.back();
+    }
+
+    int Seek(vsi_l_offset nOffset, int nWhence) override;
+    vsi_l_offset Tell() override;
+    size_t Read(void *pBuffer, size_t nSize, size_t nMemb) override;
+    size_t Write(const void *pBuffer, size_t nSize, size_t nMemb) override;
+    void ClearErr() override;
+    int Eof() override;
+    int Error() override;
+    int Close() override;
+};
+
+constexpr size_t BGZF_MAX_BLOCK_SIZE = 65536;
+
+/************************************************************************/
+/*                           VSIBGZFHandle()                            */
+/************************************************************************/
+
+VSIBGZFHandle::VSIBGZFHandle(VSIVirtualHandle *poBaseHandle, int nThreads)
+    : m_poBaseHandle(poBaseHandle), m_nThreads(nThreads)
+{
+}
+
+/************************************************************************/
+/*                          ~VSIBGZFHandle()                            */
+/************************************************************************/
+
+VSIBGZFHandle::~VSIBGZFHandle()
+{
+    VSIBGZFHandle::Close();
+}
+
+/************************************************************************/
+/*                              Close()                                 */
+/************************************************************************/
+
+int VSIBGZFHandle::Close()
+{
+    if (m_poPool)
+        m_poPool->WaitCompletion();
+    m_poPool.reset();
+    m_oMapBlocks.clear();
+
+    int nRet = 0;
+    if (m_poBaseHandle)
+    {
+        nRet = m_poBaseHandle->Close();
+        delete m_poBaseHandle;
+        m_poBaseHandle = nullptr;
+    }
+    return nRet;
+}
+
+/************************************************************************/
+/*                           GetBlockSize()                             */
+/************************************************************************/
+
+/** Returns the total size of the member whose header starts at pabyHeader,
+ * or false if this is not a BGZF member header. */
+bool VSIBGZFHandle::GetBlockSize(const GByte *pabyHeader, size_t nHeaderSize,
+                                 size_t &nBlockSize)
+{
+    if (nHeaderSize < 12 || pabyHeader[0] != gz_magic[0] ||
+        pabyHeader[1] != gz_magic[1] || pabyHeader[2] != Z_DEFLATED ||
+        (pabyHeader[3] & EXTRA_FIELD) == 0)
+    {
+        return false;
+    }
+    const size_t nXLen = pabyHeader[10] | (pabyHeader[11] << 8);
+    if (12 + nXLen > nHeaderSize)
+        return false;
+    // Look for the "BC" subfield
+    size_t nPos = 12;
+    while (nPos + 4 <= 12 + nXLen)
+    {
+        const size_t nSubLen =
+            pabyHeader[nPos + 2] | (pabyHeader[nPos + 3] << 8);
+        if (pabyHeader[nPos] == 'B' && pabyHeader[nPos + 1] == 'C' &&
+            nSubLen == 2 && nPos + 6 <= 12 + nXLen)
+        {
+            nBlockSize = static_cast<size_t>(pabyHeader[nPos + 4] |
+                                             (pabyHeader[nPos + 5] << 8)) +
+                         1;
+            // Header, + at least an empty deflate stream, + CRC and ISIZE
+            return nBlockSize >= 12 + nXLen + 2 + 8;
+        }
+        nPos += 4 + nSubLen;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                          ReadBlockSize()                             */
+/************************************************************************/
+
+/** Reads the header of the member starting at nOffset and returns its
+ * total size, or false if this is not a BGZF member header. */
+bool VSIBGZFHandle::ReadBlockSize(VSIVirtualHandle *poBaseHandle,
+                                  vsi_l_offset nOffset, size_t &nBlockSize)
+{
+    std::vector<GByte> abyHeader(12);
+    if (poBaseHandle->Seek(nOffset, SEEK_SET) != 0 ||
+        poBaseHandle->Read(abyHeader.data(), 1, 12) != 12)
+    {
+        return false;
+    }
+    const size_t nXLen = abyHeader[10] | (abyHeader[11] << 8);
+    abyHeader.resize(12 + nXLen);
+    return poBaseHandle->Read(abyHeader.data() + 12, 1, nXLen) == nXLen &&
+           GetBlockSize(abyHeader.data(), abyHeader.size(), nBlockSize);
+}
+
+/************************************************************************/
+/*                              IsBGZF()                                */
+/************************************************************************/
+
+bool VSIBGZFHandle::IsBGZF(VSIVirtualHandle *poBaseHandle)
+{
+    size_t nBlockSize = 0;
+    return ReadBlockSize(poBaseHandle, 0, nBlockSize);
+}
+
+/************************************************************************/
+/*                            ReadIndex()                               */
+/************************************************************************/
+
+/** Reads a .gzi index. It is made of a little-endian uint64 with the number
+ * of entries, followed by that number of pairs of little-endian uint64
+ * (compressed offset, uncompressed offset) for each member but the first.
+ */
+bool VSIBGZFHandle::ReadIndex(const std::string &osIndexFilename,
+                              vsi_l_offset nFileSize)
+{
+    VSILFILE *fp = VSIFOpenL(osIndexFilename.c_str(), "rb");
+    if (!fp)
+        return false;
+
+    bool bOK = false;
+    uint64_t nEntries = 0;
+    if (VSIFReadL(&nEntries, sizeof(nEntries), 1, fp) == 1)
+    {
+        CPL_LSBPTR64(&nEntries);
+        // Each member is at least 20 bytes large.
+        if (nEntries <= nFileSize / 20)
+        {
+            std::vector<uint64_t> anEntries;
+            try
+            {
+                anEntries.resize(static_cast<size_t>(nEntries) * 2);
+            }
+            catch (const std::exception &)
+            {
+            }
+            if (anEntries.size() == static_cast<size_t>(nEntries) * 2 &&
+                VSIFReadL(anEntries.data(), sizeof(uint64_t), anEntries.size(),
+                          fp) == anEntries.size())
+            {
+                bOK = true;
+                m_anCompressedOffsets.push_back(0);
+                m_anUncompressedOffsets.push_back(0);
+                for (size_t i = 0; bOK && i < anEntries.size(); i += 2)
+                {
+                    CPL_LSBPTR64(&anEntries[i]);
+                    CPL_LSBPTR64(&anEntries[i + 1]);
+                    const vsi_l_offset nCompressedOffset = anEntries[i];
+                    const vsi_l_offset nUncompressedOffset = anEntries[i + 1];
+                    if (nCompressedOffset <= m_anCompressedOffsets.back() ||
+                        nCompressedOffset - m_anCompressedOffsets.back() >
+                            BGZF_MAX_BLOCK_SIZE ||
+                        nCompressedOffset > nFileSize ||
+                        nUncompressedOffset < m_anUncompressedOffsets.back() ||
+                        nUncompressedOffset - m_anUncompressedOffsets.back() >
+                            BGZF_MAX_BLOCK_SIZE)
+                    {
+                        bOK = false;
+                    }
+                    else if (nCompressedOffset < nFileSize)
+                    {
+                        m_anCompressedOffsets.push_back(nCompressedOffset);
+                        m_anUncompressedOffsets.push_back(nUncompressedOffset);
+                    }
+                }
+            }
+        }
+    }
+    CPL_IGNORE_RET_VAL(VSIFCloseL(fp));
+
+    if (!bOK)
+    {
+        CPLDebug("GZIP", "Ignoring invalid %s", osIndexFilename.c_str());
+        m_anCompressedOffsets.clear();
+        m_anUncompressedOffsets.clear();
+    }
+    return bOK;
+}
+
+/************************************************************************/
+/*                            ScanBlocks()                              */
+/************************************************************************/
+
+/** Walks over member headers, from the last member of the index, or the
+ * start of the file, to the end of the file, to complete the index. */
+bool VSIBGZFHandle::ScanBlocks(vsi_l_offset nFileSize)
+{
+    vsi_l_offset nOffset = 0;
+    vsi_l_offset nUncompressedOffset = 0;
+    if (!m_anCompressedOffsets.empty())
+    {
+        nOffset = m_anCompressedOffsets.back();
+        nUncompressedOffset = m_anUncompressedOffsets.back();
+        m_anCompressedOffsets.pop_back();
+        m_anUncompressedOffsets.pop_back();
+    }
+
+    while (nOffset < nFileSize)
+    {
+        size_t nBlockSize = 0;
+        GByte abyISize[4];
+        if (!ReadBlockSize(m_poBaseHandle, nOffset, nBlockSize) ||
+            nBlockSize > nFileSize - nOffset ||
+            m_poBaseHandle->Seek(nOffset + nBlockSize - 4, SEEK_SET) != 0 ||
+            m_poBaseHandle->Read(abyISize, 1, 4) != 4)
+        {
+            return false;
+        }
+        const uint32_t nISize = abyISize[0] | (abyISize[1] << 8) |
+                                (abyISize[2] << 16) |
+                                (static_cast<uint32_t>(abyISize[3]) << 24);
+        if (nISize > BGZF_MAX_BLOCK_SIZE)
+            return false;
+        m_anCompressedOffsets.push_back(nOffset);
+        m_anUncompressedOffsets.push_back(nUncompressedOffset);
+        nOffset += nBlockSize;
+        nUncompressedOffset += nISize;
+    }
+    m_anCompressedOffsets.push_back(nOffset);
+    m_anUncompressedOffsets.push_back(nUncompressedOffset);
+    return true;
+}
+
+/************************************************************************/
+/*                            WriteIndex()                              */
+/************************************************************************/
+
+void VSIBGZFHandle::WriteIndex(const std::string &osIndexFilename)
+{
+    VSILFILE *fp = VSIFOpenL(osIndexFilename.c_str(), "wb");
+    if (!fp)
+        return;
+
+    // Like htslib, do not include the first member, but include the
+    // trailing empty one.
+    const size_t nEntries = m_anCompressedOffsets.size() - 2;
+    std::vector<uint64_t> anEntries;
+    anEntries.reserve(1 + 2 * nEntries);
+    anEntries.push_back(nEntries);
+    for (size_t i = 1; i <= nEntries; ++i)
+    {
+        anEntries.push_back(m_anCompressedOffsets[i]);
+        anEntries.push_back(m_anUncompressedOffsets[i]);
+    }
+    for (auto &nVal : anEntries)
+        CPL_LSBPTR64(&nVal);
+    bool bOK = VSIFWriteL(anEntries.data(), sizeof(uint64_t), anEntries.size(),
+                          fp) == anEntries.size();
+    bOK = VSIFCloseL(fp) == 0 && bOK;
+    if (!bOK)
+        VSIUnlink(osIndexFilename.c_str());
+}
+
+/************************************************************************/
+/*                               Open()                                 */
+/************************************************************************/
+
+/** Returns a handle if poBaseHandle is a BGZF file, or nullptr. In the
+ * later case, poBaseHandle is left untouched. Otherwise it is owned by the
+ * returned handle. */
+VSIBGZFHandle *VSIBGZFHandle::Open(VSIVirtualHandle *poBaseHandle,
+                                   const char *pszBaseFileName, int nThreads,
+                                   bool bWriteIndex)
+{
+    if (!IsBGZF(poBaseHandle) || poBaseHandle->Seek(0, SEEK_END) != 0)
+        return nullptr;
+    const vsi_l_offset nFileSize = poBaseHandle->Tell();
+
+    auto poHandle = std::unique_ptr<VSIBGZFHandle>(
+        new VSIBGZFHandle(poBaseHandle, nThreads));
+    const std::string osIndexFilename = std::string(pszBaseFileName) + ".gzi";
+    bool bHasIndex = false;
+    if (poHandle->ReadIndex(osIndexFilename, nFileSize))
+    {
+        bHasIndex = poHandle->ScanBlocks(nFileSize);
+        if (!bHasIndex)
+        {
+            CPLDebug("GZIP", "%s does not match %s", osIndexFilename.c_str(),
+                     pszBaseFileName);
+            poHandle->m_anCompressedOffsets.clear();
+            poHandle->m_anUncompressedOffsets.clear();
+        }
+    }
+    if (!bHasIndex)
+    {
+        if (!poHandle->ScanBlocks(nFileSize))
+        {
+            CPLDebug("GZIP", "%s is not a valid BGZF file", pszBaseFileName);
+            // Do not close the base handle, which remains owned by the
+            // caller.
+            poHandle->m_poBaseHandle = nullptr;
+            return nullptr;
+        }
+        if (bWriteIndex && poHandle->m_anCompressedOffsets.size() > 2 &&
+            !STARTS_WITH_CI(pszBaseFileName, "/vsicurl/"))
+        {
+            poHandle->WriteIndex(osIndexFilename);
+        }
+    }
+
+    if (nThreads > 1)
+    {
+        poHandle->m_poPool = std::make_unique<CPLWorkerThreadPool>();
+        if (!poHandle->m_poPool->Setup(nThreads, nullptr, nullptr, false))
+            poHandle->m_poPool.reset();
+    }
+
+    return poHandle.release();
+}
+
+/************************************************************************/
+/*                          DecompressJob()                             */
+/************************************************************************/
+
+void VSIBGZFHandle::DecompressJob(void *pData)
+{
+    Job *psJob = static_cast<Job *>(pData);
+    Block *poBlock = psJob->poBlock.get();
+    const auto &abyCompressed = poBlock->abyCompressed;
+    const size_t nCompressedSize = abyCompressed.size();
+    const size_t nISize =
+        abyCompressed[nCompressedSize - 4] |
+        (abyCompressed[nCompressedSize - 3] << 8) |
+        (abyCompressed[nCompressedSize - 2] << 16) |
+        (static_cast<size_t>(abyCompressed[nCompressedSize - 1]) << 24);
+    bool bOK = false;
+    poBlock->abyData.resize(nISize);
+    if (nISize == 0)
+    {
+        bOK = true;
+    }
+    else
+    {
+        size_t nOutBytes = 0;
+        bOK = CPLZLibInflate(abyCompressed.data(), nCompressedSize,
+                             poBlock->abyData.data(), nISize,
+                             &nOutBytes) != nullptr &&
+              nOutBytes == nISize;
+    }
+    poBlock->abyCompressed.clear();
+    poBlock->abyCompressed.shrink_to_fit();
+
+    {
+        std::lock_guard<std::mutex> oLock(psJob->poParent->m_oMutex);
+        poBlock->bOK = bOK;
+        poBlock->bDone = true;
+    }
+    psJob->poParent->m_oCV.notify_all();
+    delete psJob;
+}
+
+/************************************************************************/
+/*                             GetBlock()                               */
+/************************************************************************/
+
+/** Returns block iBlock, making sure that decompression of the following
+ * nBlocksNeeded - 1 blocks is also started, plus some more if the access
+ * pattern is sequential. */
+std::shared_ptr<VSIBGZFHandle::Block>
+VSIBGZFHandle::GetBlock(size_t iBlock, size_t nBlocksNeeded, bool bSequential)
+{
+    const size_t nBlocks = m_anCompressedOffsets.size() - 1;
+
+    // Forget about blocks that are unlikely to be needed again. Blocks
+    // still being decompressed are kept alive by their job.
+    while (!m_oMapBlocks.empty() && m_oMapBlocks.begin()->first + 1 < iBlock)
+        m_oMapBlocks.erase(m_oMapBlocks.begin());
+    size_t nReadAhead = nBlocksNeeded;
+    if (m_poPool && bSequential)
+        nReadAhead = std::max(nReadAhead, static_cast<size_t>(m_nThreads) * 2);
+    while (!m_oMapBlocks.empty() &&
+           std::prev(m_oMapBlocks.end())->first > iBlock + 2 * nReadAhead)
+    {
+        m_oMapBlocks.erase(std::prev(m_oMapBlocks.end()));
+    }
+
+    // Make sure that the next blocks are being decompressed, reading
+    // compressed data of consecutive missing blocks at once.
+    const size_t iLastBlock = std::min(nBlocks, iBlock + nReadAhead);
+    for (size_t iStart = iBlock; iStart < iLastBlock;)
+    {
+        if (m_oMapBlocks.find(iStart) != m_oMapBlocks.end())
+        {
+            ++iStart;
+            continue;
+        }
+        size_t iEnd = iStart + 1;
+        while (iEnd < iLastBlock &&
+               m_oMapBlocks.find(iEnd) == m_oMapBlocks.end())
+            ++iEnd;
+
+        const vsi_l_offset nStartOffset = m_anCompressedOffsets[iStart];
+        const size_t nSize =
+            static_cast<size_t>(m_anCompressedOffsets[iEnd] - nStartOffset);
+        std::vector<GByte> abyBuffer;
+        try
+        {
+            abyBuffer.resize(nSize);
+        }
+        catch (const std::exception &)
+        {
+            return nullptr;
+        }
+        if (m_poBaseHandle->Seek(nStartOffset, SEEK_SET) != 0 ||
+            m_poBaseHandle->Read(abyBuffer.data(), 1, nSize) != nSize)
+        {
+            // Only report the error if the block we need is affected.
+            if (iStart == iBlock)
+                return nullptr;
+            break;
+        }
+
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            auto poBlock = std::make_shared<Block>();
+            const size_t nOffsetInBuffer =
+                static_cast<size_t>(m_anCompressedOffsets[i] - nStartOffset);
+            poBlock->abyCompressed.assign(
+                abyBuffer.begin() + nOffsetInBuffer,
+                abyBuffer.begin() + nOffsetInBuffer +
+                    static_cast<size_t>(m_anCompressedOffsets[i + 1] -
+                                        m_anCompressedOffsets[i]));
+            m_oMapBlocks[i] = poBlock;
+            Job *psJob = new Job();
+            psJob->poParent = this;
+            psJob->poBlock = std::move(poBlock);
+            if (!m_poPool || !m_poPool->SubmitJob(DecompressJob, psJob))
+                DecompressJob(psJob);
+        }
+        iStart = iEnd;
+    }
+
+    auto poBlock = m_oMapBlocks[iBlock];
+    std::unique_lock<std::mutex> oLock(m_oMutex);
+    m_oCV.wait(oLock, [&poBlock] { return poBlock->bDone; });
+    if (!poBlock->bOK)
+    {
+        CPLError(CE_Failure, CPLE_FileIO,
+                 "Cannot decompress BGZF block at offset " CPL_FRMT_GUIB,
+                 static_cast<GUIntBig>(m_anCompressedOffsets[iBlock]));
+        return nullptr;
+    }
+    return poBlock;
+}
+
+/************************************************************************/
+/*                               Read()                                 */
+/************************************************************************/
+
+size_t VSIBGZFHandle::Read(void *pBuffer, size_t nSize, size_t nMemb)
+{
+    if (nSize == 0 || nMemb == 0)
+        return 0;
+    const size_t nToRead = nSize * nMemb;
+    size_t nRead = 0;
+    const vsi_l_offset nUncompressedSize = GetUncompressedSize();
+    bool bSequential = false;
+    while (nRead < nToRead)
+    {
+        if (m_nCurOffset >= nUncompressedSize)
+        {
+            m_bEOF = true;
+            break;
+        }
+        const auto oIter =
+            std::upper_bound(m_anUncompressedOffsets.begin(),
+                             m_anUncompressedOffsets.end(), m_nCurOffset);
+        const size_t iBlock =
+            static_cast<size_t>(oIter - m_anUncompressedOffsets.begin()) - 1;
+        if (nRead == 0)
+        {
+            bSequential =
+                iBlock == m_iLastBlock || iBlock == m_iLastBlock + 1;
+        }
+        m_iLastBlock = iBlock;
+        const auto oIterEnd = std::lower_bound(
+            oIter, m_anUncompressedOffsets.end(),
+            m_nCurOffset + (nToRead - nRead));
+        const auto poBlock = GetBlock(
+            iBlock, static_cast<size_t>(oIterEnd - oIter) + 1, bSequential);
+        if (!poBlock)
+        {
+            m_bError = true;
+            break;
+        }
+        const size_t nOffsetInBlock =
+            static_cast<size_t>(m_nCurOffset - m_anUncompressedOffsets[iBlock]);
+        if (nOffsetInBlock >= poBlock->abyData.size())
+        {
+            // ISIZE inconsistent with the index
+            m_bError = true;
+            break;
+        }
+        const size_t nChunk = std::min(
+            nToRead - nRead, poBlock->abyData.size() - nOffsetInBlock);
+        memcpy(static_cast<GByte *>(pBuffer) + nRead,
+               poBlock->abyData.data() + nOffsetInBlock, nChunk);
+        nRead += nChunk;
+        m_nCurOffset += nChunk;
+    }
+    return nRead / nSize;
+}
+
+/************************************************************************/
+/*                               Seek()                                 */
+/************************************************************************/
+
+int VSIBGZFHandle::Seek(vsi_l_offset nOffset, int nWhence)
+{
+    m_bEOF = false;
+    if (nWhence == SEEK_SET)
+        m_nCurOffset = nOffset;
+    else if (nWhence == SEEK_CUR)
+        m_nCurOffset += nOffset;
+    else
+        m_nCurOffset = GetUncompressedSize() + nOffset;
+    return 0;
+}
+
+/************************************************************************/
+/*                               Tell()                                 */
+/************************************************************************/
+
+vsi_l_offset VSIBGZFHandle::Tell()
+{
+    return m_nCurOffset;
+}
+
+/************************************************************************/
+/*                               Write()                                */
+/************************************************************************/
+
+size_t VSIBGZFHandle::Write(const void * /* pBuffer */, size_t /* nSize */,
+                            size_t /* nMemb */)
+{
+    CPLError(CE_Failure, CPLE_NotSupported,
+             "VSIFWriteL is not supported on GZip streams");
+    return 0;
+}
+
+/************************************************************************/
+/*                               Eof()                                  */
+/************************************************************************/
+
+int VSIBGZFHandle::Eof()
+{
+    return m_bEOF;
+}
+
+/************************************************************************/
+/*                              Error()                                 */
+/************************************************************************/
+
+int VSIBGZFHandle::Error()
+{
+    return m_bError;
+}
+
+/************************************************************************/
+/*                             ClearErr()                               */
+/************************************************************************/
+
+void VSIBGZFHandle::ClearErr()
+{
+    m_bEOF = false;
+    m_bError = false;
+}
+
 /************************************************************************/
 /* ==================================================================== */
 /*                       VSIGZipFilesystemHandler                       */
@@ -3079,6 +3748,10 @@ VSIGZipFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
     /*      Otherwise we are in the read access case.                       */
     /* -------------------------------------------------------------------- */
 
+    VSIBGZFHandle *poBGZFHandle = OpenBGZFReadOnly(pszFilename);
+    if (poBGZFHandle)
+        return poBGZFHandle;
+
     VSIGZipHandle *poGZIPHandle = OpenGZipReadOnly(pszFilename, pszAccess);
     if (poGZIPHandle)
         // Wrap the VSIGZipHandle inside a buffered reader that will
@@ -3167,6 +3840,45 @@ VSIGZipFilesystemHandler::OpenGZipReadOnly(const char *pszFilename,
     return poHandle;
 }
 
+/************************************************************************/
+/*                          OpenBGZFReadOnly()                          */
+/************************************************************************/
+
+/** Returns a handle for BGZF files if multi-threading is enabled through
+ * GDAL_NUM_THREADS, or nullptr. */
+VSIBGZFHandle *
+VSIGZipFilesystemHandler::OpenBGZFReadOnly(const char *pszFilename)
+{
+    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (!pszThreads)
+        return nullptr;
+    int nThreads;
+    if (EQUAL(pszThreads, "ALL_CPUS"))
+        nThreads = CPLGetNumCPUs();
+    else
+        nThreads = atoi(pszThreads);
+    nThreads = GDALCapThreadCount(std::max(1, std::min(128, nThreads)));
+
+    const char *pszBaseFileName = pszFilename + strlen("/vsigzip/");
+    VSIFilesystemHandler *poFSHandler =
+        VSIFileManager::GetHandler(pszBaseFileName);
+    VSIVirtualHandle *poVirtualHandle =
+        poFSHandler->Open(pszBaseFileName, "rb");
+    if (poVirtualHandle == nullptr)
+        return nullptr;
+
+    VSIBGZFHandle *poHandle = VSIBGZFHandle::Open(
+        poVirtualHandle, pszBaseFileName, nThreads,
+        CPLTestBool(
+            CPLGetConfigOption("CPL_VSIL_GZIP_WRITE_PROPERTIES", "YES")));
+    if (poHandle == nullptr)
+    {
+        poVirtualHandle->Close();
+        delete poVirtualHandle;
+    }
+    return poHandle;
+}
+
 /************************************************************************/
 /*                                Stat()                                */
 /************************************************************************/
@@ -3247,6 +3959,15 @@ int VSIGZipFilesystemHandler::Stat(const char *pszFilename,
             }
         }
 
+        // BGZF files know their uncompressed size from their index.
+        VSIBGZFHandle *poBGZFHandle = OpenBGZFReadOnly(pszFilename);
+        if (poBGZFHandle)
+        {
+            pStatBuf->st_size = poBGZFHandle->GetUncompressedSize();
+            delete poBGZFHandle;
+            return ret;
+        }
+
         // No, then seek at the end of the data (slow).
         VSIGZipHandle *poHandle =
             VSIGZipFilesystemHandler::OpenGZipReadOnly(pszFilename, "rb");
@@ -3560,9 +4281,8 @@ class VSIZipFilesystemHandler final : public VSIArchiveFilesystemHandler
     VSIVirtualHandle *OpenForWrite_unlocked(const char *pszFilename,
                                             const char *pszAccess);
 
-    struct VSIFileInZipInfo
+    struct VSIFileInZipProperties
     {
-        VSIVirtualHandleUniquePtr poVirtualHandle{};
         std::map<std::string, std::string> oMapProperties{};
         int nCompressionMethod = 0;
         uint64_t nUncompressedSize = 0;
@@ -3578,8 +4298,28 @@ class VSIZipFilesystemHandler final : public VSIArchiveFilesystemHandler
         uint64_t nSOZIPStartData = 0;
     };
 
+    struct VSIFileInZipInfo : public VSIFileInZipProperties
+    {
+        VSIVirtualHandleUniquePtr poVirtualHandle{};
+    };
+
     bool GetFileInfo(const char *pszFilename, VSIFileInZipInfo &info);
 
+    // Cache of the properties of members that have been opened, so that
+    // opening them again does not require to parse the central directory
+    // and local headers. Guarded by its own mutex, so that concurrent opens
+    // do not serialize on hMutex.
+    struct CachedFileInZipProperties
+    {
+        VSIFileInZipProperties sProps{};
+        vsi_l_offset nArchiveSize = 0;
+        time_t nArchiveMTime = 0;
+    };
+
+    std::mutex m_oMutexPropertiesCache{};
+    lru11::Cache<std::string, CachedFileInZipProperties>
+        m_oPropertiesCache{1000};
+
   public:
     VSIZipFilesystemHandler() = default;
     ~VSIZipFilesystemHandler() override;
@@ -3599,6 +4339,8 @@ class VSIZipFilesystemHandler final : public VSIArchiveFilesystemHandler
     char **GetFileMetadata(const char *pszFilename, const char *pszDomain,
                            CSLConstList papszOptions) override;
 
+    int HasOptimizedReadMultiRange(const char *pszPath) override;
+
     VSIVirtualHandle *OpenForWrite(const char *pszFilename,
                                    const char *pszAccess);
 
@@ -3753,6 +4495,190 @@ VSIZipFilesystemHandler::CreateReader(const char *pszZipFileName)
     return poReader;
 }
 
+/************************************************************************/
+/*                        VSIZipStoredHandle                            */
+/************************************************************************/
+
+// Handle for members that are STORED (not compressed): reads are forwarded
+// to the underlying file, including ReadMultiRange() ones.
+
+class VSIZipStoredHandle final : public VSIVirtualHandle
+{
+    VSIVirtualHandleUniquePtr m_poBaseHandle{};
+    const vsi_l_offset m_nStartOffset;
+    const vsi_l_offset m_nSize;
+    vsi_l_offset m_nCurPos = 0;
+    bool m_bEOF = false;
+    bool m_bError = false;
+
+    CPL_DISALLOW_COPY_ASSIGN(VSIZipStoredHandle)
+
+  public:
+    VSIZipStoredHandle(VSIVirtualHandleUniquePtr &&poBaseHandle,
+                       vsi_l_offset nStartOffset, vsi_l_offset nSize)
+        : m_poBaseHandle(std::move(poBaseHandle)),
+          m_nStartOffset(nStartOffset), m_nSize(nSize)
+    {
+    }
+
+    int Seek(vsi_l_offset nOffset, int nWhence) override;
+
+    vsi_l_offset Tell() override
+    {
+        return m_nCurPos;
+    }
+
+    size_t Read(void *pBuffer, size_t nSize, size_t nCount) override;
+    int ReadMultiRange(int nRanges, void **ppData,
+                       const vsi_l_offset *panOffsets,
+                       const size_t *panSizes) override;
+    void AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
+                    const size_t *panSizes) override;
+
+    size_t GetAdviseReadTotalBytesLimit() const override
+    {
+        return m_poBaseHandle->GetAdviseReadTotalBytesLimit();
+    }
+
+    size_t Write(const void *, size_t, size_t) override
+    {
+        return 0;
+    }
+
+    int Eof() override
+    {
+        return m_bEOF;
+    }
+
+    int Error() override
+    {
+        return m_bError;
+    }
+
+    void ClearErr() override
+    {
+        m_bEOF = false;
+        m_bError = false;
+    }
+
+    int Close() override
+    {
+        int nRet = 0;
+        if (m_poBaseHandle)
+        {
+            nRet = m_poBaseHandle->Close();
+            delete m_poBaseHandle.release();
+        }
+        return nRet;
+    }
+};
+
+/************************************************************************/
+/*                                Seek()                                */
+/************************************************************************/
+
+int VSIZipStoredHandle::Seek(vsi_l_offset nOffset, int nWhence)
+{
+    m_bEOF = false;
+    if (nWhence == SEEK_SET)
+        m_nCurPos = nOffset;
+    else if (nWhence == SEEK_CUR)
+        m_nCurPos += nOffset;
+    else if (nWhence == SEEK_END)
+        m_nCurPos = m_nSize + nOffset;
+    else
+    {
+        errno = EINVAL;
+        return -1;
+    }
+    return 0;
+}
+
+/************************************************************************/
+/*                                Read()                                */
+/************************************************************************/
+
+size_t VSIZipStoredHandle::Read(void *pBuffer, size_t nSize, size_t nCount)
+{
+    if (nSize == 0 || nCount == 0)
+        return 0;
+    if (m_nCurPos >= m_nSize)
+    {
+        m_bEOF = true;
+        return 0;
+    }
+    size_t nToRead = nSize * nCount;
+    if (nToRead > m_nSize - m_nCurPos)
+        nToRead = static_cast<size_t>(m_nSize - m_nCurPos);
+    if (m_poBaseHandle->Seek(m_nStartOffset + m_nCurPos, SEEK_SET) != 0)
+    {
+        m_bError = true;
+        return 0;
+    }
+    const size_t nRead = m_poBaseHandle->Read(pBuffer, 1, nToRead);
+    m_nCurPos += nRead;
+    if (nRead < nSize * nCount)
+    {
+        if (m_nCurPos >= m_nSize)
+            m_bEOF = true;
+        else
+            m_bError = true;
+    }
+    return nRead / nSize;
+}
+
+/************************************************************************/
+/*                           ReadMultiRange()                           */
+/************************************************************************/
+
+int VSIZipStoredHandle::ReadMultiRange(int nRanges, void **ppData,
+                                       const vsi_l_offset *panOffsets,
+                                       const size_t *panSizes)
+{
+    std::vector<vsi_l_offset> anOffsets;
+    anOffsets.reserve(nRanges);
+    for (int i = 0; i < nRanges; ++i)
+    {
+        if (panOffsets[i] > m_nSize || panSizes[i] > m_nSize - panOffsets[i])
+        {
+            // Let the generic implementation deal with short reads
+            return VSIVirtualHandle::ReadMultiRange(nRanges, ppData,
+                                                    panOffsets, panSizes);
+        }
+        anOffsets.push_back(m_nStartOffset + panOffsets[i]);
+    }
+    return m_poBaseHandle->ReadMultiRange(nRanges, ppData, anOffsets.data(),
+                                          panSizes);
+}
+
+/************************************************************************/
+/*                             AdviseRead()                             */
+/************************************************************************/
+
+void VSIZipStoredHandle::AdviseRead(int nRanges,
+                                    const vsi_l_offset *panOffsets,
+                                    const size_t *panSizes)
+{
+    std::vector<vsi_l_offset> anOffsets;
+    std::vector<size_t> anSizes;
+    anOffsets.reserve(nRanges);
+    anSizes.reserve(nRanges);
+    for (int i = 0; i < nRanges; ++i)
+    {
+        if (panOffsets[i] < m_nSize)
+        {
+            anOffsets.push_back(m_nStartOffset + panOffsets[i]);
+            anSizes.push_back(static_cast<size_t>(std::min<vsi_l_offset>(
+                panSizes[i], m_nSize - panOffsets[i])));
+        }
+    }
+    if (!anOffsets.empty())
+    {
+        m_poBaseHandle->AdviseRead(static_cast<int>(anOffsets.size()),
+                                   anOffsets.data(), anSizes.data());
+    }
+}
+
 /************************************************************************/
 /*                         VSISOZipHandle                               */
 /************************************************************************/
@@ -3770,6 +4696,7 @@ class VSISOZipHandle final : public VSIVirtualHandle
     bool bError_ = false;
     vsi_l_offset nCurPos_ = 0;
     bool bOK_ = true;
+    std::vector<GByte> abyCompressedData_{};
 #ifdef HAVE_LIBDEFLATE
     struct libdeflate_decompressor *pDecompressor_ = nullptr;
 #else
@@ -3955,10 +4882,14 @@ size_t VSISOZipHandle::Read(void *pBuffer, size_t nSize, size_t nCount)
     };
 
     size_t nOffsetInOutputBuffer = 0;
+    // When reading several consecutive chunks, the end offset of a chunk is
+    // the start offset of the next one.
+    uint64_t nOffsetInCompressedStream = static_cast<uint64_t>(-1);
     while (true)
     {
-        uint64_t nOffsetInCompressedStream =
-            ReadOffsetInCompressedStream(nCurPos_ / nChunkSize_);
+        if (nOffsetInOutputBuffer == 0)
+            nOffsetInCompressedStream =
+                ReadOffsetInCompressedStream(nCurPos_ / nChunkSize_);
         if (nOffsetInCompressedStream == static_cast<uint64_t>(-1))
         {
             bError_ = true;
@@ -3966,7 +4897,7 @@ size_t VSISOZipHandle::Read(void *pBuffer, size_t nSize, size_t nCount)
                      "Cannot read nOffsetInCompressedStream");
             return 0;
         }
-        uint64_t nNextOffsetInCompressedStream =
+        const uint64_t nNextOffsetInCompressedStream =
             ReadOffsetInCompressedStream(1 + nCurPos_ / nChunkSize_);
         if (nNextOffsetInCompressedStream == static_cast<uint64_t>(-1))
         {
@@ -4006,7 +4937,9 @@ size_t VSISOZipHandle::Read(void *pBuffer, size_t nSize, size_t nCount)
         const int nCompressedToRead = static_cast<int>(
             nNextOffsetInCompressedStream - nOffsetInCompressedStream);
         // CPLDebug("VSIZIP", "nCompressedToRead = %d", nCompressedToRead);
-        std::vector<GByte> abyCompressedData(nCompressedToRead);
+        // Buffer reused among calls, to avoid an allocation per chunk.
+        auto &abyCompressedData = abyCompressedData_;
+        abyCompressedData.resize(nCompressedToRead);
         if (poBaseHandle_->Read(&abyCompressedData[0], nCompressedToRead, 1) !=
             1)
         {
@@ -4090,6 +5023,7 @@ size_t VSISOZipHandle::Read(void *pBuffer, size_t nSize, size_t nCount)
         nToRead -= nToReadThisIter;
         if (nToRead == 0)
             break;
+        nOffsetInCompressedStream = nNextOffsetInCompressedStream;
     }
 
     return nCount;
@@ -4119,6 +5053,34 @@ bool VSIZipFilesystemHandler::GetFileInfo(const char *pszFilename,
         }
     }
 
+    VSIFilesystemHandler *poFSHandler = VSIFileManager::GetHandler(zipFilename);
+
+    const std::string osCacheKey =
+        std::string(zipFilename).append("/").append(osZipInFileName);
+    VSIStatBufL sStat;
+    const bool bCanCache = VSIStatL(zipFilename, &sStat) == 0;
+    if (bCanCache)
+    {
+        CachedFileInZipProperties sCached;
+        bool bFound;
+        {
+            std::lock_guard<std::mutex> oLock(m_oMutexPropertiesCache);
+            bFound = m_oPropertiesCache.tryGet(osCacheKey, sCached);
+        }
+        if (bFound &&
+            sCached.nArchiveSize == static_cast<vsi_l_offset>(sStat.st_size) &&
+            sCached.nArchiveMTime == static_cast<time_t>(sStat.st_mtime))
+        {
+            info.poVirtualHandle.reset(poFSHandler->Open(zipFilename, "rb"));
+            CPLFree(zipFilename);
+            if (!info.poVirtualHandle)
+                return false;
+            static_cast<VSIFileInZipProperties &>(info) =
+                std::move(sCached.sProps);
+            return true;
+        }
+    }
+
     VSIArchiveReader *poReader = OpenArchiveFile(zipFilename, osZipInFileName);
     if (poReader == nullptr)
     {
@@ -4126,8 +5088,6 @@ bool VSIZipFilesystemHandler::GetFileInfo(const char *pszFilename,
         return false;
     }
 
-    VSIFilesystemHandler *poFSHandler = VSIFileManager::GetHandler(zipFilename);
-
     VSIVirtualHandle *poVirtualHandle = poFSHandler->Open(zipFilename, "rb");
 
     CPLFree(zipFilename);
@@ -4344,6 +5304,16 @@ bool VSIZipFilesystemHandler::GetFileInfo(const char *pszFilename,
 
     info.poVirtualHandle.reset(poVirtualHandle);
 
+    if (bCanCache)
+    {
+        CachedFileInZipProperties sCached;
+        sCached.sProps = info;
+        sCached.nArchiveSize = static_cast<vsi_l_offset>(sStat.st_size);
+        sCached.nArchiveMTime = static_cast<time_t>(sStat.st_mtime);
+        std::lock_guard<std::mutex> oLock(m_oMutexPropertiesCache);
+        m_oPropertiesCache.insert(osCacheKey, sCached);
+    }
+
     return true;
 }
 
@@ -4407,10 +5377,16 @@ VSIVirtualHandle *VSIZipFilesystemHandler::Open(const char *pszFilename,
             return VSICreateCachedFile(poSOZIPHandle, info.nSOZIPChunkSize, 0);
         }
 
+        if (info.nCompressionMethod == 0)
+        {
+            return new VSIZipStoredHandle(std::move(info.poVirtualHandle),
+                                          info.nStartDataStream,
+                                          info.nUncompressedSize);
+        }
+
         VSIGZipHandle *poGZIPHandle = new VSIGZipHandle(
             info.poVirtualHandle.release(), nullptr, info.nStartDataStream,
-            info.nCompressedSize, info.nUncompressedSize, info.nCRC,
-            info.nCompressionMethod == 0);
+            info.nCompressedSize, info.nUncompressedSize, info.nCRC, false);
         if (!(poGZIPHandle->IsInitOK()))
         {
             delete poGZIPHandle;
@@ -4595,7 +5571,38 @@ void VSIZipFilesystemHandler::RemoveFromMap(VSIZipWriteHandle *poHandle)
 }
 
 /************************************************************************/
-/*                             OpenForWrite()                           */
+/*                     HasOptimizedReadMultiRange()                     */
+/************************************************************************/
+
+int VSIZipFilesystemHandler::HasOptimizedReadMultiRange(const char *pszPath)
+{
+    CPLString osZipInFileName;
+    char *zipFilename = SplitFilename(pszPath, osZipInFileName, TRUE);
+    if (zipFilename == nullptr)
+        return FALSE;
+
+    // Only STORED members, that have been opened before, forward
+    // ReadMultiRange() requests to the underlying file.
+    const std::string osCacheKey =
+        std::string(zipFilename).append("/").append(osZipInFileName);
+    CachedFileInZipProperties sCached;
+    bool bFound;
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutexPropertiesCache);
+        bFound = m_oPropertiesCache.tryGet(osCacheKey, sCached);
+    }
+    int nRet = FALSE;
+    if (bFound && sCached.sProps.nCompressionMethod == 0)
+    {
+        nRet = VSIFileManager::GetHandler(zipFilename)
+                   ->HasOptimizedReadMultiRange(zipFilename);
+    }
+    CPLFree(zipFilename);
+    return nRet;
+}
+
+/************************************************************************/
+/*                            OpenForWrite()                            */
 /************************************************************************/
 
 VSIVirtualHandle *VSIZipFilesystemHandler::OpenForWrite(const char *pszFilename,
@@ -4627,6 +5634,10 @@ VSIZipFilesystemHandler::OpenForWrite_unlocked(const char *pszFilename,
 
         oFileList.erase(iter);
     }
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutexPropertiesCache);
+        m_oPropertiesCache.clear();
+    }
 
     if (oMapZipWriteHandles.find(osZipFilename) != oMapZipWriteHandles.end())
     {
@@ -5013,6 +6024,7 @@ void VSIInstallZipFileHandler()
 void *CPLZLibDeflate(const void *ptr, size_t nBytes, int nLevel, void *outptr,
                      size_t nOutAvailableBytes, size_t *pnOutBytes)
 {
+    CPL_TRACE_SCOPE_CAT("CPLZLibDeflate", "codec");
     if (pnOutBytes != nullptr)
         *pnOutBytes = 0;
 
@@ -5149,6 +6161,7 @@ void *CPLZLibInflateEx(const void *ptr, size_t nBytes, void *outptr,
                        size_t nOutAvailableBytes, bool bAllowResizeOutptr,
                        size_t *pnOutBytes)
 {
+    CPL_TRACE_SCOPE_CAT("CPLZLibInflate", "codec");
     if (pnOutBytes != nullptr)
         *pnOutBytes = 0;
     char *pszReallocatableBuf = nullptr;
@@ -36,6 +36,7 @@
 #include "cpl_time.h"
 #include "cpl_vsil_curl_priv.h"
 #include "cpl_vsil_curl_class.h"
+#include "gdal_thread_pool.h"
 
 #include <errno.h>
 
@@ -778,6 +779,37 @@ VSIS3LikeWriteHandle::VSIS3LikeWriteHandle(
                      "Cannot allocate working buffer for %s",
                      m_poFS->GetFSPrefix().c_str());
         }
+
+        if (m_poFS->SupportsParallelMultipartUpload())
+        {
+            // Upload threads count in the process-wide thread limit.
+            m_nUploadConcurrency = GDALCapThreadCount(std::max(
+                1, atoi(VSIGetPathSpecificOption(
+                       pszFilename,
+                       std::string("CPL_VSI")
+                           .append(m_poFS->GetDebugKey())
+                           .append("_UPLOAD_CONCURRENCY")
+                           .c_str(),
+                       "1"))));
+            // Each part being uploaded holds a buffer, in addition to the
+            // one being filled. Do not use more than a quarter of the RAM.
+            const GIntBig nUsableRAM = CPLGetUsablePhysicalRAM();
+            if (m_nUploadConcurrency > 1 && nUsableRAM > 0 &&
+                m_nBufferSize > 0)
+            {
+                const GIntBig nMaxConcurrency = std::max<GIntBig>(
+                    1, nUsableRAM / 4 / static_cast<GIntBig>(m_nBufferSize) -
+                           1);
+                if (m_nUploadConcurrency > nMaxConcurrency)
+                {
+                    CPLDebug(m_poFS->GetDebugKey(),
+                             "Limiting upload concurrency to " CPL_FRMT_GIB
+                             " due to available RAM",
+                             nMaxConcurrency);
+                    m_nUploadConcurrency = static_cast<int>(nMaxConcurrency);
+                }
+            }
+        }
     }
 }
 
@@ -854,6 +886,8 @@ VSIS3LikeWriteHandle::~VSIS3LikeWriteHandle()
     VSIS3LikeWriteHandle::Close();
     delete m_poS3HandleHelper;
     CPLFree(m_pabyBuffer);
+    for (GByte *pabyBuffer : m_apabyFreeBuffers)
+        CPLFree(pabyBuffer);
     if (m_hCurlMulti)
     {
         if (m_hCurl)
@@ -1032,6 +1066,9 @@ bool VSIS3LikeWriteHandle::UploadPart()
                  m_poFS->GetDebugKey());
         return false;
     }
+    if (m_nUploadConcurrency > 1)
+        return UploadPartInBackground();
+
     const std::string osEtag = m_poFS->UploadPart(
         m_osFilename, m_nPartNumber, m_osUploadID,
         static_cast<vsi_l_offset>(m_nBufferSize) * (m_nPartNumber - 1),
@@ -1045,6 +1082,130 @@ bool VSIS3LikeWriteHandle::UploadPart()
     return !osEtag.empty();
 }
 
+/************************************************************************/
+/*                           UploadPartJob()                            */
+/************************************************************************/
+
+void VSIS3LikeWriteHandle::UploadPartJob(void *pData)
+{
+    PartUploadJob *psJob = static_cast<PartUploadJob *>(pData);
+    VSIS3LikeWriteHandle *poHandle = psJob->poHandle;
+
+    // The handle helper is modified by UploadPart(), so each job needs
+    // its own.
+    std::unique_ptr<IVSIS3LikeHandleHelper> poS3HandleHelper(
+        poHandle->m_poFS->CreateHandleHelper(
+            poHandle->m_osFilename.c_str() +
+                poHandle->m_poFS->GetFSPrefix().size(),
+            false));
+    if (poS3HandleHelper)
+    {
+        psJob->osEtag = poHandle->m_poFS->UploadPart(
+            poHandle->m_osFilename, psJob->nPartNumber, poHandle->m_osUploadID,
+            static_cast<vsi_l_offset>(poHandle->m_nBufferSize) *
+                (psJob->nPartNumber - 1),
+            psJob->pabyBuffer, psJob->nBufferSize, poS3HandleHelper.get(),
+            poHandle->m_oRetryParameters, nullptr);
+    }
+
+    std::lock_guard oLock(poHandle->m_oMutexUpload);
+    poHandle->m_apabyFreeBuffers.push_back(psJob->pabyBuffer);
+    psJob->pabyBuffer = nullptr;
+    if (psJob->osEtag.empty())
+        poHandle->m_bUploadError = true;
+}
+
+/************************************************************************/
+/*                       UploadPartInBackground()                       */
+/************************************************************************/
+
+// Hand over the current buffer to a worker thread, and continue with
+// another buffer, so that the caller can go on writing while the part is
+// uploaded.
+bool VSIS3LikeWriteHandle::UploadPartInBackground()
+{
+    if (!m_poUploadThreadPool)
+    {
+        auto poThreadPool = std::make_unique<CPLWorkerThreadPool>();
+        if (!poThreadPool->Setup(m_nUploadConcurrency, nullptr, nullptr))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot create upload threads for %s",
+                     m_osFilename.c_str());
+            return false;
+        }
+        m_poUploadJobQueue = poThreadPool->CreateJobQueue();
+        m_poUploadThreadPool = std::move(poThreadPool);
+    }
+
+    // Bound the number of parts in flight, and thus the memory used.
+    m_poUploadJobQueue->WaitCompletion(m_nUploadConcurrency - 1);
+
+    GByte *pabyNewBuffer = nullptr;
+    {
+        std::lock_guard oLock(m_oMutexUpload);
+        if (m_bUploadError)
+            return false;
+        if (!m_apabyFreeBuffers.empty())
+        {
+            pabyNewBuffer = m_apabyFreeBuffers.back();
+            m_apabyFreeBuffers.pop_back();
+        }
+    }
+    if (pabyNewBuffer == nullptr)
+    {
+        pabyNewBuffer = static_cast<GByte *>(VSIMalloc(m_nBufferSize));
+        if (pabyNewBuffer == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate working buffer for %s",
+                     m_poFS->GetFSPrefix().c_str());
+            return false;
+        }
+    }
+
+    auto psJob = std::make_unique<PartUploadJob>();
+    psJob->poHandle = this;
+    psJob->nPartNumber = m_nPartNumber;
+    psJob->pabyBuffer = m_pabyBuffer;
+    psJob->nBufferSize = m_nBufferOff;
+    m_pabyBuffer = pabyNewBuffer;
+    m_nBufferOff = 0;
+
+    if (!m_poUploadJobQueue->SubmitJob(UploadPartJob, psJob.get()))
+    {
+        std::lock_guard oLock(m_oMutexUpload);
+        m_apabyFreeBuffers.push_back(psJob->pabyBuffer);
+        return false;
+    }
+    m_apoPartUploadJobs.push_back(std::move(psJob));
+    return true;
+}
+
+/************************************************************************/
+/*                       WaitPendingPartUploads()                       */
+/************************************************************************/
+
+// Wait for the completion of parts uploaded in the background, and
+// collect their ETags in part order.
+bool VSIS3LikeWriteHandle::WaitPendingPartUploads()
+{
+    if (!m_poUploadJobQueue)
+        return true;
+    m_poUploadJobQueue->WaitCompletion();
+
+    bool bRet = true;
+    for (const auto &psJob : m_apoPartUploadJobs)
+    {
+        if (psJob->osEtag.empty())
+            bRet = false;
+        else if (bRet)
+            m_aosEtags.push_back(psJob->osEtag);
+    }
+    m_apoPartUploadJobs.clear();
+    return bRet;
+}
+
 std::string
 IVSIS3LikeFSHandler::UploadPart(const std::string &osFilename, int nPartNumber,
                                 const std::string &osUploadID,
@@ -2036,6 +2197,11 @@ int VSIS3LikeWriteHandle::Close()
         }
         else
         {
+            if (!WaitPendingPartUploads())
+            {
+                m_bError = true;
+                nRet = -1;
+            }
             if (m_bError)
             {
                 if (!m_poFS->AbortMultipart(m_osFilename, m_osUploadID,
@@ -2043,7 +2209,8 @@ int VSIS3LikeWriteHandle::Close()
                                             m_oRetryParameters))
                     nRet = -1;
             }
-            else if (m_nBufferOff > 0 && !UploadPart())
+            else if (m_nBufferOff > 0 &&
+                     !(UploadPart() && WaitPendingPartUploads()))
                 nRet = -1;
             else if (m_poFS->CompleteMultipart(
                          m_osFilename, m_osUploadID, m_aosEtags, m_nCurOffset,
@@ -82,6 +82,14 @@
 #include <sys/uio.h>
 #endif
 
+#if defined(__linux) && defined(HAVE_LINUX_IO_URING_H) &&                     \
+    defined(HAVE_PREAD64)
+#define HAVE_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
 #if defined(__MACH__) && defined(__APPLE__)
 #define HAS_CASE_INSENSITIVE_FILE_SYSTEM
 #include <stdio.h>
@@ -89,8 +97,12 @@
 #include <limits.h>
 #endif
 
+#include <algorithm>
+#include <climits>
 #include <limits>
+#include <memory>
 #include <new>
+#include <vector>
 
 #include "cpl_config.h"
 #include "cpl_conv.h"
@@ -261,6 +273,11 @@ class VSIUnixStdioHandle final : public VSIVirtualHandle
     size_t PRead(void * /*pBuffer*/, size_t /* nSize */,
                  vsi_l_offset /*nOffset*/) const override;
 #endif
+#ifdef HAVE_IO_URING
+    int ReadMultiRange(int nRanges, void **ppData,
+                       const vsi_l_offset *panOffsets,
+                       const size_t *panSizes) override;
+#endif
 };
 
 /************************************************************************/
@@ -697,6 +714,324 @@ size_t VSIUnixStdioHandle::PRead(void *pBuffer, size_t nSize,
 }
 #endif
 
+#ifdef HAVE_IO_URING
+
+/************************************************************************/
+/*                          VSIIOUringRing                              */
+/************************************************************************/
+
+namespace
+{
+// Minimal io_uring submission/completion ring, driven through raw system
+// calls so that no dependency on liburing is needed.
+// A ring is not thread-safe: one instance is kept per thread.
+class VSIIOUringRing
+{
+    CPL_DISALLOW_COPY_ASSIGN(VSIIOUringRing)
+
+    int m_fd = -1;
+    void *m_pSQRing = MAP_FAILED;
+    size_t m_nSQRingSize = 0;
+    void *m_pCQRing = MAP_FAILED;
+    size_t m_nCQRingSize = 0;
+    io_uring_sqe *m_pasSQE = nullptr;
+    size_t m_nSQESize = 0;
+
+    unsigned *m_pnSQTail = nullptr;
+    unsigned m_nSQMask = 0;
+    unsigned *m_panSQArray = nullptr;
+    unsigned *m_pnCQHead = nullptr;
+    unsigned *m_pnCQTail = nullptr;
+    unsigned m_nCQMask = 0;
+    io_uring_cqe *m_pasCQE = nullptr;
+    unsigned m_nEntries = 0;
+
+  public:
+    VSIIOUringRing() = default;
+    ~VSIIOUringRing();
+
+    bool Init(unsigned nEntries);
+
+    unsigned GetEntries() const
+    {
+        return m_nEntries;
+    }
+
+    void QueueRead(int fd, void *pBuffer, unsigned nSize, uint64_t nOffset,
+                   uint64_t nUserData);
+    bool SubmitAndWait(unsigned nToSubmit);
+    bool GetCompletion(uint64_t &nUserData, int &nRes);
+};
+
+/************************************************************************/
+/*                          ~VSIIOUringRing()                           */
+/************************************************************************/
+
+VSIIOUringRing::~VSIIOUringRing()
+{
+    if (m_pasSQE)
+        munmap(m_pasSQE, m_nSQESize);
+    if (m_pCQRing != MAP_FAILED && m_pCQRing != m_pSQRing)
+        munmap(m_pCQRing, m_nCQRingSize);
+    if (m_pSQRing != MAP_FAILED)
+        munmap(m_pSQRing, m_nSQRingSize);
+    if (m_fd >= 0)
+        close(m_fd);
+}
+
+/************************************************************************/
+/*                               Init()                                 */
+/************************************************************************/
+
+bool VSIIOUringRing::Init(unsigned nEntries)
+{
+    io_uring_params sParams;
+    memset(&sParams, 0, sizeof(sParams));
+    m_fd = static_cast<int>(syscall(__NR_io_uring_setup, nEntries, &sParams));
+    if (m_fd < 0)
+        return false;
+
+    m_nSQRingSize =
+        sParams.sq_off.array + sParams.sq_entries * sizeof(unsigned);
+    m_nCQRingSize =
+        sParams.cq_off.cqes + sParams.cq_entries * sizeof(io_uring_cqe);
+    const bool bSingleMMap = (sParams.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (bSingleMMap)
+    {
+        m_nSQRingSize = std::max(m_nSQRingSize, m_nCQRingSize);
+        m_nCQRingSize = m_nSQRingSize;
+    }
+
+    m_pSQRing = mmap(nullptr, m_nSQRingSize, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_SQ_RING);
+    if (m_pSQRing == MAP_FAILED)
+        return false;
+    if (bSingleMMap)
+    {
+        m_pCQRing = m_pSQRing;
+    }
+    else
+    {
+        m_pCQRing = mmap(nullptr, m_nCQRingSize, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_CQ_RING);
+        if (m_pCQRing == MAP_FAILED)
+            return false;
+    }
+
+    m_nSQESize = sParams.sq_entries * sizeof(io_uring_sqe);
+    void *pSQE = mmap(nullptr, m_nSQESize, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_SQES);
+    if (pSQE == MAP_FAILED)
+        return false;
+    m_pasSQE = static_cast<io_uring_sqe *>(pSQE);
+
+    GByte *pabySQ = static_cast<GByte *>(m_pSQRing);
+    m_pnSQTail = reinterpret_cast<unsigned *>(pabySQ + sParams.sq_off.tail);
+    m_nSQMask =
+        *reinterpret_cast<unsigned *>(pabySQ + sParams.sq_off.ring_mask);
+    m_panSQArray = reinterpret_cast<unsigned *>(pabySQ + sParams.sq_off.array);
+
+    GByte *pabyCQ = static_cast<GByte *>(m_pCQRing);
+    m_pnCQHead = reinterpret_cast<unsigned *>(pabyCQ + sParams.cq_off.head);
+    m_pnCQTail = reinterpret_cast<unsigned *>(pabyCQ + sParams.cq_off.tail);
+    m_nCQMask =
+        *reinterpret_cast<unsigned *>(pabyCQ + sParams.cq_off.ring_mask);
+    m_pasCQE = reinterpret_cast<io_uring_cqe *>(pabyCQ + sParams.cq_off.cqes);
+
+    m_nEntries = sParams.sq_entries;
+    return true;
+}
+
+/************************************************************************/
+/*                            QueueRead()                               */
+/************************************************************************/
+
+void VSIIOUringRing::QueueRead(int fd, void *pBuffer, unsigned nSize,
+                               uint64_t nOffset, uint64_t nUserData)
+{
+    // Only this thread produces submission entries, so a relaxed load of
+    // our own tail is enough.
+    const unsigned nTail = __atomic_load_n(m_pnSQTail, __ATOMIC_RELAXED);
+    const unsigned nIdx = nTail & m_nSQMask;
+    io_uring_sqe *psSQE = &m_pasSQE[nIdx];
+    memset(psSQE, 0, sizeof(*psSQE));
+    psSQE->opcode = IORING_OP_READ;
+    psSQE->fd = fd;
+    psSQE->addr = reinterpret_cast<uintptr_t>(pBuffer);
+    psSQE->len = nSize;
+    psSQE->off = nOffset;
+    psSQE->user_data = nUserData;
+    m_panSQArray[nIdx] = nIdx;
+    __atomic_store_n(m_pnSQTail, nTail + 1, __ATOMIC_RELEASE);
+}
+
+/************************************************************************/
+/*                          SubmitAndWait()                             */
+/************************************************************************/
+
+bool VSIIOUringRing::SubmitAndWait(unsigned nToSubmit)
+{
+    unsigned nSubmitted = 0;
+    while (nSubmitted < nToSubmit)
+    {
+        const long nRet =
+            syscall(__NR_io_uring_enter, m_fd, nToSubmit - nSubmitted,
+                    nToSubmit - nSubmitted, IORING_ENTER_GETEVENTS, nullptr, 0);
+        if (nRet < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        nSubmitted += static_cast<unsigned>(nRet);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                          GetCompletion()                             */
+/************************************************************************/
+
+bool VSIIOUringRing::GetCompletion(uint64_t &nUserData, int &nRes)
+{
+    const unsigned nHead = __atomic_load_n(m_pnCQHead, __ATOMIC_RELAXED);
+    if (nHead == __atomic_load_n(m_pnCQTail, __ATOMIC_ACQUIRE))
+        return false;
+    const io_uring_cqe *psCQE = &m_pasCQE[nHead & m_nCQMask];
+    nUserData = psCQE->user_data;
+    nRes = psCQE->res;
+    __atomic_store_n(m_pnCQHead, nHead + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+/************************************************************************/
+/*                        VSIGetIOUringRing()                           */
+/************************************************************************/
+
+// Returns the ring of the calling thread, or nullptr if io_uring is not
+// available (old kernel, seccomp filtering, io_uring_disabled sysctl...).
+thread_local std::unique_ptr<VSIIOUringRing> tlRing;
+thread_local bool tlbInitDone = false;
+
+VSIIOUringRing *VSIGetIOUringRing()
+{
+    if (!tlbInitDone)
+    {
+        tlbInitDone = true;
+        auto poRing = std::make_unique<VSIIOUringRing>();
+        constexpr unsigned RING_ENTRIES = 64;
+        if (poRing->Init(RING_ENTRIES))
+        {
+            tlRing = std::move(poRing);
+        }
+        else
+        {
+            CPLDebug("VSI", "io_uring not available: %s", strerror(errno));
+        }
+    }
+    return tlRing.get();
+}
+}  // namespace
+
+/************************************************************************/
+/*                          ReadMultiRange()                            */
+/************************************************************************/
+
+int VSIUnixStdioHandle::ReadMultiRange(int nRanges, void **ppData,
+                                       const vsi_l_offset *panOffsets,
+                                       const size_t *panSizes)
+{
+    const bool bUseIOUring =
+        CPLTestBool(CPLGetConfigOption("CPL_VSIL_USE_IO_URING", "NO"));
+    VSIIOUringRing *poRing = bUseIOUring ? VSIGetIOUringRing() : nullptr;
+    if (poRing == nullptr)
+    {
+        return VSIVirtualHandle::ReadMultiRange(nRanges, ppData, panOffsets,
+                                                panSizes);
+    }
+
+    // Reads below bypass the stdio buffer, so pending writes must reach
+    // the file descriptor first.
+    if (bLastOpWrite)
+    {
+        if (fflush(fp) != 0)
+            return -1;
+        bLastOpWrite = false;
+    }
+
+    const int fd = fileno(fp);
+    // Ranges whose completion was short (only possible near end of file, or
+    // for sizes above what a single SQE can express) are completed with
+    // pread64().
+    std::vector<size_t> anDone(nRanges, 0);
+    int iNext = 0;
+    while (iNext < nRanges)
+    {
+        unsigned nQueued = 0;
+        while (iNext < nRanges && nQueued < poRing->GetEntries())
+        {
+            const unsigned nSize = static_cast<unsigned>(
+                std::min<size_t>(panSizes[iNext], INT_MAX));
+            if (nSize > 0)
+            {
+                poRing->QueueRead(fd, ppData[iNext], nSize, panOffsets[iNext],
+                                  static_cast<uint64_t>(iNext));
+                ++nQueued;
+            }
+            ++iNext;
+        }
+        if (nQueued == 0)
+            break;
+
+        if (!poRing->SubmitAndWait(nQueued))
+        {
+            // Submission entries may have been left in the ring: do not
+            // reuse it on this thread. Fall back to the generic code path.
+            CPLDebug("VSI", "io_uring_enter() failed: %s", strerror(errno));
+            tlRing.reset();
+            return VSIVirtualHandle::ReadMultiRange(nRanges, ppData,
+                                                    panOffsets, panSizes);
+        }
+
+        uint64_t nUserData = 0;
+        int nRes = 0;
+        unsigned nCompleted = 0;
+        while (nCompleted < nQueued && poRing->GetCompletion(nUserData, nRes))
+        {
+            ++nCompleted;
+            if (nRes < 0)
+            {
+                // e.g. -EINVAL on kernels < 5.6 that lack IORING_OP_READ:
+                // the pread64() pass below takes care of the range.
+                continue;
+            }
+            anDone[static_cast<size_t>(nUserData)] = static_cast<size_t>(nRes);
+        }
+    }
+
+    for (int i = 0; i < nRanges; ++i)
+    {
+        while (anDone[i] < panSizes[i])
+        {
+            const ssize_t nRead =
+                pread64(fd, static_cast<GByte *>(ppData[i]) + anDone[i],
+                        panSizes[i] - anDone[i], panOffsets[i] + anDone[i]);
+            if (nRead < 0 && errno == EINTR)
+                continue;
+            if (nRead <= 0)
+                return -1;
+            anDone[i] += static_cast<size_t>(nRead);
+        }
+#ifdef VSI_COUNT_BYTES_READ
+        nTotalBytesRead += panSizes[i];
+#endif
+    }
+
+    return 0;
+}
+
+#endif  // HAVE_IO_URING
+
 /************************************************************************/
 /* ==================================================================== */
 /*                       VSIUnixStdioFilesystemHandler                  */
@@ -913,6 +913,9 @@ VSIWebHDFSHandle::VSIWebHDFSHandle(VSIWebHDFSFSHandler *poFSIn,
         VSIGetPathSpecificOption(pszFilename, "WEBHDFS_DELEGATION", "");
     if (!m_osDelegationParam.empty())
         m_osDelegationParam = "&delegation=" + m_osDelegationParam;
+
+    // ReadMultiRange() is not optimized, so don't split sequential reads
+    m_nReadAheadMaxParallel = 1;
 }
 
 /************************************************************************/
@@ -0,0 +1,1081 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Implement VSI large file api for Zstandard (.zst) files.
+ * Author:   agent, <agent at local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent at local>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "cpl_vsi_virtual.h"
+
+#ifndef HAVE_ZSTD
+
+/************************************************************************/
+/*                    VSIInstallZstdFileHandler()                       */
+/************************************************************************/
+
+/*!
+ \brief Install /vsizstd/ Zstandard file system handler (requires libzstd)
+
+ \verbatim embed:rst
+ See :ref:`/vsizstd/ documentation <vsizstd>`
+ \endverbatim
+
+ @since GDAL 3.10
+ */
+void VSIInstallZstdFileHandler(void)
+{
+    // dummy
+}
+
+#else
+
+//! @cond Doxygen_Suppress
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <zstd.h>
+
+#include "cpl_compressor.h"
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
+
+#if HAVE_SYS_STAT_H
+#include <sys/stat.h>
+#endif
+
+constexpr uint32_t ZSTD_FRAME_MAGIC = 0xFD2FB528U;
+constexpr uint32_t ZSTD_SKIPPABLE_FRAME_SEEK_TABLE_MAGIC = 0x184D2A5EU;
+constexpr uint32_t ZSTD_SEEKABLE_MAGIC = 0x8F92EAB1U;
+constexpr int ZSTD_SEEK_TABLE_FOOTER_SIZE = 9;
+constexpr int ZSTD_SKIPPABLE_HEADER_SIZE = 8;
+// Guard against corrupted seek tables
+constexpr uint32_t ZSTD_SEEKABLE_MAX_FRAME_DECOMPRESSED_SIZE = 1U << 30;
+
+static uint32_t ReadUInt32LSB(const GByte *pabyData)
+{
+    return pabyData[0] | (pabyData[1] << 8) | (pabyData[2] << 16) |
+           (static_cast<uint32_t>(pabyData[3]) << 24);
+}
+
+/************************************************************************/
+/* ==================================================================== */
+/*                         VSIZstdSeekableHandle                        */
+/* ==================================================================== */
+/************************************************************************/
+
+/* Files in the Zstandard seekable format (see
+   https://github.com/facebook/zstd/blob/dev/contrib/seekable_format/zstd_seekable_compression_format.md)
+   are a concatenation of independent Zstandard frames, followed by a
+   skippable frame holding a seek table with the compressed and
+   decompressed size of each frame. This allows random access and
+   decompression of several frames in parallel.
+*/
+
+class VSIZstdSeekableHandle final : public VSIVirtualHandle
+{
+    CPL_DISALLOW_COPY_ASSIGN(VSIZstdSeekableHandle)
+
+    struct Frame
+    {
+        std::vector<GByte> abyCompressed{};
+        std::vector<GByte> abyData{};
+        bool bDone = false;
+        bool bOK = false;
+    };
+
+    struct Job
+    {
+        VSIZstdSeekableHandle *poParent = nullptr;
+        std::shared_ptr<Frame> poFrame{};
+    };
+
+    VSIVirtualHandle *m_poBaseHandle = nullptr;
+    const CPLCompressor *m_psDecompressor = nullptr;
+    // Start offsets of each frame, plus a final entry with the end offsets.
+    std::vector<vsi_l_offset> m_anCompressedOffsets{};
+    std::vector<vsi_l_offset> m_anUncompressedOffsets{};
+    vsi_l_offset m_nCurOffset = 0;
+    size_t m_iLastFrame = 0;
+    bool m_bEOF = false;
+    bool m_bError = false;
+    int m_nThreads = 1;
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+    std::map<size_t, std::shared_ptr<Frame>> m_oMapFrames{};
+    std::unique_ptr<CPLWorkerThreadPool> m_poPool{};
+
+    bool ReadSeekTable(vsi_l_offset nFileSize);
+    static void DecompressJob(void *pData);
+    std::shared_ptr<Frame> GetFrame(size_t iFrame, size_t nFramesNeeded,
+                                    bool bSequential);
+
+    VSIZstdSeekableHandle(VSIVirtualHandle *poBaseHandle, int nThreads);
+
+  public:
+    ~VSIZstdSeekableHandle() override;
+
+    static VSIZstdSeekableHandle *Open(VSIVirtualHandle *poBaseHandle,
+                                       int nThreads);
+
+    vsi_l_offset GetUncompressedSize() const
+    {
+        return m_anUncompressedOffsets.back();
+    }
+
+    int Seek(vsi_l_offset nOffset, int nWhence) override;
+    vsi_l_offset Tell() override;
+    size_t Read(void *pBuffer, size_t nSize, size_t nMemb) override;
+    size_t Write(const void *pBuffer, size_t nSize, size_t nMemb) override;
+    void ClearErr() override;
+    int Eof() override;
+    int Error() override;
+    int Close() override;
+};
+
+/************************************************************************/
+/*                       VSIZstdSeekableHandle()                        */
+/************************************************************************/
+
+VSIZstdSeekableHandle::VSIZstdSeekableHandle(VSIVirtualHandle *poBaseHandle,
+                                             int nThreads)
+    : m_poBaseHandle(poBaseHandle),
+      m_psDecompressor(CPLGetDecompressor("zstd")), m_nThreads(nThreads)
+{
+}
+
+/************************************************************************/
+/*                      ~VSIZstdSeekableHandle()                        */
+/************************************************************************/
+
+VSIZstdSeekableHandle::~VSIZstdSeekableHandle()
+{
+    VSIZstdSeekableHandle::Close();
+}
+
+/************************************************************************/
+/*                               Close()                                */
+/************************************************************************/
+
+int VSIZstdSeekableHandle::Close()
+{
+    if (m_poPool)
+        m_poPool->WaitCompletion();
+    m_poPool.reset();
+    m_oMapFrames.clear();
+
+    int nRet = 0;
+    if (m_poBaseHandle)
+    {
+        nRet = m_poBaseHandle->Close();
+        delete m_poBaseHandle;
+        m_poBaseHandle = nullptr;
+    }
+    return nRet;
+}
+
+/************************************************************************/
+/*                           ReadSeekTable()                            */
+/************************************************************************/
+
+/** Reads the seek table at the end of the file. It is a skippable frame
+ * whose content is made of one entry per frame (little-endian uint32
+ * compressed size, uint32 decompressed size and optional uint32 checksum),
+ * followed by a footer with the number of frames, a descriptor byte and
+ * a magic number.
+ */
+bool VSIZstdSeekableHandle::ReadSeekTable(vsi_l_offset nFileSize)
+{
+    if (nFileSize < ZSTD_SKIPPABLE_HEADER_SIZE + ZSTD_SEEK_TABLE_FOOTER_SIZE)
+        return false;
+
+    GByte abyFooter[ZSTD_SEEK_TABLE_FOOTER_SIZE];
+    if (m_poBaseHandle->Seek(nFileSize - ZSTD_SEEK_TABLE_FOOTER_SIZE,
+                             SEEK_SET) != 0 ||
+        m_poBaseHandle->Read(abyFooter, 1, ZSTD_SEEK_TABLE_FOOTER_SIZE) !=
+            ZSTD_SEEK_TABLE_FOOTER_SIZE ||
+        ReadUInt32LSB(abyFooter + 5) != ZSTD_SEEKABLE_MAGIC)
+    {
+        return false;
+    }
+    const uint32_t nFrames = ReadUInt32LSB(abyFooter);
+    const GByte nDescriptor = abyFooter[4];
+    // Reserved bits must be zero
+    if ((nDescriptor & 0x7C) != 0)
+        return false;
+    const size_t nEntrySize = (nDescriptor & 0x80) ? 12 : 8;
+    const vsi_l_offset nTableSize =
+        static_cast<vsi_l_offset>(nFrames) * nEntrySize +
+        ZSTD_SEEK_TABLE_FOOTER_SIZE;
+    if (nTableSize + ZSTD_SKIPPABLE_HEADER_SIZE > nFileSize)
+        return false;
+    const vsi_l_offset nSkippableFrameOffset =
+        nFileSize - nTableSize - ZSTD_SKIPPABLE_HEADER_SIZE;
+
+    std::vector<GByte> abyTable;
+    try
+    {
+        abyTable.resize(static_cast<size_t>(nTableSize) +
+                        ZSTD_SKIPPABLE_HEADER_SIZE);
+    }
+    catch (const std::exception &)
+    {
+        return false;
+    }
+    if (m_poBaseHandle->Seek(nSkippableFrameOffset, SEEK_SET) != 0 ||
+        m_poBaseHandle->Read(abyTable.data(), 1, abyTable.size()) !=
+            abyTable.size() ||
+        ReadUInt32LSB(abyTable.data()) !=
+            ZSTD_SKIPPABLE_FRAME_SEEK_TABLE_MAGIC ||
+        ReadUInt32LSB(abyTable.data() + 4) != nTableSize)
+    {
+        return false;
+    }
+
+    m_anCompressedOffsets.reserve(nFrames + 1);
+    m_anUncompressedOffsets.reserve(nFrames + 1);
+    vsi_l_offset nCompressedOffset = 0;
+    vsi_l_offset nUncompressedOffset = 0;
+    for (uint32_t i = 0; i < nFrames; ++i)
+    {
+        const GByte *pabyEntry =
+            abyTable.data() + ZSTD_SKIPPABLE_HEADER_SIZE + i * nEntrySize;
+        const uint32_t nCompressedSize = ReadUInt32LSB(pabyEntry);
+        const uint32_t nDecompressedSize = ReadUInt32LSB(pabyEntry + 4);
+        if (nCompressedSize == 0 ||
+            nCompressedSize > nSkippableFrameOffset - nCompressedOffset ||
+            nDecompressedSize > ZSTD_SEEKABLE_MAX_FRAME_DECOMPRESSED_SIZE)
+        {
+            return false;
+        }
+        m_anCompressedOffsets.push_back(nCompressedOffset);
+        m_anUncompressedOffsets.push_back(nUncompressedOffset);
+        nCompressedOffset += nCompressedSize;
+        nUncompressedOffset += nDecompressedSize;
+    }
+    if (nCompressedOffset != nSkippableFrameOffset)
+        return false;
+    m_anCompressedOffsets.push_back(nCompressedOffset);
+    m_anUncompressedOffsets.push_back(nUncompressedOffset);
+    return true;
+}
+
+/************************************************************************/
+/*                                Open()                                */
+/************************************************************************/
+
+/** Returns a handle if poBaseHandle is a file in the Zstandard seekable
+ * format, or nullptr. In the later case, poBaseHandle is left untouched.
+ * Otherwise it is owned by the returned handle. */
+VSIZstdSeekableHandle *VSIZstdSeekableHandle::Open(VSIVirtualHandle *poBaseHandle,
+                                                   int nThreads)
+{
+    if (poBaseHandle->Seek(0, SEEK_END) != 0)
+        return nullptr;
+    const vsi_l_offset nFileSize = poBaseHandle->Tell();
+
+    auto poHandle = std::unique_ptr<VSIZstdSeekableHandle>(
+        new VSIZstdSeekableHandle(poBaseHandle, nThreads));
+    if (!poHandle->m_psDecompressor || !poHandle->ReadSeekTable(nFileSize))
+    {
+        // Do not close the base handle, which remains owned by the caller.
+        poHandle->m_poBaseHandle = nullptr;
+        return nullptr;
+    }
+
+    if (nThreads > 1 && poHandle->m_anCompressedOffsets.size() > 2)
+    {
+        poHandle->m_poPool = std::make_unique<CPLWorkerThreadPool>();
+        if (!poHandle->m_poPool->Setup(nThreads, nullptr, nullptr, false))
+            poHandle->m_poPool.reset();
+    }
+
+    return poHandle.release();
+}
+
+/************************************************************************/
+/*                           DecompressJob()                            */
+/************************************************************************/
+
+void VSIZstdSeekableHandle::DecompressJob(void *pData)
+{
+    Job *psJob = static_cast<Job *>(pData);
+    VSIZstdSeekableHandle *poParent = psJob->poParent;
+    Frame *poFrame = psJob->poFrame.get();
+    bool bOK = true;
+    if (!poFrame->abyData.empty())
+    {
+        void *pOutput = poFrame->abyData.data();
+        size_t nOutSize = poFrame->abyData.size();
+        bOK = poParent->m_psDecompressor->pfnFunc(
+                  poFrame->abyCompressed.data(), poFrame->abyCompressed.size(),
+                  &pOutput, &nOutSize, nullptr,
+                  poParent->m_psDecompressor->user_data) &&
+              nOutSize == poFrame->abyData.size();
+    }
+    poFrame->abyCompressed.clear();
+    poFrame->abyCompressed.shrink_to_fit();
+
+    {
+        std::lock_guard<std::mutex> oLock(poParent->m_oMutex);
+        poFrame->bOK = bOK;
+        poFrame->bDone = true;
+    }
+    poParent->m_oCV.notify_all();
+    delete psJob;
+}
+
+/************************************************************************/
+/*                              GetFrame()                              */
+/************************************************************************/
+
+/** Returns frame iFrame, making sure that decompression of the following
+ * nFramesNeeded - 1 frames is also started, plus some more if the access
+ * pattern is sequential. */
+std::shared_ptr<VSIZstdSeekableHandle::Frame>
+VSIZstdSeekableHandle::GetFrame(size_t iFrame, size_t nFramesNeeded,
+                                bool bSequential)
+{
+    const size_t nFrames = m_anCompressedOffsets.size() - 1;
+
+    // Forget about frames that are unlikely to be needed again. Frames
+    // still being decompressed are kept alive by their job.
+    while (!m_oMapFrames.empty() && m_oMapFrames.begin()->first + 1 < iFrame)
+        m_oMapFrames.erase(m_oMapFrames.begin());
+    size_t nReadAhead = nFramesNeeded;
+    if (m_poPool && bSequential)
+        nReadAhead = std::max(nReadAhead, static_cast<size_t>(m_nThreads));
+    while (!m_oMapFrames.empty() &&
+           std::prev(m_oMapFrames.end())->first > iFrame + 2 * nReadAhead)
+    {
+        m_oMapFrames.erase(std::prev(m_oMapFrames.end()));
+    }
+
+    // Make sure that the next frames are being decompressed, reading
+    // compressed data of consecutive missing frames at once.
+    const size_t iLastFrame = std::min(nFrames, iFrame + nReadAhead);
+    for (size_t iStart = iFrame; iStart < iLastFrame;)
+    {
+        if (m_oMapFrames.find(iStart) != m_oMapFrames.end())
+        {
+            ++iStart;
+            continue;
+        }
+        size_t iEnd = iStart + 1;
+        while (iEnd < iLastFrame &&
+               m_oMapFrames.find(iEnd) == m_oMapFrames.end())
+            ++iEnd;
+
+        const vsi_l_offset nStartOffset = m_anCompressedOffsets[iStart];
+        const size_t nSize =
+            static_cast<size_t>(m_anCompressedOffsets[iEnd] - nStartOffset);
+        std::vector<GByte> abyBuffer;
+        std::vector<std::shared_ptr<Frame>> apoFrames;
+        try
+        {
+            abyBuffer.resize(nSize);
+            for (size_t i = iStart; i < iEnd; ++i)
+            {
+                auto poFrame = std::make_shared<Frame>();
+                poFrame->abyData.resize(static_cast<size_t>(
+                    m_anUncompressedOffsets[i + 1] -
+                    m_anUncompressedOffsets[i]));
+                apoFrames.push_back(std::move(poFrame));
+            }
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate memory for Zstandard frames");
+            return nullptr;
+        }
+        if (m_poBaseHandle->Seek(nStartOffset, SEEK_SET) != 0 ||
+            m_poBaseHandle->Read(abyBuffer.data(), 1, nSize) != nSize)
+        {
+            // Only report the error if the frame we need is affected.
+            if (iStart == iFrame)
+                return nullptr;
+            break;
+        }
+
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            auto &poFrame = apoFrames[i - iStart];
+            const size_t nOffsetInBuffer =
+                static_cast<size_t>(m_anCompressedOffsets[i] - nStartOffset);
+            poFrame->abyCompressed.assign(
+                abyBuffer.begin() + nOffsetInBuffer,
+                abyBuffer.begin() + nOffsetInBuffer +
+                    static_cast<size_t>(m_anCompressedOffsets[i + 1] -
+                                        m_anCompressedOffsets[i]));
+            m_oMapFrames[i] = poFrame;
+            Job *psJob = new Job();
+            psJob->poParent = this;
+            psJob->poFrame = std::move(poFrame);
+            if (!m_poPool || !m_poPool->SubmitJob(DecompressJob, psJob))
+                DecompressJob(psJob);
+        }
+        iStart = iEnd;
+    }
+
+    auto poFrame = m_oMapFrames[iFrame];
+    std::unique_lock<std::mutex> oLock(m_oMutex);
+    m_oCV.wait(oLock, [&poFrame] { return poFrame->bDone; });
+    if (!poFrame->bOK)
+    {
+        CPLError(CE_Failure, CPLE_FileIO,
+                 "Cannot decompress Zstandard frame at offset " CPL_FRMT_GUIB,
+                 static_cast<GUIntBig>(m_anCompressedOffsets[iFrame]));
+        return nullptr;
+    }
+    return poFrame;
+}
+
+/************************************************************************/
+/*                                Read()                                */
+/************************************************************************/
+
+size_t VSIZstdSeekableHandle::Read(void *pBuffer, size_t nSize, size_t nMemb)
+{
+    if (nSize == 0 || nMemb == 0)
+        return 0;
+    const size_t nToRead = nSize * nMemb;
+    size_t nRead = 0;
+    const vsi_l_offset nUncompressedSize = GetUncompressedSize();
+    bool bSequential = false;
+    while (nRead < nToRead)
+    {
+        if (m_nCurOffset >= nUncompressedSize)
+        {
+            m_bEOF = true;
+            break;
+        }
+        // upper_bound() skips frames with no decompressed data.
+        const auto oIter =
+            std::upper_bound(m_anUncompressedOffsets.begin(),
+                             m_anUncompressedOffsets.end(), m_nCurOffset);
+        const size_t iFrame =
+            static_cast<size_t>(oIter - m_anUncompressedOffsets.begin()) - 1;
+        if (nRead == 0)
+        {
+            bSequential =
+                iFrame == m_iLastFrame || iFrame == m_iLastFrame + 1;
+        }
+        m_iLastFrame = iFrame;
+        const auto oIterEnd = std::lower_bound(
+            oIter, m_anUncompressedOffsets.end(),
+            m_nCurOffset + (nToRead - nRead));
+        const auto poFrame = GetFrame(
+            iFrame, static_cast<size_t>(oIterEnd - oIter) + 1, bSequential);
+        if (!poFrame)
+        {
+            m_bError = true;
+            break;
+        }
+        const size_t nOffsetInFrame =
+            static_cast<size_t>(m_nCurOffset - m_anUncompressedOffsets[iFrame]);
+        const size_t nChunk = std::min(
+            nToRead - nRead, poFrame->abyData.size() - nOffsetInFrame);
+        memcpy(static_cast<GByte *>(pBuffer) + nRead,
+               poFrame->abyData.data() + nOffsetInFrame, nChunk);
+        nRead += nChunk;
+        m_nCurOffset += nChunk;
+    }
+    return nRead / nSize;
+}
+
+/************************************************************************/
+/*                                Seek()                                */
+/************************************************************************/
+
+int VSIZstdSeekableHandle::Seek(vsi_l_offset nOffset, int nWhence)
+{
+    m_bEOF = false;
+    if (nWhence == SEEK_SET)
+        m_nCurOffset = nOffset;
+    else if (nWhence == SEEK_CUR)
+        m_nCurOffset += nOffset;
+    else
+        m_nCurOffset = GetUncompressedSize() + nOffset;
+    return 0;
+}
+
+/************************************************************************/
+/*                                Tell()                                */
+/************************************************************************/
+
+vsi_l_offset VSIZstdSeekableHandle::Tell()
+{
+    return m_nCurOffset;
+}
+
+/************************************************************************/
+/*                               Write()                                */
+/************************************************************************/
+
+size_t VSIZstdSeekableHandle::Write(const void * /* pBuffer */,
+                                    size_t /* nSize */, size_t /* nMemb */)
+{
+    CPLError(CE_Failure, CPLE_NotSupported,
+             "VSIFWriteL is not supported on Zstandard streams");
+    return 0;
+}
+
+/************************************************************************/
+/*                                Eof()                                 */
+/************************************************************************/
+
+int VSIZstdSeekableHandle::Eof()
+{
+    return m_bEOF;
+}
+
+/************************************************************************/
+/*                               Error()                                */
+/************************************************************************/
+
+int VSIZstdSeekableHandle::Error()
+{
+    return m_bError;
+}
+
+/************************************************************************/
+/*                              ClearErr()                              */
+/************************************************************************/
+
+void VSIZstdSeekableHandle::ClearErr()
+{
+    m_bEOF = false;
+    m_bError = false;
+}
+
+/************************************************************************/
+/* ==================================================================== */
+/*                          VSIZstdStreamHandle                         */
+/* ==================================================================== */
+/************************************************************************/
+
+/* Handle for Zstandard files without a seek table, which are decompressed
+   sequentially with the streaming API. Seeking backward restarts
+   decompression from the beginning of the file. */
+
+class VSIZstdStreamHandle final : public VSIVirtualHandle
+{
+    CPL_DISALLOW_COPY_ASSIGN(VSIZstdStreamHandle)
+
+    VSIVirtualHandle *m_poBaseHandle = nullptr;
+    ZSTD_DStream *m_psStream = nullptr;
+    std::vector<GByte> m_abyIn{};
+    ZSTD_inBuffer m_sIn{nullptr, 0, 0};
+    // Offset requested by the user
+    vsi_l_offset m_nCurOffset = 0;
+    // Offset of the next byte to be produced by the decompressor
+    vsi_l_offset m_nStreamOffset = 0;
+    // Return value of the last ZSTD_decompressStream() call. 0 when at
+    // a frame boundary.
+    size_t m_nLastRet = 0;
+    bool m_bEndOfStream = false;
+    bool m_bEOF = false;
+    bool m_bError = false;
+
+    bool Rewind();
+    size_t Decompress(void *pBuffer, size_t nSize);
+
+  public:
+    explicit VSIZstdStreamHandle(VSIVirtualHandle *poBaseHandle);
+    ~VSIZstdStreamHandle() override;
+
+    bool IsInitOK() const
+    {
+        return m_psStream != nullptr;
+    }
+
+    int Seek(vsi_l_offset nOffset, int nWhence) override;
+    vsi_l_offset Tell() override;
+    size_t Read(void *pBuffer, size_t nSize, size_t nMemb) override;
+    size_t Write(const void *pBuffer, size_t nSize, size_t nMemb) override;
+    void ClearErr() override;
+    int Eof() override;
+    int Error() override;
+    int Close() override;
+};
+
+/************************************************************************/
+/*                        VSIZstdStreamHandle()                         */
+/************************************************************************/
+
+VSIZstdStreamHandle::VSIZstdStreamHandle(VSIVirtualHandle *poBaseHandle)
+    : m_poBaseHandle(poBaseHandle), m_psStream(ZSTD_createDStream())
+{
+    if (m_psStream)
+    {
+        m_abyIn.resize(ZSTD_DStreamInSize());
+        Rewind();
+    }
+}
+
+/************************************************************************/
+/*                        ~VSIZstdStreamHandle()                        */
+/************************************************************************/
+
+VSIZstdStreamHandle::~VSIZstdStreamHandle()
+{
+    VSIZstdStreamHandle::Close();
+}
+
+/************************************************************************/
+/*                               Close()                                */
+/************************************************************************/
+
+int VSIZstdStreamHandle::Close()
+{
+    if (m_psStream)
+    {
+        ZSTD_freeDStream(m_psStream);
+        m_psStream = nullptr;
+    }
+
+    int nRet = 0;
+    if (m_poBaseHandle)
+    {
+        nRet = m_poBaseHandle->Close();
+        delete m_poBaseHandle;
+        m_poBaseHandle = nullptr;
+    }
+    return nRet;
+}
+
+/************************************************************************/
+/*                               Rewind()                               */
+/************************************************************************/
+
+bool VSIZstdStreamHandle::Rewind()
+{
+    m_sIn.src = m_abyIn.data();
+    m_sIn.size = 0;
+    m_sIn.pos = 0;
+    m_nStreamOffset = 0;
+    m_nLastRet = 0;
+    m_bEndOfStream = false;
+    return !ZSTD_isError(ZSTD_initDStream(m_psStream)) &&
+           m_poBaseHandle->Seek(0, SEEK_SET) == 0;
+}
+
+/************************************************************************/
+/*                             Decompress()                             */
+/************************************************************************/
+
+/** Decompresses up to nSize bytes at m_nStreamOffset. pBuffer may be null
+ * to skip data. Returns the number of bytes produced. */
+size_t VSIZstdStreamHandle::Decompress(void *pBuffer, size_t nSize)
+{
+    std::vector<GByte> abyScratch;
+    if (pBuffer == nullptr)
+    {
+        abyScratch.resize(std::min(nSize, ZSTD_DStreamOutSize()));
+    }
+
+    size_t nProduced = 0;
+    while (nProduced < nSize && !m_bEndOfStream)
+    {
+        if (m_sIn.pos == m_sIn.size)
+        {
+            m_sIn.size = m_poBaseHandle->Read(m_abyIn.data(), 1, m_abyIn.size());
+            m_sIn.pos = 0;
+            if (m_sIn.size == 0)
+            {
+                if (m_nLastRet != 0)
+                {
+                    CPLError(CE_Failure, CPLE_FileIO,
+                             "Truncated Zstandard stream");
+                    m_bError = true;
+                }
+                m_bEndOfStream = true;
+                break;
+            }
+        }
+
+        ZSTD_outBuffer sOut;
+        if (pBuffer)
+        {
+            sOut.dst = static_cast<GByte *>(pBuffer) + nProduced;
+            sOut.size = nSize - nProduced;
+        }
+        else
+        {
+            sOut.dst = abyScratch.data();
+            sOut.size = std::min(nSize - nProduced, abyScratch.size());
+        }
+        sOut.pos = 0;
+        m_nLastRet = ZSTD_decompressStream(m_psStream, &sOut, &m_sIn);
+        if (ZSTD_isError(m_nLastRet))
+        {
+            CPLError(CE_Failure, CPLE_FileIO,
+                     "Error while decompressing Zstandard stream: %s",
+                     ZSTD_getErrorName(m_nLastRet));
+            m_bError = true;
+            m_bEndOfStream = true;
+            m_nLastRet = 0;
+            break;
+        }
+        nProduced += sOut.pos;
+        m_nStreamOffset += sOut.pos;
+    }
+    return nProduced;
+}
+
+/************************************************************************/
+/*                                Read()                                */
+/************************************************************************/
+
+size_t VSIZstdStreamHandle::Read(void *pBuffer, size_t nSize, size_t nMemb)
+{
+    if (nSize == 0 || nMemb == 0 || m_bError)
+        return 0;
+
+    if (m_nCurOffset < m_nStreamOffset && !Rewind())
+    {
+        m_bError = true;
+        return 0;
+    }
+    while (m_nStreamOffset < m_nCurOffset && !m_bEndOfStream)
+    {
+        const vsi_l_offset nToSkip = m_nCurOffset - m_nStreamOffset;
+        Decompress(nullptr,
+                   static_cast<size_t>(std::min<vsi_l_offset>(
+                       nToSkip, std::numeric_limits<size_t>::max())));
+    }
+    if (m_nStreamOffset < m_nCurOffset)
+    {
+        m_bEOF = true;
+        return 0;
+    }
+
+    const size_t nToRead = nSize * nMemb;
+    const size_t nRead = Decompress(pBuffer, nToRead);
+    m_nCurOffset += nRead;
+    if (nRead < nToRead && !m_bError)
+        m_bEOF = true;
+    return nRead / nSize;
+}
+
+/************************************************************************/
+/*                                Seek()                                */
+/************************************************************************/
+
+int VSIZstdStreamHandle::Seek(vsi_l_offset nOffset, int nWhence)
+{
+    m_bEOF = false;
+    if (nWhence == SEEK_SET)
+    {
+        m_nCurOffset = nOffset;
+    }
+    else if (nWhence == SEEK_CUR)
+    {
+        m_nCurOffset += nOffset;
+    }
+    else
+    {
+        // Decompress until the end of the stream to know its size
+        if (m_nCurOffset < m_nStreamOffset && !Rewind())
+            return -1;
+        while (!m_bEndOfStream)
+            Decompress(nullptr, ZSTD_DStreamOutSize());
+        if (m_bError)
+            return -1;
+        m_nCurOffset = m_nStreamOffset + nOffset;
+    }
+    return 0;
+}
+
+/************************************************************************/
+/*                                Tell()                                */
+/************************************************************************/
+
+vsi_l_offset VSIZstdStreamHandle::Tell()
+{
+    return m_nCurOffset;
+}
+
+/************************************************************************/
+/*                               Write()                                */
+/************************************************************************/
+
+size_t VSIZstdStreamHandle::Write(const void * /* pBuffer */,
+                                  size_t /* nSize */, size_t /* nMemb */)
+{
+    CPLError(CE_Failure, CPLE_NotSupported,
+             "VSIFWriteL is not supported on Zstandard streams");
+    return 0;
+}
+
+/************************************************************************/
+/*                                Eof()                                 */
+/************************************************************************/
+
+int VSIZstdStreamHandle::Eof()
+{
+    return m_bEOF;
+}
+
+/************************************************************************/
+/*                               Error()                                */
+/************************************************************************/
+
+int VSIZstdStreamHandle::Error()
+{
+    return m_bError;
+}
+
+/************************************************************************/
+/*                              ClearErr()                              */
+/************************************************************************/
+
+void VSIZstdStreamHandle::ClearErr()
+{
+    m_bEOF = false;
+    m_bError = false;
+}
+
+/************************************************************************/
+/* ==================================================================== */
+/*                       VSIZstdFilesystemHandler                       */
+/* ==================================================================== */
+/************************************************************************/
+
+class VSIZstdFilesystemHandler final : public VSIFilesystemHandler
+{
+    CPL_DISALLOW_COPY_ASSIGN(VSIZstdFilesystemHandler)
+
+    VSIVirtualHandle *OpenZstd(const char *pszFilename, bool &bSeekable);
+
+  public:
+    VSIZstdFilesystemHandler() = default;
+
+    VSIVirtualHandle *Open(const char *pszFilename, const char *pszAccess,
+                           bool bSetError,
+                           CSLConstList /* papszOptions */) override;
+    int Stat(const char *pszFilename, VSIStatBufL *pStatBuf,
+             int nFlags) override;
+
+    const char *GetOptions() override;
+
+    bool SupportsSequentialWrite(const char * /* pszPath */,
+                                 bool /* bAllowLocalTempFile */) override
+    {
+        return false;
+    }
+
+    bool SupportsRandomWrite(const char * /* pszPath */,
+                             bool /* bAllowLocalTempFile */) override
+    {
+        return false;
+    }
+};
+
+/************************************************************************/
+/*                              OpenZstd()                              */
+/************************************************************************/
+
+VSIVirtualHandle *VSIZstdFilesystemHandler::OpenZstd(const char *pszFilename,
+                                                     bool &bSeekable)
+{
+    const char *pszBaseFileName = pszFilename + strlen("/vsizstd/");
+    VSIFilesystemHandler *poFSHandler =
+        VSIFileManager::GetHandler(pszBaseFileName);
+    VSIVirtualHandle *poVirtualHandle =
+        poFSHandler->Open(pszBaseFileName, "rb");
+    if (poVirtualHandle == nullptr)
+        return nullptr;
+
+    GByte abySignature[4] = {0, 0, 0, 0};
+    if (poVirtualHandle->Read(abySignature, 1, 4) != 4 ||
+        ReadUInt32LSB(abySignature) != ZSTD_FRAME_MAGIC)
+    {
+        poVirtualHandle->Close();
+        delete poVirtualHandle;
+        return nullptr;
+    }
+
+    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    int nThreads;
+    if (EQUAL(pszThreads, "ALL_CPUS"))
+        nThreads = CPLGetNumCPUs();
+    else
+        nThreads = atoi(pszThreads);
+    nThreads = GDALCapThreadCount(std::max(1, std::min(128, nThreads)));
+
+    VSIVirtualHandle *poHandle =
+        VSIZstdSeekableHandle::Open(poVirtualHandle, nThreads);
+    if (poHandle)
+    {
+        bSeekable = true;
+        return poHandle;
+    }
+
+    bSeekable = false;
+    auto poStreamHandle = new VSIZstdStreamHandle(poVirtualHandle);
+    if (!poStreamHandle->IsInitOK())
+    {
+        delete poStreamHandle;
+        return nullptr;
+    }
+    return poStreamHandle;
+}
+
+/************************************************************************/
+/*                                Open()                                */
+/************************************************************************/
+
+VSIVirtualHandle *
+VSIZstdFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
+                               bool /* bSetError */,
+                               CSLConstList /* papszOptions */)
+{
+    if (!STARTS_WITH_CI(pszFilename, "/vsizstd/"))
+        return nullptr;
+
+    if (strchr(pszAccess, 'w') != nullptr || strchr(pszAccess, '+') != nullptr)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Only read-only mode is supported for /vsizstd");
+        return nullptr;
+    }
+
+    bool bSeekable = false;
+    VSIVirtualHandle *poHandle = OpenZstd(pszFilename, bSeekable);
+    if (poHandle && !bSeekable)
+    {
+        // Wrap the VSIZstdStreamHandle inside a buffered reader that will
+        // improve dramatically performance when doing small backward
+        // seeks.
+        return VSICreateBufferedReaderHandle(poHandle);
+    }
+    return poHandle;
+}
+
+/************************************************************************/
+/*                                Stat()                                */
+/************************************************************************/
+
+int VSIZstdFilesystemHandler::Stat(const char *pszFilename,
+                                   VSIStatBufL *pStatBuf, int nFlags)
+{
+    if (!STARTS_WITH_CI(pszFilename, "/vsizstd/"))
+        return -1;
+
+    memset(pStatBuf, 0, sizeof(VSIStatBufL));
+
+    // Begin by doing a stat on the real file.
+    int ret = VSIStatExL(pszFilename + strlen("/vsizstd/"), pStatBuf, nFlags);
+
+    if (ret == 0 && (nFlags & VSI_STAT_SIZE_FLAG))
+    {
+        bool bSeekable = false;
+        VSIVirtualHandle *poHandle = OpenZstd(pszFilename, bSeekable);
+        if (poHandle)
+        {
+            // Files in the seekable format know their uncompressed size
+            // from their seek table. Otherwise seek at the end of the data
+            // (slow).
+            if (bSeekable)
+            {
+                pStatBuf->st_size =
+                    cpl::down_cast<VSIZstdSeekableHandle *>(poHandle)
+                        ->GetUncompressedSize();
+            }
+            else if (poHandle->Seek(0, SEEK_END) == 0)
+            {
+                pStatBuf->st_size = poHandle->Tell();
+            }
+            else
+            {
+                ret = -1;
+            }
+            delete poHandle;
+        }
+        else
+        {
+            ret = -1;
+        }
+    }
+
+    return ret;
+}
+
+/************************************************************************/
+/*                             GetOptions()                             */
+/************************************************************************/
+
+const char *VSIZstdFilesystemHandler::GetOptions()
+{
+    return "<Options>"
+           "  <Option name='GDAL_NUM_THREADS' type='string' "
+           "description='Number of threads for decompression of files in the "
+           "seekable format. Either a integer or ALL_CPUS'/>"
+           "</Options>";
+}
+
+//! @endcond
+
+/************************************************************************/
+/*                    VSIInstallZstdFileHandler()                       */
+/************************************************************************/
+
+/*!
+ \brief Install /vsizstd/ Zstandard file system handler (requires libzstd)
+
+ A special file handler is installed that allows reading on-the-fly
+ Zstandard (.zst) files, with random access and multi-threaded
+ decompression for files in the Zstandard seekable format.
+
+ All portions of the file system underneath the base
+ path "/vsizstd/" will be handled by this driver.
+
+ \verbatim embed:rst
+ See :ref:`/vsizstd/ documentation <vsizstd>`
+ \endverbatim
+
+ @since GDAL 3.10
+ */
+void VSIInstallZstdFileHandler(void)
+{
+    VSIFileManager::InstallHandler("/vsizstd/", new VSIZstdFilesystemHandler);
+}
+
+#endif
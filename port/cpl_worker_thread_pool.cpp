@@ -29,20 +29,37 @@
 #include "cpl_port.h"
 #include "cpl_worker_thread_pool.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <deque>
 #include <memory>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_runtime_metrics.h"
 #include "cpl_vsi.h"
 
 struct CPLWorkerThreadJob
 {
     CPLThreadFunc pfnFunc;
     void *pData;
+    int64_t nSubmitTimeNs;
 };
 
+struct CPLWorkerThreadJobDeque
+{
+    std::mutex m_mutex{};
+    std::deque<CPLWorkerThreadJob> m_aoJobs{};
+    // Number of jobs in m_aoJobs, so that empty deques can be skipped
+    // without taking their mutex.
+    std::atomic<int> m_nSize{0};
+};
+
+// Maximum number of job deques of a pool
+constexpr int MAX_JOB_DEQUES = 64;
+
 static thread_local CPLWorkerThreadPool *threadLocalCurrentThreadPool = nullptr;
+static thread_local int threadLocalCurrentDequeIdx = 0;
 
 /************************************************************************/
 /*                         CPLWorkerThreadPool()                        */
@@ -54,7 +71,11 @@ static thread_local CPLWorkerThreadPool *threadLocalCurrentThreadPool = nullptr;
  * must be called.
  */
 CPLWorkerThreadPool::CPLWorkerThreadPool()
+    : m_poInjectionQueue(std::make_unique<CPLWorkerThreadJobDeque>())
 {
+    const int nDeques = std::max(1, std::min(CPLGetNumCPUs(), MAX_JOB_DEQUES));
+    for (int i = 0; i < nDeques; ++i)
+        m_apoDeques.emplace_back(std::make_unique<CPLWorkerThreadJobDeque>());
 }
 
 /************************************************************************/
@@ -96,21 +117,25 @@ void CPLWorkerThreadPool::WorkerThreadFunction(void *user_data)
     CPLWorkerThreadPool *poTP = psWT->poTP;
 
     threadLocalCurrentThreadPool = poTP;
+    threadLocalCurrentDequeIdx = psWT->nDequeIdx;
 
     if (psWT->pfnInitFunc)
         psWT->pfnInitFunc(psWT->pInitData);
 
-    while (true)
+    CPLWorkerThreadJob sJob;
+    while (poTP->GetNextJob(psWT, sJob))
     {
-        CPLWorkerThreadJob *psJob = poTP->GetNextJob(psWT);
-        if (psJob == nullptr)
-            break;
-
-        if (psJob->pfnFunc)
+        if (sJob.pfnFunc)
         {
-            psJob->pfnFunc(psJob->pData);
+            const int64_t nStartNs = CPLRuntimeMetricNowNs();
+            CPLRuntimeMetricAdd(CPLRuntimeMetric::THREAD_POOL_JOBS_STARTED);
+            CPLRuntimeMetricAdd(CPLRuntimeMetric::THREAD_POOL_JOB_WAIT_NS,
+                                nStartNs - sJob.nSubmitTimeNs);
+            sJob.pfnFunc(sJob.pData);
+            CPLRuntimeMetricAdd(CPLRuntimeMetric::THREAD_POOL_JOB_RUN_NS,
+                                CPLRuntimeMetricNowNs() - nStartNs);
+            CPLRuntimeMetricAdd(CPLRuntimeMetric::THREAD_POOL_JOBS_COMPLETED);
         }
-        CPLFree(psJob);
 #if DEBUG_VERBOSE
         CPLDebug("JOB", "%p finished a job", psWT);
 #endif
@@ -118,6 +143,117 @@ void CPLWorkerThreadPool::WorkerThreadFunction(void *user_data)
     }
 }
 
+/************************************************************************/
+/*                            StartThread()                             */
+/************************************************************************/
+
+// Must be called with m_mutex held.
+bool CPLWorkerThreadPool::StartThread(CPLThreadFunc pfnInitFunc,
+                                      void *pInitData)
+{
+    std::unique_ptr<CPLWorkerThread> wt(new CPLWorkerThread);
+    wt->pfnInitFunc = pfnInitFunc;
+    wt->pInitData = pInitData;
+    wt->poTP = this;
+    wt->bMarkedAsWaiting = false;
+    wt->nDequeIdx = static_cast<int>(aWT.size() % m_apoDeques.size());
+    wt->hThread = CPLCreateJoinableThread(WorkerThreadFunction, wt.get());
+    if (wt->hThread == nullptr)
+        return false;
+    aWT.emplace_back(std::move(wt));
+    m_nStartedThreads = static_cast<int>(aWT.size());
+    return true;
+}
+
+/************************************************************************/
+/*                              PushJob()                               */
+/************************************************************************/
+
+bool CPLWorkerThreadPool::PushJob(CPLWorkerThreadJobDeque &oDeque, bool bFront,
+                                  CPLThreadFunc pfnFunc, void *pData)
+{
+    nPendingJobs++;
+    try
+    {
+        const CPLWorkerThreadJob sJob{pfnFunc, pData, CPLRuntimeMetricNowNs()};
+        std::lock_guard<std::mutex> oGuard(oDeque.m_mutex);
+        if (bFront)
+            oDeque.m_aoJobs.push_front(sJob);
+        else
+            oDeque.m_aoJobs.push_back(sJob);
+        oDeque.m_nSize++;
+        m_nQueuedJobs++;
+    }
+    catch (const std::exception &)
+    {
+        nPendingJobs--;
+        CPLError(CE_Failure, CPLE_OutOfMemory, "Cannot queue job");
+        return false;
+    }
+    CPLRuntimeMetricAdd(CPLRuntimeMetric::THREAD_POOL_JOBS_SUBMITTED);
+    return true;
+}
+
+/************************************************************************/
+/*                               PopJob()                               */
+/************************************************************************/
+
+bool CPLWorkerThreadPool::PopJob(CPLWorkerThreadJobDeque &oDeque, bool bBack,
+                                 CPLWorkerThreadJob &sJob)
+{
+    if (oDeque.m_nSize == 0)
+        return false;
+    std::lock_guard<std::mutex> oGuard(oDeque.m_mutex);
+    if (oDeque.m_aoJobs.empty())
+        return false;
+    if (bBack)
+    {
+        sJob = oDeque.m_aoJobs.back();
+        oDeque.m_aoJobs.pop_back();
+    }
+    else
+    {
+        sJob = oDeque.m_aoJobs.front();
+        oDeque.m_aoJobs.pop_front();
+    }
+    oDeque.m_nSize--;
+    m_nQueuedJobs--;
+    return true;
+}
+
+/************************************************************************/
+/*                     WakeUpWaitingWorkerThread()                      */
+/************************************************************************/
+
+// Must be called with oGuard locked on m_mutex, and
+// psWaitingWorkerThreadsList not empty. oGuard is unlocked on return.
+void CPLWorkerThreadPool::WakeUpWaitingWorkerThread(
+    std::unique_lock<std::mutex> &oGuard)
+{
+    CPLWorkerThread *psWorkerThread =
+        static_cast<CPLWorkerThread *>(psWaitingWorkerThreadsList->pData);
+
+    CPLAssert(psWorkerThread->bMarkedAsWaiting);
+    psWorkerThread->bMarkedAsWaiting = false;
+
+    CPLList *psNext = psWaitingWorkerThreadsList->psNext;
+    CPLList *psToFree = psWaitingWorkerThreadsList;
+    psWaitingWorkerThreadsList = psNext;
+    nWaitingWorkerThreads--;
+
+#if DEBUG_VERBOSE
+    CPLDebug("JOB", "Waking up %p", psWorkerThread);
+#endif
+
+    {
+        std::lock_guard<std::mutex> oGuardWT(psWorkerThread->m_mutex);
+        oGuard.unlock();
+        psWorkerThread->m_cv.notify_one();
+    }
+
+    CPLFree(psToFree);
+}
+
 /************************************************************************/
 /*                             SubmitJob()                              */
 /************************************************************************/
@@ -133,6 +269,7 @@ bool CPLWorkerThreadPool::SubmitJob(CPLThreadFunc pfnFunc, void *pData)
     CPLAssert(m_nMaxThreads > 0);
 
     bool bMustIncrementWaitingWorkerThreadsAfterSubmission = false;
+    CPLWorkerThreadJobDeque *poDeque = m_poInjectionQueue.get();
     if (threadLocalCurrentThreadPool == this)
     {
         // If there are waiting threads or we have not started all allowed
@@ -152,93 +289,49 @@ bool CPLWorkerThreadPool::SubmitJob(CPLThreadFunc pfnFunc, void *pData)
             pfnFunc(pData);
             return true;
         }
+        // Jobs submitted from a worker go to the front of its own deque,
+        // where they are likely to be taken while their data is still hot.
+        poDeque = m_apoDeques[threadLocalCurrentDequeIdx].get();
     }
 
-    CPLWorkerThreadJob *psJob = static_cast<CPLWorkerThreadJob *>(
-        VSI_MALLOC_VERBOSE(sizeof(CPLWorkerThreadJob)));
-    if (psJob == nullptr)
+    if (m_nStartedThreads < m_nMaxThreads)
     {
-        if (bMustIncrementWaitingWorkerThreadsAfterSubmission)
+        std::lock_guard<std::mutex> oGuard(m_mutex);
+        if (static_cast<int>(aWT.size()) < m_nMaxThreads)
         {
-            std::unique_lock<std::mutex> oGuard(m_mutex);
-            nWaitingWorkerThreads++;
+            // CPLDebug("CPL", "Starting new thread...");
+            if (!StartThread(nullptr, nullptr))
+            {
+                if (bMustIncrementWaitingWorkerThreadsAfterSubmission)
+                    nWaitingWorkerThreads++;
+                return false;
+            }
         }
-        return false;
     }
-    psJob->pfnFunc = pfnFunc;
-    psJob->pData = pData;
 
-    CPLList *psItem =
-        static_cast<CPLList *>(VSI_MALLOC_VERBOSE(sizeof(CPLList)));
-    if (psItem == nullptr)
+    if (!PushJob(*poDeque, bMustIncrementWaitingWorkerThreadsAfterSubmission,
+                 pfnFunc, pData))
     {
-        VSIFree(psJob);
         if (bMustIncrementWaitingWorkerThreadsAfterSubmission)
         {
-            std::unique_lock<std::mutex> oGuard(m_mutex);
+            std::lock_guard<std::mutex> oGuard(m_mutex);
             nWaitingWorkerThreads++;
         }
         return false;
     }
-    psItem->pData = psJob;
-
-    std::unique_lock<std::mutex> oGuard(m_mutex);
-
-    if (bMustIncrementWaitingWorkerThreadsAfterSubmission)
-        nWaitingWorkerThreads++;
 
-    if (static_cast<int>(aWT.size()) < m_nMaxThreads)
+    // Only take the pool mutex if there is a sleeping worker to wake up.
+    // PushJob() increments m_nQueuedJobs before nWaitingWorkerThreads is
+    // read here, and GetNextJob() increments nWaitingWorkerThreads before
+    // reading m_nQueuedJobs, so that at least one side sees the other.
+    if (bMustIncrementWaitingWorkerThreadsAfterSubmission ||
+        nWaitingWorkerThreads > 0)
     {
-        // CPLDebug("CPL", "Starting new thread...");
-        std::unique_ptr<CPLWorkerThread> wt(new CPLWorkerThread);
-        wt->pfnInitFunc = nullptr;
-        wt->pInitData = nullptr;
-        wt->poTP = this;
-        wt->bMarkedAsWaiting = false;
-        wt->hThread = CPLCreateJoinableThread(WorkerThreadFunction, wt.get());
-        if (wt->hThread == nullptr)
-        {
-            VSIFree(psJob);
-            VSIFree(psItem);
-            return false;
-        }
-        else
-        {
-            aWT.emplace_back(std::move(wt));
-        }
-    }
-
-    psItem->psNext = psJobQueue;
-    psJobQueue = psItem;
-    nPendingJobs++;
-
-    if (psWaitingWorkerThreadsList)
-    {
-        CPLWorkerThread *psWorkerThread =
-            static_cast<CPLWorkerThread *>(psWaitingWorkerThreadsList->pData);
-
-        CPLAssert(psWorkerThread->bMarkedAsWaiting);
-        psWorkerThread->bMarkedAsWaiting = false;
-
-        CPLList *psNext = psWaitingWorkerThreadsList->psNext;
-        CPLList *psToFree = psWaitingWorkerThreadsList;
-        psWaitingWorkerThreadsList = psNext;
-        nWaitingWorkerThreads--;
-
-        // CPLAssert(
-        //   CPLListCount(psWaitingWorkerThreadsList) == nWaitingWorkerThreads);
-
-#if DEBUG_VERBOSE
-        CPLDebug("JOB", "Waking up %p", psWorkerThread);
-#endif
-
-        {
-            std::lock_guard<std::mutex> oGuardWT(psWorkerThread->m_mutex);
-            oGuard.unlock();
-            psWorkerThread->m_cv.notify_one();
-        }
-
-        CPLFree(psToFree);
+        std::unique_lock<std::mutex> oGuard(m_mutex);
+        if (bMustIncrementWaitingWorkerThreadsAfterSubmission)
+            nWaitingWorkerThreads++;
+        if (psWaitingWorkerThreadsList)
+            WakeUpWaitingWorkerThread(oGuard);
     }
 
     return true;
@@ -270,110 +363,44 @@ bool CPLWorkerThreadPool::SubmitJobs(CPLThreadFunc pfnFunc,
         return true;
     }
 
-    std::unique_lock<std::mutex> oGuard(m_mutex);
-
-    CPLList *psJobQueueInit = psJobQueue;
-    bool bRet = true;
-
-    for (size_t i = 0; i < apData.size(); i++)
     {
-        if (static_cast<int>(aWT.size()) < m_nMaxThreads)
+        std::lock_guard<std::mutex> oGuard(m_mutex);
+        for (size_t i = 0;
+             i < apData.size() && static_cast<int>(aWT.size()) < m_nMaxThreads;
+             i++)
         {
-            std::unique_ptr<CPLWorkerThread> wt(new CPLWorkerThread);
-            wt->pfnInitFunc = nullptr;
-            wt->pInitData = nullptr;
-            wt->poTP = this;
-            wt->bMarkedAsWaiting = false;
-            wt->hThread =
-                CPLCreateJoinableThread(WorkerThreadFunction, wt.get());
-            if (wt->hThread == nullptr)
+            if (!StartThread(nullptr, nullptr))
             {
                 if (aWT.empty())
                     return false;
-            }
-            else
-            {
-                aWT.emplace_back(std::move(wt));
+                break;
             }
         }
-
-        CPLWorkerThreadJob *psJob = static_cast<CPLWorkerThreadJob *>(
-            VSI_MALLOC_VERBOSE(sizeof(CPLWorkerThreadJob)));
-        if (psJob == nullptr)
-        {
-            bRet = false;
-            break;
-        }
-        psJob->pfnFunc = pfnFunc;
-        psJob->pData = apData[i];
-
-        CPLList *psItem =
-            static_cast<CPLList *>(VSI_MALLOC_VERBOSE(sizeof(CPLList)));
-        if (psItem == nullptr)
-        {
-            VSIFree(psJob);
-            bRet = false;
-            break;
-        }
-        psItem->pData = psJob;
-
-        psItem->psNext = psJobQueue;
-        psJobQueue = psItem;
-        nPendingJobs++;
-    }
-
-    if (!bRet)
-    {
-        for (CPLList *psIter = psJobQueue; psIter != psJobQueueInit;)
-        {
-            CPLList *psNext = psIter->psNext;
-            VSIFree(psIter->pData);
-            VSIFree(psIter);
-            nPendingJobs--;
-            psIter = psNext;
-        }
-        return false;
     }
 
     for (size_t i = 0; i < apData.size(); i++)
     {
-        if (psWaitingWorkerThreadsList && psJobQueue)
+        if (!PushJob(*m_poInjectionQueue, false, pfnFunc, apData[i]))
         {
-            CPLWorkerThread *psWorkerThread;
-
-            psWorkerThread = static_cast<CPLWorkerThread *>(
-                psWaitingWorkerThreadsList->pData);
-
-            CPLAssert(psWorkerThread->bMarkedAsWaiting);
-            psWorkerThread->bMarkedAsWaiting = false;
-
-            CPLList *psNext = psWaitingWorkerThreadsList->psNext;
-            CPLList *psToFree = psWaitingWorkerThreadsList;
-            psWaitingWorkerThreadsList = psNext;
-            nWaitingWorkerThreads--;
-
-            // CPLAssert(
-            //    CPLListCount(psWaitingWorkerThreadsList) ==
-            //    nWaitingWorkerThreads);
-
-#if DEBUG_VERBOSE
-            CPLDebug("JOB", "Waking up %p", psWorkerThread);
-#endif
+            // Run the jobs that could not be queued, so that the caller
+            // finds all of them processed when the queued ones complete.
+            for (; i < apData.size(); i++)
             {
-                std::lock_guard<std::mutex> oGuardWT(psWorkerThread->m_mutex);
-                oGuard.unlock();
-                psWorkerThread->m_cv.notify_one();
+                pfnFunc(apData[i]);
             }
-
-            CPLFree(psToFree);
-            oGuard.lock();
-        }
-        else
-        {
             break;
         }
     }
 
+    std::unique_lock<std::mutex> oGuard(m_mutex);
+    for (size_t i = 0;
+         i < apData.size() && psWaitingWorkerThreadsList && m_nQueuedJobs > 0;
+         i++)
+    {
+        WakeUpWaitingWorkerThread(oGuard);
+        oGuard.lock();
+    }
+
     return true;
 }
 
@@ -391,11 +418,15 @@ void CPLWorkerThreadPool::WaitCompletion(int nMaxRemainingJobs)
 {
     if (nMaxRemainingJobs < 0)
         nMaxRemainingJobs = 0;
+    if (nPendingJobs <= nMaxRemainingJobs)
+        return;
     std::unique_lock<std::mutex> oGuard(m_mutex);
+    m_nWaitersOnCV++;
     while (nPendingJobs > nMaxRemainingJobs)
     {
         m_cv.wait(oGuard);
     }
+    m_nWaitersOnCV--;
 }
 
 /************************************************************************/
@@ -407,6 +438,7 @@ void CPLWorkerThreadPool::WaitCompletion(int nMaxRemainingJobs)
 void CPLWorkerThreadPool::WaitEvent()
 {
     std::unique_lock<std::mutex> oGuard(m_mutex);
+    m_nWaitersOnCV++;
     while (true)
     {
         const int nPendingJobsBefore = nPendingJobs;
@@ -421,6 +453,7 @@ void CPLWorkerThreadPool::WaitEvent()
             break;
         }
     }
+    m_nWaitersOnCV--;
 }
 
 /************************************************************************/
@@ -455,7 +488,7 @@ bool CPLWorkerThreadPool::Setup(int nThreads, CPLThreadFunc pfnInitFunc,
 {
     CPLAssert(nThreads > 0);
 
-    if (nThreads > static_cast<int>(aWT.size()) && pfnInitFunc == nullptr &&
+    if (nThreads > m_nStartedThreads && pfnInitFunc == nullptr &&
         pasInitData == nullptr && !bWaitallStarted)
     {
         std::lock_guard<std::mutex> oGuard(m_mutex);
@@ -465,25 +498,19 @@ bool CPLWorkerThreadPool::Setup(int nThreads, CPLThreadFunc pfnInitFunc,
     }
 
     bool bRet = true;
-    for (int i = static_cast<int>(aWT.size()); i < nThreads; i++)
     {
-        std::unique_ptr<CPLWorkerThread> wt(new CPLWorkerThread);
-        wt->pfnInitFunc = pfnInitFunc;
-        wt->pInitData = pasInitData ? pasInitData[i] : nullptr;
-        wt->poTP = this;
-        wt->bMarkedAsWaiting = false;
-        wt->hThread = CPLCreateJoinableThread(WorkerThreadFunction, wt.get());
-        if (wt->hThread == nullptr)
+        std::lock_guard<std::mutex> oGuard(m_mutex);
+        for (int i = static_cast<int>(aWT.size()); i < nThreads; i++)
         {
-            nThreads = i;
-            bRet = false;
-            break;
+            if (!StartThread(pfnInitFunc,
+                             pasInitData ? pasInitData[i] : nullptr))
+            {
+                nThreads = i;
+                bRet = false;
+                break;
+            }
         }
-        aWT.emplace_back(std::move(wt));
-    }
 
-    {
-        std::lock_guard<std::mutex> oGuard(m_mutex);
         if (nThreads > m_nMaxThreads)
             m_nMaxThreads = nThreads;
     }
@@ -492,10 +519,12 @@ bool CPLWorkerThreadPool::Setup(int nThreads, CPLThreadFunc pfnInitFunc,
     {
         // Wait all threads to be started
         std::unique_lock<std::mutex> oGuard(m_mutex);
+        m_nWaitersOnCV++;
         while (nWaitingWorkerThreads < nThreads)
         {
             m_cv.wait(oGuard);
         }
+        m_nWaitersOnCV--;
     }
 
     if (eState == CPLWTS_ERROR)
@@ -510,54 +539,74 @@ bool CPLWorkerThreadPool::Setup(int nThreads, CPLThreadFunc pfnInitFunc,
 
 void CPLWorkerThreadPool::DeclareJobFinished()
 {
-    std::lock_guard<std::mutex> oGuard(m_mutex);
     nPendingJobs--;
-    m_cv.notify_one();
+    // Same reasoning as in SubmitJob(): waiters increment m_nWaitersOnCV
+    // before checking nPendingJobs.
+    if (m_nWaitersOnCV > 0)
+    {
+        std::lock_guard<std::mutex> oGuard(m_mutex);
+        m_cv.notify_all();
+    }
 }
 
 /************************************************************************/
 /*                             GetNextJob()                             */
 /************************************************************************/
 
-CPLWorkerThreadJob *
-CPLWorkerThreadPool::GetNextJob(CPLWorkerThread *psWorkerThread)
+bool CPLWorkerThreadPool::GetNextJob(CPLWorkerThread *psWorkerThread,
+                                     CPLWorkerThreadJob &sJob)
 {
+    const int nDeques = static_cast<int>(m_apoDeques.size());
     while (true)
     {
-        std::unique_lock<std::mutex> oGuard(m_mutex);
-        if (eState == CPLWTS_STOP)
+        // Take the most recent job submitted by this worker, then the oldest
+        // job submitted by other threads, so that they start in submission
+        // order. Otherwise steal the oldest job of another worker, from the
+        // back of its deque, to limit interference with its owner.
+        if (PopJob(*m_apoDeques[psWorkerThread->nDequeIdx], false, sJob) ||
+            PopJob(*m_poInjectionQueue, false, sJob))
         {
-            return nullptr;
+#if DEBUG_VERBOSE
+            CPLDebug("JOB", "%p got a job", psWorkerThread);
+#endif
+            return true;
         }
-        CPLList *psTopJobIter = psJobQueue;
-        if (psTopJobIter)
+        // Only deques owned by a started worker can hold jobs.
+        const int nOwnedDeques = std::min<int>(nDeques, m_nStartedThreads);
+        for (int i = 0; i < nOwnedDeques; ++i)
         {
-            psJobQueue = psTopJobIter->psNext;
-
+            const int iDeque = (psWorkerThread->nDequeIdx + i) % nOwnedDeques;
+            if (iDeque != psWorkerThread->nDequeIdx &&
+                PopJob(*m_apoDeques[iDeque], true, sJob))
+            {
 #if DEBUG_VERBOSE
-            CPLDebug("JOB", "%p got a job", psWorkerThread);
+                CPLDebug("JOB", "%p stole a job", psWorkerThread);
 #endif
-            CPLWorkerThreadJob *psJob =
-                static_cast<CPLWorkerThreadJob *>(psTopJobIter->pData);
-            CPLFree(psTopJobIter);
-            return psJob;
+                return true;
+            }
         }
 
-        if (!psWorkerThread->bMarkedAsWaiting)
+        std::unique_lock<std::mutex> oGuard(m_mutex);
+        if (eState == CPLWTS_STOP)
         {
-            psWorkerThread->bMarkedAsWaiting = true;
-            nWaitingWorkerThreads++;
+            return false;
+        }
 
+        if (!psWorkerThread->bMarkedAsWaiting)
+        {
             CPLList *psItem =
                 static_cast<CPLList *>(VSI_MALLOC_VERBOSE(sizeof(CPLList)));
             if (psItem == nullptr)
             {
                 eState = CPLWTS_ERROR;
-                m_cv.notify_one();
+                m_cv.notify_all();
 
-                return nullptr;
+                return false;
             }
 
+            psWorkerThread->bMarkedAsWaiting = true;
+            nWaitingWorkerThreads++;
+
             psItem->pData = psWorkerThread;
             psItem->psNext = psWaitingWorkerThreadsList;
             psWaitingWorkerThreadsList = psItem;
@@ -566,9 +615,21 @@ CPLWorkerThreadPool::GetNextJob(CPLWorkerThread *psWorkerThread)
             CPLAssert(CPLListCount(psWaitingWorkerThreadsList) ==
                       nWaitingWorkerThreads);
 #endif
+
+            // A job may have been queued by a thread that did not see us
+            // waiting yet: unregister and go fetch it.
+            if (m_nQueuedJobs > 0)
+            {
+                psWorkerThread->bMarkedAsWaiting = false;
+                psWaitingWorkerThreadsList = psItem->psNext;
+                CPLFree(psItem);
+                nWaitingWorkerThreads--;
+                continue;
+            }
         }
 
-        m_cv.notify_one();
+        if (m_nWaitersOnCV > 0)
+            m_cv.notify_all();
 
 #if DEBUG_VERBOSE
         CPLDebug("JOB", "%p sleeping", psWorkerThread);
@@ -33,6 +33,7 @@
 #include "cpl_multiproc.h"
 #include "cpl_list.h"
 
+#include <atomic>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
@@ -47,6 +48,7 @@
 
 #ifndef DOXYGEN_SKIP
 struct CPLWorkerThreadJob;
+struct CPLWorkerThreadJobDeque;
 class CPLWorkerThreadPool;
 
 struct CPLWorkerThread
@@ -59,6 +61,7 @@ struct CPLWorkerThread
     CPLWorkerThreadPool *poTP = nullptr;
     CPLJoinableThread *hThread = nullptr;
     bool bMarkedAsWaiting = false;
+    int nDequeIdx = 0;
 
     std::mutex m_mutex{};
     std::condition_variable m_cv{};
@@ -83,18 +86,33 @@ class CPL_DLL CPLWorkerThreadPool
     std::mutex m_mutex{};
     std::condition_variable m_cv{};
     volatile CPLWorkerThreadState eState = CPLWTS_OK;
-    CPLList *psJobQueue = nullptr;
-    int nPendingJobs = 0;
+
+    // One job deque per worker slot, where the jobs submitted by that worker
+    // are queued. Workers take jobs from their own deque, then from the FIFO
+    // queue of jobs submitted by other threads, and steal from the other
+    // deques when both are empty.
+    std::vector<std::unique_ptr<CPLWorkerThreadJobDeque>> m_apoDeques{};
+    std::unique_ptr<CPLWorkerThreadJobDeque> m_poInjectionQueue;
+    std::atomic<int> m_nQueuedJobs{0};
+    std::atomic<int> nPendingJobs{0};
+    std::atomic<int> m_nWaitersOnCV{0};
+    std::atomic<int> m_nStartedThreads{0};
 
     CPLList *psWaitingWorkerThreadsList = nullptr;
-    int nWaitingWorkerThreads = 0;
+    std::atomic<int> nWaitingWorkerThreads{0};
 
-    int m_nMaxThreads = 0;
+    std::atomic<int> m_nMaxThreads{0};
 
     static void WorkerThreadFunction(void *user_data);
 
+    bool StartThread(CPLThreadFunc pfnInitFunc, void *pInitData);
+    bool PushJob(CPLWorkerThreadJobDeque &oDeque, bool bFront,
+                 CPLThreadFunc pfnFunc, void *pData);
+    bool PopJob(CPLWorkerThreadJobDeque &oDeque, bool bBack,
+                CPLWorkerThreadJob &sJob);
+    void WakeUpWaitingWorkerThread(std::unique_lock<std::mutex> &oGuard);
     void DeclareJobFinished();
-    CPLWorkerThreadJob *GetNextJob(CPLWorkerThread *psWorkerThread);
+    bool GetNextJob(CPLWorkerThread *psWorkerThread, CPLWorkerThreadJob &sJob);
 
   public:
     CPLWorkerThreadPool();
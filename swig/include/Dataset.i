@@ -300,6 +300,10 @@ public:
     return (GDALRasterBandShadow*) GDALGetRasterBand( self, nBand );
   }
 
+  bool IsThreadSafe(int nScopeFlags) {
+      return GDALDatasetIsThreadSafe(self, nScopeFlags, NULL);
+  }
+
 %newobject GetRootGroup;
   GDALGroupHS* GetRootGroup() {
     return GDALDatasetGetRootGroup(self);
@@ -462,6 +466,18 @@ public:
     return GDALFlushCache( self );
   }
 
+  void SetCacheBudget( GIntBig budget ) {
+    GDALDatasetSetCacheBudget( self, budget );
+  }
+
+  GIntBig GetCacheBudget() {
+    return GDALDatasetGetCacheBudget( self );
+  }
+
+  GIntBig GetCacheUsed() {
+    return GDALDatasetGetCacheUsed( self );
+  }
+
 #ifndef SWIGJAVA
 %feature ("kwargs") AddBand;
 #endif
@@ -214,6 +214,7 @@ void CPL_STDCALL PyCPLErrorHandler(CPLErr eErrClass, CPLErrorNum err_no, const c
 %rename (HasThreadSupport) wrapper_HasThreadSupport;
 %rename (NetworkStatsReset) VSINetworkStatsReset;
 %rename (NetworkStatsGetAsSerializedJSON) VSINetworkStatsGetAsSerializedJSON;
+%rename (GetIOStatistics) VSIGetIOStatistics;
 
 %apply Pointer NONNULL {const char *pszScope};
 retStringAndCPLFree*
@@ -976,6 +977,7 @@ void VSICurlPartialClearCache( const char* utf8_path );
 
 void VSINetworkStatsReset();
 retStringAndCPLFree* VSINetworkStatsGetAsSerializedJSON( char** options = NULL );
+retStringAndCPLFree* VSIGetIOStatistics( const char* prefix = NULL, char** options = NULL );
 
 #endif /* !defined(SWIGJAVA) */
 
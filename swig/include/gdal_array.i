@@ -883,6 +883,59 @@ retStringAndCPLFree* GetArrayFilename(PyArrayObject *psArray)
 %}
 %clear (int band_list, int *pband_list );
 
+%apply (int nList, int* pList) { (int nWindowValues, int *panWindows) };
+%feature( "kwargs" ) BandReadWindowsNumPy;
+%inline %{
+  CPLErr BandReadWindowsNumPy( GDALRasterBandShadow* band,
+                               int nWindowValues, int *panWindows,
+                               PyArrayObject *psArray,
+                               GDALDataType buf_type,
+                               GDALRIOResampleAlg resample_alg) {
+
+    if( PyArray_NDIM(psArray) != 3 )
+    {
+        CPLError( CE_Failure, CPLE_AppDefined,
+                  "Illegal numpy array rank %d.\n",
+                  PyArray_NDIM(psArray) );
+        return CE_Failure;
+    }
+
+    if( !(PyArray_FLAGS(psArray) & NPY_ARRAY_WRITEABLE) )
+    {
+        CPLError( CE_Failure, CPLE_AppDefined,
+                  "Cannot read in a non-writeable array." );
+        return CE_Failure;
+    }
+
+    if( (nWindowValues % 4) != 0 ||
+        PyArray_DIMS(psArray)[0] != nWindowValues / 4 )
+    {
+        CPLError( CE_Failure, CPLE_AppDefined,
+                  "Number of windows inconsistent with array shape." );
+        return CE_Failure;
+    }
+
+    if( PyArray_DIMS(psArray)[1] > INT_MAX ||
+        PyArray_DIMS(psArray)[2] > INT_MAX )
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                    "Too big array dimensions");
+        return CE_Failure;
+    }
+
+    return GDALRasterReadWindows( band, nWindowValues / 4, panWindows,
+                                  PyArray_DATA(psArray),
+                                  static_cast<int>(PyArray_DIMS(psArray)[2]),
+                                  static_cast<int>(PyArray_DIMS(psArray)[1]),
+                                  buf_type,
+                                  PyArray_STRIDES(psArray)[2],
+                                  PyArray_STRIDES(psArray)[1],
+                                  PyArray_STRIDES(psArray)[0],
+                                  resample_alg );
+  }
+%}
+%clear (int nWindowValues, int *panWindows);
+
 %{
 static bool CheckNumericDataType(GDALExtendedDataTypeHS* dt)
 {
@@ -1995,6 +2048,84 @@ PyObject* _RecordBatchAsNumpy(VoidPtrAsLong recordBatchPtr,
 
 %}
 
+%{
+static void BlockViewCapsuleDestructor(PyObject* capsule)
+{
+    delete static_cast<GDALRasterBlockView*>(
+        PyCapsule_GetPointer(capsule, "GDALRasterBlockView"));
+    /* Release the reference to the band */
+    Py_XDECREF(static_cast<PyObject*>(PyCapsule_GetContext(capsule)));
+}
+%}
+
+%inline %{
+/* Internal method used by gdal.Band.GetBlockViewArray() */
+PyObject* _BandGetBlockViewAsNumpy(GDALRasterBandShadow* band,
+                                   int xoff, int yoff,
+                                   PyObject* bandKeeper)
+{
+    GDALRasterBlockView oView;
+    Py_BEGIN_ALLOW_THREADS
+    oView = GDALRasterBand::FromHandle(band)->GetBlockView(xoff, yoff);
+    Py_END_ALLOW_THREADS
+    if( !oView )
+    {
+        Py_RETURN_NONE;
+    }
+
+    int numpytype;
+    switch( oView.GetDataType() )
+    {
+        case GDT_Byte: numpytype = NPY_UBYTE; break;
+        case GDT_Int8: numpytype = NPY_INT8; break;
+        case GDT_Int16: numpytype = NPY_INT16; break;
+        case GDT_UInt16: numpytype = NPY_UINT16; break;
+        case GDT_Int32: numpytype = NPY_INT32; break;
+        case GDT_UInt32: numpytype = NPY_UINT32; break;
+        case GDT_Int64: numpytype = NPY_INT64; break;
+        case GDT_UInt64: numpytype = NPY_UINT64; break;
+        case GDT_Float32: numpytype = NPY_FLOAT32; break;
+        case GDT_Float64: numpytype = NPY_FLOAT64; break;
+        case GDT_CFloat32: numpytype = NPY_CFLOAT; break;
+        case GDT_CFloat64: numpytype = NPY_CDOUBLE; break;
+        default:
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "Data type %s not supported by GetBlockViewArray()",
+                     GDALGetDataTypeName(oView.GetDataType()));
+            Py_RETURN_NONE;
+    }
+
+    npy_intp shape[2] = { oView.GetYSize(), oView.GetXSize() };
+    PyObject* numpyArray = PyArray_SimpleNewFromData(
+        2, shape, numpytype, const_cast<void*>(oView.GetData()));
+    if( numpyArray == NULL )
+        return NULL;
+    /* The block data is shared with the block cache */
+    PyArray_CLEARFLAGS((PyArrayObject *) numpyArray, NPY_ARRAY_WRITEABLE);
+
+    /* The capsule keeps the block locked in the block cache, and a */
+    /* reference to the band, so that its dataset is not closed, as long */
+    /* as the array is alive. */
+    PyObject* capsule = PyCapsule_New(new GDALRasterBlockView(oView),
+                                      "GDALRasterBlockView",
+                                      BlockViewCapsuleDestructor);
+    if( capsule == NULL )
+    {
+        Py_DECREF(numpyArray);
+        return NULL;
+    }
+    Py_INCREF(bandKeeper);
+    PyCapsule_SetContext(capsule, bandKeeper);
+#if NPY_API_VERSION >= 0x00000007
+    PyArray_SetBaseObject((PyArrayObject *) numpyArray, capsule);
+#else
+    PyArray_BASE((PyArrayObject *) numpyArray) = capsule;
+#endif
+    return numpyArray;
+}
+
+%}
+
 %typemap(in,numinputs=0) (CPLVirtualMemShadow** pvirtualmem, int numpytypemap) (CPLVirtualMemShadow* virtualmem)
 {
   $1 = &virtualmem;
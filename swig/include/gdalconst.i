@@ -172,6 +172,7 @@
 %constant OF_UPDATE = GDAL_OF_UPDATE;
 %constant OF_SHARED = GDAL_OF_SHARED;
 %constant OF_VERBOSE_ERROR = GDAL_OF_VERBOSE_ERROR;
+%constant OF_THREAD_SAFE = GDAL_OF_THREAD_SAFE;
 
 #if !defined(SWIGCSHARP) && !defined(SWIGJAVA)
 
@@ -181,6 +182,7 @@
 %constant char *DMD_EXTENSION          = GDAL_DMD_EXTENSION;
 %constant char *DMD_CONNECTION_PREFIX  = GDAL_DMD_CONNECTION_PREFIX;
 %constant char *DMD_EXTENSIONS         = GDAL_DMD_EXTENSIONS;
+%constant char *DMD_MAGIC_BYTES        = GDAL_DMD_MAGIC_BYTES;
 %constant char *DMD_CREATIONOPTIONLIST = GDAL_DMD_CREATIONOPTIONLIST;
 %constant char *DMD_MULTIDIM_DATASET_CREATIONOPTIONLIST         = GDAL_DMD_MULTIDIM_DATASET_CREATIONOPTIONLIST;
 %constant char *DMD_MULTIDIM_GROUP_CREATIONOPTIONLIST         = GDAL_DMD_MULTIDIM_GROUP_CREATIONOPTIONLIST;
@@ -241,6 +243,7 @@
 %constant char *GDAL_DMD_RELATIONSHIP_RELATED_TABLE_TYPES    = GDAL_DMD_RELATIONSHIP_RELATED_TABLE_TYPES;
 %constant char *DCAP_RENAME_LAYERS    = GDAL_DCAP_RENAME_LAYERS;
 %constant char *DCAP_FLUSHCACHE_CONSISTENT_STATE    = GDAL_DCAP_FLUSHCACHE_CONSISTENT_STATE;
+%constant char *DCAP_INDEPENDENT_BLOCK_READS    = GDAL_DCAP_INDEPENDENT_BLOCK_READS;
 
 %constant char *DIM_TYPE_HORIZONTAL_X       = GDAL_DIM_TYPE_HORIZONTAL_X;
 %constant char *DIM_TYPE_HORIZONTAL_Y       = GDAL_DIM_TYPE_HORIZONTAL_Y;
@@ -272,6 +275,8 @@
 #define GDAL_DMD_CONNECTION_PREFIX  "DMD_CONNECTION_PREFIX"
 #define DMD_EXTENSIONS "DMD_EXTENSIONS"
 #define GDAL_DMD_EXTENSIONS "DMD_EXTENSIONS"
+#define DMD_MAGIC_BYTES "DMD_MAGIC_BYTES"
+#define GDAL_DMD_MAGIC_BYTES "DMD_MAGIC_BYTES"
 #define DMD_CREATIONOPTIONLIST "DMD_CREATIONOPTIONLIST"
 #define GDAL_DMD_CREATIONOPTIONLIST "DMD_CREATIONOPTIONLIST"
 #define DMD_MULTIDIM_DATASET_CREATIONOPTIONLIST "DMD_MULTIDIM_DATASET_CREATIONOPTIONLIST"
@@ -391,6 +396,8 @@
 #define GDAL_DCAP_RENAME_LAYERS    "DCAP_RENAME_LAYERS"
 #define DCAP_FLUSHCACHE_CONSISTENT_STATE    "DCAP_FLUSHCACHE_CONSISTENT_STATE"
 #define GDAL_DCAP_FLUSHCACHE_CONSISTENT_STATE    "DCAP_FLUSHCACHE_CONSISTENT_STATE"
+#define DCAP_INDEPENDENT_BLOCK_READS    "DCAP_INDEPENDENT_BLOCK_READS"
+#define GDAL_DCAP_INDEPENDENT_BLOCK_READS    "DCAP_INDEPENDENT_BLOCK_READS"
 
 #define DIM_TYPE_HORIZONTAL_X "HORIZONTAL_X"
 #define GDAL_DIM_TYPE_HORIZONTAL_X "HORIZONTAL_X"
@@ -278,6 +278,42 @@ int
     `gdal.CE_None` in case of success
 ";
 
+%feature("docstring")  SetCacheBudget "
+
+Set the soft budget, in bytes, of this dataset in the global block cache.
+Blocks of datasets exceeding their budget are evicted first when the cache
+is full.
+
+See :cpp:func:`GDALDataset::SetCacheBudget`.
+
+.. versionadded:: 3.10
+
+Parameters
+----------
+budget : int
+    Budget in bytes, or 0 to remove the budget.
+";
+
+%feature("docstring")  GetCacheBudget "
+
+Return the budget, in bytes, of this dataset in the global block cache,
+or 0 if there is none.
+
+See :cpp:func:`GDALDataset::GetCacheBudget`.
+
+.. versionadded:: 3.10
+";
+
+%feature("docstring")  GetCacheUsed "
+
+Return the memory, in bytes, used by the blocks of this dataset in the
+global block cache.
+
+See :cpp:func:`GDALDataset::GetCacheUsed`.
+
+.. versionadded:: 3.10
+";
+
 
 %feature("docstring")  GetDriver "
 
@@ -507,6 +507,14 @@ void wrapper_VSIGetMemFileBuffer(const char *utf8_path, GByte **out, vsi_l_offse
 %clear (GIntBig*);
 %clear (GDALDataType *);
 
+%apply (int nCount, double *x, double *y, double *z) { (int nCount, double *x, double *y, double *values) };
+  CPLErr _SamplePoints( int nCount, double *x, double *y, double *values,
+                        GDALRIOResampleAlg resample_alg = GRIORA_NearestNeighbour ) {
+    return GDALRasterSamplePoints( self, nCount, x, y, resample_alg,
+                                   values, GDT_Float64 );
+  }
+%clear (int nCount, double *x, double *y, double *values);
+
 %apply ( void *inPythonObject ) { (void* buf_obj) };
 %apply ( void **outPythonObject ) { (void **buf ) };
 %feature( "kwargs" ) ReadBlock;
@@ -751,6 +759,142 @@ void wrapper_VSIGetMemFileBuffer(const char *utf8_path, GByte **out, vsi_l_offse
                                         callback=callback,
                                         callback_data=callback_data)
 
+  def SamplePoints(self, points,
+                   resample_alg=gdalconst.GRIORA_NearestNeighbour):
+      """
+      Return the values of the band at a set of locations.
+
+      Points sharing the same blocks are read together, which is much more
+      efficient than one ReadRaster() call per point.
+
+      .. versionadded:: 3.10
+
+      Parameters
+      ----------
+      points : list
+          Sequence of (x, y) tuples, in pixel/line coordinates where (0, 0)
+          is the top-left corner of the top-left pixel.
+      resample_alg : int, default = :py:const:`gdal.GRIORA_NearestNeighbour`
+          :py:const:`gdal.GRIORA_NearestNeighbour` or
+          :py:const:`gdal.GRIORA_Bilinear`.
+
+      Returns
+      -------
+      list:
+          One value per point, NaN for points outside of the raster.
+          For complex bands, the real part.
+      """
+      return [v for _, _, v in self._SamplePoints(points, resample_alg)]
+
+  def ReadWindows(self, windows, buf_xsize=None, buf_ysize=None,
+                  buf_type=None,
+                  resample_alg=gdalconst.GRIORA_NearestNeighbour):
+      """
+      Read several windows of the band into a single NumPy array.
+
+      When the dataset has been opened with :py:const:`gdal.OF_THREAD_SAFE`,
+      the windows are read in parallel by the number of threads set by the
+      ``GDAL_NUM_THREADS`` configuration option (defaults to ``ALL_CPUS``).
+      Otherwise they are read sequentially. The Python global interpreter
+      lock is released during the reads.
+
+      .. versionadded:: 3.10
+
+      Parameters
+      ----------
+      windows : list
+          Sequence of (xoff, yoff, xsize, ysize) tuples.
+      buf_xsize : int, optional
+          Width of the buffer of a window. Defaults to the width of the
+          windows, which must then all have the same width.
+      buf_ysize : int, optional
+          Height of the buffer of a window. Defaults to the height of the
+          windows, which must then all have the same height.
+      buf_type : int, optional
+          Data type of the returned array. Defaults to the band data type.
+      resample_alg : int, default = :py:const:`gdal.GRIORA_NearestNeighbour`
+          Resampling algorithm, used for windows whose size differs from the
+          buffer size.
+
+      Returns
+      -------
+      np.ndarray:
+          Array of shape (len(windows), buf_ysize, buf_xsize)
+      """
+      from osgeo import gdal_array
+      import numpy
+
+      windows = [tuple(int(v) for v in w) for w in windows]
+      for w in windows:
+          if len(w) != 4:
+              raise ValueError("windows must be (xoff, yoff, xsize, ysize) tuples")
+      if buf_xsize is None:
+          sizes = set(w[2] for w in windows)
+          if len(sizes) > 1:
+              raise ValueError("buf_xsize must be specified for windows of different widths")
+          buf_xsize = sizes.pop() if sizes else 0
+      if buf_ysize is None:
+          sizes = set(w[3] for w in windows)
+          if len(sizes) > 1:
+              raise ValueError("buf_ysize must be specified for windows of different heights")
+          buf_ysize = sizes.pop() if sizes else 0
+      if buf_type is None:
+          buf_type = self.DataType
+
+      typecode = gdal_array.GDALTypeCodeToNumericTypeCode(buf_type)
+      if typecode is None:
+          raise ValueError("Unsupported buf_type")
+      buf_obj = numpy.empty([len(windows), buf_ysize, buf_xsize], dtype=typecode)
+      if not windows:
+          return buf_obj
+
+      flat_windows = [v for w in windows for v in w]
+      if gdal_array.BandReadWindowsNumPy(self, flat_windows, buf_obj,
+                                         buf_type, resample_alg) != 0:
+          gdal_array._RaiseException()
+          return None
+      return buf_obj
+
+  def GetBlockViewArray(self, xoff, yoff):
+      """
+      Return a read-only NumPy array sharing the data of a block of the
+      block cache, without copying it.
+
+      The block is loaded in the block cache if needed and is kept locked
+      there as long as the array (or any array derived from it that shares
+      its memory) is alive. Such arrays keep a reference to the band, but
+      they must be released before FlushCache() or Close() is called on
+      the dataset.
+
+      .. versionadded:: 3.10
+
+      Parameters
+      ----------
+      xoff : int
+          Horizontal block offset, with zero indicating the left most block.
+      yoff : int
+          Vertical block offset, with zero indicating the top most block.
+
+      Returns
+      -------
+      np.ndarray:
+          Array of shape (rows, columns) of the valid part of the block,
+          which is smaller than the block size for blocks at the right and
+          bottom edges.
+      """
+      from osgeo import gdal_array
+
+      ar = gdal_array._BandGetBlockViewAsNumpy(self, xoff, yoff, self)
+      if ar is None:
+          gdal_array._RaiseException()
+          return None
+      block_xsize, block_ysize = self.GetBlockSize()
+      valid_xsize = min(block_xsize, self.XSize - xoff * block_xsize)
+      valid_ysize = min(block_ysize, self.YSize - yoff * block_ysize)
+      if valid_xsize != ar.shape[1] or valid_ysize != ar.shape[0]:
+          ar = ar[:valid_ysize, :valid_xsize]
+      return ar
+
   def GetVirtualMemArray(self, eAccess=gdalconst.GF_Read, xoff=0, yoff=0,
                          xsize=None, ysize=None, bufxsize=None, bufysize=None,
                          datatype=None,